@@ -0,0 +1,189 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Micro-benchmark harness.
+ *
+ * Each benchmark is declared with SIMDE_BENCH_FUNC, which takes an
+ * identifier, the return type, the types of up to four inputs (a, b,
+ * c, and d; use int for unused slots), and the expression to time.
+ * Two loops are generated from that:
+ *
+ *  * throughput: eight independent chains are interleaved, so the
+ *    result is limited by how many calls can be in flight at once.
+ *  * latency: a single chain where each call depends on the previous
+ *    one, so the result is limited by the latency of the call.
+ *
+ * In both cases the result of each call is copied back over the
+ * first input (a).  If the types differ only the leading bytes are
+ * copied, and the cost of moving the value between register files
+ * will be included in the latency number.  Functions which don't
+ * take a value input (loads) or don't return one (stores) should be
+ * registered with SIMDE_BENCH_ENTRY_THROUGHPUT since there is no
+ * chain for the latency loop to follow.
+ *
+ * Pointer arguments should use simde_bench_memory, a 64-byte aligned
+ * buffer which is large enough for any single load or store. */
+
+#if !defined(SIMDE_BENCH_H)
+#define SIMDE_BENCH_H
+
+#include "../simde/simde-common.h"
+
+#include <stdint.h>
+
+HEDLEY_BEGIN_C_DECLS
+
+#if !defined(SIMDE_BENCH_VARIANT)
+#  define SIMDE_BENCH_VARIANT "native"
+#endif
+
+#define SIMDE_BENCH_MEMORY_SIZE 4096
+
+typedef void (*SimdeBenchFunc)(size_t iterations);
+
+typedef struct {
+  const char* name;
+  SimdeBenchFunc throughput;
+  SimdeBenchFunc latency;
+} SimdeBenchEntry;
+
+typedef struct {
+  const char* isax;
+  const SimdeBenchEntry* entries;
+} SimdeBenchSuite;
+
+extern void* simde_bench_memory;
+
+/* Fill a buffer with pseudo-random data.  Every 32-bit word is a
+   float in [1, 2) so floating-point inputs are always normal and
+   don't hit denormal slow paths, and no byte is zero so integer
+   division (in SVML) can't trap. */
+void simde_bench_fill(void* buf, size_t len);
+
+/* Make sure the compiler can't discard the results. */
+void simde_bench_sink(const void* buf, size_t len);
+
+#define SIMDE_BENCH_MIN_SIZE_(A, R) ((sizeof(A) < sizeof(R)) ? sizeof(A) : sizeof(R))
+
+#define SIMDE_BENCH_STEP_(chain, R, A, expr) { \
+    A a = chain; \
+    R r_ = (expr); \
+    (void) a; \
+    simde_memcpy(&(chain), &r_, SIMDE_BENCH_MIN_SIZE_(A, R)); \
+  }
+
+#define SIMDE_BENCH_STEP_VOID_(chain, A, stmt) { \
+    A a = chain; \
+    (void) a; \
+    stmt; \
+  }
+
+/* The chains are kept in local variables instead of an array so the
+   compiler can keep them in registers; otherwise the latency numbers
+   would include a store-to-load forwarding round trip. */
+#define SIMDE_BENCH_DECLARE_INPUTS_(A, B, C, D) \
+  A init_[8]; \
+  B b; \
+  C c; \
+  D d; \
+  simde_bench_fill(init_, sizeof(init_)); \
+  simde_bench_fill(&b, sizeof(b)); \
+  simde_bench_fill(&c, sizeof(c)); \
+  simde_bench_fill(&d, sizeof(d)); \
+  A c0_ = init_[0], c1_ = init_[1], c2_ = init_[2], c3_ = init_[3]; \
+  A c4_ = init_[4], c5_ = init_[5], c6_ = init_[6], c7_ = init_[7]; \
+  (void) b; \
+  (void) c; \
+  (void) d
+
+#define SIMDE_BENCH_SINK_CHAINS_() \
+  init_[0] = c0_; init_[1] = c1_; init_[2] = c2_; init_[3] = c3_; \
+  init_[4] = c4_; init_[5] = c5_; init_[6] = c6_; init_[7] = c7_; \
+  simde_bench_sink(init_, sizeof(init_))
+
+#define SIMDE_BENCH_FUNC(id, R, A, B, C, D, expr) \
+  SIMDE__FUNCTION_POSSIBLY_UNUSED \
+  static void \
+  simde_bench_throughput_##id(size_t iterations) { \
+    SIMDE_BENCH_DECLARE_INPUTS_(A, B, C, D); \
+    for (size_t i_ = 0 ; i_ < iterations ; i_ += 8) { \
+      SIMDE_BENCH_STEP_(c0_, R, A, expr) \
+      SIMDE_BENCH_STEP_(c1_, R, A, expr) \
+      SIMDE_BENCH_STEP_(c2_, R, A, expr) \
+      SIMDE_BENCH_STEP_(c3_, R, A, expr) \
+      SIMDE_BENCH_STEP_(c4_, R, A, expr) \
+      SIMDE_BENCH_STEP_(c5_, R, A, expr) \
+      SIMDE_BENCH_STEP_(c6_, R, A, expr) \
+      SIMDE_BENCH_STEP_(c7_, R, A, expr) \
+    } \
+    SIMDE_BENCH_SINK_CHAINS_(); \
+  } \
+  SIMDE__FUNCTION_POSSIBLY_UNUSED \
+  static void \
+  simde_bench_latency_##id(size_t iterations) { \
+    SIMDE_BENCH_DECLARE_INPUTS_(A, B, C, D); \
+    for (size_t i_ = 0 ; i_ < iterations ; i_++) { \
+      SIMDE_BENCH_STEP_(c0_, R, A, expr) \
+    } \
+    SIMDE_BENCH_SINK_CHAINS_(); \
+  }
+
+#define SIMDE_BENCH_FUNC_VOID(id, A, B, C, D, stmt) \
+  SIMDE__FUNCTION_POSSIBLY_UNUSED \
+  static void \
+  simde_bench_throughput_##id(size_t iterations) { \
+    SIMDE_BENCH_DECLARE_INPUTS_(A, B, C, D); \
+    for (size_t i_ = 0 ; i_ < iterations ; i_ += 8) { \
+      SIMDE_BENCH_STEP_VOID_(c0_, A, stmt) \
+      SIMDE_BENCH_STEP_VOID_(c1_, A, stmt) \
+      SIMDE_BENCH_STEP_VOID_(c2_, A, stmt) \
+      SIMDE_BENCH_STEP_VOID_(c3_, A, stmt) \
+      SIMDE_BENCH_STEP_VOID_(c4_, A, stmt) \
+      SIMDE_BENCH_STEP_VOID_(c5_, A, stmt) \
+      SIMDE_BENCH_STEP_VOID_(c6_, A, stmt) \
+      SIMDE_BENCH_STEP_VOID_(c7_, A, stmt) \
+    } \
+    SIMDE_BENCH_SINK_CHAINS_(); \
+    simde_bench_sink(simde_bench_memory, SIMDE_BENCH_MEMORY_SIZE); \
+  }
+
+#define SIMDE_BENCH_ENTRY(id) \
+  { #id, simde_bench_throughput_##id, simde_bench_latency_##id }
+#define SIMDE_BENCH_ENTRY_THROUGHPUT(id) \
+  { #id, simde_bench_throughput_##id, NULL }
+
+#define SIMDE_BENCH_GENERATE_SYMBOL(arch, isax) \
+  HEDLEY_CONCAT(HEDLEY_CONCAT(HEDLEY_CONCAT(HEDLEY_CONCAT(simde_bench_, arch), _), isax), _get_suite)
+
+#define SIMDE_BENCH_DEFINE_SUITE(arch, isax, name) \
+  const SimdeBenchSuite* SIMDE_BENCH_GENERATE_SYMBOL(arch, isax)(void) { \
+    static const SimdeBenchSuite suite = { name, simde_bench_entries }; \
+    return &suite; \
+  }
+
+#define SIMDE_BENCH_DECLARE_SUITE(arch, isax) \
+  const SimdeBenchSuite* SIMDE_BENCH_GENERATE_SYMBOL(arch, isax)(void)
+
+HEDLEY_END_C_DECLS
+
+#endif /* !defined(SIMDE_BENCH_H) */
@@ -0,0 +1,281 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#  define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "bench.h"
+#include "../simde/x86/mmx.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <time.h>
+#endif
+
+SIMDE_BENCH_DECLARE_SUITE(x86, mmx);
+SIMDE_BENCH_DECLARE_SUITE(x86, sse);
+SIMDE_BENCH_DECLARE_SUITE(x86, sse2);
+SIMDE_BENCH_DECLARE_SUITE(x86, sse3);
+SIMDE_BENCH_DECLARE_SUITE(x86, ssse3);
+SIMDE_BENCH_DECLARE_SUITE(x86, sse4_1);
+SIMDE_BENCH_DECLARE_SUITE(x86, sse4_2);
+SIMDE_BENCH_DECLARE_SUITE(x86, aes);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx);
+SIMDE_BENCH_DECLARE_SUITE(x86, fma);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx2);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512f);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512bitalg);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512bw);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512cd);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512dq);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512vbmi);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512vl);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512vnni);
+SIMDE_BENCH_DECLARE_SUITE(x86, avx512vpopcntdq);
+SIMDE_BENCH_DECLARE_SUITE(x86, clmul);
+SIMDE_BENCH_DECLARE_SUITE(x86, svml);
+
+typedef const SimdeBenchSuite* (*SimdeBenchSuiteGetter)(void);
+
+static const SimdeBenchSuiteGetter simde_bench_suites[] = {
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, mmx),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, sse),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, sse2),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, sse3),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, ssse3),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, sse4_1),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, sse4_2),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, aes),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, fma),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx2),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512f),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512bitalg),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512bw),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512cd),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512dq),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512vbmi),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512vl),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512vnni),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, avx512vpopcntdq),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, clmul),
+  SIMDE_BENCH_GENERATE_SYMBOL(x86, svml),
+  NULL
+};
+
+typedef enum {
+  SIMDE_BENCH_FORMAT_CSV,
+  SIMDE_BENCH_FORMAT_JSON
+} SimdeBenchFormat;
+
+typedef struct {
+  SimdeBenchFormat format;
+  double min_time;
+  unsigned int repetitions;
+  const char* filter;
+} SimdeBenchOptions;
+
+static SIMDE_ALIGN(64) unsigned char simde_bench_memory_[SIMDE_BENCH_MEMORY_SIZE];
+void* simde_bench_memory = simde_bench_memory_;
+
+static uint32_t simde_bench_rng_state = UINT32_C(0x9E3779B9);
+
+void
+simde_bench_fill(void* buf, size_t len) {
+  unsigned char* p = HEDLEY_REINTERPRET_CAST(unsigned char*, buf);
+
+  while (len > 0) {
+    uint32_t v;
+    size_t n = (len < sizeof(v)) ? len : sizeof(v);
+
+    /* xorshift32 */
+    simde_bench_rng_state ^= simde_bench_rng_state << 13;
+    simde_bench_rng_state ^= simde_bench_rng_state >> 17;
+    simde_bench_rng_state ^= simde_bench_rng_state << 5;
+    v = UINT32_C(0x3F810101) | (simde_bench_rng_state & UINT32_C(0x007FFFFF));
+
+    simde_memcpy(p, &v, n);
+    p += n;
+    len -= n;
+  }
+}
+
+static volatile unsigned char simde_bench_sink_;
+
+void
+simde_bench_sink(const void* buf, size_t len) {
+  const unsigned char* p = HEDLEY_REINTERPRET_CAST(const unsigned char*, buf);
+  unsigned char acc = 0;
+
+  for (size_t i = 0 ; i < len ; i++)
+    acc ^= p[i];
+
+  simde_bench_sink_ = acc;
+}
+
+/* Monotonic clock, in seconds. */
+static double
+simde_bench_now(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER freq, t;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&t);
+  return HEDLEY_STATIC_CAST(double, t.QuadPart) / HEDLEY_STATIC_CAST(double, freq.QuadPart);
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return HEDLEY_STATIC_CAST(double, ts.tv_sec) + (HEDLEY_STATIC_CAST(double, ts.tv_nsec) * 1e-9);
+#endif
+}
+
+/* Returns the time per call in nanoseconds.  The iteration count is
+   doubled until a single run takes at least min_time seconds, then
+   the fastest of the requested number of repetitions is reported. */
+static double
+simde_bench_measure(SimdeBenchFunc func, const SimdeBenchOptions* options) {
+  size_t iterations = 64;
+  double elapsed, best;
+
+  for (;;) {
+    double start = simde_bench_now();
+    func(iterations);
+    simde_mm_empty();
+    elapsed = simde_bench_now() - start;
+
+    if (elapsed >= options->min_time || iterations >= (SIZE_MAX / 4))
+      break;
+
+    iterations *= 2;
+  }
+
+  best = elapsed;
+  for (unsigned int rep = 1 ; rep < options->repetitions ; rep++) {
+    double start = simde_bench_now();
+    func(iterations);
+    simde_mm_empty();
+    elapsed = simde_bench_now() - start;
+
+    if (elapsed < best)
+      best = elapsed;
+  }
+
+  return (best * 1e9) / HEDLEY_STATIC_CAST(double, iterations);
+}
+
+static void
+simde_bench_usage(const char* argv0) {
+  fprintf(stderr, "USAGE: %s [OPTIONS...] [PREFIX]\n\n", argv0);
+  fprintf(stderr, "  --csv              Output CSV (default)\n");
+  fprintf(stderr, "  --json             Output JSON\n");
+  fprintf(stderr, "  --min-time=MS      Minimum duration of each measurement (default: 10)\n");
+  fprintf(stderr, "  --repetitions=N    Keep the fastest of N measurements (default: 3)\n");
+  fprintf(stderr, "  --list             List available benchmarks and exit\n");
+  fprintf(stderr, "  --help             Show this message and exit\n\n");
+  fprintf(stderr, "If PREFIX is provided only benchmarks whose name starts with it\n");
+  fprintf(stderr, "(for example, \"simde_mm256_\") are run.\n");
+}
+
+int
+main(int argc, char* argv[]) {
+  SimdeBenchOptions options = { SIMDE_BENCH_FORMAT_CSV, 0.01, 3, NULL };
+  int list_only = 0;
+  int first = 1;
+
+  for (int i = 1 ; i < argc ; i++) {
+    if (strcmp(argv[i], "--csv") == 0) {
+      options.format = SIMDE_BENCH_FORMAT_CSV;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      options.format = SIMDE_BENCH_FORMAT_JSON;
+    } else if (strncmp(argv[i], "--min-time=", 11) == 0) {
+      options.min_time = strtod(argv[i] + 11, NULL) / 1000.0;
+    } else if (strncmp(argv[i], "--repetitions=", 14) == 0) {
+      long reps = strtol(argv[i] + 14, NULL, 10);
+      options.repetitions = (reps > 0) ? HEDLEY_STATIC_CAST(unsigned int, reps) : 1;
+    } else if (strcmp(argv[i], "--list") == 0) {
+      list_only = 1;
+    } else if (strcmp(argv[i], "--help") == 0) {
+      simde_bench_usage(argv[0]);
+      return EXIT_SUCCESS;
+    } else if (argv[i][0] != '-' && options.filter == NULL) {
+      options.filter = argv[i];
+    } else {
+      simde_bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (!list_only) {
+    if (options.format == SIMDE_BENCH_FORMAT_JSON)
+      printf("[\n");
+    else
+      printf("variant,isax,function,throughput_ns,latency_ns\n");
+  }
+
+  for (const SimdeBenchSuiteGetter* getter = simde_bench_suites ; *getter != NULL ; getter++) {
+    const SimdeBenchSuite* suite = (*getter)();
+
+    for (const SimdeBenchEntry* entry = suite->entries ; entry->name != NULL ; entry++) {
+      double throughput, latency = -1.0;
+
+      if (options.filter != NULL && strncmp(entry->name, options.filter, strlen(options.filter)) != 0)
+        continue;
+
+      if (list_only) {
+        printf("%s/%s\n", suite->isax, entry->name);
+        continue;
+      }
+
+      throughput = simde_bench_measure(entry->throughput, &options);
+      if (entry->latency != NULL)
+        latency = simde_bench_measure(entry->latency, &options);
+
+      if (options.format == SIMDE_BENCH_FORMAT_JSON) {
+        printf("%s  { \"variant\": \"%s\", \"isax\": \"%s\", \"function\": \"%s\", \"throughput_ns\": %.4f, \"latency_ns\": ",
+          first ? "" : ",\n", SIMDE_BENCH_VARIANT, suite->isax, entry->name, throughput);
+        if (latency >= 0.0)
+          printf("%.4f }", latency);
+        else
+          printf("null }");
+      } else {
+        printf("%s,%s,%s,%.4f,", SIMDE_BENCH_VARIANT, suite->isax, entry->name, throughput);
+        if (latency >= 0.0)
+          printf("%.4f\n", latency);
+        else
+          printf("\n");
+      }
+      fflush(stdout);
+      first = 0;
+    }
+  }
+
+  if (!list_only && options.format == SIMDE_BENCH_FORMAT_JSON)
+    printf("%s]\n", first ? "" : "\n");
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,50 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/aes.h"
+
+SIMDE_BENCH_FUNC(simde_mm_aesdec_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_aesdec_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_aesdeclast_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_aesdeclast_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_aesenc_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_aesenc_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_aesenclast_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_aesenclast_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_aesimc_si128, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_aesimc_si128(a))
+SIMDE_BENCH_FUNC(simde_mm_aeskeygenassist_si128, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_aeskeygenassist_si128(a, 1))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_aesdec_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_aesdeclast_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_aesenc_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_aesenclast_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_aesimc_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_aeskeygenassist_si128),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, aes, "aes")
@@ -0,0 +1,575 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx.h"
+
+SIMDE_BENCH_FUNC(simde_mm256_castps_pd, simde__m256d, simde__m256, int, int, int,
+  simde_mm256_castps_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_castps_si256, simde__m256i, simde__m256, int, int, int,
+  simde_mm256_castps_si256(a))
+SIMDE_BENCH_FUNC(simde_mm256_castsi256_pd, simde__m256d, simde__m256i, int, int, int,
+  simde_mm256_castsi256_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_castsi256_ps, simde__m256, simde__m256i, int, int, int,
+  simde_mm256_castsi256_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_castpd_ps, simde__m256, simde__m256d, int, int, int,
+  simde_mm256_castpd_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_castpd_si256, simde__m256i, simde__m256d, int, int, int,
+  simde_mm256_castpd_si256(a))
+SIMDE_BENCH_FUNC(simde_mm256_setzero_si256, simde__m256i, int, int, int, int,
+  simde_mm256_setzero_si256())
+SIMDE_BENCH_FUNC(simde_mm256_setzero_ps, simde__m256, int, int, int, int,
+  simde_mm256_setzero_ps())
+SIMDE_BENCH_FUNC(simde_mm256_setzero_pd, simde__m256d, int, int, int, int,
+  simde_mm256_setzero_pd())
+SIMDE_BENCH_FUNC(simde_mm256_setone_si256, simde__m256i, int, int, int, int,
+  simde_mm256_setone_si256())
+SIMDE_BENCH_FUNC(simde_mm256_set_epi8, simde__m256i, int8_t, int8_t, int8_t, int8_t,
+  simde_mm256_set_epi8(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_set_epi16, simde__m256i, int16_t, int16_t, int16_t, int16_t,
+  simde_mm256_set_epi16(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_set_epi32, simde__m256i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm256_set_epi32(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_set_epi64x, simde__m256i, int64_t, int64_t, int64_t, int64_t,
+  simde_mm256_set_epi64x(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_set_ps, simde__m256, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm256_set_ps(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_set_pd, simde__m256d, simde_float64, simde_float64, simde_float64, simde_float64,
+  simde_mm256_set_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_set_m128, simde__m256, simde__m128, simde__m128, int, int,
+  simde_mm256_set_m128(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_set_m128d, simde__m256d, simde__m128d, simde__m128d, int, int,
+  simde_mm256_set_m128d(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_set_m128i, simde__m256i, simde__m128i, simde__m128i, int, int,
+  simde_mm256_set_m128i(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_set1_epi8, simde__m256i, int8_t, int, int, int,
+  simde_mm256_set1_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm256_set1_epi16, simde__m256i, int16_t, int, int, int,
+  simde_mm256_set1_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm256_set1_epi32, simde__m256i, int32_t, int, int, int,
+  simde_mm256_set1_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_set1_epi64x, simde__m256i, int64_t, int, int, int,
+  simde_mm256_set1_epi64x(a))
+SIMDE_BENCH_FUNC(simde_mm256_set1_ps, simde__m256, simde_float32, int, int, int,
+  simde_mm256_set1_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_set1_pd, simde__m256d, simde_float64, int, int, int,
+  simde_mm256_set1_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_add_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_add_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_add_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_add_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_addsub_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_addsub_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_addsub_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_addsub_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_and_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_and_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_and_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_and_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_andnot_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_andnot_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_andnot_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_andnot_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_blend_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_blend_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_blend_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_blend_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_blendv_ps, simde__m256, simde__m256, simde__m256, simde__m256, int,
+  simde_mm256_blendv_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_blendv_pd, simde__m256d, simde__m256d, simde__m256d, simde__m256d, int,
+  simde_mm256_blendv_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_broadcast_pd, simde__m256d, int, int, int, int,
+  simde_mm256_broadcast_pd(HEDLEY_REINTERPRET_CAST(simde__m128d const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_broadcast_ps, simde__m256, int, int, int, int,
+  simde_mm256_broadcast_ps(HEDLEY_REINTERPRET_CAST(simde__m128 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_broadcast_sd, simde__m256d, int, int, int, int,
+  simde_mm256_broadcast_sd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_broadcast_ss, simde__m128, int, int, int, int,
+  simde_mm_broadcast_ss(HEDLEY_REINTERPRET_CAST(simde_float32 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_broadcast_ss, simde__m256, int, int, int, int,
+  simde_mm256_broadcast_ss(HEDLEY_REINTERPRET_CAST(simde_float32 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_castpd128_pd256, simde__m256d, simde__m128d, int, int, int,
+  simde_mm256_castpd128_pd256(a))
+SIMDE_BENCH_FUNC(simde_mm256_castpd256_pd128, simde__m128d, simde__m256d, int, int, int,
+  simde_mm256_castpd256_pd128(a))
+SIMDE_BENCH_FUNC(simde_mm256_castps128_ps256, simde__m256, simde__m128, int, int, int,
+  simde_mm256_castps128_ps256(a))
+SIMDE_BENCH_FUNC(simde_mm256_castps256_ps128, simde__m128, simde__m256, int, int, int,
+  simde_mm256_castps256_ps128(a))
+SIMDE_BENCH_FUNC(simde_mm256_castsi128_si256, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_castsi128_si256(a))
+SIMDE_BENCH_FUNC(simde_mm256_castsi256_si128, simde__m128i, simde__m256i, int, int, int,
+  simde_mm256_castsi256_si128(a))
+SIMDE_BENCH_FUNC(simde_mm256_ceil_pd, simde__m256d, simde__m256d, int, int, int,
+  simde_mm256_ceil_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_ceil_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_ceil_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cmp_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmp_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmp_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmp_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmp_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmp_sd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmp_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmp_ss(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_cmp_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_cmp_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi32_pd, simde__m256d, simde__m128i, int, int, int,
+  simde_mm256_cvtepi32_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi32_ps, simde__m256, simde__m256i, int, int, int,
+  simde_mm256_cvtepi32_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtpd_epi32, simde__m128i, simde__m256d, int, int, int,
+  simde_mm256_cvtpd_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtpd_ps, simde__m128, simde__m256d, int, int, int,
+  simde_mm256_cvtpd_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtps_epi32, simde__m256i, simde__m256, int, int, int,
+  simde_mm256_cvtps_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtps_pd, simde__m256d, simde__m128, int, int, int,
+  simde_mm256_cvtps_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvttpd_epi32, simde__m128i, simde__m256d, int, int, int,
+  simde_mm256_cvttpd_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvttps_epi32, simde__m256i, simde__m256, int, int, int,
+  simde_mm256_cvttps_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_div_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_div_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_div_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_extractf128_pd, simde__m128d, simde__m256d, int, int, int,
+  simde_mm256_extractf128_pd(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_extractf128_ps, simde__m128, simde__m256, int, int, int,
+  simde_mm256_extractf128_ps(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_extractf128_si256, simde__m128i, simde__m256i, int, int, int,
+  simde_mm256_extractf128_si256(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_floor_pd, simde__m256d, simde__m256d, int, int, int,
+  simde_mm256_floor_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_floor_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_floor_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_hadd_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_hadd_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_hadd_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_hadd_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_hsub_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_hsub_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_hsub_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_hsub_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_insert_epi8, simde__m256i, simde__m256i, int8_t, int, int,
+  simde_mm256_insert_epi8(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_insert_epi16, simde__m256i, simde__m256i, int16_t, int, int,
+  simde_mm256_insert_epi16(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_insert_epi32, simde__m256i, simde__m256i, int32_t, int, int,
+  simde_mm256_insert_epi32(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_insert_epi64, simde__m256i, simde__m256i, int64_t, int, int,
+  simde_mm256_insert_epi64(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_extract_epi32, int32_t, simde__m256i, int, int, int,
+  simde_mm256_extract_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_extract_epi64, int64_t, simde__m256i, int, int, int,
+  simde_mm256_extract_epi64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_lddqu_si256, simde__m256i, int, int, int, int,
+  simde_mm256_lddqu_si256(HEDLEY_REINTERPRET_CAST(simde__m256i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_load_pd, simde__m256d, int, int, int, int,
+  simde_mm256_load_pd(HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_load_ps, simde__m256, int, int, int, int,
+  simde_mm256_load_ps(HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_load_si256, simde__m256i, int, int, int, int,
+  simde_mm256_load_si256(HEDLEY_REINTERPRET_CAST(simde__m256i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_loadu_pd, simde__m256d, int, int, int, int,
+  simde_mm256_loadu_pd(HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_loadu_ps, simde__m256, int, int, int, int,
+  simde_mm256_loadu_ps(HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_loadu_si256, simde__m256i, int, int, int, int,
+  simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(simde__m256i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_loadu2_m128, simde__m256, int, int, int, int,
+  simde_mm256_loadu2_m128(HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory), HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_loadu2_m128d, simde__m256d, int, int, int, int,
+  simde_mm256_loadu2_m128d(HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory), HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_loadu2_m128i, simde__m256i, int, int, int, int,
+  simde_mm256_loadu2_m128i(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_bench_memory), HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_maskload_pd, simde__m128d, simde__m128i, int, int, int,
+  simde_mm_maskload_pd(HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC(simde_mm256_maskload_pd, simde__m256d, simde__m256i, int, int, int,
+  simde_mm256_maskload_pd(HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC(simde_mm_maskload_ps, simde__m128, simde__m128i, int, int, int,
+  simde_mm_maskload_ps(HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC(simde_mm256_maskload_ps, simde__m256, simde__m256i, int, int, int,
+  simde_mm256_maskload_ps(HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_maskstore_pd, simde__m128i, simde__m128d, int, int,
+  simde_mm_maskstore_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_maskstore_pd, simde__m256i, simde__m256d, int, int,
+  simde_mm256_maskstore_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_maskstore_ps, simde__m128i, simde__m128, int, int,
+  simde_mm_maskstore_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_maskstore_ps, simde__m256i, simde__m256, int, int,
+  simde_mm256_maskstore_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_min_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_min_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_max_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_max_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_movedup_pd, simde__m256d, simde__m256d, int, int, int,
+  simde_mm256_movedup_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_movehdup_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_movehdup_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_moveldup_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_moveldup_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_movemask_ps, int, simde__m256, int, int, int,
+  simde_mm256_movemask_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_movemask_pd, int, simde__m256d, int, int, int,
+  simde_mm256_movemask_pd(a))
+SIMDE_BENCH_FUNC(simde_mm256_mul_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_mul_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mul_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_mul_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_or_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_or_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_or_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_or_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_permute_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_permute_ps(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_permute_pd, simde__m256d, simde__m256d, int, int, int,
+  simde_mm256_permute_pd(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_permute_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_permute_ps(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_permute_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_permute_pd(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_permutevar_ps, simde__m128, simde__m128, simde__m128i, int, int,
+  simde_mm_permutevar_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_permutevar_pd, simde__m128d, simde__m128d, simde__m128i, int, int,
+  simde_mm_permutevar_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_permutevar_ps, simde__m256, simde__m256, simde__m256i, int, int,
+  simde_mm256_permutevar_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_permutevar_pd, simde__m256d, simde__m256d, simde__m256i, int, int,
+  simde_mm256_permutevar_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_permute2f128_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_permute2f128_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_permute2f128_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_permute2f128_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_permute2f128_si256, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_permute2f128_si256(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_rcp_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_rcp_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_round_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_round_ps(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_round_pd, simde__m256d, simde__m256d, int, int, int,
+  simde_mm256_round_pd(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_rsqrt_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_rsqrt_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_setr_epi8, simde__m256i, int8_t, int8_t, int8_t, int8_t,
+  simde_mm256_setr_epi8(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_setr_epi16, simde__m256i, int16_t, int16_t, int16_t, int16_t,
+  simde_mm256_setr_epi16(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_setr_epi32, simde__m256i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm256_setr_epi32(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_setr_epi64, simde__m256i, int64_t, int64_t, int64_t, int64_t,
+  simde_mm256_setr_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_setr_ps, simde__m256, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm256_setr_ps(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm256_setr_pd, simde__m256d, simde_float64, simde_float64, simde_float64, simde_float64,
+  simde_mm256_setr_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_setr_m128, simde__m256, simde__m128, simde__m128, int, int,
+  simde_mm256_setr_m128(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_setr_m128d, simde__m256d, simde__m128d, simde__m128d, int, int,
+  simde_mm256_setr_m128d(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_setr_m128i, simde__m256i, simde__m128i, simde__m128i, int, int,
+  simde_mm256_setr_m128i(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_shuffle_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_shuffle_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_shuffle_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_shuffle_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_sqrt_ps, simde__m256, simde__m256, int, int, int,
+  simde_mm256_sqrt_ps(a))
+SIMDE_BENCH_FUNC(simde_mm256_sqrt_pd, simde__m256d, simde__m256d, int, int, int,
+  simde_mm256_sqrt_pd(a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_store_ps, simde__m256, int, int, int,
+  simde_mm256_store_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_store_pd, simde__m256d, int, int, int,
+  simde_mm256_store_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_store_si256, simde__m256i, int, int, int,
+  simde_mm256_store_si256(HEDLEY_REINTERPRET_CAST(simde__m256i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_storeu_ps, simde__m256, int, int, int,
+  simde_mm256_storeu_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_storeu_pd, simde__m256d, int, int, int,
+  simde_mm256_storeu_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_storeu_si256, simde__m256i, int, int, int,
+  simde_mm256_storeu_si256(HEDLEY_REINTERPRET_CAST(simde__m256i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_storeu2_m128, simde__m256, int, int, int,
+  simde_mm256_storeu2_m128(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_storeu2_m128d, simde__m256d, int, int, int,
+  simde_mm256_storeu2_m128d(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_storeu2_m128i, simde__m256i, int, int, int,
+  simde_mm256_storeu2_m128i(HEDLEY_REINTERPRET_CAST(simde__m128i*, simde_bench_memory), HEDLEY_REINTERPRET_CAST(simde__m128i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_stream_ps, simde__m256, int, int, int,
+  simde_mm256_stream_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_stream_pd, simde__m256d, int, int, int,
+  simde_mm256_stream_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_stream_si256, simde__m256i, int, int, int,
+  simde_mm256_stream_si256(HEDLEY_REINTERPRET_CAST(simde__m256i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC(simde_mm256_sub_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_sub_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sub_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_sub_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_undefined_ps, simde__m256, int, int, int, int,
+  simde_mm256_undefined_ps())
+SIMDE_BENCH_FUNC(simde_mm256_undefined_pd, simde__m256d, int, int, int, int,
+  simde_mm256_undefined_pd())
+SIMDE_BENCH_FUNC(simde_mm256_undefined_si256, simde__m256i, int, int, int, int,
+  simde_mm256_undefined_si256())
+SIMDE_BENCH_FUNC(simde_mm256_xor_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_xor_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_xor_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_xor_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpackhi_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_unpackhi_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpackhi_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_unpackhi_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpacklo_ps, simde__m256, simde__m256, simde__m256, int, int,
+  simde_mm256_unpacklo_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpacklo_pd, simde__m256d, simde__m256d, simde__m256d, int, int,
+  simde_mm256_unpacklo_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_zextps128_ps256, simde__m256, simde__m128, int, int, int,
+  simde_mm256_zextps128_ps256(a))
+SIMDE_BENCH_FUNC(simde_mm256_zextpd128_pd256, simde__m256d, simde__m128d, int, int, int,
+  simde_mm256_zextpd128_pd256(a))
+SIMDE_BENCH_FUNC(simde_mm256_zextsi128_si256, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_zextsi128_si256(a))
+SIMDE_BENCH_FUNC(simde_mm_testc_ps, int, simde__m128, simde__m128, int, int,
+  simde_mm_testc_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testc_pd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_testc_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testc_ps, int, simde__m256, simde__m256, int, int,
+  simde_mm256_testc_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testc_pd, int, simde__m256d, simde__m256d, int, int,
+  simde_mm256_testc_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testc_si256, int, simde__m256i, simde__m256i, int, int,
+  simde_mm256_testc_si256(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testz_ps, int, simde__m128, simde__m128, int, int,
+  simde_mm_testz_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testz_pd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_testz_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testz_ps, int, simde__m256, simde__m256, int, int,
+  simde_mm256_testz_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testz_pd, int, simde__m256d, simde__m256d, int, int,
+  simde_mm256_testz_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testz_si256, int, simde__m256i, simde__m256i, int, int,
+  simde_mm256_testz_si256(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testnzc_ps, int, simde__m128, simde__m128, int, int,
+  simde_mm_testnzc_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testnzc_pd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_testnzc_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testnzc_ps, int, simde__m256, simde__m256, int, int,
+  simde_mm256_testnzc_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testnzc_pd, int, simde__m256d, simde__m256d, int, int,
+  simde_mm256_testnzc_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_testnzc_si256, int, simde__m256i, simde__m256i, int, int,
+  simde_mm256_testnzc_si256(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm256_castps_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_castps_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_castsi256_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_castsi256_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_castpd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_castpd_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_setzero_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_setzero_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_setzero_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_setone_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_epi64x),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_m128),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_m128d),
+  SIMDE_BENCH_ENTRY(simde_mm256_set_m128i),
+  SIMDE_BENCH_ENTRY(simde_mm256_set1_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_set1_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_set1_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_set1_epi64x),
+  SIMDE_BENCH_ENTRY(simde_mm256_set1_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_set1_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_addsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_addsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_and_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_and_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_andnot_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_andnot_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_blend_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_blend_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_blendv_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_blendv_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_broadcast_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_broadcast_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_broadcast_sd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_broadcast_ss),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_broadcast_ss),
+  SIMDE_BENCH_ENTRY(simde_mm256_castpd128_pd256),
+  SIMDE_BENCH_ENTRY(simde_mm256_castpd256_pd128),
+  SIMDE_BENCH_ENTRY(simde_mm256_castps128_ps256),
+  SIMDE_BENCH_ENTRY(simde_mm256_castps256_ps128),
+  SIMDE_BENCH_ENTRY(simde_mm256_castsi128_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_castsi256_si128),
+  SIMDE_BENCH_ENTRY(simde_mm256_ceil_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_ceil_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_ss),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi32_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi32_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtpd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtpd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtps_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtps_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvttpd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvttps_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_extractf128_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_extractf128_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_extractf128_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_floor_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_floor_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_hadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_hadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_hsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_hsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_insert_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_insert_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_insert_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_insert_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_extract_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_extract_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_lddqu_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_load_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_load_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_load_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_loadu_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_loadu_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_loadu_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_loadu2_m128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_loadu2_m128d),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_loadu2_m128i),
+  SIMDE_BENCH_ENTRY(simde_mm_maskload_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskload_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_maskload_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskload_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_maskstore_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_maskstore_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_maskstore_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_maskstore_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_movedup_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_movehdup_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_moveldup_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_movemask_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_movemask_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_or_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_or_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_permute_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_permute_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_permute_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_permute_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_permutevar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_permutevar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutevar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutevar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_permute2f128_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_permute2f128_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_permute2f128_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_rcp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_rsqrt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_m128),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_m128d),
+  SIMDE_BENCH_ENTRY(simde_mm256_setr_m128i),
+  SIMDE_BENCH_ENTRY(simde_mm256_shuffle_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_shuffle_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_sqrt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_sqrt_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_store_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_store_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_store_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_storeu_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_storeu_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_storeu_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_storeu2_m128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_storeu2_m128d),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_storeu2_m128i),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_stream_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_stream_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_stream_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_sub_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_undefined_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_undefined_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_undefined_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_xor_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_xor_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpackhi_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpackhi_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpacklo_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpacklo_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_zextps128_ps256),
+  SIMDE_BENCH_ENTRY(simde_mm256_zextpd128_pd256),
+  SIMDE_BENCH_ENTRY(simde_mm256_zextsi128_si256),
+  SIMDE_BENCH_ENTRY(simde_mm_testc_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_testc_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_testc_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_testc_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_testc_si256),
+  SIMDE_BENCH_ENTRY(simde_mm_testz_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_testz_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_testz_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_testz_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_testz_si256),
+  SIMDE_BENCH_ENTRY(simde_mm_testnzc_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_testnzc_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_testnzc_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_testnzc_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_testnzc_si256),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx, "avx")
@@ -0,0 +1,458 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx2.h"
+
+SIMDE_BENCH_FUNC(simde_mm256_abs_epi8, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_abs_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm256_abs_epi16, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_abs_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm256_abs_epi32, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_abs_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_add_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_add_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_add_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_add_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_add_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_add_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_add_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_add_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_alignr_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_alignr_epi8(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_and_si256, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_and_si256(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_andnot_si256, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_andnot_si256(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_adds_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_adds_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_adds_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_adds_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_adds_epu8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_adds_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_adds_epu16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_adds_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_blend_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_blend_epi32(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_blend_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_blend_epi16(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_blend_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_blend_epi32(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_blendv_epi8, simde__m256i, simde__m256i, simde__m256i, simde__m256i, int,
+  simde_mm256_blendv_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_broadcastsi128_si256, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_broadcastsi128_si256(a))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi8_epi16, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepi8_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi8_epi32, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepi8_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi8_epi64, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepi8_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi16_epi32, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepi16_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi16_epi64, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepi16_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepi32_epi64, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepi32_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepu8_epi16, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepu8_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepu8_epi32, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepu8_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepu8_epi64, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepu8_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepu16_epi32, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepu16_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepu16_epi64, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepu16_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm256_cvtepu32_epi64, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_cvtepu32_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm256_extract_epi8, int, simde__m256i, int, int, int,
+  simde_mm256_extract_epi8(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_extract_epi16, int, simde__m256i, int, int, int,
+  simde_mm256_extract_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_extracti128_si256, simde__m128i, simde__m256i, int, int, int,
+  simde_mm256_extracti128_si256(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_hadd_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_hadd_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_hadd_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_hadd_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_i32gather_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_i32gather_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i32gather_epi32, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_mask_i32gather_epi32(a, HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i32gather_epi32, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_i32gather_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i32gather_epi32, simde__m256i, simde__m256i, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_i32gather_epi32(a, HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm256_and_si256(b, simde_mm256_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm_i64gather_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_i64gather_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i64gather_epi32, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_mask_i64gather_epi32(a, HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i64gather_epi32, simde__m128i, simde__m256i, int, int, int,
+  simde_mm256_i64gather_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i64gather_epi32, simde__m128i, simde__m128i, simde__m256i, simde__m128i, int,
+  simde_mm256_mask_i64gather_epi32(a, HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), simde_mm256_and_si256(b, simde_mm256_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm_i32gather_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_i32gather_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i32gather_epi64, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_mask_i32gather_epi64(a, HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i32gather_epi64, simde__m256i, simde__m128i, int, int, int,
+  simde_mm256_i32gather_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i32gather_epi64, simde__m256i, simde__m256i, simde__m128i, simde__m256i, int,
+  simde_mm256_mask_i32gather_epi64(a, HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm_i64gather_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_i64gather_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i64gather_epi64, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_mask_i64gather_epi64(a, HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i64gather_epi64, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_i64gather_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i64gather_epi64, simde__m256i, simde__m256i, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_i64gather_epi64(a, HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), simde_mm256_and_si256(b, simde_mm256_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm_i32gather_ps, simde__m128, simde__m128i, int, int, int,
+  simde_mm_i32gather_ps(HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i32gather_ps, simde__m128, simde__m128, simde__m128i, simde__m128, int,
+  simde_mm_mask_i32gather_ps(a, HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i32gather_ps, simde__m256, simde__m256i, int, int, int,
+  simde_mm256_i32gather_ps(HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i32gather_ps, simde__m256, simde__m256, simde__m256i, simde__m256, int,
+  simde_mm256_mask_i32gather_ps(a, HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm256_and_si256(b, simde_mm256_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm_i64gather_ps, simde__m128, simde__m128i, int, int, int,
+  simde_mm_i64gather_ps(HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i64gather_ps, simde__m128, simde__m128, simde__m128i, simde__m128, int,
+  simde_mm_mask_i64gather_ps(a, HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i64gather_ps, simde__m128, simde__m256i, int, int, int,
+  simde_mm256_i64gather_ps(HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i64gather_ps, simde__m128, simde__m128, simde__m256i, simde__m128, int,
+  simde_mm256_mask_i64gather_ps(a, HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), simde_mm256_and_si256(b, simde_mm256_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm_i32gather_pd, simde__m128d, simde__m128i, int, int, int,
+  simde_mm_i32gather_pd(HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i32gather_pd, simde__m128d, simde__m128d, simde__m128i, simde__m128d, int,
+  simde_mm_mask_i32gather_pd(a, HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i32gather_pd, simde__m256d, simde__m128i, int, int, int,
+  simde_mm256_i32gather_pd(HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi32(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i32gather_pd, simde__m256d, simde__m256d, simde__m128i, simde__m256d, int,
+  simde_mm256_mask_i32gather_pd(a, HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm_i64gather_pd, simde__m128d, simde__m128i, int, int, int,
+  simde_mm_i64gather_pd(HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm_and_si128(a, simde_mm_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm_mask_i64gather_pd, simde__m128d, simde__m128d, simde__m128i, simde__m128d, int,
+  simde_mm_mask_i64gather_pd(a, HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm_and_si128(b, simde_mm_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_i64gather_pd, simde__m256d, simde__m256i, int, int, int,
+  simde_mm256_i64gather_pd(HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi64x(0xff)), 4))
+SIMDE_BENCH_FUNC(simde_mm256_mask_i64gather_pd, simde__m256d, simde__m256d, simde__m256i, simde__m256d, int,
+  simde_mm256_mask_i64gather_pd(a, HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), simde_mm256_and_si256(b, simde_mm256_set1_epi64x(0xff)), c, 4))
+SIMDE_BENCH_FUNC(simde_mm256_madd_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_madd_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_maddubs_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_maddubs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_max_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_epu8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_max_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_epu16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_max_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_epu32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_max_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_max_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_max_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_max_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_min_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_min_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_min_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_epu8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_min_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_epu16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_min_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_min_epu32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_min_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_movemask_epi8, int32_t, simde__m256i, int, int, int,
+  simde_mm256_movemask_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm256_mul_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_mul_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mul_epu32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_mul_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mulhi_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_mulhi_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mullo_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_mullo_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mullo_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_mullo_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_or_si256, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_or_si256(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_packs_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_packs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_packs_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_packs_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_packus_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_packus_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_packus_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_packus_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_permute2x128_si256, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_permute2x128_si256(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm256_permute4x64_epi64, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_permute4x64_epi64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_permutevar8x32_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_permutevar8x32_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sad_epu8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sad_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_shuffle_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_shuffle_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_shuffle_epi32, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_shuffle_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_sign_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sign_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sign_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sign_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sign_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sign_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_slli_epi16, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_slli_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_slli_epi32, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_slli_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_slli_epi64, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_slli_epi64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_sllv_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sllv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sllv_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sllv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sllv_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sllv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sllv_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sllv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sub_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sub_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sub_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sub_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sub_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sub_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_sub_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_sub_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_srli_epi16, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_srli_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_srli_epi64, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_srli_epi64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_srli_si256, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_srli_si256(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_srai_epi16, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_srai_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm256_srai_epi32, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_srai_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srav_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_srav_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_srav_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_srav_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srlv_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_srlv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_srlv_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_srlv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srlv_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_srlv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_srlv_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_srlv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpacklo_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpacklo_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpacklo_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpacklo_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpacklo_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpacklo_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpacklo_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpacklo_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpackhi_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpackhi_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpackhi_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpackhi_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpackhi_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpackhi_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_unpackhi_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_unpackhi_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_xor_si256, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_xor_si256(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_srli_epi32, simde__m256i, simde__m256i, int, int, int,
+  simde_mm256_srli_epi32(a, 1))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm256_abs_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_abs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_abs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_alignr_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_and_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_andnot_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_adds_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_adds_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_adds_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm256_adds_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_blend_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_blend_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_blend_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_blendv_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_broadcastsi128_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi8_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi8_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi8_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi16_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi16_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepi32_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepu8_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepu8_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepu8_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepu16_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepu16_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_cvtepu32_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_extract_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_extract_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_extracti128_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_hadd_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_hadd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_i32gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i32gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_i32gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i32gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_i64gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i64gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_i64gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i64gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_i32gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i32gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_i32gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i32gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_i64gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i64gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_i64gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i64gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_i32gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i32gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_i32gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i32gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_i64gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i64gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_i64gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i64gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_i32gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i32gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_i32gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i32gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_i64gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_i64gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_i64gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_i64gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_madd_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_maddubs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_max_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm256_min_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm256_movemask_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_mul_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mul_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mulhi_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mullo_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_or_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_packs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_packs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_packus_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_packus_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_permute2x128_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_permute4x64_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutevar8x32_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_sad_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm256_shuffle_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_shuffle_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_sign_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_sign_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_sign_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_slli_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_slli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_slli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_sllv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_sllv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_sllv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_sllv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_srli_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_srli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_srli_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_srai_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_srai_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_srav_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_srav_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_srlv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_srlv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_srlv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_srlv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpacklo_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpacklo_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpacklo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpacklo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpackhi_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpackhi_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpackhi_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_unpackhi_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_xor_si256),
+  SIMDE_BENCH_ENTRY(simde_mm256_srli_epi32),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx2, "avx2")
@@ -0,0 +1,374 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx512bw.h"
+
+SIMDE_BENCH_FUNC(simde_mm512_add_epi8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_add_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_add_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_add_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_adds_epi8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_adds_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_adds_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_adds_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_adds_epu8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_adds_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_adds_epu16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_adds_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_shuffle_epi8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_shuffle_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epi8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi16_epi8, simde__m256i, simde__m512i, int, int, int,
+  simde_mm512_cvtepi16_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi8_epi16, simde__m512i, simde__m256i, int, int, int,
+  simde_mm512_cvtepi8_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm512_movepi8_mask, simde__mmask64, simde__m512i, int, int, int,
+  simde_mm512_movepi8_mask(a))
+SIMDE_BENCH_FUNC(simde_mm512_movepi16_mask, simde__mmask32, simde__m512i, int, int, int,
+  simde_mm512_movepi16_mask(a))
+SIMDE_BENCH_FUNC(simde_mm512_movm_epi8, simde__m512i, simde__mmask64, int, int, int,
+  simde_mm512_movm_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm512_movm_epi16, simde__m512i, simde__mmask32, int, int, int,
+  simde_mm512_movm_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mov_epi8, simde__m512i, simde__m512i, simde__mmask64, simde__m512i, int,
+  simde_mm512_mask_mov_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mov_epi16, simde__m512i, simde__m512i, simde__mmask32, simde__m512i, int,
+  simde_mm512_mask_mov_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mov_epi8, simde__m512i, simde__mmask64, simde__m512i, int, int,
+  simde_mm512_maskz_mov_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mov_epi16, simde__m512i, simde__mmask32, simde__m512i, int, int,
+  simde_mm512_maskz_mov_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_blend_epi8, simde__m512i, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_blend_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_blend_epi16, simde__m512i, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_blend_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_sub_epi8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_sub_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_sub_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_sub_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_epi8, simde__m512i, simde__m512i, simde__mmask64, simde__m512i, simde__m512i,
+  simde_mm512_mask_add_epi8(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_epi8, simde__m512i, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_add_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_epi16, simde__m512i, simde__m512i, simde__mmask32, simde__m512i, simde__m512i,
+  simde_mm512_mask_add_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_epi16, simde__m512i, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_add_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_epi8, simde__m512i, simde__m512i, simde__mmask64, simde__m512i, simde__m512i,
+  simde_mm512_mask_sub_epi8(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_epi8, simde__m512i, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_sub_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_epi16, simde__m512i, simde__m512i, simde__mmask32, simde__m512i, simde__m512i,
+  simde_mm512_mask_sub_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_epi16, simde__m512i, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_sub_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epi8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epi8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epi8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epi8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epi8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epi8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epi8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epi8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epi8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epi8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epi8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epi8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epi8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epi8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epi8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epi8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epi8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epu8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epu8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epu8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epu8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epu8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epu8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epu8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epu8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epu8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epu8_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epu8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epu8_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epi16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epi16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epi16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epi16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epi16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epi16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epi16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epi16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epi16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epi16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epi16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epi16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epi16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epi16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epi16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epi16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epi16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epi16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epi16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epi16_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epi16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epi16_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epu16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epu16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epu16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epu16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epu16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epu16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epu16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epu16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epu16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epu16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epu16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epu16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epu16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epu16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epu16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epu16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epu16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epu16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epu16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epu16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epu16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epu16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epu16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epu16_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epu16_mask, simde__mmask32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epu16_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epi8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epi8_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epi8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epi8_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epu8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epu8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epu8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epu8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epu8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epu8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epu8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epu8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epu8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epu8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epu8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epu8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epu8_mask, simde__mmask64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epu8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epu8_mask, simde__mmask64, simde__mmask64, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epu8_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epu16_mask, simde__mmask32, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epu16_mask(a, b, c, SIMDE_MM_CMPINT_NLT))
+SIMDE_BENCH_FUNC(simde_mm512_packs_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_packs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_packus_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_packus_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_packus_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_packus_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_packs_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_packs_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_unpacklo_epi8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpacklo_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_unpackhi_epi8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpackhi_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_unpacklo_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpacklo_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_unpackhi_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpackhi_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_sad_epu8, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_sad_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_madd_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_madd_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maddubs_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_maddubs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_slli_epi16, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_slli_epi16(a, 5))
+SIMDE_BENCH_FUNC(simde_mm512_srli_epi16, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srli_epi16(a, 9))
+SIMDE_BENCH_FUNC(simde_mm512_srai_epi16, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srai_epi16(a, 3))
+SIMDE_BENCH_FUNC(simde_mm512_permutexvar_epi16, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_permutexvar_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutexvar_epi16, simde__m512i, simde__m512i, simde__mmask32, simde__m512i, simde__m512i,
+  simde_mm512_mask_permutexvar_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutexvar_epi16, simde__m512i, simde__mmask32, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_permutexvar_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_kand_mask32, simde__mmask32, simde__mmask32, simde__mmask32, int, int,
+  simde_kand_mask32(a, b))
+SIMDE_BENCH_FUNC(simde_kor_mask64, simde__mmask64, simde__mmask64, simde__mmask64, int, int,
+  simde_kor_mask64(a, b))
+SIMDE_BENCH_FUNC(simde_knot_mask64, simde__mmask64, simde__mmask64, int, int, int,
+  simde_knot_mask64(a))
+SIMDE_BENCH_FUNC(simde_kadd_mask64, simde__mmask64, simde__mmask64, simde__mmask64, int, int,
+  simde_kadd_mask64(a, b))
+SIMDE_BENCH_FUNC(simde_kortestz_mask64_u8, unsigned char, simde__mmask64, simde__mmask64, int, int,
+  simde_kortestz_mask64_u8(a, b))
+SIMDE_BENCH_FUNC(simde_ktestc_mask32_u8, unsigned char, simde__mmask32, simde__mmask32, int, int,
+  simde_ktestc_mask32_u8(a, b))
+SIMDE_BENCH_FUNC(simde_kshiftli_mask32, simde__mmask32, simde__mmask32, int, int, int,
+  simde_kshiftli_mask32(a, 5))
+SIMDE_BENCH_FUNC(simde_kshiftri_mask64, simde__mmask64, simde__mmask64, int, int, int,
+  simde_kshiftri_mask64(a, 7))
+SIMDE_BENCH_FUNC(simde_mm512_kunpackw, simde__mmask32, simde__mmask32, simde__mmask32, int, int,
+  simde_mm512_kunpackw(a, b))
+SIMDE_BENCH_FUNC(simde_cvtmask32_u32, unsigned int, simde__mmask32, int, int, int,
+  simde_cvtmask32_u32(a))
+SIMDE_BENCH_FUNC(simde_cvtu64_mask64, simde__mmask64, uint64_t, int, int, int,
+  simde_cvtu64_mask64(a))
+SIMDE_BENCH_FUNC(simde_mm512_kunpackd, simde__mmask64, simde__mmask64, simde__mmask64, int, int,
+  simde_mm512_kunpackd(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm512_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_adds_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_adds_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_adds_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm512_adds_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm512_shuffle_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi16_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi8_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_movepi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_movepi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_movm_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_movm_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mov_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mov_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mov_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mov_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_blend_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_blend_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_packs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_packus_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_packus_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_packs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpacklo_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpackhi_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpacklo_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpackhi_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_sad_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm512_madd_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_maddubs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_slli_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_srli_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_srai_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_kand_mask32),
+  SIMDE_BENCH_ENTRY(simde_kor_mask64),
+  SIMDE_BENCH_ENTRY(simde_knot_mask64),
+  SIMDE_BENCH_ENTRY(simde_kadd_mask64),
+  SIMDE_BENCH_ENTRY(simde_kortestz_mask64_u8),
+  SIMDE_BENCH_ENTRY(simde_ktestc_mask32_u8),
+  SIMDE_BENCH_ENTRY(simde_kshiftli_mask32),
+  SIMDE_BENCH_ENTRY(simde_kshiftri_mask64),
+  SIMDE_BENCH_ENTRY(simde_mm512_kunpackw),
+  SIMDE_BENCH_ENTRY(simde_cvtmask32_u32),
+  SIMDE_BENCH_ENTRY(simde_cvtu64_mask64),
+  SIMDE_BENCH_ENTRY(simde_mm512_kunpackd),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx512bw, "avx512bw")
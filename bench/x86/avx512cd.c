@@ -0,0 +1,74 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx512cd.h"
+
+SIMDE_BENCH_FUNC(simde_mm512_broadcastmw_epi32, simde__m512i, simde__mmask16, int, int, int,
+  simde_mm512_broadcastmw_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_broadcastmb_epi64, simde__m512i, simde__mmask8, int, int, int,
+  simde_mm512_broadcastmb_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_conflict_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_conflict_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_conflict_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_conflict_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_conflict_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_conflict_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_conflict_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_conflict_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_conflict_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_conflict_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_conflict_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_conflict_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_lzcnt_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_lzcnt_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_lzcnt_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_lzcnt_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_lzcnt_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_lzcnt_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_lzcnt_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_lzcnt_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_lzcnt_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_lzcnt_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_lzcnt_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_lzcnt_epi64(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm512_broadcastmw_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_broadcastmb_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_conflict_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_conflict_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_conflict_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_conflict_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_conflict_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_conflict_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_lzcnt_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_lzcnt_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_lzcnt_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_lzcnt_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_lzcnt_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_lzcnt_epi64),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx512cd, "avx512cd")
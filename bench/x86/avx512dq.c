@@ -0,0 +1,173 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx512dq.h"
+
+SIMDE_BENCH_FUNC(simde_mm512_mullo_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_mullo_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mullo_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_mullo_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mullo_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_mullo_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi64_pd, simde__m512d, simde__m512i, int, int, int,
+  simde_mm512_cvtepi64_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvtepi64_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_cvtepi64_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvtepi64_pd, simde__m512d, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_cvtepi64_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepu64_pd, simde__m512d, simde__m512i, int, int, int,
+  simde_mm512_cvtepu64_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi64_ps, simde__m256, simde__m512i, int, int, int,
+  simde_mm512_cvtepi64_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepu64_ps, simde__m256, simde__m512i, int, int, int,
+  simde_mm512_cvtepu64_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_cvttpd_epi64, simde__m512i, simde__m512d, int, int, int,
+  simde_mm512_cvttpd_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvttpd_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_cvttpd_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvttpd_epi64, simde__m512i, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_cvttpd_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvttpd_epu64, simde__m512i, simde__m512d, int, int, int,
+  simde_mm512_cvttpd_epu64(a))
+SIMDE_BENCH_FUNC(simde_mm512_cvtpd_epi64, simde__m512i, simde__m512d, int, int, int,
+  simde_mm512_cvtpd_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_cvtpd_epu64, simde__m512i, simde__m512d, int, int, int,
+  simde_mm512_cvtpd_epu64(a))
+SIMDE_BENCH_FUNC(simde_mm512_fpclass_ps_mask, simde__mmask16, simde__m512, int, int, int,
+  simde_mm512_fpclass_ps_mask(a, 0x99))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fpclass_ps_mask, simde__mmask16, simde__mmask16, simde__m512, int, int,
+  simde_mm512_mask_fpclass_ps_mask(a, b, 0x99))
+SIMDE_BENCH_FUNC(simde_mm512_fpclass_pd_mask, simde__mmask8, simde__m512d, int, int, int,
+  simde_mm512_fpclass_pd_mask(a, 0x99))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fpclass_pd_mask, simde__mmask8, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_mask_fpclass_pd_mask(a, b, 0x99))
+SIMDE_BENCH_FUNC(simde_mm512_movepi32_mask, simde__mmask16, simde__m512i, int, int, int,
+  simde_mm512_movepi32_mask(a))
+SIMDE_BENCH_FUNC(simde_mm512_movepi64_mask, simde__mmask8, simde__m512i, int, int, int,
+  simde_mm512_movepi64_mask(a))
+SIMDE_BENCH_FUNC(simde_mm512_movm_epi32, simde__m512i, simde__mmask16, int, int, int,
+  simde_mm512_movm_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_movm_epi64, simde__m512i, simde__mmask8, int, int, int,
+  simde_mm512_movm_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_range_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_range_ps(a, b, 0x5))
+SIMDE_BENCH_FUNC(simde_mm512_mask_range_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_range_ps(a, b, c, d, 0x5))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_range_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_range_ps(a, b, c, 0x5))
+SIMDE_BENCH_FUNC(simde_mm512_range_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_range_pd(a, b, 0x2))
+SIMDE_BENCH_FUNC(simde_mm512_mask_range_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_range_pd(a, b, c, d, 0x2))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_range_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_range_pd(a, b, c, 0x2))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_reduce_ps(a, 0x11))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_reduce_ps(a, b, c, 0x11))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_reduce_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_reduce_ps(a, b, 0x11))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_reduce_pd(a, 0x11))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_reduce_pd(a, b, c, 0x11))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_reduce_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_reduce_pd(a, b, 0x11))
+SIMDE_BENCH_FUNC(simde_mm512_xor_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_xor_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_xor_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_xor_pd(a, b))
+SIMDE_BENCH_FUNC(simde_kand_mask8, simde__mmask8, simde__mmask8, simde__mmask8, int, int,
+  simde_kand_mask8(a, b))
+SIMDE_BENCH_FUNC(simde_kadd_mask16, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_kadd_mask16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_and_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_and_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_and_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_and_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_andnot_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_andnot_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_andnot_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_andnot_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_or_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_or_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_or_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_or_pd(a, b))
+SIMDE_BENCH_FUNC(simde_ktestc_mask8_u8, unsigned char, simde__mmask8, simde__mmask8, int, int,
+  simde_ktestc_mask8_u8(a, b))
+SIMDE_BENCH_FUNC(simde_kshiftli_mask8, simde__mmask8, simde__mmask8, int, int, int,
+  simde_kshiftli_mask8(a, 3))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm512_mullo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mullo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mullo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi64_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvtepi64_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvtepi64_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepu64_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi64_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepu64_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvttpd_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvttpd_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvttpd_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvttpd_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtpd_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtpd_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_fpclass_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fpclass_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_fpclass_pd_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fpclass_pd_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_movepi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_movepi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_movm_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_movm_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_range_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_range_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_range_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_range_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_range_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_range_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_reduce_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_reduce_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_xor_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_xor_pd),
+  SIMDE_BENCH_ENTRY(simde_kand_mask8),
+  SIMDE_BENCH_ENTRY(simde_kadd_mask16),
+  SIMDE_BENCH_ENTRY(simde_mm512_and_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_and_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_andnot_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_andnot_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_or_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_or_pd),
+  SIMDE_BENCH_ENTRY(simde_ktestc_mask8_u8),
+  SIMDE_BENCH_ENTRY(simde_kshiftli_mask8),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx512dq, "avx512dq")
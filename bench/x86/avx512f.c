@@ -0,0 +1,2008 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx512f.h"
+
+SIMDE_BENCH_FUNC(simde_mm512_broadcast_i32x4, simde__m512i, simde__m128i, int, int, int,
+  simde_mm512_broadcast_i32x4(a))
+SIMDE_BENCH_FUNC(simde_mm512_castpd_ps, simde__m512, simde__m512d, int, int, int,
+  simde_mm512_castpd_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_castpd_si512, simde__m512i, simde__m512d, int, int, int,
+  simde_mm512_castpd_si512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castps_pd, simde__m512d, simde__m512, int, int, int,
+  simde_mm512_castps_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_castps_si512, simde__m512i, simde__m512, int, int, int,
+  simde_mm512_castps_si512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castsi512_ps, simde__m512, simde__m512i, int, int, int,
+  simde_mm512_castsi512_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_castsi512_pd, simde__m512d, simde__m512i, int, int, int,
+  simde_mm512_castsi512_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_castpd128_pd512, simde__m512d, simde__m128d, int, int, int,
+  simde_mm512_castpd128_pd512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castpd256_pd512, simde__m512d, simde__m256d, int, int, int,
+  simde_mm512_castpd256_pd512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castpd512_pd128, simde__m128d, simde__m512d, int, int, int,
+  simde_mm512_castpd512_pd128(a))
+SIMDE_BENCH_FUNC(simde_mm512_castpd512_pd256, simde__m256d, simde__m512d, int, int, int,
+  simde_mm512_castpd512_pd256(a))
+SIMDE_BENCH_FUNC(simde_mm512_castps128_ps512, simde__m512, simde__m128, int, int, int,
+  simde_mm512_castps128_ps512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castps256_ps512, simde__m512, simde__m256, int, int, int,
+  simde_mm512_castps256_ps512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castps512_ps128, simde__m128, simde__m512, int, int, int,
+  simde_mm512_castps512_ps128(a))
+SIMDE_BENCH_FUNC(simde_mm512_castps512_ps256, simde__m256, simde__m512, int, int, int,
+  simde_mm512_castps512_ps256(a))
+SIMDE_BENCH_FUNC(simde_mm512_castsi128_si512, simde__m512i, simde__m128i, int, int, int,
+  simde_mm512_castsi128_si512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castsi256_si512, simde__m512i, simde__m256i, int, int, int,
+  simde_mm512_castsi256_si512(a))
+SIMDE_BENCH_FUNC(simde_mm512_castsi512_si128, simde__m128i, simde__m512i, int, int, int,
+  simde_mm512_castsi512_si128(a))
+SIMDE_BENCH_FUNC(simde_mm512_castsi512_si256, simde__m256i, simde__m512i, int, int, int,
+  simde_mm512_castsi512_si256(a))
+SIMDE_BENCH_FUNC(simde_mm512_load_si512, simde__m512i, int, int, int, int,
+  simde_mm512_load_si512(HEDLEY_REINTERPRET_CAST(simde__m512i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_loadu_si512, simde__m512i, int, int, int, int,
+  simde_mm512_loadu_si512(HEDLEY_REINTERPRET_CAST(simde__m512i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_set_epi8, simde__m512i, int8_t, int8_t, int8_t, int8_t,
+  simde_mm512_set_epi8(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_set_epi16, simde__m512i, int16_t, int16_t, int16_t, int16_t,
+  simde_mm512_set_epi16(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_set_epi32, simde__m512i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm512_set_epi32(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_set_epi64, simde__m512i, int64_t, int64_t, int64_t, int64_t,
+  simde_mm512_set_epi64(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_set_ps, simde__m512, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm512_set_ps(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_set_pd, simde__m512d, simde_float64, simde_float64, simde_float64, simde_float64,
+  simde_mm512_set_pd(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_set1_epi8, simde__m512i, int8_t, int, int, int,
+  simde_mm512_set1_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm512_set1_epi16, simde__m512i, int16_t, int, int, int,
+  simde_mm512_set1_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm512_set1_epi32, simde__m512i, int32_t, int, int, int,
+  simde_mm512_set1_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_set1_epi64, simde__m512i, int64_t, int, int, int,
+  simde_mm512_set1_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_set1_ps, simde__m512, simde_float32, int, int, int,
+  simde_mm512_set1_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_set1_pd, simde__m512d, simde_float64, int, int, int,
+  simde_mm512_set1_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_set4_epi32, simde__m512i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm512_set4_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_set4_epi64, simde__m512i, int64_t, int64_t, int64_t, int64_t,
+  simde_mm512_set4_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_set4_ps, simde__m512, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm512_set4_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_set4_pd, simde__m512d, simde_float64, simde_float64, simde_float64, simde_float64,
+  simde_mm512_set4_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr_epi32, simde__m512i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm512_setr_epi32(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr_epi64, simde__m512i, int64_t, int64_t, int64_t, int64_t,
+  simde_mm512_setr_epi64(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr_ps, simde__m512, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm512_setr_ps(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr_pd, simde__m512d, simde_float64, simde_float64, simde_float64, simde_float64,
+  simde_mm512_setr_pd(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr4_epi32, simde__m512i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm512_setr4_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr4_epi64, simde__m512i, int64_t, int64_t, int64_t, int64_t,
+  simde_mm512_setr4_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr4_ps, simde__m512, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm512_setr4_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_setr4_pd, simde__m512d, simde_float64, simde_float64, simde_float64, simde_float64,
+  simde_mm512_setr4_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_setzero_si512, simde__m512i, int, int, int, int,
+  simde_mm512_setzero_si512())
+SIMDE_BENCH_FUNC(simde_mm512_setone_si512, simde__m512i, int, int, int, int,
+  simde_mm512_setone_si512())
+SIMDE_BENCH_FUNC(simde_mm512_setzero_ps, simde__m512, int, int, int, int,
+  simde_mm512_setzero_ps())
+SIMDE_BENCH_FUNC(simde_mm512_setone_ps, simde__m512, int, int, int, int,
+  simde_mm512_setone_ps())
+SIMDE_BENCH_FUNC(simde_mm512_setzero_pd, simde__m512d, int, int, int, int,
+  simde_mm512_setzero_pd())
+SIMDE_BENCH_FUNC(simde_mm512_setone_pd, simde__m512d, int, int, int, int,
+  simde_mm512_setone_pd())
+SIMDE_BENCH_FUNC(simde_mm512_mask_mov_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_mov_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mov_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_mov_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mov_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_mov_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mov_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_mov_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mov_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_mov_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mov_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_mov_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mov_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_mov_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mov_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_mov_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_compress_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_compress_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_compress_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_compress_epi32(a, b, c))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_compressstoreu_epi32, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_compressstoreu_epi32(HEDLEY_REINTERPRET_CAST(void*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expand_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_expand_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expand_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_expand_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expandloadu_epi32, simde__m512i, simde__mmask16, int, int, int,
+  simde_mm512_maskz_expandloadu_epi32(a, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expandloadu_epi32, simde__m512i, simde__m512i, simde__mmask16, int, int,
+  simde_mm512_mask_expandloadu_epi32(a, b, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_compress_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_compress_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_compress_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_compress_epi64(a, b, c))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_compressstoreu_epi64, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_compressstoreu_epi64(HEDLEY_REINTERPRET_CAST(void*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expand_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_expand_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expand_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_expand_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expandloadu_epi64, simde__m512i, simde__mmask8, int, int, int,
+  simde_mm512_maskz_expandloadu_epi64(a, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expandloadu_epi64, simde__m512i, simde__m512i, simde__mmask8, int, int,
+  simde_mm512_mask_expandloadu_epi64(a, b, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_compress_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_compress_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_compress_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_compress_ps(a, b, c))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_compressstoreu_ps, simde__mmask16, simde__m512, int, int,
+  simde_mm512_mask_compressstoreu_ps(HEDLEY_REINTERPRET_CAST(void*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expand_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_expand_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expand_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_expand_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expandloadu_ps, simde__m512, simde__mmask16, int, int, int,
+  simde_mm512_maskz_expandloadu_ps(a, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expandloadu_ps, simde__m512, simde__m512, simde__mmask16, int, int,
+  simde_mm512_mask_expandloadu_ps(a, b, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_compress_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_compress_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_compress_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_compress_pd(a, b, c))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_compressstoreu_pd, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_mask_compressstoreu_pd(HEDLEY_REINTERPRET_CAST(void*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expand_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_expand_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expand_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_expand_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_expandloadu_pd, simde__m512d, simde__mmask8, int, int, int,
+  simde_mm512_maskz_expandloadu_pd(a, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_expandloadu_pd, simde__m512d, simde__m512d, simde__mmask8, int, int,
+  simde_mm512_mask_expandloadu_pd(a, b, HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm512_srli_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srli_epi64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srli_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_srli_epi64(a, b, c, 1))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srli_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_srli_epi64(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm512_xor_si512, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_xor_si512(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_xor_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_xor_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_xor_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_xor_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_xor_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_xor_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_xor_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_xor_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_xor_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_xor_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_xor_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_xor_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_ternarylogic_epi32, simde__m512i, simde__m512i, simde__m512i, simde__m512i, int,
+  simde_mm512_ternarylogic_epi32(a, b, c, 0x96))
+SIMDE_BENCH_FUNC(simde_mm512_mask_ternarylogic_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_ternarylogic_epi32(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_ternarylogic_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, simde__m512i,
+  simde_mm512_maskz_ternarylogic_epi32(a, b, c, d, 0xE8))
+SIMDE_BENCH_FUNC(simde_mm512_ternarylogic_epi64, simde__m512i, simde__m512i, simde__m512i, simde__m512i, int,
+  simde_mm512_ternarylogic_epi64(a, b, c, 0x96))
+SIMDE_BENCH_FUNC(simde_mm512_mask_ternarylogic_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_ternarylogic_epi64(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_ternarylogic_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, simde__m512i,
+  simde_mm512_maskz_ternarylogic_epi64(a, b, c, d, 0xE8))
+SIMDE_BENCH_FUNC(simde_mm512_mask_test_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_test_epi32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_and_si512, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_and_si512(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_and_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_and_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_and_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_and_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_and_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_and_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_and_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_and_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_and_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_and_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_and_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_and_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_andnot_si512, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_andnot_si512(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_andnot_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_andnot_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_andnot_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_andnot_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_andnot_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_andnot_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_andnot_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_andnot_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_andnot_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_andnot_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_andnot_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_andnot_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_add_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_add_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_add_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_add_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_add_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_add_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_add_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_add_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_add_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_add_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_add_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_add_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_add_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_add_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_add_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_add_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_sub_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_sub_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_sub_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_sub_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_sub_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_sub_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_sub_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_sub_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_sub_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_sub_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_sub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_sub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_sub_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_sub_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_sub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_sub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epi32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epi32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epi64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epi64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epi64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epi32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epi64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epi64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi8_epi32, simde__m512i, simde__m128i, int, int, int,
+  simde_mm512_cvtepi8_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvtepi8_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m128i, int,
+  simde_mm512_mask_cvtepi8_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvtepi8_epi32, simde__m512i, simde__mmask16, simde__m128i, int, int,
+  simde_mm512_maskz_cvtepi8_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi8_epi64, simde__m512i, simde__m128i, int, int, int,
+  simde_mm512_cvtepi8_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvtepi8_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m128i, int,
+  simde_mm512_mask_cvtepi8_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvtepi8_epi64, simde__m512i, simde__mmask8, simde__m128i, int, int,
+  simde_mm512_maskz_cvtepi8_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi32_epi8, simde__m128i, simde__m512i, int, int, int,
+  simde_mm512_cvtepi32_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvtepi32_epi8, simde__m128i, simde__m128i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_cvtepi32_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvtepi32_epi8, simde__m128i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_cvtepi32_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi32_epi16, simde__m256i, simde__m512i, int, int, int,
+  simde_mm512_cvtepi32_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvtepi32_epi16, simde__m256i, simde__m256i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_cvtepi32_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvtepi32_epi16, simde__m256i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_cvtepi32_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi64_epi8, simde__m128i, simde__m512i, int, int, int,
+  simde_mm512_cvtepi64_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvtepi64_epi8, simde__m128i, simde__m128i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_cvtepi64_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvtepi64_epi8, simde__m128i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_cvtepi64_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cvtepi64_epi16, simde__m128i, simde__m512i, int, int, int,
+  simde_mm512_cvtepi64_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvtepi64_epi16, simde__m128i, simde__m128i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_cvtepi64_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvtepi64_epi16, simde__m128i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_cvtepi64_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_div_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_div_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_div_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_div_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_div_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_div_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_div_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_div_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_div_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_div_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_div_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_div_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_max_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_max_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_max_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_max_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_max_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_max_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_max_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_max_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_max_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_max_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_max_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_max_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_min_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_min_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_min_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_min_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_min_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_min_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_min_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_min_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_min_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_min_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_min_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_min_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mul_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_mul_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mul_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_mul_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mul_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_mul_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mul_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_mul_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mul_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_mul_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mul_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_mul_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_or_si512, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_or_si512(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_or_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_or_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_or_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_or_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_or_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_or_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_or_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_or_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_or_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_or_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_or_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_or_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_add_epi32, int32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_add_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_add_epi32, int32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_add_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_add_epi64, int64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_add_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_add_epi64, int64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_add_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_add_ps, simde_float32, simde__m512, int, int, int,
+  simde_mm512_reduce_add_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_add_ps, simde_float32, simde__mmask16, simde__m512, int, int,
+  simde_mm512_mask_reduce_add_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_add_pd, simde_float64, simde__m512d, int, int, int,
+  simde_mm512_reduce_add_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_add_pd, simde_float64, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_mask_reduce_add_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_mul_epi32, int32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_mul_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_mul_epi32, int32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_mul_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_mul_epi64, int64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_mul_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_mul_epi64, int64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_mul_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_mul_ps, simde_float32, simde__m512, int, int, int,
+  simde_mm512_reduce_mul_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_mul_ps, simde_float32, simde__mmask16, simde__m512, int, int,
+  simde_mm512_mask_reduce_mul_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_mul_pd, simde_float64, simde__m512d, int, int, int,
+  simde_mm512_reduce_mul_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_mul_pd, simde_float64, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_mask_reduce_mul_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_and_epi32, int32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_and_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_and_epi32, int32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_and_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_and_epi64, int64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_and_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_and_epi64, int64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_and_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_or_epi32, int32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_or_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_or_epi32, int32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_or_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_or_epi64, int64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_or_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_or_epi64, int64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_or_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_max_epi32, int32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_max_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_max_epi32, int32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_max_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_max_epu32, uint32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_max_epu32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_max_epu32, uint32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_max_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_max_epi64, int64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_max_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_max_epi64, int64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_max_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_max_epu64, uint64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_max_epu64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_max_epu64, uint64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_max_epu64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_max_ps, simde_float32, simde__m512, int, int, int,
+  simde_mm512_reduce_max_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_max_ps, simde_float32, simde__mmask16, simde__m512, int, int,
+  simde_mm512_mask_reduce_max_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_max_pd, simde_float64, simde__m512d, int, int, int,
+  simde_mm512_reduce_max_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_max_pd, simde_float64, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_mask_reduce_max_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_min_epi32, int32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_min_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_min_epi32, int32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_min_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_min_epu32, uint32_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_min_epu32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_min_epu32, uint32_t, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_mask_reduce_min_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_min_epi64, int64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_min_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_min_epi64, int64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_min_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_min_epu64, uint64_t, simde__m512i, int, int, int,
+  simde_mm512_reduce_min_epu64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_min_epu64, uint64_t, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_mask_reduce_min_epu64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_min_ps, simde_float32, simde__m512, int, int, int,
+  simde_mm512_reduce_min_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_min_ps, simde_float32, simde__mmask16, simde__m512, int, int,
+  simde_mm512_mask_reduce_min_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_reduce_min_pd, simde_float64, simde__m512d, int, int, int,
+  simde_mm512_reduce_min_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_reduce_min_pd, simde_float64, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_mask_reduce_min_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_permutexvar_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_permutexvar_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutexvar_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_permutexvar_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutexvar_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_permutexvar_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_permutexvar_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_permutexvar_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutexvar_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_permutexvar_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutexvar_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_permutexvar_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_permutexvar_ps, simde__m512, simde__m512i, simde__m512, int, int,
+  simde_mm512_permutexvar_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutexvar_ps, simde__m512, simde__m512, simde__mmask16, simde__m512i, simde__m512,
+  simde_mm512_mask_permutexvar_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutexvar_ps, simde__m512, simde__mmask16, simde__m512i, simde__m512, int,
+  simde_mm512_maskz_permutexvar_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_permutexvar_pd, simde__m512d, simde__m512i, simde__m512d, int, int,
+  simde_mm512_permutexvar_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutexvar_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512i, simde__m512d,
+  simde_mm512_mask_permutexvar_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutexvar_pd, simde__m512d, simde__mmask8, simde__m512i, simde__m512d, int,
+  simde_mm512_maskz_permutexvar_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_permutex2var_epi32, simde__m512i, simde__m512i, simde__m512i, simde__m512i, int,
+  simde_mm512_permutex2var_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutex2var_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_permutex2var_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask2_permutex2var_epi32, simde__m512i, simde__m512i, simde__m512i, simde__mmask16, simde__m512i,
+  simde_mm512_mask2_permutex2var_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutex2var_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, simde__m512i,
+  simde_mm512_maskz_permutex2var_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_permutex2var_epi64, simde__m512i, simde__m512i, simde__m512i, simde__m512i, int,
+  simde_mm512_permutex2var_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutex2var_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_permutex2var_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask2_permutex2var_epi64, simde__m512i, simde__m512i, simde__m512i, simde__mmask8, simde__m512i,
+  simde_mm512_mask2_permutex2var_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutex2var_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, simde__m512i,
+  simde_mm512_maskz_permutex2var_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_permutex2var_ps, simde__m512, simde__m512, simde__m512i, simde__m512, int,
+  simde_mm512_permutex2var_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutex2var_ps, simde__m512, simde__m512, simde__mmask16, simde__m512i, simde__m512,
+  simde_mm512_mask_permutex2var_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask2_permutex2var_ps, simde__m512, simde__m512, simde__m512i, simde__mmask16, simde__m512,
+  simde_mm512_mask2_permutex2var_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutex2var_ps, simde__m512, simde__mmask16, simde__m512, simde__m512i, simde__m512,
+  simde_mm512_maskz_permutex2var_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_permutex2var_pd, simde__m512d, simde__m512d, simde__m512i, simde__m512d, int,
+  simde_mm512_permutex2var_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_permutex2var_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512i, simde__m512d,
+  simde_mm512_mask_permutex2var_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask2_permutex2var_pd, simde__m512d, simde__m512d, simde__m512i, simde__mmask8, simde__m512d,
+  simde_mm512_mask2_permutex2var_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_permutex2var_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512i, simde__m512d,
+  simde_mm512_maskz_permutex2var_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_shuffle_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_shuffle_epi32(a, 0x1b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_shuffle_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_shuffle_epi32(a, b, c, 0x4e))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_shuffle_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_shuffle_epi32(a, b, 0xb1))
+SIMDE_BENCH_FUNC(simde_mm512_shuffle_i32x4, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_shuffle_i32x4(a, b, 0x4e))
+SIMDE_BENCH_FUNC(simde_mm512_mask_shuffle_i32x4, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_shuffle_i32x4(a, b, c, d, 0x1b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_shuffle_i32x4, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_shuffle_i32x4(a, b, c, 0xe4))
+SIMDE_BENCH_FUNC(simde_mm512_shuffle_i64x2, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_shuffle_i64x2(a, b, 0x4e))
+SIMDE_BENCH_FUNC(simde_mm512_mask_shuffle_i64x2, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_shuffle_i64x2(a, b, c, d, 0x1b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_shuffle_i64x2, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_shuffle_i64x2(a, b, c, 0xe4))
+SIMDE_BENCH_FUNC(simde_mm512_shuffle_f32x4, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_shuffle_f32x4(a, b, 0x4e))
+SIMDE_BENCH_FUNC(simde_mm512_mask_shuffle_f32x4, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_shuffle_f32x4(a, b, c, d, 0x1b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_shuffle_f32x4, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_shuffle_f32x4(a, b, c, 0xe4))
+SIMDE_BENCH_FUNC(simde_mm512_shuffle_f64x2, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_shuffle_f64x2(a, b, 0x4e))
+SIMDE_BENCH_FUNC(simde_mm512_mask_shuffle_f64x2, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_shuffle_f64x2(a, b, c, d, 0x1b))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_shuffle_f64x2, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_shuffle_f64x2(a, b, c, 0xe4))
+SIMDE_BENCH_FUNC(simde_mm512_unpacklo_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpacklo_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpacklo_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_unpacklo_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpacklo_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_unpacklo_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_unpackhi_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpackhi_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpackhi_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_unpackhi_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpackhi_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_unpackhi_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_unpacklo_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpacklo_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpacklo_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_unpacklo_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpacklo_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_unpacklo_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_unpackhi_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_unpackhi_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpackhi_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_unpackhi_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpackhi_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_unpackhi_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_unpacklo_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_unpacklo_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpacklo_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_unpacklo_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpacklo_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_unpacklo_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_unpackhi_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_unpackhi_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpackhi_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_unpackhi_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpackhi_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_unpackhi_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_unpacklo_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_unpacklo_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpacklo_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_unpacklo_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpacklo_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_unpacklo_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_unpackhi_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_unpackhi_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_unpackhi_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_unpackhi_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_unpackhi_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_unpackhi_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_i32gather_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_i32gather_epi32(simde_mm512_and_si512(a, simde_mm512_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i32gather_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_i32gather_epi32(a, b, simde_mm512_and_si512(c, simde_mm512_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_i32gather_ps, simde__m512, simde__m512i, int, int, int,
+  simde_mm512_i32gather_ps(simde_mm512_and_si512(a, simde_mm512_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i32gather_ps, simde__m512, simde__m512, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_i32gather_ps(a, b, simde_mm512_and_si512(c, simde_mm512_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_i32gather_epi64, simde__m512i, simde__m256i, int, int, int,
+  simde_mm512_i32gather_epi64(simde_mm256_and_si256(a, simde_mm256_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i32gather_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m256i, int,
+  simde_mm512_mask_i32gather_epi64(a, b, simde_mm256_and_si256(c, simde_mm256_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC(simde_mm512_i32gather_pd, simde__m512d, simde__m256i, int, int, int,
+  simde_mm512_i32gather_pd(simde_mm256_and_si256(a, simde_mm256_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i32gather_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m256i, int,
+  simde_mm512_mask_i32gather_pd(a, b, simde_mm256_and_si256(c, simde_mm256_set1_epi32(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC(simde_mm512_i64gather_epi32, simde__m256i, simde__m512i, int, int, int,
+  simde_mm512_i64gather_epi32(simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i64gather_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_i64gather_epi32(a, b, simde_mm512_and_si512(c, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_i64gather_ps, simde__m256, simde__m512i, int, int, int,
+  simde_mm512_i64gather_ps(simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i64gather_ps, simde__m256, simde__m256, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_i64gather_ps(a, b, simde_mm512_and_si512(c, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float32*, simde_bench_memory), 4))
+SIMDE_BENCH_FUNC(simde_mm512_i64gather_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_i64gather_epi64(simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i64gather_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_i64gather_epi64(a, b, simde_mm512_and_si512(c, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const int64_t*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC(simde_mm512_i64gather_pd, simde__m512d, simde__m512i, int, int, int,
+  simde_mm512_i64gather_pd(simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC(simde_mm512_mask_i64gather_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_i64gather_pd(a, b, simde_mm512_and_si512(c, simde_mm512_set1_epi64(0xff)), HEDLEY_REINTERPRET_CAST(const simde_float64*, simde_bench_memory), 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i32scatter_epi32, simde__m512i, simde__m512i, int, int,
+  simde_mm512_i32scatter_epi32(HEDLEY_REINTERPRET_CAST(int32_t*, simde_bench_memory), simde_mm512_and_si512(a, simde_mm512_set1_epi32(0xff)), b, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i32scatter_epi32, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_i32scatter_epi32(HEDLEY_REINTERPRET_CAST(int32_t*, simde_bench_memory), a, simde_mm512_and_si512(b, simde_mm512_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i32scatter_ps, simde__m512i, simde__m512, int, int,
+  simde_mm512_i32scatter_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), simde_mm512_and_si512(a, simde_mm512_set1_epi32(0xff)), b, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i32scatter_ps, simde__mmask16, simde__m512i, simde__m512, int,
+  simde_mm512_mask_i32scatter_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a, simde_mm512_and_si512(b, simde_mm512_set1_epi32(0xff)), c, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i32scatter_epi64, simde__m256i, simde__m512i, int, int,
+  simde_mm512_i32scatter_epi64(HEDLEY_REINTERPRET_CAST(int64_t*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi32(0xff)), b, 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i32scatter_epi64, simde__mmask8, simde__m256i, simde__m512i, int,
+  simde_mm512_mask_i32scatter_epi64(HEDLEY_REINTERPRET_CAST(int64_t*, simde_bench_memory), a, simde_mm256_and_si256(b, simde_mm256_set1_epi32(0xff)), c, 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i32scatter_pd, simde__m256i, simde__m512d, int, int,
+  simde_mm512_i32scatter_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), simde_mm256_and_si256(a, simde_mm256_set1_epi32(0xff)), b, 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i32scatter_pd, simde__mmask8, simde__m256i, simde__m512d, int,
+  simde_mm512_mask_i32scatter_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a, simde_mm256_and_si256(b, simde_mm256_set1_epi32(0xff)), c, 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i64scatter_epi32, simde__m512i, simde__m256i, int, int,
+  simde_mm512_i64scatter_epi32(HEDLEY_REINTERPRET_CAST(int32_t*, simde_bench_memory), simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), b, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i64scatter_epi32, simde__mmask8, simde__m512i, simde__m256i, int,
+  simde_mm512_mask_i64scatter_epi32(HEDLEY_REINTERPRET_CAST(int32_t*, simde_bench_memory), a, simde_mm512_and_si512(b, simde_mm512_set1_epi64(0xff)), c, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i64scatter_ps, simde__m512i, simde__m256, int, int,
+  simde_mm512_i64scatter_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), b, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i64scatter_ps, simde__mmask8, simde__m512i, simde__m256, int,
+  simde_mm512_mask_i64scatter_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a, simde_mm512_and_si512(b, simde_mm512_set1_epi64(0xff)), c, 4))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i64scatter_epi64, simde__m512i, simde__m512i, int, int,
+  simde_mm512_i64scatter_epi64(HEDLEY_REINTERPRET_CAST(int64_t*, simde_bench_memory), simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), b, 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i64scatter_epi64, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_i64scatter_epi64(HEDLEY_REINTERPRET_CAST(int64_t*, simde_bench_memory), a, simde_mm512_and_si512(b, simde_mm512_set1_epi64(0xff)), c, 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_i64scatter_pd, simde__m512i, simde__m512d, int, int,
+  simde_mm512_i64scatter_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), simde_mm512_and_si512(a, simde_mm512_set1_epi64(0xff)), b, 8))
+SIMDE_BENCH_FUNC_VOID(simde_mm512_mask_i64scatter_pd, simde__mmask8, simde__m512i, simde__m512d, int,
+  simde_mm512_mask_i64scatter_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a, simde_mm512_and_si512(b, simde_mm512_set1_epi64(0xff)), c, 8))
+SIMDE_BENCH_FUNC(simde_mm512_abs_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_abs_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_abs_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_abs_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_abs_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_abs_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_abs_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_abs_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_abs_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_abs_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_abs_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_abs_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mullo_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_mullo_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mullo_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_mullo_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mullo_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_mullo_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mullox_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_mullox_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mullox_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_mullox_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mul_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_mul_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mul_epi32, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_mul_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mul_epi32, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_mul_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mul_epu32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_mul_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mul_epu32, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_mul_epu32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mul_epu32, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_mul_epu32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_max_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_max_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_max_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_max_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_max_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_max_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_max_epu32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_max_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_max_epu32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_max_epu32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_max_epu32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_max_epu32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_max_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_max_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_max_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_max_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_max_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_max_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_max_epu64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_max_epu64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_max_epu64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_max_epu64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_max_epu64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_max_epu64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_min_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_min_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_min_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_min_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_min_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_min_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_min_epu32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_min_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_min_epu32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_min_epu32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_min_epu32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_min_epu32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_min_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_min_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_min_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_min_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_min_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_min_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_min_epu64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_min_epu64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_min_epu64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_min_epu64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_min_epu64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_min_epu64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_slli_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_slli_epi32(a, 5))
+SIMDE_BENCH_FUNC(simde_mm512_mask_slli_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_slli_epi32(a, b, c, 5))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_slli_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_slli_epi32(a, b, 5))
+SIMDE_BENCH_FUNC(simde_mm512_slli_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_slli_epi64(a, 13))
+SIMDE_BENCH_FUNC(simde_mm512_mask_slli_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_slli_epi64(a, b, c, 13))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_slli_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_slli_epi64(a, b, 13))
+SIMDE_BENCH_FUNC(simde_mm512_srli_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srli_epi32(a, 7))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srli_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_srli_epi32(a, b, c, 7))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srli_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_srli_epi32(a, b, 7))
+SIMDE_BENCH_FUNC(simde_mm512_srai_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srai_epi32(a, 11))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srai_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_srai_epi32(a, b, c, 11))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srai_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_srai_epi32(a, b, 11))
+SIMDE_BENCH_FUNC(simde_mm512_srai_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srai_epi64(a, 29))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srai_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_srai_epi64(a, b, c, 29))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srai_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_srai_epi64(a, b, 29))
+SIMDE_BENCH_FUNC(simde_mm512_sll_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_sll_epi32(a, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sll_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_sll_epi32(a, b, c, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sll_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_sll_epi32(a, b, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_sll_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_sll_epi64(a, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sll_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_sll_epi64(a, b, c, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sll_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_sll_epi64(a, b, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_srl_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srl_epi32(a, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srl_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_srl_epi32(a, b, c, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srl_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_srl_epi32(a, b, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_srl_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_srl_epi64(a, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srl_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_srl_epi64(a, b, c, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srl_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_srl_epi64(a, b, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_sra_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_sra_epi32(a, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sra_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_sra_epi32(a, b, c, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sra_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_sra_epi32(a, b, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_sra_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_sra_epi64(a, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sra_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_sra_epi64(a, b, c, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sra_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_sra_epi64(a, b, simde_mm_set_epi64x(0, 7)))
+SIMDE_BENCH_FUNC(simde_mm512_sllv_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_sllv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sllv_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_sllv_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sllv_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_sllv_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_sllv_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_sllv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sllv_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_sllv_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sllv_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_sllv_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_srlv_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_srlv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srlv_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_srlv_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srlv_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_srlv_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_srlv_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_srlv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srlv_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_srlv_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srlv_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_srlv_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_srav_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_srav_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srav_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_srav_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srav_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_srav_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_srav_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_srav_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_srav_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_srav_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_srav_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_srav_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_rol_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_rol_epi32(a, 7))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rol_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_rol_epi32(a, b, c, 7))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rol_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_rol_epi32(a, b, 7))
+SIMDE_BENCH_FUNC(simde_mm512_rol_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_rol_epi64(a, 17))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rol_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_rol_epi64(a, b, c, 17))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rol_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_rol_epi64(a, b, 17))
+SIMDE_BENCH_FUNC(simde_mm512_ror_epi32, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_ror_epi32(a, 7))
+SIMDE_BENCH_FUNC(simde_mm512_mask_ror_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_ror_epi32(a, b, c, 7))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_ror_epi32, simde__m512i, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_ror_epi32(a, b, 7))
+SIMDE_BENCH_FUNC(simde_mm512_ror_epi64, simde__m512i, simde__m512i, int, int, int,
+  simde_mm512_ror_epi64(a, 17))
+SIMDE_BENCH_FUNC(simde_mm512_mask_ror_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, int,
+  simde_mm512_mask_ror_epi64(a, b, c, 17))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_ror_epi64, simde__m512i, simde__mmask8, simde__m512i, int, int,
+  simde_mm512_maskz_ror_epi64(a, b, 17))
+SIMDE_BENCH_FUNC(simde_mm512_rolv_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_rolv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rolv_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_rolv_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rolv_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_rolv_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_rolv_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_rolv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rolv_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_rolv_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rolv_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_rolv_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_rorv_epi32, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_rorv_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rorv_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_rorv_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rorv_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_rorv_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_rorv_epi64, simde__m512i, simde__m512i, simde__m512i, int, int,
+  simde_mm512_rorv_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rorv_epi64, simde__m512i, simde__m512i, simde__mmask8, simde__m512i, simde__m512i,
+  simde_mm512_mask_rorv_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rorv_epi64, simde__m512i, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_maskz_rorv_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epi32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epi32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epi32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epi32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epi32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epi32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epi32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epi32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epi32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epi32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epi32_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epi32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epi32_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epu32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epu32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epu32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epu32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epu32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epu32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epu32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epu32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epu32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epu32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epu32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epu32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epu32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epu32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epu32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epu32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epu32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epu32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epu32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epu32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epu32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epu32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epu32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epu32_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epu32_mask, simde__mmask16, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epu32_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epu32_mask, simde__mmask16, simde__mmask16, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epu32_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epi64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epi64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epi64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epi64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epi64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epi64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epi64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epi64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epi64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epi64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epi64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epi64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epi64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epi64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epi64_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epi64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epi64_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_cmpeq_epu64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpeq_epu64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpeq_epu64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpeq_epu64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpgt_epu64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpgt_epu64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpgt_epu64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpgt_epu64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpge_epu64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpge_epu64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpge_epu64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpge_epu64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmple_epu64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmple_epu64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmple_epu64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmple_epu64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmplt_epu64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmplt_epu64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmplt_epu64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmplt_epu64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmpneq_epu64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmpneq_epu64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmpneq_epu64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmpneq_epu64_mask(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_epu64_mask, simde__mmask8, simde__m512i, simde__m512i, int, int,
+  simde_mm512_cmp_epu64_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_epu64_mask, simde__mmask8, simde__mmask8, simde__m512i, simde__m512i, int,
+  simde_mm512_mask_cmp_epu64_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm512_fmadd_ps, simde__m512, simde__m512, simde__m512, simde__m512, int,
+  simde_mm512_fmadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fmadd_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_fmadd_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fmadd_ps, simde__m512, simde__m512, simde__m512, simde__m512, simde__mmask16,
+  simde_mm512_mask3_fmadd_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fmadd_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, simde__m512,
+  simde_mm512_maskz_fmadd_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_fmadd_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, int,
+  simde_mm512_fmadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fmadd_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_fmadd_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fmadd_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, simde__mmask8,
+  simde_mm512_mask3_fmadd_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fmadd_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, simde__m512d,
+  simde_mm512_maskz_fmadd_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_fmsub_ps, simde__m512, simde__m512, simde__m512, simde__m512, int,
+  simde_mm512_fmsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fmsub_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_fmsub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fmsub_ps, simde__m512, simde__m512, simde__m512, simde__m512, simde__mmask16,
+  simde_mm512_mask3_fmsub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fmsub_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, simde__m512,
+  simde_mm512_maskz_fmsub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_fmsub_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, int,
+  simde_mm512_fmsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fmsub_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_fmsub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fmsub_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, simde__mmask8,
+  simde_mm512_mask3_fmsub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fmsub_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, simde__m512d,
+  simde_mm512_maskz_fmsub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_fnmadd_ps, simde__m512, simde__m512, simde__m512, simde__m512, int,
+  simde_mm512_fnmadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fnmadd_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_fnmadd_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fnmadd_ps, simde__m512, simde__m512, simde__m512, simde__m512, simde__mmask16,
+  simde_mm512_mask3_fnmadd_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fnmadd_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, simde__m512,
+  simde_mm512_maskz_fnmadd_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_fnmadd_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, int,
+  simde_mm512_fnmadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fnmadd_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_fnmadd_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fnmadd_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, simde__mmask8,
+  simde_mm512_mask3_fnmadd_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fnmadd_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, simde__m512d,
+  simde_mm512_maskz_fnmadd_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_fnmsub_ps, simde__m512, simde__m512, simde__m512, simde__m512, int,
+  simde_mm512_fnmsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fnmsub_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_fnmsub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fnmsub_ps, simde__m512, simde__m512, simde__m512, simde__m512, simde__mmask16,
+  simde_mm512_mask3_fnmsub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fnmsub_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, simde__m512,
+  simde_mm512_maskz_fnmsub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_fnmsub_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, int,
+  simde_mm512_fnmsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fnmsub_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_fnmsub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fnmsub_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, simde__mmask8,
+  simde_mm512_mask3_fnmsub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fnmsub_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, simde__m512d,
+  simde_mm512_maskz_fnmsub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_sqrt_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_sqrt_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sqrt_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_sqrt_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sqrt_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_sqrt_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_sqrt_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_sqrt_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sqrt_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_sqrt_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sqrt_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_sqrt_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_abs_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_abs_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_abs_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_abs_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_abs_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_abs_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_abs_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_abs_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_rcp14_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_rcp14_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rcp14_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_rcp14_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rcp14_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_rcp14_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_rcp14_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_rcp14_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rcp14_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_rcp14_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rcp14_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_rcp14_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_rsqrt14_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_rsqrt14_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rsqrt14_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_rsqrt14_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rsqrt14_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_rsqrt14_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_rsqrt14_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_rsqrt14_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_rsqrt14_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_rsqrt14_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_rsqrt14_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_rsqrt14_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_getexp_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_getexp_ps(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_getexp_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_getexp_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_getexp_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_getexp_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_getexp_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_getexp_pd(a))
+SIMDE_BENCH_FUNC(simde_mm512_mask_getexp_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_getexp_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_getexp_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_getexp_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_getmant_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src))
+SIMDE_BENCH_FUNC(simde_mm512_mask_getmant_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_getmant_ps(a, b, c, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_getmant_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_getmant_ps(a, b, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src))
+SIMDE_BENCH_FUNC(simde_mm512_getmant_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src))
+SIMDE_BENCH_FUNC(simde_mm512_mask_getmant_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_getmant_pd(a, b, c, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_getmant_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_getmant_pd(a, b, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src))
+SIMDE_BENCH_FUNC(simde_mm512_scalef_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_scalef_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_scalef_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_scalef_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_scalef_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_scalef_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_scalef_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_scalef_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_mask_scalef_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_scalef_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_scalef_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_scalef_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_roundscale_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_roundscale_ps(a, 0x20))
+SIMDE_BENCH_FUNC(simde_mm512_mask_roundscale_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_roundscale_ps(a, b, c, 0x20))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_roundscale_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_roundscale_ps(a, b, 0x20))
+SIMDE_BENCH_FUNC(simde_mm512_roundscale_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_roundscale_pd(a, 0x20))
+SIMDE_BENCH_FUNC(simde_mm512_mask_roundscale_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_roundscale_pd(a, b, c, 0x20))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_roundscale_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_roundscale_pd(a, b, 0x20))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_ps_mask, simde__mmask16, simde__m512, simde__m512, int, int,
+  simde_mm512_cmp_ps_mask(a, b, SIMDE_CMP_NLT_UQ))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_ps_mask, simde__mmask16, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_mask_cmp_ps_mask(a, b, c, SIMDE_CMP_NLT_UQ))
+SIMDE_BENCH_FUNC(simde_mm512_cmp_pd_mask, simde__mmask8, simde__m512d, simde__m512d, int, int,
+  simde_mm512_cmp_pd_mask(a, b, SIMDE_CMP_NLT_UQ))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cmp_pd_mask, simde__mmask8, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_mask_cmp_pd_mask(a, b, c, SIMDE_CMP_NLT_UQ))
+SIMDE_BENCH_FUNC(simde_mm512_add_round_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_add_round_ps(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_round_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_add_round_ps(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_round_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_add_round_ps(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_add_round_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_add_round_pd(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_add_round_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_add_round_pd(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_add_round_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_add_round_pd(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_sub_round_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_sub_round_ps(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_round_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_sub_round_ps(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_round_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_sub_round_ps(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_sub_round_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_sub_round_pd(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sub_round_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_sub_round_pd(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sub_round_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_sub_round_pd(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mul_round_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_mul_round_ps(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mul_round_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_mul_round_ps(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mul_round_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_mul_round_ps(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mul_round_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_mul_round_pd(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_mul_round_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_mul_round_pd(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_mul_round_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_mul_round_pd(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_div_round_ps, simde__m512, simde__m512, simde__m512, int, int,
+  simde_mm512_div_round_ps(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_div_round_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_div_round_ps(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_div_round_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, int,
+  simde_mm512_maskz_div_round_ps(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_div_round_pd, simde__m512d, simde__m512d, simde__m512d, int, int,
+  simde_mm512_div_round_pd(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_div_round_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_div_round_pd(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_div_round_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, int,
+  simde_mm512_maskz_div_round_pd(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_sqrt_round_ps, simde__m512, simde__m512, int, int, int,
+  simde_mm512_sqrt_round_ps(a, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sqrt_round_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_sqrt_round_ps(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sqrt_round_ps, simde__m512, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_sqrt_round_ps(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_sqrt_round_pd, simde__m512d, simde__m512d, int, int, int,
+  simde_mm512_sqrt_round_pd(a, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_sqrt_round_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, int,
+  simde_mm512_mask_sqrt_round_pd(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_sqrt_round_pd, simde__m512d, simde__mmask8, simde__m512d, int, int,
+  simde_mm512_maskz_sqrt_round_pd(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_fmadd_round_ps, simde__m512, simde__m512, simde__m512, simde__m512, int,
+  simde_mm512_fmadd_round_ps(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fmadd_round_ps, simde__m512, simde__m512, simde__mmask16, simde__m512, simde__m512,
+  simde_mm512_mask_fmadd_round_ps(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fmadd_round_ps, simde__m512, simde__m512, simde__m512, simde__m512, simde__mmask16,
+  simde_mm512_mask3_fmadd_round_ps(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fmadd_round_ps, simde__m512, simde__mmask16, simde__m512, simde__m512, simde__m512,
+  simde_mm512_maskz_fmadd_round_ps(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_fmadd_round_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, int,
+  simde_mm512_fmadd_round_pd(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_fmadd_round_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m512d, simde__m512d,
+  simde_mm512_mask_fmadd_round_pd(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask3_fmadd_round_pd, simde__m512d, simde__m512d, simde__m512d, simde__m512d, simde__mmask8,
+  simde_mm512_mask3_fmadd_round_pd(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_fmadd_round_pd, simde__m512d, simde__mmask8, simde__m512d, simde__m512d, simde__m512d,
+  simde_mm512_maskz_fmadd_round_pd(a, b, c, d, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_cvt_roundps_epi32, simde__m512i, simde__m512, int, int, int,
+  simde_mm512_cvt_roundps_epi32(a, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvt_roundps_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512, int,
+  simde_mm512_mask_cvt_roundps_epi32(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvt_roundps_epi32, simde__m512i, simde__mmask16, simde__m512, int, int,
+  simde_mm512_maskz_cvt_roundps_epi32(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_cvt_roundpd_epi32, simde__m256i, simde__m512d, int, int, int,
+  simde_mm512_cvt_roundpd_epi32(a, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_cvt_roundepi32_ps, simde__m512, simde__m512i, int, int, int,
+  simde_mm512_cvt_roundepi32_ps(a, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvt_roundepi32_ps, simde__m512, simde__m512, simde__mmask16, simde__m512i, int,
+  simde_mm512_mask_cvt_roundepi32_ps(a, b, c, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvt_roundepi32_ps, simde__m512, simde__mmask16, simde__m512i, int, int,
+  simde_mm512_maskz_cvt_roundepi32_ps(a, b, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_cvt_roundpd_ps, simde__m256, simde__m512d, int, int, int,
+  simde_mm512_cvt_roundpd_ps(a, SIMDE_MM_FROUND_TO_ZERO | SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_cvt_roundps_pd, simde__m512d, simde__m256, int, int, int,
+  simde_mm512_cvt_roundps_pd(a, SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_mask_cvt_roundps_pd, simde__m512d, simde__m512d, simde__mmask8, simde__m256, int,
+  simde_mm512_mask_cvt_roundps_pd(a, b, c, SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_cvt_roundps_pd, simde__m512d, simde__mmask8, simde__m256, int, int,
+  simde_mm512_maskz_cvt_roundps_pd(a, b, SIMDE_MM_FROUND_NO_EXC))
+SIMDE_BENCH_FUNC(simde_kand_mask16, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_kand_mask16(a, b))
+SIMDE_BENCH_FUNC(simde_kxnor_mask16, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_kxnor_mask16(a, b))
+SIMDE_BENCH_FUNC(simde_knot_mask16, simde__mmask16, simde__mmask16, int, int, int,
+  simde_knot_mask16(a))
+SIMDE_BENCH_FUNC(simde_kortestz_mask16_u8, unsigned char, simde__mmask16, simde__mmask16, int, int,
+  simde_kortestz_mask16_u8(a, b))
+SIMDE_BENCH_FUNC(simde_kshiftli_mask16, simde__mmask16, simde__mmask16, int, int, int,
+  simde_kshiftli_mask16(a, 3))
+SIMDE_BENCH_FUNC(simde_mm512_kand, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kand(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_kandn, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kandn(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_kor, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kor(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_kxnor, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kxnor(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_kxor, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kxor(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_knot, simde__mmask16, simde__mmask16, int, int, int,
+  simde_mm512_knot(a))
+SIMDE_BENCH_FUNC(simde_mm512_kmov, simde__mmask16, simde__mmask16, int, int, int,
+  simde_mm512_kmov(a))
+SIMDE_BENCH_FUNC(simde_mm512_kortestz, int, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kortestz(a, b))
+SIMDE_BENCH_FUNC(simde_mm512_kortestc, int, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kortestc(a, b))
+SIMDE_BENCH_FUNC(simde_cvtmask16_u32, unsigned int, simde__mmask16, int, int, int,
+  simde_cvtmask16_u32(a))
+SIMDE_BENCH_FUNC(simde_mm512_kunpackb, simde__mmask16, simde__mmask16, simde__mmask16, int, int,
+  simde_mm512_kunpackb(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm512_broadcast_i32x4),
+  SIMDE_BENCH_ENTRY(simde_mm512_castpd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_castpd_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castps_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_castps_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castsi512_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_castsi512_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_castpd128_pd512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castpd256_pd512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castpd512_pd128),
+  SIMDE_BENCH_ENTRY(simde_mm512_castpd512_pd256),
+  SIMDE_BENCH_ENTRY(simde_mm512_castps128_ps512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castps256_ps512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castps512_ps128),
+  SIMDE_BENCH_ENTRY(simde_mm512_castps512_ps256),
+  SIMDE_BENCH_ENTRY(simde_mm512_castsi128_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castsi256_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_castsi512_si128),
+  SIMDE_BENCH_ENTRY(simde_mm512_castsi512_si256),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_load_si512),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_loadu_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_set_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_set_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_set_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_set_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_set_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_set_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_set1_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_set1_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_set1_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_set1_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_set1_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_set1_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_set4_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_set4_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_set4_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_set4_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr4_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr4_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr4_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_setr4_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_setzero_si512),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_setone_si512),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_setzero_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_setone_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_setzero_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_setone_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mov_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mov_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mov_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mov_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mov_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mov_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mov_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mov_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_compress_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_compress_epi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_compressstoreu_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expand_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expand_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expandloadu_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expandloadu_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_compress_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_compress_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_compressstoreu_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expand_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expand_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expandloadu_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expandloadu_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_compress_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_compress_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_compressstoreu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expand_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expand_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expandloadu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expandloadu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_compress_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_compress_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_compressstoreu_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expand_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expand_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_expandloadu_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_expandloadu_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_srli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_xor_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_xor_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_xor_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_xor_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_xor_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_xor_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_xor_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_test_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_and_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_and_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_and_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_and_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_and_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_and_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_and_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_andnot_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_andnot_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_andnot_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_andnot_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_andnot_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_andnot_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_andnot_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi8_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvtepi8_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvtepi8_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi8_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvtepi8_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvtepi8_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi32_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvtepi32_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvtepi32_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi32_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvtepi32_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvtepi32_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi64_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvtepi64_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvtepi64_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvtepi64_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvtepi64_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvtepi64_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm512_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_max_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_max_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_max_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_max_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_max_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_max_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_min_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_min_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_min_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_min_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_min_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_min_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_or_si512),
+  SIMDE_BENCH_ENTRY(simde_mm512_or_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_or_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_or_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_or_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_or_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_or_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_mul_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_mul_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_mul_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_mul_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_and_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_and_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_and_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_and_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_or_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_or_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_or_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_or_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_max_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_max_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_max_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_max_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_max_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_max_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_max_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_max_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_max_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_max_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_max_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_max_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_min_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_min_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_min_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_min_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_min_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_min_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_min_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_min_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_min_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_min_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_reduce_min_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_reduce_min_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutexvar_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutexvar_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutexvar_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutexvar_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutexvar_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutexvar_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutexvar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutexvar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutexvar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutexvar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutexvar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutexvar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutex2var_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutex2var_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask2_permutex2var_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutex2var_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutex2var_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutex2var_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask2_permutex2var_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutex2var_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutex2var_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutex2var_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask2_permutex2var_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutex2var_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_permutex2var_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_permutex2var_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask2_permutex2var_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_permutex2var_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_shuffle_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_shuffle_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_shuffle_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_shuffle_i32x4),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_shuffle_i32x4),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_shuffle_i32x4),
+  SIMDE_BENCH_ENTRY(simde_mm512_shuffle_i64x2),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_shuffle_i64x2),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_shuffle_i64x2),
+  SIMDE_BENCH_ENTRY(simde_mm512_shuffle_f32x4),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_shuffle_f32x4),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_shuffle_f32x4),
+  SIMDE_BENCH_ENTRY(simde_mm512_shuffle_f64x2),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_shuffle_f64x2),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_shuffle_f64x2),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpacklo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpacklo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpacklo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpackhi_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpackhi_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpackhi_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpacklo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpacklo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpacklo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpackhi_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpackhi_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpackhi_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpacklo_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpacklo_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpacklo_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpackhi_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpackhi_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpackhi_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpacklo_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpacklo_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpacklo_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_unpackhi_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_unpackhi_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_unpackhi_pd),
+
+  SIMDE_BENCH_ENTRY(simde_mm512_i32gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i32gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_i32gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i32gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_i32gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i32gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_i32gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i32gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_i64gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i64gather_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_i64gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i64gather_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_i64gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i64gather_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_i64gather_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_i64gather_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i32scatter_epi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i32scatter_epi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i32scatter_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i32scatter_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i32scatter_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i32scatter_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i32scatter_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i32scatter_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i64scatter_epi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i64scatter_epi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i64scatter_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i64scatter_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i64scatter_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i64scatter_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_i64scatter_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm512_mask_i64scatter_pd),
+
+  SIMDE_BENCH_ENTRY(simde_mm512_abs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_abs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_abs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_abs_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_abs_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_abs_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mullox_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mullox_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mul_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mul_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mul_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mul_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mul_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mul_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_max_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_max_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_max_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_max_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_max_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_max_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_max_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_max_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_max_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_max_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_max_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_max_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_min_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_min_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_min_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_min_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_min_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_min_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm512_min_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_min_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_min_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_min_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_min_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_min_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm512_slli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_slli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_slli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_slli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_slli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_slli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_srli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_srai_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srai_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srai_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_srai_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srai_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srai_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_sll_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sll_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sll_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_sll_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sll_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sll_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_srl_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srl_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srl_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_srl_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srl_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srl_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_sra_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sra_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sra_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_sra_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sra_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sra_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_sllv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sllv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sllv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_sllv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sllv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sllv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_srlv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srlv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srlv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_srlv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srlv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srlv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_srav_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srav_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srav_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_srav_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_srav_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_srav_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_rol_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rol_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rol_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_rol_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rol_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rol_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_ror_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_ror_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_ror_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_ror_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_ror_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_ror_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_rolv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rolv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rolv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_rolv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rolv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rolv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_rorv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rorv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rorv_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_rorv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rorv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rorv_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpeq_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpeq_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpgt_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpgt_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpge_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpge_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmple_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmple_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmplt_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmplt_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmpneq_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmpneq_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_epu64_mask),
+
+  SIMDE_BENCH_ENTRY(simde_mm512_fmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_fmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_fmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_fmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_fnmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fnmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fnmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fnmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_fnmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fnmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fnmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fnmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_fnmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fnmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fnmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fnmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_fnmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fnmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fnmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fnmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_sqrt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sqrt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sqrt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_sqrt_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sqrt_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sqrt_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_abs_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_abs_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_abs_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_abs_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_rcp14_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rcp14_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rcp14_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_rcp14_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rcp14_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rcp14_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_rsqrt14_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rsqrt14_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rsqrt14_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_rsqrt14_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_rsqrt14_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_rsqrt14_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_getexp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_getexp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_getexp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_getexp_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_getexp_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_getexp_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_getmant_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_getmant_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_getmant_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_getmant_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_getmant_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_getmant_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_scalef_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_scalef_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_scalef_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_scalef_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_scalef_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_scalef_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_roundscale_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_roundscale_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_roundscale_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_roundscale_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_roundscale_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_roundscale_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_cmp_pd_mask),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cmp_pd_mask),
+
+  SIMDE_BENCH_ENTRY(simde_mm512_add_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_add_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_add_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_add_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_sub_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sub_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sub_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mul_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mul_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mul_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mul_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_mul_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_mul_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_div_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_div_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_div_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_div_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_div_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_div_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_sqrt_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sqrt_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sqrt_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_sqrt_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_sqrt_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_sqrt_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_fmadd_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fmadd_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fmadd_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fmadd_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_fmadd_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_fmadd_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask3_fmadd_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_fmadd_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvt_roundps_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvt_roundps_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvt_roundps_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvt_roundpd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvt_roundepi32_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvt_roundepi32_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvt_roundepi32_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvt_roundpd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm512_cvt_roundps_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_cvt_roundps_pd),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_cvt_roundps_pd),
+
+  SIMDE_BENCH_ENTRY(simde_kand_mask16),
+  SIMDE_BENCH_ENTRY(simde_kxnor_mask16),
+  SIMDE_BENCH_ENTRY(simde_knot_mask16),
+  SIMDE_BENCH_ENTRY(simde_kortestz_mask16_u8),
+  SIMDE_BENCH_ENTRY(simde_kshiftli_mask16),
+  SIMDE_BENCH_ENTRY(simde_mm512_kand),
+  SIMDE_BENCH_ENTRY(simde_mm512_kandn),
+  SIMDE_BENCH_ENTRY(simde_mm512_kor),
+  SIMDE_BENCH_ENTRY(simde_mm512_kxnor),
+  SIMDE_BENCH_ENTRY(simde_mm512_kxor),
+  SIMDE_BENCH_ENTRY(simde_mm512_knot),
+  SIMDE_BENCH_ENTRY(simde_mm512_kmov),
+  SIMDE_BENCH_ENTRY(simde_mm512_kortestz),
+  SIMDE_BENCH_ENTRY(simde_mm512_kortestc),
+  SIMDE_BENCH_ENTRY(simde_cvtmask16_u32),
+  SIMDE_BENCH_ENTRY(simde_mm512_kunpackb),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx512f, "avx512f")
@@ -0,0 +1,722 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx512vl.h"
+
+SIMDE_BENCH_FUNC(simde_mm_movm_epi8, simde__m128i, simde__mmask16, int, int, int,
+  simde_mm_movm_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm256_movm_epi8, simde__m256i, simde__mmask32, int, int, int,
+  simde_mm256_movm_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm_movm_epi16, simde__m128i, simde__mmask8, int, int, int,
+  simde_mm_movm_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm256_mask_loadu_epi32, simde__m256i, simde__m256i, simde__mmask8, int, int,
+  simde_mm256_mask_loadu_epi32(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_loadu_epi32, simde__m256i, simde__mmask8, int, int, int,
+  simde_mm256_maskz_loadu_epi32(a, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_mask_loadu_epi64, simde__m128i, simde__m128i, simde__mmask8, int, int,
+  simde_mm_mask_loadu_epi64(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_maskz_loadu_epi64, simde__m128i, simde__mmask8, int, int, int,
+  simde_mm_maskz_loadu_epi64(a, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm256_mask_loadu_epi64, simde__m256i, simde__m256i, simde__mmask8, int, int,
+  simde_mm256_mask_loadu_epi64(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_loadu_epi64, simde__m256i, simde__mmask8, int, int, int,
+  simde_mm256_maskz_loadu_epi64(a, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_mask_loadu_ps, simde__m128, simde__m128, simde__mmask8, int, int,
+  simde_mm_mask_loadu_ps(a, b, HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_maskz_loadu_ps, simde__m128, simde__mmask8, int, int, int,
+  simde_mm_maskz_loadu_ps(a, HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_mask_loadu_ps, simde__m256, simde__m256, simde__mmask8, int, int,
+  simde_mm256_mask_loadu_ps(a, b, HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_loadu_ps, simde__m256, simde__mmask8, int, int, int,
+  simde_mm256_maskz_loadu_ps(a, HEDLEY_REINTERPRET_CAST(const float*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_mask_loadu_pd, simde__m128d, simde__m128d, simde__mmask8, int, int,
+  simde_mm_mask_loadu_pd(a, b, HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_maskz_loadu_pd, simde__m128d, simde__mmask8, int, int, int,
+  simde_mm_maskz_loadu_pd(a, HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_mask_loadu_pd, simde__m256d, simde__m256d, simde__mmask8, int, int,
+  simde_mm256_mask_loadu_pd(a, b, HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_loadu_pd, simde__m256d, simde__mmask8, int, int, int,
+  simde_mm256_maskz_loadu_pd(a, HEDLEY_REINTERPRET_CAST(const double*, simde_bench_memory)))
+SIMDE_BENCH_FUNC_VOID(simde_mm_mask_storeu_epi8, simde__mmask16, simde__m128i, int, int,
+  simde_mm_mask_storeu_epi8(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_mask_storeu_epi8, simde__mmask32, simde__m256i, int, int,
+  simde_mm256_mask_storeu_epi8(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_mask_storeu_epi16, simde__mmask8, simde__m128i, int, int,
+  simde_mm_mask_storeu_epi16(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_mask_storeu_epi16, simde__mmask16, simde__m256i, int, int,
+  simde_mm256_mask_storeu_epi16(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_mask_storeu_epi32, simde__mmask8, simde__m128i, int, int,
+  simde_mm_mask_storeu_epi32(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_loadu_epi8, simde__m128i, simde__m128i, simde__mmask16, int, int,
+  simde_mm_mask_loadu_epi8(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_maskz_loadu_epi8, simde__m128i, simde__mmask16, int, int, int,
+  simde_mm_maskz_loadu_epi8(a, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm256_mask_loadu_epi8, simde__m256i, simde__m256i, simde__mmask32, int, int,
+  simde_mm256_mask_loadu_epi8(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_loadu_epi8, simde__m256i, simde__mmask32, int, int, int,
+  simde_mm256_maskz_loadu_epi8(a, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_mask_loadu_epi16, simde__m128i, simde__m128i, simde__mmask8, int, int,
+  simde_mm_mask_loadu_epi16(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_maskz_loadu_epi16, simde__m128i, simde__mmask8, int, int, int,
+  simde_mm_maskz_loadu_epi16(a, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm256_mask_loadu_epi16, simde__m256i, simde__m256i, simde__mmask16, int, int,
+  simde_mm256_mask_loadu_epi16(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_loadu_epi16, simde__m256i, simde__mmask16, int, int, int,
+  simde_mm256_maskz_loadu_epi16(a, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_mask_loadu_epi32, simde__m128i, simde__m128i, simde__mmask8, int, int,
+  simde_mm_mask_loadu_epi32(a, b, simde_bench_memory))
+SIMDE_BENCH_FUNC(simde_mm_maskz_loadu_epi32, simde__m128i, simde__mmask8, int, int, int,
+  simde_mm_maskz_loadu_epi32(a, simde_bench_memory))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_mask_storeu_epi32, simde__mmask8, simde__m256i, int, int,
+  simde_mm256_mask_storeu_epi32(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_mask_storeu_epi64, simde__mmask8, simde__m128i, int, int,
+  simde_mm_mask_storeu_epi64(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_mask_storeu_epi64, simde__mmask8, simde__m256i, int, int,
+  simde_mm256_mask_storeu_epi64(simde_bench_memory, a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_mask_storeu_ps, simde__mmask8, simde__m128, int, int,
+  simde_mm_mask_storeu_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_mask_storeu_ps, simde__mmask8, simde__m256, int, int,
+  simde_mm256_mask_storeu_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_mask_storeu_pd, simde__mmask8, simde__m128d, int, int,
+  simde_mm_mask_storeu_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm256_mask_storeu_pd, simde__mmask8, simde__m256d, int, int,
+  simde_mm256_mask_storeu_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_add_epi8, simde__m128i, simde__m128i, simde__mmask16, simde__m128i, simde__m128i,
+  simde_mm_mask_add_epi8(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_add_epi8, simde__m128i, simde__mmask16, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_add_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_add_epi8, simde__m256i, simde__m256i, simde__mmask32, simde__m256i, simde__m256i,
+  simde_mm256_mask_add_epi8(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_add_epi8, simde__m256i, simde__mmask32, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_add_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_add_epi16, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_add_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_add_epi16, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_add_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_add_epi16, simde__m256i, simde__m256i, simde__mmask16, simde__m256i, simde__m256i,
+  simde_mm256_mask_add_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_add_epi16, simde__m256i, simde__mmask16, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_add_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_add_epi32, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_add_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_add_epi32, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_add_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_add_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_add_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_add_epi32, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_add_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_add_epi64, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_add_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_add_epi64, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_add_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_add_epi64, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_add_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_add_epi64, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_add_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_sub_epi8, simde__m128i, simde__m128i, simde__mmask16, simde__m128i, simde__m128i,
+  simde_mm_mask_sub_epi8(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_sub_epi8, simde__m128i, simde__mmask16, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_sub_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_sub_epi8, simde__m256i, simde__m256i, simde__mmask32, simde__m256i, simde__m256i,
+  simde_mm256_mask_sub_epi8(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_sub_epi8, simde__m256i, simde__mmask32, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_sub_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mul_ps, simde__m256, simde__mmask8, simde__m256, simde__m256, int,
+  simde_mm256_maskz_mul_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_mul_pd, simde__m128d, simde__m128d, simde__mmask8, simde__m128d, simde__m128d,
+  simde_mm_mask_mul_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mul_pd, simde__m128d, simde__mmask8, simde__m128d, simde__m128d, int,
+  simde_mm_maskz_mul_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mul_pd, simde__m256d, simde__m256d, simde__mmask8, simde__m256d, simde__m256d,
+  simde_mm256_mask_mul_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mul_pd, simde__m256d, simde__mmask8, simde__m256d, simde__m256d, int,
+  simde_mm256_maskz_mul_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_div_ps, simde__m128, simde__m128, simde__mmask8, simde__m128, simde__m128,
+  simde_mm_mask_div_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_div_ps, simde__m128, simde__mmask8, simde__m128, simde__m128, int,
+  simde_mm_maskz_div_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_div_ps, simde__m256, simde__m256, simde__mmask8, simde__m256, simde__m256,
+  simde_mm256_mask_div_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_div_ps, simde__m256, simde__mmask8, simde__m256, simde__m256, int,
+  simde_mm256_maskz_div_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_div_pd, simde__m128d, simde__m128d, simde__mmask8, simde__m128d, simde__m128d,
+  simde_mm_mask_div_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_div_pd, simde__m128d, simde__mmask8, simde__m128d, simde__m128d, int,
+  simde_mm_maskz_div_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_div_pd, simde__m256d, simde__m256d, simde__mmask8, simde__m256d, simde__m256d,
+  simde_mm256_mask_div_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_div_pd, simde__m256d, simde__mmask8, simde__m256d, simde__m256d, int,
+  simde_mm256_maskz_div_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi8_mask, simde__mmask16, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi8_mask, simde__mmask32, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi16_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi16_mask, simde__mmask16, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi32_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi32_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi64_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpeq_epi64_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpeq_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi8_mask, simde__mmask16, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi8_mask, simde__mmask32, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi8_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi16_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi16_mask, simde__mmask16, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi16_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi32_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_sub_epi16, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_sub_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_sub_epi16, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_sub_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_sub_epi16, simde__m256i, simde__m256i, simde__mmask16, simde__m256i, simde__m256i,
+  simde_mm256_mask_sub_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_sub_epi16, simde__m256i, simde__mmask16, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_sub_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_sub_epi32, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_sub_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_sub_epi32, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_sub_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_sub_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_sub_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_sub_epi32, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_sub_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_sub_epi64, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_sub_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_sub_epi64, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_sub_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_sub_epi64, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_sub_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_sub_epi64, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_sub_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_mullo_epi32, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_mullo_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mullo_epi32, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_mullo_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mullo_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_mullo_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mullo_epi32, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_mullo_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_add_ps, simde__m128, simde__m128, simde__mmask8, simde__m128, simde__m128,
+  simde_mm_mask_add_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_add_ps, simde__m128, simde__mmask8, simde__m128, simde__m128, int,
+  simde_mm_maskz_add_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_add_ps, simde__m256, simde__m256, simde__mmask8, simde__m256, simde__m256,
+  simde_mm256_mask_add_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_add_ps, simde__m256, simde__mmask8, simde__m256, simde__m256, int,
+  simde_mm256_maskz_add_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_add_pd, simde__m128d, simde__m128d, simde__mmask8, simde__m128d, simde__m128d,
+  simde_mm_mask_add_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_add_pd, simde__m128d, simde__mmask8, simde__m128d, simde__m128d, int,
+  simde_mm_maskz_add_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_add_pd, simde__m256d, simde__m256d, simde__mmask8, simde__m256d, simde__m256d,
+  simde_mm256_mask_add_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_add_pd, simde__m256d, simde__mmask8, simde__m256d, simde__m256d, int,
+  simde_mm256_maskz_add_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_sub_ps, simde__m128, simde__m128, simde__mmask8, simde__m128, simde__m128,
+  simde_mm_mask_sub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_sub_ps, simde__m128, simde__mmask8, simde__m128, simde__m128, int,
+  simde_mm_maskz_sub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_sub_ps, simde__m256, simde__m256, simde__mmask8, simde__m256, simde__m256,
+  simde_mm256_mask_sub_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_sub_ps, simde__m256, simde__mmask8, simde__m256, simde__m256, int,
+  simde_mm256_maskz_sub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_sub_pd, simde__m128d, simde__m128d, simde__mmask8, simde__m128d, simde__m128d,
+  simde_mm_mask_sub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_sub_pd, simde__m128d, simde__mmask8, simde__m128d, simde__m128d, int,
+  simde_mm_maskz_sub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_sub_pd, simde__m256d, simde__m256d, simde__mmask8, simde__m256d, simde__m256d,
+  simde_mm256_mask_sub_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_sub_pd, simde__m256d, simde__mmask8, simde__m256d, simde__m256d, int,
+  simde_mm256_maskz_sub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_mul_ps, simde__m128, simde__m128, simde__mmask8, simde__m128, simde__m128,
+  simde_mm_mask_mul_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mul_ps, simde__m128, simde__mmask8, simde__m128, simde__m128, int,
+  simde_mm_maskz_mul_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mul_ps, simde__m256, simde__m256, simde__mmask8, simde__m256, simde__m256,
+  simde_mm256_mask_mul_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_movepi8_mask, simde__mmask32, simde__m256i, int, int, int,
+  simde_mm256_movepi8_mask(a))
+SIMDE_BENCH_FUNC(simde_mm_movepi16_mask, simde__mmask8, simde__m128i, int, int, int,
+  simde_mm_movepi16_mask(a))
+SIMDE_BENCH_FUNC(simde_mm256_movepi16_mask, simde__mmask16, simde__m256i, int, int, int,
+  simde_mm256_movepi16_mask(a))
+SIMDE_BENCH_FUNC(simde_mm_movepi32_mask, simde__mmask8, simde__m128i, int, int, int,
+  simde_mm_movepi32_mask(a))
+SIMDE_BENCH_FUNC(simde_mm256_movepi32_mask, simde__mmask8, simde__m256i, int, int, int,
+  simde_mm256_movepi32_mask(a))
+SIMDE_BENCH_FUNC(simde_mm_movepi64_mask, simde__mmask8, simde__m128i, int, int, int,
+  simde_mm_movepi64_mask(a))
+SIMDE_BENCH_FUNC(simde_mm256_movepi64_mask, simde__mmask8, simde__m256i, int, int, int,
+  simde_mm256_movepi64_mask(a))
+SIMDE_BENCH_FUNC(simde_mm_mask_mov_epi8, simde__m128i, simde__m128i, simde__mmask16, simde__m128i, int,
+  simde_mm_mask_mov_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mov_epi8, simde__m128i, simde__mmask16, simde__m128i, int, int,
+  simde_mm_maskz_mov_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mov_epi8, simde__m256i, simde__m256i, simde__mmask32, simde__m256i, int,
+  simde_mm256_mask_mov_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mov_epi8, simde__m256i, simde__mmask32, simde__m256i, int, int,
+  simde_mm256_maskz_mov_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_mov_epi16, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, int,
+  simde_mm_mask_mov_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mov_epi16, simde__m128i, simde__mmask8, simde__m128i, int, int,
+  simde_mm_maskz_mov_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mov_epi16, simde__m256i, simde__m256i, simde__mmask16, simde__m256i, int,
+  simde_mm256_mask_mov_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mov_epi16, simde__m256i, simde__mmask16, simde__m256i, int, int,
+  simde_mm256_maskz_mov_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_mov_epi32, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, int,
+  simde_mm_mask_mov_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mov_epi32, simde__m128i, simde__mmask8, simde__m128i, int, int,
+  simde_mm_maskz_mov_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mov_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, int,
+  simde_mm256_mask_mov_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mov_epi32, simde__m256i, simde__mmask8, simde__m256i, int, int,
+  simde_mm256_maskz_mov_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_mov_epi64, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, int,
+  simde_mm_mask_mov_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mov_epi64, simde__m128i, simde__mmask8, simde__m128i, int, int,
+  simde_mm_maskz_mov_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mov_epi64, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, int,
+  simde_mm256_mask_mov_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mov_epi64, simde__m256i, simde__mmask8, simde__m256i, int, int,
+  simde_mm256_maskz_mov_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_mov_ps, simde__m128, simde__m128, simde__mmask8, simde__m128, int,
+  simde_mm_mask_mov_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mov_ps, simde__m128, simde__mmask8, simde__m128, int, int,
+  simde_mm_maskz_mov_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mov_ps, simde__m256, simde__m256, simde__mmask8, simde__m256, int,
+  simde_mm256_mask_mov_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mov_ps, simde__m256, simde__mmask8, simde__m256, int, int,
+  simde_mm256_maskz_mov_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_mov_pd, simde__m128d, simde__m128d, simde__mmask8, simde__m128d, int,
+  simde_mm_mask_mov_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_maskz_mov_pd, simde__m128d, simde__mmask8, simde__m128d, int, int,
+  simde_mm_maskz_mov_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_mov_pd, simde__m256d, simde__m256d, simde__mmask8, simde__m256d, int,
+  simde_mm256_mask_mov_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_mov_pd, simde__m256d, simde__mmask8, simde__m256d, int, int,
+  simde_mm256_maskz_mov_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_movm_epi16, simde__m256i, simde__mmask16, int, int, int,
+  simde_mm256_movm_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm_movm_epi32, simde__m128i, simde__mmask8, int, int, int,
+  simde_mm_movm_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm256_movm_epi32, simde__m256i, simde__mmask8, int, int, int,
+  simde_mm256_movm_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_movm_epi64, simde__m128i, simde__mmask8, int, int, int,
+  simde_mm_movm_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm256_movm_epi64, simde__m256i, simde__mmask8, int, int, int,
+  simde_mm256_movm_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_movepi8_mask, simde__mmask16, simde__m128i, int, int, int,
+  simde_mm_movepi8_mask(a))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi32_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi32_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi64_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_cmpgt_epi64_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmpgt_epi64_mask(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epi8_mask, simde__mmask16, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epi8_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epi8_mask, simde__mmask16, simde__mmask16, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epi8_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epi8_mask, simde__mmask32, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epi8_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epi8_mask, simde__mmask32, simde__mmask32, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epi8_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epi16_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epi16_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epi16_mask, simde__mmask8, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epi16_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epi16_mask, simde__mmask16, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epi16_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epi16_mask, simde__mmask16, simde__mmask16, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epi16_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epi32_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epi32_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epi32_mask, simde__mmask8, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epi32_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epi32_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epi32_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epi32_mask, simde__mmask8, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epi32_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epi64_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epi64_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epi64_mask, simde__mmask8, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epi64_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epi64_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epi64_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epi64_mask, simde__mmask8, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epi64_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epu8_mask, simde__mmask16, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epu8_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epu8_mask, simde__mmask16, simde__mmask16, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epu8_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epu8_mask, simde__mmask32, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epu8_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epu8_mask, simde__mmask32, simde__mmask32, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epu8_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epu16_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epu16_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epu16_mask, simde__mmask8, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epu16_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epu16_mask, simde__mmask16, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epu16_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epu16_mask, simde__mmask16, simde__mmask16, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epu16_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epu32_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epu32_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epu32_mask, simde__mmask8, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epu32_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epu32_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epu32_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epu32_mask, simde__mmask8, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epu32_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_epu64_mask, simde__mmask8, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmp_epu64_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_epu64_mask, simde__mmask8, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_mask_cmp_epu64_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_epu64_mask, simde__mmask8, simde__m256i, simde__m256i, int, int,
+  simde_mm256_cmp_epu64_mask(a, b, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_epu64_mask, simde__mmask8, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_mask_cmp_epu64_mask(a, b, c, SIMDE_MM_CMPINT_LE))
+SIMDE_BENCH_FUNC(simde_mm_cmp_ps_mask, simde__mmask8, simde__m128, simde__m128, int, int,
+  simde_mm_cmp_ps_mask(a, b, SIMDE_CMP_NGE_UQ))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_ps_mask, simde__mmask8, simde__mmask8, simde__m128, simde__m128, int,
+  simde_mm_mask_cmp_ps_mask(a, b, c, SIMDE_CMP_NGE_UQ))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_ps_mask, simde__mmask8, simde__m256, simde__m256, int, int,
+  simde_mm256_cmp_ps_mask(a, b, SIMDE_CMP_NGE_UQ))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_ps_mask, simde__mmask8, simde__mmask8, simde__m256, simde__m256, int,
+  simde_mm256_mask_cmp_ps_mask(a, b, c, SIMDE_CMP_NGE_UQ))
+SIMDE_BENCH_FUNC(simde_mm_cmp_pd_mask, simde__mmask8, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmp_pd_mask(a, b, SIMDE_CMP_EQ_OQ))
+SIMDE_BENCH_FUNC(simde_mm_mask_cmp_pd_mask, simde__mmask8, simde__mmask8, simde__m128d, simde__m128d, int,
+  simde_mm_mask_cmp_pd_mask(a, b, c, SIMDE_CMP_EQ_OQ))
+SIMDE_BENCH_FUNC(simde_mm256_cmp_pd_mask, simde__mmask8, simde__m256d, simde__m256d, int, int,
+  simde_mm256_cmp_pd_mask(a, b, SIMDE_CMP_EQ_OQ))
+SIMDE_BENCH_FUNC(simde_mm256_mask_cmp_pd_mask, simde__mmask8, simde__mmask8, simde__m256d, simde__m256d, int,
+  simde_mm256_mask_cmp_pd_mask(a, b, c, SIMDE_CMP_EQ_OQ))
+SIMDE_BENCH_FUNC(simde_mm256_permutexvar_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_permutexvar_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_permutexvar_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_permutexvar_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_permutexvar_epi32, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_permutexvar_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_permutexvar_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_permutexvar_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_permutexvar_epi64, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_permutexvar_epi64(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_permutexvar_epi64, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_permutexvar_epi64(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_permutexvar_ps, simde__m256, simde__m256i, simde__m256, int, int,
+  simde_mm256_permutexvar_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_permutexvar_ps, simde__m256, simde__m256, simde__mmask8, simde__m256i, simde__m256,
+  simde_mm256_mask_permutexvar_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_permutexvar_ps, simde__m256, simde__mmask8, simde__m256i, simde__m256, int,
+  simde_mm256_maskz_permutexvar_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_permutexvar_pd, simde__m256d, simde__m256i, simde__m256d, int, int,
+  simde_mm256_permutexvar_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_permutexvar_pd, simde__m256d, simde__m256d, simde__mmask8, simde__m256i, simde__m256d,
+  simde_mm256_mask_permutexvar_pd(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_permutexvar_pd, simde__m256d, simde__mmask8, simde__m256i, simde__m256d, int,
+  simde_mm256_maskz_permutexvar_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_permutexvar_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_permutexvar_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_mask_permutexvar_epi16, simde__m256i, simde__m256i, simde__mmask16, simde__m256i, simde__m256i,
+  simde_mm256_mask_permutexvar_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_permutexvar_epi16, simde__m256i, simde__mmask16, simde__m256i, simde__m256i, int,
+  simde_mm256_maskz_permutexvar_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_ternarylogic_epi32, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_ternarylogic_epi32(a, b, c, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm_mask_ternarylogic_epi32, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_ternarylogic_epi32(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm_maskz_ternarylogic_epi32, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, simde__m128i,
+  simde_mm_maskz_ternarylogic_epi32(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm_ternarylogic_epi64, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_ternarylogic_epi64(a, b, c, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm_mask_ternarylogic_epi64, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_ternarylogic_epi64(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm_maskz_ternarylogic_epi64, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, simde__m128i,
+  simde_mm_maskz_ternarylogic_epi64(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm_permutexvar_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_permutexvar_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mask_permutexvar_epi16, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_permutexvar_epi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_permutexvar_epi16, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, int,
+  simde_mm_maskz_permutexvar_epi16(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_ternarylogic_epi32, simde__m256i, simde__m256i, simde__m256i, simde__m256i, int,
+  simde_mm256_ternarylogic_epi32(a, b, c, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm256_mask_ternarylogic_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_ternarylogic_epi32(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_ternarylogic_epi32, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, simde__m256i,
+  simde_mm256_maskz_ternarylogic_epi32(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm256_ternarylogic_epi64, simde__m256i, simde__m256i, simde__m256i, simde__m256i, int,
+  simde_mm256_ternarylogic_epi64(a, b, c, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm256_mask_ternarylogic_epi64, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_ternarylogic_epi64(a, b, c, d, 0xCA))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_ternarylogic_epi64, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, simde__m256i,
+  simde_mm256_maskz_ternarylogic_epi64(a, b, c, d, 0xCA))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_movm_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_movm_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_movm_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_loadu_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_loadu_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_loadu_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_loadu_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_loadu_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_loadu_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_loadu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_loadu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_loadu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_loadu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_loadu_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_loadu_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_loadu_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_loadu_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_mask_storeu_epi8),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_mask_storeu_epi8),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_mask_storeu_epi16),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_mask_storeu_epi16),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_mask_storeu_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_loadu_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_loadu_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_loadu_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_loadu_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_loadu_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_loadu_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_loadu_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_loadu_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_loadu_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_loadu_epi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_mask_storeu_epi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_mask_storeu_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_mask_storeu_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_mask_storeu_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_mask_storeu_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_mask_storeu_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm256_mask_storeu_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpeq_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_movepi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_movepi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_movepi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_movepi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_movepi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_movepi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_movepi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mov_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mov_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mov_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mov_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mov_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mov_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mov_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mov_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mov_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mov_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mov_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mov_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mov_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mov_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mov_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mov_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mov_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mov_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mov_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mov_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_mov_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_mov_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_mov_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_mov_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_movm_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_movm_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_movm_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_movm_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_movm_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_movepi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmpgt_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epi8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epi16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epi32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epi64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epu8_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epu16_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epu32_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_epu64_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_ps_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_cmp_pd_mask),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_cmp_pd_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_cmp_pd_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_cmp_pd_mask),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutexvar_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_permutexvar_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_permutexvar_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutexvar_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_permutexvar_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_permutexvar_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutexvar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_permutexvar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_permutexvar_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutexvar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_permutexvar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_permutexvar_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_permutexvar_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_ternarylogic_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_ternarylogic_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_ternarylogic_epi64),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx512vl, "avx512vl")
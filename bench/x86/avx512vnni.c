@@ -0,0 +1,86 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/avx512vnni.h"
+
+SIMDE_BENCH_FUNC(simde_mm512_dpbusd_epi32, simde__m512i, simde__m512i, simde__m512i, simde__m512i, int,
+  simde_mm512_dpbusd_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_dpbusd_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_dpbusd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_dpbusd_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, simde__m512i,
+  simde_mm512_maskz_dpbusd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_dpwssd_epi32, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_dpwssd_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_dpwssd_epi32, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_dpwssd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_dpwssd_epi32, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, simde__m128i,
+  simde_mm_maskz_dpwssd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_dpbusd_epi32, simde__m256i, simde__m256i, simde__m256i, simde__m256i, int,
+  simde_mm256_dpbusd_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_dpbusd_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_dpbusd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_dpbusd_epi32, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, simde__m256i,
+  simde_mm256_maskz_dpbusd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_dpbusd_epi32, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_dpbusd_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_mask_dpbusd_epi32, simde__m128i, simde__m128i, simde__mmask8, simde__m128i, simde__m128i,
+  simde_mm_mask_dpbusd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_maskz_dpbusd_epi32, simde__m128i, simde__mmask8, simde__m128i, simde__m128i, simde__m128i,
+  simde_mm_maskz_dpbusd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_dpwssd_epi32, simde__m512i, simde__m512i, simde__m512i, simde__m512i, int,
+  simde_mm512_dpwssd_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm512_mask_dpwssd_epi32, simde__m512i, simde__m512i, simde__mmask16, simde__m512i, simde__m512i,
+  simde_mm512_mask_dpwssd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm512_maskz_dpwssd_epi32, simde__m512i, simde__mmask16, simde__m512i, simde__m512i, simde__m512i,
+  simde_mm512_maskz_dpwssd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_dpwssd_epi32, simde__m256i, simde__m256i, simde__m256i, simde__m256i, int,
+  simde_mm256_dpwssd_epi32(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_mask_dpwssd_epi32, simde__m256i, simde__m256i, simde__mmask8, simde__m256i, simde__m256i,
+  simde_mm256_mask_dpwssd_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm256_maskz_dpwssd_epi32, simde__m256i, simde__mmask8, simde__m256i, simde__m256i, simde__m256i,
+  simde_mm256_maskz_dpwssd_epi32(a, b, c, d))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm512_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mask_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_maskz_dpbusd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_mask_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm512_maskz_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_mask_dpwssd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_maskz_dpwssd_epi32),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, avx512vnni, "avx512vnni")
@@ -0,0 +1,128 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/fma.h"
+
+SIMDE_BENCH_FUNC(simde_mm_fmadd_pd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fmadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmadd_pd, simde__m256d, simde__m256d, simde__m256d, simde__m256d, int,
+  simde_mm256_fmadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmadd_ps, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fmadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmadd_ps, simde__m256, simde__m256, simde__m256, simde__m256, int,
+  simde_mm256_fmadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmadd_sd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fmadd_sd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmadd_ss, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fmadd_ss(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmaddsub_pd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fmaddsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmaddsub_pd, simde__m256d, simde__m256d, simde__m256d, simde__m256d, int,
+  simde_mm256_fmaddsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmaddsub_ps, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fmaddsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmaddsub_ps, simde__m256, simde__m256, simde__m256, simde__m256, int,
+  simde_mm256_fmaddsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmsub_pd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fmsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmsub_pd, simde__m256d, simde__m256d, simde__m256d, simde__m256d, int,
+  simde_mm256_fmsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmsub_ps, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fmsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmsub_ps, simde__m256, simde__m256, simde__m256, simde__m256, int,
+  simde_mm256_fmsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmsub_sd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fmsub_sd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmsub_ss, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fmsub_ss(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmsubadd_pd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fmsubadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmsubadd_pd, simde__m256d, simde__m256d, simde__m256d, simde__m256d, int,
+  simde_mm256_fmsubadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fmsubadd_ps, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fmsubadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fmsubadd_ps, simde__m256, simde__m256, simde__m256, simde__m256, int,
+  simde_mm256_fmsubadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmadd_pd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fnmadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fnmadd_pd, simde__m256d, simde__m256d, simde__m256d, simde__m256d, int,
+  simde_mm256_fnmadd_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmadd_ps, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fnmadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fnmadd_ps, simde__m256, simde__m256, simde__m256, simde__m256, int,
+  simde_mm256_fnmadd_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmadd_sd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fnmadd_sd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmadd_ss, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fnmadd_ss(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmsub_pd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fnmsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fnmsub_pd, simde__m256d, simde__m256d, simde__m256d, simde__m256d, int,
+  simde_mm256_fnmsub_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmsub_ps, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fnmsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm256_fnmsub_ps, simde__m256, simde__m256, simde__m256, simde__m256, int,
+  simde_mm256_fnmsub_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmsub_sd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_fnmsub_sd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_fnmsub_ss, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_fnmsub_ss(a, b, c))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_fmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_fmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_fmadd_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_fmadd_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_fmaddsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmaddsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_fmaddsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmaddsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_fmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_fmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_fmsub_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_fmsub_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_fmsubadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmsubadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_fmsubadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_fmsubadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_fnmadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_fnmadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmadd_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmadd_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm256_fnmsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm256_fnmsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmsub_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_fnmsub_ss),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, fma, "fma")
@@ -0,0 +1,236 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/mmx.h"
+
+SIMDE_BENCH_FUNC(simde_mm_add_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_add_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_add_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_add_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_adds_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_pu8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_adds_pu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_adds_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_pu16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_adds_pu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_and_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_and_si64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_andnot_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_andnot_si64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_cmpeq_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_cmpeq_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_cmpeq_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_cmpgt_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_cmpgt_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_cmpgt_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtm64_si64, int64_t, simde__m64, int, int, int,
+  simde_mm_cvtm64_si64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi32_si64, simde__m64, int32_t, int, int, int,
+  simde_mm_cvtsi32_si64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi64_m64, simde__m64, int64_t, int, int, int,
+  simde_mm_cvtsi64_m64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi64_si32, int32_t, simde__m64, int, int, int,
+  simde_mm_cvtsi64_si32(a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_empty, int, int, int, int,
+  simde_mm_empty())
+SIMDE_BENCH_FUNC(simde_mm_madd_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_madd_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mulhi_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_mulhi_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mullo_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_mullo_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_or_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_or_si64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_packs_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_packs_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_packs_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_packs_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_packs_pu16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_packs_pu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_set_pi8, simde__m64, int8_t, int8_t, int8_t, int8_t,
+  simde_mm_set_pi8(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm_set_pi16, simde__m64, int16_t, int16_t, int16_t, int16_t,
+  simde_mm_set_pi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_set_pi32, simde__m64, int32_t, int32_t, int, int,
+  simde_mm_set_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_set1_pi8, simde__m64, int8_t, int, int, int,
+  simde_mm_set1_pi8(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_pi16, simde__m64, int16_t, int, int, int,
+  simde_mm_set1_pi16(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_pi32, simde__m64, int32_t, int, int, int,
+  simde_mm_set1_pi32(a))
+SIMDE_BENCH_FUNC(simde_mm_setr_pi8, simde__m64, int8_t, int8_t, int8_t, int8_t,
+  simde_mm_setr_pi8(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm_setr_pi16, simde__m64, int16_t, int16_t, int16_t, int16_t,
+  simde_mm_setr_pi16(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_setr_pi32, simde__m64, int32_t, int32_t, int, int,
+  simde_mm_setr_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_setzero_si64, simde__m64, int, int, int, int,
+  simde_mm_setzero_si64())
+SIMDE_BENCH_FUNC(simde_mm_setone_si64, simde__m64, int, int, int, int,
+  simde_mm_setone_si64())
+SIMDE_BENCH_FUNC(simde_mm_sll_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sll_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sll_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sll_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_slli_pi16, simde__m64, simde__m64, int, int, int,
+  simde_mm_slli_pi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_slli_pi32, simde__m64, simde__m64, int, int, int,
+  simde_mm_slli_pi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_slli_si64, simde__m64, simde__m64, int, int, int,
+  simde_mm_slli_si64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_sll_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sll_si64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srl_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_srl_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srl_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_srl_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srli_pi16, simde__m64, simde__m64, int, int, int,
+  simde_mm_srli_pi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srli_pi32, simde__m64, simde__m64, int, int, int,
+  simde_mm_srli_pi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srli_si64, simde__m64, simde__m64, int, int, int,
+  simde_mm_srli_si64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srl_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_srl_si64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srai_pi16, simde__m64, simde__m64, int, int, int,
+  simde_mm_srai_pi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srai_pi32, simde__m64, simde__m64, int, int, int,
+  simde_mm_srai_pi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_sra_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sra_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sra_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sra_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sub_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sub_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sub_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_subs_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_pu8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_subs_pu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_subs_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_pu16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_subs_pu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_unpackhi_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_unpackhi_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_unpackhi_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_unpacklo_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_unpacklo_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_unpacklo_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_xor_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_xor_si64(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_add_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_add_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_add_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_pu8),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_pu16),
+  SIMDE_BENCH_ENTRY(simde_mm_and_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_andnot_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtm64_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi32_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi64_m64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi64_si32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_empty),
+  SIMDE_BENCH_ENTRY(simde_mm_madd_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mulhi_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mullo_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_or_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_packs_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_packs_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_packs_pu16),
+  SIMDE_BENCH_ENTRY(simde_mm_set_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_set_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_set_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_pi32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setzero_si64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setone_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_sll_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sll_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_slli_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_slli_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_slli_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_sll_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_srl_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_srl_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_srli_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_srli_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_srli_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_srl_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_srai_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_srai_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_sra_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sra_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_pu8),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_pu16),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_xor_si64),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, mmx, "mmx")
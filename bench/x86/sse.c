@@ -0,0 +1,410 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/sse.h"
+
+SIMDE_BENCH_FUNC(simde_mm_set_ps, simde__m128, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm_set_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_set_ps1, simde__m128, simde_float32, int, int, int,
+  simde_mm_set_ps1(a))
+SIMDE_BENCH_FUNC(simde_mm_move_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_move_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_add_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_add_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_and_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_and_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_andnot_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_andnot_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_avg_pu16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_avg_pu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_avg_pu8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_avg_pu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpeq_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpeq_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpge_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpge_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpge_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpge_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpgt_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpgt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmple_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmple_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmple_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmple_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmplt_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmplt_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmplt_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmplt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpneq_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpneq_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpneq_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpneq_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnge_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpnge_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnge_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpnge_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpngt_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpngt_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpngt_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpngt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnle_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpnle_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnle_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpnle_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnlt_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpnlt_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnlt_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpnlt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpord_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpord_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpunord_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpunord_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpunord_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpunord_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comieq_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_comieq_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comige_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_comige_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comigt_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_comigt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comile_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_comile_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comilt_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_comilt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comineq_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_comineq_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvt_pi2ps, simde__m128, simde__m128, simde__m64, int, int,
+  simde_mm_cvt_pi2ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvt_ps2pi, simde__m64, simde__m128, int, int, int,
+  simde_mm_cvt_ps2pi(a))
+SIMDE_BENCH_FUNC(simde_mm_cvt_si2ss, simde__m128, simde__m128, int32_t, int, int,
+  simde_mm_cvt_si2ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvt_ss2si, int32_t, simde__m128, int, int, int,
+  simde_mm_cvt_ss2si(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpi16_ps, simde__m128, simde__m64, int, int, int,
+  simde_mm_cvtpi16_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpi32_ps, simde__m128, simde__m128, simde__m64, int, int,
+  simde_mm_cvtpi32_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtpi32x2_ps, simde__m128, simde__m64, simde__m64, int, int,
+  simde_mm_cvtpi32x2_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtpi8_ps, simde__m128, simde__m64, int, int, int,
+  simde_mm_cvtpi8_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtps_pi16, simde__m64, simde__m128, int, int, int,
+  simde_mm_cvtps_pi16(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtps_pi32, simde__m64, simde__m128, int, int, int,
+  simde_mm_cvtps_pi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtps_pi8, simde__m64, simde__m128, int, int, int,
+  simde_mm_cvtps_pi8(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpu16_ps, simde__m128, simde__m64, int, int, int,
+  simde_mm_cvtpu16_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpu8_ps, simde__m128, simde__m64, int, int, int,
+  simde_mm_cvtpu8_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi64_ss, simde__m128, simde__m128, int64_t, int, int,
+  simde_mm_cvtsi64_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtss_f32, simde_float32, simde__m128, int, int, int,
+  simde_mm_cvtss_f32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtss_si32, int32_t, simde__m128, int, int, int,
+  simde_mm_cvtss_si32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtss_si64, int64_t, simde__m128, int, int, int,
+  simde_mm_cvtss_si64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtt_ps2pi, simde__m64, simde__m128, int, int, int,
+  simde_mm_cvtt_ps2pi(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtt_ss2si, int32_t, simde__m128, int, int, int,
+  simde_mm_cvtt_ss2si(a))
+SIMDE_BENCH_FUNC(simde_mm_cvttss_si64, int64_t, simde__m128, int, int, int,
+  simde_mm_cvttss_si64(a))
+SIMDE_BENCH_FUNC(simde_mm_cmpord_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_cmpord_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_div_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_div_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_extract_pi16, int16_t, simde__m64, int, int, int,
+  simde_mm_extract_pi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_insert_pi16, simde__m64, simde__m64, int16_t, int, int,
+  simde_mm_insert_pi16(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_load_ps, simde__m128, int, int, int, int,
+  simde_mm_load_ps(HEDLEY_REINTERPRET_CAST(simde_float32 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_load_ps1, simde__m128, int, int, int, int,
+  simde_mm_load_ps1(HEDLEY_REINTERPRET_CAST(simde_float32 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_load_ss, simde__m128, int, int, int, int,
+  simde_mm_load_ss(HEDLEY_REINTERPRET_CAST(simde_float32 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadh_pi, simde__m128, simde__m128, int, int, int,
+  simde_mm_loadh_pi(a, HEDLEY_REINTERPRET_CAST(simde__m64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadl_pi, simde__m128, simde__m128, int, int, int,
+  simde_mm_loadl_pi(a, HEDLEY_REINTERPRET_CAST(simde__m64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadr_ps, simde__m128, int, int, int, int,
+  simde_mm_loadr_ps(HEDLEY_REINTERPRET_CAST(simde_float32 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadu_ps, simde__m128, int, int, int, int,
+  simde_mm_loadu_ps(HEDLEY_REINTERPRET_CAST(simde_float32 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC_VOID(simde_mm_maskmove_si64, simde__m64, simde__m64, int, int,
+  simde_mm_maskmove_si64(a, b, HEDLEY_REINTERPRET_CAST(int8_t*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_max_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_max_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_max_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_pu8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_max_pu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_max_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_min_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_min_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_pu8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_min_pu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_min_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_movehl_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_movehl_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_movelh_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_movelh_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_movemask_pi8, int, simde__m64, int, int, int,
+  simde_mm_movemask_pi8(a))
+SIMDE_BENCH_FUNC(simde_mm_movemask_ps, int, simde__m128, int, int, int,
+  simde_mm_movemask_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_mul_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_mul_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mul_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_mul_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mulhi_pu16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_mulhi_pu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_or_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_or_ps(a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_prefetch, int, int, int, int,
+  simde_mm_prefetch(HEDLEY_REINTERPRET_CAST(char const*, simde_bench_memory), 1))
+SIMDE_BENCH_FUNC(simde_mm_rcp_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_rcp_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_rcp_ss, simde__m128, simde__m128, int, int, int,
+  simde_mm_rcp_ss(a))
+SIMDE_BENCH_FUNC(simde_mm_rsqrt_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_rsqrt_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_rsqrt_ss, simde__m128, simde__m128, int, int, int,
+  simde_mm_rsqrt_ss(a))
+SIMDE_BENCH_FUNC(simde_mm_sad_pu8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sad_pu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_set_ss, simde__m128, simde_float32, int, int, int,
+  simde_mm_set_ss(a))
+SIMDE_BENCH_FUNC(simde_mm_setr_ps, simde__m128, simde_float32, simde_float32, simde_float32, simde_float32,
+  simde_mm_setr_ps(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_setzero_ps, simde__m128, int, int, int, int,
+  simde_mm_setzero_ps())
+SIMDE_BENCH_FUNC(simde_mm_undefined_ps, simde__m128, int, int, int, int,
+  simde_mm_undefined_ps())
+SIMDE_BENCH_FUNC(simde_mm_setone_ps, simde__m128, int, int, int, int,
+  simde_mm_setone_ps())
+SIMDE_BENCH_FUNC_VOID(simde_mm_sfence, int, int, int, int,
+  simde_mm_sfence())
+SIMDE_BENCH_FUNC(simde_mm_shuffle_pi16, simde__m64, simde__m64, int, int, int,
+  simde_mm_shuffle_pi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_shuffle_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_shuffle_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_sqrt_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_sqrt_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_sqrt_ss, simde__m128, simde__m128, int, int, int,
+  simde_mm_sqrt_ss(a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store_ps, simde__m128, int, int, int,
+  simde_mm_store_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store_ps1, simde__m128, int, int, int,
+  simde_mm_store_ps1(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store_ss, simde__m128, int, int, int,
+  simde_mm_store_ss(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store1_ps, simde__m128, int, int, int,
+  simde_mm_store1_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storeh_pi, simde__m128, int, int, int,
+  simde_mm_storeh_pi(HEDLEY_REINTERPRET_CAST(simde__m64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storel_pi, simde__m128, int, int, int,
+  simde_mm_storel_pi(HEDLEY_REINTERPRET_CAST(simde__m64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storer_ps, simde__m128, int, int, int,
+  simde_mm_storer_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storeu_ps, simde__m128, int, int, int,
+  simde_mm_storeu_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC(simde_mm_sub_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_sub_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_sub_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomieq_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_ucomieq_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomige_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_ucomige_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomigt_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_ucomigt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomile_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_ucomile_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomilt_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_ucomilt_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomineq_ss, int, simde__m128, simde__m128, int, int,
+  simde_mm_ucomineq_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_unpackhi_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_unpacklo_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_xor_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_xor_ps(a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_stream_pi, simde__m64, int, int, int,
+  simde_mm_stream_pi(HEDLEY_REINTERPRET_CAST(simde__m64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_stream_ps, simde__m128, int, int, int,
+  simde_mm_stream_ps(HEDLEY_REINTERPRET_CAST(simde_float32*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC(simde_mm_getcsr, uint32_t, int, int, int, int,
+  simde_mm_getcsr())
+SIMDE_BENCH_FUNC_VOID(simde_mm_setcsr, int, int, int, int,
+  simde_mm_setcsr(simde_mm_getcsr()))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_set_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_set_ps1),
+  SIMDE_BENCH_ENTRY(simde_mm_move_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_add_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_add_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_and_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_andnot_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_avg_pu16),
+  SIMDE_BENCH_ENTRY(simde_mm_avg_pu8),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpge_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpge_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmple_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmple_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmplt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmplt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpneq_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpneq_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnge_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnge_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpngt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpngt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnle_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnle_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnlt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnlt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpord_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpunord_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpunord_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_comieq_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_comige_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_comigt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_comile_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_comilt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_comineq_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cvt_pi2ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvt_ps2pi),
+  SIMDE_BENCH_ENTRY(simde_mm_cvt_si2ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cvt_ss2si),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpi16_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpi32_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpi32x2_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpi8_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtps_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtps_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtps_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpu16_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpu8_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi64_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtss_f32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtss_si32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtss_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtt_ps2pi),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtt_ss2si),
+  SIMDE_BENCH_ENTRY(simde_mm_cvttss_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpord_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_div_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_div_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_extract_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_insert_pi16),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_load_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_load_ps1),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_load_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_loadh_pi),
+  SIMDE_BENCH_ENTRY(simde_mm_loadl_pi),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_loadr_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_loadu_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_maskmove_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_max_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_max_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_max_pu8),
+  SIMDE_BENCH_ENTRY(simde_mm_max_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_min_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_min_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_min_pu8),
+  SIMDE_BENCH_ENTRY(simde_mm_min_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_movehl_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_movelh_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_movemask_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_movemask_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mul_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_mul_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_mulhi_pu16),
+  SIMDE_BENCH_ENTRY(simde_mm_or_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_prefetch),
+  SIMDE_BENCH_ENTRY(simde_mm_rcp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_rcp_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_rsqrt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_rsqrt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_sad_pu8),
+  SIMDE_BENCH_ENTRY(simde_mm_set_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setzero_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_undefined_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setone_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_sfence),
+  SIMDE_BENCH_ENTRY(simde_mm_shuffle_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_shuffle_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_sqrt_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_sqrt_ss),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store_ps1),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store_ss),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store1_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storeh_pi),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storel_pi),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storer_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storeu_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomieq_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomige_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomigt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomile_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomilt_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomineq_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_xor_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_stream_pi),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_stream_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_getcsr),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setcsr),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, sse, "sse")
@@ -0,0 +1,701 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/sse2.h"
+
+SIMDE_BENCH_FUNC(simde_mm_add_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_add_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_add_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_add_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_add_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_add_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_move_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_move_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_add_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_add_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_add_si64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_adds_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_adds_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_adds_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_adds_epu16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_adds_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_and_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_and_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_and_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_and_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_andnot_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_andnot_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_andnot_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_andnot_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_avg_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_avg_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_avg_epu16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_avg_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_bslli_si128, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_bslli_si128(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_setzero_si128, simde__m128i, int, int, int, int,
+  simde_mm_setzero_si128())
+SIMDE_BENCH_FUNC(simde_mm_bsrli_si128, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_bsrli_si128(a, 1))
+SIMDE_BENCH_FUNC_VOID(simde_mm_clflush, int, int, int, int,
+  simde_mm_clflush(HEDLEY_REINTERPRET_CAST(void const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_comieq_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_comieq_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comige_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_comige_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comigt_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_comigt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comile_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_comile_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comilt_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_comilt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_comineq_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_comineq_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_castpd_ps, simde__m128, simde__m128d, int, int, int,
+  simde_mm_castpd_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_castpd_si128, simde__m128i, simde__m128d, int, int, int,
+  simde_mm_castpd_si128(a))
+SIMDE_BENCH_FUNC(simde_mm_castps_pd, simde__m128d, simde__m128, int, int, int,
+  simde_mm_castps_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_castps_si128, simde__m128i, simde__m128, int, int, int,
+  simde_mm_castps_si128(a))
+SIMDE_BENCH_FUNC(simde_mm_castsi128_pd, simde__m128d, simde__m128i, int, int, int,
+  simde_mm_castsi128_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_castsi128_ps, simde__m128, simde__m128i, int, int, int,
+  simde_mm_castsi128_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpeq_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpeq_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpneq_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpneq_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpneq_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpneq_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmplt_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmplt_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmplt_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmplt_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmplt_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmplt_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmplt_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmplt_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmplt_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmplt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmple_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmple_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmple_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmple_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpgt_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpgt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpge_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpge_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpge_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpge_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnge_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpnge_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnge_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpnge_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnlt_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpnlt_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnlt_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpnlt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnle_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpnle_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpnle_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpnle_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpord_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpord_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtsd_f64, simde_float64, simde__m128d, int, int, int,
+  simde_mm_cvtsd_f64(a))
+SIMDE_BENCH_FUNC(simde_mm_cmpord_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpord_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpunord_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpunord_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpunord_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_cmpunord_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi32_pd, simde__m128d, simde__m128i, int, int, int,
+  simde_mm_cvtepi32_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi32_ps, simde__m128, simde__m128i, int, int, int,
+  simde_mm_cvtepi32_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpd_epi32, simde__m128i, simde__m128d, int, int, int,
+  simde_mm_cvtpd_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpd_pi32, simde__m64, simde__m128d, int, int, int,
+  simde_mm_cvtpd_pi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpd_ps, simde__m128, simde__m128d, int, int, int,
+  simde_mm_cvtpd_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtpi32_pd, simde__m128d, simde__m64, int, int, int,
+  simde_mm_cvtpi32_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtps_epi32, simde__m128i, simde__m128, int, int, int,
+  simde_mm_cvtps_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtps_pd, simde__m128d, simde__m128, int, int, int,
+  simde_mm_cvtps_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsd_si32, int32_t, simde__m128d, int, int, int,
+  simde_mm_cvtsd_si32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsd_si64, int64_t, simde__m128d, int, int, int,
+  simde_mm_cvtsd_si64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsd_ss, simde__m128, simde__m128, simde__m128d, int, int,
+  simde_mm_cvtsd_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi128_si32, int32_t, simde__m128i, int, int, int,
+  simde_mm_cvtsi128_si32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi128_si64, int64_t, simde__m128i, int, int, int,
+  simde_mm_cvtsi128_si64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi32_sd, simde__m128d, simde__m128d, int32_t, int, int,
+  simde_mm_cvtsi32_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi32_si128, simde__m128i, int32_t, int, int, int,
+  simde_mm_cvtsi32_si128(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi64_sd, simde__m128d, simde__m128d, int64_t, int, int,
+  simde_mm_cvtsi64_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtsi64_si128, simde__m128i, int64_t, int, int, int,
+  simde_mm_cvtsi64_si128(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtss_sd, simde__m128d, simde__m128d, simde__m128, int, int,
+  simde_mm_cvtss_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvttpd_epi32, simde__m128i, simde__m128d, int, int, int,
+  simde_mm_cvttpd_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvttpd_pi32, simde__m64, simde__m128d, int, int, int,
+  simde_mm_cvttpd_pi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvttps_epi32, simde__m128i, simde__m128, int, int, int,
+  simde_mm_cvttps_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvttsd_si32, int32_t, simde__m128d, int, int, int,
+  simde_mm_cvttsd_si32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvttsd_si64, int64_t, simde__m128d, int, int, int,
+  simde_mm_cvttsd_si64(a))
+SIMDE_BENCH_FUNC(simde_mm_div_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_div_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_div_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_extract_epi16, int32_t, simde__m128i, int, int, int,
+  simde_mm_extract_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_insert_epi16, simde__m128i, simde__m128i, int16_t, int, int,
+  simde_mm_insert_epi16(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_load_pd, simde__m128d, int, int, int, int,
+  simde_mm_load_pd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_load_pd1, simde__m128d, int, int, int, int,
+  simde_mm_load_pd1(HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_load_sd, simde__m128d, int, int, int, int,
+  simde_mm_load_sd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_load_si128, simde__m128i, int, int, int, int,
+  simde_mm_load_si128(HEDLEY_REINTERPRET_CAST(simde__m128i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadh_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_loadh_pd(a, HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadl_epi64, simde__m128i, int, int, int, int,
+  simde_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(simde__m128i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadl_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_loadl_pd(a, HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadr_pd, simde__m128d, int, int, int, int,
+  simde_mm_loadr_pd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadu_pd, simde__m128d, int, int, int, int,
+  simde_mm_loadu_pd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_loadu_si128, simde__m128i, int, int, int, int,
+  simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(simde__m128i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_madd_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_madd_epi16(a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_maskmoveu_si128, simde__m128i, simde__m128i, int, int,
+  simde_mm_maskmoveu_si128(a, b, HEDLEY_REINTERPRET_CAST(int8_t*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_movemask_epi8, int32_t, simde__m128i, int, int, int,
+  simde_mm_movemask_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm_movemask_pd, int32_t, simde__m128d, int, int, int,
+  simde_mm_movemask_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_movepi64_pi64, simde__m64, simde__m128i, int, int, int,
+  simde_mm_movepi64_pi64(a))
+SIMDE_BENCH_FUNC(simde_mm_movpi64_epi64, simde__m128i, simde__m64, int, int, int,
+  simde_mm_movpi64_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_min_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_min_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_min_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_min_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_min_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_max_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_max_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_max_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_max_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_move_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_move_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_mul_epu32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mul_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mul_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_mul_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mul_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_mul_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mul_su32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_mul_su32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mulhi_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mulhi_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mulhi_epu16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mulhi_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mullo_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mullo_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_or_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_or_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_or_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_or_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_packs_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_packs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_packs_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_packs_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_packus_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_packus_epi16(a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_pause, int, int, int, int,
+  simde_mm_pause())
+SIMDE_BENCH_FUNC(simde_mm_sad_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sad_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_set_epi8, simde__m128i, int8_t, int8_t, int8_t, int8_t,
+  simde_mm_set_epi8(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm_set_epi16, simde__m128i, int16_t, int16_t, int16_t, int16_t,
+  simde_mm_set_epi16(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm_set_epi32, simde__m128i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm_set_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_set_epi64, simde__m128i, simde__m64, simde__m64, int, int,
+  simde_mm_set_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_set_epi64x, simde__m128i, int64_t, int64_t, int, int,
+  simde_mm_set_epi64x(a, b))
+SIMDE_BENCH_FUNC(simde_mm_set_pd, simde__m128d, simde_float64, simde_float64, int, int,
+  simde_mm_set_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_set_pd1, simde__m128d, simde_float64, int, int, int,
+  simde_mm_set_pd1(a))
+SIMDE_BENCH_FUNC(simde_mm_set_sd, simde__m128d, simde_float64, int, int, int,
+  simde_mm_set_sd(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_epi8, simde__m128i, int8_t, int, int, int,
+  simde_mm_set1_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_epi16, simde__m128i, int16_t, int, int, int,
+  simde_mm_set1_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_epi32, simde__m128i, int32_t, int, int, int,
+  simde_mm_set1_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_epi64x, simde__m128i, int64_t, int, int, int,
+  simde_mm_set1_epi64x(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_epi64, simde__m128i, simde__m64, int, int, int,
+  simde_mm_set1_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_set1_pd, simde__m128d, simde_float64, int, int, int,
+  simde_mm_set1_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_setr_epi8, simde__m128i, int8_t, int8_t, int8_t, int8_t,
+  simde_mm_setr_epi8(a, b, c, d, d, d, d, d, d, d, d, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm_setr_epi16, simde__m128i, int16_t, int16_t, int16_t, int16_t,
+  simde_mm_setr_epi16(a, b, c, d, d, d, d, d))
+SIMDE_BENCH_FUNC(simde_mm_setr_epi32, simde__m128i, int32_t, int32_t, int32_t, int32_t,
+  simde_mm_setr_epi32(a, b, c, d))
+SIMDE_BENCH_FUNC(simde_mm_setr_epi64, simde__m128i, simde__m64, simde__m64, int, int,
+  simde_mm_setr_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_setr_pd, simde__m128d, simde_float64, simde_float64, int, int,
+  simde_mm_setr_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_setzero_pd, simde__m128d, int, int, int, int,
+  simde_mm_setzero_pd())
+SIMDE_BENCH_FUNC(simde_mm_undefined_pd, simde__m128d, int, int, int, int,
+  simde_mm_undefined_pd())
+SIMDE_BENCH_FUNC(simde_mm_undefined_si128, simde__m128i, int, int, int, int,
+  simde_mm_undefined_si128())
+SIMDE_BENCH_FUNC(simde_mm_setone_pd, simde__m128d, int, int, int, int,
+  simde_mm_setone_pd())
+SIMDE_BENCH_FUNC(simde_mm_setone_si128, simde__m128i, int, int, int, int,
+  simde_mm_setone_si128())
+SIMDE_BENCH_FUNC(simde_mm_shuffle_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_shuffle_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_shuffle_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_shuffle_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_shufflehi_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_shufflehi_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_shufflelo_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_shufflelo_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_sll_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sll_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sll_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sll_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sll_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sll_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sqrt_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_sqrt_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_sqrt_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_sqrt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srl_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_srl_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srl_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_srl_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srl_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_srl_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_srai_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_srai_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srai_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_srai_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_sra_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sra_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sra_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sra_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_slli_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_slli_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_slli_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_slli_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_slli_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_slli_epi64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srli_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_srli_epi16(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srli_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_srli_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_srli_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_srli_epi64(a, 1))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store_pd, simde__m128d, int, int, int,
+  simde_mm_store_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store1_pd, simde__m128d, int, int, int,
+  simde_mm_store1_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store_sd, simde__m128d, int, int, int,
+  simde_mm_store_sd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_store_si128, simde__m128i, int, int, int,
+  simde_mm_store_si128(HEDLEY_REINTERPRET_CAST(simde__m128i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storeh_pd, simde__m128d, int, int, int,
+  simde_mm_storeh_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storel_epi64, simde__m128i, int, int, int,
+  simde_mm_storel_epi64(HEDLEY_REINTERPRET_CAST(simde__m128i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storel_pd, simde__m128d, int, int, int,
+  simde_mm_storel_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storer_pd, simde__m128d, int, int, int,
+  simde_mm_storer_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storeu_pd, simde__m128d, int, int, int,
+  simde_mm_storeu_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_storeu_si128, simde__m128i, int, int, int,
+  simde_mm_storeu_si128(HEDLEY_REINTERPRET_CAST(simde__m128i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_stream_pd, simde__m128d, int, int, int,
+  simde_mm_stream_pd(HEDLEY_REINTERPRET_CAST(simde_float64*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_stream_si128, simde__m128i, int, int, int,
+  simde_mm_stream_si128(HEDLEY_REINTERPRET_CAST(simde__m128i*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_stream_si32, int32_t, int, int, int,
+  simde_mm_stream_si32(HEDLEY_REINTERPRET_CAST(int32_t*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC_VOID(simde_mm_stream_si64, int64_t, int, int, int,
+  simde_mm_stream_si64(HEDLEY_REINTERPRET_CAST(int64_t*, simde_bench_memory), a))
+SIMDE_BENCH_FUNC(simde_mm_sub_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sub_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sub_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sub_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sub_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_sub_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_sub_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sub_si64, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sub_si64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_subs_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_subs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_subs_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_subs_epu16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_subs_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomieq_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_ucomieq_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomige_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_ucomige_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomigt_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_ucomigt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomile_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_ucomile_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomilt_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_ucomilt_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ucomineq_sd, int, simde__m128d, simde__m128d, int, int,
+  simde_mm_ucomineq_sd(a, b))
+SIMDE_BENCH_FUNC_VOID(simde_mm_lfence, int, int, int, int,
+  simde_mm_lfence())
+SIMDE_BENCH_FUNC_VOID(simde_mm_mfence, int, int, int, int,
+  simde_mm_mfence())
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpackhi_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpackhi_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpackhi_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpackhi_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpackhi_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_unpackhi_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpacklo_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpacklo_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpacklo_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_unpacklo_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_unpacklo_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_unpacklo_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_xor_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_xor_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_xor_si128, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_xor_si128(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_add_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_add_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_add_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_add_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_add_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_move_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_add_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_add_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_adds_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_and_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_and_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_andnot_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_andnot_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_avg_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_avg_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_bslli_si128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setzero_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_bsrli_si128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_clflush),
+  SIMDE_BENCH_ENTRY(simde_mm_comieq_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_comige_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_comigt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_comile_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_comilt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_comineq_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_castpd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_castpd_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_castps_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_castps_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_castsi128_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_castsi128_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpneq_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpneq_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmplt_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_cmplt_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cmplt_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cmplt_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmplt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmple_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmple_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpge_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpge_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnge_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnge_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnlt_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnlt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnle_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpnle_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpord_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsd_f64),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpord_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpunord_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpunord_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi32_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi32_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpd_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtpi32_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtps_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtps_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsd_si32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsd_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsd_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi128_si32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi128_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi32_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi32_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi64_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtsi64_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtss_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_cvttpd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvttpd_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvttps_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvttsd_si32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvttsd_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_div_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_div_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_extract_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_insert_epi16),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_load_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_load_pd1),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_load_sd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_load_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_loadh_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_loadl_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_loadl_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_loadr_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_loadu_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_loadu_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_madd_epi16),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_maskmoveu_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_movemask_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_movemask_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_movepi64_pi64),
+  SIMDE_BENCH_ENTRY(simde_mm_movpi64_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_min_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_min_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_min_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_min_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_max_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_max_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_max_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_max_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_move_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_mul_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm_mul_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_mul_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_mul_su32),
+  SIMDE_BENCH_ENTRY(simde_mm_mulhi_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mulhi_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_mullo_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_or_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_or_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_packs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_packs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_packus_epi16),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_pause),
+  SIMDE_BENCH_ENTRY(simde_mm_sad_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_set_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_set_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_set_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_set_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_set_epi64x),
+  SIMDE_BENCH_ENTRY(simde_mm_set_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_set_pd1),
+  SIMDE_BENCH_ENTRY(simde_mm_set_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_epi64x),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_set1_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_setr_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setzero_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_undefined_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_undefined_si128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setone_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_setone_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_shuffle_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_shuffle_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_shufflehi_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_shufflelo_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sll_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sll_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_sll_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_sqrt_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_sqrt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_srl_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_srl_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_srl_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_srai_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_srai_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_sra_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sra_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_slli_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_slli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_slli_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_srli_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_srli_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_srli_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store1_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store_sd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_store_si128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storeh_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storel_epi64),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storel_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storer_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storeu_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_storeu_si128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_stream_pd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_stream_si128),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_stream_si32),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_stream_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_sub_si64),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_subs_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomieq_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomige_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomigt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomile_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomilt_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_ucomineq_sd),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_lfence),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_mfence),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_unpackhi_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_unpacklo_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_xor_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_xor_si128),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, sse2, "sse2")
@@ -0,0 +1,62 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/sse3.h"
+
+SIMDE_BENCH_FUNC(simde_mm_addsub_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_addsub_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_addsub_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_addsub_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadd_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_hadd_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadd_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_hadd_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsub_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_hsub_pd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsub_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_hsub_ps(a, b))
+SIMDE_BENCH_FUNC(simde_mm_lddqu_si128, simde__m128i, int, int, int, int,
+  simde_mm_lddqu_si128(HEDLEY_REINTERPRET_CAST(simde__m128i const*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_movedup_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_movedup_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_movehdup_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_movehdup_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_moveldup_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_moveldup_ps(a))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_addsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_addsub_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_hadd_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_hadd_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_hsub_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_hsub_ps),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_lddqu_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_movedup_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_movehdup_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_moveldup_ps),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, sse3, "sse3")
@@ -0,0 +1,212 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/sse4.1.h"
+
+SIMDE_BENCH_FUNC(simde_mm_blend_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_blend_epi16(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_blend_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_blend_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_blend_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_blend_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_blendv_epi8, simde__m128i, simde__m128i, simde__m128i, simde__m128i, int,
+  simde_mm_blendv_epi8(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_blendv_pd, simde__m128d, simde__m128d, simde__m128d, simde__m128d, int,
+  simde_mm_blendv_pd(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_blendv_ps, simde__m128, simde__m128, simde__m128, simde__m128, int,
+  simde_mm_blendv_ps(a, b, c))
+SIMDE_BENCH_FUNC(simde_mm_ceil_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_ceil_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_ceil_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_ceil_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_ceil_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_ceil_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_ceil_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_ceil_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpeq_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpeq_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi8_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepi8_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi8_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepi8_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi8_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepi8_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepu8_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepu8_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepu8_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepu8_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepu8_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepu8_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi16_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepi16_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepu16_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepu16_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepu16_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepu16_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi16_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepi16_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepi32_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepi32_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_cvtepu32_epi64, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_cvtepu32_epi64(a))
+SIMDE_BENCH_FUNC(simde_mm_dp_pd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_dp_pd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_dp_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_dp_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_extract_epi8, int8_t, simde__m128i, int, int, int,
+  simde_mm_extract_epi8(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_extract_epi32, int32_t, simde__m128i, int, int, int,
+  simde_mm_extract_epi32(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_extract_epi64, int64_t, simde__m128i, int, int, int,
+  simde_mm_extract_epi64(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_floor_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_floor_pd(a))
+SIMDE_BENCH_FUNC(simde_mm_floor_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_floor_ps(a))
+SIMDE_BENCH_FUNC(simde_mm_floor_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_floor_sd(a, b))
+SIMDE_BENCH_FUNC(simde_mm_floor_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_floor_ss(a, b))
+SIMDE_BENCH_FUNC(simde_mm_insert_epi8, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_insert_epi8(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_insert_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_insert_epi32(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_insert_epi64, simde__m128i, simde__m128i, int64_t, int, int,
+  simde_mm_insert_epi64(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_insert_ps, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_insert_ps(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_max_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_max_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_max_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_epu16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_max_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_max_epu32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_max_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_min_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_min_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_epu16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_min_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_min_epu32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_min_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_minpos_epu16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_minpos_epu16(a))
+SIMDE_BENCH_FUNC(simde_mm_mpsadbw_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mpsadbw_epu8(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_mul_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mul_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mullo_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mullo_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_packus_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_packus_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_round_pd, simde__m128d, simde__m128d, int, int, int,
+  simde_mm_round_pd(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_round_ps, simde__m128, simde__m128, int, int, int,
+  simde_mm_round_ps(a, 1))
+SIMDE_BENCH_FUNC(simde_mm_round_sd, simde__m128d, simde__m128d, simde__m128d, int, int,
+  simde_mm_round_sd(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_round_ss, simde__m128, simde__m128, simde__m128, int, int,
+  simde_mm_round_ss(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_stream_load_si128, simde__m128i, int, int, int, int,
+  simde_mm_stream_load_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_bench_memory)))
+SIMDE_BENCH_FUNC(simde_mm_test_all_ones, int, simde__m128i, int, int, int,
+  simde_mm_test_all_ones(a))
+SIMDE_BENCH_FUNC(simde_mm_test_all_zeros, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_test_all_zeros(a, b))
+SIMDE_BENCH_FUNC(simde_mm_test_mix_ones_zeros, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_test_mix_ones_zeros(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testc_si128, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_testc_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testnzc_si128, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_testnzc_si128(a, b))
+SIMDE_BENCH_FUNC(simde_mm_testz_si128, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_testz_si128(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_blend_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_blend_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_blend_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_blendv_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_blendv_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_blendv_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_ceil_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_ceil_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_ceil_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_ceil_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpeq_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi8_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi8_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi8_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepu8_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepu8_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepu8_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi16_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepu16_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepu16_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi16_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepi32_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_cvtepu32_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_dp_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_dp_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_extract_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_extract_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_extract_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_floor_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_floor_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_floor_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_floor_ss),
+  SIMDE_BENCH_ENTRY(simde_mm_insert_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_insert_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_insert_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_insert_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_max_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_max_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_max_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_max_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm_min_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_min_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_min_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_min_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm_minpos_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_mpsadbw_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_mul_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_mullo_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_packus_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_round_pd),
+  SIMDE_BENCH_ENTRY(simde_mm_round_ps),
+  SIMDE_BENCH_ENTRY(simde_mm_round_sd),
+  SIMDE_BENCH_ENTRY(simde_mm_round_ss),
+  SIMDE_BENCH_ENTRY_THROUGHPUT(simde_mm_stream_load_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_test_all_ones),
+  SIMDE_BENCH_ENTRY(simde_mm_test_all_zeros),
+  SIMDE_BENCH_ENTRY(simde_mm_test_mix_ones_zeros),
+  SIMDE_BENCH_ENTRY(simde_mm_testc_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_testnzc_si128),
+  SIMDE_BENCH_ENTRY(simde_mm_testz_si128),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, sse4_1, "sse4.1")
@@ -0,0 +1,89 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/sse4.2.h"
+
+SIMDE_BENCH_FUNC(simde_mm_cmpestra, int, simde__m128i, int, simde__m128i, int,
+  simde_mm_cmpestra(a, b, c, d, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpestrc, int, simde__m128i, int, simde__m128i, int,
+  simde_mm_cmpestrc(a, b, c, d, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpestri, int, simde__m128i, int, simde__m128i, int,
+  simde_mm_cmpestri(a, b, c, d, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpestrm, simde__m128i, simde__m128i, int, simde__m128i, int,
+  simde_mm_cmpestrm(a, b, c, d, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpestro, int, simde__m128i, int, simde__m128i, int,
+  simde_mm_cmpestro(a, b, c, d, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpestrs, int, simde__m128i, int, simde__m128i, int,
+  simde_mm_cmpestrs(a, b, c, d, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpestrz, int, simde__m128i, int, simde__m128i, int,
+  simde_mm_cmpestrz(a, b, c, d, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpgt_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpgt_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_cmpistra, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpistra(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpistrc, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpistrc(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpistri, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpistri(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpistrm, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpistrm(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpistro, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpistro(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpistrs, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpistrs(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_cmpistrz, int, simde__m128i, simde__m128i, int, int,
+  simde_mm_cmpistrz(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_crc32_u8, uint32_t, uint32_t, uint8_t, int, int,
+  simde_mm_crc32_u8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_crc32_u16, uint32_t, uint32_t, uint16_t, int, int,
+  simde_mm_crc32_u16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_crc32_u32, uint32_t, uint32_t, uint32_t, int, int,
+  simde_mm_crc32_u32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_crc32_u64, uint64_t, uint64_t, uint64_t, int, int,
+  simde_mm_crc32_u64(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_cmpestra),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpestrc),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpestri),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpestrm),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpestro),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpestrs),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpestrz),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpgt_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpistra),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpistrc),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpistri),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpistrm),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpistro),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpistrs),
+  SIMDE_BENCH_ENTRY(simde_mm_cmpistrz),
+  SIMDE_BENCH_ENTRY(simde_mm_crc32_u8),
+  SIMDE_BENCH_ENTRY(simde_mm_crc32_u16),
+  SIMDE_BENCH_ENTRY(simde_mm_crc32_u32),
+  SIMDE_BENCH_ENTRY(simde_mm_crc32_u64),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, sse4_2, "sse4.2")
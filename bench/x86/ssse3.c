@@ -0,0 +1,128 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/ssse3.h"
+
+SIMDE_BENCH_FUNC(simde_mm_abs_epi8, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_abs_epi8(a))
+SIMDE_BENCH_FUNC(simde_mm_abs_epi16, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_abs_epi16(a))
+SIMDE_BENCH_FUNC(simde_mm_abs_epi32, simde__m128i, simde__m128i, int, int, int,
+  simde_mm_abs_epi32(a))
+SIMDE_BENCH_FUNC(simde_mm_abs_pi8, simde__m64, simde__m64, int, int, int,
+  simde_mm_abs_pi8(a))
+SIMDE_BENCH_FUNC(simde_mm_abs_pi16, simde__m64, simde__m64, int, int, int,
+  simde_mm_abs_pi16(a))
+SIMDE_BENCH_FUNC(simde_mm_abs_pi32, simde__m64, simde__m64, int, int, int,
+  simde_mm_abs_pi32(a))
+SIMDE_BENCH_FUNC(simde_mm_alignr_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_alignr_epi8(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_alignr_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_alignr_pi8(a, b, 1))
+SIMDE_BENCH_FUNC(simde_mm_shuffle_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_shuffle_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_shuffle_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_shuffle_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadd_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_hadd_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadd_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_hadd_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadd_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_hadd_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadd_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_hadd_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadds_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_hadds_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hadds_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_hadds_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsub_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_hsub_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsub_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_hsub_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsub_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_hsub_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsub_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_hsub_pi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsubs_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_hsubs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_hsubs_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_hsubs_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_maddubs_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_maddubs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_maddubs_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_maddubs_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mulhrs_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_mulhrs_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_mulhrs_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_mulhrs_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sign_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sign_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sign_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sign_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sign_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_sign_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sign_pi8, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sign_pi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sign_pi16, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sign_pi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_sign_pi32, simde__m64, simde__m64, simde__m64, int, int,
+  simde_mm_sign_pi32(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_abs_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_abs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_abs_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_abs_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_abs_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_abs_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_alignr_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_alignr_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_shuffle_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_shuffle_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_hadd_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_hadd_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_hadd_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_hadd_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_hadds_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_hadds_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_hsub_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_hsub_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_hsub_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_hsub_pi32),
+  SIMDE_BENCH_ENTRY(simde_mm_hsubs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_hsubs_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_maddubs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_maddubs_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mulhrs_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_mulhrs_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sign_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_sign_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sign_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_sign_pi8),
+  SIMDE_BENCH_ENTRY(simde_mm_sign_pi16),
+  SIMDE_BENCH_ENTRY(simde_mm_sign_pi32),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, ssse3, "ssse3")
@@ -0,0 +1,80 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../bench.h"
+#include "../../simde/x86/svml.h"
+
+SIMDE_BENCH_FUNC(simde_mm_div_epi8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_epi16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_epi32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_epi64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_epu8, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_epu16, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_epu32, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm_div_epu64, simde__m128i, simde__m128i, simde__m128i, int, int,
+  simde_mm_div_epu64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epi8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epi8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epi16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epi16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epi32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epi32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epi64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epi64(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epu8, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epu8(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epu16, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epu16(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epu32, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epu32(a, b))
+SIMDE_BENCH_FUNC(simde_mm256_div_epu64, simde__m256i, simde__m256i, simde__m256i, int, int,
+  simde_mm256_div_epu64(a, b))
+
+static const SimdeBenchEntry simde_bench_entries[] = {
+  SIMDE_BENCH_ENTRY(simde_mm_div_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm_div_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm_div_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm_div_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm_div_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm_div_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm_div_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm_div_epu64),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epi8),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epi16),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epi32),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epi64),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epu8),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epu16),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epu32),
+  SIMDE_BENCH_ENTRY(simde_mm256_div_epu64),
+  { NULL, NULL, NULL }
+};
+
+SIMDE_BENCH_DEFINE_SUITE(x86, svml, "svml")
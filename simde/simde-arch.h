@@ -106,6 +106,18 @@
 #    define SIMDE_ARCH_ARM_NEON SIMDE_ARCH_ARM
 #  endif
 #endif
+#if defined(__ARM_FEATURE_CRC32)
+#  define SIMDE_ARCH_ARM_CRC32 1
+#endif
+#if defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)
+#  define SIMDE_ARCH_ARM_AES 1
+#endif
+#if defined(__ARM_FEATURE_DOTPROD)
+#  define SIMDE_ARCH_ARM_DOTPROD 1
+#endif
+#if defined(__ARM_FEATURE_MATMUL_INT8)
+#  define SIMDE_ARCH_ARM_MATMUL_INT8 1
+#endif
 
 /* Blackfin
    <https://en.wikipedia.org/wiki/Blackfin> */
@@ -240,9 +252,18 @@
 #      define SIMDE_ARCH_X86_AVX 1
 #    endif
 #  endif
+#  if defined(__AES__)
+#    define SIMDE_ARCH_X86_AES 1
+#  endif
+#  if defined(__PCLMUL__)
+#    define SIMDE_ARCH_X86_PCLMUL 1
+#  endif
 #  if defined(__AVX512BW__)
 #    define SIMDE_ARCH_X86_AVX512BW 1
 #  endif
+#  if defined(__AVX512BITALG__)
+#    define SIMDE_ARCH_X86_AVX512BITALG 1
+#  endif
 #  if defined(__AVX512CD__)
 #    define SIMDE_ARCH_X86_AVX512CD 1
 #  endif
@@ -255,6 +276,15 @@
 #  if defined(__AVX512VL__)
 #    define SIMDE_ARCH_X86_AVX512VL 1
 #  endif
+#  if defined(__AVX512VBMI__)
+#    define SIMDE_ARCH_X86_AVX512VBMI 1
+#  endif
+#  if defined(__AVX512VNNI__)
+#    define SIMDE_ARCH_X86_AVX512VNNI 1
+#  endif
+#  if defined(__AVX512VPOPCNTDQ__)
+#    define SIMDE_ARCH_X86_AVX512VPOPCNTDQ 1
+#  endif
 #endif
 
 /* Itanium
@@ -356,6 +386,9 @@
 #if defined(__ALTIVEC__)
 #  define SIMDE_ARCH_POWER_ALTIVEC SIMDE_ARCH_POWER
 #endif
+#if defined(__CRYPTO__)
+#  define SIMDE_ARCH_POWER_CRYPTO SIMDE_ARCH_POWER
+#endif
 
 /* SPARC
    <https://en.wikipedia.org/wiki/SPARC> */
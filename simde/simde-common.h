@@ -162,6 +162,17 @@
 #    endif
 #  endif
 
+/* GCC's __builtin_shuffle also accepts a mask which isn't known at
+   compile time; indices are taken modulo twice the number of elements
+   (the elements of a followed by those of b).  If the mask does turn
+   out to be constant after inlining it is compiled to the same static
+   shuffle as SIMDE__SHUFFLE_VECTOR.  clang has no equivalent. */
+#  if !defined(SIMDE_NO_SHUFFLE_VECTOR) && defined(SIMDE_VECTOR_SUBSCRIPT)
+#    if HEDLEY_GCC_HAS_BUILTIN(__builtin_shuffle,4,7,0) && !defined(__INTEL_COMPILER)
+#      define SIMDE__SHUFFLE_VECTOR_DYNAMIC(a, b, mask) __builtin_shuffle(a, b, mask)
+#    endif
+#  endif
+
 /* TODO: this actually works on XL C/C++ without SIMDE_VECTOR_SUBSCRIPT
    but the code needs to be refactored a bit to take advantage. */
 #  if !defined(SIMDE_NO_CONVERT_VECTOR) && defined(SIMDE_VECTOR_SUBSCRIPT)
@@ -235,6 +246,18 @@
 #  define SIMDE__VECTORIZE_ALIGNED(a)
 #endif
 
+/* For short loops of independent scalar memory accesses (gathers and
+   scatters) which won't be vectorized, but which should be unrolled so
+   the loads or stores can be issued back to back.  n must be a
+   literal. */
+#if defined(__clang__)
+#  define SIMDE__UNROLL(n) HEDLEY_PRAGMA(clang loop unroll_count(n))
+#elif HEDLEY_GCC_VERSION_CHECK(8,0,0)
+#  define SIMDE__UNROLL(n) HEDLEY_PRAGMA(GCC unroll n)
+#else
+#  define SIMDE__UNROLL(n)
+#endif
+
 #define SIMDE__MASK_NZ(v, mask) (((v) & (mask)) | !((v) & (mask)))
 
 /* Intended for checking coverage, you should never use this in
@@ -626,6 +649,32 @@ HEDLEY_STATIC_ASSERT(sizeof(simde_float64) == 8, "Unable to find 64-bit floating
   #endif
 #endif
 
+#if !defined(SIMDE_INFINITY)
+  #if \
+      HEDLEY_HAS_BUILTIN(__builtin_inf) || \
+      HEDLEY_GCC_VERSION_CHECK(3,3,0) || \
+      HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+    #define SIMDE_INFINITY (__builtin_inf())
+    #define SIMDE_INFINITYF (__builtin_inff())
+  #elif !defined(SIMDE_NO_MATH_H)
+    #define SIMDE_INFINITY (HUGE_VAL)
+    #define SIMDE_INFINITYF (HUGE_VALF)
+  #endif
+#endif
+
+#if !defined(SIMDE_NAN)
+  #if \
+      HEDLEY_HAS_BUILTIN(__builtin_nan) || \
+      HEDLEY_GCC_VERSION_CHECK(3,3,0) || \
+      HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+    #define SIMDE_NAN (__builtin_nan(""))
+    #define SIMDE_NANF (__builtin_nanf(""))
+  #elif !defined(SIMDE_NO_MATH_H) && defined(NAN)
+    #define SIMDE_NAN (HEDLEY_STATIC_CAST(double, NAN))
+    #define SIMDE_NANF (NAN)
+  #endif
+#endif
+
 #if defined(__has_include)
 #  if __has_include(<fenv.h>)
 #    include <fenv.h>
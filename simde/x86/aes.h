@@ -0,0 +1,402 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__AES_H)
+#  if !defined(SIMDE__AES_H)
+#    define SIMDE__AES_H
+#  endif
+#  include "ssse3.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AES_NATIVE)
+#    undef SIMDE_AES_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AES) && !defined(SIMDE_AES_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AES_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_AES) && defined(SIMDE_SSE2_NEON) && !defined(SIMDE_AES_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_AES_NEON
+#  elif defined(SIMDE_ARCH_POWER_CRYPTO) && defined(SIMDE_SSE2_POWER_ALTIVEC)
+#    define SIMDE_AES_POWER_CRYPTO
+#  endif
+
+#  if defined(SIMDE_AES_NATIVE) && !defined(SIMDE_SSE2_NATIVE)
+#    if defined(SIMDE_AES_FORCE_NATIVE)
+#      error Native AES support requires native SSE2 support
+#    else
+       HEDLEY_WARNING("Native AES support requires native SSE2 support, disabling")
+#      undef SIMDE_AES_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_AES_NATIVE)
+#    include <wmmintrin.h>
+#  elif defined(SIMDE_AES_NEON)
+#    include <arm_neon.h>
+#  elif defined(SIMDE_AES_POWER_CRYPTO)
+#    include <altivec.h>
+#  endif
+
+#if !defined(SIMDE_AES_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_AES_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+/* Portable implementation.  Everything below is written in terms of
+ * SSE2/SSSE3 operations on the whole block, with no lookup tables
+ * indexed by secret data, so it runs in constant time and still gets
+ * vectorized on targets without AES instructions.  The S-box is
+ * computed as an inversion in GF(2^8) (x^254) followed by the affine
+ * transform, and the row/column permutations are byte shuffles. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_xtime (simde__m128i a) {
+  /* Multiply each byte by x, reducing by x^8 + x^4 + x^3 + x + 1. */
+  return simde_mm_xor_si128(
+    simde_mm_add_epi8(a, a),
+    simde_mm_and_si128(simde_mm_cmplt_epi8(a, simde_mm_setzero_si128()), simde_mm_set1_epi8(0x1b)));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_gmul (simde__m128i a, simde__m128i b) {
+  const simde__m128i zero = simde_mm_setzero_si128();
+  simde__m128i r = zero;
+
+  for (int i = 0 ; i < 8 ; i++) {
+    r = simde_x_mm_aes_xtime(r);
+    r = simde_mm_xor_si128(r, simde_mm_and_si128(a, simde_mm_cmplt_epi8(b, zero)));
+    b = simde_mm_add_epi8(b, b);
+  }
+
+  return r;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_inv (simde__m128i a) {
+  /* a^254 == a^-1 for a != 0 (and 0 maps to 0, as the S-box wants). */
+  simde__m128i a2, a3, a12, a15, r;
+
+  a2  = simde_x_mm_aes_gmul(a, a);
+  a3  = simde_x_mm_aes_gmul(a2, a);
+  a12 = simde_x_mm_aes_gmul(a3, a3);
+  a12 = simde_x_mm_aes_gmul(a12, a12);
+  a15 = simde_x_mm_aes_gmul(a12, a3);
+  r   = simde_x_mm_aes_gmul(a15, a15);
+  r   = simde_x_mm_aes_gmul(r, r);
+  r   = simde_x_mm_aes_gmul(r, r);
+  r   = simde_x_mm_aes_gmul(r, r);
+  r   = simde_x_mm_aes_gmul(r, a12);
+
+  return simde_x_mm_aes_gmul(r, a2);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_rotl1 (simde__m128i a) {
+  /* Rotate each byte left by one bit; the compare yields -1 for bytes
+   * with the top bit set, so subtracting it carries that bit around. */
+  return simde_mm_sub_epi8(simde_mm_add_epi8(a, a), simde_mm_cmplt_epi8(a, simde_mm_setzero_si128()));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_sub_bytes (simde__m128i a) {
+  simde__m128i r, t;
+
+  t = simde_x_mm_aes_inv(a);
+  r = simde_mm_xor_si128(t, simde_mm_set1_epi8(0x63));
+  for (int i = 0 ; i < 4 ; i++) {
+    t = simde_x_mm_aes_rotl1(t);
+    r = simde_mm_xor_si128(r, t);
+  }
+
+  return r;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_inv_sub_bytes (simde__m128i a) {
+  simde__m128i r, t;
+
+  /* Inverse affine transform: rotl(a, 1) ^ rotl(a, 3) ^ rotl(a, 6) ^ 0x05 */
+  t = simde_x_mm_aes_rotl1(a);
+  r = simde_mm_xor_si128(t, simde_mm_set1_epi8(0x05));
+  t = simde_x_mm_aes_rotl1(simde_x_mm_aes_rotl1(t));
+  r = simde_mm_xor_si128(r, t);
+  t = simde_x_mm_aes_rotl1(simde_x_mm_aes_rotl1(simde_x_mm_aes_rotl1(t)));
+  r = simde_mm_xor_si128(r, t);
+
+  return simde_x_mm_aes_inv(r);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_shift_rows (simde__m128i a) {
+  return simde_mm_shuffle_epi8(a, simde_mm_set_epi8(11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5, 0));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_inv_shift_rows (simde__m128i a) {
+  return simde_mm_shuffle_epi8(a, simde_mm_set_epi8(3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_mix_columns (simde__m128i a) {
+  simde__m128i a1, a2, a3;
+
+  /* a1, a2 and a3 rotate each column by one, two and three bytes. */
+  a1 = simde_mm_shuffle_epi8(a, simde_mm_set_epi8(12, 15, 14, 13,  8, 11, 10,  9,  4,  7,  6,  5,  0,  3,  2,  1));
+  a2 = simde_mm_shuffle_epi8(a, simde_mm_set_epi8(13, 12, 15, 14,  9,  8, 11, 10,  5,  4,  7,  6,  1,  0,  3,  2));
+  a3 = simde_mm_shuffle_epi8(a, simde_mm_set_epi8(14, 13, 12, 15, 10,  9,  8, 11,  6,  5,  4,  7,  2,  1,  0,  3));
+
+  /* {02}a0 ^ {03}a1 ^ a2 ^ a3 */
+  return simde_mm_xor_si128(
+    simde_mm_xor_si128(simde_x_mm_aes_xtime(simde_mm_xor_si128(a, a1)), a1),
+    simde_mm_xor_si128(a2, a3));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_aes_inv_mix_columns (simde__m128i a) {
+  simde__m128i t;
+
+  /* InvMixColumns is MixColumns applied after adding {04}(a0 ^ a2) to
+   * a0 and a2 (and {04}(a1 ^ a3) to a1 and a3) of each column. */
+  t = simde_mm_xor_si128(a, simde_mm_shuffle_epi8(a, simde_mm_set_epi8(13, 12, 15, 14,  9,  8, 11, 10,  5,  4,  7,  6,  1,  0,  3,  2)));
+  t = simde_x_mm_aes_xtime(simde_x_mm_aes_xtime(t));
+
+  return simde_x_mm_aes_mix_columns(simde_mm_xor_si128(a, t));
+}
+
+#if defined(SIMDE_AES_POWER_CRYPTO)
+/* vcipher and friends number the state bytes big-endian, so on
+ * little-endian targets the block is reversed on the way in and out. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i_private
+simde_x_aes_power_swap (simde__m128i_private a) {
+  #if defined(SIMDE_BYTE_ORDER_LE)
+    const vector unsigned char idx = { 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+    a.altivec_u8 = vec_perm(a.altivec_u8, a.altivec_u8, idx);
+  #endif
+  return a;
+}
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenc_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_AES_NATIVE)
+    return _mm_aesenc_si128(a, round_key);
+  #elif defined(SIMDE_AES_NEON)
+    /* AESE adds the round key before SubBytes rather than after
+     * MixColumns, so use a zero key and add the real one at the end. */
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      k_ = simde__m128i_to_private(round_key);
+
+    r_.neon_u8 = veorq_u8(vaesmcq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0))), k_.neon_u8);
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_AES_POWER_CRYPTO)
+    simde__m128i_private
+      r_,
+      a_ = simde_x_aes_power_swap(simde__m128i_to_private(a)),
+      k_ = simde_x_aes_power_swap(simde__m128i_to_private(round_key));
+
+    r_.altivec_u64 = __builtin_crypto_vcipher(a_.altivec_u64, k_.altivec_u64);
+
+    return simde__m128i_from_private(simde_x_aes_power_swap(r_));
+  #else
+    return simde_mm_xor_si128(simde_x_mm_aes_mix_columns(simde_x_mm_aes_sub_bytes(simde_x_mm_aes_shift_rows(a))), round_key);
+  #endif
+}
+#if defined(SIMDE_AES_ENABLE_NATIVE_ALIASES)
+#  define _mm_aesenc_si128(a, round_key) simde_mm_aesenc_si128(a, round_key)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenclast_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_AES_NATIVE)
+    return _mm_aesenclast_si128(a, round_key);
+  #elif defined(SIMDE_AES_NEON)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      k_ = simde__m128i_to_private(round_key);
+
+    r_.neon_u8 = veorq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0)), k_.neon_u8);
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_AES_POWER_CRYPTO)
+    simde__m128i_private
+      r_,
+      a_ = simde_x_aes_power_swap(simde__m128i_to_private(a)),
+      k_ = simde_x_aes_power_swap(simde__m128i_to_private(round_key));
+
+    r_.altivec_u64 = __builtin_crypto_vcipherlast(a_.altivec_u64, k_.altivec_u64);
+
+    return simde__m128i_from_private(simde_x_aes_power_swap(r_));
+  #else
+    return simde_mm_xor_si128(simde_x_mm_aes_sub_bytes(simde_x_mm_aes_shift_rows(a)), round_key);
+  #endif
+}
+#if defined(SIMDE_AES_ENABLE_NATIVE_ALIASES)
+#  define _mm_aesenclast_si128(a, round_key) simde_mm_aesenclast_si128(a, round_key)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdec_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_AES_NATIVE)
+    return _mm_aesdec_si128(a, round_key);
+  #elif defined(SIMDE_AES_NEON)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      k_ = simde__m128i_to_private(round_key);
+
+    r_.neon_u8 = veorq_u8(vaesimcq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0))), k_.neon_u8);
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_AES_POWER_CRYPTO)
+    /* vncipher adds the round key before InvMixColumns; x86 adds it after. */
+    simde__m128i_private
+      r_,
+      a_ = simde_x_aes_power_swap(simde__m128i_to_private(a));
+
+    r_.altivec_u64 = __builtin_crypto_vncipher(a_.altivec_u64, vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 0)));
+
+    return simde_mm_xor_si128(simde__m128i_from_private(simde_x_aes_power_swap(r_)), round_key);
+  #else
+    return simde_mm_xor_si128(simde_x_mm_aes_inv_mix_columns(simde_x_mm_aes_inv_sub_bytes(simde_x_mm_aes_inv_shift_rows(a))), round_key);
+  #endif
+}
+#if defined(SIMDE_AES_ENABLE_NATIVE_ALIASES)
+#  define _mm_aesdec_si128(a, round_key) simde_mm_aesdec_si128(a, round_key)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdeclast_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_AES_NATIVE)
+    return _mm_aesdeclast_si128(a, round_key);
+  #elif defined(SIMDE_AES_NEON)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      k_ = simde__m128i_to_private(round_key);
+
+    r_.neon_u8 = veorq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0)), k_.neon_u8);
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_AES_POWER_CRYPTO)
+    simde__m128i_private
+      r_,
+      a_ = simde_x_aes_power_swap(simde__m128i_to_private(a)),
+      k_ = simde_x_aes_power_swap(simde__m128i_to_private(round_key));
+
+    r_.altivec_u64 = __builtin_crypto_vncipherlast(a_.altivec_u64, k_.altivec_u64);
+
+    return simde__m128i_from_private(simde_x_aes_power_swap(r_));
+  #else
+    return simde_mm_xor_si128(simde_x_mm_aes_inv_sub_bytes(simde_x_mm_aes_inv_shift_rows(a)), round_key);
+  #endif
+}
+#if defined(SIMDE_AES_ENABLE_NATIVE_ALIASES)
+#  define _mm_aesdeclast_si128(a, round_key) simde_mm_aesdeclast_si128(a, round_key)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesimc_si128 (simde__m128i a) {
+  #if defined(SIMDE_AES_NATIVE)
+    return _mm_aesimc_si128(a);
+  #elif defined(SIMDE_AES_NEON)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a);
+
+    r_.neon_u8 = vaesimcq_u8(a_.neon_u8);
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_AES_POWER_CRYPTO)
+    /* There is no bare InvMixColumns; vncipher undoes the SubBytes and
+     * ShiftRows that vcipherlast applies, leaving just InvMixColumns. */
+    simde__m128i_private
+      r_,
+      a_ = simde_x_aes_power_swap(simde__m128i_to_private(a));
+    const vector unsigned long long zero = vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 0));
+
+    r_.altivec_u64 = __builtin_crypto_vncipher(__builtin_crypto_vcipherlast(a_.altivec_u64, zero), zero);
+
+    return simde__m128i_from_private(simde_x_aes_power_swap(r_));
+  #else
+    return simde_x_mm_aes_inv_mix_columns(a);
+  #endif
+}
+#if defined(SIMDE_AES_ENABLE_NATIVE_ALIASES)
+#  define _mm_aesimc_si128(a) simde_mm_aesimc_si128(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aeskeygenassist_si128 (simde__m128i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m128i s, idx;
+
+  #if defined(SIMDE_AES_NEON) || defined(SIMDE_AES_POWER_CRYPTO)
+    /* aesenclast with a zero key is SubBytes on top of ShiftRows, so
+     * gather words 1 and 3 back from their shifted positions. */
+    s = simde_mm_aesenclast_si128(a, simde_mm_setzero_si128());
+    idx = simde_mm_set_epi8(12, 3, 6, 9, 3, 6, 9, 12, 4, 11, 14, 1, 11, 14, 1, 4);
+  #else
+    s = simde_x_mm_aes_sub_bytes(a);
+    idx = simde_mm_set_epi8(12, 15, 14, 13, 15, 14, 13, 12, 4, 7, 6, 5, 7, 6, 5, 4);
+  #endif
+
+  /* [ SubWord(a1), RotWord(SubWord(a1)) ^ rcon,
+   *   SubWord(a3), RotWord(SubWord(a3)) ^ rcon ] */
+  return simde_mm_xor_si128(simde_mm_shuffle_epi8(s, idx), simde_mm_set_epi32(imm8, 0, imm8, 0));
+}
+#if defined(SIMDE_AES_NATIVE)
+#  define simde_mm_aeskeygenassist_si128(a, imm8) _mm_aeskeygenassist_si128(a, imm8)
+#endif
+#if defined(SIMDE_AES_ENABLE_NATIVE_ALIASES)
+#  define _mm_aeskeygenassist_si128(a, imm8) simde_mm_aeskeygenassist_si128(a, imm8)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AES_H) */
@@ -41,6 +41,8 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 #    define SIMDE_AVX2_NATIVE
 #  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_AVX2_NO_NEON) && !defined(SIMDE_NO_NEON)
 #    define SIMDE_AVX2_NEON
+#  elif defined(SIMDE_ARCH_POWER_ALTIVEC)
+#    define SIMDE_AVX2_POWER_ALTIVEC
 #  endif
 
 #  if defined(SIMDE_AVX2_NATIVE) && !defined(SIMDE_AVX_NATIVE)
@@ -67,6 +69,96 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 
 SIMDE__BEGIN_DECLS
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_abs_epi8 (simde__m256i a) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_abs_epi8(a);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+
+  #if defined(SIMDE_ARCH_X86_SSSE3) || defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_abs_epi8(a_.m128i[0]);
+    r_.m128i[1] = simde_mm_abs_epi8(a_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    const __typeof__(r_.u8) m = (__typeof__(r_.u8)) (a_.i8 >> 7);
+    r_.u8 = (a_.u8 ^ m) - m;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+      r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (a_.i8[i] < 0) ? (- a_.i8[i]) : a_.i8[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_abs_epi8(a) simde_mm256_abs_epi8(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_abs_epi16 (simde__m256i a) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_abs_epi16(a);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+
+  #if defined(SIMDE_ARCH_X86_SSSE3) || defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_abs_epi16(a_.m128i[0]);
+    r_.m128i[1] = simde_mm_abs_epi16(a_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    const __typeof__(r_.u16) m = (__typeof__(r_.u16)) (a_.i16 >> 15);
+    r_.u16 = (a_.u16 ^ m) - m;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (a_.i16[i] < 0) ? (- a_.i16[i]) : a_.i16[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_abs_epi16(a) simde_mm256_abs_epi16(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_abs_epi32 (simde__m256i a) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_abs_epi32(a);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+
+  #if defined(SIMDE_ARCH_X86_SSSE3) || defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_abs_epi32(a_.m128i[0]);
+    r_.m128i[1] = simde_mm_abs_epi32(a_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    const __typeof__(r_.u32) m = (__typeof__(r_.u32)) (a_.i32 >> 31);
+    r_.u32 = (a_.u32 ^ m) - m;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (a_.i32[i] < 0) ? (- a_.u32[i]) : a_.u32[i];
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_abs_epi32(a) simde_mm256_abs_epi32(a)
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_add_epi8 (simde__m256i a, simde__m256i b) {
@@ -423,7 +515,7 @@ simde_mm_blend_epi32(simde__m128i a, simde__m128i b, const int imm8)
   return simde__m128i_from_private(r_);
 }
 #if defined(SIMDE_AVX2_NATIVE)
-#  define simde_mm_blend_epi32(a, b, imm8) _mm_blend_epi32(a, b, imm8);
+#  define simde_mm_blend_epi32(a, b, imm8) _mm_blend_epi32(a, b, imm8)
 #endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
 #  define _mm_blend_epi32(a, b, imm8) simde_mm_blend_epi32(a, b, imm8)
@@ -446,7 +538,7 @@ simde_mm256_blend_epi16(simde__m256i a, simde__m256i b, const int imm8)
   return simde__m256i_from_private(r_);
 }
 #if defined(SIMDE_AVX2_NATIVE)
-#  define simde_mm256_blend_epi16(a, b, imm8) _mm256_blend_epi16(a, b, imm8);
+#  define simde_mm256_blend_epi16(a, b, imm8) _mm256_blend_epi16(a, b, imm8)
 #endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
 #  define _mm256_blend_epi16(a, b, imm8) simde_mm256_blend_epi16(a, b, imm8)
@@ -470,7 +562,7 @@ simde_mm256_blend_epi32(simde__m256i a, simde__m256i b, const int imm8)
   return simde__m256i_from_private(r_);
 }
 #if defined(SIMDE_AVX2_NATIVE)
-#  define simde_mm256_blend_epi32(a, b, imm8) _mm256_blend_epi32(a, b, imm8);
+#  define simde_mm256_blend_epi32(a, b, imm8) _mm256_blend_epi32(a, b, imm8)
 #endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
 #  define _mm256_blend_epi32(a, b, imm8) simde_mm256_blend_epi32(a, b, imm8)
@@ -507,7 +599,7 @@ simde_mm256_blendv_epi8(simde__m256i a, simde__m256i b, simde__m256i mask) {
 #endif
 }
 #if defined(SIMDE_AVX2_NATIVE)
-#  define simde_mm256_blendv_epi8(a, b, imm8)  _mm256_blendv_epi8(a, b, imm8);
+#  define simde_mm256_blendv_epi8(a, b, imm8)  _mm256_blendv_epi8(a, b, imm8)
 #endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
 #  define _mm256_blendv_epi8(a, b, mask) simde_mm256_blendv_epi8(a, b, mask)
@@ -1096,262 +1188,1369 @@ simde_mm256_extracti128_si256 (simde__m256i a, const int imm8)
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
-simde_mm256_madd_epi16 (simde__m256i a, simde__m256i b) {
+simde_mm256_hadd_epi16 (simde__m256i a, simde__m256i b) {
 #if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_madd_epi16(a, b);
+  return _mm256_hadd_epi16(a, b);
 #else
   simde__m256i_private
     r_,
     a_ = simde__m256i_to_private(a),
     b_ = simde__m256i_to_private(b);
 
-  r_.m128i[0] = simde_mm_madd_epi16(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_madd_epi16(a_.m128i[1], b_.m128i[1]);
+  #if defined(SIMDE_ARCH_X86_SSSE3) || (defined(SIMDE_AVX2_NEON) && defined(SIMDE_ARCH_AARCH64))
+    r_.m128i[0] = simde_mm_hadd_epi16(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_hadd_epi16(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE__SHUFFLE_VECTOR) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u16 =
+      SIMDE__SHUFFLE_VECTOR(16, 32, a_.u16, b_.u16, 0, 2, 4, 6, 16, 18, 20, 22, 8, 10, 12, 14, 24, 26, 28, 30) +
+      SIMDE__SHUFFLE_VECTOR(16, 32, a_.u16, b_.u16, 1, 3, 5, 7, 17, 19, 21, 23, 9, 11, 13, 15, 25, 27, 29, 31);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      const simde__m256i_private* v = ((i & 4) == 0) ? &a_ : &b_;
+      const size_t j = ((i & 3) | ((i & 8) >> 1)) * 2;
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, v->u16[j] + v->u16[j + 1]);
+    }
+  #endif
 
   return simde__m256i_from_private(r_);
 #endif
 }
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_add_epi16(a, b) simde_mm256_add_epi16(a, b)
+#  define _mm256_hadd_epi16(a, b) simde_mm256_hadd_epi16(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
-simde_mm256_max_epi8 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE) && !defined(__PGI)
-  return _mm256_max_epi8(a, b);
+simde_mm256_hadd_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_hadd_epi32(a, b);
 #else
   simde__m256i_private
     r_,
     a_ = simde__m256i_to_private(a),
     b_ = simde__m256i_to_private(b);
 
-#if defined(SIMDE_ARCH_X86_SSE4_1)
-  r_.m128i[0] = simde_mm_max_epi8(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_max_epi8(a_.m128i[1], b_.m128i[1]);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
-    r_.i8[i] = a_.i8[i] > b_.i8[i] ? a_.i8[i] : b_.i8[i];
-  }
-#endif
+  #if defined(SIMDE_ARCH_X86_SSSE3) || (defined(SIMDE_AVX2_NEON) && defined(SIMDE_ARCH_AARCH64))
+    r_.m128i[0] = simde_mm_hadd_epi32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_hadd_epi32(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE__SHUFFLE_VECTOR) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u32 =
+      SIMDE__SHUFFLE_VECTOR(32, 32, a_.u32, b_.u32, 0, 2, 8, 10, 4, 6, 12, 14) +
+      SIMDE__SHUFFLE_VECTOR(32, 32, a_.u32, b_.u32, 1, 3, 9, 11, 5, 7, 13, 15);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      const simde__m256i_private* v = ((i & 2) == 0) ? &a_ : &b_;
+      const size_t j = ((i & 1) | ((i & 4) >> 1)) * 2;
+      r_.u32[i] = v->u32[j] + v->u32[j + 1];
+    }
+  #endif
 
   return simde__m256i_from_private(r_);
 #endif
 }
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_max_epi8(a, b) simde_mm256_max_epi8(a, b)
+#  define _mm256_hadd_epi32(a, b) simde_mm256_hadd_epi32(a, b)
 #endif
 
+/* The gathers are implemented as one unconditional load per element.
+   In the masked versions the elements which are masked off are
+   "loaded" from src instead of base_addr; the address is selected
+   with a bitmask instead of a branch, which would be mispredicted
+   about half the time with random masks, and no memory is touched
+   which the native instruction wouldn't touch. */
+
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_max_epu8 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_max_epu8(a, b);
-#else
-  simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+simde__m128i
+simde_mm_i32gather_epi32 (const int32_t* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
 
-#if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_SSE2_NEON)
-  r_.m128i[0] = simde_mm_max_epu8(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_max_epu8(a_.m128i[1], b_.m128i[1]);
-#else
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
-    r_.u8[i] = (a_.u8[i] > b_.u8[i]) ? a_.u8[i] : b_.u8[i];
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    int32_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i32[i] = dst;
   }
-#endif
 
-  return simde__m256i_from_private(r_);
-#endif
+  return simde__m128i_from_private(r_);
 }
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_epi32(base_addr, vindex, scale) _mm_i32gather_epi32(HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, scale)
+#endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_max_epu8(a, b) simde_mm256_max_epu8(a, b)
+#  define _mm_i32gather_epi32(base_addr, vindex, scale) simde_mm_i32gather_epi32(HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, scale)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_max_epu16 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_max_epu16(a, b);
-#else
-  simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+simde__m128i
+simde_mm_mask_i32gather_epi32 (simde__m128i src, const int32_t* base_addr, simde__m128i vindex, simde__m128i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    src_ = simde__m128i_to_private(src),
+    mask_ = simde__m128i_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
 
-#if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_SSE2_NEON)
-  r_.m128i[0] = simde_mm_max_epu16(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_max_epu16(a_.m128i[1], b_.m128i[1]);
-#else
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
-    r_.u16[i] = (a_.u16[i] > b_.u16[i]) ? a_.u16[i] : b_.u16[i];
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int32_t))) & ~m);
+    int32_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i32[i] = dst;
   }
-#endif
 
-  return simde__m256i_from_private(r_);
-#endif
+  return simde__m128i_from_private(r_);
 }
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_epi32(src, base_addr, vindex, mask, scale) _mm_mask_i32gather_epi32(src, HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, mask, scale)
+#endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_max_epu16(a, b) simde_mm256_max_epu16(a, b)
+#  define _mm_mask_i32gather_epi32(src, base_addr, vindex, mask, scale) simde_mm_mask_i32gather_epi32(src, HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, mask, scale)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
-simde_mm256_max_epu32 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_max_epu32(a, b);
-#else
+simde_mm256_i32gather_epi32 (const int32_t* base_addr, simde__m256i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
   simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+    vindex_ = simde__m256i_to_private(vindex),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
 
-#if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_SSE2_NEON)
-  r_.m128i[0] = simde_mm_max_epu32(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_max_epu32(a_.m128i[1], b_.m128i[1]);
-#else
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
-    r_.u32[i] = (a_.u32[i] > b_.u32[i]) ? a_.u32[i] : b_.u32[i];
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    int32_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i32[i] = dst;
   }
-#endif
 
   return simde__m256i_from_private(r_);
-#endif
 }
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_epi32(base_addr, vindex, scale) _mm256_i32gather_epi32(HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, scale)
+#endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_max_epu32(a, b) simde_mm256_max_epu32(a, b)
+#  define _mm256_i32gather_epi32(base_addr, vindex, scale) simde_mm256_i32gather_epi32(HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, scale)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
-simde_mm256_max_epi16 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_max_epi16(a, b);
-#else
+simde_mm256_mask_i32gather_epi32 (simde__m256i src, const int32_t* base_addr, simde__m256i vindex, simde__m256i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
   simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+    vindex_ = simde__m256i_to_private(vindex),
+    src_ = simde__m256i_to_private(src),
+    mask_ = simde__m256i_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
 
-#if defined(SIMDE_ARCH_X86_SSE2)
-  r_.m128i[0] = simde_mm_max_epi16(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_max_epi16(a_.m128i[1], b_.m128i[1]);
-#else
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
-    r_.i16[i] = (a_.i16[i] > b_.i16[i]) ? a_.i16[i] : b_.i16[i];
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int32_t))) & ~m);
+    int32_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i32[i] = dst;
   }
-#endif
 
   return simde__m256i_from_private(r_);
-#endif
 }
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_epi32(src, base_addr, vindex, mask, scale) _mm256_mask_i32gather_epi32(src, HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, mask, scale)
+#endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_max_epi16(a, b) simde_mm256_max_epi16(a, b)
+#  define _mm256_mask_i32gather_epi32(src, base_addr, vindex, mask, scale) simde_mm256_mask_i32gather_epi32(src, HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, mask, scale)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_max_epi32 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_max_epi32(a, b);
-#else
-  simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+simde__m128i
+simde_mm_i64gather_epi32 (const int32_t* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    r_ = simde__m128i_to_private(simde_mm_setzero_si128());
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
 
-#if defined(SIMDE_ARCH_X86_SSE4_1)
-  r_.m128i[0] = simde_mm_max_epi32(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_max_epi32(a_.m128i[1], b_.m128i[1]);
-#else
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-    r_.i32[i] = a_.i32[i] > b_.i32[i] ? a_.i32[i] : b_.i32[i];
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    int32_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i32[i] = dst;
   }
-#endif
 
-  return simde__m256i_from_private(r_);
-#endif
+  return simde__m128i_from_private(r_);
 }
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_epi32(base_addr, vindex, scale) _mm_i64gather_epi32(HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, scale)
+#endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_max_epi32(a, b) simde_mm256_max_epi32(a, b)
+#  define _mm_i64gather_epi32(base_addr, vindex, scale) simde_mm_i64gather_epi32(HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, scale)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_min_epu8 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_min_epu8(a, b);
-#else
-  simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+simde__m128i
+simde_mm_mask_i64gather_epi32 (simde__m128i src, const int32_t* base_addr, simde__m128i vindex, simde__m128i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    src_ = simde__m128i_to_private(src),
+    mask_ = simde__m128i_to_private(mask),
+    r_ = simde__m128i_to_private(simde_mm_setzero_si128());
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
 
-#if defined(SIMDE_ARCH_X86_SSE2)
-  r_.m128i[0] = simde_mm_min_epu8(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_min_epu8(a_.m128i[1], b_.m128i[1]);
-#else
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
-    r_.u8[i] = (a_.u8[i] < b_.u8[i]) ? a_.u8[i] : b_.u8[i];
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int32_t))) & ~m);
+    int32_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i32[i] = dst;
   }
-#endif
 
-  return simde__m256i_from_private(r_);
-#endif
+  return simde__m128i_from_private(r_);
 }
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_epi32(src, base_addr, vindex, mask, scale) _mm_mask_i64gather_epi32(src, HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, mask, scale)
+#endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_min_epu8(a, b) simde_mm256_min_epu8(a, b)
+#  define _mm_mask_i64gather_epi32(src, base_addr, vindex, mask, scale) simde_mm_mask_i64gather_epi32(src, HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, mask, scale)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_min_epu16 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_min_epu16(a, b);
-#else
-  simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+simde__m128i
+simde_mm256_i64gather_epi32 (const int32_t* base_addr, simde__m256i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128i_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
 
-#if defined(SIMDE_ARCH_X86_SSE2)
-  r_.m128i[0] = simde_mm_min_epu16(a_.m128i[0], b_.m128i[0]);
-  r_.m128i[1] = simde_mm_min_epu16(a_.m128i[1], b_.m128i[1]);
-#else
   SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
-    r_.u16[i] = (a_.u16[i] < b_.u16[i]) ? a_.u16[i] : b_.u16[i];
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    int32_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i32[i] = dst;
   }
-#endif
 
-  return simde__m256i_from_private(r_);
-#endif
+  return simde__m128i_from_private(r_);
 }
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_epi32(base_addr, vindex, scale) _mm256_i64gather_epi32(HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, scale)
+#endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_min_epu16(a, b) simde_mm256_min_epu16(a, b)
+#  define _mm256_i64gather_epi32(base_addr, vindex, scale) simde_mm256_i64gather_epi32(HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, scale)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_min_epu32 (simde__m256i a, simde__m256i b) {
-#if defined(SIMDE_AVX2_NATIVE)
-  return _mm256_min_epu32(a, b);
-#else
-  simde__m256i_private
-    r_,
-    a_ = simde__m256i_to_private(a),
-    b_ = simde__m256i_to_private(b);
+simde__m128i
+simde_mm256_mask_i64gather_epi32 (simde__m128i src, const int32_t* base_addr, simde__m256i vindex, simde__m128i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128i_private
+    src_ = simde__m128i_to_private(src),
+    mask_ = simde__m128i_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
 
-#if defined(SIMDE_ARCH_X86_SSE2)
-  r_.m128i[0] = simde_mm_min_epu32(a_.m128i[0], b_.m128i[0]);
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int32_t))) & ~m);
+    int32_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i32[i] = dst;
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_epi32(src, base_addr, vindex, mask, scale) _mm256_mask_i64gather_epi32(src, HEDLEY_REINTERPRET_CAST(int const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_i64gather_epi32(src, base_addr, vindex, mask, scale) simde_mm256_mask_i64gather_epi32(src, HEDLEY_REINTERPRET_CAST(int32_t const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_i32gather_epi64 (const int64_t* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    int64_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_epi64(base_addr, vindex, scale) _mm_i32gather_epi64(HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_i32gather_epi64(base_addr, vindex, scale) simde_mm_i32gather_epi64(HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_i32gather_epi64 (simde__m128i src, const int64_t* base_addr, simde__m128i vindex, simde__m128i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    src_ = simde__m128i_to_private(src),
+    mask_ = simde__m128i_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int64_t))) & ~m);
+    int64_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_epi64(src, base_addr, vindex, mask, scale) _mm_mask_i32gather_epi64(src, HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_i32gather_epi64(src, base_addr, vindex, mask, scale) simde_mm_mask_i32gather_epi64(src, HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_i32gather_epi64 (const int64_t* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256i_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    int64_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_epi64(base_addr, vindex, scale) _mm256_i32gather_epi64(HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_i32gather_epi64(base_addr, vindex, scale) simde_mm256_i32gather_epi64(HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_i32gather_epi64 (simde__m256i src, const int64_t* base_addr, simde__m128i vindex, simde__m256i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256i_private
+    src_ = simde__m256i_to_private(src),
+    mask_ = simde__m256i_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int64_t))) & ~m);
+    int64_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_epi64(src, base_addr, vindex, mask, scale) _mm256_mask_i32gather_epi64(src, HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_i32gather_epi64(src, base_addr, vindex, mask, scale) simde_mm256_mask_i32gather_epi64(src, HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_i64gather_epi64 (const int64_t* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    int64_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_epi64(base_addr, vindex, scale) _mm_i64gather_epi64(HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_i64gather_epi64(base_addr, vindex, scale) simde_mm_i64gather_epi64(HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_i64gather_epi64 (simde__m128i src, const int64_t* base_addr, simde__m128i vindex, simde__m128i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    src_ = simde__m128i_to_private(src),
+    mask_ = simde__m128i_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int64_t))) & ~m);
+    int64_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_epi64(src, base_addr, vindex, mask, scale) _mm_mask_i64gather_epi64(src, HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_i64gather_epi64(src, base_addr, vindex, mask, scale) simde_mm_mask_i64gather_epi64(src, HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_i64gather_epi64 (const int64_t* base_addr, simde__m256i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private
+    vindex_ = simde__m256i_to_private(vindex),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    int64_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_epi64(base_addr, vindex, scale) _mm256_i64gather_epi64(HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_i64gather_epi64(base_addr, vindex, scale) simde_mm256_i64gather_epi64(HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_i64gather_epi64 (simde__m256i src, const int64_t* base_addr, simde__m256i vindex, simde__m256i mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private
+    vindex_ = simde__m256i_to_private(vindex),
+    src_ = simde__m256i_to_private(src),
+    mask_ = simde__m256i_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int64_t))) & ~m);
+    int64_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_epi64(src, base_addr, vindex, mask, scale) _mm256_mask_i64gather_epi64(src, HEDLEY_REINTERPRET_CAST(long long const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_i64gather_epi64(src, base_addr, vindex, mask, scale) simde_mm256_mask_i64gather_epi64(src, HEDLEY_REINTERPRET_CAST(int64_t const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_i32gather_ps (const simde_float32* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    simde_float32 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_ps(base_addr, vindex, scale) _mm_i32gather_ps(HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_i32gather_ps(base_addr, vindex, scale) simde_mm_i32gather_ps(HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_i32gather_ps (simde__m128 src, const simde_float32* base_addr, simde__m128i vindex, simde__m128 mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private
+    src_ = simde__m128_to_private(src),
+    mask_ = simde__m128_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float32))) & ~m);
+    simde_float32 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_ps(src, base_addr, vindex, mask, scale) _mm_mask_i32gather_ps(src, HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_i32gather_ps(src, base_addr, vindex, mask, scale) simde_mm_mask_i32gather_ps(src, HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_i32gather_ps (const simde_float32* base_addr, simde__m256i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    simde_float32 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_ps(base_addr, vindex, scale) _mm256_i32gather_ps(HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_i32gather_ps(base_addr, vindex, scale) simde_mm256_i32gather_ps(HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_i32gather_ps (simde__m256 src, const simde_float32* base_addr, simde__m256i vindex, simde__m256 mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256_private
+    src_ = simde__m256_to_private(src),
+    mask_ = simde__m256_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float32))) & ~m);
+    simde_float32 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_ps(src, base_addr, vindex, mask, scale) _mm256_mask_i32gather_ps(src, HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_i32gather_ps(src, base_addr, vindex, mask, scale) simde_mm256_mask_i32gather_ps(src, HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_i64gather_ps (const simde_float32* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private r_ = simde__m128_to_private(simde_mm_setzero_ps());
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    simde_float32 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_ps(base_addr, vindex, scale) _mm_i64gather_ps(HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_i64gather_ps(base_addr, vindex, scale) simde_mm_i64gather_ps(HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_i64gather_ps (simde__m128 src, const simde_float32* base_addr, simde__m128i vindex, simde__m128 mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private
+    src_ = simde__m128_to_private(src),
+    mask_ = simde__m128_to_private(mask),
+    r_ = simde__m128_to_private(simde_mm_setzero_ps());
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float32))) & ~m);
+    simde_float32 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_ps(src, base_addr, vindex, mask, scale) _mm_mask_i64gather_ps(src, HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_i64gather_ps(src, base_addr, vindex, mask, scale) simde_mm_mask_i64gather_ps(src, HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_i64gather_ps (const simde_float32* base_addr, simde__m256i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    simde_float32 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_ps(base_addr, vindex, scale) _mm256_i64gather_ps(HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_i64gather_ps(base_addr, vindex, scale) simde_mm256_i64gather_ps(HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_mask_i64gather_ps (simde__m128 src, const simde_float32* base_addr, simde__m256i vindex, simde__m128 mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128_private
+    src_ = simde__m128_to_private(src),
+    mask_ = simde__m128_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i32[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float32))) & ~m);
+    simde_float32 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_ps(src, base_addr, vindex, mask, scale) _mm256_mask_i64gather_ps(src, HEDLEY_REINTERPRET_CAST(float const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_i64gather_ps(src, base_addr, vindex, mask, scale) simde_mm256_mask_i64gather_ps(src, HEDLEY_REINTERPRET_CAST(simde_float32 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_i32gather_pd (const simde_float64* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    simde_float64 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m128d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i32gather_pd(base_addr, vindex, scale) _mm_i32gather_pd(HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_i32gather_pd(base_addr, vindex, scale) simde_mm_i32gather_pd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_i32gather_pd (simde__m128d src, const simde_float64* base_addr, simde__m128i vindex, simde__m128d mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private
+    src_ = simde__m128d_to_private(src),
+    mask_ = simde__m128d_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float64))) & ~m);
+    simde_float64 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m128d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i32gather_pd(src, base_addr, vindex, mask, scale) _mm_mask_i32gather_pd(src, HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_i32gather_pd(src, base_addr, vindex, mask, scale) simde_mm_mask_i32gather_pd(src, HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_i32gather_pd (const simde_float64* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256d_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    simde_float64 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m256d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i32gather_pd(base_addr, vindex, scale) _mm256_i32gather_pd(HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_i32gather_pd(base_addr, vindex, scale) simde_mm256_i32gather_pd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_i32gather_pd (simde__m256d src, const simde_float64* base_addr, simde__m128i vindex, simde__m256d mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256d_private
+    src_ = simde__m256d_to_private(src),
+    mask_ = simde__m256d_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i32) / sizeof(vindex_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float64))) & ~m);
+    simde_float64 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m256d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i32gather_pd(src, base_addr, vindex, mask, scale) _mm256_mask_i32gather_pd(src, HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_i32gather_pd(src, base_addr, vindex, mask, scale) simde_mm256_mask_i32gather_pd(src, HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_i64gather_pd (const simde_float64* base_addr, simde__m128i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    simde_float64 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m128d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_i64gather_pd(base_addr, vindex, scale) _mm_i64gather_pd(HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_i64gather_pd(base_addr, vindex, scale) simde_mm_i64gather_pd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_i64gather_pd (simde__m128d src, const simde_float64* base_addr, simde__m128i vindex, simde__m128d mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private
+    src_ = simde__m128d_to_private(src),
+    mask_ = simde__m128d_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float64))) & ~m);
+    simde_float64 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m128d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm_mask_i64gather_pd(src, base_addr, vindex, mask, scale) _mm_mask_i64gather_pd(src, HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_i64gather_pd(src, base_addr, vindex, mask, scale) simde_mm_mask_i64gather_pd(src, HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_i64gather_pd (const simde_float64* base_addr, simde__m256i vindex, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256d_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    simde_float64 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m256d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_i64gather_pd(base_addr, vindex, scale) _mm256_i64gather_pd(HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_i64gather_pd(base_addr, vindex, scale) simde_mm256_i64gather_pd(HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_i64gather_pd (simde__m256d src, const simde_float64* base_addr, simde__m256i vindex, simde__m256d mask, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256d_private
+    src_ = simde__m256d_to_private(src),
+    mask_ = simde__m256d_to_private(mask),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, mask_.i64[i] < 0));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float64))) & ~m);
+    simde_float64 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m256d_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_mask_i64gather_pd(src, base_addr, vindex, mask, scale) _mm256_mask_i64gather_pd(src, HEDLEY_REINTERPRET_CAST(double const*, base_addr), vindex, mask, scale)
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_i64gather_pd(src, base_addr, vindex, mask, scale) simde_mm256_mask_i64gather_pd(src, HEDLEY_REINTERPRET_CAST(simde_float64 const*, base_addr), vindex, mask, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_madd_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  r_.m128i[0] = simde_mm_madd_epi16(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_madd_epi16(a_.m128i[1], b_.m128i[1]);
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_add_epi16(a, b) simde_mm256_add_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maddubs_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_maddubs_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  r_.m128i[0] = simde_mm_maddubs_epi16(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_maddubs_epi16(a_.m128i[1], b_.m128i[1]);
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maddubs_epi16(a, b) simde_mm256_maddubs_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE) && !defined(__PGI)
+  return _mm256_max_epi8(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE4_1)
+  r_.m128i[0] = simde_mm_max_epi8(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_max_epi8(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+    r_.i8[i] = a_.i8[i] > b_.i8[i] ? a_.i8[i] : b_.i8[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_max_epi8(a, b) simde_mm256_max_epi8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_max_epu8(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_SSE2_NEON)
+  r_.m128i[0] = simde_mm_max_epu8(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_max_epu8(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+    r_.u8[i] = (a_.u8[i] > b_.u8[i]) ? a_.u8[i] : b_.u8[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_max_epu8(a, b) simde_mm256_max_epu8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_max_epu16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_SSE2_NEON)
+  r_.m128i[0] = simde_mm_max_epu16(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_max_epu16(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+    r_.u16[i] = (a_.u16[i] > b_.u16[i]) ? a_.u16[i] : b_.u16[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_max_epu16(a, b) simde_mm256_max_epu16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epu32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_max_epu32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_SSE2_NEON)
+  r_.m128i[0] = simde_mm_max_epu32(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_max_epu32(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+    r_.u32[i] = (a_.u32[i] > b_.u32[i]) ? a_.u32[i] : b_.u32[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_max_epu32(a, b) simde_mm256_max_epu32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_max_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE2)
+  r_.m128i[0] = simde_mm_max_epi16(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_max_epi16(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+    r_.i16[i] = (a_.i16[i] > b_.i16[i]) ? a_.i16[i] : b_.i16[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_max_epi16(a, b) simde_mm256_max_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_max_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_max_epi32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE4_1)
+  r_.m128i[0] = simde_mm_max_epi32(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_max_epi32(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] = a_.i32[i] > b_.i32[i] ? a_.i32[i] : b_.i32[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_max_epi32(a, b) simde_mm256_max_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE) && !defined(__PGI)
+  return _mm256_min_epi8(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE4_1) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_min_epi8(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_min_epi8(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    __typeof__(r_.i8) m = (__typeof__(r_.i8)) (a_.i8 < b_.i8);
+    r_.i8 = (a_.i8 & m) | (b_.i8 & ~m);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+      r_.i8[i] = a_.i8[i] < b_.i8[i] ? a_.i8[i] : b_.i8[i];
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_min_epi8(a, b) simde_mm256_min_epi8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_min_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_min_epi16(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_min_epi16(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    __typeof__(r_.i16) m = (__typeof__(r_.i16)) (a_.i16 < b_.i16);
+    r_.i16 = (a_.i16 & m) | (b_.i16 & ~m);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      r_.i16[i] = a_.i16[i] < b_.i16[i] ? a_.i16[i] : b_.i16[i];
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_min_epi16(a, b) simde_mm256_min_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE) && !defined(__PGI)
+  return _mm256_min_epi32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE4_1) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_min_epi32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_min_epi32(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    __typeof__(r_.i32) m = (__typeof__(r_.i32)) (a_.i32 < b_.i32);
+    r_.i32 = (a_.i32 & m) | (b_.i32 & ~m);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      r_.i32[i] = a_.i32[i] < b_.i32[i] ? a_.i32[i] : b_.i32[i];
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_min_epi32(a, b) simde_mm256_min_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_min_epu8(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE2)
+  r_.m128i[0] = simde_mm_min_epu8(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_min_epu8(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+    r_.u8[i] = (a_.u8[i] < b_.u8[i]) ? a_.u8[i] : b_.u8[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_min_epu8(a, b) simde_mm256_min_epu8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epu16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_min_epu16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE2)
+  r_.m128i[0] = simde_mm_min_epu16(a_.m128i[0], b_.m128i[0]);
+  r_.m128i[1] = simde_mm_min_epu16(a_.m128i[1], b_.m128i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+    r_.u16[i] = (a_.u16[i] < b_.u16[i]) ? a_.u16[i] : b_.u16[i];
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_min_epu16(a, b) simde_mm256_min_epu16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_min_epu32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_min_epu32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_SSE2)
+  r_.m128i[0] = simde_mm_min_epu32(a_.m128i[0], b_.m128i[0]);
   r_.m128i[1] = simde_mm_min_epu32(a_.m128i[1], b_.m128i[1]);
 #else
   SIMDE__VECTORIZE
@@ -1394,6 +2593,154 @@ simde_mm256_movemask_epi8 (simde__m256i a) {
 #  define _mm256_movemask_epi8(a) simde_mm256_movemask_epi8(a)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mul_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_mul_epi32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE4_1)
+    r_.m128i[0] = simde_mm_mul_epi32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_mul_epi32(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i64 = ((a_.i64 << 32) >> 32) * ((b_.i64 << 32) >> 32);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      r_.i64[i] = HEDLEY_STATIC_CAST(int64_t, a_.i32[i * 2]) * HEDLEY_STATIC_CAST(int64_t, b_.i32[i * 2]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mul_epi32(a, b) simde_mm256_mul_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mul_epu32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_mul_epu32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE2)
+    r_.m128i[0] = simde_mm_mul_epu32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_mul_epu32(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u64 = (a_.u64 & UINT64_C(0xffffffff)) * (b_.u64 & UINT64_C(0xffffffff));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = HEDLEY_STATIC_CAST(uint64_t, a_.u32[i * 2]) * HEDLEY_STATIC_CAST(uint64_t, b_.u32[i * 2]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mul_epu32(a, b) simde_mm256_mul_epu32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mulhi_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_mulhi_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_mulhi_epi16(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_mulhi_epi16(a_.m128i[1], b_.m128i[1]);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, HEDLEY_STATIC_CAST(uint32_t, HEDLEY_STATIC_CAST(int32_t, a_.i16[i]) * HEDLEY_STATIC_CAST(int32_t, b_.i16[i])) >> 16);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mulhi_epi16(a, b) simde_mm256_mulhi_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mullo_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_mullo_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_mullo_epi16(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_mullo_epi16(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u16 = a_.u16 * b_.u16;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, a_.u16[i] * b_.u16[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mullo_epi16(a, b) simde_mm256_mullo_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mullo_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_mullo_epi32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE4_1) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_mullo_epi32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_mullo_epi32(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u32 = a_.u32 * b_.u32;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = a_.u32[i] * b_.u32[i];
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mullo_epi32(a, b) simde_mm256_mullo_epi32(a, b)
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_or_si256 (simde__m256i a, simde__m256i b) {
@@ -1421,7 +2768,36 @@ simde_mm256_or_si256 (simde__m256i a, simde__m256i b) {
 #endif
 }
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_or_si256(a, b) simde_mm256_or_si128(a, b)
+#  define _mm256_or_si256(a, b) simde_mm256_or_si128(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_packs_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_packs_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_packs_epi16(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_packs_epi16(a_.m128i[1], b_.m128i[1]);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+      const int16_t v = (((i >> 3) & 1) ? &b_ : &a_)->i16[(i & 7) | ((i & 16) >> 1)];
+      r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, (v > INT8_MAX) ? INT8_MAX : ((v < INT8_MIN) ? INT8_MIN : v));
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_packs_epi16(a, b) simde_mm256_packs_epi16(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -1454,6 +2830,64 @@ simde_mm256_packs_epi32 (simde__m256i a, simde__m256i b) {
 #  define _mm256_packs_epi32(a, b) simde_mm256_packs_epi32(a, b)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_packus_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_packus_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE2) || defined(SIMDE_AVX2_NEON)
+    r_.m128i[0] = simde_mm_packus_epi16(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_packus_epi16(a_.m128i[1], b_.m128i[1]);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+      const int16_t v = (((i >> 3) & 1) ? &b_ : &a_)->i16[(i & 7) | ((i & 16) >> 1)];
+      r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (v > UINT8_MAX) ? UINT8_MAX : ((v < 0) ? 0 : v));
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_packus_epi16(a, b) simde_mm256_packus_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_packus_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_packus_epi32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE4_1)
+    r_.m128i[0] = simde_mm_packus_epi32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_packus_epi32(a_.m128i[1], b_.m128i[1]);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      const int32_t v = (((i >> 2) & 1) ? &b_ : &a_)->i32[(i & 3) | ((i & 8) >> 1)];
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (v > UINT16_MAX) ? UINT16_MAX : ((v < 0) ? 0 : v));
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_packus_epi32(a, b) simde_mm256_packus_epi32(a, b)
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_permute2x128_si256 (simde__m256i a, simde__m256i b, const int imm8)
@@ -1497,6 +2931,64 @@ HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
 #  define _mm256_permute4x64_epi64(a, imm8) simde_mm256_permute4x64_epi64(a, imm8)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_permutevar8x32_epi32 (simde__m256i a, simde__m256i idx) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_permutevar8x32_epi32(a, idx);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    idx_ = simde__m256i_to_private(idx);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] = a_.i32[idx_.i32[i] & 7];
+  }
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_permutevar8x32_epi32(a, idx) simde_mm256_permutevar8x32_epi32(a, idx)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sad_epu8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_sad_epu8(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSE2)
+    r_.m128i[0] = simde_mm_sad_epu8(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_sad_epu8(a_.m128i[1], b_.m128i[1]);
+  #else
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      uint16_t sum = 0;
+
+      SIMDE__VECTORIZE_REDUCTION(+:sum)
+      for (size_t j = 0 ; j < 8 ; j++) {
+        const uint8_t e1 = a_.u8[(i * 8) + j], e2 = b_.u8[(i * 8) + j];
+        sum = HEDLEY_STATIC_CAST(uint16_t, sum + ((e1 > e2) ? (e1 - e2) : (e2 - e1)));
+      }
+
+      r_.u64[i] = sum;
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_sad_epu8(a, b) simde_mm256_sad_epu8(a, b)
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_shuffle_epi8 (simde__m256i a, simde__m256i b) {
@@ -1603,6 +3095,99 @@ simde_mm256_shuffle_epi32 (simde__m256i a, const int imm8) {
 #  define _mm256_shufflelo_epi16(a, imm8) simde_mm256_shufflelo_epi16(a, imm8)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sign_epi8 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_sign_epi8(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSSE3) || (defined(SIMDE_AVX2_NEON) && defined(SIMDE_ARCH_AARCH64))
+    r_.m128i[0] = simde_mm_sign_epi8(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_sign_epi8(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    const __typeof__(r_.u8) neg = (__typeof__(r_.u8)) (b_.i8 < 0), zero = (__typeof__(r_.u8)) (b_.i8 == 0);
+    r_.u8 = ((a_.u8 ^ neg) - neg) & ~zero;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+      r_.u8[i] = (b_.i8[i] < 0) ? HEDLEY_STATIC_CAST(uint8_t, - a_.u8[i]) : ((b_.i8[i] == 0) ? 0 : a_.u8[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_sign_epi8(a, b) simde_mm256_sign_epi8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sign_epi16 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_sign_epi16(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSSE3) || (defined(SIMDE_AVX2_NEON) && defined(SIMDE_ARCH_AARCH64))
+    r_.m128i[0] = simde_mm_sign_epi16(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_sign_epi16(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    const __typeof__(r_.u16) neg = (__typeof__(r_.u16)) (b_.i16 < 0), zero = (__typeof__(r_.u16)) (b_.i16 == 0);
+    r_.u16 = ((a_.u16 ^ neg) - neg) & ~zero;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = (b_.i16[i] < 0) ? HEDLEY_STATIC_CAST(uint16_t, - a_.u16[i]) : ((b_.i16[i] == 0) ? 0 : a_.u16[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_sign_epi16(a, b) simde_mm256_sign_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sign_epi32 (simde__m256i a, simde__m256i b) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_sign_epi32(a, b);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_SSSE3) || (defined(SIMDE_AVX2_NEON) && defined(SIMDE_ARCH_AARCH64))
+    r_.m128i[0] = simde_mm_sign_epi32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_sign_epi32(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    const __typeof__(r_.u32) neg = (__typeof__(r_.u32)) (b_.i32 < 0), zero = (__typeof__(r_.u32)) (b_.i32 == 0);
+    r_.u32 = ((a_.u32 ^ neg) - neg) & ~zero;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (b_.i32[i] < 0) ? HEDLEY_STATIC_CAST(uint32_t, - a_.u32[i]) : ((b_.i32[i] == 0) ? 0 : a_.u32[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_sign_epi32(a, b) simde_mm256_sign_epi32(a, b)
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_slli_epi16 (simde__m256i a, const int imm8)
@@ -1635,69 +3220,194 @@ simde_mm256_slli_epi16 (simde__m256i a, const int imm8)
          simde_mm_slli_epi16(simde_mm256_extracti128_si256(a, 0), (imm8)))
 #endif
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_slli_epi16(a, imm8) simde_mm256_slli_epi16(a, imm8)
+#  define _mm256_slli_epi16(a, imm8) simde_mm256_slli_epi16(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_slli_epi32 (simde__m256i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be in range [0, 31]") {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  r_.i32 = a_.i32 << HEDLEY_STATIC_CAST(int32_t, imm8);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] = a_.i32[i] << (imm8 & 0xff);
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_slli_epi32(a, imm8) _mm256_slli_epi32(a, imm8)
+#elif defined(SIMDE_ARCH_X86_SSE2)
+#  define simde_mm256_slli_epi32(a, imm8) \
+     simde_mm256_set_m128i( \
+         simde_mm_slli_epi32(simde_mm256_extracti128_si256(a, 1), (imm8)), \
+         simde_mm_slli_epi32(simde_mm256_extracti128_si256(a, 0), (imm8)))
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_slli_epi32(a, imm8) simde_mm256_slli_epi32(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_slli_epi64 (simde__m256i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 15) == imm8, "imm8 must be in range [0, 63]") {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  r_.i64 = a_.i64 << HEDLEY_STATIC_CAST(int64_t, imm8);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    r_.i64[i] = a_.i64[i] << (imm8 & 0xff);
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_slli_epi64(a, imm8) _mm256_slli_epi64(a, imm8)
+#elif defined(SIMDE_ARCH_X86_SSE2)
+#  define simde_mm256_slli_epi64(a, imm8) \
+     simde_mm256_set_m128i( \
+         simde_mm_slli_epi64(simde_mm256_extracti128_si256(a, 1), (imm8)), \
+         simde_mm_slli_epi64(simde_mm256_extracti128_si256(a, 0), (imm8)))
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_slli_epi64(a, imm8) simde_mm256_slli_epi64(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sllv_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm_sllv_epi32(a, count);
+#else
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    count_ = simde__m128i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON)
+    /* vshl only looks at the low byte of each count, so clamp the
+       counts first; shifting left by 32 or more gives 0. */
+    r_.neon_u32 = vshlq_u32(a_.neon_u32, vreinterpretq_s32_u32(vminq_u32(count_.neon_u32, vdupq_n_u32(32))));
+  #elif defined(SIMDE_AVX2_POWER_ALTIVEC)
+    /* vec_sl only looks at the low 5 bits of each count. */
+    r_.altivec_u32 = vec_and(vec_sl(a_.altivec_u32, count_.altivec_u32), (vector unsigned int) vec_cmplt(count_.altivec_u32, vec_splats(32U)));
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u32 = (a_.u32 << (count_.u32 & 31)) & ((__typeof__(r_.u32)) (count_.u32 < 32));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (count_.u32[i] < 32) ? (a_.u32[i] << count_.u32[i]) : 0;
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_sllv_epi32(a, count) simde_mm_sllv_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_sllv_epi32 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_sllv_epi32(a, count);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    count_ = simde__m256i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_sllv_epi32(a_.m128i[0], count_.m128i[0]);
+    r_.m128i[1] = simde_mm_sllv_epi32(a_.m128i[1], count_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u32 = (a_.u32 << (count_.u32 & 31)) & ((__typeof__(r_.u32)) (count_.u32 < 32));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (count_.u32[i] < 32) ? (a_.u32[i] << count_.u32[i]) : 0;
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_sllv_epi32(a, count) simde_mm256_sllv_epi32(a, count)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_slli_epi32 (simde__m256i a, const int imm8)
-    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be in range [0, 31]") {
-  simde__m256i_private
+simde__m128i
+simde_mm_sllv_epi64 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm_sllv_epi64(a, count);
+#else
+  simde__m128i_private
     r_,
-    a_ = simde__m256i_to_private(a);
+    a_ = simde__m128i_to_private(a),
+    count_ = simde__m128i_to_private(count);
 
-#if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
-  r_.i32 = a_.i32 << HEDLEY_STATIC_CAST(int32_t, imm8);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-    r_.i32[i] = a_.i32[i] << (imm8 & 0xff);
-  }
-#endif
+  #if defined(SIMDE_AVX2_NEON) && defined(SIMDE_ARCH_AARCH64)
+    r_.neon_u64 = vandq_u64(vshlq_u64(a_.neon_u64, vreinterpretq_s64_u64(count_.neon_u64)), vcltq_u64(count_.neon_u64, vdupq_n_u64(64)));
+  #elif defined(SIMDE_AVX2_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+    r_.altivec_u64 = vec_and(vec_sl(a_.altivec_u64, count_.altivec_u64), (vector unsigned long long) vec_cmplt(count_.altivec_u64, vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 64))));
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u64 = (a_.u64 << (count_.u64 & 63)) & ((__typeof__(r_.u64)) (count_.u64 < 64));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (count_.u64[i] < 64) ? (a_.u64[i] << count_.u64[i]) : 0;
+    }
+  #endif
 
-  return simde__m256i_from_private(r_);
-}
-#if defined(SIMDE_AVX2_NATIVE)
-#  define simde_mm256_slli_epi32(a, imm8) _mm256_slli_epi32(a, imm8)
-#elif defined(SIMDE_ARCH_X86_SSE2)
-#  define simde_mm256_slli_epi32(a, imm8) \
-     simde_mm256_set_m128i( \
-         simde_mm_slli_epi32(simde_mm256_extracti128_si256(a, 1), (imm8)), \
-         simde_mm_slli_epi32(simde_mm256_extracti128_si256(a, 0), (imm8)))
+  return simde__m128i_from_private(r_);
 #endif
+}
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_slli_epi32(a, imm8) simde_mm256_slli_epi32(a, imm8)
+#  define _mm_sllv_epi64(a, count) simde_mm_sllv_epi64(a, count)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
-simde_mm256_slli_epi64 (simde__m256i a, const int imm8)
-    HEDLEY_REQUIRE_MSG((imm8 & 15) == imm8, "imm8 must be in range [0, 63]") {
+simde_mm256_sllv_epi64 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_sllv_epi64(a, count);
+#else
   simde__m256i_private
     r_,
-    a_ = simde__m256i_to_private(a);
+    a_ = simde__m256i_to_private(a),
+    count_ = simde__m256i_to_private(count);
 
-#if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
-  r_.i64 = a_.i64 << HEDLEY_STATIC_CAST(int64_t, imm8);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-    r_.i64[i] = a_.i64[i] << (imm8 & 0xff);
-  }
-#endif
+  #if defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_sllv_epi64(a_.m128i[0], count_.m128i[0]);
+    r_.m128i[1] = simde_mm_sllv_epi64(a_.m128i[1], count_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u64 = (a_.u64 << (count_.u64 & 63)) & ((__typeof__(r_.u64)) (count_.u64 < 64));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (count_.u64[i] < 64) ? (a_.u64[i] << count_.u64[i]) : 0;
+    }
+  #endif
 
   return simde__m256i_from_private(r_);
-}
-#if defined(SIMDE_AVX2_NATIVE)
-#  define simde_mm256_slli_epi64(a, imm8) _mm256_slli_epi64(a, imm8)
-#elif defined(SIMDE_ARCH_X86_SSE2)
-#  define simde_mm256_slli_epi64(a, imm8) \
-     simde_mm256_set_m128i( \
-         simde_mm_slli_epi64(simde_mm256_extracti128_si256(a, 1), (imm8)), \
-         simde_mm_slli_epi64(simde_mm256_extracti128_si256(a, 0), (imm8)))
 #endif
+}
 #if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
-#  define _mm256_slli_epi64(a, imm8) simde_mm256_slli_epi64(a, imm8)
+#  define _mm256_sllv_epi64(a, count) simde_mm256_sllv_epi64(a, count)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
@@ -1820,6 +3530,40 @@ simde_mm256_sub_epi64 (simde__m256i a, simde__m256i b) {
 #  define _mm256_sub_epi64(a, b) simde_mm256_sub_epi64(a, b)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srli_epi16 (simde__m256i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+
+  if (imm8 > 15)
+    return simde_mm256_setzero_si256();
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  r_.u16 = a_.u16 >> HEDLEY_STATIC_CAST(int16_t, imm8);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+    r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, a_.u16[i] >> imm8);
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_srli_epi16(a, imm8) _mm256_srli_epi16(a, imm8)
+#elif defined(SIMDE_ARCH_X86_SSE2)
+#  define simde_mm256_srli_epi16(a, imm8) \
+     simde_mm256_set_m128i( \
+         simde_mm_srli_epi16(simde_mm256_extracti128_si256(a, 1), (imm8)), \
+         simde_mm_srli_epi16(simde_mm256_extracti128_si256(a, 0), (imm8)))
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_srli_epi16(a, imm8) simde_mm256_srli_epi16(a, imm8)
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_srli_epi64 (simde__m256i a, const int imm8) {
@@ -1884,6 +3628,258 @@ simde_mm256_srli_si256 (simde__m256i a, const int imm8) {
 #  define _mm256_srli_si256(a, imm8) simde_mm_srli_si256(a, imm8)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srai_epi16 (simde__m256i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+  /* Counts above 15 fill each element with copies of the sign bit. */
+  const int shift = (imm8 > 15) ? 15 : imm8;
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  r_.i16 = a_.i16 >> HEDLEY_STATIC_CAST(int16_t, shift);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+    r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, a_.i16[i] >> shift);
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_srai_epi16(a, imm8) _mm256_srai_epi16(a, imm8)
+#elif defined(SIMDE_ARCH_X86_SSE2)
+#  define simde_mm256_srai_epi16(a, imm8) \
+     simde_mm256_set_m128i( \
+         simde_mm_srai_epi16(simde_mm256_extracti128_si256(a, 1), (((imm8) > 15) ? 15 : (imm8))), \
+         simde_mm_srai_epi16(simde_mm256_extracti128_si256(a, 0), (((imm8) > 15) ? 15 : (imm8))))
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_srai_epi16(a, imm8) simde_mm256_srai_epi16(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srai_epi32 (simde__m256i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a);
+  const int shift = (imm8 > 31) ? 31 : imm8;
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  r_.i32 = a_.i32 >> HEDLEY_STATIC_CAST(int32_t, shift);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] = a_.i32[i] >> shift;
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX2_NATIVE)
+#  define simde_mm256_srai_epi32(a, imm8) _mm256_srai_epi32(a, imm8)
+#elif defined(SIMDE_ARCH_X86_SSE2)
+#  define simde_mm256_srai_epi32(a, imm8) \
+     simde_mm256_set_m128i( \
+         simde_mm_srai_epi32(simde_mm256_extracti128_si256(a, 1), (((imm8) > 31) ? 31 : (imm8))), \
+         simde_mm_srai_epi32(simde_mm256_extracti128_si256(a, 0), (((imm8) > 31) ? 31 : (imm8))))
+#endif
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_srai_epi32(a, imm8) simde_mm256_srai_epi32(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srav_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm_srav_epi32(a, count);
+#else
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    count_ = simde__m128i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON)
+    /* vshl fills the element with the sign bit for any right shift
+       of 32 or more, as long as the count fits in a byte. */
+    r_.neon_i32 = vshlq_s32(a_.neon_i32, vnegq_s32(vreinterpretq_s32_u32(vminq_u32(count_.neon_u32, vdupq_n_u32(32)))));
+  #elif defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.altivec_i32 = vec_sra(a_.altivec_i32, vec_min(count_.altivec_u32, vec_splats(31U)));
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    /* Counts above 31 become 31. */
+    r_.i32 = a_.i32 >> ((__typeof__(r_.i32)) ((count_.u32 | ((__typeof__(count_.u32)) (count_.u32 > 31))) & 31));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      r_.i32[i] = a_.i32[i] >> ((count_.u32[i] > 31) ? 31 : count_.u32[i]);
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_srav_epi32(a, count) simde_mm_srav_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srav_epi32 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_srav_epi32(a, count);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    count_ = simde__m256i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_srav_epi32(a_.m128i[0], count_.m128i[0]);
+    r_.m128i[1] = simde_mm_srav_epi32(a_.m128i[1], count_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i32 = a_.i32 >> ((__typeof__(r_.i32)) ((count_.u32 | ((__typeof__(count_.u32)) (count_.u32 > 31))) & 31));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      r_.i32[i] = a_.i32[i] >> ((count_.u32[i] > 31) ? 31 : count_.u32[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_srav_epi32(a, count) simde_mm256_srav_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srlv_epi32 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm_srlv_epi32(a, count);
+#else
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    count_ = simde__m128i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON)
+    /* Right shifts are left shifts by a negative count. */
+    r_.neon_u32 = vshlq_u32(a_.neon_u32, vnegq_s32(vreinterpretq_s32_u32(vminq_u32(count_.neon_u32, vdupq_n_u32(32)))));
+  #elif defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.altivec_u32 = vec_and(vec_sr(a_.altivec_u32, count_.altivec_u32), (vector unsigned int) vec_cmplt(count_.altivec_u32, vec_splats(32U)));
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u32 = (a_.u32 >> (count_.u32 & 31)) & ((__typeof__(r_.u32)) (count_.u32 < 32));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (count_.u32[i] < 32) ? (a_.u32[i] >> count_.u32[i]) : 0;
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_srlv_epi32(a, count) simde_mm_srlv_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srlv_epi32 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_srlv_epi32(a, count);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    count_ = simde__m256i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_srlv_epi32(a_.m128i[0], count_.m128i[0]);
+    r_.m128i[1] = simde_mm_srlv_epi32(a_.m128i[1], count_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u32 = (a_.u32 >> (count_.u32 & 31)) & ((__typeof__(r_.u32)) (count_.u32 < 32));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (count_.u32[i] < 32) ? (a_.u32[i] >> count_.u32[i]) : 0;
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_srlv_epi32(a, count) simde_mm256_srlv_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_srlv_epi64 (simde__m128i a, simde__m128i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm_srlv_epi64(a, count);
+#else
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    count_ = simde__m128i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON) && defined(SIMDE_ARCH_AARCH64)
+    r_.neon_u64 = vandq_u64(vshlq_u64(a_.neon_u64, vnegq_s64(vreinterpretq_s64_u64(count_.neon_u64))), vcltq_u64(count_.neon_u64, vdupq_n_u64(64)));
+  #elif defined(SIMDE_AVX2_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+    r_.altivec_u64 = vec_and(vec_sr(a_.altivec_u64, count_.altivec_u64), (vector unsigned long long) vec_cmplt(count_.altivec_u64, vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 64))));
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u64 = (a_.u64 >> (count_.u64 & 63)) & ((__typeof__(r_.u64)) (count_.u64 < 64));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (count_.u64[i] < 64) ? (a_.u64[i] >> count_.u64[i]) : 0;
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm_srlv_epi64(a, count) simde_mm_srlv_epi64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_srlv_epi64 (simde__m256i a, simde__m256i count) {
+#if defined(SIMDE_AVX2_NATIVE)
+  return _mm256_srlv_epi64(a, count);
+#else
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    count_ = simde__m256i_to_private(count);
+
+  #if defined(SIMDE_AVX2_NEON) || defined(SIMDE_AVX2_POWER_ALTIVEC)
+    r_.m128i[0] = simde_mm_srlv_epi64(a_.m128i[0], count_.m128i[0]);
+    r_.m128i[1] = simde_mm_srlv_epi64(a_.m128i[1], count_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u64 = (a_.u64 >> (count_.u64 & 63)) & ((__typeof__(r_.u64)) (count_.u64 < 64));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (count_.u64[i] < 64) ? (a_.u64[i] >> count_.u64[i]) : 0;
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX2_ENABLE_NATIVE_ALIASES)
+#  define _mm256_srlv_epi64(a, count) simde_mm256_srlv_epi64(a, count)
+#endif
+
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_unpacklo_epi8 (simde__m256i a, simde__m256i b) {
@@ -0,0 +1,195 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__AVX512BITALG_H)
+#  if !defined(SIMDE__AVX512BITALG_H)
+#    define SIMDE__AVX512BITALG_H
+#  endif
+#  include "avx512vbmi.h"
+#  include "avx512vpopcntdq.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AVX512BITALG_NATIVE)
+#    undef SIMDE_AVX512BITALG_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AVX512BITALG) && !defined(SIMDE_AVX512BITALG_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512BITALG_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_AVX512BITALG_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_AVX512BITALG_NEON
+#  elif defined(SIMDE_ARCH_POWER_ALTIVEC)
+#    define SIMDE_AVX512BITALG_POWER_ALTIVEC
+#  endif
+
+#  if defined(SIMDE_AVX512BITALG_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  if defined(SIMDE_AVX512BITALG_POWER_ALTIVEC)
+#    include <altivec.h>
+#  endif
+
+#if !defined(SIMDE_AVX512BITALG_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+  #define SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_bitshuffle_epi64_mask (simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_bitshuffle_epi64_mask(b, c);
+  #else
+    /* Bit 0 of each multishift result byte is bit (c & 63) of the
+     * matching quadword of b; move it to the sign bit and collect. */
+    return simde_mm512_movepi8_mask(simde_mm512_slli_epi16(simde_mm512_multishift_epi64_epi8(c, b), 7));
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_bitshuffle_epi64_mask(b, c) simde_mm512_bitshuffle_epi64_mask(b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_bitshuffle_epi64_mask (simde__mmask64 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_mask_bitshuffle_epi64_mask(k, b, c);
+  #else
+    return k & simde_mm512_bitshuffle_epi64_mask(b, c);
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_bitshuffle_epi64_mask(k, b, c) simde_mm512_mask_bitshuffle_epi64_mask(k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_popcnt_epi8 (simde__m512i a) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_popcnt_epi8(a);
+  #else
+    return simde_x_mm512_popcnt_epi8(a);
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_popcnt_epi8(a) simde_mm512_popcnt_epi8(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_popcnt_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_mask_popcnt_epi8(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi8(src, k, simde_mm512_popcnt_epi8(a));
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_popcnt_epi8(src, k, a) simde_mm512_mask_popcnt_epi8(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_popcnt_epi8 (simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_maskz_popcnt_epi8(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi8(k, simde_mm512_popcnt_epi8(a));
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_popcnt_epi8(k, a) simde_mm512_maskz_popcnt_epi8(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_popcnt_epi16 (simde__m512i a) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_popcnt_epi16(a);
+  #elif defined(SIMDE_ARCH_X86_SSSE3)
+    return simde_mm512_maddubs_epi16(simde_x_mm512_popcnt_epi8(a), simde_mm512_set1_epi8(1));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_AVX512BITALG_NEON)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u16 = vpaddlq_u8(vcntq_u8(a_.m128i_private[i].neon_u8));
+      }
+    #elif defined(SIMDE_AVX512BITALG_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+      for (size_t i = 0 ; i < (sizeof(r_.altivec_u16) / sizeof(r_.altivec_u16[0])) ; i++) {
+        r_.altivec_u16[i] = vec_popcnt(a_.altivec_u16[i]);
+      }
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        uint16_t v = a_.u16[i];
+        v = HEDLEY_STATIC_CAST(uint16_t, v - ((v >> 1) & UINT16_C(0x5555)));
+        v = HEDLEY_STATIC_CAST(uint16_t, (v & UINT16_C(0x3333)) + ((v >> 2) & UINT16_C(0x3333)));
+        v = HEDLEY_STATIC_CAST(uint16_t, (v + (v >> 4)) & UINT16_C(0x0f0f));
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (v + (v >> 8)) & UINT16_C(0x001f));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_popcnt_epi16(a) simde_mm512_popcnt_epi16(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_popcnt_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_mask_popcnt_epi16(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi16(src, k, simde_mm512_popcnt_epi16(a));
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_popcnt_epi16(src, k, a) simde_mm512_mask_popcnt_epi16(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_popcnt_epi16 (simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512BITALG_NATIVE)
+    return _mm512_maskz_popcnt_epi16(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi16(k, simde_mm512_popcnt_epi16(a));
+  #endif
+}
+#if defined(SIMDE_AVX512BITALG_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_popcnt_epi16(k, a) simde_mm512_maskz_popcnt_epi16(k, a)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AVX512BITALG_H) */
@@ -356,6 +356,2190 @@ simde_mm512_cvtepi8_epi16 (simde__m256i a) {
 #  define _mm512_cvtepi8_epi16(a) simde_mm512_cvtepi8_epi16(a)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_movepi8_mask (simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_movepi8_mask(a);
+#else
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  simde__mmask64 r = 0;
+
+  #if defined(SIMDE_AVX512BW_NEON) && defined(SIMDE_ARCH_AARCH64)
+    /* Weight the sign bit of each byte by its position within its group
+       of eight, then three rounds of pairwise addition collapse the 64
+       bytes into the eight bytes of the mask. */
+    static const uint8_t md[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t weights = vld1q_u8(md);
+    uint8x16_t m[4];
+
+    for (size_t i = 0 ; i < (sizeof(m) / sizeof(m[0])) ; i++) {
+      m[i] = vandq_u8(vreinterpretq_u8_s8(vshrq_n_s8(a_.m128i_private[i].neon_i8, 7)), weights);
+    }
+
+    uint8x16_t s = vpaddq_u8(vpaddq_u8(m[0], m[1]), vpaddq_u8(m[2], m[3]));
+    s = vpaddq_u8(s, s);
+    r = vgetq_lane_u64(vreinterpretq_u64_u8(s), 0);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(a_.m256i) / sizeof(a_.m256i[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask64, HEDLEY_STATIC_CAST(uint32_t, simde_mm256_movemask_epi8(a_.m256i[i]))) << (i * 32);
+    }
+  #elif defined(SIMDE_ARCH_X86_SSE2)
+    for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask64, HEDLEY_STATIC_CAST(uint16_t, simde_mm_movemask_epi8(a_.m128i[i]))) << (i * 16);
+    }
+  #else
+    for (size_t i = 0 ; i < (sizeof(a_.u8) / sizeof(a_.u8[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask64, a_.u8[i] >> 7) << i;
+    }
+  #endif
+
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movepi8_mask(a) simde_mm512_movepi8_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_movepi16_mask (simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_movepi16_mask(a);
+#else
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  simde__mmask32 r = 0;
+
+  #if defined(SIMDE_AVX512BW_NEON) && defined(SIMDE_ARCH_AARCH64)
+    static const uint16_t md[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint16x8_t weights = vld1q_u16(md);
+
+    for (size_t i = 0 ; i < (sizeof(a_.m128i_private) / sizeof(a_.m128i_private[0])) ; i++) {
+      const uint16x8_t m = vandq_u16(vreinterpretq_u16_s16(vshrq_n_s16(a_.m128i_private[i].neon_i16, 15)), weights);
+      r |= HEDLEY_STATIC_CAST(simde__mmask32, vaddvq_u16(m)) << (i * 8);
+    }
+  #elif defined(SIMDE_ARCH_X86_SSE2)
+    /* Signed saturation keeps the sign bit, so packing pairs of vectors
+       down to bytes lets movemask do the rest. */
+    for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i += 2) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask32, HEDLEY_STATIC_CAST(uint16_t, simde_mm_movemask_epi8(simde_mm_packs_epi16(a_.m128i[i], a_.m128i[i + 1])))) << (i * 8);
+    }
+  #else
+    for (size_t i = 0 ; i < (sizeof(a_.u16) / sizeof(a_.u16[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask32, a_.u16[i] >> 15) << i;
+    }
+  #endif
+
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movepi16_mask(a) simde_mm512_movepi16_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_movm_epi8 (simde__mmask64 k) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_movm_epi8(k);
+#else
+  simde__m512i_private r_;
+
+  /* Broadcast each byte of the mask to eight bytes, then test one bit
+     in each byte, like simde__m512i_from_mmask16. */
+  const simde__m128i bits = simde_mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, UINT64_C(0x8040201008040201)));
+  for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+    const simde__m128i kv = simde_mm_set_epi64x(
+      HEDLEY_STATIC_CAST(int64_t, ((k >> (i * 16 + 8)) & 0xff) * UINT64_C(0x0101010101010101)),
+      HEDLEY_STATIC_CAST(int64_t, ((k >> (i * 16    )) & 0xff) * UINT64_C(0x0101010101010101)));
+    r_.m128i[i] = simde_mm_cmpeq_epi8(simde_mm_and_si128(kv, bits), bits);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movm_epi8(k) simde_mm512_movm_epi8(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_movm_epi16 (simde__mmask32 k) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_movm_epi16(k);
+#else
+  simde__m512i_private r_;
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    const simde__m256i bits = simde_mm256_set_epi16(
+      HEDLEY_STATIC_CAST(int16_t, UINT16_C(0x8000)), 0x4000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0200, 0x0100,
+      0x0080, 0x0040, 0x0020, 0x0010, 0x0008, 0x0004, 0x0002, 0x0001);
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      const simde__m256i kv = simde_mm256_set1_epi16(HEDLEY_STATIC_CAST(int16_t, (k >> (i * 16)) & 0xffff));
+      r_.m256i[i] = simde_mm256_cmpeq_epi16(simde_mm256_and_si256(kv, bits), bits);
+    }
+  #else
+    const simde__m128i bits = simde_mm_set_epi16(128, 64, 32, 16, 8, 4, 2, 1);
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      const simde__m128i kv = simde_mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, (k >> (i * 8)) & 0xff));
+      r_.m128i[i] = simde_mm_cmpeq_epi16(simde_mm_and_si128(kv, bits), bits);
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movm_epi16(k) simde_mm512_movm_epi16(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mov_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_mov_epi8(src, k, a);
+#else
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    a_ = simde__m512i_to_private(a),
+    mask_ = simde__m512i_to_private(simde_mm512_movm_epi8(k)),
+    r_;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i32f = (a_.i32f & mask_.i32f) | (src_.i32f & ~mask_.i32f);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      r_.i32f[i] = (a_.i32f[i] & mask_.i32f[i]) | (src_.i32f[i] & ~mask_.i32f[i]);
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mov_epi8(src, k, a) simde_mm512_mask_mov_epi8(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mov_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_mov_epi16(src, k, a);
+#else
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    a_ = simde__m512i_to_private(a),
+    mask_ = simde__m512i_to_private(simde_mm512_movm_epi16(k)),
+    r_;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i32f = (a_.i32f & mask_.i32f) | (src_.i32f & ~mask_.i32f);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      r_.i32f[i] = (a_.i32f[i] & mask_.i32f[i]) | (src_.i32f[i] & ~mask_.i32f[i]);
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mov_epi16(src, k, a) simde_mm512_mask_mov_epi16(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mov_epi8 (simde__mmask64 k, simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maskz_mov_epi8(k, a);
+#else
+  return simde_mm512_and_si512(a, simde_mm512_movm_epi8(k));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mov_epi8(k, a) simde_mm512_maskz_mov_epi8(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mov_epi16 (simde__mmask32 k, simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maskz_mov_epi16(k, a);
+#else
+  return simde_mm512_and_si512(a, simde_mm512_movm_epi16(k));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mov_epi16(k, a) simde_mm512_maskz_mov_epi16(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_blend_epi8 (simde__mmask64 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_blend_epi8(k, a, b);
+#else
+  return simde_mm512_mask_mov_epi8(a, k, b);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_blend_epi8(k, a, b) simde_mm512_mask_blend_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_blend_epi16 (simde__mmask32 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_blend_epi16(k, a, b);
+#else
+  return simde_mm512_mask_mov_epi16(a, k, b);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_blend_epi16(k, a, b) simde_mm512_mask_blend_epi16(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sub_epi8 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_sub_epi8(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i8 = a_.i8 - b_.i8;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_sub_epi8(a_.m256i[i], b_.m256i[i]);
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sub_epi8(a, b) simde_mm512_sub_epi8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sub_epi16 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_sub_epi16(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i16 = a_.i16 - b_.i16;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_sub_epi16(a_.m256i[i], b_.m256i[i]);
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sub_epi16(a, b) simde_mm512_sub_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_add_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_add_epi8(src, k, a, b);
+#else
+  return simde_mm512_mask_mov_epi8(src, k, simde_mm512_add_epi8(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_add_epi8(src, k, a, b) simde_mm512_mask_add_epi8(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_add_epi8 (simde__mmask64 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maskz_add_epi8(k, a, b);
+#else
+  return simde_mm512_maskz_mov_epi8(k, simde_mm512_add_epi8(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_add_epi8(k, a, b) simde_mm512_maskz_add_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_add_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_add_epi16(src, k, a, b);
+#else
+  return simde_mm512_mask_mov_epi16(src, k, simde_mm512_add_epi16(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_add_epi16(src, k, a, b) simde_mm512_mask_add_epi16(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_add_epi16 (simde__mmask32 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maskz_add_epi16(k, a, b);
+#else
+  return simde_mm512_maskz_mov_epi16(k, simde_mm512_add_epi16(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_add_epi16(k, a, b) simde_mm512_maskz_add_epi16(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sub_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_sub_epi8(src, k, a, b);
+#else
+  return simde_mm512_mask_mov_epi8(src, k, simde_mm512_sub_epi8(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sub_epi8(src, k, a, b) simde_mm512_mask_sub_epi8(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sub_epi8 (simde__mmask64 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maskz_sub_epi8(k, a, b);
+#else
+  return simde_mm512_maskz_mov_epi8(k, simde_mm512_sub_epi8(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sub_epi8(k, a, b) simde_mm512_maskz_sub_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sub_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_sub_epi16(src, k, a, b);
+#else
+  return simde_mm512_mask_mov_epi16(src, k, simde_mm512_sub_epi16(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sub_epi16(src, k, a, b) simde_mm512_mask_sub_epi16(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sub_epi16 (simde__mmask32 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maskz_sub_epi16(k, a, b);
+#else
+  return simde_mm512_maskz_mov_epi16(k, simde_mm512_sub_epi16(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sub_epi16(k, a, b) simde_mm512_maskz_sub_epi16(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpeq_epi8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpeq_epi8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpeq_epi8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epi8_mask(k1, a, b) simde_mm512_mask_cmpeq_epi8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmpgt_epi8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpgt_epi8_mask(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpgt_epi8(a_.m256i[i], b_.m256i[i]);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i8 = (__typeof__(r_.i8)) (a_.i8 > b_.i8);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+      r_.i8[i] = (a_.i8[i] > b_.i8[i]) ? ~INT8_C(0) : INT8_C(0);
+    }
+  #endif
+
+  return simde_mm512_movepi8_mask(simde__m512i_from_private(r_));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epi8_mask(a, b) simde_mm512_cmpgt_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpgt_epi8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpgt_epi8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpgt_epi8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epi8_mask(k1, a, b) simde_mm512_mask_cmpgt_epi8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmpge_epi8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpge_epi8_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask64, ~simde_mm512_cmpgt_epi8_mask(b, a) & UINT64_C(0xffffffffffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epi8_mask(a, b) simde_mm512_cmpge_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpge_epi8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpge_epi8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpge_epi8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epi8_mask(k1, a, b) simde_mm512_mask_cmpge_epi8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmple_epi8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmple_epi8_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask64, ~simde_mm512_cmpgt_epi8_mask(a, b) & UINT64_C(0xffffffffffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epi8_mask(a, b) simde_mm512_cmple_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmple_epi8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmple_epi8_mask(k1, a, b);
+#else
+  return simde_mm512_cmple_epi8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epi8_mask(k1, a, b) simde_mm512_mask_cmple_epi8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmplt_epi8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmplt_epi8_mask(a, b);
+#else
+  return simde_mm512_cmpgt_epi8_mask(b, a);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epi8_mask(a, b) simde_mm512_cmplt_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmplt_epi8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmplt_epi8_mask(k1, a, b);
+#else
+  return simde_mm512_cmplt_epi8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epi8_mask(k1, a, b) simde_mm512_mask_cmplt_epi8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmpneq_epi8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpneq_epi8_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask64, ~simde_mm512_cmpeq_epi8_mask(a, b) & UINT64_C(0xffffffffffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epi8_mask(a, b) simde_mm512_cmpneq_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpneq_epi8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpneq_epi8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpneq_epi8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epi8_mask(k1, a, b) simde_mm512_mask_cmpneq_epi8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmp_epi8_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT64_C(0xffffffffffffffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm512_cmp_epi8_mask(a, b, imm8) _mm512_cmp_epi8_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epi8_mask(k1, a, b, imm8) _mm512_mask_cmp_epi8_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epi8_mask(k1, a, b, imm8) (simde_mm512_cmp_epi8_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epi8_mask(a, b, imm8) simde_mm512_cmp_epi8_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epi8_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epi8_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmpeq_epu8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpeq_epu8_mask(a, b);
+#else
+  return simde_mm512_cmpeq_epi8_mask(a, b);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpeq_epu8_mask(a, b) simde_mm512_cmpeq_epu8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpeq_epu8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpeq_epu8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpeq_epu8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epu8_mask(k1, a, b) simde_mm512_mask_cmpeq_epu8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmpgt_epu8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpgt_epu8_mask(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    /* Flip the sign bits so the signed comparison orders unsigned values. */
+    const simde__m256i sign = simde_mm256_set1_epi8(INT8_MIN);
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpgt_epi8(simde_mm256_xor_si256(a_.m256i[i], sign), simde_mm256_xor_si256(b_.m256i[i], sign));
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u8 = (__typeof__(r_.u8)) (a_.u8 > b_.u8);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+      r_.u8[i] = (a_.u8[i] > b_.u8[i]) ? ~UINT8_C(0) : UINT8_C(0);
+    }
+  #endif
+
+  return simde_mm512_movepi8_mask(simde__m512i_from_private(r_));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epu8_mask(a, b) simde_mm512_cmpgt_epu8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpgt_epu8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpgt_epu8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpgt_epu8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epu8_mask(k1, a, b) simde_mm512_mask_cmpgt_epu8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmpge_epu8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpge_epu8_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask64, ~simde_mm512_cmpgt_epu8_mask(b, a) & UINT64_C(0xffffffffffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epu8_mask(a, b) simde_mm512_cmpge_epu8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpge_epu8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpge_epu8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpge_epu8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epu8_mask(k1, a, b) simde_mm512_mask_cmpge_epu8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmple_epu8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmple_epu8_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask64, ~simde_mm512_cmpgt_epu8_mask(a, b) & UINT64_C(0xffffffffffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epu8_mask(a, b) simde_mm512_cmple_epu8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmple_epu8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmple_epu8_mask(k1, a, b);
+#else
+  return simde_mm512_cmple_epu8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epu8_mask(k1, a, b) simde_mm512_mask_cmple_epu8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmplt_epu8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmplt_epu8_mask(a, b);
+#else
+  return simde_mm512_cmpgt_epu8_mask(b, a);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epu8_mask(a, b) simde_mm512_cmplt_epu8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmplt_epu8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmplt_epu8_mask(k1, a, b);
+#else
+  return simde_mm512_cmplt_epu8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epu8_mask(k1, a, b) simde_mm512_mask_cmplt_epu8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmpneq_epu8_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpneq_epu8_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask64, ~simde_mm512_cmpeq_epu8_mask(a, b) & UINT64_C(0xffffffffffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epu8_mask(a, b) simde_mm512_cmpneq_epu8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_mask_cmpneq_epu8_mask (simde__mmask64 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpneq_epu8_mask(k1, a, b);
+#else
+  return simde_mm512_cmpneq_epu8_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epu8_mask(k1, a, b) simde_mm512_mask_cmpneq_epu8_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_cmp_epu8_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epu8_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epu8_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epu8_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epu8_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epu8_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epu8_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT64_C(0xffffffffffffffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm512_cmp_epu8_mask(a, b, imm8) _mm512_cmp_epu8_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epu8_mask(k1, a, b, imm8) _mm512_mask_cmp_epu8_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epu8_mask(k1, a, b, imm8) (simde_mm512_cmp_epu8_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epu8_mask(a, b, imm8) simde_mm512_cmp_epu8_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epu8_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epu8_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpeq_epi16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpeq_epi16_mask(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpeq_epi16(a_.m256i[i], b_.m256i[i]);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i16 = (__typeof__(r_.i16)) (a_.i16 == b_.i16);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      r_.i16[i] = (a_.i16[i] == b_.i16[i]) ? ~INT16_C(0) : INT16_C(0);
+    }
+  #endif
+
+  return simde_mm512_movepi16_mask(simde__m512i_from_private(r_));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpeq_epi16_mask(a, b) simde_mm512_cmpeq_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpeq_epi16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpeq_epi16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpeq_epi16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epi16_mask(k1, a, b) simde_mm512_mask_cmpeq_epi16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpgt_epi16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpgt_epi16_mask(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpgt_epi16(a_.m256i[i], b_.m256i[i]);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i16 = (__typeof__(r_.i16)) (a_.i16 > b_.i16);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      r_.i16[i] = (a_.i16[i] > b_.i16[i]) ? ~INT16_C(0) : INT16_C(0);
+    }
+  #endif
+
+  return simde_mm512_movepi16_mask(simde__m512i_from_private(r_));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epi16_mask(a, b) simde_mm512_cmpgt_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpgt_epi16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpgt_epi16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpgt_epi16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epi16_mask(k1, a, b) simde_mm512_mask_cmpgt_epi16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpge_epi16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpge_epi16_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask32, ~simde_mm512_cmpgt_epi16_mask(b, a) & UINT32_C(0xffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epi16_mask(a, b) simde_mm512_cmpge_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpge_epi16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpge_epi16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpge_epi16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epi16_mask(k1, a, b) simde_mm512_mask_cmpge_epi16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmple_epi16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmple_epi16_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask32, ~simde_mm512_cmpgt_epi16_mask(a, b) & UINT32_C(0xffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epi16_mask(a, b) simde_mm512_cmple_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmple_epi16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmple_epi16_mask(k1, a, b);
+#else
+  return simde_mm512_cmple_epi16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epi16_mask(k1, a, b) simde_mm512_mask_cmple_epi16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmplt_epi16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmplt_epi16_mask(a, b);
+#else
+  return simde_mm512_cmpgt_epi16_mask(b, a);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epi16_mask(a, b) simde_mm512_cmplt_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmplt_epi16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmplt_epi16_mask(k1, a, b);
+#else
+  return simde_mm512_cmplt_epi16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epi16_mask(k1, a, b) simde_mm512_mask_cmplt_epi16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpneq_epi16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpneq_epi16_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask32, ~simde_mm512_cmpeq_epi16_mask(a, b) & UINT32_C(0xffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epi16_mask(a, b) simde_mm512_cmpneq_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpneq_epi16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpneq_epi16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpneq_epi16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epi16_mask(k1, a, b) simde_mm512_mask_cmpneq_epi16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmp_epi16_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT32_C(0xffffffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm512_cmp_epi16_mask(a, b, imm8) _mm512_cmp_epi16_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epi16_mask(k1, a, b, imm8) _mm512_mask_cmp_epi16_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epi16_mask(k1, a, b, imm8) (simde_mm512_cmp_epi16_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epi16_mask(a, b, imm8) simde_mm512_cmp_epi16_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epi16_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epi16_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpeq_epu16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpeq_epu16_mask(a, b);
+#else
+  return simde_mm512_cmpeq_epi16_mask(a, b);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpeq_epu16_mask(a, b) simde_mm512_cmpeq_epu16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpeq_epu16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpeq_epu16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpeq_epu16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epu16_mask(k1, a, b) simde_mm512_mask_cmpeq_epu16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpgt_epu16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpgt_epu16_mask(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    /* Flip the sign bits so the signed comparison orders unsigned values. */
+    const simde__m256i sign = simde_mm256_set1_epi16(INT16_MIN);
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpgt_epi16(simde_mm256_xor_si256(a_.m256i[i], sign), simde_mm256_xor_si256(b_.m256i[i], sign));
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u16 = (__typeof__(r_.u16)) (a_.u16 > b_.u16);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = (a_.u16[i] > b_.u16[i]) ? ~UINT16_C(0) : UINT16_C(0);
+    }
+  #endif
+
+  return simde_mm512_movepi16_mask(simde__m512i_from_private(r_));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epu16_mask(a, b) simde_mm512_cmpgt_epu16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpgt_epu16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpgt_epu16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpgt_epu16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epu16_mask(k1, a, b) simde_mm512_mask_cmpgt_epu16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpge_epu16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpge_epu16_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask32, ~simde_mm512_cmpgt_epu16_mask(b, a) & UINT32_C(0xffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epu16_mask(a, b) simde_mm512_cmpge_epu16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpge_epu16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpge_epu16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpge_epu16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epu16_mask(k1, a, b) simde_mm512_mask_cmpge_epu16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmple_epu16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmple_epu16_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask32, ~simde_mm512_cmpgt_epu16_mask(a, b) & UINT32_C(0xffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epu16_mask(a, b) simde_mm512_cmple_epu16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmple_epu16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmple_epu16_mask(k1, a, b);
+#else
+  return simde_mm512_cmple_epu16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epu16_mask(k1, a, b) simde_mm512_mask_cmple_epu16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmplt_epu16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmplt_epu16_mask(a, b);
+#else
+  return simde_mm512_cmpgt_epu16_mask(b, a);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epu16_mask(a, b) simde_mm512_cmplt_epu16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmplt_epu16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmplt_epu16_mask(k1, a, b);
+#else
+  return simde_mm512_cmplt_epu16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epu16_mask(k1, a, b) simde_mm512_mask_cmplt_epu16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmpneq_epu16_mask (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_cmpneq_epu16_mask(a, b);
+#else
+  return HEDLEY_STATIC_CAST(simde__mmask32, ~simde_mm512_cmpeq_epu16_mask(a, b) & UINT32_C(0xffffffff));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epu16_mask(a, b) simde_mm512_cmpneq_epu16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_mask_cmpneq_epu16_mask (simde__mmask32 k1, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_cmpneq_epu16_mask(k1, a, b);
+#else
+  return simde_mm512_cmpneq_epu16_mask(a, b) & k1;
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epu16_mask(k1, a, b) simde_mm512_mask_cmpneq_epu16_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmp_epu16_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epu16_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epu16_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epu16_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epu16_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epu16_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epu16_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT32_C(0xffffffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm512_cmp_epu16_mask(a, b, imm8) _mm512_cmp_epu16_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epu16_mask(k1, a, b, imm8) _mm512_mask_cmp_epu16_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epu16_mask(k1, a, b, imm8) (simde_mm512_cmp_epu16_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epu16_mask(a, b, imm8) simde_mm512_cmp_epu16_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epu16_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epu16_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_packs_epi16 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_packs_epi16(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  /* Like the 256-bit version, this works within 128-bit lanes. */
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_packs_epi16(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_packs_epi16(a, b) simde_mm512_packs_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_packs_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_packs_epi32(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_packs_epi32(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_packs_epi32(a, b) simde_mm512_packs_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_packus_epi16 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_packus_epi16(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_packus_epi16(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_packus_epi16(a, b) simde_mm512_packus_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_packus_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_packus_epi32(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_packus_epi32(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_packus_epi32(a, b) simde_mm512_packus_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpacklo_epi8 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_unpacklo_epi8(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_unpacklo_epi8(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpacklo_epi8(a, b) simde_mm512_unpacklo_epi8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpackhi_epi8 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_unpackhi_epi8(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_unpackhi_epi8(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpackhi_epi8(a, b) simde_mm512_unpackhi_epi8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpacklo_epi16 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_unpacklo_epi16(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_unpacklo_epi16(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpacklo_epi16(a, b) simde_mm512_unpacklo_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpackhi_epi16 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_unpackhi_epi16(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_unpackhi_epi16(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpackhi_epi16(a, b) simde_mm512_unpackhi_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sad_epu8 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_sad_epu8(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_sad_epu8(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sad_epu8(a, b) simde_mm512_sad_epu8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_madd_epi16 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_madd_epi16(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_madd_epi16(a_.m256i[i], b_.m256i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_madd_epi16(a, b) simde_mm512_madd_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maddubs_epi16 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maddubs_epi16(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+    r_.m128i[i] = simde_mm_maddubs_epi16(a_.m128i[i], b_.m128i[i]);
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maddubs_epi16(a, b) simde_mm512_maddubs_epi16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_slli_epi16 (simde__m512i a, unsigned int imm8) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_slli_epi16(a, imm8);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+
+  if (imm8 > 15) {
+    simde_memset(&r_, 0, sizeof(r_));
+  } else {
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_slli_epi16(a_.m256i[i], HEDLEY_STATIC_CAST(int, imm8));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.u16 = a_.u16 << imm8;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, a_.u16[i] << imm8);
+      }
+    #endif
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_slli_epi16(a, imm8) simde_mm512_slli_epi16(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srli_epi16 (simde__m512i a, unsigned int imm8) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_srli_epi16(a, imm8);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+
+  if (imm8 > 15) {
+    simde_memset(&r_, 0, sizeof(r_));
+  } else {
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_srli_epi16(a_.m256i[i], HEDLEY_STATIC_CAST(int, imm8));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.u16 = a_.u16 >> imm8;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, a_.u16[i] >> imm8);
+      }
+    #endif
+  }
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srli_epi16(a, imm8) simde_mm512_srli_epi16(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srai_epi16 (simde__m512i a, unsigned int imm8) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_srai_epi16(a, imm8);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+
+  /* Anything past 15 just fills with the sign bit. */
+  if (imm8 > 15) {
+    imm8 = 15;
+  }
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_srai_epi16(a_.m256i[i], HEDLEY_STATIC_CAST(int, imm8));
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.i16 = a_.i16 >> imm8;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, a_.i16[i] >> imm8);
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srai_epi16(a, imm8) simde_mm512_srai_epi16(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_permutexvar_epi16 (simde__m512i idx, simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_permutexvar_epi16(idx, a);
+#else
+  simde__m512i_private
+    r_,
+    idx_ = simde__m512i_to_private(idx),
+    a_ = simde__m512i_to_private(a);
+
+  #if defined(SIMDE_AVX512BW_NEON) && defined(SIMDE_ARCH_AARCH64)
+    const uint8x16x4_t table = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8,
+                                   a_.m128i_private[2].neon_u8, a_.m128i_private[3].neon_u8 } };
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+      /* Element n is bytes 2n and 2n + 1 of the table. */
+      const uint16x8_t n = vandq_u16(idx_.m128i_private[i].neon_u16, vdupq_n_u16(31));
+      r_.m128i_private[i].neon_u8 = vqtbl4q_u8(table, vreinterpretq_u8_u16(vmlaq_n_u16(vdupq_n_u16(0x0100), n, 0x0202)));
+    }
+  #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+    r_.i16 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i16, a_.i16, idx_.i16);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      r_.i16[i] = a_.i16[idx_.i16[i] & 31];
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutexvar_epi16(idx, a) simde_mm512_permutexvar_epi16(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_permutexvar_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i idx, simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_mask_permutexvar_epi16(src, k, idx, a);
+#else
+  return simde_mm512_mask_mov_epi16(src, k, simde_mm512_permutexvar_epi16(idx, a));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutexvar_epi16(src, k, idx, a) simde_mm512_mask_permutexvar_epi16(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_permutexvar_epi16 (simde__mmask32 k, simde__m512i idx, simde__m512i a) {
+#if defined(SIMDE_AVX512BW_NATIVE)
+  return _mm512_maskz_permutexvar_epi16(k, idx, a);
+#else
+  return simde_mm512_maskz_mov_epi16(k, simde_mm512_permutexvar_epi16(idx, a));
+#endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutexvar_epi16(k, idx, a) simde_mm512_maskz_permutexvar_epi16(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kand_mask32 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kand_mask32(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, a & b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kand_mask32(a, b) simde_kand_mask32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kandn_mask32 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kandn_mask32(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, (~a & b) & UINT32_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kandn_mask32(a, b) simde_kandn_mask32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kor_mask32 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kor_mask32(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, a | b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kor_mask32(a, b) simde_kor_mask32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kxnor_mask32 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxnor_mask32(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, (~(a ^ b)) & UINT32_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kxnor_mask32(a, b) simde_kxnor_mask32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kxor_mask32 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxor_mask32(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, a ^ b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kxor_mask32(a, b) simde_kxor_mask32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_knot_mask32 (simde__mmask32 a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _knot_mask32(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, ~a & UINT32_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _knot_mask32(a) simde_knot_mask32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kadd_mask32 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kadd_mask32(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, (a + b) & UINT32_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kadd_mask32(a, b) simde_kadd_mask32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestz_mask32_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kortestz_mask32_u8(a, b) simde_kortestz_mask32_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestc_mask32_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, ((a | b) & UINT32_C(0xffffffff)) == UINT32_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kortestc_mask32_u8(a, b) simde_kortestc_mask32_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask32_u8 (simde__mmask32 a, simde__mmask32 b, unsigned char* all_ones) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortest_mask32_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask32_u8(a, b);
+    return simde_kortestz_mask32_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kortest_mask32_u8(a, b, all_ones) simde_kortest_mask32_u8(a, b, all_ones)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestz_mask32_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a & b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _ktestz_mask32_u8(a, b) simde_ktestz_mask32_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestc_mask32_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (~a & b & UINT32_C(0xffffffff)) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _ktestc_mask32_u8(a, b) simde_ktestc_mask32_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask32_u8 (simde__mmask32 a, simde__mmask32 b, unsigned char* and_not) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktest_mask32_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask32_u8(a, b);
+    return simde_ktestz_mask32_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _ktest_mask32_u8(a, b, and_not) simde_ktest_mask32_u8(a, b, and_not)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kshiftli_mask32 (simde__mmask32 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 31) ? 0 : HEDLEY_STATIC_CAST(simde__mmask32, (a << count) & UINT32_C(0xffffffff));
+}
+#if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftli_mask32(a, count) _kshiftli_mask32(a, count)
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kshiftli_mask32(a, count) simde_kshiftli_mask32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_kshiftri_mask32 (simde__mmask32 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 31) ? 0 : HEDLEY_STATIC_CAST(simde__mmask32, a >> count);
+}
+#if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftri_mask32(a, count) _kshiftri_mask32(a, count)
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kshiftri_mask32(a, count) simde_kshiftri_mask32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask32_u32 (simde__mmask32 a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtmask32_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _cvtmask32_u32(a) simde_cvtmask32_u32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_cvtu32_mask32 (unsigned int a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtu32_mask32(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, a & UINT32_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _cvtu32_mask32(a) simde_cvtu32_mask32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_load_mask32 (simde__mmask32* mem_addr) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _load_mask32(mem_addr);
+  #else
+    return *mem_addr;
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _load_mask32(mem_addr) simde_load_mask32(mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_store_mask32 (simde__mmask32* mem_addr, simde__mmask32 a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    _store_mask32(mem_addr, a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _store_mask32(mem_addr, a) simde_store_mask32(mem_addr, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kand_mask64 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kand_mask64(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, a & b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kand_mask64(a, b) simde_kand_mask64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kandn_mask64 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kandn_mask64(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, (~a & b) & UINT64_C(0xffffffffffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kandn_mask64(a, b) simde_kandn_mask64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kor_mask64 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kor_mask64(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, a | b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kor_mask64(a, b) simde_kor_mask64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kxnor_mask64 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxnor_mask64(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, (~(a ^ b)) & UINT64_C(0xffffffffffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kxnor_mask64(a, b) simde_kxnor_mask64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kxor_mask64 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxor_mask64(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, a ^ b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kxor_mask64(a, b) simde_kxor_mask64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_knot_mask64 (simde__mmask64 a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _knot_mask64(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, ~a & UINT64_C(0xffffffffffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _knot_mask64(a) simde_knot_mask64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kadd_mask64 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kadd_mask64(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, (a + b) & UINT64_C(0xffffffffffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kadd_mask64(a, b) simde_kadd_mask64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestz_mask64_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kortestz_mask64_u8(a, b) simde_kortestz_mask64_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestc_mask64_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, ((a | b) & UINT64_C(0xffffffffffffffff)) == UINT64_C(0xffffffffffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kortestc_mask64_u8(a, b) simde_kortestc_mask64_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask64_u8 (simde__mmask64 a, simde__mmask64 b, unsigned char* all_ones) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortest_mask64_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask64_u8(a, b);
+    return simde_kortestz_mask64_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kortest_mask64_u8(a, b, all_ones) simde_kortest_mask64_u8(a, b, all_ones)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestz_mask64_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a & b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _ktestz_mask64_u8(a, b) simde_ktestz_mask64_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestc_mask64_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (~a & b & UINT64_C(0xffffffffffffffff)) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _ktestc_mask64_u8(a, b) simde_ktestc_mask64_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask64_u8 (simde__mmask64 a, simde__mmask64 b, unsigned char* and_not) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktest_mask64_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask64_u8(a, b);
+    return simde_ktestz_mask64_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _ktest_mask64_u8(a, b, and_not) simde_ktest_mask64_u8(a, b, and_not)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kshiftli_mask64 (simde__mmask64 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 63) ? 0 : HEDLEY_STATIC_CAST(simde__mmask64, (a << count) & UINT64_C(0xffffffffffffffff));
+}
+#if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftli_mask64(a, count) _kshiftli_mask64(a, count)
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kshiftli_mask64(a, count) simde_kshiftli_mask64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_kshiftri_mask64 (simde__mmask64 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 63) ? 0 : HEDLEY_STATIC_CAST(simde__mmask64, a >> count);
+}
+#if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftri_mask64(a, count) _kshiftri_mask64(a, count)
+#endif
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _kshiftri_mask64(a, count) simde_kshiftri_mask64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_cvtmask64_u64 (simde__mmask64 a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtmask64_u64(a);
+  #else
+    return HEDLEY_STATIC_CAST(uint64_t, a);
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _cvtmask64_u64(a) simde_cvtmask64_u64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_cvtu64_mask64 (uint64_t a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtu64_mask64(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, a & UINT64_C(0xffffffffffffffff));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _cvtu64_mask64(a) simde_cvtu64_mask64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_load_mask64 (simde__mmask64* mem_addr) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _load_mask64(mem_addr);
+  #else
+    return *mem_addr;
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _load_mask64(mem_addr) simde_load_mask64(mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_store_mask64 (simde__mmask64* mem_addr, simde__mmask64 a) {
+  #if defined(SIMDE_AVX512BW_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    _store_mask64(mem_addr, a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _store_mask64(mem_addr, a) simde_store_mask64(mem_addr, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_kunpackw (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE)
+    return _mm512_kunpackw(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, ((a & UINT32_C(0xffff)) << 16) | (b & UINT32_C(0xffff)));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_kunpackw(a, b) simde_mm512_kunpackw(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_kunpackd (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_AVX512BW_NATIVE)
+    return _mm512_kunpackd(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, ((a & UINT64_C(0xffffffff)) << 32) | (b & UINT64_C(0xffffffff)));
+  #endif
+}
+#if defined(SIMDE_AVX512BW_ENABLE_NATIVE_ALIASES)
+#  define _mm512_kunpackd(a, b) simde_mm512_kunpackd(a, b)
+#endif
+
 SIMDE__END_DECLS
 
 HEDLEY_DIAGNOSTIC_POP
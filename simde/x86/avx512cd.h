@@ -0,0 +1,413 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__AVX512CD_H)
+#  if !defined(SIMDE__AVX512CD_H)
+#    define SIMDE__AVX512CD_H
+#  endif
+#  include "avx512f.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AVX512CD_NATIVE)
+#    undef SIMDE_AVX512CD_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AVX512CD) && !defined(SIMDE_AVX512CD_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512CD_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_AVX512CD_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_AVX512CD_NEON
+#  elif defined(SIMDE_ARCH_POWER_ALTIVEC)
+#    define SIMDE_AVX512CD_POWER_ALTIVEC
+#  endif
+
+#  if defined(SIMDE_AVX512CD_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  if defined(SIMDE_AVX512CD_POWER_ALTIVEC)
+#    include <altivec.h>
+#  endif
+
+#if !defined(SIMDE_AVX512CD_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+  #define SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_broadcastmw_epi32 (simde__mmask16 k) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_broadcastmw_epi32(k);
+#else
+  return simde_mm512_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k & UINT16_C(0xffff)));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_broadcastmw_epi32(k) simde_mm512_broadcastmw_epi32(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_broadcastmb_epi64 (simde__mmask8 k) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_broadcastmb_epi64(k);
+#else
+  return simde_mm512_set1_epi64(HEDLEY_STATIC_CAST(int64_t, k & UINT8_C(0xff)));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_broadcastmb_epi64(k) simde_mm512_broadcastmb_epi64(k)
+#endif
+
+/* Rather than comparing every pair of elements, broadcast each element
+   in turn, compare it against the whole vector and OR its bit into
+   every lane that matched.  That gives every lane the bits of all
+   equal elements, so at the end each lane is masked down to the
+   elements below it. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_conflict_epi32 (simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_conflict_epi32(a);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+  const simde__m512i_private below_ = simde__m512i_to_private(simde_mm512_set_epi32(
+    INT32_C(0x7fff), INT32_C(0x3fff), INT32_C(0x1fff), INT32_C(0x0fff),
+    INT32_C(0x07ff), INT32_C(0x03ff), INT32_C(0x01ff), INT32_C(0x00ff),
+    INT32_C(0x007f), INT32_C(0x003f), INT32_C(0x001f), INT32_C(0x000f),
+    INT32_C(0x0007), INT32_C(0x0003), INT32_C(0x0001), INT32_C(0x0000)));
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t h = 0 ; h < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; h++) {
+      simde__m256i acc = simde_mm256_setzero_si256();
+      for (size_t j = 0 ; j < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; j++) {
+        const simde__m256i eq = simde_mm256_cmpeq_epi32(a_.m256i[h], simde_mm256_set1_epi32(a_.i32[j]));
+        acc = simde_mm256_or_si256(acc, simde_mm256_and_si256(eq, simde_mm256_set1_epi32(INT32_C(1) << j)));
+      }
+      r_.m256i[h] = simde_mm256_and_si256(acc, below_.m256i[h]);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    simde_memset(&r_, 0, sizeof(r_));
+    for (size_t j = 0 ; j < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; j++) {
+      r_.i32 |= (a_.i32 == a_.i32[j]) & (INT32_C(1) << j);
+    }
+    r_.i32 &= below_.i32;
+  #else
+    simde_memset(&r_, 0, sizeof(r_));
+    for (size_t j = 0 ; j < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; j++) {
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] |= (a_.i32[i] == a_.i32[j]) ? (INT32_C(1) << j) : 0;
+      }
+    }
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      r_.i32[i] &= below_.i32[i];
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_conflict_epi32(a) simde_mm512_conflict_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_conflict_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_mask_conflict_epi32(src, k, a);
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_conflict_epi32(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_conflict_epi32(src, k, a) simde_mm512_mask_conflict_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_conflict_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_maskz_conflict_epi32(k, a);
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_conflict_epi32(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_conflict_epi32(k, a) simde_mm512_maskz_conflict_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_conflict_epi64 (simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_conflict_epi64(a);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+  const simde__m512i_private below_ = simde__m512i_to_private(simde_mm512_set_epi64(
+    INT64_C(0x7f), INT64_C(0x3f), INT64_C(0x1f), INT64_C(0x0f),
+    INT64_C(0x07), INT64_C(0x03), INT64_C(0x01), INT64_C(0x00)));
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t h = 0 ; h < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; h++) {
+      simde__m256i acc = simde_mm256_setzero_si256();
+      for (size_t j = 0 ; j < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; j++) {
+        const simde__m256i eq = simde_mm256_cmpeq_epi64(a_.m256i[h], simde_mm256_set1_epi64x(a_.i64[j]));
+        acc = simde_mm256_or_si256(acc, simde_mm256_and_si256(eq, simde_mm256_set1_epi64x(INT64_C(1) << j)));
+      }
+      r_.m256i[h] = simde_mm256_and_si256(acc, below_.m256i[h]);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    simde_memset(&r_, 0, sizeof(r_));
+    for (size_t j = 0 ; j < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; j++) {
+      r_.i64 |= (a_.i64 == a_.i64[j]) & (INT64_C(1) << j);
+    }
+    r_.i64 &= below_.i64;
+  #else
+    simde_memset(&r_, 0, sizeof(r_));
+    for (size_t j = 0 ; j < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; j++) {
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] |= (a_.i64[i] == a_.i64[j]) ? (INT64_C(1) << j) : 0;
+      }
+    }
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      r_.i64[i] &= below_.i64[i];
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_conflict_epi64(a) simde_mm512_conflict_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_conflict_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_mask_conflict_epi64(src, k, a);
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_conflict_epi64(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_conflict_epi64(src, k, a) simde_mm512_mask_conflict_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_conflict_epi64 (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_maskz_conflict_epi64(k, a);
+#else
+  return simde_mm512_maskz_mov_epi64(k, simde_mm512_conflict_epi64(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_conflict_epi64(k, a) simde_mm512_maskz_conflict_epi64(k, a)
+#endif
+
+/* Without a vector clz, smear the highest set bit into every bit below
+   it and count the zeros that are left. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_lzcnt_epi32 (simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_lzcnt_epi32(a);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+
+  #if defined(SIMDE_AVX512CD_NEON)
+    for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+      r_.m128i_private[i].neon_u32 = vclzq_u32(a_.m128i_private[i].neon_u32);
+    }
+  #elif defined(SIMDE_AVX512CD_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+    for (size_t i = 0 ; i < (sizeof(r_.altivec_u32) / sizeof(r_.altivec_u32[0])) ; i++) {
+      r_.altivec_u32[i] = vec_cntlz(a_.altivec_u32[i]);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u32 = a_.u32 | (a_.u32 >> 1);
+    r_.u32 |= r_.u32 >> 2;
+    r_.u32 |= r_.u32 >> 4;
+    r_.u32 |= r_.u32 >> 8;
+    r_.u32 |= r_.u32 >> 16;
+    r_.u32 = ~r_.u32;
+    r_.u32 -= (r_.u32 >> 1) & UINT32_C(0x55555555);
+    r_.u32 = (r_.u32 & UINT32_C(0x33333333)) + ((r_.u32 >> 2) & UINT32_C(0x33333333));
+    r_.u32 = (r_.u32 + (r_.u32 >> 4)) & UINT32_C(0x0f0f0f0f);
+    r_.u32 = (r_.u32 * UINT32_C(0x01010101)) >> 24;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      uint32_t v = a_.u32[i];
+      v |= v >> 1;
+      v |= v >> 2;
+      v |= v >> 4;
+      v |= v >> 8;
+      v |= v >> 16;
+      v = ~v;
+      v -= (v >> 1) & UINT32_C(0x55555555);
+      v = (v & UINT32_C(0x33333333)) + ((v >> 2) & UINT32_C(0x33333333));
+      v = (v + (v >> 4)) & UINT32_C(0x0f0f0f0f);
+      r_.u32[i] = (v * UINT32_C(0x01010101)) >> 24;
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_lzcnt_epi32(a) simde_mm512_lzcnt_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_lzcnt_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_mask_lzcnt_epi32(src, k, a);
+#else
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_lzcnt_epi32(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_lzcnt_epi32(src, k, a) simde_mm512_mask_lzcnt_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_lzcnt_epi32 (simde__mmask16 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_maskz_lzcnt_epi32(k, a);
+#else
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_lzcnt_epi32(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_lzcnt_epi32(k, a) simde_mm512_maskz_lzcnt_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_lzcnt_epi64 (simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_lzcnt_epi64(a);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+
+  #if defined(SIMDE_AVX512CD_NEON) && defined(SIMDE_ARCH_AARCH64)
+    /* There is no 64-bit vclz; count each half and only add in the low
+       half's count when the high half is all zeros. */
+    for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+      const uint64x2_t c = vreinterpretq_u64_u32(vclzq_u32(a_.m128i_private[i].neon_u32));
+      const uint64x2_t hi = vshrq_n_u64(c, 32);
+      const uint64x2_t lo = vandq_u64(c, vdupq_n_u64(UINT64_C(0xffffffff)));
+      r_.m128i_private[i].neon_u64 = vaddq_u64(hi, vandq_u64(lo, vceqq_u64(hi, vdupq_n_u64(32))));
+    }
+  #elif defined(SIMDE_AVX512CD_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+    for (size_t i = 0 ; i < (sizeof(r_.altivec_u64) / sizeof(r_.altivec_u64[0])) ; i++) {
+      r_.altivec_u64[i] = vec_cntlz(a_.altivec_u64[i]);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u64 = a_.u64 | (a_.u64 >> 1);
+    r_.u64 |= r_.u64 >> 2;
+    r_.u64 |= r_.u64 >> 4;
+    r_.u64 |= r_.u64 >> 8;
+    r_.u64 |= r_.u64 >> 16;
+    r_.u64 |= r_.u64 >> 32;
+    r_.u64 = ~r_.u64;
+    r_.u64 -= (r_.u64 >> 1) & UINT64_C(0x5555555555555555);
+    r_.u64 = (r_.u64 & UINT64_C(0x3333333333333333)) + ((r_.u64 >> 2) & UINT64_C(0x3333333333333333));
+    r_.u64 = (r_.u64 + (r_.u64 >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+    r_.u64 = (r_.u64 * UINT64_C(0x0101010101010101)) >> 56;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      uint64_t v = a_.u64[i];
+      v |= v >> 1;
+      v |= v >> 2;
+      v |= v >> 4;
+      v |= v >> 8;
+      v |= v >> 16;
+      v |= v >> 32;
+      v = ~v;
+      v -= (v >> 1) & UINT64_C(0x5555555555555555);
+      v = (v & UINT64_C(0x3333333333333333)) + ((v >> 2) & UINT64_C(0x3333333333333333));
+      v = (v + (v >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+      r_.u64[i] = (v * UINT64_C(0x0101010101010101)) >> 56;
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_lzcnt_epi64(a) simde_mm512_lzcnt_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_lzcnt_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_mask_lzcnt_epi64(src, k, a);
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_lzcnt_epi64(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_lzcnt_epi64(src, k, a) simde_mm512_mask_lzcnt_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_lzcnt_epi64 (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512CD_NATIVE)
+  return _mm512_maskz_lzcnt_epi64(k, a);
+#else
+  return simde_mm512_maskz_mov_epi64(k, simde_mm512_lzcnt_epi64(a));
+#endif
+}
+#if defined(SIMDE_AVX512CD_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_lzcnt_epi64(k, a) simde_mm512_maskz_lzcnt_epi64(k, a)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AVX512CD_H) */
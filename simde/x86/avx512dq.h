@@ -0,0 +1,1262 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__AVX512DQ_H)
+#  if !defined(SIMDE__AVX512DQ_H)
+#    define SIMDE__AVX512DQ_H
+#  endif
+#  include "avx512f.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AVX512DQ_NATIVE)
+#    undef SIMDE_AVX512DQ_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AVX512DQ) && !defined(SIMDE_AVX512DQ_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512DQ_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_AVX512DQ_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_AVX512DQ_NEON
+#  endif
+
+#  if defined(SIMDE_AVX512DQ_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#if !defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+  #define SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kand_mask8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kand_mask8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, a & b);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kand_mask8(a, b) simde_kand_mask8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kandn_mask8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kandn_mask8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, (~a & b) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kandn_mask8(a, b) simde_kandn_mask8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kor_mask8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kor_mask8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, a | b);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kor_mask8(a, b) simde_kor_mask8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kxnor_mask8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxnor_mask8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, (~(a ^ b)) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kxnor_mask8(a, b) simde_kxnor_mask8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kxor_mask8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxor_mask8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, a ^ b);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kxor_mask8(a, b) simde_kxor_mask8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_knot_mask8 (simde__mmask8 a) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _knot_mask8(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, ~a & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _knot_mask8(a) simde_knot_mask8(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kadd_mask8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kadd_mask8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, (a + b) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kadd_mask8(a, b) simde_kadd_mask8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestz_mask8_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kortestz_mask8_u8(a, b) simde_kortestz_mask8_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestc_mask8_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, ((a | b) & UINT8_C(0xff)) == UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kortestc_mask8_u8(a, b) simde_kortestc_mask8_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask8_u8 (simde__mmask8 a, simde__mmask8 b, unsigned char* all_ones) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortest_mask8_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask8_u8(a, b);
+    return simde_kortestz_mask8_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kortest_mask8_u8(a, b, all_ones) simde_kortest_mask8_u8(a, b, all_ones)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestz_mask8_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a & b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _ktestz_mask8_u8(a, b) simde_ktestz_mask8_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestc_mask8_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (~a & b & UINT8_C(0xff)) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _ktestc_mask8_u8(a, b) simde_ktestc_mask8_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask8_u8 (simde__mmask8 a, simde__mmask8 b, unsigned char* and_not) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktest_mask8_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask8_u8(a, b);
+    return simde_ktestz_mask8_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _ktest_mask8_u8(a, b, and_not) simde_ktest_mask8_u8(a, b, and_not)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kshiftli_mask8 (simde__mmask8 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 7) ? 0 : HEDLEY_STATIC_CAST(simde__mmask8, (a << count) & UINT8_C(0xff));
+}
+#if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftli_mask8(a, count) _kshiftli_mask8(a, count)
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kshiftli_mask8(a, count) simde_kshiftli_mask8(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_kshiftri_mask8 (simde__mmask8 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 7) ? 0 : HEDLEY_STATIC_CAST(simde__mmask8, a >> count);
+}
+#if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftri_mask8(a, count) _kshiftri_mask8(a, count)
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kshiftri_mask8(a, count) simde_kshiftri_mask8(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask8_u32 (simde__mmask8 a) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtmask8_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _cvtmask8_u32(a) simde_cvtmask8_u32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_cvtu32_mask8 (unsigned int a) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtu32_mask8(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, a & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _cvtu32_mask8(a) simde_cvtu32_mask8(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_load_mask8 (simde__mmask8* mem_addr) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _load_mask8(mem_addr);
+  #else
+    return *mem_addr;
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _load_mask8(mem_addr) simde_load_mask8(mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_store_mask8 (simde__mmask8* mem_addr, simde__mmask8 a) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    _store_mask8(mem_addr, a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _store_mask8(mem_addr, a) simde_store_mask8(mem_addr, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_kadd_mask16 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kadd_mask16(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, (a + b) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _kadd_mask16(a, b) simde_kadd_mask16(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestz_mask16_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a & b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _ktestz_mask16_u8(a, b) simde_ktestz_mask16_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktestc_mask16_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (~a & b & UINT16_C(0xffff)) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _ktestc_mask16_u8(a, b) simde_ktestc_mask16_u8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask16_u8 (simde__mmask16 a, simde__mmask16 b, unsigned char* and_not) {
+  #if defined(SIMDE_AVX512DQ_NATIVE) && defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _ktest_mask16_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask16_u8(a, b);
+    return simde_ktestz_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _ktest_mask16_u8(a, b, and_not) simde_ktest_mask16_u8(a, b, and_not)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_and_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_and_ps(a, b);
+#else
+  return simde_mm512_castsi512_ps(simde_mm512_and_si512(simde_mm512_castps_si512(a), simde_mm512_castps_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_and_ps(a, b) simde_mm512_and_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_and_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_and_pd(a, b);
+#else
+  return simde_mm512_castsi512_pd(simde_mm512_and_si512(simde_mm512_castpd_si512(a), simde_mm512_castpd_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_and_pd(a, b) simde_mm512_and_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_andnot_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_andnot_ps(a, b);
+#else
+  return simde_mm512_castsi512_ps(simde_mm512_andnot_si512(simde_mm512_castps_si512(a), simde_mm512_castps_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_andnot_ps(a, b) simde_mm512_andnot_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_andnot_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_andnot_pd(a, b);
+#else
+  return simde_mm512_castsi512_pd(simde_mm512_andnot_si512(simde_mm512_castpd_si512(a), simde_mm512_castpd_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_andnot_pd(a, b) simde_mm512_andnot_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_or_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_or_ps(a, b);
+#else
+  return simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_castps_si512(a), simde_mm512_castps_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_or_ps(a, b) simde_mm512_or_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_or_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_or_pd(a, b);
+#else
+  return simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_castpd_si512(a), simde_mm512_castpd_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_or_pd(a, b) simde_mm512_or_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_xor_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_xor_ps(a, b);
+#else
+  return simde_mm512_castsi512_ps(simde_mm512_xor_si512(simde_mm512_castps_si512(a), simde_mm512_castps_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_xor_ps(a, b) simde_mm512_xor_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_xor_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_xor_pd(a, b);
+#else
+  return simde_mm512_castsi512_pd(simde_mm512_xor_si512(simde_mm512_castpd_si512(a), simde_mm512_castpd_si512(b)));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_xor_pd(a, b) simde_mm512_xor_pd(a, b)
+#endif
+
+/* Each 64-bit integer is split into 32-bit halves which are dropped
+   into the mantissas of doubles with fixed exponents: the high half
+   lands in 2^84 + hi * 2^32 and the low half in 2^52 + lo.  Taking the
+   constants back out of the high part is exact, so the final addition
+   is the only operation which rounds and the result matches a direct
+   conversion.  For signed input the high half is biased by 2^31 first
+   so it can be treated as unsigned. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_cvtepi64_pd (simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvtepi64_pd(a);
+#else
+  simde__m512d_private r_;
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+  #if defined(SIMDE_AVX512DQ_NEON) && defined(SIMDE_ARCH_AARCH64)
+    for (size_t i = 0 ; i < (sizeof(r_.m128d_private) / sizeof(r_.m128d_private[0])) ; i++) {
+      r_.m128d_private[i].neon_f64 = vcvtq_f64_s64(a_.m128i_private[i].neon_i64);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    simde__m512d_private hi_, lo_;
+    hi_.u64 = ((a_.u64 >> 32) ^ UINT64_C(0x0000000080000000)) | UINT64_C(0x4530000000000000);
+    lo_.u64 = (a_.u64 & UINT64_C(0x00000000ffffffff)) | UINT64_C(0x4330000000000000);
+    /* 2^84 + 2^63 + 2^52 */
+    r_.f64 = (hi_.f64 - SIMDE_FLOAT64_C(19342822341709703277445120.0)) + lo_.f64;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = HEDLEY_STATIC_CAST(simde_float64, a_.i64[i]);
+    }
+  #endif
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi64_pd(a) simde_mm512_cvtepi64_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_cvtepi64_pd (simde__m512d src, simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_mask_cvtepi64_pd(src, k, a);
+#else
+  return simde_mm512_mask_mov_pd(src, k, simde_mm512_cvtepi64_pd(a));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvtepi64_pd(src, k, a) simde_mm512_mask_cvtepi64_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_cvtepi64_pd (simde__mmask8 k, simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_maskz_cvtepi64_pd(k, a);
+#else
+  return simde_mm512_maskz_mov_pd(k, simde_mm512_cvtepi64_pd(a));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvtepi64_pd(k, a) simde_mm512_maskz_cvtepi64_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_cvtepu64_pd (simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvtepu64_pd(a);
+#else
+  simde__m512d_private r_;
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+  #if defined(SIMDE_AVX512DQ_NEON) && defined(SIMDE_ARCH_AARCH64)
+    for (size_t i = 0 ; i < (sizeof(r_.m128d_private) / sizeof(r_.m128d_private[0])) ; i++) {
+      r_.m128d_private[i].neon_f64 = vcvtq_f64_u64(a_.m128i_private[i].neon_u64);
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    simde__m512d_private hi_, lo_;
+    hi_.u64 = (a_.u64 >> 32) | UINT64_C(0x4530000000000000);
+    lo_.u64 = (a_.u64 & UINT64_C(0x00000000ffffffff)) | UINT64_C(0x4330000000000000);
+    /* 2^84 + 2^52 */
+    r_.f64 = (hi_.f64 - SIMDE_FLOAT64_C(19342813118337666422669312.0)) + lo_.f64;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = HEDLEY_STATIC_CAST(simde_float64, a_.u64[i]);
+    }
+  #endif
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepu64_pd(a) simde_mm512_cvtepu64_pd(a)
+#endif
+
+/* Going through double first would round twice, so these are left to
+   the compiler's own conversion. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_cvtepi64_ps (simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvtepi64_ps(a);
+#else
+  simde__m256_private r_;
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+  #if defined(SIMDE__CONVERT_VECTOR)
+    SIMDE__CONVERT_VECTOR(r_.f32, a_.i64);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = HEDLEY_STATIC_CAST(simde_float32, a_.i64[i]);
+    }
+  #endif
+
+  return simde__m256_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi64_ps(a) simde_mm512_cvtepi64_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_cvtepu64_ps (simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvtepu64_ps(a);
+#else
+  simde__m256_private r_;
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+  #if defined(SIMDE__CONVERT_VECTOR)
+    SIMDE__CONVERT_VECTOR(r_.f32, a_.u64);
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = HEDLEY_STATIC_CAST(simde_float32, a_.u64[i]);
+    }
+  #endif
+
+  return simde__m256_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepu64_ps(a) simde_mm512_cvtepu64_ps(a)
+#endif
+
+/* There is no SSE or AVX2 instruction for this, so the conversion is
+   done on the bits instead: the mantissa (with the implicit bit) is
+   moved to the top of the element, then shifted right by however far
+   the exponent is below 2^63.  Anything which doesn't fit, including
+   infinities and NaN, becomes the "integer indefinite" value
+   (INT64_MIN), same as the hardware. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_cvttpd_epi64 (simde__m512d a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvttpd_epi64(a);
+#else
+  simde__m512i_private r_;
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    simde__m512i_private shift_, sign_, big_;
+
+    shift_.u64 = UINT64_C(1086) - ((a_.u64 >> 52) & UINT64_C(0x7ff));
+    sign_.i64 = a_.i64 >> 63;
+    big_.i64 = HEDLEY_STATIC_CAST(__typeof__(big_.i64), shift_.i64 <= 0);
+
+    r_.u64 = ((a_.u64 << 11) | UINT64_C(0x8000000000000000)) >> (shift_.u64 & 63);
+    r_.u64 &= HEDLEY_STATIC_CAST(__typeof__(r_.u64), shift_.u64 < 64);
+    r_.u64 = (r_.u64 ^ sign_.u64) - sign_.u64;
+    r_.u64 = (r_.u64 & ~big_.u64) | (big_.u64 & UINT64_C(0x8000000000000000));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      const simde_float64 v = a_.f64[i];
+      r_.i64[i] = (v >= SIMDE_FLOAT64_C(-9223372036854775808.0) && v < SIMDE_FLOAT64_C(9223372036854775808.0)) ?
+        HEDLEY_STATIC_CAST(int64_t, v) : INT64_MIN;
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvttpd_epi64(a) simde_mm512_cvttpd_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_cvttpd_epi64 (simde__m512i src, simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_mask_cvttpd_epi64(src, k, a);
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_cvttpd_epi64(a));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvttpd_epi64(src, k, a) simde_mm512_mask_cvttpd_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_cvttpd_epi64 (simde__mmask8 k, simde__m512d a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_maskz_cvttpd_epi64(k, a);
+#else
+  return simde_mm512_maskz_mov_epi64(k, simde_mm512_cvttpd_epi64(a));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvttpd_epi64(k, a) simde_mm512_maskz_cvttpd_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_cvttpd_epu64 (simde__m512d a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvttpd_epu64(a);
+#else
+  simde__m512i_private r_;
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    /* Same as simde_mm512_cvttpd_epi64, except that the indefinite
+       value is all ones and it is also used for anything <= -1. */
+    simde__m512i_private shift_, bad_;
+
+    shift_.u64 = UINT64_C(1086) - ((a_.u64 >> 52) & UINT64_C(0x7ff));
+    bad_.i64 =
+      HEDLEY_STATIC_CAST(__typeof__(bad_.i64), shift_.i64 < 0) |
+      (HEDLEY_STATIC_CAST(__typeof__(bad_.i64), a_.i64 < 0) & HEDLEY_STATIC_CAST(__typeof__(bad_.i64), shift_.i64 < 64));
+
+    r_.u64 = ((a_.u64 << 11) | UINT64_C(0x8000000000000000)) >> (shift_.u64 & 63);
+    r_.u64 &= HEDLEY_STATIC_CAST(__typeof__(r_.u64), shift_.u64 < 64);
+    r_.u64 |= bad_.u64;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      const simde_float64 v = a_.f64[i];
+      r_.u64[i] = (v > SIMDE_FLOAT64_C(-1.0) && v < SIMDE_FLOAT64_C(18446744073709551616.0)) ?
+        HEDLEY_STATIC_CAST(uint64_t, v) : UINT64_MAX;
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvttpd_epu64(a) simde_mm512_cvttpd_epu64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_cvtpd_epi64 (simde__m512d a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvtpd_epi64(a);
+#else
+  return simde_mm512_cvttpd_epi64(simde_mm512_roundscale_pd(a, SIMDE_MM_FROUND_CUR_DIRECTION));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtpd_epi64(a) simde_mm512_cvtpd_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_cvtpd_epu64 (simde__m512d a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_cvtpd_epu64(a);
+#else
+  return simde_mm512_cvttpd_epu64(simde_mm512_roundscale_pd(a, SIMDE_MM_FROUND_CUR_DIRECTION));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtpd_epu64(a) simde_mm512_cvtpd_epu64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_x_fpclass_f32 (uint32_t v, int imm8) {
+  const uint32_t e = v & UINT32_C(0x7f800000);
+  const uint32_t m = v & UINT32_C(0x007fffff);
+
+  return
+    (((imm8 & 0x01) != 0) && (e == UINT32_C(0x7f800000)) && ((m & UINT32_C(0x00400000)) != 0)) ||
+    (((imm8 & 0x02) != 0) && (v == UINT32_C(0x00000000))) ||
+    (((imm8 & 0x04) != 0) && (v == UINT32_C(0x80000000))) ||
+    (((imm8 & 0x08) != 0) && (v == UINT32_C(0x7f800000))) ||
+    (((imm8 & 0x10) != 0) && (v == UINT32_C(0xff800000))) ||
+    (((imm8 & 0x20) != 0) && (e == 0) && (m != 0)) ||
+    (((imm8 & 0x40) != 0) && (v > UINT32_C(0x80000000)) && (v < UINT32_C(0xff800000))) ||
+    (((imm8 & 0x80) != 0) && (e == UINT32_C(0x7f800000)) && (m != 0) && ((m & UINT32_C(0x00400000)) == 0));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_x_fpclass_f64 (uint64_t v, int imm8) {
+  const uint64_t e = v & UINT64_C(0x7ff0000000000000);
+  const uint64_t m = v & UINT64_C(0x000fffffffffffff);
+
+  return
+    (((imm8 & 0x01) != 0) && (e == UINT64_C(0x7ff0000000000000)) && ((m & UINT64_C(0x0008000000000000)) != 0)) ||
+    (((imm8 & 0x02) != 0) && (v == UINT64_C(0x0000000000000000))) ||
+    (((imm8 & 0x04) != 0) && (v == UINT64_C(0x8000000000000000))) ||
+    (((imm8 & 0x08) != 0) && (v == UINT64_C(0x7ff0000000000000))) ||
+    (((imm8 & 0x10) != 0) && (v == UINT64_C(0xfff0000000000000))) ||
+    (((imm8 & 0x20) != 0) && (e == 0) && (m != 0)) ||
+    (((imm8 & 0x40) != 0) && (v > UINT64_C(0x8000000000000000)) && (v < UINT64_C(0xfff0000000000000))) ||
+    (((imm8 & 0x80) != 0) && (e == UINT64_C(0x7ff0000000000000)) && (m != 0) && ((m & UINT64_C(0x0008000000000000)) == 0));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_fpclass_ps_mask (simde__m512 a, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512_private a_ = simde__m512_to_private(a);
+  simde__mmask16 r = 0;
+
+  for (size_t i = 0 ; i < (sizeof(a_.u32) / sizeof(a_.u32[0])) ; i++) {
+    r |= HEDLEY_STATIC_CAST(simde__mmask16, simde_x_fpclass_f32(a_.u32[i], imm8) << i);
+  }
+
+  return r;
+}
+#if defined(SIMDE_AVX512DQ_NATIVE)
+#  define simde_mm512_fpclass_ps_mask(a, imm8) _mm512_fpclass_ps_mask(a, imm8)
+#  define simde_mm512_mask_fpclass_ps_mask(k, a, imm8) _mm512_mask_fpclass_ps_mask(k, a, imm8)
+#else
+#  define simde_mm512_mask_fpclass_ps_mask(k, a, imm8) HEDLEY_STATIC_CAST(simde__mmask16, (k) & simde_mm512_fpclass_ps_mask(a, imm8))
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fpclass_ps_mask(a, imm8) simde_mm512_fpclass_ps_mask(a, imm8)
+#  define _mm512_mask_fpclass_ps_mask(k, a, imm8) simde_mm512_mask_fpclass_ps_mask(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_fpclass_pd_mask (simde__m512d a, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  simde__mmask8 r = 0;
+
+  for (size_t i = 0 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+    r |= HEDLEY_STATIC_CAST(simde__mmask8, simde_x_fpclass_f64(a_.u64[i], imm8) << i);
+  }
+
+  return r;
+}
+#if defined(SIMDE_AVX512DQ_NATIVE)
+#  define simde_mm512_fpclass_pd_mask(a, imm8) _mm512_fpclass_pd_mask(a, imm8)
+#  define simde_mm512_mask_fpclass_pd_mask(k, a, imm8) _mm512_mask_fpclass_pd_mask(k, a, imm8)
+#else
+#  define simde_mm512_mask_fpclass_pd_mask(k, a, imm8) HEDLEY_STATIC_CAST(simde__mmask8, (k) & simde_mm512_fpclass_pd_mask(a, imm8))
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fpclass_pd_mask(a, imm8) simde_mm512_fpclass_pd_mask(a, imm8)
+#  define _mm512_mask_fpclass_pd_mask(k, a, imm8) simde_mm512_mask_fpclass_pd_mask(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_movepi32_mask (simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_movepi32_mask(a);
+#else
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  simde__mmask16 r = 0;
+
+  #if defined(SIMDE_AVX512DQ_NEON) && defined(SIMDE_ARCH_AARCH64)
+    static const uint32_t md[4] = { 1, 2, 4, 8 };
+    const uint32x4_t weights = vld1q_u32(md);
+
+    for (size_t i = 0 ; i < (sizeof(a_.m128i_private) / sizeof(a_.m128i_private[0])) ; i++) {
+      const uint32x4_t m = vandq_u32(vreinterpretq_u32_s32(vshrq_n_s32(a_.m128i_private[i].neon_i32, 31)), weights);
+      r |= HEDLEY_STATIC_CAST(simde__mmask16, vaddvq_u32(m) << (i * 4));
+    }
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(a_.m256i) / sizeof(a_.m256i[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask16, simde_mm256_movemask_ps(simde_mm256_castsi256_ps(a_.m256i[i])) << (i * 8));
+    }
+  #elif defined(SIMDE_ARCH_X86_SSE2)
+    for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_movemask_ps(simde_mm_castsi128_ps(a_.m128i[i])) << (i * 4));
+    }
+  #else
+    for (size_t i = 0 ; i < (sizeof(a_.u32) / sizeof(a_.u32[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask16, (a_.u32[i] >> 31) << i);
+    }
+  #endif
+
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movepi32_mask(a) simde_mm512_movepi32_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_movepi64_mask (simde__m512i a) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_movepi64_mask(a);
+#else
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  simde__mmask8 r = 0;
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(a_.m256i) / sizeof(a_.m256i[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_movemask_pd(simde_mm256_castsi256_pd(a_.m256i[i])) << (i * 4));
+    }
+  #elif defined(SIMDE_ARCH_X86_SSE2)
+    for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_pd(simde_mm_castsi128_pd(a_.m128i[i])) << (i * 2));
+    }
+  #else
+    for (size_t i = 0 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, (a_.u64[i] >> 63) << i);
+    }
+  #endif
+
+  return r;
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movepi64_mask(a) simde_mm512_movepi64_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_movm_epi32 (simde__mmask16 k) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_movm_epi32(k);
+#else
+  return simde__m512i_from_mmask16(k);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movm_epi32(k) simde_mm512_movm_epi32(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_movm_epi64 (simde__mmask8 k) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_movm_epi64(k);
+#else
+  return simde__m512i_from_mmask8(k);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_movm_epi64(k) simde_mm512_movm_epi64(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mullo_epi64 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_mullo_epi64(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.u64 = a_.u64 * b_.u64;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = a_.u64[i] * b_.u64[i];
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mullo_epi64(a, b) simde_mm512_mullo_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mullo_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_mask_mullo_epi64(src, k, a, b);
+#else
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_mullo_epi64(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mullo_epi64(src, k, a, b) simde_mm512_mask_mullo_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mullo_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512DQ_NATIVE)
+  return _mm512_maskz_mullo_epi64(k, a, b);
+#else
+  return simde_mm512_maskz_mov_epi64(k, simde_mm512_mullo_epi64(a, b));
+#endif
+}
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mullo_epi64(k, a, b) simde_mm512_maskz_mullo_epi64(k, a, b)
+#endif
+
+/* VRANGEPS/VRANGEPD work on the bit patterns.  Flipping the magnitude
+   bits of negative values gives integers which order the same way as
+   the floats, with -0 < +0, which is what the hardware does.  A
+   signaling NaN in either operand is returned quieted; a quiet NaN is
+   ignored in favor of the other operand. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_range_f32 (uint32_t a, uint32_t b, int imm8) {
+  const uint32_t sign = UINT32_C(0x80000000);
+  const uint32_t aa = a & ~sign, ab = b & ~sign;
+  uint32_t r;
+
+  if (aa > UINT32_C(0x7f800000) || ab > UINT32_C(0x7f800000)) {
+    if (aa > UINT32_C(0x7f800000) && (a & UINT32_C(0x00400000)) == 0)
+      return a | UINT32_C(0x00400000);
+    if (ab > UINT32_C(0x7f800000) && (b & UINT32_C(0x00400000)) == 0)
+      return b | UINT32_C(0x00400000);
+    if (ab > UINT32_C(0x7f800000))
+      return a;
+    r = b;
+  } else {
+    const int32_t ka = HEDLEY_STATIC_CAST(int32_t, a ^ ((a & sign) ? ~sign : 0));
+    const int32_t kb = HEDLEY_STATIC_CAST(int32_t, b ^ ((b & sign) ? ~sign : 0));
+
+    switch (imm8 & 3) {
+      case 0:
+        r = (ka <= kb) ? a : b;
+        break;
+      case 1:
+        r = (ka >= kb) ? a : b;
+        break;
+      case 2:
+        r = (aa < ab || (aa == ab && ka <= kb)) ? a : b;
+        break;
+      default:
+        r = (aa > ab || (aa == ab && ka >= kb)) ? a : b;
+        break;
+    }
+  }
+
+  switch ((imm8 >> 2) & 3) {
+    case 0:
+      return (r & ~sign) | (a & sign);
+    case 1:
+      return r;
+    case 2:
+      return r & ~sign;
+    default:
+      return r | sign;
+  }
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_range_f64 (uint64_t a, uint64_t b, int imm8) {
+  const uint64_t sign = UINT64_C(0x8000000000000000);
+  const uint64_t aa = a & ~sign, ab = b & ~sign;
+  uint64_t r;
+
+  if (aa > UINT64_C(0x7ff0000000000000) || ab > UINT64_C(0x7ff0000000000000)) {
+    if (aa > UINT64_C(0x7ff0000000000000) && (a & UINT64_C(0x0008000000000000)) == 0)
+      return a | UINT64_C(0x0008000000000000);
+    if (ab > UINT64_C(0x7ff0000000000000) && (b & UINT64_C(0x0008000000000000)) == 0)
+      return b | UINT64_C(0x0008000000000000);
+    if (ab > UINT64_C(0x7ff0000000000000))
+      return a;
+    r = b;
+  } else {
+    const int64_t ka = HEDLEY_STATIC_CAST(int64_t, a ^ ((a & sign) ? ~sign : 0));
+    const int64_t kb = HEDLEY_STATIC_CAST(int64_t, b ^ ((b & sign) ? ~sign : 0));
+
+    switch (imm8 & 3) {
+      case 0:
+        r = (ka <= kb) ? a : b;
+        break;
+      case 1:
+        r = (ka >= kb) ? a : b;
+        break;
+      case 2:
+        r = (aa < ab || (aa == ab && ka <= kb)) ? a : b;
+        break;
+      default:
+        r = (aa > ab || (aa == ab && ka >= kb)) ? a : b;
+        break;
+    }
+  }
+
+  switch ((imm8 >> 2) & 3) {
+    case 0:
+      return (r & ~sign) | (a & sign);
+    case 1:
+      return r;
+    case 2:
+      return r & ~sign;
+    default:
+      return r | sign;
+  }
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_range_ps (simde__m512 a, simde__m512 b, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0x0f) == imm8, "imm8 must be in range [0, 15]") {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+    r_.u32[i] = simde_x_range_f32(a_.u32[i], b_.u32[i], imm8);
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512DQ_NATIVE)
+#  define simde_mm512_range_ps(a, b, imm8) _mm512_range_ps(a, b, imm8)
+#  define simde_mm512_mask_range_ps(src, k, a, b, imm8) _mm512_mask_range_ps(src, k, a, b, imm8)
+#  define simde_mm512_maskz_range_ps(k, a, b, imm8) _mm512_maskz_range_ps(k, a, b, imm8)
+#else
+#  define simde_mm512_mask_range_ps(src, k, a, b, imm8) simde_mm512_mask_mov_ps(src, k, simde_mm512_range_ps(a, b, imm8))
+#  define simde_mm512_maskz_range_ps(k, a, b, imm8) simde_mm512_maskz_mov_ps(k, simde_mm512_range_ps(a, b, imm8))
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_range_ps(a, b, imm8) simde_mm512_range_ps(a, b, imm8)
+#  define _mm512_mask_range_ps(src, k, a, b, imm8) simde_mm512_mask_range_ps(src, k, a, b, imm8)
+#  define _mm512_maskz_range_ps(k, a, b, imm8) simde_mm512_maskz_range_ps(k, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_range_pd (simde__m512d a, simde__m512d b, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0x0f) == imm8, "imm8 must be in range [0, 15]") {
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+    r_.u64[i] = simde_x_range_f64(a_.u64[i], b_.u64[i], imm8);
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512DQ_NATIVE)
+#  define simde_mm512_range_pd(a, b, imm8) _mm512_range_pd(a, b, imm8)
+#  define simde_mm512_mask_range_pd(src, k, a, b, imm8) _mm512_mask_range_pd(src, k, a, b, imm8)
+#  define simde_mm512_maskz_range_pd(k, a, b, imm8) _mm512_maskz_range_pd(k, a, b, imm8)
+#else
+#  define simde_mm512_mask_range_pd(src, k, a, b, imm8) simde_mm512_mask_mov_pd(src, k, simde_mm512_range_pd(a, b, imm8))
+#  define simde_mm512_maskz_range_pd(k, a, b, imm8) simde_mm512_maskz_mov_pd(k, simde_mm512_range_pd(a, b, imm8))
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_range_pd(a, b, imm8) simde_mm512_range_pd(a, b, imm8)
+#  define _mm512_mask_range_pd(src, k, a, b, imm8) simde_mm512_mask_range_pd(src, k, a, b, imm8)
+#  define _mm512_maskz_range_pd(k, a, b, imm8) simde_mm512_maskz_range_pd(k, a, b, imm8)
+#endif
+
+/* a - round(a * 2^M) / 2^M, where M is imm8[7:4].  The subtraction is
+   done on the scaled value, where it is exact.  Exact zeros come out
+   negative when rounding towards negative infinity, and infinities
+   reduce to +0. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_reduce_ps (simde__m512 a, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a);
+
+  const int m = imm8 >> 4;
+
+  #if defined(SIMDE_HAVE_MATH_H)
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      const simde_float32 v = ldexpf(a_.f32[i], m);
+      simde_float32 t;
+
+      if (v != v) {
+        r_.f32[i] = v;
+        continue;
+      } else if (fabsf(a_.f32[i]) == HUGE_VALF) {
+        r_.f32[i] = SIMDE_FLOAT32_C(0.0);
+        continue;
+      } else if (!(fabsf(v) < SIMDE_FLOAT32_C(8388608.0))) {
+        t = SIMDE_FLOAT32_C(0.0);
+      } else {
+        switch (imm8 & 7) {
+          case SIMDE_MM_FROUND_TO_NEG_INF:
+            t = ldexpf(v - floorf(v), -m);
+            break;
+          case SIMDE_MM_FROUND_TO_POS_INF:
+            t = ldexpf(v - ceilf(v), -m);
+            break;
+          case SIMDE_MM_FROUND_TO_ZERO:
+            t = ldexpf(v - truncf(v), -m);
+            break;
+          default:
+            t = ldexpf(v - nearbyintf(v), -m);
+            break;
+        }
+      }
+
+      r_.f32[i] = (t == SIMDE_FLOAT32_C(0.0) && (imm8 & 7) == SIMDE_MM_FROUND_TO_NEG_INF) ? -SIMDE_FLOAT32_C(0.0) : t;
+    }
+  #else
+    (void) m;
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512DQ_NATIVE)
+#  define simde_mm512_reduce_ps(a, imm8) _mm512_reduce_ps(a, imm8)
+#  define simde_mm512_mask_reduce_ps(src, k, a, imm8) _mm512_mask_reduce_ps(src, k, a, imm8)
+#  define simde_mm512_maskz_reduce_ps(k, a, imm8) _mm512_maskz_reduce_ps(k, a, imm8)
+#else
+#  define simde_mm512_mask_reduce_ps(src, k, a, imm8) simde_mm512_mask_mov_ps(src, k, simde_mm512_reduce_ps(a, imm8))
+#  define simde_mm512_maskz_reduce_ps(k, a, imm8) simde_mm512_maskz_mov_ps(k, simde_mm512_reduce_ps(a, imm8))
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_ps(a, imm8) simde_mm512_reduce_ps(a, imm8)
+#  define _mm512_mask_reduce_ps(src, k, a, imm8) simde_mm512_mask_reduce_ps(src, k, a, imm8)
+#  define _mm512_maskz_reduce_ps(k, a, imm8) simde_mm512_maskz_reduce_ps(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_reduce_pd (simde__m512d a, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a);
+
+  const int m = imm8 >> 4;
+
+  #if defined(SIMDE_HAVE_MATH_H)
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      const simde_float64 v = ldexp(a_.f64[i], m);
+      simde_float64 t;
+
+      if (v != v) {
+        r_.f64[i] = v;
+        continue;
+      } else if (fabs(a_.f64[i]) == HUGE_VAL) {
+        r_.f64[i] = SIMDE_FLOAT64_C(0.0);
+        continue;
+      } else if (!(fabs(v) < SIMDE_FLOAT64_C(4503599627370496.0))) {
+        t = SIMDE_FLOAT64_C(0.0);
+      } else {
+        switch (imm8 & 7) {
+          case SIMDE_MM_FROUND_TO_NEG_INF:
+            t = ldexp(v - floor(v), -m);
+            break;
+          case SIMDE_MM_FROUND_TO_POS_INF:
+            t = ldexp(v - ceil(v), -m);
+            break;
+          case SIMDE_MM_FROUND_TO_ZERO:
+            t = ldexp(v - trunc(v), -m);
+            break;
+          default:
+            t = ldexp(v - nearbyint(v), -m);
+            break;
+        }
+      }
+
+      r_.f64[i] = (t == SIMDE_FLOAT64_C(0.0) && (imm8 & 7) == SIMDE_MM_FROUND_TO_NEG_INF) ? -SIMDE_FLOAT64_C(0.0) : t;
+    }
+  #else
+    (void) m;
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512DQ_NATIVE)
+#  define simde_mm512_reduce_pd(a, imm8) _mm512_reduce_pd(a, imm8)
+#  define simde_mm512_mask_reduce_pd(src, k, a, imm8) _mm512_mask_reduce_pd(src, k, a, imm8)
+#  define simde_mm512_maskz_reduce_pd(k, a, imm8) _mm512_maskz_reduce_pd(k, a, imm8)
+#else
+#  define simde_mm512_mask_reduce_pd(src, k, a, imm8) simde_mm512_mask_mov_pd(src, k, simde_mm512_reduce_pd(a, imm8))
+#  define simde_mm512_maskz_reduce_pd(k, a, imm8) simde_mm512_maskz_mov_pd(k, simde_mm512_reduce_pd(a, imm8))
+#endif
+#if defined(SIMDE_AVX512DQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_pd(a, imm8) simde_mm512_reduce_pd(a, imm8)
+#  define _mm512_mask_reduce_pd(src, k, a, imm8) simde_mm512_mask_reduce_pd(src, k, a, imm8)
+#  define _mm512_maskz_reduce_pd(k, a, imm8) simde_mm512_maskz_reduce_pd(k, a, imm8)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AVX512DQ_H) */
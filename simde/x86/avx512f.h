@@ -27,6 +27,7 @@
 #    define SIMDE__AVX512F_H
 #  endif
 #  include "avx2.h"
+#  include "fma.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -66,6 +67,14 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 #    include <immintrin.h>
 #  endif
 
+/* The _k*_mask* intrinsics showed up well after the _mm512_k* ones
+   (GCC 7, clang 8); older compilers get the (scalar) fallbacks. */
+#  if defined(SIMDE_AVX512F_NATIVE) && \
+      (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0)) && \
+      (!defined(__clang__) || (__clang_major__ >= (defined(__apple_build_version__) ? 11 : 8)))
+#    define SIMDE_AVX512F_KMASK_NATIVE
+#  endif
+
 #  if defined(SIMDE_AVX512F_POWER_ALTIVEC)
 #    include <altivec.h>
 #  endif
@@ -278,6 +287,54 @@ typedef union {
   typedef simde__m512d __m512d;
 #endif
 
+#define SIMDE_MM_CMPINT_EQ     0
+#define SIMDE_MM_CMPINT_LT     1
+#define SIMDE_MM_CMPINT_LE     2
+#define SIMDE_MM_CMPINT_FALSE  3
+#define SIMDE_MM_CMPINT_NE     4
+#define SIMDE_MM_CMPINT_NLT    5
+#define SIMDE_MM_CMPINT_NLE    6
+#define SIMDE_MM_CMPINT_TRUE   7
+
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES) && !defined(_MM_CMPINT_EQ)
+#define _MM_CMPINT_EQ SIMDE_MM_CMPINT_EQ
+#define _MM_CMPINT_LT SIMDE_MM_CMPINT_LT
+#define _MM_CMPINT_LE SIMDE_MM_CMPINT_LE
+#define _MM_CMPINT_FALSE SIMDE_MM_CMPINT_FALSE
+#define _MM_CMPINT_NE SIMDE_MM_CMPINT_NE
+#define _MM_CMPINT_NLT SIMDE_MM_CMPINT_NLT
+#define _MM_CMPINT_NLE SIMDE_MM_CMPINT_NLE
+#define _MM_CMPINT_TRUE SIMDE_MM_CMPINT_TRUE
+#endif
+
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define SIMDE_MM_MANT_NORM_1_2     _MM_MANT_NORM_1_2
+#  define SIMDE_MM_MANT_NORM_p5_2    _MM_MANT_NORM_p5_2
+#  define SIMDE_MM_MANT_NORM_p5_1    _MM_MANT_NORM_p5_1
+#  define SIMDE_MM_MANT_NORM_p75_1p5 _MM_MANT_NORM_p75_1p5
+#  define SIMDE_MM_MANT_SIGN_src     _MM_MANT_SIGN_src
+#  define SIMDE_MM_MANT_SIGN_zero    _MM_MANT_SIGN_zero
+#  define SIMDE_MM_MANT_SIGN_nan     _MM_MANT_SIGN_nan
+#else
+#  define SIMDE_MM_MANT_NORM_1_2     0
+#  define SIMDE_MM_MANT_NORM_p5_2    1
+#  define SIMDE_MM_MANT_NORM_p5_1    2
+#  define SIMDE_MM_MANT_NORM_p75_1p5 3
+#  define SIMDE_MM_MANT_SIGN_src     0
+#  define SIMDE_MM_MANT_SIGN_zero    1
+#  define SIMDE_MM_MANT_SIGN_nan     2
+#endif
+
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#define _MM_MANT_NORM_1_2 SIMDE_MM_MANT_NORM_1_2
+#define _MM_MANT_NORM_p5_2 SIMDE_MM_MANT_NORM_p5_2
+#define _MM_MANT_NORM_p5_1 SIMDE_MM_MANT_NORM_p5_1
+#define _MM_MANT_NORM_p75_1p5 SIMDE_MM_MANT_NORM_p75_1p5
+#define _MM_MANT_SIGN_src SIMDE_MM_MANT_SIGN_src
+#define _MM_MANT_SIGN_zero SIMDE_MM_MANT_SIGN_zero
+#define _MM_MANT_SIGN_nan SIMDE_MM_MANT_SIGN_nan
+#endif
+
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512), "simde__m512 size incorrect");
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512_private), "simde__m512_private size incorrect");
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512i), "simde__m512i size incorrect");
@@ -1595,99 +1652,87 @@ simde_mm512_setone_pd(void) {
   return simde_mm512_castsi512_pd(simde_mm512_setone_si512());
 }
 
+/* Expand a mask register to a vector where each element is either all
+   ones (bit set) or all zeros (bit clear).  The masked operations are
+   implemented as a bitwise blend with this vector, which lets the
+   compiler keep everything in vector registers instead of testing the
+   bits of the mask one element at a time.
+
+   This is done in 256- or 128-bit pieces instead of with 512-bit
+   vector extensions since compilers tend to scalarize comparisons on
+   vectors wider than the hardware supports. */
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_srli_epi64 (simde__m512i a, unsigned int imm8) {
+simde__m512i_from_mmask16 (simde__mmask16 k) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_srli_epi64(a, imm8);
+    /* Should never be reached. */
+    return _mm512_mask_mov_epi32(_mm512_setzero_epi32(), k, _mm512_set1_epi32(~INT32_C(0)));
   #else
-    simde__m512i_private
-      r_,
-      a_ = simde__m512i_to_private(a);
+    simde__m512i_private r_;
 
     #if defined(SIMDE_ARCH_X86_AVX2)
-      r_.m256i[0] = simde_mm256_srli_epi64(a_.m256i[0], imm8);
-      r_.m256i[1] = simde_mm256_srli_epi64(a_.m256i[1], imm8);
-    #elif defined(SIMDE_ARCH_X86_SSE2)
-      r_.m128i[0] = simde_mm_srli_epi64(a_.m128i[0], imm8);
-      r_.m128i[1] = simde_mm_srli_epi64(a_.m128i[1], imm8);
-      r_.m128i[2] = simde_mm_srli_epi64(a_.m128i[2], imm8);
-      r_.m128i[3] = simde_mm_srli_epi64(a_.m128i[3], imm8);
+      const simde__m256i bits = simde_mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+      r_.m256i[0] = simde_mm256_cmpeq_epi32(simde_mm256_and_si256(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k     )), bits), bits);
+      r_.m256i[1] = simde_mm256_cmpeq_epi32(simde_mm256_and_si256(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k >> 8)), bits), bits);
     #else
-      /* The Intel Intrinsics Guide says that only the 8 LSBits of imm8 are
-      * used.  In this case we should do "imm8 &= 0xff" here.  However in
-      * practice all bits are used. */
-      if (imm8 > 63) {
-        simde_memset(&r_, 0, sizeof(r_));
-      } else {
-        #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
-          r_.u64 = a_.u64 >> imm8;
-        #else
-          SIMDE__VECTORIZE
-          for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
-            r_.u64[i] = a_.u64[i] >> imm8;
-          }
-        #endif
+      const simde__m128i bits = simde_mm_set_epi32(8, 4, 2, 1);
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        const simde__m128i kv = simde_mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k >> (i * 4)));
+        r_.m128i[i] = simde_mm_cmpeq_epi32(simde_mm_and_si128(kv, bits), bits);
       }
     #endif
 
     return simde__m512i_from_private(r_);
   #endif
 }
-#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_srli_epi64(a, imm8) simde_mm512_srli_epi64(a, imm8)
-#endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_xor_si512 (simde__m512i a, simde__m512i b) {
+simde__m512i_from_mmask8 (simde__mmask8 k) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_xor_si512(a, b);
+    /* Should never be reached. */
+    return _mm512_mask_mov_epi64(_mm512_setzero_epi32(), k, _mm512_set1_epi64(~INT64_C(0)));
   #else
-    simde__m512i_private
-      r_,
-      a_ = simde__m512i_to_private(a),
-      b_ = simde__m512i_to_private(b);
+    simde__m512i_private r_;
 
-  #if defined(SIMDE_ARCH_X86_AVX2)
-    r_.m256i[0] = simde_mm256_xor_si256(a_.m256i[0], b_.m256i[0]);
-    r_.m256i[1] = simde_mm256_xor_si256(a_.m256i[1], b_.m256i[1]);
-  #elif defined(SIMDE_ARCH_X86_SSE2)
-    r_.m128i[0] = simde_mm_xor_si128(a_.m128i[0], b_.m128i[0]);
-    r_.m128i[1] = simde_mm_xor_si128(a_.m128i[1], b_.m128i[1]);
-    r_.m128i[2] = simde_mm_xor_si128(a_.m128i[2], b_.m128i[2]);
-    r_.m128i[3] = simde_mm_xor_si128(a_.m128i[3], b_.m128i[3]);
-  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-    r_.i32f = a_.i32f ^ b_.i32f;
-  #else
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
-      r_.i32f[i] = a_.i32f[i] ^ b_.i32f[i];
-    }
-  #endif
+    /* Each bit is tested in both halves of the 64-bit element so we
+       only need a 32-bit comparison. */
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i bits = simde_mm256_set_epi32(8, 8, 4, 4, 2, 2, 1, 1);
+      r_.m256i[0] = simde_mm256_cmpeq_epi32(simde_mm256_and_si256(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k     )), bits), bits);
+      r_.m256i[1] = simde_mm256_cmpeq_epi32(simde_mm256_and_si256(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k >> 4)), bits), bits);
+    #else
+      const simde__m128i bits = simde_mm_set_epi32(2, 2, 1, 1);
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        const simde__m128i kv = simde_mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k >> (i * 2)));
+        r_.m128i[i] = simde_mm_cmpeq_epi32(simde_mm_and_si128(kv, bits), bits);
+      }
+    #endif
 
-  return simde__m512i_from_private(r_);
-#endif
+    return simde__m512i_from_private(r_);
+  #endif
 }
-#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_xor_si512(a, b) simde_mm512_xor_si512(a, b)
-#endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_mask_mov_epi32(simde__m512i src, simde__mmask16 k, simde__m512i a) {
+simde_mm512_mask_mov_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_mask_mov_epi32(src, k, a);
   #else
     simde__m512i_private
       src_ = simde__m512i_to_private(src),
       a_ = simde__m512i_to_private(a),
+      mask_ = simde__m512i_to_private(simde__m512i_from_mmask16(k)),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-      r_.i32[i] = ((k >> i) & 1) ? a_.i32[i] : src_.i32[i];
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = (a_.i32f & mask_.i32f) | (src_.i32f & ~mask_.i32f);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = (a_.i32f[i] & mask_.i32f[i]) | (src_.i32f[i] & ~mask_.i32f[i]);
+      }
+    #endif
 
     return simde__m512i_from_private(r_);
   #endif
@@ -1698,19 +1743,24 @@ simde_mm512_mask_mov_epi32(simde__m512i src, simde__mmask16 k, simde__m512i a) {
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_mask_mov_epi64(simde__m512i src, simde__mmask8 k, simde__m512i a) {
+simde_mm512_mask_mov_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_mask_mov_epi64(src, k, a);
   #else
     simde__m512i_private
       src_ = simde__m512i_to_private(src),
       a_ = simde__m512i_to_private(a),
+      mask_ = simde__m512i_to_private(simde__m512i_from_mmask8(k)),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-      r_.i64[i] = ((k >> i) & 1) ? a_.i64[i] : src_.i64[i];
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = (a_.i32f & mask_.i32f) | (src_.i32f & ~mask_.i32f);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = (a_.i32f[i] & mask_.i32f[i]) | (src_.i32f[i] & ~mask_.i32f[i]);
+      }
+    #endif
 
     return simde__m512i_from_private(r_);
   #endif
@@ -1721,19 +1771,24 @@ simde_mm512_mask_mov_epi64(simde__m512i src, simde__mmask8 k, simde__m512i a) {
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_mask_mov_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
+simde_mm512_mask_mov_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_mask_mov_ps(src, k, a);
   #else
     simde__m512_private
       src_ = simde__m512_to_private(src),
       a_ = simde__m512_to_private(a),
+      mask_ = simde__m512_to_private(simde_mm512_castsi512_ps(simde__m512i_from_mmask16(k))),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = ((k >> i) & 1) ? a_.f32[i] : src_.f32[i];
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = (a_.i32f & mask_.i32f) | (src_.i32f & ~mask_.i32f);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = (a_.i32f[i] & mask_.i32f[i]) | (src_.i32f[i] & ~mask_.i32f[i]);
+      }
+    #endif
 
     return simde__m512_from_private(r_);
   #endif
@@ -1744,19 +1799,24 @@ simde_mm512_mask_mov_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_mask_mov_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
+simde_mm512_mask_mov_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_mask_mov_pd(src, k, a);
   #else
     simde__m512d_private
       src_ = simde__m512d_to_private(src),
       a_ = simde__m512d_to_private(a),
+      mask_ = simde__m512d_to_private(simde_mm512_castsi512_pd(simde__m512i_from_mmask8(k))),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = ((k >> i) & 1) ? a_.f64[i] : src_.f64[i];
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = (a_.i32f & mask_.i32f) | (src_.i32f & ~mask_.i32f);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = (a_.i32f[i] & mask_.i32f[i]) | (src_.i32f[i] & ~mask_.i32f[i]);
+      }
+    #endif
 
     return simde__m512d_from_private(r_);
   #endif
@@ -1767,18 +1827,23 @@ simde_mm512_mask_mov_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_maskz_mov_epi32(simde__mmask16 k, simde__m512i a) {
+simde_mm512_maskz_mov_epi32 (simde__mmask16 k, simde__m512i a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_maskz_mov_epi32(k, a);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
+      mask_ = simde__m512i_to_private(simde__m512i_from_mmask16(k)),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-      r_.i32[i] = ((k >> i) & 1) ? a_.i32[i] : INT32_C(0);
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = a_.i32f & mask_.i32f;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = a_.i32f[i] & mask_.i32f[i];
+      }
+    #endif
 
     return simde__m512i_from_private(r_);
   #endif
@@ -1789,18 +1854,23 @@ simde_mm512_maskz_mov_epi32(simde__mmask16 k, simde__m512i a) {
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_maskz_mov_epi64(simde__mmask8 k, simde__m512i a) {
+simde_mm512_maskz_mov_epi64 (simde__mmask8 k, simde__m512i a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_maskz_mov_epi64(k, a);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
+      mask_ = simde__m512i_to_private(simde__m512i_from_mmask8(k)),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-      r_.i64[i] = ((k >> i) & 1) ? a_.i64[i] : INT64_C(0);
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = a_.i32f & mask_.i32f;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = a_.i32f[i] & mask_.i32f[i];
+      }
+    #endif
 
     return simde__m512i_from_private(r_);
   #endif
@@ -1811,18 +1881,23 @@ simde_mm512_maskz_mov_epi64(simde__mmask8 k, simde__m512i a) {
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_maskz_mov_ps(simde__mmask16 k, simde__m512 a) {
+simde_mm512_maskz_mov_ps (simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_maskz_mov_ps(k, a);
   #else
     simde__m512_private
       a_ = simde__m512_to_private(a),
+      mask_ = simde__m512_to_private(simde_mm512_castsi512_ps(simde__m512i_from_mmask16(k))),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = ((k >> i) & 1) ? a_.f32[i] : SIMDE_FLOAT32_C(0.0);
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = a_.i32f & mask_.i32f;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = a_.i32f[i] & mask_.i32f[i];
+      }
+    #endif
 
     return simde__m512_from_private(r_);
   #endif
@@ -1833,18 +1908,23 @@ simde_mm512_maskz_mov_ps(simde__mmask16 k, simde__m512 a) {
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_maskz_mov_pd(simde__mmask8 k, simde__m512d a) {
+simde_mm512_maskz_mov_pd (simde__mmask8 k, simde__m512d a) {
   #if defined(SIMDE_AVX512F_NATIVE)
     return _mm512_maskz_mov_pd(k, a);
   #else
     simde__m512d_private
       a_ = simde__m512d_to_private(a),
+      mask_ = simde__m512d_to_private(simde_mm512_castsi512_pd(simde__m512i_from_mmask8(k))),
       r_;
 
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = ((k >> i) & 1) ? a_.f64[i] : SIMDE_FLOAT64_C(0.0);
-    }
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32f = a_.i32f & mask_.i32f;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+        r_.i32f[i] = a_.i32f[i] & mask_.i32f[i];
+      }
+    #endif
 
     return simde__m512d_from_private(r_);
   #endif
@@ -1854,759 +1934,12040 @@ simde_mm512_maskz_mov_pd(simde__mmask8 k, simde__m512d a) {
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__mmask16
-simde_mm512_mask_test_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
-  #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_mask_test_epi32_mask(k1, a, b);
+unsigned int
+simde_x_popcount_u32 (uint32_t v) {
+  #if HEDLEY_GNUC_HAS_BUILTIN(__builtin_popcount,3,4,0)
+    return HEDLEY_STATIC_CAST(unsigned int, __builtin_popcount(v));
   #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a),
-      b_ = simde__m512i_to_private(b);
-    simde__mmask16 r = 0;
-
-    SIMDE__VECTORIZE_REDUCTION(|:r)
-    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-      r |= !!(a_.i32[i] & b_.i32[i]) << i;
-    }
-
-    return r & k1;
+    v = v - ((v >> 1) & UINT32_C(0x55555555));
+    v = (v & UINT32_C(0x33333333)) + ((v >> 2) & UINT32_C(0x33333333));
+    v = (v + (v >> 4)) & UINT32_C(0x0F0F0F0F);
+    return HEDLEY_STATIC_CAST(unsigned int, (v * UINT32_C(0x01010101)) >> 24);
   #endif
 }
-#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_mask_test_epi32_mask(a, b) simde_mm512_mask_test_epi32_mask(a, b)
-#endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512i
-simde__m512i_from_mmask16 (simde__mmask16 k) {
-  #if defined(SIMDE_AVX512F_NATIVE)
-    /* Should never be reached. */
-    return _mm512_mask_mov_epi32(_mm512_setzero_epi32(), k, _mm512_set1_epi32(~INT32_C(0)));
+unsigned int
+simde_x_popcount_u64 (uint64_t v) {
+  #if HEDLEY_GNUC_HAS_BUILTIN(__builtin_popcountll,3,4,0)
+    return HEDLEY_STATIC_CAST(unsigned int, __builtin_popcountll(HEDLEY_STATIC_CAST(unsigned long long, v)));
   #else
-    simde__m512i_private r_;
-
-    SIMDE__VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-      r_.i32[i] = (k & (1 << i)) ? ~INT32_C(0) : INT32_C(0);
-    }
-
-    return simde__m512i_from_private(r_);
+    return
+      simde_x_popcount_u32(HEDLEY_STATIC_CAST(uint32_t, v)) +
+      simde_x_popcount_u32(HEDLEY_STATIC_CAST(uint32_t, v >> 32));
   #endif
 }
 
+/* Number of trailing zero bits, or the width of the type if v is 0
+   (like TZCNT), so it can be used directly to walk the set bits of a
+   mask without a separate check for an empty mask. */
 SIMDE__FUNCTION_ATTRIBUTES
-simde__mmask16
-simde__m512i_private_to_mmask16 (simde__m512i_private a) {
-  #if defined(SIMDE_AVX512F_NATIVE)
-    HEDLEY_UNREACHABLE_RETURN(0);
+unsigned int
+simde_x_tzcnt_u32 (uint32_t v) {
+  #if HEDLEY_GNUC_HAS_BUILTIN(__builtin_ctz,3,4,0)
+    return (v == 0) ? 32 : HEDLEY_STATIC_CAST(unsigned int, __builtin_ctz(v));
   #else
-    simde__mmask16 r = 0;
-
-    /* Note: using addition instead of a bitwise or for the reduction
-       seems like it should improve things since hardware support for
-       horizontal addition is better than bitwise or.  However, GCC
-       generates the same code, and clang is actually a bit slower.
-       I suspect this can be optimized quite a bit, and this function
-       is probably going to be pretty hot. */
-    SIMDE__VECTORIZE_REDUCTION(|:r)
-    for (size_t i = 0 ; i < (sizeof(a.i32) / sizeof(a.i32[0])) ; i++) {
-      r |= !!(a.i32[i]) << i;
-    }
-
-    return r;
+    static const uint8_t debruijn[32] = {
+       0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+      31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+    };
+    if (v == 0)
+      return 32;
+    return debruijn[((v & (~v + 1)) * UINT32_C(0x077CB531)) >> 27];
   #endif
 }
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__mmask8
-simde__m512i_private_to_mmask8 (simde__m512i_private a) {
-  #if defined(SIMDE_AVX512F_NATIVE)
-    HEDLEY_UNREACHABLE_RETURN(0);
+unsigned int
+simde_x_tzcnt_u64 (uint64_t v) {
+  #if HEDLEY_GNUC_HAS_BUILTIN(__builtin_ctzll,3,4,0)
+    return (v == 0) ? 64 : HEDLEY_STATIC_CAST(unsigned int, __builtin_ctzll(HEDLEY_STATIC_CAST(unsigned long long, v)));
   #else
-    simde__mmask8 r = 0;
-    SIMDE__VECTORIZE_REDUCTION(|:r)
-    for (size_t i = 0 ; i < (sizeof(a.i64) / sizeof(a.i64[0])) ; i++) {
-      r |= !!(a.i64[i]) << i;
-    }
-
-    return r;
+    const uint32_t lo = HEDLEY_STATIC_CAST(uint32_t, v);
+    return (lo != 0) ? simde_x_tzcnt_u32(lo) : (32 + simde_x_tzcnt_u32(HEDLEY_STATIC_CAST(uint32_t, v >> 32)));
   #endif
 }
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512i
-simde_mm512_and_si512 (simde__m512i a, simde__m512i b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_and_si512(a, b);
-#else
-  simde__m512i_private
-    r_,
-    a_ = simde__m512i_to_private(a),
-    b_ = simde__m512i_to_private(b);
-
-#if defined(SIMDE_ARCH_X86_AVX2)
-  r_.m256i[0] = simde_mm256_and_si256(a_.m256i[0], b_.m256i[0]);
-  r_.m256i[1] = simde_mm256_and_si256(a_.m256i[1], b_.m256i[1]);
-#elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.i32f = a_.i32f & b_.i32f;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-    r_.i32[i] = a_.i32[i] & b_.i32[i];
-  }
-#endif
-
-  return simde__m512i_from_private(r_);
-#endif
+simde__mmask16
+simde_kand_mask16 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kand_mask16(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, a & b);
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_and_si512(a, b) simde_mm512_and_si512(a, b)
+#  define _kand_mask16(a, b) simde_kand_mask16(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512i
-simde_mm512_andnot_si512 (simde__m512i a, simde__m512i b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_andnot_si512(a, b);
-#else
-  simde__m512i_private
-    r_,
-    a_ = simde__m512i_to_private(a),
-    b_ = simde__m512i_to_private(b);
-
-#if defined(SIMDE_ARCH_X86_AVX2)
-  r_.m256i[0] = simde_mm256_andnot_si256(a_.m256i[0], b_.m256i[0]);
-  r_.m256i[1] = simde_mm256_andnot_si256(a_.m256i[1], b_.m256i[1]);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
-    r_.i32f[i] = ~(a_.i32f[i]) & b_.i32f[i];
-  }
+simde__mmask16
+simde_kandn_mask16 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kandn_mask16(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, (~a & b) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _kandn_mask16(a, b) simde_kandn_mask16(a, b)
 #endif
 
-  return simde__m512i_from_private(r_);
-#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_kor_mask16 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kor_mask16(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, a | b);
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_andnot_si512(a, b) simde_mm512_andnot_si512(a, b)
+#  define _kor_mask16(a, b) simde_kor_mask16(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512i
-simde_mm512_add_epi32 (simde__m512i a, simde__m512i b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_add_epi32(a, b);
-#else
-  simde__m512i_private
-    r_,
-    a_ = simde__m512i_to_private(a),
-    b_ = simde__m512i_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.i32 = a_.i32 + b_.i32;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-    r_.m256i[i] = simde_mm256_add_epi32(a_.m256i[i], b_.m256i[i]);
-  }
-#endif
-
-  return simde__m512i_from_private(r_);
-#endif
+simde__mmask16
+simde_kxnor_mask16 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxnor_mask16(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, (~(a ^ b)) & UINT16_C(0xffff));
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_add_epi32(a, b) simde_mm512_add_epi32(a, b)
+#  define _kxnor_mask16(a, b) simde_kxnor_mask16(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512i
-simde_mm512_add_epi64 (simde__m512i a, simde__m512i b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_add_epi64(a, b);
-#else
-  simde__m512i_private
-    r_,
-    a_ = simde__m512i_to_private(a),
-    b_ = simde__m512i_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.i64 = a_.i64 + b_.i64;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-    r_.m256i[i] = simde_mm256_add_epi64(a_.m256i[i], b_.m256i[i]);
-  }
-#endif
-
-  return simde__m512i_from_private(r_);
-#endif
+simde__mmask16
+simde_kxor_mask16 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kxor_mask16(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, a ^ b);
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_add_epi64(a, b) simde_mm512_add_epi64(a, b)
+#  define _kxor_mask16(a, b) simde_kxor_mask16(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512
-simde_mm512_add_ps (simde__m512 a, simde__m512 b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_add_ps(a, b);
-#else
-  simde__m512_private
-    r_,
-    a_ = simde__m512_to_private(a),
-    b_ = simde__m512_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f32 = a_.f32 + b_.f32;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
-    r_.m256[i] = simde_mm256_add_ps(a_.m256[i], b_.m256[i]);
-  }
-#endif
-
-  return simde__m512_from_private(r_);
-#endif
+simde__mmask16
+simde_knot_mask16 (simde__mmask16 a) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _knot_mask16(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ~a & UINT16_C(0xffff));
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_add_ps(a, b) simde_mm512_add_ps(a, b)
+#  define _knot_mask16(a) simde_knot_mask16(a)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512d
-simde_mm512_add_pd (simde__m512d a, simde__m512d b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_add_pd(a, b);
-#else
-  simde__m512d_private
-    r_,
-    a_ = simde__m512d_to_private(a),
-    b_ = simde__m512d_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f64 = a_.f64 + b_.f64;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-    r_.m256d[i] = simde_mm256_add_pd(a_.m256d[i], b_.m256d[i]);
-  }
+unsigned char
+simde_kortestz_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestz_mask16_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _kortestz_mask16_u8(a, b) simde_kortestz_mask16_u8(a, b)
 #endif
 
-  return simde__m512d_from_private(r_);
-#endif
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortestc_mask16_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, ((a | b) & UINT16_C(0xffff)) == UINT16_C(0xffff));
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_add_pd(a, b) simde_mm512_add_pd(a, b)
+#  define _kortestc_mask16_u8(a, b) simde_kortestc_mask16_u8(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512i
-simde_mm512_sub_epi32 (simde__m512i a, simde__m512i b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_sub_epi32(a, b);
-#else
-  simde__m512i_private
-    r_,
-    a_ = simde__m512i_to_private(a),
-    b_ = simde__m512i_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.i32 = a_.i32 - b_.i32;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-    r_.m256i[i] = simde_mm256_sub_epi32(a_.m256i[i], b_.m256i[i]);
-  }
+unsigned char
+simde_kortest_mask16_u8 (simde__mmask16 a, simde__mmask16 b, unsigned char* all_ones) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _kortest_mask16_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask16_u8(a, b);
+    return simde_kortestz_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _kortest_mask16_u8(a, b, all_ones) simde_kortest_mask16_u8(a, b, all_ones)
 #endif
 
-  return simde__m512i_from_private(r_);
-#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_kshiftli_mask16 (simde__mmask16 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 15) ? 0 : HEDLEY_STATIC_CAST(simde__mmask16, (a << count) & UINT16_C(0xffff));
 }
+#if defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftli_mask16(a, count) _kshiftli_mask16(a, count)
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_sub_epi32(a, b) simde_mm512_sub_epi32(a, b)
+#  define _kshiftli_mask16(a, count) simde_kshiftli_mask16(a, count)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512i
-simde_mm512_sub_epi64 (simde__m512i a, simde__m512i b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_sub_epi64(a, b);
-#else
-  simde__m512i_private
-    r_,
-    a_ = simde__m512i_to_private(a),
-    b_ = simde__m512i_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.i64 = a_.i64 - b_.i64;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-    r_.m256i[i] = simde_mm256_sub_epi64(a_.m256i[i], b_.m256i[i]);
-  }
+simde__mmask16
+simde_kshiftri_mask16 (simde__mmask16 a, unsigned int count)
+    HEDLEY_REQUIRE_MSG((count & 0xff) == count, "count must be in range [0, 255]") {
+  return (count > 15) ? 0 : HEDLEY_STATIC_CAST(simde__mmask16, a >> count);
+}
+#if defined(SIMDE_AVX512F_KMASK_NATIVE)
+#  define simde_kshiftri_mask16(a, count) _kshiftri_mask16(a, count)
 #endif
-
-  return simde__m512i_from_private(r_);
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _kshiftri_mask16(a, count) simde_kshiftri_mask16(a, count)
 #endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask16_u32 (simde__mmask16 a) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtmask16_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_sub_epi64(a, b) simde_mm512_sub_epi64(a, b)
+#  define _cvtmask16_u32(a) simde_cvtmask16_u32(a)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512
-simde_mm512_sub_ps (simde__m512 a, simde__m512 b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_sub_ps(a, b);
-#else
-  simde__m512_private
-    r_,
-    a_ = simde__m512_to_private(a),
-    b_ = simde__m512_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f32 = a_.f32 - b_.f32;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
-    r_.m256[i] = simde_mm256_sub_ps(a_.m256[i], b_.m256[i]);
-  }
+simde__mmask16
+simde_cvtu32_mask16 (unsigned int a) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _cvtu32_mask16(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, a & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _cvtu32_mask16(a) simde_cvtu32_mask16(a)
 #endif
 
-  return simde__m512_from_private(r_);
-#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_load_mask16 (simde__mmask16* mem_addr) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    return _load_mask16(mem_addr);
+  #else
+    return *mem_addr;
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_sub_ps(a, b) simde_mm512_sub_ps(a, b)
+#  define _load_mask16(mem_addr) simde_load_mask16(mem_addr)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m512d
-simde_mm512_sub_pd (simde__m512d a, simde__m512d b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_sub_pd(a, b);
-#else
-  simde__m512d_private
-    r_,
-    a_ = simde__m512d_to_private(a),
-    b_ = simde__m512d_to_private(b);
-
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f64 = a_.f64 - b_.f64;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-    r_.m256d[i] = simde_mm256_sub_pd(a_.m256d[i], b_.m256d[i]);
-  }
+void
+simde_store_mask16 (simde__mmask16* mem_addr, simde__mmask16 a) {
+  #if defined(SIMDE_AVX512F_KMASK_NATIVE)
+    _store_mask16(mem_addr, a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _store_mask16(mem_addr, a) simde_store_mask16(mem_addr, a)
 #endif
 
-  return simde__m512d_from_private(r_);
-#endif
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kand (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_kand(a, b);
+  #else
+    return simde_kand_mask16(a, b);
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_sub_pd(a, b) simde_mm512_sub_pd(a, b)
+#  define _mm512_kand(a, b) simde_mm512_kand(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__mmask16
-simde_mm512_cmpeq_epi32_mask (simde__m512i a, simde__m512i b) {
+simde_mm512_kandn (simde__mmask16 a, simde__mmask16 b) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_cmpeq_epi32_mask(a, b);
+    return _mm512_kandn(a, b);
   #else
-    simde__m512i_private
-      r_,
-      a_ = simde__m512i_to_private(a),
-      b_ = simde__m512i_to_private(b);
-
-    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-      r_.m256i[i] = simde_mm256_cmpeq_epi32(a_.m256i[i], b_.m256i[i]);
-    }
-
-    return simde__m512i_private_to_mmask16(r_);
+    return simde_kandn_mask16(a, b);
   #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cmpeq_epi32_mask(a, b) simde_mm512_cmpeq_epi32_mask(a, b)
+#  define _mm512_kandn(a, b) simde_mm512_kandn(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__mmask16
-simde_mm512_mask_cmpeq_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+simde_mm512_kor (simde__mmask16 a, simde__mmask16 b) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_mask_cmpeq_epi32_mask(k1, a, b);
+    return _mm512_kor(a, b);
   #else
-    return simde_mm512_cmpeq_epi32_mask(a, b) & k1;
+    return simde_kor_mask16(a, b);
   #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_mask_cmpeq_epi32_mask(k1, a, b) simde_mm512_mask_cmpeq_epi32_mask(k1, a, b)
+#  define _mm512_kor(a, b) simde_mm512_kor(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__mmask8
-simde_mm512_cmpeq_epi64_mask (simde__m512i a, simde__m512i b) {
+simde__mmask16
+simde_mm512_kxnor (simde__mmask16 a, simde__mmask16 b) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_cmpeq_epi64_mask(a, b);
+    return _mm512_kxnor(a, b);
   #else
-    simde__m512i_private
-      r_,
-      a_ = simde__m512i_to_private(a),
-      b_ = simde__m512i_to_private(b);
-
-    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-      r_.m256i[i] = simde_mm256_cmpeq_epi64(a_.m256i[i], b_.m256i[i]);
-    }
-
-    return simde__m512i_private_to_mmask8(r_);
+    return simde_kxnor_mask16(a, b);
   #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cmpeq_epi64_mask(a, b) simde_mm512_cmpeq_epi64_mask(a, b)
+#  define _mm512_kxnor(a, b) simde_mm512_kxnor(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__mmask8
-simde_mm512_mask_cmpeq_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+simde__mmask16
+simde_mm512_kxor (simde__mmask16 a, simde__mmask16 b) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_mask_cmpeq_epi64_mask(k1, a, b);
+    return _mm512_kxor(a, b);
   #else
-    return simde_mm512_cmpeq_epi64_mask(a, b) & k1;
+    return simde_kxor_mask16(a, b);
   #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_mask_cmpeq_epi64_mask(k1, a, b) simde_mm512_mask_cmpeq_epi64_mask(k1, a, b)
+#  define _mm512_kxor(a, b) simde_mm512_kxor(a, b)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__mmask16
-simde_mm512_mask_cmpgt_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+simde_mm512_knot (simde__mmask16 a) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_mask_cmpgt_epi32_mask(k1, a, b);
+    return _mm512_knot(a);
   #else
-    simde__m512i_private
-      r_,
+    return simde_knot_mask16(a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_knot(a) simde_mm512_knot(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kmov (simde__mmask16 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_kmov(a);
+  #else
+    return a;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_kmov(a) simde_mm512_kmov(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm512_kortestz (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_kortestz(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(int, simde_kortestz_mask16_u8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_kortestz(a, b) simde_mm512_kortestz(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_mm512_kortestc (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_kortestc(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(int, simde_kortestc_mask16_u8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_kortestc(a, b) simde_mm512_kortestc(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kunpackb (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_kunpackb(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ((a & 0xff) << 8) | (b & 0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_kunpackb(a, b) simde_mm512_kunpackb(a, b)
+#endif
+
+/* Duplicate each bit of an 8-bit mask, so operations on 64-bit
+   elements can be done with the 32-bit version. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde__mmask16_from_mmask8_dup (simde__mmask8 k) {
+  uint32_t r = k;
+  r = (r | (r << 4)) & UINT32_C(0x0F0F);
+  r = (r | (r << 2)) & UINT32_C(0x3333);
+  r = (r | (r << 1)) & UINT32_C(0x5555);
+  return HEDLEY_STATIC_CAST(simde__mmask16, r | (r << 1));
+}
+
+/* Shuffle tables for emulating compress and expand on four 32-bit
+   elements at a time with simde_mm_shuffle_epi8, indexed by the mask
+   for those elements.  The compress entry moves the selected elements
+   to the bottom of the vector, and the expand entry moves the bottom
+   elements to the selected positions.  Unused bytes are -128 so they
+   are zeroed. */
+SIMDE__FUNCTION_ATTRIBUTES
+const int8_t*
+simde_x_mm_compress_epi32_table (void) {
+  static const int8_t table[16][16] = {
+    { -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    4,    5,    6,    7, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    4,    5,    6,    7, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    8,    9,   10,   11, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    8,    9,   10,   11, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    4,    5,    6,    7,    8,    9,   10,   11, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11, -128, -128, -128, -128 },
+    {   12,   13,   14,   15, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,   12,   13,   14,   15, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    4,    5,    6,    7,   12,   13,   14,   15, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    4,    5,    6,    7,   12,   13,   14,   15, -128, -128, -128, -128 },
+    {    8,    9,   10,   11,   12,   13,   14,   15, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    8,    9,   10,   11,   12,   13,   14,   15, -128, -128, -128, -128 },
+    {    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15 }
+  };
+
+  return table[0];
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+const int8_t*
+simde_x_mm_expand_epi32_table (void) {
+  static const int8_t table[16][16] = {
+    { -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128 },
+    { -128, -128, -128, -128,    0,    1,    2,    3, -128, -128, -128, -128, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    4,    5,    6,    7, -128, -128, -128, -128, -128, -128, -128, -128 },
+    { -128, -128, -128, -128, -128, -128, -128, -128,    0,    1,    2,    3, -128, -128, -128, -128 },
+    {    0,    1,    2,    3, -128, -128, -128, -128,    4,    5,    6,    7, -128, -128, -128, -128 },
+    { -128, -128, -128, -128,    0,    1,    2,    3,    4,    5,    6,    7, -128, -128, -128, -128 },
+    {    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11, -128, -128, -128, -128 },
+    { -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,    0,    1,    2,    3 },
+    {    0,    1,    2,    3, -128, -128, -128, -128, -128, -128, -128, -128,    4,    5,    6,    7 },
+    { -128, -128, -128, -128,    0,    1,    2,    3, -128, -128, -128, -128,    4,    5,    6,    7 },
+    {    0,    1,    2,    3,    4,    5,    6,    7, -128, -128, -128, -128,    8,    9,   10,   11 },
+    { -128, -128, -128, -128, -128, -128, -128, -128,    0,    1,    2,    3,    4,    5,    6,    7 },
+    {    0,    1,    2,    3, -128, -128, -128, -128,    4,    5,    6,    7,    8,    9,   10,   11 },
+    { -128, -128, -128, -128,    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11 },
+    {    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15 }
+  };
+
+  return table[0];
+}
+
+/* The same for eight 32-bit elements at a time with
+   simde_mm256_permutevar8x32_epi32.  Each entry holds eight 3-bit
+   indices in consecutive nibbles, starting with the lowest. */
+SIMDE__FUNCTION_ATTRIBUTES
+const uint32_t*
+simde_x_mm256_compress_epi32_table (void) {
+  static const uint32_t table[256] = {
+    0x00000000, 0x00000000, 0x00000001, 0x00000010, 0x00000002, 0x00000020, 0x00000021, 0x00000210,
+    0x00000003, 0x00000030, 0x00000031, 0x00000310, 0x00000032, 0x00000320, 0x00000321, 0x00003210,
+    0x00000004, 0x00000040, 0x00000041, 0x00000410, 0x00000042, 0x00000420, 0x00000421, 0x00004210,
+    0x00000043, 0x00000430, 0x00000431, 0x00004310, 0x00000432, 0x00004320, 0x00004321, 0x00043210,
+    0x00000005, 0x00000050, 0x00000051, 0x00000510, 0x00000052, 0x00000520, 0x00000521, 0x00005210,
+    0x00000053, 0x00000530, 0x00000531, 0x00005310, 0x00000532, 0x00005320, 0x00005321, 0x00053210,
+    0x00000054, 0x00000540, 0x00000541, 0x00005410, 0x00000542, 0x00005420, 0x00005421, 0x00054210,
+    0x00000543, 0x00005430, 0x00005431, 0x00054310, 0x00005432, 0x00054320, 0x00054321, 0x00543210,
+    0x00000006, 0x00000060, 0x00000061, 0x00000610, 0x00000062, 0x00000620, 0x00000621, 0x00006210,
+    0x00000063, 0x00000630, 0x00000631, 0x00006310, 0x00000632, 0x00006320, 0x00006321, 0x00063210,
+    0x00000064, 0x00000640, 0x00000641, 0x00006410, 0x00000642, 0x00006420, 0x00006421, 0x00064210,
+    0x00000643, 0x00006430, 0x00006431, 0x00064310, 0x00006432, 0x00064320, 0x00064321, 0x00643210,
+    0x00000065, 0x00000650, 0x00000651, 0x00006510, 0x00000652, 0x00006520, 0x00006521, 0x00065210,
+    0x00000653, 0x00006530, 0x00006531, 0x00065310, 0x00006532, 0x00065320, 0x00065321, 0x00653210,
+    0x00000654, 0x00006540, 0x00006541, 0x00065410, 0x00006542, 0x00065420, 0x00065421, 0x00654210,
+    0x00006543, 0x00065430, 0x00065431, 0x00654310, 0x00065432, 0x00654320, 0x00654321, 0x06543210,
+    0x00000007, 0x00000070, 0x00000071, 0x00000710, 0x00000072, 0x00000720, 0x00000721, 0x00007210,
+    0x00000073, 0x00000730, 0x00000731, 0x00007310, 0x00000732, 0x00007320, 0x00007321, 0x00073210,
+    0x00000074, 0x00000740, 0x00000741, 0x00007410, 0x00000742, 0x00007420, 0x00007421, 0x00074210,
+    0x00000743, 0x00007430, 0x00007431, 0x00074310, 0x00007432, 0x00074320, 0x00074321, 0x00743210,
+    0x00000075, 0x00000750, 0x00000751, 0x00007510, 0x00000752, 0x00007520, 0x00007521, 0x00075210,
+    0x00000753, 0x00007530, 0x00007531, 0x00075310, 0x00007532, 0x00075320, 0x00075321, 0x00753210,
+    0x00000754, 0x00007540, 0x00007541, 0x00075410, 0x00007542, 0x00075420, 0x00075421, 0x00754210,
+    0x00007543, 0x00075430, 0x00075431, 0x00754310, 0x00075432, 0x00754320, 0x00754321, 0x07543210,
+    0x00000076, 0x00000760, 0x00000761, 0x00007610, 0x00000762, 0x00007620, 0x00007621, 0x00076210,
+    0x00000763, 0x00007630, 0x00007631, 0x00076310, 0x00007632, 0x00076320, 0x00076321, 0x00763210,
+    0x00000764, 0x00007640, 0x00007641, 0x00076410, 0x00007642, 0x00076420, 0x00076421, 0x00764210,
+    0x00007643, 0x00076430, 0x00076431, 0x00764310, 0x00076432, 0x00764320, 0x00764321, 0x07643210,
+    0x00000765, 0x00007650, 0x00007651, 0x00076510, 0x00007652, 0x00076520, 0x00076521, 0x00765210,
+    0x00007653, 0x00076530, 0x00076531, 0x00765310, 0x00076532, 0x00765320, 0x00765321, 0x07653210,
+    0x00007654, 0x00076540, 0x00076541, 0x00765410, 0x00076542, 0x00765420, 0x00765421, 0x07654210,
+    0x00076543, 0x00765430, 0x00765431, 0x07654310, 0x00765432, 0x07654320, 0x07654321, 0x76543210
+  };
+
+  return table;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+const uint32_t*
+simde_x_mm256_expand_epi32_table (void) {
+  static const uint32_t table[256] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000100, 0x00000100, 0x00000210,
+    0x00000000, 0x00001000, 0x00001000, 0x00002010, 0x00001000, 0x00002100, 0x00002100, 0x00003210,
+    0x00000000, 0x00010000, 0x00010000, 0x00020010, 0x00010000, 0x00020100, 0x00020100, 0x00030210,
+    0x00010000, 0x00021000, 0x00021000, 0x00032010, 0x00021000, 0x00032100, 0x00032100, 0x00043210,
+    0x00000000, 0x00100000, 0x00100000, 0x00200010, 0x00100000, 0x00200100, 0x00200100, 0x00300210,
+    0x00100000, 0x00201000, 0x00201000, 0x00302010, 0x00201000, 0x00302100, 0x00302100, 0x00403210,
+    0x00100000, 0x00210000, 0x00210000, 0x00320010, 0x00210000, 0x00320100, 0x00320100, 0x00430210,
+    0x00210000, 0x00321000, 0x00321000, 0x00432010, 0x00321000, 0x00432100, 0x00432100, 0x00543210,
+    0x00000000, 0x01000000, 0x01000000, 0x02000010, 0x01000000, 0x02000100, 0x02000100, 0x03000210,
+    0x01000000, 0x02001000, 0x02001000, 0x03002010, 0x02001000, 0x03002100, 0x03002100, 0x04003210,
+    0x01000000, 0x02010000, 0x02010000, 0x03020010, 0x02010000, 0x03020100, 0x03020100, 0x04030210,
+    0x02010000, 0x03021000, 0x03021000, 0x04032010, 0x03021000, 0x04032100, 0x04032100, 0x05043210,
+    0x01000000, 0x02100000, 0x02100000, 0x03200010, 0x02100000, 0x03200100, 0x03200100, 0x04300210,
+    0x02100000, 0x03201000, 0x03201000, 0x04302010, 0x03201000, 0x04302100, 0x04302100, 0x05403210,
+    0x02100000, 0x03210000, 0x03210000, 0x04320010, 0x03210000, 0x04320100, 0x04320100, 0x05430210,
+    0x03210000, 0x04321000, 0x04321000, 0x05432010, 0x04321000, 0x05432100, 0x05432100, 0x06543210,
+    0x00000000, 0x10000000, 0x10000000, 0x20000010, 0x10000000, 0x20000100, 0x20000100, 0x30000210,
+    0x10000000, 0x20001000, 0x20001000, 0x30002010, 0x20001000, 0x30002100, 0x30002100, 0x40003210,
+    0x10000000, 0x20010000, 0x20010000, 0x30020010, 0x20010000, 0x30020100, 0x30020100, 0x40030210,
+    0x20010000, 0x30021000, 0x30021000, 0x40032010, 0x30021000, 0x40032100, 0x40032100, 0x50043210,
+    0x10000000, 0x20100000, 0x20100000, 0x30200010, 0x20100000, 0x30200100, 0x30200100, 0x40300210,
+    0x20100000, 0x30201000, 0x30201000, 0x40302010, 0x30201000, 0x40302100, 0x40302100, 0x50403210,
+    0x20100000, 0x30210000, 0x30210000, 0x40320010, 0x30210000, 0x40320100, 0x40320100, 0x50430210,
+    0x30210000, 0x40321000, 0x40321000, 0x50432010, 0x40321000, 0x50432100, 0x50432100, 0x60543210,
+    0x10000000, 0x21000000, 0x21000000, 0x32000010, 0x21000000, 0x32000100, 0x32000100, 0x43000210,
+    0x21000000, 0x32001000, 0x32001000, 0x43002010, 0x32001000, 0x43002100, 0x43002100, 0x54003210,
+    0x21000000, 0x32010000, 0x32010000, 0x43020010, 0x32010000, 0x43020100, 0x43020100, 0x54030210,
+    0x32010000, 0x43021000, 0x43021000, 0x54032010, 0x43021000, 0x54032100, 0x54032100, 0x65043210,
+    0x21000000, 0x32100000, 0x32100000, 0x43200010, 0x32100000, 0x43200100, 0x43200100, 0x54300210,
+    0x32100000, 0x43201000, 0x43201000, 0x54302010, 0x43201000, 0x54302100, 0x54302100, 0x65403210,
+    0x32100000, 0x43210000, 0x43210000, 0x54320010, 0x43210000, 0x54320100, 0x54320100, 0x65430210,
+    0x43210000, 0x54321000, 0x54321000, 0x65432010, 0x54321000, 0x65432100, 0x65432100, 0x76543210
+  };
+
+  return table;
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_compress_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_compress_epi32(k, a);
+  #else
+    simde__m512i_private
       a_ = simde__m512i_to_private(a),
-      b_ = simde__m512i_to_private(b);
+      r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-      r_.m256i[i] = simde_mm256_cmpgt_epi32(a_.m256i[i], b_.m256i[i]);
-    }
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      /* Compress each half with a table lookup, then rotate the upper
+         half up by the number of elements taken from the lower half
+         and merge.  Only the low three bits of each index are used by
+         the permutes, so the rotation doesn't need any masking. */
+      const uint32_t* table = simde_x_mm256_compress_epi32_table();
+      const simde__m256i iota = simde_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      const simde__m256i shifts = simde_mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+      const uint32_t kl = HEDLEY_STATIC_CAST(uint32_t, k & 0xff);
+      const uint32_t kh = HEDLEY_STATIC_CAST(uint32_t, (k >> 8) & 0xff);
+      const int32_t nl = HEDLEY_STATIC_CAST(int32_t, simde_x_popcount_u32(kl));
+      const int32_t n = nl + HEDLEY_STATIC_CAST(int32_t, simde_x_popcount_u32(kh));
+      const simde__m256i lo = simde_mm256_permutevar8x32_epi32(a_.m256i[0], simde_mm256_srlv_epi32(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, table[kl])), shifts));
+      const simde__m256i hi = simde_mm256_permutevar8x32_epi32(a_.m256i[1], simde_mm256_srlv_epi32(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, table[kh])), shifts));
+      const simde__m256i hi_rot = simde_mm256_permutevar8x32_epi32(hi, simde_mm256_sub_epi32(iota, simde_mm256_set1_epi32(nl)));
+      const simde__m256i from_lo = simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(nl), iota);
+      r_.m256i[0] = simde_mm256_or_si256(simde_mm256_and_si256(from_lo, lo), simde_mm256_andnot_si256(from_lo, hi_rot));
+      r_.m256i[0] = simde_mm256_and_si256(r_.m256i[0], simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(n), iota));
+      r_.m256i[1] = simde_mm256_and_si256(hi_rot, simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(n - 8), iota));
+    #elif defined(SIMDE_ARCH_X86_SSSE3) || defined(SIMDE_SSSE3_NEON)
+      /* Compress each 128-bit chunk with a table lookup and store it
+         right after the output of the previous chunk.  The unused
+         elements of a chunk are zero and are either overwritten by the
+         next chunk or left as the zeroed tail.  At most 12 elements
+         precede the last chunk, so the stores stay inside r_. */
+      const int8_t* table = simde_x_mm_compress_epi32_table();
+      int32_t* dst = HEDLEY_REINTERPRET_CAST(int32_t*, &r_);
+      r_ = simde__m512i_to_private(simde_mm512_setzero_si512());
+      for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i++) {
+        const uint32_t m = HEDLEY_STATIC_CAST(uint32_t, (k >> (i * 4)) & 15);
+        const simde__m128i idx = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, &(table[m * 16])));
+        simde_mm_storeu_si128(HEDLEY_REINTERPRET_CAST(simde__m128i*, dst), simde_mm_shuffle_epi8(a_.m128i[i], idx));
+        dst += simde_x_popcount_u32(m);
+      }
+    #else
+      size_t n = 0;
+      r_ = simde__m512i_to_private(simde_mm512_setzero_si512());
+      for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+        if ((k >> i) & 1) {
+          r_.i32[n++] = a_.i32[i];
+        }
+      }
+    #endif
 
-    return simde__m512i_private_to_mmask16(r_) & k1;
+    return simde__m512i_from_private(r_);
   #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_mask_cmpgt_epi32_mask(k1, a, b) simde_mm512_mask_cmpgt_epi32_mask(k1, a, b)
+#  define _mm512_maskz_compress_epi32(k, a) simde_mm512_maskz_compress_epi32(k, a)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__mmask8
-simde_mm512_mask_cmpgt_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+simde__m512i
+simde_mm512_mask_compress_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
   #if defined(SIMDE_AVX512F_NATIVE)
-    return _mm512_mask_cmpgt_epi64_mask(k1, a, b);
+    return _mm512_mask_compress_epi32(src, k, a);
+  #else
+    /* The compressed elements are at the bottom of the vector; the
+       rest come from src. */
+    const simde__mmask16 valid = HEDLEY_STATIC_CAST(simde__mmask16, (UINT32_C(1) << simde_x_popcount_u32(k)) - 1);
+    return simde_mm512_mask_mov_epi32(src, valid, simde_mm512_maskz_compress_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_compress_epi32(src, k, a) simde_mm512_mask_compress_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_epi32 (void* base_addr, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    _mm512_mask_compressstoreu_epi32(base_addr, k, a);
+  #else
+    simde__m512i_private r_ = simde__m512i_to_private(simde_mm512_maskz_compress_epi32(k, a));
+    const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_x_popcount_u32(k));
+
+    #if defined(SIMDE_AVX_NATIVE)
+      /* A masked store writes exactly n elements without the branches
+         of a variable-length memcpy. */
+      const simde__m256i iota = simde_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      simde_float32* dst = HEDLEY_REINTERPRET_CAST(simde_float32*, base_addr);
+      simde_mm256_maskstore_ps(dst    , simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(n    ), iota), simde_mm256_castsi256_ps(r_.m256i[0]));
+      simde_mm256_maskstore_ps(dst + 8, simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(n - 8), iota), simde_mm256_castsi256_ps(r_.m256i[1]));
+    #else
+      simde_memcpy(base_addr, &r_, HEDLEY_STATIC_CAST(size_t, n) * sizeof(int32_t));
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_compressstoreu_epi32(base_addr, k, a) simde_mm512_mask_compressstoreu_epi32(base_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expand_epi32(k, a);
   #else
     simde__m512i_private
-      r_,
       a_ = simde__m512i_to_private(a),
-      b_ = simde__m512i_to_private(b);
+      r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-      r_.m256i[i] = simde_mm256_cmpgt_epi64(a_.m256i[i], b_.m256i[i]);
-    }
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      /* The upper half of the result is expanded from the elements of
+         a starting at the first one not used by the lower half. */
+      const uint32_t* table = simde_x_mm256_expand_epi32_table();
+      const simde__m256i iota = simde_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      const simde__m256i shifts = simde_mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+      const uint32_t kl = HEDLEY_STATIC_CAST(uint32_t, k & 0xff);
+      const uint32_t kh = HEDLEY_STATIC_CAST(uint32_t, (k >> 8) & 0xff);
+      const simde__m256i idx = simde_mm256_add_epi32(iota, simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_popcount_u32(kl))));
+      const simde__m256i from_lo = simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(8), idx);
+      const simde__m256i upper =
+        simde_mm256_or_si256(
+          simde_mm256_and_si256(from_lo, simde_mm256_permutevar8x32_epi32(a_.m256i[0], idx)),
+          simde_mm256_andnot_si256(from_lo, simde_mm256_permutevar8x32_epi32(a_.m256i[1], idx)));
+      const simde__m512i_private mask_ = simde__m512i_to_private(simde__m512i_from_mmask16(k));
+      r_.m256i[0] = simde_mm256_permutevar8x32_epi32(a_.m256i[0], simde_mm256_srlv_epi32(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, table[kl])), shifts));
+      r_.m256i[1] = simde_mm256_permutevar8x32_epi32(upper, simde_mm256_srlv_epi32(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, table[kh])), shifts));
+      r_.m256i[0] = simde_mm256_and_si256(r_.m256i[0], mask_.m256i[0]);
+      r_.m256i[1] = simde_mm256_and_si256(r_.m256i[1], mask_.m256i[1]);
+    #elif defined(SIMDE_ARCH_X86_SSSE3) || defined(SIMDE_SSSE3_NEON)
+      /* Load each 128-bit chunk of the output starting at the first
+         unused element of a and spread it out with a table lookup.  At
+         most 12 elements are used before the last chunk, so the loads
+         stay inside a_. */
+      const int8_t* table = simde_x_mm_expand_epi32_table();
+      const int32_t* src = HEDLEY_REINTERPRET_CAST(const int32_t*, &a_);
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        const uint32_t m = HEDLEY_STATIC_CAST(uint32_t, (k >> (i * 4)) & 15);
+        const simde__m128i idx = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, &(table[m * 16])));
+        r_.m128i[i] = simde_mm_shuffle_epi8(simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, src)), idx);
+        src += simde_x_popcount_u32(m);
+      }
+    #else
+      size_t n = 0;
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = ((k >> i) & 1) ? a_.i32[n++] : 0;
+      }
+    #endif
 
-    return simde__m512i_private_to_mmask8(r_) & k1;
+    return simde__m512i_from_private(r_);
   #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_mask_cmpgt_epi64_mask(k1, a, b) simde_mm512_mask_cmpgt_epi64_mask(k1, a, b)
+#  define _mm512_maskz_expand_epi32(k, a) simde_mm512_maskz_expand_epi32(k, a)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_cvtepi8_epi32 (simde__m128i a) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_cvtepi8_epi32(a);
-#else
-  simde__m512i_private r_;
-  simde__m128i_private a_ = simde__m128i_to_private(a);
+simde_mm512_mask_expand_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expand_epi32(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_maskz_expand_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_expand_epi32(src, k, a) simde_mm512_mask_expand_epi32(src, k, a)
+#endif
 
-#if defined(SIMDE__CONVERT_VECTOR)
-  SIMDE__CONVERT_VECTOR(r_.i32, a_.i8);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-    r_.i32[i] = a_.i8[i];
-  }
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi32 (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_epi32(k, mem_addr);
+  #else
+    /* Only the selected number of elements may be read; the memory
+       after them might not be accessible. */
+    simde__m512i_private a_;
+    const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_x_popcount_u32(k));
+
+    #if defined(SIMDE_AVX_NATIVE)
+      const simde__m256i iota = simde_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      const simde_float32* src = HEDLEY_REINTERPRET_CAST(const simde_float32*, mem_addr);
+      a_.m256i[0] = simde_mm256_castps_si256(simde_mm256_maskload_ps(src    , simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(n    ), iota)));
+      a_.m256i[1] = simde_mm256_castps_si256(simde_mm256_maskload_ps(src + 8, simde_mm256_cmpgt_epi32(simde_mm256_set1_epi32(n - 8), iota)));
+    #else
+      a_ = simde__m512i_to_private(simde_mm512_setzero_si512());
+      simde_memcpy(&a_, mem_addr, HEDLEY_STATIC_CAST(size_t, n) * sizeof(int32_t));
+    #endif
+
+    return simde_mm512_maskz_expand_epi32(k, simde__m512i_from_private(a_));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_expandloadu_epi32(k, mem_addr) simde_mm512_maskz_expandloadu_epi32(k, mem_addr)
 #endif
 
-  return simde__m512i_from_private(r_);
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi32 (simde__m512i src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_epi32(src, k, mem_addr);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_maskz_expandloadu_epi32(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_expandloadu_epi32(src, k, mem_addr) simde_mm512_mask_expandloadu_epi32(src, k, mem_addr)
 #endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_compress_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_compress_epi64(k, a);
+  #else
+    /* Compressing or expanding 64-bit elements is the same as doing
+       it on pairs of 32-bit elements. */
+    return simde_mm512_maskz_compress_epi32(simde__mmask16_from_mmask8_dup(k), a);
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cvtepi8_epi32(a) simde_mm512_cvtepi8_epi32(a)
+#  define _mm512_maskz_compress_epi64(k, a) simde_mm512_maskz_compress_epi64(k, a)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_cvtepi8_epi64 (simde__m128i a) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_cvtepi8_epi64(a);
-#else
-  simde__m512i_private r_;
-  simde__m128i_private a_ = simde__m128i_to_private(a);
+simde_mm512_mask_compress_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_compress_epi64(src, k, a);
+  #else
+    return simde_mm512_mask_compress_epi32(src, simde__mmask16_from_mmask8_dup(k), a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_compress_epi64(src, k, a) simde_mm512_mask_compress_epi64(src, k, a)
+#endif
 
-#if defined(SIMDE__CONVERT_VECTOR)
-  SIMDE__CONVERT_VECTOR(r_.i64, a_.m64_private[0].i8);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-    r_.i64[i] = a_.i8[i];
-  }
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    _mm512_mask_compressstoreu_epi64(base_addr, k, a);
+  #else
+    simde_mm512_mask_compressstoreu_epi32(base_addr, simde__mmask16_from_mmask8_dup(k), a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_compressstoreu_epi64(base_addr, k, a) simde_mm512_mask_compressstoreu_epi64(base_addr, k, a)
 #endif
 
-  return simde__m512i_from_private(r_);
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expand_epi64(k, a);
+  #else
+    return simde_mm512_maskz_expand_epi32(simde__mmask16_from_mmask8_dup(k), a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_expand_epi64(k, a) simde_mm512_maskz_expand_epi64(k, a)
 #endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expand_epi64(src, k, a);
+  #else
+    return simde_mm512_mask_expand_epi32(src, simde__mmask16_from_mmask8_dup(k), a);
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cvtepi8_epi64(a) simde_mm512_cvtepi8_epi64(a)
+#  define _mm512_mask_expand_epi64(src, k, a) simde_mm512_mask_expand_epi64(src, k, a)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m128i
-simde_mm512_cvtepi32_epi8 (simde__m512i a) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_cvtepi32_epi8(a);
-#else
-  simde__m128i_private r_;
-  simde__m512i_private a_ = simde__m512i_to_private(a);
+simde__m512i
+simde_mm512_maskz_expandloadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_epi64(k, mem_addr);
+  #else
+    return simde_mm512_maskz_expandloadu_epi32(simde__mmask16_from_mmask8_dup(k), mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_expandloadu_epi64(k, mem_addr) simde_mm512_maskz_expandloadu_epi64(k, mem_addr)
+#endif
 
-#if defined(SIMDE__CONVERT_VECTOR)
-  SIMDE__CONVERT_VECTOR(r_.i8, a_.i32);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-    r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, a_.i32[i]);
-  }
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi64 (simde__m512i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_epi64(src, k, mem_addr);
+  #else
+    return simde_mm512_mask_expandloadu_epi32(src, simde__mmask16_from_mmask8_dup(k), mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_expandloadu_epi64(src, k, mem_addr) simde_mm512_mask_expandloadu_epi64(src, k, mem_addr)
 #endif
 
-  return simde__m128i_from_private(r_);
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_compress_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_compress_ps(k, a);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_maskz_compress_epi32(k, simde_mm512_castps_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_compress_ps(k, a) simde_mm512_maskz_compress_ps(k, a)
 #endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_compress_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_compress_ps(src, k, a);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_mask_compress_epi32(simde_mm512_castps_si512(src), k, simde_mm512_castps_si512(a)));
+  #endif
 }
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cvtepi32_epi8(a) simde_mm512_cvtepi32_epi8(a)
+#  define _mm512_mask_compress_ps(src, k, a) simde_mm512_mask_compress_ps(src, k, a)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm512_cvtepi32_epi16 (simde__m512i a) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_cvtepi32_epi16(a);
-#else
-  simde__m256i_private r_;
-  simde__m512i_private a_ = simde__m512i_to_private(a);
+void
+simde_mm512_mask_compressstoreu_ps (void* base_addr, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    _mm512_mask_compressstoreu_ps(base_addr, k, a);
+  #else
+    simde_mm512_mask_compressstoreu_epi32(base_addr, k, simde_mm512_castps_si512(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_compressstoreu_ps(base_addr, k, a) simde_mm512_mask_compressstoreu_ps(base_addr, k, a)
+#endif
 
-#if defined(SIMDE__CONVERT_VECTOR)
-  SIMDE__CONVERT_VECTOR(r_.i16, a_.i32);
-#else
-  SIMDE__VECTORIZE
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_expand_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expand_ps(k, a);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_maskz_expand_epi32(k, simde_mm512_castps_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_expand_ps(k, a) simde_mm512_maskz_expand_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_expand_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expand_ps(src, k, a);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_mask_expand_epi32(simde_mm512_castps_si512(src), k, simde_mm512_castps_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_expand_ps(src, k, a) simde_mm512_mask_expand_ps(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_expandloadu_ps (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_ps(k, mem_addr);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_maskz_expandloadu_epi32(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_expandloadu_ps(k, mem_addr) simde_mm512_maskz_expandloadu_ps(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_expandloadu_ps (simde__m512 src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_ps(src, k, mem_addr);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_mask_expandloadu_epi32(simde_mm512_castps_si512(src), k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_expandloadu_ps(src, k, mem_addr) simde_mm512_mask_expandloadu_ps(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_compress_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_compress_pd(k, a);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_maskz_compress_epi32(simde__mmask16_from_mmask8_dup(k), simde_mm512_castpd_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_compress_pd(k, a) simde_mm512_maskz_compress_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_compress_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_compress_pd(src, k, a);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_mask_compress_epi32(simde_mm512_castpd_si512(src), simde__mmask16_from_mmask8_dup(k), simde_mm512_castpd_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_compress_pd(src, k, a) simde_mm512_mask_compress_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_pd (void* base_addr, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    _mm512_mask_compressstoreu_pd(base_addr, k, a);
+  #else
+    simde_mm512_mask_compressstoreu_epi32(base_addr, simde__mmask16_from_mmask8_dup(k), simde_mm512_castpd_si512(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_compressstoreu_pd(base_addr, k, a) simde_mm512_mask_compressstoreu_pd(base_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_expand_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expand_pd(k, a);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_maskz_expand_epi32(simde__mmask16_from_mmask8_dup(k), simde_mm512_castpd_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_expand_pd(k, a) simde_mm512_maskz_expand_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_expand_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expand_pd(src, k, a);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_mask_expand_epi32(simde_mm512_castpd_si512(src), simde__mmask16_from_mmask8_dup(k), simde_mm512_castpd_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_expand_pd(src, k, a) simde_mm512_mask_expand_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_expandloadu_pd (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_pd(k, mem_addr);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_maskz_expandloadu_epi32(simde__mmask16_from_mmask8_dup(k), mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_expandloadu_pd(k, mem_addr) simde_mm512_maskz_expandloadu_pd(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_expandloadu_pd (simde__m512d src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_pd(src, k, mem_addr);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_mask_expandloadu_epi32(simde_mm512_castpd_si512(src), simde__mmask16_from_mmask8_dup(k), mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_expandloadu_pd(src, k, mem_addr) simde_mm512_mask_expandloadu_pd(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srli_epi64 (simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srli_epi64(a, imm8);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      r_.m256i[0] = simde_mm256_srli_epi64(a_.m256i[0], imm8);
+      r_.m256i[1] = simde_mm256_srli_epi64(a_.m256i[1], imm8);
+    #elif defined(SIMDE_ARCH_X86_SSE2)
+      r_.m128i[0] = simde_mm_srli_epi64(a_.m128i[0], imm8);
+      r_.m128i[1] = simde_mm_srli_epi64(a_.m128i[1], imm8);
+      r_.m128i[2] = simde_mm_srli_epi64(a_.m128i[2], imm8);
+      r_.m128i[3] = simde_mm_srli_epi64(a_.m128i[3], imm8);
+    #else
+      /* The Intel Intrinsics Guide says that only the 8 LSBits of imm8 are
+      * used.  In this case we should do "imm8 &= 0xff" here.  However in
+      * practice all bits are used. */
+      if (imm8 > 63) {
+        simde_memset(&r_, 0, sizeof(r_));
+      } else {
+        #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+          r_.u64 = a_.u64 >> imm8;
+        #else
+          SIMDE__VECTORIZE
+          for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+            r_.u64[i] = a_.u64[i] >> imm8;
+          }
+        #endif
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srli_epi64(a, imm8) simde_mm512_srli_epi64(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srli_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srli_epi64(src, k, a, imm8);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_srli_epi64(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srli_epi64(src, k, a, imm8) simde_mm512_mask_srli_epi64(src, k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srli_epi64 (simde__mmask8 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srli_epi64(k, a, imm8);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_srli_epi64(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srli_epi64(k, a, imm8) simde_mm512_maskz_srli_epi64(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_xor_si512 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_xor_si512(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    r_.m256i[0] = simde_mm256_xor_si256(a_.m256i[0], b_.m256i[0]);
+    r_.m256i[1] = simde_mm256_xor_si256(a_.m256i[1], b_.m256i[1]);
+  #elif defined(SIMDE_ARCH_X86_SSE2)
+    r_.m128i[0] = simde_mm_xor_si128(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_xor_si128(a_.m128i[1], b_.m128i[1]);
+    r_.m128i[2] = simde_mm_xor_si128(a_.m128i[2], b_.m128i[2]);
+    r_.m128i[3] = simde_mm_xor_si128(a_.m128i[3], b_.m128i[3]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    r_.i32f = a_.i32f ^ b_.i32f;
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      r_.i32f[i] = a_.i32f[i] ^ b_.i32f[i];
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_xor_si512(a, b) simde_mm512_xor_si512(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_xor_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_xor_epi32(a, b);
+  #else
+    return simde_mm512_xor_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_xor_epi32(a, b) simde_mm512_xor_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_xor_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_xor_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_xor_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_xor_epi32(src, k, a, b) simde_mm512_mask_xor_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_xor_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_xor_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_xor_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_xor_epi32(k, a, b) simde_mm512_maskz_xor_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_xor_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_xor_epi64(a, b);
+  #else
+    return simde_mm512_xor_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_xor_epi64(a, b) simde_mm512_xor_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_xor_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_xor_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_xor_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_xor_epi64(src, k, a, b) simde_mm512_mask_xor_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_xor_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_xor_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_xor_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_xor_epi64(k, a, b) simde_mm512_maskz_xor_epi64(k, a, b)
+#endif
+
+/* vpternlog computes an arbitrary boolean function of three inputs;
+   bit (a << 2) | (b << 1) | c of imm8 is the result for the
+   corresponding input bits.  For each of the 256 functions this is
+   the cheapest expression using and, or, xor, andnot and not (found
+   by exhaustive search), so once imm8 is known the switch below
+   folds away to the same code you would write by hand.  Selects are
+   written as c ^ ((b ^ c) & a), which compilers turn into a single
+   vbsl on NEON.  The expressions work on scalars as well as vectors,
+   and zero / all ones are written in terms of a so they have the
+   right type. */
+#define SIMDE_X_TERNARYLOGIC_0x00(a, b, c) ((a) ^ (a))
+#define SIMDE_X_TERNARYLOGIC_0x01(a, b, c) (~((a) | (b)) & ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x02(a, b, c) (~((a) | (b)) & (c))
+#define SIMDE_X_TERNARYLOGIC_0x03(a, b, c) (~((a) | (b)))
+#define SIMDE_X_TERNARYLOGIC_0x04(a, b, c) (~((a) | (c)) & (b))
+#define SIMDE_X_TERNARYLOGIC_0x05(a, b, c) (~((a) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0x06(a, b, c) (~(a) & ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x07(a, b, c) (~((b) & (c)) & ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x08(a, b, c) (~(a) & ((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x09(a, b, c) (~((b) ^ (c)) & ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x0A(a, b, c) (~(a) & (c))
+#define SIMDE_X_TERNARYLOGIC_0x0B(a, b, c) (~(~(c) & (b)) & ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x0C(a, b, c) (~(a) & (b))
+#define SIMDE_X_TERNARYLOGIC_0x0D(a, b, c) (~(~(b) & (c)) & ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x0E(a, b, c) (~(a) & ((b) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0x0F(a, b, c) (~(a))
+#define SIMDE_X_TERNARYLOGIC_0x10(a, b, c) (~((b) | (c)) & (a))
+#define SIMDE_X_TERNARYLOGIC_0x11(a, b, c) (~((b) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0x12(a, b, c) (~(b) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x13(a, b, c) (~((a) & (c)) & ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x14(a, b, c) (~(c) & ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x15(a, b, c) (~((a) & (b)) & ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x16(a, b, c) (((a) | (b)) ^ (((a) & (b)) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0x17(a, b, c) (~((a) & ((b) | (c))) & ~((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x18(a, b, c) (~((b) ^ (c)) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x19(a, b, c) (~(((a) & (b)) | ((b) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0x1A(a, b, c) (~((a) & (b)) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x1B(a, b, c) (~((b) ^ (((a) ^ (b)) & (c))))
+#define SIMDE_X_TERNARYLOGIC_0x1C(a, b, c) (~((a) & (c)) & ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x1D(a, b, c) (~((c) ^ (((a) ^ (c)) & (b))))
+#define SIMDE_X_TERNARYLOGIC_0x1E(a, b, c) ((a) ^ ((b) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0x1F(a, b, c) (~((a) & ((b) | (c))))
+#define SIMDE_X_TERNARYLOGIC_0x20(a, b, c) ((a) & (~(b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x21(a, b, c) (~((a) ^ (c)) & ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x22(a, b, c) (~(b) & (c))
+#define SIMDE_X_TERNARYLOGIC_0x23(a, b, c) (~(~(c) & (a)) & ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x24(a, b, c) (((b) ^ (c)) & ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x25(a, b, c) ((a) ^ (((a) & (b)) | ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0x26(a, b, c) (~((a) & (b)) & ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x27(a, b, c) (~((a) ^ (((b) ^ (a)) & (c))))
+#define SIMDE_X_TERNARYLOGIC_0x28(a, b, c) ((c) & ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x29(a, b, c) (((a) | (b)) ^ (((a) & (b)) | ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0x2A(a, b, c) (~((a) & (b)) & (c))
+#define SIMDE_X_TERNARYLOGIC_0x2B(a, b, c) (((a) | ((b) ^ (c))) ^ ((b) | ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0x2C(a, b, c) (((b) | (c)) & ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x2D(a, b, c) ((~(b) & (c)) ^ ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x2E(a, b, c) (((b) | (c)) ^ ((a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x2F(a, b, c) ((~(b) & (c)) | ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x30(a, b, c) (~(b) & (a))
+#define SIMDE_X_TERNARYLOGIC_0x31(a, b, c) (~(~(a) & (c)) & ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x32(a, b, c) (~(b) & ((a) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0x33(a, b, c) (~(b))
+#define SIMDE_X_TERNARYLOGIC_0x34(a, b, c) (~((b) & (c)) & ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x35(a, b, c) (~((c) ^ (((b) ^ (c)) & (a))))
+#define SIMDE_X_TERNARYLOGIC_0x36(a, b, c) (((a) | (c)) ^ (b))
+#define SIMDE_X_TERNARYLOGIC_0x37(a, b, c) (~(((a) | (c)) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x38(a, b, c) (((a) | (c)) & ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x39(a, b, c) (~(b) ^ (~(a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x3A(a, b, c) (((a) | (c)) ^ ((a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x3B(a, b, c) (~(b) | (~(a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x3C(a, b, c) ((a) ^ (b))
+#define SIMDE_X_TERNARYLOGIC_0x3D(a, b, c) (~(~((a) ^ (b)) & ((a) | (c))))
+#define SIMDE_X_TERNARYLOGIC_0x3E(a, b, c) (((a) ^ (b)) | (~(b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x3F(a, b, c) (~((a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x40(a, b, c) ((a) & (~(c) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x41(a, b, c) (~((a) ^ (b)) & ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x42(a, b, c) (((b) ^ (c)) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x43(a, b, c) ((a) ^ (((a) & (c)) | ~(b)))
+#define SIMDE_X_TERNARYLOGIC_0x44(a, b, c) (~(c) & (b))
+#define SIMDE_X_TERNARYLOGIC_0x45(a, b, c) (~(~(b) & (a)) & ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x46(a, b, c) (~((a) & (c)) & ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x47(a, b, c) (~((a) ^ (((c) ^ (a)) & (b))))
+#define SIMDE_X_TERNARYLOGIC_0x48(a, b, c) ((b) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x49(a, b, c) (((a) | (c)) ^ (((a) & (c)) | ~(b)))
+#define SIMDE_X_TERNARYLOGIC_0x4A(a, b, c) (((b) | (c)) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x4B(a, b, c) ((~(c) & (b)) ^ ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x4C(a, b, c) (~((a) & (c)) & (b))
+#define SIMDE_X_TERNARYLOGIC_0x4D(a, b, c) (((a) | ((b) ^ (c))) ^ ((c) | ~(b)))
+#define SIMDE_X_TERNARYLOGIC_0x4E(a, b, c) (((b) | (c)) ^ ((a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x4F(a, b, c) ((~(c) & (b)) | ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x50(a, b, c) (~(c) & (a))
+#define SIMDE_X_TERNARYLOGIC_0x51(a, b, c) (~(~(a) & (b)) & ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x52(a, b, c) (~((b) & (c)) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x53(a, b, c) (~((b) ^ (((c) ^ (b)) & (a))))
+#define SIMDE_X_TERNARYLOGIC_0x54(a, b, c) (~(c) & ((a) | (b)))
+#define SIMDE_X_TERNARYLOGIC_0x55(a, b, c) (~(c))
+#define SIMDE_X_TERNARYLOGIC_0x56(a, b, c) (((a) | (b)) ^ (c))
+#define SIMDE_X_TERNARYLOGIC_0x57(a, b, c) (~(((a) | (b)) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x58(a, b, c) (((a) | (b)) & ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x59(a, b, c) (~(c) ^ (~(a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x5A(a, b, c) ((a) ^ (c))
+#define SIMDE_X_TERNARYLOGIC_0x5B(a, b, c) (~(~((a) ^ (c)) & ((a) | (b))))
+#define SIMDE_X_TERNARYLOGIC_0x5C(a, b, c) (((a) | (b)) ^ ((a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x5D(a, b, c) (~(c) | (~(a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x5E(a, b, c) (((a) ^ (c)) | (~(c) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x5F(a, b, c) (~((a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x60(a, b, c) ((a) & ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x61(a, b, c) (((a) | ((b) & (c))) ^ ((b) ^ ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0x62(a, b, c) (((a) | (c)) & ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x63(a, b, c) ((~(c) & (a)) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x64(a, b, c) (((a) | (b)) & ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x65(a, b, c) (~(c) ^ (~(b) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0x66(a, b, c) ((b) ^ (c))
+#define SIMDE_X_TERNARYLOGIC_0x67(a, b, c) (~(~((b) ^ (c)) & ((a) | (b))))
+#define SIMDE_X_TERNARYLOGIC_0x68(a, b, c) (((a) | (b)) & (((a) & (b)) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x69(a, b, c) (((b) ^ (c)) ^ ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x6A(a, b, c) (((a) & (b)) ^ (c))
+#define SIMDE_X_TERNARYLOGIC_0x6B(a, b, c) (((a) | (~(b) & (c))) ^ ((b) ^ ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0x6C(a, b, c) ((b) ^ ((a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x6D(a, b, c) (((a) | (~(c) & (b))) ^ ((b) ^ ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0x6E(a, b, c) (((b) ^ (c)) | (~(a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x6F(a, b, c) (((b) ^ (c)) | ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x70(a, b, c) (~((b) & (c)) & (a))
+#define SIMDE_X_TERNARYLOGIC_0x71(a, b, c) (((a) | ~(c)) ^ (~((a) ^ (c)) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x72(a, b, c) (((a) | (c)) ^ ((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x73(a, b, c) ((~(c) & (a)) | ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x74(a, b, c) (((a) | (b)) ^ ((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x75(a, b, c) (~(c) | (~(b) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0x76(a, b, c) (((b) ^ (c)) | (~(c) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0x77(a, b, c) (~((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x78(a, b, c) ((a) ^ ((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x79(a, b, c) (((a) | ~(c)) ^ (~(~(c) & (a)) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0x7A(a, b, c) (((a) ^ (c)) | (~(b) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0x7B(a, b, c) (((a) ^ (c)) | ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x7C(a, b, c) ((~(c) & (a)) | ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x7D(a, b, c) (~(c) | ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0x7E(a, b, c) (((b) ^ (c)) | ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x7F(a, b, c) (~((a) & ((b) & (c))))
+#define SIMDE_X_TERNARYLOGIC_0x80(a, b, c) ((a) & ((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x81(a, b, c) (~(((b) ^ (c)) | ((a) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0x82(a, b, c) (~((a) ^ (b)) & (c))
+#define SIMDE_X_TERNARYLOGIC_0x83(a, b, c) ((a) ^ ((~(c) & (a)) | ~(b)))
+#define SIMDE_X_TERNARYLOGIC_0x84(a, b, c) (~((a) ^ (c)) & (b))
+#define SIMDE_X_TERNARYLOGIC_0x85(a, b, c) ((a) ^ (~(c) | (~(b) & (a))))
+#define SIMDE_X_TERNARYLOGIC_0x86(a, b, c) ((a) ^ (((b) ^ (c)) | (~(c) & (a))))
+#define SIMDE_X_TERNARYLOGIC_0x87(a, b, c) (((b) & (c)) ^ ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x88(a, b, c) ((b) & (c))
+#define SIMDE_X_TERNARYLOGIC_0x89(a, b, c) (((b) | (~(c) & (a))) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x8A(a, b, c) (~(~(b) & (a)) & (c))
+#define SIMDE_X_TERNARYLOGIC_0x8B(a, b, c) (((a) | (b)) ^ ~((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x8C(a, b, c) (~(~(c) & (a)) & (b))
+#define SIMDE_X_TERNARYLOGIC_0x8D(a, b, c) (((a) | (c)) ^ ~((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x8E(a, b, c) ((a) ^ (((b) ^ (c)) | ((a) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0x8F(a, b, c) (((b) & (c)) | ~(a))
+#define SIMDE_X_TERNARYLOGIC_0x90(a, b, c) (~((b) ^ (c)) & (a))
+#define SIMDE_X_TERNARYLOGIC_0x91(a, b, c) ((b) ^ (~(c) | (~(a) & (b))))
+#define SIMDE_X_TERNARYLOGIC_0x92(a, b, c) (((a) | (c)) & ((a) ^ ((b) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0x93(a, b, c) (((a) & (c)) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0x94(a, b, c) (((a) | (b)) & ((a) ^ ((b) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0x95(a, b, c) (((a) & (b)) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x96(a, b, c) ((a) ^ ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x97(a, b, c) (((a) & ((b) | (c))) ^ ~((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0x98(a, b, c) (~((b) ^ (c)) & ((a) | (b)))
+#define SIMDE_X_TERNARYLOGIC_0x99(a, b, c) ((b) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x9A(a, b, c) ((c) ^ (~(b) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0x9B(a, b, c) (((b) | (~(a) & (c))) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0x9C(a, b, c) ((b) ^ (~(c) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0x9D(a, b, c) ((b) ^ (~(~(a) & (b)) & ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0x9E(a, b, c) (((a) | ((b) & (c))) ^ ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0x9F(a, b, c) (~((a) & ((b) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0xA0(a, b, c) ((a) & (c))
+#define SIMDE_X_TERNARYLOGIC_0xA1(a, b, c) (((a) | (~(c) & (b))) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xA2(a, b, c) (~(~(a) & (b)) & (c))
+#define SIMDE_X_TERNARYLOGIC_0xA3(a, b, c) (((a) | (b)) ^ ~((a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xA4(a, b, c) (~((a) ^ (c)) & ((a) | (b)))
+#define SIMDE_X_TERNARYLOGIC_0xA5(a, b, c) ((a) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xA6(a, b, c) ((c) ^ (~(a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xA7(a, b, c) (((a) | (~(b) & (c))) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xA8(a, b, c) (((a) | (b)) & (c))
+#define SIMDE_X_TERNARYLOGIC_0xA9(a, b, c) (((a) | (b)) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xAA(a, b, c) ((c))
+#define SIMDE_X_TERNARYLOGIC_0xAB(a, b, c) ((c) | ~((a) | (b)))
+#define SIMDE_X_TERNARYLOGIC_0xAC(a, b, c) ((b) ^ (((c) ^ (b)) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0xAD(a, b, c) (((a) | ((b) & (c))) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xAE(a, b, c) ((c) | (~(a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xAF(a, b, c) ((c) | ~(a))
+#define SIMDE_X_TERNARYLOGIC_0xB0(a, b, c) (~(~(c) & (b)) & (a))
+#define SIMDE_X_TERNARYLOGIC_0xB1(a, b, c) (((a) | ~(c)) ^ (~(c) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xB2(a, b, c) (((a) | (c)) ^ ((b) & ((a) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0xB3(a, b, c) (((a) & (c)) | ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xB4(a, b, c) ((a) ^ (~(c) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xB5(a, b, c) ((a) ^ (~(~(b) & (a)) & ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0xB6(a, b, c) (((a) | (c)) ^ (~((a) & (c)) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xB7(a, b, c) (~((b) & ((a) ^ (c))))
+#define SIMDE_X_TERNARYLOGIC_0xB8(a, b, c) ((a) ^ (((c) ^ (a)) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xB9(a, b, c) (((b) | ((a) & (c))) ^ ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xBA(a, b, c) ((c) | (~(b) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0xBB(a, b, c) ((c) | ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xBC(a, b, c) (((a) & (c)) | ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0xBD(a, b, c) (((a) ^ ~(c)) | ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0xBE(a, b, c) ((c) | ((a) ^ (b)))
+#define SIMDE_X_TERNARYLOGIC_0xBF(a, b, c) ((c) | ~((a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xC0(a, b, c) ((a) & (b))
+#define SIMDE_X_TERNARYLOGIC_0xC1(a, b, c) (((a) | (~(b) & (c))) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xC2(a, b, c) (~((a) ^ (b)) & ((a) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0xC3(a, b, c) ((a) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xC4(a, b, c) (~(~(a) & (c)) & (b))
+#define SIMDE_X_TERNARYLOGIC_0xC5(a, b, c) (((a) | (c)) ^ ~((a) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xC6(a, b, c) ((b) ^ (~(a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xC7(a, b, c) (((a) | (~(c) & (b))) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xC8(a, b, c) (((a) | (c)) & (b))
+#define SIMDE_X_TERNARYLOGIC_0xC9(a, b, c) (((a) | (c)) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xCA(a, b, c) ((c) ^ (((b) ^ (c)) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0xCB(a, b, c) (((a) | ((b) & (c))) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xCC(a, b, c) ((b))
+#define SIMDE_X_TERNARYLOGIC_0xCD(a, b, c) ((b) | ~((a) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0xCE(a, b, c) ((b) | (~(a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xCF(a, b, c) ((b) | ~(a))
+#define SIMDE_X_TERNARYLOGIC_0xD0(a, b, c) (~(~(b) & (c)) & (a))
+#define SIMDE_X_TERNARYLOGIC_0xD1(a, b, c) (((a) | ~(b)) ^ (~(b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xD2(a, b, c) ((a) ^ (~(b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xD3(a, b, c) ((a) ^ (~(~(c) & (a)) & ~(b)))
+#define SIMDE_X_TERNARYLOGIC_0xD4(a, b, c) (((a) | (b)) ^ ((c) & ((a) ^ (b))))
+#define SIMDE_X_TERNARYLOGIC_0xD5(a, b, c) (((a) & (b)) | ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xD6(a, b, c) (((a) | (b)) ^ (~((a) & (b)) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xD7(a, b, c) (~((c) & ((a) ^ (b))))
+#define SIMDE_X_TERNARYLOGIC_0xD8(a, b, c) ((a) ^ (((b) ^ (a)) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xD9(a, b, c) ((((a) & (b)) | (c)) ^ ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xDA(a, b, c) (((a) & (b)) | ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0xDB(a, b, c) (((a) ^ ~(b)) | ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0xDC(a, b, c) ((b) | (~(c) & (a)))
+#define SIMDE_X_TERNARYLOGIC_0xDD(a, b, c) ((b) | ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xDE(a, b, c) ((b) | ((a) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0xDF(a, b, c) ((b) | ~((a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xE0(a, b, c) ((a) & ((b) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0xE1(a, b, c) (((b) | (c)) ^ ~(a))
+#define SIMDE_X_TERNARYLOGIC_0xE2(a, b, c) ((c) ^ (((a) ^ (c)) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xE3(a, b, c) ((a) ^ (~((a) & (c)) & ~(b)))
+#define SIMDE_X_TERNARYLOGIC_0xE4(a, b, c) ((b) ^ (((a) ^ (b)) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xE5(a, b, c) ((a) ^ (~((a) & (b)) & ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0xE6(a, b, c) (((a) & (b)) | ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0xE7(a, b, c) (((a) ^ ~(b)) | ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0xE8(a, b, c) (((a) | (b)) & (((a) & (b)) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0xE9(a, b, c) (((a) | (b)) ^ (~((a) & (b)) & ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0xEA(a, b, c) (((a) & (b)) | (c))
+#define SIMDE_X_TERNARYLOGIC_0xEB(a, b, c) (((a) ^ ~(b)) | (c))
+#define SIMDE_X_TERNARYLOGIC_0xEC(a, b, c) ((b) | ((a) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xED(a, b, c) ((b) | ((a) ^ ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0xEE(a, b, c) ((b) | (c))
+#define SIMDE_X_TERNARYLOGIC_0xEF(a, b, c) (((b) | (c)) | ~(a))
+#define SIMDE_X_TERNARYLOGIC_0xF0(a, b, c) ((a))
+#define SIMDE_X_TERNARYLOGIC_0xF1(a, b, c) ((a) | ~((b) | (c)))
+#define SIMDE_X_TERNARYLOGIC_0xF2(a, b, c) ((a) | (~(b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xF3(a, b, c) ((a) | ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xF4(a, b, c) ((a) | (~(c) & (b)))
+#define SIMDE_X_TERNARYLOGIC_0xF5(a, b, c) ((a) | ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xF6(a, b, c) ((a) | ((b) ^ (c)))
+#define SIMDE_X_TERNARYLOGIC_0xF7(a, b, c) ((a) | ~((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xF8(a, b, c) ((a) | ((b) & (c)))
+#define SIMDE_X_TERNARYLOGIC_0xF9(a, b, c) ((a) | ((b) ^ ~(c)))
+#define SIMDE_X_TERNARYLOGIC_0xFA(a, b, c) ((a) | (c))
+#define SIMDE_X_TERNARYLOGIC_0xFB(a, b, c) (((a) | (c)) | ~(b))
+#define SIMDE_X_TERNARYLOGIC_0xFC(a, b, c) ((a) | (b))
+#define SIMDE_X_TERNARYLOGIC_0xFD(a, b, c) (((a) | (b)) | ~(c))
+#define SIMDE_X_TERNARYLOGIC_0xFE(a, b, c) (((a) | (b)) | (c))
+#define SIMDE_X_TERNARYLOGIC_0xFF(a, b, c) (~((a) ^ (a)))
+
+#define SIMDE_X_TERNARYLOGIC_SWITCH(imm8, r, a, b, c) \
+  switch (imm8) { \
+    case 0x00: r = SIMDE_X_TERNARYLOGIC_0x00(a, b, c); break; \
+    case 0x01: r = SIMDE_X_TERNARYLOGIC_0x01(a, b, c); break; \
+    case 0x02: r = SIMDE_X_TERNARYLOGIC_0x02(a, b, c); break; \
+    case 0x03: r = SIMDE_X_TERNARYLOGIC_0x03(a, b, c); break; \
+    case 0x04: r = SIMDE_X_TERNARYLOGIC_0x04(a, b, c); break; \
+    case 0x05: r = SIMDE_X_TERNARYLOGIC_0x05(a, b, c); break; \
+    case 0x06: r = SIMDE_X_TERNARYLOGIC_0x06(a, b, c); break; \
+    case 0x07: r = SIMDE_X_TERNARYLOGIC_0x07(a, b, c); break; \
+    case 0x08: r = SIMDE_X_TERNARYLOGIC_0x08(a, b, c); break; \
+    case 0x09: r = SIMDE_X_TERNARYLOGIC_0x09(a, b, c); break; \
+    case 0x0A: r = SIMDE_X_TERNARYLOGIC_0x0A(a, b, c); break; \
+    case 0x0B: r = SIMDE_X_TERNARYLOGIC_0x0B(a, b, c); break; \
+    case 0x0C: r = SIMDE_X_TERNARYLOGIC_0x0C(a, b, c); break; \
+    case 0x0D: r = SIMDE_X_TERNARYLOGIC_0x0D(a, b, c); break; \
+    case 0x0E: r = SIMDE_X_TERNARYLOGIC_0x0E(a, b, c); break; \
+    case 0x0F: r = SIMDE_X_TERNARYLOGIC_0x0F(a, b, c); break; \
+    case 0x10: r = SIMDE_X_TERNARYLOGIC_0x10(a, b, c); break; \
+    case 0x11: r = SIMDE_X_TERNARYLOGIC_0x11(a, b, c); break; \
+    case 0x12: r = SIMDE_X_TERNARYLOGIC_0x12(a, b, c); break; \
+    case 0x13: r = SIMDE_X_TERNARYLOGIC_0x13(a, b, c); break; \
+    case 0x14: r = SIMDE_X_TERNARYLOGIC_0x14(a, b, c); break; \
+    case 0x15: r = SIMDE_X_TERNARYLOGIC_0x15(a, b, c); break; \
+    case 0x16: r = SIMDE_X_TERNARYLOGIC_0x16(a, b, c); break; \
+    case 0x17: r = SIMDE_X_TERNARYLOGIC_0x17(a, b, c); break; \
+    case 0x18: r = SIMDE_X_TERNARYLOGIC_0x18(a, b, c); break; \
+    case 0x19: r = SIMDE_X_TERNARYLOGIC_0x19(a, b, c); break; \
+    case 0x1A: r = SIMDE_X_TERNARYLOGIC_0x1A(a, b, c); break; \
+    case 0x1B: r = SIMDE_X_TERNARYLOGIC_0x1B(a, b, c); break; \
+    case 0x1C: r = SIMDE_X_TERNARYLOGIC_0x1C(a, b, c); break; \
+    case 0x1D: r = SIMDE_X_TERNARYLOGIC_0x1D(a, b, c); break; \
+    case 0x1E: r = SIMDE_X_TERNARYLOGIC_0x1E(a, b, c); break; \
+    case 0x1F: r = SIMDE_X_TERNARYLOGIC_0x1F(a, b, c); break; \
+    case 0x20: r = SIMDE_X_TERNARYLOGIC_0x20(a, b, c); break; \
+    case 0x21: r = SIMDE_X_TERNARYLOGIC_0x21(a, b, c); break; \
+    case 0x22: r = SIMDE_X_TERNARYLOGIC_0x22(a, b, c); break; \
+    case 0x23: r = SIMDE_X_TERNARYLOGIC_0x23(a, b, c); break; \
+    case 0x24: r = SIMDE_X_TERNARYLOGIC_0x24(a, b, c); break; \
+    case 0x25: r = SIMDE_X_TERNARYLOGIC_0x25(a, b, c); break; \
+    case 0x26: r = SIMDE_X_TERNARYLOGIC_0x26(a, b, c); break; \
+    case 0x27: r = SIMDE_X_TERNARYLOGIC_0x27(a, b, c); break; \
+    case 0x28: r = SIMDE_X_TERNARYLOGIC_0x28(a, b, c); break; \
+    case 0x29: r = SIMDE_X_TERNARYLOGIC_0x29(a, b, c); break; \
+    case 0x2A: r = SIMDE_X_TERNARYLOGIC_0x2A(a, b, c); break; \
+    case 0x2B: r = SIMDE_X_TERNARYLOGIC_0x2B(a, b, c); break; \
+    case 0x2C: r = SIMDE_X_TERNARYLOGIC_0x2C(a, b, c); break; \
+    case 0x2D: r = SIMDE_X_TERNARYLOGIC_0x2D(a, b, c); break; \
+    case 0x2E: r = SIMDE_X_TERNARYLOGIC_0x2E(a, b, c); break; \
+    case 0x2F: r = SIMDE_X_TERNARYLOGIC_0x2F(a, b, c); break; \
+    case 0x30: r = SIMDE_X_TERNARYLOGIC_0x30(a, b, c); break; \
+    case 0x31: r = SIMDE_X_TERNARYLOGIC_0x31(a, b, c); break; \
+    case 0x32: r = SIMDE_X_TERNARYLOGIC_0x32(a, b, c); break; \
+    case 0x33: r = SIMDE_X_TERNARYLOGIC_0x33(a, b, c); break; \
+    case 0x34: r = SIMDE_X_TERNARYLOGIC_0x34(a, b, c); break; \
+    case 0x35: r = SIMDE_X_TERNARYLOGIC_0x35(a, b, c); break; \
+    case 0x36: r = SIMDE_X_TERNARYLOGIC_0x36(a, b, c); break; \
+    case 0x37: r = SIMDE_X_TERNARYLOGIC_0x37(a, b, c); break; \
+    case 0x38: r = SIMDE_X_TERNARYLOGIC_0x38(a, b, c); break; \
+    case 0x39: r = SIMDE_X_TERNARYLOGIC_0x39(a, b, c); break; \
+    case 0x3A: r = SIMDE_X_TERNARYLOGIC_0x3A(a, b, c); break; \
+    case 0x3B: r = SIMDE_X_TERNARYLOGIC_0x3B(a, b, c); break; \
+    case 0x3C: r = SIMDE_X_TERNARYLOGIC_0x3C(a, b, c); break; \
+    case 0x3D: r = SIMDE_X_TERNARYLOGIC_0x3D(a, b, c); break; \
+    case 0x3E: r = SIMDE_X_TERNARYLOGIC_0x3E(a, b, c); break; \
+    case 0x3F: r = SIMDE_X_TERNARYLOGIC_0x3F(a, b, c); break; \
+    case 0x40: r = SIMDE_X_TERNARYLOGIC_0x40(a, b, c); break; \
+    case 0x41: r = SIMDE_X_TERNARYLOGIC_0x41(a, b, c); break; \
+    case 0x42: r = SIMDE_X_TERNARYLOGIC_0x42(a, b, c); break; \
+    case 0x43: r = SIMDE_X_TERNARYLOGIC_0x43(a, b, c); break; \
+    case 0x44: r = SIMDE_X_TERNARYLOGIC_0x44(a, b, c); break; \
+    case 0x45: r = SIMDE_X_TERNARYLOGIC_0x45(a, b, c); break; \
+    case 0x46: r = SIMDE_X_TERNARYLOGIC_0x46(a, b, c); break; \
+    case 0x47: r = SIMDE_X_TERNARYLOGIC_0x47(a, b, c); break; \
+    case 0x48: r = SIMDE_X_TERNARYLOGIC_0x48(a, b, c); break; \
+    case 0x49: r = SIMDE_X_TERNARYLOGIC_0x49(a, b, c); break; \
+    case 0x4A: r = SIMDE_X_TERNARYLOGIC_0x4A(a, b, c); break; \
+    case 0x4B: r = SIMDE_X_TERNARYLOGIC_0x4B(a, b, c); break; \
+    case 0x4C: r = SIMDE_X_TERNARYLOGIC_0x4C(a, b, c); break; \
+    case 0x4D: r = SIMDE_X_TERNARYLOGIC_0x4D(a, b, c); break; \
+    case 0x4E: r = SIMDE_X_TERNARYLOGIC_0x4E(a, b, c); break; \
+    case 0x4F: r = SIMDE_X_TERNARYLOGIC_0x4F(a, b, c); break; \
+    case 0x50: r = SIMDE_X_TERNARYLOGIC_0x50(a, b, c); break; \
+    case 0x51: r = SIMDE_X_TERNARYLOGIC_0x51(a, b, c); break; \
+    case 0x52: r = SIMDE_X_TERNARYLOGIC_0x52(a, b, c); break; \
+    case 0x53: r = SIMDE_X_TERNARYLOGIC_0x53(a, b, c); break; \
+    case 0x54: r = SIMDE_X_TERNARYLOGIC_0x54(a, b, c); break; \
+    case 0x55: r = SIMDE_X_TERNARYLOGIC_0x55(a, b, c); break; \
+    case 0x56: r = SIMDE_X_TERNARYLOGIC_0x56(a, b, c); break; \
+    case 0x57: r = SIMDE_X_TERNARYLOGIC_0x57(a, b, c); break; \
+    case 0x58: r = SIMDE_X_TERNARYLOGIC_0x58(a, b, c); break; \
+    case 0x59: r = SIMDE_X_TERNARYLOGIC_0x59(a, b, c); break; \
+    case 0x5A: r = SIMDE_X_TERNARYLOGIC_0x5A(a, b, c); break; \
+    case 0x5B: r = SIMDE_X_TERNARYLOGIC_0x5B(a, b, c); break; \
+    case 0x5C: r = SIMDE_X_TERNARYLOGIC_0x5C(a, b, c); break; \
+    case 0x5D: r = SIMDE_X_TERNARYLOGIC_0x5D(a, b, c); break; \
+    case 0x5E: r = SIMDE_X_TERNARYLOGIC_0x5E(a, b, c); break; \
+    case 0x5F: r = SIMDE_X_TERNARYLOGIC_0x5F(a, b, c); break; \
+    case 0x60: r = SIMDE_X_TERNARYLOGIC_0x60(a, b, c); break; \
+    case 0x61: r = SIMDE_X_TERNARYLOGIC_0x61(a, b, c); break; \
+    case 0x62: r = SIMDE_X_TERNARYLOGIC_0x62(a, b, c); break; \
+    case 0x63: r = SIMDE_X_TERNARYLOGIC_0x63(a, b, c); break; \
+    case 0x64: r = SIMDE_X_TERNARYLOGIC_0x64(a, b, c); break; \
+    case 0x65: r = SIMDE_X_TERNARYLOGIC_0x65(a, b, c); break; \
+    case 0x66: r = SIMDE_X_TERNARYLOGIC_0x66(a, b, c); break; \
+    case 0x67: r = SIMDE_X_TERNARYLOGIC_0x67(a, b, c); break; \
+    case 0x68: r = SIMDE_X_TERNARYLOGIC_0x68(a, b, c); break; \
+    case 0x69: r = SIMDE_X_TERNARYLOGIC_0x69(a, b, c); break; \
+    case 0x6A: r = SIMDE_X_TERNARYLOGIC_0x6A(a, b, c); break; \
+    case 0x6B: r = SIMDE_X_TERNARYLOGIC_0x6B(a, b, c); break; \
+    case 0x6C: r = SIMDE_X_TERNARYLOGIC_0x6C(a, b, c); break; \
+    case 0x6D: r = SIMDE_X_TERNARYLOGIC_0x6D(a, b, c); break; \
+    case 0x6E: r = SIMDE_X_TERNARYLOGIC_0x6E(a, b, c); break; \
+    case 0x6F: r = SIMDE_X_TERNARYLOGIC_0x6F(a, b, c); break; \
+    case 0x70: r = SIMDE_X_TERNARYLOGIC_0x70(a, b, c); break; \
+    case 0x71: r = SIMDE_X_TERNARYLOGIC_0x71(a, b, c); break; \
+    case 0x72: r = SIMDE_X_TERNARYLOGIC_0x72(a, b, c); break; \
+    case 0x73: r = SIMDE_X_TERNARYLOGIC_0x73(a, b, c); break; \
+    case 0x74: r = SIMDE_X_TERNARYLOGIC_0x74(a, b, c); break; \
+    case 0x75: r = SIMDE_X_TERNARYLOGIC_0x75(a, b, c); break; \
+    case 0x76: r = SIMDE_X_TERNARYLOGIC_0x76(a, b, c); break; \
+    case 0x77: r = SIMDE_X_TERNARYLOGIC_0x77(a, b, c); break; \
+    case 0x78: r = SIMDE_X_TERNARYLOGIC_0x78(a, b, c); break; \
+    case 0x79: r = SIMDE_X_TERNARYLOGIC_0x79(a, b, c); break; \
+    case 0x7A: r = SIMDE_X_TERNARYLOGIC_0x7A(a, b, c); break; \
+    case 0x7B: r = SIMDE_X_TERNARYLOGIC_0x7B(a, b, c); break; \
+    case 0x7C: r = SIMDE_X_TERNARYLOGIC_0x7C(a, b, c); break; \
+    case 0x7D: r = SIMDE_X_TERNARYLOGIC_0x7D(a, b, c); break; \
+    case 0x7E: r = SIMDE_X_TERNARYLOGIC_0x7E(a, b, c); break; \
+    case 0x7F: r = SIMDE_X_TERNARYLOGIC_0x7F(a, b, c); break; \
+    case 0x80: r = SIMDE_X_TERNARYLOGIC_0x80(a, b, c); break; \
+    case 0x81: r = SIMDE_X_TERNARYLOGIC_0x81(a, b, c); break; \
+    case 0x82: r = SIMDE_X_TERNARYLOGIC_0x82(a, b, c); break; \
+    case 0x83: r = SIMDE_X_TERNARYLOGIC_0x83(a, b, c); break; \
+    case 0x84: r = SIMDE_X_TERNARYLOGIC_0x84(a, b, c); break; \
+    case 0x85: r = SIMDE_X_TERNARYLOGIC_0x85(a, b, c); break; \
+    case 0x86: r = SIMDE_X_TERNARYLOGIC_0x86(a, b, c); break; \
+    case 0x87: r = SIMDE_X_TERNARYLOGIC_0x87(a, b, c); break; \
+    case 0x88: r = SIMDE_X_TERNARYLOGIC_0x88(a, b, c); break; \
+    case 0x89: r = SIMDE_X_TERNARYLOGIC_0x89(a, b, c); break; \
+    case 0x8A: r = SIMDE_X_TERNARYLOGIC_0x8A(a, b, c); break; \
+    case 0x8B: r = SIMDE_X_TERNARYLOGIC_0x8B(a, b, c); break; \
+    case 0x8C: r = SIMDE_X_TERNARYLOGIC_0x8C(a, b, c); break; \
+    case 0x8D: r = SIMDE_X_TERNARYLOGIC_0x8D(a, b, c); break; \
+    case 0x8E: r = SIMDE_X_TERNARYLOGIC_0x8E(a, b, c); break; \
+    case 0x8F: r = SIMDE_X_TERNARYLOGIC_0x8F(a, b, c); break; \
+    case 0x90: r = SIMDE_X_TERNARYLOGIC_0x90(a, b, c); break; \
+    case 0x91: r = SIMDE_X_TERNARYLOGIC_0x91(a, b, c); break; \
+    case 0x92: r = SIMDE_X_TERNARYLOGIC_0x92(a, b, c); break; \
+    case 0x93: r = SIMDE_X_TERNARYLOGIC_0x93(a, b, c); break; \
+    case 0x94: r = SIMDE_X_TERNARYLOGIC_0x94(a, b, c); break; \
+    case 0x95: r = SIMDE_X_TERNARYLOGIC_0x95(a, b, c); break; \
+    case 0x96: r = SIMDE_X_TERNARYLOGIC_0x96(a, b, c); break; \
+    case 0x97: r = SIMDE_X_TERNARYLOGIC_0x97(a, b, c); break; \
+    case 0x98: r = SIMDE_X_TERNARYLOGIC_0x98(a, b, c); break; \
+    case 0x99: r = SIMDE_X_TERNARYLOGIC_0x99(a, b, c); break; \
+    case 0x9A: r = SIMDE_X_TERNARYLOGIC_0x9A(a, b, c); break; \
+    case 0x9B: r = SIMDE_X_TERNARYLOGIC_0x9B(a, b, c); break; \
+    case 0x9C: r = SIMDE_X_TERNARYLOGIC_0x9C(a, b, c); break; \
+    case 0x9D: r = SIMDE_X_TERNARYLOGIC_0x9D(a, b, c); break; \
+    case 0x9E: r = SIMDE_X_TERNARYLOGIC_0x9E(a, b, c); break; \
+    case 0x9F: r = SIMDE_X_TERNARYLOGIC_0x9F(a, b, c); break; \
+    case 0xA0: r = SIMDE_X_TERNARYLOGIC_0xA0(a, b, c); break; \
+    case 0xA1: r = SIMDE_X_TERNARYLOGIC_0xA1(a, b, c); break; \
+    case 0xA2: r = SIMDE_X_TERNARYLOGIC_0xA2(a, b, c); break; \
+    case 0xA3: r = SIMDE_X_TERNARYLOGIC_0xA3(a, b, c); break; \
+    case 0xA4: r = SIMDE_X_TERNARYLOGIC_0xA4(a, b, c); break; \
+    case 0xA5: r = SIMDE_X_TERNARYLOGIC_0xA5(a, b, c); break; \
+    case 0xA6: r = SIMDE_X_TERNARYLOGIC_0xA6(a, b, c); break; \
+    case 0xA7: r = SIMDE_X_TERNARYLOGIC_0xA7(a, b, c); break; \
+    case 0xA8: r = SIMDE_X_TERNARYLOGIC_0xA8(a, b, c); break; \
+    case 0xA9: r = SIMDE_X_TERNARYLOGIC_0xA9(a, b, c); break; \
+    case 0xAA: r = SIMDE_X_TERNARYLOGIC_0xAA(a, b, c); break; \
+    case 0xAB: r = SIMDE_X_TERNARYLOGIC_0xAB(a, b, c); break; \
+    case 0xAC: r = SIMDE_X_TERNARYLOGIC_0xAC(a, b, c); break; \
+    case 0xAD: r = SIMDE_X_TERNARYLOGIC_0xAD(a, b, c); break; \
+    case 0xAE: r = SIMDE_X_TERNARYLOGIC_0xAE(a, b, c); break; \
+    case 0xAF: r = SIMDE_X_TERNARYLOGIC_0xAF(a, b, c); break; \
+    case 0xB0: r = SIMDE_X_TERNARYLOGIC_0xB0(a, b, c); break; \
+    case 0xB1: r = SIMDE_X_TERNARYLOGIC_0xB1(a, b, c); break; \
+    case 0xB2: r = SIMDE_X_TERNARYLOGIC_0xB2(a, b, c); break; \
+    case 0xB3: r = SIMDE_X_TERNARYLOGIC_0xB3(a, b, c); break; \
+    case 0xB4: r = SIMDE_X_TERNARYLOGIC_0xB4(a, b, c); break; \
+    case 0xB5: r = SIMDE_X_TERNARYLOGIC_0xB5(a, b, c); break; \
+    case 0xB6: r = SIMDE_X_TERNARYLOGIC_0xB6(a, b, c); break; \
+    case 0xB7: r = SIMDE_X_TERNARYLOGIC_0xB7(a, b, c); break; \
+    case 0xB8: r = SIMDE_X_TERNARYLOGIC_0xB8(a, b, c); break; \
+    case 0xB9: r = SIMDE_X_TERNARYLOGIC_0xB9(a, b, c); break; \
+    case 0xBA: r = SIMDE_X_TERNARYLOGIC_0xBA(a, b, c); break; \
+    case 0xBB: r = SIMDE_X_TERNARYLOGIC_0xBB(a, b, c); break; \
+    case 0xBC: r = SIMDE_X_TERNARYLOGIC_0xBC(a, b, c); break; \
+    case 0xBD: r = SIMDE_X_TERNARYLOGIC_0xBD(a, b, c); break; \
+    case 0xBE: r = SIMDE_X_TERNARYLOGIC_0xBE(a, b, c); break; \
+    case 0xBF: r = SIMDE_X_TERNARYLOGIC_0xBF(a, b, c); break; \
+    case 0xC0: r = SIMDE_X_TERNARYLOGIC_0xC0(a, b, c); break; \
+    case 0xC1: r = SIMDE_X_TERNARYLOGIC_0xC1(a, b, c); break; \
+    case 0xC2: r = SIMDE_X_TERNARYLOGIC_0xC2(a, b, c); break; \
+    case 0xC3: r = SIMDE_X_TERNARYLOGIC_0xC3(a, b, c); break; \
+    case 0xC4: r = SIMDE_X_TERNARYLOGIC_0xC4(a, b, c); break; \
+    case 0xC5: r = SIMDE_X_TERNARYLOGIC_0xC5(a, b, c); break; \
+    case 0xC6: r = SIMDE_X_TERNARYLOGIC_0xC6(a, b, c); break; \
+    case 0xC7: r = SIMDE_X_TERNARYLOGIC_0xC7(a, b, c); break; \
+    case 0xC8: r = SIMDE_X_TERNARYLOGIC_0xC8(a, b, c); break; \
+    case 0xC9: r = SIMDE_X_TERNARYLOGIC_0xC9(a, b, c); break; \
+    case 0xCA: r = SIMDE_X_TERNARYLOGIC_0xCA(a, b, c); break; \
+    case 0xCB: r = SIMDE_X_TERNARYLOGIC_0xCB(a, b, c); break; \
+    case 0xCC: r = SIMDE_X_TERNARYLOGIC_0xCC(a, b, c); break; \
+    case 0xCD: r = SIMDE_X_TERNARYLOGIC_0xCD(a, b, c); break; \
+    case 0xCE: r = SIMDE_X_TERNARYLOGIC_0xCE(a, b, c); break; \
+    case 0xCF: r = SIMDE_X_TERNARYLOGIC_0xCF(a, b, c); break; \
+    case 0xD0: r = SIMDE_X_TERNARYLOGIC_0xD0(a, b, c); break; \
+    case 0xD1: r = SIMDE_X_TERNARYLOGIC_0xD1(a, b, c); break; \
+    case 0xD2: r = SIMDE_X_TERNARYLOGIC_0xD2(a, b, c); break; \
+    case 0xD3: r = SIMDE_X_TERNARYLOGIC_0xD3(a, b, c); break; \
+    case 0xD4: r = SIMDE_X_TERNARYLOGIC_0xD4(a, b, c); break; \
+    case 0xD5: r = SIMDE_X_TERNARYLOGIC_0xD5(a, b, c); break; \
+    case 0xD6: r = SIMDE_X_TERNARYLOGIC_0xD6(a, b, c); break; \
+    case 0xD7: r = SIMDE_X_TERNARYLOGIC_0xD7(a, b, c); break; \
+    case 0xD8: r = SIMDE_X_TERNARYLOGIC_0xD8(a, b, c); break; \
+    case 0xD9: r = SIMDE_X_TERNARYLOGIC_0xD9(a, b, c); break; \
+    case 0xDA: r = SIMDE_X_TERNARYLOGIC_0xDA(a, b, c); break; \
+    case 0xDB: r = SIMDE_X_TERNARYLOGIC_0xDB(a, b, c); break; \
+    case 0xDC: r = SIMDE_X_TERNARYLOGIC_0xDC(a, b, c); break; \
+    case 0xDD: r = SIMDE_X_TERNARYLOGIC_0xDD(a, b, c); break; \
+    case 0xDE: r = SIMDE_X_TERNARYLOGIC_0xDE(a, b, c); break; \
+    case 0xDF: r = SIMDE_X_TERNARYLOGIC_0xDF(a, b, c); break; \
+    case 0xE0: r = SIMDE_X_TERNARYLOGIC_0xE0(a, b, c); break; \
+    case 0xE1: r = SIMDE_X_TERNARYLOGIC_0xE1(a, b, c); break; \
+    case 0xE2: r = SIMDE_X_TERNARYLOGIC_0xE2(a, b, c); break; \
+    case 0xE3: r = SIMDE_X_TERNARYLOGIC_0xE3(a, b, c); break; \
+    case 0xE4: r = SIMDE_X_TERNARYLOGIC_0xE4(a, b, c); break; \
+    case 0xE5: r = SIMDE_X_TERNARYLOGIC_0xE5(a, b, c); break; \
+    case 0xE6: r = SIMDE_X_TERNARYLOGIC_0xE6(a, b, c); break; \
+    case 0xE7: r = SIMDE_X_TERNARYLOGIC_0xE7(a, b, c); break; \
+    case 0xE8: r = SIMDE_X_TERNARYLOGIC_0xE8(a, b, c); break; \
+    case 0xE9: r = SIMDE_X_TERNARYLOGIC_0xE9(a, b, c); break; \
+    case 0xEA: r = SIMDE_X_TERNARYLOGIC_0xEA(a, b, c); break; \
+    case 0xEB: r = SIMDE_X_TERNARYLOGIC_0xEB(a, b, c); break; \
+    case 0xEC: r = SIMDE_X_TERNARYLOGIC_0xEC(a, b, c); break; \
+    case 0xED: r = SIMDE_X_TERNARYLOGIC_0xED(a, b, c); break; \
+    case 0xEE: r = SIMDE_X_TERNARYLOGIC_0xEE(a, b, c); break; \
+    case 0xEF: r = SIMDE_X_TERNARYLOGIC_0xEF(a, b, c); break; \
+    case 0xF0: r = SIMDE_X_TERNARYLOGIC_0xF0(a, b, c); break; \
+    case 0xF1: r = SIMDE_X_TERNARYLOGIC_0xF1(a, b, c); break; \
+    case 0xF2: r = SIMDE_X_TERNARYLOGIC_0xF2(a, b, c); break; \
+    case 0xF3: r = SIMDE_X_TERNARYLOGIC_0xF3(a, b, c); break; \
+    case 0xF4: r = SIMDE_X_TERNARYLOGIC_0xF4(a, b, c); break; \
+    case 0xF5: r = SIMDE_X_TERNARYLOGIC_0xF5(a, b, c); break; \
+    case 0xF6: r = SIMDE_X_TERNARYLOGIC_0xF6(a, b, c); break; \
+    case 0xF7: r = SIMDE_X_TERNARYLOGIC_0xF7(a, b, c); break; \
+    case 0xF8: r = SIMDE_X_TERNARYLOGIC_0xF8(a, b, c); break; \
+    case 0xF9: r = SIMDE_X_TERNARYLOGIC_0xF9(a, b, c); break; \
+    case 0xFA: r = SIMDE_X_TERNARYLOGIC_0xFA(a, b, c); break; \
+    case 0xFB: r = SIMDE_X_TERNARYLOGIC_0xFB(a, b, c); break; \
+    case 0xFC: r = SIMDE_X_TERNARYLOGIC_0xFC(a, b, c); break; \
+    case 0xFD: r = SIMDE_X_TERNARYLOGIC_0xFD(a, b, c); break; \
+    case 0xFE: r = SIMDE_X_TERNARYLOGIC_0xFE(a, b, c); break; \
+    case 0xFF: r = SIMDE_X_TERNARYLOGIC_0xFF(a, b, c); break; \
+    default: HEDLEY_UNREACHABLE(); break; \
+  }
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_ternarylogic_epi32 (simde__m512i a, simde__m512i b, simde__m512i c, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b),
+    c_ = simde__m512i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_SWITCH(imm8, r_.i32f, a_.i32f, b_.i32f, c_.i32f)
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_SWITCH(imm8, r_.i32f[i], a_.i32f[i], b_.i32f[i], c_.i32f[i])
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_ternarylogic_epi32(a, b, c, imm8) _mm512_ternarylogic_epi32(a, b, c, imm8)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_ternarylogic_epi32(a, b, c, imm8) simde_mm512_ternarylogic_epi32(a, b, c, imm8)
+#endif
+
+/* imm8 has to stay a constant expression all the way down to the
+   native or emulated ternarylogic, so the masked versions (and the
+   64-bit version, which doesn't care about element size without a
+   mask) are macros. */
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm512_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#  define simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#  define simde_mm512_ternarylogic_epi64(a, b, c, imm8) _mm512_ternarylogic_epi64(a, b, c, imm8)
+#  define simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm512_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#  define simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#else
+#  define simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_ternarylogic_epi32(src, a, b, imm8))
+#  define simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_ternarylogic_epi32(a, b, c, imm8))
+#  define simde_mm512_ternarylogic_epi64(a, b, c, imm8) simde_mm512_ternarylogic_epi32(a, b, c, imm8)
+#  define simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_ternarylogic_epi32(src, a, b, imm8))
+#  define simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_ternarylogic_epi32(a, b, c, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#  define _mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#  define _mm512_ternarylogic_epi64(a, b, c, imm8) simde_mm512_ternarylogic_epi64(a, b, c, imm8)
+#  define _mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#  define _mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_test_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_test_epi32_mask(k1, a, b);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+    simde__mmask16 r = 0;
+
+    SIMDE__VECTORIZE_REDUCTION(|:r)
+    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+      r |= !!(a_.i32[i] & b_.i32[i]) << i;
+    }
+
+    return r & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_test_epi32_mask(a, b) simde_mm512_mask_test_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde__m512i_private_to_mmask16 (simde__m512i_private a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    HEDLEY_UNREACHABLE_RETURN(0);
+  #else
+    simde__mmask16 r = 0;
+
+    /* Note: using addition instead of a bitwise or for the reduction
+       seems like it should improve things since hardware support for
+       horizontal addition is better than bitwise or.  However, GCC
+       generates the same code, and clang is actually a bit slower.
+       I suspect this can be optimized quite a bit, and this function
+       is probably going to be pretty hot. */
+    SIMDE__VECTORIZE_REDUCTION(|:r)
+    for (size_t i = 0 ; i < (sizeof(a.i32) / sizeof(a.i32[0])) ; i++) {
+      r |= !!(a.i32[i]) << i;
+    }
+
+    return r;
+  #endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde__m512i_private_to_mmask8 (simde__m512i_private a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    HEDLEY_UNREACHABLE_RETURN(0);
+  #else
+    simde__mmask8 r = 0;
+    SIMDE__VECTORIZE_REDUCTION(|:r)
+    for (size_t i = 0 ; i < (sizeof(a.i64) / sizeof(a.i64[0])) ; i++) {
+      r |= !!(a.i64[i]) << i;
+    }
+
+    return r;
+  #endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_and_si512 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_and_si512(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_AVX2)
+  r_.m256i[0] = simde_mm256_and_si256(a_.m256i[0], b_.m256i[0]);
+  r_.m256i[1] = simde_mm256_and_si256(a_.m256i[1], b_.m256i[1]);
+#elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.i32f = a_.i32f & b_.i32f;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] = a_.i32[i] & b_.i32[i];
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_and_si512(a, b) simde_mm512_and_si512(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_and_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_and_epi32(a, b);
+  #else
+    return simde_mm512_and_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_and_epi32(a, b) simde_mm512_and_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_and_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_and_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_and_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_and_epi32(src, k, a, b) simde_mm512_mask_and_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_and_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_and_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_and_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_and_epi32(k, a, b) simde_mm512_maskz_and_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_and_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_and_epi64(a, b);
+  #else
+    return simde_mm512_and_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_and_epi64(a, b) simde_mm512_and_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_and_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_and_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_and_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_and_epi64(src, k, a, b) simde_mm512_mask_and_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_and_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_and_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_and_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_and_epi64(k, a, b) simde_mm512_maskz_and_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_andnot_si512 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_andnot_si512(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_AVX2)
+  r_.m256i[0] = simde_mm256_andnot_si256(a_.m256i[0], b_.m256i[0]);
+  r_.m256i[1] = simde_mm256_andnot_si256(a_.m256i[1], b_.m256i[1]);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+    r_.i32f[i] = ~(a_.i32f[i]) & b_.i32f[i];
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_andnot_si512(a, b) simde_mm512_andnot_si512(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_andnot_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_andnot_epi32(a, b);
+  #else
+    return simde_mm512_andnot_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_andnot_epi32(a, b) simde_mm512_andnot_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_andnot_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_andnot_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_andnot_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_andnot_epi32(src, k, a, b) simde_mm512_mask_andnot_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_andnot_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_andnot_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_andnot_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_andnot_epi32(k, a, b) simde_mm512_maskz_andnot_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_andnot_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_andnot_epi64(a, b);
+  #else
+    return simde_mm512_andnot_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_andnot_epi64(a, b) simde_mm512_andnot_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_andnot_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_andnot_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_andnot_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_andnot_epi64(src, k, a, b) simde_mm512_mask_andnot_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_andnot_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_andnot_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_andnot_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_andnot_epi64(k, a, b) simde_mm512_maskz_andnot_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_add_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_add_epi32(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.i32 = a_.i32 + b_.i32;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_add_epi32(a_.m256i[i], b_.m256i[i]);
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_add_epi32(a, b) simde_mm512_add_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_add_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_add_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_add_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_add_epi32(src, k, a, b) simde_mm512_mask_add_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_add_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_add_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_add_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_add_epi32(k, a, b) simde_mm512_maskz_add_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_add_epi64 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_add_epi64(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.i64 = a_.i64 + b_.i64;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_add_epi64(a_.m256i[i], b_.m256i[i]);
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_add_epi64(a, b) simde_mm512_add_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_add_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_add_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_add_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_add_epi64(src, k, a, b) simde_mm512_mask_add_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_add_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_add_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_add_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_add_epi64(k, a, b) simde_mm512_maskz_add_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_add_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_add_ps(a, b);
+#else
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f32 = a_.f32 + b_.f32;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+    r_.m256[i] = simde_mm256_add_ps(a_.m256[i], b_.m256[i]);
+  }
+#endif
+
+  return simde__m512_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_add_ps(a, b) simde_mm512_add_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_add_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_add_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_add_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_add_ps(src, k, a, b) simde_mm512_mask_add_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_add_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_add_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_add_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_add_ps(k, a, b) simde_mm512_maskz_add_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_add_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_add_pd(a, b);
+#else
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f64 = a_.f64 + b_.f64;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+    r_.m256d[i] = simde_mm256_add_pd(a_.m256d[i], b_.m256d[i]);
+  }
+#endif
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_add_pd(a, b) simde_mm512_add_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_add_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_add_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_add_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_add_pd(src, k, a, b) simde_mm512_mask_add_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_add_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_add_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_add_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_add_pd(k, a, b) simde_mm512_maskz_add_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sub_epi32 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_sub_epi32(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.i32 = a_.i32 - b_.i32;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_sub_epi32(a_.m256i[i], b_.m256i[i]);
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sub_epi32(a, b) simde_mm512_sub_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sub_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sub_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_sub_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sub_epi32(src, k, a, b) simde_mm512_mask_sub_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sub_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sub_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_sub_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sub_epi32(k, a, b) simde_mm512_maskz_sub_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sub_epi64 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_sub_epi64(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.i64 = a_.i64 - b_.i64;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+    r_.m256i[i] = simde_mm256_sub_epi64(a_.m256i[i], b_.m256i[i]);
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sub_epi64(a, b) simde_mm512_sub_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sub_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sub_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_sub_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sub_epi64(src, k, a, b) simde_mm512_mask_sub_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sub_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sub_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_sub_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sub_epi64(k, a, b) simde_mm512_maskz_sub_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_sub_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_sub_ps(a, b);
+#else
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f32 = a_.f32 - b_.f32;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+    r_.m256[i] = simde_mm256_sub_ps(a_.m256[i], b_.m256[i]);
+  }
+#endif
+
+  return simde__m512_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sub_ps(a, b) simde_mm512_sub_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_sub_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sub_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_sub_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sub_ps(src, k, a, b) simde_mm512_mask_sub_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_sub_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sub_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_sub_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sub_ps(k, a, b) simde_mm512_maskz_sub_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_sub_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_sub_pd(a, b);
+#else
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f64 = a_.f64 - b_.f64;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+    r_.m256d[i] = simde_mm256_sub_pd(a_.m256d[i], b_.m256d[i]);
+  }
+#endif
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sub_pd(a, b) simde_mm512_sub_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_sub_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sub_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_sub_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sub_pd(src, k, a, b) simde_mm512_mask_sub_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_sub_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sub_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_sub_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sub_pd(k, a, b) simde_mm512_maskz_sub_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpeq_epi32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpeq_epi32_mask(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpeq_epi32(a_.m256i[i], b_.m256i[i]);
+    }
+
+    return simde__m512i_private_to_mmask16(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpeq_epi32_mask(a, b) simde_mm512_cmpeq_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpeq_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpeq_epi32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpeq_epi32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epi32_mask(k1, a, b) simde_mm512_mask_cmpeq_epi32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpeq_epi64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpeq_epi64_mask(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpeq_epi64(a_.m256i[i], b_.m256i[i]);
+    }
+
+    return simde__m512i_private_to_mmask8(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpeq_epi64_mask(a, b) simde_mm512_cmpeq_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpeq_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpeq_epi64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpeq_epi64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epi64_mask(k1, a, b) simde_mm512_mask_cmpeq_epi64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpgt_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpgt_epi32_mask(k1, a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpgt_epi32(a_.m256i[i], b_.m256i[i]);
+    }
+
+    return simde__m512i_private_to_mmask16(r_) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epi32_mask(k1, a, b) simde_mm512_mask_cmpgt_epi32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpgt_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpgt_epi64_mask(k1, a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cmpgt_epi64(a_.m256i[i], b_.m256i[i]);
+    }
+
+    return simde__m512i_private_to_mmask8(r_) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epi64_mask(k1, a, b) simde_mm512_mask_cmpgt_epi64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_cvtepi8_epi32 (simde__m128i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cvtepi8_epi32(a);
+#else
+  simde__m512i_private r_;
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+
+#if defined(SIMDE__CONVERT_VECTOR)
+  SIMDE__CONVERT_VECTOR(r_.i32, a_.i8);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] = a_.i8[i];
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi8_epi32(a) simde_mm512_cvtepi8_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_cvtepi8_epi32 (simde__m512i src, simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cvtepi8_epi32(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_cvtepi8_epi32(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvtepi8_epi32(src, k, a) simde_mm512_mask_cvtepi8_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_cvtepi8_epi32 (simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_cvtepi8_epi32(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_cvtepi8_epi32(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvtepi8_epi32(k, a) simde_mm512_maskz_cvtepi8_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_cvtepi8_epi64 (simde__m128i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cvtepi8_epi64(a);
+#else
+  simde__m512i_private r_;
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+
+#if defined(SIMDE__CONVERT_VECTOR)
+  SIMDE__CONVERT_VECTOR(r_.i64, a_.m64_private[0].i8);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    r_.i64[i] = a_.i8[i];
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi8_epi64(a) simde_mm512_cvtepi8_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_cvtepi8_epi64 (simde__m512i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cvtepi8_epi64(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_cvtepi8_epi64(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvtepi8_epi64(src, k, a) simde_mm512_mask_cvtepi8_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_cvtepi8_epi64 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_cvtepi8_epi64(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_cvtepi8_epi64(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvtepi8_epi64(k, a) simde_mm512_maskz_cvtepi8_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_cvtepi32_epi8 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cvtepi32_epi8(a);
+#else
+  simde__m128i_private r_;
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+#if defined(SIMDE__CONVERT_VECTOR)
+  SIMDE__CONVERT_VECTOR(r_.i8, a_.i32);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, a_.i32[i]);
+  }
+#endif
+
+  return simde__m128i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi32_epi8(a) simde_mm512_cvtepi32_epi8(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_mask_cvtepi32_epi8 (simde__m128i src, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cvtepi32_epi8(src, k, a);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(simde_mm512_cvtepi32_epi8(a)),
+      src_ = simde__m128i_to_private(src);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+      const int8_t m = -HEDLEY_STATIC_CAST(int8_t, (k >> i) & 1);
+      r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, (r_.i8[i] & m) | (src_.i8[i] & ~m));
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvtepi32_epi8(src, k, a) simde_mm512_mask_cvtepi32_epi8(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_maskz_cvtepi32_epi8 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_cvtepi32_epi8(k, a);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(simde_mm512_cvtepi32_epi8(a));
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+      const int8_t m = -HEDLEY_STATIC_CAST(int8_t, (k >> i) & 1);
+      r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, r_.i8[i] & m);
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvtepi32_epi8(k, a) simde_mm512_maskz_cvtepi32_epi8(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_cvtepi32_epi16 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cvtepi32_epi16(a);
+#else
+  simde__m256i_private r_;
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+#if defined(SIMDE__CONVERT_VECTOR)
+  SIMDE__CONVERT_VECTOR(r_.i16, a_.i32);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, a_.i32[i]);
+  }
+#endif
+
+  return simde__m256i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi32_epi16(a) simde_mm512_cvtepi32_epi16(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_mask_cvtepi32_epi16 (simde__m256i src, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cvtepi32_epi16(src, k, a);
+  #else
+    simde__m256i_private
+      r_ = simde__m256i_to_private(simde_mm512_cvtepi32_epi16(a)),
+      src_ = simde__m256i_to_private(src);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      const int16_t m = -HEDLEY_STATIC_CAST(int16_t, (k >> i) & 1);
+      r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, (r_.i16[i] & m) | (src_.i16[i] & ~m));
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvtepi32_epi16(src, k, a) simde_mm512_mask_cvtepi32_epi16(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_maskz_cvtepi32_epi16 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_cvtepi32_epi16(k, a);
+  #else
+    simde__m256i_private
+      r_ = simde__m256i_to_private(simde_mm512_cvtepi32_epi16(a));
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      const int16_t m = -HEDLEY_STATIC_CAST(int16_t, (k >> i) & 1);
+      r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, r_.i16[i] & m);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvtepi32_epi16(k, a) simde_mm512_maskz_cvtepi32_epi16(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_cvtepi64_epi8 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cvtepi64_epi8(a);
+#else
+  simde__m128i_private r_ = simde__m128i_to_private(simde_mm_setzero_si128());
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+#if defined(SIMDE__CONVERT_VECTOR)
+  SIMDE__CONVERT_VECTOR(r_.m64_private[0].i8, a_.i64);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, a_.i64[i]);
+  }
+#endif
+
+  return simde__m128i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi64_epi8(a) simde_mm512_cvtepi64_epi8(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_mask_cvtepi64_epi8 (simde__m128i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cvtepi64_epi8(src, k, a);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(simde_mm512_cvtepi64_epi8(a)),
+      src_ = simde__m128i_to_private(src);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 8 ; i++) {
+      const int8_t m = -HEDLEY_STATIC_CAST(int8_t, (k >> i) & 1);
+      r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, (r_.i8[i] & m) | (src_.i8[i] & ~m));
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvtepi64_epi8(src, k, a) simde_mm512_mask_cvtepi64_epi8(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_maskz_cvtepi64_epi8 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_cvtepi64_epi8(k, a);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(simde_mm512_cvtepi64_epi8(a));
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 8 ; i++) {
+      const int8_t m = -HEDLEY_STATIC_CAST(int8_t, (k >> i) & 1);
+      r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, r_.i8[i] & m);
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvtepi64_epi8(k, a) simde_mm512_maskz_cvtepi64_epi8(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_cvtepi64_epi16 (simde__m512i a) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_cvtepi64_epi16(a);
+#else
+  simde__m128i_private r_ = simde__m128i_to_private(simde_mm_setzero_si128());
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+#if defined(SIMDE__CONVERT_VECTOR)
+  SIMDE__CONVERT_VECTOR(r_.i16, a_.i64);
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, a_.i64[i]);
+  }
+#endif
+
+  return simde__m128i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvtepi64_epi16(a) simde_mm512_cvtepi64_epi16(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_mask_cvtepi64_epi16 (simde__m128i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cvtepi64_epi16(src, k, a);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(simde_mm512_cvtepi64_epi16(a)),
+      src_ = simde__m128i_to_private(src);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      const int16_t m = -HEDLEY_STATIC_CAST(int16_t, (k >> i) & 1);
+      r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, (r_.i16[i] & m) | (src_.i16[i] & ~m));
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cvtepi64_epi16(src, k, a) simde_mm512_mask_cvtepi64_epi16(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm512_maskz_cvtepi64_epi16 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_cvtepi64_epi16(k, a);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(simde_mm512_cvtepi64_epi16(a));
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      const int16_t m = -HEDLEY_STATIC_CAST(int16_t, (k >> i) & 1);
+      r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, r_.i16[i] & m);
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_cvtepi64_epi16(k, a) simde_mm512_maskz_cvtepi64_epi16(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_div_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_div_ps(a, b);
+#else
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f32 = a_.f32 / b_.f32;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+    r_.m256[i] = simde_mm256_div_ps(a_.m256[i], b_.m256[i]);
+  }
+#endif
+
+  return simde__m512_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_div_ps(a, b) simde_mm512_div_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_div_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_div_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_div_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_div_ps(src, k, a, b) simde_mm512_mask_div_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_div_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_div_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_div_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_div_ps(k, a, b) simde_mm512_maskz_div_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_div_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_div_pd(a, b);
+#else
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f64 = a_.f64 / b_.f64;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+    r_.m256d[i] = simde_mm256_div_pd(a_.m256d[i], b_.m256d[i]);
+  }
+#endif
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_div_pd(a, b) simde_mm512_div_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_div_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_div_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_div_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_div_pd(src, k, a, b) simde_mm512_mask_div_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_div_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_div_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_div_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_div_pd(k, a, b) simde_mm512_maskz_div_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_max_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_max_ps(a, b);
+#else
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+    r_.m256[i] = simde_mm256_max_ps(a_.m256[i], b_.m256[i]);
+  }
+
+  return simde__m512_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_max_ps(a, b) simde_mm512_max_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_max_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_max_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_max_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_max_ps(src, k, a, b) simde_mm512_mask_max_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_max_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_max_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_max_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_max_ps(k, a, b) simde_mm512_maskz_max_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_max_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_max_pd(a, b);
+#else
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+    r_.m256d[i] = simde_mm256_max_pd(a_.m256d[i], b_.m256d[i]);
+  }
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_max_pd(a, b) simde_mm512_max_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_max_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_max_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_max_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_max_pd(src, k, a, b) simde_mm512_mask_max_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_max_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_max_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_max_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_max_pd(k, a, b) simde_mm512_maskz_max_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_min_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_min_ps(a, b);
+#else
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+    r_.m256[i] = simde_mm256_min_ps(a_.m256[i], b_.m256[i]);
+  }
+
+  return simde__m512_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_min_ps(a, b) simde_mm512_min_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_min_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_min_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_min_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_min_ps(src, k, a, b) simde_mm512_mask_min_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_min_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_min_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_min_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_min_ps(k, a, b) simde_mm512_maskz_min_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_min_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_min_pd(a, b);
+#else
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+    r_.m256d[i] = simde_mm256_min_pd(a_.m256d[i], b_.m256d[i]);
+  }
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_min_pd(a, b) simde_mm512_min_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_min_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_min_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_min_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_min_pd(src, k, a, b) simde_mm512_mask_min_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_min_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_min_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_min_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_min_pd(k, a, b) simde_mm512_maskz_min_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mul_ps (simde__m512 a, simde__m512 b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mul_ps(a, b);
+#else
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f32 = a_.f32 * b_.f32;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+    r_.m256[i] = simde_mm256_mul_ps(a_.m256[i], b_.m256[i]);
+  }
+#endif
+
+  return simde__m512_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mul_ps(a, b) simde_mm512_mul_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_mul_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_mul_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_mul_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mul_ps(src, k, a, b) simde_mm512_mask_mul_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_mul_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_mul_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_mul_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mul_ps(k, a, b) simde_mm512_maskz_mul_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mul_pd (simde__m512d a, simde__m512d b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_mul_pd(a, b);
+#else
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.f64 = a_.f64 * b_.f64;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+    r_.m256d[i] = simde_mm256_mul_pd(a_.m256d[i], b_.m256d[i]);
+  }
+#endif
+
+  return simde__m512d_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mul_pd(a, b) simde_mm512_mul_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_mul_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_mul_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_mul_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mul_pd(src, k, a, b) simde_mm512_mask_mul_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_mul_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_mul_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_mul_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mul_pd(k, a, b) simde_mm512_maskz_mul_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_or_si512 (simde__m512i a, simde__m512i b) {
+#if defined(SIMDE_AVX512F_NATIVE)
+  return _mm512_or_si512(a, b);
+#else
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+#if defined(SIMDE_ARCH_X86_AVX2)
+  r_.m256i[0] = simde_mm256_or_si256(a_.m256i[0], b_.m256i[0]);
+  r_.m256i[1] = simde_mm256_or_si256(a_.m256i[1], b_.m256i[1]);
+#elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+  r_.i32f = a_.i32f | b_.i32f;
+#else
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32f[i] = a_.i32f[i] | b_.i32f[i];
+  }
+#endif
+
+  return simde__m512i_from_private(r_);
+#endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_or_si512(a, b) simde_mm512_or_si512(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_or_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_or_epi32(a, b);
+  #else
+    return simde_mm512_or_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_or_epi32(a, b) simde_mm512_or_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_or_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_or_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_or_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_or_epi32(src, k, a, b) simde_mm512_mask_or_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_or_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_or_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_or_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_or_epi32(k, a, b) simde_mm512_maskz_or_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_or_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_or_epi64(a, b);
+  #else
+    return simde_mm512_or_si512(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_or_epi64(a, b) simde_mm512_or_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_or_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_or_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_or_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_or_epi64(src, k, a, b) simde_mm512_mask_or_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_or_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_or_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_or_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_or_epi64(k, a, b) simde_mm512_maskz_or_epi64(k, a, b)
+#endif
+
+/* The reductions fold the upper half of the vector onto the lower half
+   until a single element is left, so there are only log2(n) dependent
+   operations instead of a serial chain.  On AArch64 the last 128 bits
+   are handled by a single across-vector instruction where NEON has
+   one.  The masked versions replace the inactive elements with the
+   identity of the operation first. */
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_add_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_add_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_add_epi32(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_add_epi32(t_.m128i[0], t_.m128i[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vaddvq_s32(simde__m128i_to_private(r).neon_i32);
+    #else
+      r = simde_mm_add_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_add_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_add_epi32(a) simde_mm512_reduce_add_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_add_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_epi32(k, a);
+  #else
+    return simde_mm512_reduce_add_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_add_epi32(k, a) simde_mm512_mask_reduce_add_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_add_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_add_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_add_epi64(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_add_epi64(t_.m128i[0], t_.m128i[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vaddvq_s64(simde__m128i_to_private(r).neon_i64);
+    #else
+      return simde_mm_cvtsi128_si64(simde_mm_add_epi64(r, simde_mm_unpackhi_epi64(r, r)));
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_add_epi64(a) simde_mm512_reduce_add_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_add_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_epi64(k, a);
+  #else
+    return simde_mm512_reduce_add_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_add_epi64(k, a) simde_mm512_mask_reduce_add_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_add_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_add_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256_private t_ = simde__m256_to_private(simde_mm256_add_ps(a_.m256[0], a_.m256[1]));
+    simde__m128 r = simde_mm_add_ps(t_.m128[0], t_.m128[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vaddvq_f32(simde__m128_to_private(r).neon_f32);
+    #else
+      r = simde_mm_add_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_add_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtss_f32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_add_ps(a) simde_mm512_reduce_add_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_add_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_ps(k, a);
+  #else
+    return simde_mm512_reduce_add_ps(simde_mm512_maskz_mov_ps(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_add_ps(k, a) simde_mm512_mask_reduce_add_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_add_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_add_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d_private t_ = simde__m256d_to_private(simde_mm256_add_pd(a_.m256d[0], a_.m256d[1]));
+    simde__m128d r = simde_mm_add_pd(t_.m128d[0], t_.m128d[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vaddvq_f64(simde__m128d_to_private(r).neon_f64);
+    #else
+      return simde_mm_cvtsd_f64(simde_mm_add_pd(r, simde_mm_unpackhi_pd(r, r)));
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_add_pd(a) simde_mm512_reduce_add_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_add_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_pd(k, a);
+  #else
+    return simde_mm512_reduce_add_pd(simde_mm512_maskz_mov_pd(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_add_pd(k, a) simde_mm512_mask_reduce_add_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_mul_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_mul_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_mullo_epi32(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_mullo_epi32(t_.m128i[0], t_.m128i[1]);
+
+    r = simde_mm_mullo_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    r = simde_mm_mullo_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtsi128_si32(r);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_mul_epi32(a) simde_mm512_reduce_mul_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_mul_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_epi32(k, a);
+  #else
+    return simde_mm512_reduce_mul_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(1), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_mul_epi32(k, a) simde_mm512_mask_reduce_mul_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_mul_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_mul_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 4 ; i++) {
+      a_.u64[i] = a_.u64[i] * a_.u64[i + 4];
+    }
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 2 ; i++) {
+      a_.u64[i] = a_.u64[i] * a_.u64[i + 2];
+    }
+
+    return HEDLEY_STATIC_CAST(int64_t, a_.u64[0] * a_.u64[1]);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_mul_epi64(a) simde_mm512_reduce_mul_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_mul_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_epi64(k, a);
+  #else
+    return simde_mm512_reduce_mul_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(1), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_mul_epi64(k, a) simde_mm512_mask_reduce_mul_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_mul_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_mul_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256_private t_ = simde__m256_to_private(simde_mm256_mul_ps(a_.m256[0], a_.m256[1]));
+    simde__m128 r = simde_mm_mul_ps(t_.m128[0], t_.m128[1]);
+
+    r = simde_mm_mul_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    r = simde_mm_mul_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtss_f32(r);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_mul_ps(a) simde_mm512_reduce_mul_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_mul_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_ps(k, a);
+  #else
+    return simde_mm512_reduce_mul_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_mul_ps(k, a) simde_mm512_mask_reduce_mul_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_mul_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_mul_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d_private t_ = simde__m256d_to_private(simde_mm256_mul_pd(a_.m256d[0], a_.m256d[1]));
+    simde__m128d r = simde_mm_mul_pd(t_.m128d[0], t_.m128d[1]);
+
+    return simde_mm_cvtsd_f64(simde_mm_mul_pd(r, simde_mm_unpackhi_pd(r, r)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_mul_pd(a) simde_mm512_reduce_mul_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_mul_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_pd(k, a);
+  #else
+    return simde_mm512_reduce_mul_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_mul_pd(k, a) simde_mm512_mask_reduce_mul_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_and_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_and_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_and_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_and_si128(t_.m128i[0], t_.m128i[1]);
+
+    r = simde_mm_and_si128(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    r = simde_mm_and_si128(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtsi128_si32(r);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_and_epi32(a) simde_mm512_reduce_and_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_and_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_and_epi32(k, a);
+  #else
+    return simde_mm512_reduce_and_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_and_epi32(k, a) simde_mm512_mask_reduce_and_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_and_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_and_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_and_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_and_si128(t_.m128i[0], t_.m128i[1]);
+
+    return simde_mm_cvtsi128_si64(simde_mm_and_si128(r, simde_mm_unpackhi_epi64(r, r)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_and_epi64(a) simde_mm512_reduce_and_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_and_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_and_epi64(k, a);
+  #else
+    return simde_mm512_reduce_and_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(~INT64_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_and_epi64(k, a) simde_mm512_mask_reduce_and_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_or_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_or_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_or_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_or_si128(t_.m128i[0], t_.m128i[1]);
+
+    r = simde_mm_or_si128(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    r = simde_mm_or_si128(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtsi128_si32(r);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_or_epi32(a) simde_mm512_reduce_or_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_or_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_or_epi32(k, a);
+  #else
+    return simde_mm512_reduce_or_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_or_epi32(k, a) simde_mm512_mask_reduce_or_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_or_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_or_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_or_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_or_si128(t_.m128i[0], t_.m128i[1]);
+
+    return simde_mm_cvtsi128_si64(simde_mm_or_si128(r, simde_mm_unpackhi_epi64(r, r)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_or_epi64(a) simde_mm512_reduce_or_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_or_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_or_epi64(k, a);
+  #else
+    return simde_mm512_reduce_or_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_or_epi64(k, a) simde_mm512_mask_reduce_or_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_max_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_max_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_max_epi32(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_max_epi32(t_.m128i[0], t_.m128i[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vmaxvq_s32(simde__m128i_to_private(r).neon_i32);
+    #else
+      r = simde_mm_max_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_max_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_max_epi32(a) simde_mm512_reduce_max_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_max_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epi32(k, a);
+  #else
+    return simde_mm512_reduce_max_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MIN), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_max_epi32(k, a) simde_mm512_mask_reduce_max_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_max_epu32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_max_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_max_epu32(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_max_epu32(t_.m128i[0], t_.m128i[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vmaxvq_u32(simde__m128i_to_private(r).neon_u32);
+    #else
+      r = simde_mm_max_epu32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_max_epu32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return HEDLEY_STATIC_CAST(uint32_t, simde_mm_cvtsi128_si32(r));
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_max_epu32(a) simde_mm512_reduce_max_epu32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_max_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epu32(k, a);
+  #else
+    return simde_mm512_reduce_max_epu32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_max_epu32(k, a) simde_mm512_mask_reduce_max_epu32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_max_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_max_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 4 ; i++) {
+      a_.i64[i] = (a_.i64[i] > a_.i64[i + 4]) ? a_.i64[i] : a_.i64[i + 4];
+    }
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 2 ; i++) {
+      a_.i64[i] = (a_.i64[i] > a_.i64[i + 2]) ? a_.i64[i] : a_.i64[i + 2];
+    }
+
+    return (a_.i64[0] > a_.i64[1]) ? a_.i64[0] : a_.i64[1];
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_max_epi64(a) simde_mm512_reduce_max_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_max_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epi64(k, a);
+  #else
+    return simde_mm512_reduce_max_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(INT64_MIN), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_max_epi64(k, a) simde_mm512_mask_reduce_max_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_max_epu64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_max_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 4 ; i++) {
+      a_.u64[i] = (a_.u64[i] > a_.u64[i + 4]) ? a_.u64[i] : a_.u64[i + 4];
+    }
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 2 ; i++) {
+      a_.u64[i] = (a_.u64[i] > a_.u64[i + 2]) ? a_.u64[i] : a_.u64[i + 2];
+    }
+
+    return (a_.u64[0] > a_.u64[1]) ? a_.u64[0] : a_.u64[1];
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_max_epu64(a) simde_mm512_reduce_max_epu64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_max_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epu64(k, a);
+  #else
+    return simde_mm512_reduce_max_epu64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_max_epu64(k, a) simde_mm512_mask_reduce_max_epu64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_max_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_max_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256_private t_ = simde__m256_to_private(simde_mm256_max_ps(a_.m256[0], a_.m256[1]));
+    simde__m128 r = simde_mm_max_ps(t_.m128[0], t_.m128[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vmaxvq_f32(simde__m128_to_private(r).neon_f32);
+    #else
+      r = simde_mm_max_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_max_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtss_f32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_max_ps(a) simde_mm512_reduce_max_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_max_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_ps(k, a);
+  #else
+    return simde_mm512_reduce_max_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(-SIMDE_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_max_ps(k, a) simde_mm512_mask_reduce_max_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_max_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_max_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d_private t_ = simde__m256d_to_private(simde_mm256_max_pd(a_.m256d[0], a_.m256d[1]));
+    simde__m128d r = simde_mm_max_pd(t_.m128d[0], t_.m128d[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vmaxvq_f64(simde__m128d_to_private(r).neon_f64);
+    #else
+      return simde_mm_cvtsd_f64(simde_mm_max_pd(r, simde_mm_unpackhi_pd(r, r)));
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_max_pd(a) simde_mm512_reduce_max_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_max_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_pd(k, a);
+  #else
+    return simde_mm512_reduce_max_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(-SIMDE_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_max_pd(k, a) simde_mm512_mask_reduce_max_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_min_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_min_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_min_epi32(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_min_epi32(t_.m128i[0], t_.m128i[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vminvq_s32(simde__m128i_to_private(r).neon_i32);
+    #else
+      r = simde_mm_min_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_min_epi32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_min_epi32(a) simde_mm512_reduce_min_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_min_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epi32(k, a);
+  #else
+    return simde_mm512_reduce_min_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MAX), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_min_epi32(k, a) simde_mm512_mask_reduce_min_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_min_epu32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_min_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i_private t_ = simde__m256i_to_private(simde_mm256_min_epu32(a_.m256i[0], a_.m256i[1]));
+    simde__m128i r = simde_mm_min_epu32(t_.m128i[0], t_.m128i[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vminvq_u32(simde__m128i_to_private(r).neon_u32);
+    #else
+      r = simde_mm_min_epu32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_min_epu32(r, simde_mm_shuffle_epi32(r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return HEDLEY_STATIC_CAST(uint32_t, simde_mm_cvtsi128_si32(r));
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_min_epu32(a) simde_mm512_reduce_min_epu32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_min_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epu32(k, a);
+  #else
+    return simde_mm512_reduce_min_epu32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_min_epu32(k, a) simde_mm512_mask_reduce_min_epu32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_min_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_min_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 4 ; i++) {
+      a_.i64[i] = (a_.i64[i] < a_.i64[i + 4]) ? a_.i64[i] : a_.i64[i + 4];
+    }
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 2 ; i++) {
+      a_.i64[i] = (a_.i64[i] < a_.i64[i + 2]) ? a_.i64[i] : a_.i64[i + 2];
+    }
+
+    return (a_.i64[0] < a_.i64[1]) ? a_.i64[0] : a_.i64[1];
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_min_epi64(a) simde_mm512_reduce_min_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_min_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epi64(k, a);
+  #else
+    return simde_mm512_reduce_min_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(INT64_MAX), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_min_epi64(k, a) simde_mm512_mask_reduce_min_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_min_epu64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_min_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 4 ; i++) {
+      a_.u64[i] = (a_.u64[i] < a_.u64[i + 4]) ? a_.u64[i] : a_.u64[i + 4];
+    }
+
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < 2 ; i++) {
+      a_.u64[i] = (a_.u64[i] < a_.u64[i + 2]) ? a_.u64[i] : a_.u64[i + 2];
+    }
+
+    return (a_.u64[0] < a_.u64[1]) ? a_.u64[0] : a_.u64[1];
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_min_epu64(a) simde_mm512_reduce_min_epu64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_min_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epu64(k, a);
+  #else
+    return simde_mm512_reduce_min_epu64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(~INT64_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_min_epu64(k, a) simde_mm512_mask_reduce_min_epu64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_min_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_min_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256_private t_ = simde__m256_to_private(simde_mm256_min_ps(a_.m256[0], a_.m256[1]));
+    simde__m128 r = simde_mm_min_ps(t_.m128[0], t_.m128[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vminvq_f32(simde__m128_to_private(r).neon_f32);
+    #else
+      r = simde_mm_min_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      r = simde_mm_min_ps(r, simde_mm_shuffle_ps(r, r, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtss_f32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_min_ps(a) simde_mm512_reduce_min_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_min_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_ps(k, a);
+  #else
+    return simde_mm512_reduce_min_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_min_ps(k, a) simde_mm512_mask_reduce_min_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_min_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_reduce_min_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d_private t_ = simde__m256d_to_private(simde_mm256_min_pd(a_.m256d[0], a_.m256d[1]));
+    simde__m128d r = simde_mm_min_pd(t_.m128d[0], t_.m128d[1]);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      return vminvq_f64(simde__m128d_to_private(r).neon_f64);
+    #else
+      return simde_mm_cvtsd_f64(simde_mm_min_pd(r, simde_mm_unpackhi_pd(r, r)));
+    #endif
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_reduce_min_pd(a) simde_mm512_reduce_min_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_min_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_pd(k, a);
+  #else
+    return simde_mm512_reduce_min_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_reduce_min_pd(k, a) simde_mm512_mask_reduce_min_pd(k, a)
+#endif
+
+#if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+/* The cross-lane permutes map onto vqtbl4q_u8 (a 64-byte table
+   lookup), but that works on bytes so each element index has to be
+   expanded into the indices of its bytes first: broadcast the scaled
+   index to every byte of the element then add 0, 1, 2, ... */
+SIMDE__FUNCTION_ATTRIBUTES
+uint8x16_t
+simde_x_mm512_tbl_idx_epi32 (uint32x4_t idx, uint32_t mask) {
+  static const uint8_t bcast[16] = { 0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12 };
+  static const uint8_t offset[16] = { 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 };
+  const uint8x16_t scaled = vreinterpretq_u8_u32(vshlq_n_u32(vandq_u32(idx, vdupq_n_u32(mask)), 2));
+  return vaddq_u8(vqtbl1q_u8(scaled, vld1q_u8(bcast)), vld1q_u8(offset));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint8x16_t
+simde_x_mm512_tbl_idx_epi64 (uint64x2_t idx, uint64_t mask) {
+  static const uint8_t bcast[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8 };
+  static const uint8_t offset[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+  const uint8x16_t scaled = vreinterpretq_u8_u64(vshlq_n_u64(vandq_u64(idx, vdupq_n_u64(mask)), 3));
+  return vaddq_u8(vqtbl1q_u8(scaled, vld1q_u8(bcast)), vld1q_u8(offset));
+}
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_permutexvar_epi32 (simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutexvar_epi32(idx, a);
+  #else
+    simde__m512i_private
+      r_,
+      idx_ = simde__m512i_to_private(idx),
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      const uint8x16x4_t table = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8,
+                                     a_.m128i_private[2].neon_u8, a_.m128i_private[3].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u8 = vqtbl4q_u8(table, simde_x_mm512_tbl_idx_epi32(idx_.m128i_private[i].neon_u32, 15));
+      }
+    #elif defined(SIMDE_ARCH_X86_AVX2)
+      /* vpermd only reaches eight elements; permute both halves of a and
+         let bit 3 of the index pick one. */
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_castps_si256(simde_mm256_blendv_ps(
+          simde_mm256_castsi256_ps(simde_mm256_permutevar8x32_epi32(a_.m256i[0], idx_.m256i[i])),
+          simde_mm256_castsi256_ps(simde_mm256_permutevar8x32_epi32(a_.m256i[1], idx_.m256i[i])),
+          simde_mm256_castsi256_ps(simde_mm256_slli_epi32(idx_.m256i[i], 28))));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i32 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i32, a_.i32, idx_.i32);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = a_.i32[idx_.i32[i] & 15];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutexvar_epi32(idx, a) simde_mm512_permutexvar_epi32(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_permutexvar_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutexvar_epi32(src, k, idx, a);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_permutexvar_epi32(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutexvar_epi32(src, k, idx, a) simde_mm512_mask_permutexvar_epi32(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_permutexvar_epi32 (simde__mmask16 k, simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutexvar_epi32(k, idx, a);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_permutexvar_epi32(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutexvar_epi32(k, idx, a) simde_mm512_maskz_permutexvar_epi32(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_permutexvar_epi64 (simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutexvar_epi64(idx, a);
+  #else
+    simde__m512i_private
+      r_,
+      idx_ = simde__m512i_to_private(idx),
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      const uint8x16x4_t table = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8,
+                                     a_.m128i_private[2].neon_u8, a_.m128i_private[3].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u8 = vqtbl4q_u8(table, simde_x_mm512_tbl_idx_epi64(idx_.m128i_private[i].neon_u64, 7));
+      }
+    #elif defined(SIMDE_ARCH_X86_AVX2)
+      /* Same as permutexvar_epi32, but each 64-bit index i becomes the
+         pair of 32-bit indices 2i, 2i + 1 and bit 2 picks the half. */
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i t2 = simde_mm256_slli_epi64(simde_mm256_and_si256(idx_.m256i[i], simde_mm256_set1_epi64x(3)), 1);
+        const simde__m256i t = simde_mm256_add_epi32(simde_mm256_or_si256(t2, simde_mm256_slli_epi64(t2, 32)),
+                                                     simde_mm256_set_epi32(1, 0, 1, 0, 1, 0, 1, 0));
+        r_.m256i[i] = simde_mm256_castpd_si256(simde_mm256_blendv_pd(
+          simde_mm256_castsi256_pd(simde_mm256_permutevar8x32_epi32(a_.m256i[0], t)),
+          simde_mm256_castsi256_pd(simde_mm256_permutevar8x32_epi32(a_.m256i[1], t)),
+          simde_mm256_castsi256_pd(simde_mm256_slli_epi64(idx_.m256i[i], 61))));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i64 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i64, a_.i64, idx_.i64);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = a_.i64[idx_.i64[i] & 7];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutexvar_epi64(idx, a) simde_mm512_permutexvar_epi64(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_permutexvar_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutexvar_epi64(src, k, idx, a);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_permutexvar_epi64(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutexvar_epi64(src, k, idx, a) simde_mm512_mask_permutexvar_epi64(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_permutexvar_epi64 (simde__mmask8 k, simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutexvar_epi64(k, idx, a);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_permutexvar_epi64(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutexvar_epi64(k, idx, a) simde_mm512_maskz_permutexvar_epi64(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_permutexvar_ps (simde__m512i idx, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutexvar_ps(idx, a);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_permutexvar_epi32(idx, simde_mm512_castps_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutexvar_ps(idx, a) simde_mm512_permutexvar_ps(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_permutexvar_ps (simde__m512 src, simde__mmask16 k, simde__m512i idx, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutexvar_ps(src, k, idx, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_permutexvar_ps(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutexvar_ps(src, k, idx, a) simde_mm512_mask_permutexvar_ps(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_permutexvar_ps (simde__mmask16 k, simde__m512i idx, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutexvar_ps(k, idx, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_permutexvar_ps(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutexvar_ps(k, idx, a) simde_mm512_maskz_permutexvar_ps(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_permutexvar_pd (simde__m512i idx, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutexvar_pd(idx, a);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_permutexvar_epi64(idx, simde_mm512_castpd_si512(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutexvar_pd(idx, a) simde_mm512_permutexvar_pd(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_permutexvar_pd (simde__m512d src, simde__mmask8 k, simde__m512i idx, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutexvar_pd(src, k, idx, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_permutexvar_pd(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutexvar_pd(src, k, idx, a) simde_mm512_mask_permutexvar_pd(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_permutexvar_pd (simde__mmask8 k, simde__m512i idx, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutexvar_pd(k, idx, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_permutexvar_pd(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutexvar_pd(k, idx, a) simde_mm512_maskz_permutexvar_pd(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_permutex2var_epi32 (simde__m512i a, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutex2var_epi32(a, idx, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      idx_ = simde__m512i_to_private(idx),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      /* Byte indices past the end of a 64-byte table give 0 with vqtbl4q
+         and leave the destination alone with vqtbx4q, so look everything
+         up in a, then subtract 64 and look it up again in b. */
+      const uint8x16x4_t
+        table_a = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8,
+                      a_.m128i_private[2].neon_u8, a_.m128i_private[3].neon_u8 } },
+        table_b = { { b_.m128i_private[0].neon_u8, b_.m128i_private[1].neon_u8,
+                      b_.m128i_private[2].neon_u8, b_.m128i_private[3].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        const uint8x16_t ix = simde_x_mm512_tbl_idx_epi32(idx_.m128i_private[i].neon_u32, 31);
+        r_.m128i_private[i].neon_u8 = vqtbx4q_u8(vqtbl4q_u8(table_a, ix), table_b, vsubq_u8(ix, vdupq_n_u8(64)));
+      }
+    #elif defined(SIMDE_ARCH_X86_AVX2)
+      /* permutexvar_epi32 on both a and b, then bit 4 of the index picks
+         the source. */
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256 sel_half = simde_mm256_castsi256_ps(simde_mm256_slli_epi32(idx_.m256i[i], 28));
+        const simde__m256 sel_src = simde_mm256_castsi256_ps(simde_mm256_slli_epi32(idx_.m256i[i], 27));
+        const simde__m256 ra = simde_mm256_blendv_ps(
+          simde_mm256_castsi256_ps(simde_mm256_permutevar8x32_epi32(a_.m256i[0], idx_.m256i[i])),
+          simde_mm256_castsi256_ps(simde_mm256_permutevar8x32_epi32(a_.m256i[1], idx_.m256i[i])),
+          sel_half);
+        const simde__m256 rb = simde_mm256_blendv_ps(
+          simde_mm256_castsi256_ps(simde_mm256_permutevar8x32_epi32(b_.m256i[0], idx_.m256i[i])),
+          simde_mm256_castsi256_ps(simde_mm256_permutevar8x32_epi32(b_.m256i[1], idx_.m256i[i])),
+          sel_half);
+        r_.m256i[i] = simde_mm256_castps_si256(simde_mm256_blendv_ps(ra, rb, sel_src));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i32 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i32, b_.i32, idx_.i32);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = (idx_.i32[i] & 16) ? b_.i32[idx_.i32[i] & 15] : a_.i32[idx_.i32[i] & 15];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutex2var_epi32(a, idx, b) simde_mm512_permutex2var_epi32(a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_permutex2var_epi32 (simde__m512i a, simde__mmask16 k, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutex2var_epi32(a, k, idx, b);
+  #else
+    return simde_mm512_mask_mov_epi32(a, k, simde_mm512_permutex2var_epi32(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutex2var_epi32(a, k, idx, b) simde_mm512_mask_permutex2var_epi32(a, k, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask2_permutex2var_epi32 (simde__m512i a, simde__m512i idx, simde__mmask16 k, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask2_permutex2var_epi32(a, idx, k, b);
+  #else
+    return simde_mm512_mask_mov_epi32(idx, k, simde_mm512_permutex2var_epi32(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask2_permutex2var_epi32(a, idx, k, b) simde_mm512_mask2_permutex2var_epi32(a, idx, k, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_permutex2var_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutex2var_epi32(k, a, idx, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_permutex2var_epi32(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutex2var_epi32(k, a, idx, b) simde_mm512_maskz_permutex2var_epi32(k, a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_permutex2var_epi64 (simde__m512i a, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutex2var_epi64(a, idx, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      idx_ = simde__m512i_to_private(idx),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      /* Byte indices past the end of a 64-byte table give 0 with vqtbl4q
+         and leave the destination alone with vqtbx4q, so look everything
+         up in a, then subtract 64 and look it up again in b. */
+      const uint8x16x4_t
+        table_a = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8,
+                      a_.m128i_private[2].neon_u8, a_.m128i_private[3].neon_u8 } },
+        table_b = { { b_.m128i_private[0].neon_u8, b_.m128i_private[1].neon_u8,
+                      b_.m128i_private[2].neon_u8, b_.m128i_private[3].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        const uint8x16_t ix = simde_x_mm512_tbl_idx_epi64(idx_.m128i_private[i].neon_u64, 15);
+        r_.m128i_private[i].neon_u8 = vqtbx4q_u8(vqtbl4q_u8(table_a, ix), table_b, vsubq_u8(ix, vdupq_n_u8(64)));
+      }
+    #elif defined(SIMDE_ARCH_X86_AVX2)
+      /* See permutexvar_epi64 and permutex2var_epi32. */
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256d sel_half = simde_mm256_castsi256_pd(simde_mm256_slli_epi64(idx_.m256i[i], 61));
+        const simde__m256d sel_src = simde_mm256_castsi256_pd(simde_mm256_slli_epi64(idx_.m256i[i], 60));
+        const simde__m256i t2 = simde_mm256_slli_epi64(simde_mm256_and_si256(idx_.m256i[i], simde_mm256_set1_epi64x(3)), 1);
+        const simde__m256i t = simde_mm256_add_epi32(simde_mm256_or_si256(t2, simde_mm256_slli_epi64(t2, 32)),
+                                                     simde_mm256_set_epi32(1, 0, 1, 0, 1, 0, 1, 0));
+        const simde__m256d ra = simde_mm256_blendv_pd(
+          simde_mm256_castsi256_pd(simde_mm256_permutevar8x32_epi32(a_.m256i[0], t)),
+          simde_mm256_castsi256_pd(simde_mm256_permutevar8x32_epi32(a_.m256i[1], t)),
+          sel_half);
+        const simde__m256d rb = simde_mm256_blendv_pd(
+          simde_mm256_castsi256_pd(simde_mm256_permutevar8x32_epi32(b_.m256i[0], t)),
+          simde_mm256_castsi256_pd(simde_mm256_permutevar8x32_epi32(b_.m256i[1], t)),
+          sel_half);
+        r_.m256i[i] = simde_mm256_castpd_si256(simde_mm256_blendv_pd(ra, rb, sel_src));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i64 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i64, b_.i64, idx_.i64);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = (idx_.i64[i] & 8) ? b_.i64[idx_.i64[i] & 7] : a_.i64[idx_.i64[i] & 7];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutex2var_epi64(a, idx, b) simde_mm512_permutex2var_epi64(a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_permutex2var_epi64 (simde__m512i a, simde__mmask8 k, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutex2var_epi64(a, k, idx, b);
+  #else
+    return simde_mm512_mask_mov_epi64(a, k, simde_mm512_permutex2var_epi64(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutex2var_epi64(a, k, idx, b) simde_mm512_mask_permutex2var_epi64(a, k, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask2_permutex2var_epi64 (simde__m512i a, simde__m512i idx, simde__mmask8 k, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask2_permutex2var_epi64(a, idx, k, b);
+  #else
+    return simde_mm512_mask_mov_epi64(idx, k, simde_mm512_permutex2var_epi64(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask2_permutex2var_epi64(a, idx, k, b) simde_mm512_mask2_permutex2var_epi64(a, idx, k, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_permutex2var_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutex2var_epi64(k, a, idx, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_permutex2var_epi64(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutex2var_epi64(k, a, idx, b) simde_mm512_maskz_permutex2var_epi64(k, a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_permutex2var_ps (simde__m512 a, simde__m512i idx, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutex2var_ps(a, idx, b);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_permutex2var_epi32(simde_mm512_castps_si512(a), idx, simde_mm512_castps_si512(b)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutex2var_ps(a, idx, b) simde_mm512_permutex2var_ps(a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_permutex2var_ps (simde__m512 a, simde__mmask16 k, simde__m512i idx, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutex2var_ps(a, k, idx, b);
+  #else
+    return simde_mm512_mask_mov_ps(a, k, simde_mm512_permutex2var_ps(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutex2var_ps(a, k, idx, b) simde_mm512_mask_permutex2var_ps(a, k, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask2_permutex2var_ps (simde__m512 a, simde__m512i idx, simde__mmask16 k, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask2_permutex2var_ps(a, idx, k, b);
+  #else
+    return simde_mm512_mask_mov_ps(simde_mm512_castsi512_ps(idx), k, simde_mm512_permutex2var_ps(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask2_permutex2var_ps(a, idx, k, b) simde_mm512_mask2_permutex2var_ps(a, idx, k, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_permutex2var_ps (simde__mmask16 k, simde__m512 a, simde__m512i idx, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutex2var_ps(k, a, idx, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_permutex2var_ps(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutex2var_ps(k, a, idx, b) simde_mm512_maskz_permutex2var_ps(k, a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_permutex2var_pd (simde__m512d a, simde__m512i idx, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_permutex2var_pd(a, idx, b);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_permutex2var_epi64(simde_mm512_castpd_si512(a), idx, simde_mm512_castpd_si512(b)));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutex2var_pd(a, idx, b) simde_mm512_permutex2var_pd(a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_permutex2var_pd (simde__m512d a, simde__mmask8 k, simde__m512i idx, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_permutex2var_pd(a, k, idx, b);
+  #else
+    return simde_mm512_mask_mov_pd(a, k, simde_mm512_permutex2var_pd(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutex2var_pd(a, k, idx, b) simde_mm512_mask_permutex2var_pd(a, k, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask2_permutex2var_pd (simde__m512d a, simde__m512i idx, simde__mmask8 k, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask2_permutex2var_pd(a, idx, k, b);
+  #else
+    return simde_mm512_mask_mov_pd(simde_mm512_castsi512_pd(idx), k, simde_mm512_permutex2var_pd(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask2_permutex2var_pd(a, idx, k, b) simde_mm512_mask2_permutex2var_pd(a, idx, k, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_permutex2var_pd (simde__mmask8 k, simde__m512d a, simde__m512i idx, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_permutex2var_pd(k, a, idx, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_permutex2var_pd(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutex2var_pd(k, a, idx, b) simde_mm512_maskz_permutex2var_pd(k, a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shuffle_epi32 (simde__m512i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] = a_.i32[(i & ~HEDLEY_STATIC_CAST(size_t, 3)) | HEDLEY_STATIC_CAST(size_t, (imm8 >> ((i & 3) * 2)) & 3)];
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_shuffle_epi32(a, imm8) _mm512_shuffle_epi32(a, HEDLEY_STATIC_CAST(_MM_PERM_ENUM, imm8))
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm512_shuffle_epi32(a, imm8) (__extension__ ({ \
+      simde__m512i_private \
+        simde__tmp_r_, \
+        simde__tmp_a_ = simde__m512i_to_private(a); \
+      simde__tmp_r_.i32 = \
+        SIMDE__SHUFFLE_VECTOR(32, 64, \
+                              (simde__tmp_a_).i32, \
+                              (simde__tmp_a_).i32, \
+                              ((imm8)     ) & 3, \
+                              ((imm8) >> 2) & 3, \
+                              ((imm8) >> 4) & 3, \
+                              ((imm8) >> 6) & 3, \
+                              (((imm8)     ) & 3) +  4, \
+                              (((imm8) >> 2) & 3) +  4, \
+                              (((imm8) >> 4) & 3) +  4, \
+                              (((imm8) >> 6) & 3) +  4, \
+                              (((imm8)     ) & 3) +  8, \
+                              (((imm8) >> 2) & 3) +  8, \
+                              (((imm8) >> 4) & 3) +  8, \
+                              (((imm8) >> 6) & 3) +  8, \
+                              (((imm8)     ) & 3) + 12, \
+                              (((imm8) >> 2) & 3) + 12, \
+                              (((imm8) >> 4) & 3) + 12, \
+                              (((imm8) >> 6) & 3) + 12); \
+      simde__m512i_from_private(simde__tmp_r_); }))
+#endif
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_shuffle_epi32(src, k, a, imm8) _mm512_mask_shuffle_epi32(src, k, a, HEDLEY_STATIC_CAST(_MM_PERM_ENUM, imm8))
+#  define simde_mm512_maskz_shuffle_epi32(k, a, imm8) _mm512_maskz_shuffle_epi32(k, a, HEDLEY_STATIC_CAST(_MM_PERM_ENUM, imm8))
+#else
+#  define simde_mm512_mask_shuffle_epi32(src, k, a, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_shuffle_epi32(a, imm8))
+#  define simde_mm512_maskz_shuffle_epi32(k, a, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_shuffle_epi32(a, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_shuffle_epi32(a, imm8) simde_mm512_shuffle_epi32(a, imm8)
+#  define _mm512_mask_shuffle_epi32(src, k, a, imm8) simde_mm512_mask_shuffle_epi32(src, k, a, imm8)
+#  define _mm512_maskz_shuffle_epi32(k, a, imm8) simde_mm512_maskz_shuffle_epi32(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shuffle_i32x4 (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  r_.m128i[0] = a_.m128i[(imm8     ) & 3];
+  r_.m128i[1] = a_.m128i[(imm8 >> 2) & 3];
+  r_.m128i[2] = b_.m128i[(imm8 >> 4) & 3];
+  r_.m128i[3] = b_.m128i[(imm8 >> 6) & 3];
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_shuffle_i32x4(a, b, imm8) _mm512_shuffle_i32x4(a, b, imm8)
+#elif defined(SIMDE__SHUFFLE_VECTOR)
+#  define simde_mm512_shuffle_i32x4(a, b, imm8) (__extension__ ({ \
+      simde__m512i_private \
+        simde__tmp_r_, \
+        simde__tmp_a_ = simde__m512i_to_private(a), \
+        simde__tmp_b_ = simde__m512i_to_private(b); \
+      simde__tmp_r_.i64 = \
+        SIMDE__SHUFFLE_VECTOR(64, 64, \
+                              (simde__tmp_a_).i64, \
+                              (simde__tmp_b_).i64, \
+                              ((((imm8)     ) & 3) * 2)    , \
+                              ((((imm8)     ) & 3) * 2) + 1, \
+                              ((((imm8) >> 2) & 3) * 2)    , \
+                              ((((imm8) >> 2) & 3) * 2) + 1, \
+                              ((((imm8) >> 4) & 3) * 2) + 8, \
+                              ((((imm8) >> 4) & 3) * 2) + 9, \
+                              ((((imm8) >> 6) & 3) * 2) + 8, \
+                              ((((imm8) >> 6) & 3) * 2) + 9); \
+      simde__m512i_from_private(simde__tmp_r_); }))
+#endif
+
+/* Without a mask the element size doesn't matter, so the other three
+   128-bit lane shuffles are all shuffle_i32x4. */
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_shuffle_i32x4(src, k, a, b, imm8) _mm512_mask_shuffle_i32x4(src, k, a, b, imm8)
+#  define simde_mm512_maskz_shuffle_i32x4(k, a, b, imm8) _mm512_maskz_shuffle_i32x4(k, a, b, imm8)
+#  define simde_mm512_shuffle_i64x2(a, b, imm8) _mm512_shuffle_i64x2(a, b, imm8)
+#  define simde_mm512_mask_shuffle_i64x2(src, k, a, b, imm8) _mm512_mask_shuffle_i64x2(src, k, a, b, imm8)
+#  define simde_mm512_maskz_shuffle_i64x2(k, a, b, imm8) _mm512_maskz_shuffle_i64x2(k, a, b, imm8)
+#  define simde_mm512_shuffle_f32x4(a, b, imm8) _mm512_shuffle_f32x4(a, b, imm8)
+#  define simde_mm512_mask_shuffle_f32x4(src, k, a, b, imm8) _mm512_mask_shuffle_f32x4(src, k, a, b, imm8)
+#  define simde_mm512_maskz_shuffle_f32x4(k, a, b, imm8) _mm512_maskz_shuffle_f32x4(k, a, b, imm8)
+#  define simde_mm512_shuffle_f64x2(a, b, imm8) _mm512_shuffle_f64x2(a, b, imm8)
+#  define simde_mm512_mask_shuffle_f64x2(src, k, a, b, imm8) _mm512_mask_shuffle_f64x2(src, k, a, b, imm8)
+#  define simde_mm512_maskz_shuffle_f64x2(k, a, b, imm8) _mm512_maskz_shuffle_f64x2(k, a, b, imm8)
+#else
+#  define simde_mm512_mask_shuffle_i32x4(src, k, a, b, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_shuffle_i32x4(a, b, imm8))
+#  define simde_mm512_maskz_shuffle_i32x4(k, a, b, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_shuffle_i32x4(a, b, imm8))
+#  define simde_mm512_shuffle_i64x2(a, b, imm8) simde_mm512_shuffle_i32x4(a, b, imm8)
+#  define simde_mm512_mask_shuffle_i64x2(src, k, a, b, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_shuffle_i32x4(a, b, imm8))
+#  define simde_mm512_maskz_shuffle_i64x2(k, a, b, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_shuffle_i32x4(a, b, imm8))
+#  define simde_mm512_shuffle_f32x4(a, b, imm8) \
+     simde_mm512_castsi512_ps(simde_mm512_shuffle_i32x4(simde_mm512_castps_si512(a), simde_mm512_castps_si512(b), imm8))
+#  define simde_mm512_mask_shuffle_f32x4(src, k, a, b, imm8) simde_mm512_mask_mov_ps(src, k, simde_mm512_shuffle_f32x4(a, b, imm8))
+#  define simde_mm512_maskz_shuffle_f32x4(k, a, b, imm8) simde_mm512_maskz_mov_ps(k, simde_mm512_shuffle_f32x4(a, b, imm8))
+#  define simde_mm512_shuffle_f64x2(a, b, imm8) \
+     simde_mm512_castsi512_pd(simde_mm512_shuffle_i32x4(simde_mm512_castpd_si512(a), simde_mm512_castpd_si512(b), imm8))
+#  define simde_mm512_mask_shuffle_f64x2(src, k, a, b, imm8) simde_mm512_mask_mov_pd(src, k, simde_mm512_shuffle_f64x2(a, b, imm8))
+#  define simde_mm512_maskz_shuffle_f64x2(k, a, b, imm8) simde_mm512_maskz_mov_pd(k, simde_mm512_shuffle_f64x2(a, b, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_shuffle_i32x4(a, b, imm8) simde_mm512_shuffle_i32x4(a, b, imm8)
+#  define _mm512_mask_shuffle_i32x4(src, k, a, b, imm8) simde_mm512_mask_shuffle_i32x4(src, k, a, b, imm8)
+#  define _mm512_maskz_shuffle_i32x4(k, a, b, imm8) simde_mm512_maskz_shuffle_i32x4(k, a, b, imm8)
+#  define _mm512_shuffle_i64x2(a, b, imm8) simde_mm512_shuffle_i64x2(a, b, imm8)
+#  define _mm512_mask_shuffle_i64x2(src, k, a, b, imm8) simde_mm512_mask_shuffle_i64x2(src, k, a, b, imm8)
+#  define _mm512_maskz_shuffle_i64x2(k, a, b, imm8) simde_mm512_maskz_shuffle_i64x2(k, a, b, imm8)
+#  define _mm512_shuffle_f32x4(a, b, imm8) simde_mm512_shuffle_f32x4(a, b, imm8)
+#  define _mm512_mask_shuffle_f32x4(src, k, a, b, imm8) simde_mm512_mask_shuffle_f32x4(src, k, a, b, imm8)
+#  define _mm512_maskz_shuffle_f32x4(k, a, b, imm8) simde_mm512_maskz_shuffle_f32x4(k, a, b, imm8)
+#  define _mm512_shuffle_f64x2(a, b, imm8) simde_mm512_shuffle_f64x2(a, b, imm8)
+#  define _mm512_mask_shuffle_f64x2(src, k, a, b, imm8) simde_mm512_mask_shuffle_f64x2(src, k, a, b, imm8)
+#  define _mm512_maskz_shuffle_f64x2(k, a, b, imm8) simde_mm512_maskz_shuffle_f64x2(k, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpacklo_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpacklo_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.i32 = SIMDE__SHUFFLE_VECTOR(32, 64, a_.i32, b_.i32, 0, 16, 1, 17, 4, 20, 5, 21, 8, 24, 9, 25, 12, 28, 13, 29);
+    #else
+      r_.m256i[0] = simde_mm256_unpacklo_epi32(a_.m256i[0], b_.m256i[0]);
+      r_.m256i[1] = simde_mm256_unpacklo_epi32(a_.m256i[1], b_.m256i[1]);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpacklo_epi32(a, b) simde_mm512_unpacklo_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_unpacklo_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpacklo_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_unpacklo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpacklo_epi32(src, k, a, b) simde_mm512_mask_unpacklo_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_unpacklo_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpacklo_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_unpacklo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpacklo_epi32(k, a, b) simde_mm512_maskz_unpacklo_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpackhi_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpackhi_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.i32 = SIMDE__SHUFFLE_VECTOR(32, 64, a_.i32, b_.i32, 2, 18, 3, 19, 6, 22, 7, 23, 10, 26, 11, 27, 14, 30, 15, 31);
+    #else
+      r_.m256i[0] = simde_mm256_unpackhi_epi32(a_.m256i[0], b_.m256i[0]);
+      r_.m256i[1] = simde_mm256_unpackhi_epi32(a_.m256i[1], b_.m256i[1]);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpackhi_epi32(a, b) simde_mm512_unpackhi_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_unpackhi_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpackhi_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_unpackhi_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpackhi_epi32(src, k, a, b) simde_mm512_mask_unpackhi_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_unpackhi_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpackhi_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_unpackhi_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpackhi_epi32(k, a, b) simde_mm512_maskz_unpackhi_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpacklo_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpacklo_epi64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.i64 = SIMDE__SHUFFLE_VECTOR(64, 64, a_.i64, b_.i64, 0, 8, 2, 10, 4, 12, 6, 14);
+    #else
+      r_.m256i[0] = simde_mm256_unpacklo_epi64(a_.m256i[0], b_.m256i[0]);
+      r_.m256i[1] = simde_mm256_unpacklo_epi64(a_.m256i[1], b_.m256i[1]);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpacklo_epi64(a, b) simde_mm512_unpacklo_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_unpacklo_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpacklo_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_unpacklo_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpacklo_epi64(src, k, a, b) simde_mm512_mask_unpacklo_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_unpacklo_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpacklo_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_unpacklo_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpacklo_epi64(k, a, b) simde_mm512_maskz_unpacklo_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_unpackhi_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpackhi_epi64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.i64 = SIMDE__SHUFFLE_VECTOR(64, 64, a_.i64, b_.i64, 1, 9, 3, 11, 5, 13, 7, 15);
+    #else
+      r_.m256i[0] = simde_mm256_unpackhi_epi64(a_.m256i[0], b_.m256i[0]);
+      r_.m256i[1] = simde_mm256_unpackhi_epi64(a_.m256i[1], b_.m256i[1]);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpackhi_epi64(a, b) simde_mm512_unpackhi_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_unpackhi_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpackhi_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_unpackhi_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpackhi_epi64(src, k, a, b) simde_mm512_mask_unpackhi_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_unpackhi_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpackhi_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_unpackhi_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpackhi_epi64(k, a, b) simde_mm512_maskz_unpackhi_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_unpacklo_ps (simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpacklo_ps(a, b);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.f32 = SIMDE__SHUFFLE_VECTOR(32, 64, a_.f32, b_.f32, 0, 16, 1, 17, 4, 20, 5, 21, 8, 24, 9, 25, 12, 28, 13, 29);
+    #else
+      r_.m256[0] = simde_mm256_unpacklo_ps(a_.m256[0], b_.m256[0]);
+      r_.m256[1] = simde_mm256_unpacklo_ps(a_.m256[1], b_.m256[1]);
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpacklo_ps(a, b) simde_mm512_unpacklo_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_unpacklo_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpacklo_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_unpacklo_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpacklo_ps(src, k, a, b) simde_mm512_mask_unpacklo_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_unpacklo_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpacklo_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_unpacklo_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpacklo_ps(k, a, b) simde_mm512_maskz_unpacklo_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_unpackhi_ps (simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpackhi_ps(a, b);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.f32 = SIMDE__SHUFFLE_VECTOR(32, 64, a_.f32, b_.f32, 2, 18, 3, 19, 6, 22, 7, 23, 10, 26, 11, 27, 14, 30, 15, 31);
+    #else
+      r_.m256[0] = simde_mm256_unpackhi_ps(a_.m256[0], b_.m256[0]);
+      r_.m256[1] = simde_mm256_unpackhi_ps(a_.m256[1], b_.m256[1]);
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpackhi_ps(a, b) simde_mm512_unpackhi_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_unpackhi_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpackhi_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_unpackhi_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpackhi_ps(src, k, a, b) simde_mm512_mask_unpackhi_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_unpackhi_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpackhi_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_unpackhi_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpackhi_ps(k, a, b) simde_mm512_maskz_unpackhi_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_unpacklo_pd (simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpacklo_pd(a, b);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.f64 = SIMDE__SHUFFLE_VECTOR(64, 64, a_.f64, b_.f64, 0, 8, 2, 10, 4, 12, 6, 14);
+    #else
+      r_.m256d[0] = simde_mm256_unpacklo_pd(a_.m256d[0], b_.m256d[0]);
+      r_.m256d[1] = simde_mm256_unpacklo_pd(a_.m256d[1], b_.m256d[1]);
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpacklo_pd(a, b) simde_mm512_unpacklo_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_unpacklo_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpacklo_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_unpacklo_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpacklo_pd(src, k, a, b) simde_mm512_mask_unpacklo_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_unpacklo_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpacklo_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_unpacklo_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpacklo_pd(k, a, b) simde_mm512_maskz_unpacklo_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_unpackhi_pd (simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_unpackhi_pd(a, b);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b);
+
+    #if defined(SIMDE__SHUFFLE_VECTOR)
+      r_.f64 = SIMDE__SHUFFLE_VECTOR(64, 64, a_.f64, b_.f64, 1, 9, 3, 11, 5, 13, 7, 15);
+    #else
+      r_.m256d[0] = simde_mm256_unpackhi_pd(a_.m256d[0], b_.m256d[0]);
+      r_.m256d[1] = simde_mm256_unpackhi_pd(a_.m256d[1], b_.m256d[1]);
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_unpackhi_pd(a, b) simde_mm512_unpackhi_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_unpackhi_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_unpackhi_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_unpackhi_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_unpackhi_pd(src, k, a, b) simde_mm512_mask_unpackhi_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_unpackhi_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_unpackhi_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_unpackhi_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_unpackhi_pd(k, a, b) simde_mm512_maskz_unpackhi_pd(k, a, b)
+#endif
+
+/* Like the AVX2 gathers, these are one unconditional scalar load per
+   element, and masked off elements are "loaded" from src by selecting
+   the address with a bitmask instead of branching.  The loops are fully
+   unrolled so the loads don't depend on each other.
+
+   The scatters work the same way, with masked off elements stored to a
+   dummy variable.  The stores are issued in lane order, so when several
+   indices point to the same address the highest lane wins, just like
+   the native instruction.  Don't add SIMDE__VECTORIZE to those loops;
+   the stores are allowed to alias each other. */
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i32gather_epi32 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(16)
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    int32_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i32[i] = dst;
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32gather_epi32(vindex, base_addr, scale) _mm512_i32gather_epi32(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32gather_epi32(vindex, base_addr, scale) simde_mm512_i32gather_epi32(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i32gather_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(16)
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int32_t))) & ~m);
+    int32_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i32[i] = dst;
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_i32gather_ps (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(16)
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    simde_float32 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32gather_ps(vindex, base_addr, scale) _mm512_i32gather_ps(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32gather_ps(vindex, base_addr, scale) simde_mm512_i32gather_ps(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_i32gather_ps (simde__m512 src, simde__mmask16 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private
+    src_ = simde__m512_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(16)
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float32))) & ~m);
+    simde_float32 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i32gather_epi64 (simde__m256i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    int64_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32gather_epi64(vindex, base_addr, scale) _mm512_i32gather_epi64(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32gather_epi64(vindex, base_addr, scale) simde_mm512_i32gather_epi64(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i32gather_epi64 (simde__m512i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int64_t))) & ~m);
+    int64_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_i32gather_pd (simde__m256i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale);
+    simde_float64 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32gather_pd(vindex, base_addr, scale) _mm512_i32gather_pd(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32gather_pd(vindex, base_addr, scale) simde_mm512_i32gather_pd(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_i32gather_pd (simde__m512d src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private
+    src_ = simde__m512d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float64))) & ~m);
+    simde_float64 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_i64gather_epi32 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    int32_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i32[i] = dst;
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64gather_epi32(vindex, base_addr, scale) _mm512_i64gather_epi32(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64gather_epi32(vindex, base_addr, scale) simde_mm512_i64gather_epi32(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_mask_i64gather_epi32 (simde__m256i src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private
+    src_ = simde__m256i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int32_t))) & ~m);
+    int32_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i32[i] = dst;
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_i64gather_ps (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    simde_float32 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64gather_ps(vindex, base_addr, scale) _mm512_i64gather_ps(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64gather_ps(vindex, base_addr, scale) simde_mm512_i64gather_ps(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_mask_i64gather_ps (simde__m256 src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private
+    src_ = simde__m256_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float32))) & ~m);
+    simde_float32 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f32[i] = dst;
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i64gather_epi64 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    int64_t dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64gather_epi64(vindex, base_addr, scale) _mm512_i64gather_epi64(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64gather_epi64(vindex, base_addr, scale) simde_mm512_i64gather_epi64(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i64gather_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(int64_t))) & ~m);
+    int64_t dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.i64[i] = dst;
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_i64gather_pd (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uint8_t* elem_addr = addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale);
+    simde_float64 dst;
+    simde_memcpy(&dst, elem_addr, sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64gather_pd(vindex, base_addr, scale) _mm512_i64gather_pd(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64gather_pd(vindex, base_addr, scale) simde_mm512_i64gather_pd(vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_i64gather_pd (simde__m512d src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private
+    src_ = simde__m512d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, &src_);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, src_addr + (i * sizeof(simde_float64))) & ~m);
+    simde_float64 dst;
+    simde_memcpy(&dst, HEDLEY_REINTERPRET_CAST(const void*, elem_addr), sizeof(dst));
+    r_.f64[i] = dst;
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_epi32 (void* base_addr, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(16)
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    const int32_t v = a_.i32[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale) _mm512_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi32 (void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(16)
   for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-    r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, a_.i32[i]);
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const int32_t v = a_.i32[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_ps (void* base_addr, simde__m512i vindex, simde__m512 a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private a_ = simde__m512_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(16)
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    const simde_float32 v = a_.f32[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32scatter_ps(base_addr, vindex, a, scale) _mm512_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32scatter_ps(base_addr, vindex, a, scale) simde_mm512_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_ps (void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512 a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private a_ = simde__m512_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(16)
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const simde_float32 v = a_.f32[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_epi64 (void* base_addr, simde__m256i vindex, simde__m512i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    const int64_t v = a_.i64[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale) _mm512_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const int64_t v = a_.i64[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_pd (void* base_addr, simde__m256i vindex, simde__m512d a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    const simde_float64 v = a_.f64[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i32scatter_pd(base_addr, vindex, a, scale) _mm512_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i32scatter_pd(base_addr, vindex, a, scale) simde_mm512_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_pd (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512d a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i32[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const simde_float64 v = a_.f64[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_epi32 (void* base_addr, simde__m512i vindex, simde__m256i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    const int32_t v = a_.i32[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale) _mm512_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const int32_t v = a_.i32[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_ps (void* base_addr, simde__m512i vindex, simde__m256 a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    const simde_float32 v = a_.f32[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64scatter_ps(base_addr, vindex, a, scale) _mm512_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64scatter_ps(base_addr, vindex, a, scale) simde_mm512_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_ps (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256 a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const simde_float32 v = a_.f32[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_epi64 (void* base_addr, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    const int64_t v = a_.i64[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale) _mm512_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const int64_t v = a_.i64[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_pd (void* base_addr, simde__m512i vindex, simde__m512d a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    const simde_float64 v = a_.f64[i];
+    simde_memcpy(addr + (HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_i64scatter_pd(base_addr, vindex, a, scale) _mm512_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_i64scatter_pd(base_addr, vindex, a, scale) simde_mm512_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_pd (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512d a, const int32_t scale)
+    HEDLEY_REQUIRE_MSG((scale == 1) || (scale == 2) || (scale == 4) || (scale == 8), "scale must be 1, 2, 4, or 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* discard_addr = HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+
+  SIMDE__UNROLL(8)
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    const uintptr_t m = HEDLEY_STATIC_CAST(uintptr_t, -HEDLEY_STATIC_CAST(intptr_t, (k >> i) & 1));
+    const uintptr_t elem_addr =
+      ((HEDLEY_REINTERPRET_CAST(uintptr_t, addr) + HEDLEY_STATIC_CAST(uintptr_t, HEDLEY_STATIC_CAST(ptrdiff_t, vindex_.i64[i]) * scale)) & m) |
+      (HEDLEY_REINTERPRET_CAST(uintptr_t, discard_addr) & ~m);
+    const simde_float64 v = a_.f64[i];
+    simde_memcpy(HEDLEY_REINTERPRET_CAST(void*, elem_addr), &v, sizeof(v));
+  }
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_abs_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_abs_epi32(a);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_abs_epi32(a_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      const __typeof__(r_.u32) m = (__typeof__(r_.u32)) (a_.i32 >> 31);
+      r_.u32 = (a_.u32 ^ m) - m;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = (a_.i32[i] < 0) ? (- a_.u32[i]) : a_.u32[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_abs_epi32(a) simde_mm512_abs_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_abs_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_abs_epi32(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_abs_epi32(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_abs_epi32(src, k, a) simde_mm512_mask_abs_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_abs_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_abs_epi32(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_abs_epi32(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_abs_epi32(k, a) simde_mm512_maskz_abs_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_abs_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_abs_epi64(a);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i m = simde_mm256_cmpgt_epi64(simde_mm256_setzero_si256(), a_.m256i[i]);
+        r_.m256i[i] = simde_mm256_sub_epi64(simde_mm256_xor_si256(a_.m256i[i], m), m);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      const __typeof__(r_.u64) m = (__typeof__(r_.u64)) (a_.i64 >> 63);
+      r_.u64 = (a_.u64 ^ m) - m;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = (a_.i64[i] < 0) ? (- a_.u64[i]) : a_.u64[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_abs_epi64(a) simde_mm512_abs_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_abs_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_abs_epi64(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_abs_epi64(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_abs_epi64(src, k, a) simde_mm512_mask_abs_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_abs_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_abs_epi64(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_abs_epi64(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_abs_epi64(k, a) simde_mm512_maskz_abs_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mullo_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mullo_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_mullo_epi32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u32 = a_.u32 * b_.u32;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = a_.u32[i] * b_.u32[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mullo_epi32(a, b) simde_mm512_mullo_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mullo_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_mullo_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_mullo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mullo_epi32(src, k, a, b) simde_mm512_mask_mullo_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mullo_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_mullo_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_mullo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mullo_epi32(k, a, b) simde_mm512_maskz_mullo_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mullox_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mullox_epi64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u64 = a_.u64 * b_.u64;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = a_.u64[i] * b_.u64[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mullox_epi64(a, b) simde_mm512_mullox_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mullox_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_mullox_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_mullox_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mullox_epi64(src, k, a, b) simde_mm512_mask_mullox_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mul_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mul_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_mul_epi32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i64 = ((a_.i64 << 32) >> 32) * ((b_.i64 << 32) >> 32);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = HEDLEY_STATIC_CAST(int64_t, a_.i32[i * 2]) * HEDLEY_STATIC_CAST(int64_t, b_.i32[i * 2]);
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mul_epi32(a, b) simde_mm512_mul_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mul_epi32 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_mul_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_mul_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mul_epi32(src, k, a, b) simde_mm512_mask_mul_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mul_epi32 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_mul_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_mul_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mul_epi32(k, a, b) simde_mm512_maskz_mul_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mul_epu32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mul_epu32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_mul_epu32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u64 = (a_.u64 & UINT64_C(0xffffffff)) * (b_.u64 & UINT64_C(0xffffffff));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = HEDLEY_STATIC_CAST(uint64_t, a_.u32[i * 2]) * HEDLEY_STATIC_CAST(uint64_t, b_.u32[i * 2]);
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mul_epu32(a, b) simde_mm512_mul_epu32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_mul_epu32 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_mul_epu32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_mul_epu32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_mul_epu32(src, k, a, b) simde_mm512_mask_mul_epu32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_mul_epu32 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_mul_epu32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_mul_epu32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_mul_epu32(k, a, b) simde_mm512_maskz_mul_epu32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_max_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_max_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_max_epi32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.i32) m = (__typeof__(r_.i32)) (a_.i32 > b_.i32);
+      r_.i32 = (a_.i32 & m) | (b_.i32 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = (a_.i32[i] > b_.i32[i]) ? a_.i32[i] : b_.i32[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_max_epi32(a, b) simde_mm512_max_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_max_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_max_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_max_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_max_epi32(src, k, a, b) simde_mm512_mask_max_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_max_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_max_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_max_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_max_epi32(k, a, b) simde_mm512_maskz_max_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_max_epu32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_max_epu32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_max_epu32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.u32) m = (__typeof__(r_.u32)) (a_.u32 > b_.u32);
+      r_.u32 = (a_.u32 & m) | (b_.u32 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = (a_.u32[i] > b_.u32[i]) ? a_.u32[i] : b_.u32[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_max_epu32(a, b) simde_mm512_max_epu32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_max_epu32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_max_epu32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_max_epu32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_max_epu32(src, k, a, b) simde_mm512_mask_max_epu32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_max_epu32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_max_epu32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_max_epu32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_max_epu32(k, a, b) simde_mm512_maskz_max_epu32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_max_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_max_epi64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_blendv_epi8(b_.m256i[i], a_.m256i[i], simde_mm256_cmpgt_epi64(a_.m256i[i], b_.m256i[i]));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.i64) m = (__typeof__(r_.i64)) (a_.i64 > b_.i64);
+      r_.i64 = (a_.i64 & m) | (b_.i64 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = (a_.i64[i] > b_.i64[i]) ? a_.i64[i] : b_.i64[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_max_epi64(a, b) simde_mm512_max_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_max_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_max_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_max_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_max_epi64(src, k, a, b) simde_mm512_mask_max_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_max_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_max_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_max_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_max_epi64(k, a, b) simde_mm512_maskz_max_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_max_epu64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_max_epu64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i sign = simde_mm256_set1_epi64x(INT64_MIN);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i gt = simde_mm256_cmpgt_epi64(simde_mm256_xor_si256(a_.m256i[i], sign), simde_mm256_xor_si256(b_.m256i[i], sign));
+        r_.m256i[i] = simde_mm256_blendv_epi8(b_.m256i[i], a_.m256i[i], gt);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.u64) m = (__typeof__(r_.u64)) (a_.u64 > b_.u64);
+      r_.u64 = (a_.u64 & m) | (b_.u64 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = (a_.u64[i] > b_.u64[i]) ? a_.u64[i] : b_.u64[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_max_epu64(a, b) simde_mm512_max_epu64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_max_epu64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_max_epu64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_max_epu64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_max_epu64(src, k, a, b) simde_mm512_mask_max_epu64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_max_epu64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_max_epu64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_max_epu64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_max_epu64(k, a, b) simde_mm512_maskz_max_epu64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_min_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_min_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_min_epi32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.i32) m = (__typeof__(r_.i32)) (a_.i32 < b_.i32);
+      r_.i32 = (a_.i32 & m) | (b_.i32 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = (a_.i32[i] < b_.i32[i]) ? a_.i32[i] : b_.i32[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_min_epi32(a, b) simde_mm512_min_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_min_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_min_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_min_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_min_epi32(src, k, a, b) simde_mm512_mask_min_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_min_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_min_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_min_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_min_epi32(k, a, b) simde_mm512_maskz_min_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_min_epu32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_min_epu32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_min_epu32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.u32) m = (__typeof__(r_.u32)) (a_.u32 < b_.u32);
+      r_.u32 = (a_.u32 & m) | (b_.u32 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = (a_.u32[i] < b_.u32[i]) ? a_.u32[i] : b_.u32[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_min_epu32(a, b) simde_mm512_min_epu32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_min_epu32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_min_epu32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_min_epu32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_min_epu32(src, k, a, b) simde_mm512_mask_min_epu32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_min_epu32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_min_epu32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_min_epu32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_min_epu32(k, a, b) simde_mm512_maskz_min_epu32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_min_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_min_epi64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_blendv_epi8(a_.m256i[i], b_.m256i[i], simde_mm256_cmpgt_epi64(a_.m256i[i], b_.m256i[i]));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.i64) m = (__typeof__(r_.i64)) (a_.i64 < b_.i64);
+      r_.i64 = (a_.i64 & m) | (b_.i64 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = (a_.i64[i] < b_.i64[i]) ? a_.i64[i] : b_.i64[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_min_epi64(a, b) simde_mm512_min_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_min_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_min_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_min_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_min_epi64(src, k, a, b) simde_mm512_mask_min_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_min_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_min_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_min_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_min_epi64(k, a, b) simde_mm512_maskz_min_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_min_epu64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_min_epu64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i sign = simde_mm256_set1_epi64x(INT64_MIN);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i gt = simde_mm256_cmpgt_epi64(simde_mm256_xor_si256(a_.m256i[i], sign), simde_mm256_xor_si256(b_.m256i[i], sign));
+        r_.m256i[i] = simde_mm256_blendv_epi8(a_.m256i[i], b_.m256i[i], gt);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.u64) m = (__typeof__(r_.u64)) (a_.u64 < b_.u64);
+      r_.u64 = (a_.u64 & m) | (b_.u64 & ~m);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = (a_.u64[i] < b_.u64[i]) ? a_.u64[i] : b_.u64[i];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_min_epu64(a, b) simde_mm512_min_epu64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_min_epu64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_min_epu64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_min_epu64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_min_epu64(src, k, a, b) simde_mm512_mask_min_epu64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_min_epu64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_min_epu64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_min_epu64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_min_epu64(k, a, b) simde_mm512_maskz_min_epu64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_slli_epi32 (simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_slli_epi32(a, imm8);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    if (imm8 > 31) {
+      simde_memset(&r_, 0, sizeof(r_));
+    } else {
+      #if defined(SIMDE_ARCH_X86_AVX2)
+        for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+          r_.m256i[i] = simde_mm256_slli_epi32(a_.m256i[i], HEDLEY_STATIC_CAST(int, imm8));
+        }
+      #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+        r_.u32 = a_.u32 << imm8;
+      #else
+        SIMDE__VECTORIZE
+        for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+          r_.u32[i] = a_.u32[i] << imm8;
+        }
+      #endif
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_slli_epi32(a, imm8) simde_mm512_slli_epi32(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_slli_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_slli_epi32(src, k, a, imm8);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_slli_epi32(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_slli_epi32(src, k, a, imm8) simde_mm512_mask_slli_epi32(src, k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_slli_epi32 (simde__mmask16 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_slli_epi32(k, a, imm8);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_slli_epi32(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_slli_epi32(k, a, imm8) simde_mm512_maskz_slli_epi32(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_slli_epi64 (simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_slli_epi64(a, imm8);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    if (imm8 > 63) {
+      simde_memset(&r_, 0, sizeof(r_));
+    } else {
+      #if defined(SIMDE_ARCH_X86_AVX2)
+        for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+          r_.m256i[i] = simde_mm256_slli_epi64(a_.m256i[i], HEDLEY_STATIC_CAST(int, imm8));
+        }
+      #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+        r_.u64 = a_.u64 << imm8;
+      #else
+        SIMDE__VECTORIZE
+        for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+          r_.u64[i] = a_.u64[i] << imm8;
+        }
+      #endif
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_slli_epi64(a, imm8) simde_mm512_slli_epi64(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_slli_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_slli_epi64(src, k, a, imm8);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_slli_epi64(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_slli_epi64(src, k, a, imm8) simde_mm512_mask_slli_epi64(src, k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_slli_epi64 (simde__mmask8 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_slli_epi64(k, a, imm8);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_slli_epi64(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_slli_epi64(k, a, imm8) simde_mm512_maskz_slli_epi64(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srli_epi32 (simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srli_epi32(a, imm8);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    if (imm8 > 31) {
+      simde_memset(&r_, 0, sizeof(r_));
+    } else {
+      #if defined(SIMDE_ARCH_X86_AVX2)
+        for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+          r_.m256i[i] = simde_mm256_srli_epi32(a_.m256i[i], HEDLEY_STATIC_CAST(int, imm8));
+        }
+      #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+        r_.u32 = a_.u32 >> imm8;
+      #else
+        SIMDE__VECTORIZE
+        for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+          r_.u32[i] = a_.u32[i] >> imm8;
+        }
+      #endif
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srli_epi32(a, imm8) simde_mm512_srli_epi32(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srli_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srli_epi32(src, k, a, imm8);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_srli_epi32(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srli_epi32(src, k, a, imm8) simde_mm512_mask_srli_epi32(src, k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srli_epi32 (simde__mmask16 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srli_epi32(k, a, imm8);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_srli_epi32(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srli_epi32(k, a, imm8) simde_mm512_maskz_srli_epi32(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srai_epi32 (simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srai_epi32(a, imm8);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    /* Counts larger than the element size fill with the sign bit. */
+    const unsigned int shift = (imm8 > 31) ? 31 : imm8;
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_srai_epi32(a_.m256i[i], HEDLEY_STATIC_CAST(int, shift));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.i32 = a_.i32 >> HEDLEY_STATIC_CAST(int32_t, shift);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = a_.i32[i] >> shift;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srai_epi32(a, imm8) simde_mm512_srai_epi32(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srai_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srai_epi32(src, k, a, imm8);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_srai_epi32(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srai_epi32(src, k, a, imm8) simde_mm512_mask_srai_epi32(src, k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srai_epi32 (simde__mmask16 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srai_epi32(k, a, imm8);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_srai_epi32(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srai_epi32(k, a, imm8) simde_mm512_maskz_srai_epi32(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srai_epi64 (simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srai_epi64(a, imm8);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    /* Counts larger than the element size fill with the sign bit. */
+    const unsigned int shift = (imm8 > 63) ? 63 : imm8;
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.i64 = a_.i64 >> HEDLEY_STATIC_CAST(int64_t, shift);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = a_.i64[i] >> shift;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srai_epi64(a, imm8) simde_mm512_srai_epi64(a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srai_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srai_epi64(src, k, a, imm8);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_srai_epi64(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srai_epi64(src, k, a, imm8) simde_mm512_mask_srai_epi64(src, k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srai_epi64 (simde__mmask8 k, simde__m512i a, unsigned int imm8) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srai_epi64(k, a, imm8);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_srai_epi64(a, imm8));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srai_epi64(k, a, imm8) simde_mm512_maskz_srai_epi64(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sll_epi32 (simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sll_epi32(a, count);
+  #else
+    simde__m128i_private count_ = simde__m128i_to_private(count);
+
+    return simde_mm512_slli_epi32(a, HEDLEY_STATIC_CAST(unsigned int, (count_.u64[0] > 32) ? 32 : count_.u64[0]));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sll_epi32(a, count) simde_mm512_sll_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sll_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sll_epi32(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_sll_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sll_epi32(src, k, a, count) simde_mm512_mask_sll_epi32(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sll_epi32 (simde__mmask16 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sll_epi32(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_sll_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sll_epi32(k, a, count) simde_mm512_maskz_sll_epi32(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sll_epi64 (simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sll_epi64(a, count);
+  #else
+    simde__m128i_private count_ = simde__m128i_to_private(count);
+
+    return simde_mm512_slli_epi64(a, HEDLEY_STATIC_CAST(unsigned int, (count_.u64[0] > 64) ? 64 : count_.u64[0]));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sll_epi64(a, count) simde_mm512_sll_epi64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sll_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sll_epi64(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_sll_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sll_epi64(src, k, a, count) simde_mm512_mask_sll_epi64(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sll_epi64 (simde__mmask8 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sll_epi64(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_sll_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sll_epi64(k, a, count) simde_mm512_maskz_sll_epi64(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srl_epi32 (simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srl_epi32(a, count);
+  #else
+    simde__m128i_private count_ = simde__m128i_to_private(count);
+
+    return simde_mm512_srli_epi32(a, HEDLEY_STATIC_CAST(unsigned int, (count_.u64[0] > 32) ? 32 : count_.u64[0]));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srl_epi32(a, count) simde_mm512_srl_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srl_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srl_epi32(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_srl_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srl_epi32(src, k, a, count) simde_mm512_mask_srl_epi32(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srl_epi32 (simde__mmask16 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srl_epi32(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_srl_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srl_epi32(k, a, count) simde_mm512_maskz_srl_epi32(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srl_epi64 (simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srl_epi64(a, count);
+  #else
+    simde__m128i_private count_ = simde__m128i_to_private(count);
+
+    return simde_mm512_srli_epi64(a, HEDLEY_STATIC_CAST(unsigned int, (count_.u64[0] > 64) ? 64 : count_.u64[0]));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srl_epi64(a, count) simde_mm512_srl_epi64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srl_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srl_epi64(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_srl_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srl_epi64(src, k, a, count) simde_mm512_mask_srl_epi64(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srl_epi64 (simde__mmask8 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srl_epi64(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_srl_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srl_epi64(k, a, count) simde_mm512_maskz_srl_epi64(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sra_epi32 (simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sra_epi32(a, count);
+  #else
+    simde__m128i_private count_ = simde__m128i_to_private(count);
+
+    return simde_mm512_srai_epi32(a, HEDLEY_STATIC_CAST(unsigned int, (count_.u64[0] > 31) ? 31 : count_.u64[0]));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sra_epi32(a, count) simde_mm512_sra_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sra_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sra_epi32(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_sra_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sra_epi32(src, k, a, count) simde_mm512_mask_sra_epi32(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sra_epi32 (simde__mmask16 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sra_epi32(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_sra_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sra_epi32(k, a, count) simde_mm512_maskz_sra_epi32(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sra_epi64 (simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sra_epi64(a, count);
+  #else
+    simde__m128i_private count_ = simde__m128i_to_private(count);
+
+    return simde_mm512_srai_epi64(a, HEDLEY_STATIC_CAST(unsigned int, (count_.u64[0] > 63) ? 63 : count_.u64[0]));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sra_epi64(a, count) simde_mm512_sra_epi64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sra_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sra_epi64(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_sra_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sra_epi64(src, k, a, count) simde_mm512_mask_sra_epi64(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sra_epi64 (simde__mmask8 k, simde__m512i a, simde__m128i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sra_epi64(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_sra_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sra_epi64(k, a, count) simde_mm512_maskz_sra_epi64(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sllv_epi32 (simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sllv_epi32(a, count);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      count_ = simde__m512i_to_private(count);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_sllv_epi32(a_.m256i[i], count_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u32 = (a_.u32 << (count_.u32 & 31)) & ((__typeof__(r_.u32)) (count_.u32 < 32));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = (count_.u32[i] < 32) ? (a_.u32[i] << count_.u32[i]) : 0;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sllv_epi32(a, count) simde_mm512_sllv_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sllv_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sllv_epi32(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_sllv_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sllv_epi32(src, k, a, count) simde_mm512_mask_sllv_epi32(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sllv_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sllv_epi32(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_sllv_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sllv_epi32(k, a, count) simde_mm512_maskz_sllv_epi32(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_sllv_epi64 (simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sllv_epi64(a, count);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      count_ = simde__m512i_to_private(count);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_sllv_epi64(a_.m256i[i], count_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u64 = (a_.u64 << (count_.u64 & 63)) & ((__typeof__(r_.u64)) (count_.u64 < 64));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = (count_.u64[i] < 64) ? (a_.u64[i] << count_.u64[i]) : 0;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sllv_epi64(a, count) simde_mm512_sllv_epi64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_sllv_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sllv_epi64(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_sllv_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sllv_epi64(src, k, a, count) simde_mm512_mask_sllv_epi64(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_sllv_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sllv_epi64(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_sllv_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sllv_epi64(k, a, count) simde_mm512_maskz_sllv_epi64(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srlv_epi32 (simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srlv_epi32(a, count);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      count_ = simde__m512i_to_private(count);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_srlv_epi32(a_.m256i[i], count_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u32 = (a_.u32 >> (count_.u32 & 31)) & ((__typeof__(r_.u32)) (count_.u32 < 32));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = (count_.u32[i] < 32) ? (a_.u32[i] >> count_.u32[i]) : 0;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srlv_epi32(a, count) simde_mm512_srlv_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srlv_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srlv_epi32(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_srlv_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srlv_epi32(src, k, a, count) simde_mm512_mask_srlv_epi32(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srlv_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srlv_epi32(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_srlv_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srlv_epi32(k, a, count) simde_mm512_maskz_srlv_epi32(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srlv_epi64 (simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srlv_epi64(a, count);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      count_ = simde__m512i_to_private(count);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_srlv_epi64(a_.m256i[i], count_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u64 = (a_.u64 >> (count_.u64 & 63)) & ((__typeof__(r_.u64)) (count_.u64 < 64));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = (count_.u64[i] < 64) ? (a_.u64[i] >> count_.u64[i]) : 0;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srlv_epi64(a, count) simde_mm512_srlv_epi64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srlv_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srlv_epi64(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_srlv_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srlv_epi64(src, k, a, count) simde_mm512_mask_srlv_epi64(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srlv_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srlv_epi64(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_srlv_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srlv_epi64(k, a, count) simde_mm512_maskz_srlv_epi64(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srav_epi32 (simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srav_epi32(a, count);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      count_ = simde__m512i_to_private(count);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_srav_epi32(a_.m256i[i], count_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32 = a_.i32 >> ((__typeof__(r_.i32)) ((count_.u32 | ((__typeof__(count_.u32)) (count_.u32 > 31))) & 31));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = a_.i32[i] >> ((count_.u32[i] > 31) ? 31 : count_.u32[i]);
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srav_epi32(a, count) simde_mm512_srav_epi32(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srav_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srav_epi32(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_srav_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srav_epi32(src, k, a, count) simde_mm512_mask_srav_epi32(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srav_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srav_epi32(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_srav_epi32(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srav_epi32(k, a, count) simde_mm512_maskz_srav_epi32(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_srav_epi64 (simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_srav_epi64(a, count);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      count_ = simde__m512i_to_private(count);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i64 = a_.i64 >> ((__typeof__(r_.i64)) ((count_.u64 | ((__typeof__(count_.u64)) (count_.u64 > 63))) & 63));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = a_.i64[i] >> ((count_.u64[i] > 63) ? 63 : count_.u64[i]);
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_srav_epi64(a, count) simde_mm512_srav_epi64(a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_srav_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_srav_epi64(src, k, a, count);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_srav_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_srav_epi64(src, k, a, count) simde_mm512_mask_srav_epi64(src, k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_srav_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i count) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_srav_epi64(k, a, count);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_srav_epi64(a, count));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_srav_epi64(k, a, count) simde_mm512_maskz_srav_epi64(k, a, count)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_rol_epi32 (simde__m512i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+  const int s = imm8 & 31;
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_or_si256(simde_mm256_slli_epi32(a_.m256i[i], s), simde_mm256_srli_epi32(a_.m256i[i], (32 - s) & 31));
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u32 = (a_.u32 << s) | (a_.u32 >> ((32 - s) & 31));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (a_.u32[i] << s) | (a_.u32[i] >> ((32 - s) & 31));
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_rol_epi32(a, imm8) _mm512_rol_epi32(a, imm8)
+#  define simde_mm512_mask_rol_epi32(src, k, a, imm8) _mm512_mask_rol_epi32(src, k, a, imm8)
+#  define simde_mm512_maskz_rol_epi32(k, a, imm8) _mm512_maskz_rol_epi32(k, a, imm8)
+#else
+#  define simde_mm512_mask_rol_epi32(src, k, a, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_rol_epi32(a, imm8))
+#  define simde_mm512_maskz_rol_epi32(k, a, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_rol_epi32(a, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rol_epi32(a, imm8) simde_mm512_rol_epi32(a, imm8)
+#  define _mm512_mask_rol_epi32(src, k, a, imm8) simde_mm512_mask_rol_epi32(src, k, a, imm8)
+#  define _mm512_maskz_rol_epi32(k, a, imm8) simde_mm512_maskz_rol_epi32(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_rol_epi64 (simde__m512i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+  const int s = imm8 & 63;
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_or_si256(simde_mm256_slli_epi64(a_.m256i[i], s), simde_mm256_srli_epi64(a_.m256i[i], (64 - s) & 63));
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u64 = (a_.u64 << s) | (a_.u64 >> ((64 - s) & 63));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (a_.u64[i] << s) | (a_.u64[i] >> ((64 - s) & 63));
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_rol_epi64(a, imm8) _mm512_rol_epi64(a, imm8)
+#  define simde_mm512_mask_rol_epi64(src, k, a, imm8) _mm512_mask_rol_epi64(src, k, a, imm8)
+#  define simde_mm512_maskz_rol_epi64(k, a, imm8) _mm512_maskz_rol_epi64(k, a, imm8)
+#else
+#  define simde_mm512_mask_rol_epi64(src, k, a, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_rol_epi64(a, imm8))
+#  define simde_mm512_maskz_rol_epi64(k, a, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_rol_epi64(a, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rol_epi64(a, imm8) simde_mm512_rol_epi64(a, imm8)
+#  define _mm512_mask_rol_epi64(src, k, a, imm8) simde_mm512_mask_rol_epi64(src, k, a, imm8)
+#  define _mm512_maskz_rol_epi64(k, a, imm8) simde_mm512_maskz_rol_epi64(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_ror_epi32 (simde__m512i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+  const int s = imm8 & 31;
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_or_si256(simde_mm256_srli_epi32(a_.m256i[i], s), simde_mm256_slli_epi32(a_.m256i[i], (32 - s) & 31));
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u32 = (a_.u32 >> s) | (a_.u32 << ((32 - s) & 31));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (a_.u32[i] >> s) | (a_.u32[i] << ((32 - s) & 31));
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_ror_epi32(a, imm8) _mm512_ror_epi32(a, imm8)
+#  define simde_mm512_mask_ror_epi32(src, k, a, imm8) _mm512_mask_ror_epi32(src, k, a, imm8)
+#  define simde_mm512_maskz_ror_epi32(k, a, imm8) _mm512_maskz_ror_epi32(k, a, imm8)
+#else
+#  define simde_mm512_mask_ror_epi32(src, k, a, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_ror_epi32(a, imm8))
+#  define simde_mm512_maskz_ror_epi32(k, a, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_ror_epi32(a, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_ror_epi32(a, imm8) simde_mm512_ror_epi32(a, imm8)
+#  define _mm512_mask_ror_epi32(src, k, a, imm8) simde_mm512_mask_ror_epi32(src, k, a, imm8)
+#  define _mm512_maskz_ror_epi32(k, a, imm8) simde_mm512_maskz_ror_epi32(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_ror_epi64 (simde__m512i a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a);
+  const int s = imm8 & 63;
+
+  #if defined(SIMDE_ARCH_X86_AVX2)
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_or_si256(simde_mm256_srli_epi64(a_.m256i[i], s), simde_mm256_slli_epi64(a_.m256i[i], (64 - s) & 63));
+    }
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u64 = (a_.u64 >> s) | (a_.u64 << ((64 - s) & 63));
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (a_.u64[i] >> s) | (a_.u64[i] << ((64 - s) & 63));
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_ror_epi64(a, imm8) _mm512_ror_epi64(a, imm8)
+#  define simde_mm512_mask_ror_epi64(src, k, a, imm8) _mm512_mask_ror_epi64(src, k, a, imm8)
+#  define simde_mm512_maskz_ror_epi64(k, a, imm8) _mm512_maskz_ror_epi64(k, a, imm8)
+#else
+#  define simde_mm512_mask_ror_epi64(src, k, a, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_ror_epi64(a, imm8))
+#  define simde_mm512_maskz_ror_epi64(k, a, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_ror_epi64(a, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_ror_epi64(a, imm8) simde_mm512_ror_epi64(a, imm8)
+#  define _mm512_mask_ror_epi64(src, k, a, imm8) simde_mm512_mask_ror_epi64(src, k, a, imm8)
+#  define _mm512_maskz_ror_epi64(k, a, imm8) simde_mm512_maskz_ror_epi64(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_rolv_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rolv_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i mask = simde_mm256_set1_epi32(31);
+      const simde__m256i width = simde_mm256_set1_epi32(32);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i s = simde_mm256_and_si256(b_.m256i[i], mask);
+        r_.m256i[i] = simde_mm256_or_si256(simde_mm256_sllv_epi32(a_.m256i[i], s), simde_mm256_srlv_epi32(a_.m256i[i], simde_mm256_sub_epi32(width, s)));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      const __typeof__(r_.u32) s = b_.u32 & 31;
+      r_.u32 = (a_.u32 << s) | (a_.u32 >> ((32 - s) & 31));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const uint32_t s = b_.u32[i] & 31;
+        r_.u32[i] = (a_.u32[i] << s) | (a_.u32[i] >> ((32 - s) & 31));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rolv_epi32(a, b) simde_mm512_rolv_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_rolv_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rolv_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_rolv_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rolv_epi32(src, k, a, b) simde_mm512_mask_rolv_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_rolv_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rolv_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_rolv_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rolv_epi32(k, a, b) simde_mm512_maskz_rolv_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_rolv_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rolv_epi64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i mask = simde_mm256_set1_epi64x(63);
+      const simde__m256i width = simde_mm256_set1_epi64x(64);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i s = simde_mm256_and_si256(b_.m256i[i], mask);
+        r_.m256i[i] = simde_mm256_or_si256(simde_mm256_sllv_epi64(a_.m256i[i], s), simde_mm256_srlv_epi64(a_.m256i[i], simde_mm256_sub_epi64(width, s)));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      const __typeof__(r_.u64) s = b_.u64 & 63;
+      r_.u64 = (a_.u64 << s) | (a_.u64 >> ((64 - s) & 63));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t s = b_.u64[i] & 63;
+        r_.u64[i] = (a_.u64[i] << s) | (a_.u64[i] >> ((64 - s) & 63));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rolv_epi64(a, b) simde_mm512_rolv_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_rolv_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rolv_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_rolv_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rolv_epi64(src, k, a, b) simde_mm512_mask_rolv_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_rolv_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rolv_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_rolv_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rolv_epi64(k, a, b) simde_mm512_maskz_rolv_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_rorv_epi32 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rorv_epi32(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i mask = simde_mm256_set1_epi32(31);
+      const simde__m256i width = simde_mm256_set1_epi32(32);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i s = simde_mm256_and_si256(b_.m256i[i], mask);
+        r_.m256i[i] = simde_mm256_or_si256(simde_mm256_srlv_epi32(a_.m256i[i], s), simde_mm256_sllv_epi32(a_.m256i[i], simde_mm256_sub_epi32(width, s)));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      const __typeof__(r_.u32) s = b_.u32 & 31;
+      r_.u32 = (a_.u32 >> s) | (a_.u32 << ((32 - s) & 31));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const uint32_t s = b_.u32[i] & 31;
+        r_.u32[i] = (a_.u32[i] >> s) | (a_.u32[i] << ((32 - s) & 31));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rorv_epi32(a, b) simde_mm512_rorv_epi32(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_rorv_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rorv_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_rorv_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rorv_epi32(src, k, a, b) simde_mm512_mask_rorv_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_rorv_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rorv_epi32(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_rorv_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rorv_epi32(k, a, b) simde_mm512_maskz_rorv_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_rorv_epi64 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rorv_epi64(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i mask = simde_mm256_set1_epi64x(63);
+      const simde__m256i width = simde_mm256_set1_epi64x(64);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        const simde__m256i s = simde_mm256_and_si256(b_.m256i[i], mask);
+        r_.m256i[i] = simde_mm256_or_si256(simde_mm256_srlv_epi64(a_.m256i[i], s), simde_mm256_sllv_epi64(a_.m256i[i], simde_mm256_sub_epi64(width, s)));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      const __typeof__(r_.u64) s = b_.u64 & 63;
+      r_.u64 = (a_.u64 >> s) | (a_.u64 << ((64 - s) & 63));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t s = b_.u64[i] & 63;
+        r_.u64[i] = (a_.u64[i] >> s) | (a_.u64[i] << ((64 - s) & 63));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rorv_epi64(a, b) simde_mm512_rorv_epi64(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_rorv_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rorv_epi64(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_rorv_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rorv_epi64(src, k, a, b) simde_mm512_mask_rorv_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_rorv_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rorv_epi64(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_rorv_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rorv_epi64(k, a, b) simde_mm512_maskz_rorv_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpgt_epi32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpgt_epi32_mask(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_cmpgt_epi32(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32 = (__typeof__(r_.i32)) (a_.i32 > b_.i32);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = (a_.i32[i] > b_.i32[i]) ? ~INT32_C(0) : INT32_C(0);
+      }
+    #endif
+
+    return simde__m512i_private_to_mmask16(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epi32_mask(a, b) simde_mm512_cmpgt_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpge_epi32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpge_epi32_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ~simde_mm512_cmpgt_epi32_mask(b, a) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epi32_mask(a, b) simde_mm512_cmpge_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpge_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpge_epi32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpge_epi32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epi32_mask(k1, a, b) simde_mm512_mask_cmpge_epi32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmple_epi32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmple_epi32_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ~simde_mm512_cmpgt_epi32_mask(a, b) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epi32_mask(a, b) simde_mm512_cmple_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmple_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmple_epi32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmple_epi32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epi32_mask(k1, a, b) simde_mm512_mask_cmple_epi32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmplt_epi32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmplt_epi32_mask(a, b);
+  #else
+    return simde_mm512_cmpgt_epi32_mask(b, a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epi32_mask(a, b) simde_mm512_cmplt_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmplt_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmplt_epi32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmplt_epi32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epi32_mask(k1, a, b) simde_mm512_mask_cmplt_epi32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpneq_epi32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpneq_epi32_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ~simde_mm512_cmpeq_epi32_mask(a, b) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epi32_mask(a, b) simde_mm512_cmpneq_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpneq_epi32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpneq_epi32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpneq_epi32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epi32_mask(k1, a, b) simde_mm512_mask_cmpneq_epi32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmp_epi32_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT16_C(0xffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_epi32_mask(a, b, imm8) _mm512_cmp_epi32_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epi32_mask(k1, a, b, imm8) _mm512_mask_cmp_epi32_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epi32_mask(k1, a, b, imm8) (simde_mm512_cmp_epi32_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epi32_mask(a, b, imm8) simde_mm512_cmp_epi32_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epi32_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epi32_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpeq_epu32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpeq_epu32_mask(a, b);
+  #else
+    return simde_mm512_cmpeq_epi32_mask(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpeq_epu32_mask(a, b) simde_mm512_cmpeq_epu32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpeq_epu32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpeq_epu32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpeq_epu32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epu32_mask(k1, a, b) simde_mm512_mask_cmpeq_epu32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpgt_epu32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpgt_epu32_mask(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i sign = simde_mm256_set1_epi32(INT32_MIN);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_cmpgt_epi32(simde_mm256_xor_si256(a_.m256i[i], sign), simde_mm256_xor_si256(b_.m256i[i], sign));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i32 = (__typeof__(r_.i32)) (a_.u32 > b_.u32);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = (a_.u32[i] > b_.u32[i]) ? ~INT32_C(0) : INT32_C(0);
+      }
+    #endif
+
+    return simde__m512i_private_to_mmask16(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epu32_mask(a, b) simde_mm512_cmpgt_epu32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpgt_epu32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpgt_epu32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpgt_epu32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epu32_mask(k1, a, b) simde_mm512_mask_cmpgt_epu32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpge_epu32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpge_epu32_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ~simde_mm512_cmpgt_epu32_mask(b, a) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epu32_mask(a, b) simde_mm512_cmpge_epu32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpge_epu32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpge_epu32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpge_epu32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epu32_mask(k1, a, b) simde_mm512_mask_cmpge_epu32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmple_epu32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmple_epu32_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ~simde_mm512_cmpgt_epu32_mask(a, b) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epu32_mask(a, b) simde_mm512_cmple_epu32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmple_epu32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmple_epu32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmple_epu32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epu32_mask(k1, a, b) simde_mm512_mask_cmple_epu32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmplt_epu32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmplt_epu32_mask(a, b);
+  #else
+    return simde_mm512_cmpgt_epu32_mask(b, a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epu32_mask(a, b) simde_mm512_cmplt_epu32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmplt_epu32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmplt_epu32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmplt_epu32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epu32_mask(k1, a, b) simde_mm512_mask_cmplt_epu32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmpneq_epu32_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpneq_epu32_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ~simde_mm512_cmpeq_epi32_mask(a, b) & UINT16_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epu32_mask(a, b) simde_mm512_cmpneq_epu32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_mask_cmpneq_epu32_mask (simde__mmask16 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpneq_epu32_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpneq_epu32_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epu32_mask(k1, a, b) simde_mm512_mask_cmpneq_epu32_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmp_epu32_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epu32_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epu32_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epu32_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epu32_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epu32_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epu32_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT16_C(0xffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_epu32_mask(a, b, imm8) _mm512_cmp_epu32_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epu32_mask(k1, a, b, imm8) _mm512_mask_cmp_epu32_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epu32_mask(k1, a, b, imm8) (simde_mm512_cmp_epu32_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epu32_mask(a, b, imm8) simde_mm512_cmp_epu32_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epu32_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epu32_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpgt_epi64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpgt_epi64_mask(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_cmpgt_epi64(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i64 = (__typeof__(r_.i64)) (a_.i64 > b_.i64);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = (a_.i64[i] > b_.i64[i]) ? ~INT64_C(0) : INT64_C(0);
+      }
+    #endif
+
+    return simde__m512i_private_to_mmask8(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epi64_mask(a, b) simde_mm512_cmpgt_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpge_epi64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpge_epi64_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, ~simde_mm512_cmpgt_epi64_mask(b, a) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epi64_mask(a, b) simde_mm512_cmpge_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpge_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpge_epi64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpge_epi64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epi64_mask(k1, a, b) simde_mm512_mask_cmpge_epi64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmple_epi64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmple_epi64_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, ~simde_mm512_cmpgt_epi64_mask(a, b) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epi64_mask(a, b) simde_mm512_cmple_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmple_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmple_epi64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmple_epi64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epi64_mask(k1, a, b) simde_mm512_mask_cmple_epi64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmplt_epi64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmplt_epi64_mask(a, b);
+  #else
+    return simde_mm512_cmpgt_epi64_mask(b, a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epi64_mask(a, b) simde_mm512_cmplt_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmplt_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmplt_epi64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmplt_epi64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epi64_mask(k1, a, b) simde_mm512_mask_cmplt_epi64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpneq_epi64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpneq_epi64_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, ~simde_mm512_cmpeq_epi64_mask(a, b) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epi64_mask(a, b) simde_mm512_cmpneq_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpneq_epi64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpneq_epi64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpneq_epi64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epi64_mask(k1, a, b) simde_mm512_mask_cmpneq_epi64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmp_epi64_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0xff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_epi64_mask(a, b, imm8) _mm512_cmp_epi64_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epi64_mask(k1, a, b, imm8) _mm512_mask_cmp_epi64_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epi64_mask(k1, a, b, imm8) (simde_mm512_cmp_epi64_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epi64_mask(a, b, imm8) simde_mm512_cmp_epi64_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epi64_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epi64_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpeq_epu64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpeq_epu64_mask(a, b);
+  #else
+    return simde_mm512_cmpeq_epi64_mask(a, b);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpeq_epu64_mask(a, b) simde_mm512_cmpeq_epu64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpeq_epu64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpeq_epu64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpeq_epu64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpeq_epu64_mask(k1, a, b) simde_mm512_mask_cmpeq_epu64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpgt_epu64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpgt_epu64_mask(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_ARCH_X86_AVX2)
+      const simde__m256i sign = simde_mm256_set1_epi64x(INT64_MIN);
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_cmpgt_epi64(simde_mm256_xor_si256(a_.m256i[i], sign), simde_mm256_xor_si256(b_.m256i[i], sign));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.i64 = (__typeof__(r_.i64)) (a_.u64 > b_.u64);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = (a_.u64[i] > b_.u64[i]) ? ~INT64_C(0) : INT64_C(0);
+      }
+    #endif
+
+    return simde__m512i_private_to_mmask8(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpgt_epu64_mask(a, b) simde_mm512_cmpgt_epu64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpgt_epu64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpgt_epu64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpgt_epu64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpgt_epu64_mask(k1, a, b) simde_mm512_mask_cmpgt_epu64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpge_epu64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpge_epu64_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, ~simde_mm512_cmpgt_epu64_mask(b, a) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpge_epu64_mask(a, b) simde_mm512_cmpge_epu64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpge_epu64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpge_epu64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpge_epu64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpge_epu64_mask(k1, a, b) simde_mm512_mask_cmpge_epu64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmple_epu64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmple_epu64_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, ~simde_mm512_cmpgt_epu64_mask(a, b) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmple_epu64_mask(a, b) simde_mm512_cmple_epu64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmple_epu64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmple_epu64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmple_epu64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmple_epu64_mask(k1, a, b) simde_mm512_mask_cmple_epu64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmplt_epu64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmplt_epu64_mask(a, b);
+  #else
+    return simde_mm512_cmpgt_epu64_mask(b, a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmplt_epu64_mask(a, b) simde_mm512_cmplt_epu64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmplt_epu64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmplt_epu64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmplt_epu64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmplt_epu64_mask(k1, a, b) simde_mm512_mask_cmplt_epu64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmpneq_epu64_mask (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_cmpneq_epu64_mask(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, ~simde_mm512_cmpeq_epi64_mask(a, b) & UINT8_C(0xff));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmpneq_epu64_mask(a, b) simde_mm512_cmpneq_epu64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_mask_cmpneq_epu64_mask (simde__mmask8 k1, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_cmpneq_epu64_mask(k1, a, b);
+  #else
+    return simde_mm512_cmpneq_epu64_mask(a, b) & k1;
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_cmpneq_epu64_mask(k1, a, b) simde_mm512_mask_cmpneq_epu64_mask(k1, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmp_epu64_mask (simde__m512i a, simde__m512i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm512_cmpeq_epu64_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm512_cmplt_epu64_mask(a, b);
+    case SIMDE_MM_CMPINT_LE:
+      return simde_mm512_cmple_epu64_mask(a, b);
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return simde_mm512_cmpneq_epu64_mask(a, b);
+    case SIMDE_MM_CMPINT_NLT:
+      return simde_mm512_cmpge_epu64_mask(a, b);
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm512_cmpgt_epu64_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0xff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_epu64_mask(a, b, imm8) _mm512_cmp_epu64_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_epu64_mask(k1, a, b, imm8) _mm512_mask_cmp_epu64_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_epu64_mask(k1, a, b, imm8) (simde_mm512_cmp_epu64_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_epu64_mask(a, b, imm8) simde_mm512_cmp_epu64_mask(a, b, imm8)
+#  define _mm512_mask_cmp_epu64_mask(k1, a, b, imm8) simde_mm512_mask_cmp_epu64_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_fmadd_ps (simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fmadd_ps(a, b, c);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b),
+      c_ = simde__m512_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_fmadd_ps(a_.m256[i], b_.m256[i], c_.m256[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128_private) / sizeof(r_.m128_private[0])) ; i++) {
+        r_.m128_private[i].neon_f32 = vfmaq_f32(c_.m128_private[i].neon_f32, a_.m128_private[i].neon_f32, b_.m128_private[i].neon_f32);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f32 = (a_.f32 * b_.f32) + c_.f32;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = (a_.f32[i] * b_.f32[i]) + c_.f32[i];
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fmadd_ps(a, b, c) simde_mm512_fmadd_ps(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_fmadd_ps (simde__m512 a, simde__mmask16 k, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fmadd_ps(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_ps(a, k, simde_mm512_fmadd_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fmadd_ps(a, k, b, c) simde_mm512_mask_fmadd_ps(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask3_fmadd_ps (simde__m512 a, simde__m512 b, simde__m512 c, simde__mmask16 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fmadd_ps(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_ps(c, k, simde_mm512_fmadd_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fmadd_ps(a, b, c, k) simde_mm512_mask3_fmadd_ps(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_fmadd_ps (simde__mmask16 k, simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fmadd_ps(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_fmadd_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fmadd_ps(k, a, b, c) simde_mm512_maskz_fmadd_ps(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_fmadd_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fmadd_pd(a, b, c);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b),
+      c_ = simde__m512d_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_fmadd_pd(a_.m256d[i], b_.m256d[i], c_.m256d[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d_private) / sizeof(r_.m128d_private[0])) ; i++) {
+        r_.m128d_private[i].neon_f64 = vfmaq_f64(c_.m128d_private[i].neon_f64, a_.m128d_private[i].neon_f64, b_.m128d_private[i].neon_f64);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f64 = (a_.f64 * b_.f64) + c_.f64;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = (a_.f64[i] * b_.f64[i]) + c_.f64[i];
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fmadd_pd(a, b, c) simde_mm512_fmadd_pd(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_fmadd_pd (simde__m512d a, simde__mmask8 k, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fmadd_pd(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_pd(a, k, simde_mm512_fmadd_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fmadd_pd(a, k, b, c) simde_mm512_mask_fmadd_pd(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask3_fmadd_pd (simde__m512d a, simde__m512d b, simde__m512d c, simde__mmask8 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fmadd_pd(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_pd(c, k, simde_mm512_fmadd_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fmadd_pd(a, b, c, k) simde_mm512_mask3_fmadd_pd(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_fmadd_pd (simde__mmask8 k, simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fmadd_pd(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_fmadd_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fmadd_pd(k, a, b, c) simde_mm512_maskz_fmadd_pd(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_fmsub_ps (simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fmsub_ps(a, b, c);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b),
+      c_ = simde__m512_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_fmsub_ps(a_.m256[i], b_.m256[i], c_.m256[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128_private) / sizeof(r_.m128_private[0])) ; i++) {
+        r_.m128_private[i].neon_f32 = vnegq_f32(vfmsq_f32(c_.m128_private[i].neon_f32, a_.m128_private[i].neon_f32, b_.m128_private[i].neon_f32));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f32 = (a_.f32 * b_.f32) - c_.f32;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = (a_.f32[i] * b_.f32[i]) - c_.f32[i];
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fmsub_ps(a, b, c) simde_mm512_fmsub_ps(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_fmsub_ps (simde__m512 a, simde__mmask16 k, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fmsub_ps(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_ps(a, k, simde_mm512_fmsub_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fmsub_ps(a, k, b, c) simde_mm512_mask_fmsub_ps(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask3_fmsub_ps (simde__m512 a, simde__m512 b, simde__m512 c, simde__mmask16 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fmsub_ps(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_ps(c, k, simde_mm512_fmsub_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fmsub_ps(a, b, c, k) simde_mm512_mask3_fmsub_ps(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_fmsub_ps (simde__mmask16 k, simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fmsub_ps(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_fmsub_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fmsub_ps(k, a, b, c) simde_mm512_maskz_fmsub_ps(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_fmsub_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fmsub_pd(a, b, c);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b),
+      c_ = simde__m512d_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_fmsub_pd(a_.m256d[i], b_.m256d[i], c_.m256d[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d_private) / sizeof(r_.m128d_private[0])) ; i++) {
+        r_.m128d_private[i].neon_f64 = vnegq_f64(vfmsq_f64(c_.m128d_private[i].neon_f64, a_.m128d_private[i].neon_f64, b_.m128d_private[i].neon_f64));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f64 = (a_.f64 * b_.f64) - c_.f64;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = (a_.f64[i] * b_.f64[i]) - c_.f64[i];
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fmsub_pd(a, b, c) simde_mm512_fmsub_pd(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_fmsub_pd (simde__m512d a, simde__mmask8 k, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fmsub_pd(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_pd(a, k, simde_mm512_fmsub_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fmsub_pd(a, k, b, c) simde_mm512_mask_fmsub_pd(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask3_fmsub_pd (simde__m512d a, simde__m512d b, simde__m512d c, simde__mmask8 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fmsub_pd(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_pd(c, k, simde_mm512_fmsub_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fmsub_pd(a, b, c, k) simde_mm512_mask3_fmsub_pd(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_fmsub_pd (simde__mmask8 k, simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fmsub_pd(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_fmsub_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fmsub_pd(k, a, b, c) simde_mm512_maskz_fmsub_pd(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_fnmadd_ps (simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fnmadd_ps(a, b, c);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b),
+      c_ = simde__m512_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_fnmadd_ps(a_.m256[i], b_.m256[i], c_.m256[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128_private) / sizeof(r_.m128_private[0])) ; i++) {
+        r_.m128_private[i].neon_f32 = vfmsq_f32(c_.m128_private[i].neon_f32, a_.m128_private[i].neon_f32, b_.m128_private[i].neon_f32);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f32 = -(a_.f32 * b_.f32) + c_.f32;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = -(a_.f32[i] * b_.f32[i]) + c_.f32[i];
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fnmadd_ps(a, b, c) simde_mm512_fnmadd_ps(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_fnmadd_ps (simde__m512 a, simde__mmask16 k, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fnmadd_ps(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_ps(a, k, simde_mm512_fnmadd_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fnmadd_ps(a, k, b, c) simde_mm512_mask_fnmadd_ps(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask3_fnmadd_ps (simde__m512 a, simde__m512 b, simde__m512 c, simde__mmask16 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fnmadd_ps(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_ps(c, k, simde_mm512_fnmadd_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fnmadd_ps(a, b, c, k) simde_mm512_mask3_fnmadd_ps(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_fnmadd_ps (simde__mmask16 k, simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fnmadd_ps(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_fnmadd_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fnmadd_ps(k, a, b, c) simde_mm512_maskz_fnmadd_ps(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_fnmadd_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fnmadd_pd(a, b, c);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b),
+      c_ = simde__m512d_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_fnmadd_pd(a_.m256d[i], b_.m256d[i], c_.m256d[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d_private) / sizeof(r_.m128d_private[0])) ; i++) {
+        r_.m128d_private[i].neon_f64 = vfmsq_f64(c_.m128d_private[i].neon_f64, a_.m128d_private[i].neon_f64, b_.m128d_private[i].neon_f64);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f64 = -(a_.f64 * b_.f64) + c_.f64;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = -(a_.f64[i] * b_.f64[i]) + c_.f64[i];
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fnmadd_pd(a, b, c) simde_mm512_fnmadd_pd(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_fnmadd_pd (simde__m512d a, simde__mmask8 k, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fnmadd_pd(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_pd(a, k, simde_mm512_fnmadd_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fnmadd_pd(a, k, b, c) simde_mm512_mask_fnmadd_pd(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask3_fnmadd_pd (simde__m512d a, simde__m512d b, simde__m512d c, simde__mmask8 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fnmadd_pd(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_pd(c, k, simde_mm512_fnmadd_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fnmadd_pd(a, b, c, k) simde_mm512_mask3_fnmadd_pd(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_fnmadd_pd (simde__mmask8 k, simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fnmadd_pd(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_fnmadd_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fnmadd_pd(k, a, b, c) simde_mm512_maskz_fnmadd_pd(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_fnmsub_ps (simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fnmsub_ps(a, b, c);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b),
+      c_ = simde__m512_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_fnmsub_ps(a_.m256[i], b_.m256[i], c_.m256[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128_private) / sizeof(r_.m128_private[0])) ; i++) {
+        r_.m128_private[i].neon_f32 = vnegq_f32(vfmaq_f32(c_.m128_private[i].neon_f32, a_.m128_private[i].neon_f32, b_.m128_private[i].neon_f32));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f32 = -(a_.f32 * b_.f32) - c_.f32;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = -(a_.f32[i] * b_.f32[i]) - c_.f32[i];
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fnmsub_ps(a, b, c) simde_mm512_fnmsub_ps(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_fnmsub_ps (simde__m512 a, simde__mmask16 k, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fnmsub_ps(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_ps(a, k, simde_mm512_fnmsub_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fnmsub_ps(a, k, b, c) simde_mm512_mask_fnmsub_ps(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask3_fnmsub_ps (simde__m512 a, simde__m512 b, simde__m512 c, simde__mmask16 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fnmsub_ps(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_ps(c, k, simde_mm512_fnmsub_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fnmsub_ps(a, b, c, k) simde_mm512_mask3_fnmsub_ps(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_fnmsub_ps (simde__mmask16 k, simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fnmsub_ps(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_fnmsub_ps(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fnmsub_ps(k, a, b, c) simde_mm512_maskz_fnmsub_ps(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_fnmsub_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_fnmsub_pd(a, b, c);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b),
+      c_ = simde__m512d_to_private(c);
+
+    #if defined(SIMDE_FMA_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_fnmsub_pd(a_.m256d[i], b_.m256d[i], c_.m256d[i]);
+      }
+    #elif defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d_private) / sizeof(r_.m128d_private[0])) ; i++) {
+        r_.m128d_private[i].neon_f64 = vnegq_f64(vfmaq_f64(c_.m128d_private[i].neon_f64, a_.m128d_private[i].neon_f64, b_.m128d_private[i].neon_f64));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.f64 = -(a_.f64 * b_.f64) - c_.f64;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = -(a_.f64[i] * b_.f64[i]) - c_.f64[i];
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fnmsub_pd(a, b, c) simde_mm512_fnmsub_pd(a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_fnmsub_pd (simde__m512d a, simde__mmask8 k, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_fnmsub_pd(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_pd(a, k, simde_mm512_fnmsub_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_fnmsub_pd(a, k, b, c) simde_mm512_mask_fnmsub_pd(a, k, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask3_fnmsub_pd (simde__m512d a, simde__m512d b, simde__m512d c, simde__mmask8 k) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask3_fnmsub_pd(a, b, c, k);
+  #else
+    return simde_mm512_mask_mov_pd(c, k, simde_mm512_fnmsub_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask3_fnmsub_pd(a, b, c, k) simde_mm512_mask3_fnmsub_pd(a, b, c, k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_fnmsub_pd (simde__mmask8 k, simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_fnmsub_pd(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_fnmsub_pd(a, b, c));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_fnmsub_pd(k, a, b, c) simde_mm512_maskz_fnmsub_pd(k, a, b, c)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_sqrt_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sqrt_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+      r_.m256[i] = simde_mm256_sqrt_ps(a_.m256[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sqrt_ps(a) simde_mm512_sqrt_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_sqrt_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sqrt_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_sqrt_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sqrt_ps(src, k, a) simde_mm512_mask_sqrt_ps(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_sqrt_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sqrt_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_sqrt_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sqrt_ps(k, a) simde_mm512_maskz_sqrt_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_sqrt_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_sqrt_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+      r_.m256d[i] = simde_mm256_sqrt_pd(a_.m256d[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sqrt_pd(a) simde_mm512_sqrt_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_sqrt_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_sqrt_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_sqrt_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_sqrt_pd(src, k, a) simde_mm512_mask_sqrt_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_sqrt_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_sqrt_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_sqrt_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_sqrt_pd(k, a) simde_mm512_maskz_sqrt_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_abs_ps (simde__m512 v2) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_abs_ps(v2);
+  #else
+    simde__m512_private
+      r_,
+      v2_ = simde__m512_to_private(v2);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.u32 = v2_.u32 & UINT32_C(0x7fffffff);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = v2_.u32[i] & UINT32_C(0x7fffffff);
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_abs_ps(v2) simde_mm512_abs_ps(v2)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_abs_ps (simde__m512 src, simde__mmask16 k, simde__m512 v2) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_abs_ps(src, k, v2);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_abs_ps(v2));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_abs_ps(src, k, v2) simde_mm512_mask_abs_ps(src, k, v2)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_abs_pd (simde__m512d v2) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_abs_pd(v2);
+  #else
+    simde__m512d_private
+      r_,
+      v2_ = simde__m512d_to_private(v2);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.u64 = v2_.u64 & UINT64_C(0x7fffffffffffffff);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = v2_.u64[i] & UINT64_C(0x7fffffffffffffff);
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_abs_pd(v2) simde_mm512_abs_pd(v2)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_abs_pd (simde__m512d src, simde__mmask8 k, simde__m512d v2) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_abs_pd(src, k, v2);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_abs_pd(v2));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_abs_pd(src, k, v2) simde_mm512_mask_abs_pd(src, k, v2)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_rcp14_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rcp14_ps(a);
+  #else
+    return simde_mm512_div_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rcp14_ps(a) simde_mm512_rcp14_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_rcp14_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rcp14_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rcp14_ps(src, k, a) simde_mm512_mask_rcp14_ps(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_rcp14_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rcp14_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rcp14_ps(k, a) simde_mm512_maskz_rcp14_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_rsqrt14_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rsqrt14_ps(a);
+  #else
+    return simde_mm512_div_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), simde_mm512_sqrt_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rsqrt14_ps(a) simde_mm512_rsqrt14_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_rsqrt14_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rsqrt14_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rsqrt14_ps(src, k, a) simde_mm512_mask_rsqrt14_ps(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_rsqrt14_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rsqrt14_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rsqrt14_ps(k, a) simde_mm512_maskz_rsqrt14_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_rcp14_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rcp14_pd(a);
+  #else
+    return simde_mm512_div_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), a);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rcp14_pd(a) simde_mm512_rcp14_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_rcp14_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rcp14_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rcp14_pd(src, k, a) simde_mm512_mask_rcp14_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_rcp14_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rcp14_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rcp14_pd(k, a) simde_mm512_maskz_rcp14_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_rsqrt14_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_rsqrt14_pd(a);
+  #else
+    return simde_mm512_div_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), simde_mm512_sqrt_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_rsqrt14_pd(a) simde_mm512_rsqrt14_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_rsqrt14_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_rsqrt14_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_rsqrt14_pd(src, k, a) simde_mm512_mask_rsqrt14_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_rsqrt14_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_rsqrt14_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_rsqrt14_pd(k, a) simde_mm512_maskz_rsqrt14_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_getexp_ps (simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_getexp_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    #if defined(SIMDE_HAVE_MATH_H)
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = logbf(a_.f32[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_getexp_ps(a) simde_mm512_getexp_ps(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_getexp_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_getexp_ps(src, k, a) simde_mm512_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_getexp_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_getexp_ps(k, a) simde_mm512_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_getexp_pd (simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_getexp_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if defined(SIMDE_HAVE_MATH_H)
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = logb(a_.f64[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_getexp_pd(a) simde_mm512_getexp_pd(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_getexp_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_getexp_pd(src, k, a) simde_mm512_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_getexp_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_getexp_pd(k, a) simde_mm512_maskz_getexp_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_getmant_ps (simde__m512 a, int interv, int sc)
+    HEDLEY_REQUIRE_MSG(((interv & 3) == interv) && ((sc & 3) == sc), "interv and sc must be SIMDE_MM_MANT_NORM_* and SIMDE_MM_MANT_SIGN_* values") {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a);
+
+  #if defined(SIMDE_HAVE_MATH_H)
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      const simde_float32 v = a_.f32[i];
+      simde_float32 m;
+
+      if (simde_isnanf(v)) {
+        m = v;
+      } else if ((v == SIMDE_FLOAT32_C(0.0)) || (fabsf(v) == SIMDE_INFINITYF)) {
+        m = SIMDE_FLOAT32_C(1.0);
+      } else if ((sc & SIMDE_MM_MANT_SIGN_nan) && (v < SIMDE_FLOAT32_C(0.0))) {
+        m = SIMDE_NANF;
+      } else {
+        /* frexp returns [0.5, 1), which is also correct for denormals. */
+        int e;
+        m = frexpf(fabsf(v), &e);
+        switch (interv) {
+          case SIMDE_MM_MANT_NORM_1_2:
+            m *= SIMDE_FLOAT32_C(2.0);
+            break;
+          case SIMDE_MM_MANT_NORM_p5_2:
+            /* [1, 2) for even exponents, [0.5, 1) for odd ones */
+            if (e & 1)
+              m *= SIMDE_FLOAT32_C(2.0);
+            break;
+          case SIMDE_MM_MANT_NORM_p5_1:
+            break;
+          case SIMDE_MM_MANT_NORM_p75_1p5:
+            if (m < SIMDE_FLOAT32_C(0.75))
+              m *= SIMDE_FLOAT32_C(2.0);
+            break;
+          default:
+            HEDLEY_UNREACHABLE();
+            break;
+        }
+      }
+
+      r_.f32[i] = (!(sc & SIMDE_MM_MANT_SIGN_zero) && signbit(v)) ? -m : m;
+    }
+  #else
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_getmant_ps(a, interv, sc) _mm512_getmant_ps(a, interv, sc)
+#  define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) _mm512_mask_getmant_ps(src, k, a, interv, sc)
+#  define simde_mm512_maskz_getmant_ps(k, a, interv, sc) _mm512_maskz_getmant_ps(k, a, interv, sc)
+#else
+#  define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_mov_ps(src, k, simde_mm512_getmant_ps(a, interv, sc))
+#  define simde_mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_mov_ps(k, simde_mm512_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_getmant_ps(a, interv, sc) simde_mm512_getmant_ps(a, interv, sc)
+#  define _mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_getmant_ps(src, k, a, interv, sc)
+#  define _mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_getmant_pd (simde__m512d a, int interv, int sc)
+    HEDLEY_REQUIRE_MSG(((interv & 3) == interv) && ((sc & 3) == sc), "interv and sc must be SIMDE_MM_MANT_NORM_* and SIMDE_MM_MANT_SIGN_* values") {
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a);
+
+  #if defined(SIMDE_HAVE_MATH_H)
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      const simde_float64 v = a_.f64[i];
+      simde_float64 m;
+
+      if (simde_isnan(v)) {
+        m = v;
+      } else if ((v == SIMDE_FLOAT64_C(0.0)) || (fabs(v) == SIMDE_INFINITY)) {
+        m = SIMDE_FLOAT64_C(1.0);
+      } else if ((sc & SIMDE_MM_MANT_SIGN_nan) && (v < SIMDE_FLOAT64_C(0.0))) {
+        m = SIMDE_NAN;
+      } else {
+        /* frexp returns [0.5, 1), which is also correct for denormals. */
+        int e;
+        m = frexp(fabs(v), &e);
+        switch (interv) {
+          case SIMDE_MM_MANT_NORM_1_2:
+            m *= SIMDE_FLOAT64_C(2.0);
+            break;
+          case SIMDE_MM_MANT_NORM_p5_2:
+            /* [1, 2) for even exponents, [0.5, 1) for odd ones */
+            if (e & 1)
+              m *= SIMDE_FLOAT64_C(2.0);
+            break;
+          case SIMDE_MM_MANT_NORM_p5_1:
+            break;
+          case SIMDE_MM_MANT_NORM_p75_1p5:
+            if (m < SIMDE_FLOAT64_C(0.75))
+              m *= SIMDE_FLOAT64_C(2.0);
+            break;
+          default:
+            HEDLEY_UNREACHABLE();
+            break;
+        }
+      }
+
+      r_.f64[i] = (!(sc & SIMDE_MM_MANT_SIGN_zero) && signbit(v)) ? -m : m;
+    }
+  #else
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_getmant_pd(a, interv, sc) _mm512_getmant_pd(a, interv, sc)
+#  define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) _mm512_mask_getmant_pd(src, k, a, interv, sc)
+#  define simde_mm512_maskz_getmant_pd(k, a, interv, sc) _mm512_maskz_getmant_pd(k, a, interv, sc)
+#else
+#  define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_mov_pd(src, k, simde_mm512_getmant_pd(a, interv, sc))
+#  define simde_mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_mov_pd(k, simde_mm512_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_getmant_pd(a, interv, sc) simde_mm512_getmant_pd(a, interv, sc)
+#  define _mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_getmant_pd(src, k, a, interv, sc)
+#  define _mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_scalef_ps (simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_scalef_ps(a, b);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    #if defined(SIMDE_HAVE_MATH_H)
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        const simde_float32 e = floorf(b_.f32[i]);
+
+        if (fabsf(e) < SIMDE_FLOAT32_C(512.0)) {
+          r_.f32[i] = scalbnf(a_.f32[i], HEDLEY_STATIC_CAST(int, e));
+        } else if (simde_isnanf(e) || (fabsf(e) == SIMDE_INFINITYF)) {
+          /* Gets NaN for 0 * 2^inf and inf * 2^-inf right. */
+          r_.f32[i] = (e > SIMDE_FLOAT32_C(0.0)) ? (a_.f32[i] * e) : (a_.f32[i] / -e);
+        } else {
+          r_.f32[i] = scalbnf(a_.f32[i], (e > SIMDE_FLOAT32_C(0.0)) ? 512 : -512);
+        }
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_scalef_ps(a, b) simde_mm512_scalef_ps(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_scalef_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_scalef_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_scalef_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_scalef_ps(src, k, a, b) simde_mm512_mask_scalef_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_scalef_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_scalef_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_scalef_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_scalef_ps(k, a, b) simde_mm512_maskz_scalef_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_scalef_pd (simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_scalef_pd(a, b);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b);
+
+    #if defined(SIMDE_HAVE_MATH_H)
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        const simde_float64 e = floor(b_.f64[i]);
+
+        if (fabs(e) < SIMDE_FLOAT64_C(4096.0)) {
+          r_.f64[i] = scalbn(a_.f64[i], HEDLEY_STATIC_CAST(int, e));
+        } else if (simde_isnan(e) || (fabs(e) == SIMDE_INFINITY)) {
+          /* Gets NaN for 0 * 2^inf and inf * 2^-inf right. */
+          r_.f64[i] = (e > SIMDE_FLOAT64_C(0.0)) ? (a_.f64[i] * e) : (a_.f64[i] / -e);
+        } else {
+          r_.f64[i] = scalbn(a_.f64[i], (e > SIMDE_FLOAT64_C(0.0)) ? 4096 : -4096);
+        }
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_scalef_pd(a, b) simde_mm512_scalef_pd(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_scalef_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_mask_scalef_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_scalef_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_scalef_pd(src, k, a, b) simde_mm512_mask_scalef_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_scalef_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_AVX512F_NATIVE)
+    return _mm512_maskz_scalef_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_scalef_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_scalef_pd(k, a, b) simde_mm512_maskz_scalef_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_roundscale_ps (simde__m512 a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a);
+
+  const int m = imm8 >> 4;
+
+  #if defined(SIMDE_HAVE_MATH_H)
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      simde_float32 v = a_.f32[i];
+
+      /* Anything this large is already an integer (or inf/NaN). */
+      if (!(fabsf(v) < SIMDE_FLOAT32_C(8388608.0))) {
+        r_.f32[i] = v;
+        continue;
+      }
+
+      v = ldexpf(v, m);
+      switch (imm8 & 7) {
+        case SIMDE_MM_FROUND_TO_NEG_INF:
+          v = floorf(v);
+          break;
+        case SIMDE_MM_FROUND_TO_POS_INF:
+          v = ceilf(v);
+          break;
+        case SIMDE_MM_FROUND_TO_ZERO:
+          v = truncf(v);
+          break;
+        default:
+          v = nearbyintf(v);
+          break;
+      }
+      r_.f32[i] = ldexpf(v, -m);
+    }
+  #else
+    (void) m;
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_roundscale_ps(a, imm8) _mm512_roundscale_ps(a, imm8)
+#  define simde_mm512_mask_roundscale_ps(src, k, a, imm8) _mm512_mask_roundscale_ps(src, k, a, imm8)
+#  define simde_mm512_maskz_roundscale_ps(k, a, imm8) _mm512_maskz_roundscale_ps(k, a, imm8)
+#else
+#  define simde_mm512_mask_roundscale_ps(src, k, a, imm8) simde_mm512_mask_mov_ps(src, k, simde_mm512_roundscale_ps(a, imm8))
+#  define simde_mm512_maskz_roundscale_ps(k, a, imm8) simde_mm512_maskz_mov_ps(k, simde_mm512_roundscale_ps(a, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_roundscale_ps(a, imm8) simde_mm512_roundscale_ps(a, imm8)
+#  define _mm512_mask_roundscale_ps(src, k, a, imm8) simde_mm512_mask_roundscale_ps(src, k, a, imm8)
+#  define _mm512_maskz_roundscale_ps(k, a, imm8) simde_mm512_maskz_roundscale_ps(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_roundscale_pd (simde__m512d a, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a);
+
+  const int m = imm8 >> 4;
+
+  #if defined(SIMDE_HAVE_MATH_H)
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      simde_float64 v = a_.f64[i];
+
+      /* Anything this large is already an integer (or inf/NaN). */
+      if (!(fabs(v) < SIMDE_FLOAT64_C(4503599627370496.0))) {
+        r_.f64[i] = v;
+        continue;
+      }
+
+      v = ldexp(v, m);
+      switch (imm8 & 7) {
+        case SIMDE_MM_FROUND_TO_NEG_INF:
+          v = floor(v);
+          break;
+        case SIMDE_MM_FROUND_TO_POS_INF:
+          v = ceil(v);
+          break;
+        case SIMDE_MM_FROUND_TO_ZERO:
+          v = trunc(v);
+          break;
+        default:
+          v = nearbyint(v);
+          break;
+      }
+      r_.f64[i] = ldexp(v, -m);
+    }
+  #else
+    (void) m;
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_roundscale_pd(a, imm8) _mm512_roundscale_pd(a, imm8)
+#  define simde_mm512_mask_roundscale_pd(src, k, a, imm8) _mm512_mask_roundscale_pd(src, k, a, imm8)
+#  define simde_mm512_maskz_roundscale_pd(k, a, imm8) _mm512_maskz_roundscale_pd(k, a, imm8)
+#else
+#  define simde_mm512_mask_roundscale_pd(src, k, a, imm8) simde_mm512_mask_mov_pd(src, k, simde_mm512_roundscale_pd(a, imm8))
+#  define simde_mm512_maskz_roundscale_pd(k, a, imm8) simde_mm512_maskz_mov_pd(k, simde_mm512_roundscale_pd(a, imm8))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_roundscale_pd(a, imm8) simde_mm512_roundscale_pd(a, imm8)
+#  define _mm512_mask_roundscale_pd(src, k, a, imm8) simde_mm512_mask_roundscale_pd(src, k, a, imm8)
+#  define _mm512_maskz_roundscale_pd(k, a, imm8) simde_mm512_maskz_roundscale_pd(k, a, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_cmp_ps_mask (simde__m512 a, simde__m512 b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be one of the SIMDE_CMP_* macros (values: [0, 31])") {
+  simde__m512_private
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  /* Bit 4 only selects whether quiet NaNs signal, which doesn't
+     change the result. */
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m512i_private r_;
+
+    switch (imm8 & 15) {
+      case SIMDE_CMP_EQ_OQ:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 == b_.f32);
+        break;
+      case SIMDE_CMP_LT_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 < b_.f32);
+        break;
+      case SIMDE_CMP_LE_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 <= b_.f32);
+        break;
+      case SIMDE_CMP_UNORD_Q:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 != a_.f32) | (b_.f32 != b_.f32));
+        break;
+      case SIMDE_CMP_NEQ_UQ:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 != b_.f32);
+        break;
+      case SIMDE_CMP_NLT_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 < b_.f32);
+        break;
+      case SIMDE_CMP_NLE_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 <= b_.f32);
+        break;
+      case SIMDE_CMP_ORD_Q:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 == a_.f32) & (b_.f32 == b_.f32));
+        break;
+      case SIMDE_CMP_EQ_UQ:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 == b_.f32) | (a_.f32 != a_.f32) | (b_.f32 != b_.f32));
+        break;
+      case SIMDE_CMP_NGE_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 >= b_.f32);
+        break;
+      case SIMDE_CMP_NGT_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 > b_.f32);
+        break;
+      case SIMDE_CMP_FALSE_OQ:
+        return 0;
+      case SIMDE_CMP_NEQ_OQ:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 < b_.f32) | (a_.f32 > b_.f32));
+        break;
+      case SIMDE_CMP_GE_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 >= b_.f32);
+        break;
+      case SIMDE_CMP_GT_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 > b_.f32);
+        break;
+      case SIMDE_CMP_TRUE_UQ:
+        return UINT16_C(0xffff);
+      default:
+        HEDLEY_UNREACHABLE_RETURN(0);
+    }
+
+    return simde__m512i_private_to_mmask16(r_);
+  #else
+    simde__mmask16 r = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+      const simde_float32 x = a_.f32[i], y = b_.f32[i];
+      int t;
+
+      switch (imm8 & 15) {
+        case SIMDE_CMP_EQ_OQ:
+          t = (x == y);
+          break;
+        case SIMDE_CMP_LT_OS:
+          t = (x < y);
+          break;
+        case SIMDE_CMP_LE_OS:
+          t = (x <= y);
+          break;
+        case SIMDE_CMP_UNORD_Q:
+          t = ((x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NEQ_UQ:
+          t = (x != y);
+          break;
+        case SIMDE_CMP_NLT_US:
+          t = !(x < y);
+          break;
+        case SIMDE_CMP_NLE_US:
+          t = !(x <= y);
+          break;
+        case SIMDE_CMP_ORD_Q:
+          t = ((x == x) && (y == y));
+          break;
+        case SIMDE_CMP_EQ_UQ:
+          t = ((x == y) || (x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NGE_US:
+          t = !(x >= y);
+          break;
+        case SIMDE_CMP_NGT_US:
+          t = !(x > y);
+          break;
+        case SIMDE_CMP_FALSE_OQ:
+          t = 0;
+          break;
+        case SIMDE_CMP_NEQ_OQ:
+          t = ((x < y) || (x > y));
+          break;
+        case SIMDE_CMP_GE_OS:
+          t = (x >= y);
+          break;
+        case SIMDE_CMP_GT_OS:
+          t = (x > y);
+          break;
+        case SIMDE_CMP_TRUE_UQ:
+          t = 1;
+          break;
+        default:
+          HEDLEY_UNREACHABLE_RETURN(0);
+      }
+
+      r |= HEDLEY_STATIC_CAST(simde__mmask16, t << i);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_ps_mask(a, b, imm8) _mm512_cmp_ps_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_ps_mask(k1, a, b, imm8) _mm512_mask_cmp_ps_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_ps_mask(k1, a, b, imm8) (simde_mm512_cmp_ps_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_ps_mask(a, b, imm8) simde_mm512_cmp_ps_mask(a, b, imm8)
+#  define _mm512_mask_cmp_ps_mask(k1, a, b, imm8) simde_mm512_mask_cmp_ps_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm512_cmp_pd_mask (simde__m512d a, simde__m512d b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be one of the SIMDE_CMP_* macros (values: [0, 31])") {
+  simde__m512d_private
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+  /* Bit 4 only selects whether quiet NaNs signal, which doesn't
+     change the result. */
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m512i_private r_;
+
+    switch (imm8 & 15) {
+      case SIMDE_CMP_EQ_OQ:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 == b_.f64);
+        break;
+      case SIMDE_CMP_LT_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 < b_.f64);
+        break;
+      case SIMDE_CMP_LE_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 <= b_.f64);
+        break;
+      case SIMDE_CMP_UNORD_Q:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 != a_.f64) | (b_.f64 != b_.f64));
+        break;
+      case SIMDE_CMP_NEQ_UQ:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 != b_.f64);
+        break;
+      case SIMDE_CMP_NLT_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 < b_.f64);
+        break;
+      case SIMDE_CMP_NLE_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 <= b_.f64);
+        break;
+      case SIMDE_CMP_ORD_Q:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 == a_.f64) & (b_.f64 == b_.f64));
+        break;
+      case SIMDE_CMP_EQ_UQ:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 == b_.f64) | (a_.f64 != a_.f64) | (b_.f64 != b_.f64));
+        break;
+      case SIMDE_CMP_NGE_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 >= b_.f64);
+        break;
+      case SIMDE_CMP_NGT_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 > b_.f64);
+        break;
+      case SIMDE_CMP_FALSE_OQ:
+        return 0;
+      case SIMDE_CMP_NEQ_OQ:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 < b_.f64) | (a_.f64 > b_.f64));
+        break;
+      case SIMDE_CMP_GE_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 >= b_.f64);
+        break;
+      case SIMDE_CMP_GT_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 > b_.f64);
+        break;
+      case SIMDE_CMP_TRUE_UQ:
+        return UINT8_C(0xff);
+      default:
+        HEDLEY_UNREACHABLE_RETURN(0);
+    }
+
+    return simde__m512i_private_to_mmask8(r_);
+  #else
+    simde__mmask8 r = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+      const simde_float64 x = a_.f64[i], y = b_.f64[i];
+      int t;
+
+      switch (imm8 & 15) {
+        case SIMDE_CMP_EQ_OQ:
+          t = (x == y);
+          break;
+        case SIMDE_CMP_LT_OS:
+          t = (x < y);
+          break;
+        case SIMDE_CMP_LE_OS:
+          t = (x <= y);
+          break;
+        case SIMDE_CMP_UNORD_Q:
+          t = ((x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NEQ_UQ:
+          t = (x != y);
+          break;
+        case SIMDE_CMP_NLT_US:
+          t = !(x < y);
+          break;
+        case SIMDE_CMP_NLE_US:
+          t = !(x <= y);
+          break;
+        case SIMDE_CMP_ORD_Q:
+          t = ((x == x) && (y == y));
+          break;
+        case SIMDE_CMP_EQ_UQ:
+          t = ((x == y) || (x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NGE_US:
+          t = !(x >= y);
+          break;
+        case SIMDE_CMP_NGT_US:
+          t = !(x > y);
+          break;
+        case SIMDE_CMP_FALSE_OQ:
+          t = 0;
+          break;
+        case SIMDE_CMP_NEQ_OQ:
+          t = ((x < y) || (x > y));
+          break;
+        case SIMDE_CMP_GE_OS:
+          t = (x >= y);
+          break;
+        case SIMDE_CMP_GT_OS:
+          t = (x > y);
+          break;
+        case SIMDE_CMP_TRUE_UQ:
+          t = 1;
+          break;
+        default:
+          HEDLEY_UNREACHABLE_RETURN(0);
+      }
+
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, t << i);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cmp_pd_mask(a, b, imm8) _mm512_cmp_pd_mask(a, b, imm8)
+#  define simde_mm512_mask_cmp_pd_mask(k1, a, b, imm8) _mm512_mask_cmp_pd_mask(k1, a, b, imm8)
+#else
+#  define simde_mm512_mask_cmp_pd_mask(k1, a, b, imm8) (simde_mm512_cmp_pd_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cmp_pd_mask(a, b, imm8) simde_mm512_cmp_pd_mask(a, b, imm8)
+#  define _mm512_mask_cmp_pd_mask(k1, a, b, imm8) simde_mm512_mask_cmp_pd_mask(k1, a, b, imm8)
+#endif
+
+/* Static rounding.  With SIMDE_MM_FROUND_CUR_DIRECTION or
+ * SIMDE_MM_FROUND_TO_NEAREST_INT the *_round_* functions below are just
+ * the normal operations; like the rest of SIMDe they assume the
+ * floating point environment is left in its default round-to-nearest
+ * mode, and they never change it.
+ *
+ * For the directed modes the portable versions start from the
+ * round-to-nearest result and an error-free transformation (TwoSum for
+ * addition, an FMA residual for the rest) giving the sign of the
+ * rounding error, then step the result one ulp when it was rounded the
+ * wrong way (see simde_x_sf_nudge_u32).  Binary32 operations get their
+ * residuals exactly from binary64 arithmetic.  Binary64 residuals stop
+ * being exact close to the subnormal range, so those lanes compute the
+ * exact result from the integer significands with the simde_x_sf_*
+ * helpers instead.
+ *
+ * The simde_x_sf_* helpers work on bit patterns.  A format is given by
+ * p, the number of significand bits including the implicit one, and
+ * ebits, the width of the exponent field (24/8 for binary32, 53/11 for
+ * binary64). */
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_x_sf_bitlen (uint64_t v) {
+  #if HEDLEY_GNUC_HAS_BUILTIN(__builtin_clzll,3,4,0)
+    return (v == 0) ? 0 : (64 - __builtin_clzll(HEDLEY_STATIC_CAST(unsigned long long, v)));
+  #else
+    int n = 0;
+    if (v >> 32) { n += 32; v >>= 32; }
+    if (v >> 16) { n += 16; v >>= 16; }
+    if (v >>  8) { n +=  8; v >>=  8; }
+    if (v >>  4) { n +=  4; v >>=  4; }
+    if (v >>  2) { n +=  2; v >>=  2; }
+    if (v >>  1) { n +=  1; v >>=  1; }
+    return n + HEDLEY_STATIC_CAST(int, v);
+  #endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_x_sf_isfinite (uint64_t v, int p, int ebits) {
+  const uint64_t emask = (UINT64_C(1) << ebits) - 1;
+  return ((v >> (p - 1)) & emask) != emask;
+}
+
+/* Splits a finite value into sign, significand and exponent so that
+ * it equals (-1)**s * m * 2**e.  Unless the value is zero, m is
+ * normalized to exactly p bits (also for subnormals). */
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_unpack (uint64_t v, int p, int ebits, int* s, int* e) {
+  const int bias = (1 << (ebits - 1)) - 1;
+  const int f = HEDLEY_STATIC_CAST(int, (v >> (p - 1)) & ((UINT64_C(1) << ebits) - 1));
+  uint64_t m = v & ((UINT64_C(1) << (p - 1)) - 1);
+
+  *s = HEDLEY_STATIC_CAST(int, (v >> (p - 1 + ebits)) & 1);
+  if (f == 0) {
+    const int n = (m == 0) ? 0 : (p - simde_x_sf_bitlen(m));
+    m <<= n;
+    *e = 2 - bias - p - n;
+  } else {
+    m |= UINT64_C(1) << (p - 1);
+    *e = f - bias - (p - 1);
+  }
+
+  return m;
+}
+
+/* Rounds (-1)**s * (m + f) * 2**e, where 0 <= f < 1 and f != 0
+ * exactly when sticky is set, to the format using the given rounding
+ * mode.  When sticky is set m must have at least p + 2 bits. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_round_pack (int s, uint64_t m, int e, int sticky, int mode, int p, int ebits) {
+  const int bias = (1 << (ebits - 1)) - 1;
+  /* Exponent of the least significant bit of a subnormal. */
+  const int emin = 2 - bias - p;
+  const uint64_t sign = HEDLEY_STATIC_CAST(uint64_t, s) << (p - 1 + ebits);
+  const uint64_t inf = ((UINT64_C(1) << ebits) - 1) << (p - 1);
+  int shift = simde_x_sf_bitlen(m) - p;
+  int round = 0;
+  uint64_t q;
+
+  if (e + shift < emin)
+    shift = emin - e;
+
+  if (shift <= 0) {
+    q = m << -shift;
+  } else if (shift < 64) {
+    const uint64_t half = UINT64_C(1) << (shift - 1);
+    q = m >> shift;
+    round = (m & half) != 0;
+    sticky |= (m & (half - 1)) != 0;
+  } else {
+    q = 0;
+    round = (shift == 64) && (m >> 63);
+    sticky |= ((shift == 64) ? (m << 1) : m) != 0;
+  }
+  e += shift;
+
+  switch (mode) {
+    case SIMDE_MM_FROUND_TO_NEAREST_INT:
+      q += (round && (sticky || (q & 1)));
+      break;
+    case SIMDE_MM_FROUND_TO_NEG_INF:
+      q += (s && (round || sticky));
+      break;
+    case SIMDE_MM_FROUND_TO_POS_INF:
+      q += (!s && (round || sticky));
+      break;
+    default:
+      break;
+  }
+
+  if (q >> p) {
+    q >>= 1;
+    e++;
+  }
+
+  /* Subnormals (including the case where rounding carried into the
+   * smallest normal) are just the significand. */
+  if (!(q >> (p - 1)))
+    return sign | q;
+
+  if (e + p - 1 > bias) {
+    const int to_inf =
+      (mode == SIMDE_MM_FROUND_TO_NEAREST_INT) ||
+      ((mode == SIMDE_MM_FROUND_TO_POS_INF) && !s) ||
+      ((mode == SIMDE_MM_FROUND_TO_NEG_INF) && s);
+    return sign | (to_inf ? inf : (inf - 1));
+  }
+
+  return sign | (HEDLEY_STATIC_CAST(uint64_t, e + p - 1 + bias) << (p - 1)) | (q & ((UINT64_C(1) << (p - 1)) - 1));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_sf_mul_u64 (uint64_t a, uint64_t b, uint64_t* hi, uint64_t* lo) {
+  const uint64_t a0 = a & UINT64_C(0xffffffff), a1 = a >> 32;
+  const uint64_t b0 = b & UINT64_C(0xffffffff), b1 = b >> 32;
+  const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  const uint64_t mid = (p00 >> 32) + (p01 & UINT64_C(0xffffffff)) + (p10 & UINT64_C(0xffffffff));
+
+  *lo = (mid << 32) | (p00 & UINT64_C(0xffffffff));
+  *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_sf_shl_u128 (uint64_t* hi, uint64_t* lo, int n) {
+  if (n >= 64) {
+    *hi = *lo << (n - 64);
+    *lo = 0;
+  } else if (n > 0) {
+    *hi = (*hi << n) | (*lo >> (64 - n));
+    *lo <<= n;
+  }
+}
+
+/* Shift right, ORing anything shifted out into the lowest bit. */
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_x_sf_shr_jam_u128 (uint64_t* hi, uint64_t* lo, int n) {
+  if (n >= 128) {
+    *lo = (*hi | *lo) != 0;
+    *hi = 0;
+  } else if (n >= 64) {
+    const int sticky = (*lo != 0) || ((n > 64) && ((*hi << (128 - n)) != 0));
+    *lo = (*hi >> (n - 64)) | HEDLEY_STATIC_CAST(uint64_t, sticky);
+    *hi = 0;
+  } else if (n > 0) {
+    const int sticky = (*lo << (64 - n)) != 0;
+    *lo = (*lo >> n) | (*hi << (64 - n)) | HEDLEY_STATIC_CAST(uint64_t, sticky);
+    *hi >>= n;
+  }
+}
+
+/* Shifts hi:lo (which must be below 2**126) right until it fits in 62
+ * bits, adjusting the exponent and the sticky flag to match. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_narrow (uint64_t hi, uint64_t lo, int* e, int* sticky) {
+  const int n = (hi == 0) ? (simde_x_sf_bitlen(lo) - 62) : (simde_x_sf_bitlen(hi) + 2);
+
+  if (n <= 0)
+    return lo;
+
+  *e += n;
+  *sticky |= (lo << (64 - n)) != 0;
+  return (hi << (64 - n)) | (lo >> n);
+}
+
+/* The arithmetic helpers require finite operands; infinities and NaNs
+ * give exact results with the normal operations. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_add (uint64_t a, uint64_t b, int mode, int p, int ebits) {
+  const uint64_t sign = UINT64_C(1) << (p - 1 + ebits);
+  int sa, sb, ea, eb;
+  uint64_t ma, mb;
+
+  if ((a & ~sign) == 0 && (b & ~sign) == 0)
+    return (a == b) ? a : ((mode == SIMDE_MM_FROUND_TO_NEG_INF) ? sign : 0);
+  if ((a & ~sign) == 0)
+    return b;
+  if ((b & ~sign) == 0)
+    return a;
+
+  ma = simde_x_sf_unpack(a, p, ebits, &sa, &ea) << (62 - p);
+  mb = simde_x_sf_unpack(b, p, ebits, &sb, &eb) << (62 - p);
+  if (ea < eb) {
+    const uint64_t mt = ma; const int st = sa, et = ea;
+    ma = mb; sa = sb; ea = eb;
+    mb = mt; sb = st; eb = et;
+  }
+
+  /* There are enough guard bits that the jammed low bit is as good as
+   * the bits that were shifted out. */
+  mb = (ea - eb >= 64) ? 1 : ((mb >> (ea - eb)) | ((ea != eb) && ((mb << (64 - (ea - eb))) != 0)));
+  if (sa == sb) {
+    ma += mb;
+  } else if (ma >= mb) {
+    ma -= mb;
+  } else {
+    ma = mb - ma;
+    sa = sb;
+  }
+
+  /* An exact zero is +0, or -0 when rounding down. */
+  if (ma == 0)
+    return (mode == SIMDE_MM_FROUND_TO_NEG_INF) ? sign : 0;
+
+  return simde_x_sf_round_pack(sa, ma, ea - (62 - p), 0, mode, p, ebits);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_mul (uint64_t a, uint64_t b, int mode, int p, int ebits) {
+  const uint64_t sign = UINT64_C(1) << (p - 1 + ebits);
+  int sa, sb, ea, eb, sticky = 0;
+  uint64_t ma, mb, hi, lo;
+
+  if ((a & ~sign) == 0 || (b & ~sign) == 0)
+    return (a ^ b) & sign;
+
+  ma = simde_x_sf_unpack(a, p, ebits, &sa, &ea);
+  mb = simde_x_sf_unpack(b, p, ebits, &sb, &eb);
+  simde_x_sf_mul_u64(ma, mb, &hi, &lo);
+  ea += eb;
+  lo = simde_x_sf_narrow(hi, lo, &ea, &sticky);
+
+  return simde_x_sf_round_pack(sa ^ sb, lo, ea, sticky, mode, p, ebits);
+}
+
+/* b must not be zero. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_div (uint64_t a, uint64_t b, int mode, int p, int ebits) {
+  const uint64_t sign = UINT64_C(1) << (p - 1 + ebits);
+  int sa, sb, ea, eb;
+  uint64_t ma, mb, q = 0;
+
+  if ((a & ~sign) == 0)
+    return (a ^ b) & sign;
+
+  ma = simde_x_sf_unpack(a, p, ebits, &sa, &ea);
+  mb = simde_x_sf_unpack(b, p, ebits, &sb, &eb);
+
+  /* Long division, 8 bits at a time; the quotient ends up with 56 or
+   * 57 bits. */
+  for (int i = 0 ; i < 7 ; i++) {
+    ma <<= 8;
+    q = (q << 8) | (ma / mb);
+    ma %= mb;
+  }
+
+  return simde_x_sf_round_pack(sa ^ sb, q, ea - eb - 56, ma != 0, mode, p, ebits);
+}
+
+/* a must not be negative. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_sqrt (uint64_t a, int mode, int p, int ebits) {
+  const int t = (p / 2) + 2;
+  int s, e;
+  uint64_t m, root = 0, rem = 0;
+
+  if ((a << 1) == 0)
+    return a;
+
+  m = simde_x_sf_unpack(a, p, ebits, &s, &e);
+  if (e & 1) {
+    m <<= 1;
+    e--;
+  }
+
+  /* Digit-by-digit square root of m * 2**(2t), which gives at least
+   * p + 2 bits. */
+  for (int i = ((simde_x_sf_bitlen(m) + (2 * t) + 1) / 2) - 1 ; i >= 0 ; i--) {
+    const uint64_t trial = (root << 2) | 1;
+    rem = (rem << 2) | ((i >= t) ? ((m >> (2 * (i - t))) & 3) : 0);
+    root <<= 1;
+    if (rem >= trial) {
+      rem -= trial;
+      root |= 1;
+    }
+  }
+
+  return simde_x_sf_round_pack(0, root, (e - (2 * t)) / 2, rem != 0, mode, p, ebits);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_fma (uint64_t a, uint64_t b, uint64_t c, int mode, int p, int ebits) {
+  const uint64_t sign = UINT64_C(1) << (p - 1 + ebits);
+  int sa, sb, sc, ea, eb, ec, sticky = 0;
+  uint64_t ma, mb, mc, ph, pl, ch = 0, cl;
+
+  if ((a & ~sign) == 0 || (b & ~sign) == 0)
+    return simde_x_sf_add((a ^ b) & sign, c, mode, p, ebits);
+  if ((c & ~sign) == 0)
+    return simde_x_sf_mul(a, b, mode, p, ebits);
+
+  ma = simde_x_sf_unpack(a, p, ebits, &sa, &ea);
+  mb = simde_x_sf_unpack(b, p, ebits, &sb, &eb);
+  mc = simde_x_sf_unpack(c, p, ebits, &sc, &ec);
+  sa ^= sb;
+  ea += eb;
+
+  /* Line both up just below bit 124.  The exact product has zeros
+   * below it, as does c, so nothing is lost to alignment unless the
+   * exponents are far enough apart that there can't be much
+   * cancellation. */
+  simde_x_sf_mul_u64(ma, mb, &ph, &pl);
+  simde_x_sf_shl_u128(&ph, &pl, 124 - (2 * p));
+  ea -= 124 - (2 * p);
+  cl = mc;
+  simde_x_sf_shl_u128(&ch, &cl, 124 - p);
+  ec -= 124 - p;
+  if (ea >= ec) {
+    simde_x_sf_shr_jam_u128(&ch, &cl, ea - ec);
+  } else {
+    simde_x_sf_shr_jam_u128(&ph, &pl, ec - ea);
+    ea = ec;
+  }
+
+  if (sa == sc) {
+    pl += cl;
+    ph += ch + (pl < cl);
+  } else if ((ph > ch) || ((ph == ch) && (pl >= cl))) {
+    ph -= ch + (pl < cl);
+    pl -= cl;
+  } else {
+    ph = ch - ph - (cl < pl);
+    pl = cl - pl;
+    sa = sc;
+  }
+
+  if ((ph | pl) == 0)
+    return (mode == SIMDE_MM_FROUND_TO_NEG_INF) ? sign : 0;
+
+  pl = simde_x_sf_narrow(ph, pl, &ea, &sticky);
+  return simde_x_sf_round_pack(sa, pl, ea, sticky, mode, p, ebits);
+}
+
+/* fma() if we have it, which is all the residuals below need. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_x_sf_fma_f64 (simde_float64 a, simde_float64 b, simde_float64 c) {
+  #if defined(SIMDE_HAVE_MATH_H)
+    return fma(a, b, c);
+  #else
+    uint64_t ua, ub, uc;
+    simde_memcpy(&ua, &a, sizeof(ua));
+    simde_memcpy(&ub, &b, sizeof(ub));
+    simde_memcpy(&uc, &c, sizeof(uc));
+    if (simde_x_sf_isfinite(ua, 53, 11) && simde_x_sf_isfinite(ub, 53, 11) && simde_x_sf_isfinite(uc, 53, 11)) {
+      ua = simde_x_sf_fma(ua, ub, uc, SIMDE_MM_FROUND_TO_NEAREST_INT, 53, 11);
+      simde_memcpy(&a, &ua, sizeof(a));
+      return a;
+    }
+    return (a * b) + c;
+  #endif
+}
+
+/* The error of s = a + b, exactly.  This is Fast2Sum with the operands
+ * ordered by magnitude rather than TwoSum, which can overflow part way
+ * when s is close to the largest finite value. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_sf_sum_err_f32 (simde_float32 a, simde_float32 b, simde_float32 s) {
+  const int swap = ((a < 0) ? -a : a) < ((b < 0) ? -b : b);
+  const simde_float32 hi = swap ? b : a, lo = swap ? a : b;
+  return lo - (s - hi);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde_float64
+simde_x_sf_sum_err_f64 (simde_float64 a, simde_float64 b, simde_float64 s) {
+  const int swap = ((a < 0) ? -a : a) < ((b < 0) ? -b : b);
+  const simde_float64 hi = swap ? b : a, lo = swap ? a : b;
+  return lo - (s - hi);
+}
+
+/* True when |v| < 2**-960.  Below that the residual of a binary64
+ * product may fall into the subnormal range and lose bits. */
+SIMDE__FUNCTION_ATTRIBUTES
+int
+simde_x_sf_tiny_f64 (uint64_t v) {
+  return (v << 1) < (UINT64_C(63) << 53);
+}
+
+/* r is the round-to-nearest result of an operation on finite operands
+ * and err is the sign (-1, 0 or 1) of exact - r.  Returns the result
+ * rounded according to a directed mode: r itself, or its neighbour on
+ * the side of the exact result.  An infinite r is an overflow, so the
+ * exact result lies just inside it.
+ *
+ * Rounding toward negative infinity has to move down when the exact
+ * result is below r, toward positive infinity up when it's above, and
+ * toward zero down in magnitude when it's on the zero side of r.  Moving
+ * away from zero is one up in the bit pattern, toward zero one down; r
+ * can't be zero unless err has the same sign. */
+SIMDE__FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sf_nudge_u32 (uint32_t r, int err, int mode) {
+  const uint32_t rs = r >> 31;
+  const uint32_t inf = (r << 1) == UINT32_C(0xff000000);
+  const uint32_t es = inf ? (rs ^ 1) : HEDLEY_STATIC_CAST(uint32_t, err < 0);
+  const uint32_t step = (inf | (err != 0)) &
+    (es == ((mode == SIMDE_MM_FROUND_TO_NEG_INF) ? 1 : ((mode == SIMDE_MM_FROUND_TO_POS_INF) ? 0 : (rs ^ 1))));
+
+  return r - step + ((step & ~(es ^ rs)) << 1);
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_sf_nudge_u64 (uint64_t r, int err, int mode) {
+  const uint64_t rs = r >> 63;
+  const uint64_t inf = (r << 1) == UINT64_C(0xffe0000000000000);
+  const uint64_t es = inf ? (rs ^ 1) : HEDLEY_STATIC_CAST(uint64_t, err < 0);
+  const uint64_t step = (inf | (err != 0)) &
+    (es == ((mode == SIMDE_MM_FROUND_TO_NEG_INF) ? 1 : ((mode == SIMDE_MM_FROUND_TO_POS_INF) ? 0 : (rs ^ 1))));
+
+  return r - step + ((step & ~(es ^ rs)) << 1);
+}
+
+/* a * b + c with a single rounding, even when there is no hardware
+ * FMA.  Used for SIMDE_MM_FROUND_CUR_DIRECTION. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_fmadd_exact_ps (simde__m512 a, simde__m512 b, simde__m512 c) {
+  #if defined(SIMDE_AVX512F_NATIVE) || defined(SIMDE_FMA_NATIVE) || (defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64))
+    return simde_mm512_fmadd_ps(a, b, c);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b),
+      c_ = simde__m512_to_private(c);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      /* The product is exact in double precision; the sum is rounded to
+       * odd so the conversion back to float doesn't round twice. */
+      const simde_float64 p = HEDLEY_STATIC_CAST(simde_float64, a_.f32[i]) * HEDLEY_STATIC_CAST(simde_float64, b_.f32[i]);
+      const simde_float64 q = HEDLEY_STATIC_CAST(simde_float64, c_.f32[i]);
+      simde_float64 s = p + q;
+      const simde_float64 t = s - p;
+      const simde_float64 e = (p - (s - t)) + (q - t);
+
+      if ((e < 0) || (e > 0)) {
+        uint64_t bits;
+        simde_memcpy(&bits, &s, sizeof(bits));
+        if ((bits & 1) == 0) {
+          bits = ((e > 0) == (s > 0)) ? (bits + 1) : (bits - 1);
+          simde_memcpy(&s, &bits, sizeof(s));
+        }
+      }
+
+      r_.f32[i] = HEDLEY_STATIC_CAST(simde_float32, s);
+    }
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_fmadd_exact_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
+  #if defined(SIMDE_AVX512F_NATIVE) || defined(SIMDE_FMA_NATIVE) || (defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64))
+    return simde_mm512_fmadd_pd(a, b, c);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b),
+      c_ = simde__m512d_to_private(c);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_x_sf_fma_f64(a_.f64[i], b_.f64[i], c_.f64[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_add_round_ps (simde__m512 a, simde__m512 b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512_private
+    r_ = simde__m512_to_private(simde_mm512_add_ps(a, b)),
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      const simde_float32 e = simde_x_sf_sum_err_f32(a_.f32[i], b_.f32[i], r_.f32[i]);
+      uint32_t v = simde_x_sf_nudge_u32(r_.u32[i], (e > 0) - (e < 0), rounding & 3);
+
+      /* An exact zero is -0 when rounding down unless both are +0. */
+      if (((rounding & 3) == SIMDE_MM_FROUND_TO_NEG_INF) && ((v << 1) == 0))
+        v = (a_.u32[i] | b_.u32[i]) & UINT32_C(0x80000000);
+
+      /* Infinities and NaNs give exact results. */
+      r_.u32[i] = (simde_x_sf_isfinite(a_.u32[i], 24, 8) & simde_x_sf_isfinite(b_.u32[i], 24, 8)) ? v : r_.u32[i];
+    }
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_add_round_ps(a, b, rounding) _mm512_add_round_ps(a, b, rounding)
+#  define simde_mm512_mask_add_round_ps(src, k, a, b, rounding) _mm512_mask_add_round_ps(src, k, a, b, rounding)
+#  define simde_mm512_maskz_add_round_ps(k, a, b, rounding) _mm512_maskz_add_round_ps(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_add_round_ps(src, k, a, b, rounding) simde_mm512_mask_mov_ps(src, k, simde_mm512_add_round_ps(a, b, rounding))
+#  define simde_mm512_maskz_add_round_ps(k, a, b, rounding) simde_mm512_maskz_mov_ps(k, simde_mm512_add_round_ps(a, b, rounding))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_add_round_ps(a, b, rounding) simde_mm512_add_round_ps(a, b, rounding)
+#  define _mm512_mask_add_round_ps(src, k, a, b, rounding) simde_mm512_mask_add_round_ps(src, k, a, b, rounding)
+#  define _mm512_maskz_add_round_ps(k, a, b, rounding) simde_mm512_maskz_add_round_ps(k, a, b, rounding)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_add_round_pd (simde__m512d a, simde__m512d b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512d_private
+    r_ = simde__m512d_to_private(simde_mm512_add_pd(a, b)),
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      const simde_float64 e = simde_x_sf_sum_err_f64(a_.f64[i], b_.f64[i], r_.f64[i]);
+      uint64_t v = simde_x_sf_nudge_u64(r_.u64[i], (e > 0) - (e < 0), rounding & 3);
+
+      if (((rounding & 3) == SIMDE_MM_FROUND_TO_NEG_INF) && ((v << 1) == 0))
+        v = (a_.u64[i] | b_.u64[i]) & (UINT64_C(1) << 63);
+
+      r_.u64[i] = (simde_x_sf_isfinite(a_.u64[i], 53, 11) & simde_x_sf_isfinite(b_.u64[i], 53, 11)) ? v : r_.u64[i];
+    }
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_add_round_pd(a, b, rounding) _mm512_add_round_pd(a, b, rounding)
+#  define simde_mm512_mask_add_round_pd(src, k, a, b, rounding) _mm512_mask_add_round_pd(src, k, a, b, rounding)
+#  define simde_mm512_maskz_add_round_pd(k, a, b, rounding) _mm512_maskz_add_round_pd(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_add_round_pd(src, k, a, b, rounding) simde_mm512_mask_mov_pd(src, k, simde_mm512_add_round_pd(a, b, rounding))
+#  define simde_mm512_maskz_add_round_pd(k, a, b, rounding) simde_mm512_maskz_mov_pd(k, simde_mm512_add_round_pd(a, b, rounding))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_add_round_pd(a, b, rounding) simde_mm512_add_round_pd(a, b, rounding)
+#  define _mm512_mask_add_round_pd(src, k, a, b, rounding) simde_mm512_mask_add_round_pd(src, k, a, b, rounding)
+#  define _mm512_maskz_add_round_pd(k, a, b, rounding) simde_mm512_maskz_add_round_pd(k, a, b, rounding)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_sub_round_ps (simde__m512 a, simde__m512 b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512_private
+    r_ = simde__m512_to_private(simde_mm512_sub_ps(a, b)),
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      const simde_float32 e = simde_x_sf_sum_err_f32(a_.f32[i], -b_.f32[i], r_.f32[i]);
+      uint32_t v = simde_x_sf_nudge_u32(r_.u32[i], (e > 0) - (e < 0), rounding & 3);
+
+      if (((rounding & 3) == SIMDE_MM_FROUND_TO_NEG_INF) && ((v << 1) == 0))
+        v = (a_.u32[i] | ~b_.u32[i]) & UINT32_C(0x80000000);
+
+      /* Infinities and NaNs give exact results. */
+      r_.u32[i] = (simde_x_sf_isfinite(a_.u32[i], 24, 8) & simde_x_sf_isfinite(b_.u32[i], 24, 8)) ? v : r_.u32[i];
+    }
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_sub_round_ps(a, b, rounding) _mm512_sub_round_ps(a, b, rounding)
+#  define simde_mm512_mask_sub_round_ps(src, k, a, b, rounding) _mm512_mask_sub_round_ps(src, k, a, b, rounding)
+#  define simde_mm512_maskz_sub_round_ps(k, a, b, rounding) _mm512_maskz_sub_round_ps(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_sub_round_ps(src, k, a, b, rounding) simde_mm512_mask_mov_ps(src, k, simde_mm512_sub_round_ps(a, b, rounding))
+#  define simde_mm512_maskz_sub_round_ps(k, a, b, rounding) simde_mm512_maskz_mov_ps(k, simde_mm512_sub_round_ps(a, b, rounding))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sub_round_ps(a, b, rounding) simde_mm512_sub_round_ps(a, b, rounding)
+#  define _mm512_mask_sub_round_ps(src, k, a, b, rounding) simde_mm512_mask_sub_round_ps(src, k, a, b, rounding)
+#  define _mm512_maskz_sub_round_ps(k, a, b, rounding) simde_mm512_maskz_sub_round_ps(k, a, b, rounding)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_sub_round_pd (simde__m512d a, simde__m512d b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512d_private
+    r_ = simde__m512d_to_private(simde_mm512_sub_pd(a, b)),
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      const simde_float64 e = simde_x_sf_sum_err_f64(a_.f64[i], -b_.f64[i], r_.f64[i]);
+      uint64_t v = simde_x_sf_nudge_u64(r_.u64[i], (e > 0) - (e < 0), rounding & 3);
+
+      if (((rounding & 3) == SIMDE_MM_FROUND_TO_NEG_INF) && ((v << 1) == 0))
+        v = (a_.u64[i] | ~b_.u64[i]) & (UINT64_C(1) << 63);
+
+      r_.u64[i] = (simde_x_sf_isfinite(a_.u64[i], 53, 11) & simde_x_sf_isfinite(b_.u64[i], 53, 11)) ? v : r_.u64[i];
+    }
   }
-#endif
 
-  return simde__m256i_from_private(r_);
-#endif
+  return simde__m512d_from_private(r_);
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_sub_round_pd(a, b, rounding) _mm512_sub_round_pd(a, b, rounding)
+#  define simde_mm512_mask_sub_round_pd(src, k, a, b, rounding) _mm512_mask_sub_round_pd(src, k, a, b, rounding)
+#  define simde_mm512_maskz_sub_round_pd(k, a, b, rounding) _mm512_maskz_sub_round_pd(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_sub_round_pd(src, k, a, b, rounding) simde_mm512_mask_mov_pd(src, k, simde_mm512_sub_round_pd(a, b, rounding))
+#  define simde_mm512_maskz_sub_round_pd(k, a, b, rounding) simde_mm512_maskz_mov_pd(k, simde_mm512_sub_round_pd(a, b, rounding))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cvtepi32_epi16(a) simde_mm512_cvtepi32_epi16(a)
+#  define _mm512_sub_round_pd(a, b, rounding) simde_mm512_sub_round_pd(a, b, rounding)
+#  define _mm512_mask_sub_round_pd(src, k, a, b, rounding) simde_mm512_mask_sub_round_pd(src, k, a, b, rounding)
+#  define _mm512_maskz_sub_round_pd(k, a, b, rounding) simde_mm512_maskz_sub_round_pd(k, a, b, rounding)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m128i
-simde_mm512_cvtepi64_epi8 (simde__m512i a) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_cvtepi64_epi8(a);
-#else
-  simde__m128i_private r_ = simde__m128i_to_private(simde_mm_setzero_si128());
-  simde__m512i_private a_ = simde__m512i_to_private(a);
+simde__m512
+simde_mm512_mul_round_ps (simde__m512 a, simde__m512 b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512_private
+    r_ = simde__m512_to_private(simde_mm512_mul_ps(a, b)),
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
 
-#if defined(SIMDE__CONVERT_VECTOR)
-  SIMDE__CONVERT_VECTOR(r_.m64_private[0].i8, a_.i64);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-    r_.i8[i] = HEDLEY_STATIC_CAST(int8_t, a_.i64[i]);
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      /* The product of two floats is exact in double precision. */
+      const simde_float64 e = (HEDLEY_STATIC_CAST(simde_float64, a_.f32[i]) * HEDLEY_STATIC_CAST(simde_float64, b_.f32[i])) - HEDLEY_STATIC_CAST(simde_float64, r_.f32[i]);
+      const uint32_t v = simde_x_sf_nudge_u32(r_.u32[i], (e > 0) - (e < 0), rounding & 3);
+
+      /* Infinities and NaNs give exact results. */
+      r_.u32[i] = (simde_x_sf_isfinite(a_.u32[i], 24, 8) & simde_x_sf_isfinite(b_.u32[i], 24, 8)) ? v : r_.u32[i];
+    }
   }
-#endif
 
-  return simde__m128i_from_private(r_);
-#endif
+  return simde__m512_from_private(r_);
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mul_round_ps(a, b, rounding) _mm512_mul_round_ps(a, b, rounding)
+#  define simde_mm512_mask_mul_round_ps(src, k, a, b, rounding) _mm512_mask_mul_round_ps(src, k, a, b, rounding)
+#  define simde_mm512_maskz_mul_round_ps(k, a, b, rounding) _mm512_maskz_mul_round_ps(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_mul_round_ps(src, k, a, b, rounding) simde_mm512_mask_mov_ps(src, k, simde_mm512_mul_round_ps(a, b, rounding))
+#  define simde_mm512_maskz_mul_round_ps(k, a, b, rounding) simde_mm512_maskz_mov_ps(k, simde_mm512_mul_round_ps(a, b, rounding))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cvtepi64_epi8(a) simde_mm512_cvtepi64_epi8(a)
+#  define _mm512_mul_round_ps(a, b, rounding) simde_mm512_mul_round_ps(a, b, rounding)
+#  define _mm512_mask_mul_round_ps(src, k, a, b, rounding) simde_mm512_mask_mul_round_ps(src, k, a, b, rounding)
+#  define _mm512_maskz_mul_round_ps(k, a, b, rounding) simde_mm512_maskz_mul_round_ps(k, a, b, rounding)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
-simde__m128i
-simde_mm512_cvtepi64_epi16 (simde__m512i a) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_cvtepi64_epi16(a);
-#else
-  simde__m128i_private r_ = simde__m128i_to_private(simde_mm_setzero_si128());
-  simde__m512i_private a_ = simde__m512i_to_private(a);
+simde__m512d
+simde_mm512_mul_round_pd (simde__m512d a, simde__m512d b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512d_private
+    r_ = simde__m512d_to_private(simde_mm512_mul_pd(a, b)),
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
 
-#if defined(SIMDE__CONVERT_VECTOR)
-  SIMDE__CONVERT_VECTOR(r_.i16, a_.i64);
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-    r_.i16[i] = HEDLEY_STATIC_CAST(int16_t, a_.i64[i]);
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      if (simde_x_sf_isfinite(a_.u64[i], 53, 11) && simde_x_sf_isfinite(b_.u64[i], 53, 11)) {
+        if (simde_x_sf_tiny_f64(r_.u64[i])) {
+          r_.u64[i] = simde_x_sf_mul(a_.u64[i], b_.u64[i], rounding & 3, 53, 11);
+        } else {
+          const simde_float64 e = simde_x_sf_fma_f64(a_.f64[i], b_.f64[i], -r_.f64[i]);
+          r_.u64[i] = simde_x_sf_nudge_u64(r_.u64[i], (e > 0) - (e < 0), rounding & 3);
+        }
+      }
+    }
   }
-#endif
 
-  return simde__m128i_from_private(r_);
-#endif
+  return simde__m512d_from_private(r_);
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_mul_round_pd(a, b, rounding) _mm512_mul_round_pd(a, b, rounding)
+#  define simde_mm512_mask_mul_round_pd(src, k, a, b, rounding) _mm512_mask_mul_round_pd(src, k, a, b, rounding)
+#  define simde_mm512_maskz_mul_round_pd(k, a, b, rounding) _mm512_maskz_mul_round_pd(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_mul_round_pd(src, k, a, b, rounding) simde_mm512_mask_mov_pd(src, k, simde_mm512_mul_round_pd(a, b, rounding))
+#  define simde_mm512_maskz_mul_round_pd(k, a, b, rounding) simde_mm512_maskz_mov_pd(k, simde_mm512_mul_round_pd(a, b, rounding))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_cvtepi64_epi16(a) simde_mm512_cvtepi64_epi16(a)
+#  define _mm512_mul_round_pd(a, b, rounding) simde_mm512_mul_round_pd(a, b, rounding)
+#  define _mm512_mask_mul_round_pd(src, k, a, b, rounding) simde_mm512_mask_mul_round_pd(src, k, a, b, rounding)
+#  define _mm512_maskz_mul_round_pd(k, a, b, rounding) simde_mm512_maskz_mul_round_pd(k, a, b, rounding)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_div_ps (simde__m512 a, simde__m512 b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_div_ps(a, b);
-#else
+simde_mm512_div_round_ps (simde__m512 a, simde__m512 b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
   simde__m512_private
-    r_,
+    r_ = simde__m512_to_private(simde_mm512_div_ps(a, b)),
     a_ = simde__m512_to_private(a),
     b_ = simde__m512_to_private(b);
 
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f32 = a_.f32 / b_.f32;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
-    r_.m256[i] = simde_mm256_div_ps(a_.m256[i], b_.m256[i]);
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      /* a - q * b is exact in double precision; the error of q has its
+       * sign times that of b. */
+      const simde_float64 e = HEDLEY_STATIC_CAST(simde_float64, a_.f32[i]) - (HEDLEY_STATIC_CAST(simde_float64, r_.f32[i]) * HEDLEY_STATIC_CAST(simde_float64, b_.f32[i]));
+      const int s = (b_.u32[i] >> 31) ? -1 : 1;
+      const uint32_t v = simde_x_sf_nudge_u32(r_.u32[i], s * ((e > 0) - (e < 0)), rounding & 3);
+
+      /* Infinities and NaNs give exact results. */
+      r_.u32[i] = (simde_x_sf_isfinite(a_.u32[i], 24, 8) & simde_x_sf_isfinite(b_.u32[i], 24, 8) & ((b_.u32[i] << 1) != 0)) ? v : r_.u32[i];
+    }
   }
-#endif
 
   return simde__m512_from_private(r_);
-#endif
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_div_round_ps(a, b, rounding) _mm512_div_round_ps(a, b, rounding)
+#  define simde_mm512_mask_div_round_ps(src, k, a, b, rounding) _mm512_mask_div_round_ps(src, k, a, b, rounding)
+#  define simde_mm512_maskz_div_round_ps(k, a, b, rounding) _mm512_maskz_div_round_ps(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_div_round_ps(src, k, a, b, rounding) simde_mm512_mask_mov_ps(src, k, simde_mm512_div_round_ps(a, b, rounding))
+#  define simde_mm512_maskz_div_round_ps(k, a, b, rounding) simde_mm512_maskz_mov_ps(k, simde_mm512_div_round_ps(a, b, rounding))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_div_ps(a, b) simde_mm512_div_ps(a, b)
+#  define _mm512_div_round_ps(a, b, rounding) simde_mm512_div_round_ps(a, b, rounding)
+#  define _mm512_mask_div_round_ps(src, k, a, b, rounding) simde_mm512_mask_div_round_ps(src, k, a, b, rounding)
+#  define _mm512_maskz_div_round_ps(k, a, b, rounding) simde_mm512_maskz_div_round_ps(k, a, b, rounding)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_div_pd (simde__m512d a, simde__m512d b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_div_pd(a, b);
-#else
+simde_mm512_div_round_pd (simde__m512d a, simde__m512d b, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
   simde__m512d_private
-    r_,
+    r_ = simde__m512d_to_private(simde_mm512_div_pd(a, b)),
     a_ = simde__m512d_to_private(a),
     b_ = simde__m512d_to_private(b);
 
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f64 = a_.f64 / b_.f64;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-    r_.m256d[i] = simde_mm256_div_pd(a_.m256d[i], b_.m256d[i]);
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      if (simde_x_sf_isfinite(a_.u64[i], 53, 11) && simde_x_sf_isfinite(b_.u64[i], 53, 11) && ((b_.u64[i] << 1) != 0)) {
+        if (simde_x_sf_tiny_f64(r_.u64[i]) || simde_x_sf_tiny_f64(a_.u64[i])) {
+          r_.u64[i] = simde_x_sf_div(a_.u64[i], b_.u64[i], rounding & 3, 53, 11);
+        } else {
+          const simde_float64 e = simde_x_sf_fma_f64(-r_.f64[i], b_.f64[i], a_.f64[i]);
+          const int s = (b_.u64[i] >> 63) ? -1 : 1;
+          r_.u64[i] = simde_x_sf_nudge_u64(r_.u64[i], s * ((e > 0) - (e < 0)), rounding & 3);
+        }
+      }
+    }
   }
-#endif
 
   return simde__m512d_from_private(r_);
-#endif
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_div_round_pd(a, b, rounding) _mm512_div_round_pd(a, b, rounding)
+#  define simde_mm512_mask_div_round_pd(src, k, a, b, rounding) _mm512_mask_div_round_pd(src, k, a, b, rounding)
+#  define simde_mm512_maskz_div_round_pd(k, a, b, rounding) _mm512_maskz_div_round_pd(k, a, b, rounding)
+#else
+#  define simde_mm512_mask_div_round_pd(src, k, a, b, rounding) simde_mm512_mask_mov_pd(src, k, simde_mm512_div_round_pd(a, b, rounding))
+#  define simde_mm512_maskz_div_round_pd(k, a, b, rounding) simde_mm512_maskz_mov_pd(k, simde_mm512_div_round_pd(a, b, rounding))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_div_pd(a, b) simde_mm512_div_pd(a, b)
+#  define _mm512_div_round_pd(a, b, rounding) simde_mm512_div_round_pd(a, b, rounding)
+#  define _mm512_mask_div_round_pd(src, k, a, b, rounding) simde_mm512_mask_div_round_pd(src, k, a, b, rounding)
+#  define _mm512_maskz_div_round_pd(k, a, b, rounding) simde_mm512_maskz_div_round_pd(k, a, b, rounding)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_mul_ps (simde__m512 a, simde__m512 b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_mul_ps(a, b);
-#else
+simde_mm512_sqrt_round_ps (simde__m512 a, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
   simde__m512_private
-    r_,
-    a_ = simde__m512_to_private(a),
-    b_ = simde__m512_to_private(b);
+    r_ = simde__m512_to_private(simde_mm512_sqrt_ps(a)),
+    a_ = simde__m512_to_private(a);
 
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f32 = a_.f32 * b_.f32;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
-    r_.m256[i] = simde_mm256_mul_ps(a_.m256[i], b_.m256[i]);
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      const simde_float64 s = HEDLEY_STATIC_CAST(simde_float64, r_.f32[i]);
+      const simde_float64 e = HEDLEY_STATIC_CAST(simde_float64, a_.f32[i]) - (s * s);
+      const uint32_t v = simde_x_sf_nudge_u32(r_.u32[i], (e > 0) - (e < 0), rounding & 3);
+
+      /* Infinities and NaNs give exact results. */
+      r_.u32[i] = (simde_x_sf_isfinite(a_.u32[i], 24, 8) & !(a_.u32[i] >> 31)) ? v : r_.u32[i];
+    }
   }
-#endif
 
   return simde__m512_from_private(r_);
-#endif
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_sqrt_round_ps(a, rounding) _mm512_sqrt_round_ps(a, rounding)
+#  define simde_mm512_mask_sqrt_round_ps(src, k, a, rounding) _mm512_mask_sqrt_round_ps(src, k, a, rounding)
+#  define simde_mm512_maskz_sqrt_round_ps(k, a, rounding) _mm512_maskz_sqrt_round_ps(k, a, rounding)
+#else
+#  define simde_mm512_mask_sqrt_round_ps(src, k, a, rounding) simde_mm512_mask_mov_ps(src, k, simde_mm512_sqrt_round_ps(a, rounding))
+#  define simde_mm512_maskz_sqrt_round_ps(k, a, rounding) simde_mm512_maskz_mov_ps(k, simde_mm512_sqrt_round_ps(a, rounding))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_mul_ps(a, b) simde_mm512_mul_ps(a, b)
+#  define _mm512_sqrt_round_ps(a, rounding) simde_mm512_sqrt_round_ps(a, rounding)
+#  define _mm512_mask_sqrt_round_ps(src, k, a, rounding) simde_mm512_mask_sqrt_round_ps(src, k, a, rounding)
+#  define _mm512_maskz_sqrt_round_ps(k, a, rounding) simde_mm512_maskz_sqrt_round_ps(k, a, rounding)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_mul_pd (simde__m512d a, simde__m512d b) {
-#if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_mul_pd(a, b);
-#else
+simde_mm512_sqrt_round_pd (simde__m512d a, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
   simde__m512d_private
-    r_,
-    a_ = simde__m512d_to_private(a),
-    b_ = simde__m512d_to_private(b);
+    r_ = simde__m512d_to_private(simde_mm512_sqrt_pd(a)),
+    a_ = simde__m512d_to_private(a);
+
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      if (simde_x_sf_isfinite(a_.u64[i], 53, 11) && !(a_.u64[i] >> 63)) {
+        if (simde_x_sf_tiny_f64(a_.u64[i])) {
+          r_.u64[i] = simde_x_sf_sqrt(a_.u64[i], rounding & 3, 53, 11);
+        } else {
+          const simde_float64 e = simde_x_sf_fma_f64(-r_.f64[i], r_.f64[i], a_.f64[i]);
+          r_.u64[i] = simde_x_sf_nudge_u64(r_.u64[i], (e > 0) - (e < 0), rounding & 3);
+        }
+      }
+    }
+  }
 
-#if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.f64 = a_.f64 * b_.f64;
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_sqrt_round_pd(a, rounding) _mm512_sqrt_round_pd(a, rounding)
+#  define simde_mm512_mask_sqrt_round_pd(src, k, a, rounding) _mm512_mask_sqrt_round_pd(src, k, a, rounding)
+#  define simde_mm512_maskz_sqrt_round_pd(k, a, rounding) _mm512_maskz_sqrt_round_pd(k, a, rounding)
 #else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-    r_.m256d[i] = simde_mm256_mul_pd(a_.m256d[i], b_.m256d[i]);
+#  define simde_mm512_mask_sqrt_round_pd(src, k, a, rounding) simde_mm512_mask_mov_pd(src, k, simde_mm512_sqrt_round_pd(a, rounding))
+#  define simde_mm512_maskz_sqrt_round_pd(k, a, rounding) simde_mm512_maskz_mov_pd(k, simde_mm512_sqrt_round_pd(a, rounding))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_sqrt_round_pd(a, rounding) simde_mm512_sqrt_round_pd(a, rounding)
+#  define _mm512_mask_sqrt_round_pd(src, k, a, rounding) simde_mm512_mask_sqrt_round_pd(src, k, a, rounding)
+#  define _mm512_maskz_sqrt_round_pd(k, a, rounding) simde_mm512_maskz_sqrt_round_pd(k, a, rounding)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_fmadd_round_ps (simde__m512 a, simde__m512 b, simde__m512 c, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512_private
+    r_ = simde__m512_to_private(simde_x_mm512_fmadd_exact_ps(a, b, c)),
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b),
+    c_ = simde__m512_to_private(c);
+
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      /* s + e is exactly a * b + c, and r is within an ulp of it, so the
+       * sign of s - r is that of the error unless it is zero. */
+      const simde_float64 p = HEDLEY_STATIC_CAST(simde_float64, a_.f32[i]) * HEDLEY_STATIC_CAST(simde_float64, b_.f32[i]);
+      const simde_float64 q = HEDLEY_STATIC_CAST(simde_float64, c_.f32[i]);
+      const simde_float64 s = p + q;
+      const simde_float64 e = simde_x_sf_sum_err_f64(p, q, s);
+      const simde_float64 d = s - HEDLEY_STATIC_CAST(simde_float64, r_.f32[i]);
+      const int ds = (d > 0) - (d < 0);
+      uint32_t v = simde_x_sf_nudge_u32(r_.u32[i], ds ? ds : ((e > 0) - (e < 0)), rounding & 3);
+
+      if (((rounding & 3) == SIMDE_MM_FROUND_TO_NEG_INF) && (s == 0))
+        v = ((a_.u32[i] ^ b_.u32[i]) | c_.u32[i]) & UINT32_C(0x80000000);
+
+      /* Infinities and NaNs give exact results. */
+      r_.u32[i] = (simde_x_sf_isfinite(a_.u32[i], 24, 8) & simde_x_sf_isfinite(b_.u32[i], 24, 8) & simde_x_sf_isfinite(c_.u32[i], 24, 8)) ? v : r_.u32[i];
+    }
   }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_fmadd_round_ps(a, b, c, rounding) _mm512_fmadd_round_ps(a, b, c, rounding)
+#  define simde_mm512_mask_fmadd_round_ps(a, k, b, c, rounding) _mm512_mask_fmadd_round_ps(a, k, b, c, rounding)
+#  define simde_mm512_mask3_fmadd_round_ps(a, b, c, k, rounding) _mm512_mask3_fmadd_round_ps(a, b, c, k, rounding)
+#  define simde_mm512_maskz_fmadd_round_ps(k, a, b, c, rounding) _mm512_maskz_fmadd_round_ps(k, a, b, c, rounding)
+#else
+#  define simde_mm512_mask_fmadd_round_ps(a, k, b, c, rounding) simde_mm512_mask_mov_ps(a, k, simde_mm512_fmadd_round_ps(a, b, c, rounding))
+#  define simde_mm512_mask3_fmadd_round_ps(a, b, c, k, rounding) simde_mm512_mask_mov_ps(c, k, simde_mm512_fmadd_round_ps(a, b, c, rounding))
+#  define simde_mm512_maskz_fmadd_round_ps(k, a, b, c, rounding) simde_mm512_maskz_mov_ps(k, simde_mm512_fmadd_round_ps(a, b, c, rounding))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_fmadd_round_ps(a, b, c, rounding) simde_mm512_fmadd_round_ps(a, b, c, rounding)
+#  define _mm512_mask_fmadd_round_ps(a, k, b, c, rounding) simde_mm512_mask_fmadd_round_ps(a, k, b, c, rounding)
+#  define _mm512_mask3_fmadd_round_ps(a, b, c, k, rounding) simde_mm512_mask3_fmadd_round_ps(a, b, c, k, rounding)
+#  define _mm512_maskz_fmadd_round_ps(k, a, b, c, rounding) simde_mm512_maskz_fmadd_round_ps(k, a, b, c, rounding)
 #endif
 
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_fmadd_round_pd (simde__m512d a, simde__m512d b, simde__m512d c, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512d_private
+    r_ = simde__m512d_to_private(simde_x_mm512_fmadd_exact_pd(a, b, c)),
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b),
+    c_ = simde__m512d_to_private(c);
+
+  if (!(rounding & SIMDE_MM_FROUND_CUR_DIRECTION) && ((rounding & 3) != SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      if (simde_x_sf_isfinite(a_.u64[i], 53, 11) && simde_x_sf_isfinite(b_.u64[i], 53, 11) && simde_x_sf_isfinite(c_.u64[i], 53, 11)) {
+        const simde_float64 u1 = a_.f64[i] * b_.f64[i];
+        uint64_t u;
+        simde_memcpy(&u, &u1, sizeof(u));
+
+        if (!simde_x_sf_isfinite(u, 53, 11) || simde_x_sf_tiny_f64(u) || simde_x_sf_tiny_f64(r_.u64[i])) {
+          r_.u64[i] = simde_x_sf_fma(a_.u64[i], b_.u64[i], c_.u64[i], rounding & 3, 53, 11);
+        } else {
+          /* The error of the FMA (Boldo and Muller, "Exact and
+           * approximated error of the FMA"); e is that error correctly
+           * rounded. */
+          const simde_float64 u2 = simde_x_sf_fma_f64(a_.f64[i], b_.f64[i], -u1);
+          const simde_float64 x1 = c_.f64[i] + u2;
+          const simde_float64 x2 = simde_x_sf_sum_err_f64(c_.f64[i], u2, x1);
+          const simde_float64 y1 = u1 + x1;
+          const simde_float64 y2 = simde_x_sf_sum_err_f64(u1, x1, y1);
+          const simde_float64 e = ((y1 - r_.f64[i]) + y2) + x2;
+          r_.u64[i] = simde_x_sf_nudge_u64(r_.u64[i], (e > 0) - (e < 0), rounding & 3);
+        }
+      }
+    }
+  }
+
   return simde__m512d_from_private(r_);
-#endif
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_fmadd_round_pd(a, b, c, rounding) _mm512_fmadd_round_pd(a, b, c, rounding)
+#  define simde_mm512_mask_fmadd_round_pd(a, k, b, c, rounding) _mm512_mask_fmadd_round_pd(a, k, b, c, rounding)
+#  define simde_mm512_mask3_fmadd_round_pd(a, b, c, k, rounding) _mm512_mask3_fmadd_round_pd(a, b, c, k, rounding)
+#  define simde_mm512_maskz_fmadd_round_pd(k, a, b, c, rounding) _mm512_maskz_fmadd_round_pd(k, a, b, c, rounding)
+#else
+#  define simde_mm512_mask_fmadd_round_pd(a, k, b, c, rounding) simde_mm512_mask_mov_pd(a, k, simde_mm512_fmadd_round_pd(a, b, c, rounding))
+#  define simde_mm512_mask3_fmadd_round_pd(a, b, c, k, rounding) simde_mm512_mask_mov_pd(c, k, simde_mm512_fmadd_round_pd(a, b, c, rounding))
+#  define simde_mm512_maskz_fmadd_round_pd(k, a, b, c, rounding) simde_mm512_maskz_mov_pd(k, simde_mm512_fmadd_round_pd(a, b, c, rounding))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_mul_pd(a, b) simde_mm512_mul_pd(a, b)
+#  define _mm512_fmadd_round_pd(a, b, c, rounding) simde_mm512_fmadd_round_pd(a, b, c, rounding)
+#  define _mm512_mask_fmadd_round_pd(a, k, b, c, rounding) simde_mm512_mask_fmadd_round_pd(a, k, b, c, rounding)
+#  define _mm512_mask3_fmadd_round_pd(a, b, c, k, rounding) simde_mm512_mask3_fmadd_round_pd(a, b, c, k, rounding)
+#  define _mm512_maskz_fmadd_round_pd(k, a, b, c, rounding) simde_mm512_maskz_fmadd_round_pd(k, a, b, c, rounding)
 #endif
 
 SIMDE__FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_or_si512 (simde__m512i a, simde__m512i b) {
+simde_mm512_cvt_roundps_epi32 (simde__m512 a, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512i_private r_;
+  simde__m512_private a_ = simde__m512_to_private(a);
+
+  #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+    const int mode = (rounding & SIMDE_MM_FROUND_CUR_DIRECTION) ? -1 : (rounding & 3);
+    for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+      const float32x4_t v = a_.m128_private[i].neon_f32;
+      int32x4_t t;
+
+      switch (mode) {
+        case SIMDE_MM_FROUND_TO_NEAREST_INT:
+          t = vcvtnq_s32_f32(v);
+          break;
+        case SIMDE_MM_FROUND_TO_NEG_INF:
+          t = vcvtmq_s32_f32(v);
+          break;
+        case SIMDE_MM_FROUND_TO_POS_INF:
+          t = vcvtpq_s32_f32(v);
+          break;
+        case SIMDE_MM_FROUND_TO_ZERO:
+          t = vcvtq_s32_f32(v);
+          break;
+        default:
+          t = vcvtq_s32_f32(vrndiq_f32(v));
+          break;
+      }
+
+      /* NEON saturates (and gives 0 for NaN) where x86 gives the
+       * "integer indefinite" value.  Floats this large are integers, so
+       * checking before rounding is the same as after. */
+      r_.m128i_private[i].neon_i32 = vbslq_s32(
+        vandq_u32(vcgeq_f32(v, vdupq_n_f32(SIMDE_FLOAT32_C(-2147483648.0))), vcltq_f32(v, vdupq_n_f32(SIMDE_FLOAT32_C(2147483648.0)))),
+        t, vdupq_n_s32(INT32_MIN));
+    }
+  #elif defined(SIMDE_HAVE_MATH_H)
+    const int mode = (rounding & SIMDE_MM_FROUND_CUR_DIRECTION) ? -1 : (rounding & 3);
+    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+      simde_float32 v = a_.f32[i];
+
+      switch (mode) {
+        case SIMDE_MM_FROUND_TO_NEAREST_INT:
+          /* Not nearbyintf(), which uses the current rounding mode.
+           * Anything this large is already an integer (or inf/NaN). */
+          if (fabsf(v) < SIMDE_FLOAT32_C(8388608.0)) {
+            const simde_float32 f = floorf(v);
+            const simde_float32 d = v - f;
+            v = ((d > SIMDE_FLOAT32_C(0.5)) || ((d == SIMDE_FLOAT32_C(0.5)) && (HEDLEY_STATIC_CAST(int32_t, f) & 1))) ? (f + SIMDE_FLOAT32_C(1.0)) : f;
+          }
+          break;
+        case SIMDE_MM_FROUND_TO_NEG_INF:
+          v = floorf(v);
+          break;
+        case SIMDE_MM_FROUND_TO_POS_INF:
+          v = ceilf(v);
+          break;
+        case SIMDE_MM_FROUND_TO_ZERO:
+          v = truncf(v);
+          break;
+        default:
+          v = nearbyintf(v);
+          break;
+      }
+
+      /* Out of range and NaN give the "integer indefinite" value. */
+      r_.i32[i] = ((v >= SIMDE_FLOAT32_C(-2147483648.0)) && (v < SIMDE_FLOAT32_C(2147483648.0))) ? HEDLEY_STATIC_CAST(int32_t, v) : INT32_MIN;
+    }
+  #else
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
 #if defined(SIMDE_AVX512F_NATIVE)
-  return _mm512_or_si512(a, b);
+#  define simde_mm512_cvt_roundps_epi32(a, rounding) _mm512_cvt_roundps_epi32(a, rounding)
+#  define simde_mm512_mask_cvt_roundps_epi32(src, k, a, rounding) _mm512_mask_cvt_roundps_epi32(src, k, a, rounding)
+#  define simde_mm512_maskz_cvt_roundps_epi32(k, a, rounding) _mm512_maskz_cvt_roundps_epi32(k, a, rounding)
 #else
-  simde__m512i_private
-    r_,
-    a_ = simde__m512i_to_private(a),
-    b_ = simde__m512i_to_private(b);
+#  define simde_mm512_mask_cvt_roundps_epi32(src, k, a, rounding) simde_mm512_mask_mov_epi32(src, k, simde_mm512_cvt_roundps_epi32(a, rounding))
+#  define simde_mm512_maskz_cvt_roundps_epi32(k, a, rounding) simde_mm512_maskz_mov_epi32(k, simde_mm512_cvt_roundps_epi32(a, rounding))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvt_roundps_epi32(a, rounding) simde_mm512_cvt_roundps_epi32(a, rounding)
+#  define _mm512_mask_cvt_roundps_epi32(src, k, a, rounding) simde_mm512_mask_cvt_roundps_epi32(src, k, a, rounding)
+#  define _mm512_maskz_cvt_roundps_epi32(k, a, rounding) simde_mm512_maskz_cvt_roundps_epi32(k, a, rounding)
+#endif
 
-#if defined(SIMDE_ARCH_X86_AVX2)
-  r_.m256i[0] = simde_mm256_or_si256(a_.m256i[0], b_.m256i[0]);
-  r_.m256i[1] = simde_mm256_or_si256(a_.m256i[1], b_.m256i[1]);
-#elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
-  r_.i32f = a_.i32f | b_.i32f;
-#else
-  SIMDE__VECTORIZE
-  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-    r_.i32f[i] = a_.i32f[i] | b_.i32f[i];
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_cvt_roundpd_epi32 (simde__m512d a, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m256i_private r_;
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  #if defined(SIMDE_AVX512F_NEON) && defined(SIMDE_ARCH_AARCH64)
+    const int mode = (rounding & SIMDE_MM_FROUND_CUR_DIRECTION) ? -1 : (rounding & 3);
+    for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+      int32x2_t h[2];
+
+      for (size_t j = 0 ; j < (sizeof(h) / sizeof(h[0])) ; j++) {
+        float64x2_t v = a_.m128d_private[(i * 2) + j].neon_f64;
+
+        switch (mode) {
+          case SIMDE_MM_FROUND_TO_NEAREST_INT:
+            v = vrndnq_f64(v);
+            break;
+          case SIMDE_MM_FROUND_TO_NEG_INF:
+            v = vrndmq_f64(v);
+            break;
+          case SIMDE_MM_FROUND_TO_POS_INF:
+            v = vrndpq_f64(v);
+            break;
+          case SIMDE_MM_FROUND_TO_ZERO:
+            v = vrndq_f64(v);
+            break;
+          default:
+            v = vrndiq_f64(v);
+            break;
+        }
+
+        /* Out of range and NaN give the "integer indefinite" value. */
+        h[j] = vmovn_s64(vbslq_s64(
+          vandq_u64(vcgeq_f64(v, vdupq_n_f64(SIMDE_FLOAT64_C(-2147483648.0))), vcltq_f64(v, vdupq_n_f64(SIMDE_FLOAT64_C(2147483648.0)))),
+          vcvtq_s64_f64(v), vdupq_n_s64(INT32_MIN)));
+      }
+
+      r_.m128i_private[i].neon_i32 = vcombine_s32(h[0], h[1]);
+    }
+  #elif defined(SIMDE_HAVE_MATH_H)
+    const int mode = (rounding & SIMDE_MM_FROUND_CUR_DIRECTION) ? -1 : (rounding & 3);
+    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+      simde_float64 v = a_.f64[i];
+
+      switch (mode) {
+        case SIMDE_MM_FROUND_TO_NEAREST_INT:
+          /* Not nearbyint(), which uses the current rounding mode.
+           * Anything this large is already an integer (or inf/NaN). */
+          if (fabs(v) < SIMDE_FLOAT64_C(4503599627370496.0)) {
+            const simde_float64 f = floor(v);
+            const simde_float64 d = v - f;
+            v = ((d > SIMDE_FLOAT64_C(0.5)) || ((d == SIMDE_FLOAT64_C(0.5)) && (HEDLEY_STATIC_CAST(int64_t, f) & 1))) ? (f + SIMDE_FLOAT64_C(1.0)) : f;
+          }
+          break;
+        case SIMDE_MM_FROUND_TO_NEG_INF:
+          v = floor(v);
+          break;
+        case SIMDE_MM_FROUND_TO_POS_INF:
+          v = ceil(v);
+          break;
+        case SIMDE_MM_FROUND_TO_ZERO:
+          v = trunc(v);
+          break;
+        default:
+          v = nearbyint(v);
+          break;
+      }
+
+      /* Out of range and NaN give the "integer indefinite" value. */
+      r_.i32[i] = ((v >= SIMDE_FLOAT64_C(-2147483648.0)) && (v < SIMDE_FLOAT64_C(2147483648.0))) ? HEDLEY_STATIC_CAST(int32_t, v) : INT32_MIN;
+    }
+  #else
+    HEDLEY_UNREACHABLE();
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cvt_roundpd_epi32(a, rounding) _mm512_cvt_roundpd_epi32(a, rounding)
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvt_roundpd_epi32(a, rounding) simde_mm512_cvt_roundpd_epi32(a, rounding)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_cvt_roundepi32_ps (simde__m512i a, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m512_private r_;
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    if (rounding & SIMDE_MM_FROUND_CUR_DIRECTION) {
+      r_.f32[i] = HEDLEY_STATIC_CAST(simde_float32, a_.i32[i]);
+    } else {
+      const int64_t v = HEDLEY_STATIC_CAST(int64_t, a_.i32[i]);
+      r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, simde_x_sf_round_pack(v < 0, HEDLEY_STATIC_CAST(uint64_t, (v < 0) ? -v : v), 0, 0, rounding & 3, 24, 8));
+    }
   }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cvt_roundepi32_ps(a, rounding) _mm512_cvt_roundepi32_ps(a, rounding)
+#  define simde_mm512_mask_cvt_roundepi32_ps(src, k, a, rounding) _mm512_mask_cvt_roundepi32_ps(src, k, a, rounding)
+#  define simde_mm512_maskz_cvt_roundepi32_ps(k, a, rounding) _mm512_maskz_cvt_roundepi32_ps(k, a, rounding)
+#else
+#  define simde_mm512_mask_cvt_roundepi32_ps(src, k, a, rounding) simde_mm512_mask_mov_ps(src, k, simde_mm512_cvt_roundepi32_ps(a, rounding))
+#  define simde_mm512_maskz_cvt_roundepi32_ps(k, a, rounding) simde_mm512_maskz_mov_ps(k, simde_mm512_cvt_roundepi32_ps(a, rounding))
+#endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvt_roundepi32_ps(a, rounding) simde_mm512_cvt_roundepi32_ps(a, rounding)
+#  define _mm512_mask_cvt_roundepi32_ps(src, k, a, rounding) simde_mm512_mask_cvt_roundepi32_ps(src, k, a, rounding)
+#  define _mm512_maskz_cvt_roundepi32_ps(k, a, rounding) simde_mm512_maskz_cvt_roundepi32_ps(k, a, rounding)
 #endif
 
-  return simde__m512i_from_private(r_);
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_cvt_roundpd_ps (simde__m512d a, int rounding)
+    HEDLEY_REQUIRE_MSG((rounding & 15) == rounding, "rounding must be in range [0, 15]") {
+  simde__m256_private r_;
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    if ((rounding & SIMDE_MM_FROUND_CUR_DIRECTION) || !simde_x_sf_isfinite(a_.u64[i], 53, 11)) {
+      r_.f32[i] = HEDLEY_STATIC_CAST(simde_float32, a_.f64[i]);
+    } else {
+      int s, e;
+      const uint64_t m = simde_x_sf_unpack(a_.u64[i], 53, 11, &s, &e);
+      r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, simde_x_sf_round_pack(s, m, e, 0, rounding & 3, 24, 8));
+    }
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cvt_roundpd_ps(a, rounding) _mm512_cvt_roundpd_ps(a, rounding)
 #endif
+#if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
+#  define _mm512_cvt_roundpd_ps(a, rounding) simde_mm512_cvt_roundpd_ps(a, rounding)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_cvt_roundps_pd (simde__m256 a, int sae)
+    HEDLEY_REQUIRE_MSG((sae & 15) == sae, "sae must be in range [0, 15]") {
+  simde__m512d_private r_;
+  simde__m256_private a_ = simde__m256_to_private(a);
+
+  (void) sae;
+
+  /* Every float is exactly representable as a double. */
+  SIMDE__VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    r_.f64[i] = HEDLEY_STATIC_CAST(simde_float64, a_.f32[i]);
+  }
+
+  return simde__m512d_from_private(r_);
 }
+#if defined(SIMDE_AVX512F_NATIVE)
+#  define simde_mm512_cvt_roundps_pd(a, sae) _mm512_cvt_roundps_pd(a, sae)
+#  define simde_mm512_mask_cvt_roundps_pd(src, k, a, sae) _mm512_mask_cvt_roundps_pd(src, k, a, sae)
+#  define simde_mm512_maskz_cvt_roundps_pd(k, a, sae) _mm512_maskz_cvt_roundps_pd(k, a, sae)
+#else
+#  define simde_mm512_mask_cvt_roundps_pd(src, k, a, sae) simde_mm512_mask_mov_pd(src, k, simde_mm512_cvt_roundps_pd(a, sae))
+#  define simde_mm512_maskz_cvt_roundps_pd(k, a, sae) simde_mm512_maskz_mov_pd(k, simde_mm512_cvt_roundps_pd(a, sae))
+#endif
 #if defined(SIMDE_AVX512F_ENABLE_NATIVE_ALIASES)
-#  define _mm512_or_si512(a, b) simde_mm512_or_si512(a, b)
+#  define _mm512_cvt_roundps_pd(a, sae) simde_mm512_cvt_roundps_pd(a, sae)
+#  define _mm512_mask_cvt_roundps_pd(src, k, a, sae) simde_mm512_mask_cvt_roundps_pd(src, k, a, sae)
+#  define _mm512_maskz_cvt_roundps_pd(k, a, sae) simde_mm512_maskz_cvt_roundps_pd(k, a, sae)
 #endif
 
 SIMDE__END_DECLS
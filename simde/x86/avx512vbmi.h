@@ -0,0 +1,335 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__AVX512VBMI_H)
+#  if !defined(SIMDE__AVX512VBMI_H)
+#    define SIMDE__AVX512VBMI_H
+#  endif
+#  include "avx512bw.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AVX512VBMI_NATIVE)
+#    undef SIMDE_AVX512VBMI_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AVX512VBMI) && !defined(SIMDE_AVX512VBMI_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512VBMI_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_AVX512VBMI_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_AVX512VBMI_NEON
+#  endif
+
+#  if defined(SIMDE_AVX512VBMI_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#if !defined(SIMDE_AVX512VBMI_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+  #define SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+#if defined(SIMDE_ARCH_X86_AVX2)
+/* Looks up 32 bytes of the 64-byte table a using bits 0-5 of idx.
+ * pshufb only indexes within a 128-bit lane, so each quarter of the
+ * table is broadcast to both lanes and the four lookups are blended on
+ * bits 4 and 5 of the index. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_permutexvar64_epi8 (simde__m256i idx, simde__m512i a) {
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  const simde__m256i n = simde_mm256_and_si256(idx, simde_mm256_set1_epi8(0x0f));
+  const simde__m256i sel_quarter = simde_mm256_slli_epi16(idx, 3);
+  const simde__m256i sel_half = simde_mm256_slli_epi16(idx, 2);
+
+  const simde__m256i lo = simde_mm256_blendv_epi8(
+    simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(a_.m128i[0]), n),
+    simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(a_.m128i[1]), n),
+    sel_quarter);
+  const simde__m256i hi = simde_mm256_blendv_epi8(
+    simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(a_.m128i[2]), n),
+    simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(a_.m128i[3]), n),
+    sel_quarter);
+
+  return simde_mm256_blendv_epi8(lo, hi, sel_half);
+}
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_multishift_epi64_epi8 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_multishift_epi64_epi8(a, b);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    /* Byte j of each result quadword is the eight bits of b starting at
+     * bit (byte j of a) & 63, wrapping around.  That is the low byte of
+     * b rotated right by that amount, so each byte position costs two
+     * variable shifts instead of a per-bit gather. */
+    #if defined(SIMDE_AVX512VBMI_NEON) && defined(SIMDE_ARCH_AARCH64)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        uint64x2_t r = vdupq_n_u64(0);
+        for (int j = 0 ; j < 64 ; j += 8) {
+          const int64x2_t c = vreinterpretq_s64_u64(vandq_u64(vshlq_u64(a_.m128i_private[i].neon_u64, vdupq_n_s64(-j)), vdupq_n_u64(63)));
+          const uint64x2_t v =
+            vorrq_u64(vshlq_u64(b_.m128i_private[i].neon_u64, vnegq_s64(c)),
+                      vshlq_u64(b_.m128i_private[i].neon_u64, vsubq_s64(vdupq_n_s64(64), c)));
+          r = vorrq_u64(r, vshlq_u64(vandq_u64(v, vdupq_n_u64(0xff)), vdupq_n_s64(j)));
+        }
+        r_.m128i_private[i].neon_u64 = r;
+      }
+    #elif defined(SIMDE_ARCH_X86_AVX2)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        simde__m256i r = simde_mm256_setzero_si256();
+        for (int j = 0 ; j < 64 ; j += 8) {
+          const simde__m256i c = simde_mm256_and_si256(simde_mm256_srlv_epi64(a_.m256i[i], simde_mm256_set1_epi64x(j)), simde_mm256_set1_epi64x(63));
+          const simde__m256i v = simde_mm256_or_si256(
+            simde_mm256_srlv_epi64(b_.m256i[i], c),
+            simde_mm256_sllv_epi64(b_.m256i[i], simde_mm256_sub_epi64(simde_mm256_set1_epi64x(64), c)));
+          r = simde_mm256_or_si256(r, simde_mm256_sllv_epi64(simde_mm256_and_si256(v, simde_mm256_set1_epi64x(0xff)), simde_mm256_set1_epi64x(j)));
+        }
+        r_.m256i[i] = r;
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      __typeof__(r_.u64) r = { 0, };
+      for (int j = 0 ; j < 64 ; j += 8) {
+        const __typeof__(r_.u64) c = (a_.u64 >> j) & 63;
+        r |= (((b_.u64 >> c) | (b_.u64 << ((64 - c) & 63))) & 0xff) << j;
+      }
+      r_.u64 = r;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+        const uint64_t q = b_.u64[i / 8];
+        const unsigned int c = a_.u8[i] & 63;
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (q >> c) | (q << ((64 - c) & 63)));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_multishift_epi64_epi8(a, b) simde_mm512_multishift_epi64_epi8(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_multishift_epi64_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_mask_multishift_epi64_epi8(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi8(src, k, simde_mm512_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_multishift_epi64_epi8(src, k, a, b) simde_mm512_mask_multishift_epi64_epi8(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_multishift_epi64_epi8 (simde__mmask64 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_maskz_multishift_epi64_epi8(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi8(k, simde_mm512_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_multishift_epi64_epi8(k, a, b) simde_mm512_maskz_multishift_epi64_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_permutex2var_epi8 (simde__m512i a, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_permutex2var_epi8(a, idx, b);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    simde__m512i_private
+      r_,
+      idx_ = simde__m512i_to_private(idx);
+
+    /* Look the index up in both tables, then bit 6 picks the source. */
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_blendv_epi8(
+        simde_x_mm256_permutexvar64_epi8(idx_.m256i[i], a),
+        simde_x_mm256_permutexvar64_epi8(idx_.m256i[i], b),
+        simde_mm256_slli_epi16(idx_.m256i[i], 1));
+    }
+
+    return simde__m512i_from_private(r_);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      idx_ = simde__m512i_to_private(idx),
+      b_ = simde__m512i_to_private(b);
+
+    #if defined(SIMDE_AVX512VBMI_NEON) && defined(SIMDE_ARCH_AARCH64)
+      /* Same trick as permutex2var_epi32: vqtbl4q gives 0 for indices
+         64-127, then vqtbx4q fills those in from b. */
+      const uint8x16x4_t
+        table_a = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8,
+                      a_.m128i_private[2].neon_u8, a_.m128i_private[3].neon_u8 } },
+        table_b = { { b_.m128i_private[0].neon_u8, b_.m128i_private[1].neon_u8,
+                      b_.m128i_private[2].neon_u8, b_.m128i_private[3].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        const uint8x16_t ix = vandq_u8(idx_.m128i_private[i].neon_u8, vdupq_n_u8(127));
+        r_.m128i_private[i].neon_u8 = vqtbx4q_u8(vqtbl4q_u8(table_a, ix), table_b, vsubq_u8(ix, vdupq_n_u8(64)));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.u8 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.u8, b_.u8, idx_.u8);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+        r_.u8[i] = (idx_.u8[i] & 64) ? b_.u8[idx_.u8[i] & 63] : a_.u8[idx_.u8[i] & 63];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutex2var_epi8(a, idx, b) simde_mm512_permutex2var_epi8(a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_permutex2var_epi8 (simde__m512i a, simde__mmask64 k, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_mask_permutex2var_epi8(a, k, idx, b);
+  #else
+    return simde_mm512_mask_mov_epi8(a, k, simde_mm512_permutex2var_epi8(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutex2var_epi8(a, k, idx, b) simde_mm512_mask_permutex2var_epi8(a, k, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask2_permutex2var_epi8 (simde__m512i a, simde__m512i idx, simde__mmask64 k, simde__m512i b) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_mask2_permutex2var_epi8(a, idx, k, b);
+  #else
+    return simde_mm512_mask_mov_epi8(idx, k, simde_mm512_permutex2var_epi8(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask2_permutex2var_epi8(a, idx, k, b) simde_mm512_mask2_permutex2var_epi8(a, idx, k, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_permutex2var_epi8 (simde__mmask64 k, simde__m512i a, simde__m512i idx, simde__m512i b) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_maskz_permutex2var_epi8(k, a, idx, b);
+  #else
+    return simde_mm512_maskz_mov_epi8(k, simde_mm512_permutex2var_epi8(a, idx, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutex2var_epi8(k, a, idx, b) simde_mm512_maskz_permutex2var_epi8(k, a, idx, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_permutexvar_epi8 (simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_permutexvar_epi8(idx, a);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    simde__m512i_private
+      r_,
+      idx_ = simde__m512i_to_private(idx);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_x_mm256_permutexvar64_epi8(idx_.m256i[i], a);
+    }
+
+    return simde__m512i_from_private(r_);
+  #else
+    simde__m512i_private
+      r_,
+      idx_ = simde__m512i_to_private(idx),
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_AVX512VBMI_NEON) && defined(SIMDE_ARCH_AARCH64)
+      const uint8x16x4_t table = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8,
+                                     a_.m128i_private[2].neon_u8, a_.m128i_private[3].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u8 = vqtbl4q_u8(table, vandq_u8(idx_.m128i_private[i].neon_u8, vdupq_n_u8(63)));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.u8 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.u8, a_.u8, idx_.u8);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+        r_.u8[i] = a_.u8[idx_.u8[i] & 63];
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_permutexvar_epi8(idx, a) simde_mm512_permutexvar_epi8(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_permutexvar_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_mask_permutexvar_epi8(src, k, idx, a);
+  #else
+    return simde_mm512_mask_mov_epi8(src, k, simde_mm512_permutexvar_epi8(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_permutexvar_epi8(src, k, idx, a) simde_mm512_mask_permutexvar_epi8(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_permutexvar_epi8 (simde__mmask64 k, simde__m512i idx, simde__m512i a) {
+  #if defined(SIMDE_AVX512VBMI_NATIVE)
+    return _mm512_maskz_permutexvar_epi8(k, idx, a);
+  #else
+    return simde_mm512_maskz_mov_epi8(k, simde_mm512_permutexvar_epi8(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_permutexvar_epi8(k, idx, a) simde_mm512_maskz_permutexvar_epi8(k, idx, a)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AVX512VBMI_H) */
@@ -0,0 +1,3946 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+/* AVX-512VL doesn't add any new operations of its own; it allows the
+ * AVX-512F/BW/DQ instructions (masking in particular) to be used on
+ * 128- and 256-bit vectors.  Functions which operate on 8- or 16-bit
+ * elements additionally require AVX-512BW, and the mask <-> vector
+ * conversions for 32- and 64-bit elements require AVX-512DQ. */
+
+#if !defined(SIMDE__AVX512VL_H)
+#  if !defined(SIMDE__AVX512VL_H)
+#    define SIMDE__AVX512VL_H
+#  endif
+#  include "avx512bw.h"
+#  include "avx512dq.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AVX512VL_NATIVE)
+#    undef SIMDE_AVX512VL_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AVX512VL) && !defined(SIMDE_AVX512VL_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512VL_NATIVE
+#  elif defined(SIMDE_AVX512F_NEON) && !defined(SIMDE_AVX512VL_NO_NEON)
+#    define SIMDE_AVX512VL_NEON
+#  endif
+
+#  if defined(SIMDE_AVX512VL_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#if !defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+  #define SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_movm_epi8 (simde__mmask16 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_movm_epi8(k);
+  #else
+    /* Broadcast each byte of the mask to eight bytes, then test one bit
+       in each byte, like simde_mm512_movm_epi8. */
+    const simde__m128i bits = simde_mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, UINT64_C(0x8040201008040201)));
+    const simde__m128i kv = simde_mm_set_epi64x(
+      HEDLEY_STATIC_CAST(int64_t, ((k >> 8) & 0xff) * UINT64_C(0x0101010101010101)),
+      HEDLEY_STATIC_CAST(int64_t, ( k       & 0xff) * UINT64_C(0x0101010101010101)));
+
+    return simde_mm_cmpeq_epi8(simde_mm_and_si128(kv, bits), bits);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movm_epi8(k) simde_mm_movm_epi8(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_movm_epi8 (simde__mmask32 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_movm_epi8(k);
+  #else
+    simde__m256i_private r_;
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_movm_epi8(HEDLEY_STATIC_CAST(simde__mmask16, (k >> (i * 16)) & 0xffff));
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movm_epi8(k) simde_mm256_movm_epi8(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_movm_epi16 (simde__mmask8 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_movm_epi16(k);
+  #else
+    const simde__m128i bits = simde_mm_set_epi16(128, 64, 32, 16, 8, 4, 2, 1);
+
+    return simde_mm_cmpeq_epi16(simde_mm_and_si128(simde_mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, k)), bits), bits);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movm_epi16(k) simde_mm_movm_epi16(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_movm_epi16 (simde__mmask16 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_movm_epi16(k);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    const simde__m256i bits = simde_mm256_set_epi16(
+      HEDLEY_STATIC_CAST(int16_t, UINT16_C(0x8000)), 0x4000, 0x2000, 0x1000, 0x0800, 0x0400, 0x0200, 0x0100,
+      0x0080, 0x0040, 0x0020, 0x0010, 0x0008, 0x0004, 0x0002, 0x0001);
+
+    return simde_mm256_cmpeq_epi16(simde_mm256_and_si256(simde_mm256_set1_epi16(HEDLEY_STATIC_CAST(int16_t, k)), bits), bits);
+  #else
+    simde__m256i_private r_;
+
+    r_.m128i[0] = simde_mm_movm_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k & 0xff));
+    r_.m128i[1] = simde_mm_movm_epi16(HEDLEY_STATIC_CAST(simde__mmask8, (k >> 8) & 0xff));
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movm_epi16(k) simde_mm256_movm_epi16(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_movm_epi32 (simde__mmask8 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm_movm_epi32(k);
+  #else
+    const simde__m128i bits = simde_mm_set_epi32(8, 4, 2, 1);
+
+    return simde_mm_cmpeq_epi32(simde_mm_and_si128(simde_mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k)), bits), bits);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movm_epi32(k) simde_mm_movm_epi32(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_movm_epi32 (simde__mmask8 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm256_movm_epi32(k);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    const simde__m256i bits = simde_mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+
+    return simde_mm256_cmpeq_epi32(simde_mm256_and_si256(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k)), bits), bits);
+  #else
+    simde__m256i_private r_;
+
+    r_.m128i[0] = simde_mm_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k & 0x0f));
+    r_.m128i[1] = simde_mm_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, (k >> 4) & 0x0f));
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movm_epi32(k) simde_mm256_movm_epi32(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_movm_epi64 (simde__mmask8 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm_movm_epi64(k);
+  #else
+    const simde__m128i bits = simde_mm_set_epi64x(2, 1);
+
+    return simde_mm_cmpeq_epi64(simde_mm_and_si128(simde_mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, k)), bits), bits);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movm_epi64(k) simde_mm_movm_epi64(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_movm_epi64 (simde__mmask8 k) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm256_movm_epi64(k);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    const simde__m256i bits = simde_mm256_set_epi64x(8, 4, 2, 1);
+
+    return simde_mm256_cmpeq_epi64(simde_mm256_and_si256(simde_mm256_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, k)), bits), bits);
+  #else
+    simde__m256i_private r_;
+
+    r_.m128i[0] = simde_mm_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k & 0x03));
+    r_.m128i[1] = simde_mm_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, (k >> 2) & 0x03));
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movm_epi64(k) simde_mm256_movm_epi64(k)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm_movepi8_mask (simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_movepi8_mask(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_movemask_epi8(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movepi8_mask(a) simde_mm_movepi8_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm256_movepi8_mask (simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_movepi8_mask(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, HEDLEY_STATIC_CAST(uint32_t, simde_mm256_movemask_epi8(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movepi8_mask(a) simde_mm256_movepi8_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_movepi16_mask (simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_movepi16_mask(a);
+  #else
+    /* Saturating to 8 bits keeps the sign, and movemask only looks at
+       the sign. */
+    return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_epi8(simde_mm_packs_epi16(a, simde_mm_setzero_si128())));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movepi16_mask(a) simde_mm_movepi16_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm256_movepi16_mask (simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_movepi16_mask(a);
+  #else
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_movemask_epi8(simde_mm_packs_epi16(a_.m128i[0], a_.m128i[1])));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movepi16_mask(a) simde_mm256_movepi16_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_movepi32_mask (simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm_movepi32_mask(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_ps(simde_mm_castsi128_ps(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movepi32_mask(a) simde_mm_movepi32_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_movepi32_mask (simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm256_movepi32_mask(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_movemask_ps(simde_mm256_castsi256_ps(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movepi32_mask(a) simde_mm256_movepi32_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_movepi64_mask (simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm_movepi64_mask(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_pd(simde_mm_castsi128_pd(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_movepi64_mask(a) simde_mm_movepi64_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_movepi64_mask (simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512DQ_NATIVE)
+    return _mm256_movepi64_mask(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_movemask_pd(simde_mm256_castsi256_pd(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_movepi64_mask(a) simde_mm256_movepi64_mask(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_mov_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_mov_epi8(src, k, a);
+  #else
+    return simde_mm_blendv_epi8(src, a, simde_mm_movm_epi8(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mov_epi8(src, k, a) simde_mm_mask_mov_epi8(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_mov_epi8 (simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_mov_epi8(k, a);
+  #else
+    return simde_mm_and_si128(a, simde_mm_movm_epi8(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mov_epi8(k, a) simde_mm_maskz_mov_epi8(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_mov_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_mov_epi8(src, k, a);
+  #else
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi8(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mov_epi8(src, k, a) simde_mm256_mask_mov_epi8(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_mov_epi8 (simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_mov_epi8(k, a);
+  #else
+    return simde_mm256_and_si256(a, simde_mm256_movm_epi8(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mov_epi8(k, a) simde_mm256_maskz_mov_epi8(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_mov_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_mov_epi16(src, k, a);
+  #else
+    return simde_mm_blendv_epi8(src, a, simde_mm_movm_epi16(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mov_epi16(src, k, a) simde_mm_mask_mov_epi16(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_mov_epi16 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_mov_epi16(k, a);
+  #else
+    return simde_mm_and_si128(a, simde_mm_movm_epi16(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mov_epi16(k, a) simde_mm_maskz_mov_epi16(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_mov_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_mov_epi16(src, k, a);
+  #else
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi16(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mov_epi16(src, k, a) simde_mm256_mask_mov_epi16(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_mov_epi16 (simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_mov_epi16(k, a);
+  #else
+    return simde_mm256_and_si256(a, simde_mm256_movm_epi16(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mov_epi16(k, a) simde_mm256_maskz_mov_epi16(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_mov_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_mov_epi32(src, k, a);
+  #else
+    return simde_mm_blendv_epi8(src, a, simde_mm_movm_epi32(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mov_epi32(src, k, a) simde_mm_mask_mov_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_mov_epi32 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_mov_epi32(k, a);
+  #else
+    return simde_mm_and_si128(a, simde_mm_movm_epi32(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mov_epi32(k, a) simde_mm_maskz_mov_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_mov_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_mov_epi32(src, k, a);
+  #else
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi32(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mov_epi32(src, k, a) simde_mm256_mask_mov_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_mov_epi32 (simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_mov_epi32(k, a);
+  #else
+    return simde_mm256_and_si256(a, simde_mm256_movm_epi32(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mov_epi32(k, a) simde_mm256_maskz_mov_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_mov_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_mov_epi64(src, k, a);
+  #else
+    return simde_mm_blendv_epi8(src, a, simde_mm_movm_epi64(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mov_epi64(src, k, a) simde_mm_mask_mov_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_mov_epi64 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_mov_epi64(k, a);
+  #else
+    return simde_mm_and_si128(a, simde_mm_movm_epi64(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mov_epi64(k, a) simde_mm_maskz_mov_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_mov_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_mov_epi64(src, k, a);
+  #else
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi64(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mov_epi64(src, k, a) simde_mm256_mask_mov_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_mov_epi64 (simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_mov_epi64(k, a);
+  #else
+    return simde_mm256_and_si256(a, simde_mm256_movm_epi64(k));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mov_epi64(k, a) simde_mm256_maskz_mov_epi64(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_mov_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_mov_ps(src, k, a);
+  #else
+    return simde_mm_castsi128_ps(simde_mm_mask_mov_epi32(simde_mm_castps_si128(src), k, simde_mm_castps_si128(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mov_ps(src, k, a) simde_mm_mask_mov_ps(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_mov_ps (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_mov_ps(k, a);
+  #else
+    return simde_mm_castsi128_ps(simde_mm_maskz_mov_epi32(k, simde_mm_castps_si128(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mov_ps(k, a) simde_mm_maskz_mov_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_mov_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_mov_ps(src, k, a);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_mask_mov_epi32(simde_mm256_castps_si256(src), k, simde_mm256_castps_si256(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mov_ps(src, k, a) simde_mm256_mask_mov_ps(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_mov_ps (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_mov_ps(k, a);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_maskz_mov_epi32(k, simde_mm256_castps_si256(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mov_ps(k, a) simde_mm256_maskz_mov_ps(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_mov_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_mov_pd(src, k, a);
+  #else
+    return simde_mm_castsi128_pd(simde_mm_mask_mov_epi64(simde_mm_castpd_si128(src), k, simde_mm_castpd_si128(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mov_pd(src, k, a) simde_mm_mask_mov_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_mov_pd (simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_mov_pd(k, a);
+  #else
+    return simde_mm_castsi128_pd(simde_mm_maskz_mov_epi64(k, simde_mm_castpd_si128(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mov_pd(k, a) simde_mm_maskz_mov_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_mov_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_mov_pd(src, k, a);
+  #else
+    return simde_mm256_castsi256_pd(simde_mm256_mask_mov_epi64(simde_mm256_castpd_si256(src), k, simde_mm256_castpd_si256(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mov_pd(src, k, a) simde_mm256_mask_mov_pd(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_mov_pd (simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_mov_pd(k, a);
+  #else
+    return simde_mm256_castsi256_pd(simde_mm256_maskz_mov_epi64(k, simde_mm256_castpd_si256(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mov_pd(k, a) simde_mm256_maskz_mov_pd(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_loadu_epi8 (simde__m128i src, simde__mmask16 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_loadu_epi8(src, k, mem_addr);
+  #else
+    simde__m128i_private r_ = simde__m128i_to_private(src);
+
+    /* Only read the selected elements; the masked-off ones may well be
+       past the end of the buffer (that's usually the point of using a
+       masked load), and the native instruction doesn't fault on them. */
+    for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int8_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i8[i] = v;
+      }
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_loadu_epi8(src, k, mem_addr) simde_mm_mask_loadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_loadu_epi8 (simde__mmask16 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_loadu_epi8(k, mem_addr);
+  #else
+    return simde_mm_mask_loadu_epi8(simde_mm_setzero_si128(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_loadu_epi8(k, mem_addr) simde_mm_maskz_loadu_epi8(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_loadu_epi8 (simde__m256i src, simde__mmask32 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_loadu_epi8(src, k, mem_addr);
+  #else
+    simde__m256i_private r_ = simde__m256i_to_private(src);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int8_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i8[i] = v;
+      }
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_loadu_epi8(src, k, mem_addr) simde_mm256_mask_loadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_loadu_epi8 (simde__mmask32 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_loadu_epi8(k, mem_addr);
+  #else
+    return simde_mm256_mask_loadu_epi8(simde_mm256_setzero_si256(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_loadu_epi8(k, mem_addr) simde_mm256_maskz_loadu_epi8(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_loadu_epi16 (simde__m128i src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_loadu_epi16(src, k, mem_addr);
+  #else
+    simde__m128i_private r_ = simde__m128i_to_private(src);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int16_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i16[i] = v;
+      }
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_loadu_epi16(src, k, mem_addr) simde_mm_mask_loadu_epi16(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_loadu_epi16 (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_loadu_epi16(k, mem_addr);
+  #else
+    return simde_mm_mask_loadu_epi16(simde_mm_setzero_si128(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_loadu_epi16(k, mem_addr) simde_mm_maskz_loadu_epi16(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_loadu_epi16 (simde__m256i src, simde__mmask16 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_loadu_epi16(src, k, mem_addr);
+  #else
+    simde__m256i_private r_ = simde__m256i_to_private(src);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int16_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i16[i] = v;
+      }
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_loadu_epi16(src, k, mem_addr) simde_mm256_mask_loadu_epi16(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_loadu_epi16 (simde__mmask16 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_loadu_epi16(k, mem_addr);
+  #else
+    return simde_mm256_mask_loadu_epi16(simde_mm256_setzero_si256(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_loadu_epi16(k, mem_addr) simde_mm256_maskz_loadu_epi16(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_loadu_epi32 (simde__m128i src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_loadu_epi32(src, k, mem_addr);
+  #elif defined(SIMDE_AVX_NATIVE)
+    const __m128 mask = _mm_castsi128_ps(simde_mm_movm_epi32(k));
+    return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(src), _mm_maskload_ps(HEDLEY_REINTERPRET_CAST(float const*, mem_addr), _mm_castps_si128(mask)), mask));
+  #else
+    simde__m128i_private r_ = simde__m128i_to_private(src);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int32_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i32[i] = v;
+      }
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_loadu_epi32(src, k, mem_addr) simde_mm_mask_loadu_epi32(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_loadu_epi32 (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_loadu_epi32(k, mem_addr);
+  #else
+    return simde_mm_mask_loadu_epi32(simde_mm_setzero_si128(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_loadu_epi32(k, mem_addr) simde_mm_maskz_loadu_epi32(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_loadu_epi32 (simde__m256i src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_loadu_epi32(src, k, mem_addr);
+  #elif defined(SIMDE_AVX_NATIVE)
+    const __m256 mask = _mm256_castsi256_ps(simde_mm256_movm_epi32(k));
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(src), _mm256_maskload_ps(HEDLEY_REINTERPRET_CAST(float const*, mem_addr), _mm256_castps_si256(mask)), mask));
+  #else
+    simde__m256i_private r_ = simde__m256i_to_private(src);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int32_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i32[i] = v;
+      }
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_loadu_epi32(src, k, mem_addr) simde_mm256_mask_loadu_epi32(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_loadu_epi32 (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_loadu_epi32(k, mem_addr);
+  #else
+    return simde_mm256_mask_loadu_epi32(simde_mm256_setzero_si256(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_loadu_epi32(k, mem_addr) simde_mm256_maskz_loadu_epi32(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_loadu_epi64 (simde__m128i src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_loadu_epi64(src, k, mem_addr);
+  #elif defined(SIMDE_AVX_NATIVE)
+    const __m128d mask = _mm_castsi128_pd(simde_mm_movm_epi64(k));
+    return _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(src), _mm_maskload_pd(HEDLEY_REINTERPRET_CAST(double const*, mem_addr), _mm_castpd_si128(mask)), mask));
+  #else
+    simde__m128i_private r_ = simde__m128i_to_private(src);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int64_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i64[i] = v;
+      }
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_loadu_epi64(src, k, mem_addr) simde_mm_mask_loadu_epi64(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_loadu_epi64 (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_loadu_epi64(k, mem_addr);
+  #else
+    return simde_mm_mask_loadu_epi64(simde_mm_setzero_si128(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_loadu_epi64(k, mem_addr) simde_mm_maskz_loadu_epi64(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_loadu_epi64 (simde__m256i src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_loadu_epi64(src, k, mem_addr);
+  #elif defined(SIMDE_AVX_NATIVE)
+    const __m256d mask = _mm256_castsi256_pd(simde_mm256_movm_epi64(k));
+    return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(src), _mm256_maskload_pd(HEDLEY_REINTERPRET_CAST(double const*, mem_addr), _mm256_castpd_si256(mask)), mask));
+  #else
+    simde__m256i_private r_ = simde__m256i_to_private(src);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      if ((k >> i) & 1) {
+        int64_t v;
+        simde_memcpy(&v, HEDLEY_REINTERPRET_CAST(const char*, mem_addr) + (i * sizeof(v)), sizeof(v));
+        r_.i64[i] = v;
+      }
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_loadu_epi64(src, k, mem_addr) simde_mm256_mask_loadu_epi64(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_loadu_epi64 (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_loadu_epi64(k, mem_addr);
+  #else
+    return simde_mm256_mask_loadu_epi64(simde_mm256_setzero_si256(), k, mem_addr);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_loadu_epi64(k, mem_addr) simde_mm256_maskz_loadu_epi64(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_loadu_ps (simde__m128 src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_loadu_ps(src, k, mem_addr);
+  #else
+    return simde_mm_castsi128_ps(simde_mm_mask_loadu_epi32(simde_mm_castps_si128(src), k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_loadu_ps(src, k, mem_addr) simde_mm_mask_loadu_ps(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_loadu_ps (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_loadu_ps(k, mem_addr);
+  #else
+    return simde_mm_castsi128_ps(simde_mm_maskz_loadu_epi32(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_loadu_ps(k, mem_addr) simde_mm_maskz_loadu_ps(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_loadu_ps (simde__m256 src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_loadu_ps(src, k, mem_addr);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_mask_loadu_epi32(simde_mm256_castps_si256(src), k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_loadu_ps(src, k, mem_addr) simde_mm256_mask_loadu_ps(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_loadu_ps (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_loadu_ps(k, mem_addr);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_maskz_loadu_epi32(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_loadu_ps(k, mem_addr) simde_mm256_maskz_loadu_ps(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_loadu_pd (simde__m128d src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_loadu_pd(src, k, mem_addr);
+  #else
+    return simde_mm_castsi128_pd(simde_mm_mask_loadu_epi64(simde_mm_castpd_si128(src), k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_loadu_pd(src, k, mem_addr) simde_mm_mask_loadu_pd(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_loadu_pd (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_loadu_pd(k, mem_addr);
+  #else
+    return simde_mm_castsi128_pd(simde_mm_maskz_loadu_epi64(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_loadu_pd(k, mem_addr) simde_mm_maskz_loadu_pd(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_loadu_pd (simde__m256d src, simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_loadu_pd(src, k, mem_addr);
+  #else
+    return simde_mm256_castsi256_pd(simde_mm256_mask_loadu_epi64(simde_mm256_castpd_si256(src), k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_loadu_pd(src, k, mem_addr) simde_mm256_mask_loadu_pd(src, k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_loadu_pd (simde__mmask8 k, void const * mem_addr) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_loadu_pd(k, mem_addr);
+  #else
+    return simde_mm256_castsi256_pd(simde_mm256_maskz_loadu_epi64(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_loadu_pd(k, mem_addr) simde_mm256_maskz_loadu_pd(k, mem_addr)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_storeu_epi8 (void * mem_addr, simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    _mm_mask_storeu_epi8(mem_addr, k, a);
+  #else
+    simde__m128i_private a_ = simde__m128i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i8) / sizeof(a_.i8[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int8_t v = a_.i8[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_storeu_epi8(mem_addr, k, a) simde_mm_mask_storeu_epi8(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_storeu_epi8 (void * mem_addr, simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    _mm256_mask_storeu_epi8(mem_addr, k, a);
+  #else
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i8) / sizeof(a_.i8[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int8_t v = a_.i8[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_storeu_epi8(mem_addr, k, a) simde_mm256_mask_storeu_epi8(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_storeu_epi16 (void * mem_addr, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    _mm_mask_storeu_epi16(mem_addr, k, a);
+  #else
+    simde__m128i_private a_ = simde__m128i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i16) / sizeof(a_.i16[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int16_t v = a_.i16[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_storeu_epi16(mem_addr, k, a) simde_mm_mask_storeu_epi16(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_storeu_epi16 (void * mem_addr, simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    _mm256_mask_storeu_epi16(mem_addr, k, a);
+  #else
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i16) / sizeof(a_.i16[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int16_t v = a_.i16[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_storeu_epi16(mem_addr, k, a) simde_mm256_mask_storeu_epi16(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_storeu_epi32 (void * mem_addr, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm_mask_storeu_epi32(mem_addr, k, a);
+  #elif defined(SIMDE_AVX_NATIVE)
+    _mm_maskstore_ps(HEDLEY_REINTERPRET_CAST(float*, mem_addr), simde_mm_movm_epi32(k), _mm_castsi128_ps(a));
+  #else
+    simde__m128i_private a_ = simde__m128i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int32_t v = a_.i32[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_storeu_epi32(mem_addr, k, a) simde_mm_mask_storeu_epi32(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_storeu_epi32 (void * mem_addr, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm256_mask_storeu_epi32(mem_addr, k, a);
+  #elif defined(SIMDE_AVX_NATIVE)
+    _mm256_maskstore_ps(HEDLEY_REINTERPRET_CAST(float*, mem_addr), simde_mm256_movm_epi32(k), _mm256_castsi256_ps(a));
+  #else
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int32_t v = a_.i32[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_storeu_epi32(mem_addr, k, a) simde_mm256_mask_storeu_epi32(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_storeu_epi64 (void * mem_addr, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm_mask_storeu_epi64(mem_addr, k, a);
+  #elif defined(SIMDE_AVX_NATIVE)
+    _mm_maskstore_pd(HEDLEY_REINTERPRET_CAST(double*, mem_addr), simde_mm_movm_epi64(k), _mm_castsi128_pd(a));
+  #else
+    simde__m128i_private a_ = simde__m128i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int64_t v = a_.i64[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_storeu_epi64(mem_addr, k, a) simde_mm_mask_storeu_epi64(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_storeu_epi64 (void * mem_addr, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm256_mask_storeu_epi64(mem_addr, k, a);
+  #elif defined(SIMDE_AVX_NATIVE)
+    _mm256_maskstore_pd(HEDLEY_REINTERPRET_CAST(double*, mem_addr), simde_mm256_movm_epi64(k), _mm256_castsi256_pd(a));
+  #else
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+      if ((k >> i) & 1) {
+        const int64_t v = a_.i64[i];
+        simde_memcpy(HEDLEY_REINTERPRET_CAST(char*, mem_addr) + (i * sizeof(v)), &v, sizeof(v));
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_storeu_epi64(mem_addr, k, a) simde_mm256_mask_storeu_epi64(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_storeu_ps (void * mem_addr, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm_mask_storeu_ps(mem_addr, k, a);
+  #else
+    simde_mm_mask_storeu_epi32(mem_addr, k, simde_mm_castps_si128(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_storeu_ps(mem_addr, k, a) simde_mm_mask_storeu_ps(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_storeu_ps (void * mem_addr, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm256_mask_storeu_ps(mem_addr, k, a);
+  #else
+    simde_mm256_mask_storeu_epi32(mem_addr, k, simde_mm256_castps_si256(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_storeu_ps(mem_addr, k, a) simde_mm256_mask_storeu_ps(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_storeu_pd (void * mem_addr, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm_mask_storeu_pd(mem_addr, k, a);
+  #else
+    simde_mm_mask_storeu_epi64(mem_addr, k, simde_mm_castpd_si128(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_storeu_pd(mem_addr, k, a) simde_mm_mask_storeu_pd(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_storeu_pd (void * mem_addr, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    _mm256_mask_storeu_pd(mem_addr, k, a);
+  #else
+    simde_mm256_mask_storeu_epi64(mem_addr, k, simde_mm256_castpd_si256(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_storeu_pd(mem_addr, k, a) simde_mm256_mask_storeu_pd(mem_addr, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_add_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_add_epi8(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi8(src, k, simde_mm_add_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_add_epi8(src, k, a, b) simde_mm_mask_add_epi8(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_add_epi8 (simde__mmask16 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_add_epi8(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi8(k, simde_mm_add_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_add_epi8(k, a, b) simde_mm_maskz_add_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_add_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_add_epi8(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi8(src, k, simde_mm256_add_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_add_epi8(src, k, a, b) simde_mm256_mask_add_epi8(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_add_epi8 (simde__mmask32 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_add_epi8(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi8(k, simde_mm256_add_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_add_epi8(k, a, b) simde_mm256_maskz_add_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_add_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_add_epi16(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi16(src, k, simde_mm_add_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_add_epi16(src, k, a, b) simde_mm_mask_add_epi16(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_add_epi16 (simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_add_epi16(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi16(k, simde_mm_add_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_add_epi16(k, a, b) simde_mm_maskz_add_epi16(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_add_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_add_epi16(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi16(src, k, simde_mm256_add_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_add_epi16(src, k, a, b) simde_mm256_mask_add_epi16(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_add_epi16 (simde__mmask16 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_add_epi16(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi16(k, simde_mm256_add_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_add_epi16(k, a, b) simde_mm256_maskz_add_epi16(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_add_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_add_epi32(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi32(src, k, simde_mm_add_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_add_epi32(src, k, a, b) simde_mm_mask_add_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_add_epi32 (simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_add_epi32(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_add_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_add_epi32(k, a, b) simde_mm_maskz_add_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_add_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_add_epi32(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_add_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_add_epi32(src, k, a, b) simde_mm256_mask_add_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_add_epi32 (simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_add_epi32(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_add_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_add_epi32(k, a, b) simde_mm256_maskz_add_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_add_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_add_epi64(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi64(src, k, simde_mm_add_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_add_epi64(src, k, a, b) simde_mm_mask_add_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_add_epi64 (simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_add_epi64(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_add_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_add_epi64(k, a, b) simde_mm_maskz_add_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_add_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_add_epi64(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi64(src, k, simde_mm256_add_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_add_epi64(src, k, a, b) simde_mm256_mask_add_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_add_epi64 (simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_add_epi64(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_add_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_add_epi64(k, a, b) simde_mm256_maskz_add_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_sub_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_sub_epi8(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi8(src, k, simde_mm_sub_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_sub_epi8(src, k, a, b) simde_mm_mask_sub_epi8(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_sub_epi8 (simde__mmask16 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_sub_epi8(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi8(k, simde_mm_sub_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_sub_epi8(k, a, b) simde_mm_maskz_sub_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_sub_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_sub_epi8(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi8(src, k, simde_mm256_sub_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_sub_epi8(src, k, a, b) simde_mm256_mask_sub_epi8(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_sub_epi8 (simde__mmask32 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_sub_epi8(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi8(k, simde_mm256_sub_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_sub_epi8(k, a, b) simde_mm256_maskz_sub_epi8(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_sub_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_sub_epi16(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi16(src, k, simde_mm_sub_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_sub_epi16(src, k, a, b) simde_mm_mask_sub_epi16(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_sub_epi16 (simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_sub_epi16(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi16(k, simde_mm_sub_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_sub_epi16(k, a, b) simde_mm_maskz_sub_epi16(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_sub_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_sub_epi16(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi16(src, k, simde_mm256_sub_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_sub_epi16(src, k, a, b) simde_mm256_mask_sub_epi16(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_sub_epi16 (simde__mmask16 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_sub_epi16(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi16(k, simde_mm256_sub_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_sub_epi16(k, a, b) simde_mm256_maskz_sub_epi16(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_sub_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_sub_epi32(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi32(src, k, simde_mm_sub_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_sub_epi32(src, k, a, b) simde_mm_mask_sub_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_sub_epi32 (simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_sub_epi32(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_sub_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_sub_epi32(k, a, b) simde_mm_maskz_sub_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_sub_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_sub_epi32(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_sub_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_sub_epi32(src, k, a, b) simde_mm256_mask_sub_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_sub_epi32 (simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_sub_epi32(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_sub_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_sub_epi32(k, a, b) simde_mm256_maskz_sub_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_sub_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_sub_epi64(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi64(src, k, simde_mm_sub_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_sub_epi64(src, k, a, b) simde_mm_mask_sub_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_sub_epi64 (simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_sub_epi64(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_sub_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_sub_epi64(k, a, b) simde_mm_maskz_sub_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_sub_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_sub_epi64(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi64(src, k, simde_mm256_sub_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_sub_epi64(src, k, a, b) simde_mm256_mask_sub_epi64(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_sub_epi64 (simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_sub_epi64(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_sub_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_sub_epi64(k, a, b) simde_mm256_maskz_sub_epi64(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_mullo_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_mullo_epi32(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi32(src, k, simde_mm_mullo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mullo_epi32(src, k, a, b) simde_mm_mask_mullo_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_mullo_epi32 (simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_mullo_epi32(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_mullo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mullo_epi32(k, a, b) simde_mm_maskz_mullo_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_mullo_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_mullo_epi32(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_mullo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mullo_epi32(src, k, a, b) simde_mm256_mask_mullo_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_mullo_epi32 (simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_mullo_epi32(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_mullo_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mullo_epi32(k, a, b) simde_mm256_maskz_mullo_epi32(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_add_ps (simde__m128 src, simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_add_ps(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_add_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_add_ps(src, k, a, b) simde_mm_mask_add_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_add_ps (simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_add_ps(k, a, b);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_add_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_add_ps(k, a, b) simde_mm_maskz_add_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_add_ps (simde__m256 src, simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_add_ps(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_add_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_add_ps(src, k, a, b) simde_mm256_mask_add_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_add_ps (simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_add_ps(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_add_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_add_ps(k, a, b) simde_mm256_maskz_add_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_add_pd (simde__m128d src, simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_add_pd(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_add_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_add_pd(src, k, a, b) simde_mm_mask_add_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_add_pd (simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_add_pd(k, a, b);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_add_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_add_pd(k, a, b) simde_mm_maskz_add_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_add_pd (simde__m256d src, simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_add_pd(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_add_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_add_pd(src, k, a, b) simde_mm256_mask_add_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_add_pd (simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_add_pd(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_add_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_add_pd(k, a, b) simde_mm256_maskz_add_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_sub_ps (simde__m128 src, simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_sub_ps(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_sub_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_sub_ps(src, k, a, b) simde_mm_mask_sub_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_sub_ps (simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_sub_ps(k, a, b);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_sub_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_sub_ps(k, a, b) simde_mm_maskz_sub_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_sub_ps (simde__m256 src, simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_sub_ps(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_sub_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_sub_ps(src, k, a, b) simde_mm256_mask_sub_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_sub_ps (simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_sub_ps(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_sub_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_sub_ps(k, a, b) simde_mm256_maskz_sub_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_sub_pd (simde__m128d src, simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_sub_pd(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_sub_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_sub_pd(src, k, a, b) simde_mm_mask_sub_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_sub_pd (simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_sub_pd(k, a, b);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_sub_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_sub_pd(k, a, b) simde_mm_maskz_sub_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_sub_pd (simde__m256d src, simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_sub_pd(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_sub_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_sub_pd(src, k, a, b) simde_mm256_mask_sub_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_sub_pd (simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_sub_pd(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_sub_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_sub_pd(k, a, b) simde_mm256_maskz_sub_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_mul_ps (simde__m128 src, simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_mul_ps(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_mul_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mul_ps(src, k, a, b) simde_mm_mask_mul_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_mul_ps (simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_mul_ps(k, a, b);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_mul_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mul_ps(k, a, b) simde_mm_maskz_mul_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_mul_ps (simde__m256 src, simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_mul_ps(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_mul_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mul_ps(src, k, a, b) simde_mm256_mask_mul_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_mul_ps (simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_mul_ps(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_mul_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mul_ps(k, a, b) simde_mm256_maskz_mul_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_mul_pd (simde__m128d src, simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_mul_pd(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_mul_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_mul_pd(src, k, a, b) simde_mm_mask_mul_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_mul_pd (simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_mul_pd(k, a, b);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_mul_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_mul_pd(k, a, b) simde_mm_maskz_mul_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_mul_pd (simde__m256d src, simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_mul_pd(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_mul_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_mul_pd(src, k, a, b) simde_mm256_mask_mul_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_mul_pd (simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_mul_pd(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_mul_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_mul_pd(k, a, b) simde_mm256_maskz_mul_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_div_ps (simde__m128 src, simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_div_ps(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_div_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_div_ps(src, k, a, b) simde_mm_mask_div_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_div_ps (simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_div_ps(k, a, b);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_div_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_div_ps(k, a, b) simde_mm_maskz_div_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_div_ps (simde__m256 src, simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_div_ps(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_div_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_div_ps(src, k, a, b) simde_mm256_mask_div_ps(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_div_ps (simde__mmask8 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_div_ps(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_div_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_div_ps(k, a, b) simde_mm256_maskz_div_ps(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_div_pd (simde__m128d src, simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_div_pd(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_div_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_div_pd(src, k, a, b) simde_mm_mask_div_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_div_pd (simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_div_pd(k, a, b);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_div_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_div_pd(k, a, b) simde_mm_maskz_div_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_div_pd (simde__m256d src, simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_div_pd(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_div_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_div_pd(src, k, a, b) simde_mm256_mask_div_pd(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_div_pd (simde__mmask8 k, simde__m256d a, simde__m256d b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_div_pd(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_div_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_div_pd(k, a, b) simde_mm256_maskz_div_pd(k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm_cmpeq_epi8_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_cmpeq_epi8_mask(a, b);
+  #else
+    return simde_mm_movepi8_mask(simde_mm_cmpeq_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpeq_epi8_mask(a, b) simde_mm_cmpeq_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm256_cmpeq_epi8_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_cmpeq_epi8_mask(a, b);
+  #else
+    return simde_mm256_movepi8_mask(simde_mm256_cmpeq_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpeq_epi8_mask(a, b) simde_mm256_cmpeq_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmpeq_epi16_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_cmpeq_epi16_mask(a, b);
+  #else
+    return simde_mm_movepi16_mask(simde_mm_cmpeq_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpeq_epi16_mask(a, b) simde_mm_cmpeq_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm256_cmpeq_epi16_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_cmpeq_epi16_mask(a, b);
+  #else
+    return simde_mm256_movepi16_mask(simde_mm256_cmpeq_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpeq_epi16_mask(a, b) simde_mm256_cmpeq_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmpeq_epi32_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_cmpeq_epi32_mask(a, b);
+  #else
+    return simde_mm_movepi32_mask(simde_mm_cmpeq_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpeq_epi32_mask(a, b) simde_mm_cmpeq_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmpeq_epi32_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_cmpeq_epi32_mask(a, b);
+  #else
+    return simde_mm256_movepi32_mask(simde_mm256_cmpeq_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpeq_epi32_mask(a, b) simde_mm256_cmpeq_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmpeq_epi64_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_cmpeq_epi64_mask(a, b);
+  #else
+    return simde_mm_movepi64_mask(simde_mm_cmpeq_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpeq_epi64_mask(a, b) simde_mm_cmpeq_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmpeq_epi64_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_cmpeq_epi64_mask(a, b);
+  #else
+    return simde_mm256_movepi64_mask(simde_mm256_cmpeq_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpeq_epi64_mask(a, b) simde_mm256_cmpeq_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm_cmpgt_epi8_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_cmpgt_epi8_mask(a, b);
+  #else
+    return simde_mm_movepi8_mask(simde_mm_cmpgt_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpgt_epi8_mask(a, b) simde_mm_cmpgt_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm256_cmpgt_epi8_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_cmpgt_epi8_mask(a, b);
+  #else
+    return simde_mm256_movepi8_mask(simde_mm256_cmpgt_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpgt_epi8_mask(a, b) simde_mm256_cmpgt_epi8_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmpgt_epi16_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_cmpgt_epi16_mask(a, b);
+  #else
+    return simde_mm_movepi16_mask(simde_mm_cmpgt_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpgt_epi16_mask(a, b) simde_mm_cmpgt_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm256_cmpgt_epi16_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_cmpgt_epi16_mask(a, b);
+  #else
+    return simde_mm256_movepi16_mask(simde_mm256_cmpgt_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpgt_epi16_mask(a, b) simde_mm256_cmpgt_epi16_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmpgt_epi32_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_cmpgt_epi32_mask(a, b);
+  #else
+    return simde_mm_movepi32_mask(simde_mm_cmpgt_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpgt_epi32_mask(a, b) simde_mm_cmpgt_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmpgt_epi32_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_cmpgt_epi32_mask(a, b);
+  #else
+    return simde_mm256_movepi32_mask(simde_mm256_cmpgt_epi32(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpgt_epi32_mask(a, b) simde_mm256_cmpgt_epi32_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmpgt_epi64_mask (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_cmpgt_epi64_mask(a, b);
+  #else
+    return simde_mm_movepi64_mask(simde_mm_cmpgt_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmpgt_epi64_mask(a, b) simde_mm_cmpgt_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmpgt_epi64_mask (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_cmpgt_epi64_mask(a, b);
+  #else
+    return simde_mm256_movepi64_mask(simde_mm256_cmpgt_epi64(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmpgt_epi64_mask(a, b) simde_mm256_cmpgt_epi64_mask(a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm_cmp_epi8_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi8_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_cmpgt_epi8_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_cmpeq_epi8_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_cmpgt_epi8_mask(b, a) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT16_C(0xffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm_cmp_epi8_mask(a, b, imm8) _mm_cmp_epi8_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epi8_mask(k1, a, b, imm8) _mm_mask_cmp_epi8_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epi8_mask(k1, a, b, imm8) (simde_mm_cmp_epi8_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epi8_mask(a, b, imm8) simde_mm_cmp_epi8_mask(a, b, imm8)
+#  define _mm_mask_cmp_epi8_mask(k1, a, b, imm8) simde_mm_mask_cmp_epi8_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm256_cmp_epi8_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi8_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask32, simde_mm256_cmpgt_epi8_mask(a, b) ^ UINT32_C(0xffffffff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask32, simde_mm256_cmpeq_epi8_mask(a, b) ^ UINT32_C(0xffffffff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask32, simde_mm256_cmpgt_epi8_mask(b, a) ^ UINT32_C(0xffffffff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT32_C(0xffffffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm256_cmp_epi8_mask(a, b, imm8) _mm256_cmp_epi8_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epi8_mask(k1, a, b, imm8) _mm256_mask_cmp_epi8_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epi8_mask(k1, a, b, imm8) (simde_mm256_cmp_epi8_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epi8_mask(a, b, imm8) simde_mm256_cmp_epi8_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epi8_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epi8_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_epi16_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi16_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi16_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpeq_epi16_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi16_mask(b, a) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0xff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm_cmp_epi16_mask(a, b, imm8) _mm_cmp_epi16_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epi16_mask(k1, a, b, imm8) _mm_mask_cmp_epi16_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epi16_mask(k1, a, b, imm8) (simde_mm_cmp_epi16_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epi16_mask(a, b, imm8) simde_mm_cmp_epi16_mask(a, b, imm8)
+#  define _mm_mask_cmp_epi16_mask(k1, a, b, imm8) simde_mm_mask_cmp_epi16_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm256_cmp_epi16_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi16_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm256_cmpgt_epi16_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm256_cmpeq_epi16_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm256_cmpgt_epi16_mask(b, a) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT16_C(0xffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm256_cmp_epi16_mask(a, b, imm8) _mm256_cmp_epi16_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epi16_mask(k1, a, b, imm8) _mm256_mask_cmp_epi16_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epi16_mask(k1, a, b, imm8) (simde_mm256_cmp_epi16_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epi16_mask(a, b, imm8) simde_mm256_cmp_epi16_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epi16_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epi16_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_epi32_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi32_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi32_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpeq_epi32_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi32_mask(b, a) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0x0f);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm_cmp_epi32_mask(a, b, imm8) _mm_cmp_epi32_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epi32_mask(k1, a, b, imm8) _mm_mask_cmp_epi32_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epi32_mask(k1, a, b, imm8) (simde_mm_cmp_epi32_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epi32_mask(a, b, imm8) simde_mm_cmp_epi32_mask(a, b, imm8)
+#  define _mm_mask_cmp_epi32_mask(k1, a, b, imm8) simde_mm_mask_cmp_epi32_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmp_epi32_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi32_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi32_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpeq_epi32_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi32_mask(b, a) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0xff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm256_cmp_epi32_mask(a, b, imm8) _mm256_cmp_epi32_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epi32_mask(k1, a, b, imm8) _mm256_mask_cmp_epi32_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epi32_mask(k1, a, b, imm8) (simde_mm256_cmp_epi32_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epi32_mask(a, b, imm8) simde_mm256_cmp_epi32_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epi32_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epi32_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_epi64_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi64_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi64_mask(a, b) ^ UINT8_C(0x03));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpeq_epi64_mask(a, b) ^ UINT8_C(0x03));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi64_mask(b, a) ^ UINT8_C(0x03));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0x03);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm_cmp_epi64_mask(a, b, imm8) _mm_cmp_epi64_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epi64_mask(k1, a, b, imm8) _mm_mask_cmp_epi64_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epi64_mask(k1, a, b, imm8) (simde_mm_cmp_epi64_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epi64_mask(a, b, imm8) simde_mm_cmp_epi64_mask(a, b, imm8)
+#  define _mm_mask_cmp_epi64_mask(k1, a, b, imm8) simde_mm_mask_cmp_epi64_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmp_epi64_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi64_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi64_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpeq_epi64_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi64_mask(b, a) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0x0f);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm256_cmp_epi64_mask(a, b, imm8) _mm256_cmp_epi64_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epi64_mask(k1, a, b, imm8) _mm256_mask_cmp_epi64_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epi64_mask(k1, a, b, imm8) (simde_mm256_cmp_epi64_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epi64_mask(a, b, imm8) simde_mm256_cmp_epi64_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epi64_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epi64_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm_cmp_epu8_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  /* Flipping the sign bit maps unsigned order onto signed order. */
+  const simde__m128i sign = simde_mm_set1_epi8(INT8_MIN);
+  a = simde_mm_xor_si128(a, sign);
+  b = simde_mm_xor_si128(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi8_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_cmpgt_epi8_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_cmpeq_epi8_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm_cmpgt_epi8_mask(b, a) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT16_C(0xffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm_cmp_epu8_mask(a, b, imm8) _mm_cmp_epu8_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epu8_mask(k1, a, b, imm8) _mm_mask_cmp_epu8_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epu8_mask(k1, a, b, imm8) (simde_mm_cmp_epu8_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epu8_mask(a, b, imm8) simde_mm_cmp_epu8_mask(a, b, imm8)
+#  define _mm_mask_cmp_epu8_mask(k1, a, b, imm8) simde_mm_mask_cmp_epu8_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm256_cmp_epu8_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  const simde__m256i sign = simde_mm256_set1_epi8(INT8_MIN);
+  a = simde_mm256_xor_si256(a, sign);
+  b = simde_mm256_xor_si256(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi8_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask32, simde_mm256_cmpgt_epi8_mask(a, b) ^ UINT32_C(0xffffffff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask32, simde_mm256_cmpeq_epi8_mask(a, b) ^ UINT32_C(0xffffffff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask32, simde_mm256_cmpgt_epi8_mask(b, a) ^ UINT32_C(0xffffffff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi8_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT32_C(0xffffffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm256_cmp_epu8_mask(a, b, imm8) _mm256_cmp_epu8_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epu8_mask(k1, a, b, imm8) _mm256_mask_cmp_epu8_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epu8_mask(k1, a, b, imm8) (simde_mm256_cmp_epu8_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epu8_mask(a, b, imm8) simde_mm256_cmp_epu8_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epu8_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epu8_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_epu16_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  const simde__m128i sign = simde_mm_set1_epi16(INT16_MIN);
+  a = simde_mm_xor_si128(a, sign);
+  b = simde_mm_xor_si128(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi16_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi16_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpeq_epi16_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi16_mask(b, a) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0xff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm_cmp_epu16_mask(a, b, imm8) _mm_cmp_epu16_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epu16_mask(k1, a, b, imm8) _mm_mask_cmp_epu16_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epu16_mask(k1, a, b, imm8) (simde_mm_cmp_epu16_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epu16_mask(a, b, imm8) simde_mm_cmp_epu16_mask(a, b, imm8)
+#  define _mm_mask_cmp_epu16_mask(k1, a, b, imm8) simde_mm_mask_cmp_epu16_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm256_cmp_epu16_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  const simde__m256i sign = simde_mm256_set1_epi16(INT16_MIN);
+  a = simde_mm256_xor_si256(a, sign);
+  b = simde_mm256_xor_si256(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi16_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm256_cmpgt_epi16_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm256_cmpeq_epi16_mask(a, b) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask16, simde_mm256_cmpgt_epi16_mask(b, a) ^ UINT16_C(0xffff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi16_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT16_C(0xffff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+#  define simde_mm256_cmp_epu16_mask(a, b, imm8) _mm256_cmp_epu16_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epu16_mask(k1, a, b, imm8) _mm256_mask_cmp_epu16_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epu16_mask(k1, a, b, imm8) (simde_mm256_cmp_epu16_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epu16_mask(a, b, imm8) simde_mm256_cmp_epu16_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epu16_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epu16_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_epu32_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  const simde__m128i sign = simde_mm_set1_epi32(INT32_MIN);
+  a = simde_mm_xor_si128(a, sign);
+  b = simde_mm_xor_si128(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi32_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi32_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpeq_epi32_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi32_mask(b, a) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0x0f);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm_cmp_epu32_mask(a, b, imm8) _mm_cmp_epu32_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epu32_mask(k1, a, b, imm8) _mm_mask_cmp_epu32_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epu32_mask(k1, a, b, imm8) (simde_mm_cmp_epu32_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epu32_mask(a, b, imm8) simde_mm_cmp_epu32_mask(a, b, imm8)
+#  define _mm_mask_cmp_epu32_mask(k1, a, b, imm8) simde_mm_mask_cmp_epu32_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmp_epu32_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  const simde__m256i sign = simde_mm256_set1_epi32(INT32_MIN);
+  a = simde_mm256_xor_si256(a, sign);
+  b = simde_mm256_xor_si256(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi32_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi32_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpeq_epi32_mask(a, b) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi32_mask(b, a) ^ UINT8_C(0xff));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi32_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0xff);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm256_cmp_epu32_mask(a, b, imm8) _mm256_cmp_epu32_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epu32_mask(k1, a, b, imm8) _mm256_mask_cmp_epu32_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epu32_mask(k1, a, b, imm8) (simde_mm256_cmp_epu32_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epu32_mask(a, b, imm8) simde_mm256_cmp_epu32_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epu32_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epu32_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_epu64_mask (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  const simde__m128i sign = simde_mm_set1_epi64x(INT64_MIN);
+  a = simde_mm_xor_si128(a, sign);
+  b = simde_mm_xor_si128(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm_cmpeq_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm_cmpgt_epi64_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi64_mask(a, b) ^ UINT8_C(0x03));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpeq_epi64_mask(a, b) ^ UINT8_C(0x03));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_cmpgt_epi64_mask(b, a) ^ UINT8_C(0x03));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm_cmpgt_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0x03);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm_cmp_epu64_mask(a, b, imm8) _mm_cmp_epu64_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_epu64_mask(k1, a, b, imm8) _mm_mask_cmp_epu64_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_epu64_mask(k1, a, b, imm8) (simde_mm_cmp_epu64_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_epu64_mask(a, b, imm8) simde_mm_cmp_epu64_mask(a, b, imm8)
+#  define _mm_mask_cmp_epu64_mask(k1, a, b, imm8) simde_mm_mask_cmp_epu64_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmp_epu64_mask (simde__m256i a, simde__m256i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 7) == imm8, "imm8 must be one of the SIMDE_MM_CMPINT_* macros (values: [0, 7])") {
+  const simde__m256i sign = simde_mm256_set1_epi64x(INT64_MIN);
+  a = simde_mm256_xor_si256(a, sign);
+  b = simde_mm256_xor_si256(b, sign);
+
+  switch (imm8) {
+    case SIMDE_MM_CMPINT_EQ:
+      return simde_mm256_cmpeq_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_LT:
+      return simde_mm256_cmpgt_epi64_mask(b, a);
+    case SIMDE_MM_CMPINT_LE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi64_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_FALSE:
+      return 0;
+    case SIMDE_MM_CMPINT_NE:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpeq_epi64_mask(a, b) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLT:
+      return HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_cmpgt_epi64_mask(b, a) ^ UINT8_C(0x0f));
+    case SIMDE_MM_CMPINT_NLE:
+      return simde_mm256_cmpgt_epi64_mask(a, b);
+    case SIMDE_MM_CMPINT_TRUE:
+      return UINT8_C(0x0f);
+  }
+
+  HEDLEY_UNREACHABLE_RETURN(0);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm256_cmp_epu64_mask(a, b, imm8) _mm256_cmp_epu64_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_epu64_mask(k1, a, b, imm8) _mm256_mask_cmp_epu64_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_epu64_mask(k1, a, b, imm8) (simde_mm256_cmp_epu64_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_epu64_mask(a, b, imm8) simde_mm256_cmp_epu64_mask(a, b, imm8)
+#  define _mm256_mask_cmp_epu64_mask(k1, a, b, imm8) simde_mm256_mask_cmp_epu64_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_ps_mask (simde__m128 a, simde__m128 b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be one of the SIMDE_CMP_* macros (values: [0, 31])") {
+  simde__m128_private
+    a_ = simde__m128_to_private(a),
+    b_ = simde__m128_to_private(b);
+
+  /* Bit 4 only selects whether quiet NaNs signal, which doesn't
+     change the result. */
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m128i_private r_;
+
+    switch (imm8 & 15) {
+      case SIMDE_CMP_EQ_OQ:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 == b_.f32);
+        break;
+      case SIMDE_CMP_LT_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 < b_.f32);
+        break;
+      case SIMDE_CMP_LE_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 <= b_.f32);
+        break;
+      case SIMDE_CMP_UNORD_Q:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 != a_.f32) | (b_.f32 != b_.f32));
+        break;
+      case SIMDE_CMP_NEQ_UQ:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 != b_.f32);
+        break;
+      case SIMDE_CMP_NLT_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 < b_.f32);
+        break;
+      case SIMDE_CMP_NLE_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 <= b_.f32);
+        break;
+      case SIMDE_CMP_ORD_Q:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 == a_.f32) & (b_.f32 == b_.f32));
+        break;
+      case SIMDE_CMP_EQ_UQ:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 == b_.f32) | (a_.f32 != a_.f32) | (b_.f32 != b_.f32));
+        break;
+      case SIMDE_CMP_NGE_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 >= b_.f32);
+        break;
+      case SIMDE_CMP_NGT_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 > b_.f32);
+        break;
+      case SIMDE_CMP_FALSE_OQ:
+        return 0;
+      case SIMDE_CMP_NEQ_OQ:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 < b_.f32) | (a_.f32 > b_.f32));
+        break;
+      case SIMDE_CMP_GE_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 >= b_.f32);
+        break;
+      case SIMDE_CMP_GT_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 > b_.f32);
+        break;
+      case SIMDE_CMP_TRUE_UQ:
+        return UINT8_C(0x0f);
+      default:
+        HEDLEY_UNREACHABLE_RETURN(0);
+    }
+
+    return simde_mm_movepi32_mask(simde__m128i_from_private(r_));
+  #else
+    simde__mmask8 r = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+      const simde_float32 x = a_.f32[i], y = b_.f32[i];
+      int t;
+
+      switch (imm8 & 15) {
+        case SIMDE_CMP_EQ_OQ:
+          t = (x == y);
+          break;
+        case SIMDE_CMP_LT_OS:
+          t = (x < y);
+          break;
+        case SIMDE_CMP_LE_OS:
+          t = (x <= y);
+          break;
+        case SIMDE_CMP_UNORD_Q:
+          t = ((x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NEQ_UQ:
+          t = (x != y);
+          break;
+        case SIMDE_CMP_NLT_US:
+          t = !(x < y);
+          break;
+        case SIMDE_CMP_NLE_US:
+          t = !(x <= y);
+          break;
+        case SIMDE_CMP_ORD_Q:
+          t = ((x == x) && (y == y));
+          break;
+        case SIMDE_CMP_EQ_UQ:
+          t = ((x == y) || (x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NGE_US:
+          t = !(x >= y);
+          break;
+        case SIMDE_CMP_NGT_US:
+          t = !(x > y);
+          break;
+        case SIMDE_CMP_FALSE_OQ:
+          t = 0;
+          break;
+        case SIMDE_CMP_NEQ_OQ:
+          t = ((x < y) || (x > y));
+          break;
+        case SIMDE_CMP_GE_OS:
+          t = (x >= y);
+          break;
+        case SIMDE_CMP_GT_OS:
+          t = (x > y);
+          break;
+        case SIMDE_CMP_TRUE_UQ:
+          t = 1;
+          break;
+        default:
+          HEDLEY_UNREACHABLE_RETURN(0);
+      }
+
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, t << i);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm_cmp_ps_mask(a, b, imm8) _mm_cmp_ps_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_ps_mask(k1, a, b, imm8) _mm_mask_cmp_ps_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_ps_mask(k1, a, b, imm8) (simde_mm_cmp_ps_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_ps_mask(a, b, imm8) simde_mm_cmp_ps_mask(a, b, imm8)
+#  define _mm_mask_cmp_ps_mask(k1, a, b, imm8) simde_mm_mask_cmp_ps_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmp_ps_mask (simde__m256 a, simde__m256 b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be one of the SIMDE_CMP_* macros (values: [0, 31])") {
+  simde__m256_private
+    a_ = simde__m256_to_private(a),
+    b_ = simde__m256_to_private(b);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m256i_private r_;
+
+    switch (imm8 & 15) {
+      case SIMDE_CMP_EQ_OQ:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 == b_.f32);
+        break;
+      case SIMDE_CMP_LT_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 < b_.f32);
+        break;
+      case SIMDE_CMP_LE_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 <= b_.f32);
+        break;
+      case SIMDE_CMP_UNORD_Q:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 != a_.f32) | (b_.f32 != b_.f32));
+        break;
+      case SIMDE_CMP_NEQ_UQ:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 != b_.f32);
+        break;
+      case SIMDE_CMP_NLT_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 < b_.f32);
+        break;
+      case SIMDE_CMP_NLE_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 <= b_.f32);
+        break;
+      case SIMDE_CMP_ORD_Q:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 == a_.f32) & (b_.f32 == b_.f32));
+        break;
+      case SIMDE_CMP_EQ_UQ:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 == b_.f32) | (a_.f32 != a_.f32) | (b_.f32 != b_.f32));
+        break;
+      case SIMDE_CMP_NGE_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 >= b_.f32);
+        break;
+      case SIMDE_CMP_NGT_US:
+        r_.i32 = (__typeof__(r_.i32)) ~(a_.f32 > b_.f32);
+        break;
+      case SIMDE_CMP_FALSE_OQ:
+        return 0;
+      case SIMDE_CMP_NEQ_OQ:
+        r_.i32 = (__typeof__(r_.i32)) ((a_.f32 < b_.f32) | (a_.f32 > b_.f32));
+        break;
+      case SIMDE_CMP_GE_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 >= b_.f32);
+        break;
+      case SIMDE_CMP_GT_OS:
+        r_.i32 = (__typeof__(r_.i32)) (a_.f32 > b_.f32);
+        break;
+      case SIMDE_CMP_TRUE_UQ:
+        return UINT8_C(0xff);
+      default:
+        HEDLEY_UNREACHABLE_RETURN(0);
+    }
+
+    return simde_mm256_movepi32_mask(simde__m256i_from_private(r_));
+  #else
+    simde__mmask8 r = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+      const simde_float32 x = a_.f32[i], y = b_.f32[i];
+      int t;
+
+      switch (imm8 & 15) {
+        case SIMDE_CMP_EQ_OQ:
+          t = (x == y);
+          break;
+        case SIMDE_CMP_LT_OS:
+          t = (x < y);
+          break;
+        case SIMDE_CMP_LE_OS:
+          t = (x <= y);
+          break;
+        case SIMDE_CMP_UNORD_Q:
+          t = ((x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NEQ_UQ:
+          t = (x != y);
+          break;
+        case SIMDE_CMP_NLT_US:
+          t = !(x < y);
+          break;
+        case SIMDE_CMP_NLE_US:
+          t = !(x <= y);
+          break;
+        case SIMDE_CMP_ORD_Q:
+          t = ((x == x) && (y == y));
+          break;
+        case SIMDE_CMP_EQ_UQ:
+          t = ((x == y) || (x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NGE_US:
+          t = !(x >= y);
+          break;
+        case SIMDE_CMP_NGT_US:
+          t = !(x > y);
+          break;
+        case SIMDE_CMP_FALSE_OQ:
+          t = 0;
+          break;
+        case SIMDE_CMP_NEQ_OQ:
+          t = ((x < y) || (x > y));
+          break;
+        case SIMDE_CMP_GE_OS:
+          t = (x >= y);
+          break;
+        case SIMDE_CMP_GT_OS:
+          t = (x > y);
+          break;
+        case SIMDE_CMP_TRUE_UQ:
+          t = 1;
+          break;
+        default:
+          HEDLEY_UNREACHABLE_RETURN(0);
+      }
+
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, t << i);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm256_cmp_ps_mask(a, b, imm8) _mm256_cmp_ps_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_ps_mask(k1, a, b, imm8) _mm256_mask_cmp_ps_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_ps_mask(k1, a, b, imm8) (simde_mm256_cmp_ps_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_ps_mask(a, b, imm8) simde_mm256_cmp_ps_mask(a, b, imm8)
+#  define _mm256_mask_cmp_ps_mask(k1, a, b, imm8) simde_mm256_mask_cmp_ps_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm_cmp_pd_mask (simde__m128d a, simde__m128d b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be one of the SIMDE_CMP_* macros (values: [0, 31])") {
+  simde__m128d_private
+    a_ = simde__m128d_to_private(a),
+    b_ = simde__m128d_to_private(b);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m128i_private r_;
+
+    switch (imm8 & 15) {
+      case SIMDE_CMP_EQ_OQ:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 == b_.f64);
+        break;
+      case SIMDE_CMP_LT_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 < b_.f64);
+        break;
+      case SIMDE_CMP_LE_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 <= b_.f64);
+        break;
+      case SIMDE_CMP_UNORD_Q:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 != a_.f64) | (b_.f64 != b_.f64));
+        break;
+      case SIMDE_CMP_NEQ_UQ:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 != b_.f64);
+        break;
+      case SIMDE_CMP_NLT_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 < b_.f64);
+        break;
+      case SIMDE_CMP_NLE_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 <= b_.f64);
+        break;
+      case SIMDE_CMP_ORD_Q:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 == a_.f64) & (b_.f64 == b_.f64));
+        break;
+      case SIMDE_CMP_EQ_UQ:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 == b_.f64) | (a_.f64 != a_.f64) | (b_.f64 != b_.f64));
+        break;
+      case SIMDE_CMP_NGE_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 >= b_.f64);
+        break;
+      case SIMDE_CMP_NGT_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 > b_.f64);
+        break;
+      case SIMDE_CMP_FALSE_OQ:
+        return 0;
+      case SIMDE_CMP_NEQ_OQ:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 < b_.f64) | (a_.f64 > b_.f64));
+        break;
+      case SIMDE_CMP_GE_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 >= b_.f64);
+        break;
+      case SIMDE_CMP_GT_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 > b_.f64);
+        break;
+      case SIMDE_CMP_TRUE_UQ:
+        return UINT8_C(0x03);
+      default:
+        HEDLEY_UNREACHABLE_RETURN(0);
+    }
+
+    return simde_mm_movepi64_mask(simde__m128i_from_private(r_));
+  #else
+    simde__mmask8 r = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+      const simde_float64 x = a_.f64[i], y = b_.f64[i];
+      int t;
+
+      switch (imm8 & 15) {
+        case SIMDE_CMP_EQ_OQ:
+          t = (x == y);
+          break;
+        case SIMDE_CMP_LT_OS:
+          t = (x < y);
+          break;
+        case SIMDE_CMP_LE_OS:
+          t = (x <= y);
+          break;
+        case SIMDE_CMP_UNORD_Q:
+          t = ((x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NEQ_UQ:
+          t = (x != y);
+          break;
+        case SIMDE_CMP_NLT_US:
+          t = !(x < y);
+          break;
+        case SIMDE_CMP_NLE_US:
+          t = !(x <= y);
+          break;
+        case SIMDE_CMP_ORD_Q:
+          t = ((x == x) && (y == y));
+          break;
+        case SIMDE_CMP_EQ_UQ:
+          t = ((x == y) || (x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NGE_US:
+          t = !(x >= y);
+          break;
+        case SIMDE_CMP_NGT_US:
+          t = !(x > y);
+          break;
+        case SIMDE_CMP_FALSE_OQ:
+          t = 0;
+          break;
+        case SIMDE_CMP_NEQ_OQ:
+          t = ((x < y) || (x > y));
+          break;
+        case SIMDE_CMP_GE_OS:
+          t = (x >= y);
+          break;
+        case SIMDE_CMP_GT_OS:
+          t = (x > y);
+          break;
+        case SIMDE_CMP_TRUE_UQ:
+          t = 1;
+          break;
+        default:
+          HEDLEY_UNREACHABLE_RETURN(0);
+      }
+
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, t << i);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm_cmp_pd_mask(a, b, imm8) _mm_cmp_pd_mask(a, b, imm8)
+#  define simde_mm_mask_cmp_pd_mask(k1, a, b, imm8) _mm_mask_cmp_pd_mask(k1, a, b, imm8)
+#else
+#  define simde_mm_mask_cmp_pd_mask(k1, a, b, imm8) (simde_mm_cmp_pd_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_cmp_pd_mask(a, b, imm8) simde_mm_cmp_pd_mask(a, b, imm8)
+#  define _mm_mask_cmp_pd_mask(k1, a, b, imm8) simde_mm_mask_cmp_pd_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_mm256_cmp_pd_mask (simde__m256d a, simde__m256d b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 31) == imm8, "imm8 must be one of the SIMDE_CMP_* macros (values: [0, 31])") {
+  simde__m256d_private
+    a_ = simde__m256d_to_private(a),
+    b_ = simde__m256d_to_private(b);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m256i_private r_;
+
+    switch (imm8 & 15) {
+      case SIMDE_CMP_EQ_OQ:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 == b_.f64);
+        break;
+      case SIMDE_CMP_LT_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 < b_.f64);
+        break;
+      case SIMDE_CMP_LE_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 <= b_.f64);
+        break;
+      case SIMDE_CMP_UNORD_Q:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 != a_.f64) | (b_.f64 != b_.f64));
+        break;
+      case SIMDE_CMP_NEQ_UQ:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 != b_.f64);
+        break;
+      case SIMDE_CMP_NLT_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 < b_.f64);
+        break;
+      case SIMDE_CMP_NLE_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 <= b_.f64);
+        break;
+      case SIMDE_CMP_ORD_Q:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 == a_.f64) & (b_.f64 == b_.f64));
+        break;
+      case SIMDE_CMP_EQ_UQ:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 == b_.f64) | (a_.f64 != a_.f64) | (b_.f64 != b_.f64));
+        break;
+      case SIMDE_CMP_NGE_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 >= b_.f64);
+        break;
+      case SIMDE_CMP_NGT_US:
+        r_.i64 = (__typeof__(r_.i64)) ~(a_.f64 > b_.f64);
+        break;
+      case SIMDE_CMP_FALSE_OQ:
+        return 0;
+      case SIMDE_CMP_NEQ_OQ:
+        r_.i64 = (__typeof__(r_.i64)) ((a_.f64 < b_.f64) | (a_.f64 > b_.f64));
+        break;
+      case SIMDE_CMP_GE_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 >= b_.f64);
+        break;
+      case SIMDE_CMP_GT_OS:
+        r_.i64 = (__typeof__(r_.i64)) (a_.f64 > b_.f64);
+        break;
+      case SIMDE_CMP_TRUE_UQ:
+        return UINT8_C(0x0f);
+      default:
+        HEDLEY_UNREACHABLE_RETURN(0);
+    }
+
+    return simde_mm256_movepi64_mask(simde__m256i_from_private(r_));
+  #else
+    simde__mmask8 r = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+      const simde_float64 x = a_.f64[i], y = b_.f64[i];
+      int t;
+
+      switch (imm8 & 15) {
+        case SIMDE_CMP_EQ_OQ:
+          t = (x == y);
+          break;
+        case SIMDE_CMP_LT_OS:
+          t = (x < y);
+          break;
+        case SIMDE_CMP_LE_OS:
+          t = (x <= y);
+          break;
+        case SIMDE_CMP_UNORD_Q:
+          t = ((x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NEQ_UQ:
+          t = (x != y);
+          break;
+        case SIMDE_CMP_NLT_US:
+          t = !(x < y);
+          break;
+        case SIMDE_CMP_NLE_US:
+          t = !(x <= y);
+          break;
+        case SIMDE_CMP_ORD_Q:
+          t = ((x == x) && (y == y));
+          break;
+        case SIMDE_CMP_EQ_UQ:
+          t = ((x == y) || (x != x) || (y != y));
+          break;
+        case SIMDE_CMP_NGE_US:
+          t = !(x >= y);
+          break;
+        case SIMDE_CMP_NGT_US:
+          t = !(x > y);
+          break;
+        case SIMDE_CMP_FALSE_OQ:
+          t = 0;
+          break;
+        case SIMDE_CMP_NEQ_OQ:
+          t = ((x < y) || (x > y));
+          break;
+        case SIMDE_CMP_GE_OS:
+          t = (x >= y);
+          break;
+        case SIMDE_CMP_GT_OS:
+          t = (x > y);
+          break;
+        case SIMDE_CMP_TRUE_UQ:
+          t = 1;
+          break;
+        default:
+          HEDLEY_UNREACHABLE_RETURN(0);
+      }
+
+      r |= HEDLEY_STATIC_CAST(simde__mmask8, t << i);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm256_cmp_pd_mask(a, b, imm8) _mm256_cmp_pd_mask(a, b, imm8)
+#  define simde_mm256_mask_cmp_pd_mask(k1, a, b, imm8) _mm256_mask_cmp_pd_mask(k1, a, b, imm8)
+#else
+#  define simde_mm256_mask_cmp_pd_mask(k1, a, b, imm8) (simde_mm256_cmp_pd_mask(a, b, imm8) & (k1))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_cmp_pd_mask(a, b, imm8) simde_mm256_cmp_pd_mask(a, b, imm8)
+#  define _mm256_mask_cmp_pd_mask(k1, a, b, imm8) simde_mm256_mask_cmp_pd_mask(k1, a, b, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_permutexvar_epi32 (simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_permutexvar_epi32(idx, a);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    return simde_mm256_permutevar8x32_epi32(a, idx);
+  #else
+    simde__m256i_private
+      r_,
+      idx_ = simde__m256i_to_private(idx),
+      a_ = simde__m256i_to_private(a);
+
+    #if defined(SIMDE_AVX512VL_NEON) && defined(SIMDE_ARCH_AARCH64)
+      const uint8x16x2_t table = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u8 = vqtbl2q_u8(table, simde_x_mm512_tbl_idx_epi32(idx_.m128i_private[i].neon_u32, 7));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i32 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i32, a_.i32, idx_.i32);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = a_.i32[idx_.i32[i] & 7];
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_permutexvar_epi32(idx, a) simde_mm256_permutexvar_epi32(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_permutexvar_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_permutexvar_epi32(src, k, idx, a);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_permutexvar_epi32(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_permutexvar_epi32(src, k, idx, a) simde_mm256_mask_permutexvar_epi32(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_permutexvar_epi32 (simde__mmask8 k, simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_permutexvar_epi32(k, idx, a);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_permutexvar_epi32(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_permutexvar_epi32(k, idx, a) simde_mm256_maskz_permutexvar_epi32(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_permutexvar_epi64 (simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_permutexvar_epi64(idx, a);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    /* Each 64-bit index i becomes the pair of 32-bit indices 2i, 2i + 1,
+       as in simde_mm512_permutexvar_epi64. */
+    const simde__m256i t2 = simde_mm256_slli_epi64(simde_mm256_and_si256(idx, simde_mm256_set1_epi64x(3)), 1);
+    return simde_mm256_permutevar8x32_epi32(a,
+      simde_mm256_add_epi32(simde_mm256_or_si256(t2, simde_mm256_slli_epi64(t2, 32)), simde_mm256_set_epi32(1, 0, 1, 0, 1, 0, 1, 0)));
+  #else
+    simde__m256i_private
+      r_,
+      idx_ = simde__m256i_to_private(idx),
+      a_ = simde__m256i_to_private(a);
+
+    #if defined(SIMDE_AVX512VL_NEON) && defined(SIMDE_ARCH_AARCH64)
+      const uint8x16x2_t table = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u8 = vqtbl2q_u8(table, simde_x_mm512_tbl_idx_epi64(idx_.m128i_private[i].neon_u64, 3));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i64 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i64, a_.i64, idx_.i64);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = a_.i64[idx_.i64[i] & 3];
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_permutexvar_epi64(idx, a) simde_mm256_permutexvar_epi64(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_permutexvar_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_permutexvar_epi64(src, k, idx, a);
+  #else
+    return simde_mm256_mask_mov_epi64(src, k, simde_mm256_permutexvar_epi64(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_permutexvar_epi64(src, k, idx, a) simde_mm256_mask_permutexvar_epi64(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_permutexvar_epi64 (simde__mmask8 k, simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_permutexvar_epi64(k, idx, a);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_permutexvar_epi64(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_permutexvar_epi64(k, idx, a) simde_mm256_maskz_permutexvar_epi64(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_permutexvar_ps (simde__m256i idx, simde__m256 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_permutexvar_ps(idx, a);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_permutexvar_epi32(idx, simde_mm256_castps_si256(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_permutexvar_ps(idx, a) simde_mm256_permutexvar_ps(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_permutexvar_ps (simde__m256 src, simde__mmask8 k, simde__m256i idx, simde__m256 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_permutexvar_ps(src, k, idx, a);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_permutexvar_ps(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_permutexvar_ps(src, k, idx, a) simde_mm256_mask_permutexvar_ps(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_permutexvar_ps (simde__mmask8 k, simde__m256i idx, simde__m256 a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_permutexvar_ps(k, idx, a);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_permutexvar_ps(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_permutexvar_ps(k, idx, a) simde_mm256_maskz_permutexvar_ps(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_permutexvar_pd (simde__m256i idx, simde__m256d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_permutexvar_pd(idx, a);
+  #else
+    return simde_mm256_castsi256_pd(simde_mm256_permutexvar_epi64(idx, simde_mm256_castpd_si256(a)));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_permutexvar_pd(idx, a) simde_mm256_permutexvar_pd(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_permutexvar_pd (simde__m256d src, simde__mmask8 k, simde__m256i idx, simde__m256d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_permutexvar_pd(src, k, idx, a);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_permutexvar_pd(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_permutexvar_pd(src, k, idx, a) simde_mm256_mask_permutexvar_pd(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_permutexvar_pd (simde__mmask8 k, simde__m256i idx, simde__m256d a) {
+  #if defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_permutexvar_pd(k, idx, a);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_permutexvar_pd(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_permutexvar_pd(k, idx, a) simde_mm256_maskz_permutexvar_pd(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_permutexvar_epi16 (simde__m128i idx, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_permutexvar_epi16(idx, a);
+  #elif defined(SIMDE_ARCH_X86_SSSE3)
+    /* Element n is bytes 2n and 2n + 1. */
+    const simde__m128i n = simde_mm_and_si128(idx, simde_mm_set1_epi16(7));
+    return simde_mm_shuffle_epi8(a, simde_mm_add_epi16(simde_mm_mullo_epi16(n, simde_mm_set1_epi16(0x0202)), simde_mm_set1_epi16(0x0100)));
+  #else
+    simde__m128i_private
+      r_,
+      idx_ = simde__m128i_to_private(idx),
+      a_ = simde__m128i_to_private(a);
+
+    #if defined(SIMDE_AVX512VL_NEON) && defined(SIMDE_ARCH_AARCH64)
+      const uint16x8_t n = vandq_u16(idx_.neon_u16, vdupq_n_u16(7));
+      r_.neon_u8 = vqtbl1q_u8(a_.neon_u8, vreinterpretq_u8_u16(vmlaq_n_u16(vdupq_n_u16(0x0100), n, 0x0202)));
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i16 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i16, a_.i16, idx_.i16);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+        r_.i16[i] = a_.i16[idx_.i16[i] & 7];
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_permutexvar_epi16(idx, a) simde_mm_permutexvar_epi16(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_permutexvar_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i idx, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_mask_permutexvar_epi16(src, k, idx, a);
+  #else
+    return simde_mm_mask_mov_epi16(src, k, simde_mm_permutexvar_epi16(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_permutexvar_epi16(src, k, idx, a) simde_mm_mask_permutexvar_epi16(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_permutexvar_epi16 (simde__mmask8 k, simde__m128i idx, simde__m128i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm_maskz_permutexvar_epi16(k, idx, a);
+  #else
+    return simde_mm_maskz_mov_epi16(k, simde_mm_permutexvar_epi16(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_permutexvar_epi16(k, idx, a) simde_mm_maskz_permutexvar_epi16(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_permutexvar_epi16 (simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_permutexvar_epi16(idx, a);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    /* vpshufb can't cross 128-bit lanes, so look every index up in both
+       halves of a and let bit 3 of the index pick one. */
+    const simde__m256i n = simde_mm256_and_si256(idx, simde_mm256_set1_epi16(7));
+    const simde__m256i b = simde_mm256_add_epi16(simde_mm256_mullo_epi16(n, simde_mm256_set1_epi16(0x0202)), simde_mm256_set1_epi16(0x0100));
+    const simde__m256i lo = simde_mm256_shuffle_epi8(simde_mm256_permute2x128_si256(a, a, 0x00), b);
+    const simde__m256i hi = simde_mm256_shuffle_epi8(simde_mm256_permute2x128_si256(a, a, 0x11), b);
+    return simde_mm256_blendv_epi8(lo, hi, simde_mm256_srai_epi16(simde_mm256_slli_epi16(idx, 12), 15));
+  #else
+    simde__m256i_private
+      r_,
+      idx_ = simde__m256i_to_private(idx),
+      a_ = simde__m256i_to_private(a);
+
+    #if defined(SIMDE_AVX512VL_NEON) && defined(SIMDE_ARCH_AARCH64)
+      const uint8x16x2_t table = { { a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8 } };
+
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        const uint16x8_t n = vandq_u16(idx_.m128i_private[i].neon_u16, vdupq_n_u16(15));
+        r_.m128i_private[i].neon_u8 = vqtbl2q_u8(table, vreinterpretq_u8_u16(vmlaq_n_u16(vdupq_n_u16(0x0100), n, 0x0202)));
+      }
+    #elif defined(SIMDE__SHUFFLE_VECTOR_DYNAMIC)
+      r_.i16 = SIMDE__SHUFFLE_VECTOR_DYNAMIC(a_.i16, a_.i16, idx_.i16);
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+        r_.i16[i] = a_.i16[idx_.i16[i] & 15];
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_permutexvar_epi16(idx, a) simde_mm256_permutexvar_epi16(idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_permutexvar_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_mask_permutexvar_epi16(src, k, idx, a);
+  #else
+    return simde_mm256_mask_mov_epi16(src, k, simde_mm256_permutexvar_epi16(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_permutexvar_epi16(src, k, idx, a) simde_mm256_mask_permutexvar_epi16(src, k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_permutexvar_epi16 (simde__mmask16 k, simde__m256i idx, simde__m256i a) {
+  #if defined(SIMDE_AVX512VL_NATIVE) && defined(SIMDE_AVX512BW_NATIVE)
+    return _mm256_maskz_permutexvar_epi16(k, idx, a);
+  #else
+    return simde_mm256_maskz_mov_epi16(k, simde_mm256_permutexvar_epi16(idx, a));
+  #endif
+}
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_permutexvar_epi16(k, idx, a) simde_mm256_maskz_permutexvar_epi16(k, idx, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_ternarylogic_epi32 (simde__m128i a, simde__m128i b, simde__m128i c, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b),
+    c_ = simde__m128i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_SWITCH(imm8, r_.i32f, a_.i32f, b_.i32f, c_.i32f)
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_SWITCH(imm8, r_.i32f[i], a_.i32f[i], b_.i32f[i], c_.i32f[i])
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm_ternarylogic_epi32(a, b, c, imm8) _mm_ternarylogic_epi32(a, b, c, imm8)
+#  define simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#  define simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#  define simde_mm_ternarylogic_epi64(a, b, c, imm8) _mm_ternarylogic_epi64(a, b, c, imm8)
+#  define simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#  define simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#else
+#  define simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm_mask_mov_epi32(src, k, simde_mm_ternarylogic_epi32(src, a, b, imm8))
+#  define simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm_maskz_mov_epi32(k, simde_mm_ternarylogic_epi32(a, b, c, imm8))
+#  define simde_mm_ternarylogic_epi64(a, b, c, imm8) simde_mm_ternarylogic_epi32(a, b, c, imm8)
+#  define simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm_mask_mov_epi64(src, k, simde_mm_ternarylogic_epi32(src, a, b, imm8))
+#  define simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm_maskz_mov_epi64(k, simde_mm_ternarylogic_epi32(a, b, c, imm8))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm_ternarylogic_epi32(a, b, c, imm8) simde_mm_ternarylogic_epi32(a, b, c, imm8)
+#  define _mm_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#  define _mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#  define _mm_ternarylogic_epi64(a, b, c, imm8) simde_mm_ternarylogic_epi64(a, b, c, imm8)
+#  define _mm_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#  define _mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_ternarylogic_epi32 (simde__m256i a, simde__m256i b, simde__m256i c, int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b),
+    c_ = simde__m256i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_SWITCH(imm8, r_.i32f, a_.i32f, b_.i32f, c_.i32f)
+  #else
+    SIMDE__VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_SWITCH(imm8, r_.i32f[i], a_.i32f[i], b_.i32f[i], c_.i32f[i])
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_AVX512VL_NATIVE)
+#  define simde_mm256_ternarylogic_epi32(a, b, c, imm8) _mm256_ternarylogic_epi32(a, b, c, imm8)
+#  define simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm256_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#  define simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#  define simde_mm256_ternarylogic_epi64(a, b, c, imm8) _mm256_ternarylogic_epi64(a, b, c, imm8)
+#  define simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm256_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#  define simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#else
+#  define simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm256_mask_mov_epi32(src, k, simde_mm256_ternarylogic_epi32(src, a, b, imm8))
+#  define simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm256_maskz_mov_epi32(k, simde_mm256_ternarylogic_epi32(a, b, c, imm8))
+#  define simde_mm256_ternarylogic_epi64(a, b, c, imm8) simde_mm256_ternarylogic_epi32(a, b, c, imm8)
+#  define simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm256_mask_mov_epi64(src, k, simde_mm256_ternarylogic_epi32(src, a, b, imm8))
+#  define simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm256_maskz_mov_epi64(k, simde_mm256_ternarylogic_epi32(a, b, c, imm8))
+#endif
+#if defined(SIMDE_AVX512VL_ENABLE_NATIVE_ALIASES)
+#  define _mm256_ternarylogic_epi32(a, b, c, imm8) simde_mm256_ternarylogic_epi32(a, b, c, imm8)
+#  define _mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#  define _mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#  define _mm256_ternarylogic_epi64(a, b, c, imm8) simde_mm256_ternarylogic_epi64(a, b, c, imm8)
+#  define _mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#  define _mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AVX512VL_H) */
@@ -0,0 +1,368 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__AVX512VNNI_H)
+#  if !defined(SIMDE__AVX512VNNI_H)
+#    define SIMDE__AVX512VNNI_H
+#  endif
+#  include "avx512vl.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AVX512VNNI_NATIVE)
+#    undef SIMDE_AVX512VNNI_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AVX512VNNI) && !defined(SIMDE_AVX512VNNI_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512VNNI_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_AVX512VNNI_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_AVX512VNNI_NEON
+#  endif
+
+#  if defined(SIMDE_AVX512VNNI_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#if !defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+  #define SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES
+#endif
+
+/* The 128- and 256-bit versions are only native when AVX512VL is
+ * available as well. */
+
+SIMDE__BEGIN_DECLS
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_dpbusd_epi32 (simde__m128i src, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_dpbusd_epi32(src, a, b);
+  #elif defined(SIMDE_ARCH_X86_SSSE3)
+    /* maddubs saturates each pair to int16, and 255 * 127 * 2 doesn't
+     * fit.  Splitting a into its low seven bits and its top bit keeps
+     * both halves in range; madd against 1 then widens the pairs into
+     * exact 32-bit sums of four. */
+    const simde__m128i ones = simde_mm_set1_epi16(1);
+    const simde__m128i lo = simde_mm_maddubs_epi16(simde_mm_and_si128(a, simde_mm_set1_epi8(INT8_MAX)), b);
+    const simde__m128i hi = simde_mm_maddubs_epi16(simde_mm_and_si128(a, simde_mm_set1_epi8(INT8_MIN)), b);
+
+    return simde_mm_add_epi32(src, simde_mm_add_epi32(simde_mm_madd_epi16(lo, ones), simde_mm_madd_epi16(hi, ones)));
+  #else
+    simde__m128i_private
+      r_,
+      src_ = simde__m128i_to_private(src),
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_AVX512VNNI_NEON) && defined(SIMDE_ARCH_AARCH64) && defined(SIMDE_ARCH_ARM_MATMUL_INT8)
+      r_.neon_i32 = vusdotq_s32(src_.neon_i32, a_.neon_u8, b_.neon_i8);
+    #elif defined(SIMDE_AVX512VNNI_NEON) && defined(SIMDE_ARCH_AARCH64) && defined(SIMDE_ARCH_ARM_DOTPROD)
+      /* SDOT is signed by signed, so bias a into int8 range and add
+       * 128 times the sum of b back in. */
+      const int32x4_t bsum = vdotq_s32(vdupq_n_s32(0), vdupq_n_s8(1), b_.neon_i8);
+      r_.neon_i32 = vdotq_s32(src_.neon_i32, vreinterpretq_s8_u8(veorq_u8(a_.neon_u8, vdupq_n_u8(0x80))), b_.neon_i8);
+      r_.neon_i32 = vaddq_s32(r_.neon_i32, vshlq_n_s32(bsum, 7));
+    #elif defined(SIMDE_AVX512VNNI_NEON) && defined(SIMDE_ARCH_AARCH64)
+      /* u8 * s8 always fits in an int16, so there is no need to widen
+       * before the multiply. */
+      const int16x8_t pl = vmulq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(a_.neon_u8))), vmovl_s8(vget_low_s8(b_.neon_i8)));
+      const int16x8_t ph = vmulq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(a_.neon_u8))), vmovl_s8(vget_high_s8(b_.neon_i8)));
+      r_.neon_i32 = vaddq_s32(src_.neon_i32, vpaddq_s32(vpaddlq_s16(pl), vpaddlq_s16(ph)));
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        const size_t j = i * 4;
+        const int32_t sum =
+          (HEDLEY_STATIC_CAST(int32_t, a_.u8[  j  ]) * HEDLEY_STATIC_CAST(int32_t, b_.i8[  j  ])) +
+          (HEDLEY_STATIC_CAST(int32_t, a_.u8[j + 1]) * HEDLEY_STATIC_CAST(int32_t, b_.i8[j + 1])) +
+          (HEDLEY_STATIC_CAST(int32_t, a_.u8[j + 2]) * HEDLEY_STATIC_CAST(int32_t, b_.i8[j + 2])) +
+          (HEDLEY_STATIC_CAST(int32_t, a_.u8[j + 3]) * HEDLEY_STATIC_CAST(int32_t, b_.i8[j + 3]));
+        r_.u32[i] = src_.u32[i] + HEDLEY_STATIC_CAST(uint32_t, sum);
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm_dpbusd_epi32(src, a, b) simde_mm_dpbusd_epi32(src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_dpbusd_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_dpbusd_epi32(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi32(src, k, simde_mm_dpbusd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_dpbusd_epi32(src, k, a, b) simde_mm_mask_dpbusd_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_dpbusd_epi32 (simde__mmask8 k, simde__m128i src, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_dpbusd_epi32(k, src, a, b);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_dpbusd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_dpbusd_epi32(k, src, a, b) simde_mm_maskz_dpbusd_epi32(k, src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_dpbusd_epi32 (simde__m256i src, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_dpbusd_epi32(src, a, b);
+  #elif defined(SIMDE_ARCH_X86_AVX2)
+    const simde__m256i ones = simde_mm256_set1_epi16(1);
+    const simde__m256i lo = simde_mm256_maddubs_epi16(simde_mm256_and_si256(a, simde_mm256_set1_epi8(INT8_MAX)), b);
+    const simde__m256i hi = simde_mm256_maddubs_epi16(simde_mm256_and_si256(a, simde_mm256_set1_epi8(INT8_MIN)), b);
+
+    return simde_mm256_add_epi32(src, simde_mm256_add_epi32(simde_mm256_madd_epi16(lo, ones), simde_mm256_madd_epi16(hi, ones)));
+  #else
+    simde__m256i_private
+      r_,
+      src_ = simde__m256i_to_private(src),
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_dpbusd_epi32(src_.m128i[i], a_.m128i[i], b_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm256_dpbusd_epi32(src, a, b) simde_mm256_dpbusd_epi32(src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_dpbusd_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_dpbusd_epi32(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_dpbusd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_dpbusd_epi32(src, k, a, b) simde_mm256_mask_dpbusd_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_dpbusd_epi32 (simde__mmask8 k, simde__m256i src, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_dpbusd_epi32(k, src, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_dpbusd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_dpbusd_epi32(k, src, a, b) simde_mm256_maskz_dpbusd_epi32(k, src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_dpbusd_epi32 (simde__m512i src, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE)
+    return _mm512_dpbusd_epi32(src, a, b);
+  #elif defined(SIMDE_ARCH_X86_AVX512BW)
+    const simde__m512i ones = simde_mm512_set1_epi16(1);
+    const simde__m512i lo = simde_mm512_maddubs_epi16(simde_mm512_and_si512(a, simde_mm512_set1_epi8(INT8_MAX)), b);
+    const simde__m512i hi = simde_mm512_maddubs_epi16(simde_mm512_and_si512(a, simde_mm512_set1_epi8(INT8_MIN)), b);
+
+    return simde_mm512_add_epi32(src, simde_mm512_add_epi32(simde_mm512_madd_epi16(lo, ones), simde_mm512_madd_epi16(hi, ones)));
+  #else
+    simde__m512i_private
+      r_,
+      src_ = simde__m512i_to_private(src),
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_dpbusd_epi32(src_.m256i[i], a_.m256i[i], b_.m256i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_dpbusd_epi32(src, a, b) simde_mm512_dpbusd_epi32(src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_dpbusd_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE)
+    return _mm512_mask_dpbusd_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_dpbusd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_dpbusd_epi32(src, k, a, b) simde_mm512_mask_dpbusd_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_dpbusd_epi32 (simde__mmask16 k, simde__m512i src, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE)
+    return _mm512_maskz_dpbusd_epi32(k, src, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_dpbusd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_dpbusd_epi32(k, src, a, b) simde_mm512_maskz_dpbusd_epi32(k, src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_dpwssd_epi32 (simde__m128i src, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_dpwssd_epi32(src, a, b);
+  #else
+    return simde_mm_add_epi32(src, simde_mm_madd_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm_dpwssd_epi32(src, a, b) simde_mm_dpwssd_epi32(src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_dpwssd_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_mask_dpwssd_epi32(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi32(src, k, simde_mm_dpwssd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm_mask_dpwssd_epi32(src, k, a, b) simde_mm_mask_dpwssd_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_dpwssd_epi32 (simde__mmask8 k, simde__m128i src, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm_maskz_dpwssd_epi32(k, src, a, b);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_dpwssd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm_maskz_dpwssd_epi32(k, src, a, b) simde_mm_maskz_dpwssd_epi32(k, src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_dpwssd_epi32 (simde__m256i src, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_dpwssd_epi32(src, a, b);
+  #else
+    return simde_mm256_add_epi32(src, simde_mm256_madd_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm256_dpwssd_epi32(src, a, b) simde_mm256_dpwssd_epi32(src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_dpwssd_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_mask_dpwssd_epi32(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_dpwssd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm256_mask_dpwssd_epi32(src, k, a, b) simde_mm256_mask_dpwssd_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_dpwssd_epi32 (simde__mmask8 k, simde__m256i src, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE) && defined(SIMDE_AVX512VL_NATIVE)
+    return _mm256_maskz_dpwssd_epi32(k, src, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_dpwssd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm256_maskz_dpwssd_epi32(k, src, a, b) simde_mm256_maskz_dpwssd_epi32(k, src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_dpwssd_epi32 (simde__m512i src, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE)
+    return _mm512_dpwssd_epi32(src, a, b);
+  #else
+    return simde_mm512_add_epi32(src, simde_mm512_madd_epi16(a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_dpwssd_epi32(src, a, b) simde_mm512_dpwssd_epi32(src, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_dpwssd_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE)
+    return _mm512_mask_dpwssd_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_dpwssd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_dpwssd_epi32(src, k, a, b) simde_mm512_mask_dpwssd_epi32(src, k, a, b)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_dpwssd_epi32 (simde__mmask16 k, simde__m512i src, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_AVX512VNNI_NATIVE)
+    return _mm512_maskz_dpwssd_epi32(k, src, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_dpwssd_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_dpwssd_epi32(k, src, a, b) simde_mm512_maskz_dpwssd_epi32(k, src, a, b)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AVX512VNNI_H) */
@@ -0,0 +1,247 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__AVX512VPOPCNTDQ_H)
+#  if !defined(SIMDE__AVX512VPOPCNTDQ_H)
+#    define SIMDE__AVX512VPOPCNTDQ_H
+#  endif
+#  include "avx512bw.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+#    undef SIMDE_AVX512VPOPCNTDQ_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_AVX512VPOPCNTDQ) && !defined(SIMDE_AVX512VPOPCNTDQ_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_AVX512VPOPCNTDQ_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_AVX512VPOPCNTDQ_NO_NEON) && !defined(SIMDE_NO_NEON)
+#    define SIMDE_AVX512VPOPCNTDQ_NEON
+#  elif defined(SIMDE_ARCH_POWER_ALTIVEC)
+#    define SIMDE_AVX512VPOPCNTDQ_POWER_ALTIVEC
+#  endif
+
+#  if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+#    include <immintrin.h>
+#  endif
+
+#  if defined(SIMDE_AVX512VPOPCNTDQ_POWER_ALTIVEC)
+#    include <altivec.h>
+#  endif
+
+#if !defined(SIMDE_AVX512VPOPCNTDQ_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+  #define SIMDE_AVX512VPOPCNTDQ_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+/* Population count of each byte.  The wider counts below (and the
+ * ones in avx512bitalg.h) are built from this on x86, where there is
+ * no native popcount narrower than a general-purpose register. */
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_x_mm512_popcnt_epi8 (simde__m512i a) {
+  #if defined(SIMDE_ARCH_X86_SSSE3)
+    /* Look up the count of each nibble with pshufb. */
+    const simde__m512i lut = simde_mm512_broadcast_i32x4(simde_mm_set_epi8(4, 3, 3, 2, 3, 2, 2, 1, 3, 2, 2, 1, 2, 1, 1, 0));
+    const simde__m512i low_nibbles = simde_mm512_set1_epi8(0x0f);
+
+    return simde_mm512_add_epi8(
+      simde_mm512_shuffle_epi8(lut, simde_mm512_and_si512(a, low_nibbles)),
+      simde_mm512_shuffle_epi8(lut, simde_mm512_and_si512(simde_mm512_srli_epi16(a, 4), low_nibbles)));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_AVX512VPOPCNTDQ_NEON)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u8 = vcntq_u8(a_.m128i_private[i].neon_u8);
+      }
+    #elif defined(SIMDE_AVX512VPOPCNTDQ_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+      for (size_t i = 0 ; i < (sizeof(r_.altivec_u8) / sizeof(r_.altivec_u8[0])) ; i++) {
+        r_.altivec_u8[i] = vec_popcnt(a_.altivec_u8[i]);
+      }
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+        uint8_t v = a_.u8[i];
+        v = HEDLEY_STATIC_CAST(uint8_t, v - ((v >> 1) & UINT8_C(0x55)));
+        v = HEDLEY_STATIC_CAST(uint8_t, (v & UINT8_C(0x33)) + ((v >> 2) & UINT8_C(0x33)));
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (v + (v >> 4)) & UINT8_C(0x0f));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_popcnt_epi32 (simde__m512i a) {
+  #if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+    return _mm512_popcnt_epi32(a);
+  #elif defined(SIMDE_ARCH_X86_SSSE3)
+    /* maddubs against 1 sums adjacent byte counts, madd against 1 sums
+     * adjacent 16-bit counts. */
+    return simde_mm512_madd_epi16(
+      simde_mm512_maddubs_epi16(simde_x_mm512_popcnt_epi8(a), simde_mm512_set1_epi8(1)),
+      simde_mm512_set1_epi16(1));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_AVX512VPOPCNTDQ_NEON)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u32 = vpaddlq_u16(vpaddlq_u8(vcntq_u8(a_.m128i_private[i].neon_u8)));
+      }
+    #elif defined(SIMDE_AVX512VPOPCNTDQ_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+      for (size_t i = 0 ; i < (sizeof(r_.altivec_u32) / sizeof(r_.altivec_u32[0])) ; i++) {
+        r_.altivec_u32[i] = vec_popcnt(a_.altivec_u32[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.u32 = a_.u32 - ((a_.u32 >> 1) & UINT32_C(0x55555555));
+      r_.u32 = (r_.u32 & UINT32_C(0x33333333)) + ((r_.u32 >> 2) & UINT32_C(0x33333333));
+      r_.u32 = (r_.u32 + (r_.u32 >> 4)) & UINT32_C(0x0f0f0f0f);
+      r_.u32 = (r_.u32 * UINT32_C(0x01010101)) >> 24;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        uint32_t v = a_.u32[i];
+        v -= (v >> 1) & UINT32_C(0x55555555);
+        v = (v & UINT32_C(0x33333333)) + ((v >> 2) & UINT32_C(0x33333333));
+        v = (v + (v >> 4)) & UINT32_C(0x0f0f0f0f);
+        r_.u32[i] = (v * UINT32_C(0x01010101)) >> 24;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VPOPCNTDQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_popcnt_epi32(a) simde_mm512_popcnt_epi32(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_popcnt_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+    return _mm512_mask_popcnt_epi32(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_popcnt_epi32(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VPOPCNTDQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_popcnt_epi32(src, k, a) simde_mm512_mask_popcnt_epi32(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_popcnt_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+    return _mm512_maskz_popcnt_epi32(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_popcnt_epi32(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VPOPCNTDQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_popcnt_epi32(k, a) simde_mm512_maskz_popcnt_epi32(k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_popcnt_epi64 (simde__m512i a) {
+  #if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+    return _mm512_popcnt_epi64(a);
+  #elif defined(SIMDE_ARCH_X86_SSSE3)
+    /* psadbw against zero sums the eight byte counts of each quadword. */
+    return simde_mm512_sad_epu8(simde_x_mm512_popcnt_epi8(a), simde_mm512_setzero_si512());
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_AVX512VPOPCNTDQ_NEON)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_u64 = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vcntq_u8(a_.m128i_private[i].neon_u8))));
+      }
+    #elif defined(SIMDE_AVX512VPOPCNTDQ_POWER_ALTIVEC) && (SIMDE_ARCH_POWER >= 800)
+      for (size_t i = 0 ; i < (sizeof(r_.altivec_u64) / sizeof(r_.altivec_u64[0])) ; i++) {
+        r_.altivec_u64[i] = vec_popcnt(a_.altivec_u64[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.u64 = a_.u64 - ((a_.u64 >> 1) & UINT64_C(0x5555555555555555));
+      r_.u64 = (r_.u64 & UINT64_C(0x3333333333333333)) + ((r_.u64 >> 2) & UINT64_C(0x3333333333333333));
+      r_.u64 = (r_.u64 + (r_.u64 >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+      r_.u64 = (r_.u64 * UINT64_C(0x0101010101010101)) >> 56;
+    #else
+      SIMDE__VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        uint64_t v = a_.u64[i];
+        v -= (v >> 1) & UINT64_C(0x5555555555555555);
+        v = (v & UINT64_C(0x3333333333333333)) + ((v >> 2) & UINT64_C(0x3333333333333333));
+        v = (v + (v >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+        r_.u64[i] = (v * UINT64_C(0x0101010101010101)) >> 56;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_AVX512VPOPCNTDQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_popcnt_epi64(a) simde_mm512_popcnt_epi64(a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_popcnt_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+    return _mm512_mask_popcnt_epi64(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_popcnt_epi64(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VPOPCNTDQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_mask_popcnt_epi64(src, k, a) simde_mm512_mask_popcnt_epi64(src, k, a)
+#endif
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_popcnt_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE)
+    return _mm512_maskz_popcnt_epi64(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_popcnt_epi64(a));
+  #endif
+}
+#if defined(SIMDE_AVX512VPOPCNTDQ_ENABLE_NATIVE_ALIASES)
+#  define _mm512_maskz_popcnt_epi64(k, a) simde_mm512_maskz_popcnt_epi64(k, a)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__AVX512VPOPCNTDQ_H) */
@@ -0,0 +1,154 @@
+/* Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE__CLMUL_H)
+#  if !defined(SIMDE__CLMUL_H)
+#    define SIMDE__CLMUL_H
+#  endif
+#  include "sse2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+#  if defined(SIMDE_CLMUL_NATIVE)
+#    undef SIMDE_CLMUL_NATIVE
+#  endif
+#  if defined(SIMDE_ARCH_X86_PCLMUL) && !defined(SIMDE_CLMUL_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#    define SIMDE_CLMUL_NATIVE
+#  elif defined(SIMDE_ARCH_ARM_AES) && defined(SIMDE_SSE2_NEON) && !defined(SIMDE_CLMUL_NO_NEON) && !defined(SIMDE_NO_NEON)
+     /* The 64-bit PMULL is part of the AES extension. */
+#    define SIMDE_CLMUL_NEON
+#  elif defined(SIMDE_ARCH_POWER_CRYPTO) && defined(SIMDE_SSE2_POWER_ALTIVEC)
+#    define SIMDE_CLMUL_POWER_CRYPTO
+#  endif
+
+#  if defined(SIMDE_CLMUL_NATIVE) && !defined(SIMDE_SSE2_NATIVE)
+#    if defined(SIMDE_CLMUL_FORCE_NATIVE)
+#      error Native CLMUL support requires native SSE2 support
+#    else
+       HEDLEY_WARNING("Native CLMUL support requires native SSE2 support, disabling")
+#      undef SIMDE_CLMUL_NATIVE
+#    endif
+#  endif
+
+#  if defined(SIMDE_CLMUL_NATIVE)
+#    include <wmmintrin.h>
+#  elif defined(SIMDE_CLMUL_NEON)
+#    include <arm_neon.h>
+#  elif defined(SIMDE_CLMUL_POWER_CRYPTO)
+#    include <altivec.h>
+#  endif
+
+#if !defined(SIMDE_CLMUL_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_CLMUL_ENABLE_NATIVE_ALIASES
+#endif
+
+SIMDE__BEGIN_DECLS
+
+SIMDE__FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_clmul_u32 (uint32_t x, uint32_t y) {
+  /* Carry-less 32x32 -> 64-bit multiply using ordinary integer
+   * multiplies.  Each operand is split into four sets of bits spaced
+   * four apart, so no column of a partial product can collect more
+   * than eight ones and carries never reach the next bit of the same
+   * set; masking afterwards keeps only the bits we want.  This is
+   * constant-time, unlike a loop over the bits of one operand. */
+  const uint64_t
+    x0 = x & UINT32_C(0x11111111),
+    x1 = x & UINT32_C(0x22222222),
+    x2 = x & UINT32_C(0x44444444),
+    x3 = x & UINT32_C(0x88888888),
+    y0 = y & UINT32_C(0x11111111),
+    y1 = y & UINT32_C(0x22222222),
+    y2 = y & UINT32_C(0x44444444),
+    y3 = y & UINT32_C(0x88888888);
+  uint64_t z0, z1, z2, z3;
+
+  z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+  z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+  z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+  z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+
+  return
+    (z0 & UINT64_C(0x1111111111111111)) |
+    (z1 & UINT64_C(0x2222222222222222)) |
+    (z2 & UINT64_C(0x4444444444444444)) |
+    (z3 & UINT64_C(0x8888888888888888));
+}
+
+SIMDE__FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_clmulepi64_si128 (simde__m128i a, simde__m128i b, const int imm8)
+    HEDLEY_REQUIRE_MSG((imm8 & 0xff) == imm8, "imm8 must be in range [0, 255]") {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+  const uint64_t x = a_.u64[imm8 & 1];
+  const uint64_t y = b_.u64[(imm8 >> 4) & 1];
+
+  #if defined(SIMDE_CLMUL_NEON)
+    r_.neon_u64 = vreinterpretq_u64_p128(vmull_p64(HEDLEY_STATIC_CAST(poly64_t, x), HEDLEY_STATIC_CAST(poly64_t, y)));
+  #elif defined(SIMDE_CLMUL_POWER_CRYPTO)
+    /* vpmsumd XORs the products of both doubleword pairs; zeroing the
+     * other pair leaves the single 128-bit product. */
+    const vector unsigned long long
+      xv = { x, 0 },
+      yv = { y, 0 };
+
+    r_.altivec_u64 = __builtin_crypto_vpmsumd(xv, yv);
+    #if defined(SIMDE_BYTE_ORDER_BE)
+      r_.altivec_u8 = vec_sld(r_.altivec_u8, r_.altivec_u8, 8);
+    #endif
+  #else
+    /* Karatsuba: three 32x32 multiplies instead of four. */
+    const uint32_t
+      xl = HEDLEY_STATIC_CAST(uint32_t, x),
+      xh = HEDLEY_STATIC_CAST(uint32_t, x >> 32),
+      yl = HEDLEY_STATIC_CAST(uint32_t, y),
+      yh = HEDLEY_STATIC_CAST(uint32_t, y >> 32);
+    const uint64_t
+      lo = simde_x_clmul_u32(xl, yl),
+      hi = simde_x_clmul_u32(xh, yh),
+      mid = simde_x_clmul_u32(xl ^ xh, yl ^ yh) ^ lo ^ hi;
+
+    r_.u64[0] = lo ^ (mid << 32);
+    r_.u64[1] = hi ^ (mid >> 32);
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_CLMUL_NATIVE)
+#  define simde_mm_clmulepi64_si128(a, b, imm8) _mm_clmulepi64_si128(a, b, imm8)
+#endif
+#if defined(SIMDE_CLMUL_ENABLE_NATIVE_ALIASES)
+#  define _mm_clmulepi64_si128(a, b, imm8) simde_mm_clmulepi64_si128(a, b, imm8)
+#endif
+
+SIMDE__END_DECLS
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE__CLMUL_H) */
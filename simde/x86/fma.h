@@ -36,7 +36,7 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 #  if defined(SIMDE_FMA_NATIVE)
 #    undef SIMDE_FMA_NATIVE
 #  endif
-#  if defined(SIMDE_ARCH_X86_GMA) && !defined(SIMDE_FMA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+#  if defined(SIMDE_ARCH_X86_FMA) && !defined(SIMDE_FMA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
 #    define SIMDE_FMA_NATIVE
 #  elif defined(SIMDE_ARCH_ARM_NEON) && !defined(SIMDE_FMA_NO_NEON) && !defined(SIMDE_NO_NEON)
 #    define SIMDE_FMA_NEON
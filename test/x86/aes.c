@@ -0,0 +1,437 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX aes
+#include <test/x86/test-x86-internal.h>
+#include <simde/x86/aes.h>
+
+#if defined(SIMDE_AES_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_mm_aesdec_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C( 100), INT8_C( -16), INT8_C( -18), INT8_C( -71), INT8_C(   2), INT8_C( 110), INT8_C(  96), INT8_C( 118),
+                        INT8_C( -36), INT8_C(  27), INT8_C( 119), INT8_C( -82), INT8_C(  11), INT8_C( -13), INT8_C(  77), INT8_C( -83)),
+      simde_mm_set_epi8(INT8_C(  48), INT8_C(  95), INT8_C(   5), INT8_C(  12), INT8_C(  54), INT8_C(-115), INT8_C( -52), INT8_C( 116),
+                        INT8_C( 123), INT8_C(   7), INT8_C( -50), INT8_C(-111), INT8_C( -27), INT8_C(-112), INT8_C(  97), INT8_C(  54)),
+      simde_mm_set_epi8(INT8_C( 105), INT8_C(-117), INT8_C( 107), INT8_C( 126), INT8_C( -17), INT8_C(-107), INT8_C( 126), INT8_C(  -8),
+                        INT8_C( 127), INT8_C(-103), INT8_C(-110), INT8_C( -15), INT8_C(-118), INT8_C( -44), INT8_C( -86), INT8_C(-127)) },
+    { simde_mm_set_epi8(INT8_C(-105), INT8_C(  16), INT8_C(  29), INT8_C( -50), INT8_C(  78), INT8_C( 123), INT8_C(  -5), INT8_C( 121),
+                        INT8_C(  44), INT8_C( -21), INT8_C(  22), INT8_C( -32), INT8_C( -95), INT8_C( -59), INT8_C(  74), INT8_C( -20)),
+      simde_mm_set_epi8(INT8_C( -39), INT8_C( -86), INT8_C( 121), INT8_C(  46), INT8_C(  26), INT8_C( -12), INT8_C( 112), INT8_C( -22),
+                        INT8_C(-102), INT8_C( -46), INT8_C( -31), INT8_C(  68), INT8_C( -42), INT8_C( -24), INT8_C( -14), INT8_C( -49)),
+      simde_mm_set_epi8(INT8_C(   8), INT8_C(  30), INT8_C( -66), INT8_C( -50), INT8_C(  32), INT8_C(  98), INT8_C(-113), INT8_C( 107),
+                        INT8_C(  24), INT8_C( -31), INT8_C( -27), INT8_C( -57), INT8_C( -73), INT8_C( -93), INT8_C(  55), INT8_C(  60)) },
+    { simde_mm_set_epi8(INT8_C(-113), INT8_C(-114), INT8_C( -87), INT8_C( -45), INT8_C(  73), INT8_C(  66), INT8_C(-115), INT8_C(-114),
+                        INT8_C( -35), INT8_C( -86), INT8_C(  78), INT8_C(-123), INT8_C( -80), INT8_C( -42), INT8_C( -30), INT8_C(-117)),
+      simde_mm_set_epi8(INT8_C(  46), INT8_C( -83), INT8_C(-123), INT8_C(  71), INT8_C(  86), INT8_C( -41), INT8_C(  31), INT8_C(   3),
+                        INT8_C(   8), INT8_C( -12), INT8_C( 116), INT8_C(  -1), INT8_C( -72), INT8_C( -24), INT8_C( -85), INT8_C(  21)),
+      simde_mm_set_epi8(INT8_C( -76), INT8_C(  30), INT8_C(  74), INT8_C(  34), INT8_C(  33), INT8_C( 101), INT8_C( 127), INT8_C( -49),
+                        INT8_C(-107), INT8_C(  74), INT8_C(  74), INT8_C(  -4), INT8_C( -36), INT8_C( -64), INT8_C(  61), INT8_C(-119)) },
+    { simde_mm_set_epi8(INT8_C(  14), INT8_C(  31), INT8_C( -60), INT8_C(-101), INT8_C( -42), INT8_C(  59), INT8_C(-128), INT8_C( -98),
+                        INT8_C(  85), INT8_C( -68), INT8_C( 121), INT8_C(  -8), INT8_C( -83), INT8_C( -89), INT8_C(  17), INT8_C(  -3)),
+      simde_mm_set_epi8(INT8_C( -59), INT8_C( 118), INT8_C(  80), INT8_C( 121), INT8_C(  -4), INT8_C(  93), INT8_C(  67), INT8_C(  -1),
+                        INT8_C( -71), INT8_C(  33), INT8_C(-103), INT8_C( -24), INT8_C(  63), INT8_C(  90), INT8_C(  16), INT8_C(  31)),
+      simde_mm_set_epi8(INT8_C(  -5), INT8_C( -19), INT8_C(  51), INT8_C(  13), INT8_C(-123), INT8_C( 110), INT8_C(  30), INT8_C( -58),
+                        INT8_C( -37), INT8_C( -84), INT8_C(  79), INT8_C(  82), INT8_C( -69), INT8_C( -98), INT8_C( -21), INT8_C( -87)) },
+    { simde_mm_set_epi8(INT8_C( -93), INT8_C(  46), INT8_C( -38), INT8_C( -65), INT8_C(  85), INT8_C(-123), INT8_C( -67), INT8_C( 117),
+                        INT8_C(  53), INT8_C(  60), INT8_C(  -4), INT8_C(  56), INT8_C( 125), INT8_C(  -6), INT8_C( -26), INT8_C( -72)),
+      simde_mm_set_epi8(INT8_C(-110), INT8_C(  -5), INT8_C(  45), INT8_C( -49), INT8_C( -56), INT8_C( -82), INT8_C(-102), INT8_C(  25),
+                        INT8_C(  -4), INT8_C(  86), INT8_C(  57), INT8_C( -79), INT8_C( 107), INT8_C( 113), INT8_C(  75), INT8_C(  79)),
+      simde_mm_set_epi8(INT8_C(  72), INT8_C( 113), INT8_C( -89), INT8_C(  82), INT8_C( -62), INT8_C( -85), INT8_C( -86), INT8_C(  41),
+                        INT8_C( -18), INT8_C(-103), INT8_C( 114), INT8_C(-118), INT8_C(  22), INT8_C(  48), INT8_C(  41), INT8_C(  79)) },
+    { simde_mm_set_epi8(INT8_C( -68), INT8_C( -69), INT8_C(-101), INT8_C( 126), INT8_C(-102), INT8_C(  49), INT8_C(-102), INT8_C( -17),
+                        INT8_C(  84), INT8_C(  75), INT8_C(  14), INT8_C( -57), INT8_C( 109), INT8_C(   0), INT8_C(  97), INT8_C( 109)),
+      simde_mm_set_epi8(INT8_C(-128), INT8_C( -82), INT8_C(  33), INT8_C(  32), INT8_C(-126), INT8_C( 101), INT8_C( 113), INT8_C( -34),
+                        INT8_C(  15), INT8_C(  26), INT8_C(  80), INT8_C( -43), INT8_C(-100), INT8_C(  10), INT8_C( -94), INT8_C(  26)),
+      simde_mm_set_epi8(INT8_C( -17), INT8_C(  23), INT8_C(  85), INT8_C(  64), INT8_C(  82), INT8_C( -65), INT8_C(  45), INT8_C(  20),
+                        INT8_C( -98), INT8_C(  71), INT8_C( 110), INT8_C(   7), INT8_C(  13), INT8_C( 127), INT8_C(  45), INT8_C(  -7)) },
+    { simde_mm_set_epi8(INT8_C(  13), INT8_C(   9), INT8_C(-127), INT8_C( -24), INT8_C( -63), INT8_C(  -6), INT8_C( 123), INT8_C( -28),
+                        INT8_C(  14), INT8_C(  30), INT8_C( -51), INT8_C(   2), INT8_C( -19), INT8_C( 124), INT8_C(  12), INT8_C( -67)),
+      simde_mm_set_epi8(INT8_C( 109), INT8_C(   8), INT8_C(  68), INT8_C( -62), INT8_C( 105), INT8_C( -25), INT8_C( 105), INT8_C(  63),
+                        INT8_C( -36), INT8_C(-122), INT8_C( -77), INT8_C( -45), INT8_C( -51), INT8_C( -67), INT8_C( -10), INT8_C(  19)),
+      simde_mm_set_epi8(INT8_C(-100), INT8_C( -34), INT8_C(   7), INT8_C( -41), INT8_C(-111), INT8_C( -11), INT8_C(  65), INT8_C(  33),
+                        INT8_C( -12), INT8_C( -92), INT8_C(  43), INT8_C(  55), INT8_C(  38), INT8_C( 118), INT8_C( 126), INT8_C(  36)) },
+    { simde_mm_set_epi8(INT8_C(  91), INT8_C(-110), INT8_C(-114), INT8_C(  44), INT8_C(-104), INT8_C( 125), INT8_C(-123), INT8_C( 125),
+                        INT8_C(  54), INT8_C(-127), INT8_C( -38), INT8_C( 127), INT8_C( 105), INT8_C(-109), INT8_C(   8), INT8_C(  45)),
+      simde_mm_set_epi8(INT8_C( -52), INT8_C( -72), INT8_C( 112), INT8_C(  33), INT8_C(  52), INT8_C(-104), INT8_C(  -9), INT8_C( -11),
+                        INT8_C( 108), INT8_C( 113), INT8_C( 110), INT8_C(  30), INT8_C( 108), INT8_C( -19), INT8_C(-127), INT8_C(  55)),
+      simde_mm_set_epi8(INT8_C( -93), INT8_C(  68), INT8_C(  60), INT8_C( -82), INT8_C( -93), INT8_C( 104), INT8_C( 117), INT8_C(  12),
+                        INT8_C(-116), INT8_C(  42), INT8_C(  87), INT8_C( -34), INT8_C( -94), INT8_C( 113), INT8_C( -37), INT8_C(  20)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesdec_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesdeclast_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C( -80), INT8_C( -70), INT8_C(-111), INT8_C( -28), INT8_C( 127), INT8_C(  98), INT8_C(   0), INT8_C( -20),
+                        INT8_C( -97), INT8_C(   7), INT8_C( -78), INT8_C( 122), INT8_C( 120), INT8_C(-122), INT8_C(-101), INT8_C(  90)),
+      simde_mm_set_epi8(INT8_C(  53), INT8_C( -13), INT8_C(   5), INT8_C( -80), INT8_C( -64), INT8_C(  -4), INT8_C(-110), INT8_C(  82),
+                        INT8_C( -57), INT8_C(  43), INT8_C(  76), INT8_C(  54), INT8_C( -48), INT8_C( -37), INT8_C( 127), INT8_C( -19)),
+      simde_mm_set_epi8(INT8_C( -12), INT8_C( -53), INT8_C(  87), INT8_C(  30), INT8_C(  60), INT8_C(  32), INT8_C( -84), INT8_C( -47),
+                        INT8_C( -84), INT8_C( -21), INT8_C( -92), INT8_C(-117), INT8_C( -66), INT8_C( 112), INT8_C( -45), INT8_C( -85)) },
+    { simde_mm_set_epi8(INT8_C(-114), INT8_C(  57), INT8_C( -72), INT8_C(  29), INT8_C( -25), INT8_C(  27), INT8_C( 125), INT8_C(   9),
+                        INT8_C( 122), INT8_C( -57), INT8_C(-113), INT8_C( -77), INT8_C( 115), INT8_C(  -1), INT8_C( -65), INT8_C( -10)),
+      simde_mm_set_epi8(INT8_C( -65), INT8_C( -53), INT8_C(  -1), INT8_C(  -1), INT8_C(  12), INT8_C( -68), INT8_C( -65), INT8_C(  32),
+                        INT8_C(  89), INT8_C( -90), INT8_C(-101), INT8_C( -95), INT8_C(  38), INT8_C( -51), INT8_C(  41), INT8_C( -77)),
+      simde_mm_set_epi8(INT8_C(  48), INT8_C(  -6), INT8_C( -20), INT8_C(  33), INT8_C( -22), INT8_C( -63), INT8_C( -52), INT8_C(  96),
+                        INT8_C( -23), INT8_C(  -3), INT8_C( 111), INT8_C( -22), INT8_C(-101), INT8_C(-119), INT8_C( -77), INT8_C( 101)) },
+    { simde_mm_set_epi8(INT8_C(  87), INT8_C(  42), INT8_C(  21), INT8_C( -19), INT8_C(  72), INT8_C( -77), INT8_C(  -3), INT8_C( -62),
+                        INT8_C(  45), INT8_C(  28), INT8_C( -30), INT8_C(-120), INT8_C(  86), INT8_C( -46), INT8_C(  14), INT8_C(  94)),
+      simde_mm_set_epi8(INT8_C(  23), INT8_C( -88), INT8_C( -20), INT8_C(-120), INT8_C( -32), INT8_C( -38), INT8_C(  11), INT8_C( -84),
+                        INT8_C(  50), INT8_C( -71), INT8_C(  17), INT8_C(  73), INT8_C(-108), INT8_C(  23), INT8_C( -86), INT8_C( -71)),
+      simde_mm_set_epi8(INT8_C( -82), INT8_C( 108), INT8_C( -51), INT8_C( -37), INT8_C(  58), INT8_C( -91), INT8_C(  48), INT8_C(   4),
+                        INT8_C( -26), INT8_C(  44), INT8_C( -58), INT8_C( -34), INT8_C( 110), INT8_C(  92), INT8_C(-123), INT8_C(  36)) },
+    { simde_mm_set_epi8(INT8_C( -68), INT8_C(  58), INT8_C(  91), INT8_C(  65), INT8_C(-102), INT8_C(  67), INT8_C( -81), INT8_C( -46),
+                        INT8_C(  12), INT8_C( -56), INT8_C(-114), INT8_C( -85), INT8_C(  47), INT8_C(-102), INT8_C( -44), INT8_C( -69)),
+      simde_mm_set_epi8(INT8_C( -25), INT8_C(  26), INT8_C( 117), INT8_C( 103), INT8_C( -19), INT8_C( -72), INT8_C( -58), INT8_C( 117),
+                        INT8_C( 111), INT8_C(  15), INT8_C(  52), INT8_C(  20), INT8_C( -60), INT8_C( 124), INT8_C(-100), INT8_C(  13)),
+      simde_mm_set_epi8(INT8_C( -87), INT8_C( -85), INT8_C( 110), INT8_C( -97), INT8_C(-107), INT8_C(-113), INT8_C(  32), INT8_C(  10),
+                        INT8_C(  88), INT8_C( -83), INT8_C(  45), INT8_C(  26), INT8_C(  69), INT8_C(  24), INT8_C( -53), INT8_C( -13)) },
+    { simde_mm_set_epi8(INT8_C( -29), INT8_C( 117), INT8_C(-125), INT8_C( 125), INT8_C( -88), INT8_C(  64), INT8_C( -39), INT8_C( -20),
+                        INT8_C(  99), INT8_C( 103), INT8_C(  76), INT8_C(  -8), INT8_C(  65), INT8_C( -18), INT8_C(-118), INT8_C( -71)),
+      simde_mm_set_epi8(INT8_C(  78), INT8_C(  -6), INT8_C(  88), INT8_C(  46), INT8_C( -32), INT8_C(  41), INT8_C( -33), INT8_C( -39),
+                        INT8_C(  87), INT8_C(-114), INT8_C( -78), INT8_C(  46), INT8_C(  30), INT8_C( -91), INT8_C( -93), INT8_C(  95)),
+      simde_mm_set_epi8(INT8_C( -74), INT8_C( -16), INT8_C( -67), INT8_C(  61), INT8_C( -83), INT8_C( -80), INT8_C(-126), INT8_C(  90),
+                        INT8_C(  56), INT8_C( -79), INT8_C( 125), INT8_C( -49), INT8_C(  30), INT8_C( -41), INT8_C( -30), INT8_C(-124)) },
+    { simde_mm_set_epi8(INT8_C(  46), INT8_C(  58), INT8_C(  78), INT8_C( -13), INT8_C(  73), INT8_C( 111), INT8_C(  65), INT8_C(  18),
+                        INT8_C( -13), INT8_C( -77), INT8_C(  99), INT8_C( -23), INT8_C(  56), INT8_C(  41), INT8_C(  90), INT8_C(  38)),
+      simde_mm_set_epi8(INT8_C(  70), INT8_C(  33), INT8_C( 127), INT8_C(  16), INT8_C(  78), INT8_C( -77), INT8_C(   0), INT8_C(  38),
+                        INT8_C( -72), INT8_C(   9), INT8_C( -41), INT8_C(-114), INT8_C(  42), INT8_C(  47), INT8_C(-101), INT8_C(  16)),
+      simde_mm_set_epi8(INT8_C(  48), INT8_C( 106), INT8_C(-121), INT8_C( 110), INT8_C(-115), INT8_C(  -1), INT8_C(   0), INT8_C(  31),
+                        INT8_C(  28), INT8_C( -85), INT8_C(-111), INT8_C( 101), INT8_C(  84), INT8_C(  41), INT8_C(  45), INT8_C(  51)) },
+    { simde_mm_set_epi8(INT8_C(  74), INT8_C(  58), INT8_C( -30), INT8_C(-101), INT8_C(  42), INT8_C( -16), INT8_C( -53), INT8_C( 121),
+                        INT8_C(-119), INT8_C(  71), INT8_C( -75), INT8_C(  -2), INT8_C(  -3), INT8_C( -90), INT8_C( -81), INT8_C( -90)),
+      simde_mm_set_epi8(INT8_C( -19), INT8_C(  10), INT8_C(   0), INT8_C( -21), INT8_C(  48), INT8_C(  43), INT8_C(  82), INT8_C( -58),
+                        INT8_C( -65), INT8_C( -48), INT8_C(  39), INT8_C(  59), INT8_C(  16), INT8_C( -90), INT8_C( -44), INT8_C( -81)),
+      simde_mm_set_epi8(INT8_C( -52), INT8_C(  28), INT8_C(  89), INT8_C(   3), INT8_C( 108), INT8_C( -18), INT8_C(-128), INT8_C( 105),
+                        INT8_C(  42), INT8_C( 114), INT8_C(  60), INT8_C(  55), INT8_C( -30), INT8_C( -79), INT8_C( -17), INT8_C( 106)) },
+    { simde_mm_set_epi8(INT8_C(  91), INT8_C( -20), INT8_C(  37), INT8_C( -87), INT8_C(-122), INT8_C( -86), INT8_C( 111), INT8_C( -56),
+                        INT8_C(  60), INT8_C(  10), INT8_C(  69), INT8_C( -83), INT8_C( 109), INT8_C(   1), INT8_C( 117), INT8_C( -29)),
+      simde_mm_set_epi8(INT8_C(  69), INT8_C(-102), INT8_C( -26), INT8_C( -40), INT8_C(  46), INT8_C( -16), INT8_C( -69), INT8_C(  69),
+                        INT8_C(-112), INT8_C(  75), INT8_C( -62), INT8_C( -35), INT8_C( -96), INT8_C( -21), INT8_C( -55), INT8_C(  23)),
+      simde_mm_set_epi8(INT8_C( -10), INT8_C(  57), INT8_C( -32), INT8_C( 111), INT8_C( 121), INT8_C(  -7), INT8_C( -45), INT8_C( -12),
+                        INT8_C(  76), INT8_C( -56), INT8_C(  -3), INT8_C( -59), INT8_C( -51), INT8_C(-119), INT8_C(  11), INT8_C(  90)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesdeclast_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesenc_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C( 113), INT8_C(  16), INT8_C( -73), INT8_C(  38), INT8_C(  50), INT8_C(  37), INT8_C(-115), INT8_C( -27),
+                        INT8_C( -40), INT8_C( -13), INT8_C(  11), INT8_C(  22), INT8_C(  99), INT8_C(  13), INT8_C(  43), INT8_C( 115)),
+      simde_mm_set_epi8(INT8_C( -77), INT8_C( -81), INT8_C( -74), INT8_C( 116), INT8_C( -46), INT8_C(  99), INT8_C( -12), INT8_C(   1),
+                        INT8_C(  84), INT8_C(  59), INT8_C(  20), INT8_C( -68), INT8_C( 121), INT8_C( -30), INT8_C(  31), INT8_C( -66)),
+      simde_mm_set_epi8(INT8_C(  11), INT8_C( -42), INT8_C(-116), INT8_C( -89), INT8_C(  30), INT8_C(   5), INT8_C( 103), INT8_C(  -2),
+                        INT8_C( -25), INT8_C( -72), INT8_C(  87), INT8_C( -28), INT8_C( -70), INT8_C( -58), INT8_C(  36), INT8_C(  90)) },
+    { simde_mm_set_epi8(INT8_C( 101), INT8_C(-107), INT8_C(  13), INT8_C(   5), INT8_C( 120), INT8_C( -16), INT8_C(   9), INT8_C( -50),
+                        INT8_C(-103), INT8_C(  42), INT8_C(  85), INT8_C(  20), INT8_C(  -6), INT8_C( -24), INT8_C(  19), INT8_C( -87)),
+      simde_mm_set_epi8(INT8_C( -11), INT8_C(-117), INT8_C( 106), INT8_C(  95), INT8_C(-100), INT8_C( 120), INT8_C( 109), INT8_C( -87),
+                        INT8_C(  87), INT8_C(   3), INT8_C(  87), INT8_C(  43), INT8_C(  -5), INT8_C(-128), INT8_C(  90), INT8_C(  93)),
+      simde_mm_set_epi8(INT8_C( -77), INT8_C(-109), INT8_C( 115), INT8_C(  87), INT8_C(-111), INT8_C(  32), INT8_C(  11), INT8_C( -77),
+                        INT8_C(  51), INT8_C( -37), INT8_C(  -4), INT8_C( -64), INT8_C( 127), INT8_C( 123), INT8_C( -88), INT8_C(  62)) },
+    { simde_mm_set_epi8(INT8_C(  80), INT8_C( -22), INT8_C( -68), INT8_C( 114), INT8_C(-121), INT8_C( -36), INT8_C(  78), INT8_C(  28),
+                        INT8_C( -88), INT8_C(  55), INT8_C( 121), INT8_C(  62), INT8_C( -98), INT8_C(-118), INT8_C( -41), INT8_C(  50)),
+      simde_mm_set_epi8(INT8_C(  72), INT8_C(-103), INT8_C(  -1), INT8_C(  17), INT8_C( -62), INT8_C(  -9), INT8_C(-106), INT8_C(  99),
+                        INT8_C(  77), INT8_C( -54), INT8_C(  29), INT8_C(  87), INT8_C(  -1), INT8_C(   3), INT8_C( -15), INT8_C(-128)),
+      simde_mm_set_epi8(INT8_C(  50), INT8_C( -63), INT8_C(   1), INT8_C(  14), INT8_C(  -7), INT8_C( -81), INT8_C(-128), INT8_C(  83),
+                        INT8_C(  62), INT8_C(  95), INT8_C( 104), INT8_C( -43), INT8_C(  12), INT8_C( 116), INT8_C( 103), INT8_C( -46)) },
+    { simde_mm_set_epi8(INT8_C( -53), INT8_C( 116), INT8_C( -54), INT8_C(  48), INT8_C( -77), INT8_C( -42), INT8_C(-119), INT8_C(  76),
+                        INT8_C(  22), INT8_C(  22), INT8_C( 108), INT8_C( 118), INT8_C( -83), INT8_C(  69), INT8_C(-127), INT8_C(-113)),
+      simde_mm_set_epi8(INT8_C(  40), INT8_C( -95), INT8_C( -30), INT8_C(  57), INT8_C(  51), INT8_C(-127), INT8_C( -19), INT8_C(  48),
+                        INT8_C(  33), INT8_C( 115), INT8_C(  85), INT8_C(-121), INT8_C(  24), INT8_C(-122), INT8_C(  -9), INT8_C(  94)),
+      simde_mm_set_epi8(INT8_C( -75), INT8_C(-112), INT8_C(  90), INT8_C(  15), INT8_C( -36), INT8_C( -55), INT8_C( -39), INT8_C( -41),
+                        INT8_C( 109), INT8_C( 119), INT8_C(   0), INT8_C(   2), INT8_C(  21), INT8_C( 115), INT8_C(  58), INT8_C( -95)) },
+    { simde_mm_set_epi8(INT8_C( -66), INT8_C( -60), INT8_C( 104), INT8_C(-115), INT8_C(  53), INT8_C( -73), INT8_C(-121), INT8_C(  47),
+                        INT8_C(   7), INT8_C(  76), INT8_C(  49), INT8_C( -74), INT8_C( -39), INT8_C( -17), INT8_C( -94), INT8_C( -22)),
+      simde_mm_set_epi8(INT8_C(  42), INT8_C(  62), INT8_C(  54), INT8_C(  64), INT8_C(  91), INT8_C( -16), INT8_C(  46), INT8_C(  38),
+                        INT8_C(  -8), INT8_C(  -3), INT8_C(   0), INT8_C(  22), INT8_C(  53), INT8_C(  26), INT8_C( -61), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C( -23), INT8_C( -86), INT8_C( -14), INT8_C(  11), INT8_C( 111), INT8_C(  81), INT8_C(  14), INT8_C( -39),
+                        INT8_C(  75), INT8_C( -61), INT8_C( 113), INT8_C(-102), INT8_C(-114), INT8_C(  -6), INT8_C( -97), INT8_C( -95)) },
+    { simde_mm_set_epi8(INT8_C( 107), INT8_C( 101), INT8_C(  -6), INT8_C( 104), INT8_C( -56), INT8_C(  18), INT8_C( -64), INT8_C( 117),
+                        INT8_C(  79), INT8_C( -89), INT8_C(-108), INT8_C(  85), INT8_C(  45), INT8_C( 124), INT8_C(-121), INT8_C(  -6)),
+      simde_mm_set_epi8(INT8_C( -16), INT8_C(-120), INT8_C(  37), INT8_C( 110), INT8_C( 113), INT8_C( -74), INT8_C( 121), INT8_C(  68),
+                        INT8_C( -80), INT8_C( -40), INT8_C(  56), INT8_C( -44), INT8_C( -12), INT8_C(  86), INT8_C(  88), INT8_C( -75)),
+      simde_mm_set_epi8(INT8_C( -65), INT8_C(  65), INT8_C(  66), INT8_C( 105), INT8_C( -29), INT8_C( -79), INT8_C(  10), INT8_C(-122),
+                        INT8_C( -13), INT8_C( 119), INT8_C( -92), INT8_C( 119), INT8_C(-106), INT8_C(  81), INT8_C(  14), INT8_C(  63)) },
+    { simde_mm_set_epi8(INT8_C( 127), INT8_C(  48), INT8_C(  99), INT8_C(  77), INT8_C(  35), INT8_C(-101), INT8_C(  54), INT8_C( -65),
+                        INT8_C( -76), INT8_C( -47), INT8_C( -65), INT8_C(  73), INT8_C(-122), INT8_C(-113), INT8_C( -60), INT8_C( -74)),
+      simde_mm_set_epi8(INT8_C( -65), INT8_C(   2), INT8_C(  61), INT8_C(  95), INT8_C( 113), INT8_C( -60), INT8_C(  15), INT8_C(  12),
+                        INT8_C(-102), INT8_C( -33), INT8_C(   7), INT8_C(  60), INT8_C( -89), INT8_C( -30), INT8_C(  79), INT8_C(  18)),
+      simde_mm_set_epi8(INT8_C( -17), INT8_C( -21), INT8_C(-126), INT8_C( -66), INT8_C( -32), INT8_C(  93), INT8_C( -14), INT8_C( -12),
+                        INT8_C(  94), INT8_C(  37), INT8_C( 126), INT8_C(   5), INT8_C( -42), INT8_C( -31), INT8_C(  -1), INT8_C(  80)) },
+    { simde_mm_set_epi8(INT8_C(  59), INT8_C( -74), INT8_C(  10), INT8_C(  31), INT8_C( 100), INT8_C(  73), INT8_C(  67), INT8_C(  26),
+                        INT8_C(  -8), INT8_C( -38), INT8_C(  -1), INT8_C(  74), INT8_C( -73), INT8_C( -31), INT8_C( -60), INT8_C(  18)),
+      simde_mm_set_epi8(INT8_C(-105), INT8_C(  75), INT8_C( -27), INT8_C(  71), INT8_C(  80), INT8_C(   5), INT8_C(   4), INT8_C( -78),
+                        INT8_C( -31), INT8_C( -74), INT8_C( -52), INT8_C(  63), INT8_C( -50), INT8_C(-118), INT8_C(  87), INT8_C(  28)),
+      simde_mm_set_epi8(INT8_C(   1), INT8_C(  -4), INT8_C( -89), INT8_C( -20), INT8_C( -80), INT8_C( -24), INT8_C(  58), INT8_C(  -3),
+                        INT8_C( -99), INT8_C(   6), INT8_C(  85), INT8_C(  65), INT8_C( 124), INT8_C(  30), INT8_C(  29), INT8_C( 118)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesenc_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesenclast_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i round_key;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C( 120), INT8_C( -76), INT8_C( 121), INT8_C(-121), INT8_C(-123), INT8_C(  83), INT8_C(-124), INT8_C(  63),
+                        INT8_C( 120), INT8_C(-122), INT8_C(  55), INT8_C( -67), INT8_C( -69), INT8_C(   4), INT8_C(  98), INT8_C(  59)),
+      simde_mm_set_epi8(INT8_C( -85), INT8_C(  89), INT8_C(  23), INT8_C( -88), INT8_C(  31), INT8_C(  15), INT8_C( -78), INT8_C( -82),
+                        INT8_C( -10), INT8_C(  20), INT8_C( -36), INT8_C(  64), INT8_C(  55), INT8_C( -47), INT8_C( -52), INT8_C(  -9)),
+      simde_mm_set_epi8(INT8_C(  60), INT8_C(  29), INT8_C( -67), INT8_C( -65), INT8_C( -93), INT8_C(  -3), INT8_C(   4), INT8_C( -37),
+                        INT8_C(  28), INT8_C(-103), INT8_C(-125), INT8_C(  58), INT8_C(-117), INT8_C(  60), INT8_C(  86), INT8_C(  21)) },
+    { simde_mm_set_epi8(INT8_C( -89), INT8_C( -27), INT8_C(-111), INT8_C( -24), INT8_C(  90), INT8_C(-124), INT8_C(   9), INT8_C(   7),
+                        INT8_C(  16), INT8_C( 125), INT8_C( -71), INT8_C( 112), INT8_C( -10), INT8_C(  30), INT8_C( -58), INT8_C(  75)),
+      simde_mm_set_epi8(INT8_C( 124), INT8_C( -73), INT8_C( -48), INT8_C( -96), INT8_C( -23), INT8_C( -76), INT8_C(  70), INT8_C( -44),
+                        INT8_C(  66), INT8_C( -24), INT8_C( 127), INT8_C( -86), INT8_C( -21), INT8_C( -71), INT8_C( -96), INT8_C( -43)),
+      simde_mm_set_epi8(INT8_C( -62), INT8_C(  72), INT8_C( 100), INT8_C(  59), INT8_C(  35), INT8_C( -58), INT8_C( -57), INT8_C(  17),
+                        INT8_C(   0), INT8_C(  49), INT8_C( 126), INT8_C(  -5), INT8_C( -73), INT8_C( -26), INT8_C( -10), INT8_C( 102)) },
+    { simde_mm_set_epi8(INT8_C(  23), INT8_C(  40), INT8_C(  41), INT8_C(  65), INT8_C( 119), INT8_C(  91), INT8_C( -47), INT8_C(  47),
+                        INT8_C(-109), INT8_C( -76), INT8_C(  17), INT8_C(  85), INT8_C( 123), INT8_C(  30), INT8_C(  27), INT8_C(  89)),
+      simde_mm_set_epi8(INT8_C(-100), INT8_C( -58), INT8_C( -45), INT8_C(-114), INT8_C( -69), INT8_C(  77), INT8_C( -61), INT8_C(-105),
+                        INT8_C(  29), INT8_C( 110), INT8_C( -75), INT8_C( 108), INT8_C( -61), INT8_C(  -2), INT8_C( -51), INT8_C(  77)),
+      simde_mm_set_epi8(INT8_C( 105), INT8_C(  75), INT8_C( 124), INT8_C(  13), INT8_C( 103), INT8_C(  63), INT8_C( 102), INT8_C(-126),
+                        INT8_C(  60), INT8_C(  90), INT8_C(-117), INT8_C(-112), INT8_C(  51), INT8_C( -57), INT8_C(  79), INT8_C(-122)) },
+    { simde_mm_set_epi8(INT8_C(  64), INT8_C(  72), INT8_C(  17), INT8_C(-127), INT8_C( -11), INT8_C(  79), INT8_C(  27), INT8_C( 107),
+                        INT8_C(-109), INT8_C( -25), INT8_C( -16), INT8_C(-100), INT8_C( 118), INT8_C(-103), INT8_C(  93), INT8_C( -48)),
+      simde_mm_set_epi8(INT8_C(  43), INT8_C(  89), INT8_C( -95), INT8_C(  16), INT8_C(   6), INT8_C(  -2), INT8_C(  16), INT8_C( -94),
+                        INT8_C(  -4), INT8_C(  16), INT8_C(  83), INT8_C( 106), INT8_C(  57), INT8_C(  52), INT8_C(  63), INT8_C( -99)),
+      simde_mm_set_epi8(INT8_C( -51), INT8_C( -51), INT8_C( -19), INT8_C(  28), INT8_C( -38), INT8_C(  16), INT8_C(-110), INT8_C( -35),
+                        INT8_C( -60), INT8_C(  66), INT8_C(  -4), INT8_C( -76), INT8_C(  48), INT8_C( -80), INT8_C( -77), INT8_C( -19)) },
+    { simde_mm_set_epi8(INT8_C(  72), INT8_C(  47), INT8_C( 123), INT8_C( 119), INT8_C( -13), INT8_C( -76), INT8_C(  47), INT8_C( -53),
+                        INT8_C( -78), INT8_C(  93), INT8_C( -32), INT8_C(  75), INT8_C(  83), INT8_C( 101), INT8_C(-124), INT8_C(   3)),
+      simde_mm_set_epi8(INT8_C( -68), INT8_C(  30), INT8_C(  -5), INT8_C( -76), INT8_C( -48), INT8_C(-106), INT8_C(  19), INT8_C(  -2),
+                        INT8_C( -86), INT8_C(  25), INT8_C( -17), INT8_C(  72), INT8_C( -34), INT8_C(   9), INT8_C( -43), INT8_C(  84)),
+      simde_mm_set_epi8(INT8_C( -79), INT8_C(  82), INT8_C( -92), INT8_C(  65), INT8_C( -25), INT8_C( -37), INT8_C(  50), INT8_C( -31),
+                        INT8_C(  71), INT8_C(  12), INT8_C(  -6), INT8_C(  -5), INT8_C(-116), INT8_C(-124), INT8_C(  52), INT8_C(  47)) },
+    { simde_mm_set_epi8(INT8_C(  33), INT8_C(   3), INT8_C( -90), INT8_C( -17), INT8_C( 111), INT8_C( 123), INT8_C( -54), INT8_C(  25),
+                        INT8_C(   1), INT8_C( 100), INT8_C(  12), INT8_C(  -3), INT8_C(  94), INT8_C( 126), INT8_C(   0), INT8_C(  89)),
+      simde_mm_set_epi8(INT8_C(  71), INT8_C( -49), INT8_C( -67), INT8_C( -44), INT8_C(  68), INT8_C( 102), INT8_C( -43), INT8_C( -70),
+                        INT8_C( -70), INT8_C(  89), INT8_C( -37), INT8_C( -65), INT8_C(  33), INT8_C(-114), INT8_C(-101), INT8_C( -51)),
+      simde_mm_set_epi8(INT8_C( -17), INT8_C(-116), INT8_C( -34), INT8_C(  11), INT8_C(  56), INT8_C(-107), INT8_C( -15), INT8_C( 110),
+                        INT8_C( -30), INT8_C(  34), INT8_C( -81), INT8_C( -21), INT8_C( -36), INT8_C( -81), INT8_C( 101), INT8_C(   6)) },
+    { simde_mm_set_epi8(INT8_C(  29), INT8_C(  87), INT8_C( -41), INT8_C(  10), INT8_C( -66), INT8_C( 108), INT8_C(  46), INT8_C( -68),
+                        INT8_C(  15), INT8_C( 113), INT8_C(-128), INT8_C( -22), INT8_C(  66), INT8_C( -50), INT8_C(  54), INT8_C(-111)),
+      simde_mm_set_epi8(INT8_C(-100), INT8_C( -62), INT8_C( -39), INT8_C(  66), INT8_C( -40), INT8_C( -84), INT8_C(-100), INT8_C(  18),
+                        INT8_C(  61), INT8_C( -12), INT8_C(-122), INT8_C(  95), INT8_C(   6), INT8_C(  14), INT8_C( -39), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(  50), INT8_C(  97), INT8_C( -36), INT8_C(  37), INT8_C( -82), INT8_C(  39), INT8_C(-110), INT8_C( 119),
+                        INT8_C(  17), INT8_C( -81), INT8_C( -73), INT8_C( -40), INT8_C( -94), INT8_C(  94), INT8_C(  20), INT8_C(  96)) },
+    { simde_mm_set_epi8(INT8_C( -95), INT8_C( -51), INT8_C(  93), INT8_C(  22), INT8_C( 108), INT8_C( 102), INT8_C( 114), INT8_C(  41),
+                        INT8_C( 104), INT8_C( -62), INT8_C(-100), INT8_C(  34), INT8_C( -26), INT8_C( -20), INT8_C(-127), INT8_C( -86)),
+      simde_mm_set_epi8(INT8_C(  63), INT8_C(  62), INT8_C(  66), INT8_C( -67), INT8_C( -77), INT8_C(  29), INT8_C( 109), INT8_C( -28),
+                        INT8_C(-107), INT8_C(  12), INT8_C(  97), INT8_C( 117), INT8_C( -66), INT8_C( 125), INT8_C(  20), INT8_C(-115)),
+      simde_mm_set_epi8(INT8_C( 111), INT8_C(  27), INT8_C(  78), INT8_C(  -6), INT8_C( -10), INT8_C( -45), INT8_C(  33), INT8_C(  65),
+                        INT8_C(  27), INT8_C( -79), INT8_C(  33), INT8_C( -26), INT8_C(-116), INT8_C(  78), INT8_C( -54), INT8_C(  33)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesenclast_si128(test_vec[i].a, test_vec[i].round_key);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aesimc_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C( 104), INT8_C(-110), INT8_C( -14), INT8_C(  79), INT8_C(   7), INT8_C(  53), INT8_C(   4), INT8_C( -93),
+                        INT8_C( -72), INT8_C( -24), INT8_C(  98), INT8_C(  14), INT8_C(  -2), INT8_C( -30), INT8_C( -82), INT8_C(  63)),
+      simde_mm_set_epi8(INT8_C(  49), INT8_C( 109), INT8_C(  37), INT8_C(  62), INT8_C(   9), INT8_C( 110), INT8_C(  59), INT8_C( -55),
+                        INT8_C(  77), INT8_C(  58), INT8_C( -17), INT8_C( -92), INT8_C( -75), INT8_C(  10), INT8_C( -28), INT8_C( -42)) },
+    { simde_mm_set_epi8(INT8_C(  54), INT8_C( -17), INT8_C( -10), INT8_C(  -2), INT8_C(  66), INT8_C(  66), INT8_C(-120), INT8_C( -90),
+                        INT8_C( 127), INT8_C( -81), INT8_C(  77), INT8_C(  80), INT8_C( -72), INT8_C(  58), INT8_C(  38), INT8_C( 106)),
+      simde_mm_set_epi8(INT8_C(-109), INT8_C(   1), INT8_C( -22), INT8_C( -87), INT8_C( -47), INT8_C( -70), INT8_C(  71), INT8_C(   2),
+                        INT8_C(  22), INT8_C(  58), INT8_C( -91), INT8_C(  68), INT8_C( -83), INT8_C(-102), INT8_C( -76), INT8_C(  77)) },
+    { simde_mm_set_epi8(INT8_C(-125), INT8_C(  58), INT8_C(  99), INT8_C( -70), INT8_C(-111), INT8_C(  49), INT8_C(  52), INT8_C(  63),
+                        INT8_C( 116), INT8_C(  54), INT8_C( -96), INT8_C(  42), INT8_C( -73), INT8_C(  30), INT8_C( -28), INT8_C(  55)),
+      simde_mm_set_epi8(INT8_C(  17), INT8_C(  40), INT8_C(  49), INT8_C( 104), INT8_C( -16), INT8_C( -42), INT8_C(  24), INT8_C(-107),
+                        INT8_C( 103), INT8_C(  16), INT8_C(  56), INT8_C(-121), INT8_C( 124), INT8_C( 116), INT8_C( -37), INT8_C( -87)) },
+    { simde_mm_set_epi8(INT8_C( -56), INT8_C( -71), INT8_C(  62), INT8_C(   0), INT8_C(  72), INT8_C(-104), INT8_C( -45), INT8_C(  36),
+                        INT8_C(-103), INT8_C(  44), INT8_C( -74), INT8_C(  76), INT8_C(  -3), INT8_C(  -9), INT8_C( -71), INT8_C(-105)),
+      simde_mm_set_epi8(INT8_C( -73), INT8_C(-120), INT8_C( -33), INT8_C( -81), INT8_C( -50), INT8_C( -31), INT8_C(  27), INT8_C(  19),
+                        INT8_C(-107), INT8_C( -57), INT8_C(  36), INT8_C(  57), INT8_C(  61), INT8_C( 103), INT8_C(  49), INT8_C(  79)) },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C(-118), INT8_C(-102), INT8_C( 117), INT8_C( -67), INT8_C( -85), INT8_C( -80), INT8_C(  85),
+                        INT8_C( 100), INT8_C(  93), INT8_C(  45), INT8_C( -50), INT8_C(  35), INT8_C(  93), INT8_C( -85), INT8_C(-126)),
+      simde_mm_set_epi8(INT8_C(-107), INT8_C( -61), INT8_C(  94), INT8_C( -19), INT8_C( 104), INT8_C( 120), INT8_C(-104), INT8_C( 123),
+                        INT8_C(  68), INT8_C(   5), INT8_C( -94), INT8_C(  57), INT8_C( -75), INT8_C(  41), INT8_C(-109), INT8_C(  88)) },
+    { simde_mm_set_epi8(INT8_C(   8), INT8_C( 125), INT8_C(  99), INT8_C(   3), INT8_C(-109), INT8_C( 121), INT8_C( -41), INT8_C(-111),
+                        INT8_C(-103), INT8_C(  85), INT8_C(  49), INT8_C(  -9), INT8_C( -18), INT8_C( -36), INT8_C(  82), INT8_C( 117)),
+      simde_mm_set_epi8(INT8_C(  20), INT8_C( -55), INT8_C(  85), INT8_C( -99), INT8_C(  39), INT8_C(-128), INT8_C(  32), INT8_C(  43),
+                        INT8_C(-119), INT8_C(  50), INT8_C(  53), INT8_C(-124), INT8_C( -72), INT8_C(-105), INT8_C(  46), INT8_C(  20)) },
+    { simde_mm_set_epi8(INT8_C( -22), INT8_C(   6), INT8_C( -92), INT8_C( 100), INT8_C(  54), INT8_C(  15), INT8_C( 118), INT8_C(  62),
+                        INT8_C( -13), INT8_C( -55), INT8_C( -54), INT8_C(  -1), INT8_C( -80), INT8_C(  36), INT8_C( -32), INT8_C( 126)),
+      simde_mm_set_epi8(INT8_C(-103), INT8_C(   1), INT8_C(-113), INT8_C(  59), INT8_C( -23), INT8_C( 109), INT8_C(  75), INT8_C( -66),
+                        INT8_C( 120), INT8_C(  18), INT8_C(  95), INT8_C(  58), INT8_C(  54), INT8_C(  62), INT8_C( 114), INT8_C( 112)) },
+    { simde_mm_set_epi8(INT8_C( -42), INT8_C( 106), INT8_C( 116), INT8_C( -76), INT8_C(  56), INT8_C(  -3), INT8_C(   9), INT8_C(-100),
+                        INT8_C(  83), INT8_C(  54), INT8_C(  16), INT8_C(  18), INT8_C( -35), INT8_C( -35), INT8_C(  39), INT8_C(  82)),
+      simde_mm_set_epi8(INT8_C(  29), INT8_C( -19), INT8_C(  71), INT8_C( -53), INT8_C(  73), INT8_C(  21), INT8_C( -40), INT8_C( -44),
+                        INT8_C( -76), INT8_C(  30), INT8_C(  57), INT8_C( -12), INT8_C( -19), INT8_C(  39), INT8_C(  -3), INT8_C(  66)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aesimc_si128(test_vec[i].a);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_aeskeygenassist_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  37), INT8_C(  47), INT8_C(  44), INT8_C(  50), INT8_C( -76), INT8_C(  17), INT8_C( 102),
+                        INT8_C(-115), INT8_C(  84), INT8_C(-105), INT8_C( -74), INT8_C( -25), INT8_C( -29), INT8_C(  20), INT8_C(-113)),
+      simde_mm_set_epi8(INT8_C( 113), INT8_C(  99), INT8_C(  63), INT8_C(  14), INT8_C(  99), INT8_C(  63), INT8_C(  21), INT8_C( 113),
+                        INT8_C(  78), INT8_C(  93), INT8_C(  32), INT8_C(-109), INT8_C(  93), INT8_C(  32), INT8_C(-120), INT8_C(  78)) },
+    { simde_mm_set_epi8(INT8_C( -92), INT8_C(  71), INT8_C( -76), INT8_C( -64), INT8_C( 119), INT8_C(  19), INT8_C( -78), INT8_C(   5),
+                        INT8_C( -12), INT8_C( -37), INT8_C( -93), INT8_C( -37), INT8_C(-124), INT8_C( 113), INT8_C( -32), INT8_C( -60)),
+      simde_mm_set_epi8(INT8_C( -70), INT8_C(  73), INT8_C( -96), INT8_C(-106), INT8_C(  73), INT8_C( -96), INT8_C(-115), INT8_C( -70),
+                        INT8_C( -71), INT8_C( -65), INT8_C( -71), INT8_C(  17), INT8_C( -65), INT8_C( -71), INT8_C(  10), INT8_C( -71)) },
+    { simde_mm_set_epi8(INT8_C( 124), INT8_C(  61), INT8_C(-112), INT8_C(  66), INT8_C(-125), INT8_C(  50), INT8_C( -69), INT8_C(   9),
+                        INT8_C(  88), INT8_C( -42), INT8_C(-113), INT8_C( -11), INT8_C(  45), INT8_C(  19), INT8_C( -76), INT8_C(  33)),
+      simde_mm_set_epi8(INT8_C(  44), INT8_C(  16), INT8_C(  39), INT8_C( 123), INT8_C(  16), INT8_C(  39), INT8_C(  96), INT8_C(  44),
+                        INT8_C( -26), INT8_C( 106), INT8_C( -10), INT8_C( 104), INT8_C( 106), INT8_C( -10), INT8_C( 115), INT8_C( -26)) },
+    { simde_mm_set_epi8(INT8_C( -71), INT8_C(   8), INT8_C(  20), INT8_C( 118), INT8_C(  53), INT8_C(-120), INT8_C( -39), INT8_C(-121),
+                        INT8_C(-104), INT8_C( -32), INT8_C(-112), INT8_C(  82), INT8_C( -27), INT8_C(-123), INT8_C(  60), INT8_C(  63)),
+      simde_mm_set_epi8(INT8_C(  56), INT8_C(  86), INT8_C(  48), INT8_C( -31), INT8_C(  86), INT8_C(  48), INT8_C(  -6), INT8_C(  56),
+                        INT8_C(   0), INT8_C(  70), INT8_C( -31), INT8_C( 123), INT8_C(  70), INT8_C( -31), INT8_C(  96), INT8_C(   0)) },
+    { simde_mm_set_epi8(INT8_C(  33), INT8_C(  62), INT8_C(  73), INT8_C(  -9), INT8_C(  85), INT8_C( -55), INT8_C( -82), INT8_C( 103),
+                        INT8_C(   4), INT8_C(  52), INT8_C( -98), INT8_C( -88), INT8_C(  51), INT8_C(  13), INT8_C(  73), INT8_C( -12)),
+      simde_mm_set_epi8(INT8_C( 104), INT8_C(  -3), INT8_C( -78), INT8_C(  32), INT8_C(  -3), INT8_C( -78), INT8_C(  59), INT8_C( 104),
+                        INT8_C( -62), INT8_C( -14), INT8_C(  24), INT8_C(  16), INT8_C( -14), INT8_C(  24), INT8_C(  11), INT8_C( -62)) },
+    { simde_mm_set_epi8(INT8_C( 105), INT8_C( -96), INT8_C( -36), INT8_C(  32), INT8_C( -84), INT8_C( -13), INT8_C( 124), INT8_C( -78),
+                        INT8_C( -83), INT8_C( -63), INT8_C(  91), INT8_C(-126), INT8_C( 117), INT8_C(  51), INT8_C(  68), INT8_C(  -5)),
+      simde_mm_set_epi8(INT8_C( -73), INT8_C(  -7), INT8_C( -32), INT8_C( -99), INT8_C(  -7), INT8_C( -32), INT8_C(-122), INT8_C( -73),
+                        INT8_C(  19), INT8_C(-107), INT8_C( 120), INT8_C(  34), INT8_C(-107), INT8_C( 120), INT8_C(  57), INT8_C(  19)) },
+    { simde_mm_set_epi8(INT8_C(  -8), INT8_C( -21), INT8_C(  50), INT8_C(   4), INT8_C( 123), INT8_C( -69), INT8_C( -49), INT8_C( -26),
+                        INT8_C( 114), INT8_C(-101), INT8_C(  -3), INT8_C( -22), INT8_C(  83), INT8_C( 117), INT8_C( -10), INT8_C( -53)),
+      simde_mm_set_epi8(INT8_C( -14), INT8_C(  65), INT8_C( -23), INT8_C(  56), INT8_C(  65), INT8_C( -23), INT8_C(  35), INT8_C( -14),
+                        INT8_C(-121), INT8_C(  64), INT8_C(  20), INT8_C(  79), INT8_C(  64), INT8_C(  20), INT8_C(  84), INT8_C(-121)) },
+    { simde_mm_set_epi8(INT8_C(  65), INT8_C(   3), INT8_C(  27), INT8_C( -57), INT8_C(  95), INT8_C(  85), INT8_C( -68), INT8_C( -70),
+                        INT8_C(  75), INT8_C(-123), INT8_C(  34), INT8_C(-114), INT8_C( -25), INT8_C( -79), INT8_C(-127), INT8_C(  -7)),
+      simde_mm_set_epi8(INT8_C( -58), INT8_C(-125), INT8_C( 123), INT8_C( -76), INT8_C(-125), INT8_C( 123), INT8_C( -81), INT8_C( -58),
+                        INT8_C(  25), INT8_C( -77), INT8_C(-105), INT8_C(-120), INT8_C( -77), INT8_C(-105), INT8_C(-109), INT8_C(  25)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_aeskeygenassist_si128(test_vec[i].a, 0x1b);
+    simde_assert_m128i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_AES_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_AES_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm_aesdec_si128),
+  SIMDE_TESTS_DEFINE_TEST(mm_aesdeclast_si128),
+  SIMDE_TESTS_DEFINE_TEST(mm_aesenc_si128),
+  SIMDE_TESTS_DEFINE_TEST(mm_aesenclast_si128),
+  SIMDE_TESTS_DEFINE_TEST(mm_aesimc_si128),
+  SIMDE_TESTS_DEFINE_TEST(mm_aeskeygenassist_si128),
+
+#endif /* defined(SIMDE_AES_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
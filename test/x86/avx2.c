@@ -27,6 +27,287 @@
 
 #if defined(SIMDE_AVX2_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
 
+static MunitResult
+test_simde_mm256_abs_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(INT8_C(  -9), INT8_C(  41), INT8_C(-118), INT8_C( 112),
+                           INT8_C(  -3), INT8_C(  41), INT8_C( -10), INT8_C(  80),
+                           INT8_C(   0), INT8_C(  -3), INT8_C( -36), INT8_C(  86),
+                           INT8_C(  12), INT8_C( -19), INT8_C( -30), INT8_C(  28),
+                           INT8_C( -67), INT8_C(  37), INT8_C( 119), INT8_C( -12),
+                           INT8_C(  74), INT8_C(  26), INT8_C( -55), INT8_C( 121),
+                           INT8_C( -98), INT8_C(  78), INT8_C(  48), INT8_C( -45),
+                           INT8_C(-120), INT8_C(  10), INT8_C( -31), INT8_C(  17)),
+      simde_mm256_set_epi8(INT8_C(   9), INT8_C(  41), INT8_C( 118), INT8_C( 112),
+                           INT8_C(   3), INT8_C(  41), INT8_C(  10), INT8_C(  80),
+                           INT8_C(   0), INT8_C(   3), INT8_C(  36), INT8_C(  86),
+                           INT8_C(  12), INT8_C(  19), INT8_C(  30), INT8_C(  28),
+                           INT8_C(  67), INT8_C(  37), INT8_C( 119), INT8_C(  12),
+                           INT8_C(  74), INT8_C(  26), INT8_C(  55), INT8_C( 121),
+                           INT8_C(  98), INT8_C(  78), INT8_C(  48), INT8_C(  45),
+                           INT8_C( 120), INT8_C(  10), INT8_C(  31), INT8_C(  17)) },
+    { simde_mm256_set_epi8(INT8_C( 119), INT8_C(   9), INT8_C( -14), INT8_C( -89),
+                           INT8_C( -42), INT8_C(  26), INT8_C(  40), INT8_C( 126),
+                           INT8_C(  38), INT8_C( -35), INT8_C( -66), INT8_C(  90),
+                           INT8_C( -87), INT8_C( -62), INT8_C(-113), INT8_C(  79),
+                           INT8_C( -60), INT8_C( -59), INT8_C(  83), INT8_C(  33),
+                           INT8_C( -64), INT8_C(  80), INT8_C(-107), INT8_C(   1),
+                           INT8_C( -22), INT8_C( -63), INT8_C(  43), INT8_C(   7),
+                           INT8_C( -52), INT8_C( -29), INT8_C(  73), INT8_C( -14)),
+      simde_mm256_set_epi8(INT8_C( 119), INT8_C(   9), INT8_C(  14), INT8_C(  89),
+                           INT8_C(  42), INT8_C(  26), INT8_C(  40), INT8_C( 126),
+                           INT8_C(  38), INT8_C(  35), INT8_C(  66), INT8_C(  90),
+                           INT8_C(  87), INT8_C(  62), INT8_C( 113), INT8_C(  79),
+                           INT8_C(  60), INT8_C(  59), INT8_C(  83), INT8_C(  33),
+                           INT8_C(  64), INT8_C(  80), INT8_C( 107), INT8_C(   1),
+                           INT8_C(  22), INT8_C(  63), INT8_C(  43), INT8_C(   7),
+                           INT8_C(  52), INT8_C(  29), INT8_C(  73), INT8_C(  14)) },
+    { simde_mm256_set_epi8(INT8_C( -63), INT8_C(  19), INT8_C(  67), INT8_C( -36),
+                           INT8_C(  76), INT8_C( -27), INT8_C(  61), INT8_C( -12),
+                           INT8_C( -91), INT8_C(   3), INT8_C(  89), INT8_C( -82),
+                           INT8_C(  34), INT8_C(  78), INT8_C(  78), INT8_C( -69),
+                           INT8_C(  31), INT8_C(  13), INT8_C(  47), INT8_C( -92),
+                           INT8_C( -81), INT8_C(   9), INT8_C(  31), INT8_C( -36),
+                           INT8_C(   8), INT8_C(-123), INT8_C(  81), INT8_C( 107),
+                           INT8_C(-104), INT8_C( -73), INT8_C( -62), INT8_C( -63)),
+      simde_mm256_set_epi8(INT8_C(  63), INT8_C(  19), INT8_C(  67), INT8_C(  36),
+                           INT8_C(  76), INT8_C(  27), INT8_C(  61), INT8_C(  12),
+                           INT8_C(  91), INT8_C(   3), INT8_C(  89), INT8_C(  82),
+                           INT8_C(  34), INT8_C(  78), INT8_C(  78), INT8_C(  69),
+                           INT8_C(  31), INT8_C(  13), INT8_C(  47), INT8_C(  92),
+                           INT8_C(  81), INT8_C(   9), INT8_C(  31), INT8_C(  36),
+                           INT8_C(   8), INT8_C( 123), INT8_C(  81), INT8_C( 107),
+                           INT8_C( 104), INT8_C(  73), INT8_C(  62), INT8_C(  63)) },
+    { simde_mm256_set_epi8(INT8_C( 111), INT8_C(  21), INT8_C( -86), INT8_C( -21),
+                           INT8_C( -48), INT8_C(  12), INT8_C( -17), INT8_C(-128),
+                           INT8_C(  94), INT8_C(  76), INT8_C(   4), INT8_C(-123),
+                           INT8_C(  95), INT8_C( -42), INT8_C( -93), INT8_C( 121),
+                           INT8_C(-126), INT8_C( 112), INT8_C(  -1), INT8_C( -54),
+                           INT8_C(  -5), INT8_C(-108), INT8_C(  -3), INT8_C(-106),
+                           INT8_C( -25), INT8_C(-100), INT8_C( 100), INT8_C( -35),
+                           INT8_C( -80), INT8_C( -35), INT8_C(  79), INT8_C(-102)),
+      simde_mm256_set_epi8(INT8_C( 111), INT8_C(  21), INT8_C(  86), INT8_C(  21),
+                           INT8_C(  48), INT8_C(  12), INT8_C(  17), INT8_C(-128),
+                           INT8_C(  94), INT8_C(  76), INT8_C(   4), INT8_C( 123),
+                           INT8_C(  95), INT8_C(  42), INT8_C(  93), INT8_C( 121),
+                           INT8_C( 126), INT8_C( 112), INT8_C(   1), INT8_C(  54),
+                           INT8_C(   5), INT8_C( 108), INT8_C(   3), INT8_C( 106),
+                           INT8_C(  25), INT8_C( 100), INT8_C( 100), INT8_C(  35),
+                           INT8_C(  80), INT8_C(  35), INT8_C(  79), INT8_C( 102)) },
+    { simde_mm256_set_epi8(INT8_C( -54), INT8_C(  54), INT8_C(  -5), INT8_C(  37),
+                           INT8_C( -84), INT8_C(-109), INT8_C( -48), INT8_C(  72),
+                           INT8_C( -69), INT8_C(  89), INT8_C( 107), INT8_C(  13),
+                           INT8_C( -32), INT8_C(  52), INT8_C(  52), INT8_C( -67),
+                           INT8_C(  55), INT8_C(  61), INT8_C( -42), INT8_C(-115),
+                           INT8_C( -18), INT8_C(  62), INT8_C(  68), INT8_C( -17),
+                           INT8_C(-124), INT8_C( -75), INT8_C(   7), INT8_C(-116),
+                           INT8_C( -61), INT8_C( 103), INT8_C(-104), INT8_C( -73)),
+      simde_mm256_set_epi8(INT8_C(  54), INT8_C(  54), INT8_C(   5), INT8_C(  37),
+                           INT8_C(  84), INT8_C( 109), INT8_C(  48), INT8_C(  72),
+                           INT8_C(  69), INT8_C(  89), INT8_C( 107), INT8_C(  13),
+                           INT8_C(  32), INT8_C(  52), INT8_C(  52), INT8_C(  67),
+                           INT8_C(  55), INT8_C(  61), INT8_C(  42), INT8_C( 115),
+                           INT8_C(  18), INT8_C(  62), INT8_C(  68), INT8_C(  17),
+                           INT8_C( 124), INT8_C(  75), INT8_C(   7), INT8_C( 116),
+                           INT8_C(  61), INT8_C( 103), INT8_C( 104), INT8_C(  73)) },
+    { simde_mm256_set_epi8(INT8_C( -51), INT8_C( -36), INT8_C(  38), INT8_C(  20),
+                           INT8_C( -57), INT8_C( -34), INT8_C(  54), INT8_C( -81),
+                           INT8_C(   3), INT8_C( -44), INT8_C( -67), INT8_C( -20),
+                           INT8_C(  -5), INT8_C( -22), INT8_C(  44), INT8_C( 106),
+                           INT8_C(-107), INT8_C(  -6), INT8_C(  96), INT8_C( 106),
+                           INT8_C(  34), INT8_C(-105), INT8_C( -70), INT8_C( -17),
+                           INT8_C(   9), INT8_C( -62), INT8_C( 112), INT8_C( -45),
+                           INT8_C( 113), INT8_C(   3), INT8_C( 113), INT8_C(   5)),
+      simde_mm256_set_epi8(INT8_C(  51), INT8_C(  36), INT8_C(  38), INT8_C(  20),
+                           INT8_C(  57), INT8_C(  34), INT8_C(  54), INT8_C(  81),
+                           INT8_C(   3), INT8_C(  44), INT8_C(  67), INT8_C(  20),
+                           INT8_C(   5), INT8_C(  22), INT8_C(  44), INT8_C( 106),
+                           INT8_C( 107), INT8_C(   6), INT8_C(  96), INT8_C( 106),
+                           INT8_C(  34), INT8_C( 105), INT8_C(  70), INT8_C(  17),
+                           INT8_C(   9), INT8_C(  62), INT8_C( 112), INT8_C(  45),
+                           INT8_C( 113), INT8_C(   3), INT8_C( 113), INT8_C(   5)) },
+    { simde_mm256_set_epi8(INT8_C(  75), INT8_C( 103), INT8_C(  95), INT8_C( 123),
+                           INT8_C(  -4), INT8_C(  22), INT8_C(-101), INT8_C( -96),
+                           INT8_C( -89), INT8_C(  89), INT8_C(  43), INT8_C(  45),
+                           INT8_C( -76), INT8_C(-113), INT8_C(  -6), INT8_C(  60),
+                           INT8_C( -47), INT8_C(  87), INT8_C( 115), INT8_C(  51),
+                           INT8_C( 127), INT8_C( -66), INT8_C( 104), INT8_C(  86),
+                           INT8_C( 102), INT8_C( -63), INT8_C( -10), INT8_C( -85),
+                           INT8_C(-122), INT8_C(  66), INT8_C(  14), INT8_C(  64)),
+      simde_mm256_set_epi8(INT8_C(  75), INT8_C( 103), INT8_C(  95), INT8_C( 123),
+                           INT8_C(   4), INT8_C(  22), INT8_C( 101), INT8_C(  96),
+                           INT8_C(  89), INT8_C(  89), INT8_C(  43), INT8_C(  45),
+                           INT8_C(  76), INT8_C( 113), INT8_C(   6), INT8_C(  60),
+                           INT8_C(  47), INT8_C(  87), INT8_C( 115), INT8_C(  51),
+                           INT8_C( 127), INT8_C(  66), INT8_C( 104), INT8_C(  86),
+                           INT8_C( 102), INT8_C(  63), INT8_C(  10), INT8_C(  85),
+                           INT8_C( 122), INT8_C(  66), INT8_C(  14), INT8_C(  64)) },
+    { simde_mm256_set_epi8(INT8_C( -34), INT8_C(  28), INT8_C( -21), INT8_C( 117),
+                           INT8_C( 117), INT8_C( -94), INT8_C(  48), INT8_C(  20),
+                           INT8_C(  54), INT8_C(-101), INT8_C(   5), INT8_C(-114),
+                           INT8_C( -45), INT8_C(  -8), INT8_C( -15), INT8_C(-112),
+                           INT8_C( -95), INT8_C( 127), INT8_C(  43), INT8_C( -72),
+                           INT8_C( -11), INT8_C(  73), INT8_C( -90), INT8_C(  16),
+                           INT8_C( -41), INT8_C(-126), INT8_C( -97), INT8_C(  49),
+                           INT8_C( 107), INT8_C( -50), INT8_C( 120), INT8_C(-115)),
+      simde_mm256_set_epi8(INT8_C(  34), INT8_C(  28), INT8_C(  21), INT8_C( 117),
+                           INT8_C( 117), INT8_C(  94), INT8_C(  48), INT8_C(  20),
+                           INT8_C(  54), INT8_C( 101), INT8_C(   5), INT8_C( 114),
+                           INT8_C(  45), INT8_C(   8), INT8_C(  15), INT8_C( 112),
+                           INT8_C(  95), INT8_C( 127), INT8_C(  43), INT8_C(  72),
+                           INT8_C(  11), INT8_C(  73), INT8_C(  90), INT8_C(  16),
+                           INT8_C(  41), INT8_C( 126), INT8_C(  97), INT8_C(  49),
+                           INT8_C( 107), INT8_C(  50), INT8_C( 120), INT8_C( 115)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_abs_epi8(test_vec[i].a);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_abs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C(   883), INT16_C(  4935), INT16_C(-24008), INT16_C( 30965),
+                            INT16_C(-17842), INT16_C( 17518), INT16_C( 17563), INT16_C(-27989),
+                            INT16_C(-11591), INT16_C(  6106), INT16_C(-15396), INT16_C(  8945),
+                            INT16_C(-24437), INT16_C( -8580), INT16_C( 20552), INT16_C( -5138)),
+      simde_mm256_set_epi16(INT16_C(   883), INT16_C(  4935), INT16_C( 24008), INT16_C( 30965),
+                            INT16_C( 17842), INT16_C( 17518), INT16_C( 17563), INT16_C( 27989),
+                            INT16_C( 11591), INT16_C(  6106), INT16_C( 15396), INT16_C(  8945),
+                            INT16_C( 24437), INT16_C(  8580), INT16_C( 20552), INT16_C(  5138)) },
+    { simde_mm256_set_epi16(INT16_C(  7150), INT16_C(-12396), INT16_C(  -548), INT16_C(  3078),
+                            INT16_C(-27859), INT16_C( -7142), INT16_C(-18476), INT16_C(-21233),
+                            INT16_C(-27604), INT16_C(-18466), INT16_C(  2150), INT16_C(-19524),
+                            INT16_C( 31449), INT16_C( 29080), INT16_C( 24805), INT16_C(  5433)),
+      simde_mm256_set_epi16(INT16_C(  7150), INT16_C( 12396), INT16_C(   548), INT16_C(  3078),
+                            INT16_C( 27859), INT16_C(  7142), INT16_C( 18476), INT16_C( 21233),
+                            INT16_C( 27604), INT16_C( 18466), INT16_C(  2150), INT16_C( 19524),
+                            INT16_C( 31449), INT16_C( 29080), INT16_C( 24805), INT16_C(  5433)) },
+    { simde_mm256_set_epi16(INT16_C(-28313), INT16_C(-24885), INT16_C( -2391), INT16_C( 13220),
+                            INT16_C(  1665), INT16_C(-13744), INT16_C( -7325), INT16_C(  6028),
+                            INT16_C( -5303), INT16_C(-26987), INT16_C(-10180), INT16_C( 13834),
+                            INT16_C(  -540), INT16_C( 31330), INT16_C(-27869), INT16_C( -7943)),
+      simde_mm256_set_epi16(INT16_C( 28313), INT16_C( 24885), INT16_C(  2391), INT16_C( 13220),
+                            INT16_C(  1665), INT16_C( 13744), INT16_C(  7325), INT16_C(  6028),
+                            INT16_C(  5303), INT16_C( 26987), INT16_C( 10180), INT16_C( 13834),
+                            INT16_C(   540), INT16_C( 31330), INT16_C( 27869), INT16_C(  7943)) },
+    { simde_mm256_set_epi16(INT16_C( 16517), INT16_C(-10696), INT16_C( -9816), INT16_C(-24170),
+                            INT16_C(-22217), INT16_C(-13585), INT16_C( 12198), INT16_C(-20725),
+                            INT16_C( 15105), INT16_C( -1414), INT16_C(-21199), INT16_C(  4961),
+                            INT16_C(-27590), INT16_C(-29425), INT16_C( 18707), INT16_C( 19422)),
+      simde_mm256_set_epi16(INT16_C( 16517), INT16_C( 10696), INT16_C(  9816), INT16_C( 24170),
+                            INT16_C( 22217), INT16_C( 13585), INT16_C( 12198), INT16_C( 20725),
+                            INT16_C( 15105), INT16_C(  1414), INT16_C( 21199), INT16_C(  4961),
+                            INT16_C( 27590), INT16_C( 29425), INT16_C( 18707), INT16_C( 19422)) },
+    { simde_mm256_set_epi16(INT16_C( 12569), INT16_C(-17810), INT16_C( 23275), INT16_C(  1424),
+                            INT16_C(-25200), INT16_C(  4287), INT16_C(   861), INT16_C(-18856),
+                            INT16_C( 16484), INT16_C(-27262), INT16_C( 18063), INT16_C( 29563),
+                            INT16_C( 20341), INT16_C(-10539), INT16_C(-17775), INT16_C( -8156)),
+      simde_mm256_set_epi16(INT16_C( 12569), INT16_C( 17810), INT16_C( 23275), INT16_C(  1424),
+                            INT16_C( 25200), INT16_C(  4287), INT16_C(   861), INT16_C( 18856),
+                            INT16_C( 16484), INT16_C( 27262), INT16_C( 18063), INT16_C( 29563),
+                            INT16_C( 20341), INT16_C( 10539), INT16_C( 17775), INT16_C(  8156)) },
+    { simde_mm256_set_epi16(INT16_C(-29895), INT16_C( -6941), INT16_C(  4492), INT16_C( 20504),
+                            INT16_C(-27198), INT16_C(-30736), INT16_C( -9883), INT16_C(-21390),
+                            INT16_C(-20014), INT16_C(  9830), INT16_C( 24608), INT16_C( -1654),
+                            INT16_C(-13434), INT16_C(-31306), INT16_C(-14954), INT16_C(  3271)),
+      simde_mm256_set_epi16(INT16_C( 29895), INT16_C(  6941), INT16_C(  4492), INT16_C( 20504),
+                            INT16_C( 27198), INT16_C( 30736), INT16_C(  9883), INT16_C( 21390),
+                            INT16_C( 20014), INT16_C(  9830), INT16_C( 24608), INT16_C(  1654),
+                            INT16_C( 13434), INT16_C( 31306), INT16_C( 14954), INT16_C(  3271)) },
+    { simde_mm256_set_epi16(INT16_C( 10379), INT16_C(-22944), INT16_C(-17016), INT16_C(-17934),
+                            INT16_C(  1074), INT16_C(  7843), INT16_C(  8628), INT16_C(-16593),
+                            INT16_C(   381), INT16_C(-10089), INT16_C(-16300), INT16_C(  8316),
+                            INT16_C( -9324), INT16_C( 10870), INT16_C( -8415), INT16_C(  1992)),
+      simde_mm256_set_epi16(INT16_C( 10379), INT16_C( 22944), INT16_C( 17016), INT16_C( 17934),
+                            INT16_C(  1074), INT16_C(  7843), INT16_C(  8628), INT16_C( 16593),
+                            INT16_C(   381), INT16_C( 10089), INT16_C( 16300), INT16_C(  8316),
+                            INT16_C(  9324), INT16_C( 10870), INT16_C(  8415), INT16_C(  1992)) },
+    { simde_mm256_set_epi16(INT16_C( 23189), INT16_C( 11529), INT16_C(-21392), INT16_C( 13870),
+                            INT16_C( -9246), INT16_C(-11429), INT16_C( 30202), INT16_C(-30322),
+                            INT16_C(  3839), INT16_C(-18344), INT16_C(-28708), INT16_C(-30284),
+                            INT16_C( 12529), INT16_C(-22355), INT16_C(-32214), INT16_C( 15430)),
+      simde_mm256_set_epi16(INT16_C( 23189), INT16_C( 11529), INT16_C( 21392), INT16_C( 13870),
+                            INT16_C(  9246), INT16_C( 11429), INT16_C( 30202), INT16_C( 30322),
+                            INT16_C(  3839), INT16_C( 18344), INT16_C( 28708), INT16_C( 30284),
+                            INT16_C( 12529), INT16_C( 22355), INT16_C( 32214), INT16_C( 15430)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_abs_epi16(test_vec[i].a);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_abs_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(-1594287694), INT32_C(  345717154), INT32_C(-1750041006), INT32_C( 1450747900),
+                            INT32_C(  781959208), INT32_C( -706414136), INT32_C( -873955609), INT32_C( 1164656919)),
+      simde_mm256_set_epi32(INT32_C( 1594287694), INT32_C(  345717154), INT32_C( 1750041006), INT32_C( 1450747900),
+                            INT32_C(  781959208), INT32_C(  706414136), INT32_C(  873955609), INT32_C( 1164656919)) },
+    { simde_mm256_set_epi32(INT32_C(  186202433), INT32_C(  185194671), INT32_C( -423126496), INT32_C( 1248080575),
+                            INT32_C( 2002123786), INT32_C(   82925373), INT32_C(-1630808050), INT32_C( 1580887729)),
+      simde_mm256_set_epi32(INT32_C(  186202433), INT32_C(  185194671), INT32_C(  423126496), INT32_C( 1248080575),
+                            INT32_C( 2002123786), INT32_C(   82925373), INT32_C( 1630808050), INT32_C( 1580887729)) },
+    { simde_mm256_set_epi32(INT32_C(-1163426184), INT32_C( 1617326160), INT32_C( -113694768), INT32_C(  979417471),
+                            INT32_C(-1194650676), INT32_C(-1443186841), INT32_C(  331804543), INT32_C(-1408461015)),
+      simde_mm256_set_epi32(INT32_C( 1163426184), INT32_C( 1617326160), INT32_C(  113694768), INT32_C(  979417471),
+                            INT32_C( 1194650676), INT32_C( 1443186841), INT32_C(  331804543), INT32_C( 1408461015)) },
+    { simde_mm256_set_epi32(INT32_C( 2105139222), INT32_C( 1551251038), INT32_C(  438435979), INT32_C( -997249598),
+                            INT32_C(-2089303913), INT32_C(-1400121665), INT32_C(  -92389878), INT32_C(-2017402503)),
+      simde_mm256_set_epi32(INT32_C( 2105139222), INT32_C( 1551251038), INT32_C(  438435979), INT32_C(  997249598),
+                            INT32_C( 2089303913), INT32_C( 1400121665), INT32_C(   92389878), INT32_C( 2017402503)) },
+    { simde_mm256_set_epi32(INT32_C( 2116610468), INT32_C( -738707785), INT32_C(  -59629357), INT32_C(   54238276),
+                            INT32_C(  716290233), INT32_C(  -17079525), INT32_C(-2032552257), INT32_C(  398599855)),
+      simde_mm256_set_epi32(INT32_C( 2116610468), INT32_C(  738707785), INT32_C(   59629357), INT32_C(   54238276),
+                            INT32_C(  716290233), INT32_C(   17079525), INT32_C( 2032552257), INT32_C(  398599855)) },
+    { simde_mm256_set_epi32(INT32_C(-1917002816), INT32_C( -352122390), INT32_C(  877199175), INT32_C(  -27128109),
+                            INT32_C( 1330493482), INT32_C(  706896537), INT32_C(   61997166), INT32_C(-1085037544)),
+      simde_mm256_set_epi32(INT32_C( 1917002816), INT32_C(  352122390), INT32_C(  877199175), INT32_C(   27128109),
+                            INT32_C( 1330493482), INT32_C(  706896537), INT32_C(   61997166), INT32_C( 1085037544)) },
+    { simde_mm256_set_epi32(INT32_C( -907934501), INT32_C( 2132099941), INT32_C(  563876043), INT32_C(-1811786718),
+                            INT32_C(  977980783), INT32_C(-1673349799), INT32_C(   93852889), INT32_C(   17783692)),
+      simde_mm256_set_epi32(INT32_C(  907934501), INT32_C( 2132099941), INT32_C(  563876043), INT32_C( 1811786718),
+                            INT32_C(  977980783), INT32_C( 1673349799), INT32_C(   93852889), INT32_C(   17783692)) },
+    { simde_mm256_set_epi32(INT32_C( 2018155914), INT32_C( 2093816254), INT32_C(  780012243), INT32_C(-1933491316),
+                            INT32_C( -344090054), INT32_C( 1046649193), INT32_C( 2076498697), INT32_C(-1262899144)),
+      simde_mm256_set_epi32(INT32_C( 2018155914), INT32_C( 2093816254), INT32_C(  780012243), INT32_C( 1933491316),
+                            INT32_C(  344090054), INT32_C( 1046649193), INT32_C( 2076498697), INT32_C( 1262899144)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_abs_epi32(test_vec[i].a);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitResult
 test_simde_mm256_add_epi8(const MunitParameter params[], void* data) {
   (void) params;
@@ -4512,7 +4793,7 @@ test_simde_mm256_extracti128_si256(const MunitParameter params[], void* data) {
 }
 
 static MunitResult
-test_simde_mm256_madd_epi16(const MunitParameter params[], void* data) {
+test_simde_mm256_hadd_epi16(const MunitParameter params[], void* data) {
   (void) params;
   (void) data;
 
@@ -4521,98 +4802,114 @@ test_simde_mm256_madd_epi16(const MunitParameter params[], void* data) {
     simde__m256i b;
     simde__m256i r;
   } test_vec[8] = {
-    { simde_mm256_set_epi16(INT16_C(-22074), INT16_C( 27892), INT16_C(-27402), INT16_C( -5185),
-                            INT16_C(-13617), INT16_C(  6733), INT16_C( 31914), INT16_C( 16627),
-                            INT16_C( 14296), INT16_C(   527), INT16_C(-18797), INT16_C( 25549),
-                            INT16_C( 30759), INT16_C(-12360), INT16_C(  6414), INT16_C( 21507)),
-      simde_mm256_set_epi16(INT16_C( 13087), INT16_C(   552), INT16_C(-32388), INT16_C( 21398),
-                            INT16_C( -2724), INT16_C( 12527), INT16_C(  4881), INT16_C( -1411),
-                            INT16_C(  4971), INT16_C(  -716), INT16_C(-15438), INT16_C( 22737),
-                            INT16_C( 22649), INT16_C( 14157), INT16_C( 16131), INT16_C( 25742)),
-      simde_mm256_set_epi32(INT32_C( -273486054), INT32_C(  776547346), INT32_C(  121436999), INT32_C(  132311537),
-                            INT32_C(   70688084), INT32_C(  871095699), INT32_C(  521680071), INT32_C(  657097428)) },
-    { simde_mm256_set_epi16(INT16_C( 31591), INT16_C( 27463), INT16_C(-11448), INT16_C( 12754),
-                            INT16_C( 23360), INT16_C( 24732), INT16_C( 21501), INT16_C(  9477),
-                            INT16_C(-29628), INT16_C( 15818), INT16_C( 22405), INT16_C(-17463),
-                            INT16_C( -4252), INT16_C(  1744), INT16_C( 29107), INT16_C(  -236)),
-      simde_mm256_set_epi16(INT16_C( 17376), INT16_C(-10713), INT16_C(  2486), INT16_C(  1967),
-                            INT16_C(  3397), INT16_C( 25143), INT16_C( 11210), INT16_C( -8470),
-                            INT16_C( -7431), INT16_C(-24781), INT16_C( 28646), INT16_C(-15461),
-                            INT16_C( -7439), INT16_C(-17272), INT16_C(-12699), INT16_C( 15557)),
-      simde_mm256_set_epi32(INT32_C(  254714097), INT32_C(   -3372610), INT32_C(  701190596), INT32_C(  160756020),
-                            INT32_C( -171820190), INT32_C(  911809073), INT32_C(    1508260), INT32_C( -373301245)) },
-    { simde_mm256_set_epi16(INT16_C(-23018), INT16_C( 27443), INT16_C( -9704), INT16_C(  6815),
-                            INT16_C(-10742), INT16_C(-15199), INT16_C(-25926), INT16_C( 11907),
-                            INT16_C(-11173), INT16_C( -1296), INT16_C(-31401), INT16_C(-11984),
-                            INT16_C( 29153), INT16_C( 26221), INT16_C( 23204), INT16_C( 24693)),
-      simde_mm256_set_epi16(INT16_C( 22883), INT16_C( -1430), INT16_C(-22444), INT16_C( -4173),
-                            INT16_C( -9271), INT16_C(-22344), INT16_C(-19214), INT16_C(-15237),
-                            INT16_C(  8913), INT16_C(-31636), INT16_C(-32308), INT16_C( 15943),
-                            INT16_C(  4837), INT16_C( -6600), INT16_C(-14527), INT16_C(-29993)),
-      simde_mm256_set_epi32(INT32_C( -565964384), INT32_C(  189357581), INT32_C(  439195538), INT32_C(  316715205),
-                            INT32_C(  -58584693), INT32_C(  823442596), INT32_C(  -32045539), INT32_C(-1077701657)) },
-    { simde_mm256_set_epi16(INT16_C( -2513), INT16_C( -1446), INT16_C( 20507), INT16_C(-25668),
-                            INT16_C( 32595), INT16_C(  1090), INT16_C(  8204), INT16_C(  9120),
-                            INT16_C( -8133), INT16_C( 31849), INT16_C(-18457), INT16_C(-12347),
-                            INT16_C( 18795), INT16_C( -8246), INT16_C( 23278), INT16_C(-14987)),
-      simde_mm256_set_epi16(INT16_C( 12529), INT16_C(-11077), INT16_C(  5410), INT16_C(-23993),
-                            INT16_C(-26377), INT16_C( -6112), INT16_C(-21857), INT16_C(  3969),
-                            INT16_C( -2477), INT16_C(-13689), INT16_C( 21824), INT16_C(  -644),
-                            INT16_C( 10631), INT16_C(-12974), INT16_C(-28564), INT16_C( 32352)),
-      simde_mm256_set_epi32(INT32_C(  -15468035), INT32_C(  726795194), INT32_C( -866420395), INT32_C( -143117548),
-                            INT32_C( -415835520), INT32_C( -394854100), INT32_C(  306793249), INT32_C(-1149772216)) },
-    { simde_mm256_set_epi16(INT16_C(  7571), INT16_C( 21562), INT16_C( 24839), INT16_C( 27056),
-                            INT16_C(-18448), INT16_C( 29209), INT16_C(  1880), INT16_C(-21767),
-                            INT16_C( 26198), INT16_C(-31641), INT16_C(  3244), INT16_C(-13098),
-                            INT16_C( -4443), INT16_C(  -521), INT16_C(-27791), INT16_C(-13063)),
-      simde_mm256_set_epi16(INT16_C(-17648), INT16_C(  8337), INT16_C( -3551), INT16_C(-28013),
-                            INT16_C(-17930), INT16_C(   577), INT16_C( 32382), INT16_C( 20122),
-                            INT16_C(-14435), INT16_C(-21581), INT16_C(-32759), INT16_C(  2792),
-                            INT16_C(-24268), INT16_C( 11663), INT16_C( -1946), INT16_C( 19139)),
-      simde_mm256_set_epi32(INT32_C(   46149386), INT32_C( -846123017), INT32_C(  347626233), INT32_C( -377117414),
-                            INT32_C(  304676291), INT32_C( -142839812), INT32_C(  101746301), INT32_C( -195931471)) },
-    { simde_mm256_set_epi16(INT16_C(-11993), INT16_C( -3203), INT16_C( 15681), INT16_C(-18383),
-                            INT16_C( 16847), INT16_C(  2437), INT16_C( -8441), INT16_C( 14338),
-                            INT16_C(  7300), INT16_C(-21082), INT16_C(-17580), INT16_C(  1429),
-                            INT16_C(-32388), INT16_C(-10418), INT16_C(-19218), INT16_C(-31595)),
-      simde_mm256_set_epi16(INT16_C(-24077), INT16_C(-32143), INT16_C( 18864), INT16_C( 11719),
-                            INT16_C( -5555), INT16_C( -6220), INT16_C(-30370), INT16_C( 23594),
-                            INT16_C( 29026), INT16_C( 10950), INT16_C( 31566), INT16_C(-28277),
-                            INT16_C( 28777), INT16_C( 17653), INT16_C(-21542), INT16_C(  7263)),
-      simde_mm256_set_epi32(INT32_C(  391709490), INT32_C(   80376007), INT32_C( -108743225), INT32_C(  594643942),
-                            INT32_C(  -18958100), INT32_C( -595338113), INT32_C(-1115938430), INT32_C(  184519671)) },
-    { simde_mm256_set_epi16(INT16_C(-31708), INT16_C( -6736), INT16_C(-12543), INT16_C(-19831),
-                            INT16_C( -5660), INT16_C(-20189), INT16_C( 31844), INT16_C( 20882),
-                            INT16_C(-22159), INT16_C( -7550), INT16_C(  8622), INT16_C(-20427),
-                            INT16_C(-19784), INT16_C(  4739), INT16_C( -9632), INT16_C(  3416)),
-      simde_mm256_set_epi16(INT16_C( 18684), INT16_C(  4347), INT16_C( 18074), INT16_C(-24539),
-                            INT16_C( 14613), INT16_C(-28009), INT16_C( 18528), INT16_C(-16867),
-                            INT16_C(  1794), INT16_C(-22885), INT16_C( 27546), INT16_C( 25964),
-                            INT16_C( -3488), INT16_C(-31053), INT16_C(  6969), INT16_C(-12364)),
-      simde_mm256_set_epi32(INT32_C( -621713664), INT32_C(  259930727), INT32_C(  482764121), INT32_C(  237788938),
-                            INT32_C(  133028504), INT32_C( -292865016), INT32_C(  -78153575), INT32_C( -109360832)) },
-    { simde_mm256_set_epi16(INT16_C( 32611), INT16_C(-26810), INT16_C( 32585), INT16_C(  6944),
-                            INT16_C( 26033), INT16_C(  2406), INT16_C(-32105), INT16_C(-11091),
-                            INT16_C(-32475), INT16_C(-29532), INT16_C( 13591), INT16_C(-15433),
-                            INT16_C( 29089), INT16_C(-24035), INT16_C( 15832), INT16_C(-10008)),
-      simde_mm256_set_epi16(INT16_C( 16370), INT16_C( -9733), INT16_C( -7456), INT16_C( -2346),
-                            INT16_C( -1285), INT16_C( -5955), INT16_C(-24955), INT16_C( -4486),
-                            INT16_C(  4170), INT16_C(-17666), INT16_C(  7986), INT16_C( 19848),
-                            INT16_C(-13940), INT16_C( 24511), INT16_C( 18142), INT16_C(-26201)),
-      simde_mm256_set_epi32(INT32_C(  794783800), INT32_C( -259244384), INT32_C(  -47780135), INT32_C(  850934501),
-                            INT32_C(  386291562), INT32_C( -197776458), INT32_C( -994622545), INT32_C(  549443752)) }
+    { simde_mm256_set_epi16(INT16_C(-18181), INT16_C( 19878), INT16_C( 25126), INT16_C(-19496),
+                            INT16_C( 17151), INT16_C( -9608), INT16_C( 12957), INT16_C( -4971),
+                            INT16_C( -3552), INT16_C( -7871), INT16_C( 26540), INT16_C(-22263),
+                            INT16_C(-17396), INT16_C( -6686), INT16_C(-22229), INT16_C( 32621)),
+      simde_mm256_set_epi16(INT16_C(  3937), INT16_C( 29634), INT16_C( -2684), INT16_C(-17536),
+                            INT16_C(  1622), INT16_C(  5871), INT16_C( -4046), INT16_C(-21524),
+                            INT16_C(-22251), INT16_C(-27114), INT16_C( 12358), INT16_C( -8214),
+                            INT16_C(-24203), INT16_C( -6993), INT16_C( 24992), INT16_C( -8335)),
+      simde_mm256_set_epi16(INT16_C(-31965), INT16_C(-20220), INT16_C(  7493), INT16_C(-25570),
+                            INT16_C(  1697), INT16_C(  5630), INT16_C(  7543), INT16_C(  7986),
+                            INT16_C( 16171), INT16_C(  4144), INT16_C(-31196), INT16_C( 16657),
+                            INT16_C(-11423), INT16_C(  4277), INT16_C(-24082), INT16_C( 10392)) },
+    { simde_mm256_set_epi16(INT16_C( -4142), INT16_C( 27301), INT16_C( 16794), INT16_C(  9846),
+                            INT16_C( 17555), INT16_C( 22343), INT16_C( 14792), INT16_C(-27305),
+                            INT16_C(-12047), INT16_C(-13758), INT16_C( 16936), INT16_C(-20699),
+                            INT16_C( 18797), INT16_C( -2831), INT16_C( 23982), INT16_C( 31459)),
+      simde_mm256_set_epi16(INT16_C(  5365), INT16_C(-30168), INT16_C( 24618), INT16_C( 23614),
+                            INT16_C(  7933), INT16_C( -4387), INT16_C(-12133), INT16_C( 31055),
+                            INT16_C( -8523), INT16_C( -3988), INT16_C(  5855), INT16_C( 12254),
+                            INT16_C(-20060), INT16_C( 31852), INT16_C( 16898), INT16_C( 24080)),
+      simde_mm256_set_epi16(INT16_C(-24803), INT16_C(-17304), INT16_C(  3546), INT16_C( 18922),
+                            INT16_C( 23159), INT16_C( 26640), INT16_C(-25638), INT16_C(-12513),
+                            INT16_C(-12511), INT16_C( 18109), INT16_C( 11792), INT16_C(-24558),
+                            INT16_C(-25805), INT16_C( -3763), INT16_C( 15966), INT16_C(-10095)) },
+    { simde_mm256_set_epi16(INT16_C(-27959), INT16_C( 30204), INT16_C( 19171), INT16_C( 30666),
+                            INT16_C(-19673), INT16_C( 30029), INT16_C( 24431), INT16_C( 18255),
+                            INT16_C( 32164), INT16_C( 26313), INT16_C( 31194), INT16_C(  8730),
+                            INT16_C(-27704), INT16_C( 24747), INT16_C( 28931), INT16_C( 30146)),
+      simde_mm256_set_epi16(INT16_C( -1281), INT16_C( 16278), INT16_C( 24106), INT16_C(-14017),
+                            INT16_C(-11702), INT16_C( 24100), INT16_C(  6395), INT16_C(   968),
+                            INT16_C(-22765), INT16_C(  8561), INT16_C(-22932), INT16_C( 18655),
+                            INT16_C(-16765), INT16_C( 23319), INT16_C(-13746), INT16_C(  2713)),
+      simde_mm256_set_epi16(INT16_C( 14997), INT16_C( 10089), INT16_C( 12398), INT16_C(  7363),
+                            INT16_C(  2245), INT16_C(-15699), INT16_C( 10356), INT16_C(-22850),
+                            INT16_C(-14204), INT16_C( -4277), INT16_C(  6554), INT16_C(-11033),
+                            INT16_C( -7059), INT16_C(-25612), INT16_C( -2957), INT16_C( -6459)) },
+    { simde_mm256_set_epi16(INT16_C(-19161), INT16_C( 16227), INT16_C(  8479), INT16_C( 22512),
+                            INT16_C(-14999), INT16_C(-31577), INT16_C(-13780), INT16_C( 14864),
+                            INT16_C(-16430), INT16_C( -2243), INT16_C( 13696), INT16_C( 25638),
+                            INT16_C(-15557), INT16_C( 28017), INT16_C( 18354), INT16_C( 25851)),
+      simde_mm256_set_epi16(INT16_C( -7790), INT16_C(-14079), INT16_C(  8561), INT16_C(-26371),
+                            INT16_C(  2534), INT16_C(   538), INT16_C( 23245), INT16_C(  7640),
+                            INT16_C(-23231), INT16_C( -2954), INT16_C(-19127), INT16_C( 21894),
+                            INT16_C( -1695), INT16_C( 16782), INT16_C(-14894), INT16_C( 14438)),
+      simde_mm256_set_epi16(INT16_C(-21869), INT16_C(-17810), INT16_C(  3072), INT16_C( 30885),
+                            INT16_C( -2934), INT16_C( 30991), INT16_C( 18960), INT16_C(  1084),
+                            INT16_C(-26185), INT16_C(  2767), INT16_C( 15087), INT16_C(  -456),
+                            INT16_C(-18673), INT16_C(-26202), INT16_C( 12460), INT16_C(-21331)) },
+    { simde_mm256_set_epi16(INT16_C( -1195), INT16_C( 28529), INT16_C( 27570), INT16_C( -1159),
+                            INT16_C(  6576), INT16_C(-29867), INT16_C(-14234), INT16_C( 27660),
+                            INT16_C( -2753), INT16_C( 27417), INT16_C( -3564), INT16_C(  6297),
+                            INT16_C(  5429), INT16_C( 22387), INT16_C( 16659), INT16_C(-23024)),
+      simde_mm256_set_epi16(INT16_C( -3779), INT16_C(-28580), INT16_C( 23564), INT16_C( 21108),
+                            INT16_C( 24148), INT16_C(-18480), INT16_C( 29192), INT16_C( 17510),
+                            INT16_C( 15974), INT16_C( 14356), INT16_C(-19474), INT16_C(-12354),
+                            INT16_C( 15057), INT16_C(  8473), INT16_C( 30575), INT16_C( 19870)),
+      simde_mm256_set_epi16(INT16_C(-32359), INT16_C(-20864), INT16_C(  5668), INT16_C(-18834),
+                            INT16_C( 27334), INT16_C( 26411), INT16_C(-23291), INT16_C( 13426),
+                            INT16_C( 30330), INT16_C(-31828), INT16_C( 23530), INT16_C(-15091),
+                            INT16_C( 24664), INT16_C(  2733), INT16_C( 27816), INT16_C( -6365)) },
+    { simde_mm256_set_epi16(INT16_C( 17043), INT16_C( 13726), INT16_C( 28258), INT16_C( -9220),
+                            INT16_C(  4672), INT16_C(  6242), INT16_C(  -564), INT16_C( 19601),
+                            INT16_C( 18811), INT16_C(-20942), INT16_C( 16452), INT16_C( 14910),
+                            INT16_C( 25156), INT16_C(-23092), INT16_C(  4108), INT16_C(  6194)),
+      simde_mm256_set_epi16(INT16_C( -8931), INT16_C(-13687), INT16_C( 27427), INT16_C(-15754),
+                            INT16_C(  7212), INT16_C(-28698), INT16_C( 27843), INT16_C( 31091),
+                            INT16_C(  8995), INT16_C( 16800), INT16_C( 23554), INT16_C(-17595),
+                            INT16_C( 29632), INT16_C(-22769), INT16_C(-19342), INT16_C(-12294)),
+      simde_mm256_set_epi16(INT16_C(-22618), INT16_C( 11673), INT16_C(-21486), INT16_C( -6602),
+                            INT16_C( 30769), INT16_C( 19038), INT16_C( 10914), INT16_C( 19037),
+                            INT16_C( 25795), INT16_C(  5959), INT16_C(  6863), INT16_C(-31636),
+                            INT16_C( -2131), INT16_C( 31362), INT16_C(  2064), INT16_C( 10302)) },
+    { simde_mm256_set_epi16(INT16_C( 29543), INT16_C(-21920), INT16_C( 22155), INT16_C( -4090),
+                            INT16_C( -7379), INT16_C( 26973), INT16_C( -3048), INT16_C( 22257),
+                            INT16_C(-27931), INT16_C(-21317), INT16_C(-19839), INT16_C(-32113),
+                            INT16_C( 18707), INT16_C( -1353), INT16_C(  2532), INT16_C(-27236)),
+      simde_mm256_set_epi16(INT16_C( -8451), INT16_C(  -265), INT16_C( 20343), INT16_C( 31646),
+                            INT16_C( 32278), INT16_C(-15003), INT16_C(-29509), INT16_C( 27503),
+                            INT16_C( 16348), INT16_C(  9246), INT16_C(  5240), INT16_C( 28716),
+                            INT16_C(-20103), INT16_C( 23982), INT16_C( 10258), INT16_C(  9385)),
+      simde_mm256_set_epi16(INT16_C( -8716), INT16_C(-13547), INT16_C( 17275), INT16_C( -2006),
+                            INT16_C(  7623), INT16_C( 18065), INT16_C( 19594), INT16_C( 19209),
+                            INT16_C( 25594), INT16_C(-31580), INT16_C(  3879), INT16_C( 19643),
+                            INT16_C( 16288), INT16_C( 13584), INT16_C( 17354), INT16_C(-24704)) },
+    { simde_mm256_set_epi16(INT16_C( 13557), INT16_C(  8578), INT16_C(-20717), INT16_C( 18773),
+                            INT16_C(   410), INT16_C( -3166), INT16_C(-26325), INT16_C(-30610),
+                            INT16_C( 29724), INT16_C( -6160), INT16_C( 10814), INT16_C(-27347),
+                            INT16_C( 15147), INT16_C( -2347), INT16_C( 32142), INT16_C(  9361)),
+      simde_mm256_set_epi16(INT16_C(  4941), INT16_C( 24480), INT16_C( 31485), INT16_C( 13722),
+                            INT16_C( 29250), INT16_C( 28911), INT16_C( 16745), INT16_C( 29551),
+                            INT16_C(-26040), INT16_C( 18675), INT16_C( 13173), INT16_C(  4494),
+                            INT16_C( 27148), INT16_C(-20143), INT16_C( 24502), INT16_C(  2098)),
+      simde_mm256_set_epi16(INT16_C( 29421), INT16_C(-20329), INT16_C( -7375), INT16_C(-19240),
+                            INT16_C( 22135), INT16_C( -1944), INT16_C( -2756), INT16_C(  8601),
+                            INT16_C( -7365), INT16_C( 17667), INT16_C(  7005), INT16_C( 26600),
+                            INT16_C( 23564), INT16_C(-16533), INT16_C( 12800), INT16_C(-24033)) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
-    simde__m256i r = simde_mm256_madd_epi16(test_vec[i].a, test_vec[i].b);
-    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+    simde__m256i r = simde_mm256_hadd_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
   }
 
   return MUNIT_OK;
 }
 
 static MunitResult
-test_simde_mm256_max_epi8(const MunitParameter params[], void* data) {
+test_simde_mm256_hadd_epi32(const MunitParameter params[], void* data) {
   (void) params;
   (void) data;
 
@@ -4621,126 +4918,2762 @@ test_simde_mm256_max_epi8(const MunitParameter params[], void* data) {
     simde__m256i b;
     simde__m256i r;
   } test_vec[8] = {
-    { simde_mm256_set_epi8(INT8_C(  82), INT8_C(  80), INT8_C( 100), INT8_C(-114),
-                           INT8_C(-121), INT8_C(-115), INT8_C( -33), INT8_C( -36),
-                           INT8_C(-105), INT8_C( -52), INT8_C(  94), INT8_C(  97),
-                           INT8_C( -84), INT8_C( 116), INT8_C( 107), INT8_C( -76),
-                           INT8_C(   5), INT8_C(  53), INT8_C( 122), INT8_C(-101),
-                           INT8_C(  32), INT8_C(-122), INT8_C( -66), INT8_C( -61),
-                           INT8_C( -25), INT8_C(  -2), INT8_C(  14), INT8_C( -94),
-                           INT8_C(  18), INT8_C( -35), INT8_C(-102), INT8_C(  57)),
-      simde_mm256_set_epi8(INT8_C(  46), INT8_C( -89), INT8_C(  83), INT8_C( 115),
-                           INT8_C( 114), INT8_C(  48), INT8_C(   9), INT8_C(   1),
-                           INT8_C(  54), INT8_C( -93), INT8_C( 118), INT8_C( -84),
-                           INT8_C(  50), INT8_C( -43), INT8_C(-125), INT8_C( -87),
-                           INT8_C(  48), INT8_C(  67), INT8_C(  65), INT8_C( 103),
-                           INT8_C( 105), INT8_C( -97), INT8_C( -54), INT8_C(  17),
-                           INT8_C( -90), INT8_C( -86), INT8_C( 116), INT8_C( 127),
-                           INT8_C(  77), INT8_C(  -5), INT8_C(  31), INT8_C(  24)),
-      simde_mm256_set_epi8(INT8_C(  82), INT8_C(  80), INT8_C( 100), INT8_C( 115),
-                           INT8_C( 114), INT8_C(  48), INT8_C(   9), INT8_C(   1),
-                           INT8_C(  54), INT8_C( -52), INT8_C( 118), INT8_C(  97),
-                           INT8_C(  50), INT8_C( 116), INT8_C( 107), INT8_C( -76),
-                           INT8_C(  48), INT8_C(  67), INT8_C( 122), INT8_C( 103),
-                           INT8_C( 105), INT8_C( -97), INT8_C( -54), INT8_C(  17),
-                           INT8_C( -25), INT8_C(  -2), INT8_C( 116), INT8_C( 127),
-                           INT8_C(  77), INT8_C(  -5), INT8_C(  31), INT8_C(  57)) },
-    { simde_mm256_set_epi8(INT8_C( 104), INT8_C( 106), INT8_C(-125), INT8_C(  -4),
-                           INT8_C( -59), INT8_C(  95), INT8_C( -56), INT8_C(  31),
-                           INT8_C( 108), INT8_C(   5), INT8_C( 101), INT8_C(  27),
-                           INT8_C( -64), INT8_C(  57), INT8_C(-101), INT8_C( -55),
-                           INT8_C(  77), INT8_C( 118), INT8_C(  99), INT8_C(  21),
-                           INT8_C(  95), INT8_C(  17), INT8_C(  54), INT8_C( -21),
-                           INT8_C(  92), INT8_C( -54), INT8_C(  78), INT8_C(  40),
-                           INT8_C( 102), INT8_C(-101), INT8_C(   0), INT8_C( 127)),
-      simde_mm256_set_epi8(INT8_C( -59), INT8_C( 102), INT8_C(  95), INT8_C( -82),
-                           INT8_C( -77), INT8_C( -39), INT8_C( -88), INT8_C( -22),
-                           INT8_C(  54), INT8_C(  84), INT8_C( -33), INT8_C(  49),
-                           INT8_C(  63), INT8_C(  99), INT8_C(  64), INT8_C(-122),
-                           INT8_C( 102), INT8_C(  28), INT8_C(  90), INT8_C(  72),
-                           INT8_C(  24), INT8_C(  50), INT8_C(  78), INT8_C( -15),
-                           INT8_C( -20), INT8_C( -56), INT8_C(  73), INT8_C(  48),
-                           INT8_C( -27), INT8_C(   7), INT8_C( -15), INT8_C(-109)),
-      simde_mm256_set_epi8(INT8_C( 104), INT8_C( 106), INT8_C(  95), INT8_C(  -4),
-                           INT8_C( -59), INT8_C(  95), INT8_C( -56), INT8_C(  31),
-                           INT8_C( 108), INT8_C(  84), INT8_C( 101), INT8_C(  49),
-                           INT8_C(  63), INT8_C(  99), INT8_C(  64), INT8_C( -55),
-                           INT8_C( 102), INT8_C( 118), INT8_C(  99), INT8_C(  72),
-                           INT8_C(  95), INT8_C(  50), INT8_C(  78), INT8_C( -15),
-                           INT8_C(  92), INT8_C( -54), INT8_C(  78), INT8_C(  48),
-                           INT8_C( 102), INT8_C(   7), INT8_C(   0), INT8_C( 127)) },
-    { simde_mm256_set_epi8(INT8_C(  65), INT8_C(  23), INT8_C(  64), INT8_C( -32),
-                           INT8_C( -17), INT8_C(  98), INT8_C( -25), INT8_C( 100),
-                           INT8_C(-100), INT8_C( -55), INT8_C( -13), INT8_C( 105),
-                           INT8_C(   8), INT8_C(  62), INT8_C(-102), INT8_C(  30),
-                           INT8_C(  -9), INT8_C(  71), INT8_C( -37), INT8_C( -11),
-                           INT8_C( -97), INT8_C(  54), INT8_C( -23), INT8_C( 103),
-                           INT8_C(  11), INT8_C( -76), INT8_C(  47), INT8_C(  45),
-                           INT8_C( -29), INT8_C( -83), INT8_C( -52), INT8_C(  82)),
-      simde_mm256_set_epi8(INT8_C(  -2), INT8_C( -84), INT8_C( -69), INT8_C( -58),
-                           INT8_C(-128), INT8_C(  76), INT8_C( 110), INT8_C( -99),
-                           INT8_C(  46), INT8_C(   8), INT8_C( -50), INT8_C(  -2),
-                           INT8_C( 114), INT8_C(  31), INT8_C( -27), INT8_C( -16),
-                           INT8_C(  63), INT8_C( -83), INT8_C(-114), INT8_C( 116),
-                           INT8_C(  14), INT8_C( -31), INT8_C(   3), INT8_C(-105),
-                           INT8_C( -84), INT8_C( -19), INT8_C(  81), INT8_C(  57),
-                           INT8_C( -55), INT8_C( -67), INT8_C( -89), INT8_C(  74)),
-      simde_mm256_set_epi8(INT8_C(  65), INT8_C(  23), INT8_C(  64), INT8_C( -32),
-                           INT8_C( -17), INT8_C(  98), INT8_C( 110), INT8_C( 100),
-                           INT8_C(  46), INT8_C(   8), INT8_C( -13), INT8_C( 105),
-                           INT8_C( 114), INT8_C(  62), INT8_C( -27), INT8_C(  30),
-                           INT8_C(  63), INT8_C(  71), INT8_C( -37), INT8_C( 116),
-                           INT8_C(  14), INT8_C(  54), INT8_C(   3), INT8_C( 103),
-                           INT8_C(  11), INT8_C( -19), INT8_C(  81), INT8_C(  57),
-                           INT8_C( -29), INT8_C( -67), INT8_C( -52), INT8_C(  82)) },
-    { simde_mm256_set_epi8(INT8_C(   3), INT8_C( -48), INT8_C( -19), INT8_C( 101),
-                           INT8_C(  -3), INT8_C( -85), INT8_C(-102), INT8_C(  26),
-                           INT8_C(  89), INT8_C( -95), INT8_C(  51), INT8_C(  -5),
-                           INT8_C(  13), INT8_C(  30), INT8_C( -92), INT8_C( -13),
-                           INT8_C(  68), INT8_C(  71), INT8_C(-127), INT8_C( -65),
-                           INT8_C(-102), INT8_C(  -1), INT8_C(  48), INT8_C(  30),
-                           INT8_C(  43), INT8_C(  71), INT8_C(  53), INT8_C(  78),
-                           INT8_C(  81), INT8_C( 119), INT8_C( -32), INT8_C(  18)),
-      simde_mm256_set_epi8(INT8_C( -81), INT8_C( -54), INT8_C( -70), INT8_C( 102),
-                           INT8_C(  86), INT8_C( 106), INT8_C(  99), INT8_C(  -7),
-                           INT8_C( -74), INT8_C( -52), INT8_C(-121), INT8_C(-127),
-                           INT8_C(  49), INT8_C(-119), INT8_C(  52), INT8_C( 119),
-                           INT8_C( 123), INT8_C(-104), INT8_C(  44), INT8_C( -14),
-                           INT8_C(  56), INT8_C( -83), INT8_C(  21), INT8_C( 108),
-                           INT8_C( -43), INT8_C(  75), INT8_C(  75), INT8_C(  51),
-                           INT8_C(  54), INT8_C( -18), INT8_C( 100), INT8_C(  49)),
-      simde_mm256_set_epi8(INT8_C(   3), INT8_C( -48), INT8_C( -19), INT8_C( 102),
-                           INT8_C(  86), INT8_C( 106), INT8_C(  99), INT8_C(  26),
-                           INT8_C(  89), INT8_C( -52), INT8_C(  51), INT8_C(  -5),
-                           INT8_C(  49), INT8_C(  30), INT8_C(  52), INT8_C( 119),
-                           INT8_C( 123), INT8_C(  71), INT8_C(  44), INT8_C( -14),
-                           INT8_C(  56), INT8_C(  -1), INT8_C(  48), INT8_C( 108),
-                           INT8_C(  43), INT8_C(  75), INT8_C(  75), INT8_C(  78),
-                           INT8_C(  81), INT8_C( 119), INT8_C( 100), INT8_C(  49)) },
-    { simde_mm256_set_epi8(INT8_C( -92), INT8_C(  89), INT8_C(  61), INT8_C( 117),
-                           INT8_C( -42), INT8_C(  29), INT8_C( -36), INT8_C(  67),
-                           INT8_C(-107), INT8_C(  95), INT8_C(-103), INT8_C( -42),
-                           INT8_C( -63), INT8_C(  54), INT8_C(  53), INT8_C( -40),
-                           INT8_C( -66), INT8_C( -31), INT8_C( -91), INT8_C(  82),
-                           INT8_C( 110), INT8_C( -33), INT8_C(  21), INT8_C(  38),
-                           INT8_C( -69), INT8_C(  34), INT8_C( -74), INT8_C(  24),
-                           INT8_C( -26), INT8_C(-124), INT8_C( -81), INT8_C(  36)),
-      simde_mm256_set_epi8(INT8_C(-105), INT8_C(  55), INT8_C(-117), INT8_C(  72),
-                           INT8_C( -82), INT8_C( -42), INT8_C( 100), INT8_C( -21),
-                           INT8_C(  19), INT8_C( 104), INT8_C(  11), INT8_C(  52),
-                           INT8_C(  30), INT8_C(   8), INT8_C(  70), INT8_C( -51),
-                           INT8_C( -61), INT8_C( -91), INT8_C( 126), INT8_C( -28),
-                           INT8_C( -34), INT8_C( 102), INT8_C(  69), INT8_C(  99),
-                           INT8_C(  81), INT8_C(  11), INT8_C( -51), INT8_C(   2),
-                           INT8_C(  60), INT8_C( -70), INT8_C(  92), INT8_C( -37)),
-      simde_mm256_set_epi8(INT8_C( -92), INT8_C(  89), INT8_C(  61), INT8_C( 117),
-                           INT8_C( -42), INT8_C(  29), INT8_C( 100), INT8_C(  67),
-                           INT8_C(  19), INT8_C( 104), INT8_C(  11), INT8_C(  52),
-                           INT8_C(  30), INT8_C(  54), INT8_C(  70), INT8_C( -40),
-                           INT8_C( -61), INT8_C( -31), INT8_C( 126), INT8_C(  82),
-                           INT8_C( 110), INT8_C( 102), INT8_C(  69), INT8_C(  99),
-                           INT8_C(  81), INT8_C(  34), INT8_C( -51), INT8_C(  24),
-                           INT8_C(  60), INT8_C( -70), INT8_C(  92), INT8_C(  36)) },
+    { simde_mm256_set_epi32(INT32_C( 1560902596), INT32_C(  406894853), INT32_C(-1057362904), INT32_C(-1612039523),
+                            INT32_C(-1493212676), INT32_C(-1420219000), INT32_C(-1220696014), INT32_C(  239734993)),
+      simde_mm256_set_epi32(INT32_C(  548642320), INT32_C( -503695661), INT32_C( -722338091), INT32_C(  561608977),
+                            INT32_C( 2042908230), INT32_C(-1420838798), INT32_C( -575797529), INT32_C( 1102462719)),
+      simde_mm256_set_epi32(INT32_C(   44946659), INT32_C( -160729114), INT32_C( 1967797449), INT32_C( 1625564869),
+                            INT32_C(  622069432), INT32_C(  526665190), INT32_C( 1381535620), INT32_C( -980961021)) },
+    { simde_mm256_set_epi32(INT32_C(-1877185968), INT32_C( -512934944), INT32_C( 1453321943), INT32_C( -926314823),
+                            INT32_C( 2141613291), INT32_C(-1699117949), INT32_C(  152004484), INT32_C(  741510070)),
+      simde_mm256_set_epi32(INT32_C( 1840575765), INT32_C( -459932034), INT32_C( 1679076322), INT32_C(-1244872405),
+                            INT32_C(  622658550), INT32_C(-1924285767), INT32_C(-1601975603), INT32_C( 1329174675)),
+      simde_mm256_set_epi32(INT32_C( 1380643731), INT32_C(  434203917), INT32_C( 1904846384), INT32_C(  527007120),
+                            INT32_C(-1301627217), INT32_C( -272800928), INT32_C(  442495342), INT32_C(  893514554)) },
+    { simde_mm256_set_epi32(INT32_C( 1195891306), INT32_C( 1513882660), INT32_C(  551807105), INT32_C( 1930294274),
+                            INT32_C( -742468628), INT32_C( 2124655180), INT32_C(  145200642), INT32_C(  411898701)),
+      simde_mm256_set_epi32(INT32_C(-1417826121), INT32_C(  -99562173), INT32_C( 1709618461), INT32_C(  394262572),
+                            INT32_C(-2052920047), INT32_C( 1497695200), INT32_C(  443707922), INT32_C( -506418415)),
+      simde_mm256_set_epi32(INT32_C(-1517388294), INT32_C( 2103881033), INT32_C(-1585193330), INT32_C(-1812865917),
+                            INT32_C( -555224847), INT32_C(  -62710493), INT32_C( 1382186552), INT32_C(  557099343)) },
+    { simde_mm256_set_epi32(INT32_C(  366628402), INT32_C(  509372109), INT32_C( 1306448685), INT32_C(-2144293978),
+                            INT32_C( 1183255917), INT32_C(-2037921595), INT32_C(  188580493), INT32_C( -895808042)),
+      simde_mm256_set_epi32(INT32_C(  -50760310), INT32_C(-1987665057), INT32_C(  632732592), INT32_C(-1890883650),
+                            INT32_C(   15567384), INT32_C( 1828137438), INT32_C(-1050036640), INT32_C(-1960447781)),
+      simde_mm256_set_epi32(INT32_C(-2038425367), INT32_C(-1258151058), INT32_C(  876000511), INT32_C( -837845293),
+                            INT32_C( 1843704822), INT32_C( 1284482875), INT32_C( -854665678), INT32_C( -707227549)) },
+    { simde_mm256_set_epi32(INT32_C(  437951876), INT32_C(  370548288), INT32_C( 1751709148), INT32_C( 2025532888),
+                            INT32_C( 2127677034), INT32_C( 1618405209), INT32_C(  455953858), INT32_C(-1008714521)),
+      simde_mm256_set_epi32(INT32_C(-1801909832), INT32_C(  213208514), INT32_C(  504689421), INT32_C(  797863952),
+                            INT32_C(  381935638), INT32_C( 1215701209), INT32_C(-1979669693), INT32_C( 1195889672)),
+      simde_mm256_set_epi32(INT32_C(-1588701318), INT32_C( 1302553373), INT32_C(  808500164), INT32_C( -517725260),
+                            INT32_C( 1597636847), INT32_C( -783780021), INT32_C( -548885053), INT32_C( -552760663)) },
+    { simde_mm256_set_epi32(INT32_C(  912025182), INT32_C( 1377081677), INT32_C(-1469529265), INT32_C(-1829770103),
+                            INT32_C( -426390986), INT32_C(-1110568799), INT32_C(-2075115494), INT32_C( 1142695141)),
+      simde_mm256_set_epi32(INT32_C( 1153514376), INT32_C( 1818122364), INT32_C(-1992752795), INT32_C(  328793385),
+                            INT32_C(   87783709), INT32_C(  433608323), INT32_C(-2112732046), INT32_C(-1212664786)),
+      simde_mm256_set_epi32(INT32_C(-1323330556), INT32_C(-1663959410), INT32_C(-2005860437), INT32_C(  995667928),
+                            INT32_C(  521392032), INT32_C(  969570464), INT32_C(-1536959785), INT32_C( -932420353)) },
+    { simde_mm256_set_epi32(INT32_C(  970653694), INT32_C( -780539802), INT32_C( 1319098071), INT32_C( -165009187),
+                            INT32_C(-1562685508), INT32_C( 1346767984), INT32_C(  374641592), INT32_C(  778569342)),
+      simde_mm256_set_epi32(INT32_C(  201330286), INT32_C( 1387902177), INT32_C( -627586829), INT32_C( -232993382),
+                            INT32_C( 2062484938), INT32_C(-1890600827), INT32_C( 1527763490), INT32_C( -378316527)),
+      simde_mm256_set_epi32(INT32_C( 1589232463), INT32_C( -860580211), INT32_C(  190113892), INT32_C( 1154088884),
+                            INT32_C(  171884111), INT32_C( 1149446963), INT32_C( -215917524), INT32_C( 1153210934)) },
+    { simde_mm256_set_epi32(INT32_C( 1334071543), INT32_C(  359222750), INT32_C(-1385987957), INT32_C( -765014648),
+                            INT32_C( 1416497303), INT32_C(-1935310085), INT32_C(-1606653221), INT32_C(  -65124328)),
+      simde_mm256_set_epi32(INT32_C( -905042213), INT32_C( 1266973341), INT32_C( 1134326449), INT32_C( -692990370),
+                            INT32_C( -384852225), INT32_C( -933438548), INT32_C( -921857283), INT32_C(-1774048041)),
+      simde_mm256_set_epi32(INT32_C(  361931128), INT32_C(  441336079), INT32_C( 1693294293), INT32_C( 2143964691),
+                            INT32_C(-1318290773), INT32_C( 1599061972), INT32_C( -518812782), INT32_C(-1671777549)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_hadd_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i32gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C(  850362205), INT32_C(-1414499816), INT32_C(-1563225106), INT32_C(-1142117515),
+    INT32_C(-1770229660), INT32_C( -393268971), INT32_C(-1149057157), INT32_C(  916149174),
+    INT32_C( 1071181222), INT32_C( -954646175), INT32_C(-2041390708), INT32_C( -562663289),
+    INT32_C(-1089870679), INT32_C(-1934929996), INT32_C( 1816406179), INT32_C( -521146366),
+    INT32_C( -194843355), INT32_C( 1717043917), INT32_C( 1418418096), INT32_C(-1080509512),
+    INT32_C(  811915762), INT32_C( 1623788952), INT32_C(-1197003856), INT32_C( 1579028139),
+    INT32_C( -717142648), INT32_C( 1409597414), INT32_C(-1190536676), INT32_C( 1334976548),
+    INT32_C( -664474857), INT32_C(  816809605), INT32_C(-1911288302), INT32_C(  -82064653),
+    INT32_C(  890182118), INT32_C(-1155170129), INT32_C( 2033441810), INT32_C( -245912333),
+    INT32_C( 1434731546), INT32_C( 1532037955), INT32_C( -481168663), INT32_C( -379064720),
+    INT32_C(-1036622332), INT32_C( 2000124749), INT32_C(  400310997), INT32_C( -534316785),
+    INT32_C(  611853535), INT32_C(  -44456330), INT32_C(-2069677580), INT32_C(  -80253117),
+    INT32_C( 1570410420), INT32_C(-1055944059), INT32_C(-1045035916), INT32_C( -399362486),
+    INT32_C(-1420833583), INT32_C(  -67741624), INT32_C( -897099810), INT32_C(-1080001399),
+    INT32_C(-2059062852), INT32_C(  396780060), INT32_C( -223387827), INT32_C(-1142245567),
+    INT32_C( 1769831406), INT32_C( -693116235), INT32_C(-1756660457), INT32_C(  730072578)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(        -24), INT32_C(         21), INT32_C(          3), INT32_C(          5)),
+      simde_mm_set_epi32(INT32_C( 1071181222), INT32_C(  -67741624), INT32_C( -245912333), INT32_C( 1532037955)) },
+    { simde_mm_set_epi32(INT32_C(         17), INT32_C(         18), INT32_C(        -27), INT32_C(        -28)),
+      simde_mm_set_epi32(INT32_C(-1055944059), INT32_C(-1045035916), INT32_C( -393268971), INT32_C(-1770229660)) },
+    { simde_mm_set_epi32(INT32_C(        -10), INT32_C(         11), INT32_C(         -6), INT32_C(        -16)),
+      simde_mm_set_epi32(INT32_C(-1197003856), INT32_C( -534316785), INT32_C(-1190536676), INT32_C( -194843355)) },
+    { simde_mm_set_epi32(INT32_C(         10), INT32_C(        -14), INT32_C(        -13), INT32_C(         21)),
+      simde_mm_set_epi32(INT32_C(  400310997), INT32_C( 1418418096), INT32_C(-1080509512), INT32_C(  -67741624)) },
+    { simde_mm_set_epi32(INT32_C(        -23), INT32_C(        -21), INT32_C(         17), INT32_C(        -11)),
+      simde_mm_set_epi32(INT32_C( -954646175), INT32_C( -562663289), INT32_C(-1055944059), INT32_C( 1623788952)) },
+    { simde_mm_set_epi32(INT32_C(        -12), INT32_C(          9), INT32_C(         29), INT32_C(         10)),
+      simde_mm_set_epi32(INT32_C(  811915762), INT32_C( 2000124749), INT32_C( -693116235), INT32_C(  400310997)) },
+    { simde_mm_set_epi32(INT32_C(         30), INT32_C(         28), INT32_C(        -14), INT32_C(         20)),
+      simde_mm_set_epi32(INT32_C(-1756660457), INT32_C( 1769831406), INT32_C( 1418418096), INT32_C(-1420833583)) },
+    { simde_mm_set_epi32(INT32_C(        -21), INT32_C(         17), INT32_C(         31), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C( -562663289), INT32_C(-1055944059), INT32_C(  730072578), INT32_C(  890182118)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_i32gather_epi32(&(table[32]), test_vec[i].vindex, 4);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i32gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C( -298524333), INT32_C(-2077201197), INT32_C(-1386620755), INT32_C(-1555573748),
+    INT32_C( 1441979360), INT32_C(  985519279), INT32_C(  348369414), INT32_C( -102198380),
+    INT32_C(-1546996794), INT32_C(-2048646112), INT32_C(-1093980222), INT32_C(-1298965179),
+    INT32_C(-1385224337), INT32_C(-2136113034), INT32_C( 1402631419), INT32_C(-2112349565),
+    INT32_C( -242462499), INT32_C( 1680475262), INT32_C( 1836676046), INT32_C( 2057381743),
+    INT32_C( 2093730316), INT32_C( 1178741334), INT32_C( 1097830522), INT32_C( 1406163615),
+    INT32_C( 1630924027), INT32_C(  838241565), INT32_C( 1494342325), INT32_C(-1516976883),
+    INT32_C( -655919710), INT32_C( -307052165), INT32_C(  729246102), INT32_C(-1850411155),
+    INT32_C(-1595278316), INT32_C( -804600967), INT32_C(  357519667), INT32_C( 1343156065),
+    INT32_C(  971428278), INT32_C(  -39013631), INT32_C(  484377066), INT32_C(-1046990220),
+    INT32_C( -923568654), INT32_C(  784142145), INT32_C(  272563678), INT32_C( -727458808),
+    INT32_C( -344995181), INT32_C(-1572465038), INT32_C(  303832811), INT32_C(-1305825316),
+    INT32_C(-1378055337), INT32_C(-1397239286), INT32_C(   11375325), INT32_C( 1698296334),
+    INT32_C(  556653725), INT32_C(  -56368897), INT32_C( -467603081), INT32_C(-1870889729),
+    INT32_C(-1559645031), INT32_C( -926840750), INT32_C( -126349665), INT32_C(-1434077457),
+    INT32_C(-1829944051), INT32_C(  699554489), INT32_C( -614995823), INT32_C( -962081158)
+  };
+
+  const struct {
+    simde__m128i src;
+    simde__m128i vindex;
+    simde__m128i mask;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C( -904347676), INT32_C( -747924743), INT32_C( -487515188), INT32_C( 1855289693)),
+      simde_mm_set_epi32(INT32_C(        -23), INT32_C(         -5), INT32_C(          6), INT32_C(          5)),
+      simde_mm_set_epi32(INT32_C( 1278234869), INT32_C(  666532035), INT32_C(  556791989), INT32_C( 1631577735)),
+      simde_mm_set_epi32(INT32_C( -904347676), INT32_C( -747924743), INT32_C( -487515188), INT32_C( 1855289693)) },
+    { simde_mm_set_epi32(INT32_C( -290109107), INT32_C( -489581413), INT32_C( -155376285), INT32_C( 1835525214)),
+      simde_mm_set_epi32(INT32_C(        -19), INT32_C(         -7), INT32_C(        -29), INT32_C(         25)),
+      simde_mm_set_epi32(INT32_C( 1489071885), INT32_C(   91205789), INT32_C(-1806943093), INT32_C( 1101724995)),
+      simde_mm_set_epi32(INT32_C( -290109107), INT32_C( -489581413), INT32_C(-1555573748), INT32_C( 1835525214)) },
+    { simde_mm_set_epi32(INT32_C(-1116108704), INT32_C( 1615126297), INT32_C( 1606997787), INT32_C(-1574521394)),
+      simde_mm_set_epi32(INT32_C(        -25), INT32_C(        -16), INT32_C(          5), INT32_C(        -30)),
+      simde_mm_set_epi32(INT32_C( -936198160), INT32_C( 1109586858), INT32_C(-2096680703), INT32_C( 1496663954)),
+      simde_mm_set_epi32(INT32_C( -102198380), INT32_C( 1615126297), INT32_C(  -39013631), INT32_C(-1574521394)) },
+    { simde_mm_set_epi32(INT32_C( 2120151387), INT32_C(-1744567290), INT32_C( 1678961023), INT32_C( 1002724587)),
+      simde_mm_set_epi32(INT32_C(         20), INT32_C(        -27), INT32_C(         -8), INT32_C(         14)),
+      simde_mm_set_epi32(INT32_C( -141759147), INT32_C( -455402659), INT32_C( 2038724761), INT32_C( -992664223)),
+      simde_mm_set_epi32(INT32_C(  556653725), INT32_C(  985519279), INT32_C( 1678961023), INT32_C(  303832811)) },
+    { simde_mm_set_epi32(INT32_C( -360503354), INT32_C( 1083938467), INT32_C( 1203154813), INT32_C(  291601316)),
+      simde_mm_set_epi32(INT32_C(        -31), INT32_C(         23), INT32_C(         -2), INT32_C(         23)),
+      simde_mm_set_epi32(INT32_C(  976754387), INT32_C(-1830465118), INT32_C(-1687705367), INT32_C( 1494056424)),
+      simde_mm_set_epi32(INT32_C( -360503354), INT32_C(-1870889729), INT32_C(  729246102), INT32_C(  291601316)) },
+    { simde_mm_set_epi32(INT32_C(-1315819400), INT32_C( -519976946), INT32_C( 1457362621), INT32_C(  699839364)),
+      simde_mm_set_epi32(INT32_C(         15), INT32_C(        -30), INT32_C(         -9), INT32_C(        -28)),
+      simde_mm_set_epi32(INT32_C( -885815688), INT32_C( 1391447608), INT32_C(-1545298157), INT32_C( -257478371)),
+      simde_mm_set_epi32(INT32_C(-1305825316), INT32_C( -519976946), INT32_C( 1406163615), INT32_C( 1441979360)) },
+    { simde_mm_set_epi32(INT32_C(  849690068), INT32_C( -404965097), INT32_C(  -98131679), INT32_C( 1569092114)),
+      simde_mm_set_epi32(INT32_C(        -13), INT32_C(         10), INT32_C(        -20), INT32_C(         12)),
+      simde_mm_set_epi32(INT32_C( 1524453272), INT32_C( 1183959245), INT32_C( -600638000), INT32_C( 1720448709)),
+      simde_mm_set_epi32(INT32_C(  849690068), INT32_C( -404965097), INT32_C(-1385224337), INT32_C( 1569092114)) },
+    { simde_mm_set_epi32(INT32_C( 2103015304), INT32_C( 1683815398), INT32_C( -106035463), INT32_C( 1369888134)),
+      simde_mm_set_epi32(INT32_C(         -4), INT32_C(         -6), INT32_C(         13), INT32_C(         23)),
+      simde_mm_set_epi32(INT32_C( 1696194773), INT32_C(-1709954486), INT32_C(-1245775605), INT32_C(  420197101)),
+      simde_mm_set_epi32(INT32_C( 2103015304), INT32_C( 1494342325), INT32_C(-1572465038), INT32_C( 1369888134)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mask_i32gather_epi32(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 4);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C( -859448623), INT32_C( 1801406251), INT32_C(-1171195035), INT32_C( -469336323),
+    INT32_C(  557968581), INT32_C( 1815127811), INT32_C(-1204525482), INT32_C( -606938249),
+    INT32_C(  529844208), INT32_C(  453454207), INT32_C(   60204355), INT32_C(-2098353487),
+    INT32_C(  149141137), INT32_C(  783353314), INT32_C(  431540196), INT32_C(  368183475),
+    INT32_C( -353030387), INT32_C(   39233859), INT32_C( -496999888), INT32_C(-1712322845),
+    INT32_C(  725953998), INT32_C(  -61704011), INT32_C(  928891131), INT32_C(  130855233),
+    INT32_C( 1241567581), INT32_C(  157353878), INT32_C( 1531787067), INT32_C(-2099135279),
+    INT32_C(-1454788911), INT32_C(-1304402920), INT32_C(  288428361), INT32_C(-1230790517),
+    INT32_C( 1805914801), INT32_C( 2086294253), INT32_C( 1061781482), INT32_C( 1736121649),
+    INT32_C( -703593767), INT32_C( 1568475413), INT32_C( 1219071231), INT32_C(-1643089806),
+    INT32_C(  596405899), INT32_C( -158897403), INT32_C( 1882516847), INT32_C( 1994730982),
+    INT32_C(  -51680348), INT32_C( 1167389471), INT32_C( -149608123), INT32_C( 1341185524),
+    INT32_C(  253859509), INT32_C( -133382385), INT32_C(  823512813), INT32_C(-1583022819),
+    INT32_C(-1503739490), INT32_C( -490092401), INT32_C(  401759431), INT32_C( -749782675),
+    INT32_C(  359114352), INT32_C( 1752073481), INT32_C(  152410626), INT32_C(  620312353),
+    INT32_C( 1656733762), INT32_C( 1938450984), INT32_C(-1337267431), INT32_C(   18971981)
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(         22), INT32_C(        -30), INT32_C(         19), INT32_C(          3),
+                            INT32_C(        -12), INT32_C(        -15), INT32_C(         -8), INT32_C(        -23)),
+      simde_mm256_set_epi32(INT32_C(  401759431), INT32_C(-1171195035), INT32_C(-1583022819), INT32_C( 1736121649),
+                            INT32_C(  725953998), INT32_C(   39233859), INT32_C( 1241567581), INT32_C(  453454207)) },
+    { simde_mm256_set_epi32(INT32_C(         -3), INT32_C(        -31), INT32_C(         18), INT32_C(        -21),
+                            INT32_C(        -28), INT32_C(         19), INT32_C(        -27), INT32_C(         13)),
+      simde_mm256_set_epi32(INT32_C(-1304402920), INT32_C( 1801406251), INT32_C(  823512813), INT32_C(-2098353487),
+                            INT32_C(  557968581), INT32_C(-1583022819), INT32_C( 1815127811), INT32_C( 1167389471)) },
+    { simde_mm256_set_epi32(INT32_C(        -13), INT32_C(          7), INT32_C(        -20), INT32_C(         11),
+                            INT32_C(         28), INT32_C(         17), INT32_C(         13), INT32_C(        -22)),
+      simde_mm256_set_epi32(INT32_C(-1712322845), INT32_C(-1643089806), INT32_C(  149141137), INT32_C( 1994730982),
+                            INT32_C( 1656733762), INT32_C( -133382385), INT32_C( 1167389471), INT32_C(   60204355)) },
+    { simde_mm256_set_epi32(INT32_C(         27), INT32_C(        -21), INT32_C(        -15), INT32_C(         -9),
+                            INT32_C(         17), INT32_C(        -18), INT32_C(         -7), INT32_C(          3)),
+      simde_mm256_set_epi32(INT32_C(  620312353), INT32_C(-2098353487), INT32_C(   39233859), INT32_C(  130855233),
+                            INT32_C( -133382385), INT32_C(  431540196), INT32_C(  157353878), INT32_C( 1736121649)) },
+    { simde_mm256_set_epi32(INT32_C(         22), INT32_C(        -29), INT32_C(         21), INT32_C(          6),
+                            INT32_C(         10), INT32_C(        -30), INT32_C(         12), INT32_C(         13)),
+      simde_mm256_set_epi32(INT32_C(  401759431), INT32_C( -469336323), INT32_C( -490092401), INT32_C( 1219071231),
+                            INT32_C( 1882516847), INT32_C(-1171195035), INT32_C(  -51680348), INT32_C( 1167389471)) },
+    { simde_mm256_set_epi32(INT32_C(        -30), INT32_C(         -8), INT32_C(         21), INT32_C(        -12),
+                            INT32_C(         -9), INT32_C(        -11), INT32_C(         -1), INT32_C(        -28)),
+      simde_mm256_set_epi32(INT32_C(-1171195035), INT32_C( 1241567581), INT32_C( -490092401), INT32_C(  725953998),
+                            INT32_C(  130855233), INT32_C(  -61704011), INT32_C(-1230790517), INT32_C(  557968581)) },
+    { simde_mm256_set_epi32(INT32_C(         12), INT32_C(          5), INT32_C(        -29), INT32_C(          6),
+                            INT32_C(        -20), INT32_C(        -29), INT32_C(         29), INT32_C(        -23)),
+      simde_mm256_set_epi32(INT32_C(  -51680348), INT32_C( 1568475413), INT32_C( -469336323), INT32_C( 1219071231),
+                            INT32_C(  149141137), INT32_C( -469336323), INT32_C( 1938450984), INT32_C(  453454207)) },
+    { simde_mm256_set_epi32(INT32_C(         12), INT32_C(         -1), INT32_C(        -20), INT32_C(         13),
+                            INT32_C(         19), INT32_C(        -28), INT32_C(         -8), INT32_C(         14)),
+      simde_mm256_set_epi32(INT32_C(  -51680348), INT32_C(-1230790517), INT32_C(  149141137), INT32_C( 1167389471),
+                            INT32_C(-1583022819), INT32_C(  557968581), INT32_C( 1241567581), INT32_C( -149608123)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_i32gather_epi32(&(table[32]), test_vec[i].vindex, 4);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i32gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C(-2014928081), INT32_C(  457427030), INT32_C(  873897797), INT32_C( -966226552),
+    INT32_C(  487428855), INT32_C( -855935665), INT32_C( 1967341879), INT32_C( -623564001),
+    INT32_C(-1728869663), INT32_C( 1724326195), INT32_C( -331071448), INT32_C(-1649760503),
+    INT32_C(-1420302754), INT32_C( 2109752880), INT32_C(-1036355945), INT32_C(-1203220817),
+    INT32_C(  -69710637), INT32_C(-1326087048), INT32_C(-1624831673), INT32_C( -453026318),
+    INT32_C( 1740291403), INT32_C(  932231019), INT32_C(   20835567), INT32_C( -228841219),
+    INT32_C( -899900657), INT32_C(-1006599913), INT32_C(-1419408699), INT32_C(  685454282),
+    INT32_C( 1516648454), INT32_C( 1567488608), INT32_C(-1797048569), INT32_C(-1989845681),
+    INT32_C(  -16432170), INT32_C( -297779692), INT32_C( 1758824189), INT32_C(  525549996),
+    INT32_C(-1704309085), INT32_C( 1357370065), INT32_C( -434851396), INT32_C(  143103107),
+    INT32_C(  845972360), INT32_C( -370095204), INT32_C(-1450383880), INT32_C( -800678468),
+    INT32_C(   58851485), INT32_C(-1579276151), INT32_C( 1801943944), INT32_C(  -70639373),
+    INT32_C(  352952410), INT32_C( 1270614729), INT32_C(  435867395), INT32_C(  807691917),
+    INT32_C( 1635752550), INT32_C( 1488975053), INT32_C( -738431466), INT32_C( -216410048),
+    INT32_C(  441095640), INT32_C( 1575369788), INT32_C(-1411346569), INT32_C(  862013372),
+    INT32_C(-1359238423), INT32_C( -977220225), INT32_C( -737260018), INT32_C(  710567657)
+  };
+
+  const struct {
+    simde__m256i src;
+    simde__m256i vindex;
+    simde__m256i mask;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(  840206699), INT32_C(  253450164), INT32_C( 1917497744), INT32_C(-2047973346),
+                            INT32_C( 1177185386), INT32_C(-1658875211), INT32_C( -669473374), INT32_C(-1917314458)),
+      simde_mm256_set_epi32(INT32_C(         11), INT32_C(         -7), INT32_C(         13), INT32_C(         31),
+                            INT32_C(         24), INT32_C(        -14), INT32_C(         14), INT32_C(        -10)),
+      simde_mm256_set_epi32(INT32_C( -987549214), INT32_C( -283175041), INT32_C(-1292300360), INT32_C( -712741133),
+                            INT32_C( -184728263), INT32_C( -656030027), INT32_C( -797770840), INT32_C(-1459540119)),
+      simde_mm256_set_epi32(INT32_C( -800678468), INT32_C(-1006599913), INT32_C(-1579276151), INT32_C(  710567657),
+                            INT32_C(  441095640), INT32_C(-1624831673), INT32_C( 1801943944), INT32_C(   20835567)) },
+    { simde_mm256_set_epi32(INT32_C(-1719515941), INT32_C(-1158200455), INT32_C( -100232282), INT32_C( 1577994280),
+                            INT32_C(  -37461353), INT32_C(  897872027), INT32_C(   89649698), INT32_C(-1626403392)),
+      simde_mm256_set_epi32(INT32_C(          9), INT32_C(         25), INT32_C(        -22), INT32_C(         21),
+                            INT32_C(         21), INT32_C(         -2), INT32_C(        -10), INT32_C(        -32)),
+      simde_mm256_set_epi32(INT32_C( -843444543), INT32_C( -632504908), INT32_C(-1678857296), INT32_C( 1425633700),
+                            INT32_C(-1522669056), INT32_C( 2090674981), INT32_C(  867892180), INT32_C( 1107990319)),
+      simde_mm256_set_epi32(INT32_C( -370095204), INT32_C( 1575369788), INT32_C( -331071448), INT32_C( 1577994280),
+                            INT32_C( 1488975053), INT32_C(  897872027), INT32_C(   89649698), INT32_C(-1626403392)) },
+    { simde_mm256_set_epi32(INT32_C( 1750228209), INT32_C(-2037655841), INT32_C( 1642213103), INT32_C( 1770309566),
+                            INT32_C( -840935693), INT32_C(  300695743), INT32_C( 1531666310), INT32_C(-2091398558)),
+      simde_mm256_set_epi32(INT32_C(        -21), INT32_C(         -2), INT32_C(          8), INT32_C(          3),
+                            INT32_C(          8), INT32_C(         -9), INT32_C(         20), INT32_C(         10)),
+      simde_mm256_set_epi32(INT32_C( -629904173), INT32_C(-1092148899), INT32_C( 1799742109), INT32_C( -460758556),
+                            INT32_C( -687528472), INT32_C(  982486644), INT32_C( -849797142), INT32_C(  744409385)),
+      simde_mm256_set_epi32(INT32_C(-1649760503), INT32_C(-1797048569), INT32_C( 1642213103), INT32_C(  525549996),
+                            INT32_C(  845972360), INT32_C(  300695743), INT32_C( 1635752550), INT32_C(-2091398558)) },
+    { simde_mm256_set_epi32(INT32_C( 1310611010), INT32_C(   10046755), INT32_C( 2068310070), INT32_C(  107130346),
+                            INT32_C(-1082948536), INT32_C(-1354938898), INT32_C( 1291786613), INT32_C( -251672445)),
+      simde_mm256_set_epi32(INT32_C(        -31), INT32_C(         19), INT32_C(         21), INT32_C(        -15),
+                            INT32_C(         -6), INT32_C(        -25), INT32_C(         21), INT32_C(         18)),
+      simde_mm256_set_epi32(INT32_C(  341897547), INT32_C( 1126430409), INT32_C( -696997567), INT32_C( -385890621),
+                            INT32_C( 1403549806), INT32_C( 1313744521), INT32_C(  268337411), INT32_C( -133513330)),
+      simde_mm256_set_epi32(INT32_C( 1310611010), INT32_C(   10046755), INT32_C( 1488975053), INT32_C(-1326087048),
+                            INT32_C(-1082948536), INT32_C(-1354938898), INT32_C( 1291786613), INT32_C(  435867395)) },
+    { simde_mm256_set_epi32(INT32_C( 1086289796), INT32_C(  518892791), INT32_C(-1939973999), INT32_C( -927108678),
+                            INT32_C(-1054246557), INT32_C( 1937327614), INT32_C( -110002168), INT32_C(-1411080802)),
+      simde_mm256_set_epi32(INT32_C(        -31), INT32_C(         26), INT32_C(         29), INT32_C(        -10),
+                            INT32_C(        -16), INT32_C(        -31), INT32_C(          0), INT32_C(         16)),
+      simde_mm256_set_epi32(INT32_C(-1181327322), INT32_C( -507499805), INT32_C( -467882054), INT32_C(  378105727),
+                            INT32_C( 1997642473), INT32_C(-1671116920), INT32_C( -147873649), INT32_C(-2140604542)),
+      simde_mm256_set_epi32(INT32_C(  457427030), INT32_C(-1411346569), INT32_C( -977220225), INT32_C( -927108678),
+                            INT32_C(-1054246557), INT32_C(  457427030), INT32_C(  -16432170), INT32_C(  352952410)) },
+    { simde_mm256_set_epi32(INT32_C(-1873886738), INT32_C(-1818037808), INT32_C( -810666482), INT32_C( 1184048624),
+                            INT32_C( 1656166211), INT32_C( -623909824), INT32_C( 1952642450), INT32_C( -849398394)),
+      simde_mm256_set_epi32(INT32_C(        -27), INT32_C(        -14), INT32_C(         29), INT32_C(        -18),
+                            INT32_C(        -32), INT32_C(        -29), INT32_C(          1), INT32_C(         21)),
+      simde_mm256_set_epi32(INT32_C(  917753384), INT32_C(  405560862), INT32_C(  443742481), INT32_C( 1466825421),
+                            INT32_C(-1896666728), INT32_C(  553247350), INT32_C( 1152212900), INT32_C(    4984900)),
+      simde_mm256_set_epi32(INT32_C(-1873886738), INT32_C(-1818037808), INT32_C( -810666482), INT32_C( 1184048624),
+                            INT32_C(-2014928081), INT32_C( -623909824), INT32_C( 1952642450), INT32_C( -849398394)) },
+    { simde_mm256_set_epi32(INT32_C(  147424832), INT32_C( 1883014062), INT32_C(  888513082), INT32_C(   43990912),
+                            INT32_C(-1928516170), INT32_C( 1051569784), INT32_C(-1946879098), INT32_C(-1857851446)),
+      simde_mm256_set_epi32(INT32_C(         -4), INT32_C(        -12), INT32_C(        -24), INT32_C(          1),
+                            INT32_C(        -11), INT32_C(         19), INT32_C(         19), INT32_C(        -24)),
+      simde_mm256_set_epi32(INT32_C(-2064048265), INT32_C( -871716422), INT32_C( 1884087776), INT32_C( 1242613170),
+                            INT32_C( -914059268), INT32_C( -144495797), INT32_C( 1402381728), INT32_C(-1383699436)),
+      simde_mm256_set_epi32(INT32_C( 1516648454), INT32_C( 1740291403), INT32_C(  888513082), INT32_C(   43990912),
+                            INT32_C(  932231019), INT32_C(  807691917), INT32_C(-1946879098), INT32_C(-1728869663)) },
+    { simde_mm256_set_epi32(INT32_C( 1545264473), INT32_C(-1663230671), INT32_C( -192678904), INT32_C( 1954422324),
+                            INT32_C(  244710109), INT32_C(-2073646749), INT32_C(-1265904094), INT32_C(  142971109)),
+      simde_mm256_set_epi32(INT32_C(         31), INT32_C(         -1), INT32_C(          3), INT32_C(         14),
+                            INT32_C(         10), INT32_C(         -6), INT32_C(          3), INT32_C(        -30)),
+      simde_mm256_set_epi32(INT32_C( -345824822), INT32_C( 1410255300), INT32_C(-1881391975), INT32_C(-2107882297),
+                            INT32_C( -889471930), INT32_C(-1077781380), INT32_C(  548137163), INT32_C( 1062852166)),
+      simde_mm256_set_epi32(INT32_C(  710567657), INT32_C(-1663230671), INT32_C(  525549996), INT32_C( 1801943944),
+                            INT32_C(-1450383880), INT32_C(-1419408699), INT32_C(-1265904094), INT32_C(  142971109)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_i32gather_epi32(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 4);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i64gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C( 1985500176), INT32_C( -930483586), INT32_C( 1097200829), INT32_C(-1224778493),
+    INT32_C(  549810997), INT32_C(-1902526932), INT32_C(  920901815), INT32_C(  347802026),
+    INT32_C(   78617144), INT32_C( -685434922), INT32_C( 2104854646), INT32_C( 1736432273),
+    INT32_C(   80468717), INT32_C(  276605874), INT32_C(-1441762182), INT32_C(  177206423),
+    INT32_C( 1444072418), INT32_C(  554404476), INT32_C( -452993349), INT32_C(-1424389987),
+    INT32_C(-1158073432), INT32_C( -209875283), INT32_C( 2059114602), INT32_C( 1838025240),
+    INT32_C( 1872276333), INT32_C( 1439362935), INT32_C( 1723984585), INT32_C( 1118674528),
+    INT32_C( 1221269390), INT32_C(-2117699504), INT32_C( 1023800952), INT32_C(-1494526177),
+    INT32_C( 1217368773), INT32_C( 1052617808), INT32_C( -337367546), INT32_C(-2114420324),
+    INT32_C(-1159594402), INT32_C(  528793903), INT32_C( 2136040237), INT32_C( -131695393),
+    INT32_C(  304013645), INT32_C( -449614970), INT32_C( 1881953868), INT32_C(  876384654),
+    INT32_C(-1258844554), INT32_C( 2012659055), INT32_C( -196341509), INT32_C(  307131645),
+    INT32_C(-1269689742), INT32_C(   45695311), INT32_C(  362809422), INT32_C( -696503679),
+    INT32_C(  699847961), INT32_C( 1414170913), INT32_C(-1727445050), INT32_C(  326351418),
+    INT32_C( 1685345953), INT32_C(-1809296264), INT32_C(  435042971), INT32_C( -434200823),
+    INT32_C(  516149387), INT32_C(-1351394334), INT32_C( 1121937908), INT32_C( -596706312)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(                   1), INT64_C(                  13)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( -337367546), INT32_C(  435042971)) },
+    { simde_mm_set_epi64x(INT64_C(                  -8), INT64_C(                  -8)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1444072418), INT32_C( 1444072418)) },
+    { simde_mm_set_epi64x(INT64_C(                  -3), INT64_C(                  -4)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1723984585), INT32_C( 1872276333)) },
+    { simde_mm_set_epi64x(INT64_C(                   3), INT64_C(                   9)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 2136040237), INT32_C(  362809422)) },
+    { simde_mm_set_epi64x(INT64_C(                  -9), INT64_C(                  -9)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(-1441762182), INT32_C(-1441762182)) },
+    { simde_mm_set_epi64x(INT64_C(                 -16), INT64_C(                  -6)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1985500176), INT32_C(-1158073432)) },
+    { simde_mm_set_epi64x(INT64_C(                  13), INT64_C(                  12)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(  435042971), INT32_C( 1685345953)) },
+    { simde_mm_set_epi64x(INT64_C(                   5), INT64_C(                  -6)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1881953868), INT32_C(-1158073432)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_i64gather_epi32(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i64gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C( 1616151438), INT32_C( 1262321760), INT32_C( 1560092511), INT32_C( -185133088),
+    INT32_C(  765889893), INT32_C( -650965729), INT32_C( -925382066), INT32_C(-1628710685),
+    INT32_C( -622995301), INT32_C(  766943589), INT32_C( 1621070067), INT32_C( -299709030),
+    INT32_C(-1408225109), INT32_C( 1749426371), INT32_C(  171315794), INT32_C( 1110630278),
+    INT32_C( -634235330), INT32_C( 1683408151), INT32_C(-1261447666), INT32_C(-1747289415),
+    INT32_C( -146047506), INT32_C(  311766958), INT32_C( 2129608630), INT32_C(  482990156),
+    INT32_C( -934089242), INT32_C( -450639181), INT32_C(  765252518), INT32_C(  719667571),
+    INT32_C( 1482848266), INT32_C( 1925137812), INT32_C( -292699638), INT32_C( 1661848733),
+    INT32_C( -530795233), INT32_C( 2081712831), INT32_C(  364311942), INT32_C(  659653329),
+    INT32_C( 1689740079), INT32_C(  954684916), INT32_C( -268808088), INT32_C(  827689054),
+    INT32_C(    6877505), INT32_C( -383959644), INT32_C( -448935896), INT32_C(  162191846),
+    INT32_C(   83063065), INT32_C( -787266100), INT32_C(-1721933854), INT32_C(  224597920),
+    INT32_C( -639837361), INT32_C( 1848146544), INT32_C(  184936020), INT32_C(  556904637),
+    INT32_C(  894822627), INT32_C( 1228894995), INT32_C(-1629018793), INT32_C(-1874920599),
+    INT32_C(-1067136129), INT32_C(-1181024393), INT32_C(-1991804484), INT32_C( -565571520),
+    INT32_C( 1622610285), INT32_C(-1034903152), INT32_C(-1560989375), INT32_C(  396384995)
+  };
+
+  const struct {
+    simde__m128i src;
+    simde__m128i vindex;
+    simde__m128i mask;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C( -460377178), INT32_C(-1283010755), INT32_C( 1166454194), INT32_C( 1008121091)),
+      simde_mm_set_epi64x(INT64_C(                  -5), INT64_C(                 -11)),
+      simde_mm_set_epi32(INT32_C( 2053020511), INT32_C(  755708340), INT32_C(-1715049827), INT32_C( 1997271138)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 2129608630), INT32_C( 1008121091)) },
+    { simde_mm_set_epi32(INT32_C(-2037817495), INT32_C( -561259779), INT32_C(   67013034), INT32_C(  614822302)),
+      simde_mm_set_epi64x(INT64_C(                   5), INT64_C(                  11)),
+      simde_mm_set_epi32(INT32_C(   -3631793), INT32_C( 1394154950), INT32_C( -974122757), INT32_C(-1605597720)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( -448935896), INT32_C(-1629018793)) },
+    { simde_mm_set_epi32(INT32_C( -193294013), INT32_C(  630355123), INT32_C(  659403344), INT32_C(  805998074)),
+      simde_mm_set_epi64x(INT64_C(                  -9), INT64_C(                   1)),
+      simde_mm_set_epi32(INT32_C(-1418475315), INT32_C( 1801686592), INT32_C( -550535158), INT32_C(  452429563)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(  171315794), INT32_C(  805998074)) },
+    { simde_mm_set_epi32(INT32_C( 1458268094), INT32_C(-1552085508), INT32_C(-1141893435), INT32_C(  699565530)),
+      simde_mm_set_epi64x(INT64_C(                  15), INT64_C(                 -12)),
+      simde_mm_set_epi32(INT32_C(  318972691), INT32_C( 1171929204), INT32_C(-1477657279), INT32_C(  591366704)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(-1560989375), INT32_C(  699565530)) },
+    { simde_mm_set_epi32(INT32_C(-2049817397), INT32_C( 1742213134), INT32_C( -572502335), INT32_C( 1302333597)),
+      simde_mm_set_epi64x(INT64_C(                  12), INT64_C(                  14)),
+      simde_mm_set_epi32(INT32_C(-1609552792), INT32_C( 2091087231), INT32_C(  100152007), INT32_C(  858857380)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( -572502335), INT32_C( 1302333597)) },
+    { simde_mm_set_epi32(INT32_C( -261201173), INT32_C( 1006028071), INT32_C(-2039711640), INT32_C(-2060096157)),
+      simde_mm_set_epi64x(INT64_C(                  -2), INT64_C(                  -1)),
+      simde_mm_set_epi32(INT32_C(-1795040646), INT32_C( -248948471), INT32_C(-1661999498), INT32_C( -345783155)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1482848266), INT32_C( -292699638)) },
+    { simde_mm_set_epi32(INT32_C( -801054248), INT32_C(-1558764582), INT32_C( -484449615), INT32_C(-1026854938)),
+      simde_mm_set_epi64x(INT64_C(                 -14), INT64_C(                   9)),
+      simde_mm_set_epi32(INT32_C(  805480364), INT32_C(-1715438453), INT32_C(-1643730649), INT32_C( -625407514)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(  765889893), INT32_C(  184936020)) },
+    { simde_mm_set_epi32(INT32_C(-1640739129), INT32_C( 1340518235), INT32_C(  117648864), INT32_C(  338316326)),
+      simde_mm_set_epi64x(INT64_C(                  -4), INT64_C(                  -5)),
+      simde_mm_set_epi32(INT32_C( -458636172), INT32_C( -711798929), INT32_C(  959649657), INT32_C(  797725212)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(  117648864), INT32_C(  338316326)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mask_i64gather_epi32(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C(   46229928), INT32_C(-2126416474), INT32_C( -835047836), INT32_C(-1174344413),
+    INT32_C( -843267791), INT32_C(-1753506224), INT32_C(-2002919316), INT32_C(  437801691),
+    INT32_C( -765657660), INT32_C( -252731249), INT32_C(-1913993369), INT32_C(-1713054252),
+    INT32_C( 1157844912), INT32_C( 1237114133), INT32_C(-1872824563), INT32_C( 1567055663),
+    INT32_C( -364082413), INT32_C(-1908490489), INT32_C(  390015273), INT32_C( 1879349511),
+    INT32_C(-1036072510), INT32_C(-1089400063), INT32_C(-1465938906), INT32_C( 1212345129),
+    INT32_C(  455541722), INT32_C( -419574619), INT32_C(-1641282409), INT32_C(-1704450891),
+    INT32_C( 1150642019), INT32_C(  285205508), INT32_C( 1896735846), INT32_C( -963296955),
+    INT32_C( -440502093), INT32_C(-1013314486), INT32_C(-1769650294), INT32_C(-1253446449),
+    INT32_C( 1412186706), INT32_C( -140052564), INT32_C(  192642502), INT32_C(  172900521),
+    INT32_C( 1976498060), INT32_C(-2030223587), INT32_C(-1907985683), INT32_C( 1074977099),
+    INT32_C( 1697055660), INT32_C( 1441405655), INT32_C(  892548907), INT32_C( 1544062791),
+    INT32_C(-1271134200), INT32_C(  -87871677), INT32_C( -530947373), INT32_C(  804035421),
+    INT32_C(-1131313415), INT32_C( 1238246047), INT32_C( -135377205), INT32_C( -916490328),
+    INT32_C( 1457081844), INT32_C( -456446572), INT32_C( -600805673), INT32_C( 1135366377),
+    INT32_C(-1765695789), INT32_C(  607842069), INT32_C( 1050228658), INT32_C(  114285182)
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                  14), INT64_C(                   4),
+                             INT64_C(                  -8), INT64_C(                 -12)),
+      simde_mm_set_epi32(INT32_C(-1765695789), INT32_C( 1976498060), INT32_C( -364082413), INT32_C( -765657660)) },
+    { simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                   4),
+                             INT64_C(                 -10), INT64_C(                  -7)),
+      simde_mm_set_epi32(INT32_C( 1412186706), INT32_C( 1976498060), INT32_C( 1157844912), INT32_C(  390015273)) },
+    { simde_mm256_set_epi64x(INT64_C(                  -2), INT64_C(                   0),
+                             INT64_C(                 -11), INT64_C(                  11)),
+      simde_mm_set_epi32(INT32_C( 1150642019), INT32_C( -440502093), INT32_C(-1913993369), INT32_C( -135377205)) },
+    { simde_mm256_set_epi64x(INT64_C(                  -3), INT64_C(                  -3),
+                             INT64_C(                   2), INT64_C(                  11)),
+      simde_mm_set_epi32(INT32_C(-1641282409), INT32_C(-1641282409), INT32_C( 1412186706), INT32_C( -135377205)) },
+    { simde_mm256_set_epi64x(INT64_C(                  -2), INT64_C(                  13),
+                             INT64_C(                  -8), INT64_C(                  -5)),
+      simde_mm_set_epi32(INT32_C( 1150642019), INT32_C( -600805673), INT32_C( -364082413), INT32_C(-1465938906)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -10), INT64_C(                   3),
+                             INT64_C(                  -7), INT64_C(                  -8)),
+      simde_mm_set_epi32(INT32_C( 1157844912), INT32_C(  192642502), INT32_C(  390015273), INT32_C( -364082413)) },
+    { simde_mm256_set_epi64x(INT64_C(                  10), INT64_C(                 -14),
+                             INT64_C(                 -12), INT64_C(                 -16)),
+      simde_mm_set_epi32(INT32_C(-1131313415), INT32_C( -843267791), INT32_C( -765657660), INT32_C(   46229928)) },
+    { simde_mm256_set_epi64x(INT64_C(                  -4), INT64_C(                   8),
+                             INT64_C(                  15), INT64_C(                 -11)),
+      simde_mm_set_epi32(INT32_C(  455541722), INT32_C(-1271134200), INT32_C( 1050228658), INT32_C(-1913993369)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm256_i64gather_epi32(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i64gather_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int32_t table[64] = {
+    INT32_C(-1639938136), INT32_C( 1220929777), INT32_C( -853846544), INT32_C(  794287736),
+    INT32_C(  647203045), INT32_C( -602260362), INT32_C( 1748767445), INT32_C(  719057478),
+    INT32_C( 1406839202), INT32_C( 1253142907), INT32_C(-1246357456), INT32_C( 1623283162),
+    INT32_C(  675841018), INT32_C(-1522700296), INT32_C( -764897336), INT32_C(   74995887),
+    INT32_C( -149733472), INT32_C(-1132069856), INT32_C(  -42641571), INT32_C(-1752158200),
+    INT32_C(  543842348), INT32_C( 1896577418), INT32_C( 1685848275), INT32_C(  349772684),
+    INT32_C( -643666888), INT32_C( 1871893470), INT32_C( -138653035), INT32_C(  430708322),
+    INT32_C(  738512181), INT32_C(-1002399256), INT32_C(-1856305331), INT32_C(-1876143010),
+    INT32_C(  159431027), INT32_C(  470831359), INT32_C(-1041756156), INT32_C( 1677861382),
+    INT32_C(-1153475188), INT32_C(-1622964178), INT32_C( -726321228), INT32_C( -426687731),
+    INT32_C(   93100321), INT32_C(  104603337), INT32_C( -150907414), INT32_C( 1397870708),
+    INT32_C(-2082164407), INT32_C( -169855992), INT32_C( 1400322044), INT32_C(-1641228443),
+    INT32_C( -280638733), INT32_C( 1931706252), INT32_C(-1495539001), INT32_C( -243429193),
+    INT32_C( -990668796), INT32_C(-1507948689), INT32_C( 1296537851), INT32_C( 1167592589),
+    INT32_C(-2114142953), INT32_C(-2124036026), INT32_C(  511051332), INT32_C( -216158668),
+    INT32_C( -146566132), INT32_C( 1234368408), INT32_C( 1915662717), INT32_C( 1107871206)
+  };
+
+  const struct {
+    simde__m128i src;
+    simde__m256i vindex;
+    simde__m128i mask;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(  380704041), INT32_C( 1564552489), INT32_C(-1005401150), INT32_C(  750717918)),
+      simde_mm256_set_epi64x(INT64_C(                   3), INT64_C(                 -10),
+                             INT64_C(                 -11), INT64_C(                 -10)),
+      simde_mm_set_epi32(INT32_C(  752317189), INT32_C( -830141008), INT32_C( 1380203709), INT32_C(-1262663760)),
+      simde_mm_set_epi32(INT32_C(  380704041), INT32_C(  675841018), INT32_C(-1005401150), INT32_C(  675841018)) },
+    { simde_mm_set_epi32(INT32_C( 1308400911), INT32_C(-1595441381), INT32_C(-2032673744), INT32_C( -108880992)),
+      simde_mm256_set_epi64x(INT64_C(                  15), INT64_C(                  -6),
+                             INT64_C(                   4), INT64_C(                  13)),
+      simde_mm_set_epi32(INT32_C( 1520660924), INT32_C(-1512770737), INT32_C( -165776882), INT32_C(-1644526721)),
+      simde_mm_set_epi32(INT32_C( 1308400911), INT32_C(  543842348), INT32_C(   93100321), INT32_C(  511051332)) },
+    { simde_mm_set_epi32(INT32_C(  -73367992), INT32_C( 2127233901), INT32_C( -959118380), INT32_C( 1243261894)),
+      simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                  -6),
+                             INT64_C(                   9), INT64_C(                  -4)),
+      simde_mm_set_epi32(INT32_C( -790388601), INT32_C(-1398575293), INT32_C(-1873388869), INT32_C( -390129299)),
+      simde_mm_set_epi32(INT32_C(-1153475188), INT32_C(  543842348), INT32_C(-1495539001), INT32_C( -643666888)) },
+    { simde_mm_set_epi32(INT32_C(-1243084734), INT32_C( 2050159032), INT32_C( 1983564702), INT32_C( -909323997)),
+      simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                   6),
+                             INT64_C(                   8), INT64_C(                   8)),
+      simde_mm_set_epi32(INT32_C(-1206485327), INT32_C( -132721780), INT32_C( -107707125), INT32_C(-1863502938)),
+      simde_mm_set_epi32(INT32_C(-1153475188), INT32_C(-2082164407), INT32_C( -280638733), INT32_C( -280638733)) },
+    { simde_mm_set_epi32(INT32_C(-1042108470), INT32_C( 1557000959), INT32_C(-2107076170), INT32_C(  374868717)),
+      simde_mm256_set_epi64x(INT64_C(                  -4), INT64_C(                  -6),
+                             INT64_C(                  -8), INT64_C(                   2)),
+      simde_mm_set_epi32(INT32_C(  -82493534), INT32_C(  336994507), INT32_C( -328064309), INT32_C( 1039464285)),
+      simde_mm_set_epi32(INT32_C( -643666888), INT32_C( 1557000959), INT32_C( -149733472), INT32_C(  374868717)) },
+    { simde_mm_set_epi32(INT32_C(-1121065464), INT32_C( -271259389), INT32_C(  254898074), INT32_C( -168625244)),
+      simde_mm256_set_epi64x(INT64_C(                   8), INT64_C(                   0),
+                             INT64_C(                  10), INT64_C(                  -6)),
+      simde_mm_set_epi32(INT32_C(-1410593210), INT32_C(-1289267891), INT32_C(  121849298), INT32_C( -876574840)),
+      simde_mm_set_epi32(INT32_C( -280638733), INT32_C(  159431027), INT32_C(  254898074), INT32_C(  543842348)) },
+    { simde_mm_set_epi32(INT32_C(-1683715759), INT32_C( -297910611), INT32_C(  293634885), INT32_C( 1398640206)),
+      simde_mm256_set_epi64x(INT64_C(                   4), INT64_C(                 -10),
+                             INT64_C(                  15), INT64_C(                  10)),
+      simde_mm_set_epi32(INT32_C(-1161222662), INT32_C( -586302926), INT32_C( 1987590303), INT32_C(  422685710)),
+      simde_mm_set_epi32(INT32_C(   93100321), INT32_C(  675841018), INT32_C(  293634885), INT32_C( 1398640206)) },
+    { simde_mm_set_epi32(INT32_C(  968548782), INT32_C( -780725983), INT32_C(  566389931), INT32_C( -229759831)),
+      simde_mm256_set_epi64x(INT64_C(                 -14), INT64_C(                  13),
+                             INT64_C(                   3), INT64_C(                  -5)),
+      simde_mm_set_epi32(INT32_C( 1198125743), INT32_C( -962745314), INT32_C(  -37327211), INT32_C( 1192880164)),
+      simde_mm_set_epi32(INT32_C(  968548782), INT32_C(  511051332), INT32_C( -726321228), INT32_C( -229759831)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm256_mask_i64gather_epi32(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i32gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C( 3305897188295840937), INT64_C(  633709528032837433), INT64_C(-6861803097265595396), INT64_C( 8238808737706232163),
+    INT64_C(-1323446772933415470), INT64_C( 7563537279865220210), INT64_C(-2463912573809027086), INT64_C(-4804470783098557050),
+    INT64_C(-2134522228201783316), INT64_C( -457544015176911723), INT64_C( -528644108360900086), INT64_C(-6178182878917446003),
+    INT64_C( 8657137180960214171), INT64_C( 6289095895739157514), INT64_C( 7096057613211080043), INT64_C(-4950038701995638394),
+    INT64_C(-3549002035742068300), INT64_C( 1144515339511958907), INT64_C(-2434140302042388205), INT64_C( 1978564434257613513),
+    INT64_C(-6043700413885741925), INT64_C( 5327220697662887143), INT64_C(-3835467112765016215), INT64_C(-5637848282807526777),
+    INT64_C( 9040941794999550982), INT64_C( 8619526220216973085), INT64_C(-5250142871697217367), INT64_C(-3906152170544401318),
+    INT64_C(-1611677164581466696), INT64_C(-8319538471226097208), INT64_C(-5108487748335452999), INT64_C(-9167244992470380616),
+    INT64_C( 2259589852300232569), INT64_C(-6880417455150860137), INT64_C(-1834322801893902555), INT64_C(-4083171859850739513),
+    INT64_C( 6078754057105149976), INT64_C(-7487083065362226088), INT64_C( 1705960137151771345), INT64_C(-3494775304055135051),
+    INT64_C(  937751781193014330), INT64_C( 7637233684765716189), INT64_C( 7218904373408550601), INT64_C(-4473616278908922912),
+    INT64_C( -214001812172158344), INT64_C(  638271565065619462), INT64_C( 1711050561955748804), INT64_C( 1362334918803591339),
+    INT64_C( 3870449495583450044), INT64_C( 7449302686143001931), INT64_C( 1820876326171255621), INT64_C( 7804224327761432351),
+    INT64_C( 2965439556528302012), INT64_C( -449618908804789097), INT64_C( -862732489891612652), INT64_C(-6809304001770823025),
+    INT64_C( 6023662125189910498), INT64_C( 5326762800865754317), INT64_C( 1926183313643277517), INT64_C(  171890622635186278),
+    INT64_C(  452658382440689076), INT64_C( 3540353585125646924), INT64_C(-4193791107465622795), INT64_C( 6876158316250994562)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(         -5), INT32_C(        -25), INT32_C(        -25), INT32_C(         -5)),
+      simde_mm_set_epi64x(INT64_C(-4804470783098557050), INT64_C(-3906152170544401318)) },
+    { simde_mm_set_epi32(INT32_C(        -12), INT32_C(         12), INT32_C(        -20), INT32_C(         11)),
+      simde_mm_set_epi64x(INT64_C( 8657137180960214171), INT64_C(-4473616278908922912)) },
+    { simde_mm_set_epi32(INT32_C(        -14), INT32_C(        -24), INT32_C(        -16), INT32_C(        -32)),
+      simde_mm_set_epi64x(INT64_C(-3549002035742068300), INT64_C( 3305897188295840937)) },
+    { simde_mm_set_epi32(INT32_C(         17), INT32_C(        -23), INT32_C(        -26), INT32_C(        -18)),
+      simde_mm_set_epi64x(INT64_C(-2463912573809027086), INT64_C( 7096057613211080043)) },
+    { simde_mm_set_epi32(INT32_C(         31), INT32_C(          1), INT32_C(          2), INT32_C(        -16)),
+      simde_mm_set_epi64x(INT64_C(-1834322801893902555), INT64_C(-3549002035742068300)) },
+    { simde_mm_set_epi32(INT32_C(        -10), INT32_C(        -30), INT32_C(         29), INT32_C(         -5)),
+      simde_mm_set_epi64x(INT64_C( 3540353585125646924), INT64_C(-3906152170544401318)) },
+    { simde_mm_set_epi32(INT32_C(        -18), INT32_C(        -20), INT32_C(         20), INT32_C(        -32)),
+      simde_mm_set_epi64x(INT64_C( 2965439556528302012), INT64_C( 3305897188295840937)) },
+    { simde_mm_set_epi32(INT32_C(         17), INT32_C(         14), INT32_C(          9), INT32_C(         11)),
+      simde_mm_set_epi64x(INT64_C( 7637233684765716189), INT64_C(-4473616278908922912)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_i32gather_epi64(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i32gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C(-4489388526105137626), INT64_C( 2835553486109910110), INT64_C(-7392872366582508289), INT64_C(-4443354508324468766),
+    INT64_C( 6892801670615574857), INT64_C( 4388164835218934913), INT64_C( 5577445678475267182), INT64_C(  349439880652498143),
+    INT64_C(-5874664937503941638), INT64_C(-2904146070036399889), INT64_C(  728622040501910452), INT64_C(-2773975562680146864),
+    INT64_C( 5245938967153337404), INT64_C( 6065311540115484608), INT64_C( 8626853130540374458), INT64_C(-8703481637759555313),
+    INT64_C(-3255066589049282462), INT64_C(  305121219822948121), INT64_C(-5973485535388604814), INT64_C( 3010214683712310906),
+    INT64_C(  567064097716917509), INT64_C(-7059747545184768145), INT64_C( 5016592067774331161), INT64_C( -575228561786635071),
+    INT64_C(-1295091444952846605), INT64_C( 4841091789246814873), INT64_C( 4031384505063943345), INT64_C(-8492070794172665215),
+    INT64_C( 6053565120318372177), INT64_C( 4541607334862032364), INT64_C( 8204104874335613273), INT64_C(-4897509117940607355),
+    INT64_C(-6463676080106720913), INT64_C( 3848876581267539115), INT64_C(-6451186577209291615), INT64_C( 5747979882494470921),
+    INT64_C( 8182068065199773017), INT64_C(-7265127186191525533), INT64_C(-2869221052752377436), INT64_C( 6664422763657370913),
+    INT64_C(-6594392835743934406), INT64_C( 1513154896996647231), INT64_C(-7774649881904892008), INT64_C( 6327792595636025155),
+    INT64_C(-4913934163679477443), INT64_C( 6966292130791097310), INT64_C(  -58133429037840384), INT64_C( 2169766837408103438),
+    INT64_C(-6081924840858839474), INT64_C( 7887943503822079046), INT64_C(-7027060839392662671), INT64_C( 7964453155821927185),
+    INT64_C( 7834509277318889590), INT64_C( 2657534836462243730), INT64_C(  479991417701481902), INT64_C(-4667559304290568824),
+    INT64_C( 6128790122176519572), INT64_C(-1743767031337530085), INT64_C(-6864855891066281488), INT64_C(-7353650465492132089),
+    INT64_C(-3517516014082331038), INT64_C(-6439673839395820538), INT64_C( 8852743390332717309), INT64_C( 6142877563939944354)
+  };
+
+  const struct {
+    simde__m128i src;
+    simde__m128i vindex;
+    simde__m128i mask;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(-7378308080555692715), INT64_C(-7907135420148147359)),
+      simde_mm_set_epi32(INT32_C(        -17), INT32_C(         18), INT32_C(         21), INT32_C(        -14)),
+      simde_mm_set_epi64x(INT64_C(-4402401678820526498), INT64_C( 2498182274496468203)),
+      simde_mm_set_epi64x(INT64_C( 2657534836462243730), INT64_C(-7907135420148147359)) },
+    { simde_mm_set_epi64x(INT64_C(-6517612800150638618), INT64_C(-4233420857299680577)),
+      simde_mm_set_epi32(INT32_C(          1), INT32_C(        -26), INT32_C(        -13), INT32_C(          8)),
+      simde_mm_set_epi64x(INT64_C( 8347669503187269447), INT64_C(  406687156178905317)),
+      simde_mm_set_epi64x(INT64_C(-6517612800150638618), INT64_C(-4233420857299680577)) },
+    { simde_mm_set_epi64x(INT64_C( 5916694754169791426), INT64_C(  725690913100419751)),
+      simde_mm_set_epi32(INT32_C(         14), INT32_C(         -1), INT32_C(         22), INT32_C(         -8)),
+      simde_mm_set_epi64x(INT64_C( 5463597898866057597), INT64_C(-8167297275638614562)),
+      simde_mm_set_epi64x(INT64_C( 5916694754169791426), INT64_C(-1295091444952846605)) },
+    { simde_mm_set_epi64x(INT64_C(-1911315933989492927), INT64_C(-4975359410850044553)),
+      simde_mm_set_epi32(INT32_C(         19), INT32_C(        -19), INT32_C(         20), INT32_C(         28)),
+      simde_mm_set_epi64x(INT64_C( 6416963322421874965), INT64_C( 5558546682847130925)),
+      simde_mm_set_epi64x(INT64_C(-1911315933989492927), INT64_C(-4975359410850044553)) },
+    { simde_mm_set_epi64x(INT64_C( 2853307021454941572), INT64_C(-6657988521102468329)),
+      simde_mm_set_epi32(INT32_C(        -32), INT32_C(         10), INT32_C(        -22), INT32_C(         27)),
+      simde_mm_set_epi64x(INT64_C( 4019735012527779248), INT64_C( 1905069133316780273)),
+      simde_mm_set_epi64x(INT64_C( 2853307021454941572), INT64_C(-6657988521102468329)) },
+    { simde_mm_set_epi64x(INT64_C(-9095342909173225699), INT64_C(-6772055124423011983)),
+      simde_mm_set_epi32(INT32_C(          1), INT32_C(        -13), INT32_C(         -8), INT32_C(          6)),
+      simde_mm_set_epi64x(INT64_C( 2825845407518756715), INT64_C(-4845513437602918836)),
+      simde_mm_set_epi64x(INT64_C(-9095342909173225699), INT64_C(-2869221052752377436)) },
+    { simde_mm_set_epi64x(INT64_C( 7914178558125301834), INT64_C( 6642306419094183125)),
+      simde_mm_set_epi32(INT32_C(          3), INT32_C(         26), INT32_C(        -26), INT32_C(         21)),
+      simde_mm_set_epi64x(INT64_C(-7588831787585159405), INT64_C(-7031699214160157313)),
+      simde_mm_set_epi64x(INT64_C( 5577445678475267182), INT64_C( 2657534836462243730)) },
+    { simde_mm_set_epi64x(INT64_C( 9069788884006171433), INT64_C( -421412217284363005)),
+      simde_mm_set_epi32(INT32_C(          2), INT32_C(         11), INT32_C(         -4), INT32_C(         11)),
+      simde_mm_set_epi64x(INT64_C(-3516901089089320448), INT64_C( 8649276160957928287)),
+      simde_mm_set_epi64x(INT64_C( 6053565120318372177), INT64_C( -421412217284363005)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mask_i32gather_epi64(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C( 6130492318263994786), INT64_C( 4827795419360769743), INT64_C( 1464831588737388026), INT64_C( 2439335233839297050),
+    INT64_C( 4220337205832757021), INT64_C(-9079784069102118494), INT64_C(-1007016161347573262), INT64_C(  769969444598137629),
+    INT64_C( 1731637256698006456), INT64_C(-7997337370312174518), INT64_C(-6733134844770825768), INT64_C( 2161844775975844189),
+    INT64_C( 6939484472551371166), INT64_C( 3471277822755911566), INT64_C(   17508841188968930), INT64_C( 6793168121848033824),
+    INT64_C( 8789592610442354148), INT64_C(-4315990758077158113), INT64_C(-3945293933679754089), INT64_C(-6657860660495936496),
+    INT64_C(-3913377762074138010), INT64_C( 2694272339396423246), INT64_C(-7206702999274729203), INT64_C(-8447144557832421832),
+    INT64_C(-1018281282963881271), INT64_C( 3923867237315931154), INT64_C( 2196182749764923504), INT64_C(-1746051887984944520),
+    INT64_C(-8793117757066572710), INT64_C(  214954927267593706), INT64_C(-5230455802183295880), INT64_C(  203565241638385098),
+    INT64_C(-8368640590579836420), INT64_C(-3727167759954298970), INT64_C(-2634662600247405697), INT64_C(-1459474856451428958),
+    INT64_C( 6454397087712038982), INT64_C( 8435231222036456119), INT64_C(-5904103673350885061), INT64_C( 4729386987089112913),
+    INT64_C( -469066835985042727), INT64_C( 1293366009358618618), INT64_C(-1103399147728077509), INT64_C(-8320543776640136849),
+    INT64_C( 7255019503350498121), INT64_C(-8207774486567176590), INT64_C(-7384001376613382355), INT64_C( 1142855448357593034),
+    INT64_C(-4993623587167043761), INT64_C(  426409306049398619), INT64_C(-7990076206079136123), INT64_C( 5049731780126020112),
+    INT64_C(-2725736863525623718), INT64_C( -422553455683078837), INT64_C( 8245027239858788585), INT64_C(-6886314060382244388),
+    INT64_C( 1056465197839019219), INT64_C( -221965699663026104), INT64_C(-3708303689449630541), INT64_C( 1233309942087606597),
+    INT64_C(-6106929429997302051), INT64_C(  374648739360667688), INT64_C( 6408467461081815261), INT64_C(-1530150712745596970)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(         26), INT32_C(         12), INT32_C(         23), INT32_C(         29)),
+      simde_mm256_set_epi64x(INT64_C(-3708303689449630541), INT64_C( 7255019503350498121),
+                             INT64_C(-6886314060382244388), INT64_C(  374648739360667688)) },
+    { simde_mm_set_epi32(INT32_C(         22), INT32_C(        -31), INT32_C(         28), INT32_C(        -25)),
+      simde_mm256_set_epi64x(INT64_C( 8245027239858788585), INT64_C( 4827795419360769743),
+                             INT64_C(-6106929429997302051), INT64_C(  769969444598137629)) },
+    { simde_mm_set_epi32(INT32_C(         -8), INT32_C(         -7), INT32_C(         13), INT32_C(         -1)),
+      simde_mm256_set_epi64x(INT64_C(-1018281282963881271), INT64_C( 3923867237315931154),
+                             INT64_C(-8207774486567176590), INT64_C(  203565241638385098)) },
+    { simde_mm_set_epi32(INT32_C(        -21), INT32_C(          1), INT32_C(         30), INT32_C(         26)),
+      simde_mm256_set_epi64x(INT64_C( 2161844775975844189), INT64_C(-3727167759954298970),
+                             INT64_C( 6408467461081815261), INT64_C(-3708303689449630541)) },
+    { simde_mm_set_epi32(INT32_C(        -31), INT32_C(        -29), INT32_C(         -2), INT32_C(        -30)),
+      simde_mm256_set_epi64x(INT64_C( 4827795419360769743), INT64_C( 2439335233839297050),
+                             INT64_C(-5230455802183295880), INT64_C( 1464831588737388026)) },
+    { simde_mm_set_epi32(INT32_C(        -12), INT32_C(         21), INT32_C(        -29), INT32_C(         10)),
+      simde_mm256_set_epi64x(INT64_C(-3913377762074138010), INT64_C( -422553455683078837),
+                             INT64_C( 2439335233839297050), INT64_C(-1103399147728077509)) },
+    { simde_mm_set_epi32(INT32_C(        -12), INT32_C(         -7), INT32_C(          3), INT32_C(         -2)),
+      simde_mm256_set_epi64x(INT64_C(-3913377762074138010), INT64_C( 3923867237315931154),
+                             INT64_C(-1459474856451428958), INT64_C(-5230455802183295880)) },
+    { simde_mm_set_epi32(INT32_C(         11), INT32_C(        -28), INT32_C(         29), INT32_C(         -1)),
+      simde_mm256_set_epi64x(INT64_C(-8320543776640136849), INT64_C( 4220337205832757021),
+                             INT64_C(  374648739360667688), INT64_C(  203565241638385098)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_i32gather_epi64(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i32gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C( 7238000976870397478), INT64_C(-3399861962300576252), INT64_C(-8164002559400834215), INT64_C( 3236386773232270987),
+    INT64_C(-1694951308312671310), INT64_C( 5896521582342209857), INT64_C( 2272680200318542641), INT64_C(-1524024164129115283),
+    INT64_C(  644571480940403501), INT64_C( 7030300824032584154), INT64_C(-8870520733684312927), INT64_C( 1052578220155180789),
+    INT64_C(-7924602324220776380), INT64_C(-2865756331978079483), INT64_C(-1114105956291857727), INT64_C(-4900857773521394545),
+    INT64_C( 8203311959135931362), INT64_C(-4622125200555681417), INT64_C( 1765755994317083082), INT64_C( 4676145524651049548),
+    INT64_C(-6322324195903092342), INT64_C( 7840087806268027627), INT64_C( 4362628786675212166), INT64_C( 5466981953861664700),
+    INT64_C( 2040225440946035899), INT64_C(-3447979946296332162), INT64_C( 6082304060022336199), INT64_C(-2860696532753489520),
+    INT64_C(-6841720992723446433), INT64_C( 5307526157907824588), INT64_C(-6904540782914237099), INT64_C(-1464089932071943457),
+    INT64_C( 3343506443636787164), INT64_C( 2122727769586764852), INT64_C( 5064307510010048709), INT64_C( 5816754664419643396),
+    INT64_C(-7476946029696135162), INT64_C(  444988930710223105), INT64_C(-8244929755576186996), INT64_C( 4066454952490469282),
+    INT64_C(-7723230568488534602), INT64_C(-8855471465181662897), INT64_C( 4592010042169848266), INT64_C(-6016289243490781507),
+    INT64_C(-7634445901183645867), INT64_C( 3019199608760699051), INT64_C( 6107308457211337381), INT64_C(-9016936845650979778),
+    INT64_C( 6416415783650118013), INT64_C( -872874233399241573), INT64_C( 9032889453895946674), INT64_C(-6240302112632531637),
+    INT64_C(-3199797915555723154), INT64_C( 2876878378068570032), INT64_C(-6686250841421732581), INT64_C( 4025752497978104880),
+    INT64_C(-4691091968509058421), INT64_C( 7961883199312670999), INT64_C( 2892643423784098740), INT64_C(-6864190006307648516),
+    INT64_C(-8597525874087164273), INT64_C(-6643117691134563699), INT64_C( 1064493280841483742), INT64_C(  240117572631334342)
+  };
+
+  const struct {
+    simde__m256i src;
+    simde__m128i vindex;
+    simde__m256i mask;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 5027868240490321771), INT64_C(-2670899093021624667),
+                             INT64_C( 4684703871303284415), INT64_C( 1964586449591490699)),
+      simde_mm_set_epi32(INT32_C(         23), INT32_C(         -8), INT32_C(          1), INT32_C(         -7)),
+      simde_mm256_set_epi64x(INT64_C( 3790782679412362330), INT64_C(-3648656826452922747),
+                             INT64_C( 5012112011134034811), INT64_C( 5437314829844075538)),
+      simde_mm256_set_epi64x(INT64_C( 5027868240490321771), INT64_C( 2040225440946035899),
+                             INT64_C( 4684703871303284415), INT64_C( 1964586449591490699)) },
+    { simde_mm256_set_epi64x(INT64_C( 3233394856040452301), INT64_C( 5583695449000175584),
+                             INT64_C(-9141816644947522329), INT64_C( 3412342584051951074)),
+      simde_mm_set_epi32(INT32_C(         14), INT32_C(        -31), INT32_C(          9), INT32_C(          0)),
+      simde_mm256_set_epi64x(INT64_C( 6655992220118843091), INT64_C( -528300979041468177),
+                             INT64_C( 5144526076759457627), INT64_C(-6908260235021341304)),
+      simde_mm256_set_epi64x(INT64_C( 3233394856040452301), INT64_C(-3399861962300576252),
+                             INT64_C(-9141816644947522329), INT64_C( 3343506443636787164)) },
+    { simde_mm256_set_epi64x(INT64_C( 7641126067121542758), INT64_C(-7685065296141736924),
+                             INT64_C(  606942063423296506), INT64_C( 6250306024628103150)),
+      simde_mm_set_epi32(INT32_C(         12), INT32_C(         -7), INT32_C(        -22), INT32_C(         24)),
+      simde_mm256_set_epi64x(INT64_C(-2246244026565895104), INT64_C(-7509716805311219248),
+                             INT64_C(-4963196073464186661), INT64_C( -811779411134918058)),
+      simde_mm256_set_epi64x(INT64_C(-7634445901183645867), INT64_C(-3447979946296332162),
+                             INT64_C(-8870520733684312927), INT64_C(-4691091968509058421)) },
+    { simde_mm256_set_epi64x(INT64_C(-5514909268411411362), INT64_C(-4679243622653357887),
+                             INT64_C(-7920000905250187692), INT64_C( 3098453272004870411)),
+      simde_mm_set_epi32(INT32_C(         -9), INT32_C(          9), INT32_C(        -17), INT32_C(          8)),
+      simde_mm256_set_epi64x(INT64_C( 8029686326064784733), INT64_C( 2157366714825939181),
+                             INT64_C(-9164511086691602717), INT64_C( 8297679943464707994)),
+      simde_mm256_set_epi64x(INT64_C(-5514909268411411362), INT64_C(-4679243622653357887),
+                             INT64_C(-4900857773521394545), INT64_C( 3098453272004870411)) },
+    { simde_mm256_set_epi64x(INT64_C( 4293725644073510781), INT64_C(-1526337684246527835),
+                             INT64_C(-3307740691052425417), INT64_C( 5581375318951520023)),
+      simde_mm_set_epi32(INT32_C(        -20), INT32_C(        -16), INT32_C(        -32), INT32_C(         15)),
+      simde_mm256_set_epi64x(INT64_C( -300367509131327584), INT64_C(-5678705860293209658),
+                             INT64_C( -873102031460310548), INT64_C(-2371164837619157970)),
+      simde_mm256_set_epi64x(INT64_C(-7924602324220776380), INT64_C( 8203311959135931362),
+                             INT64_C( 7238000976870397478), INT64_C(-9016936845650979778)) },
+    { simde_mm256_set_epi64x(INT64_C(-1567070839022660477), INT64_C( 1663923847857650574),
+                             INT64_C(-4092678897028042027), INT64_C(-6024102525568445912)),
+      simde_mm_set_epi32(INT32_C(          1), INT32_C(         27), INT32_C(         -3), INT32_C(        -27)),
+      simde_mm256_set_epi64x(INT64_C(-8356925230987139184), INT64_C(-8373757247046360158),
+                             INT64_C( 3341307907254636251), INT64_C( 6331205476159342138)),
+      simde_mm256_set_epi64x(INT64_C( 2122727769586764852), INT64_C(-6864190006307648516),
+                             INT64_C(-4092678897028042027), INT64_C(-6024102525568445912)) },
+    { simde_mm256_set_epi64x(INT64_C( 8809770163142360036), INT64_C( -199932266699783373),
+                             INT64_C( 2964872030791858618), INT64_C( 5076831593390023885)),
+      simde_mm_set_epi32(INT32_C(         -5), INT32_C(          2), INT32_C(        -13), INT32_C(          0)),
+      simde_mm256_set_epi64x(INT64_C(-1431925753737750883), INT64_C(-6760977599179815711),
+                             INT64_C(-5298828369625350459), INT64_C(-2856370447280958117)),
+      simde_mm256_set_epi64x(INT64_C(-2860696532753489520), INT64_C( 5064307510010048709),
+                             INT64_C( 4676145524651049548), INT64_C( 3343506443636787164)) },
+    { simde_mm256_set_epi64x(INT64_C( 3118736699830939895), INT64_C(-1994899603887444703),
+                             INT64_C(-3826058680819873360), INT64_C( 2021678989828268747)),
+      simde_mm_set_epi32(INT32_C(         23), INT32_C(         15), INT32_C(         31), INT32_C(         21)),
+      simde_mm256_set_epi64x(INT64_C(-1167485001709059301), INT64_C( -253885634596149658),
+                             INT64_C(  904594693396523120), INT64_C( 7514885677278430355)),
+      simde_mm256_set_epi64x(INT64_C( 4025752497978104880), INT64_C(-9016936845650979778),
+                             INT64_C(-3826058680819873360), INT64_C( 2021678989828268747)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_i32gather_epi64(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i64gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C( 6296979161410046580), INT64_C(-1642782278715650783), INT64_C( -624420599491902520), INT64_C( 2164635675944932358),
+    INT64_C( 4716921373901714968), INT64_C(-4032948686314077323), INT64_C(-2387565206436562301), INT64_C( 7682005150267635371),
+    INT64_C( 2460118186625329786), INT64_C( 3253217893865829794), INT64_C(-6431384906654450341), INT64_C( 5172581018411922255),
+    INT64_C( 4616286481243087637), INT64_C( 2951943821279236208), INT64_C( 6216350519727771664), INT64_C( 6749982325512090626),
+    INT64_C(-7648679508057659237), INT64_C( -226316080987494394), INT64_C(-4939335031583371519), INT64_C(-5312953152475227632),
+    INT64_C(-5837815126807480965), INT64_C(   11950410965707493), INT64_C(-3530885612632320090), INT64_C(-1296843235746733751),
+    INT64_C(-1401961896013992821), INT64_C( 3163900619603616057), INT64_C( 1271850730896643803), INT64_C( 1116626481190993161),
+    INT64_C( -390934116960291089), INT64_C( 5033916855333136615), INT64_C( 4543410358889932135), INT64_C(-4613111507529617699),
+    INT64_C( 3405220901780333682), INT64_C( 6106850881975523687), INT64_C( 4656018151055520724), INT64_C( 7183500074303818200),
+    INT64_C(-5033681649815610561), INT64_C( 6061361894204872957), INT64_C(-8559160364455714810), INT64_C( 8319758680762780548),
+    INT64_C(  327597964833687765), INT64_C( 1532716261646638084), INT64_C( -249443932135344403), INT64_C( 1552078041401771651),
+    INT64_C(-5276194170126327107), INT64_C( 3876483126737332549), INT64_C( -816493514664606073), INT64_C( 4615115360434136739),
+    INT64_C(-1714561529957886036), INT64_C( 3364051316564055771), INT64_C( 2323987836755011124), INT64_C(-5011830292694717834),
+    INT64_C(-6750273008232736499), INT64_C(-7233266405385476851), INT64_C( -781426496634165282), INT64_C( 1392102824713831844),
+    INT64_C( 7308671797767894305), INT64_C(  379199452601088773), INT64_C( 6139930037143372609), INT64_C( 6761296975397475659),
+    INT64_C( 8194929000229695341), INT64_C( 4383063455298974553), INT64_C(-4981028692288538734), INT64_C( 8610999634296648567)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(                  -9), INT64_C(                  27)),
+      simde_mm_set_epi64x(INT64_C(-1296843235746733751), INT64_C( 6761296975397475659)) },
+    { simde_mm_set_epi64x(INT64_C(                 -14), INT64_C(                  -1)),
+      simde_mm_set_epi64x(INT64_C(-4939335031583371519), INT64_C(-4613111507529617699)) },
+    { simde_mm_set_epi64x(INT64_C(                  28), INT64_C(                  -3)),
+      simde_mm_set_epi64x(INT64_C( 8194929000229695341), INT64_C( 5033916855333136615)) },
+    { simde_mm_set_epi64x(INT64_C(                 -25), INT64_C(                   1)),
+      simde_mm_set_epi64x(INT64_C( 7682005150267635371), INT64_C( 6106850881975523687)) },
+    { simde_mm_set_epi64x(INT64_C(                  -2), INT64_C(                  -9)),
+      simde_mm_set_epi64x(INT64_C( 4543410358889932135), INT64_C(-1296843235746733751)) },
+    { simde_mm_set_epi64x(INT64_C(                 -12), INT64_C(                  -8)),
+      simde_mm_set_epi64x(INT64_C(-5837815126807480965), INT64_C(-1401961896013992821)) },
+    { simde_mm_set_epi64x(INT64_C(                  -3), INT64_C(                 -27)),
+      simde_mm_set_epi64x(INT64_C( 5033916855333136615), INT64_C(-4032948686314077323)) },
+    { simde_mm_set_epi64x(INT64_C(                   3), INT64_C(                 -22)),
+      simde_mm_set_epi64x(INT64_C( 7183500074303818200), INT64_C(-6431384906654450341)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_i64gather_epi64(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i64gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C(  684385941520310605), INT64_C(  -92488947953901227), INT64_C(-1429737203300612815), INT64_C( 7944919325953879699),
+    INT64_C( 5873966475274449326), INT64_C(  582277059264132267), INT64_C(-1089411375416957540), INT64_C(-4299663107934118669),
+    INT64_C( 3692859984408273749), INT64_C( 4255882073090886499), INT64_C( 6082867634990596333), INT64_C( 1628910455159218634),
+    INT64_C( 6308053579461343220), INT64_C(-7931907060383740161), INT64_C( -719324589991008164), INT64_C(-4024979746706047861),
+    INT64_C(  957878491009855857), INT64_C(-7743978950166765733), INT64_C(-7386041463180033183), INT64_C( 2210133562590026740),
+    INT64_C( -663935764062323826), INT64_C( 6465152234704270625), INT64_C( 2075582077673811651), INT64_C( 8483136952474789484),
+    INT64_C(-1630574175836758713), INT64_C( 1660551944147605476), INT64_C( 1363829571129399065), INT64_C(-2937047777740226668),
+    INT64_C( 8476600859345691696), INT64_C( 3398385822441048863), INT64_C(-1100756850690286779), INT64_C(  239077456774791837),
+    INT64_C(-8562117297020685459), INT64_C(-2491225322755968938), INT64_C( 9147749537080587208), INT64_C( 3094878585025803220),
+    INT64_C( 5579222797019613268), INT64_C( 6256939271563857217), INT64_C(  691905379840984524), INT64_C(-6778380413649793281),
+    INT64_C(-1652310230944413290), INT64_C( -469011394769762938), INT64_C( 4412819137556909068), INT64_C( -642360455399299273),
+    INT64_C( 8086785804068854844), INT64_C(-6208590615224850044), INT64_C( -386869469298517102), INT64_C(-7681146878388538559),
+    INT64_C(-6558368306500761598), INT64_C( -459878720136768651), INT64_C(-1148958784647454718), INT64_C(-4274005228546242715),
+    INT64_C(-2835055140703506111), INT64_C(-4864953137763116237), INT64_C(-8488684848383750379), INT64_C( 6866829367201884371),
+    INT64_C( -706400895651640473), INT64_C(-7170176576284470947), INT64_C(-5814811204365125365), INT64_C( 8468736857065040302),
+    INT64_C( 8012794222574772505), INT64_C( 5603078408960201401), INT64_C(-5143754112420821273), INT64_C( 3943429960576487751)
+  };
+
+  const struct {
+    simde__m128i src;
+    simde__m128i vindex;
+    simde__m128i mask;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(-2669724786400692995), INT64_C( -692160691228503498)),
+      simde_mm_set_epi64x(INT64_C(                 -19), INT64_C(                  27)),
+      simde_mm_set_epi64x(INT64_C( 6817076940125975307), INT64_C( 3406693543324202821)),
+      simde_mm_set_epi64x(INT64_C(-2669724786400692995), INT64_C( -692160691228503498)) },
+    { simde_mm_set_epi64x(INT64_C(-2606307334187120473), INT64_C(-5893955368470290396)),
+      simde_mm_set_epi64x(INT64_C(                  17), INT64_C(                 -26)),
+      simde_mm_set_epi64x(INT64_C( 3764647795336737678), INT64_C(-1316607824081244303)),
+      simde_mm_set_epi64x(INT64_C(-2606307334187120473), INT64_C(-1089411375416957540)) },
+    { simde_mm_set_epi64x(INT64_C( 7378164284057454718), INT64_C( 6198223554598423072)),
+      simde_mm_set_epi64x(INT64_C(                  25), INT64_C(                 -24)),
+      simde_mm_set_epi64x(INT64_C( 6512965848862081301), INT64_C( 2673743147256245296)),
+      simde_mm_set_epi64x(INT64_C( 7378164284057454718), INT64_C( 6198223554598423072)) },
+    { simde_mm_set_epi64x(INT64_C(  916377025506859145), INT64_C(-8456298186868029330)),
+      simde_mm_set_epi64x(INT64_C(                   3), INT64_C(                  28)),
+      simde_mm_set_epi64x(INT64_C( 2964970138821208791), INT64_C(-6148790582542907412)),
+      simde_mm_set_epi64x(INT64_C(  916377025506859145), INT64_C( 8012794222574772505)) },
+    { simde_mm_set_epi64x(INT64_C( 8417212777735409184), INT64_C(-4092764035286995073)),
+      simde_mm_set_epi64x(INT64_C(                  14), INT64_C(                  24)),
+      simde_mm_set_epi64x(INT64_C( 1396102760005396086), INT64_C( 8940788934155326544)),
+      simde_mm_set_epi64x(INT64_C( 8417212777735409184), INT64_C(-4092764035286995073)) },
+    { simde_mm_set_epi64x(INT64_C(-1794198414650501493), INT64_C( 3244769699465621253)),
+      simde_mm_set_epi64x(INT64_C(                  22), INT64_C(                 -26)),
+      simde_mm_set_epi64x(INT64_C(  144217354784268162), INT64_C( 7834311932773356530)),
+      simde_mm_set_epi64x(INT64_C(-1794198414650501493), INT64_C( 3244769699465621253)) },
+    { simde_mm_set_epi64x(INT64_C( 6273945831271405096), INT64_C( 4814686274901118558)),
+      simde_mm_set_epi64x(INT64_C(                  -2), INT64_C(                 -15)),
+      simde_mm_set_epi64x(INT64_C( -503848873706717302), INT64_C( 6399992656956427585)),
+      simde_mm_set_epi64x(INT64_C(-1100756850690286779), INT64_C( 4814686274901118558)) },
+    { simde_mm_set_epi64x(INT64_C( 1872458394000651605), INT64_C( 8478265926285852150)),
+      simde_mm_set_epi64x(INT64_C(                  11), INT64_C(                 -25)),
+      simde_mm_set_epi64x(INT64_C( 8702580501553930561), INT64_C(-3416014985752782432)),
+      simde_mm_set_epi64x(INT64_C( 1872458394000651605), INT64_C(-4299663107934118669)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mask_i64gather_epi64(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C( 1481488094198426985), INT64_C( 3675286435318946204), INT64_C(-2929063601686224579), INT64_C(-1528591974472750044),
+    INT64_C( 5419511392136496949), INT64_C( 7581015731161209669), INT64_C( 8151372271543190785), INT64_C(-5056317119217059987),
+    INT64_C(-1691787632001603606), INT64_C(  -17177226482182933), INT64_C(-7135450012676750414), INT64_C(-1994531322366320323),
+    INT64_C(-2770580748234381593), INT64_C(-7153111145208518732), INT64_C( 7384901371613056849), INT64_C( 1367141436917748684),
+    INT64_C( 2913917144834573744), INT64_C(-3330958699668609616), INT64_C( 8309461950335040528), INT64_C( 4783417199181465857),
+    INT64_C( 1828936621775192026), INT64_C(-3949276620439730391), INT64_C( 2588452770942342646), INT64_C(  408331948702394705),
+    INT64_C( 4490341356332262073), INT64_C(-6476149207164051504), INT64_C( 6901378983519938881), INT64_C(-4825616984552213299),
+    INT64_C(-8196951824029054440), INT64_C( 9132665306117746461), INT64_C( 6575176508213740430), INT64_C(-5952757544808872289),
+    INT64_C(-7100740913719902684), INT64_C(-7995718442914128372), INT64_C(-7676058424602486896), INT64_C( 8556232690211787734),
+    INT64_C(-1057879638954092534), INT64_C(-3252402220631232110), INT64_C(-1380549602673382049), INT64_C( 2021152476334724935),
+    INT64_C(-6980223436977596312), INT64_C( 7958044620969891938), INT64_C( 1916129412740443152), INT64_C( 2049282205872611748),
+    INT64_C( 3777591083607375978), INT64_C(-8594694975622791768), INT64_C(-3507793488404652845), INT64_C( 6738086764780370352),
+    INT64_C( 7453924085125154091), INT64_C( 8397458803865316481), INT64_C( 6690406767616162768), INT64_C( 2949807549612826116),
+    INT64_C( 6337711026911203934), INT64_C( 3954015066396938445), INT64_C( 2663241525179827250), INT64_C( 2090706219881646556),
+    INT64_C(-8321039770211361007), INT64_C(-5465647662502038769), INT64_C(-1594711794352627051), INT64_C( 7351198363190507506),
+    INT64_C(-5924239767893509726), INT64_C(-5862007992937476546), INT64_C( 4636636111258823961), INT64_C( 7530440242148201436)
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                 -16), INT64_C(                  22),
+                             INT64_C(                 -19), INT64_C(                 -30)),
+      simde_mm256_set_epi64x(INT64_C( 2913917144834573744), INT64_C( 2663241525179827250),
+                             INT64_C(-7153111145208518732), INT64_C(-2929063601686224579)) },
+    { simde_mm256_set_epi64x(INT64_C(                   1), INT64_C(                 -13),
+                             INT64_C(                  -3), INT64_C(                 -32)),
+      simde_mm256_set_epi64x(INT64_C(-7995718442914128372), INT64_C( 4783417199181465857),
+                             INT64_C( 9132665306117746461), INT64_C( 1481488094198426985)) },
+    { simde_mm256_set_epi64x(INT64_C(                  14), INT64_C(                  12),
+                             INT64_C(                  -3), INT64_C(                  23)),
+      simde_mm256_set_epi64x(INT64_C(-3507793488404652845), INT64_C( 3777591083607375978),
+                             INT64_C( 9132665306117746461), INT64_C( 2090706219881646556)) },
+    { simde_mm256_set_epi64x(INT64_C(                  18), INT64_C(                 -22),
+                             INT64_C(                  13), INT64_C(                  28)),
+      simde_mm256_set_epi64x(INT64_C( 6690406767616162768), INT64_C(-7135450012676750414),
+                             INT64_C(-8594694975622791768), INT64_C(-5924239767893509726)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -25), INT64_C(                 -11),
+                             INT64_C(                  21), INT64_C(                 -32)),
+      simde_mm256_set_epi64x(INT64_C(-5056317119217059987), INT64_C(-3949276620439730391),
+                             INT64_C( 3954015066396938445), INT64_C( 1481488094198426985)) },
+    { simde_mm256_set_epi64x(INT64_C(                   9), INT64_C(                  21),
+                             INT64_C(                   2), INT64_C(                 -11)),
+      simde_mm256_set_epi64x(INT64_C( 7958044620969891938), INT64_C( 3954015066396938445),
+                             INT64_C(-7676058424602486896), INT64_C(-3949276620439730391)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -10), INT64_C(                   4),
+                             INT64_C(                 -27), INT64_C(                 -32)),
+      simde_mm256_set_epi64x(INT64_C( 2588452770942342646), INT64_C(-1057879638954092534),
+                             INT64_C( 7581015731161209669), INT64_C( 1481488094198426985)) },
+    { simde_mm256_set_epi64x(INT64_C(                  27), INT64_C(                  26),
+                             INT64_C(                   2), INT64_C(                 -28)),
+      simde_mm256_set_epi64x(INT64_C( 7351198363190507506), INT64_C(-1594711794352627051),
+                             INT64_C(-7676058424602486896), INT64_C( 5419511392136496949)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_i64gather_epi64(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i64gather_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const int64_t table[64] = {
+    INT64_C(-1333056389908730432), INT64_C( 3905769742294070284), INT64_C(-8019466850601604668), INT64_C(-3361598822001072325),
+    INT64_C(-1652450033267896284), INT64_C(-3063200274978165166), INT64_C( 1969604664514052622), INT64_C( 9025720415112618793),
+    INT64_C(-1518421576538049235), INT64_C(-5350670299356367535), INT64_C(-4784353945717544368), INT64_C(-8207534181894187426),
+    INT64_C(-3210010095245907695), INT64_C(-7657711387868595316), INT64_C( -449606294100650398), INT64_C( 2768040779571441134),
+    INT64_C( 9036980816347151996), INT64_C( 1973025343415896203), INT64_C( 7005813249583269243), INT64_C( -764112520070488709),
+    INT64_C(-9124522198757618264), INT64_C( 7129734833246197324), INT64_C( -450173804669750910), INT64_C(-1504961331021601270),
+    INT64_C(-6088964651500592076), INT64_C( -469013215367316556), INT64_C(-1639523730970641356), INT64_C(-6708270085795140686),
+    INT64_C(-5542999720124711271), INT64_C( 2279645251931559370), INT64_C( -139422892936289141), INT64_C( 6909183854847346345),
+    INT64_C(-4111850221195568853), INT64_C( 3936061144837785343), INT64_C(-4824120847318352296), INT64_C( 8231728381868471780),
+    INT64_C(-6856866256039011362), INT64_C( 8088009745555062557), INT64_C( 7803774805100684248), INT64_C(-7439477182452335490),
+    INT64_C(-7465699719534103337), INT64_C( -100417222998295797), INT64_C( 4028589299535837923), INT64_C(-2256506516150572919),
+    INT64_C(-6669482162716200687), INT64_C(-5148202615102923748), INT64_C( 1467323983992257405), INT64_C( 7257436599440527416),
+    INT64_C( -711391678039705588), INT64_C( 7838323830072187223), INT64_C(-7127049626929290354), INT64_C(-7895343695717633580),
+    INT64_C(   20385421145287391), INT64_C(-6750093889299511850), INT64_C(-4641913885237263077), INT64_C(-4859046294342336898),
+    INT64_C(-7745669368726309699), INT64_C( 2748977344480400615), INT64_C( 3286583392351454082), INT64_C(  109396890781351587),
+    INT64_C( 8464838218349828855), INT64_C( 8019081636482341709), INT64_C( 7536052288171913859), INT64_C(-2576592331343791578)
+  };
+
+  const struct {
+    simde__m256i src;
+    simde__m256i vindex;
+    simde__m256i mask;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C( 6743049727902365345), INT64_C( 2130233964960047861),
+                             INT64_C( 5167022725599509277), INT64_C( 5755643123549831883)),
+      simde_mm256_set_epi64x(INT64_C(                  31), INT64_C(                  24),
+                             INT64_C(                  -4), INT64_C(                  -1)),
+      simde_mm256_set_epi64x(INT64_C( 2474847700808930286), INT64_C(  913464595107192097),
+                             INT64_C(-8167908102809672760), INT64_C(-1908952078106639197)),
+      simde_mm256_set_epi64x(INT64_C( 6743049727902365345), INT64_C( 2130233964960047861),
+                             INT64_C(-5542999720124711271), INT64_C( 6909183854847346345)) },
+    { simde_mm256_set_epi64x(INT64_C( 3464111617179127864), INT64_C(  162971282588539976),
+                             INT64_C(-6062171502843505626), INT64_C( 5355045289562139554)),
+      simde_mm256_set_epi64x(INT64_C(                 -15), INT64_C(                 -10),
+                             INT64_C(                 -11), INT64_C(                  28)),
+      simde_mm256_set_epi64x(INT64_C(-8019225858941506387), INT64_C( 1945862756463128576),
+                             INT64_C(-3030736120660488604), INT64_C( 1213565699248315257)),
+      simde_mm256_set_epi64x(INT64_C( 1973025343415896203), INT64_C(  162971282588539976),
+                             INT64_C( 7129734833246197324), INT64_C( 5355045289562139554)) },
+    { simde_mm256_set_epi64x(INT64_C( 8621186071002285990), INT64_C(-7244729679520814108),
+                             INT64_C(  487502133874650861), INT64_C(-7728805732756122959)),
+      simde_mm256_set_epi64x(INT64_C(                  17), INT64_C(                  -7),
+                             INT64_C(                 -23), INT64_C(                  15)),
+      simde_mm256_set_epi64x(INT64_C( 8772085408800799726), INT64_C(-5964485439169872255),
+                             INT64_C(  520718810877271638), INT64_C(-6056497525158690067)),
+      simde_mm256_set_epi64x(INT64_C( 8621186071002285990), INT64_C( -469013215367316556),
+                             INT64_C(  487502133874650861), INT64_C( 7257436599440527416)) },
+    { simde_mm256_set_epi64x(INT64_C( 4762066227579343976), INT64_C( 5231823574352881941),
+                             INT64_C( 5989222469776883072), INT64_C(   34353151209838385)),
+      simde_mm256_set_epi64x(INT64_C(                 -14), INT64_C(                   3),
+                             INT64_C(                 -12), INT64_C(                   6)),
+      simde_mm256_set_epi64x(INT64_C(-1620001202430180284), INT64_C( 5080961491984165569),
+                             INT64_C(-3721438009374122992), INT64_C( 8807632487494780209)),
+      simde_mm256_set_epi64x(INT64_C( 7005813249583269243), INT64_C( 5231823574352881941),
+                             INT64_C(-9124522198757618264), INT64_C(   34353151209838385)) },
+    { simde_mm256_set_epi64x(INT64_C( 1028687333602378328), INT64_C( 5199679573499894535),
+                             INT64_C( 8326650460129314836), INT64_C(-6265156948349245052)),
+      simde_mm256_set_epi64x(INT64_C(                   1), INT64_C(                   7),
+                             INT64_C(                 -26), INT64_C(                  30)),
+      simde_mm256_set_epi64x(INT64_C(-2418899086228652729), INT64_C(-3687908398104502888),
+                             INT64_C( 2465840287943503551), INT64_C( 3844863499500915798)),
+      simde_mm256_set_epi64x(INT64_C( 3936061144837785343), INT64_C(-7439477182452335490),
+                             INT64_C( 8326650460129314836), INT64_C(-6265156948349245052)) },
+    { simde_mm256_set_epi64x(INT64_C(-3416135206646490148), INT64_C(-8090113314123726511),
+                             INT64_C( -686696717183053392), INT64_C(-4776051530485070135)),
+      simde_mm256_set_epi64x(INT64_C(                  19), INT64_C(                  -3),
+                             INT64_C(                  23), INT64_C(                   5)),
+      simde_mm256_set_epi64x(INT64_C( 1118752441807013426), INT64_C( 5206939027174622154),
+                             INT64_C(-5540680941927196766), INT64_C(  146466314393579839)),
+      simde_mm256_set_epi64x(INT64_C(-3416135206646490148), INT64_C(-8090113314123726511),
+                             INT64_C(-4859046294342336898), INT64_C(-4776051530485070135)) },
+    { simde_mm256_set_epi64x(INT64_C( 7505895874194071741), INT64_C( 7919714371023743749),
+                             INT64_C(-5853600924415193072), INT64_C(-5685434511043763933)),
+      simde_mm256_set_epi64x(INT64_C(                  15), INT64_C(                  20),
+                             INT64_C(                   7), INT64_C(                 -16)),
+      simde_mm256_set_epi64x(INT64_C( 8679086162626108617), INT64_C( 3252701411920507653),
+                             INT64_C( 1685362640499739391), INT64_C( 3580559020114404274)),
+      simde_mm256_set_epi64x(INT64_C( 7505895874194071741), INT64_C( 7919714371023743749),
+                             INT64_C(-5853600924415193072), INT64_C(-5685434511043763933)) },
+    { simde_mm256_set_epi64x(INT64_C(-4922896004201859984), INT64_C( 6230406019895156419),
+                             INT64_C(-5613637000884624858), INT64_C( 7786741745061767572)),
+      simde_mm256_set_epi64x(INT64_C(                  23), INT64_C(                  11),
+                             INT64_C(                  -8), INT64_C(                  22)),
+      simde_mm256_set_epi64x(INT64_C(-2768427752170918055), INT64_C(-2130585551268651769),
+                             INT64_C( 7602052140079765641), INT64_C( 3114656597259841189)),
+      simde_mm256_set_epi64x(INT64_C(-4859046294342336898), INT64_C(-2256506516150572919),
+                             INT64_C(-5613637000884624858), INT64_C( 7786741745061767572)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_i64gather_epi64(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i32gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(   525.19), SIMDE_FLOAT32_C(   906.01), SIMDE_FLOAT32_C(   131.26), SIMDE_FLOAT32_C(  -104.75),
+    SIMDE_FLOAT32_C(  -732.76), SIMDE_FLOAT32_C(  -289.39), SIMDE_FLOAT32_C(  -655.41), SIMDE_FLOAT32_C(  -851.74),
+    SIMDE_FLOAT32_C(  -997.36), SIMDE_FLOAT32_C(   299.33), SIMDE_FLOAT32_C(  -790.44), SIMDE_FLOAT32_C(  -274.36),
+    SIMDE_FLOAT32_C(  -559.05), SIMDE_FLOAT32_C(  -639.22), SIMDE_FLOAT32_C(  -460.85), SIMDE_FLOAT32_C(   743.25),
+    SIMDE_FLOAT32_C(  -106.71), SIMDE_FLOAT32_C(  -549.69), SIMDE_FLOAT32_C(   219.35), SIMDE_FLOAT32_C(   -10.47),
+    SIMDE_FLOAT32_C(   895.04), SIMDE_FLOAT32_C(  -416.25), SIMDE_FLOAT32_C(  -251.64), SIMDE_FLOAT32_C(   822.78),
+    SIMDE_FLOAT32_C(   160.97), SIMDE_FLOAT32_C(   293.53), SIMDE_FLOAT32_C(   872.78), SIMDE_FLOAT32_C(   308.58),
+    SIMDE_FLOAT32_C(   610.92), SIMDE_FLOAT32_C(  -161.11), SIMDE_FLOAT32_C(  -682.29), SIMDE_FLOAT32_C(    18.19),
+    SIMDE_FLOAT32_C(   888.36), SIMDE_FLOAT32_C(  -387.26), SIMDE_FLOAT32_C(   274.11), SIMDE_FLOAT32_C(  -316.77),
+    SIMDE_FLOAT32_C(  -451.47), SIMDE_FLOAT32_C(   753.37), SIMDE_FLOAT32_C(  -348.84), SIMDE_FLOAT32_C(  -505.13),
+    SIMDE_FLOAT32_C(  -112.00), SIMDE_FLOAT32_C(   514.53), SIMDE_FLOAT32_C(  -791.05), SIMDE_FLOAT32_C(  -936.93),
+    SIMDE_FLOAT32_C(  -228.94), SIMDE_FLOAT32_C(   -71.49), SIMDE_FLOAT32_C(  -196.21), SIMDE_FLOAT32_C(    98.91),
+    SIMDE_FLOAT32_C(   821.00), SIMDE_FLOAT32_C(  -956.33), SIMDE_FLOAT32_C(  -746.08), SIMDE_FLOAT32_C(  -219.75),
+    SIMDE_FLOAT32_C(   126.11), SIMDE_FLOAT32_C(  -202.88), SIMDE_FLOAT32_C(   861.04), SIMDE_FLOAT32_C(  -908.27),
+    SIMDE_FLOAT32_C(  -581.26), SIMDE_FLOAT32_C(   524.80), SIMDE_FLOAT32_C(   407.25), SIMDE_FLOAT32_C(  -817.36),
+    SIMDE_FLOAT32_C(    78.63), SIMDE_FLOAT32_C(  -402.43), SIMDE_FLOAT32_C(   849.14), SIMDE_FLOAT32_C(   283.57)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(        -50), INT32_C(          4), INT32_C(         62), INT32_C(         38)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -851.74), SIMDE_FLOAT32_C(  274.11), SIMDE_FLOAT32_C(  283.57), SIMDE_FLOAT32_C( -219.75)) },
+    { simde_mm_set_epi32(INT32_C(        -46), INT32_C(        -26), INT32_C(        -48), INT32_C(         46)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  299.33), SIMDE_FLOAT32_C(  -10.47), SIMDE_FLOAT32_C( -997.36), SIMDE_FLOAT32_C( -908.27)) },
+    { simde_mm_set_epi32(INT32_C(         38), INT32_C(         38), INT32_C(        -18), INT32_C(        -10)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -219.75), SIMDE_FLOAT32_C( -219.75), SIMDE_FLOAT32_C(  822.78), SIMDE_FLOAT32_C(  308.58)) },
+    { simde_mm_set_epi32(INT32_C(        -38), INT32_C(        -10), INT32_C(         58), INT32_C(          4)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -639.22), SIMDE_FLOAT32_C(  308.58), SIMDE_FLOAT32_C( -402.43), SIMDE_FLOAT32_C(  274.11)) },
+    { simde_mm_set_epi32(INT32_C(        -58), INT32_C(         62), INT32_C(         52), INT32_C(        -40)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -104.75), SIMDE_FLOAT32_C(  283.57), SIMDE_FLOAT32_C(  407.25), SIMDE_FLOAT32_C( -559.05)) },
+    { simde_mm_set_epi32(INT32_C(        -48), INT32_C(         54), INT32_C(         18), INT32_C(         26)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -997.36), SIMDE_FLOAT32_C( -817.36), SIMDE_FLOAT32_C(  514.53), SIMDE_FLOAT32_C(  -71.49)) },
+    { simde_mm_set_epi32(INT32_C(          0), INT32_C(        -54), INT32_C(         40), INT32_C(        -54)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  888.36), SIMDE_FLOAT32_C( -289.39), SIMDE_FLOAT32_C(  126.11), SIMDE_FLOAT32_C( -289.39)) },
+    { simde_mm_set_epi32(INT32_C(         14), INT32_C(         36), INT32_C(        -46), INT32_C(         46)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -505.13), SIMDE_FLOAT32_C( -746.08), SIMDE_FLOAT32_C(  299.33), SIMDE_FLOAT32_C( -908.27)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_i32gather_ps(&(table[32]), test_vec[i].vindex, 2);
+    simde_assert_m128_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i32gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(   -20.13), SIMDE_FLOAT32_C(  -229.32), SIMDE_FLOAT32_C(   116.66), SIMDE_FLOAT32_C(   189.08),
+    SIMDE_FLOAT32_C(   756.31), SIMDE_FLOAT32_C(  -147.57), SIMDE_FLOAT32_C(   767.45), SIMDE_FLOAT32_C(   410.64),
+    SIMDE_FLOAT32_C(    13.75), SIMDE_FLOAT32_C(  -534.69), SIMDE_FLOAT32_C(  -542.32), SIMDE_FLOAT32_C(   -18.62),
+    SIMDE_FLOAT32_C(   -75.97), SIMDE_FLOAT32_C(   -16.83), SIMDE_FLOAT32_C(  -767.03), SIMDE_FLOAT32_C(    -5.58),
+    SIMDE_FLOAT32_C(   368.46), SIMDE_FLOAT32_C(   231.37), SIMDE_FLOAT32_C(   590.87), SIMDE_FLOAT32_C(  -229.93),
+    SIMDE_FLOAT32_C(    27.25), SIMDE_FLOAT32_C(   884.55), SIMDE_FLOAT32_C(   849.59), SIMDE_FLOAT32_C(     0.17),
+    SIMDE_FLOAT32_C(   391.64), SIMDE_FLOAT32_C(    26.03), SIMDE_FLOAT32_C(   224.67), SIMDE_FLOAT32_C(   278.18),
+    SIMDE_FLOAT32_C(   545.13), SIMDE_FLOAT32_C(   -24.61), SIMDE_FLOAT32_C(    68.95), SIMDE_FLOAT32_C(   849.70),
+    SIMDE_FLOAT32_C(  -137.22), SIMDE_FLOAT32_C(   665.62), SIMDE_FLOAT32_C(   -89.69), SIMDE_FLOAT32_C(  -382.73),
+    SIMDE_FLOAT32_C(    61.01), SIMDE_FLOAT32_C(  -712.52), SIMDE_FLOAT32_C(  -917.65), SIMDE_FLOAT32_C(  -138.94),
+    SIMDE_FLOAT32_C(   975.65), SIMDE_FLOAT32_C(  -206.23), SIMDE_FLOAT32_C(   220.61), SIMDE_FLOAT32_C(   677.20),
+    SIMDE_FLOAT32_C(  -564.30), SIMDE_FLOAT32_C(   317.16), SIMDE_FLOAT32_C(  -539.80), SIMDE_FLOAT32_C(   234.88),
+    SIMDE_FLOAT32_C(   165.44), SIMDE_FLOAT32_C(    97.78), SIMDE_FLOAT32_C(  -879.47), SIMDE_FLOAT32_C(  -214.05),
+    SIMDE_FLOAT32_C(  -338.31), SIMDE_FLOAT32_C(  -159.87), SIMDE_FLOAT32_C(   222.60), SIMDE_FLOAT32_C(  -902.12),
+    SIMDE_FLOAT32_C(   374.99), SIMDE_FLOAT32_C(   542.30), SIMDE_FLOAT32_C(   -20.39), SIMDE_FLOAT32_C(  -914.37),
+    SIMDE_FLOAT32_C(   430.64), SIMDE_FLOAT32_C(  -268.29), SIMDE_FLOAT32_C(   797.92), SIMDE_FLOAT32_C(   121.33)
+  };
+
+  const struct {
+    simde__m128 src;
+    simde__m128i vindex;
+    simde__m128 mask;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  123.56), SIMDE_FLOAT32_C(  770.19), SIMDE_FLOAT32_C(   99.89), SIMDE_FLOAT32_C( -181.58)),
+      simde_mm_set_epi32(INT32_C(         30), INT32_C(          6), INT32_C(         58), INT32_C(         14)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  124.60), SIMDE_FLOAT32_C(  546.52), SIMDE_FLOAT32_C(  159.48), SIMDE_FLOAT32_C(  829.15)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  123.56), SIMDE_FLOAT32_C(  770.19), SIMDE_FLOAT32_C(   99.89), SIMDE_FLOAT32_C( -181.58)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(   68.49), SIMDE_FLOAT32_C(  -47.70), SIMDE_FLOAT32_C( -976.93), SIMDE_FLOAT32_C(  606.77)),
+      simde_mm_set_epi32(INT32_C(         42), INT32_C(          0), INT32_C(         60), INT32_C(          8)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -962.61), SIMDE_FLOAT32_C(  223.88), SIMDE_FLOAT32_C( -232.76), SIMDE_FLOAT32_C(  779.52)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -159.87), SIMDE_FLOAT32_C(  -47.70), SIMDE_FLOAT32_C(  797.92), SIMDE_FLOAT32_C(  606.77)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -856.13), SIMDE_FLOAT32_C( -706.40), SIMDE_FLOAT32_C(  174.96), SIMDE_FLOAT32_C( -215.81)),
+      simde_mm_set_epi32(INT32_C(        -46), INT32_C(        -56), INT32_C(          2), INT32_C(        -28)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  388.64), SIMDE_FLOAT32_C( -899.22), SIMDE_FLOAT32_C(   22.36), SIMDE_FLOAT32_C(  180.32)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -856.13), SIMDE_FLOAT32_C(  756.31), SIMDE_FLOAT32_C(  174.96), SIMDE_FLOAT32_C( -215.81)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  427.70), SIMDE_FLOAT32_C( -155.38), SIMDE_FLOAT32_C(  642.63), SIMDE_FLOAT32_C( -222.31)),
+      simde_mm_set_epi32(INT32_C(        -34), INT32_C(          8), INT32_C(        -24), INT32_C(        -50)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -891.77), SIMDE_FLOAT32_C( -913.18), SIMDE_FLOAT32_C(  459.14), SIMDE_FLOAT32_C( -194.76)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(   -5.58), SIMDE_FLOAT32_C(   61.01), SIMDE_FLOAT32_C(  642.63), SIMDE_FLOAT32_C(  410.64)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -314.60), SIMDE_FLOAT32_C( -639.48), SIMDE_FLOAT32_C(  564.28), SIMDE_FLOAT32_C( -172.95)),
+      simde_mm_set_epi32(INT32_C(         50), INT32_C(        -30), INT32_C(        -50), INT32_C(         34)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -495.06), SIMDE_FLOAT32_C(   -9.80), SIMDE_FLOAT32_C(  721.14), SIMDE_FLOAT32_C(  622.26)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  542.30), SIMDE_FLOAT32_C(  231.37), SIMDE_FLOAT32_C(  564.28), SIMDE_FLOAT32_C( -172.95)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -726.67), SIMDE_FLOAT32_C(  -70.21), SIMDE_FLOAT32_C(  469.29), SIMDE_FLOAT32_C(  504.32)),
+      simde_mm_set_epi32(INT32_C(         12), INT32_C(        -40), INT32_C(         36), INT32_C(         60)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  -43.91), SIMDE_FLOAT32_C( -909.49), SIMDE_FLOAT32_C(  459.01), SIMDE_FLOAT32_C( -711.52)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -917.65), SIMDE_FLOAT32_C(  -75.97), SIMDE_FLOAT32_C(  469.29), SIMDE_FLOAT32_C(  797.92)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  960.49), SIMDE_FLOAT32_C( -976.43), SIMDE_FLOAT32_C( -560.64), SIMDE_FLOAT32_C(  696.90)),
+      simde_mm_set_epi32(INT32_C(          4), INT32_C(         12), INT32_C(         24), INT32_C(         42)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  745.16), SIMDE_FLOAT32_C( -101.97), SIMDE_FLOAT32_C( -126.03), SIMDE_FLOAT32_C(  141.87)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  960.49), SIMDE_FLOAT32_C( -917.65), SIMDE_FLOAT32_C( -564.30), SIMDE_FLOAT32_C(  696.90)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  121.85), SIMDE_FLOAT32_C(  113.31), SIMDE_FLOAT32_C(  887.90), SIMDE_FLOAT32_C( -411.33)),
+      simde_mm_set_epi32(INT32_C(         12), INT32_C(         18), INT32_C(        -12), INT32_C(         26)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -839.80), SIMDE_FLOAT32_C(  902.09), SIMDE_FLOAT32_C( -537.42), SIMDE_FLOAT32_C(  558.61)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -917.65), SIMDE_FLOAT32_C(  113.31), SIMDE_FLOAT32_C(  224.67), SIMDE_FLOAT32_C( -411.33)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_mask_i32gather_ps(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 2);
+    simde_assert_m128_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(  -797.37), SIMDE_FLOAT32_C(   -81.75), SIMDE_FLOAT32_C(   446.22), SIMDE_FLOAT32_C(  -807.46),
+    SIMDE_FLOAT32_C(   859.99), SIMDE_FLOAT32_C(   780.31), SIMDE_FLOAT32_C(   145.82), SIMDE_FLOAT32_C(   769.92),
+    SIMDE_FLOAT32_C(  -407.15), SIMDE_FLOAT32_C(   -45.11), SIMDE_FLOAT32_C(    68.74), SIMDE_FLOAT32_C(  -916.22),
+    SIMDE_FLOAT32_C(   -59.51), SIMDE_FLOAT32_C(  -542.07), SIMDE_FLOAT32_C(   257.04), SIMDE_FLOAT32_C(   -41.74),
+    SIMDE_FLOAT32_C(  -892.67), SIMDE_FLOAT32_C(   463.59), SIMDE_FLOAT32_C(  -660.68), SIMDE_FLOAT32_C(   678.99),
+    SIMDE_FLOAT32_C(   859.47), SIMDE_FLOAT32_C(  -247.31), SIMDE_FLOAT32_C(   -53.89), SIMDE_FLOAT32_C(  -330.48),
+    SIMDE_FLOAT32_C(   778.01), SIMDE_FLOAT32_C(   193.79), SIMDE_FLOAT32_C(   372.46), SIMDE_FLOAT32_C(   831.96),
+    SIMDE_FLOAT32_C(  -215.70), SIMDE_FLOAT32_C(   885.65), SIMDE_FLOAT32_C(   547.05), SIMDE_FLOAT32_C(  -373.67),
+    SIMDE_FLOAT32_C(   816.17), SIMDE_FLOAT32_C(  -347.96), SIMDE_FLOAT32_C(  -248.10), SIMDE_FLOAT32_C(  -113.76),
+    SIMDE_FLOAT32_C(  -365.52), SIMDE_FLOAT32_C(   912.08), SIMDE_FLOAT32_C(  -864.41), SIMDE_FLOAT32_C(   857.30),
+    SIMDE_FLOAT32_C(  -996.87), SIMDE_FLOAT32_C(   635.79), SIMDE_FLOAT32_C(   903.81), SIMDE_FLOAT32_C(   700.66),
+    SIMDE_FLOAT32_C(  -268.24), SIMDE_FLOAT32_C(   116.31), SIMDE_FLOAT32_C(  -481.06), SIMDE_FLOAT32_C(   730.44),
+    SIMDE_FLOAT32_C(   637.04), SIMDE_FLOAT32_C(   923.52), SIMDE_FLOAT32_C(   758.94), SIMDE_FLOAT32_C(   599.82),
+    SIMDE_FLOAT32_C(   851.21), SIMDE_FLOAT32_C(  -743.55), SIMDE_FLOAT32_C(   720.86), SIMDE_FLOAT32_C(  -553.46),
+    SIMDE_FLOAT32_C(   138.33), SIMDE_FLOAT32_C(  -748.95), SIMDE_FLOAT32_C(   651.87), SIMDE_FLOAT32_C(    35.29),
+    SIMDE_FLOAT32_C(   137.45), SIMDE_FLOAT32_C(   356.41), SIMDE_FLOAT32_C(   683.25), SIMDE_FLOAT32_C(  -574.44)
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(        -14), INT32_C(          4), INT32_C(         20), INT32_C(         14),
+                            INT32_C(        -40), INT32_C(        -50), INT32_C(         42), INT32_C(         28)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  193.79), SIMDE_FLOAT32_C( -248.10),
+                         SIMDE_FLOAT32_C(  903.81), SIMDE_FLOAT32_C(  857.30),
+                         SIMDE_FLOAT32_C(  -59.51), SIMDE_FLOAT32_C(  769.92),
+                         SIMDE_FLOAT32_C( -743.55), SIMDE_FLOAT32_C( -481.06)) },
+    { simde_mm256_set_epi32(INT32_C(        -20), INT32_C(         28), INT32_C(        -32), INT32_C(        -50),
+                            INT32_C(        -42), INT32_C(         56), INT32_C(        -32), INT32_C(        -20)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  -53.89), SIMDE_FLOAT32_C( -481.06),
+                         SIMDE_FLOAT32_C( -892.67), SIMDE_FLOAT32_C(  769.92),
+                         SIMDE_FLOAT32_C( -916.22), SIMDE_FLOAT32_C(  137.45),
+                         SIMDE_FLOAT32_C( -892.67), SIMDE_FLOAT32_C(  -53.89)) },
+    { simde_mm256_set_epi32(INT32_C(          0), INT32_C(         40), INT32_C(        -30), INT32_C(         12),
+                            INT32_C(         50), INT32_C(         -6), INT32_C(        -24), INT32_C(         46)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  816.17), SIMDE_FLOAT32_C(  851.21),
+                         SIMDE_FLOAT32_C(  463.59), SIMDE_FLOAT32_C( -864.41),
+                         SIMDE_FLOAT32_C( -748.95), SIMDE_FLOAT32_C(  885.65),
+                         SIMDE_FLOAT32_C(  859.47), SIMDE_FLOAT32_C( -553.46)) },
+    { simde_mm256_set_epi32(INT32_C(         44), INT32_C(         10), INT32_C(        -54), INT32_C(          2),
+                            INT32_C(         18), INT32_C(        -42), INT32_C(         -4), INT32_C(          0)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  720.86), SIMDE_FLOAT32_C(  912.08),
+                         SIMDE_FLOAT32_C(  780.31), SIMDE_FLOAT32_C( -347.96),
+                         SIMDE_FLOAT32_C(  635.79), SIMDE_FLOAT32_C( -916.22),
+                         SIMDE_FLOAT32_C(  547.05), SIMDE_FLOAT32_C(  816.17)) },
+    { simde_mm256_set_epi32(INT32_C(         38), INT32_C(         12), INT32_C(        -16), INT32_C(        -44),
+                            INT32_C(        -34), INT32_C(         56), INT32_C(         42), INT32_C(        -10)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  599.82), SIMDE_FLOAT32_C( -864.41),
+                         SIMDE_FLOAT32_C(  778.01), SIMDE_FLOAT32_C(   68.74),
+                         SIMDE_FLOAT32_C(  -41.74), SIMDE_FLOAT32_C(  137.45),
+                         SIMDE_FLOAT32_C( -743.55), SIMDE_FLOAT32_C(  831.96)) },
+    { simde_mm256_set_epi32(INT32_C(        -32), INT32_C(          6), INT32_C(        -50), INT32_C(         38),
+                            INT32_C(         24), INT32_C(        -38), INT32_C(        -34), INT32_C(         40)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C( -892.67), SIMDE_FLOAT32_C( -113.76),
+                         SIMDE_FLOAT32_C(  769.92), SIMDE_FLOAT32_C(  599.82),
+                         SIMDE_FLOAT32_C( -268.24), SIMDE_FLOAT32_C( -542.07),
+                         SIMDE_FLOAT32_C(  -41.74), SIMDE_FLOAT32_C(  851.21)) },
+    { simde_mm256_set_epi32(INT32_C(        -10), INT32_C(         14), INT32_C(        -32), INT32_C(         26),
+                            INT32_C(         50), INT32_C(        -34), INT32_C(          6), INT32_C(        -16)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  831.96), SIMDE_FLOAT32_C(  857.30),
+                         SIMDE_FLOAT32_C( -892.67), SIMDE_FLOAT32_C(  116.31),
+                         SIMDE_FLOAT32_C( -748.95), SIMDE_FLOAT32_C(  -41.74),
+                         SIMDE_FLOAT32_C( -113.76), SIMDE_FLOAT32_C(  778.01)) },
+    { simde_mm256_set_epi32(INT32_C(         14), INT32_C(        -36), INT32_C(        -64), INT32_C(         32),
+                            INT32_C(         22), INT32_C(         10), INT32_C(        -32), INT32_C(        -30)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  857.30), SIMDE_FLOAT32_C(  257.04),
+                         SIMDE_FLOAT32_C( -797.37), SIMDE_FLOAT32_C(  637.04),
+                         SIMDE_FLOAT32_C(  700.66), SIMDE_FLOAT32_C(  912.08),
+                         SIMDE_FLOAT32_C( -892.67), SIMDE_FLOAT32_C(  463.59)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_i32gather_ps(&(table[32]), test_vec[i].vindex, 2);
+    simde_assert_m256_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i32gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(   790.05), SIMDE_FLOAT32_C(  -396.63), SIMDE_FLOAT32_C(  -947.53), SIMDE_FLOAT32_C(   490.78),
+    SIMDE_FLOAT32_C(   177.66), SIMDE_FLOAT32_C(  -674.35), SIMDE_FLOAT32_C(   753.14), SIMDE_FLOAT32_C(   842.47),
+    SIMDE_FLOAT32_C(  -259.10), SIMDE_FLOAT32_C(  -328.14), SIMDE_FLOAT32_C(   326.40), SIMDE_FLOAT32_C(   700.48),
+    SIMDE_FLOAT32_C(   779.61), SIMDE_FLOAT32_C(   493.17), SIMDE_FLOAT32_C(   -12.75), SIMDE_FLOAT32_C(   771.07),
+    SIMDE_FLOAT32_C(   265.37), SIMDE_FLOAT32_C(   930.24), SIMDE_FLOAT32_C(   536.42), SIMDE_FLOAT32_C(  -457.28),
+    SIMDE_FLOAT32_C(  -190.51), SIMDE_FLOAT32_C(   207.37), SIMDE_FLOAT32_C(   663.52), SIMDE_FLOAT32_C(  -542.50),
+    SIMDE_FLOAT32_C(  -768.86), SIMDE_FLOAT32_C(  -672.19), SIMDE_FLOAT32_C(   338.05), SIMDE_FLOAT32_C(   -21.54),
+    SIMDE_FLOAT32_C(   437.31), SIMDE_FLOAT32_C(    -9.29), SIMDE_FLOAT32_C(   792.53), SIMDE_FLOAT32_C(  -358.94),
+    SIMDE_FLOAT32_C(   516.92), SIMDE_FLOAT32_C(  -447.30), SIMDE_FLOAT32_C(  -379.89), SIMDE_FLOAT32_C(  -525.49),
+    SIMDE_FLOAT32_C(  -773.72), SIMDE_FLOAT32_C(   688.82), SIMDE_FLOAT32_C(     6.66), SIMDE_FLOAT32_C(   239.35),
+    SIMDE_FLOAT32_C(   206.19), SIMDE_FLOAT32_C(   116.55), SIMDE_FLOAT32_C(  -493.36), SIMDE_FLOAT32_C(   944.41),
+    SIMDE_FLOAT32_C(   284.53), SIMDE_FLOAT32_C(   803.91), SIMDE_FLOAT32_C(   395.35), SIMDE_FLOAT32_C(  -379.91),
+    SIMDE_FLOAT32_C(   188.30), SIMDE_FLOAT32_C(  -961.71), SIMDE_FLOAT32_C(  -720.34), SIMDE_FLOAT32_C(    57.28),
+    SIMDE_FLOAT32_C(   989.43), SIMDE_FLOAT32_C(  -969.71), SIMDE_FLOAT32_C(  -825.48), SIMDE_FLOAT32_C(   688.21),
+    SIMDE_FLOAT32_C(  -762.07), SIMDE_FLOAT32_C(    64.68), SIMDE_FLOAT32_C(   224.68), SIMDE_FLOAT32_C(  -864.09),
+    SIMDE_FLOAT32_C(    21.89), SIMDE_FLOAT32_C(   527.22), SIMDE_FLOAT32_C(  -597.83), SIMDE_FLOAT32_C(    40.38)
+  };
+
+  const struct {
+    simde__m256 src;
+    simde__m256i vindex;
+    simde__m256 mask;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C(   63.55), SIMDE_FLOAT32_C(  900.91),
+                         SIMDE_FLOAT32_C( -379.60), SIMDE_FLOAT32_C( -140.99),
+                         SIMDE_FLOAT32_C(  533.07), SIMDE_FLOAT32_C(  127.10),
+                         SIMDE_FLOAT32_C(  409.81), SIMDE_FLOAT32_C(  840.53)),
+      simde_mm256_set_epi32(INT32_C(         28), INT32_C(        -50), INT32_C(        -36), INT32_C(         28),
+                            INT32_C(         60), INT32_C(        -62), INT32_C(        -62), INT32_C(         -2)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C( -439.73), SIMDE_FLOAT32_C( -981.24),
+                         SIMDE_FLOAT32_C( -920.98), SIMDE_FLOAT32_C(  945.83),
+                         SIMDE_FLOAT32_C( -950.77), SIMDE_FLOAT32_C(  502.23),
+                         SIMDE_FLOAT32_C( -443.19), SIMDE_FLOAT32_C( -888.45)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  395.35), SIMDE_FLOAT32_C(  842.47),
+                         SIMDE_FLOAT32_C(  -12.75), SIMDE_FLOAT32_C( -140.99),
+                         SIMDE_FLOAT32_C( -597.83), SIMDE_FLOAT32_C(  127.10),
+                         SIMDE_FLOAT32_C( -396.63), SIMDE_FLOAT32_C( -358.94)) },
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C(  498.72), SIMDE_FLOAT32_C(   78.68),
+                         SIMDE_FLOAT32_C(  179.01), SIMDE_FLOAT32_C(  933.74),
+                         SIMDE_FLOAT32_C( -309.86), SIMDE_FLOAT32_C(  448.41),
+                         SIMDE_FLOAT32_C( -348.59), SIMDE_FLOAT32_C( -900.15)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(         16), INT32_C(         34), INT32_C(        -54),
+                            INT32_C(         10), INT32_C(         24), INT32_C(        -16), INT32_C(         60)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C( -243.01), SIMDE_FLOAT32_C( -841.28),
+                         SIMDE_FLOAT32_C(  277.13), SIMDE_FLOAT32_C(  464.25),
+                         SIMDE_FLOAT32_C( -435.39), SIMDE_FLOAT32_C(  327.59),
+                         SIMDE_FLOAT32_C( -323.14), SIMDE_FLOAT32_C( -420.51)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  516.92), SIMDE_FLOAT32_C(  206.19),
+                         SIMDE_FLOAT32_C(  179.01), SIMDE_FLOAT32_C(  933.74),
+                         SIMDE_FLOAT32_C(  688.82), SIMDE_FLOAT32_C(  448.41),
+                         SIMDE_FLOAT32_C( -768.86), SIMDE_FLOAT32_C( -597.83)) },
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C(  -98.55), SIMDE_FLOAT32_C( -674.31),
+                         SIMDE_FLOAT32_C( -204.63), SIMDE_FLOAT32_C(  935.13),
+                         SIMDE_FLOAT32_C( -300.50), SIMDE_FLOAT32_C(  655.52),
+                         SIMDE_FLOAT32_C(  639.31), SIMDE_FLOAT32_C(  875.81)),
+      simde_mm256_set_epi32(INT32_C(         38), INT32_C(         18), INT32_C(         58), INT32_C(          4),
+                            INT32_C(        -62), INT32_C(         56), INT32_C(        -30), INT32_C(        -50)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  177.50), SIMDE_FLOAT32_C(  727.06),
+                         SIMDE_FLOAT32_C(  906.88), SIMDE_FLOAT32_C( -466.86),
+                         SIMDE_FLOAT32_C(  902.08), SIMDE_FLOAT32_C(  -54.70),
+                         SIMDE_FLOAT32_C(  991.97), SIMDE_FLOAT32_C(   88.63)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  -98.55), SIMDE_FLOAT32_C( -674.31),
+                         SIMDE_FLOAT32_C( -204.63), SIMDE_FLOAT32_C( -379.89),
+                         SIMDE_FLOAT32_C( -300.50), SIMDE_FLOAT32_C(   21.89),
+                         SIMDE_FLOAT32_C(  639.31), SIMDE_FLOAT32_C(  875.81)) },
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C(  276.63), SIMDE_FLOAT32_C(  103.07),
+                         SIMDE_FLOAT32_C( -983.51), SIMDE_FLOAT32_C(   51.70),
+                         SIMDE_FLOAT32_C(  826.97), SIMDE_FLOAT32_C( -375.22),
+                         SIMDE_FLOAT32_C( -394.83), SIMDE_FLOAT32_C( -685.56)),
+      simde_mm256_set_epi32(INT32_C(        -36), INT32_C(        -46), INT32_C(          0), INT32_C(         -8),
+                            INT32_C(         14), INT32_C(          8), INT32_C(        -56), INT32_C(        -62)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C( -683.73), SIMDE_FLOAT32_C(    8.11),
+                         SIMDE_FLOAT32_C(   96.01), SIMDE_FLOAT32_C( -793.89),
+                         SIMDE_FLOAT32_C( -512.29), SIMDE_FLOAT32_C( -413.69),
+                         SIMDE_FLOAT32_C(    6.33), SIMDE_FLOAT32_C( -989.20)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  -12.75), SIMDE_FLOAT32_C(  103.07),
+                         SIMDE_FLOAT32_C( -983.51), SIMDE_FLOAT32_C(  437.31),
+                         SIMDE_FLOAT32_C(  239.35), SIMDE_FLOAT32_C( -773.72),
+                         SIMDE_FLOAT32_C( -394.83), SIMDE_FLOAT32_C( -396.63)) },
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C(  434.45), SIMDE_FLOAT32_C(  113.01),
+                         SIMDE_FLOAT32_C(  896.20), SIMDE_FLOAT32_C(  187.61),
+                         SIMDE_FLOAT32_C(  -33.44), SIMDE_FLOAT32_C(  823.67),
+                         SIMDE_FLOAT32_C(  700.79), SIMDE_FLOAT32_C(  323.12)),
+      simde_mm256_set_epi32(INT32_C(         30), INT32_C(         60), INT32_C(         -4), INT32_C(        -22),
+                            INT32_C(        -50), INT32_C(         18), INT32_C(        -26), INT32_C(         -2)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  656.59), SIMDE_FLOAT32_C( -583.05),
+                         SIMDE_FLOAT32_C( -945.99), SIMDE_FLOAT32_C(   36.84),
+                         SIMDE_FLOAT32_C(  287.95), SIMDE_FLOAT32_C(  636.66),
+                         SIMDE_FLOAT32_C(  423.86), SIMDE_FLOAT32_C( -713.63)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  434.45), SIMDE_FLOAT32_C( -597.83),
+                         SIMDE_FLOAT32_C(  792.53), SIMDE_FLOAT32_C(  187.61),
+                         SIMDE_FLOAT32_C(  -33.44), SIMDE_FLOAT32_C(  823.67),
+                         SIMDE_FLOAT32_C(  700.79), SIMDE_FLOAT32_C( -358.94)) },
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C(  866.98), SIMDE_FLOAT32_C(  815.81),
+                         SIMDE_FLOAT32_C( -390.70), SIMDE_FLOAT32_C( -651.09),
+                         SIMDE_FLOAT32_C(  808.93), SIMDE_FLOAT32_C(  311.83),
+                         SIMDE_FLOAT32_C( -290.92), SIMDE_FLOAT32_C( -505.55)),
+      simde_mm256_set_epi32(INT32_C(        -22), INT32_C(         28), INT32_C(         34), INT32_C(         34),
+                            INT32_C(         36), INT32_C(        -62), INT32_C(         36), INT32_C(         18)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  695.22), SIMDE_FLOAT32_C(  666.50),
+                         SIMDE_FLOAT32_C(   19.69), SIMDE_FLOAT32_C( -836.82),
+                         SIMDE_FLOAT32_C( -685.62), SIMDE_FLOAT32_C( -863.84),
+                         SIMDE_FLOAT32_C(   97.29), SIMDE_FLOAT32_C(  108.81)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  866.98), SIMDE_FLOAT32_C(  815.81),
+                         SIMDE_FLOAT32_C( -390.70), SIMDE_FLOAT32_C( -961.71),
+                         SIMDE_FLOAT32_C( -720.34), SIMDE_FLOAT32_C( -396.63),
+                         SIMDE_FLOAT32_C( -290.92), SIMDE_FLOAT32_C( -505.55)) },
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C(  968.70), SIMDE_FLOAT32_C(  -31.75),
+                         SIMDE_FLOAT32_C( -937.46), SIMDE_FLOAT32_C( -186.68),
+                         SIMDE_FLOAT32_C( -182.06), SIMDE_FLOAT32_C(  376.89),
+                         SIMDE_FLOAT32_C( -184.93), SIMDE_FLOAT32_C(  -33.32)),
+      simde_mm256_set_epi32(INT32_C(         38), INT32_C(        -48), INT32_C(        -46), INT32_C(        -26),
+                            INT32_C(        -32), INT32_C(          8), INT32_C(         18), INT32_C(         18)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  306.36), SIMDE_FLOAT32_C( -199.82),
+                         SIMDE_FLOAT32_C(  -75.75), SIMDE_FLOAT32_C( -680.42),
+                         SIMDE_FLOAT32_C(  916.10), SIMDE_FLOAT32_C( -945.27),
+                         SIMDE_FLOAT32_C(  193.67), SIMDE_FLOAT32_C(  690.03)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  968.70), SIMDE_FLOAT32_C( -259.10),
+                         SIMDE_FLOAT32_C( -328.14), SIMDE_FLOAT32_C( -457.28),
+                         SIMDE_FLOAT32_C( -182.06), SIMDE_FLOAT32_C( -773.72),
+                         SIMDE_FLOAT32_C( -184.93), SIMDE_FLOAT32_C(  -33.32)) },
+    { simde_mm256_set_ps(SIMDE_FLOAT32_C( -279.81), SIMDE_FLOAT32_C(   40.96),
+                         SIMDE_FLOAT32_C( -377.84), SIMDE_FLOAT32_C(  956.19),
+                         SIMDE_FLOAT32_C(  714.09), SIMDE_FLOAT32_C(  535.78),
+                         SIMDE_FLOAT32_C(  321.12), SIMDE_FLOAT32_C(  -41.56)),
+      simde_mm256_set_epi32(INT32_C(        -48), INT32_C(         46), INT32_C(        -56), INT32_C(         30),
+                            INT32_C(         -8), INT32_C(          6), INT32_C(        -64), INT32_C(        -26)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(  -71.19), SIMDE_FLOAT32_C( -834.08),
+                         SIMDE_FLOAT32_C(  158.28), SIMDE_FLOAT32_C( -575.08),
+                         SIMDE_FLOAT32_C(  255.78), SIMDE_FLOAT32_C(  718.83),
+                         SIMDE_FLOAT32_C(  317.99), SIMDE_FLOAT32_C(  717.01)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C( -259.10), SIMDE_FLOAT32_C(  688.21),
+                         SIMDE_FLOAT32_C( -377.84), SIMDE_FLOAT32_C( -379.91),
+                         SIMDE_FLOAT32_C(  714.09), SIMDE_FLOAT32_C(  535.78),
+                         SIMDE_FLOAT32_C(  321.12), SIMDE_FLOAT32_C(  -41.56)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm256_mask_i32gather_ps(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 2);
+    simde_assert_m256_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i64gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(   341.84), SIMDE_FLOAT32_C(   267.33), SIMDE_FLOAT32_C(  -319.49), SIMDE_FLOAT32_C(   797.02),
+    SIMDE_FLOAT32_C(   896.83), SIMDE_FLOAT32_C(   897.74), SIMDE_FLOAT32_C(  -845.03), SIMDE_FLOAT32_C(  -505.56),
+    SIMDE_FLOAT32_C(  -728.29), SIMDE_FLOAT32_C(   315.08), SIMDE_FLOAT32_C(   197.83), SIMDE_FLOAT32_C(  -928.35),
+    SIMDE_FLOAT32_C(   467.70), SIMDE_FLOAT32_C(   -25.66), SIMDE_FLOAT32_C(   621.63), SIMDE_FLOAT32_C(  -595.56),
+    SIMDE_FLOAT32_C(   457.17), SIMDE_FLOAT32_C(  -631.70), SIMDE_FLOAT32_C(   666.55), SIMDE_FLOAT32_C(  -512.26),
+    SIMDE_FLOAT32_C(   827.31), SIMDE_FLOAT32_C(   506.32), SIMDE_FLOAT32_C(  -131.96), SIMDE_FLOAT32_C(   866.53),
+    SIMDE_FLOAT32_C(   323.15), SIMDE_FLOAT32_C(   103.23), SIMDE_FLOAT32_C(  -992.70), SIMDE_FLOAT32_C(   -95.79),
+    SIMDE_FLOAT32_C(   -14.73), SIMDE_FLOAT32_C(   449.03), SIMDE_FLOAT32_C(   442.68), SIMDE_FLOAT32_C(   607.70),
+    SIMDE_FLOAT32_C(   150.44), SIMDE_FLOAT32_C(  -246.49), SIMDE_FLOAT32_C(   570.79), SIMDE_FLOAT32_C(   234.54),
+    SIMDE_FLOAT32_C(  -629.41), SIMDE_FLOAT32_C(   780.47), SIMDE_FLOAT32_C(  -469.50), SIMDE_FLOAT32_C(  -163.44),
+    SIMDE_FLOAT32_C(   757.46), SIMDE_FLOAT32_C(  -191.76), SIMDE_FLOAT32_C(   597.55), SIMDE_FLOAT32_C(  -192.25),
+    SIMDE_FLOAT32_C(   986.19), SIMDE_FLOAT32_C(   580.37), SIMDE_FLOAT32_C(    55.43), SIMDE_FLOAT32_C(  -745.57),
+    SIMDE_FLOAT32_C(  -957.11), SIMDE_FLOAT32_C(  -549.89), SIMDE_FLOAT32_C(   991.16), SIMDE_FLOAT32_C(   802.49),
+    SIMDE_FLOAT32_C(   109.15), SIMDE_FLOAT32_C(   531.05), SIMDE_FLOAT32_C(   978.71), SIMDE_FLOAT32_C(  -812.86),
+    SIMDE_FLOAT32_C(  -365.42), SIMDE_FLOAT32_C(   192.40), SIMDE_FLOAT32_C(  -172.15), SIMDE_FLOAT32_C(   706.82),
+    SIMDE_FLOAT32_C(   -76.66), SIMDE_FLOAT32_C(   380.34), SIMDE_FLOAT32_C(   441.28), SIMDE_FLOAT32_C(   -80.03)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(                  -4), INT64_C(                  -9)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  -14.73), SIMDE_FLOAT32_C(  866.53)) },
+    { simde_mm_set_epi64x(INT64_C(                  -9), INT64_C(                  -2)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  866.53), SIMDE_FLOAT32_C(  442.68)) },
+    { simde_mm_set_epi64x(INT64_C(                   6), INT64_C(                   6)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -469.50), SIMDE_FLOAT32_C( -469.50)) },
+    { simde_mm_set_epi64x(INT64_C(                 -18), INT64_C(                 -14)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  621.63), SIMDE_FLOAT32_C(  666.55)) },
+    { simde_mm_set_epi64x(INT64_C(                 -19), INT64_C(                  17)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  -25.66), SIMDE_FLOAT32_C( -549.89)) },
+    { simde_mm_set_epi64x(INT64_C(                   8), INT64_C(                  17)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  757.46), SIMDE_FLOAT32_C( -549.89)) },
+    { simde_mm_set_epi64x(INT64_C(                  28), INT64_C(                 -26)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  -76.66), SIMDE_FLOAT32_C( -845.03)) },
+    { simde_mm_set_epi64x(INT64_C(                  22), INT64_C(                  19)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  978.71), SIMDE_FLOAT32_C(  802.49)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_i64gather_ps(&(table[32]), test_vec[i].vindex, 4);
+    simde_assert_m128_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i64gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(  -504.78), SIMDE_FLOAT32_C(   361.63), SIMDE_FLOAT32_C(     3.62), SIMDE_FLOAT32_C(   756.13),
+    SIMDE_FLOAT32_C(   353.65), SIMDE_FLOAT32_C(   469.52), SIMDE_FLOAT32_C(   -70.85), SIMDE_FLOAT32_C(  -888.80),
+    SIMDE_FLOAT32_C(  -326.52), SIMDE_FLOAT32_C(  -563.01), SIMDE_FLOAT32_C(  -569.90), SIMDE_FLOAT32_C(   634.21),
+    SIMDE_FLOAT32_C(   697.17), SIMDE_FLOAT32_C(   -45.62), SIMDE_FLOAT32_C(  -951.89), SIMDE_FLOAT32_C(   680.05),
+    SIMDE_FLOAT32_C(  -351.22), SIMDE_FLOAT32_C(   380.22), SIMDE_FLOAT32_C(   145.50), SIMDE_FLOAT32_C(  -201.40),
+    SIMDE_FLOAT32_C(  -222.24), SIMDE_FLOAT32_C(  -518.26), SIMDE_FLOAT32_C(  -684.93), SIMDE_FLOAT32_C(     6.06),
+    SIMDE_FLOAT32_C(   319.06), SIMDE_FLOAT32_C(   -97.56), SIMDE_FLOAT32_C(   853.49), SIMDE_FLOAT32_C(   950.98),
+    SIMDE_FLOAT32_C(   123.49), SIMDE_FLOAT32_C(   815.62), SIMDE_FLOAT32_C(  -238.58), SIMDE_FLOAT32_C(  -219.68),
+    SIMDE_FLOAT32_C(  -866.36), SIMDE_FLOAT32_C(  -575.74), SIMDE_FLOAT32_C(   896.61), SIMDE_FLOAT32_C(   -22.15),
+    SIMDE_FLOAT32_C(  -796.40), SIMDE_FLOAT32_C(  -406.00), SIMDE_FLOAT32_C(   841.50), SIMDE_FLOAT32_C(    -6.39),
+    SIMDE_FLOAT32_C(  -918.24), SIMDE_FLOAT32_C(  -775.23), SIMDE_FLOAT32_C(   932.57), SIMDE_FLOAT32_C(    83.23),
+    SIMDE_FLOAT32_C(  -258.26), SIMDE_FLOAT32_C(  -684.73), SIMDE_FLOAT32_C(   158.76), SIMDE_FLOAT32_C(   279.89),
+    SIMDE_FLOAT32_C(   197.54), SIMDE_FLOAT32_C(   399.88), SIMDE_FLOAT32_C(   630.17), SIMDE_FLOAT32_C(  -534.64),
+    SIMDE_FLOAT32_C(   599.00), SIMDE_FLOAT32_C(  -806.21), SIMDE_FLOAT32_C(  -298.01), SIMDE_FLOAT32_C(  -546.67),
+    SIMDE_FLOAT32_C(  -600.94), SIMDE_FLOAT32_C(   328.67), SIMDE_FLOAT32_C(   916.18), SIMDE_FLOAT32_C(  -596.07),
+    SIMDE_FLOAT32_C(   273.85), SIMDE_FLOAT32_C(   -37.81), SIMDE_FLOAT32_C(  -786.84), SIMDE_FLOAT32_C(  -852.33)
+  };
+
+  const struct {
+    simde__m128 src;
+    simde__m128i vindex;
+    simde__m128 mask;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -691.75), SIMDE_FLOAT32_C(  288.51), SIMDE_FLOAT32_C( -928.39), SIMDE_FLOAT32_C(  698.34)),
+      simde_mm_set_epi64x(INT64_C(                  21), INT64_C(                  -6)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(   18.57), SIMDE_FLOAT32_C(  521.56), SIMDE_FLOAT32_C( -982.53), SIMDE_FLOAT32_C( -583.81)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -806.21), SIMDE_FLOAT32_C(  853.49)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  293.48), SIMDE_FLOAT32_C(  213.03), SIMDE_FLOAT32_C(   94.55), SIMDE_FLOAT32_C( -664.74)),
+      simde_mm_set_epi64x(INT64_C(                  19), INT64_C(                 -10)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  528.15), SIMDE_FLOAT32_C(  295.88), SIMDE_FLOAT32_C(  -83.19), SIMDE_FLOAT32_C(  647.53)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -534.64), SIMDE_FLOAT32_C( -664.74)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  -88.45), SIMDE_FLOAT32_C( -833.99), SIMDE_FLOAT32_C( -155.85), SIMDE_FLOAT32_C(  -73.53)),
+      simde_mm_set_epi64x(INT64_C(                  28), INT64_C(                   6)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -568.83), SIMDE_FLOAT32_C(  318.27), SIMDE_FLOAT32_C(  574.21), SIMDE_FLOAT32_C(  274.40)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -155.85), SIMDE_FLOAT32_C(  -73.53)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  202.74), SIMDE_FLOAT32_C( -691.50), SIMDE_FLOAT32_C( -555.76), SIMDE_FLOAT32_C(  632.76)),
+      simde_mm_set_epi64x(INT64_C(                  -9), INT64_C(                  19)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -128.14), SIMDE_FLOAT32_C( -248.14), SIMDE_FLOAT32_C(  865.78), SIMDE_FLOAT32_C(  161.13)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -555.76), SIMDE_FLOAT32_C(  632.76)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -108.66), SIMDE_FLOAT32_C( -119.23), SIMDE_FLOAT32_C( -467.46), SIMDE_FLOAT32_C( -808.15)),
+      simde_mm_set_epi64x(INT64_C(                  -2), INT64_C(                  24)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  114.34), SIMDE_FLOAT32_C(  791.61), SIMDE_FLOAT32_C( -202.04), SIMDE_FLOAT32_C(  228.27)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -238.58), SIMDE_FLOAT32_C( -808.15)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  877.40), SIMDE_FLOAT32_C(   39.57), SIMDE_FLOAT32_C(  950.34), SIMDE_FLOAT32_C( -701.97)),
+      simde_mm_set_epi64x(INT64_C(                 -11), INT64_C(                 -28)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  264.28), SIMDE_FLOAT32_C(  188.53), SIMDE_FLOAT32_C(  -76.39), SIMDE_FLOAT32_C(  662.02)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -518.26), SIMDE_FLOAT32_C( -701.97)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -299.12), SIMDE_FLOAT32_C(   31.41), SIMDE_FLOAT32_C(  665.76), SIMDE_FLOAT32_C( -153.91)),
+      simde_mm_set_epi64x(INT64_C(                  25), INT64_C(                  29)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  418.10), SIMDE_FLOAT32_C( -622.28), SIMDE_FLOAT32_C( -451.11), SIMDE_FLOAT32_C(  723.80)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  328.67), SIMDE_FLOAT32_C( -153.91)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -127.15), SIMDE_FLOAT32_C(  341.78), SIMDE_FLOAT32_C(  622.29), SIMDE_FLOAT32_C( -567.70)),
+      simde_mm_set_epi64x(INT64_C(                 -28), INT64_C(                  15)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  364.95), SIMDE_FLOAT32_C( -495.14), SIMDE_FLOAT32_C(  429.55), SIMDE_FLOAT32_C( -488.66)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  622.29), SIMDE_FLOAT32_C(  279.89)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm_mask_i64gather_ps(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 4);
+    simde_assert_m128_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(  -318.31), SIMDE_FLOAT32_C(  -652.61), SIMDE_FLOAT32_C(   754.44), SIMDE_FLOAT32_C(    94.40),
+    SIMDE_FLOAT32_C(   623.90), SIMDE_FLOAT32_C(  -413.43), SIMDE_FLOAT32_C(   621.80), SIMDE_FLOAT32_C(  -375.69),
+    SIMDE_FLOAT32_C(   675.97), SIMDE_FLOAT32_C(    61.23), SIMDE_FLOAT32_C(  -958.13), SIMDE_FLOAT32_C(   318.80),
+    SIMDE_FLOAT32_C(  -889.45), SIMDE_FLOAT32_C(   778.00), SIMDE_FLOAT32_C(  -486.19), SIMDE_FLOAT32_C(   107.83),
+    SIMDE_FLOAT32_C(  -506.03), SIMDE_FLOAT32_C(   -40.79), SIMDE_FLOAT32_C(   663.92), SIMDE_FLOAT32_C(  -924.46),
+    SIMDE_FLOAT32_C(   699.82), SIMDE_FLOAT32_C(   532.94), SIMDE_FLOAT32_C(   273.55), SIMDE_FLOAT32_C(   568.41),
+    SIMDE_FLOAT32_C(  -106.14), SIMDE_FLOAT32_C(   476.95), SIMDE_FLOAT32_C(  -151.80), SIMDE_FLOAT32_C(   616.21),
+    SIMDE_FLOAT32_C(   835.03), SIMDE_FLOAT32_C(  -156.98), SIMDE_FLOAT32_C(   395.90), SIMDE_FLOAT32_C(  -885.12),
+    SIMDE_FLOAT32_C(   436.45), SIMDE_FLOAT32_C(  -310.97), SIMDE_FLOAT32_C(   599.77), SIMDE_FLOAT32_C(   676.68),
+    SIMDE_FLOAT32_C(  -356.44), SIMDE_FLOAT32_C(   593.75), SIMDE_FLOAT32_C(  -242.90), SIMDE_FLOAT32_C(    26.69),
+    SIMDE_FLOAT32_C(  -806.07), SIMDE_FLOAT32_C(   901.05), SIMDE_FLOAT32_C(   460.10), SIMDE_FLOAT32_C(  -857.88),
+    SIMDE_FLOAT32_C(   645.89), SIMDE_FLOAT32_C(  -124.03), SIMDE_FLOAT32_C(   -62.71), SIMDE_FLOAT32_C(   967.49),
+    SIMDE_FLOAT32_C(  -244.94), SIMDE_FLOAT32_C(   351.59), SIMDE_FLOAT32_C(  -561.22), SIMDE_FLOAT32_C(   813.06),
+    SIMDE_FLOAT32_C(   284.92), SIMDE_FLOAT32_C(  -496.11), SIMDE_FLOAT32_C(   -47.98), SIMDE_FLOAT32_C(  -961.87),
+    SIMDE_FLOAT32_C(  -582.85), SIMDE_FLOAT32_C(  -379.72), SIMDE_FLOAT32_C(   740.84), SIMDE_FLOAT32_C(  -635.95),
+    SIMDE_FLOAT32_C(  -709.06), SIMDE_FLOAT32_C(   436.51), SIMDE_FLOAT32_C(   424.29), SIMDE_FLOAT32_C(  -140.58)
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                  -7), INT64_C(                 -17),
+                             INT64_C(                 -19), INT64_C(                  -7)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  476.95), SIMDE_FLOAT32_C(  107.83), SIMDE_FLOAT32_C(  778.00), SIMDE_FLOAT32_C(  476.95)) },
+    { simde_mm256_set_epi64x(INT64_C(                  -6), INT64_C(                 -21),
+                             INT64_C(                 -24), INT64_C(                  29)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -151.80), SIMDE_FLOAT32_C(  318.80), SIMDE_FLOAT32_C(  675.97), SIMDE_FLOAT32_C(  436.51)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -24), INT64_C(                 -17),
+                             INT64_C(                 -15), INT64_C(                 -13)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  675.97), SIMDE_FLOAT32_C(  107.83), SIMDE_FLOAT32_C(  -40.79), SIMDE_FLOAT32_C( -924.46)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -27), INT64_C(                  -3),
+                             INT64_C(                  -3), INT64_C(                  -8)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -413.43), SIMDE_FLOAT32_C( -156.98), SIMDE_FLOAT32_C( -156.98), SIMDE_FLOAT32_C( -106.14)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -31), INT64_C(                 -13),
+                             INT64_C(                 -23), INT64_C(                   6)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -652.61), SIMDE_FLOAT32_C( -924.46), SIMDE_FLOAT32_C(   61.23), SIMDE_FLOAT32_C( -242.90)) },
+    { simde_mm256_set_epi64x(INT64_C(                   7), INT64_C(                 -30),
+                             INT64_C(                 -23), INT64_C(                   3)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(   26.69), SIMDE_FLOAT32_C(  754.44), SIMDE_FLOAT32_C(   61.23), SIMDE_FLOAT32_C(  676.68)) },
+    { simde_mm256_set_epi64x(INT64_C(                  10), INT64_C(                   3),
+                             INT64_C(                  15), INT64_C(                 -17)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  460.10), SIMDE_FLOAT32_C(  676.68), SIMDE_FLOAT32_C(  967.49), SIMDE_FLOAT32_C(  107.83)) },
+    { simde_mm256_set_epi64x(INT64_C(                  22), INT64_C(                  16),
+                             INT64_C(                  21), INT64_C(                   8)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  -47.98), SIMDE_FLOAT32_C( -244.94), SIMDE_FLOAT32_C( -496.11), SIMDE_FLOAT32_C( -806.07)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm256_i64gather_ps(&(table[32]), test_vec[i].vindex, 4);
+    simde_assert_m128_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i64gather_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float32 table[64] = {
+    SIMDE_FLOAT32_C(   287.07), SIMDE_FLOAT32_C(  -103.22), SIMDE_FLOAT32_C(  -865.96), SIMDE_FLOAT32_C(   650.55),
+    SIMDE_FLOAT32_C(  -831.64), SIMDE_FLOAT32_C(   503.07), SIMDE_FLOAT32_C(  -108.44), SIMDE_FLOAT32_C(  -651.65),
+    SIMDE_FLOAT32_C(   674.94), SIMDE_FLOAT32_C(  -861.62), SIMDE_FLOAT32_C(  -294.17), SIMDE_FLOAT32_C(   862.75),
+    SIMDE_FLOAT32_C(  -373.18), SIMDE_FLOAT32_C(  -240.74), SIMDE_FLOAT32_C(   -34.04), SIMDE_FLOAT32_C(  -954.53),
+    SIMDE_FLOAT32_C(  -695.01), SIMDE_FLOAT32_C(  -945.97), SIMDE_FLOAT32_C(  -878.58), SIMDE_FLOAT32_C(   865.44),
+    SIMDE_FLOAT32_C(   922.62), SIMDE_FLOAT32_C(   345.39), SIMDE_FLOAT32_C(   968.79), SIMDE_FLOAT32_C(  -247.88),
+    SIMDE_FLOAT32_C(   511.45), SIMDE_FLOAT32_C(   263.48), SIMDE_FLOAT32_C(  -236.71), SIMDE_FLOAT32_C(   822.47),
+    SIMDE_FLOAT32_C(  -432.41), SIMDE_FLOAT32_C(  -280.43), SIMDE_FLOAT32_C(  -504.03), SIMDE_FLOAT32_C(   958.11),
+    SIMDE_FLOAT32_C(   257.58), SIMDE_FLOAT32_C(   953.88), SIMDE_FLOAT32_C(   488.47), SIMDE_FLOAT32_C(   176.06),
+    SIMDE_FLOAT32_C(  -316.16), SIMDE_FLOAT32_C(   911.99), SIMDE_FLOAT32_C(  -862.63), SIMDE_FLOAT32_C(    38.36),
+    SIMDE_FLOAT32_C(   988.37), SIMDE_FLOAT32_C(   812.78), SIMDE_FLOAT32_C(   -95.02), SIMDE_FLOAT32_C(   766.92),
+    SIMDE_FLOAT32_C(  -268.46), SIMDE_FLOAT32_C(   509.93), SIMDE_FLOAT32_C(  -702.28), SIMDE_FLOAT32_C(  -940.72),
+    SIMDE_FLOAT32_C(   -95.52), SIMDE_FLOAT32_C(  -736.53), SIMDE_FLOAT32_C(    40.27), SIMDE_FLOAT32_C(  -336.64),
+    SIMDE_FLOAT32_C(   320.16), SIMDE_FLOAT32_C(    51.70), SIMDE_FLOAT32_C(  -874.39), SIMDE_FLOAT32_C(  -325.69),
+    SIMDE_FLOAT32_C(  -237.21), SIMDE_FLOAT32_C(  -875.42), SIMDE_FLOAT32_C(   954.86), SIMDE_FLOAT32_C(  -487.91),
+    SIMDE_FLOAT32_C(  -395.57), SIMDE_FLOAT32_C(  -475.70), SIMDE_FLOAT32_C(   212.35), SIMDE_FLOAT32_C(  -449.97)
+  };
+
+  const struct {
+    simde__m128 src;
+    simde__m256i vindex;
+    simde__m128 mask;
+    simde__m128 r;
+  } test_vec[8] = {
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -403.20), SIMDE_FLOAT32_C(  548.23), SIMDE_FLOAT32_C( -490.69), SIMDE_FLOAT32_C( -931.15)),
+      simde_mm256_set_epi64x(INT64_C(                   3), INT64_C(                  -2),
+                             INT64_C(                 -24), INT64_C(                 -32)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  -40.28), SIMDE_FLOAT32_C(  -52.27), SIMDE_FLOAT32_C( -780.16), SIMDE_FLOAT32_C(  116.16)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  176.06), SIMDE_FLOAT32_C( -504.03), SIMDE_FLOAT32_C(  674.94), SIMDE_FLOAT32_C( -931.15)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -362.52), SIMDE_FLOAT32_C( -570.29), SIMDE_FLOAT32_C( -320.78), SIMDE_FLOAT32_C(  740.25)),
+      simde_mm256_set_epi64x(INT64_C(                   4), INT64_C(                 -22),
+                             INT64_C(                 -23), INT64_C(                  10)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -512.08), SIMDE_FLOAT32_C( -970.43), SIMDE_FLOAT32_C(   88.73), SIMDE_FLOAT32_C( -961.93)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -316.16), SIMDE_FLOAT32_C( -294.17), SIMDE_FLOAT32_C( -320.78), SIMDE_FLOAT32_C(  -95.02)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  500.65), SIMDE_FLOAT32_C( -835.52), SIMDE_FLOAT32_C(  837.10), SIMDE_FLOAT32_C(  876.54)),
+      simde_mm256_set_epi64x(INT64_C(                 -25), INT64_C(                  23),
+                             INT64_C(                  21), INT64_C(                 -25)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  608.42), SIMDE_FLOAT32_C( -661.23), SIMDE_FLOAT32_C(   16.90), SIMDE_FLOAT32_C( -253.48)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  500.65), SIMDE_FLOAT32_C( -325.69), SIMDE_FLOAT32_C(  837.10), SIMDE_FLOAT32_C( -651.65)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -929.61), SIMDE_FLOAT32_C(  -88.76), SIMDE_FLOAT32_C(  911.22), SIMDE_FLOAT32_C( -818.43)),
+      simde_mm256_set_epi64x(INT64_C(                 -22), INT64_C(                 -20),
+                             INT64_C(                  21), INT64_C(                 -30)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -802.07), SIMDE_FLOAT32_C(  788.00), SIMDE_FLOAT32_C(   27.04), SIMDE_FLOAT32_C(  989.83)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -294.17), SIMDE_FLOAT32_C(  -88.76), SIMDE_FLOAT32_C(  911.22), SIMDE_FLOAT32_C( -818.43)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  701.69), SIMDE_FLOAT32_C( -378.44), SIMDE_FLOAT32_C( -989.82), SIMDE_FLOAT32_C(  705.62)),
+      simde_mm256_set_epi64x(INT64_C(                 -26), INT64_C(                 -15),
+                             INT64_C(                 -22), INT64_C(                 -20)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -264.51), SIMDE_FLOAT32_C(  195.08), SIMDE_FLOAT32_C( -352.90), SIMDE_FLOAT32_C(   23.76)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -108.44), SIMDE_FLOAT32_C( -378.44), SIMDE_FLOAT32_C( -294.17), SIMDE_FLOAT32_C(  705.62)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -730.83), SIMDE_FLOAT32_C(  269.72), SIMDE_FLOAT32_C( -881.50), SIMDE_FLOAT32_C( -916.19)),
+      simde_mm256_set_epi64x(INT64_C(                  27), INT64_C(                  -3),
+                             INT64_C(                   8), INT64_C(                  18)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(  -75.56), SIMDE_FLOAT32_C(   77.70), SIMDE_FLOAT32_C( -894.48), SIMDE_FLOAT32_C( -294.42)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -487.91), SIMDE_FLOAT32_C(  269.72), SIMDE_FLOAT32_C(  988.37), SIMDE_FLOAT32_C(   40.27)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(  442.58), SIMDE_FLOAT32_C( -317.63), SIMDE_FLOAT32_C( -738.99), SIMDE_FLOAT32_C( -851.35)),
+      simde_mm256_set_epi64x(INT64_C(                  22), INT64_C(                 -26),
+                             INT64_C(                 -24), INT64_C(                  27)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -600.38), SIMDE_FLOAT32_C( -346.51), SIMDE_FLOAT32_C(  346.79), SIMDE_FLOAT32_C( -141.68)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -874.39), SIMDE_FLOAT32_C( -108.44), SIMDE_FLOAT32_C( -738.99), SIMDE_FLOAT32_C( -487.91)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( -652.47), SIMDE_FLOAT32_C(  377.43), SIMDE_FLOAT32_C(  301.57), SIMDE_FLOAT32_C( -331.02)),
+      simde_mm256_set_epi64x(INT64_C(                  21), INT64_C(                   4),
+                             INT64_C(                 -11), INT64_C(                 -10)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    6.03), SIMDE_FLOAT32_C(  770.51), SIMDE_FLOAT32_C( -688.33), SIMDE_FLOAT32_C( -585.11)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C( -652.47), SIMDE_FLOAT32_C(  377.43), SIMDE_FLOAT32_C(  345.39), SIMDE_FLOAT32_C(  968.79)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128 r = simde_mm256_mask_i64gather_ps(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 4);
+    simde_assert_m128_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i32gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(   605.09), SIMDE_FLOAT64_C(   484.22), SIMDE_FLOAT64_C(   916.80), SIMDE_FLOAT64_C(  -142.61),
+    SIMDE_FLOAT64_C(  -765.92), SIMDE_FLOAT64_C(   649.75), SIMDE_FLOAT64_C(   839.21), SIMDE_FLOAT64_C(   329.08),
+    SIMDE_FLOAT64_C(   808.93), SIMDE_FLOAT64_C(  -312.53), SIMDE_FLOAT64_C(   696.93), SIMDE_FLOAT64_C(  -609.38),
+    SIMDE_FLOAT64_C(   486.94), SIMDE_FLOAT64_C(    53.90), SIMDE_FLOAT64_C(  -742.64), SIMDE_FLOAT64_C(  -254.25),
+    SIMDE_FLOAT64_C(  -840.78), SIMDE_FLOAT64_C(  -940.03), SIMDE_FLOAT64_C(  -540.96), SIMDE_FLOAT64_C(   859.39),
+    SIMDE_FLOAT64_C(   565.14), SIMDE_FLOAT64_C(  -551.89), SIMDE_FLOAT64_C(  -603.03), SIMDE_FLOAT64_C(   232.29),
+    SIMDE_FLOAT64_C(  -531.85), SIMDE_FLOAT64_C(    80.53), SIMDE_FLOAT64_C(   128.72), SIMDE_FLOAT64_C(   -15.22),
+    SIMDE_FLOAT64_C(   770.71), SIMDE_FLOAT64_C(  -639.40), SIMDE_FLOAT64_C(   852.22), SIMDE_FLOAT64_C(  -882.13),
+    SIMDE_FLOAT64_C(  -291.54), SIMDE_FLOAT64_C(  -779.91), SIMDE_FLOAT64_C(  -463.51), SIMDE_FLOAT64_C(   843.74),
+    SIMDE_FLOAT64_C(  -168.77), SIMDE_FLOAT64_C(   929.04), SIMDE_FLOAT64_C(   207.94), SIMDE_FLOAT64_C(   402.96),
+    SIMDE_FLOAT64_C(  -598.31), SIMDE_FLOAT64_C(   888.80), SIMDE_FLOAT64_C(  -639.78), SIMDE_FLOAT64_C(   536.51),
+    SIMDE_FLOAT64_C(   969.62), SIMDE_FLOAT64_C(  -252.97), SIMDE_FLOAT64_C(   710.38), SIMDE_FLOAT64_C(  -635.50),
+    SIMDE_FLOAT64_C(  -696.57), SIMDE_FLOAT64_C(  -732.49), SIMDE_FLOAT64_C(  -260.53), SIMDE_FLOAT64_C(   990.97),
+    SIMDE_FLOAT64_C(   968.19), SIMDE_FLOAT64_C(  -871.99), SIMDE_FLOAT64_C(   715.09), SIMDE_FLOAT64_C(  -629.77),
+    SIMDE_FLOAT64_C(   449.73), SIMDE_FLOAT64_C(  -628.67), SIMDE_FLOAT64_C(   951.25), SIMDE_FLOAT64_C(   586.29),
+    SIMDE_FLOAT64_C(   547.02), SIMDE_FLOAT64_C(  -229.91), SIMDE_FLOAT64_C(    80.63), SIMDE_FLOAT64_C(   873.71)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(       -120), INT32_C(        112), INT32_C(        176), INT32_C(         72)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  715.09), SIMDE_FLOAT64_C(  888.80)) },
+    { simde_mm_set_epi32(INT32_C(        120), INT32_C(        152), INT32_C(         40), INT32_C(        128)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  929.04), SIMDE_FLOAT64_C( -696.57)) },
+    { simde_mm_set_epi32(INT32_C(        192), INT32_C(        128), INT32_C(        176), INT32_C(          0)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  715.09), SIMDE_FLOAT64_C( -291.54)) },
+    { simde_mm_set_epi32(INT32_C(         48), INT32_C(       -104), INT32_C(        -16), INT32_C(        112)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  852.22), SIMDE_FLOAT64_C(  710.38)) },
+    { simde_mm_set_epi32(INT32_C(         24), INT32_C(         64), INT32_C(       -152), INT32_C(       -168)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(   53.90), SIMDE_FLOAT64_C( -609.38)) },
+    { simde_mm_set_epi32(INT32_C(       -224), INT32_C(       -200), INT32_C(       -184), INT32_C(        -32)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -312.53), SIMDE_FLOAT64_C(  770.71)) },
+    { simde_mm_set_epi32(INT32_C(        -32), INT32_C(        120), INT32_C(       -128), INT32_C(        -80)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -840.78), SIMDE_FLOAT64_C( -603.03)) },
+    { simde_mm_set_epi32(INT32_C(       -168), INT32_C(        168), INT32_C(         88), INT32_C(        184)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  536.51), SIMDE_FLOAT64_C( -629.77)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_i32gather_pd(&(table[32]), test_vec[i].vindex, 1);
+    simde_assert_m128d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i32gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(  -630.05), SIMDE_FLOAT64_C(   575.30), SIMDE_FLOAT64_C(   807.95), SIMDE_FLOAT64_C(   232.57),
+    SIMDE_FLOAT64_C(   951.70), SIMDE_FLOAT64_C(  -496.25), SIMDE_FLOAT64_C(   645.26), SIMDE_FLOAT64_C(    72.36),
+    SIMDE_FLOAT64_C(  -812.99), SIMDE_FLOAT64_C(  -709.74), SIMDE_FLOAT64_C(  -456.64), SIMDE_FLOAT64_C(  -747.50),
+    SIMDE_FLOAT64_C(   464.64), SIMDE_FLOAT64_C(  -953.06), SIMDE_FLOAT64_C(    34.06), SIMDE_FLOAT64_C(   474.63),
+    SIMDE_FLOAT64_C(  -158.41), SIMDE_FLOAT64_C(   377.15), SIMDE_FLOAT64_C(   291.32), SIMDE_FLOAT64_C(   506.20),
+    SIMDE_FLOAT64_C(   132.53), SIMDE_FLOAT64_C(  -657.68), SIMDE_FLOAT64_C(  -650.34), SIMDE_FLOAT64_C(  -934.54),
+    SIMDE_FLOAT64_C(   773.18), SIMDE_FLOAT64_C(  -907.67), SIMDE_FLOAT64_C(   935.03), SIMDE_FLOAT64_C(  -896.49),
+    SIMDE_FLOAT64_C(  -888.10), SIMDE_FLOAT64_C(  -640.78), SIMDE_FLOAT64_C(  -181.83), SIMDE_FLOAT64_C(   643.49),
+    SIMDE_FLOAT64_C(   209.95), SIMDE_FLOAT64_C(  -440.79), SIMDE_FLOAT64_C(   932.66), SIMDE_FLOAT64_C(  -474.02),
+    SIMDE_FLOAT64_C(   521.76), SIMDE_FLOAT64_C(   598.47), SIMDE_FLOAT64_C(  -726.79), SIMDE_FLOAT64_C(   147.66),
+    SIMDE_FLOAT64_C(  -639.99), SIMDE_FLOAT64_C(   287.19), SIMDE_FLOAT64_C(  -735.40), SIMDE_FLOAT64_C(  -662.41),
+    SIMDE_FLOAT64_C(  -528.15), SIMDE_FLOAT64_C(   275.52), SIMDE_FLOAT64_C(   297.58), SIMDE_FLOAT64_C(  -327.08),
+    SIMDE_FLOAT64_C(   -83.41), SIMDE_FLOAT64_C(  -488.78), SIMDE_FLOAT64_C(   546.13), SIMDE_FLOAT64_C(   543.18),
+    SIMDE_FLOAT64_C(   739.52), SIMDE_FLOAT64_C(   838.50), SIMDE_FLOAT64_C(   979.01), SIMDE_FLOAT64_C(  -632.88),
+    SIMDE_FLOAT64_C(   122.53), SIMDE_FLOAT64_C(  -376.58), SIMDE_FLOAT64_C(  -953.11), SIMDE_FLOAT64_C(  -302.28),
+    SIMDE_FLOAT64_C(  -581.13), SIMDE_FLOAT64_C(  -457.71), SIMDE_FLOAT64_C(   942.90), SIMDE_FLOAT64_C(  -693.72)
+  };
+
+  const struct {
+    simde__m128d src;
+    simde__m128i vindex;
+    simde__m128d mask;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  909.43), SIMDE_FLOAT64_C( -132.91)),
+      simde_mm_set_epi32(INT32_C(         32), INT32_C(        208), INT32_C(        216), INT32_C(       -128)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -265.89), SIMDE_FLOAT64_C( -801.75)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -302.28), SIMDE_FLOAT64_C( -158.41)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  835.72), SIMDE_FLOAT64_C(  731.75)),
+      simde_mm_set_epi32(INT32_C(        144), INT32_C(         96), INT32_C(        -32), INT32_C(       -168)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -171.78), SIMDE_FLOAT64_C(  937.50)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -888.10), SIMDE_FLOAT64_C(  731.75)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  851.38), SIMDE_FLOAT64_C(   -8.07)),
+      simde_mm_set_epi32(INT32_C(        -72), INT32_C(        -32), INT32_C(        216), INT32_C(        192)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  599.34), SIMDE_FLOAT64_C( -959.25)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  851.38), SIMDE_FLOAT64_C(  122.53)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C( -198.27), SIMDE_FLOAT64_C( -485.83)),
+      simde_mm_set_epi32(INT32_C(         24), INT32_C(         40), INT32_C(         56), INT32_C(       -128)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -800.71), SIMDE_FLOAT64_C(  404.99)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  147.66), SIMDE_FLOAT64_C( -485.83)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  329.10), SIMDE_FLOAT64_C(  591.42)),
+      simde_mm_set_epi32(INT32_C(        120), INT32_C(       -128), INT32_C(        104), INT32_C(        216)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -809.06), SIMDE_FLOAT64_C( -246.46)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  275.52), SIMDE_FLOAT64_C( -302.28)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  -35.35), SIMDE_FLOAT64_C( -756.61)),
+      simde_mm_set_epi32(INT32_C(       -112), INT32_C(       -152), INT32_C(        176), INT32_C(        -56)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -272.13), SIMDE_FLOAT64_C(  476.96)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  979.01), SIMDE_FLOAT64_C( -756.61)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  756.01), SIMDE_FLOAT64_C( -307.16)),
+      simde_mm_set_epi32(INT32_C(        232), INT32_C(         56), INT32_C(       -208), INT32_C(        112)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -169.07), SIMDE_FLOAT64_C(  706.60)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  645.26), SIMDE_FLOAT64_C( -307.16)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  109.35), SIMDE_FLOAT64_C(  432.33)),
+      simde_mm_set_epi32(INT32_C(        176), INT32_C(          8), INT32_C(         64), INT32_C(        240)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  174.06), SIMDE_FLOAT64_C( -263.84)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  109.35), SIMDE_FLOAT64_C(  942.90)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_mask_i32gather_pd(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 1);
+    simde_assert_m128d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i32gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(   429.27), SIMDE_FLOAT64_C(  -737.58), SIMDE_FLOAT64_C(   380.63), SIMDE_FLOAT64_C(   285.94),
+    SIMDE_FLOAT64_C(  -510.03), SIMDE_FLOAT64_C(   814.70), SIMDE_FLOAT64_C(  -221.89), SIMDE_FLOAT64_C(  -984.63),
+    SIMDE_FLOAT64_C(  -758.79), SIMDE_FLOAT64_C(  -112.29), SIMDE_FLOAT64_C(  -222.40), SIMDE_FLOAT64_C(  -852.01),
+    SIMDE_FLOAT64_C(  -343.78), SIMDE_FLOAT64_C(   206.47), SIMDE_FLOAT64_C(  -347.82), SIMDE_FLOAT64_C(    -4.37),
+    SIMDE_FLOAT64_C(   707.80), SIMDE_FLOAT64_C(   590.85), SIMDE_FLOAT64_C(   -90.20), SIMDE_FLOAT64_C(   376.74),
+    SIMDE_FLOAT64_C(   171.99), SIMDE_FLOAT64_C(  -133.04), SIMDE_FLOAT64_C(  -135.99), SIMDE_FLOAT64_C(  -710.43),
+    SIMDE_FLOAT64_C(   391.58), SIMDE_FLOAT64_C(  -826.30), SIMDE_FLOAT64_C(   187.24), SIMDE_FLOAT64_C(   308.62),
+    SIMDE_FLOAT64_C(  -342.47), SIMDE_FLOAT64_C(  -661.02), SIMDE_FLOAT64_C(   468.38), SIMDE_FLOAT64_C(  -835.61),
+    SIMDE_FLOAT64_C(   154.85), SIMDE_FLOAT64_C(   591.86), SIMDE_FLOAT64_C(   686.16), SIMDE_FLOAT64_C(  -283.80),
+    SIMDE_FLOAT64_C(   766.81), SIMDE_FLOAT64_C(   853.29), SIMDE_FLOAT64_C(   360.00), SIMDE_FLOAT64_C(  -154.11),
+    SIMDE_FLOAT64_C(  -223.85), SIMDE_FLOAT64_C(  -254.78), SIMDE_FLOAT64_C(   958.05), SIMDE_FLOAT64_C(   777.07),
+    SIMDE_FLOAT64_C(  -260.65), SIMDE_FLOAT64_C(  -421.20), SIMDE_FLOAT64_C(   663.95), SIMDE_FLOAT64_C(   456.37),
+    SIMDE_FLOAT64_C(   286.83), SIMDE_FLOAT64_C(   969.22), SIMDE_FLOAT64_C(   447.84), SIMDE_FLOAT64_C(   -55.94),
+    SIMDE_FLOAT64_C(   393.48), SIMDE_FLOAT64_C(   149.35), SIMDE_FLOAT64_C(   241.53), SIMDE_FLOAT64_C(  -883.32),
+    SIMDE_FLOAT64_C(   716.23), SIMDE_FLOAT64_C(   340.98), SIMDE_FLOAT64_C(   405.98), SIMDE_FLOAT64_C(  -707.57),
+    SIMDE_FLOAT64_C(   633.91), SIMDE_FLOAT64_C(    89.11), SIMDE_FLOAT64_C(  -555.97), SIMDE_FLOAT64_C(   -28.41)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(       -184), INT32_C(        184), INT32_C(         48), INT32_C(       -216)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -112.29), SIMDE_FLOAT64_C( -883.32),
+                         SIMDE_FLOAT64_C(  360.00), SIMDE_FLOAT64_C(  814.70)) },
+    { simde_mm_set_epi32(INT32_C(         32), INT32_C(       -104), INT32_C(        -48), INT32_C(        -56)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  766.81), SIMDE_FLOAT64_C(  376.74),
+                         SIMDE_FLOAT64_C(  187.24), SIMDE_FLOAT64_C( -826.30)) },
+    { simde_mm_set_epi32(INT32_C(        232), INT32_C(       -120), INT32_C(       -168), INT32_C(       -152)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(   89.11), SIMDE_FLOAT64_C(  590.85),
+                         SIMDE_FLOAT64_C( -852.01), SIMDE_FLOAT64_C(  206.47)) },
+    { simde_mm_set_epi32(INT32_C(          8), INT32_C(        -88), INT32_C(       -192), INT32_C(        160)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  591.86), SIMDE_FLOAT64_C( -133.04),
+                         SIMDE_FLOAT64_C( -758.79), SIMDE_FLOAT64_C(  393.48)) },
+    { simde_mm_set_epi32(INT32_C(        -72), INT32_C(       -240), INT32_C(         96), INT32_C(         80)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -710.43), SIMDE_FLOAT64_C(  380.63),
+                         SIMDE_FLOAT64_C( -260.65), SIMDE_FLOAT64_C(  958.05)) },
+    { simde_mm_set_epi32(INT32_C(        -72), INT32_C(        144), INT32_C(         72), INT32_C(       -224)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -710.43), SIMDE_FLOAT64_C(  447.84),
+                         SIMDE_FLOAT64_C( -254.78), SIMDE_FLOAT64_C( -510.03)) },
+    { simde_mm_set_epi32(INT32_C(       -232), INT32_C(       -136), INT32_C(        -32), INT32_C(       -200)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  285.94), SIMDE_FLOAT64_C(   -4.37),
+                         SIMDE_FLOAT64_C( -342.47), SIMDE_FLOAT64_C( -984.63)) },
+    { simde_mm_set_epi32(INT32_C(         56), INT32_C(       -152), INT32_C(        -64), INT32_C(       -184)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -154.11), SIMDE_FLOAT64_C(  206.47),
+                         SIMDE_FLOAT64_C(  391.58), SIMDE_FLOAT64_C( -112.29)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_i32gather_pd(&(table[32]), test_vec[i].vindex, 1);
+    simde_assert_m256d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i32gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(   661.89), SIMDE_FLOAT64_C(   -90.57), SIMDE_FLOAT64_C(   893.30), SIMDE_FLOAT64_C(  -243.32),
+    SIMDE_FLOAT64_C(   214.58), SIMDE_FLOAT64_C(   461.65), SIMDE_FLOAT64_C(   -56.43), SIMDE_FLOAT64_C(   506.65),
+    SIMDE_FLOAT64_C(  -481.92), SIMDE_FLOAT64_C(   722.71), SIMDE_FLOAT64_C(   625.21), SIMDE_FLOAT64_C(   398.80),
+    SIMDE_FLOAT64_C(    67.91), SIMDE_FLOAT64_C(  -669.84), SIMDE_FLOAT64_C(   813.41), SIMDE_FLOAT64_C(   -90.54),
+    SIMDE_FLOAT64_C(  -650.39), SIMDE_FLOAT64_C(   737.60), SIMDE_FLOAT64_C(   684.73), SIMDE_FLOAT64_C(  -778.78),
+    SIMDE_FLOAT64_C(   763.75), SIMDE_FLOAT64_C(  -855.57), SIMDE_FLOAT64_C(  -966.84), SIMDE_FLOAT64_C(   137.50),
+    SIMDE_FLOAT64_C(   802.79), SIMDE_FLOAT64_C(  -679.25), SIMDE_FLOAT64_C(  -402.84), SIMDE_FLOAT64_C(   274.47),
+    SIMDE_FLOAT64_C(  -769.38), SIMDE_FLOAT64_C(  -916.02), SIMDE_FLOAT64_C(   419.57), SIMDE_FLOAT64_C(   646.07),
+    SIMDE_FLOAT64_C(  -921.51), SIMDE_FLOAT64_C(   732.66), SIMDE_FLOAT64_C(   316.13), SIMDE_FLOAT64_C(   344.52),
+    SIMDE_FLOAT64_C(   797.64), SIMDE_FLOAT64_C(  -875.49), SIMDE_FLOAT64_C(  -431.02), SIMDE_FLOAT64_C(   656.24),
+    SIMDE_FLOAT64_C(   301.74), SIMDE_FLOAT64_C(  -493.52), SIMDE_FLOAT64_C(  -197.81), SIMDE_FLOAT64_C(   126.34),
+    SIMDE_FLOAT64_C(  -284.49), SIMDE_FLOAT64_C(   561.41), SIMDE_FLOAT64_C(   689.16), SIMDE_FLOAT64_C(   -91.60),
+    SIMDE_FLOAT64_C(   618.82), SIMDE_FLOAT64_C(  -660.38), SIMDE_FLOAT64_C(  -994.37), SIMDE_FLOAT64_C(   658.02),
+    SIMDE_FLOAT64_C(   -50.40), SIMDE_FLOAT64_C(    -3.50), SIMDE_FLOAT64_C(  -956.00), SIMDE_FLOAT64_C(  -741.60),
+    SIMDE_FLOAT64_C(   -84.82), SIMDE_FLOAT64_C(   901.94), SIMDE_FLOAT64_C(   771.90), SIMDE_FLOAT64_C(  -677.74),
+    SIMDE_FLOAT64_C(   602.60), SIMDE_FLOAT64_C(   103.49), SIMDE_FLOAT64_C(  -292.79), SIMDE_FLOAT64_C(   371.93)
+  };
+
+  const struct {
+    simde__m256d src;
+    simde__m128i vindex;
+    simde__m256d mask;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C(  737.83), SIMDE_FLOAT64_C(  758.21),
+                         SIMDE_FLOAT64_C( -243.61), SIMDE_FLOAT64_C( -201.62)),
+      simde_mm_set_epi32(INT32_C(        136), INT32_C(        112), INT32_C(       -240), INT32_C(        120)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -617.81), SIMDE_FLOAT64_C(  964.28),
+                         SIMDE_FLOAT64_C(  651.14), SIMDE_FLOAT64_C(   51.05)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -660.38), SIMDE_FLOAT64_C(  758.21),
+                         SIMDE_FLOAT64_C( -243.61), SIMDE_FLOAT64_C( -201.62)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -312.62), SIMDE_FLOAT64_C(  453.74),
+                         SIMDE_FLOAT64_C( -262.33), SIMDE_FLOAT64_C( -952.35)),
+      simde_mm_set_epi32(INT32_C(        120), INT32_C(       -144), INT32_C(         48), INT32_C(        120)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -516.10), SIMDE_FLOAT64_C(  353.41),
+                         SIMDE_FLOAT64_C( -873.06), SIMDE_FLOAT64_C(  289.11)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  -91.60), SIMDE_FLOAT64_C(  453.74),
+                         SIMDE_FLOAT64_C( -431.02), SIMDE_FLOAT64_C( -952.35)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -467.36), SIMDE_FLOAT64_C(  180.64),
+                         SIMDE_FLOAT64_C( -321.27), SIMDE_FLOAT64_C(  335.00)),
+      simde_mm_set_epi32(INT32_C(       -128), INT32_C(        160), INT32_C(         64), INT32_C(        -64)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  292.44), SIMDE_FLOAT64_C( -388.82),
+                         SIMDE_FLOAT64_C(  644.70), SIMDE_FLOAT64_C( -241.17)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -467.36), SIMDE_FLOAT64_C(  -50.40),
+                         SIMDE_FLOAT64_C( -321.27), SIMDE_FLOAT64_C(  802.79)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C(    1.83), SIMDE_FLOAT64_C( -695.91),
+                         SIMDE_FLOAT64_C( -124.61), SIMDE_FLOAT64_C(  548.91)),
+      simde_mm_set_epi32(INT32_C(        144), INT32_C(        208), INT32_C(        144), INT32_C(        -24)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -372.95), SIMDE_FLOAT64_C( -325.50),
+                         SIMDE_FLOAT64_C( -972.81), SIMDE_FLOAT64_C(  -75.76)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -994.37), SIMDE_FLOAT64_C(  771.90),
+                         SIMDE_FLOAT64_C( -994.37), SIMDE_FLOAT64_C( -916.02)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -254.76), SIMDE_FLOAT64_C(  637.13),
+                         SIMDE_FLOAT64_C( -192.89), SIMDE_FLOAT64_C( -917.95)),
+      simde_mm_set_epi32(INT32_C(        -24), INT32_C(        -88), INT32_C(       -160), INT32_C(        -24)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  204.12), SIMDE_FLOAT64_C(  862.01),
+                         SIMDE_FLOAT64_C( -802.33), SIMDE_FLOAT64_C( -144.23)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -254.76), SIMDE_FLOAT64_C(  637.13),
+                         SIMDE_FLOAT64_C(   67.91), SIMDE_FLOAT64_C( -916.02)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C(  606.21), SIMDE_FLOAT64_C(  146.72),
+                         SIMDE_FLOAT64_C(  222.20), SIMDE_FLOAT64_C(  198.07)),
+      simde_mm_set_epi32(INT32_C(        192), INT32_C(       -160), INT32_C(       -152), INT32_C(       -208)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  542.70), SIMDE_FLOAT64_C( -426.53),
+                         SIMDE_FLOAT64_C(  384.70), SIMDE_FLOAT64_C(  475.04)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  606.21), SIMDE_FLOAT64_C(   67.91),
+                         SIMDE_FLOAT64_C(  222.20), SIMDE_FLOAT64_C(  198.07)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C(  755.09), SIMDE_FLOAT64_C( -208.85),
+                         SIMDE_FLOAT64_C(  -52.62), SIMDE_FLOAT64_C(  942.94)),
+      simde_mm_set_epi32(INT32_C(        176), INT32_C(       -192), INT32_C(         -8), INT32_C(        -80)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  420.88), SIMDE_FLOAT64_C(  231.64),
+                         SIMDE_FLOAT64_C( -434.18), SIMDE_FLOAT64_C(  988.96)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  755.09), SIMDE_FLOAT64_C( -208.85),
+                         SIMDE_FLOAT64_C(  646.07), SIMDE_FLOAT64_C(  942.94)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -117.07), SIMDE_FLOAT64_C(  896.64),
+                         SIMDE_FLOAT64_C(  282.07), SIMDE_FLOAT64_C( -795.02)),
+      simde_mm_set_epi32(INT32_C(         88), INT32_C(         72), INT32_C(        240), INT32_C(         72)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -321.65), SIMDE_FLOAT64_C( -507.06),
+                         SIMDE_FLOAT64_C(  652.42), SIMDE_FLOAT64_C(  554.80)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  126.34), SIMDE_FLOAT64_C( -493.52),
+                         SIMDE_FLOAT64_C(  282.07), SIMDE_FLOAT64_C( -795.02)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_mask_i32gather_pd(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 1);
+    simde_assert_m256d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_i64gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(   -43.96), SIMDE_FLOAT64_C(  -786.03), SIMDE_FLOAT64_C(   198.45), SIMDE_FLOAT64_C(    20.85),
+    SIMDE_FLOAT64_C(   625.28), SIMDE_FLOAT64_C(  -937.64), SIMDE_FLOAT64_C(  -146.94), SIMDE_FLOAT64_C(   165.48),
+    SIMDE_FLOAT64_C(   189.23), SIMDE_FLOAT64_C(   772.45), SIMDE_FLOAT64_C(   985.88), SIMDE_FLOAT64_C(  -515.62),
+    SIMDE_FLOAT64_C(  -779.72), SIMDE_FLOAT64_C(  -743.56), SIMDE_FLOAT64_C(   474.24), SIMDE_FLOAT64_C(  -405.04),
+    SIMDE_FLOAT64_C(  -979.42), SIMDE_FLOAT64_C(  -358.87), SIMDE_FLOAT64_C(   -42.99), SIMDE_FLOAT64_C(   669.50),
+    SIMDE_FLOAT64_C(   -43.52), SIMDE_FLOAT64_C(  -185.11), SIMDE_FLOAT64_C(   319.24), SIMDE_FLOAT64_C(   873.90),
+    SIMDE_FLOAT64_C(  -466.46), SIMDE_FLOAT64_C(  -956.86), SIMDE_FLOAT64_C(  -541.98), SIMDE_FLOAT64_C(   755.00),
+    SIMDE_FLOAT64_C(  -512.06), SIMDE_FLOAT64_C(  -141.93), SIMDE_FLOAT64_C(  -897.17), SIMDE_FLOAT64_C(  -886.49),
+    SIMDE_FLOAT64_C(   945.52), SIMDE_FLOAT64_C(   -33.97), SIMDE_FLOAT64_C(  -244.64), SIMDE_FLOAT64_C(   708.55),
+    SIMDE_FLOAT64_C(  -420.18), SIMDE_FLOAT64_C(  -438.20), SIMDE_FLOAT64_C(  -969.03), SIMDE_FLOAT64_C(   663.46),
+    SIMDE_FLOAT64_C(  -203.46), SIMDE_FLOAT64_C(  -700.84), SIMDE_FLOAT64_C(  -302.36), SIMDE_FLOAT64_C(   946.49),
+    SIMDE_FLOAT64_C(   -46.83), SIMDE_FLOAT64_C(   840.64), SIMDE_FLOAT64_C(   379.85), SIMDE_FLOAT64_C(  -366.99),
+    SIMDE_FLOAT64_C(  -616.97), SIMDE_FLOAT64_C(  -497.39), SIMDE_FLOAT64_C(   820.60), SIMDE_FLOAT64_C(  -517.08),
+    SIMDE_FLOAT64_C(  -784.22), SIMDE_FLOAT64_C(  -722.75), SIMDE_FLOAT64_C(   119.62), SIMDE_FLOAT64_C(   674.09),
+    SIMDE_FLOAT64_C(   332.55), SIMDE_FLOAT64_C(   397.35), SIMDE_FLOAT64_C(  -811.97), SIMDE_FLOAT64_C(   425.61),
+    SIMDE_FLOAT64_C(   -23.82), SIMDE_FLOAT64_C(  -142.32), SIMDE_FLOAT64_C(   503.78), SIMDE_FLOAT64_C(   273.70)
+  };
+
+  const struct {
+    simde__m128i vindex;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C(                  24), INT64_C(                  21)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  332.55), SIMDE_FLOAT64_C( -722.75)) },
+    { simde_mm_set_epi64x(INT64_C(                  19), INT64_C(                  24)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -517.08), SIMDE_FLOAT64_C(  332.55)) },
+    { simde_mm_set_epi64x(INT64_C(                 -17), INT64_C(                  19)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -405.04), SIMDE_FLOAT64_C( -517.08)) },
+    { simde_mm_set_epi64x(INT64_C(                 -10), INT64_C(                   2)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  319.24), SIMDE_FLOAT64_C( -244.64)) },
+    { simde_mm_set_epi64x(INT64_C(                 -29), INT64_C(                  20)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(   20.85), SIMDE_FLOAT64_C( -784.22)) },
+    { simde_mm_set_epi64x(INT64_C(                  -3), INT64_C(                 -17)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -141.93), SIMDE_FLOAT64_C( -405.04)) },
+    { simde_mm_set_epi64x(INT64_C(                 -23), INT64_C(                  29)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  772.45), SIMDE_FLOAT64_C( -142.32)) },
+    { simde_mm_set_epi64x(INT64_C(                  -3), INT64_C(                  -9)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -141.93), SIMDE_FLOAT64_C(  873.90)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_i64gather_pd(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m128d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_i64gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(   235.32), SIMDE_FLOAT64_C(   257.62), SIMDE_FLOAT64_C(   916.92), SIMDE_FLOAT64_C(   167.57),
+    SIMDE_FLOAT64_C(  -541.54), SIMDE_FLOAT64_C(  -608.18), SIMDE_FLOAT64_C(  -896.52), SIMDE_FLOAT64_C(   310.18),
+    SIMDE_FLOAT64_C(   258.27), SIMDE_FLOAT64_C(   156.70), SIMDE_FLOAT64_C(  -734.25), SIMDE_FLOAT64_C(  -384.53),
+    SIMDE_FLOAT64_C(   644.37), SIMDE_FLOAT64_C(   578.53), SIMDE_FLOAT64_C(  -669.56), SIMDE_FLOAT64_C(  -914.43),
+    SIMDE_FLOAT64_C(   886.84), SIMDE_FLOAT64_C(  -568.10), SIMDE_FLOAT64_C(  -154.59), SIMDE_FLOAT64_C(  -731.49),
+    SIMDE_FLOAT64_C(   724.19), SIMDE_FLOAT64_C(   355.32), SIMDE_FLOAT64_C(  -610.56), SIMDE_FLOAT64_C(   467.44),
+    SIMDE_FLOAT64_C(  -463.89), SIMDE_FLOAT64_C(   -82.10), SIMDE_FLOAT64_C(   684.95), SIMDE_FLOAT64_C(  -680.86),
+    SIMDE_FLOAT64_C(   -35.84), SIMDE_FLOAT64_C(  -993.17), SIMDE_FLOAT64_C(   957.56), SIMDE_FLOAT64_C(   630.57),
+    SIMDE_FLOAT64_C(  -153.41), SIMDE_FLOAT64_C(  -176.16), SIMDE_FLOAT64_C(  -658.76), SIMDE_FLOAT64_C(   661.71),
+    SIMDE_FLOAT64_C(  -857.69), SIMDE_FLOAT64_C(  -531.16), SIMDE_FLOAT64_C(  -249.79), SIMDE_FLOAT64_C(  -125.95),
+    SIMDE_FLOAT64_C(   548.50), SIMDE_FLOAT64_C(  -202.56), SIMDE_FLOAT64_C(  -695.69), SIMDE_FLOAT64_C(   326.42),
+    SIMDE_FLOAT64_C(   543.92), SIMDE_FLOAT64_C(  -853.79), SIMDE_FLOAT64_C(   977.72), SIMDE_FLOAT64_C(  -334.93),
+    SIMDE_FLOAT64_C(   693.29), SIMDE_FLOAT64_C(  -295.50), SIMDE_FLOAT64_C(   628.36), SIMDE_FLOAT64_C(   969.87),
+    SIMDE_FLOAT64_C(   901.94), SIMDE_FLOAT64_C(  -421.16), SIMDE_FLOAT64_C(   -81.26), SIMDE_FLOAT64_C(  -957.95),
+    SIMDE_FLOAT64_C(  -276.16), SIMDE_FLOAT64_C(   729.43), SIMDE_FLOAT64_C(  -916.74), SIMDE_FLOAT64_C(   -55.78),
+    SIMDE_FLOAT64_C(   807.87), SIMDE_FLOAT64_C(   313.85), SIMDE_FLOAT64_C(  -411.32), SIMDE_FLOAT64_C(  -972.26)
+  };
+
+  const struct {
+    simde__m128d src;
+    simde__m128i vindex;
+    simde__m128d mask;
+    simde__m128d r;
+  } test_vec[8] = {
+    { simde_mm_set_pd(SIMDE_FLOAT64_C( -188.27), SIMDE_FLOAT64_C( -412.22)),
+      simde_mm_set_epi64x(INT64_C(                  14), INT64_C(                 -24)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  378.02), SIMDE_FLOAT64_C(  515.05)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -188.27), SIMDE_FLOAT64_C( -412.22)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C( -809.31), SIMDE_FLOAT64_C( -446.06)),
+      simde_mm_set_epi64x(INT64_C(                  28), INT64_C(                  19)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  150.63), SIMDE_FLOAT64_C(  116.81)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -809.31), SIMDE_FLOAT64_C( -446.06)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  290.71), SIMDE_FLOAT64_C(  137.27)),
+      simde_mm_set_epi64x(INT64_C(                  16), INT64_C(                  -5)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -209.58), SIMDE_FLOAT64_C(  -75.76)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  693.29), SIMDE_FLOAT64_C( -680.86)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  598.40), SIMDE_FLOAT64_C(  961.01)),
+      simde_mm_set_epi64x(INT64_C(                 -15), INT64_C(                   8)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  442.48), SIMDE_FLOAT64_C( -522.77)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  598.40), SIMDE_FLOAT64_C(  548.50)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C( -993.06), SIMDE_FLOAT64_C( -774.34)),
+      simde_mm_set_epi64x(INT64_C(                   1), INT64_C(                  13)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(   10.77), SIMDE_FLOAT64_C(  137.11)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -993.06), SIMDE_FLOAT64_C( -774.34)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  451.33), SIMDE_FLOAT64_C(  424.82)),
+      simde_mm_set_epi64x(INT64_C(                 -31), INT64_C(                  -4)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  849.98), SIMDE_FLOAT64_C( -438.31)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  451.33), SIMDE_FLOAT64_C(  -35.84)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C( -634.96), SIMDE_FLOAT64_C( -892.62)),
+      simde_mm_set_epi64x(INT64_C(                  -6), INT64_C(                  29)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  374.76), SIMDE_FLOAT64_C(  969.16)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C( -634.96), SIMDE_FLOAT64_C( -892.62)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(  243.82), SIMDE_FLOAT64_C(  603.97)),
+      simde_mm_set_epi64x(INT64_C(                  25), INT64_C(                  21)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  951.32), SIMDE_FLOAT64_C( -211.08)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(  243.82), SIMDE_FLOAT64_C( -421.16)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128d r = simde_mm_mask_i64gather_pd(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m128d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_i64gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(   912.33), SIMDE_FLOAT64_C(  -235.10), SIMDE_FLOAT64_C(   511.29), SIMDE_FLOAT64_C(   -96.85),
+    SIMDE_FLOAT64_C(  -974.95), SIMDE_FLOAT64_C(  -651.84), SIMDE_FLOAT64_C(  -515.03), SIMDE_FLOAT64_C(  -283.54),
+    SIMDE_FLOAT64_C(  -962.52), SIMDE_FLOAT64_C(  -589.66), SIMDE_FLOAT64_C(    94.97), SIMDE_FLOAT64_C(   748.56),
+    SIMDE_FLOAT64_C(   918.44), SIMDE_FLOAT64_C(   108.47), SIMDE_FLOAT64_C(  -280.98), SIMDE_FLOAT64_C(   641.49),
+    SIMDE_FLOAT64_C(   620.30), SIMDE_FLOAT64_C(   947.95), SIMDE_FLOAT64_C(   479.33), SIMDE_FLOAT64_C(     9.09),
+    SIMDE_FLOAT64_C(   807.31), SIMDE_FLOAT64_C(   609.03), SIMDE_FLOAT64_C(   -50.02), SIMDE_FLOAT64_C(  -276.69),
+    SIMDE_FLOAT64_C(   276.29), SIMDE_FLOAT64_C(  -319.42), SIMDE_FLOAT64_C(   -56.26), SIMDE_FLOAT64_C(   616.04),
+    SIMDE_FLOAT64_C(   633.96), SIMDE_FLOAT64_C(  -646.94), SIMDE_FLOAT64_C(   920.12), SIMDE_FLOAT64_C(   832.93),
+    SIMDE_FLOAT64_C(  -618.76), SIMDE_FLOAT64_C(   643.28), SIMDE_FLOAT64_C(   481.32), SIMDE_FLOAT64_C(   161.86),
+    SIMDE_FLOAT64_C(   831.06), SIMDE_FLOAT64_C(   391.29), SIMDE_FLOAT64_C(  -254.67), SIMDE_FLOAT64_C(   394.32),
+    SIMDE_FLOAT64_C(  -399.43), SIMDE_FLOAT64_C(  -444.86), SIMDE_FLOAT64_C(   816.36), SIMDE_FLOAT64_C(    -9.15),
+    SIMDE_FLOAT64_C(   804.03), SIMDE_FLOAT64_C(   537.66), SIMDE_FLOAT64_C(   709.72), SIMDE_FLOAT64_C(    23.05),
+    SIMDE_FLOAT64_C(   -16.67), SIMDE_FLOAT64_C(   508.42), SIMDE_FLOAT64_C(   857.46), SIMDE_FLOAT64_C(   983.75),
+    SIMDE_FLOAT64_C(   155.41), SIMDE_FLOAT64_C(   894.94), SIMDE_FLOAT64_C(   376.26), SIMDE_FLOAT64_C(   -84.89),
+    SIMDE_FLOAT64_C(  -680.51), SIMDE_FLOAT64_C(    97.14), SIMDE_FLOAT64_C(  -347.50), SIMDE_FLOAT64_C(  -861.61),
+    SIMDE_FLOAT64_C(   993.02), SIMDE_FLOAT64_C(   714.53), SIMDE_FLOAT64_C(  -541.65), SIMDE_FLOAT64_C(   459.68)
+  };
+
+  const struct {
+    simde__m256i vindex;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi64x(INT64_C(                 -21), INT64_C(                  14),
+                             INT64_C(                  -7), INT64_C(                  28)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  748.56), SIMDE_FLOAT64_C(  709.72),
+                         SIMDE_FLOAT64_C( -319.42), SIMDE_FLOAT64_C(  993.02)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -23), INT64_C(                   4),
+                             INT64_C(                 -32), INT64_C(                  14)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -589.66), SIMDE_FLOAT64_C(  831.06),
+                         SIMDE_FLOAT64_C(  912.33), SIMDE_FLOAT64_C(  709.72)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -24), INT64_C(                  13),
+                             INT64_C(                  25), INT64_C(                  12)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -962.52), SIMDE_FLOAT64_C(  537.66),
+                         SIMDE_FLOAT64_C(   97.14), SIMDE_FLOAT64_C(  804.03)) },
+    { simde_mm256_set_epi64x(INT64_C(                  10), INT64_C(                   7),
+                             INT64_C(                  26), INT64_C(                 -20)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  816.36), SIMDE_FLOAT64_C(  394.32),
+                         SIMDE_FLOAT64_C( -347.50), SIMDE_FLOAT64_C(  918.44)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -23), INT64_C(                 -23),
+                             INT64_C(                 -32), INT64_C(                  25)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -589.66), SIMDE_FLOAT64_C( -589.66),
+                         SIMDE_FLOAT64_C(  912.33), SIMDE_FLOAT64_C(   97.14)) },
+    { simde_mm256_set_epi64x(INT64_C(                 -14), INT64_C(                 -14),
+                             INT64_C(                  28), INT64_C(                  21)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  479.33), SIMDE_FLOAT64_C(  479.33),
+                         SIMDE_FLOAT64_C(  993.02), SIMDE_FLOAT64_C(  894.94)) },
+    { simde_mm256_set_epi64x(INT64_C(                  27), INT64_C(                 -13),
+                             INT64_C(                 -22), INT64_C(                 -15)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -861.61), SIMDE_FLOAT64_C(    9.09),
+                         SIMDE_FLOAT64_C(   94.97), SIMDE_FLOAT64_C(  947.95)) },
+    { simde_mm256_set_epi64x(INT64_C(                   2), INT64_C(                   5),
+                             INT64_C(                 -21), INT64_C(                 -16)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  481.32), SIMDE_FLOAT64_C(  391.29),
+                         SIMDE_FLOAT64_C(  748.56), SIMDE_FLOAT64_C(  620.30)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_i64gather_pd(&(table[32]), test_vec[i].vindex, 8);
+    simde_assert_m256d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_i64gather_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  static const simde_float64 table[64] = {
+    SIMDE_FLOAT64_C(   121.63), SIMDE_FLOAT64_C(   640.79), SIMDE_FLOAT64_C(   945.82), SIMDE_FLOAT64_C(   850.68),
+    SIMDE_FLOAT64_C(  -179.54), SIMDE_FLOAT64_C(  -170.29), SIMDE_FLOAT64_C(   648.48), SIMDE_FLOAT64_C(  -758.85),
+    SIMDE_FLOAT64_C(   853.72), SIMDE_FLOAT64_C(   303.11), SIMDE_FLOAT64_C(  -719.32), SIMDE_FLOAT64_C(  -323.06),
+    SIMDE_FLOAT64_C(  -633.20), SIMDE_FLOAT64_C(  -614.22), SIMDE_FLOAT64_C(   895.34), SIMDE_FLOAT64_C(    97.97),
+    SIMDE_FLOAT64_C(  -978.49), SIMDE_FLOAT64_C(   164.66), SIMDE_FLOAT64_C(  -318.74), SIMDE_FLOAT64_C(  -183.81),
+    SIMDE_FLOAT64_C(   480.68), SIMDE_FLOAT64_C(   384.87), SIMDE_FLOAT64_C(  -575.96), SIMDE_FLOAT64_C(  -403.10),
+    SIMDE_FLOAT64_C(   195.83), SIMDE_FLOAT64_C(  -100.30), SIMDE_FLOAT64_C(   325.34), SIMDE_FLOAT64_C(  -335.43),
+    SIMDE_FLOAT64_C(   191.06), SIMDE_FLOAT64_C(  -891.88), SIMDE_FLOAT64_C(  -497.69), SIMDE_FLOAT64_C(   414.73),
+    SIMDE_FLOAT64_C(  -893.01), SIMDE_FLOAT64_C(  -739.48), SIMDE_FLOAT64_C(     5.85), SIMDE_FLOAT64_C(  -344.02),
+    SIMDE_FLOAT64_C(   896.06), SIMDE_FLOAT64_C(  -541.01), SIMDE_FLOAT64_C(  -480.53), SIMDE_FLOAT64_C(   158.58),
+    SIMDE_FLOAT64_C(   784.10), SIMDE_FLOAT64_C(  -938.95), SIMDE_FLOAT64_C(   421.37), SIMDE_FLOAT64_C(   176.98),
+    SIMDE_FLOAT64_C(  -457.48), SIMDE_FLOAT64_C(  -657.70), SIMDE_FLOAT64_C(   913.80), SIMDE_FLOAT64_C(  -441.56),
+    SIMDE_FLOAT64_C(  -847.30), SIMDE_FLOAT64_C(   846.22), SIMDE_FLOAT64_C(   -53.08), SIMDE_FLOAT64_C(   302.80),
+    SIMDE_FLOAT64_C(    52.67), SIMDE_FLOAT64_C(  -541.55), SIMDE_FLOAT64_C(  -908.47), SIMDE_FLOAT64_C(  -697.23),
+    SIMDE_FLOAT64_C(   315.33), SIMDE_FLOAT64_C(    67.42), SIMDE_FLOAT64_C(   744.14), SIMDE_FLOAT64_C(   711.80),
+    SIMDE_FLOAT64_C(   224.25), SIMDE_FLOAT64_C(  -355.73), SIMDE_FLOAT64_C(  -252.47), SIMDE_FLOAT64_C(  -201.86)
+  };
+
+  const struct {
+    simde__m256d src;
+    simde__m256i vindex;
+    simde__m256d mask;
+    simde__m256d r;
+  } test_vec[8] = {
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C(  332.91), SIMDE_FLOAT64_C(  919.71),
+                         SIMDE_FLOAT64_C( -853.71), SIMDE_FLOAT64_C(   65.29)),
+      simde_mm256_set_epi64x(INT64_C(                 -17), INT64_C(                 -23),
+                             INT64_C(                   1), INT64_C(                   3)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  963.09), SIMDE_FLOAT64_C( -929.40),
+                         SIMDE_FLOAT64_C( -724.77), SIMDE_FLOAT64_C(  519.75)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  332.91), SIMDE_FLOAT64_C(  303.11),
+                         SIMDE_FLOAT64_C( -739.48), SIMDE_FLOAT64_C(   65.29)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C(  561.52), SIMDE_FLOAT64_C(  273.89),
+                         SIMDE_FLOAT64_C( -298.09), SIMDE_FLOAT64_C( -442.27)),
+      simde_mm256_set_epi64x(INT64_C(                  21), INT64_C(                  22),
+                             INT64_C(                  18), INT64_C(                 -18)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -845.90), SIMDE_FLOAT64_C( -768.37),
+                         SIMDE_FLOAT64_C(  400.66), SIMDE_FLOAT64_C(  107.09)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -541.55), SIMDE_FLOAT64_C( -908.47),
+                         SIMDE_FLOAT64_C( -298.09), SIMDE_FLOAT64_C( -442.27)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -233.39), SIMDE_FLOAT64_C(  642.40),
+                         SIMDE_FLOAT64_C( -879.77), SIMDE_FLOAT64_C( -430.08)),
+      simde_mm256_set_epi64x(INT64_C(                  16), INT64_C(                 -22),
+                             INT64_C(                   8), INT64_C(                  14)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -257.10), SIMDE_FLOAT64_C(  -99.52),
+                         SIMDE_FLOAT64_C(  -67.51), SIMDE_FLOAT64_C(  541.88)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -847.30), SIMDE_FLOAT64_C( -719.32),
+                         SIMDE_FLOAT64_C(  784.10), SIMDE_FLOAT64_C( -430.08)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -882.36), SIMDE_FLOAT64_C(   10.83),
+                         SIMDE_FLOAT64_C( -623.87), SIMDE_FLOAT64_C(  786.48)),
+      simde_mm256_set_epi64x(INT64_C(                  16), INT64_C(                  11),
+                             INT64_C(                  17), INT64_C(                  16)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  459.81), SIMDE_FLOAT64_C(  202.34),
+                         SIMDE_FLOAT64_C( -500.42), SIMDE_FLOAT64_C(  633.93)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -882.36), SIMDE_FLOAT64_C(   10.83),
+                         SIMDE_FLOAT64_C(  846.22), SIMDE_FLOAT64_C(  786.48)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -763.50), SIMDE_FLOAT64_C( -379.30),
+                         SIMDE_FLOAT64_C(  274.08), SIMDE_FLOAT64_C( -998.68)),
+      simde_mm256_set_epi64x(INT64_C(                  -1), INT64_C(                   5),
+                             INT64_C(                  27), INT64_C(                  14)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -589.12), SIMDE_FLOAT64_C(  752.33),
+                         SIMDE_FLOAT64_C(  452.54), SIMDE_FLOAT64_C(  426.26)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  414.73), SIMDE_FLOAT64_C( -379.30),
+                         SIMDE_FLOAT64_C(  274.08), SIMDE_FLOAT64_C( -998.68)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -426.71), SIMDE_FLOAT64_C( -965.62),
+                         SIMDE_FLOAT64_C(  914.55), SIMDE_FLOAT64_C( -462.50)),
+      simde_mm256_set_epi64x(INT64_C(                 -19), INT64_C(                   3),
+                             INT64_C(                 -30), INT64_C(                  18)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -817.74), SIMDE_FLOAT64_C(  789.46),
+                         SIMDE_FLOAT64_C( -311.35), SIMDE_FLOAT64_C( -800.15)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -614.22), SIMDE_FLOAT64_C( -965.62),
+                         SIMDE_FLOAT64_C(  945.82), SIMDE_FLOAT64_C(  -53.08)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C( -591.36), SIMDE_FLOAT64_C(  -74.63),
+                         SIMDE_FLOAT64_C( -211.74), SIMDE_FLOAT64_C(   53.53)),
+      simde_mm256_set_epi64x(INT64_C(                  31), INT64_C(                  -1),
+                             INT64_C(                   5), INT64_C(                 -27)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -171.16), SIMDE_FLOAT64_C( -373.98),
+                         SIMDE_FLOAT64_C(  703.81), SIMDE_FLOAT64_C( -767.59)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C( -201.86), SIMDE_FLOAT64_C(  414.73),
+                         SIMDE_FLOAT64_C( -211.74), SIMDE_FLOAT64_C( -170.29)) },
+    { simde_mm256_set_pd(SIMDE_FLOAT64_C(   27.16), SIMDE_FLOAT64_C( -964.28),
+                         SIMDE_FLOAT64_C( -269.97), SIMDE_FLOAT64_C( -646.55)),
+      simde_mm256_set_epi64x(INT64_C(                 -28), INT64_C(                   8),
+                             INT64_C(                  31), INT64_C(                 -29)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(  384.50), SIMDE_FLOAT64_C(  739.69),
+                         SIMDE_FLOAT64_C(  -61.30), SIMDE_FLOAT64_C(  423.97)),
+      simde_mm256_set_pd(SIMDE_FLOAT64_C(   27.16), SIMDE_FLOAT64_C( -964.28),
+                         SIMDE_FLOAT64_C( -201.86), SIMDE_FLOAT64_C( -646.55)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256d r = simde_mm256_mask_i64gather_pd(test_vec[i].src, &(table[32]), test_vec[i].vindex, test_vec[i].mask, 8);
+    simde_assert_m256d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_madd_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C(-22074), INT16_C( 27892), INT16_C(-27402), INT16_C( -5185),
+                            INT16_C(-13617), INT16_C(  6733), INT16_C( 31914), INT16_C( 16627),
+                            INT16_C( 14296), INT16_C(   527), INT16_C(-18797), INT16_C( 25549),
+                            INT16_C( 30759), INT16_C(-12360), INT16_C(  6414), INT16_C( 21507)),
+      simde_mm256_set_epi16(INT16_C( 13087), INT16_C(   552), INT16_C(-32388), INT16_C( 21398),
+                            INT16_C( -2724), INT16_C( 12527), INT16_C(  4881), INT16_C( -1411),
+                            INT16_C(  4971), INT16_C(  -716), INT16_C(-15438), INT16_C( 22737),
+                            INT16_C( 22649), INT16_C( 14157), INT16_C( 16131), INT16_C( 25742)),
+      simde_mm256_set_epi32(INT32_C( -273486054), INT32_C(  776547346), INT32_C(  121436999), INT32_C(  132311537),
+                            INT32_C(   70688084), INT32_C(  871095699), INT32_C(  521680071), INT32_C(  657097428)) },
+    { simde_mm256_set_epi16(INT16_C( 31591), INT16_C( 27463), INT16_C(-11448), INT16_C( 12754),
+                            INT16_C( 23360), INT16_C( 24732), INT16_C( 21501), INT16_C(  9477),
+                            INT16_C(-29628), INT16_C( 15818), INT16_C( 22405), INT16_C(-17463),
+                            INT16_C( -4252), INT16_C(  1744), INT16_C( 29107), INT16_C(  -236)),
+      simde_mm256_set_epi16(INT16_C( 17376), INT16_C(-10713), INT16_C(  2486), INT16_C(  1967),
+                            INT16_C(  3397), INT16_C( 25143), INT16_C( 11210), INT16_C( -8470),
+                            INT16_C( -7431), INT16_C(-24781), INT16_C( 28646), INT16_C(-15461),
+                            INT16_C( -7439), INT16_C(-17272), INT16_C(-12699), INT16_C( 15557)),
+      simde_mm256_set_epi32(INT32_C(  254714097), INT32_C(   -3372610), INT32_C(  701190596), INT32_C(  160756020),
+                            INT32_C( -171820190), INT32_C(  911809073), INT32_C(    1508260), INT32_C( -373301245)) },
+    { simde_mm256_set_epi16(INT16_C(-23018), INT16_C( 27443), INT16_C( -9704), INT16_C(  6815),
+                            INT16_C(-10742), INT16_C(-15199), INT16_C(-25926), INT16_C( 11907),
+                            INT16_C(-11173), INT16_C( -1296), INT16_C(-31401), INT16_C(-11984),
+                            INT16_C( 29153), INT16_C( 26221), INT16_C( 23204), INT16_C( 24693)),
+      simde_mm256_set_epi16(INT16_C( 22883), INT16_C( -1430), INT16_C(-22444), INT16_C( -4173),
+                            INT16_C( -9271), INT16_C(-22344), INT16_C(-19214), INT16_C(-15237),
+                            INT16_C(  8913), INT16_C(-31636), INT16_C(-32308), INT16_C( 15943),
+                            INT16_C(  4837), INT16_C( -6600), INT16_C(-14527), INT16_C(-29993)),
+      simde_mm256_set_epi32(INT32_C( -565964384), INT32_C(  189357581), INT32_C(  439195538), INT32_C(  316715205),
+                            INT32_C(  -58584693), INT32_C(  823442596), INT32_C(  -32045539), INT32_C(-1077701657)) },
+    { simde_mm256_set_epi16(INT16_C( -2513), INT16_C( -1446), INT16_C( 20507), INT16_C(-25668),
+                            INT16_C( 32595), INT16_C(  1090), INT16_C(  8204), INT16_C(  9120),
+                            INT16_C( -8133), INT16_C( 31849), INT16_C(-18457), INT16_C(-12347),
+                            INT16_C( 18795), INT16_C( -8246), INT16_C( 23278), INT16_C(-14987)),
+      simde_mm256_set_epi16(INT16_C( 12529), INT16_C(-11077), INT16_C(  5410), INT16_C(-23993),
+                            INT16_C(-26377), INT16_C( -6112), INT16_C(-21857), INT16_C(  3969),
+                            INT16_C( -2477), INT16_C(-13689), INT16_C( 21824), INT16_C(  -644),
+                            INT16_C( 10631), INT16_C(-12974), INT16_C(-28564), INT16_C( 32352)),
+      simde_mm256_set_epi32(INT32_C(  -15468035), INT32_C(  726795194), INT32_C( -866420395), INT32_C( -143117548),
+                            INT32_C( -415835520), INT32_C( -394854100), INT32_C(  306793249), INT32_C(-1149772216)) },
+    { simde_mm256_set_epi16(INT16_C(  7571), INT16_C( 21562), INT16_C( 24839), INT16_C( 27056),
+                            INT16_C(-18448), INT16_C( 29209), INT16_C(  1880), INT16_C(-21767),
+                            INT16_C( 26198), INT16_C(-31641), INT16_C(  3244), INT16_C(-13098),
+                            INT16_C( -4443), INT16_C(  -521), INT16_C(-27791), INT16_C(-13063)),
+      simde_mm256_set_epi16(INT16_C(-17648), INT16_C(  8337), INT16_C( -3551), INT16_C(-28013),
+                            INT16_C(-17930), INT16_C(   577), INT16_C( 32382), INT16_C( 20122),
+                            INT16_C(-14435), INT16_C(-21581), INT16_C(-32759), INT16_C(  2792),
+                            INT16_C(-24268), INT16_C( 11663), INT16_C( -1946), INT16_C( 19139)),
+      simde_mm256_set_epi32(INT32_C(   46149386), INT32_C( -846123017), INT32_C(  347626233), INT32_C( -377117414),
+                            INT32_C(  304676291), INT32_C( -142839812), INT32_C(  101746301), INT32_C( -195931471)) },
+    { simde_mm256_set_epi16(INT16_C(-11993), INT16_C( -3203), INT16_C( 15681), INT16_C(-18383),
+                            INT16_C( 16847), INT16_C(  2437), INT16_C( -8441), INT16_C( 14338),
+                            INT16_C(  7300), INT16_C(-21082), INT16_C(-17580), INT16_C(  1429),
+                            INT16_C(-32388), INT16_C(-10418), INT16_C(-19218), INT16_C(-31595)),
+      simde_mm256_set_epi16(INT16_C(-24077), INT16_C(-32143), INT16_C( 18864), INT16_C( 11719),
+                            INT16_C( -5555), INT16_C( -6220), INT16_C(-30370), INT16_C( 23594),
+                            INT16_C( 29026), INT16_C( 10950), INT16_C( 31566), INT16_C(-28277),
+                            INT16_C( 28777), INT16_C( 17653), INT16_C(-21542), INT16_C(  7263)),
+      simde_mm256_set_epi32(INT32_C(  391709490), INT32_C(   80376007), INT32_C( -108743225), INT32_C(  594643942),
+                            INT32_C(  -18958100), INT32_C( -595338113), INT32_C(-1115938430), INT32_C(  184519671)) },
+    { simde_mm256_set_epi16(INT16_C(-31708), INT16_C( -6736), INT16_C(-12543), INT16_C(-19831),
+                            INT16_C( -5660), INT16_C(-20189), INT16_C( 31844), INT16_C( 20882),
+                            INT16_C(-22159), INT16_C( -7550), INT16_C(  8622), INT16_C(-20427),
+                            INT16_C(-19784), INT16_C(  4739), INT16_C( -9632), INT16_C(  3416)),
+      simde_mm256_set_epi16(INT16_C( 18684), INT16_C(  4347), INT16_C( 18074), INT16_C(-24539),
+                            INT16_C( 14613), INT16_C(-28009), INT16_C( 18528), INT16_C(-16867),
+                            INT16_C(  1794), INT16_C(-22885), INT16_C( 27546), INT16_C( 25964),
+                            INT16_C( -3488), INT16_C(-31053), INT16_C(  6969), INT16_C(-12364)),
+      simde_mm256_set_epi32(INT32_C( -621713664), INT32_C(  259930727), INT32_C(  482764121), INT32_C(  237788938),
+                            INT32_C(  133028504), INT32_C( -292865016), INT32_C(  -78153575), INT32_C( -109360832)) },
+    { simde_mm256_set_epi16(INT16_C( 32611), INT16_C(-26810), INT16_C( 32585), INT16_C(  6944),
+                            INT16_C( 26033), INT16_C(  2406), INT16_C(-32105), INT16_C(-11091),
+                            INT16_C(-32475), INT16_C(-29532), INT16_C( 13591), INT16_C(-15433),
+                            INT16_C( 29089), INT16_C(-24035), INT16_C( 15832), INT16_C(-10008)),
+      simde_mm256_set_epi16(INT16_C( 16370), INT16_C( -9733), INT16_C( -7456), INT16_C( -2346),
+                            INT16_C( -1285), INT16_C( -5955), INT16_C(-24955), INT16_C( -4486),
+                            INT16_C(  4170), INT16_C(-17666), INT16_C(  7986), INT16_C( 19848),
+                            INT16_C(-13940), INT16_C( 24511), INT16_C( 18142), INT16_C(-26201)),
+      simde_mm256_set_epi32(INT32_C(  794783800), INT32_C( -259244384), INT32_C(  -47780135), INT32_C(  850934501),
+                            INT32_C(  386291562), INT32_C( -197776458), INT32_C( -994622545), INT32_C(  549443752)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_madd_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maddubs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm256_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)) },
+    { simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)) },
+    { simde_mm256_set_epi8(INT8_C(-110), INT8_C(  -5), INT8_C(  45), INT8_C( -49), INT8_C( -56), INT8_C( -82), INT8_C(-102), INT8_C(  25),
+                           INT8_C(  -4), INT8_C(  86), INT8_C(  57), INT8_C( -79), INT8_C( 107), INT8_C( 113), INT8_C(  75), INT8_C(  79),
+                           INT8_C( -93), INT8_C(  46), INT8_C( -38), INT8_C( -65), INT8_C(  85), INT8_C(-123), INT8_C( -67), INT8_C( 117),
+                           INT8_C(  53), INT8_C(  60), INT8_C(  -4), INT8_C(  56), INT8_C( 125), INT8_C(  -6), INT8_C( -26), INT8_C( -72)),
+      simde_mm256_set_epi8(INT8_C(-128), INT8_C( -82), INT8_C(  33), INT8_C(  32), INT8_C(-126), INT8_C( 101), INT8_C( 113), INT8_C( -34),
+                           INT8_C(  15), INT8_C(  26), INT8_C(  80), INT8_C( -43), INT8_C(-100), INT8_C(  10), INT8_C( -94), INT8_C(  26),
+                           INT8_C( -68), INT8_C( -69), INT8_C(-101), INT8_C( 126), INT8_C(-102), INT8_C(  49), INT8_C(-102), INT8_C( -17),
+                           INT8_C(  84), INT8_C(  75), INT8_C(  14), INT8_C( -57), INT8_C( 109), INT8_C(   0), INT8_C(  97), INT8_C( 109)),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(  8109), INT16_C( -7626), INT16_C( 16552), INT16_C(  6016), INT16_C( -3051), INT16_C( -9570), INT16_C( -4996),
+                            INT16_C(-14258), INT16_C(  2048), INT16_C( -2153), INT16_C(-21267), INT16_C(  8952), INT16_C(   336), INT16_C( 13625), INT16_C( 32767)) },
+    { simde_mm256_set_epi8(INT8_C( 109), INT8_C(   8), INT8_C(  68), INT8_C( -62), INT8_C( 105), INT8_C( -25), INT8_C( 105), INT8_C(  63),
+                           INT8_C( -36), INT8_C(-122), INT8_C( -77), INT8_C( -45), INT8_C( -51), INT8_C( -67), INT8_C( -10), INT8_C(  19),
+                           INT8_C(  13), INT8_C(   9), INT8_C(-127), INT8_C( -24), INT8_C( -63), INT8_C(  -6), INT8_C( 123), INT8_C( -28),
+                           INT8_C(  14), INT8_C(  30), INT8_C( -51), INT8_C(   2), INT8_C( -19), INT8_C( 124), INT8_C(  12), INT8_C( -67)),
+      simde_mm256_set_epi8(INT8_C( -52), INT8_C( -72), INT8_C( 112), INT8_C(  33), INT8_C(  52), INT8_C(-104), INT8_C(  -9), INT8_C( -11),
+                           INT8_C( 108), INT8_C( 113), INT8_C( 110), INT8_C(  30), INT8_C( 108), INT8_C( -19), INT8_C(-127), INT8_C(  55),
+                           INT8_C(  91), INT8_C(-110), INT8_C(-114), INT8_C(  44), INT8_C(-104), INT8_C( 125), INT8_C(-123), INT8_C( 125),
+                           INT8_C(  54), INT8_C(-127), INT8_C( -38), INT8_C( 127), INT8_C( 105), INT8_C(-109), INT8_C(   8), INT8_C(  45)),
+      simde_mm256_set_epi16(INT16_C( -6244), INT16_C( 14018), INT16_C(-18564), INT16_C( -1638), INT16_C( 32767), INT16_C( 26020), INT16_C( 18549), INT16_C(-30197),
+                            INT16_C(   193), INT16_C( -4498), INT16_C( 11178), INT16_C( 13371), INT16_C( -3054), INT16_C( -7536), INT16_C( 11369), INT16_C(  8601)) },
+    { simde_mm256_set_epi8(INT8_C(  53), INT8_C( -13), INT8_C(   5), INT8_C( -80), INT8_C( -64), INT8_C(  -4), INT8_C(-110), INT8_C(  82),
+                           INT8_C( -57), INT8_C(  43), INT8_C(  76), INT8_C(  54), INT8_C( -48), INT8_C( -37), INT8_C( 127), INT8_C( -19),
+                           INT8_C( -80), INT8_C( -70), INT8_C(-111), INT8_C( -28), INT8_C( 127), INT8_C(  98), INT8_C(   0), INT8_C( -20),
+                           INT8_C( -97), INT8_C(   7), INT8_C( -78), INT8_C( 122), INT8_C( 120), INT8_C(-122), INT8_C(-101), INT8_C(  90)),
+      simde_mm256_set_epi8(INT8_C( -65), INT8_C( -53), INT8_C(  -1), INT8_C(  -1), INT8_C(  12), INT8_C( -68), INT8_C( -65), INT8_C(  32),
+                           INT8_C(  89), INT8_C( -90), INT8_C(-101), INT8_C( -95), INT8_C(  38), INT8_C( -51), INT8_C(  41), INT8_C( -77),
+                           INT8_C(-114), INT8_C(  57), INT8_C( -72), INT8_C(  29), INT8_C( -25), INT8_C(  27), INT8_C( 125), INT8_C(   9),
+                           INT8_C( 122), INT8_C( -57), INT8_C(-113), INT8_C( -77), INT8_C( 115), INT8_C(  -1), INT8_C( -65), INT8_C( -10)),
+      simde_mm256_set_epi16(INT16_C(-16324), INT16_C(  -181), INT16_C(-14832), INT16_C( -6866), INT16_C( 13841), INT16_C(-12806), INT16_C( -3265), INT16_C(-13042),
+                            INT16_C( -9462), INT16_C( -3828), INT16_C(  -529), INT16_C(  2124), INT16_C( 18999), INT16_C(-29508), INT16_C( 13666), INT16_C(-10975)) },
+    { simde_mm256_set_epi8(INT8_C(  23), INT8_C( -88), INT8_C( -20), INT8_C(-120), INT8_C( -32), INT8_C( -38), INT8_C(  11), INT8_C( -84),
+                           INT8_C(  50), INT8_C( -71), INT8_C(  17), INT8_C(  73), INT8_C(-108), INT8_C(  23), INT8_C( -86), INT8_C( -71),
+                           INT8_C(  87), INT8_C(  42), INT8_C(  21), INT8_C( -19), INT8_C(  72), INT8_C( -77), INT8_C(  -3), INT8_C( -62),
+                           INT8_C(  45), INT8_C(  28), INT8_C( -30), INT8_C(-120), INT8_C(  86), INT8_C( -46), INT8_C(  14), INT8_C(  94)),
+      simde_mm256_set_epi8(INT8_C( -25), INT8_C(  26), INT8_C( 117), INT8_C( 103), INT8_C( -19), INT8_C( -72), INT8_C( -58), INT8_C( 117),
+                           INT8_C( 111), INT8_C(  15), INT8_C(  52), INT8_C(  20), INT8_C( -60), INT8_C( 124), INT8_C(-100), INT8_C(  13),
+                           INT8_C( -68), INT8_C(  58), INT8_C(  91), INT8_C(  65), INT8_C(-102), INT8_C(  67), INT8_C( -81), INT8_C( -46),
+                           INT8_C(  12), INT8_C( -56), INT8_C(-114), INT8_C( -85), INT8_C(  47), INT8_C(-102), INT8_C( -44), INT8_C( -69)),
+      simde_mm256_set_epi16(INT16_C(  3793), INT16_C( 32767), INT16_C(-19952), INT16_C( 19486), INT16_C(  8325), INT16_C(  2344), INT16_C( -6028), INT16_C(-14595),
+                            INT16_C( -3480), INT16_C( 17316), INT16_C(  4649), INT16_C(-29417), INT16_C( -1028), INT16_C(-32768), INT16_C(-17378), INT16_C( -7102)) },
+    { simde_mm256_set_epi8(INT8_C(  78), INT8_C(  -6), INT8_C(  88), INT8_C(  46), INT8_C( -32), INT8_C(  41), INT8_C( -33), INT8_C( -39),
+                           INT8_C(  87), INT8_C(-114), INT8_C( -78), INT8_C(  46), INT8_C(  30), INT8_C( -91), INT8_C( -93), INT8_C(  95),
+                           INT8_C( -29), INT8_C( 117), INT8_C(-125), INT8_C( 125), INT8_C( -88), INT8_C(  64), INT8_C( -39), INT8_C( -20),
+                           INT8_C(  99), INT8_C( 103), INT8_C(  76), INT8_C(  -8), INT8_C(  65), INT8_C( -18), INT8_C(-118), INT8_C( -71)),
+      simde_mm256_set_epi8(INT8_C(  70), INT8_C(  33), INT8_C( 127), INT8_C(  16), INT8_C(  78), INT8_C( -77), INT8_C(   0), INT8_C(  38),
+                           INT8_C( -72), INT8_C(   9), INT8_C( -41), INT8_C(-114), INT8_C(  42), INT8_C(  47), INT8_C(-101), INT8_C(  16),
+                           INT8_C(  46), INT8_C(  58), INT8_C(  78), INT8_C( -13), INT8_C(  73), INT8_C( 111), INT8_C(  65), INT8_C(  18),
+                           INT8_C( -13), INT8_C( -77), INT8_C(  99), INT8_C( -23), INT8_C(  56), INT8_C(  41), INT8_C(  90), INT8_C(  38)),
+      simde_mm256_set_epi16(INT16_C( 13710), INT16_C( 11912), INT16_C( 14315), INT16_C(  8246), INT16_C( -4986), INT16_C(-12542), INT16_C(  9015), INT16_C(-14943),
+                            INT16_C( 17228), INT16_C(  8593), INT16_C( 19368), INT16_C( 18353), INT16_C( -9218), INT16_C(  1820), INT16_C( 13398), INT16_C( 19450)) },
+    { simde_mm256_set_epi8(INT8_C( -19), INT8_C(  10), INT8_C(   0), INT8_C( -21), INT8_C(  48), INT8_C(  43), INT8_C(  82), INT8_C( -58),
+                           INT8_C( -65), INT8_C( -48), INT8_C(  39), INT8_C(  59), INT8_C(  16), INT8_C( -90), INT8_C( -44), INT8_C( -81),
+                           INT8_C(  74), INT8_C(  58), INT8_C( -30), INT8_C(-101), INT8_C(  42), INT8_C( -16), INT8_C( -53), INT8_C( 121),
+                           INT8_C(-119), INT8_C(  71), INT8_C( -75), INT8_C(  -2), INT8_C(  -3), INT8_C( -90), INT8_C( -81), INT8_C( -90)),
+      simde_mm256_set_epi8(INT8_C(  69), INT8_C(-102), INT8_C( -26), INT8_C( -40), INT8_C(  46), INT8_C( -16), INT8_C( -69), INT8_C(  69),
+                           INT8_C(-112), INT8_C(  75), INT8_C( -62), INT8_C( -35), INT8_C( -96), INT8_C( -21), INT8_C( -55), INT8_C(  23),
+                           INT8_C(  91), INT8_C( -20), INT8_C(  37), INT8_C( -87), INT8_C(-122), INT8_C( -86), INT8_C( 111), INT8_C( -56),
+                           INT8_C(  60), INT8_C(  10), INT8_C(  69), INT8_C( -83), INT8_C( 109), INT8_C(   1), INT8_C( 117), INT8_C( -29)),
+      simde_mm256_set_epi16(INT16_C( 15333), INT16_C( -9400), INT16_C(  1520), INT16_C(  8004), INT16_C( -5792), INT16_C( -4483), INT16_C( -5022), INT16_C( -7635),
+                            INT16_C(  5574), INT16_C( -5123), INT16_C(-25764), INT16_C( 15757), INT16_C(  8930), INT16_C( -8593), INT16_C( 27743), INT16_C( 15661)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_maddubs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_max_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(INT8_C(  82), INT8_C(  80), INT8_C( 100), INT8_C(-114),
+                           INT8_C(-121), INT8_C(-115), INT8_C( -33), INT8_C( -36),
+                           INT8_C(-105), INT8_C( -52), INT8_C(  94), INT8_C(  97),
+                           INT8_C( -84), INT8_C( 116), INT8_C( 107), INT8_C( -76),
+                           INT8_C(   5), INT8_C(  53), INT8_C( 122), INT8_C(-101),
+                           INT8_C(  32), INT8_C(-122), INT8_C( -66), INT8_C( -61),
+                           INT8_C( -25), INT8_C(  -2), INT8_C(  14), INT8_C( -94),
+                           INT8_C(  18), INT8_C( -35), INT8_C(-102), INT8_C(  57)),
+      simde_mm256_set_epi8(INT8_C(  46), INT8_C( -89), INT8_C(  83), INT8_C( 115),
+                           INT8_C( 114), INT8_C(  48), INT8_C(   9), INT8_C(   1),
+                           INT8_C(  54), INT8_C( -93), INT8_C( 118), INT8_C( -84),
+                           INT8_C(  50), INT8_C( -43), INT8_C(-125), INT8_C( -87),
+                           INT8_C(  48), INT8_C(  67), INT8_C(  65), INT8_C( 103),
+                           INT8_C( 105), INT8_C( -97), INT8_C( -54), INT8_C(  17),
+                           INT8_C( -90), INT8_C( -86), INT8_C( 116), INT8_C( 127),
+                           INT8_C(  77), INT8_C(  -5), INT8_C(  31), INT8_C(  24)),
+      simde_mm256_set_epi8(INT8_C(  82), INT8_C(  80), INT8_C( 100), INT8_C( 115),
+                           INT8_C( 114), INT8_C(  48), INT8_C(   9), INT8_C(   1),
+                           INT8_C(  54), INT8_C( -52), INT8_C( 118), INT8_C(  97),
+                           INT8_C(  50), INT8_C( 116), INT8_C( 107), INT8_C( -76),
+                           INT8_C(  48), INT8_C(  67), INT8_C( 122), INT8_C( 103),
+                           INT8_C( 105), INT8_C( -97), INT8_C( -54), INT8_C(  17),
+                           INT8_C( -25), INT8_C(  -2), INT8_C( 116), INT8_C( 127),
+                           INT8_C(  77), INT8_C(  -5), INT8_C(  31), INT8_C(  57)) },
+    { simde_mm256_set_epi8(INT8_C( 104), INT8_C( 106), INT8_C(-125), INT8_C(  -4),
+                           INT8_C( -59), INT8_C(  95), INT8_C( -56), INT8_C(  31),
+                           INT8_C( 108), INT8_C(   5), INT8_C( 101), INT8_C(  27),
+                           INT8_C( -64), INT8_C(  57), INT8_C(-101), INT8_C( -55),
+                           INT8_C(  77), INT8_C( 118), INT8_C(  99), INT8_C(  21),
+                           INT8_C(  95), INT8_C(  17), INT8_C(  54), INT8_C( -21),
+                           INT8_C(  92), INT8_C( -54), INT8_C(  78), INT8_C(  40),
+                           INT8_C( 102), INT8_C(-101), INT8_C(   0), INT8_C( 127)),
+      simde_mm256_set_epi8(INT8_C( -59), INT8_C( 102), INT8_C(  95), INT8_C( -82),
+                           INT8_C( -77), INT8_C( -39), INT8_C( -88), INT8_C( -22),
+                           INT8_C(  54), INT8_C(  84), INT8_C( -33), INT8_C(  49),
+                           INT8_C(  63), INT8_C(  99), INT8_C(  64), INT8_C(-122),
+                           INT8_C( 102), INT8_C(  28), INT8_C(  90), INT8_C(  72),
+                           INT8_C(  24), INT8_C(  50), INT8_C(  78), INT8_C( -15),
+                           INT8_C( -20), INT8_C( -56), INT8_C(  73), INT8_C(  48),
+                           INT8_C( -27), INT8_C(   7), INT8_C( -15), INT8_C(-109)),
+      simde_mm256_set_epi8(INT8_C( 104), INT8_C( 106), INT8_C(  95), INT8_C(  -4),
+                           INT8_C( -59), INT8_C(  95), INT8_C( -56), INT8_C(  31),
+                           INT8_C( 108), INT8_C(  84), INT8_C( 101), INT8_C(  49),
+                           INT8_C(  63), INT8_C(  99), INT8_C(  64), INT8_C( -55),
+                           INT8_C( 102), INT8_C( 118), INT8_C(  99), INT8_C(  72),
+                           INT8_C(  95), INT8_C(  50), INT8_C(  78), INT8_C( -15),
+                           INT8_C(  92), INT8_C( -54), INT8_C(  78), INT8_C(  48),
+                           INT8_C( 102), INT8_C(   7), INT8_C(   0), INT8_C( 127)) },
+    { simde_mm256_set_epi8(INT8_C(  65), INT8_C(  23), INT8_C(  64), INT8_C( -32),
+                           INT8_C( -17), INT8_C(  98), INT8_C( -25), INT8_C( 100),
+                           INT8_C(-100), INT8_C( -55), INT8_C( -13), INT8_C( 105),
+                           INT8_C(   8), INT8_C(  62), INT8_C(-102), INT8_C(  30),
+                           INT8_C(  -9), INT8_C(  71), INT8_C( -37), INT8_C( -11),
+                           INT8_C( -97), INT8_C(  54), INT8_C( -23), INT8_C( 103),
+                           INT8_C(  11), INT8_C( -76), INT8_C(  47), INT8_C(  45),
+                           INT8_C( -29), INT8_C( -83), INT8_C( -52), INT8_C(  82)),
+      simde_mm256_set_epi8(INT8_C(  -2), INT8_C( -84), INT8_C( -69), INT8_C( -58),
+                           INT8_C(-128), INT8_C(  76), INT8_C( 110), INT8_C( -99),
+                           INT8_C(  46), INT8_C(   8), INT8_C( -50), INT8_C(  -2),
+                           INT8_C( 114), INT8_C(  31), INT8_C( -27), INT8_C( -16),
+                           INT8_C(  63), INT8_C( -83), INT8_C(-114), INT8_C( 116),
+                           INT8_C(  14), INT8_C( -31), INT8_C(   3), INT8_C(-105),
+                           INT8_C( -84), INT8_C( -19), INT8_C(  81), INT8_C(  57),
+                           INT8_C( -55), INT8_C( -67), INT8_C( -89), INT8_C(  74)),
+      simde_mm256_set_epi8(INT8_C(  65), INT8_C(  23), INT8_C(  64), INT8_C( -32),
+                           INT8_C( -17), INT8_C(  98), INT8_C( 110), INT8_C( 100),
+                           INT8_C(  46), INT8_C(   8), INT8_C( -13), INT8_C( 105),
+                           INT8_C( 114), INT8_C(  62), INT8_C( -27), INT8_C(  30),
+                           INT8_C(  63), INT8_C(  71), INT8_C( -37), INT8_C( 116),
+                           INT8_C(  14), INT8_C(  54), INT8_C(   3), INT8_C( 103),
+                           INT8_C(  11), INT8_C( -19), INT8_C(  81), INT8_C(  57),
+                           INT8_C( -29), INT8_C( -67), INT8_C( -52), INT8_C(  82)) },
+    { simde_mm256_set_epi8(INT8_C(   3), INT8_C( -48), INT8_C( -19), INT8_C( 101),
+                           INT8_C(  -3), INT8_C( -85), INT8_C(-102), INT8_C(  26),
+                           INT8_C(  89), INT8_C( -95), INT8_C(  51), INT8_C(  -5),
+                           INT8_C(  13), INT8_C(  30), INT8_C( -92), INT8_C( -13),
+                           INT8_C(  68), INT8_C(  71), INT8_C(-127), INT8_C( -65),
+                           INT8_C(-102), INT8_C(  -1), INT8_C(  48), INT8_C(  30),
+                           INT8_C(  43), INT8_C(  71), INT8_C(  53), INT8_C(  78),
+                           INT8_C(  81), INT8_C( 119), INT8_C( -32), INT8_C(  18)),
+      simde_mm256_set_epi8(INT8_C( -81), INT8_C( -54), INT8_C( -70), INT8_C( 102),
+                           INT8_C(  86), INT8_C( 106), INT8_C(  99), INT8_C(  -7),
+                           INT8_C( -74), INT8_C( -52), INT8_C(-121), INT8_C(-127),
+                           INT8_C(  49), INT8_C(-119), INT8_C(  52), INT8_C( 119),
+                           INT8_C( 123), INT8_C(-104), INT8_C(  44), INT8_C( -14),
+                           INT8_C(  56), INT8_C( -83), INT8_C(  21), INT8_C( 108),
+                           INT8_C( -43), INT8_C(  75), INT8_C(  75), INT8_C(  51),
+                           INT8_C(  54), INT8_C( -18), INT8_C( 100), INT8_C(  49)),
+      simde_mm256_set_epi8(INT8_C(   3), INT8_C( -48), INT8_C( -19), INT8_C( 102),
+                           INT8_C(  86), INT8_C( 106), INT8_C(  99), INT8_C(  26),
+                           INT8_C(  89), INT8_C( -52), INT8_C(  51), INT8_C(  -5),
+                           INT8_C(  49), INT8_C(  30), INT8_C(  52), INT8_C( 119),
+                           INT8_C( 123), INT8_C(  71), INT8_C(  44), INT8_C( -14),
+                           INT8_C(  56), INT8_C(  -1), INT8_C(  48), INT8_C( 108),
+                           INT8_C(  43), INT8_C(  75), INT8_C(  75), INT8_C(  78),
+                           INT8_C(  81), INT8_C( 119), INT8_C( 100), INT8_C(  49)) },
+    { simde_mm256_set_epi8(INT8_C( -92), INT8_C(  89), INT8_C(  61), INT8_C( 117),
+                           INT8_C( -42), INT8_C(  29), INT8_C( -36), INT8_C(  67),
+                           INT8_C(-107), INT8_C(  95), INT8_C(-103), INT8_C( -42),
+                           INT8_C( -63), INT8_C(  54), INT8_C(  53), INT8_C( -40),
+                           INT8_C( -66), INT8_C( -31), INT8_C( -91), INT8_C(  82),
+                           INT8_C( 110), INT8_C( -33), INT8_C(  21), INT8_C(  38),
+                           INT8_C( -69), INT8_C(  34), INT8_C( -74), INT8_C(  24),
+                           INT8_C( -26), INT8_C(-124), INT8_C( -81), INT8_C(  36)),
+      simde_mm256_set_epi8(INT8_C(-105), INT8_C(  55), INT8_C(-117), INT8_C(  72),
+                           INT8_C( -82), INT8_C( -42), INT8_C( 100), INT8_C( -21),
+                           INT8_C(  19), INT8_C( 104), INT8_C(  11), INT8_C(  52),
+                           INT8_C(  30), INT8_C(   8), INT8_C(  70), INT8_C( -51),
+                           INT8_C( -61), INT8_C( -91), INT8_C( 126), INT8_C( -28),
+                           INT8_C( -34), INT8_C( 102), INT8_C(  69), INT8_C(  99),
+                           INT8_C(  81), INT8_C(  11), INT8_C( -51), INT8_C(   2),
+                           INT8_C(  60), INT8_C( -70), INT8_C(  92), INT8_C( -37)),
+      simde_mm256_set_epi8(INT8_C( -92), INT8_C(  89), INT8_C(  61), INT8_C( 117),
+                           INT8_C( -42), INT8_C(  29), INT8_C( 100), INT8_C(  67),
+                           INT8_C(  19), INT8_C( 104), INT8_C(  11), INT8_C(  52),
+                           INT8_C(  30), INT8_C(  54), INT8_C(  70), INT8_C( -40),
+                           INT8_C( -61), INT8_C( -31), INT8_C( 126), INT8_C(  82),
+                           INT8_C( 110), INT8_C( 102), INT8_C(  69), INT8_C(  99),
+                           INT8_C(  81), INT8_C(  34), INT8_C( -51), INT8_C(  24),
+                           INT8_C(  60), INT8_C( -70), INT8_C(  92), INT8_C(  36)) },
     { simde_mm256_set_epi8(INT8_C(-123), INT8_C( 126), INT8_C(  24), INT8_C(  94),
                            INT8_C( -42), INT8_C( 118), INT8_C(   5), INT8_C( -41),
                            INT8_C( -65), INT8_C( -51), INT8_C( -68), INT8_C( 107),
@@ -5213,7 +8146,403 @@ test_simde_mm256_max_epi32(const MunitParameter params[], void* data) {
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
-    simde__m256i r = simde_mm256_max_epi32(test_vec[i].a, test_vec[i].b);
+    simde__m256i r = simde_mm256_max_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(INT8_C(  35), INT8_C(-124), INT8_C( -63), INT8_C(  59),
+                           INT8_C(  61), INT8_C( -84), INT8_C( 126), INT8_C( -49),
+                           INT8_C(-120), INT8_C(-125), INT8_C( -16), INT8_C(  22),
+                           INT8_C( 112), INT8_C( -97), INT8_C(-126), INT8_C(  44),
+                           INT8_C(  76), INT8_C(  84), INT8_C( -71), INT8_C( 121),
+                           INT8_C( 121), INT8_C(  33), INT8_C(-104), INT8_C(  82),
+                           INT8_C( -15), INT8_C( -50), INT8_C(  50), INT8_C( 114),
+                           INT8_C(-119), INT8_C( -84), INT8_C(  78), INT8_C(-107)),
+      simde_mm256_set_epi8(INT8_C( -72), INT8_C(  42), INT8_C( -81), INT8_C( -66),
+                           INT8_C( -87), INT8_C(-110), INT8_C(  18), INT8_C(  24),
+                           INT8_C(   0), INT8_C( -41), INT8_C( 123), INT8_C(  -6),
+                           INT8_C(  74), INT8_C(  98), INT8_C(  54), INT8_C(  46),
+                           INT8_C(  14), INT8_C(  86), INT8_C( -79), INT8_C(-126),
+                           INT8_C(  74), INT8_C(  -5), INT8_C( -34), INT8_C(  90),
+                           INT8_C(-115), INT8_C(  -6), INT8_C(  80), INT8_C( -71),
+                           INT8_C( -70), INT8_C( -51), INT8_C( -22), INT8_C( -71)),
+      simde_mm256_set_epi8(INT8_C( -72), INT8_C(-124), INT8_C( -81), INT8_C( -66),
+                           INT8_C( -87), INT8_C(-110), INT8_C(  18), INT8_C( -49),
+                           INT8_C(-120), INT8_C(-125), INT8_C( -16), INT8_C(  -6),
+                           INT8_C(  74), INT8_C( -97), INT8_C(-126), INT8_C(  44),
+                           INT8_C(  14), INT8_C(  84), INT8_C( -79), INT8_C(-126),
+                           INT8_C(  74), INT8_C(  -5), INT8_C(-104), INT8_C(  82),
+                           INT8_C(-115), INT8_C( -50), INT8_C(  50), INT8_C( -71),
+                           INT8_C(-119), INT8_C( -84), INT8_C( -22), INT8_C(-107)) },
+    { simde_mm256_set_epi8(INT8_C(-117), INT8_C( 105), INT8_C(  73), INT8_C(-122),
+                           INT8_C(-113), INT8_C( -20), INT8_C( -37), INT8_C( 105),
+                           INT8_C( -62), INT8_C(-111), INT8_C(  51), INT8_C(  85),
+                           INT8_C(  17), INT8_C(   7), INT8_C( -40), INT8_C(  92),
+                           INT8_C( 110), INT8_C( -17), INT8_C( -10), INT8_C(  74),
+                           INT8_C(  92), INT8_C( -39), INT8_C( -76), INT8_C(-127),
+                           INT8_C(  73), INT8_C(  71), INT8_C(-100), INT8_C( -29),
+                           INT8_C(  39), INT8_C(  53), INT8_C( -42), INT8_C( -43)),
+      simde_mm256_set_epi8(INT8_C(  48), INT8_C(  80), INT8_C(   2), INT8_C( 114),
+                           INT8_C(  78), INT8_C(  58), INT8_C( -41), INT8_C(-122),
+                           INT8_C( -39), INT8_C( -10), INT8_C(  66), INT8_C( -85),
+                           INT8_C(  75), INT8_C(  51), INT8_C( -10), INT8_C(  80),
+                           INT8_C(  30), INT8_C( -23), INT8_C( -24), INT8_C( -69),
+                           INT8_C( -92), INT8_C(-101), INT8_C(  81), INT8_C(  19),
+                           INT8_C( -60), INT8_C( -43), INT8_C(  95), INT8_C( 101),
+                           INT8_C(-116), INT8_C(  46), INT8_C(-115), INT8_C( -72)),
+      simde_mm256_set_epi8(INT8_C(-117), INT8_C(  80), INT8_C(   2), INT8_C(-122),
+                           INT8_C(-113), INT8_C( -20), INT8_C( -41), INT8_C(-122),
+                           INT8_C( -62), INT8_C(-111), INT8_C(  51), INT8_C( -85),
+                           INT8_C(  17), INT8_C(   7), INT8_C( -40), INT8_C(  80),
+                           INT8_C(  30), INT8_C( -23), INT8_C( -24), INT8_C( -69),
+                           INT8_C( -92), INT8_C(-101), INT8_C( -76), INT8_C(-127),
+                           INT8_C( -60), INT8_C( -43), INT8_C(-100), INT8_C( -29),
+                           INT8_C(-116), INT8_C(  46), INT8_C(-115), INT8_C( -72)) },
+    { simde_mm256_set_epi8(INT8_C(  56), INT8_C( -55), INT8_C( -42), INT8_C(  12),
+                           INT8_C(-119), INT8_C( -48), INT8_C(  66), INT8_C(  58),
+                           INT8_C( 116), INT8_C(  20), INT8_C(  92), INT8_C( -39),
+                           INT8_C(  85), INT8_C(-116), INT8_C(  64), INT8_C(  22),
+                           INT8_C(  60), INT8_C(  96), INT8_C( -29), INT8_C(  43),
+                           INT8_C( 111), INT8_C( -58), INT8_C( -77), INT8_C(  89),
+                           INT8_C(  99), INT8_C( -74), INT8_C( -97), INT8_C( 127),
+                           INT8_C(  83), INT8_C(  73), INT8_C(   7), INT8_C( -18)),
+      simde_mm256_set_epi8(INT8_C(   0), INT8_C( 110), INT8_C(  72), INT8_C( -63),
+                           INT8_C( -50), INT8_C( -11), INT8_C( -38), INT8_C( -35),
+                           INT8_C(  39), INT8_C( -60), INT8_C(  14), INT8_C(   6),
+                           INT8_C(-115), INT8_C( 109), INT8_C( -30), INT8_C( -37),
+                           INT8_C(  57), INT8_C( 109), INT8_C( -26), INT8_C(  12),
+                           INT8_C( 120), INT8_C(  68), INT8_C(   8), INT8_C( -27),
+                           INT8_C(  15), INT8_C(-106), INT8_C(   4), INT8_C(   4),
+                           INT8_C(  64), INT8_C( 100), INT8_C( 104), INT8_C( 118)),
+      simde_mm256_set_epi8(INT8_C(   0), INT8_C( -55), INT8_C( -42), INT8_C( -63),
+                           INT8_C(-119), INT8_C( -48), INT8_C( -38), INT8_C( -35),
+                           INT8_C(  39), INT8_C( -60), INT8_C(  14), INT8_C( -39),
+                           INT8_C(-115), INT8_C(-116), INT8_C( -30), INT8_C( -37),
+                           INT8_C(  57), INT8_C(  96), INT8_C( -29), INT8_C(  12),
+                           INT8_C( 111), INT8_C( -58), INT8_C( -77), INT8_C( -27),
+                           INT8_C(  15), INT8_C(-106), INT8_C( -97), INT8_C(   4),
+                           INT8_C(  64), INT8_C(  73), INT8_C(   7), INT8_C( -18)) },
+    { simde_mm256_set_epi8(INT8_C(  85), INT8_C(  45), INT8_C( -10), INT8_C( -41),
+                           INT8_C(  15), INT8_C(  37), INT8_C( -52), INT8_C(   4),
+                           INT8_C(  14), INT8_C(-123), INT8_C( -40), INT8_C(  66),
+                           INT8_C(  -7), INT8_C(  27), INT8_C(  55), INT8_C(-128),
+                           INT8_C(-123), INT8_C( -50), INT8_C( 116), INT8_C(  82),
+                           INT8_C(  84), INT8_C( -33), INT8_C( -74), INT8_C(  46),
+                           INT8_C(  62), INT8_C(-123), INT8_C( -84), INT8_C(-121),
+                           INT8_C( 119), INT8_C(  33), INT8_C( 115), INT8_C( -68)),
+      simde_mm256_set_epi8(INT8_C( -11), INT8_C(  63), INT8_C( 115), INT8_C( -64),
+                           INT8_C( 106), INT8_C(  84), INT8_C( -83), INT8_C( 117),
+                           INT8_C(  17), INT8_C( -38), INT8_C(   2), INT8_C(  58),
+                           INT8_C(  12), INT8_C( -19), INT8_C( -10), INT8_C(  38),
+                           INT8_C(-123), INT8_C( -80), INT8_C(  62), INT8_C(  90),
+                           INT8_C( 104), INT8_C(  60), INT8_C(  76), INT8_C( -59),
+                           INT8_C(  93), INT8_C( -72), INT8_C( 118), INT8_C( 122),
+                           INT8_C(  42), INT8_C(-103), INT8_C( -14), INT8_C( -33)),
+      simde_mm256_set_epi8(INT8_C( -11), INT8_C(  45), INT8_C( -10), INT8_C( -64),
+                           INT8_C(  15), INT8_C(  37), INT8_C( -83), INT8_C(   4),
+                           INT8_C(  14), INT8_C(-123), INT8_C( -40), INT8_C(  58),
+                           INT8_C(  -7), INT8_C( -19), INT8_C( -10), INT8_C(-128),
+                           INT8_C(-123), INT8_C( -80), INT8_C(  62), INT8_C(  82),
+                           INT8_C(  84), INT8_C( -33), INT8_C( -74), INT8_C( -59),
+                           INT8_C(  62), INT8_C(-123), INT8_C( -84), INT8_C(-121),
+                           INT8_C(  42), INT8_C(-103), INT8_C( -14), INT8_C( -68)) },
+    { simde_mm256_set_epi8(INT8_C( 101), INT8_C( -16), INT8_C( 122), INT8_C( -37),
+                           INT8_C( -62), INT8_C( -55), INT8_C( -52), INT8_C( -81),
+                           INT8_C( 107), INT8_C( 123), INT8_C(-120), INT8_C( 118),
+                           INT8_C( -63), INT8_C( -62), INT8_C( -67), INT8_C( -78),
+                           INT8_C( -37), INT8_C( 107), INT8_C( -44), INT8_C(  60),
+                           INT8_C(-101), INT8_C(  11), INT8_C( -66), INT8_C(  -7),
+                           INT8_C( 111), INT8_C(  45), INT8_C(  83), INT8_C(-112),
+                           INT8_C( -99), INT8_C(  91), INT8_C( -60), INT8_C(  26)),
+      simde_mm256_set_epi8(INT8_C( -74), INT8_C(   0), INT8_C(  98), INT8_C( -47),
+                           INT8_C( -88), INT8_C( 124), INT8_C(   2), INT8_C(  32),
+                           INT8_C(  46), INT8_C( 118), INT8_C( -37), INT8_C(  77),
+                           INT8_C(-128), INT8_C(  44), INT8_C(  -3), INT8_C(  87),
+                           INT8_C( -38), INT8_C(  88), INT8_C(-117), INT8_C( -94),
+                           INT8_C( 118), INT8_C(  28), INT8_C(  10), INT8_C(   4),
+                           INT8_C(   4), INT8_C(  94), INT8_C( -87), INT8_C(  25),
+                           INT8_C(-104), INT8_C( -95), INT8_C( -96), INT8_C( -27)),
+      simde_mm256_set_epi8(INT8_C( -74), INT8_C( -16), INT8_C(  98), INT8_C( -47),
+                           INT8_C( -88), INT8_C( -55), INT8_C( -52), INT8_C( -81),
+                           INT8_C(  46), INT8_C( 118), INT8_C(-120), INT8_C(  77),
+                           INT8_C(-128), INT8_C( -62), INT8_C( -67), INT8_C( -78),
+                           INT8_C( -38), INT8_C(  88), INT8_C(-117), INT8_C( -94),
+                           INT8_C(-101), INT8_C(  11), INT8_C( -66), INT8_C(  -7),
+                           INT8_C(   4), INT8_C(  45), INT8_C( -87), INT8_C(-112),
+                           INT8_C(-104), INT8_C( -95), INT8_C( -96), INT8_C( -27)) },
+    { simde_mm256_set_epi8(INT8_C( -93), INT8_C( 103), INT8_C(-106), INT8_C(  68),
+                           INT8_C(  54), INT8_C( -73), INT8_C(  89), INT8_C( -84),
+                           INT8_C(  60), INT8_C(  56), INT8_C(  80), INT8_C(  32),
+                           INT8_C( -65), INT8_C( 115), INT8_C(  47), INT8_C( -72),
+                           INT8_C( -85), INT8_C(  -4), INT8_C( -49), INT8_C( 115),
+                           INT8_C( -90), INT8_C( 118), INT8_C(   8), INT8_C(  78),
+                           INT8_C(  24), INT8_C( -73), INT8_C( -62), INT8_C( 110),
+                           INT8_C( -63), INT8_C(  63), INT8_C(  75), INT8_C(  57)),
+      simde_mm256_set_epi8(INT8_C(  73), INT8_C(-110), INT8_C(  36), INT8_C( 102),
+                           INT8_C( -95), INT8_C(  53), INT8_C( -20), INT8_C(  88),
+                           INT8_C( 114), INT8_C(  24), INT8_C(-101), INT8_C( 117),
+                           INT8_C(  17), INT8_C( 115), INT8_C( -24), INT8_C(  12),
+                           INT8_C( 112), INT8_C(-123), INT8_C(  99), INT8_C(  19),
+                           INT8_C( -82), INT8_C(-115), INT8_C(  81), INT8_C(   1),
+                           INT8_C(-106), INT8_C(   8), INT8_C(  32), INT8_C(  34),
+                           INT8_C( -39), INT8_C( -36), INT8_C(  70), INT8_C(  78)),
+      simde_mm256_set_epi8(INT8_C( -93), INT8_C(-110), INT8_C(-106), INT8_C(  68),
+                           INT8_C( -95), INT8_C( -73), INT8_C( -20), INT8_C( -84),
+                           INT8_C(  60), INT8_C(  24), INT8_C(-101), INT8_C(  32),
+                           INT8_C( -65), INT8_C( 115), INT8_C( -24), INT8_C( -72),
+                           INT8_C( -85), INT8_C(-123), INT8_C( -49), INT8_C(  19),
+                           INT8_C( -90), INT8_C(-115), INT8_C(   8), INT8_C(   1),
+                           INT8_C(-106), INT8_C( -73), INT8_C( -62), INT8_C(  34),
+                           INT8_C( -63), INT8_C( -36), INT8_C(  70), INT8_C(  57)) },
+    { simde_mm256_set_epi8(INT8_C(   7), INT8_C(  23), INT8_C( -40), INT8_C( -27),
+                           INT8_C(  63), INT8_C(  19), INT8_C( -18), INT8_C( -79),
+                           INT8_C(  69), INT8_C(  93), INT8_C(  23), INT8_C(  11),
+                           INT8_C( 121), INT8_C(-120), INT8_C( -21), INT8_C(  -2),
+                           INT8_C( -29), INT8_C( -70), INT8_C(  92), INT8_C(  22),
+                           INT8_C( -69), INT8_C(  91), INT8_C(  65), INT8_C( 105),
+                           INT8_C(   3), INT8_C( 115), INT8_C( 123), INT8_C(-120),
+                           INT8_C(-107), INT8_C( 115), INT8_C( -10), INT8_C( -43)),
+      simde_mm256_set_epi8(INT8_C( -74), INT8_C(  32), INT8_C(-117), INT8_C(   3),
+                           INT8_C(  59), INT8_C(  -4), INT8_C(  90), INT8_C(  68),
+                           INT8_C( -81), INT8_C( -64), INT8_C(  70), INT8_C(  24),
+                           INT8_C( 108), INT8_C(  28), INT8_C( -69), INT8_C(  25),
+                           INT8_C(-112), INT8_C( -61), INT8_C( -86), INT8_C( -53),
+                           INT8_C( 127), INT8_C(  37), INT8_C( -72), INT8_C(  36),
+                           INT8_C( -83), INT8_C( -62), INT8_C(  42), INT8_C( -49),
+                           INT8_C( -76), INT8_C(  16), INT8_C(  54), INT8_C( -55)),
+      simde_mm256_set_epi8(INT8_C( -74), INT8_C(  23), INT8_C(-117), INT8_C( -27),
+                           INT8_C(  59), INT8_C(  -4), INT8_C( -18), INT8_C( -79),
+                           INT8_C( -81), INT8_C( -64), INT8_C(  23), INT8_C(  11),
+                           INT8_C( 108), INT8_C(-120), INT8_C( -69), INT8_C(  -2),
+                           INT8_C(-112), INT8_C( -70), INT8_C( -86), INT8_C( -53),
+                           INT8_C( -69), INT8_C(  37), INT8_C( -72), INT8_C(  36),
+                           INT8_C( -83), INT8_C( -62), INT8_C(  42), INT8_C(-120),
+                           INT8_C(-107), INT8_C(  16), INT8_C( -10), INT8_C( -55)) },
+    { simde_mm256_set_epi8(INT8_C(-120), INT8_C( -53), INT8_C(  11), INT8_C(-114),
+                           INT8_C( 110), INT8_C(   4), INT8_C( -35), INT8_C( -16),
+                           INT8_C(-103), INT8_C(  27), INT8_C(-114), INT8_C( -85),
+                           INT8_C(  73), INT8_C(  51), INT8_C( -88), INT8_C( 120),
+                           INT8_C( -17), INT8_C( 117), INT8_C(  23), INT8_C(   7),
+                           INT8_C( -46), INT8_C(  64), INT8_C( -55), INT8_C(  27),
+                           INT8_C( -48), INT8_C( -87), INT8_C( -86), INT8_C(  38),
+                           INT8_C(  62), INT8_C(  22), INT8_C(  20), INT8_C( -73)),
+      simde_mm256_set_epi8(INT8_C(-111), INT8_C(-124), INT8_C( 112), INT8_C( 102),
+                           INT8_C( -11), INT8_C(  35), INT8_C(  83), INT8_C( -40),
+                           INT8_C( 120), INT8_C( 126), INT8_C(  72), INT8_C(  72),
+                           INT8_C( -89), INT8_C( 103), INT8_C(-112), INT8_C( 124),
+                           INT8_C(  48), INT8_C( -59), INT8_C(  25), INT8_C( 113),
+                           INT8_C( -58), INT8_C( -55), INT8_C(-112), INT8_C(  38),
+                           INT8_C( 122), INT8_C( 118), INT8_C(-115), INT8_C(  -8),
+                           INT8_C(  82), INT8_C( -33), INT8_C(-122), INT8_C( -91)),
+      simde_mm256_set_epi8(INT8_C(-120), INT8_C(-124), INT8_C(  11), INT8_C(-114),
+                           INT8_C( -11), INT8_C(   4), INT8_C( -35), INT8_C( -40),
+                           INT8_C(-103), INT8_C(  27), INT8_C(-114), INT8_C( -85),
+                           INT8_C( -89), INT8_C(  51), INT8_C(-112), INT8_C( 120),
+                           INT8_C( -17), INT8_C( -59), INT8_C(  23), INT8_C(   7),
+                           INT8_C( -58), INT8_C( -55), INT8_C(-112), INT8_C(  27),
+                           INT8_C( -48), INT8_C( -87), INT8_C(-115), INT8_C(  -8),
+                           INT8_C(  62), INT8_C( -33), INT8_C(-122), INT8_C( -91)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C(-14561), INT16_C( -2891), INT16_C(-14216), INT16_C( 24176),
+                            INT16_C(-20187), INT16_C(  4508), INT16_C(-10814), INT16_C( 31951),
+                            INT16_C(-23821), INT16_C( 20904), INT16_C( -5728), INT16_C( 29292),
+                            INT16_C(-16635), INT16_C(-31636), INT16_C(  2684), INT16_C( -8447)),
+      simde_mm256_set_epi16(INT16_C( 14844), INT16_C( -2793), INT16_C( 31025), INT16_C(-24528),
+                            INT16_C(  4730), INT16_C( 20201), INT16_C(-24915), INT16_C(-19761),
+                            INT16_C(-28003), INT16_C(-25983), INT16_C( 28939), INT16_C(   384),
+                            INT16_C( 17041), INT16_C( -9021), INT16_C(-12099), INT16_C(-20376)),
+      simde_mm256_set_epi16(INT16_C(-14561), INT16_C( -2891), INT16_C(-14216), INT16_C(-24528),
+                            INT16_C(-20187), INT16_C(  4508), INT16_C(-24915), INT16_C(-19761),
+                            INT16_C(-28003), INT16_C(-25983), INT16_C( -5728), INT16_C(   384),
+                            INT16_C(-16635), INT16_C(-31636), INT16_C(-12099), INT16_C(-20376)) },
+    { simde_mm256_set_epi16(INT16_C( 27530), INT16_C(-19016), INT16_C(   239), INT16_C( -3982),
+                            INT16_C(-19703), INT16_C(  4877), INT16_C(-13059), INT16_C(  4026),
+                            INT16_C(     0), INT16_C( 17468), INT16_C(-16083), INT16_C( 17773),
+                            INT16_C( -8676), INT16_C(-26857), INT16_C(-19759), INT16_C(-23841)),
+      simde_mm256_set_epi16(INT16_C( 10409), INT16_C( -8640), INT16_C(-18044), INT16_C( -6772),
+                            INT16_C( 28234), INT16_C(  9875), INT16_C( 18398), INT16_C( 24598),
+                            INT16_C( 30857), INT16_C( 24460), INT16_C(-19095), INT16_C(-22363),
+                            INT16_C( 29088), INT16_C( 24239), INT16_C( 21396), INT16_C( 16547)),
+      simde_mm256_set_epi16(INT16_C( 10409), INT16_C(-19016), INT16_C(-18044), INT16_C( -6772),
+                            INT16_C(-19703), INT16_C(  4877), INT16_C(-13059), INT16_C(  4026),
+                            INT16_C(     0), INT16_C( 17468), INT16_C(-19095), INT16_C(-22363),
+                            INT16_C( -8676), INT16_C(-26857), INT16_C(-19759), INT16_C(-23841)) },
+    { simde_mm256_set_epi16(INT16_C( 11475), INT16_C(-26959), INT16_C(-22940), INT16_C( 13033),
+                            INT16_C( 18816), INT16_C(  6849), INT16_C(  5907), INT16_C(  5977),
+                            INT16_C(-29495), INT16_C( -1835), INT16_C(-30656), INT16_C(  1608),
+                            INT16_C(-23600), INT16_C( 19972), INT16_C(  2231), INT16_C(  5580)),
+      simde_mm256_set_epi16(INT16_C( 20221), INT16_C(  2996), INT16_C( 12951), INT16_C( -7666),
+                            INT16_C( -4704), INT16_C(-14338), INT16_C(-28720), INT16_C(-17063),
+                            INT16_C(-32140), INT16_C( 29774), INT16_C( 23136), INT16_C( 14360),
+                            INT16_C(-10778), INT16_C(-25190), INT16_C(-24269), INT16_C( 29094)),
+      simde_mm256_set_epi16(INT16_C( 11475), INT16_C(-26959), INT16_C(-22940), INT16_C( -7666),
+                            INT16_C( -4704), INT16_C(-14338), INT16_C(-28720), INT16_C(-17063),
+                            INT16_C(-32140), INT16_C( -1835), INT16_C(-30656), INT16_C(  1608),
+                            INT16_C(-23600), INT16_C(-25190), INT16_C(-24269), INT16_C(  5580)) },
+    { simde_mm256_set_epi16(INT16_C(-22570), INT16_C( -1711), INT16_C( 19225), INT16_C(-29112),
+                            INT16_C(  4610), INT16_C( 16462), INT16_C(  5640), INT16_C( -1106),
+                            INT16_C( -6746), INT16_C(  1138), INT16_C( -9913), INT16_C(-32768),
+                            INT16_C(  3590), INT16_C( 19008), INT16_C( 11509), INT16_C( -6560)),
+      simde_mm256_set_epi16(INT16_C(-12945), INT16_C(-15683), INT16_C(-31220), INT16_C(  5253),
+                            INT16_C( -3915), INT16_C( 20908), INT16_C( -5327), INT16_C(  6554),
+                            INT16_C( 13852), INT16_C(-23225), INT16_C( 26022), INT16_C( 26307),
+                            INT16_C( 23417), INT16_C(-18799), INT16_C(-20388), INT16_C(-29822)),
+      simde_mm256_set_epi16(INT16_C(-22570), INT16_C(-15683), INT16_C(-31220), INT16_C(-29112),
+                            INT16_C( -3915), INT16_C( 16462), INT16_C( -5327), INT16_C( -1106),
+                            INT16_C( -6746), INT16_C(-23225), INT16_C( -9913), INT16_C(-32768),
+                            INT16_C(  3590), INT16_C(-18799), INT16_C(-20388), INT16_C(-29822)) },
+    { simde_mm256_set_epi16(INT16_C( 16992), INT16_C( -5172), INT16_C( 23160), INT16_C( 21068),
+                            INT16_C( 28164), INT16_C(-31909), INT16_C( 12688), INT16_C(-21199),
+                            INT16_C(  8573), INT16_C( -9662), INT16_C( 24102), INT16_C( 10272),
+                            INT16_C(-27799), INT16_C( 25957), INT16_C(-18928), INT16_C( 30780)),
+      simde_mm256_set_epi16(INT16_C( 28568), INT16_C( 29425), INT16_C( 12236), INT16_C( 29764),
+                            INT16_C(-27210), INT16_C( 25204), INT16_C(-27232), INT16_C( 10473),
+                            INT16_C( 21976), INT16_C(  9260), INT16_C( -4734), INT16_C(  3307),
+                            INT16_C( 31190), INT16_C( -7847), INT16_C(  8535), INT16_C( 29062)),
+      simde_mm256_set_epi16(INT16_C( 16992), INT16_C( -5172), INT16_C( 12236), INT16_C( 21068),
+                            INT16_C(-27210), INT16_C(-31909), INT16_C(-27232), INT16_C(-21199),
+                            INT16_C(  8573), INT16_C( -9662), INT16_C( -4734), INT16_C(  3307),
+                            INT16_C(-27799), INT16_C( -7847), INT16_C(-18928), INT16_C( 29062)) },
+    { simde_mm256_set_epi16(INT16_C(-21496), INT16_C( 30921), INT16_C( -4975), INT16_C( -2470),
+                            INT16_C( 21556), INT16_C(  2729), INT16_C(  7134), INT16_C(-18044),
+                            INT16_C(  2580), INT16_C(  5289), INT16_C(  9200), INT16_C(-11983),
+                            INT16_C( 18918), INT16_C( 17952), INT16_C(  9859), INT16_C( 29053)),
+      simde_mm256_set_epi16(INT16_C(-20281), INT16_C(-12186), INT16_C( 27694), INT16_C(  6748),
+                            INT16_C(-10997), INT16_C( 29604), INT16_C(-31336), INT16_C(-13388),
+                            INT16_C(-24068), INT16_C(-11864), INT16_C( 13342), INT16_C(-27855),
+                            INT16_C( 23936), INT16_C(-24068), INT16_C( 12342), INT16_C(-10995)),
+      simde_mm256_set_epi16(INT16_C(-21496), INT16_C(-12186), INT16_C( -4975), INT16_C( -2470),
+                            INT16_C(-10997), INT16_C(  2729), INT16_C(-31336), INT16_C(-18044),
+                            INT16_C(-24068), INT16_C(-11864), INT16_C(  9200), INT16_C(-27855),
+                            INT16_C( 18918), INT16_C(-24068), INT16_C(  9859), INT16_C(-10995)) },
+    { simde_mm256_set_epi16(INT16_C(  6678), INT16_C( -3200), INT16_C( 23600), INT16_C( 23608),
+                            INT16_C(-16952), INT16_C( 27855), INT16_C(-15645), INT16_C( 11148),
+                            INT16_C( 19572), INT16_C( 13428), INT16_C( -8371), INT16_C( 14161),
+                            INT16_C(-19394), INT16_C( 21155), INT16_C( 22430), INT16_C(  3287)),
+      simde_mm256_set_epi16(INT16_C( -5269), INT16_C( -5048), INT16_C(-22656), INT16_C(-27160),
+                            INT16_C(-13049), INT16_C(-14701), INT16_C(-23010), INT16_C( 22781),
+                            INT16_C(-31660), INT16_C( 19613), INT16_C(-16137), INT16_C( 20267),
+                            INT16_C(  6134), INT16_C( 24578), INT16_C( 25311), INT16_C(-15294)),
+      simde_mm256_set_epi16(INT16_C( -5269), INT16_C( -5048), INT16_C(-22656), INT16_C(-27160),
+                            INT16_C(-16952), INT16_C(-14701), INT16_C(-23010), INT16_C( 11148),
+                            INT16_C(-31660), INT16_C( 13428), INT16_C(-16137), INT16_C( 14161),
+                            INT16_C(-19394), INT16_C( 21155), INT16_C( 22430), INT16_C(-15294)) },
+    { simde_mm256_set_epi16(INT16_C( 21578), INT16_C(-17468), INT16_C( -6877), INT16_C( 15637),
+                            INT16_C(  1008), INT16_C(-13414), INT16_C( -8202), INT16_C( 29792),
+                            INT16_C( 13854), INT16_C(-26724), INT16_C(  8893), INT16_C(  3986),
+                            INT16_C( 11366), INT16_C( 29913), INT16_C(-31079), INT16_C( 23426)),
+      simde_mm256_set_epi16(INT16_C( 20731), INT16_C(-19759), INT16_C(-25528), INT16_C( 24741),
+                            INT16_C( 31013), INT16_C(-18705), INT16_C( -5421), INT16_C(-10027),
+                            INT16_C( 11023), INT16_C(-32621), INT16_C(-23550), INT16_C(-23271),
+                            INT16_C( 26405), INT16_C( 16836), INT16_C(-18510), INT16_C( 29290)),
+      simde_mm256_set_epi16(INT16_C( 20731), INT16_C(-19759), INT16_C(-25528), INT16_C( 15637),
+                            INT16_C(  1008), INT16_C(-18705), INT16_C( -8202), INT16_C(-10027),
+                            INT16_C( 11023), INT16_C(-32621), INT16_C(-23550), INT16_C(-23271),
+                            INT16_C( 11366), INT16_C( 16836), INT16_C(-31079), INT16_C( 23426)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_min_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( 1487629780), INT32_C( 1279944208), INT32_C(-1882925110), INT32_C(-1895226408),
+                            INT32_C(-1578080527), INT32_C( -893020027), INT32_C( -434180791), INT32_C( 1332173772)),
+      simde_mm256_set_epi32(INT32_C(-2136904869), INT32_C( 1500065591), INT32_C( -702895156), INT32_C(  -79734979),
+                            INT32_C( -993418575), INT32_C(-1909655640), INT32_C( 1251452143), INT32_C(  737051550)),
+      simde_mm256_set_epi32(INT32_C(-2136904869), INT32_C( 1279944208), INT32_C(-1882925110), INT32_C(-1895226408),
+                            INT32_C(-1578080527), INT32_C(-1909655640), INT32_C( -434180791), INT32_C(  737051550)) },
+    { simde_mm256_set_epi32(INT32_C( -953612449), INT32_C( 2141511588), INT32_C( -586854944), INT32_C( 1518122396),
+                            INT32_C( -282515062), INT32_C( -485280368), INT32_C(  110344268), INT32_C( 1985748173)),
+      simde_mm256_set_epi32(INT32_C(   87543886), INT32_C(  412960547), INT32_C( -228532945), INT32_C(  904415854),
+                            INT32_C(-1384659860), INT32_C(   82919922), INT32_C( 1455763348), INT32_C(   41423956)),
+      simde_mm256_set_epi32(INT32_C( -953612449), INT32_C(  412960547), INT32_C( -586854944), INT32_C(  904415854),
+                            INT32_C(-1384659860), INT32_C( -485280368), INT32_C(  110344268), INT32_C(   41423956)) },
+    { simde_mm256_set_epi32(INT32_C(  278085578), INT32_C(  384135453), INT32_C( -560266461), INT32_C(-1032840622),
+                            INT32_C(-1079620473), INT32_C( 1201815807), INT32_C(  688383683), INT32_C( 1396677835)),
+      simde_mm256_set_epi32(INT32_C( 1271714808), INT32_C(-1785678493), INT32_C( 1436208122), INT32_C( -639599881),
+                            INT32_C( -961965990), INT32_C( 1457617350), INT32_C(-2029168363), INT32_C( 1668004958)),
+      simde_mm256_set_epi32(INT32_C(  278085578), INT32_C(-1785678493), INT32_C( -560266461), INT32_C(-1032840622),
+                            INT32_C(-1079620473), INT32_C( 1201815807), INT32_C(-2029168363), INT32_C( 1396677835)) },
+    { simde_mm256_set_epi32(INT32_C( 1834729625), INT32_C(-1663626252), INT32_C( 1652755813), INT32_C(-1810306628),
+                            INT32_C( -514606534), INT32_C(  114264711), INT32_C(-1331086876), INT32_C( 1781987673)),
+      simde_mm256_set_epi32(INT32_C( 1067766194), INT32_C(   67929002), INT32_C(  509541798), INT32_C(  409880670),
+                            INT32_C( 1577647586), INT32_C( -650259406), INT32_C( -805524608), INT32_C( -414473597)),
+      simde_mm256_set_epi32(INT32_C( 1067766194), INT32_C(-1663626252), INT32_C(  509541798), INT32_C(-1810306628),
+                            INT32_C( -514606534), INT32_C( -650259406), INT32_C(-1331086876), INT32_C( -414473597)) },
+    { simde_mm256_set_epi32(INT32_C( -678425036), INT32_C(  750981078), INT32_C(-1617800997), INT32_C(  732329639),
+                            INT32_C( -363460566), INT32_C( 1652064525), INT32_C(  400445059), INT32_C( -531232587)),
+      simde_mm256_set_epi32(INT32_C( 1390637498), INT32_C(-1218055979), INT32_C( 1199851614), INT32_C( 1444836406),
+                            INT32_C( 1749846907), INT32_C(  223036271), INT32_C( 1167762269), INT32_C(-1001121776)),
+      simde_mm256_set_epi32(INT32_C( -678425036), INT32_C(-1218055979), INT32_C(-1617800997), INT32_C(  732329639),
+                            INT32_C( -363460566), INT32_C(  223036271), INT32_C(  400445059), INT32_C(-1001121776)) },
+    { simde_mm256_set_epi32(INT32_C(  401222901), INT32_C(-1232377031), INT32_C( -161995674), INT32_C(  715762186),
+                            INT32_C( -403306291), INT32_C(  689124123), INT32_C(-1128038274), INT32_C(  741898360)),
+      simde_mm256_set_epi32(INT32_C(-1328849655), INT32_C( 1269440693), INT32_C( 1730139700), INT32_C( 1623561220),
+                            INT32_C( 1382851337), INT32_C( 1262582603), INT32_C(  299396108), INT32_C(-1984937277)),
+      simde_mm256_set_epi32(INT32_C(-1328849655), INT32_C(-1232377031), INT32_C( -161995674), INT32_C(  715762186),
+                            INT32_C( -403306291), INT32_C(  689124123), INT32_C(-1128038274), INT32_C(-1984937277)) },
+    { simde_mm256_set_epi32(INT32_C(-1759537005), INT32_C( 1866853396), INT32_C(-1953604945), INT32_C(-1100309630),
+                            INT32_C(  283847106), INT32_C( 1244926201), INT32_C( -897797132), INT32_C(-1352053935)),
+      simde_mm256_set_epi32(INT32_C(-1441488583), INT32_C( 1234189485), INT32_C(-1943614679), INT32_C(-1265766697),
+                            INT32_C(-1495801093), INT32_C(-1873144633), INT32_C( -291530519), INT32_C(-1629500916)),
+      simde_mm256_set_epi32(INT32_C(-1759537005), INT32_C( 1234189485), INT32_C(-1953604945), INT32_C(-1265766697),
+                            INT32_C(-1495801093), INT32_C(-1873144633), INT32_C( -897797132), INT32_C(-1629500916)) },
+    { simde_mm256_set_epi32(INT32_C(-1346059850), INT32_C(  784465530), INT32_C(-1019923685), INT32_C( 1006111893),
+                            INT32_C( -494714591), INT32_C( 2134210460), INT32_C(  310160721), INT32_C(-1399227625)),
+      simde_mm256_set_epi32(INT32_C( 1276308311), INT32_C(  356870973), INT32_C(  871793495), INT32_C(-1105447302),
+                            INT32_C( -436543600), INT32_C( -946938525), INT32_C(-2099422451), INT32_C( -263949268)),
+      simde_mm256_set_epi32(INT32_C(-1346059850), INT32_C(  356870973), INT32_C(-1019923685), INT32_C(-1105447302),
+                            INT32_C( -494714591), INT32_C( -946938525), INT32_C(-2099422451), INT32_C(-1399227625)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_min_epi32(test_vec[i].a, test_vec[i].b);
     simde_assert_m256i_i32(r, ==, test_vec[i].r);
   }
 
@@ -5707,6 +9036,442 @@ test_simde_mm256_movemask_epi8(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm256_mul_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( -264869274), INT32_C(  145832253), INT32_C(-1997562284), INT32_C( 1187864933),
+                            INT32_C( 2009371989), INT32_C( 1966182625), INT32_C(-1128793572), INT32_C(-2056967935)),
+      simde_mm256_set_epi32(INT32_C(-1932425993), INT32_C(  771508768), INT32_C( -451980818), INT32_C(  445098125),
+                            INT32_C( 2010293748), INT32_C(  316926988), INT32_C( 1886536824), INT32_C( 1793846443)),
+      simde_mm256_set_epi64x(INT64_C(  112510861846694304), INT64_C(  528716454431550625),
+                             INT64_C(  623136337199183500), INT64_C(-3689884613564805205)) },
+    { simde_mm256_set_epi32(INT32_C(  929407488), INT32_C( 1480109464), INT32_C(-1920693260), INT32_C( 1612363260),
+                            INT32_C( -687384138), INT32_C(-1123741437), INT32_C( -829453190), INT32_C( -807263013)),
+      simde_mm256_set_epi32(INT32_C( 1044177705), INT32_C(-1836093089), INT32_C(-1262651490), INT32_C(-1454423217),
+                            INT32_C( -357312502), INT32_C( -216442621), INT32_C( 1976731074), INT32_C(  976549741)),
+      simde_mm256_set_epi64x(INT64_C(-2717618757813894296), INT64_C(-2345058559581807420),
+                             INT64_C(  243225541950586377), INT64_C( -788332486264029633)) },
+    { simde_mm256_set_epi32(INT32_C(-1640203111), INT32_C( 1261934600), INT32_C( 1593028186), INT32_C( 1546310646),
+                            INT32_C(-2128774891), INT32_C(-2000607756), INT32_C( 1457730494), INT32_C( -750316626)),
+      simde_mm256_set_epi32(INT32_C( -910418890), INT32_C( 1718101540), INT32_C(  137143653), INT32_C( 1437397299),
+                            INT32_C( 1102322688), INT32_C( 1015481175), INT32_C(  587685157), INT32_C( 1435776717)),
+      simde_mm256_set_epi64x(INT64_C( 2168131779639284000), INT64_C( 2222662745975345154),
+                             INT64_C(-2031579514776993300), INT64_C(-1077287141988796842)) },
+    { simde_mm256_set_epi32(INT32_C( 1948318465), INT32_C(-2103485558), INT32_C( -211718690), INT32_C(  978119076),
+                            INT32_C( 1512082293), INT32_C(  195579053), INT32_C(  231266736), INT32_C(  382807008)),
+      simde_mm256_set_epi32(INT32_C( 1894638700), INT32_C( 1778837273), INT32_C(  838085632), INT32_C( 1214280244),
+                            INT32_C(  410287654), INT32_C(  742819105), INT32_C( 2142003415), INT32_C(-1298033538)),
+      simde_mm256_set_epi64x(INT64_C(-3741758513787603334), INT64_C( 1187710670266334544),
+                             INT64_C(  145279857106207565), INT64_C( -496896334965434304)) },
+    { simde_mm256_set_epi32(INT32_C(-1888011459), INT32_C( -601350477), INT32_C( 2110702355), INT32_C(-1235195233),
+                            INT32_C(  566813463), INT32_C(  328901963), INT32_C(  263480326), INT32_C( -416712210)),
+      simde_mm256_set_epi32(INT32_C( -866383137), INT32_C(-1706160608), INT32_C(  716507584), INT32_C(-1353098429),
+                            INT32_C( -930095895), INT32_C( 2039790373), INT32_C(-1091866722), INT32_C( -674869238)),
+      simde_mm256_set_epi64x(INT64_C( 1026000495459410016), INT64_C( 1671340729280588957),
+                             INT64_C(  670891057788202199), INT64_C(  281226251627995980)) },
+    { simde_mm256_set_epi32(INT32_C( -229482799), INT32_C(   21346834), INT32_C( 1009973204), INT32_C(  883007576),
+                            INT32_C(  915240265), INT32_C(  858985468), INT32_C(-1053213887), INT32_C(  133736749)),
+      simde_mm256_set_epi32(INT32_C( 1441428592), INT32_C(-1751229235), INT32_C( 1028328293), INT32_C(  292549214),
+                            INT32_C(   73972565), INT32_C( 1396388818), INT32_C( -573437277), INT32_C(-1305706865)),
+      simde_mm256_set_epi64x(INT64_C(  -37383199775491990), INT64_C(  258323172314845264),
+                             INT64_C( 1199477702339696824), INT64_C( -174620991272081885)) },
+    { simde_mm256_set_epi32(INT32_C( 2046989766), INT32_C(  909965778), INT32_C(-1174868560), INT32_C( -810618416),
+                            INT32_C( 2082214470), INT32_C( 1120659141), INT32_C(-1363848889), INT32_C(  732740923)),
+      simde_mm256_set_epi32(INT32_C(-1092104047), INT32_C(   59281346), INT32_C(-1049904012), INT32_C( -410108290),
+                            INT32_C(-2118501314), INT32_C( -514124001), INT32_C( -424858345), INT32_C(-1500163118)),
+      simde_mm256_set_epi64x(INT64_C(   53943996133777188), INT64_C(  332441332428268640),
+                             INT64_C( -576157761328143141), INT64_C(-1099230907733877914)) },
+    { simde_mm256_set_epi32(INT32_C(   46731607), INT32_C(   97812868), INT32_C(   42051632), INT32_C(-1289241554),
+                            INT32_C(-1087932623), INT32_C( 1100238416), INT32_C(  140939702), INT32_C(  -76575509)),
+      simde_mm256_set_epi32(INT32_C( -821747911), INT32_C(-1903034774), INT32_C( 1312876010), INT32_C( -486186153),
+                            INT32_C(-2010242516), INT32_C(-1117025547), INT32_C(-1024096216), INT32_C( 1557352334)),
+      simde_mm256_set_epi64x(INT64_C( -186141289148671832), INT64_C(  626811391427001762),
+                             INT64_C(-1228994418462813552), INT64_C( -119255047668388006)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mul_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mul_epu32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_x_mm256_set_epu32(UINT32_C(2072938972), UINT32_C(1547337353), UINT32_C( 263745602), UINT32_C(3117950173),
+                              UINT32_C( 500570686), UINT32_C(3119659054), UINT32_C(3313438977), UINT32_C(1805941810)),
+      simde_x_mm256_set_epu32(UINT32_C(1323680499), UINT32_C( 727822402), UINT32_C(3039663642), UINT32_C(2739885506),
+                              UINT32_C(4019359114), UINT32_C( 884201701), UINT32_C(3466527095), UINT32_C(3227048319)),
+      simde_x_mm256_set_epu64x(UINT64_C( 1126186788964781906), UINT64_C( 8542826487432892538),
+                               UINT64_C( 2758407842086850854), UINT64_C( 5827861482172317390)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3039650768), UINT32_C(2302219678), UINT32_C( 752550689), UINT32_C(  22086507),
+                              UINT32_C(1058912310), UINT32_C(3955514509), UINT32_C(3707757056), UINT32_C(3513197546)),
+      simde_x_mm256_set_epu32(UINT32_C(3364323509), UINT32_C(4207898929), UINT32_C(1438161737), UINT32_C(2069985158),
+                              UINT32_C( 614055438), UINT32_C(1156185106), UINT32_C(1678020865), UINT32_C( 395707960)),
+      simde_x_mm256_set_epu64x(UINT64_C( 9687507717378924862), UINT64_C(   45718741682063106),
+                               UINT64_C( 4573306961872702954), UINT64_C( 1390200234004666160)) },
+    { simde_x_mm256_set_epu32(UINT32_C(2512554281), UINT32_C(2990038064), UINT32_C(3555389263), UINT32_C(1600481539),
+                              UINT32_C( 659135090), UINT32_C(1893426096), UINT32_C(3381179219), UINT32_C(2897413429)),
+      simde_x_mm256_set_epu32(UINT32_C(1908168704), UINT32_C(4083899874), UINT32_C(1085900338), UINT32_C(3881168123),
+                              UINT32_C(1674084725), UINT32_C(1195351791), UINT32_C(2142434706), UINT32_C( 787448936)),
+      simde_x_mm256_set_epu64x(UINT64_C(12211016072824803936), UINT64_C( 6211737930616781297),
+                               UINT64_C( 2263310274979737936), UINT64_C( 2281565121818161544)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3052278386), UINT32_C( 653521635), UINT32_C(1969951204), UINT32_C( 382681472),
+                              UINT32_C(3080247784), UINT32_C(3218640796), UINT32_C(  50171011), UINT32_C(4128638199)),
+      simde_x_mm256_set_epu32(UINT32_C(3885381265), UINT32_C(3633252701), UINT32_C( 301218330), UINT32_C( 478514921),
+                              UINT32_C(1472655792), UINT32_C(1685998219), UINT32_C(4060410149), UINT32_C( 963888168)),
+      simde_x_mm256_set_epu64x(UINT64_C( 2374409245525686135), UINT64_C(  183118794342243712),
+                               UINT64_C( 5426622649656742324), UINT64_C( 3979545509968929432)) },
+    { simde_x_mm256_set_epu32(UINT32_C( 831821683), UINT32_C(  51842988), UINT32_C(1549836210), UINT32_C(2341509403),
+                              UINT32_C( 399669872), UINT32_C(1219588040), UINT32_C(1344287234), UINT32_C( 582069304)),
+      simde_x_mm256_set_epu32(UINT32_C(1944751024), UINT32_C(2704387783), UINT32_C(2718730063), UINT32_C( 433195536),
+                              UINT32_C( 340956451), UINT32_C(2395686858), UINT32_C(3238220788), UINT32_C(3949442799)),
+      simde_x_mm256_set_epu64x(UINT64_C(  140203543381415604), UINT64_C( 1014331420881625008),
+                               UINT64_C( 2921751039601978320), UINT64_C( 2298849421201741896)) },
+    { simde_x_mm256_set_epu32(UINT32_C(2469378154), UINT32_C(1090489023), UINT32_C(1401845909), UINT32_C( 629971323),
+                              UINT32_C(1564062933), UINT32_C(2161838419), UINT32_C(3196794185), UINT32_C(3389025511)),
+      simde_x_mm256_set_epu32(UINT32_C( 610843905), UINT32_C(3363328524), UINT32_C(2508173495), UINT32_C(2924786112),
+                              UINT32_C(4045884765), UINT32_C(1132012420), UINT32_C(2845993506), UINT32_C(2344640016)),
+      simde_x_mm256_set_epu64x(UINT64_C( 3667672836164792052), UINT64_C( 1842531376468666176),
+                               UINT64_C( 2447227940341163980), UINT64_C( 7946044828335448176)) },
+    { simde_x_mm256_set_epu32(UINT32_C(1945425396), UINT32_C(2027137667), UINT32_C( 956555415), UINT32_C(2797704790),
+                              UINT32_C(2280277116), UINT32_C(3375340590), UINT32_C( 613384198), UINT32_C(1981444616)),
+      simde_x_mm256_set_epu32(UINT32_C(3627330867), UINT32_C(2154609576), UINT32_C(2306857099), UINT32_C(2292284338),
+                              UINT32_C(3104956093), UINT32_C(3298919516), UINT32_C(3824430676), UINT32_C(3377198213)),
+      simde_x_mm256_set_epu64x(UINT64_C( 4367690229188499192), UINT64_C( 6413134872464579020),
+                               UINT64_C(11134976945497954440), UINT64_C( 6691731216313671208)) },
+    { simde_x_mm256_set_epu32(UINT32_C(2590697932), UINT32_C(2581725750), UINT32_C(2879395948), UINT32_C(1982116151),
+                              UINT32_C(2732791157), UINT32_C(2431090821), UINT32_C( 160307437), UINT32_C(3031690381)),
+      simde_x_mm256_set_epu32(UINT32_C(4103941508), UINT32_C(3578477875), UINT32_C(4196319204), UINT32_C(4054100273),
+                              UINT32_C(1502005130), UINT32_C(2123073050), UINT32_C( 209934734), UINT32_C(3676510039)),
+      simde_x_mm256_set_epu64x(UINT64_C( 9238648475692781250), UINT64_C( 8035697628886809223),
+                               UINT64_C( 5161383404167474050), UINT64_C(11146040120886234859)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mul_epu32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mulhi_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C(-28672), INT16_C(-24640), INT16_C(  -685), INT16_C(  1911),
+                            INT16_C( -7070), INT16_C(-30395), INT16_C(-25528), INT16_C( 17635),
+                            INT16_C( 31603), INT16_C(-21912), INT16_C( 26114), INT16_C(-29212),
+                            INT16_C( 29941), INT16_C( 19910), INT16_C( 18139), INT16_C( 16657)),
+      simde_mm256_set_epi16(INT16_C(-20360), INT16_C( 31991), INT16_C( 22819), INT16_C( 22283),
+                            INT16_C(-26606), INT16_C( 25747), INT16_C(  8553), INT16_C( 11670),
+                            INT16_C( 20076), INT16_C(  8923), INT16_C(-21785), INT16_C(-16719),
+                            INT16_C( 30057), INT16_C(-15109), INT16_C(  1446), INT16_C( -8389)),
+      simde_mm256_set_epi16(INT16_C(  8907), INT16_C(-12028), INT16_C(  -239), INT16_C(   649),
+                            INT16_C(  2870), INT16_C(-11942), INT16_C( -3332), INT16_C(  3140),
+                            INT16_C(  9681), INT16_C( -2984), INT16_C( -8681), INT16_C(  7452),
+                            INT16_C( 13731), INT16_C( -4591), INT16_C(   400), INT16_C( -2133)) },
+    { simde_mm256_set_epi16(INT16_C(-25755), INT16_C( 11204), INT16_C(-16922), INT16_C( 13364),
+                            INT16_C(-12459), INT16_C(  6542), INT16_C(-30883), INT16_C(-30995),
+                            INT16_C( 12748), INT16_C( -1108), INT16_C(  4678), INT16_C( -8294),
+                            INT16_C( 22572), INT16_C( 21717), INT16_C( 32039), INT16_C( -6925)),
+      simde_mm256_set_epi16(INT16_C( 12607), INT16_C(  9088), INT16_C(-29863), INT16_C(  9118),
+                            INT16_C(  7278), INT16_C(-23273), INT16_C(-10698), INT16_C(-27275),
+                            INT16_C( -6477), INT16_C(  5943), INT16_C( 16842), INT16_C(-12511),
+                            INT16_C(  3455), INT16_C( 14647), INT16_C( 20815), INT16_C( 25540)),
+      simde_mm256_set_epi16(INT16_C( -4955), INT16_C(  1553), INT16_C(  7710), INT16_C(  1859),
+                            INT16_C( -1384), INT16_C( -2324), INT16_C(  5041), INT16_C( 12899),
+                            INT16_C( -1260), INT16_C(  -101), INT16_C(  1202), INT16_C(  1583),
+                            INT16_C(  1189), INT16_C(  4853), INT16_C( 10175), INT16_C( -2699)) },
+    { simde_mm256_set_epi16(INT16_C(  5616), INT16_C(-25096), INT16_C(-28282), INT16_C(-12987),
+                            INT16_C( 22381), INT16_C( 23411), INT16_C( 24369), INT16_C( -6548),
+                            INT16_C(-28383), INT16_C( 12603), INT16_C( 30031), INT16_C(-30642),
+                            INT16_C( 29405), INT16_C( -8162), INT16_C( 13449), INT16_C( -7511)),
+      simde_mm256_set_epi16(INT16_C( -7062), INT16_C(-14989), INT16_C(-21400), INT16_C(  -767),
+                            INT16_C(-19813), INT16_C(-32015), INT16_C(-19958), INT16_C(-13918),
+                            INT16_C(-28168), INT16_C( 18008), INT16_C(-25126), INT16_C(-24602),
+                            INT16_C(-26690), INT16_C( -5150), INT16_C(  4233), INT16_C(-26983)),
+      simde_mm256_set_epi16(INT16_C(  -606), INT16_C(  5739), INT16_C(  9235), INT16_C(   151),
+                            INT16_C( -6767), INT16_C(-11437), INT16_C( -7422), INT16_C(  1390),
+                            INT16_C( 12199), INT16_C(  3463), INT16_C(-11514), INT16_C( 11502),
+                            INT16_C(-11976), INT16_C(   641), INT16_C(   868), INT16_C(  3092)) },
+    { simde_mm256_set_epi16(INT16_C(-21159), INT16_C( -5118), INT16_C( -4198), INT16_C( 15896),
+                            INT16_C(-18643), INT16_C( 20259), INT16_C( -7953), INT16_C( 28626),
+                            INT16_C(-30869), INT16_C( 14302), INT16_C(  7319), INT16_C( 27638),
+                            INT16_C( 27232), INT16_C(-11318), INT16_C(  8947), INT16_C( 14177)),
+      simde_mm256_set_epi16(INT16_C(-10860), INT16_C(-11971), INT16_C(-17306), INT16_C( -8853),
+                            INT16_C(-20976), INT16_C(   556), INT16_C( 12820), INT16_C( 26742),
+                            INT16_C(-23749), INT16_C( 27979), INT16_C(-17404), INT16_C(-26738),
+                            INT16_C( 14434), INT16_C(-19508), INT16_C(  4747), INT16_C(-18926)),
+      simde_mm256_set_epi16(INT16_C(  3506), INT16_C(   934), INT16_C(  1108), INT16_C( -2148),
+                            INT16_C(  5967), INT16_C(   171), INT16_C( -1556), INT16_C( 11680),
+                            INT16_C( 11186), INT16_C(  6105), INT16_C( -1944), INT16_C(-11277),
+                            INT16_C(  5997), INT16_C(  3369), INT16_C(   648), INT16_C( -4095)) },
+    { simde_mm256_set_epi16(INT16_C( 25291), INT16_C(  6052), INT16_C( 15386), INT16_C(-22136),
+                            INT16_C( 20169), INT16_C(  8160), INT16_C(-26777), INT16_C( 23891),
+                            INT16_C( 29545), INT16_C( -5993), INT16_C( -8469), INT16_C( 32678),
+                            INT16_C( 23251), INT16_C(  2472), INT16_C(-30780), INT16_C(-26654)),
+      simde_mm256_set_epi16(INT16_C(-25751), INT16_C( -1964), INT16_C(-22530), INT16_C(-27813),
+                            INT16_C(-29612), INT16_C( -4726), INT16_C( -9449), INT16_C(-21408),
+                            INT16_C( 12495), INT16_C(-22809), INT16_C( -1002), INT16_C(-18159),
+                            INT16_C( 17229), INT16_C(-20384), INT16_C(-20558), INT16_C(-31784)),
+      simde_mm256_set_epi16(INT16_C( -9938), INT16_C(  -182), INT16_C( -5290), INT16_C(  9394),
+                            INT16_C( -9114), INT16_C(  -589), INT16_C(  3860), INT16_C( -7805),
+                            INT16_C(  5633), INT16_C(  2085), INT16_C(   129), INT16_C( -9055),
+                            INT16_C(  6112), INT16_C(  -769), INT16_C(  9655), INT16_C( 12926)) },
+    { simde_mm256_set_epi16(INT16_C( 28636), INT16_C( -5200), INT16_C( 27154), INT16_C(  5702),
+                            INT16_C(-32451), INT16_C(-15717), INT16_C(-23454), INT16_C(-27682),
+                            INT16_C( -2160), INT16_C( 29250), INT16_C( 21574), INT16_C(-21661),
+                            INT16_C(-32523), INT16_C( 27469), INT16_C( 32666), INT16_C( -4682)),
+      simde_mm256_set_epi16(INT16_C(  2546), INT16_C( -3239), INT16_C( -8612), INT16_C(-15374),
+                            INT16_C(-20115), INT16_C(-24873), INT16_C(  4905), INT16_C(-25955),
+                            INT16_C(  6104), INT16_C( 10860), INT16_C(-25132), INT16_C(  6897),
+                            INT16_C(-20454), INT16_C(  7684), INT16_C(  1092), INT16_C(-29883)),
+      simde_mm256_set_epi16(INT16_C(  1112), INT16_C(   257), INT16_C( -3569), INT16_C( -1338),
+                            INT16_C(  9960), INT16_C(  5965), INT16_C( -1756), INT16_C( 10963),
+                            INT16_C(  -202), INT16_C(  4847), INT16_C( -8274), INT16_C( -2280),
+                            INT16_C( 10150), INT16_C(  3220), INT16_C(   544), INT16_C(  2134)) },
+    { simde_mm256_set_epi16(INT16_C(  2203), INT16_C(-29461), INT16_C( 25562), INT16_C(-17482),
+                            INT16_C(  7746), INT16_C(-16121), INT16_C(-30009), INT16_C(-12659),
+                            INT16_C(  1932), INT16_C(  5184), INT16_C(-18625), INT16_C(  5590),
+                            INT16_C( 25819), INT16_C(  4963), INT16_C(  2321), INT16_C(-20765)),
+      simde_mm256_set_epi16(INT16_C(   241), INT16_C(  4933), INT16_C(-28487), INT16_C( 18731),
+                            INT16_C( 30035), INT16_C(   496), INT16_C(-25174), INT16_C(-28357),
+                            INT16_C(   833), INT16_C( 20936), INT16_C(-22588), INT16_C(-25678),
+                            INT16_C(-28280), INT16_C(-15924), INT16_C(-24737), INT16_C(  4522)),
+      simde_mm256_set_epi16(INT16_C(     8), INT16_C( -2218), INT16_C(-11112), INT16_C( -4997),
+                            INT16_C(  3549), INT16_C(  -123), INT16_C( 11527), INT16_C(  5477),
+                            INT16_C(    24), INT16_C(  1656), INT16_C(  6419), INT16_C( -2191),
+                            INT16_C(-11142), INT16_C( -1206), INT16_C(  -877), INT16_C( -1433)) },
+    { simde_mm256_set_epi16(INT16_C(-26967), INT16_C( 11244), INT16_C(  4261), INT16_C( -2855),
+                            INT16_C( 25518), INT16_C(    32), INT16_C( 10330), INT16_C(-29708),
+                            INT16_C( 29754), INT16_C( 15537), INT16_C(-24335), INT16_C(-32611),
+                            INT16_C( 31047), INT16_C( 30567), INT16_C( 12212), INT16_C(-17924)),
+      simde_mm256_set_epi16(INT16_C(  3682), INT16_C( 18569), INT16_C(-11656), INT16_C( -9242),
+                            INT16_C( 30401), INT16_C(  5891), INT16_C( 14290), INT16_C( 28736),
+                            INT16_C(  2660), INT16_C( -7688), INT16_C( 32292), INT16_C(-20064),
+                            INT16_C(-16559), INT16_C( 13748), INT16_C( -4126), INT16_C( -5257)),
+      simde_mm256_set_epi16(INT16_C( -1516), INT16_C(  3185), INT16_C(  -758), INT16_C(   402),
+                            INT16_C( 11837), INT16_C(     2), INT16_C(  2252), INT16_C(-13027),
+                            INT16_C(  1207), INT16_C( -1823), INT16_C(-11991), INT16_C(  9983),
+                            INT16_C( -7845), INT16_C(  6412), INT16_C(  -769), INT16_C(  1437)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mulhi_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mullo_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C(  3943), INT16_C(  6007), INT16_C(-27947), INT16_C(-27413),
+                            INT16_C(-24413), INT16_C(-32690), INT16_C(-17567), INT16_C(-28531),
+                            INT16_C( -2927), INT16_C(-20870), INT16_C( 24626), INT16_C(-16595),
+                            INT16_C(-24998), INT16_C(  2580), INT16_C(  2666), INT16_C( -7927)),
+      simde_mm256_set_epi16(INT16_C(-22167), INT16_C( -8676), INT16_C(-27754), INT16_C(-26277),
+                            INT16_C( -7449), INT16_C( 25455), INT16_C(-14824), INT16_C( 20992),
+                            INT16_C( -6281), INT16_C(-29096), INT16_C(-20143), INT16_C( 17265),
+                            INT16_C(  6136), INT16_C(-27365), INT16_C( 28455), INT16_C(-21775)),
+      simde_mm256_set_epi16(INT16_C( 20543), INT16_C(-15612), INT16_C( 22478), INT16_C( 25225),
+                            INT16_C( -9963), INT16_C(-13358), INT16_C(-26856), INT16_C( 10752),
+                            INT16_C(-31129), INT16_C(-23056), INT16_C(   466), INT16_C( 10717),
+                            INT16_C( 32048), INT16_C(-19428), INT16_C(-29658), INT16_C(-11399)) },
+    { simde_mm256_set_epi16(INT16_C( -7959), INT16_C(   990), INT16_C( 12410), INT16_C(-26710),
+                            INT16_C(  1568), INT16_C(-14938), INT16_C( 17581), INT16_C( 24405),
+                            INT16_C(-25518), INT16_C(-30326), INT16_C(-23168), INT16_C(-14077),
+                            INT16_C( 17675), INT16_C(-13788), INT16_C(-19584), INT16_C(  2072)),
+      simde_mm256_set_epi16(INT16_C(-12688), INT16_C(  4763), INT16_C(-20815), INT16_C( 14224),
+                            INT16_C( 30792), INT16_C( 28240), INT16_C(  3188), INT16_C( 25827),
+                            INT16_C( -6050), INT16_C(-28393), INT16_C( -9529), INT16_C( 28036),
+                            INT16_C( 30371), INT16_C( 25917), INT16_C(-31015), INT16_C( 23339)),
+      simde_mm256_set_epi16(INT16_C( -7184), INT16_C( -3222), INT16_C( 28762), INT16_C(-10848),
+                            INT16_C(-18176), INT16_C(  6112), INT16_C( 14948), INT16_C(-17313),
+                            INT16_C(-18916), INT16_C(-31386), INT16_C(-22912), INT16_C( -4980),
+                            INT16_C(  2049), INT16_C( 24212), INT16_C( 10112), INT16_C( -7160)) },
+    { simde_mm256_set_epi16(INT16_C(  4789), INT16_C( 21253), INT16_C(  5562), INT16_C( -2616),
+                            INT16_C(-20199), INT16_C( 28100), INT16_C( -7240), INT16_C(-11909),
+                            INT16_C(-28548), INT16_C(-15515), INT16_C( 20438), INT16_C( -5887),
+                            INT16_C(  3871), INT16_C( -7487), INT16_C( 15113), INT16_C(-32105)),
+      simde_mm256_set_epi16(INT16_C( -3305), INT16_C(-26935), INT16_C(  6923), INT16_C(-15621),
+                            INT16_C(-14272), INT16_C(  9218), INT16_C( 25839), INT16_C(-15681),
+                            INT16_C( 11234), INT16_C(  7806), INT16_C(-11284), INT16_C( 16543),
+                            INT16_C( 27634), INT16_C(-27855), INT16_C(-22412), INT16_C( 25090)),
+      simde_mm256_set_epi16(INT16_C( 32067), INT16_C(  7405), INT16_C(-29442), INT16_C(-29928),
+                            INT16_C(-12736), INT16_C( 27528), INT16_C( 30920), INT16_C(-32571),
+                            INT16_C( 24952), INT16_C(   438), INT16_C( -1208), INT16_C( -2145),
+                            INT16_C( 16462), INT16_C( 14833), INT16_C(-22508), INT16_C(-11474)) },
+    { simde_mm256_set_epi16(INT16_C(-28220), INT16_C(-16123), INT16_C(-19942), INT16_C( 26753),
+                            INT16_C(-12131), INT16_C(-14101), INT16_C(  5431), INT16_C(-32208),
+                            INT16_C( 28411), INT16_C( 30977), INT16_C( 15310), INT16_C( 17643),
+                            INT16_C(-19241), INT16_C( -3474), INT16_C(  9421), INT16_C(-10716)),
+      simde_mm256_set_epi16(INT16_C( -6865), INT16_C( 32115), INT16_C(-20823), INT16_C(-32248),
+                            INT16_C( 20022), INT16_C( 17077), INT16_C( 26939), INT16_C(-12609),
+                            INT16_C(-13290), INT16_C( -4273), INT16_C(  7991), INT16_C( -1420),
+                            INT16_C( -8278), INT16_C(  8905), INT16_C( 18326), INT16_C(  3198)),
+      simde_mm256_set_epi16(INT16_C(  5884), INT16_C(  9791), INT16_C( 16170), INT16_C(-14840),
+                            INT16_C(-10466), INT16_C(-23513), INT16_C( 29357), INT16_C(-15920),
+                            INT16_C(-29294), INT16_C( 17999), INT16_C(-13502), INT16_C(-18308),
+                            INT16_C( 24518), INT16_C( -2978), INT16_C( 27422), INT16_C(  5560)) },
+    { simde_mm256_set_epi16(INT16_C(  5674), INT16_C(-18097), INT16_C( 31134), INT16_C( 30879),
+                            INT16_C(-12692), INT16_C(-14543), INT16_C( 17806), INT16_C( 17432),
+                            INT16_C( 12324), INT16_C( 16071), INT16_C( 28088), INT16_C( 14469),
+                            INT16_C(  5524), INT16_C(  9266), INT16_C(-12471), INT16_C(-11730)),
+      simde_mm256_set_epi16(INT16_C( -6317), INT16_C(-31624), INT16_C(  -177), INT16_C(-20936),
+                            INT16_C(  9740), INT16_C( 23062), INT16_C( 13475), INT16_C( -4379),
+                            INT16_C(-32061), INT16_C(-10676), INT16_C(-14380), INT16_C( 18095),
+                            INT16_C( 20777), INT16_C( -4929), INT16_C( 23355), INT16_C( 30162)),
+      simde_mm256_set_epi16(INT16_C(  5534), INT16_C(-26360), INT16_C( -5694), INT16_C( 29896),
+                            INT16_C(-19184), INT16_C( 22582), INT16_C(  8554), INT16_C( 14712),
+                            INT16_C( -3220), INT16_C(  -748), INT16_C( -7072), INT16_C(   235),
+                            INT16_C( 18612), INT16_C(  6478), INT16_C(-18221), INT16_C( 28604)) },
+    { simde_mm256_set_epi16(INT16_C(  4263), INT16_C(-20910), INT16_C(-25835), INT16_C( 31152),
+                            INT16_C(-17063), INT16_C( 27596), INT16_C( -3638), INT16_C( 22530),
+                            INT16_C(-23225), INT16_C(-15125), INT16_C(  -331), INT16_C(-25562),
+                            INT16_C( 11493), INT16_C(-23931), INT16_C( 23301), INT16_C( 19418)),
+      simde_mm256_set_epi16(INT16_C( 19016), INT16_C( 26202), INT16_C( 30254), INT16_C(-20524),
+                            INT16_C(  -580), INT16_C( 14366), INT16_C( 17506), INT16_C( 26843),
+                            INT16_C(  5118), INT16_C( 14541), INT16_C( 30664), INT16_C( -5765),
+                            INT16_C( -9999), INT16_C( 27556), INT16_C(  1038), INT16_C(-28712)),
+      simde_mm256_set_epi16(INT16_C( -2824), INT16_C( -2860), INT16_C(-29754), INT16_C(  5568),
+                            INT16_C(   604), INT16_C( 16872), INT16_C( 14164), INT16_C(  6582),
+                            INT16_C( 16754), INT16_C(  6191), INT16_C(  8296), INT16_C(-25534),
+                            INT16_C( 31637), INT16_C(-19404), INT16_C(  3654), INT16_C(-14864)) },
+    { simde_mm256_set_epi16(INT16_C(-19761), INT16_C(-12232), INT16_C(-28359), INT16_C( 19440),
+                            INT16_C(-20615), INT16_C(-17673), INT16_C( 27469), INT16_C(  5014),
+                            INT16_C(-18488), INT16_C(  8792), INT16_C( 18109), INT16_C(-29455),
+                            INT16_C( -1837), INT16_C(-22480), INT16_C(-32364), INT16_C(-29244)),
+      simde_mm256_set_epi16(INT16_C(  6534), INT16_C( 10457), INT16_C( 28564), INT16_C( 14970),
+                            INT16_C(-14039), INT16_C(-31210), INT16_C(-31955), INT16_C(-16842),
+                            INT16_C( 12392), INT16_C( 18464), INT16_C( 15984), INT16_C( 22671),
+                            INT16_C(-25421), INT16_C(-18356), INT16_C(-10830), INT16_C( 21651)),
+      simde_mm256_set_epi16(INT16_C(-12454), INT16_C( 16248), INT16_C(-21516), INT16_C(-28576),
+                            INT16_C(  7009), INT16_C( 23354), INT16_C( 17289), INT16_C( 30116),
+                            INT16_C( 10560), INT16_C(  2816), INT16_C(-18256), INT16_C(-28001),
+                            INT16_C(-28791), INT16_C( 28224), INT16_C( 15592), INT16_C(-18548)) },
+    { simde_mm256_set_epi16(INT16_C( 11302), INT16_C( 27835), INT16_C( 19930), INT16_C( 30816),
+                            INT16_C(-26353), INT16_C( 31613), INT16_C(-26439), INT16_C(  7507),
+                            INT16_C(-11188), INT16_C(   -44), INT16_C(-12862), INT16_C( 28720),
+                            INT16_C( 28254), INT16_C(-18161), INT16_C(-15270), INT16_C( 24203)),
+      simde_mm256_set_epi16(INT16_C( 29732), INT16_C(  1779), INT16_C(-14165), INT16_C( 17846),
+                            INT16_C(  9975), INT16_C(-31553), INT16_C( 13589), INT16_C(-32059),
+                            INT16_C(  3887), INT16_C( 17773), INT16_C(-11521), INT16_C( 27427),
+                            INT16_C(  5997), INT16_C(-11716), INT16_C( -6325), INT16_C(  8620)),
+      simde_mm256_set_epi16(INT16_C( 27992), INT16_C(-26751), INT16_C( 20638), INT16_C( 29760),
+                            INT16_C( -6279), INT16_C(-27069), INT16_C(-11219), INT16_C(-18721),
+                            INT16_C( 28148), INT16_C(  4420), INT16_C(  6206), INT16_C( 26256),
+                            INT16_C( 28678), INT16_C(-21116), INT16_C(-17314), INT16_C( 28772)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mullo_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mullo_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( 2035373361), INT32_C(  697601347), INT32_C(-1100033108), INT32_C(  446661232),
+                            INT32_C( 1048792448), INT32_C(  881432606), INT32_C( 1693693601), INT32_C(  153161696)),
+      simde_mm256_set_epi32(INT32_C(-1766215588), INT32_C( 1348355279), INT32_C( -498316557), INT32_C(  971521713),
+                            INT32_C(  286465297), INT32_C(  796976973), INT32_C(   94031322), INT32_C(  945953409)),
+      simde_mm256_set_epi32(INT32_C( -902476388), INT32_C( -482474707), INT32_C( 2071110724), INT32_C(  794840944),
+                            INT32_C( 1191159168), INT32_C(-2035952890), INT32_C(  581071386), INT32_C(  151371744)) },
+    { simde_mm256_set_epi32(INT32_C( 1771634035), INT32_C( -167321146), INT32_C( 1692121293), INT32_C( 1972171109),
+                            INT32_C( 1429569476), INT32_C( 1186278370), INT32_C( -136966947), INT32_C(-1206641977)),
+      simde_mm256_set_epi32(INT32_C( -833216466), INT32_C( 1053651914), INT32_C(   -2067390), INT32_C(-1545590027),
+                            INT32_C(-2042475383), INT32_C( 1408273165), INT32_C(  461695783), INT32_C(-1496461069)),
+      simde_mm256_set_epi32(INT32_C( -942806358), INT32_C( -127395780), INT32_C( 1992460506), INT32_C(  652056489),
+                            INT32_C(   68653028), INT32_C( 1608970362), INT32_C(  811521195), INT32_C(-1942873371)) },
+    { simde_mm256_set_epi32(INT32_C( -409413144), INT32_C( 1589192001), INT32_C(  388999766), INT32_C(-1745585594),
+                            INT32_C(-1651074088), INT32_C(-1521096003), INT32_C( -903808128), INT32_C( -608529539)),
+      simde_mm256_set_epi32(INT32_C( 1491459735), INT32_C( 1269700839), INT32_C(  665985671), INT32_C( -733688049),
+                            INT32_C(  -92750067), INT32_C(-1497131978), INT32_C( -546098286), INT32_C(  654032462)),
+      simde_mm256_set_epi32(INT32_C( -727205928), INT32_C(  834450855), INT32_C(  411975514), INT32_C(  147440666),
+                            INT32_C( 1546392056), INT32_C( -406075426), INT32_C( 1399451392), INT32_C(-1780566506)) },
+    { simde_mm256_set_epi32(INT32_C( -250148065), INT32_C(-1199219310), INT32_C(-1754678037), INT32_C( -262641485),
+                            INT32_C( 2104877086), INT32_C(  -71633145), INT32_C(-1329225577), INT32_C(  864878512)),
+      simde_mm256_set_epi32(INT32_C(  832982066), INT32_C(-1557667220), INT32_C(-2095107307), INT32_C( 1671037006),
+                            INT32_C( 1490543335), INT32_C(  220808009), INT32_C(-1734385307), INT32_C( -164753912)),
+      simde_mm256_set_epi32(INT32_C(  317153294), INT32_C( -870556264), INT32_C(-1648078777), INT32_C( 1872619146),
+                            INT32_C( -831932654), INT32_C(-1575598593), INT32_C(   94016147), INT32_C( 1677958528)) },
+    { simde_mm256_set_epi32(INT32_C( -895399083), INT32_C(-1398176073), INT32_C( -118927015), INT32_C( -632896532),
+                            INT32_C( 1107850792), INT32_C(  279574072), INT32_C( 1049070723), INT32_C( 1334075083)),
+      simde_mm256_set_epi32(INT32_C(-1826157116), INT32_C(-1857070608), INT32_C(-1023149510), INT32_C(  -35733582),
+                            INT32_C( 1251201118), INT32_C(-2049560433), INT32_C( 1292066776), INT32_C( -410233683)),
+      simde_mm256_set_epi32(INT32_C(-1656488428), INT32_C(  138209936), INT32_C(  -44541910), INT32_C(-1274458600),
+                            INT32_C(-2011962704), INT32_C(  401279304), INT32_C(  470559624), INT32_C(  798141231)) },
+    { simde_mm256_set_epi32(INT32_C(  466667970), INT32_C(-1249879962), INT32_C(-1960449823), INT32_C(-1869020178),
+                            INT32_C(-1619047081), INT32_C(-1763485240), INT32_C(   74862612), INT32_C(-2116798368)),
+      simde_mm256_set_epi32(INT32_C( -687615253), INT32_C(-1967033924), INT32_C( -913013973), INT32_C(  298886447),
+                            INT32_C( -467883114), INT32_C(-1789421488), INT32_C(  542422480), INT32_C( 1046784791)),
+      simde_mm256_set_epi32(INT32_C(  426793238), INT32_C(-1842614040), INT32_C(  278741195), INT32_C(  721428146),
+                            INT32_C( 1858366970), INT32_C(  257085056), INT32_C(  223294528), INT32_C(-1321652064)) },
+    { simde_mm256_set_epi32(INT32_C(-1272022381), INT32_C( 1597079560), INT32_C(  281363235), INT32_C(  361287146),
+                            INT32_C( 1489480331), INT32_C( 2072928901), INT32_C( 2042797452), INT32_C( 1284490848)),
+      simde_mm256_set_epi32(INT32_C( 1100100118), INT32_C( 1784152702), INT32_C(  351905842), INT32_C(   10040661),
+                            INT32_C( 1267266337), INT32_C( -934791090), INT32_C(   75743457), INT32_C( -156243203)),
+      simde_mm256_set_epi32(INT32_C( -893043038), INT32_C(-1877142544), INT32_C(-1012853546), INT32_C(-1981296462),
+                            INT32_C( 1266085099), INT32_C( 1750539398), INT32_C( -925272052), INT32_C( -250950432)) },
+    { simde_mm256_set_epi32(INT32_C( 1437235919), INT32_C(  771546411), INT32_C( -727231191), INT32_C(-1030648073),
+                            INT32_C(-2133375550), INT32_C( -236057050), INT32_C(-1022414039), INT32_C( 1468836649)),
+      simde_mm256_set_epi32(INT32_C( -226609070), INT32_C(  940183660), INT32_C(  105649405), INT32_C( -665562026),
+                            INT32_C(  754169458), INT32_C( -606826193), INT32_C(-1795720391), INT32_C(-1744517367)),
+      simde_mm256_set_epi32(INT32_C( -614818226), INT32_C( 1076756004), INT32_C( 2050121093), INT32_C( 1893405434),
+                            INT32_C(  -90506140), INT32_C( 2049974010), INT32_C( -863627487), INT32_C( 1906500465)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mullo_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitResult
 test_simde_mm256_or_si256(const MunitParameter params[], void* data) {
   (void) params;
@@ -5775,6 +9540,154 @@ test_simde_mm256_or_si256(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm256_packs_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C(   204), INT16_C(    -1), INT16_C(    82), INT16_C(    83),
+                            INT16_C(  -287), INT16_C(   274), INT16_C(  -274), INT16_C(   285),
+                            INT16_C(    67), INT16_C(  -148), INT16_C(    -9), INT16_C(  -274),
+                            INT16_C(   176), INT16_C(  -156), INT16_C(    58), INT16_C(     3)),
+      simde_mm256_set_epi16(INT16_C(  -141), INT16_C(  -209), INT16_C(    51), INT16_C(   208),
+                            INT16_C(     5), INT16_C(    33), INT16_C(  -193), INT16_C(  -118),
+                            INT16_C(  -207), INT16_C(   298), INT16_C(   -21), INT16_C(   229),
+                            INT16_C(   176), INT16_C(  -231), INT16_C(  -143), INT16_C(  -132)),
+      simde_mm256_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(  51), INT8_C( 127),
+                           INT8_C(   5), INT8_C(  33), INT8_C(-128), INT8_C(-118),
+                           INT8_C( 127), INT8_C(  -1), INT8_C(  82), INT8_C(  83),
+                           INT8_C(-128), INT8_C( 127), INT8_C(-128), INT8_C( 127),
+                           INT8_C(-128), INT8_C( 127), INT8_C( -21), INT8_C( 127),
+                           INT8_C( 127), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(  67), INT8_C(-128), INT8_C(  -9), INT8_C(-128),
+                           INT8_C( 127), INT8_C(-128), INT8_C(  58), INT8_C(   3)) },
+    { simde_mm256_set_epi16(INT16_C(   266), INT16_C(   163), INT16_C(  -147), INT16_C(  -212),
+                            INT16_C(   -27), INT16_C(  -132), INT16_C(    35), INT16_C(   -58),
+                            INT16_C(   -77), INT16_C(    55), INT16_C(  -122), INT16_C(  -216),
+                            INT16_C(    66), INT16_C(  -293), INT16_C(    91), INT16_C(   202)),
+      simde_mm256_set_epi16(INT16_C(   -58), INT16_C(   274), INT16_C(    -9), INT16_C(   138),
+                            INT16_C(    70), INT16_C(    73), INT16_C(   274), INT16_C(  -211),
+                            INT16_C(   246), INT16_C(  -126), INT16_C(  -227), INT16_C(   -26),
+                            INT16_C(  -167), INT16_C(   153), INT16_C(    -9), INT16_C(   -40)),
+      simde_mm256_set_epi8(INT8_C( -58), INT8_C( 127), INT8_C(  -9), INT8_C( 127),
+                           INT8_C(  70), INT8_C(  73), INT8_C( 127), INT8_C(-128),
+                           INT8_C( 127), INT8_C( 127), INT8_C(-128), INT8_C(-128),
+                           INT8_C( -27), INT8_C(-128), INT8_C(  35), INT8_C( -58),
+                           INT8_C( 127), INT8_C(-126), INT8_C(-128), INT8_C( -26),
+                           INT8_C(-128), INT8_C( 127), INT8_C(  -9), INT8_C( -40),
+                           INT8_C( -77), INT8_C(  55), INT8_C(-122), INT8_C(-128),
+                           INT8_C(  66), INT8_C(-128), INT8_C(  91), INT8_C( 127)) },
+    { simde_mm256_set_epi16(INT16_C(    81), INT16_C(    78), INT16_C(   123), INT16_C(   265),
+                            INT16_C(   219), INT16_C(    17), INT16_C(   -29), INT16_C(   181),
+                            INT16_C(   149), INT16_C(  -161), INT16_C(   -67), INT16_C(   -94),
+                            INT16_C(  -163), INT16_C(  -162), INT16_C(   265), INT16_C(  -146)),
+      simde_mm256_set_epi16(INT16_C(    21), INT16_C(     0), INT16_C(   -50), INT16_C(  -190),
+                            INT16_C(  -157), INT16_C(   131), INT16_C(  -245), INT16_C(   -95),
+                            INT16_C(   292), INT16_C(  -281), INT16_C(   269), INT16_C(  -269),
+                            INT16_C(  -240), INT16_C(   231), INT16_C(   200), INT16_C(  -260)),
+      simde_mm256_set_epi8(INT8_C(  21), INT8_C(   0), INT8_C( -50), INT8_C(-128),
+                           INT8_C(-128), INT8_C( 127), INT8_C(-128), INT8_C( -95),
+                           INT8_C(  81), INT8_C(  78), INT8_C( 123), INT8_C( 127),
+                           INT8_C( 127), INT8_C(  17), INT8_C( -29), INT8_C( 127),
+                           INT8_C( 127), INT8_C(-128), INT8_C( 127), INT8_C(-128),
+                           INT8_C(-128), INT8_C( 127), INT8_C( 127), INT8_C(-128),
+                           INT8_C( 127), INT8_C(-128), INT8_C( -67), INT8_C( -94),
+                           INT8_C(-128), INT8_C(-128), INT8_C( 127), INT8_C(-128)) },
+    { simde_mm256_set_epi16(INT16_C(   285), INT16_C(   249), INT16_C(   272), INT16_C(  -118),
+                            INT16_C(  -214), INT16_C(   -90), INT16_C(  -128), INT16_C(   113),
+                            INT16_C(   100), INT16_C(   -15), INT16_C(  -204), INT16_C(    17),
+                            INT16_C(   122), INT16_C(  -151), INT16_C(    52), INT16_C(   290)),
+      simde_mm256_set_epi16(INT16_C(   -61), INT16_C(    26), INT16_C(   -76), INT16_C(  -176),
+                            INT16_C(  -234), INT16_C(    86), INT16_C(  -213), INT16_C(   -24),
+                            INT16_C(    95), INT16_C(   -62), INT16_C(  -148), INT16_C(  -239),
+                            INT16_C(  -115), INT16_C(   276), INT16_C(   297), INT16_C(  -228)),
+      simde_mm256_set_epi8(INT8_C( -61), INT8_C(  26), INT8_C( -76), INT8_C(-128),
+                           INT8_C(-128), INT8_C(  86), INT8_C(-128), INT8_C( -24),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C(-118),
+                           INT8_C(-128), INT8_C( -90), INT8_C(-128), INT8_C( 113),
+                           INT8_C(  95), INT8_C( -62), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-115), INT8_C( 127), INT8_C( 127), INT8_C(-128),
+                           INT8_C( 100), INT8_C( -15), INT8_C(-128), INT8_C(  17),
+                           INT8_C( 122), INT8_C(-128), INT8_C(  52), INT8_C( 127)) },
+    { simde_mm256_set_epi16(INT16_C(  -132), INT16_C(   -37), INT16_C(   100), INT16_C(  -104),
+                            INT16_C(  -101), INT16_C(  -179), INT16_C(     8), INT16_C(   130),
+                            INT16_C(  -278), INT16_C(     7), INT16_C(    37), INT16_C(  -129),
+                            INT16_C(    -7), INT16_C(  -253), INT16_C(   127), INT16_C(  -102)),
+      simde_mm256_set_epi16(INT16_C(   266), INT16_C(  -178), INT16_C(  -206), INT16_C(   -22),
+                            INT16_C(    14), INT16_C(  -129), INT16_C(  -271), INT16_C(    -2),
+                            INT16_C(  -198), INT16_C(    55), INT16_C(    78), INT16_C(   -64),
+                            INT16_C(  -277), INT16_C(   273), INT16_C(  -252), INT16_C(   245)),
+      simde_mm256_set_epi8(INT8_C( 127), INT8_C(-128), INT8_C(-128), INT8_C( -22),
+                           INT8_C(  14), INT8_C(-128), INT8_C(-128), INT8_C(  -2),
+                           INT8_C(-128), INT8_C( -37), INT8_C( 100), INT8_C(-104),
+                           INT8_C(-101), INT8_C(-128), INT8_C(   8), INT8_C( 127),
+                           INT8_C(-128), INT8_C(  55), INT8_C(  78), INT8_C( -64),
+                           INT8_C(-128), INT8_C( 127), INT8_C(-128), INT8_C( 127),
+                           INT8_C(-128), INT8_C(   7), INT8_C(  37), INT8_C(-128),
+                           INT8_C(  -7), INT8_C(-128), INT8_C( 127), INT8_C(-102)) },
+    { simde_mm256_set_epi16(INT16_C(   -25), INT16_C(   105), INT16_C(    60), INT16_C(   -24),
+                            INT16_C(   166), INT16_C(   282), INT16_C(   -90), INT16_C(   289),
+                            INT16_C(  -113), INT16_C(   280), INT16_C(    84), INT16_C(  -130),
+                            INT16_C(   224), INT16_C(   215), INT16_C(  -176), INT16_C(    76)),
+      simde_mm256_set_epi16(INT16_C(    54), INT16_C(   -98), INT16_C(   223), INT16_C(   259),
+                            INT16_C(   231), INT16_C(   154), INT16_C(   -36), INT16_C(   268),
+                            INT16_C(   -47), INT16_C(  -127), INT16_C(    39), INT16_C(  -214),
+                            INT16_C(  -278), INT16_C(   119), INT16_C(  -232), INT16_C(  -296)),
+      simde_mm256_set_epi8(INT8_C(  54), INT8_C( -98), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( -36), INT8_C( 127),
+                           INT8_C( -25), INT8_C( 105), INT8_C(  60), INT8_C( -24),
+                           INT8_C( 127), INT8_C( 127), INT8_C( -90), INT8_C( 127),
+                           INT8_C( -47), INT8_C(-127), INT8_C(  39), INT8_C(-128),
+                           INT8_C(-128), INT8_C( 119), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-113), INT8_C( 127), INT8_C(  84), INT8_C(-128),
+                           INT8_C( 127), INT8_C( 127), INT8_C(-128), INT8_C(  76)) },
+    { simde_mm256_set_epi16(INT16_C(   135), INT16_C(   -49), INT16_C(  -232), INT16_C(  -230),
+                            INT16_C(  -219), INT16_C(   118), INT16_C(   157), INT16_C(   216),
+                            INT16_C(    66), INT16_C(    67), INT16_C(   290), INT16_C(   165),
+                            INT16_C(     9), INT16_C(  -234), INT16_C(   225), INT16_C(  -136)),
+      simde_mm256_set_epi16(INT16_C(   -22), INT16_C(    28), INT16_C(     9), INT16_C(  -273),
+                            INT16_C(   116), INT16_C(  -147), INT16_C(   120), INT16_C(    12),
+                            INT16_C(   140), INT16_C(   271), INT16_C(   293), INT16_C(   168),
+                            INT16_C(    51), INT16_C(  -146), INT16_C(   -49), INT16_C(   -60)),
+      simde_mm256_set_epi8(INT8_C( -22), INT8_C(  28), INT8_C(   9), INT8_C(-128),
+                           INT8_C( 116), INT8_C(-128), INT8_C( 120), INT8_C(  12),
+                           INT8_C( 127), INT8_C( -49), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C( 118), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C(  51), INT8_C(-128), INT8_C( -49), INT8_C( -60),
+                           INT8_C(  66), INT8_C(  67), INT8_C( 127), INT8_C( 127),
+                           INT8_C(   9), INT8_C(-128), INT8_C( 127), INT8_C(-128)) },
+    { simde_mm256_set_epi16(INT16_C(   120), INT16_C(  -126), INT16_C(    67), INT16_C(  -129),
+                            INT16_C(    11), INT16_C(  -166), INT16_C(    55), INT16_C(   -13),
+                            INT16_C(   263), INT16_C(   -90), INT16_C(   163), INT16_C(   131),
+                            INT16_C(   121), INT16_C(    14), INT16_C(   199), INT16_C(   237)),
+      simde_mm256_set_epi16(INT16_C(   149), INT16_C(   -19), INT16_C(  -286), INT16_C(    95),
+                            INT16_C(    98), INT16_C(  -197), INT16_C(   205), INT16_C(   256),
+                            INT16_C(   219), INT16_C(     5), INT16_C(  -140), INT16_C(   235),
+                            INT16_C(  -160), INT16_C(  -179), INT16_C(  -145), INT16_C(  -210)),
+      simde_mm256_set_epi8(INT8_C( 127), INT8_C( -19), INT8_C(-128), INT8_C(  95),
+                           INT8_C(  98), INT8_C(-128), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 120), INT8_C(-126), INT8_C(  67), INT8_C(-128),
+                           INT8_C(  11), INT8_C(-128), INT8_C(  55), INT8_C( -13),
+                           INT8_C( 127), INT8_C(   5), INT8_C(-128), INT8_C( 127),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C( 127), INT8_C( -90), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 121), INT8_C(  14), INT8_C( 127), INT8_C( 127)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_packs_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitResult
 test_simde_mm256_packs_epi32(const MunitParameter params[], void* data) {
   (void) params;
@@ -5859,6 +9772,238 @@ test_simde_mm256_packs_epi32(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm256_packus_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C(    60), INT16_C(  -132), INT16_C(   344), INT16_C(  -191),
+                            INT16_C(   -50), INT16_C(  -233), INT16_C(  -321), INT16_C(  -375),
+                            INT16_C(   169), INT16_C(    20), INT16_C(   268), INT16_C(   254),
+                            INT16_C(   145), INT16_C(   -79), INT16_C(   166), INT16_C(   316)),
+      simde_mm256_set_epi16(INT16_C(   104), INT16_C(   184), INT16_C(   266), INT16_C(  -232),
+                            INT16_C(   333), INT16_C(   101), INT16_C(   228), INT16_C(    36),
+                            INT16_C(  -230), INT16_C(   327), INT16_C(  -344), INT16_C(  -344),
+                            INT16_C(   349), INT16_C(   139), INT16_C(   225), INT16_C(    78)),
+      simde_x_mm256_set_epu8(UINT8_C(104), UINT8_C(184), UINT8_C(255), UINT8_C(  0),
+                             UINT8_C(255), UINT8_C(101), UINT8_C(228), UINT8_C( 36),
+                             UINT8_C( 60), UINT8_C(  0), UINT8_C(255), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(255), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(255), UINT8_C(139), UINT8_C(225), UINT8_C( 78),
+                             UINT8_C(169), UINT8_C( 20), UINT8_C(255), UINT8_C(254),
+                             UINT8_C(145), UINT8_C(  0), UINT8_C(166), UINT8_C(255)) },
+    { simde_mm256_set_epi16(INT16_C(    14), INT16_C(  -284), INT16_C(  -120), INT16_C(    10),
+                            INT16_C(   209), INT16_C(   223), INT16_C(  -351), INT16_C(   -72),
+                            INT16_C(   330), INT16_C(  -130), INT16_C(   301), INT16_C(  -300),
+                            INT16_C(  -255), INT16_C(   141), INT16_C(   -23), INT16_C(   113)),
+      simde_mm256_set_epi16(INT16_C(    -9), INT16_C(  -147), INT16_C(  -359), INT16_C(    91),
+                            INT16_C(   162), INT16_C(   326), INT16_C(    51), INT16_C(   273),
+                            INT16_C(   290), INT16_C(  -273), INT16_C(   -82), INT16_C(  -351),
+                            INT16_C(   -98), INT16_C(  -176), INT16_C(  -377), INT16_C(    53)),
+      simde_x_mm256_set_epu8(UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 91),
+                             UINT8_C(162), UINT8_C(255), UINT8_C( 51), UINT8_C(255),
+                             UINT8_C( 14), UINT8_C(  0), UINT8_C(  0), UINT8_C( 10),
+                             UINT8_C(209), UINT8_C(223), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(255), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 53),
+                             UINT8_C(255), UINT8_C(  0), UINT8_C(255), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(141), UINT8_C(  0), UINT8_C(113)) },
+    { simde_mm256_set_epi16(INT16_C(    99), INT16_C(   271), INT16_C(  -353), INT16_C(   125),
+                            INT16_C(   221), INT16_C(   396), INT16_C(    79), INT16_C(  -227),
+                            INT16_C(   -30), INT16_C(   184), INT16_C(   295), INT16_C(   -64),
+                            INT16_C(   -37), INT16_C(    69), INT16_C(  -209), INT16_C(    76)),
+      simde_mm256_set_epi16(INT16_C(  -121), INT16_C(   326), INT16_C(    24), INT16_C(   -51),
+                            INT16_C(   348), INT16_C(   324), INT16_C(  -351), INT16_C(   109),
+                            INT16_C(  -222), INT16_C(   314), INT16_C(  -182), INT16_C(   303),
+                            INT16_C(   228), INT16_C(  -211), INT16_C(    49), INT16_C(  -214)),
+      simde_x_mm256_set_epu8(UINT8_C(  0), UINT8_C(255), UINT8_C( 24), UINT8_C(  0),
+                             UINT8_C(255), UINT8_C(255), UINT8_C(  0), UINT8_C(109),
+                             UINT8_C( 99), UINT8_C(255), UINT8_C(  0), UINT8_C(125),
+                             UINT8_C(221), UINT8_C(255), UINT8_C( 79), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(255), UINT8_C(  0), UINT8_C(255),
+                             UINT8_C(228), UINT8_C(  0), UINT8_C( 49), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(184), UINT8_C(255), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 76)) },
+    { simde_mm256_set_epi16(INT16_C(  -102), INT16_C(  -313), INT16_C(  -257), INT16_C(  -369),
+                            INT16_C(  -278), INT16_C(   349), INT16_C(   123), INT16_C(  -179),
+                            INT16_C(   210), INT16_C(  -226), INT16_C(  -177), INT16_C(  -104),
+                            INT16_C(   137), INT16_C(  -171), INT16_C(   372), INT16_C(  -213)),
+      simde_mm256_set_epi16(INT16_C(  -235), INT16_C(   155), INT16_C(  -240), INT16_C(  -268),
+                            INT16_C(   164), INT16_C(  -379), INT16_C(  -183), INT16_C(  -183),
+                            INT16_C(  -278), INT16_C(   -17), INT16_C(  -304), INT16_C(   316),
+                            INT16_C(   390), INT16_C(     1), INT16_C(  -324), INT16_C(   348)),
+      simde_x_mm256_set_epu8(UINT8_C(  0), UINT8_C(155), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(164), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(255), UINT8_C(123), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(255),
+                             UINT8_C(255), UINT8_C(  1), UINT8_C(  0), UINT8_C(255),
+                             UINT8_C(210), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(137), UINT8_C(  0), UINT8_C(255), UINT8_C(  0)) },
+    { simde_mm256_set_epi16(INT16_C(   282), INT16_C(  -289), INT16_C(   -46), INT16_C(  -284),
+                            INT16_C(   -73), INT16_C(  -362), INT16_C(   -56), INT16_C(    68),
+                            INT16_C(    42), INT16_C(   293), INT16_C(   -69), INT16_C(   136),
+                            INT16_C(  -395), INT16_C(   208), INT16_C(  -245), INT16_C(  -174)),
+      simde_mm256_set_epi16(INT16_C(  -350), INT16_C(  -322), INT16_C(  -294), INT16_C(  -370),
+                            INT16_C(    -4), INT16_C(   322), INT16_C(  -334), INT16_C(  -305),
+                            INT16_C(   383), INT16_C(    52), INT16_C(   298), INT16_C(  -207),
+                            INT16_C(  -395), INT16_C(   185), INT16_C(    84), INT16_C(   241)),
+      simde_x_mm256_set_epu8(UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(255), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(255), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 68),
+                             UINT8_C(255), UINT8_C( 52), UINT8_C(255), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(185), UINT8_C( 84), UINT8_C(241),
+                             UINT8_C( 42), UINT8_C(255), UINT8_C(  0), UINT8_C(136),
+                             UINT8_C(  0), UINT8_C(208), UINT8_C(  0), UINT8_C(  0)) },
+    { simde_mm256_set_epi16(INT16_C(  -109), INT16_C(   227), INT16_C(   302), INT16_C(  -369),
+                            INT16_C(   386), INT16_C(   304), INT16_C(  -324), INT16_C(    64),
+                            INT16_C(   394), INT16_C(  -223), INT16_C(   140), INT16_C(  -179),
+                            INT16_C(  -235), INT16_C(    18), INT16_C(   240), INT16_C(  -254)),
+      simde_mm256_set_epi16(INT16_C(   -59), INT16_C(   182), INT16_C(   295), INT16_C(    81),
+                            INT16_C(   139), INT16_C(   346), INT16_C(   134), INT16_C(   -98),
+                            INT16_C(   139), INT16_C(   329), INT16_C(  -266), INT16_C(   278),
+                            INT16_C(  -250), INT16_C(  -170), INT16_C(  -111), INT16_C(  -309)),
+      simde_x_mm256_set_epu8(UINT8_C(  0), UINT8_C(182), UINT8_C(255), UINT8_C( 81),
+                             UINT8_C(139), UINT8_C(255), UINT8_C(134), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(227), UINT8_C(255), UINT8_C(  0),
+                             UINT8_C(255), UINT8_C(255), UINT8_C(  0), UINT8_C( 64),
+                             UINT8_C(139), UINT8_C(255), UINT8_C(  0), UINT8_C(255),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(255), UINT8_C(  0), UINT8_C(140), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C( 18), UINT8_C(240), UINT8_C(  0)) },
+    { simde_mm256_set_epi16(INT16_C(   180), INT16_C(  -375), INT16_C(  -209), INT16_C(  -347),
+                            INT16_C(  -343), INT16_C(   -14), INT16_C(    97), INT16_C(  -344),
+                            INT16_C(   202), INT16_C(   334), INT16_C(    15), INT16_C(   -59),
+                            INT16_C(  -181), INT16_C(  -174), INT16_C(    79), INT16_C(   235)),
+      simde_mm256_set_epi16(INT16_C(   153), INT16_C(   357), INT16_C(   328), INT16_C(    61),
+                            INT16_C(   236), INT16_C(   385), INT16_C(  -110), INT16_C(  -299),
+                            INT16_C(   204), INT16_C(  -285), INT16_C(   293), INT16_C(  -186),
+                            INT16_C(  -159), INT16_C(  -151), INT16_C(   322), INT16_C(   391)),
+      simde_x_mm256_set_epu8(UINT8_C(153), UINT8_C(255), UINT8_C(255), UINT8_C( 61),
+                             UINT8_C(236), UINT8_C(255), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(180), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C( 97), UINT8_C(  0),
+                             UINT8_C(204), UINT8_C(  0), UINT8_C(255), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C(255), UINT8_C(255),
+                             UINT8_C(202), UINT8_C(255), UINT8_C( 15), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(  0), UINT8_C( 79), UINT8_C(235)) },
+    { simde_mm256_set_epi16(INT16_C(   221), INT16_C(  -374), INT16_C(   -23), INT16_C(   -11),
+                            INT16_C(  -237), INT16_C(    64), INT16_C(   -79), INT16_C(  -175),
+                            INT16_C(  -284), INT16_C(    18), INT16_C(  -368), INT16_C(   130),
+                            INT16_C(  -120), INT16_C(   100), INT16_C(  -381), INT16_C(  -222)),
+      simde_mm256_set_epi16(INT16_C(  -398), INT16_C(  -385), INT16_C(   218), INT16_C(   -37),
+                            INT16_C(  -352), INT16_C(   305), INT16_C(  -196), INT16_C(   164),
+                            INT16_C(  -118), INT16_C(   345), INT16_C(  -105), INT16_C(   158),
+                            INT16_C(  -250), INT16_C(    97), INT16_C(   -93), INT16_C(   394)),
+      simde_x_mm256_set_epu8(UINT8_C(  0), UINT8_C(  0), UINT8_C(218), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(255), UINT8_C(  0), UINT8_C(164),
+                             UINT8_C(221), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0),
+                             UINT8_C(  0), UINT8_C(255), UINT8_C(  0), UINT8_C(158),
+                             UINT8_C(  0), UINT8_C( 97), UINT8_C(  0), UINT8_C(255),
+                             UINT8_C(  0), UINT8_C( 18), UINT8_C(  0), UINT8_C(130),
+                             UINT8_C(  0), UINT8_C(100), UINT8_C(  0), UINT8_C(  0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_packus_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_packus_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(      35715), INT32_C(      54287), INT32_C(     -89189), INT32_C(      39280),
+                            INT32_C(      12366), INT32_C(       3976), INT32_C(      14453), INT32_C(      98038)),
+      simde_mm256_set_epi32(INT32_C(      98015), INT32_C(      55744), INT32_C(      68317), INT32_C(      82549),
+                            INT32_C(      41249), INT32_C(      91560), INT32_C(      70175), INT32_C(     -15478)),
+      simde_x_mm256_set_epu16(UINT16_C(65535), UINT16_C(55744), UINT16_C(65535), UINT16_C(65535),
+                              UINT16_C(35715), UINT16_C(54287), UINT16_C(    0), UINT16_C(39280),
+                              UINT16_C(41249), UINT16_C(65535), UINT16_C(65535), UINT16_C(    0),
+                              UINT16_C(12366), UINT16_C( 3976), UINT16_C(14453), UINT16_C(65535)) },
+    { simde_mm256_set_epi32(INT32_C(      58500), INT32_C(      37403), INT32_C(      33899), INT32_C(     -32408),
+                            INT32_C(      22123), INT32_C(      96265), INT32_C(     -71554), INT32_C(      47558)),
+      simde_mm256_set_epi32(INT32_C(      11329), INT32_C(      26452), INT32_C(      -2949), INT32_C(      74566),
+                            INT32_C(      51390), INT32_C(      11474), INT32_C(     -55393), INT32_C(      49805)),
+      simde_x_mm256_set_epu16(UINT16_C(11329), UINT16_C(26452), UINT16_C(    0), UINT16_C(65535),
+                              UINT16_C(58500), UINT16_C(37403), UINT16_C(33899), UINT16_C(    0),
+                              UINT16_C(51390), UINT16_C(11474), UINT16_C(    0), UINT16_C(49805),
+                              UINT16_C(22123), UINT16_C(65535), UINT16_C(    0), UINT16_C(47558)) },
+    { simde_mm256_set_epi32(INT32_C(     -69605), INT32_C(      17658), INT32_C(      99668), INT32_C(      39007),
+                            INT32_C(      96675), INT32_C(      39003), INT32_C(     -11564), INT32_C(      88686)),
+      simde_mm256_set_epi32(INT32_C(      92198), INT32_C(     -76435), INT32_C(      -4171), INT32_C(      -7129),
+                            INT32_C(       2314), INT32_C(     -40743), INT32_C(     -99008), INT32_C(      62888)),
+      simde_x_mm256_set_epu16(UINT16_C(65535), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                              UINT16_C(    0), UINT16_C(17658), UINT16_C(65535), UINT16_C(39007),
+                              UINT16_C( 2314), UINT16_C(    0), UINT16_C(    0), UINT16_C(62888),
+                              UINT16_C(65535), UINT16_C(39003), UINT16_C(    0), UINT16_C(65535)) },
+    { simde_mm256_set_epi32(INT32_C(     -41603), INT32_C(     -52951), INT32_C(      69646), INT32_C(      46477),
+                            INT32_C(     -65319), INT32_C(     -87435), INT32_C(      26579), INT32_C(      57111)),
+      simde_mm256_set_epi32(INT32_C(     -95591), INT32_C(     -97014), INT32_C(      45896), INT32_C(     -80914),
+                            INT32_C(      -2145), INT32_C(      72817), INT32_C(     -47519), INT32_C(     -82166)),
+      simde_x_mm256_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(45896), UINT16_C(    0),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C(65535), UINT16_C(46477),
+                              UINT16_C(    0), UINT16_C(65535), UINT16_C(    0), UINT16_C(    0),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C(26579), UINT16_C(57111)) },
+    { simde_mm256_set_epi32(INT32_C(      35266), INT32_C(      30717), INT32_C(      72208), INT32_C(      72274),
+                            INT32_C(     -79356), INT32_C(     -42936), INT32_C(      85488), INT32_C(       3409)),
+      simde_mm256_set_epi32(INT32_C(     -90144), INT32_C(     -13787), INT32_C(     -74658), INT32_C(     -73936),
+                            INT32_C(     -46871), INT32_C(     -94045), INT32_C(      89133), INT32_C(      41844)),
+      simde_x_mm256_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                              UINT16_C(35266), UINT16_C(30717), UINT16_C(65535), UINT16_C(65535),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C(65535), UINT16_C(41844),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C(65535), UINT16_C( 3409)) },
+    { simde_mm256_set_epi32(INT32_C(     -22751), INT32_C(     -13293), INT32_C(     -83614), INT32_C(     -13220),
+                            INT32_C(     -72067), INT32_C(      22531), INT32_C(     -21061), INT32_C(      42911)),
+      simde_mm256_set_epi32(INT32_C(       6379), INT32_C(     -22141), INT32_C(     -82487), INT32_C(      -2937),
+                            INT32_C(     -99485), INT32_C(      47242), INT32_C(     -69051), INT32_C(      92847)),
+      simde_x_mm256_set_epu16(UINT16_C( 6379), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                              UINT16_C(    0), UINT16_C(47242), UINT16_C(    0), UINT16_C(65535),
+                              UINT16_C(    0), UINT16_C(22531), UINT16_C(    0), UINT16_C(42911)) },
+    { simde_mm256_set_epi32(INT32_C(      39095), INT32_C(     -18975), INT32_C(       6660), INT32_C(       5673),
+                            INT32_C(     -32412), INT32_C(     -10627), INT32_C(     -27598), INT32_C(       8881)),
+      simde_mm256_set_epi32(INT32_C(     -81583), INT32_C(      86419), INT32_C(     -95744), INT32_C(      52474),
+                            INT32_C(     -49482), INT32_C(     -78550), INT32_C(       1913), INT32_C(     -42025)),
+      simde_x_mm256_set_epu16(UINT16_C(    0), UINT16_C(65535), UINT16_C(    0), UINT16_C(52474),
+                              UINT16_C(39095), UINT16_C(    0), UINT16_C( 6660), UINT16_C( 5673),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C( 1913), UINT16_C(    0),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 8881)) },
+    { simde_mm256_set_epi32(INT32_C(      91496), INT32_C(      18327), INT32_C(      39474), INT32_C(     -84862),
+                            INT32_C(     -48009), INT32_C(     -93811), INT32_C(      17538), INT32_C(     -88546)),
+      simde_mm256_set_epi32(INT32_C(     -36232), INT32_C(      73985), INT32_C(      73494), INT32_C(      67391),
+                            INT32_C(      88383), INT32_C(      10524), INT32_C(      39517), INT32_C(     -40955)),
+      simde_x_mm256_set_epu16(UINT16_C(    0), UINT16_C(65535), UINT16_C(65535), UINT16_C(65535),
+                              UINT16_C(65535), UINT16_C(18327), UINT16_C(39474), UINT16_C(    0),
+                              UINT16_C(65535), UINT16_C(10524), UINT16_C(39517), UINT16_C(    0),
+                              UINT16_C(    0), UINT16_C(    0), UINT16_C(17538), UINT16_C(    0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_packus_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitResult
 test_simde_mm256_permute4x64_epi64(const MunitParameter params[], void* data) {
   (void) params;
@@ -5910,6 +10055,238 @@ test_simde_mm256_permute4x64_epi64(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm256_permutevar8x32_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i idx;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(-1026728657), INT32_C( -332870341), INT32_C(  628738795), INT32_C(-1608598080),
+                            INT32_C(  954310678), INT32_C( -175064114), INT32_C( 1489060294), INT32_C( -812509102)),
+      simde_mm256_set_epi32(INT32_C( -779954776), INT32_C(-1343201170), INT32_C(-1891131773), INT32_C( -228953381),
+                            INT32_C( 1738673246), INT32_C(-1010540913), INT32_C(  831436238), INT32_C( 1857281225)),
+      simde_mm256_set_epi32(INT32_C( -812509102), INT32_C( -332870341), INT32_C(  954310678), INT32_C(  954310678),
+                            INT32_C( -332870341), INT32_C(-1026728657), INT32_C( -332870341), INT32_C( 1489060294)) },
+    { simde_mm256_set_epi32(INT32_C( 1198384670), INT32_C( 1992281845), INT32_C(-1361581381), INT32_C(  333111220),
+                            INT32_C(-1043192800), INT32_C(  348483963), INT32_C(-1940228520), INT32_C( -478299592)),
+      simde_mm256_set_epi32(INT32_C( -629350446), INT32_C(  380461018), INT32_C(-1590574875), INT32_C(-1409142629),
+                            INT32_C(-1236606050), INT32_C(-1249614667), INT32_C(-1907069713), INT32_C(-1495680341)),
+      simde_mm256_set_epi32(INT32_C(  348483963), INT32_C(  348483963), INT32_C(-1361581381), INT32_C(-1043192800),
+                            INT32_C( 1992281845), INT32_C(-1361581381), INT32_C( 1198384670), INT32_C(-1043192800)) },
+    { simde_mm256_set_epi32(INT32_C( 1355632389), INT32_C( 1403693859), INT32_C( 1303519788), INT32_C(  886544896),
+                            INT32_C( 1750241746), INT32_C( -136962365), INT32_C(-2105301456), INT32_C( 1120397981)),
+      simde_mm256_set_epi32(INT32_C( 2122948821), INT32_C( 2143423731), INT32_C( -770671588), INT32_C(-1589517220),
+                            INT32_C( 1688309911), INT32_C(  864747351), INT32_C( 1868379536), INT32_C(-1414595092)),
+      simde_mm256_set_epi32(INT32_C( 1303519788), INT32_C( 1750241746), INT32_C(  886544896), INT32_C(  886544896),
+                            INT32_C( 1355632389), INT32_C( 1355632389), INT32_C( 1120397981), INT32_C(  886544896)) },
+    { simde_mm256_set_epi32(INT32_C(  600476529), INT32_C( 1259944769), INT32_C(-1036465913), INT32_C(  804970480),
+                            INT32_C( 1655013960), INT32_C( 1660915326), INT32_C(-1217816427), INT32_C( -764403650)),
+      simde_mm256_set_epi32(INT32_C(  -26439778), INT32_C(  313255629), INT32_C(-1394522253), INT32_C( -990832746),
+                            INT32_C(-1979808957), INT32_C(  192533056), INT32_C( -810247871), INT32_C( 1598622561)),
+      simde_mm256_set_epi32(INT32_C( 1259944769), INT32_C(-1036465913), INT32_C( 1655013960), INT32_C( 1259944769),
+                            INT32_C( 1655013960), INT32_C( -764403650), INT32_C(-1217816427), INT32_C(-1217816427)) },
+    { simde_mm256_set_epi32(INT32_C(-1746009582), INT32_C(   11868955), INT32_C( 1633388233), INT32_C(  231506815),
+                            INT32_C( 1797640256), INT32_C(   41351130), INT32_C(  377869021), INT32_C( 1932349717)),
+      simde_mm256_set_epi32(INT32_C(-1351634912), INT32_C( -707259761), INT32_C( -553926626), INT32_C(  578192743),
+                            INT32_C(-1365698695), INT32_C(-1034758202), INT32_C( 2062240230), INT32_C(-1679927756)),
+      simde_mm256_set_epi32(INT32_C( 1932349717), INT32_C(-1746009582), INT32_C(   11868955), INT32_C(-1746009582),
+                            INT32_C(  377869021), INT32_C(   11868955), INT32_C(   11868955), INT32_C(  231506815)) },
+    { simde_mm256_set_epi32(INT32_C( 1720915247), INT32_C( -455907380), INT32_C( -346821506), INT32_C( -781241392),
+                            INT32_C( -641335226), INT32_C( -676284960), INT32_C( -251166698), INT32_C( -740388460)),
+      simde_mm256_set_epi32(INT32_C(  156963171), INT32_C( -354819941), INT32_C( 1230728537), INT32_C( -154709574),
+                            INT32_C( 1479803615), INT32_C(-1966518802), INT32_C( -785127874), INT32_C( 1291653630)),
+      simde_mm256_set_epi32(INT32_C( -641335226), INT32_C( -641335226), INT32_C( -251166698), INT32_C( -676284960),
+                            INT32_C( 1720915247), INT32_C( -455907380), INT32_C( -455907380), INT32_C( -455907380)) },
+    { simde_mm256_set_epi32(INT32_C(  319114539), INT32_C(-1026197701), INT32_C(  721503531), INT32_C( 1194030407),
+                            INT32_C(  290307323), INT32_C(   56357958), INT32_C(  576641281), INT32_C( 1594969367)),
+      simde_mm256_set_epi32(INT32_C(  335315785), INT32_C(-1600401777), INT32_C(  133706352), INT32_C( -549639294),
+                            INT32_C( -478823293), INT32_C( 1362856014), INT32_C( 1814068913), INT32_C(   99674887)),
+      simde_mm256_set_epi32(INT32_C(  576641281), INT32_C(  319114539), INT32_C( 1594969367), INT32_C(   56357958),
+                            INT32_C(  290307323), INT32_C(-1026197701), INT32_C(  576641281), INT32_C(  319114539)) },
+    { simde_mm256_set_epi32(INT32_C( -999539507), INT32_C(  -55759065), INT32_C( -426257695), INT32_C(  769675868),
+                            INT32_C( 1792741243), INT32_C(-2112299259), INT32_C(-1530061441), INT32_C(-1393821989)),
+      simde_mm256_set_epi32(INT32_C(  308972536), INT32_C( -134451140), INT32_C( 1423263569), INT32_C(-1528044383),
+                            INT32_C( 1459841825), INT32_C( 1307501361), INT32_C(  723224267), INT32_C( 1036549789)),
+      simde_mm256_set_epi32(INT32_C(-1393821989), INT32_C(  769675868), INT32_C(-1530061441), INT32_C(-1530061441),
+                            INT32_C(-1530061441), INT32_C(-1530061441), INT32_C( 1792741243), INT32_C( -426257695)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_permutevar8x32_epi32(test_vec[i].a, test_vec[i].idx);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sad_epu8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_x_mm256_set_epu8(UINT8_C( 71), UINT8_C(168), UINT8_C( 18), UINT8_C(133),
+                             UINT8_C(184), UINT8_C(110), UINT8_C(249), UINT8_C(190),
+                             UINT8_C( 64), UINT8_C(159), UINT8_C(250), UINT8_C(249),
+                             UINT8_C( 35), UINT8_C(138), UINT8_C( 50), UINT8_C(201),
+                             UINT8_C( 53), UINT8_C( 11), UINT8_C( 31), UINT8_C(109),
+                             UINT8_C(130), UINT8_C(104), UINT8_C( 94), UINT8_C(149),
+                             UINT8_C( 95), UINT8_C(248), UINT8_C(135), UINT8_C(188),
+                             UINT8_C(112), UINT8_C( 60), UINT8_C( 52), UINT8_C(233)),
+      simde_x_mm256_set_epu8(UINT8_C(108), UINT8_C(223), UINT8_C(121), UINT8_C(248),
+                             UINT8_C(147), UINT8_C(250), UINT8_C(114), UINT8_C( 70),
+                             UINT8_C( 60), UINT8_C( 58), UINT8_C(233), UINT8_C(170),
+                             UINT8_C(173), UINT8_C( 65), UINT8_C(252), UINT8_C( 92),
+                             UINT8_C(229), UINT8_C( 97), UINT8_C( 19), UINT8_C(115),
+                             UINT8_C(202), UINT8_C( 56), UINT8_C( 64), UINT8_C(137),
+                             UINT8_C(132), UINT8_C(137), UINT8_C( 69), UINT8_C( 85),
+                             UINT8_C( 95), UINT8_C( 29), UINT8_C(152), UINT8_C(131)),
+      simde_x_mm256_set_epu64x(UINT64_C(                 742), UINT64_C(                 723),
+                               UINT64_C(                 442), UINT64_C(                 567)) },
+    { simde_x_mm256_set_epu8(UINT8_C(144), UINT8_C(215), UINT8_C(105), UINT8_C(162),
+                             UINT8_C(183), UINT8_C( 95), UINT8_C( 61), UINT8_C(226),
+                             UINT8_C(223), UINT8_C( 49), UINT8_C( 85), UINT8_C(111),
+                             UINT8_C( 37), UINT8_C( 99), UINT8_C(158), UINT8_C(118),
+                             UINT8_C(181), UINT8_C(208), UINT8_C(165), UINT8_C(136),
+                             UINT8_C( 58), UINT8_C( 18), UINT8_C(237), UINT8_C( 51),
+                             UINT8_C( 79), UINT8_C( 99), UINT8_C(222), UINT8_C( 22),
+                             UINT8_C(251), UINT8_C(115), UINT8_C(236), UINT8_C( 32)),
+      simde_x_mm256_set_epu8(UINT8_C( 29), UINT8_C(123), UINT8_C(148), UINT8_C(133),
+                             UINT8_C( 71), UINT8_C(168), UINT8_C(237), UINT8_C(134),
+                             UINT8_C(209), UINT8_C(186), UINT8_C(251), UINT8_C(240),
+                             UINT8_C(231), UINT8_C( 61), UINT8_C(222), UINT8_C( 62),
+                             UINT8_C(153), UINT8_C(200), UINT8_C(155), UINT8_C( 15),
+                             UINT8_C(234), UINT8_C(133), UINT8_C( 17), UINT8_C( 39),
+                             UINT8_C(  7), UINT8_C( 19), UINT8_C(140), UINT8_C(159),
+                             UINT8_C(  1), UINT8_C(232), UINT8_C(143), UINT8_C(127)),
+      simde_x_mm256_set_epu64x(UINT64_C(                 732), UINT64_C(                 798),
+                               UINT64_C(                 690), UINT64_C(                 926)) },
+    { simde_x_mm256_set_epu8(UINT8_C(244), UINT8_C( 54), UINT8_C( 18), UINT8_C( 74),
+                             UINT8_C( 92), UINT8_C( 84), UINT8_C( 56), UINT8_C(  2),
+                             UINT8_C(223), UINT8_C( 97), UINT8_C(  9), UINT8_C( 83),
+                             UINT8_C(134), UINT8_C(219), UINT8_C(156), UINT8_C( 14),
+                             UINT8_C(137), UINT8_C(111), UINT8_C(166), UINT8_C( 28),
+                             UINT8_C( 48), UINT8_C( 42), UINT8_C(131), UINT8_C(134),
+                             UINT8_C( 42), UINT8_C( 44), UINT8_C(177), UINT8_C(220),
+                             UINT8_C(161), UINT8_C(117), UINT8_C(250), UINT8_C(205)),
+      simde_x_mm256_set_epu8(UINT8_C(  8), UINT8_C(165), UINT8_C(152), UINT8_C(199),
+                             UINT8_C(246), UINT8_C(157), UINT8_C( 71), UINT8_C(206),
+                             UINT8_C(  4), UINT8_C( 30), UINT8_C(219), UINT8_C( 21),
+                             UINT8_C(230), UINT8_C(153), UINT8_C(184), UINT8_C(137),
+                             UINT8_C(234), UINT8_C( 18), UINT8_C( 14), UINT8_C(155),
+                             UINT8_C( 47), UINT8_C( 75), UINT8_C(254), UINT8_C(112),
+                             UINT8_C(135), UINT8_C( 65), UINT8_C( 11), UINT8_C( 85),
+                             UINT8_C(168), UINT8_C(177), UINT8_C(156), UINT8_C(185)),
+      simde_x_mm256_set_epu64x(UINT64_C(                1052), UINT64_C(                 871),
+                               UINT64_C(                 648), UINT64_C(                 596)) },
+    { simde_x_mm256_set_epu8(UINT8_C( 49), UINT8_C(170), UINT8_C(177), UINT8_C(202),
+                             UINT8_C(126), UINT8_C(251), UINT8_C( 63), UINT8_C(117),
+                             UINT8_C(254), UINT8_C(243), UINT8_C( 87), UINT8_C( 31),
+                             UINT8_C( 51), UINT8_C( 83), UINT8_C(250), UINT8_C(131),
+                             UINT8_C(164), UINT8_C(207), UINT8_C( 19), UINT8_C(244),
+                             UINT8_C( 90), UINT8_C(173), UINT8_C(166), UINT8_C(223),
+                             UINT8_C(158), UINT8_C(221), UINT8_C(194), UINT8_C(253),
+                             UINT8_C(134), UINT8_C(203), UINT8_C(148), UINT8_C( 16)),
+      simde_x_mm256_set_epu8(UINT8_C(167), UINT8_C(242), UINT8_C(131), UINT8_C(164),
+                             UINT8_C( 28), UINT8_C(221), UINT8_C(  5), UINT8_C(150),
+                             UINT8_C(203), UINT8_C( 69), UINT8_C(158), UINT8_C(124),
+                             UINT8_C(  0), UINT8_C( 54), UINT8_C(165), UINT8_C(228),
+                             UINT8_C(159), UINT8_C(138), UINT8_C(122), UINT8_C(167),
+                             UINT8_C( 15), UINT8_C(123), UINT8_C(214), UINT8_C(124),
+                             UINT8_C(  6), UINT8_C(100), UINT8_C( 88), UINT8_C(161),
+                             UINT8_C( 79), UINT8_C( 49), UINT8_C(230), UINT8_C(147)),
+      simde_x_mm256_set_epu64x(UINT64_C(                 493), UINT64_C(                 651),
+                               UINT64_C(                 526), UINT64_C(                 893)) },
+    { simde_x_mm256_set_epu8(UINT8_C(140), UINT8_C(  2), UINT8_C( 10), UINT8_C(199),
+                             UINT8_C(232), UINT8_C(181), UINT8_C(119), UINT8_C(188),
+                             UINT8_C( 18), UINT8_C(  4), UINT8_C(237), UINT8_C( 49),
+                             UINT8_C(216), UINT8_C(219), UINT8_C(186), UINT8_C(141),
+                             UINT8_C(162), UINT8_C( 84), UINT8_C(163), UINT8_C(  7),
+                             UINT8_C(206), UINT8_C(112), UINT8_C(133), UINT8_C( 41),
+                             UINT8_C( 69), UINT8_C(154), UINT8_C(217), UINT8_C( 79),
+                             UINT8_C(103), UINT8_C(158), UINT8_C( 34), UINT8_C( 40)),
+      simde_x_mm256_set_epu8(UINT8_C(141), UINT8_C(140), UINT8_C(143), UINT8_C( 29),
+                             UINT8_C(184), UINT8_C( 74), UINT8_C(  2), UINT8_C(247),
+                             UINT8_C(168), UINT8_C( 12), UINT8_C(229), UINT8_C( 71),
+                             UINT8_C( 59), UINT8_C(123), UINT8_C(198), UINT8_C(179),
+                             UINT8_C(105), UINT8_C(186), UINT8_C( 22), UINT8_C(153),
+                             UINT8_C(130), UINT8_C(159), UINT8_C(194), UINT8_C(229),
+                             UINT8_C(242), UINT8_C(155), UINT8_C(180), UINT8_C(141),
+                             UINT8_C(125), UINT8_C(254), UINT8_C(161), UINT8_C( 79)),
+      simde_x_mm256_set_epu64x(UINT64_C(                 773), UINT64_C(                 491),
+                               UINT64_C(                 818), UINT64_C(                 557)) },
+    { simde_x_mm256_set_epu8(UINT8_C(123), UINT8_C(134), UINT8_C(143), UINT8_C(168),
+                             UINT8_C(187), UINT8_C(228), UINT8_C( 92), UINT8_C(108),
+                             UINT8_C( 86), UINT8_C( 28), UINT8_C( 98), UINT8_C(173),
+                             UINT8_C(238), UINT8_C(191), UINT8_C( 71), UINT8_C(130),
+                             UINT8_C( 86), UINT8_C(179), UINT8_C( 71), UINT8_C( 27),
+                             UINT8_C( 31), UINT8_C(158), UINT8_C(251), UINT8_C( 85),
+                             UINT8_C( 89), UINT8_C(230), UINT8_C( 76), UINT8_C( 26),
+                             UINT8_C( 30), UINT8_C(219), UINT8_C(140), UINT8_C( 36)),
+      simde_x_mm256_set_epu8(UINT8_C(208), UINT8_C( 40), UINT8_C(165), UINT8_C(140),
+                             UINT8_C(114), UINT8_C( 60), UINT8_C(181), UINT8_C( 75),
+                             UINT8_C(140), UINT8_C(185), UINT8_C( 15), UINT8_C( 43),
+                             UINT8_C(196), UINT8_C( 74), UINT8_C( 82), UINT8_C(135),
+                             UINT8_C(132), UINT8_C( 50), UINT8_C(227), UINT8_C(146),
+                             UINT8_C( 94), UINT8_C(189), UINT8_C(  5), UINT8_C(216),
+                             UINT8_C(231), UINT8_C(156), UINT8_C(147), UINT8_C(246),
+                             UINT8_C( 30), UINT8_C(120), UINT8_C(239), UINT8_C( 31)),
+      simde_x_mm256_set_epu64x(UINT64_C(                 592), UINT64_C(                 599),
+                               UINT64_C(                 921), UINT64_C(                 710)) },
+    { simde_x_mm256_set_epu8(UINT8_C(142), UINT8_C(213), UINT8_C( 93), UINT8_C(109),
+                             UINT8_C(117), UINT8_C( 81), UINT8_C(248), UINT8_C(203),
+                             UINT8_C( 81), UINT8_C(204), UINT8_C( 32), UINT8_C( 30),
+                             UINT8_C( 98), UINT8_C(181), UINT8_C( 11), UINT8_C(214),
+                             UINT8_C(129), UINT8_C(174), UINT8_C(100), UINT8_C( 46),
+                             UINT8_C( 16), UINT8_C( 74), UINT8_C(  2), UINT8_C(235),
+                             UINT8_C( 85), UINT8_C(204), UINT8_C( 52), UINT8_C(179),
+                             UINT8_C( 69), UINT8_C(208), UINT8_C( 56), UINT8_C(193)),
+      simde_x_mm256_set_epu8(UINT8_C( 64), UINT8_C(173), UINT8_C( 41), UINT8_C(236),
+                             UINT8_C(197), UINT8_C(206), UINT8_C(175), UINT8_C( 77),
+                             UINT8_C( 13), UINT8_C(170), UINT8_C( 92), UINT8_C( 52),
+                             UINT8_C( 88), UINT8_C(149), UINT8_C(121), UINT8_C(134),
+                             UINT8_C( 46), UINT8_C( 88), UINT8_C(219), UINT8_C(105),
+                             UINT8_C(248), UINT8_C(201), UINT8_C(142), UINT8_C( 50),
+                             UINT8_C(183), UINT8_C(206), UINT8_C(251), UINT8_C(202),
+                             UINT8_C( 42), UINT8_C(149), UINT8_C( 93), UINT8_C(103)),
+      simde_x_mm256_set_epu64x(UINT64_C(                 701), UINT64_C(                 416),
+                               UINT64_C(                1031), UINT64_C(                 535)) },
+    { simde_x_mm256_set_epu8(UINT8_C( 30), UINT8_C(253), UINT8_C(230), UINT8_C(141),
+                             UINT8_C(113), UINT8_C( 23), UINT8_C( 21), UINT8_C(101),
+                             UINT8_C( 33), UINT8_C(226), UINT8_C( 80), UINT8_C(145),
+                             UINT8_C(136), UINT8_C(199), UINT8_C(142), UINT8_C( 56),
+                             UINT8_C(137), UINT8_C(146), UINT8_C(195), UINT8_C(136),
+                             UINT8_C(102), UINT8_C( 12), UINT8_C( 88), UINT8_C( 26),
+                             UINT8_C(108), UINT8_C( 48), UINT8_C(141), UINT8_C(119),
+                             UINT8_C( 29), UINT8_C(144), UINT8_C(249), UINT8_C(236)),
+      simde_x_mm256_set_epu8(UINT8_C(101), UINT8_C(202), UINT8_C(181), UINT8_C(252),
+                             UINT8_C(173), UINT8_C(200), UINT8_C(245), UINT8_C( 27),
+                             UINT8_C( 65), UINT8_C(246), UINT8_C(163), UINT8_C(168),
+                             UINT8_C(177), UINT8_C(109), UINT8_C(232), UINT8_C(  4),
+                             UINT8_C(171), UINT8_C( 89), UINT8_C( 83), UINT8_C(130),
+                             UINT8_C( 20), UINT8_C(247), UINT8_C( 87), UINT8_C(115),
+                             UINT8_C(101), UINT8_C(115), UINT8_C( 61), UINT8_C( 33),
+                             UINT8_C( 13), UINT8_C(107), UINT8_C(212), UINT8_C(110)),
+      simde_x_mm256_set_epu64x(UINT64_C(                 817), UINT64_C(                 431),
+                               UINT64_C(                 616), UINT64_C(                 456)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sad_epu8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitResult
 test_simde_mm256_shuffle_epi8(const MunitParameter params[], void* data) {
   (void) params;
@@ -6249,8 +10626,404 @@ test_simde_mm256_shufflelo_epi16(const MunitParameter params[], void* data) {
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
-    simde__m256i r = simde_mm256_shufflelo_epi16(test_vec[i].a, 149);
-    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+    simde__m256i r = simde_mm256_shufflelo_epi16(test_vec[i].a, 149);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sign_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi8(INT8_C(  76), INT8_C(   4), INT8_C(  84), INT8_C(-103),
+                           INT8_C(  93), INT8_C(  33), INT8_C(  15), INT8_C( -20),
+                           INT8_C(  -1), INT8_C(  25), INT8_C( -56), INT8_C(  76),
+                           INT8_C(  -9), INT8_C(-108), INT8_C( -11), INT8_C( 123),
+                           INT8_C( -22), INT8_C(  64), INT8_C( -61), INT8_C(  69),
+                           INT8_C(   5), INT8_C( -14), INT8_C(-123), INT8_C( -16),
+                           INT8_C( -79), INT8_C(  41), INT8_C(-110), INT8_C(  -7),
+                           INT8_C(  39), INT8_C(  19), INT8_C(  29), INT8_C( -34)),
+      simde_mm256_set_epi8(INT8_C(  17), INT8_C(-115), INT8_C(  68), INT8_C(   0),
+                           INT8_C( -10), INT8_C(   0), INT8_C(  56), INT8_C(   0),
+                           INT8_C( -36), INT8_C(  73), INT8_C(  72), INT8_C(   0),
+                           INT8_C( 109), INT8_C(   0), INT8_C(   0), INT8_C(  44),
+                           INT8_C(   0), INT8_C(  27), INT8_C( -54), INT8_C( 127),
+                           INT8_C(   0), INT8_C(   0), INT8_C( 108), INT8_C( -82),
+                           INT8_C( -29), INT8_C(  77), INT8_C( -93), INT8_C(   0),
+                           INT8_C(  52), INT8_C(  -6), INT8_C( -31), INT8_C(  31)),
+      simde_mm256_set_epi8(INT8_C(  76), INT8_C(  -4), INT8_C(  84), INT8_C(   0),
+                           INT8_C( -93), INT8_C(   0), INT8_C(  15), INT8_C(   0),
+                           INT8_C(   1), INT8_C(  25), INT8_C( -56), INT8_C(   0),
+                           INT8_C(  -9), INT8_C(   0), INT8_C(   0), INT8_C( 123),
+                           INT8_C(   0), INT8_C(  64), INT8_C(  61), INT8_C(  69),
+                           INT8_C(   0), INT8_C(   0), INT8_C(-123), INT8_C(  16),
+                           INT8_C(  79), INT8_C(  41), INT8_C( 110), INT8_C(   0),
+                           INT8_C(  39), INT8_C( -19), INT8_C( -29), INT8_C( -34)) },
+    { simde_mm256_set_epi8(INT8_C(  70), INT8_C(  80), INT8_C( -51), INT8_C(  99),
+                           INT8_C(  65), INT8_C( -68), INT8_C(  -5), INT8_C(-106),
+                           INT8_C(-109), INT8_C(  61), INT8_C(-108), INT8_C( -99),
+                           INT8_C(  17), INT8_C( -78), INT8_C( -45), INT8_C( -96),
+                           INT8_C(-119), INT8_C(-100), INT8_C( -71), INT8_C( -12),
+                           INT8_C(  14), INT8_C(  60), INT8_C( -33), INT8_C(-120),
+                           INT8_C(  32), INT8_C( -59), INT8_C(-128), INT8_C( -33),
+                           INT8_C( -42), INT8_C( -77), INT8_C( 125), INT8_C( 121)),
+      simde_mm256_set_epi8(INT8_C( -58), INT8_C(  32), INT8_C( -70), INT8_C(  72),
+                           INT8_C(   0), INT8_C( -34), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -18), INT8_C(   0), INT8_C(   0), INT8_C( -38),
+                           INT8_C( -56), INT8_C(  75), INT8_C( 101), INT8_C( -69),
+                           INT8_C(  71), INT8_C(  72), INT8_C(-105), INT8_C(  94),
+                           INT8_C( -56), INT8_C( -86), INT8_C(  64), INT8_C(   0),
+                           INT8_C( -89), INT8_C(   0), INT8_C(   0), INT8_C(  64),
+                           INT8_C(  48), INT8_C( -74), INT8_C(-115), INT8_C(  17)),
+      simde_mm256_set_epi8(INT8_C( -70), INT8_C(  80), INT8_C(  51), INT8_C(  99),
+                           INT8_C(   0), INT8_C(  68), INT8_C(   0), INT8_C(   0),
+                           INT8_C( 109), INT8_C(   0), INT8_C(   0), INT8_C(  99),
+                           INT8_C( -17), INT8_C( -78), INT8_C( -45), INT8_C(  96),
+                           INT8_C(-119), INT8_C(-100), INT8_C(  71), INT8_C( -12),
+                           INT8_C( -14), INT8_C( -60), INT8_C( -33), INT8_C(   0),
+                           INT8_C( -32), INT8_C(   0), INT8_C(   0), INT8_C( -33),
+                           INT8_C( -42), INT8_C(  77), INT8_C(-125), INT8_C( 121)) },
+    { simde_mm256_set_epi8(INT8_C( -60), INT8_C(-107), INT8_C(  31), INT8_C( -90),
+                           INT8_C(-125), INT8_C( -30), INT8_C(-105), INT8_C( 127),
+                           INT8_C( -74), INT8_C( -81), INT8_C( -98), INT8_C( 102),
+                           INT8_C(  56), INT8_C(   4), INT8_C(  82), INT8_C( 114),
+                           INT8_C( -27), INT8_C(  25), INT8_C(  71), INT8_C( -12),
+                           INT8_C(  40), INT8_C(   0), INT8_C(  98), INT8_C(   4),
+                           INT8_C(  78), INT8_C(  86), INT8_C(   0), INT8_C( -15),
+                           INT8_C(  69), INT8_C( -26), INT8_C(   8), INT8_C(  -3)),
+      simde_mm256_set_epi8(INT8_C(  24), INT8_C(   0), INT8_C(-119), INT8_C(  36),
+                           INT8_C( -51), INT8_C(   0), INT8_C(  13), INT8_C(-111),
+                           INT8_C(   0), INT8_C( -10), INT8_C( -76), INT8_C(  87),
+                           INT8_C( -74), INT8_C(-100), INT8_C(  33), INT8_C( 100),
+                           INT8_C( -10), INT8_C(   0), INT8_C(  63), INT8_C( -77),
+                           INT8_C( -23), INT8_C( -44), INT8_C( -46), INT8_C( -59),
+                           INT8_C( -60), INT8_C( -52), INT8_C( -74), INT8_C(   0),
+                           INT8_C(-106), INT8_C(   0), INT8_C( -78), INT8_C(   0)),
+      simde_mm256_set_epi8(INT8_C( -60), INT8_C(   0), INT8_C( -31), INT8_C( -90),
+                           INT8_C( 125), INT8_C(   0), INT8_C(-105), INT8_C(-127),
+                           INT8_C(   0), INT8_C(  81), INT8_C(  98), INT8_C( 102),
+                           INT8_C( -56), INT8_C(  -4), INT8_C(  82), INT8_C( 114),
+                           INT8_C(  27), INT8_C(   0), INT8_C(  71), INT8_C(  12),
+                           INT8_C( -40), INT8_C(   0), INT8_C( -98), INT8_C(  -4),
+                           INT8_C( -78), INT8_C( -86), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -69), INT8_C(   0), INT8_C(  -8), INT8_C(   0)) },
+    { simde_mm256_set_epi8(INT8_C( -49), INT8_C( -34), INT8_C( 112), INT8_C(-123),
+                           INT8_C( 109), INT8_C( -52), INT8_C(  82), INT8_C(  50),
+                           INT8_C(  58), INT8_C( -21), INT8_C( -52), INT8_C(-119),
+                           INT8_C( -90), INT8_C(-123), INT8_C( -12), INT8_C(  -9),
+                           INT8_C( -78), INT8_C(  10), INT8_C(-115), INT8_C(  -6),
+                           INT8_C( -97), INT8_C(-118), INT8_C(  50), INT8_C(  -7),
+                           INT8_C(  41), INT8_C( -20), INT8_C(   4), INT8_C(  74),
+                           INT8_C( 124), INT8_C( -65), INT8_C( -70), INT8_C(  88)),
+      simde_mm256_set_epi8(INT8_C( 100), INT8_C(   0), INT8_C( 117), INT8_C( -77),
+                           INT8_C(   0), INT8_C( -12), INT8_C(   0), INT8_C( -89),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -81),
+                           INT8_C( -75), INT8_C(  36), INT8_C(   0), INT8_C(  27),
+                           INT8_C( 104), INT8_C(   0), INT8_C(  62), INT8_C(   0),
+                           INT8_C(  70), INT8_C( -66), INT8_C(-105), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -73), INT8_C( -28), INT8_C( -44)),
+      simde_mm256_set_epi8(INT8_C( -49), INT8_C(   0), INT8_C( 112), INT8_C( 123),
+                           INT8_C(   0), INT8_C(  52), INT8_C(   0), INT8_C( -50),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   9),
+                           INT8_C(  78), INT8_C(  10), INT8_C(   0), INT8_C(  -6),
+                           INT8_C( -97), INT8_C(   0), INT8_C(  50), INT8_C(   0),
+                           INT8_C(  41), INT8_C(  20), INT8_C(  -4), INT8_C(   0),
+                           INT8_C(   0), INT8_C(  65), INT8_C(  70), INT8_C( -88)) },
+    { simde_mm256_set_epi8(INT8_C( 119), INT8_C( 103), INT8_C( -82), INT8_C( -25),
+                           INT8_C( -28), INT8_C(   0), INT8_C( -49), INT8_C(-104),
+                           INT8_C( 104), INT8_C(   4), INT8_C(  52), INT8_C( -11),
+                           INT8_C( -64), INT8_C(  -7), INT8_C(  37), INT8_C(  87),
+                           INT8_C(  29), INT8_C( -72), INT8_C( 112), INT8_C(-113),
+                           INT8_C(  41), INT8_C(  65), INT8_C(  11), INT8_C( -16),
+                           INT8_C(   8), INT8_C( 100), INT8_C(-119), INT8_C( -36),
+                           INT8_C(  44), INT8_C( -83), INT8_C( 107), INT8_C( -66)),
+      simde_mm256_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -35), INT8_C(   0), INT8_C( -92),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  74), INT8_C(  66),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  10), INT8_C(  84),
+                           INT8_C( 111), INT8_C(  13), INT8_C(   0), INT8_C( 113),
+                           INT8_C( -56), INT8_C( -73), INT8_C(-122), INT8_C( -32),
+                           INT8_C(   0), INT8_C(  65), INT8_C(  22), INT8_C( -54),
+                           INT8_C(   0), INT8_C(-114), INT8_C( 116), INT8_C(-106)),
+      simde_mm256_set_epi8(INT8_C(   0), INT8_C( 103), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 104),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  52), INT8_C( -11),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  37), INT8_C(  87),
+                           INT8_C(  29), INT8_C( -72), INT8_C(   0), INT8_C(-113),
+                           INT8_C( -41), INT8_C( -65), INT8_C( -11), INT8_C(  16),
+                           INT8_C(   0), INT8_C( 100), INT8_C(-119), INT8_C(  36),
+                           INT8_C(   0), INT8_C(  83), INT8_C( 107), INT8_C(  66)) },
+    { simde_mm256_set_epi8(INT8_C(  61), INT8_C( -18), INT8_C(  32), INT8_C( -33),
+                           INT8_C(  17), INT8_C( -66), INT8_C( 118), INT8_C( -39),
+                           INT8_C( 111), INT8_C(  47), INT8_C(-116), INT8_C(  42),
+                           INT8_C( 108), INT8_C(  54), INT8_C(  70), INT8_C( -53),
+                           INT8_C(  47), INT8_C( -32), INT8_C( -99), INT8_C( -40),
+                           INT8_C( -15), INT8_C( 103), INT8_C(  25), INT8_C(  57),
+                           INT8_C( -76), INT8_C( 102), INT8_C( 108), INT8_C( -43),
+                           INT8_C( -54), INT8_C( 126), INT8_C( -59), INT8_C(  89)),
+      simde_mm256_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C( -69), INT8_C( 114),
+                           INT8_C(  96), INT8_C( 111), INT8_C( 104), INT8_C(  64),
+                           INT8_C(  49), INT8_C(  96), INT8_C(   0), INT8_C(   0),
+                           INT8_C(-123), INT8_C(   0), INT8_C( -62), INT8_C( -24),
+                           INT8_C(   0), INT8_C(-105), INT8_C(   0), INT8_C( -33),
+                           INT8_C( -64), INT8_C(-124), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -85), INT8_C( -58), INT8_C(  -5), INT8_C(  13),
+                           INT8_C(-121), INT8_C( -21), INT8_C( -71), INT8_C( -32)),
+      simde_mm256_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C( -32), INT8_C( -33),
+                           INT8_C(  17), INT8_C( -66), INT8_C( 118), INT8_C( -39),
+                           INT8_C( 111), INT8_C(  47), INT8_C(   0), INT8_C(   0),
+                           INT8_C(-108), INT8_C(   0), INT8_C( -70), INT8_C(  53),
+                           INT8_C(   0), INT8_C(  32), INT8_C(   0), INT8_C(  40),
+                           INT8_C(  15), INT8_C(-103), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  76), INT8_C(-102), INT8_C(-108), INT8_C( -43),
+                           INT8_C(  54), INT8_C(-126), INT8_C(  59), INT8_C( -89)) },
+    { simde_mm256_set_epi8(INT8_C(  90), INT8_C( -15), INT8_C(  75), INT8_C( -98),
+                           INT8_C(-125), INT8_C(  95), INT8_C(  45), INT8_C( 107),
+                           INT8_C(-114), INT8_C( -11), INT8_C(  15), INT8_C(  93),
+                           INT8_C(  89), INT8_C( -32), INT8_C(  10), INT8_C(  -1),
+                           INT8_C( -46), INT8_C(  18), INT8_C( -79), INT8_C( -18),
+                           INT8_C( -79), INT8_C(-122), INT8_C(  80), INT8_C(  36),
+                           INT8_C( 102), INT8_C( -25), INT8_C(  53), INT8_C(-100),
+                           INT8_C( -89), INT8_C( -24), INT8_C(  74), INT8_C(  98)),
+      simde_mm256_set_epi8(INT8_C(  80), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -47), INT8_C(   0), INT8_C(   0), INT8_C(  14),
+                           INT8_C(  50), INT8_C(  55), INT8_C( -30), INT8_C(   0),
+                           INT8_C( -87), INT8_C( -14), INT8_C(-108), INT8_C(   0),
+                           INT8_C( -68), INT8_C(-123), INT8_C(  80), INT8_C(   0),
+                           INT8_C( -46), INT8_C( -33), INT8_C(   0), INT8_C( -74),
+                           INT8_C( -83), INT8_C( -49), INT8_C( -87), INT8_C(  92),
+                           INT8_C(  99), INT8_C( -37), INT8_C(  -3), INT8_C(   0)),
+      simde_mm256_set_epi8(INT8_C(  90), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C( 125), INT8_C(   0), INT8_C(   0), INT8_C( 107),
+                           INT8_C(-114), INT8_C( -11), INT8_C( -15), INT8_C(   0),
+                           INT8_C( -89), INT8_C(  32), INT8_C( -10), INT8_C(   0),
+                           INT8_C(  46), INT8_C( -18), INT8_C( -79), INT8_C(   0),
+                           INT8_C(  79), INT8_C( 122), INT8_C(   0), INT8_C( -36),
+                           INT8_C(-102), INT8_C(  25), INT8_C( -53), INT8_C(-100),
+                           INT8_C( -89), INT8_C(  24), INT8_C( -74), INT8_C(   0)) },
+    { simde_mm256_set_epi8(INT8_C(-106), INT8_C( -21), INT8_C( 125), INT8_C(-122),
+                           INT8_C( -67), INT8_C( -42), INT8_C( -73), INT8_C(  61),
+                           INT8_C(  63), INT8_C( 115), INT8_C( -80), INT8_C( -47),
+                           INT8_C(-126), INT8_C( -15), INT8_C(  71), INT8_C(  39),
+                           INT8_C( -36), INT8_C( 114), INT8_C(  50), INT8_C(  84),
+                           INT8_C( -81), INT8_C(  89), INT8_C(  43), INT8_C(  15),
+                           INT8_C(-114), INT8_C(  26), INT8_C( -41), INT8_C(  77),
+                           INT8_C( -74), INT8_C( 122), INT8_C(  68), INT8_C( 118)),
+      simde_mm256_set_epi8(INT8_C( -77), INT8_C(  11), INT8_C(  77), INT8_C( -68),
+                           INT8_C(   0), INT8_C( 104), INT8_C(   0), INT8_C( -63),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -23), INT8_C(  40),
+                           INT8_C( 123), INT8_C(  67), INT8_C(   0), INT8_C( -92),
+                           INT8_C(  85), INT8_C(-108), INT8_C(-100), INT8_C(   0),
+                           INT8_C( 120), INT8_C(   0), INT8_C( -36), INT8_C( -33),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -42), INT8_C(  31),
+                           INT8_C( -99), INT8_C(   0), INT8_C(   0), INT8_C(-101)),
+      simde_mm256_set_epi8(INT8_C( 106), INT8_C( -21), INT8_C( 125), INT8_C( 122),
+                           INT8_C(   0), INT8_C( -42), INT8_C(   0), INT8_C( -61),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  80), INT8_C( -47),
+                           INT8_C(-126), INT8_C( -15), INT8_C(   0), INT8_C( -39),
+                           INT8_C( -36), INT8_C(-114), INT8_C( -50), INT8_C(   0),
+                           INT8_C( -81), INT8_C(   0), INT8_C( -43), INT8_C( -15),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  41), INT8_C(  77),
+                           INT8_C(  74), INT8_C(   0), INT8_C(   0), INT8_C(-118)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sign_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sign_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C( 32250), INT16_C( -8808), INT16_C(-10858), INT16_C( -7403),
+                            INT16_C( 28947), INT16_C( 19448), INT16_C( 29738), INT16_C( -6218),
+                            INT16_C(-16912), INT16_C(-20608), INT16_C( 30270), INT16_C(  4630),
+                            INT16_C(-31487), INT16_C( 19448), INT16_C( -2140), INT16_C( 31274)),
+      simde_mm256_set_epi16(INT16_C( 12189), INT16_C( 15657), INT16_C( 31423), INT16_C( 30756),
+                            INT16_C(     0), INT16_C(-22034), INT16_C( 19413), INT16_C( 10681),
+                            INT16_C( -4197), INT16_C( -4337), INT16_C(     0), INT16_C(-17088),
+                            INT16_C(     0), INT16_C(  9154), INT16_C(-18952), INT16_C(     0)),
+      simde_mm256_set_epi16(INT16_C( 32250), INT16_C( -8808), INT16_C(-10858), INT16_C( -7403),
+                            INT16_C(     0), INT16_C(-19448), INT16_C( 29738), INT16_C( -6218),
+                            INT16_C( 16912), INT16_C( 20608), INT16_C(     0), INT16_C( -4630),
+                            INT16_C(     0), INT16_C( 19448), INT16_C(  2140), INT16_C(     0)) },
+    { simde_mm256_set_epi16(INT16_C(   400), INT16_C( 18159), INT16_C(  4086), INT16_C(  2253),
+                            INT16_C(  4064), INT16_C(-32272), INT16_C( 21695), INT16_C( 24506),
+                            INT16_C( -3102), INT16_C(-23219), INT16_C( 27949), INT16_C( 22365),
+                            INT16_C( -6917), INT16_C( 13587), INT16_C( -9608), INT16_C(-27774)),
+      simde_mm256_set_epi16(INT16_C(-16693), INT16_C(-31143), INT16_C( 29751), INT16_C(     0),
+                            INT16_C(-22160), INT16_C(  5343), INT16_C( 21747), INT16_C(-32231),
+                            INT16_C(-25339), INT16_C( 24391), INT16_C(-29634), INT16_C(-14575),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C( 25422)),
+      simde_mm256_set_epi16(INT16_C(  -400), INT16_C(-18159), INT16_C(  4086), INT16_C(     0),
+                            INT16_C( -4064), INT16_C(-32272), INT16_C( 21695), INT16_C(-24506),
+                            INT16_C(  3102), INT16_C(-23219), INT16_C(-27949), INT16_C(-22365),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(-27774)) },
+    { simde_mm256_set_epi16(INT16_C(-24580), INT16_C(  8258), INT16_C( 15091), INT16_C(-19295),
+                            INT16_C( -6116), INT16_C(-22630), INT16_C( -8327), INT16_C(  1317),
+                            INT16_C( 21394), INT16_C(-26317), INT16_C( 13708), INT16_C( 30445),
+                            INT16_C(-13768), INT16_C( -2156), INT16_C(   255), INT16_C(  -906)),
+      simde_mm256_set_epi16(INT16_C( 30070), INT16_C( 13771), INT16_C( 25011), INT16_C(     0),
+                            INT16_C(     0), INT16_C( 25489), INT16_C(     0), INT16_C(-11005),
+                            INT16_C(     0), INT16_C( 29108), INT16_C( 12855), INT16_C(-11464),
+                            INT16_C(-13755), INT16_C(     0), INT16_C(  7565), INT16_C(  3217)),
+      simde_mm256_set_epi16(INT16_C(-24580), INT16_C(  8258), INT16_C( 15091), INT16_C(     0),
+                            INT16_C(     0), INT16_C(-22630), INT16_C(     0), INT16_C( -1317),
+                            INT16_C(     0), INT16_C(-26317), INT16_C( 13708), INT16_C(-30445),
+                            INT16_C( 13768), INT16_C(     0), INT16_C(   255), INT16_C(  -906)) },
+    { simde_mm256_set_epi16(INT16_C(-24504), INT16_C(  7194), INT16_C(-24807), INT16_C( 13669),
+                            INT16_C( 24879), INT16_C( -4937), INT16_C( 29070), INT16_C( 29696),
+                            INT16_C(  3771), INT16_C( -1974), INT16_C(-32326), INT16_C( 15043),
+                            INT16_C( -6933), INT16_C(-20277), INT16_C(  1321), INT16_C(-32740)),
+      simde_mm256_set_epi16(INT16_C( -5719), INT16_C(     0), INT16_C(     0), INT16_C(-14381),
+                            INT16_C( -8729), INT16_C(     0), INT16_C( 17869), INT16_C(-18238),
+                            INT16_C(-16520), INT16_C(     0), INT16_C( 24404), INT16_C(     0),
+                            INT16_C(-20083), INT16_C(     0), INT16_C( 25951), INT16_C(     0)),
+      simde_mm256_set_epi16(INT16_C( 24504), INT16_C(     0), INT16_C(     0), INT16_C(-13669),
+                            INT16_C(-24879), INT16_C(     0), INT16_C( 29070), INT16_C(-29696),
+                            INT16_C( -3771), INT16_C(     0), INT16_C(-32326), INT16_C(     0),
+                            INT16_C(  6933), INT16_C(     0), INT16_C(  1321), INT16_C(     0)) },
+    { simde_mm256_set_epi16(INT16_C(-19273), INT16_C( -9156), INT16_C( 20699), INT16_C(-27584),
+                            INT16_C(  3094), INT16_C( -3251), INT16_C(-22972), INT16_C( 29234),
+                            INT16_C(-24207), INT16_C( 14824), INT16_C( 10911), INT16_C( 13288),
+                            INT16_C(-10762), INT16_C( 17474), INT16_C( -3223), INT16_C(-27078)),
+      simde_mm256_set_epi16(INT16_C(  2063), INT16_C(     0), INT16_C( 24800), INT16_C( 10776),
+                            INT16_C( -1459), INT16_C(  5601), INT16_C(-31339), INT16_C(     0),
+                            INT16_C( 17253), INT16_C(-14668), INT16_C( 28105), INT16_C(     0),
+                            INT16_C(-26755), INT16_C(     0), INT16_C(     0), INT16_C(-22842)),
+      simde_mm256_set_epi16(INT16_C(-19273), INT16_C(     0), INT16_C( 20699), INT16_C(-27584),
+                            INT16_C( -3094), INT16_C( -3251), INT16_C( 22972), INT16_C(     0),
+                            INT16_C(-24207), INT16_C(-14824), INT16_C( 10911), INT16_C(     0),
+                            INT16_C( 10762), INT16_C(     0), INT16_C(     0), INT16_C( 27078)) },
+    { simde_mm256_set_epi16(INT16_C(  3058), INT16_C( 21024), INT16_C( 21596), INT16_C( 22759),
+                            INT16_C( -4437), INT16_C(  2325), INT16_C(-17761), INT16_C( 14127),
+                            INT16_C( 10607), INT16_C( -7076), INT16_C(  4789), INT16_C( -6987),
+                            INT16_C( 18269), INT16_C( 26449), INT16_C( 26489), INT16_C(-26401)),
+      simde_mm256_set_epi16(INT16_C(  3456), INT16_C( 30865), INT16_C(     0), INT16_C( 14013),
+                            INT16_C( -4164), INT16_C(     0), INT16_C(-29578), INT16_C( -7426),
+                            INT16_C(  5964), INT16_C(     0), INT16_C(  3054), INT16_C(-28968),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C( 30929)),
+      simde_mm256_set_epi16(INT16_C(  3058), INT16_C( 21024), INT16_C(     0), INT16_C( 22759),
+                            INT16_C(  4437), INT16_C(     0), INT16_C( 17761), INT16_C(-14127),
+                            INT16_C( 10607), INT16_C(     0), INT16_C(  4789), INT16_C(  6987),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(-26401)) },
+    { simde_mm256_set_epi16(INT16_C( 17534), INT16_C(-25313), INT16_C( 32589), INT16_C( -8686),
+                            INT16_C( 31314), INT16_C( 30865), INT16_C(-11698), INT16_C( 12378),
+                            INT16_C( -8901), INT16_C( -6564), INT16_C( 32445), INT16_C( -1871),
+                            INT16_C(-11595), INT16_C( -5491), INT16_C(-25419), INT16_C(-31589)),
+      simde_mm256_set_epi16(INT16_C(     0), INT16_C(  8081), INT16_C(     0), INT16_C(     0),
+                            INT16_C(-13539), INT16_C(-10053), INT16_C( -6344), INT16_C(-20620),
+                            INT16_C(     0), INT16_C(-30008), INT16_C(  8087), INT16_C(  -248),
+                            INT16_C(-16748), INT16_C(-13966), INT16_C( 19322), INT16_C( 30298)),
+      simde_mm256_set_epi16(INT16_C(     0), INT16_C(-25313), INT16_C(     0), INT16_C(     0),
+                            INT16_C(-31314), INT16_C(-30865), INT16_C( 11698), INT16_C(-12378),
+                            INT16_C(     0), INT16_C(  6564), INT16_C( 32445), INT16_C(  1871),
+                            INT16_C( 11595), INT16_C(  5491), INT16_C(-25419), INT16_C(-31589)) },
+    { simde_mm256_set_epi16(INT16_C( 27925), INT16_C( -2319), INT16_C(-17348), INT16_C( -1711),
+                            INT16_C( -3967), INT16_C(  3540), INT16_C(-13880), INT16_C(   761),
+                            INT16_C( 30071), INT16_C( 31517), INT16_C(-12202), INT16_C( 11348),
+                            INT16_C( 27271), INT16_C( -8610), INT16_C(-19462), INT16_C( 29865)),
+      simde_mm256_set_epi16(INT16_C(     0), INT16_C(  4238), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(     0), INT16_C( 26828), INT16_C(     0),
+                            INT16_C(  8944), INT16_C(-20661), INT16_C(-25999), INT16_C( 12321),
+                            INT16_C( 17328), INT16_C(-32220), INT16_C( 20630), INT16_C( -7018)),
+      simde_mm256_set_epi16(INT16_C(     0), INT16_C( -2319), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(     0), INT16_C(-13880), INT16_C(     0),
+                            INT16_C( 30071), INT16_C(-31517), INT16_C( 12202), INT16_C( 11348),
+                            INT16_C( 27271), INT16_C(  8610), INT16_C(-19462), INT16_C(-29865)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sign_epi16(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sign_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( -836341631), INT32_C( 1405517382), INT32_C(  776490560), INT32_C( -236412018),
+                            INT32_C(-2124461612), INT32_C(  -38997608), INT32_C( 1890677758), INT32_C( 1112948927)),
+      simde_mm256_set_epi32(INT32_C( 1218437120), INT32_C(          0), INT32_C(          0), INT32_C( 1185945589),
+                            INT32_C(          0), INT32_C(-1868637815), INT32_C( -652406698), INT32_C(  620860319)),
+      simde_mm256_set_epi32(INT32_C( -836341631), INT32_C(          0), INT32_C(          0), INT32_C( -236412018),
+                            INT32_C(          0), INT32_C(   38997608), INT32_C(-1890677758), INT32_C( 1112948927)) },
+    { simde_mm256_set_epi32(INT32_C( 1666531834), INT32_C(-1386018557), INT32_C(-1336219873), INT32_C( -831890297),
+                            INT32_C(  529167573), INT32_C( -223910061), INT32_C( -290353979), INT32_C(  255557568)),
+      simde_mm256_set_epi32(INT32_C(  -78688984), INT32_C(          0), INT32_C(          0), INT32_C(-1249026482),
+                            INT32_C(          0), INT32_C(-1375304797), INT32_C(  615818529), INT32_C(          0)),
+      simde_mm256_set_epi32(INT32_C(-1666531834), INT32_C(          0), INT32_C(          0), INT32_C(  831890297),
+                            INT32_C(          0), INT32_C(  223910061), INT32_C( -290353979), INT32_C(          0)) },
+    { simde_mm256_set_epi32(INT32_C(-1750437820), INT32_C( 1316540717), INT32_C(-1396491931), INT32_C( 1665526495),
+                            INT32_C(  191876745), INT32_C( -971610995), INT32_C(-1731482028), INT32_C(  176488882)),
+      simde_mm256_set_epi32(INT32_C(  144868884), INT32_C(          0), INT32_C(  391452327), INT32_C( 2020425756),
+                            INT32_C(-1019071720), INT32_C(-1909933229), INT32_C(  297116678), INT32_C( 1672527623)),
+      simde_mm256_set_epi32(INT32_C(-1750437820), INT32_C(          0), INT32_C(-1396491931), INT32_C( 1665526495),
+                            INT32_C( -191876745), INT32_C(  971610995), INT32_C(-1731482028), INT32_C(  176488882)) },
+    { simde_mm256_set_epi32(INT32_C( 1783496925), INT32_C(-1963228578), INT32_C(-1615175029), INT32_C(-1432256329),
+                            INT32_C(  789274373), INT32_C( 1265097274), INT32_C(  -70902734), INT32_C(  278369304)),
+      simde_mm256_set_epi32(INT32_C( 2043267623), INT32_C(          0), INT32_C(  287277724), INT32_C( -872062706),
+                            INT32_C(          0), INT32_C(          0), INT32_C( 1312702944), INT32_C(  615585080)),
+      simde_mm256_set_epi32(INT32_C( 1783496925), INT32_C(          0), INT32_C(-1615175029), INT32_C( 1432256329),
+                            INT32_C(          0), INT32_C(          0), INT32_C(  -70902734), INT32_C(  278369304)) },
+    { simde_mm256_set_epi32(INT32_C(  662388539), INT32_C( -262755374), INT32_C(-1782010011), INT32_C( 1295241816),
+                            INT32_C( -476014658), INT32_C( 2059225371), INT32_C( -693524779), INT32_C(-1809656973)),
+      simde_mm256_set_epi32(INT32_C( 2127990528), INT32_C(-1125413452), INT32_C(          0), INT32_C(-1226617721),
+                            INT32_C(-1740266978), INT32_C(          0), INT32_C( -594235384), INT32_C( -938464144)),
+      simde_mm256_set_epi32(INT32_C(  662388539), INT32_C(  262755374), INT32_C(          0), INT32_C(-1295241816),
+                            INT32_C(  476014658), INT32_C(          0), INT32_C(  693524779), INT32_C( 1809656973)) },
+    { simde_mm256_set_epi32(INT32_C( 1975266019), INT32_C( -568321311), INT32_C( 1910001668), INT32_C(  507287359),
+                            INT32_C( 1459836866), INT32_C( 1376019141), INT32_C( -263923236), INT32_C(-1950197218)),
+      simde_mm256_set_epi32(INT32_C(-1510262527), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C( -285577643), INT32_C(-1555709053), INT32_C(-2088476317), INT32_C( 1244367990)),
+      simde_mm256_set_epi32(INT32_C(-1975266019), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(-1459836866), INT32_C(-1376019141), INT32_C(  263923236), INT32_C(-1950197218)) },
+    { simde_mm256_set_epi32(INT32_C( 1947636533), INT32_C(-1575194086), INT32_C( -385623815), INT32_C( 1426407259),
+                            INT32_C(-1296622182), INT32_C(-1488195016), INT32_C(-1283016824), INT32_C(  772320563)),
+      simde_mm256_set_epi32(INT32_C( 1852057040), INT32_C(-1435757633), INT32_C(-1768257639), INT32_C( -733035076),
+                            INT32_C( 2145367555), INT32_C(-1210096725), INT32_C(-1613283931), INT32_C(  290045949)),
+      simde_mm256_set_epi32(INT32_C( 1947636533), INT32_C( 1575194086), INT32_C(  385623815), INT32_C(-1426407259),
+                            INT32_C(-1296622182), INT32_C( 1488195016), INT32_C( 1283016824), INT32_C(  772320563)) },
+    { simde_mm256_set_epi32(INT32_C(  187906317), INT32_C(-1093719275), INT32_C(   51618386), INT32_C( 1379179970),
+                            INT32_C(-1821439588), INT32_C( -142468558), INT32_C( -349443365), INT32_C(  262170779)),
+      simde_mm256_set_epi32(INT32_C( 1987589486), INT32_C( -833994491), INT32_C(          0), INT32_C(          0),
+                            INT32_C(-1685457154), INT32_C(-1856605499), INT32_C(  255557071), INT32_C( 1247324470)),
+      simde_mm256_set_epi32(INT32_C(  187906317), INT32_C( 1093719275), INT32_C(          0), INT32_C(          0),
+                            INT32_C( 1821439588), INT32_C(  142468558), INT32_C( -349443365), INT32_C(  262170779)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sign_epi32(test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
   }
 
   return MUNIT_OK;
@@ -6584,6 +11357,313 @@ test_simde_mm256_slli_epi64(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm_sllv_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(1999231072), UINT32_C(2811630604), UINT32_C(2880195253), UINT32_C(4199031445)),
+      simde_x_mm_set_epu32(UINT32_C(        37), UINT32_C(        24), UINT32_C(2979446501), UINT32_C(        23)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C( 201326592), UINT32_C(         0), UINT32_C(1249902592)) },
+    { simde_x_mm_set_epu32(UINT32_C(3618130480), UINT32_C(3318616773), UINT32_C(2586873163), UINT32_C( 924812846)),
+      simde_x_mm_set_epu32(UINT32_C(2206662465), UINT32_C(        34), UINT32_C(         8), UINT32_C(         8)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C(         0), UINT32_C( 814566144), UINT32_C( 528887296)) },
+    { simde_x_mm_set_epu32(UINT32_C(  38029898), UINT32_C(3645609514), UINT32_C(3952787807), UINT32_C(1671445247)),
+      simde_x_mm_set_epu32(UINT32_C(        33), UINT32_C(         9), UINT32_C(        21), UINT32_C(        12)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C(2536264704), UINT32_C( 736100352), UINT32_C(  61861888)) },
+    { simde_x_mm_set_epu32(UINT32_C( 900516711), UINT32_C(1430080279), UINT32_C(1004956756), UINT32_C(3341002862)),
+      simde_x_mm_set_epu32(UINT32_C(         1), UINT32_C(         3), UINT32_C( 259943856), UINT32_C(         7)),
+      simde_x_mm_set_epu32(UINT32_C(1801033422), UINT32_C(2850707640), UINT32_C(         0), UINT32_C(2446604032)) },
+    { simde_x_mm_set_epu32(UINT32_C(2075919366), UINT32_C(1550742169), UINT32_C(1641197512), UINT32_C(1390250737)),
+      simde_x_mm_set_epu32(UINT32_C(        38), UINT32_C(        26), UINT32_C(3902948426), UINT32_C(         7)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C(1677721600), UINT32_C(         0), UINT32_C(1858435200)) },
+    { simde_x_mm_set_epu32(UINT32_C(3926133340), UINT32_C(3985557329), UINT32_C(1831563158), UINT32_C( 704787550)),
+      simde_x_mm_set_epu32(UINT32_C(        17), UINT32_C(        11), UINT32_C(        18), UINT32_C(3962078766)),
+      simde_x_mm_set_epu32(UINT32_C( 347602944), UINT32_C(1983547392), UINT32_C(3193438208), UINT32_C(         0)) },
+    { simde_x_mm_set_epu32(UINT32_C( 345450877), UINT32_C( 432209279), UINT32_C(2329777188), UINT32_C(3544931619)),
+      simde_x_mm_set_epu32(UINT32_C( 115566616), UINT32_C(        24), UINT32_C(        22), UINT32_C(        24)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C(2130706432), UINT32_C( 150994944), UINT32_C( 587202560)) },
+    { simde_x_mm_set_epu32(UINT32_C( 208951404), UINT32_C(4215652031), UINT32_C(2961520560), UINT32_C(1249024456)),
+      simde_x_mm_set_epu32(UINT32_C(        29), UINT32_C(        11), UINT32_C(        33), UINT32_C(        38)),
+      simde_x_mm_set_epu32(UINT32_C(2147483648), UINT32_C( 771094528), UINT32_C(         0), UINT32_C(         0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sllv_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sllv_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_x_mm256_set_epu32(UINT32_C(1773296684), UINT32_C(2703829446), UINT32_C(3753004110), UINT32_C(1277975265),
+                              UINT32_C(2496613689), UINT32_C(4263149305), UINT32_C(2653176904), UINT32_C(1309026420)),
+      simde_x_mm256_set_epu32(UINT32_C( 341231492), UINT32_C(        38), UINT32_C(         2), UINT32_C(        32),
+                              UINT32_C(3027728005), UINT32_C(        17), UINT32_C(4283673601), UINT32_C(        39)),
+      simde_x_mm256_set_epu32(UINT32_C(         0), UINT32_C(         0), UINT32_C(2127114552), UINT32_C(         0),
+                              UINT32_C(         0), UINT32_C(4260495360), UINT32_C(         0), UINT32_C(         0)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3913502632), UINT32_C(1141525604), UINT32_C(2948633411), UINT32_C(1203643472),
+                              UINT32_C(1886670454), UINT32_C( 876776872), UINT32_C(3854435338), UINT32_C(1751833867)),
+      simde_x_mm256_set_epu32(UINT32_C(        23), UINT32_C(1839244303), UINT32_C(        21), UINT32_C(        16),
+                              UINT32_C(2618352244), UINT32_C(         6), UINT32_C(        14), UINT32_C(         6)),
+      simde_x_mm256_set_epu32(UINT32_C(3556769792), UINT32_C(         0), UINT32_C(1751121920), UINT32_C( 609222656),
+                              UINT32_C(         0), UINT32_C( 279144960), UINT32_C(2164424704), UINT32_C( 448217792)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3717613265), UINT32_C(2329129089), UINT32_C(2285957084), UINT32_C(3272967915),
+                              UINT32_C(2796675178), UINT32_C(2643100110), UINT32_C( 953004229), UINT32_C( 193474634)),
+      simde_x_mm256_set_epu32(UINT32_C(        17), UINT32_C( 145361195), UINT32_C(        21), UINT32_C(        39),
+                              UINT32_C(        34), UINT32_C(         4), UINT32_C(        16), UINT32_C(         8)),
+      simde_x_mm256_set_epu32(UINT32_C(2376204288), UINT32_C(         0), UINT32_C(4219469824), UINT32_C(         0),
+                              UINT32_C(         0), UINT32_C(3634896096), UINT32_C(2965700608), UINT32_C(2284866048)) },
+    { simde_x_mm256_set_epu32(UINT32_C(2532178561), UINT32_C(1271821481), UINT32_C(1064943777), UINT32_C(2065272406),
+                              UINT32_C(2508016052), UINT32_C(2091506859), UINT32_C(1173914014), UINT32_C(1954036822)),
+      simde_x_mm256_set_epu32(UINT32_C(        39), UINT32_C(         9), UINT32_C(1577093193), UINT32_C(         9),
+                              UINT32_C(         7), UINT32_C(        12), UINT32_C(        11), UINT32_C(        27)),
+      simde_x_mm256_set_epu32(UINT32_C(         0), UINT32_C(2632536576), UINT32_C(         0), UINT32_C( 857517056),
+                              UINT32_C(3198474752), UINT32_C(2647306240), UINT32_C(3289182208), UINT32_C(2952790016)) },
+    { simde_x_mm256_set_epu32(UINT32_C( 854531863), UINT32_C( 152248065), UINT32_C(1107207594), UINT32_C( 816538451),
+                              UINT32_C(2934922065), UINT32_C(1193112992), UINT32_C(3548558719), UINT32_C(3499875523)),
+      simde_x_mm256_set_epu32(UINT32_C( 944172146), UINT32_C(         8), UINT32_C(        38), UINT32_C(        19),
+                              UINT32_C(         9), UINT32_C( 699174001), UINT32_C(         8), UINT32_C(         8)),
+      simde_x_mm256_set_epu32(UINT32_C(         0), UINT32_C( 320798976), UINT32_C(         0), UINT32_C( 446169088),
+                              UINT32_C(3736510976), UINT32_C(         0), UINT32_C(2192932608), UINT32_C(2614936320)) },
+    { simde_x_mm256_set_epu32(UINT32_C(2309132712), UINT32_C(1788284874), UINT32_C( 211777861), UINT32_C(2064712642),
+                              UINT32_C(1690509798), UINT32_C(2176724109), UINT32_C(1095619086), UINT32_C(2128859178)),
+      simde_x_mm256_set_epu32(UINT32_C(        19), UINT32_C(3077445628), UINT32_C(        38), UINT32_C(        23),
+                              UINT32_C(        32), UINT32_C(        39), UINT32_C(        24), UINT32_C(         4)),
+      simde_x_mm256_set_epu32(UINT32_C(2369781760), UINT32_C(         0), UINT32_C(         0), UINT32_C(3774873600),
+                              UINT32_C(         0), UINT32_C(         0), UINT32_C( 234881024), UINT32_C(3996975776)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3220974710), UINT32_C(3274394381), UINT32_C(1265608909), UINT32_C(3270062387),
+                              UINT32_C(1205257660), UINT32_C(2095388074), UINT32_C( 141438574), UINT32_C(2051950714)),
+      simde_x_mm256_set_epu32(UINT32_C(        17), UINT32_C(         6), UINT32_C(        26), UINT32_C(        17),
+                              UINT32_C(3916506836), UINT32_C(         7), UINT32_C(         4), UINT32_C(2059776270)),
+      simde_x_mm256_set_epu32(UINT32_C(1491861504), UINT32_C(3402810176), UINT32_C( 872415232), UINT32_C(1650851840),
+                              UINT32_C(         0), UINT32_C(1921701120), UINT32_C(2263017184), UINT32_C(         0)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3212541826), UINT32_C( 909439874), UINT32_C( 948672235), UINT32_C(1331917696),
+                              UINT32_C(1813256349), UINT32_C(2593196403), UINT32_C(2003121937), UINT32_C(3295298749)),
+      simde_x_mm256_set_epu32(UINT32_C(        29), UINT32_C(        31), UINT32_C(        31), UINT32_C(         4),
+                              UINT32_C(         6), UINT32_C(        39), UINT32_C(        26), UINT32_C(        36)),
+      simde_x_mm256_set_epu32(UINT32_C(1073741824), UINT32_C(         0), UINT32_C(2147483648), UINT32_C(4130813952),
+                              UINT32_C(  84289344), UINT32_C(         0), UINT32_C(1140850688), UINT32_C(         0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sllv_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_sllv_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu64x(UINT64_C(16457292213780971622), UINT64_C( 4342177153601698690)),
+      simde_x_mm_set_epu64x(UINT64_C(                  36), UINT64_C(                  11)),
+      simde_x_mm_set_epu64x(UINT64_C(17543779357808394240), UINT64_C( 1448167048275038208)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 7541567245775849227), UINT64_C( 9987801668889446603)),
+      simde_x_mm_set_epu64x(UINT64_C(                  27), UINT64_C(                   2)),
+      simde_x_mm_set_epu64x(UINT64_C(11525140497970495488), UINT64_C( 3057718528138683180)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 7574412864955892748), UINT64_C(11202538848166915395)),
+      simde_x_mm_set_epu64x(UINT64_C(                  49), UINT64_C(                  61)),
+      simde_x_mm_set_epu64x(UINT64_C( 9806588188599255040), UINT64_C( 6917529027641081856)) },
+    { simde_x_mm_set_epu64x(UINT64_C(10474152665759911366), UINT64_C(  608196544172653283)),
+      simde_x_mm_set_epu64x(UINT64_C( 1565814505291232747), UINT64_C(                  68)),
+      simde_x_mm_set_epu64x(UINT64_C(                   0), UINT64_C(                   0)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 3582197327309998457), UINT64_C(  819567285301033024)),
+      simde_x_mm_set_epu64x(UINT64_C(                  35), UINT64_C(11765633590558325589)),
+      simde_x_mm_set_epu64x(UINT64_C( 5572161961329688576), UINT64_C(                   0)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 1164192073042933611), UINT64_C( 5474843439536196024)),
+      simde_x_mm_set_epu64x(UINT64_C(                  12), UINT64_C(                  66)),
+      simde_x_mm_set_epu64x(UINT64_C( 9270760166791753728), UINT64_C(                   0)) },
+    { simde_x_mm_set_epu64x(UINT64_C(10384249868913029459), UINT64_C( 1809214159905536775)),
+      simde_x_mm_set_epu64x(UINT64_C(                  59), UINT64_C(                  39)),
+      simde_x_mm_set_epu64x(UINT64_C(10952754293765046272), UINT64_C(16383395605222785024)) },
+    { simde_x_mm_set_epu64x(UINT64_C(13850955615365777022), UINT64_C(14951999588843353080)),
+      simde_x_mm_set_epu64x(UINT64_C(                  61), UINT64_C(                   3)),
+      simde_x_mm_set_epu64x(UINT64_C(13835058055282163712), UINT64_C( 8935532268489514944)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_sllv_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_sllv_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_x_mm256_set_epu64x(UINT64_C( 6914200708294002921), UINT64_C(10260487827477354016),
+                               UINT64_C(  154281873425407199), UINT64_C( 1421070160151442536)),
+      simde_x_mm256_set_epu64x(UINT64_C(                   7), UINT64_C(                  27),
+                               UINT64_C( 5947951672233074025), UINT64_C(16568098932596722092)),
+      simde_x_mm256_set_epu64x(UINT64_C(18020719197283447936), UINT64_C( 9842633138990219264),
+                               UINT64_C(                   0), UINT64_C(                   0)) },
+    { simde_x_mm256_set_epu64x(UINT64_C(10807078121092478892), UINT64_C(15362849426735670041),
+                               UINT64_C(14579291440439802786), UINT64_C(17435331596936480220)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  33), UINT64_C( 5745639374455929072),
+                               UINT64_C(                   9), UINT64_C(15871589131955865768)),
+      simde_x_mm256_set_epu64x(UINT64_C(16661611457670021120), UINT64_C(                   0),
+                               UINT64_C(12112611726520173568), UINT64_C(                   0)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 9591892433390197670), UINT64_C(15546012239786554049),
+                               UINT64_C( 1233253708947193211), UINT64_C( 1672401893230281485)),
+      simde_x_mm256_set_epu64x(UINT64_C(                   3), UINT64_C(                  21),
+                               UINT64_C(13850024561377758356), UINT64_C(                  62)),
+      simde_x_mm256_set_epu64x(UINT64_C( 2948163172283374896), UINT64_C(17906676358900088832),
+                               UINT64_C(                   0), UINT64_C( 4611686018427387904)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 6000908527666023189), UINT64_C( 5869067649915424997),
+                               UINT64_C( 7858755232027656429), UINT64_C(15897503420408074674)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  52), UINT64_C( 3876461925166786797),
+                               UINT64_C(                  50), UINT64_C(                  21)),
+      simde_x_mm256_set_epu64x(UINT64_C(12776712142850097152), UINT64_C(                   0),
+                               UINT64_C(  266838277921701888), UINT64_C(16445913708439273472)) },
+    { simde_x_mm256_set_epu64x(UINT64_C(10641568830635242078), UINT64_C( 5197371330943774234),
+                               UINT64_C( 2784154287796003902), UINT64_C( 3031542804719433993)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  62), UINT64_C(                  49),
+                               UINT64_C(                  71), UINT64_C(                  22)),
+      simde_x_mm256_set_epu64x(UINT64_C( 9223372036854775808), UINT64_C(15867307387133100032),
+                               UINT64_C(                   0), UINT64_C(  549206462912528384)) },
+    { simde_x_mm256_set_epu64x(UINT64_C(12629765461990227952), UINT64_C(18237296308747526299),
+                               UINT64_C(12445684721176993061), UINT64_C(14582664864643566168)),
+      simde_x_mm256_set_epu64x(UINT64_C( 2420345612524737001), UINT64_C(                  44),
+                               UINT64_C(                  40), UINT64_C(                  46)),
+      simde_x_mm256_set_epu64x(UINT64_C(                   0), UINT64_C(  435072353064452096),
+                               UINT64_C( 4818047858286526464), UINT64_C(10562629976044077056)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 5446035282014182783), UINT64_C( 3746048318563538556),
+                               UINT64_C(13335143924052789766), UINT64_C(  627501481821619210)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  64), UINT64_C(                  57),
+                               UINT64_C(                  50), UINT64_C(                  35)),
+      simde_x_mm256_set_epu64x(UINT64_C(                   0), UINT64_C(17870283321406128128),
+                               UINT64_C( 2889059160958173184), UINT64_C( 4616788095977652224)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 9179347678498329512), UINT64_C(16365902582639702825),
+                               UINT64_C(14903353516455021339), UINT64_C( 9944160845820364214)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  28), UINT64_C(                  63),
+                               UINT64_C(                  52), UINT64_C(                  51)),
+      simde_x_mm256_set_epu64x(UINT64_C( 4966117141431451648), UINT64_C( 9223372036854775808),
+                               UINT64_C(12803733740614320128), UINT64_C( 3292131327607832576)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_sllv_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srli_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_x_mm256_set_epu16(UINT16_C(64018), UINT16_C(18530), UINT16_C(60802), UINT16_C(56615),
+                              UINT16_C(39163), UINT16_C(53897), UINT16_C(32206), UINT16_C(26819),
+                              UINT16_C(39663), UINT16_C(65080), UINT16_C(65307), UINT16_C(43241),
+                              UINT16_C( 6405), UINT16_C(17390), UINT16_C(54188), UINT16_C(31762)),
+      simde_x_mm256_set_epu16(UINT16_C( 8002), UINT16_C( 2316), UINT16_C( 7600), UINT16_C( 7076),
+                              UINT16_C( 4895), UINT16_C( 6737), UINT16_C( 4025), UINT16_C( 3352),
+                              UINT16_C( 4957), UINT16_C( 8135), UINT16_C( 8163), UINT16_C( 5405),
+                              UINT16_C(  800), UINT16_C( 2173), UINT16_C( 6773), UINT16_C( 3970)) },
+    { simde_x_mm256_set_epu16(UINT16_C(12559), UINT16_C(52840), UINT16_C( 5718), UINT16_C(61902),
+                              UINT16_C( 8748), UINT16_C(63331), UINT16_C(62526), UINT16_C(46498),
+                              UINT16_C(16922), UINT16_C(24293), UINT16_C(20968), UINT16_C(23787),
+                              UINT16_C(43572), UINT16_C( 1745), UINT16_C(48811), UINT16_C(17717)),
+      simde_x_mm256_set_epu16(UINT16_C( 1569), UINT16_C( 6605), UINT16_C(  714), UINT16_C( 7737),
+                              UINT16_C( 1093), UINT16_C( 7916), UINT16_C( 7815), UINT16_C( 5812),
+                              UINT16_C( 2115), UINT16_C( 3036), UINT16_C( 2621), UINT16_C( 2973),
+                              UINT16_C( 5446), UINT16_C(  218), UINT16_C( 6101), UINT16_C( 2214)) },
+    { simde_x_mm256_set_epu16(UINT16_C(59460), UINT16_C(23713), UINT16_C(37400), UINT16_C(13864),
+                              UINT16_C(60265), UINT16_C(28529), UINT16_C(54519), UINT16_C(32680),
+                              UINT16_C(17633), UINT16_C(56987), UINT16_C(11051), UINT16_C(65102),
+                              UINT16_C(22761), UINT16_C(24474), UINT16_C(49554), UINT16_C(26271)),
+      simde_x_mm256_set_epu16(UINT16_C( 7432), UINT16_C( 2964), UINT16_C( 4675), UINT16_C( 1733),
+                              UINT16_C( 7533), UINT16_C( 3566), UINT16_C( 6814), UINT16_C( 4085),
+                              UINT16_C( 2204), UINT16_C( 7123), UINT16_C( 1381), UINT16_C( 8137),
+                              UINT16_C( 2845), UINT16_C( 3059), UINT16_C( 6194), UINT16_C( 3283)) },
+    { simde_x_mm256_set_epu16(UINT16_C(10698), UINT16_C(62767), UINT16_C(46733), UINT16_C(65090),
+                              UINT16_C(23725), UINT16_C(62603), UINT16_C(13579), UINT16_C(25580),
+                              UINT16_C(39922), UINT16_C( 2783), UINT16_C(38972), UINT16_C(35137),
+                              UINT16_C(46168), UINT16_C(33079), UINT16_C(26903), UINT16_C(56001)),
+      simde_x_mm256_set_epu16(UINT16_C( 1337), UINT16_C( 7845), UINT16_C( 5841), UINT16_C( 8136),
+                              UINT16_C( 2965), UINT16_C( 7825), UINT16_C( 1697), UINT16_C( 3197),
+                              UINT16_C( 4990), UINT16_C(  347), UINT16_C( 4871), UINT16_C( 4392),
+                              UINT16_C( 5771), UINT16_C( 4134), UINT16_C( 3362), UINT16_C( 7000)) },
+    { simde_x_mm256_set_epu16(UINT16_C(45066), UINT16_C(51104), UINT16_C(12354), UINT16_C(14868),
+                              UINT16_C(23620), UINT16_C(64257), UINT16_C(55937), UINT16_C(14123),
+                              UINT16_C(39974), UINT16_C(20165), UINT16_C(12688), UINT16_C(34266),
+                              UINT16_C(49582), UINT16_C(62839), UINT16_C(18362), UINT16_C(31909)),
+      simde_x_mm256_set_epu16(UINT16_C( 5633), UINT16_C( 6388), UINT16_C( 1544), UINT16_C( 1858),
+                              UINT16_C( 2952), UINT16_C( 8032), UINT16_C( 6992), UINT16_C( 1765),
+                              UINT16_C( 4996), UINT16_C( 2520), UINT16_C( 1586), UINT16_C( 4283),
+                              UINT16_C( 6197), UINT16_C( 7854), UINT16_C( 2295), UINT16_C( 3988)) },
+    { simde_x_mm256_set_epu16(UINT16_C(24002), UINT16_C(59882), UINT16_C(29776), UINT16_C(18595),
+                              UINT16_C(44614), UINT16_C(12949), UINT16_C(21287), UINT16_C(46686),
+                              UINT16_C( 5787), UINT16_C(32246), UINT16_C(35286), UINT16_C(50632),
+                              UINT16_C(10451), UINT16_C(28150), UINT16_C(25112), UINT16_C(40309)),
+      simde_x_mm256_set_epu16(UINT16_C( 3000), UINT16_C( 7485), UINT16_C( 3722), UINT16_C( 2324),
+                              UINT16_C( 5576), UINT16_C( 1618), UINT16_C( 2660), UINT16_C( 5835),
+                              UINT16_C(  723), UINT16_C( 4030), UINT16_C( 4410), UINT16_C( 6329),
+                              UINT16_C( 1306), UINT16_C( 3518), UINT16_C( 3139), UINT16_C( 5038)) },
+    { simde_x_mm256_set_epu16(UINT16_C(62468), UINT16_C(11457), UINT16_C(11734), UINT16_C(56583),
+                              UINT16_C(41627), UINT16_C(34441), UINT16_C( 7451), UINT16_C(36896),
+                              UINT16_C( 4249), UINT16_C(63709), UINT16_C(32758), UINT16_C(43910),
+                              UINT16_C( 9385), UINT16_C(52320), UINT16_C(15912), UINT16_C(29825)),
+      simde_x_mm256_set_epu16(UINT16_C( 7808), UINT16_C( 1432), UINT16_C( 1466), UINT16_C( 7072),
+                              UINT16_C( 5203), UINT16_C( 4305), UINT16_C(  931), UINT16_C( 4612),
+                              UINT16_C(  531), UINT16_C( 7963), UINT16_C( 4094), UINT16_C( 5488),
+                              UINT16_C( 1173), UINT16_C( 6540), UINT16_C( 1989), UINT16_C( 3728)) },
+    { simde_x_mm256_set_epu16(UINT16_C(38753), UINT16_C(53872), UINT16_C(52206), UINT16_C(40324),
+                              UINT16_C( 1677), UINT16_C(12129), UINT16_C(34344), UINT16_C(26742),
+                              UINT16_C(29726), UINT16_C( 4343), UINT16_C(30102), UINT16_C(43452),
+                              UINT16_C( 4299), UINT16_C(32694), UINT16_C(51983), UINT16_C(24355)),
+      simde_x_mm256_set_epu16(UINT16_C( 4844), UINT16_C( 6734), UINT16_C( 6525), UINT16_C( 5040),
+                              UINT16_C(  209), UINT16_C( 1516), UINT16_C( 4293), UINT16_C( 3342),
+                              UINT16_C( 3715), UINT16_C(  542), UINT16_C( 3762), UINT16_C( 5431),
+                              UINT16_C(  537), UINT16_C( 4086), UINT16_C( 6497), UINT16_C( 3044)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srli_epi16(test_vec[i].a, 3);
+    simde_assert_m256i_u16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 
 static MunitResult
 test_simde_mm256_srli_epi64(const MunitParameter params[], void* data) {
@@ -6783,6 +11863,536 @@ test_simde_mm256_srli_si256(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm256_srai_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi16(INT16_C( 25716), INT16_C( -4297), INT16_C(  9081), INT16_C( -2321),
+                            INT16_C( 10678), INT16_C(-30742), INT16_C(-28232), INT16_C(-27192),
+                            INT16_C(-14400), INT16_C(-14850), INT16_C(  1632), INT16_C(-14467),
+                            INT16_C( 13190), INT16_C(  2725), INT16_C(-21293), INT16_C( 13113)),
+      simde_mm256_set_epi16(INT16_C(   803), INT16_C(  -135), INT16_C(   283), INT16_C(   -73),
+                            INT16_C(   333), INT16_C(  -961), INT16_C(  -883), INT16_C(  -850),
+                            INT16_C(  -450), INT16_C(  -465), INT16_C(    51), INT16_C(  -453),
+                            INT16_C(   412), INT16_C(    85), INT16_C(  -666), INT16_C(   409)) },
+    { simde_mm256_set_epi16(INT16_C(-18998), INT16_C( 14069), INT16_C( 13141), INT16_C( -7457),
+                            INT16_C( -6614), INT16_C( 32447), INT16_C( 13248), INT16_C( -6194),
+                            INT16_C( 24184), INT16_C(  -659), INT16_C(  6016), INT16_C( 13555),
+                            INT16_C(-12055), INT16_C( 29576), INT16_C(-18071), INT16_C(-11666)),
+      simde_mm256_set_epi16(INT16_C(  -594), INT16_C(   439), INT16_C(   410), INT16_C(  -234),
+                            INT16_C(  -207), INT16_C(  1013), INT16_C(   414), INT16_C(  -194),
+                            INT16_C(   755), INT16_C(   -21), INT16_C(   188), INT16_C(   423),
+                            INT16_C(  -377), INT16_C(   924), INT16_C(  -565), INT16_C(  -365)) },
+    { simde_mm256_set_epi16(INT16_C( -8895), INT16_C(-25369), INT16_C(-24405), INT16_C(-28421),
+                            INT16_C(  7590), INT16_C(  2086), INT16_C( 26341), INT16_C( -1371),
+                            INT16_C(-23040), INT16_C( 20580), INT16_C( -6291), INT16_C( 15617),
+                            INT16_C( -4080), INT16_C( 29855), INT16_C( 31164), INT16_C( 13936)),
+      simde_mm256_set_epi16(INT16_C(  -278), INT16_C(  -793), INT16_C(  -763), INT16_C(  -889),
+                            INT16_C(   237), INT16_C(    65), INT16_C(   823), INT16_C(   -43),
+                            INT16_C(  -720), INT16_C(   643), INT16_C(  -197), INT16_C(   488),
+                            INT16_C(  -128), INT16_C(   932), INT16_C(   973), INT16_C(   435)) },
+    { simde_mm256_set_epi16(INT16_C(-28515), INT16_C(  9140), INT16_C( -9280), INT16_C(-27841),
+                            INT16_C( 11240), INT16_C(-25237), INT16_C(-11597), INT16_C(-27423),
+                            INT16_C( -6983), INT16_C( 31021), INT16_C(-13186), INT16_C(   126),
+                            INT16_C(-16099), INT16_C( -5026), INT16_C(  8375), INT16_C( 21392)),
+      simde_mm256_set_epi16(INT16_C(  -892), INT16_C(   285), INT16_C(  -290), INT16_C(  -871),
+                            INT16_C(   351), INT16_C(  -789), INT16_C(  -363), INT16_C(  -857),
+                            INT16_C(  -219), INT16_C(   969), INT16_C(  -413), INT16_C(     3),
+                            INT16_C(  -504), INT16_C(  -158), INT16_C(   261), INT16_C(   668)) },
+    { simde_mm256_set_epi16(INT16_C(-11758), INT16_C(   247), INT16_C( 10236), INT16_C( 18018),
+                            INT16_C( -9288), INT16_C(-24813), INT16_C( 22496), INT16_C( -7792),
+                            INT16_C( -5182), INT16_C(-29387), INT16_C(-11047), INT16_C(-30035),
+                            INT16_C(  6610), INT16_C(  4118), INT16_C(  5363), INT16_C( 32573)),
+      simde_mm256_set_epi16(INT16_C(  -368), INT16_C(     7), INT16_C(   319), INT16_C(   563),
+                            INT16_C(  -291), INT16_C(  -776), INT16_C(   703), INT16_C(  -244),
+                            INT16_C(  -162), INT16_C(  -919), INT16_C(  -346), INT16_C(  -939),
+                            INT16_C(   206), INT16_C(   128), INT16_C(   167), INT16_C(  1017)) },
+    { simde_mm256_set_epi16(INT16_C(-19380), INT16_C(-27367), INT16_C( 20466), INT16_C(  3273),
+                            INT16_C(-19313), INT16_C( 17368), INT16_C( 17440), INT16_C(   120),
+                            INT16_C(-28208), INT16_C(-17061), INT16_C( 19297), INT16_C(-11571),
+                            INT16_C(  2897), INT16_C( 17681), INT16_C( -1829), INT16_C(-14175)),
+      simde_mm256_set_epi16(INT16_C(  -606), INT16_C(  -856), INT16_C(   639), INT16_C(   102),
+                            INT16_C(  -604), INT16_C(   542), INT16_C(   545), INT16_C(     3),
+                            INT16_C(  -882), INT16_C(  -534), INT16_C(   603), INT16_C(  -362),
+                            INT16_C(    90), INT16_C(   552), INT16_C(   -58), INT16_C(  -443)) },
+    { simde_mm256_set_epi16(INT16_C(-22251), INT16_C( 23329), INT16_C(-17806), INT16_C( 26831),
+                            INT16_C( 12641), INT16_C(   771), INT16_C( 16868), INT16_C(-21663),
+                            INT16_C( 18422), INT16_C( 10433), INT16_C( 24508), INT16_C(-10995),
+                            INT16_C( 21799), INT16_C(-10575), INT16_C( 19900), INT16_C( 15615)),
+      simde_mm256_set_epi16(INT16_C(  -696), INT16_C(   729), INT16_C(  -557), INT16_C(   838),
+                            INT16_C(   395), INT16_C(    24), INT16_C(   527), INT16_C(  -677),
+                            INT16_C(   575), INT16_C(   326), INT16_C(   765), INT16_C(  -344),
+                            INT16_C(   681), INT16_C(  -331), INT16_C(   621), INT16_C(   487)) },
+    { simde_mm256_set_epi16(INT16_C( 12926), INT16_C(-19629), INT16_C(-30061), INT16_C( 20440),
+                            INT16_C( -1717), INT16_C( -5566), INT16_C(  7391), INT16_C(-25407),
+                            INT16_C( 17396), INT16_C(-13936), INT16_C( -5779), INT16_C(-20763),
+                            INT16_C( 32694), INT16_C(-28297), INT16_C(-15173), INT16_C(  8662)),
+      simde_mm256_set_epi16(INT16_C(   403), INT16_C(  -614), INT16_C(  -940), INT16_C(   638),
+                            INT16_C(   -54), INT16_C(  -174), INT16_C(   230), INT16_C(  -794),
+                            INT16_C(   543), INT16_C(  -436), INT16_C(  -181), INT16_C(  -649),
+                            INT16_C(  1021), INT16_C(  -885), INT16_C(  -475), INT16_C(   270)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srai_epi16(test_vec[i].a, 5);
+    simde_assert_m256i_i16(r, ==, test_vec[i].r);
+  }
+
+  /* Counts wider than the element fill it with the sign bit. */
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } sat_vec[2] = {
+    { simde_mm256_set_epi16(INT16_C(-32768), INT16_C(    -1), INT16_C(     0), INT16_C( 32767),
+                            INT16_C(     1), INT16_C(-32767), INT16_C( 32766), INT16_C(    -2),
+                            INT16_C(-32768), INT16_C(    -1), INT16_C(     0), INT16_C( 32767),
+                            INT16_C(     1), INT16_C(-32767), INT16_C( 32766), INT16_C(    -2)),
+      simde_mm256_set_epi16(INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(    -1), INT16_C(     0), INT16_C(    -1),
+                            INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(    -1), INT16_C(     0), INT16_C(    -1)) },
+    { simde_mm256_set_epi16(INT16_C(-22208), INT16_C( 30806), INT16_C(  1523), INT16_C(-27942),
+                            INT16_C(-32709), INT16_C(-13687), INT16_C( 28869), INT16_C( 16142),
+                            INT16_C(  9094), INT16_C(-29899), INT16_C(  2975), INT16_C( 31305),
+                            INT16_C( -6802), INT16_C( 21496), INT16_C(-20420), INT16_C( -7474)),
+      simde_mm256_set_epi16(INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(    -1),
+                            INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(    -1), INT16_C(     0), INT16_C(     0),
+                            INT16_C(    -1), INT16_C(     0), INT16_C(    -1), INT16_C(    -1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(sat_vec) / sizeof(sat_vec[0])); i++) {
+    simde__m256i r;
+
+    r = simde_mm256_srai_epi16(sat_vec[i].a, 16);
+    simde_assert_m256i_i16(r, ==, sat_vec[i].r);
+    r = simde_mm256_srai_epi16(sat_vec[i].a, 40);
+    simde_assert_m256i_i16(r, ==, sat_vec[i].r);
+    r = simde_mm256_srai_epi16(sat_vec[i].a, 255);
+    simde_assert_m256i_i16(r, ==, sat_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srai_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(-1986220120), INT32_C( 1881184007), INT32_C( -462490180), INT32_C( 1012310518),
+                            INT32_C(-1076957286), INT32_C( 1578669484), INT32_C( 1515595340), INT32_C(-1117259236)),
+      simde_mm256_set_epi32(INT32_C(    -242459), INT32_C(     229636), INT32_C(     -56457), INT32_C(     123573),
+                            INT32_C(    -131465), INT32_C(     192708), INT32_C(     185009), INT32_C(    -136385)) },
+    { simde_mm256_set_epi32(INT32_C( -385113586), INT32_C( -907132866), INT32_C( -611565413), INT32_C( 1710546338),
+                            INT32_C(-1918598295), INT32_C( 1734843912), INT32_C(  841790299), INT32_C(  159568300)),
+      simde_mm256_set_epi32(INT32_C(     -47011), INT32_C(    -110734), INT32_C(     -74654), INT32_C(     208806),
+                            INT32_C(    -234204), INT32_C(     211772), INT32_C(     102757), INT32_C(      19478)) },
+    { simde_mm256_set_epi32(INT32_C( -587781315), INT32_C(-1945073817), INT32_C(  902078884), INT32_C(  416120963),
+                            INT32_C(-1764539119), INT32_C(-1912566509), INT32_C(  563411833), INT32_C(  870982756)),
+      simde_mm256_set_epi32(INT32_C(     -71751), INT32_C(    -237436), INT32_C(     110117), INT32_C(      50796),
+                            INT32_C(    -215398), INT32_C(    -233468), INT32_C(      68775), INT32_C(     106321)) },
+    { simde_mm256_set_epi32(INT32_C(-2009055015), INT32_C( -493142550), INT32_C(  284249988), INT32_C( 1246269930),
+                            INT32_C(-1084282474), INT32_C(  170965982), INT32_C( -976437979), INT32_C(   24212239)),
+      simde_mm256_set_epi32(INT32_C(    -245246), INT32_C(     -60199), INT32_C(      34698), INT32_C(     152132),
+                            INT32_C(    -132359), INT32_C(      20869), INT32_C(    -119195), INT32_C(       2955)) },
+    { simde_mm256_set_epi32(INT32_C( -767130855), INT32_C( 1574631181), INT32_C( 2079886665), INT32_C( 1128858580),
+                            INT32_C(  249677422), INT32_C(-1846745118), INT32_C( -709699092), INT32_C( -180658919)),
+      simde_mm256_set_epi32(INT32_C(     -93644), INT32_C(     192215), INT32_C(     253892), INT32_C(     137800),
+                            INT32_C(      30478), INT32_C(    -225433), INT32_C(     -86634), INT32_C(     -22054)) },
+    { simde_mm256_set_epi32(INT32_C(-1662655749), INT32_C(-1193031969), INT32_C( -568285242), INT32_C(  647713776),
+                            INT32_C( 1214149164), INT32_C( -310346021), INT32_C( 2147020736), INT32_C(  343698155)),
+      simde_mm256_set_epi32(INT32_C(    -202961), INT32_C(    -145634), INT32_C(     -69371), INT32_C(      79066),
+                            INT32_C(     148211), INT32_C(     -37885), INT32_C(     262087), INT32_C(      41955)) },
+    { simde_mm256_set_epi32(INT32_C(    1752532), INT32_C(    2787300), INT32_C( -542578383), INT32_C(-1734225918),
+                            INT32_C(  850784326), INT32_C(-1551362498), INT32_C( -307617099), INT32_C( -657492663)),
+      simde_mm256_set_epi32(INT32_C(        213), INT32_C(        340), INT32_C(     -66233), INT32_C(    -211698),
+                            INT32_C(     103855), INT32_C(    -189376), INT32_C(     -37551), INT32_C(     -80261)) },
+    { simde_mm256_set_epi32(INT32_C(  139082330), INT32_C( -505501258), INT32_C(-1288340647), INT32_C( 1774592582),
+                            INT32_C(  -78941774), INT32_C( 1622779061), INT32_C( 1841334575), INT32_C(-1268454422)),
+      simde_mm256_set_epi32(INT32_C(      16977), INT32_C(     -61707), INT32_C(    -157269), INT32_C(     216625),
+                            INT32_C(      -9637), INT32_C(     198093), INT32_C(     224772), INT32_C(    -154841)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srai_epi32(test_vec[i].a, 13);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  /* Counts wider than the element fill it with the sign bit. */
+  const struct {
+    simde__m256i a;
+    simde__m256i r;
+  } sat_vec[2] = {
+    { simde_mm256_set_epi32(INT32_C(-2147483648), INT32_C(         -1), INT32_C(          0), INT32_C( 2147483647),
+                            INT32_C(          1), INT32_C(-2147483647), INT32_C( 2147483646), INT32_C(         -2)),
+      simde_mm256_set_epi32(INT32_C(         -1), INT32_C(         -1), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         -1), INT32_C(          0), INT32_C(         -1)) },
+    { simde_mm256_set_epi32(INT32_C(  983066218), INT32_C( -323413922), INT32_C( 2105548896), INT32_C(-1071651588),
+                            INT32_C(  857365491), INT32_C( 1097659845), INT32_C( 1273074964), INT32_C( 1729857283)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(         -1), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(sat_vec) / sizeof(sat_vec[0])); i++) {
+    simde__m256i r;
+
+    r = simde_mm256_srai_epi32(sat_vec[i].a, 32);
+    simde_assert_m256i_i32(r, ==, sat_vec[i].r);
+    r = simde_mm256_srai_epi32(sat_vec[i].a, 40);
+    simde_assert_m256i_i32(r, ==, sat_vec[i].r);
+    r = simde_mm256_srai_epi32(sat_vec[i].a, 255);
+    simde_assert_m256i_i32(r, ==, sat_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srav_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(-1634861881), INT32_C(-1805083694), INT32_C(  687824256), INT32_C(  746802650)),
+      simde_x_mm_set_epu32(UINT32_C(        16), UINT32_C(        27), UINT32_C(        19), UINT32_C(        23)),
+      simde_mm_set_epi32(INT32_C(     -24947), INT32_C(        -14), INT32_C(       1311), INT32_C(         89)) },
+    { simde_mm_set_epi32(INT32_C(  903636546), INT32_C(  612030970), INT32_C(-1755068814), INT32_C(-1693889763)),
+      simde_x_mm_set_epu32(UINT32_C(        29), UINT32_C( 865073646), UINT32_C(        21), UINT32_C(        13)),
+      simde_mm_set_epi32(INT32_C(          1), INT32_C(          0), INT32_C(       -837), INT32_C(    -206774)) },
+    { simde_mm_set_epi32(INT32_C( 1817640860), INT32_C(-1419039820), INT32_C( -647787404), INT32_C( -519858586)),
+      simde_x_mm_set_epu32(UINT32_C(         9), UINT32_C(        16), UINT32_C(4120877322), UINT32_C(         8)),
+      simde_mm_set_epi32(INT32_C(    3550079), INT32_C(     -21653), INT32_C(         -1), INT32_C(   -2030698)) },
+    { simde_mm_set_epi32(INT32_C(-2010187495), INT32_C(-1338847877), INT32_C(-1264909971), INT32_C(-1202927190)),
+      simde_x_mm_set_epu32(UINT32_C(        33), UINT32_C(        11), UINT32_C(3406440737), UINT32_C(1344208275)),
+      simde_mm_set_epi32(INT32_C(         -1), INT32_C(    -653735), INT32_C(         -1), INT32_C(         -1)) },
+    { simde_mm_set_epi32(INT32_C(   78218895), INT32_C(  162284634), INT32_C( -346838522), INT32_C( -719455557)),
+      simde_x_mm_set_epu32(UINT32_C(        23), UINT32_C(        16), UINT32_C(         4), UINT32_C(        22)),
+      simde_mm_set_epi32(INT32_C(          9), INT32_C(       2476), INT32_C(  -21677408), INT32_C(       -172)) },
+    { simde_mm_set_epi32(INT32_C(  120180361), INT32_C(-1640867663), INT32_C( 2132652705), INT32_C(-1874140232)),
+      simde_x_mm_set_epu32(UINT32_C(         6), UINT32_C(        16), UINT32_C(        23), UINT32_C(        33)),
+      simde_mm_set_epi32(INT32_C(    1877818), INT32_C(     -25038), INT32_C(        254), INT32_C(         -1)) },
+    { simde_mm_set_epi32(INT32_C( 1117357795), INT32_C( 1100090035), INT32_C( 1100509800), INT32_C( 1895635719)),
+      simde_x_mm_set_epu32(UINT32_C(        33), UINT32_C(        29), UINT32_C(         3), UINT32_C(        16)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          2), INT32_C(  137563725), INT32_C(      28925)) },
+    { simde_mm_set_epi32(INT32_C(-1823769745), INT32_C( 1261143556), INT32_C(  138046490), INT32_C( 1390376749)),
+      simde_x_mm_set_epu32(UINT32_C(         4), UINT32_C(        37), UINT32_C(        17), UINT32_C(        32)),
+      simde_mm_set_epi32(INT32_C( -113985610), INT32_C(          0), INT32_C(       1053), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srav_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srav_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C(-1096207470), INT32_C( 1010598392), INT32_C(-2095211865), INT32_C(  595910136),
+                            INT32_C(  819583739), INT32_C(  184888288), INT32_C( 1220752735), INT32_C(  -54686206)),
+      simde_x_mm256_set_epu32(UINT32_C(        11), UINT32_C(         7), UINT32_C(         1), UINT32_C( 326399716),
+                              UINT32_C(        19), UINT32_C(        16), UINT32_C(1400286078), UINT32_C(         3)),
+      simde_mm256_set_epi32(INT32_C(    -535258), INT32_C(    7895299), INT32_C(-1047605933), INT32_C(          0),
+                            INT32_C(       1563), INT32_C(       2821), INT32_C(          0), INT32_C(   -6835776)) },
+    { simde_mm256_set_epi32(INT32_C(-2101014187), INT32_C( -891598890), INT32_C(-1324541512), INT32_C(  473188545),
+                            INT32_C(-1594651909), INT32_C(-1464758645), INT32_C(-2102681022), INT32_C( -274200435)),
+      simde_x_mm256_set_epu32(UINT32_C(        11), UINT32_C(        24), UINT32_C(         6), UINT32_C(        23),
+                              UINT32_C(        11), UINT32_C(        18), UINT32_C(        21), UINT32_C(         1)),
+      simde_mm256_set_epi32(INT32_C(   -1025886), INT32_C(        -54), INT32_C(  -20695962), INT32_C(         56),
+                            INT32_C(    -778639), INT32_C(      -5588), INT32_C(      -1003), INT32_C( -137100218)) },
+    { simde_mm256_set_epi32(INT32_C(  338623353), INT32_C(  266363468), INT32_C(  711611442), INT32_C( -337214083),
+                            INT32_C(  961225208), INT32_C(-1425299787), INT32_C(-2112467223), INT32_C(-2046670828)),
+      simde_x_mm256_set_epu32(UINT32_C(         2), UINT32_C(         2), UINT32_C(2708384463), UINT32_C(        19),
+                              UINT32_C(        17), UINT32_C(        22), UINT32_C(        31), UINT32_C(         4)),
+      simde_mm256_set_epi32(INT32_C(   84655838), INT32_C(   66590867), INT32_C(          0), INT32_C(       -644),
+                            INT32_C(       7333), INT32_C(       -340), INT32_C(         -1), INT32_C( -127916927)) },
+    { simde_mm256_set_epi32(INT32_C( -150079801), INT32_C( 1570024364), INT32_C(  215317966), INT32_C(-1714412323),
+                            INT32_C( -730284715), INT32_C(  -84947848), INT32_C(   15158162), INT32_C(-1018999461)),
+      simde_x_mm256_set_epu32(UINT32_C(        36), UINT32_C(         9), UINT32_C(         1), UINT32_C(        13),
+                              UINT32_C(1584003220), UINT32_C(1695581723), UINT32_C(        11), UINT32_C(1801229006)),
+      simde_mm256_set_epi32(INT32_C(         -1), INT32_C(    3066453), INT32_C(  107658983), INT32_C(    -209279),
+                            INT32_C(         -1), INT32_C(         -1), INT32_C(       7401), INT32_C(         -1)) },
+    { simde_mm256_set_epi32(INT32_C(  175113429), INT32_C(-1293293407), INT32_C(-1272828302), INT32_C(  215187972),
+                            INT32_C(  848894404), INT32_C( 1414284519), INT32_C(-1370196454), INT32_C(  112399149)),
+      simde_x_mm256_set_epu32(UINT32_C(        28), UINT32_C(        17), UINT32_C(        19), UINT32_C(        37),
+                              UINT32_C(        34), UINT32_C(        14), UINT32_C(         2), UINT32_C(2655165736)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(      -9868), INT32_C(      -2428), INT32_C(          0),
+                            INT32_C(          0), INT32_C(      86321), INT32_C( -342549114), INT32_C(          0)) },
+    { simde_mm256_set_epi32(INT32_C( 1714613593), INT32_C( -196824319), INT32_C( 1741445791), INT32_C(-1259217675),
+                            INT32_C( 2011226903), INT32_C( -554044910), INT32_C( -811178434), INT32_C(  980858633)),
+      simde_x_mm256_set_epu32(UINT32_C(        37), UINT32_C(        22), UINT32_C(         3), UINT32_C(         9),
+                              UINT32_C(         7), UINT32_C(         3), UINT32_C(        32), UINT32_C(        18)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(        -47), INT32_C(  217680723), INT32_C(   -2459410),
+                            INT32_C(   15712710), INT32_C(  -69255614), INT32_C(         -1), INT32_C(       3741)) },
+    { simde_mm256_set_epi32(INT32_C(-1531453237), INT32_C( 1676955256), INT32_C( -136406741), INT32_C( 1840005267),
+                            INT32_C(-1059368169), INT32_C(-1307294634), INT32_C(-1321471339), INT32_C(  662408192)),
+      simde_x_mm256_set_epu32(UINT32_C(1855102864), UINT32_C( 346382201), UINT32_C(         8), UINT32_C(        32),
+                              UINT32_C(        24), UINT32_C(        14), UINT32_C( 737044465), UINT32_C(         1)),
+      simde_mm256_set_epi32(INT32_C(         -1), INT32_C(          0), INT32_C(    -532839), INT32_C(          0),
+                            INT32_C(        -64), INT32_C(     -79791), INT32_C(         -1), INT32_C(  331204096)) },
+    { simde_mm256_set_epi32(INT32_C(  867840225), INT32_C(  431371937), INT32_C(-1509127712), INT32_C(-1450386950),
+                            INT32_C( 1656602186), INT32_C( -405352464), INT32_C( 1821207301), INT32_C( 1634325167)),
+      simde_x_mm256_set_epu32(UINT32_C(        11), UINT32_C(        13), UINT32_C(        34), UINT32_C(        29),
+                              UINT32_C(2410366021), UINT32_C(        32), UINT32_C(         9), UINT32_C(        31)),
+      simde_mm256_set_epi32(INT32_C(     423750), INT32_C(      52657), INT32_C(         -1), INT32_C(         -3),
+                            INT32_C(          0), INT32_C(         -1), INT32_C(    3557045), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srav_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srlv_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu32(UINT32_C(3078220368), UINT32_C(1623841878), UINT32_C(1525133930), UINT32_C( 973500948)),
+      simde_x_mm_set_epu32(UINT32_C(        32), UINT32_C(        26), UINT32_C(         1), UINT32_C(        14)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C(        24), UINT32_C( 762566965), UINT32_C(     59417)) },
+    { simde_x_mm_set_epu32(UINT32_C( 606118709), UINT32_C(4094327475), UINT32_C(2146355174), UINT32_C( 749684529)),
+      simde_x_mm_set_epu32(UINT32_C(        11), UINT32_C(        29), UINT32_C(        37), UINT32_C(        38)),
+      simde_x_mm_set_epu32(UINT32_C(    295956), UINT32_C(         7), UINT32_C(         0), UINT32_C(         0)) },
+    { simde_x_mm_set_epu32(UINT32_C(1964363324), UINT32_C( 639006457), UINT32_C(1261298294), UINT32_C(2302760751)),
+      simde_x_mm_set_epu32(UINT32_C(        36), UINT32_C(        27), UINT32_C(        14), UINT32_C(2707038717)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C(         4), UINT32_C(     76983), UINT32_C(         0)) },
+    { simde_x_mm_set_epu32(UINT32_C(4114845893), UINT32_C(1198735183), UINT32_C(2033283415), UINT32_C(1668757428)),
+      simde_x_mm_set_epu32(UINT32_C(         2), UINT32_C(        34), UINT32_C(        38), UINT32_C(        34)),
+      simde_x_mm_set_epu32(UINT32_C(1028711473), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0)) },
+    { simde_x_mm_set_epu32(UINT32_C(3423341676), UINT32_C(2875438825), UINT32_C(  55411230), UINT32_C(2912596898)),
+      simde_x_mm_set_epu32(UINT32_C(        13), UINT32_C(         8), UINT32_C(        36), UINT32_C(        21)),
+      simde_x_mm_set_epu32(UINT32_C(    417888), UINT32_C(  11232182), UINT32_C(         0), UINT32_C(      1388)) },
+    { simde_x_mm_set_epu32(UINT32_C(2821643194), UINT32_C( 851808427), UINT32_C( 222163117), UINT32_C(4068826991)),
+      simde_x_mm_set_epu32(UINT32_C(         2), UINT32_C(  68131668), UINT32_C( 334705808), UINT32_C(3366936502)),
+      simde_x_mm_set_epu32(UINT32_C( 705410798), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0)) },
+    { simde_x_mm_set_epu32(UINT32_C(2000229252), UINT32_C(4045883328), UINT32_C(1422332370), UINT32_C( 280882240)),
+      simde_x_mm_set_epu32(UINT32_C(2584476228), UINT32_C(3375390470), UINT32_C(        21), UINT32_C(        17)),
+      simde_x_mm_set_epu32(UINT32_C(         0), UINT32_C(         0), UINT32_C(       678), UINT32_C(      2142)) },
+    { simde_x_mm_set_epu32(UINT32_C(   5008535), UINT32_C(1363132599), UINT32_C( 930834312), UINT32_C(3641657776)),
+      simde_x_mm_set_epu32(UINT32_C(        16), UINT32_C(        18), UINT32_C(        33), UINT32_C(         4)),
+      simde_x_mm_set_epu32(UINT32_C(        76), UINT32_C(      5199), UINT32_C(         0), UINT32_C( 227603611)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srlv_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srlv_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_x_mm256_set_epu32(UINT32_C( 721791721), UINT32_C( 499293156), UINT32_C(4285252769), UINT32_C(3530092365),
+                              UINT32_C(  64412100), UINT32_C(2025717479), UINT32_C(2819360346), UINT32_C( 138419772)),
+      simde_x_mm256_set_epu32(UINT32_C(         9), UINT32_C(        11), UINT32_C(        34), UINT32_C(         7),
+                              UINT32_C(        18), UINT32_C(1423678961), UINT32_C(2746120048), UINT32_C(        23)),
+      simde_x_mm256_set_epu32(UINT32_C(   1409749), UINT32_C(    243795), UINT32_C(         0), UINT32_C(  27578846),
+                              UINT32_C(       245), UINT32_C(         0), UINT32_C(         0), UINT32_C(        16)) },
+    { simde_x_mm256_set_epu32(UINT32_C( 411431006), UINT32_C(1984984275), UINT32_C(2969117090), UINT32_C(1452784821),
+                              UINT32_C(1369356192), UINT32_C( 345599863), UINT32_C(3360435742), UINT32_C(4216950485)),
+      simde_x_mm256_set_epu32(UINT32_C(        14), UINT32_C(        18), UINT32_C(2653131439), UINT32_C(1502427117),
+                              UINT32_C(         9), UINT32_C(        37), UINT32_C(        28), UINT32_C(        32)),
+      simde_x_mm256_set_epu32(UINT32_C(     25111), UINT32_C(      7572), UINT32_C(         0), UINT32_C(         0),
+                              UINT32_C(   2674523), UINT32_C(         0), UINT32_C(        12), UINT32_C(         0)) },
+    { simde_x_mm256_set_epu32(UINT32_C( 233233705), UINT32_C(2388275820), UINT32_C(2444762285), UINT32_C(2005698524),
+                              UINT32_C(1123912865), UINT32_C(3803936013), UINT32_C(2721104310), UINT32_C( 955602181)),
+      simde_x_mm256_set_epu32(UINT32_C(1123263862), UINT32_C(         2), UINT32_C(         7), UINT32_C(        18),
+                              UINT32_C(        37), UINT32_C(3210362707), UINT32_C(         1), UINT32_C(1557476544)),
+      simde_x_mm256_set_epu32(UINT32_C(         0), UINT32_C( 597068955), UINT32_C(  19099705), UINT32_C(      7651),
+                              UINT32_C(         0), UINT32_C(         0), UINT32_C(1360552155), UINT32_C(         0)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3291355817), UINT32_C(3859347408), UINT32_C(3685913594), UINT32_C(1656715700),
+                              UINT32_C(1012982651), UINT32_C(2327024240), UINT32_C(3512571013), UINT32_C(3062170556)),
+      simde_x_mm256_set_epu32(UINT32_C(        17), UINT32_C(        16), UINT32_C(        17), UINT32_C(        18),
+                              UINT32_C(         9), UINT32_C(         9), UINT32_C(         9), UINT32_C(3093352787)),
+      simde_x_mm256_set_epu32(UINT32_C(     25111), UINT32_C(     58888), UINT32_C(     28121), UINT32_C(      6319),
+                              UINT32_C(   1978481), UINT32_C(   4544969), UINT32_C(   6860490), UINT32_C(         0)) },
+    { simde_x_mm256_set_epu32(UINT32_C( 877584828), UINT32_C(2884377809), UINT32_C(3121932684), UINT32_C(1048496026),
+                              UINT32_C(3339161134), UINT32_C( 167777322), UINT32_C( 104124854), UINT32_C(1727910055)),
+      simde_x_mm256_set_epu32(UINT32_C(         4), UINT32_C(        31), UINT32_C(        21), UINT32_C(        14),
+                              UINT32_C(1652776143), UINT32_C(        26), UINT32_C(        16), UINT32_C(        32)),
+      simde_x_mm256_set_epu32(UINT32_C(  54849051), UINT32_C(         1), UINT32_C(      1488), UINT32_C(     63995),
+                              UINT32_C(         0), UINT32_C(         2), UINT32_C(      1588), UINT32_C(         0)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3193048219), UINT32_C(2185896171), UINT32_C(4272259684), UINT32_C(2270770013),
+                              UINT32_C(3402726235), UINT32_C(3190573654), UINT32_C( 673864857), UINT32_C(1194934252)),
+      simde_x_mm256_set_epu32(UINT32_C(        24), UINT32_C(        23), UINT32_C(         1), UINT32_C(        23),
+                              UINT32_C(        19), UINT32_C(         6), UINT32_C(         8), UINT32_C(        39)),
+      simde_x_mm256_set_epu32(UINT32_C(       190), UINT32_C(       260), UINT32_C(2136129842), UINT32_C(       270),
+                              UINT32_C(      6490), UINT32_C(  49852713), UINT32_C(   2632284), UINT32_C(         0)) },
+    { simde_x_mm256_set_epu32(UINT32_C(3405598168), UINT32_C(1925820065), UINT32_C(1494456880), UINT32_C(3809856683),
+                              UINT32_C( 368998573), UINT32_C(4172280465), UINT32_C(1600875976), UINT32_C(2544520841)),
+      simde_x_mm256_set_epu32(UINT32_C(        39), UINT32_C(  41722260), UINT32_C(3467991294), UINT32_C(        21),
+                              UINT32_C(         2), UINT32_C(         9), UINT32_C(        32), UINT32_C(        27)),
+      simde_x_mm256_set_epu32(UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(      1816),
+                              UINT32_C(  92249643), UINT32_C(   8148985), UINT32_C(         0), UINT32_C(        18)) },
+    { simde_x_mm256_set_epu32(UINT32_C(4271220232), UINT32_C(2545864582), UINT32_C(1649425649), UINT32_C(2192388867),
+                              UINT32_C(3765201083), UINT32_C(1807664981), UINT32_C(2954945877), UINT32_C( 297274988)),
+      simde_x_mm256_set_epu32(UINT32_C(         1), UINT32_C(         4), UINT32_C(        21), UINT32_C(        32),
+                              UINT32_C(3216400424), UINT32_C(        28), UINT32_C(         1), UINT32_C(        17)),
+      simde_x_mm256_set_epu32(UINT32_C(2135610116), UINT32_C( 159116536), UINT32_C(       786), UINT32_C(         0),
+                              UINT32_C(         0), UINT32_C(         6), UINT32_C(1477472938), UINT32_C(      2268)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srlv_epi32(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_srlv_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i count;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_x_mm_set_epu64x(UINT64_C( 1847746211518337630), UINT64_C( 1631910680169513143)),
+      simde_x_mm_set_epu64x(UINT64_C(                  57), UINT64_C(16325175378635369890)),
+      simde_x_mm_set_epu64x(UINT64_C(                  12), UINT64_C(                   0)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 5582531875327579688), UINT64_C( 1887786406348120893)),
+      simde_x_mm_set_epu64x(UINT64_C(                  42), UINT64_C(                  49)),
+      simde_x_mm_set_epu64x(UINT64_C(             1269320), UINT64_C(                3353)) },
+    { simde_x_mm_set_epu64x(UINT64_C(17721331819480685433), UINT64_C( 9814704356113002179)),
+      simde_x_mm_set_epu64x(UINT64_C(                  49), UINT64_C(                  46)),
+      simde_x_mm_set_epu64x(UINT64_C(               31479), UINT64_C(              139475)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 8558338317991393908), UINT64_C( 3505985169380978409)),
+      simde_x_mm_set_epu64x(UINT64_C(                  34), UINT64_C(                  64)),
+      simde_x_mm_set_epu64x(UINT64_C(           498160854), UINT64_C(                   0)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 4256975038653394671), UINT64_C(17898700471073738935)),
+      simde_x_mm_set_epu64x(UINT64_C( 8670343955951929378), UINT64_C(                  29)),
+      simde_x_mm_set_epu64x(UINT64_C(                   0), UINT64_C(         33338927609)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 2377775803064061930), UINT64_C( 8675659313914860082)),
+      simde_x_mm_set_epu64x(UINT64_C(                  31), UINT64_C(                  54)),
+      simde_x_mm_set_epu64x(UINT64_C(          1107238141), UINT64_C(                 481)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 3877787757478003911), UINT64_C(13330390034910995442)),
+      simde_x_mm_set_epu64x(UINT64_C(11529087672592309262), UINT64_C(                  11)),
+      simde_x_mm_set_epu64x(UINT64_C(                   0), UINT64_C(    6508979509233884)) },
+    { simde_x_mm_set_epu64x(UINT64_C( 9597718882362290505), UINT64_C( 6601377432343889334)),
+      simde_x_mm_set_epu64x(UINT64_C(                  51), UINT64_C(                  66)),
+      simde_x_mm_set_epu64x(UINT64_C(                4262), UINT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_srlv_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m128i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_srlv_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i a;
+    simde__m256i count;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_x_mm256_set_epu64x(UINT64_C(17223335586785567611), UINT64_C( 9538856910273700318),
+                               UINT64_C(17421733737015471096), UINT64_C( 3763369630686552853)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  31), UINT64_C(                  15),
+                               UINT64_C(13206069626487677745), UINT64_C(17361580659455432750)),
+      simde_x_mm256_set_epu64x(UINT64_C(          8020240621), UINT64_C(     291102810982473),
+                               UINT64_C(                   0), UINT64_C(                   0)) },
+    { simde_x_mm256_set_epu64x(UINT64_C(15073429575362991600), UINT64_C(18149199879226106035),
+                               UINT64_C(10424504794060890941), UINT64_C(16733339333816670527)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  59), UINT64_C(                  40),
+                               UINT64_C(15576088483020522455), UINT64_C(                  20)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  26), UINT64_C(            16506601),
+                               UINT64_C(                   0), UINT64_C(      15958155950371)) },
+    { simde_x_mm256_set_epu64x(UINT64_C(17330723525283798124), UINT64_C( 2071607504636497920),
+                               UINT64_C(15073283600949925233), UINT64_C( 7056588734158478372)),
+      simde_x_mm256_set_epu64x(UINT64_C( 1816883850049360193), UINT64_C(                  40),
+                               UINT64_C(                  20), UINT64_C(                  11)),
+      simde_x_mm256_set_epu64x(UINT64_C(                   0), UINT64_C(             1884116),
+                               UINT64_C(      14375003434133), UINT64_C(    3445599967850819)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 7829445216662912436), UINT64_C( 1599448684381188761),
+                               UINT64_C( 7475062515950646168), UINT64_C(16223612972562479395)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  18), UINT64_C(                  66),
+                               UINT64_C(                   9), UINT64_C(11832716539321425136)),
+      simde_x_mm256_set_epu64x(UINT64_C(      29866963259364), UINT64_C(                   0),
+                               UINT64_C(   14599731476466105), UINT64_C(                   0)) },
+    { simde_x_mm256_set_epu64x(UINT64_C(10192056702965590942), UINT64_C(14201274551456841182),
+                               UINT64_C( 9741147870087701313), UINT64_C( 9207294142875502429)),
+      simde_x_mm256_set_epu64x(UINT64_C(  629114244582035141), UINT64_C(                  17),
+                               UINT64_C(                  37), UINT64_C( 9465791281164869967)),
+      simde_x_mm256_set_epu64x(UINT64_C(                   0), UINT64_C(     108347126399664),
+                               UINT64_C(            70876179), UINT64_C(                   0)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 7645579203069956953), UINT64_C( 5428869157318447311),
+                               UINT64_C(  393358271476634688), UINT64_C( 3659084651199097368)),
+      simde_x_mm256_set_epu64x(UINT64_C(12915364356806451575), UINT64_C(                  67),
+                               UINT64_C(                  38), UINT64_C(                  10)),
+      simde_x_mm256_set_epu64x(UINT64_C(                   0), UINT64_C(                   0),
+                               UINT64_C(             1431029), UINT64_C(    3573324854686618)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 5131596277784300367), UINT64_C(16354084315049882283),
+                               UINT64_C( 5583062721287779736), UINT64_C( 6788280929832816373)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  44), UINT64_C( 5330435502115253187),
+                               UINT64_C(17290048270306051722), UINT64_C(                  57)),
+      simde_x_mm256_set_epu64x(UINT64_C(              291697), UINT64_C(                   0),
+                               UINT64_C(                   0), UINT64_C(                  47)) },
+    { simde_x_mm256_set_epu64x(UINT64_C( 4548399724923964057), UINT64_C(15712685216320851089),
+                               UINT64_C( 7620656488615899772), UINT64_C(10352873836166500085)),
+      simde_x_mm256_set_epu64x(UINT64_C(                  41), UINT64_C(                  21),
+                               UINT64_C( 7792852464956383325), UINT64_C(16089676026759850082)),
+      simde_x_mm256_set_epu64x(UINT64_C(             2068372), UINT64_C(       7492392166290),
+                               UINT64_C(                   0), UINT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_srlv_epi64(test_vec[i].a, test_vec[i].count);
+    simde_assert_m256i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitResult
 test_simde_mm256_sub_epi8(const MunitParameter params[], void* data) {
   (void) params;
@@ -8548,6 +14158,9 @@ HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
 
 static MunitTest test_suite_tests[] = {
 #if defined(SIMDE_AVX2_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm256_abs_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm256_abs_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_abs_epi32),
   SIMDE_TESTS_DEFINE_TEST(mm256_add_epi8),
   SIMDE_TESTS_DEFINE_TEST(mm256_add_epi16),
   SIMDE_TESTS_DEFINE_TEST(mm256_add_epi32),
@@ -8600,12 +14213,50 @@ static MunitTest test_suite_tests[] = {
   SIMDE_TESTS_DEFINE_TEST(mm256_extract_epi8),
   SIMDE_TESTS_DEFINE_TEST(mm256_extract_epi16),
   SIMDE_TESTS_DEFINE_TEST(mm256_extracti128_si256),
+  SIMDE_TESTS_DEFINE_TEST(mm256_hadd_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_hadd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_i32gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i32gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i32gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i32gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_i64gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i64gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i64gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i64gather_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_i32gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i32gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i32gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i32gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm_i64gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i64gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i64gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i64gather_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm_i32gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i32gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i32gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i32gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm_i64gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i64gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i64gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i64gather_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm_i32gather_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i32gather_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i32gather_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i32gather_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm_i64gather_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_i64gather_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm256_i64gather_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_i64gather_pd),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_madd_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_maddubs_epi16),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_max_epi8),
   SIMDE_TESTS_DEFINE_TEST(mm256_max_epi16),
   SIMDE_TESTS_DEFINE_TEST(mm256_max_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_min_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm256_min_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_min_epi32),
   SIMDE_TESTS_DEFINE_TEST(mm256_max_epu8),
   SIMDE_TESTS_DEFINE_TEST(mm256_max_epu16),
   SIMDE_TESTS_DEFINE_TEST(mm256_max_epu32),
@@ -8615,21 +14266,39 @@ static MunitTest test_suite_tests[] = {
   SIMDE_TESTS_DEFINE_TEST(mm256_min_epu32),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_movemask_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mul_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mul_epu32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mulhi_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mullo_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mullo_epi32),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_or_si256),
+  SIMDE_TESTS_DEFINE_TEST(mm256_packs_epi16),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_packs_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_packus_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_packus_epi32),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_permute4x64_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_permutevar8x32_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_sad_epu8),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_shuffle_epi8),
   SIMDE_TESTS_DEFINE_TEST(mm256_shuffle_epi32),
   SIMDE_TESTS_DEFINE_TEST(mm256_shufflelo_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_sign_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm256_sign_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_sign_epi32),
   SIMDE_TESTS_DEFINE_TEST(mm256_shuffle_epi8),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_slli_epi16),
   SIMDE_TESTS_DEFINE_TEST(mm256_slli_epi32),
   SIMDE_TESTS_DEFINE_TEST(mm256_slli_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm_sllv_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_sllv_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_sllv_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_sllv_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_srli_epi16),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_sub_epi8),
   SIMDE_TESTS_DEFINE_TEST(mm256_sub_epi16),
@@ -8639,6 +14308,14 @@ static MunitTest test_suite_tests[] = {
   SIMDE_TESTS_DEFINE_TEST(mm256_srli_epi32),
   SIMDE_TESTS_DEFINE_TEST(mm256_srli_epi64),
   SIMDE_TESTS_DEFINE_TEST(mm256_srli_si256),
+  SIMDE_TESTS_DEFINE_TEST(mm256_srai_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm256_srai_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_srav_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_srav_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_srlv_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_srlv_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_srlv_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm256_srlv_epi64),
   SIMDE_TESTS_DEFINE_TEST(mm256_srli_epi64),
 
   SIMDE_TESTS_DEFINE_TEST(mm256_unpacklo_epi8),
@@ -0,0 +1,1144 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX avx512bitalg
+#include <simde/x86/avx512bitalg.h>
+#include <test/x86/test-avx512.h>
+
+#if defined(SIMDE_AVX512BITALG_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_mm512_bitshuffle_epi64_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i b;
+    simde__m512i c;
+    simde__mmask64 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-2762262182510694166), INT64_C(-7290517160979795249),
+                            INT64_C(-7561511002437846151), INT64_C( 3236705911238380268),
+                            INT64_C( 3485510186621062260), INT64_C( 8865281517519135030),
+                            INT64_C( 7273575876580499574), INT64_C(-2586341971585708627)),
+      simde_mm512_set_epi8(INT8_C( -59), INT8_C( 118), INT8_C(  80), INT8_C( 121), INT8_C(  -4), INT8_C(  93), INT8_C(  67), INT8_C(  -1),
+                           INT8_C( -71), INT8_C(  33), INT8_C(-103), INT8_C( -24), INT8_C(  63), INT8_C(  90), INT8_C(  16), INT8_C(  31),
+                           INT8_C(  14), INT8_C(  31), INT8_C( -60), INT8_C(-101), INT8_C( -42), INT8_C(  59), INT8_C(-128), INT8_C( -98),
+                           INT8_C(  85), INT8_C( -68), INT8_C( 121), INT8_C(  -8), INT8_C( -83), INT8_C( -89), INT8_C(  17), INT8_C(  -3),
+                           INT8_C(  46), INT8_C( -83), INT8_C(-123), INT8_C(  71), INT8_C(  86), INT8_C( -41), INT8_C(  31), INT8_C(   3),
+                           INT8_C(   8), INT8_C( -12), INT8_C( 116), INT8_C(  -1), INT8_C( -72), INT8_C( -24), INT8_C( -85), INT8_C(  21),
+                           INT8_C(-113), INT8_C(-114), INT8_C( -87), INT8_C( -45), INT8_C(  73), INT8_C(  66), INT8_C(-115), INT8_C(-114),
+                           INT8_C( -35), INT8_C( -86), INT8_C(  78), INT8_C(-123), INT8_C( -80), INT8_C( -42), INT8_C( -30), INT8_C(-117)),
+      UINT64_C(10069409972632582015) },
+    { simde_mm512_set_epi64(INT64_C(-9174358967396765218), INT64_C( 1088271138339594778),
+                            INT64_C(-4847109605879080209), INT64_C( 6073964772129268077),
+                            INT64_C(-7855634754569332199), INT64_C( -263960093980013745),
+                            INT64_C(-6688167881290171019), INT64_C( 3836218302174783160)),
+      simde_mm512_set_epi8(INT8_C( -52), INT8_C( -72), INT8_C( 112), INT8_C(  33), INT8_C(  52), INT8_C(-104), INT8_C(  -9), INT8_C( -11),
+                           INT8_C( 108), INT8_C( 113), INT8_C( 110), INT8_C(  30), INT8_C( 108), INT8_C( -19), INT8_C(-127), INT8_C(  55),
+                           INT8_C(  91), INT8_C(-110), INT8_C(-114), INT8_C(  44), INT8_C(-104), INT8_C( 125), INT8_C(-123), INT8_C( 125),
+                           INT8_C(  54), INT8_C(-127), INT8_C( -38), INT8_C( 127), INT8_C( 105), INT8_C(-109), INT8_C(   8), INT8_C(  45),
+                           INT8_C( 109), INT8_C(   8), INT8_C(  68), INT8_C( -62), INT8_C( 105), INT8_C( -25), INT8_C( 105), INT8_C(  63),
+                           INT8_C( -36), INT8_C(-122), INT8_C( -77), INT8_C( -45), INT8_C( -51), INT8_C( -67), INT8_C( -10), INT8_C(  19),
+                           INT8_C(  13), INT8_C(   9), INT8_C(-127), INT8_C( -24), INT8_C( -63), INT8_C(  -6), INT8_C( 123), INT8_C( -28),
+                           INT8_C(  14), INT8_C(  30), INT8_C( -51), INT8_C(   2), INT8_C( -19), INT8_C( 124), INT8_C(  12), INT8_C( -67)),
+      UINT64_C( 9505576722691949037) },
+    { simde_mm512_set_epi64(INT64_C(-4626322721297613024), INT64_C( 6460021831952574899),
+                            INT64_C(-8198319208080376567), INT64_C( 8847197993900687350),
+                            INT64_C( 3887457160061030994), INT64_C(-4095095637847343123),
+                            INT64_C(-5712092766790352660), INT64_C(-6987420057764193446)),
+      simde_mm512_set_epi8(INT8_C( -25), INT8_C(  26), INT8_C( 117), INT8_C( 103), INT8_C( -19), INT8_C( -72), INT8_C( -58), INT8_C( 117),
+                           INT8_C( 111), INT8_C(  15), INT8_C(  52), INT8_C(  20), INT8_C( -60), INT8_C( 124), INT8_C(-100), INT8_C(  13),
+                           INT8_C( -68), INT8_C(  58), INT8_C(  91), INT8_C(  65), INT8_C(-102), INT8_C(  67), INT8_C( -81), INT8_C( -46),
+                           INT8_C(  12), INT8_C( -56), INT8_C(-114), INT8_C( -85), INT8_C(  47), INT8_C(-102), INT8_C( -44), INT8_C( -69),
+                           INT8_C(  23), INT8_C( -88), INT8_C( -20), INT8_C(-120), INT8_C( -32), INT8_C( -38), INT8_C(  11), INT8_C( -84),
+                           INT8_C(  50), INT8_C( -71), INT8_C(  17), INT8_C(  73), INT8_C(-108), INT8_C(  23), INT8_C( -86), INT8_C( -71),
+                           INT8_C(  87), INT8_C(  42), INT8_C(  21), INT8_C( -19), INT8_C(  72), INT8_C( -77), INT8_C(  -3), INT8_C( -62),
+                           INT8_C(  45), INT8_C(  28), INT8_C( -30), INT8_C(-120), INT8_C(  86), INT8_C( -46), INT8_C(  14), INT8_C(  94)),
+      UINT64_C(15892445365794711509) },
+    { simde_mm512_set_epi64(INT64_C( 5053459964902965286), INT64_C(-5185376490347324656),
+                            INT64_C( 3331061681209950482), INT64_C( -886254848341091802),
+                            INT64_C( 5690958037488623577), INT64_C( 6309176039145055071),
+                            INT64_C(-2056593079107790356), INT64_C( 7162778361497815737)),
+      simde_mm512_set_epi8(INT8_C(  69), INT8_C(-102), INT8_C( -26), INT8_C( -40), INT8_C(  46), INT8_C( -16), INT8_C( -69), INT8_C(  69),
+                           INT8_C(-112), INT8_C(  75), INT8_C( -62), INT8_C( -35), INT8_C( -96), INT8_C( -21), INT8_C( -55), INT8_C(  23),
+                           INT8_C(  91), INT8_C( -20), INT8_C(  37), INT8_C( -87), INT8_C(-122), INT8_C( -86), INT8_C( 111), INT8_C( -56),
+                           INT8_C(  60), INT8_C(  10), INT8_C(  69), INT8_C( -83), INT8_C( 109), INT8_C(   1), INT8_C( 117), INT8_C( -29),
+                           INT8_C( -19), INT8_C(  10), INT8_C(   0), INT8_C( -21), INT8_C(  48), INT8_C(  43), INT8_C(  82), INT8_C( -58),
+                           INT8_C( -65), INT8_C( -48), INT8_C(  39), INT8_C(  59), INT8_C(  16), INT8_C( -90), INT8_C( -44), INT8_C( -81),
+                           INT8_C(  74), INT8_C(  58), INT8_C( -30), INT8_C(-101), INT8_C(  42), INT8_C( -16), INT8_C( -53), INT8_C( 121),
+                           INT8_C(-119), INT8_C(  71), INT8_C( -75), INT8_C(  -2), INT8_C(  -3), INT8_C( -90), INT8_C( -81), INT8_C( -90)),
+      UINT64_C(14831116356795578365) },
+    { simde_mm512_set_epi64(INT64_C( -753391553774850647), INT64_C( 6269950952644565597),
+                            INT64_C( 7319771086515603918), INT64_C(-7410016688287509591),
+                            INT64_C(-5498976007133858815), INT64_C( 6069467722543144894),
+                            INT64_C( 8147213100591189477), INT64_C(-2813893151397434509)),
+      simde_mm512_set_epi8(INT8_C(  40), INT8_C( -95), INT8_C( -30), INT8_C(  57), INT8_C(  51), INT8_C(-127), INT8_C( -19), INT8_C(  48),
+                           INT8_C(  33), INT8_C( 115), INT8_C(  85), INT8_C(-121), INT8_C(  24), INT8_C(-122), INT8_C(  -9), INT8_C(  94),
+                           INT8_C( -53), INT8_C( 116), INT8_C( -54), INT8_C(  48), INT8_C( -77), INT8_C( -42), INT8_C(-119), INT8_C(  76),
+                           INT8_C(  22), INT8_C(  22), INT8_C( 108), INT8_C( 118), INT8_C( -83), INT8_C(  69), INT8_C(-127), INT8_C(-113),
+                           INT8_C(  72), INT8_C(-103), INT8_C(  -1), INT8_C(  17), INT8_C( -62), INT8_C(  -9), INT8_C(-106), INT8_C(  99),
+                           INT8_C(  77), INT8_C( -54), INT8_C(  29), INT8_C(  87), INT8_C(  -1), INT8_C(   3), INT8_C( -15), INT8_C(-128),
+                           INT8_C(  80), INT8_C( -22), INT8_C( -68), INT8_C( 114), INT8_C(-121), INT8_C( -36), INT8_C(  78), INT8_C(  28),
+                           INT8_C( -88), INT8_C(  55), INT8_C( 121), INT8_C(  62), INT8_C( -98), INT8_C(-118), INT8_C( -41), INT8_C(  50)),
+      UINT64_C( 7750084611479629272) },
+    { simde_mm512_set_epi64(INT64_C(-1114599751489783484), INT64_C(-5703746440781211467),
+                            INT64_C( 7738866862646280309), INT64_C( 5739719343663253498),
+                            INT64_C( 3043930048197307942), INT64_C( -505247487815400479),
+                            INT64_C(-4700517155367057617), INT64_C(  525849917905674986)),
+      simde_mm512_set_epi8(INT8_C(-105), INT8_C(  75), INT8_C( -27), INT8_C(  71), INT8_C(  80), INT8_C(   5), INT8_C(   4), INT8_C( -78),
+                           INT8_C( -31), INT8_C( -74), INT8_C( -52), INT8_C(  63), INT8_C( -50), INT8_C(-118), INT8_C(  87), INT8_C(  28),
+                           INT8_C(  59), INT8_C( -74), INT8_C(  10), INT8_C(  31), INT8_C( 100), INT8_C(  73), INT8_C(  67), INT8_C(  26),
+                           INT8_C(  -8), INT8_C( -38), INT8_C(  -1), INT8_C(  74), INT8_C( -73), INT8_C( -31), INT8_C( -60), INT8_C(  18),
+                           INT8_C( -65), INT8_C(   2), INT8_C(  61), INT8_C(  95), INT8_C( 113), INT8_C( -60), INT8_C(  15), INT8_C(  12),
+                           INT8_C(-102), INT8_C( -33), INT8_C(   7), INT8_C(  60), INT8_C( -89), INT8_C( -30), INT8_C(  79), INT8_C(  18),
+                           INT8_C( 127), INT8_C(  48), INT8_C(  99), INT8_C(  77), INT8_C(  35), INT8_C(-101), INT8_C(  54), INT8_C( -65),
+                           INT8_C( -76), INT8_C( -47), INT8_C( -65), INT8_C(  73), INT8_C(-122), INT8_C(-113), INT8_C( -60), INT8_C( -74)),
+      UINT64_C(16175189177451064157) },
+    { simde_mm512_set_epi64(INT64_C( 8986880970975364820), INT64_C( 4821243773176094933),
+                            INT64_C(-6348507672571803385), INT64_C( 1188309771512366667),
+                            INT64_C(-6099818209453559122), INT64_C( -714704272472552201),
+                            INT64_C( 8697710403323659327), INT64_C( 8684690219456553531)),
+      simde_mm512_set_epi8(INT8_C(  43), INT8_C(  89), INT8_C( -95), INT8_C(  16), INT8_C(   6), INT8_C(  -2), INT8_C(  16), INT8_C( -94),
+                           INT8_C(  -4), INT8_C(  16), INT8_C(  83), INT8_C( 106), INT8_C(  57), INT8_C(  52), INT8_C(  63), INT8_C( -99),
+                           INT8_C(  64), INT8_C(  72), INT8_C(  17), INT8_C(-127), INT8_C( -11), INT8_C(  79), INT8_C(  27), INT8_C( 107),
+                           INT8_C(-109), INT8_C( -25), INT8_C( -16), INT8_C(-100), INT8_C( 118), INT8_C(-103), INT8_C(  93), INT8_C( -48),
+                           INT8_C(-100), INT8_C( -58), INT8_C( -45), INT8_C(-114), INT8_C( -69), INT8_C(  77), INT8_C( -61), INT8_C(-105),
+                           INT8_C(  29), INT8_C( 110), INT8_C( -75), INT8_C( 108), INT8_C( -61), INT8_C(  -2), INT8_C( -51), INT8_C(  77),
+                           INT8_C(  23), INT8_C(  40), INT8_C(  41), INT8_C(  65), INT8_C( 119), INT8_C(  91), INT8_C( -47), INT8_C(  47),
+                           INT8_C(-109), INT8_C( -76), INT8_C(  17), INT8_C(  85), INT8_C( 123), INT8_C(  30), INT8_C(  27), INT8_C(  89)),
+      UINT64_C(  898990113148918283) },
+    { simde_mm512_set_epi64(INT64_C( 5174563216250295738), INT64_C(-5018738695779476531),
+                            INT64_C( 2378928575479532057), INT64_C(  100219374060568665),
+                            INT64_C(-4891195391265598466), INT64_C(-6189653116602165932),
+                            INT64_C( 5201511849756209099), INT64_C(-5594068547997957117)),
+      simde_mm512_set_epi8(INT8_C(  63), INT8_C(  62), INT8_C(  66), INT8_C( -67), INT8_C( -77), INT8_C(  29), INT8_C( 109), INT8_C( -28),
+                           INT8_C(-107), INT8_C(  12), INT8_C(  97), INT8_C( 117), INT8_C( -66), INT8_C( 125), INT8_C(  20), INT8_C(-115),
+                           INT8_C( -95), INT8_C( -51), INT8_C(  93), INT8_C(  22), INT8_C( 108), INT8_C( 102), INT8_C( 114), INT8_C(  41),
+                           INT8_C( 104), INT8_C( -62), INT8_C(-100), INT8_C(  34), INT8_C( -26), INT8_C( -20), INT8_C(-127), INT8_C( -86),
+                           INT8_C(-100), INT8_C( -62), INT8_C( -39), INT8_C(  66), INT8_C( -40), INT8_C( -84), INT8_C(-100), INT8_C(  18),
+                           INT8_C(  61), INT8_C( -12), INT8_C(-122), INT8_C(  95), INT8_C(   6), INT8_C(  14), INT8_C( -39), INT8_C( -31),
+                           INT8_C(  29), INT8_C(  87), INT8_C( -41), INT8_C(  10), INT8_C( -66), INT8_C( 108), INT8_C(  46), INT8_C( -68),
+                           INT8_C(  15), INT8_C( 113), INT8_C(-128), INT8_C( -22), INT8_C(  66), INT8_C( -50), INT8_C(  54), INT8_C(-111)),
+      UINT64_C( 5432666310557236898) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask64 r = simde_mm512_bitshuffle_epi64_mask(test_vec[i].b, test_vec[i].c);
+    simde_assert_mmask64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_bitshuffle_epi64_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask64 k;
+    simde__m512i b;
+    simde__m512i c;
+    simde__mmask64 r;
+  } test_vec[8] = {
+    { UINT64_C(10183931469221794959),
+      simde_mm512_set_epi64(INT64_C(-3983084224493595868), INT64_C(-7409346845136668265),
+                            INT64_C(-8990764053140786113), INT64_C( 8374056662463341623),
+                            INT64_C( 3958654169375738022), INT64_C( 9200657572824753770),
+                            INT64_C( 7535351547781514403), INT64_C(-5122736759588606401)),
+      simde_mm512_set_epi8(INT8_C( -42), INT8_C( 106), INT8_C( 116), INT8_C( -76), INT8_C(  56), INT8_C(  -3), INT8_C(   9), INT8_C(-100),
+                           INT8_C(  83), INT8_C(  54), INT8_C(  16), INT8_C(  18), INT8_C( -35), INT8_C( -35), INT8_C(  39), INT8_C(  82),
+                           INT8_C( -22), INT8_C(   6), INT8_C( -92), INT8_C( 100), INT8_C(  54), INT8_C(  15), INT8_C( 118), INT8_C(  62),
+                           INT8_C( -13), INT8_C( -55), INT8_C( -54), INT8_C(  -1), INT8_C( -80), INT8_C(  36), INT8_C( -32), INT8_C( 126),
+                           INT8_C(   8), INT8_C( 125), INT8_C(  99), INT8_C(   3), INT8_C(-109), INT8_C( 121), INT8_C( -41), INT8_C(-111),
+                           INT8_C(-103), INT8_C(  85), INT8_C(  49), INT8_C(  -9), INT8_C( -18), INT8_C( -36), INT8_C(  82), INT8_C( 117),
+                           INT8_C(-128), INT8_C(-118), INT8_C(-102), INT8_C( 117), INT8_C( -67), INT8_C( -85), INT8_C( -80), INT8_C(  85),
+                           INT8_C( 100), INT8_C(  93), INT8_C(  45), INT8_C( -50), INT8_C(  35), INT8_C(  93), INT8_C( -85), INT8_C(-126)),
+      UINT64_C(    5647230860066829) },
+    { UINT64_C(15514479648896607089),
+      simde_mm512_set_epi64(INT64_C(  303041520188869108), INT64_C(-5113814878942340729),
+                            INT64_C(-7430780699448886209), INT64_C( 8952470249625795337),
+                            INT64_C( 6401462203539764257), INT64_C(-6609115189418413563),
+                            INT64_C( -802867945340280636), INT64_C(   10466441014022502)),
+      simde_mm512_set_epi8(INT8_C(  45), INT8_C( -92), INT8_C(  97), INT8_C( -21), INT8_C(  65), INT8_C(-107), INT8_C( 121), INT8_C(  67),
+                           INT8_C(  65), INT8_C(   3), INT8_C(  27), INT8_C( -57), INT8_C(  95), INT8_C(  85), INT8_C( -68), INT8_C( -70),
+                           INT8_C(  75), INT8_C(-123), INT8_C(  34), INT8_C(-114), INT8_C( -25), INT8_C( -79), INT8_C(-127), INT8_C(  -7),
+                           INT8_C(  -8), INT8_C( -21), INT8_C(  50), INT8_C(   4), INT8_C( 123), INT8_C( -69), INT8_C( -49), INT8_C( -26),
+                           INT8_C( 114), INT8_C(-101), INT8_C(  -3), INT8_C( -22), INT8_C(  83), INT8_C( 117), INT8_C( -10), INT8_C( -53),
+                           INT8_C( 105), INT8_C( -96), INT8_C( -36), INT8_C(  32), INT8_C( -84), INT8_C( -13), INT8_C( 124), INT8_C( -78),
+                           INT8_C( -83), INT8_C( -63), INT8_C(  91), INT8_C(-126), INT8_C( 117), INT8_C(  51), INT8_C(  68), INT8_C(  -5),
+                           INT8_C(  33), INT8_C(  62), INT8_C(  73), INT8_C(  -9), INT8_C(  85), INT8_C( -55), INT8_C( -82), INT8_C( 103)),
+      UINT64_C( 1153625237447770112) },
+    { UINT64_C( 6908278180918791474),
+      simde_mm512_set_epi64(INT64_C( 7894184978641588039), INT64_C( 8021423225718370915),
+                            INT64_C( 7619244336060766418), INT64_C(-4057224908672321539),
+                            INT64_C(   26081975292207995), INT64_C( 4298861702658039994),
+                            INT64_C(-4977752992647291648), INT64_C( 2079899249879653367)),
+      simde_mm512_set_epi8(INT8_C( -93), INT8_C( 114), INT8_C( 102), INT8_C(-121), INT8_C( -37), INT8_C( 107), INT8_C(-101), INT8_C(   4),
+                           INT8_C( 114), INT8_C( -91), INT8_C(  71), INT8_C(  19), INT8_C( -87), INT8_C( -72), INT8_C( 108), INT8_C( -99),
+                           INT8_C(  85), INT8_C( -53), INT8_C(  89), INT8_C( -24), INT8_C(-101), INT8_C(  87), INT8_C( 121), INT8_C( -18),
+                           INT8_C(  61), INT8_C( -85), INT8_C( -56), INT8_C( -87), INT8_C( -19), INT8_C( -19), INT8_C( 111), INT8_C(  48),
+                           INT8_C( -15), INT8_C( -84), INT8_C( -99), INT8_C(  41), INT8_C(  15), INT8_C(  29), INT8_C(  78), INT8_C( -19),
+                           INT8_C( -91), INT8_C(-127), INT8_C(  35), INT8_C(  10), INT8_C( -38), INT8_C( -17), INT8_C(  50), INT8_C(-120),
+                           INT8_C(   4), INT8_C(  24), INT8_C( -62), INT8_C(  65), INT8_C(  -6), INT8_C( 122), INT8_C( -58), INT8_C(   4),
+                           INT8_C( -75), INT8_C(  23), INT8_C( 103), INT8_C( -92), INT8_C( 118), INT8_C(-105), INT8_C( 110), INT8_C(-103)),
+      UINT64_C( 4631706076487352338) },
+    { UINT64_C( 2121456467413474122),
+      simde_mm512_set_epi64(INT64_C(-4953145183864439525), INT64_C( 3434830249819350805),
+                            INT64_C( 6552758849678126542), INT64_C( 8024948789879737938),
+                            INT64_C(-2910746159232150152), INT64_C(-4711229690542929235),
+                            INT64_C( 7083636654114676055), INT64_C( 7557011817084780456)),
+      simde_mm512_set_epi8(INT8_C( 125), INT8_C(  50), INT8_C(  81), INT8_C(  27), INT8_C(  51), INT8_C(-112), INT8_C( -17), INT8_C( -43),
+                           INT8_C(  89), INT8_C( -31), INT8_C( -74), INT8_C(-126), INT8_C( -31), INT8_C( -53), INT8_C( -42), INT8_C(  57),
+                           INT8_C( -28), INT8_C(  55), INT8_C(  49), INT8_C(-128), INT8_C(-111), INT8_C( -75), INT8_C(-126), INT8_C( 125),
+                           INT8_C( -88), INT8_C( 123), INT8_C( -34), INT8_C( -92), INT8_C( -39), INT8_C(-125), INT8_C(  45), INT8_C( -90),
+                           INT8_C( -77), INT8_C( -11), INT8_C( 110), INT8_C(  62), INT8_C(-125), INT8_C( -60), INT8_C( 104), INT8_C( -73),
+                           INT8_C( -74), INT8_C(  36), INT8_C(-102), INT8_C( 124), INT8_C(  57), INT8_C( 102), INT8_C(  81), INT8_C(  85),
+                           INT8_C(  17), INT8_C( 103), INT8_C( -22), INT8_C(-111), INT8_C( 103), INT8_C( -55), INT8_C( 100), INT8_C(-100),
+                           INT8_C( -45), INT8_C(   5), INT8_C(  99), INT8_C( -39), INT8_C(  65), INT8_C( -23), INT8_C(  62), INT8_C( -95)),
+      UINT64_C( 1157640885708652866) },
+    { UINT64_C( 7599363534108668497),
+      simde_mm512_set_epi64(INT64_C(-7626691164318815639), INT64_C( 1192903641592048753),
+                            INT64_C( 7484454320442583137), INT64_C( 1637653549219098237),
+                            INT64_C( 2041354727252151524), INT64_C( 5300251386009088963),
+                            INT64_C(-6863287947421224091), INT64_C( 2193752911870184700)),
+      simde_mm512_set_epi8(INT8_C( -83), INT8_C( 127), INT8_C(  78), INT8_C( -28), INT8_C(  -1), INT8_C(  68), INT8_C(  20), INT8_C(  57),
+                           INT8_C(  17), INT8_C(-101), INT8_C( -23), INT8_C(  99), INT8_C(  55), INT8_C( -90), INT8_C( 123), INT8_C(  15),
+                           INT8_C(  15), INT8_C(  38), INT8_C(  88), INT8_C(-110), INT8_C( -44), INT8_C(  41), INT8_C( -46), INT8_C( 107),
+                           INT8_C( -27), INT8_C(-116), INT8_C( -60), INT8_C(  83), INT8_C(-126), INT8_C( -73), INT8_C( -59), INT8_C( -32),
+                           INT8_C(   1), INT8_C( -22), INT8_C(  76), INT8_C( 114), INT8_C(-105), INT8_C(-100), INT8_C( -25), INT8_C( -17),
+                           INT8_C( -64), INT8_C( -15), INT8_C( -56), INT8_C(  54), INT8_C( -41), INT8_C(  33), INT8_C(  84), INT8_C( -58),
+                           INT8_C( -28), INT8_C( 122), INT8_C( 120), INT8_C(  45), INT8_C(-106), INT8_C( -96), INT8_C( -40), INT8_C( -73),
+                           INT8_C(-120), INT8_C( 112), INT8_C(  19), INT8_C( -15), INT8_C( -64), INT8_C( -79), INT8_C(  69), INT8_C( 125)),
+      UINT64_C( 5273746632884785216) },
+    { UINT64_C( 1800725215051196236),
+      simde_mm512_set_epi64(INT64_C(-2453999997582050570), INT64_C(-5132138000516068512),
+                            INT64_C( 3817255840748527841), INT64_C( -717362921797471612),
+                            INT64_C(-6918467254423979085), INT64_C(-8591389949938592677),
+                            INT64_C(-5545441212237716397), INT64_C( 7819226882432643957)),
+      simde_mm512_set_epi8(INT8_C( -12), INT8_C(-126), INT8_C( 125), INT8_C(   3), INT8_C(  67), INT8_C( -23), INT8_C( 100), INT8_C( -59),
+                           INT8_C(  33), INT8_C( -80), INT8_C(  55), INT8_C( -66), INT8_C(-115), INT8_C( -72), INT8_C( -89), INT8_C(  75),
+                           INT8_C(  40), INT8_C( -13), INT8_C(  80), INT8_C(   8), INT8_C(  42), INT8_C(  11), INT8_C( -36), INT8_C(  51),
+                           INT8_C(  -9), INT8_C( -71), INT8_C( -69), INT8_C(  99), INT8_C(  32), INT8_C( 115), INT8_C(  68), INT8_C( 123),
+                           INT8_C( 107), INT8_C(  74), INT8_C(  67), INT8_C(  55), INT8_C(-127), INT8_C( -63), INT8_C( -79), INT8_C(  89),
+                           INT8_C( -62), INT8_C(  21), INT8_C(  17), INT8_C( -10), INT8_C(  28), INT8_C(  16), INT8_C( -69), INT8_C( -82),
+                           INT8_C( -30), INT8_C(  -3), INT8_C( 117), INT8_C( 112), INT8_C( -90), INT8_C( -28), INT8_C( -82), INT8_C( 114),
+                           INT8_C(  36), INT8_C( -26), INT8_C(  41), INT8_C( -40), INT8_C(-106), INT8_C(  -5), INT8_C(  24), INT8_C(-125)),
+      UINT64_C(   45423061344912452) },
+    { UINT64_C( 1377475904235760951),
+      simde_mm512_set_epi64(INT64_C( 8047038781672288153), INT64_C(-6998527521013550340),
+                            INT64_C( 4057363179913107024), INT64_C(-5078633318302455034),
+                            INT64_C( 6957744617404376207), INT64_C(-8777755400989789145),
+                            INT64_C( 1961148765367208118), INT64_C( 2071258549847661058)),
+      simde_mm512_set_epi8(INT8_C( -64), INT8_C(  29), INT8_C( 119), INT8_C(-128), INT8_C( -98), INT8_C( -12), INT8_C( -15), INT8_C( -44),
+                           INT8_C( -82), INT8_C(  91), INT8_C( -84), INT8_C(  28), INT8_C(-118), INT8_C(  -5), INT8_C(-126), INT8_C(-111),
+                           INT8_C( -23), INT8_C(  65), INT8_C(  14), INT8_C( -92), INT8_C( -79), INT8_C( -48), INT8_C(  27), INT8_C( 103),
+                           INT8_C(  23), INT8_C(  39), INT8_C( -12), INT8_C(  37), INT8_C(-111), INT8_C(-119), INT8_C(  -2), INT8_C(  91),
+                           INT8_C(   1), INT8_C( -94), INT8_C(  85), INT8_C(  59), INT8_C(-119), INT8_C(  78), INT8_C(   7), INT8_C(  21),
+                           INT8_C(-111), INT8_C(  81), INT8_C(  51), INT8_C( -47), INT8_C( -15), INT8_C( -51), INT8_C(  48), INT8_C(  53),
+                           INT8_C( -97), INT8_C( -55), INT8_C( 118), INT8_C(  43), INT8_C( -11), INT8_C(  43), INT8_C( -52), INT8_C( -84),
+                           INT8_C( -78), INT8_C( 123), INT8_C(-115), INT8_C( 108), INT8_C( 125), INT8_C(  44), INT8_C(  21), INT8_C(   6)),
+      UINT64_C( 1226245775804139542) },
+    { UINT64_C( 9368664475625410080),
+      simde_mm512_set_epi64(INT64_C(-4688413465499045252), INT64_C( 8568031992945163211),
+                            INT64_C( 7742341921735941116), INT64_C(-3123532509779036205),
+                            INT64_C( 2908594654138534336), INT64_C( 8971406573523692503),
+                            INT64_C(-9212197640851702165), INT64_C(-8160855226251017427)),
+      simde_mm512_set_epi8(INT8_C( -12), INT8_C(  11), INT8_C( -12), INT8_C( -66), INT8_C(  64), INT8_C(  13), INT8_C(  87), INT8_C(  14),
+                           INT8_C(  65), INT8_C(  95), INT8_C(  41), INT8_C(  47), INT8_C( -96), INT8_C(  72), INT8_C(  24), INT8_C(  -1),
+                           INT8_C( 124), INT8_C( -39), INT8_C(  77), INT8_C(  93), INT8_C(  22), INT8_C(  13), INT8_C(  -9), INT8_C(  81),
+                           INT8_C(  28), INT8_C( 104), INT8_C( -59), INT8_C( -18), INT8_C( -98), INT8_C(   1), INT8_C( -33), INT8_C(  47),
+                           INT8_C(  47), INT8_C( -95), INT8_C( -54), INT8_C(  52), INT8_C(  15), INT8_C(-107), INT8_C(  20), INT8_C(-122),
+                           INT8_C(  73), INT8_C( -93), INT8_C(  66), INT8_C( 104), INT8_C( -50), INT8_C( -52), INT8_C(  86), INT8_C( -21),
+                           INT8_C( -24), INT8_C(  93), INT8_C(  78), INT8_C(  47), INT8_C( -40), INT8_C( -50), INT8_C( -66), INT8_C(  87),
+                           INT8_C( -99), INT8_C( -37), INT8_C( -52), INT8_C(-102), INT8_C( -38), INT8_C( -33), INT8_C( -25), INT8_C(-104)),
+      UINT64_C(  145241173905637376) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask64 r = simde_mm512_mask_bitshuffle_epi64_mask(test_vec[i].k, test_vec[i].b, test_vec[i].c);
+    simde_assert_mmask64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_popcnt_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi16(INT16_C( 21831), INT16_C(-23046), INT16_C( 26253), INT16_C(  9482), INT16_C(  7157), INT16_C(-19510), INT16_C(-18876), INT16_C( -2974),
+                            INT16_C(-22075), INT16_C( 32085), INT16_C( 25063), INT16_C( 25573), INT16_C(-16376), INT16_C( 21047), INT16_C( -3321), INT16_C( -9770),
+                            INT16_C( 11634), INT16_C( 23476), INT16_C(  2831), INT16_C(   913), INT16_C(-16888), INT16_C(-20600), INT16_C( -1985), INT16_C( 20914),
+                            INT16_C( 11493), INT16_C(  3166), INT16_C( 18251), INT16_C(-27691), INT16_C(  4693), INT16_C( 10044), INT16_C( 32644), INT16_C( 13500)),
+      simde_mm512_set_epi16(INT16_C(     8), INT16_C(    10), INT16_C(     8), INT16_C(     5), INT16_C(    10), INT16_C(     9), INT16_C(     7), INT16_C(     8),
+                            INT16_C(     8), INT16_C(    10), INT16_C(     9), INT16_C(     9), INT16_C(     3), INT16_C(     8), INT16_C(     9), INT16_C(    10),
+                            INT16_C(     8), INT16_C(     9), INT16_C(     7), INT16_C(     5), INT16_C(     7), INT16_C(     8), INT16_C(    11), INT16_C(     7),
+                            INT16_C(     8), INT16_C(     7), INT16_C(     8), INT16_C(     9), INT16_C(     6), INT16_C(     8), INT16_C(     9), INT16_C(     8)) },
+    { simde_mm512_set_epi16(INT16_C(-25894), INT16_C(-23715), INT16_C(-17370), INT16_C(-23839), INT16_C( -1098), INT16_C(   402), INT16_C(-12877), INT16_C( -5710),
+                            INT16_C(-19071), INT16_C(-17856), INT16_C(-22245), INT16_C(-31755), INT16_C( -5940), INT16_C(-26640), INT16_C(-21838), INT16_C( 19501),
+                            INT16_C( 24627), INT16_C( 25909), INT16_C( -6857), INT16_C(-28750), INT16_C(    34), INT16_C(  7581), INT16_C( 31571), INT16_C( 31040),
+                            INT16_C( 32499), INT16_C(  5366), INT16_C(  2869), INT16_C(  7611), INT16_C(-28344), INT16_C( 13225), INT16_C( -4568), INT16_C( 15808)),
+      simde_mm512_set_epi16(INT16_C(     9), INT16_C(     9), INT16_C(     8), INT16_C(     7), INT16_C(    12), INT16_C(     4), INT16_C(    10), INT16_C(     9),
+                            INT16_C(     7), INT16_C(     6), INT16_C(     8), INT16_C(     9), INT16_C(     8), INT16_C(     9), INT16_C(     8), INT16_C(     7),
+                            INT16_C(     6), INT16_C(     8), INT16_C(    10), INT16_C(     9), INT16_C(     2), INT16_C(     9), INT16_C(    10), INT16_C(     6),
+                            INT16_C(    12), INT16_C(     8), INT16_C(     7), INT16_C(    10), INT16_C(     5), INT16_C(     8), INT16_C(     8), INT16_C(     7)) },
+    { simde_mm512_set_epi16(INT16_C(-16814), INT16_C(-30840), INT16_C( 23730), INT16_C( 21015), INT16_C(-18393), INT16_C( 23960), INT16_C(  7335), INT16_C( -4152),
+                            INT16_C(-15034), INT16_C( 21641), INT16_C(  3239), INT16_C(-23794), INT16_C( 16099), INT16_C(-14677), INT16_C( 20578), INT16_C(-22909),
+                            INT16_C( 32581), INT16_C(-14485), INT16_C( 21145), INT16_C( -1743), INT16_C( -8331), INT16_C( 28518), INT16_C(-11124), INT16_C(-10401),
+                            INT16_C( -2936), INT16_C( -7855), INT16_C(  -129), INT16_C(-13813), INT16_C(  8909), INT16_C(-15452), INT16_C( 13666), INT16_C( 30692)),
+      simde_mm512_set_epi16(INT16_C(     9), INT16_C(     6), INT16_C(     8), INT16_C(     7), INT16_C(     8), INT16_C(     8), INT16_C(     8), INT16_C(    10),
+                            INT16_C(     7), INT16_C(     6), INT16_C(     7), INT16_C(     7), INT16_C(    10), INT16_C(     9), INT16_C(     5), INT16_C(     7),
+                            INT16_C(    10), INT16_C(    10), INT16_C(     7), INT16_C(     9), INT16_C(    12), INT16_C(    10), INT16_C(     7), INT16_C(    12),
+                            INT16_C(     7), INT16_C(     7), INT16_C(    15), INT16_C(     7), INT16_C(     7), INT16_C(     7), INT16_C(     7), INT16_C(    10)) },
+    { simde_mm512_set_epi16(INT16_C(-18814), INT16_C( 31314), INT16_C( -6004), INT16_C( 15570), INT16_C( 16506), INT16_C( 14211), INT16_C(-10045), INT16_C( -2760),
+                            INT16_C(  4991), INT16_C(-18392), INT16_C(  -996), INT16_C(-15554), INT16_C( 16854), INT16_C( 21347), INT16_C( 24536), INT16_C(-22164),
+                            INT16_C(-17429), INT16_C( 19171), INT16_C( 28281), INT16_C( -8559), INT16_C( 20457), INT16_C( 25444), INT16_C( 10238), INT16_C(  7015),
+                            INT16_C(-24389), INT16_C( 26134), INT16_C(-23629), INT16_C(-26347), INT16_C( 31090), INT16_C(-24900), INT16_C(-29637), INT16_C( 21363)),
+      simde_mm512_set_epi16(INT16_C(     7), INT16_C(     8), INT16_C(     7), INT16_C(     8), INT16_C(     6), INT16_C(     8), INT16_C(     8), INT16_C(     9),
+                            INT16_C(    10), INT16_C(     6), INT16_C(     9), INT16_C(     9), INT16_C(     7), INT16_C(     8), INT16_C(    10), INT16_C(     8),
+                            INT16_C(    12), INT16_C(     8), INT16_C(    10), INT16_C(     9), INT16_C(    10), INT16_C(     7), INT16_C(    11), INT16_C(     9),
+                            INT16_C(     8), INT16_C(     7), INT16_C(     9), INT16_C(     7), INT16_C(     9), INT16_C(    10), INT16_C(     8), INT16_C(     9)) },
+    { simde_mm512_set_epi16(INT16_C(  5243), INT16_C(-12339), INT16_C( 28914), INT16_C(-26608), INT16_C(  3124), INT16_C( 11360), INT16_C(-27737), INT16_C( -8918),
+                            INT16_C(-29133), INT16_C( -6303), INT16_C( 15152), INT16_C( -7070), INT16_C( 17966), INT16_C( 16513), INT16_C( -6257), INT16_C(-23833),
+                            INT16_C( -7355), INT16_C( 28568), INT16_C( 14937), INT16_C( -3962), INT16_C(  1530), INT16_C(-23589), INT16_C(-13592), INT16_C( -8057),
+                            INT16_C(-12307), INT16_C(  5901), INT16_C(-11766), INT16_C(  1611), INT16_C(-27104), INT16_C( 25757), INT16_C( 18846), INT16_C( 20523)),
+      simde_mm512_set_epi16(INT16_C(     8), INT16_C(    11), INT16_C(     8), INT16_C(     4), INT16_C(     5), INT16_C(     5), INT16_C(     9), INT16_C(     9),
+                            INT16_C(     8), INT16_C(     9), INT16_C(     7), INT16_C(     7), INT16_C(     7), INT16_C(     3), INT16_C(    11), INT16_C(     9),
+                            INT16_C(     8), INT16_C(     9), INT16_C(     8), INT16_C(     7), INT16_C(     8), INT16_C(    10), INT16_C(     8), INT16_C(     7),
+                            INT16_C(    12), INT16_C(     7), INT16_C(     6), INT16_C(     6), INT16_C(     5), INT16_C(     8), INT16_C(     8), INT16_C(     6)) },
+    { simde_mm512_set_epi16(INT16_C(  -800), INT16_C( 31709), INT16_C( -7000), INT16_C(-14198), INT16_C( 29261), INT16_C( 29422), INT16_C(  6479), INT16_C(  6202),
+                            INT16_C( 21827), INT16_C( 12993), INT16_C(  9123), INT16_C(   251), INT16_C( -6366), INT16_C(  -462), INT16_C(  2360), INT16_C(  3052),
+                            INT16_C(-10331), INT16_C(-17125), INT16_C(-25686), INT16_C(-14752), INT16_C( 32652), INT16_C( 29362), INT16_C(-22115), INT16_C( -6419),
+                            INT16_C( 13409), INT16_C( -1020), INT16_C(  9798), INT16_C( -8238), INT16_C(-22664), INT16_C( 28286), INT16_C( 30711), INT16_C( 31008)),
+      simde_mm512_set_epi16(INT16_C(     9), INT16_C(    12), INT16_C(     7), INT16_C(     6), INT16_C(     8), INT16_C(    10), INT16_C(     8), INT16_C(     6),
+                            INT16_C(     7), INT16_C(     6), INT16_C(     7), INT16_C(     7), INT16_C(     8), INT16_C(    10), INT16_C(     5), INT16_C(     8),
+                            INT16_C(    10), INT16_C(    10), INT16_C(     9), INT16_C(     6), INT16_C(    10), INT16_C(     8), INT16_C(     9), INT16_C(    11),
+                            INT16_C(     6), INT16_C(     7), INT16_C(     6), INT16_C(    11), INT16_C(     9), INT16_C(    11), INT16_C(    13), INT16_C(     6)) },
+    { simde_mm512_set_epi16(INT16_C(-32367), INT16_C(-13952), INT16_C(   168), INT16_C(  4261), INT16_C(-17159), INT16_C( 17989), INT16_C( 32403), INT16_C(-29837),
+                            INT16_C(-30664), INT16_C(-14878), INT16_C(-11364), INT16_C(-13340), INT16_C( 28891), INT16_C(  4738), INT16_C( 19447), INT16_C(-18743),
+                            INT16_C( 28037), INT16_C(   703), INT16_C(-14324), INT16_C(-26908), INT16_C( 24557), INT16_C(  4047), INT16_C( 31171), INT16_C(-28539),
+                            INT16_C( 16867), INT16_C(  6020), INT16_C( 30551), INT16_C(-27476), INT16_C(  5104), INT16_C( 10307), INT16_C(-25740), INT16_C( -1125)),
+      simde_mm512_set_epi16(INT16_C(     5), INT16_C(     5), INT16_C(     3), INT16_C(     5), INT16_C(    11), INT16_C(     6), INT16_C(    10), INT16_C(     9),
+                            INT16_C(     5), INT16_C(     8), INT16_C(     9), INT16_C(     9), INT16_C(     9), INT16_C(     4), INT16_C(    11), INT16_C(     9),
+                            INT16_C(     8), INT16_C(     8), INT16_C(     5), INT16_C(     8), INT16_C(    12), INT16_C(    10), INT16_C(     9), INT16_C(     5),
+                            INT16_C(     7), INT16_C(     6), INT16_C(    11), INT16_C(     7), INT16_C(     7), INT16_C(     5), INT16_C(     9), INT16_C(    12)) },
+    { simde_mm512_set_epi16(INT16_C(  7733), INT16_C( -8846), INT16_C(-21538), INT16_C( -8238), INT16_C( 24357), INT16_C( 24504), INT16_C( 29929), INT16_C( 20848),
+                            INT16_C( 12948), INT16_C( 23733), INT16_C( 22424), INT16_C( 26914), INT16_C(-31896), INT16_C( -2330), INT16_C( 19625), INT16_C( 32153),
+                            INT16_C( 25030), INT16_C(-31902), INT16_C( 31058), INT16_C( -3023), INT16_C(-22652), INT16_C(  8212), INT16_C( 25210), INT16_C( 10273),
+                            INT16_C( 10056), INT16_C( 17105), INT16_C(  5027), INT16_C( 23383), INT16_C(-21028), INT16_C( -9355), INT16_C(-17615), INT16_C(-13884)),
+      simde_mm512_set_epi16(INT16_C(     8), INT16_C(    10), INT16_C(    11), INT16_C(    11), INT16_C(     9), INT16_C(    10), INT16_C(     9), INT16_C(     6),
+                            INT16_C(     6), INT16_C(     9), INT16_C(     8), INT16_C(     6), INT16_C(     6), INT16_C(    11), INT16_C(     7), INT16_C(    10),
+                            INT16_C(     7), INT16_C(     6), INT16_C(     8), INT16_C(     8), INT16_C(     7), INT16_C(     3), INT16_C(     8), INT16_C(     4),
+                            INT16_C(     6), INT16_C(     6), INT16_C(     7), INT16_C(    10), INT16_C(    10), INT16_C(    11), INT16_C(     9), INT16_C(     7)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_popcnt_epi16(test_vec[i].a);
+    simde_assert_m512i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_popcnt_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask32 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi16(INT16_C( -3037), INT16_C(  7393), INT16_C(  8566), INT16_C( -9104), INT16_C( -2654), INT16_C( -1432), INT16_C( 21028), INT16_C(-28269),
+                            INT16_C( 32565), INT16_C( -8671), INT16_C( 11739), INT16_C( 17046), INT16_C(-16818), INT16_C( -3803), INT16_C( 21216), INT16_C( 17692),
+                            INT16_C(  2529), INT16_C(-18474), INT16_C(  3449), INT16_C( 16291), INT16_C(-19512), INT16_C( -7885), INT16_C( 31795), INT16_C(  8672),
+                            INT16_C(-27664), INT16_C( -7068), INT16_C(  5096), INT16_C( -4096), INT16_C( -9502), INT16_C( 31376), INT16_C(-12514), INT16_C(-10515)),
+      UINT32_C(2380042404),
+      simde_mm512_set_epi16(INT16_C(  3159), INT16_C(   145), INT16_C(-29624), INT16_C(-28870), INT16_C(  7810), INT16_C( -9097), INT16_C(  1845), INT16_C(-19620),
+                            INT16_C(-19388), INT16_C(-23820), INT16_C( 20082), INT16_C( -8543), INT16_C(-15929), INT16_C( -6508), INT16_C( 18153), INT16_C( 14544),
+                            INT16_C( 27485), INT16_C( -9804), INT16_C( 14459), INT16_C(-12917), INT16_C( -4755), INT16_C(-15832), INT16_C( 26321), INT16_C(  2456),
+                            INT16_C( 32174), INT16_C(  4933), INT16_C(-16588), INT16_C( 26003), INT16_C(  7148), INT16_C(-29532), INT16_C( 16029), INT16_C( 11720)),
+      simde_mm512_set_epi16(INT16_C(     7), INT16_C(  7393), INT16_C(  8566), INT16_C( -9104), INT16_C(     6), INT16_C(    11), INT16_C( 21028), INT16_C(     9),
+                            INT16_C(     6), INT16_C(     8), INT16_C( 11739), INT16_C(     9), INT16_C(     8), INT16_C(     8), INT16_C( 21216), INT16_C( 17692),
+                            INT16_C(    10), INT16_C(-18474), INT16_C(  3449), INT16_C(     9), INT16_C(-19512), INT16_C( -7885), INT16_C( 31795), INT16_C(  8672),
+                            INT16_C(    11), INT16_C( -7068), INT16_C(    10), INT16_C( -4096), INT16_C( -9502), INT16_C(     6), INT16_C(-12514), INT16_C(-10515)) },
+    { simde_mm512_set_epi16(INT16_C( -9000), INT16_C(-11346), INT16_C(-30707), INT16_C(-10100), INT16_C( 19390), INT16_C(-21874), INT16_C(-20565), INT16_C(  2334),
+                            INT16_C( 27788), INT16_C( 11533), INT16_C( 15815), INT16_C( 24545), INT16_C( 14688), INT16_C( 15607), INT16_C( 17100), INT16_C( -5194),
+                            INT16_C(-21779), INT16_C( -6555), INT16_C(-25655), INT16_C(-18043), INT16_C( -3559), INT16_C(-19002), INT16_C(  1655), INT16_C( -1487),
+                            INT16_C(-16721), INT16_C( 32383), INT16_C( 30104), INT16_C( -1340), INT16_C( 11187), INT16_C( 18720), INT16_C(-12547), INT16_C(-32635)),
+      UINT32_C(2696718743),
+      simde_mm512_set_epi16(INT16_C(-25798), INT16_C(-23844), INT16_C( 17278), INT16_C(-16853), INT16_C(-10745), INT16_C(-23779), INT16_C(-16946), INT16_C( 20555),
+                            INT16_C( 29284), INT16_C(-18560), INT16_C( 14949), INT16_C( -3672), INT16_C(-17042), INT16_C(  8573), INT16_C( 15577), INT16_C( 20020),
+                            INT16_C(-20138), INT16_C( 26594), INT16_C(-25426), INT16_C(-27620), INT16_C(-16840), INT16_C(-25259), INT16_C(-16775), INT16_C(  -158),
+                            INT16_C(-19119), INT16_C(-28198), INT16_C(-15553), INT16_C(-12355), INT16_C( 30324), INT16_C(-32162), INT16_C(-21248), INT16_C( 24637)),
+      simde_mm512_set_epi16(INT16_C(     9), INT16_C(-11346), INT16_C(     9), INT16_C(-10100), INT16_C( 19390), INT16_C(-21874), INT16_C(-20565), INT16_C(  2334),
+                            INT16_C(     7), INT16_C( 11533), INT16_C(     8), INT16_C(     8), INT16_C(    11), INT16_C(     8), INT16_C( 17100), INT16_C( -5194),
+                            INT16_C(     8), INT16_C( -6555), INT16_C(     9), INT16_C(-18043), INT16_C(     9), INT16_C(-19002), INT16_C(  1655), INT16_C(    11),
+                            INT16_C(     8), INT16_C( 32383), INT16_C( 30104), INT16_C(    12), INT16_C( 11187), INT16_C(     7), INT16_C(     5), INT16_C(     7)) },
+    { simde_mm512_set_epi16(INT16_C(-31206), INT16_C(-13706), INT16_C( 20507), INT16_C(  3468), INT16_C( 27594), INT16_C(-21905), INT16_C(-14895), INT16_C( 10397),
+                            INT16_C(  6883), INT16_C(-19433), INT16_C(-22174), INT16_C( 21113), INT16_C(-31250), INT16_C(  3933), INT16_C( 22805), INT16_C( 23311),
+                            INT16_C(-11753), INT16_C(-22272), INT16_C(-17991), INT16_C(-12908), INT16_C(-28196), INT16_C( -9011), INT16_C(-12007), INT16_C( 29619),
+                            INT16_C(-14215), INT16_C(-16098), INT16_C( 10539), INT16_C( 20142), INT16_C(-32720), INT16_C(-11031), INT16_C( 14317), INT16_C( 21764)),
+      UINT32_C(1699280921),
+      simde_mm512_set_epi16(INT16_C( 26238), INT16_C(  6025), INT16_C(-16394), INT16_C(  9182), INT16_C(-17208), INT16_C(-20741), INT16_C( 13246), INT16_C(-28227),
+                            INT16_C( 29430), INT16_C(-29466), INT16_C(-18151), INT16_C(  5971), INT16_C(-11017), INT16_C(  2783), INT16_C(-31330), INT16_C( 22008),
+                            INT16_C(-31441), INT16_C( -5771), INT16_C( -4356), INT16_C(-23746), INT16_C(-21366), INT16_C(-15071), INT16_C(  1270), INT16_C(-24893),
+                            INT16_C(  -359), INT16_C( -8014), INT16_C( 16666), INT16_C(-11546), INT16_C(-29183), INT16_C(  8166), INT16_C( 27367), INT16_C(-10089)),
+      simde_mm512_set_epi16(INT16_C(-31206), INT16_C(     7), INT16_C(    13), INT16_C(  3468), INT16_C( 27594), INT16_C(    12), INT16_C(-14895), INT16_C(     9),
+                            INT16_C(  6883), INT16_C(     8), INT16_C(-22174), INT16_C( 21113), INT16_C(    11), INT16_C(  3933), INT16_C( 22805), INT16_C( 23311),
+                            INT16_C(     8), INT16_C(    10), INT16_C(    12), INT16_C(     9), INT16_C(     7), INT16_C( -9011), INT16_C(-12007), INT16_C( 29619),
+                            INT16_C(-14215), INT16_C(-16098), INT16_C( 10539), INT16_C(     9), INT16_C(     5), INT16_C(-11031), INT16_C( 14317), INT16_C(     9)) },
+    { simde_mm512_set_epi16(INT16_C( 28070), INT16_C(-22107), INT16_C(-13469), INT16_C(-25092), INT16_C( 15918), INT16_C(  6845), INT16_C(  2753), INT16_C(-32386),
+                            INT16_C( 12696), INT16_C(-11415), INT16_C(-27796), INT16_C(-25973), INT16_C(-28892), INT16_C(  3271), INT16_C( 21690), INT16_C(-27033),
+                            INT16_C(-23450), INT16_C(-24694), INT16_C( 24600), INT16_C( 21964), INT16_C(-12749), INT16_C(-11961), INT16_C( 32130), INT16_C(-15800),
+                            INT16_C(  6820), INT16_C(-26101), INT16_C(-27200), INT16_C( 24438), INT16_C(-28816), INT16_C( 25509), INT16_C( 13293), INT16_C( 20393)),
+      UINT32_C(4060147567),
+      simde_mm512_set_epi16(INT16_C( 20831), INT16_C(  3703), INT16_C(-24231), INT16_C(-23195), INT16_C(  7367), INT16_C( -2070), INT16_C( -8431), INT16_C( 11186),
+                            INT16_C(-14304), INT16_C( -9721), INT16_C( -5553), INT16_C( -3949), INT16_C( -7619), INT16_C(-26440), INT16_C(  2814), INT16_C( 28914),
+                            INT16_C( -4460), INT16_C(-30085), INT16_C(-26580), INT16_C( 30915), INT16_C(  3418), INT16_C(-30399), INT16_C(-22349), INT16_C( 29866),
+                            INT16_C(-18835), INT16_C( 28876), INT16_C(-25558), INT16_C( 29516), INT16_C(-12237), INT16_C( 25523), INT16_C( 24611), INT16_C(-23097)),
+      simde_mm512_set_epi16(INT16_C(     9), INT16_C(     9), INT16_C(     7), INT16_C(     8), INT16_C( 15918), INT16_C(  6845), INT16_C(     9), INT16_C(-32386),
+                            INT16_C( 12696), INT16_C(-11415), INT16_C(-27796), INT16_C(-25973), INT16_C(-28892), INT16_C(  3271), INT16_C( 21690), INT16_C(-27033),
+                            INT16_C(     9), INT16_C(     9), INT16_C(     6), INT16_C( 21964), INT16_C(     7), INT16_C(     5), INT16_C(     8), INT16_C(     8),
+                            INT16_C(  6820), INT16_C(     7), INT16_C(     7), INT16_C( 24438), INT16_C(     7), INT16_C(     9), INT16_C(     5), INT16_C(     9)) },
+    { simde_mm512_set_epi16(INT16_C(  -195), INT16_C(-25342), INT16_C( 21926), INT16_C(  9804), INT16_C( 16356), INT16_C( -1246), INT16_C(-22521), INT16_C(-21484),
+                            INT16_C( -2865), INT16_C( -4585), INT16_C( 31555), INT16_C(-21629), INT16_C(-14598), INT16_C( -3610), INT16_C( 22653), INT16_C( 15935),
+                            INT16_C( 18047), INT16_C(-28308), INT16_C( 26047), INT16_C(-19242), INT16_C( 23024), INT16_C( 28043), INT16_C( 14004), INT16_C(  3658),
+                            INT16_C( -2370), INT16_C( -7067), INT16_C(-14176), INT16_C(  2203), INT16_C( -6443), INT16_C( -3508), INT16_C( -4400), INT16_C(-10895)),
+      UINT32_C(3953996372),
+      simde_mm512_set_epi16(INT16_C(-12384), INT16_C(-14954), INT16_C( 22321), INT16_C(-14502), INT16_C(-27827), INT16_C(-29542), INT16_C( 15503), INT16_C(-27469),
+                            INT16_C(-24670), INT16_C(  7723), INT16_C(-17012), INT16_C( -7887), INT16_C(-23889), INT16_C( -3385), INT16_C( -5774), INT16_C( 11821),
+                            INT16_C( -5285), INT16_C(-12304), INT16_C( -6647), INT16_C(-31643), INT16_C( -6631), INT16_C( 16776), INT16_C(  7120), INT16_C(-30667),
+                            INT16_C(   266), INT16_C( 21503), INT16_C( 29643), INT16_C(-23566), INT16_C(-27593), INT16_C(  5251), INT16_C(  3661), INT16_C( 30976)),
+      simde_mm512_set_epi16(INT16_C(     8), INT16_C(     8), INT16_C(     8), INT16_C(  9804), INT16_C(     8), INT16_C( -1246), INT16_C(     9), INT16_C(     8),
+                            INT16_C(     9), INT16_C( -4585), INT16_C(     9), INT16_C(-21629), INT16_C(     9), INT16_C(    10), INT16_C( 22653), INT16_C(     8),
+                            INT16_C( 18047), INT16_C(-28308), INT16_C(     7), INT16_C(     6), INT16_C( 23024), INT16_C( 28043), INT16_C(     7), INT16_C(  3658),
+                            INT16_C( -2370), INT16_C(    12), INT16_C(-14176), INT16_C(     9), INT16_C( -6443), INT16_C(     5), INT16_C( -4400), INT16_C(-10895)) },
+    { simde_mm512_set_epi16(INT16_C(-30434), INT16_C(-24385), INT16_C(   876), INT16_C(-31070), INT16_C( 28636), INT16_C( -2080), INT16_C( 22435), INT16_C(-29122),
+                            INT16_C(-16624), INT16_C(-30348), INT16_C(-22375), INT16_C( 25210), INT16_C( 26635), INT16_C(-23560), INT16_C( -9928), INT16_C( 22421),
+                            INT16_C( 20341), INT16_C(-13999), INT16_C(-13458), INT16_C( 11011), INT16_C( -1110), INT16_C(-27535), INT16_C( 29736), INT16_C(  3417),
+                            INT16_C( -2876), INT16_C( -5702), INT16_C( 15643), INT16_C(  2506), INT16_C(-16126), INT16_C( -4679), INT16_C(-27364), INT16_C( 32048)),
+      UINT32_C(3738478928),
+      simde_mm512_set_epi16(INT16_C( 11718), INT16_C( 12232), INT16_C(-14250), INT16_C(   403), INT16_C( 16928), INT16_C( -6072), INT16_C(  5545), INT16_C(  9688),
+                            INT16_C(  8310), INT16_C( 23456), INT16_C( 23517), INT16_C(-28487), INT16_C( -7132), INT16_C(-13644), INT16_C(  1789), INT16_C( 22601),
+                            INT16_C(-25879), INT16_C(-26021), INT16_C(-12367), INT16_C(  4137), INT16_C( 25859), INT16_C(-22640), INT16_C(  2562), INT16_C( 11262),
+                            INT16_C(-11140), INT16_C( 18668), INT16_C(-17926), INT16_C(  8065), INT16_C( -1771), INT16_C( 16236), INT16_C( 22721), INT16_C(-18641)),
+      simde_mm512_set_epi16(INT16_C(     8), INT16_C(     8), INT16_C(   876), INT16_C(     5), INT16_C(     3), INT16_C(     6), INT16_C(     7), INT16_C(-29122),
+                            INT16_C(     6), INT16_C(     7), INT16_C(-22375), INT16_C(     7), INT16_C( 26635), INT16_C(     8), INT16_C( -9928), INT16_C( 22421),
+                            INT16_C(     9), INT16_C(-13999), INT16_C(    10), INT16_C( 11011), INT16_C(     6), INT16_C(-27535), INT16_C( 29736), INT16_C(    11),
+                            INT16_C( -2876), INT16_C(     7), INT16_C( 15643), INT16_C(     7), INT16_C(-16126), INT16_C( -4679), INT16_C(-27364), INT16_C( 32048)) },
+    { simde_mm512_set_epi16(INT16_C( 24233), INT16_C(-19239), INT16_C(  6647), INT16_C( 18799), INT16_C(  7072), INT16_C(   333), INT16_C(-31442), INT16_C( -2684),
+                            INT16_C( 31862), INT16_C( -6977), INT16_C( -9202), INT16_C( 28772), INT16_C(-19113), INT16_C(-25007), INT16_C(-16016), INT16_C(  4487),
+                            INT16_C( 15833), INT16_C( -4435), INT16_C( 25638), INT16_C(-22060), INT16_C(-26771), INT16_C( 19786), INT16_C( 10058), INT16_C(-20170),
+                            INT16_C(-21507), INT16_C(-27289), INT16_C(-31398), INT16_C(-12758), INT16_C(-30901), INT16_C(  7257), INT16_C( -9363), INT16_C( 21506)),
+      UINT32_C(2799671177),
+      simde_mm512_set_epi16(INT16_C(-30431), INT16_C(  4631), INT16_C( 12969), INT16_C( -1026), INT16_C( 18903), INT16_C(-30742), INT16_C( 22118), INT16_C( -3812),
+                            INT16_C(-28704), INT16_C(-12892), INT16_C( 21474), INT16_C(-16985), INT16_C( -8517), INT16_C( 20089), INT16_C(-11418), INT16_C(-29061),
+                            INT16_C( -5828), INT16_C(-20868), INT16_C(-13741), INT16_C( 17459), INT16_C(  6389), INT16_C(  9454), INT16_C( -1925), INT16_C(-13721),
+                            INT16_C(-12095), INT16_C(-26672), INT16_C( -5627), INT16_C( 12613), INT16_C(-29326), INT16_C(-29506), INT16_C(  1857), INT16_C(  7229)),
+      simde_mm512_set_epi16(INT16_C(     5), INT16_C(-19239), INT16_C(     7), INT16_C( 18799), INT16_C(  7072), INT16_C(     9), INT16_C(     8), INT16_C( -2684),
+                            INT16_C(     8), INT16_C(     8), INT16_C( -9202), INT16_C(    11), INT16_C(    12), INT16_C(     9), INT16_C(     9), INT16_C(    10),
+                            INT16_C(     9), INT16_C( -4435), INT16_C( 25638), INT16_C(     6), INT16_C(-26771), INT16_C(     8), INT16_C(    11), INT16_C(     9),
+                            INT16_C(     6), INT16_C(-27289), INT16_C(-31398), INT16_C(-12758), INT16_C(     8), INT16_C(  7257), INT16_C( -9363), INT16_C(     8)) },
+    { simde_mm512_set_epi16(INT16_C(-11378), INT16_C( 22780), INT16_C( 15532), INT16_C( 11103), INT16_C( -7391), INT16_C( 17476), INT16_C( -9965), INT16_C( -3461),
+                            INT16_C( 13341), INT16_C( 18627), INT16_C( -5832), INT16_C( -5720), INT16_C( -8676), INT16_C(-27161), INT16_C( 18533), INT16_C( 11957),
+                            INT16_C(-22592), INT16_C( 15230), INT16_C( -9667), INT16_C( -4118), INT16_C( 23156), INT16_C( -5369), INT16_C(-25379), INT16_C(  2686),
+                            INT16_C(  3277), INT16_C(  2893), INT16_C(-13472), INT16_C(  1715), INT16_C( 31091), INT16_C( -9778), INT16_C( 21834), INT16_C( -5402)),
+      UINT32_C(3636694167),
+      simde_mm512_set_epi16(INT16_C( 14426), INT16_C( -7206), INT16_C(-25815), INT16_C( 11724), INT16_C(  2111), INT16_C(-22677), INT16_C(   749), INT16_C( 30780),
+                            INT16_C( 10773), INT16_C( 15761), INT16_C(-29114), INT16_C( 29337), INT16_C( 21285), INT16_C( 29125), INT16_C(  2286), INT16_C(-28293),
+                            INT16_C(-11122), INT16_C( 25493), INT16_C(  -310), INT16_C( 28064), INT16_C( -1845), INT16_C( -7562), INT16_C(  1429), INT16_C( 18996),
+                            INT16_C( 26768), INT16_C(-25184), INT16_C(-22040), INT16_C(  6656), INT16_C( -7922), INT16_C( 10687), INT16_C( -7386), INT16_C( 17609)),
+      simde_mm512_set_epi16(INT16_C(     7), INT16_C(    10), INT16_C( 15532), INT16_C(     8), INT16_C(     7), INT16_C( 17476), INT16_C( -9965), INT16_C( -3461),
+                            INT16_C(     6), INT16_C(     8), INT16_C( -5832), INT16_C( -5720), INT16_C( -8676), INT16_C(-27161), INT16_C(     7), INT16_C(     9),
+                            INT16_C(     8), INT16_C( 15230), INT16_C( -9667), INT16_C( -4118), INT16_C(    10), INT16_C(     9), INT16_C(-25379), INT16_C(  2686),
+                            INT16_C(     5), INT16_C(  2893), INT16_C(-13472), INT16_C(     3), INT16_C( 31091), INT16_C(    10), INT16_C(     8), INT16_C(     6)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_popcnt_epi16(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_popcnt_epi16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask32 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT32_C(2147125988),
+      simde_mm512_set_epi16(INT16_C( 13305), INT16_C(-25881), INT16_C( 26363), INT16_C( -6165), INT16_C( 15116), INT16_C(-14756), INT16_C(   870), INT16_C( 24278),
+                            INT16_C( 14139), INT16_C( -9741), INT16_C( 19157), INT16_C( 15914), INT16_C( 23056), INT16_C(  9130), INT16_C( -4802), INT16_C(  3892),
+                            INT16_C(-32206), INT16_C(-25503), INT16_C(  8377), INT16_C(  -375), INT16_C(-11000), INT16_C(-14749), INT16_C( 16458), INT16_C( 20374),
+                            INT16_C( 19691), INT16_C( 18336), INT16_C(  3100), INT16_C(-23982), INT16_C(-14247), INT16_C( 18060), INT16_C(  3743), INT16_C(-12722)),
+      simde_mm512_set_epi16(INT16_C(     0), INT16_C(    10), INT16_C(    11), INT16_C(    12), INT16_C(     7), INT16_C(     8), INT16_C(     6), INT16_C(    10),
+                            INT16_C(    10), INT16_C(    11), INT16_C(     8), INT16_C(     8), INT16_C(     5), INT16_C(     0), INT16_C(    11), INT16_C(     0),
+                            INT16_C(     5), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     6), INT16_C(     0), INT16_C(     4), INT16_C(     0),
+                            INT16_C(     9), INT16_C(     6), INT16_C(     5), INT16_C(     0), INT16_C(     0), INT16_C(     6), INT16_C(     0), INT16_C(     0)) },
+    { UINT32_C(3354335189),
+      simde_mm512_set_epi16(INT16_C(-18551), INT16_C(-32029), INT16_C( -9669), INT16_C( -9754), INT16_C( 16353), INT16_C( 21211), INT16_C(-17174), INT16_C(-14677),
+                            INT16_C(-25154), INT16_C(  3352), INT16_C( 13675), INT16_C( 29453), INT16_C(-25814), INT16_C(-30796), INT16_C(-23730), INT16_C( 22371),
+                            INT16_C(-15789), INT16_C(  3006), INT16_C( -2681), INT16_C(  8545), INT16_C(-16050), INT16_C( 19235), INT16_C(-11346), INT16_C( 18156),
+                            INT16_C(  1721), INT16_C( 16805), INT16_C( 28048), INT16_C( -6084), INT16_C(    83), INT16_C(-26826), INT16_C( 16153), INT16_C( 18161)),
+      simde_mm512_set_epi16(INT16_C(     9), INT16_C(     7), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     9), INT16_C(    10), INT16_C(     9),
+                            INT16_C(    11), INT16_C(     5), INT16_C(     9), INT16_C(     0), INT16_C(     8), INT16_C(     8), INT16_C(     8), INT16_C(     9),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     5), INT16_C(     0), INT16_C(     7), INT16_C(    10), INT16_C(     8),
+                            INT16_C(     7), INT16_C(     6), INT16_C(     0), INT16_C(     8), INT16_C(     0), INT16_C(     9), INT16_C(     0), INT16_C(     8)) },
+    { UINT32_C( 321473302),
+      simde_mm512_set_epi16(INT16_C( -9547), INT16_C( -7004), INT16_C( 15963), INT16_C( 12104), INT16_C( 18030), INT16_C(-17181), INT16_C( -7545), INT16_C(  8716),
+                            INT16_C(-30943), INT16_C(  7662), INT16_C(-21220), INT16_C(-28717), INT16_C(-21266), INT16_C(-12118), INT16_C( -1678), INT16_C(  5624),
+                            INT16_C(-19033), INT16_C(-27436), INT16_C( -9429), INT16_C( 22100), INT16_C( 23288), INT16_C(-15371), INT16_C(-22963), INT16_C( 20105),
+                            INT16_C( 31722), INT16_C( 24359), INT16_C(-17947), INT16_C(-23293), INT16_C( 24482), INT16_C(-21269), INT16_C( 23595), INT16_C(-25414)),
+      simde_mm512_set_epi16(INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     7), INT16_C(     0), INT16_C(     0), INT16_C(     8), INT16_C(     4),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     8), INT16_C(     0), INT16_C(    10), INT16_C(     0), INT16_C(     0), INT16_C(     8),
+                            INT16_C(     0), INT16_C(     7), INT16_C(     0), INT16_C(     0), INT16_C(     9), INT16_C(     0), INT16_C(     8), INT16_C(     7),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     6), INT16_C(     0), INT16_C(    10), INT16_C(     8), INT16_C(     0)) },
+    { UINT32_C( 268459200),
+      simde_mm512_set_epi16(INT16_C(-12712), INT16_C(-27031), INT16_C( 29365), INT16_C(  9417), INT16_C( 25403), INT16_C( 27020), INT16_C( -7678), INT16_C(   783),
+                            INT16_C( 28634), INT16_C( 32327), INT16_C(-10286), INT16_C( 18304), INT16_C(  4031), INT16_C( -3578), INT16_C(  7218), INT16_C(  8837),
+                            INT16_C(-31888), INT16_C( 27133), INT16_C(-20061), INT16_C(-10123), INT16_C(-19425), INT16_C(  2251), INT16_C( 31569), INT16_C(-15108),
+                            INT16_C( -9275), INT16_C(-24155), INT16_C( 28948), INT16_C( 25144), INT16_C( 23456), INT16_C(-20181), INT16_C(-29121), INT16_C(  7168)),
+      simde_mm512_set_epi16(INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     6), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(    11), INT16_C(     0), INT16_C(     9), INT16_C(     9), INT16_C(     6), INT16_C(     0), INT16_C(     0),
+                            INT16_C(    10), INT16_C(     7), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0)) },
+    { UINT32_C(3885246194),
+      simde_mm512_set_epi16(INT16_C( 28283), INT16_C(-26269), INT16_C(-24179), INT16_C( 32524), INT16_C(  8544), INT16_C(  7779), INT16_C(  1721), INT16_C(-30184),
+                            INT16_C(-13700), INT16_C( -5484), INT16_C( 26968), INT16_C( 10312), INT16_C( -7960), INT16_C(-13446), INT16_C( -5484), INT16_C(  7280),
+                            INT16_C(-16628), INT16_C(  1520), INT16_C( 29613), INT16_C( 21334), INT16_C( -3488), INT16_C(-26021), INT16_C(  4814), INT16_C(  4976),
+                            INT16_C(-29716), INT16_C( -4748), INT16_C( -8975), INT16_C( -5919), INT16_C( 11946), INT16_C( 23893), INT16_C( 23901), INT16_C( 27769)),
+      simde_mm512_set_epi16(INT16_C(    11), INT16_C(     8), INT16_C(     7), INT16_C(     0), INT16_C(     0), INT16_C(     8), INT16_C(     7), INT16_C(     5),
+                            INT16_C(     9), INT16_C(     0), INT16_C(     0), INT16_C(     4), INT16_C(     0), INT16_C(    10), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     0), INT16_C(     0), INT16_C(    10), INT16_C(     0), INT16_C(     0), INT16_C(     9), INT16_C(     7), INT16_C(     0),
+                            INT16_C(     9), INT16_C(    10), INT16_C(    10), INT16_C(     8), INT16_C(     0), INT16_C(     0), INT16_C(    10), INT16_C(     0)) },
+    { UINT32_C(2398844785),
+      simde_mm512_set_epi16(INT16_C( 20075), INT16_C(  5124), INT16_C(-32054), INT16_C(-13529), INT16_C(-17692), INT16_C( 30699), INT16_C(-14393), INT16_C(-22219),
+                            INT16_C(  4048), INT16_C( 25233), INT16_C(-11126), INT16_C(   117), INT16_C( 27367), INT16_C(-31482), INT16_C(  3827), INT16_C( 21200),
+                            INT16_C( 12175), INT16_C(  7565), INT16_C(-25722), INT16_C( 21431), INT16_C( 28364), INT16_C( 16806), INT16_C(-22901), INT16_C(-20949),
+                            INT16_C(  4568), INT16_C(-18153), INT16_C(-13224), INT16_C( 30747), INT16_C(-13414), INT16_C(-14442), INT16_C(-19470), INT16_C( -3521)),
+      simde_mm512_set_epi16(INT16_C(     9), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     9), INT16_C(    12), INT16_C(    10), INT16_C(     0),
+                            INT16_C(     7), INT16_C(     6), INT16_C(     7), INT16_C(     5), INT16_C(    10), INT16_C(     0), INT16_C(     9), INT16_C(     6),
+                            INT16_C(     0), INT16_C(     8), INT16_C(     8), INT16_C(    10), INT16_C(     0), INT16_C(     6), INT16_C(     8), INT16_C(     9),
+                            INT16_C(     0), INT16_C(     9), INT16_C(     7), INT16_C(     8), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(    11)) },
+    { UINT32_C(1041411285),
+      simde_mm512_set_epi16(INT16_C( -1445), INT16_C(-15363), INT16_C( -8404), INT16_C( 16854), INT16_C(-25604), INT16_C(-24043), INT16_C( 10028), INT16_C(-10565),
+                            INT16_C( 21557), INT16_C(  6960), INT16_C( 23950), INT16_C(-22985), INT16_C(  4481), INT16_C(-24339), INT16_C(   239), INT16_C(-30855),
+                            INT16_C( 16034), INT16_C(-19721), INT16_C(-19128), INT16_C( 12698), INT16_C( 13305), INT16_C(-30193), INT16_C(  9962), INT16_C(-23651),
+                            INT16_C( -7086), INT16_C( 11685), INT16_C( 18451), INT16_C( 15588), INT16_C(-29249), INT16_C(-22057), INT16_C( 27243), INT16_C( 32223)),
+      simde_mm512_set_epi16(INT16_C(     0), INT16_C(     0), INT16_C(    10), INT16_C(     7), INT16_C(    11), INT16_C(     6), INT16_C(     7), INT16_C(     0),
+                            INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     9), INT16_C(     0), INT16_C(     0), INT16_C(     7), INT16_C(     0),
+                            INT16_C(     8), INT16_C(     0), INT16_C(     7), INT16_C(     0), INT16_C(    10), INT16_C(     7), INT16_C(     0), INT16_C(     0),
+                            INT16_C(     7), INT16_C(     8), INT16_C(     0), INT16_C(     8), INT16_C(     0), INT16_C(    10), INT16_C(     0), INT16_C(    13)) },
+    { UINT32_C( 500537203),
+      simde_mm512_set_epi16(INT16_C( -9009), INT16_C( 24065), INT16_C(-29119), INT16_C( 29072), INT16_C( 11151), INT16_C( -1155), INT16_C( -1616), INT16_C(  6434),
+                            INT16_C( 17085), INT16_C(-28677), INT16_C( 13795), INT16_C(-31509), INT16_C( -8150), INT16_C( 26480), INT16_C(-16143), INT16_C(  2107),
+                            INT16_C( 19961), INT16_C(  4022), INT16_C(-19489), INT16_C(-12697), INT16_C( 25612), INT16_C( 22536), INT16_C(-26531), INT16_C(-30474),
+                            INT16_C( 11878), INT16_C( -5410), INT16_C( -8518), INT16_C(  8693), INT16_C( 17198), INT16_C( 25941), INT16_C( -6969), INT16_C(  7372)),
+      simde_mm512_set_epi16(INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     6), INT16_C(     9), INT16_C(    13), INT16_C(     0), INT16_C(     5),
+                            INT16_C(     8), INT16_C(    12), INT16_C(     0), INT16_C(     8), INT16_C(     0), INT16_C(     8), INT16_C(     0), INT16_C(     6),
+                            INT16_C(    10), INT16_C(     0), INT16_C(     0), INT16_C(    10), INT16_C(     0), INT16_C(     4), INT16_C(     8), INT16_C(     8),
+                            INT16_C(     0), INT16_C(    11), INT16_C(    11), INT16_C(     8), INT16_C(     0), INT16_C(     0), INT16_C(     9), INT16_C(     7)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_popcnt_epi16(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_popcnt_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C(  -5), INT8_C( -27), INT8_C(  32), INT8_C( -13), INT8_C( 106), INT8_C( -41), INT8_C( -67), INT8_C(-116),
+                           INT8_C( -91), INT8_C(  74), INT8_C( -52), INT8_C( 114), INT8_C(  48), INT8_C(  86), INT8_C(-126), INT8_C( -55),
+                           INT8_C( 118), INT8_C( -84), INT8_C( -18), INT8_C(  52), INT8_C( -23), INT8_C(  79), INT8_C(  52), INT8_C( -96),
+                           INT8_C( -15), INT8_C(  66), INT8_C( -41), INT8_C(  99), INT8_C(  33), INT8_C( 121), INT8_C( -54), INT8_C(  52),
+                           INT8_C( -34), INT8_C( -86), INT8_C( -93), INT8_C( -27), INT8_C(-108), INT8_C(  63), INT8_C(  46), INT8_C( 104),
+                           INT8_C(  86), INT8_C(   7), INT8_C( 109), INT8_C( 104), INT8_C(  92), INT8_C( -13), INT8_C( -62), INT8_C( -83),
+                           INT8_C( -51), INT8_C( 113), INT8_C(  54), INT8_C( -75), INT8_C(  61), INT8_C( 102), INT8_C( -72), INT8_C( -36),
+                           INT8_C(-110), INT8_C(   8), INT8_C(   2), INT8_C( 105), INT8_C(  57), INT8_C(  95), INT8_C(-128), INT8_C( -99)),
+      simde_mm512_set_epi8(INT8_C(   7), INT8_C(   5), INT8_C(   1), INT8_C(   6), INT8_C(   4), INT8_C(   6), INT8_C(   6), INT8_C(   3),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   2), INT8_C(   4), INT8_C(   2), INT8_C(   4),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   6), INT8_C(   3), INT8_C(   5), INT8_C(   5), INT8_C(   3), INT8_C(   2),
+                           INT8_C(   5), INT8_C(   2), INT8_C(   6), INT8_C(   4), INT8_C(   2), INT8_C(   5), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   6), INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(   3), INT8_C(   6), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   3), INT8_C(   4), INT8_C(   6), INT8_C(   3), INT8_C(   5),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(   5), INT8_C(   4), INT8_C(   4), INT8_C(   5),
+                           INT8_C(   3), INT8_C(   1), INT8_C(   1), INT8_C(   4), INT8_C(   4), INT8_C(   6), INT8_C(   1), INT8_C(   5)) },
+    { simde_mm512_set_epi8(INT8_C( -62), INT8_C( -45), INT8_C(  48), INT8_C( -55), INT8_C( 107), INT8_C(-100), INT8_C( -36), INT8_C( -50),
+                           INT8_C( -49), INT8_C(-127), INT8_C(  40), INT8_C( -76), INT8_C(-104), INT8_C(  89), INT8_C( -88), INT8_C(  30),
+                           INT8_C( -61), INT8_C( -21), INT8_C( -17), INT8_C(  74), INT8_C(-110), INT8_C( 122), INT8_C(-116), INT8_C( -57),
+                           INT8_C(  79), INT8_C(  59), INT8_C( -17), INT8_C(-108), INT8_C(  47), INT8_C(  26), INT8_C(  81), INT8_C(  37),
+                           INT8_C( -38), INT8_C(   3), INT8_C( -16), INT8_C( -55), INT8_C(-125), INT8_C( -29), INT8_C(  43), INT8_C( -14),
+                           INT8_C(   1), INT8_C( 123), INT8_C(  81), INT8_C(  13), INT8_C( -32), INT8_C(-128), INT8_C( 122), INT8_C( -57),
+                           INT8_C( -56), INT8_C( -71), INT8_C( -16), INT8_C( 111), INT8_C(  26), INT8_C( -61), INT8_C(   9), INT8_C( -44),
+                           INT8_C(  41), INT8_C(  33), INT8_C(  39), INT8_C(-117), INT8_C(  45), INT8_C( -78), INT8_C( -15), INT8_C(  -9)),
+      simde_mm512_set_epi8(INT8_C(   3), INT8_C(   5), INT8_C(   2), INT8_C(   4), INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C(   5),
+                           INT8_C(   6), INT8_C(   2), INT8_C(   2), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   3), INT8_C(   4),
+                           INT8_C(   4), INT8_C(   6), INT8_C(   7), INT8_C(   3), INT8_C(   3), INT8_C(   5), INT8_C(   3), INT8_C(   5),
+                           INT8_C(   5), INT8_C(   5), INT8_C(   7), INT8_C(   3), INT8_C(   5), INT8_C(   3), INT8_C(   3), INT8_C(   3),
+                           INT8_C(   5), INT8_C(   2), INT8_C(   4), INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   4), INT8_C(   5),
+                           INT8_C(   1), INT8_C(   6), INT8_C(   3), INT8_C(   3), INT8_C(   3), INT8_C(   1), INT8_C(   5), INT8_C(   5),
+                           INT8_C(   3), INT8_C(   5), INT8_C(   4), INT8_C(   6), INT8_C(   3), INT8_C(   4), INT8_C(   2), INT8_C(   4),
+                           INT8_C(   3), INT8_C(   2), INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(   7)) },
+    { simde_mm512_set_epi8(INT8_C( 123), INT8_C(  39), INT8_C(  17), INT8_C( -41), INT8_C( -40), INT8_C( -34), INT8_C( -79), INT8_C(  48),
+                           INT8_C( 116), INT8_C( -74), INT8_C(  61), INT8_C(  19), INT8_C(-119), INT8_C(  10), INT8_C( -80), INT8_C(  80),
+                           INT8_C(  70), INT8_C(-121), INT8_C( 127), INT8_C( 114), INT8_C(  26), INT8_C( 100), INT8_C( 119), INT8_C(  62),
+                           INT8_C(  20), INT8_C( -53), INT8_C( -32), INT8_C( -58), INT8_C(-113), INT8_C(  49), INT8_C( -46), INT8_C(  26),
+                           INT8_C(-111), INT8_C(  71), INT8_C(  71), INT8_C(  45), INT8_C( -96), INT8_C(  54), INT8_C( -18), INT8_C(  70),
+                           INT8_C(  88), INT8_C( 109), INT8_C( -94), INT8_C(  18), INT8_C(  28), INT8_C(  74), INT8_C( -77), INT8_C(  32),
+                           INT8_C( 110), INT8_C( -52), INT8_C( -38), INT8_C(  36), INT8_C( -27), INT8_C( 116), INT8_C(  93), INT8_C(  26),
+                           INT8_C( -74), INT8_C(-128), INT8_C(-126), INT8_C(  75), INT8_C( -88), INT8_C(  11), INT8_C(  22), INT8_C(  -9)),
+      simde_mm512_set_epi8(INT8_C(   6), INT8_C(   4), INT8_C(   2), INT8_C(   6), INT8_C(   4), INT8_C(   6), INT8_C(   4), INT8_C(   2),
+                           INT8_C(   4), INT8_C(   5), INT8_C(   5), INT8_C(   3), INT8_C(   3), INT8_C(   2), INT8_C(   3), INT8_C(   2),
+                           INT8_C(   3), INT8_C(   4), INT8_C(   7), INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   6), INT8_C(   5),
+                           INT8_C(   2), INT8_C(   5), INT8_C(   3), INT8_C(   4), INT8_C(   5), INT8_C(   3), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   2), INT8_C(   4), INT8_C(   6), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   5), INT8_C(   3), INT8_C(   2), INT8_C(   3), INT8_C(   3), INT8_C(   5), INT8_C(   1),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C(   2), INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C(   3),
+                           INT8_C(   5), INT8_C(   1), INT8_C(   2), INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   3), INT8_C(   7)) },
+    { simde_mm512_set_epi8(INT8_C( -61), INT8_C( -48), INT8_C( -92), INT8_C(  53), INT8_C(  12), INT8_C( 125), INT8_C( -89), INT8_C( -58),
+                           INT8_C(-122), INT8_C( -72), INT8_C(  30), INT8_C( 118), INT8_C(-127), INT8_C( -30), INT8_C( -67), INT8_C(  -3),
+                           INT8_C(  71), INT8_C(-112), INT8_C( -88), INT8_C(  19), INT8_C(  62), INT8_C(  91), INT8_C( -90), INT8_C( -80),
+                           INT8_C(-122), INT8_C(-118), INT8_C( -29), INT8_C(  59), INT8_C( -77), INT8_C( -86), INT8_C( -22), INT8_C( 100),
+                           INT8_C(  44), INT8_C(  63), INT8_C(-121), INT8_C(-127), INT8_C( -88), INT8_C( -41), INT8_C( -56), INT8_C( -75),
+                           INT8_C(  86), INT8_C( -92), INT8_C(-105), INT8_C(  63), INT8_C(  41), INT8_C(   9), INT8_C( 101), INT8_C(  -2),
+                           INT8_C(-126), INT8_C(-125), INT8_C(-125), INT8_C(  72), INT8_C(  36), INT8_C(-109), INT8_C(-106), INT8_C(  82),
+                           INT8_C(  58), INT8_C(  28), INT8_C(  -4), INT8_C( -45), INT8_C(  22), INT8_C(  65), INT8_C(  64), INT8_C(  82)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   4), INT8_C(   2), INT8_C(   6), INT8_C(   5), INT8_C(   4),
+                           INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(   2), INT8_C(   4), INT8_C(   6), INT8_C(   7),
+                           INT8_C(   4), INT8_C(   2), INT8_C(   3), INT8_C(   3), INT8_C(   5), INT8_C(   5), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   3), INT8_C(   5), INT8_C(   5), INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   6), INT8_C(   4), INT8_C(   2), INT8_C(   3), INT8_C(   6), INT8_C(   3), INT8_C(   5),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   6), INT8_C(   3), INT8_C(   2), INT8_C(   4), INT8_C(   7),
+                           INT8_C(   2), INT8_C(   3), INT8_C(   3), INT8_C(   2), INT8_C(   2), INT8_C(   4), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   6), INT8_C(   5), INT8_C(   3), INT8_C(   2), INT8_C(   1), INT8_C(   3)) },
+    { simde_mm512_set_epi8(INT8_C(  11), INT8_C( -84), INT8_C(  57), INT8_C(  10), INT8_C(  91), INT8_C( -26), INT8_C(  55), INT8_C( -93),
+                           INT8_C(-102), INT8_C( -15), INT8_C(-124), INT8_C( -24), INT8_C( 109), INT8_C(-121), INT8_C(  65), INT8_C(  97),
+                           INT8_C(  38), INT8_C(  48), INT8_C(  66), INT8_C( -58), INT8_C(  77), INT8_C(-110), INT8_C(  86), INT8_C( -52),
+                           INT8_C(   9), INT8_C( -79), INT8_C(  83), INT8_C(  27), INT8_C( -84), INT8_C(  35), INT8_C(-100), INT8_C( -75),
+                           INT8_C(  18), INT8_C( 127), INT8_C(  73), INT8_C(  76), INT8_C( -21), INT8_C(  97), INT8_C(  -4), INT8_C(  13),
+                           INT8_C( 121), INT8_C( 101), INT8_C( -81), INT8_C( -81), INT8_C(   4), INT8_C(  82), INT8_C( -20), INT8_C( -44),
+                           INT8_C(-125), INT8_C(  30), INT8_C(-109), INT8_C(  99), INT8_C(  22), INT8_C( -43), INT8_C( -61), INT8_C(-109),
+                           INT8_C(-123), INT8_C(-101), INT8_C(  50), INT8_C(  89), INT8_C(  23), INT8_C( -26), INT8_C( 109), INT8_C(   9)),
+      simde_mm512_set_epi8(INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   2), INT8_C(   5), INT8_C(   5), INT8_C(   5), INT8_C(   4),
+                           INT8_C(   4), INT8_C(   5), INT8_C(   2), INT8_C(   4), INT8_C(   5), INT8_C(   4), INT8_C(   2), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   2), INT8_C(   2), INT8_C(   4), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   4),
+                           INT8_C(   2), INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   5),
+                           INT8_C(   2), INT8_C(   7), INT8_C(   3), INT8_C(   3), INT8_C(   6), INT8_C(   3), INT8_C(   6), INT8_C(   3),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   6), INT8_C(   6), INT8_C(   1), INT8_C(   3), INT8_C(   5), INT8_C(   4),
+                           INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   4), INT8_C(   4),
+                           INT8_C(   3), INT8_C(   5), INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(   5), INT8_C(   2)) },
+    { simde_mm512_set_epi8(INT8_C( -54), INT8_C( -91), INT8_C( -23), INT8_C( -85), INT8_C( -60), INT8_C(-118), INT8_C(-113), INT8_C( 109),
+                           INT8_C(  90), INT8_C(  81), INT8_C(  80), INT8_C(  13), INT8_C( 103), INT8_C( -14), INT8_C( -34), INT8_C( -48),
+                           INT8_C(  98), INT8_C(  95), INT8_C(-125), INT8_C( -39), INT8_C( 113), INT8_C(  82), INT8_C( 107), INT8_C( -57),
+                           INT8_C( 105), INT8_C(  92), INT8_C( -79), INT8_C( -11), INT8_C( -36), INT8_C(   4), INT8_C(-126), INT8_C(   3),
+                           INT8_C(  56), INT8_C( -30), INT8_C(-108), INT8_C(  90), INT8_C(  48), INT8_C( 114), INT8_C(   4), INT8_C(-118),
+                           INT8_C(  34), INT8_C(  22), INT8_C( -79), INT8_C(-128), INT8_C( -46), INT8_C(  11), INT8_C(  64), INT8_C( -53),
+                           INT8_C(  90), INT8_C(  82), INT8_C( -87), INT8_C( 114), INT8_C(  48), INT8_C( -75), INT8_C(  80), INT8_C( -22),
+                           INT8_C(  92), INT8_C( -80), INT8_C(-120), INT8_C( -62), INT8_C(-106), INT8_C(  48), INT8_C( 115), INT8_C(  12)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(   5), INT8_C(   3), INT8_C(   3), INT8_C(   5), INT8_C(   5),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   2), INT8_C(   3), INT8_C(   5), INT8_C(   5), INT8_C(   6), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   6), INT8_C(   3), INT8_C(   5), INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   5),
+                           INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   6), INT8_C(   5), INT8_C(   1), INT8_C(   2), INT8_C(   2),
+                           INT8_C(   3), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   2), INT8_C(   4), INT8_C(   1), INT8_C(   3),
+                           INT8_C(   2), INT8_C(   3), INT8_C(   4), INT8_C(   1), INT8_C(   4), INT8_C(   3), INT8_C(   1), INT8_C(   5),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   2), INT8_C(   5), INT8_C(   2), INT8_C(   5),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   2), INT8_C(   3), INT8_C(   4), INT8_C(   2), INT8_C(   5), INT8_C(   2)) },
+    { simde_mm512_set_epi8(INT8_C(  76), INT8_C(  66), INT8_C(  33), INT8_C(   5), INT8_C( -62), INT8_C( -81), INT8_C(-120), INT8_C(  52),
+                           INT8_C(   0), INT8_C(  10), INT8_C(  46), INT8_C( -80), INT8_C(-110), INT8_C(  29), INT8_C(  53), INT8_C( -97),
+                           INT8_C( 107), INT8_C(  46), INT8_C( -99), INT8_C( -61), INT8_C( 102), INT8_C( -67), INT8_C( -79), INT8_C(  -4),
+                           INT8_C(-115), INT8_C(  78), INT8_C(  67), INT8_C( -43), INT8_C( -21), INT8_C(   4), INT8_C(  36), INT8_C( -11),
+                           INT8_C(  91), INT8_C( -26), INT8_C( -35), INT8_C( -37), INT8_C(   5), INT8_C(  66), INT8_C(   9), INT8_C(  39),
+                           INT8_C( -63), INT8_C( -69), INT8_C( -27), INT8_C(   9), INT8_C(  26), INT8_C(  52), INT8_C(-111), INT8_C(  69),
+                           INT8_C(-119), INT8_C(  51), INT8_C(  13), INT8_C(-116), INT8_C( -26), INT8_C( -45), INT8_C(-102), INT8_C(  49),
+                           INT8_C(  23), INT8_C(  78), INT8_C( 112), INT8_C(-125), INT8_C(  34), INT8_C(  43), INT8_C( -31), INT8_C(  51)),
+      simde_mm512_set_epi8(INT8_C(   3), INT8_C(   2), INT8_C(   2), INT8_C(   2), INT8_C(   3), INT8_C(   6), INT8_C(   2), INT8_C(   3),
+                           INT8_C(   0), INT8_C(   2), INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   6),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C(   4), INT8_C(   4), INT8_C(   6), INT8_C(   4), INT8_C(   6),
+                           INT8_C(   4), INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   6), INT8_C(   1), INT8_C(   2), INT8_C(   6),
+                           INT8_C(   5), INT8_C(   5), INT8_C(   6), INT8_C(   6), INT8_C(   2), INT8_C(   2), INT8_C(   2), INT8_C(   4),
+                           INT8_C(   3), INT8_C(   6), INT8_C(   5), INT8_C(   2), INT8_C(   3), INT8_C(   3), INT8_C(   3), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   5), INT8_C(   5), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   4), INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   2), INT8_C(   4), INT8_C(   4), INT8_C(   4)) },
+    { simde_mm512_set_epi8(INT8_C(  57), INT8_C( -28), INT8_C(  85), INT8_C(-109), INT8_C(  95), INT8_C( -58), INT8_C(  44), INT8_C( -67),
+                           INT8_C( -75), INT8_C(-103), INT8_C( -27), INT8_C( -49), INT8_C( -24), INT8_C( -86), INT8_C( -37), INT8_C(-118),
+                           INT8_C( 127), INT8_C( -21), INT8_C(  -8), INT8_C( -70), INT8_C( -38), INT8_C( 123), INT8_C( 117), INT8_C(  96),
+                           INT8_C( -57), INT8_C( -68), INT8_C(  90), INT8_C( -80), INT8_C( -65), INT8_C(  49), INT8_C(  21), INT8_C(-117),
+                           INT8_C( -38), INT8_C( -49), INT8_C( -58), INT8_C(  85), INT8_C( -14), INT8_C( -37), INT8_C( -33), INT8_C( 117),
+                           INT8_C( -88), INT8_C( -66), INT8_C( 118), INT8_C(-113), INT8_C( -67), INT8_C( -36), INT8_C( -51), INT8_C(  47),
+                           INT8_C(   3), INT8_C(-106), INT8_C( -52), INT8_C(  70), INT8_C(  78), INT8_C(  59), INT8_C(  95), INT8_C(-112),
+                           INT8_C( -80), INT8_C( -73), INT8_C( 123), INT8_C(  -2), INT8_C(  39), INT8_C(-122), INT8_C(  90), INT8_C(  36)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   4), INT8_C(   6), INT8_C(   4), INT8_C(   3), INT8_C(   6),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C(   6), INT8_C(   4), INT8_C(   4), INT8_C(   6), INT8_C(   3),
+                           INT8_C(   7), INT8_C(   6), INT8_C(   5), INT8_C(   5), INT8_C(   5), INT8_C(   6), INT8_C(   5), INT8_C(   2),
+                           INT8_C(   5), INT8_C(   5), INT8_C(   4), INT8_C(   3), INT8_C(   7), INT8_C(   3), INT8_C(   3), INT8_C(   4),
+                           INT8_C(   5), INT8_C(   6), INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(   6), INT8_C(   7), INT8_C(   5),
+                           INT8_C(   3), INT8_C(   6), INT8_C(   5), INT8_C(   5), INT8_C(   6), INT8_C(   5), INT8_C(   5), INT8_C(   5),
+                           INT8_C(   2), INT8_C(   4), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   5), INT8_C(   6), INT8_C(   2),
+                           INT8_C(   3), INT8_C(   6), INT8_C(   6), INT8_C(   7), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   2)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_popcnt_epi8(test_vec[i].a);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_popcnt_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask64 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C( -74), INT8_C(-117), INT8_C(  18), INT8_C(   3), INT8_C(  25), INT8_C( -51), INT8_C(  52), INT8_C(-101),
+                           INT8_C(  -5), INT8_C(   5), INT8_C(  86), INT8_C(  57), INT8_C(   9), INT8_C(  18), INT8_C( 123), INT8_C(  45),
+                           INT8_C(-109), INT8_C( 113), INT8_C( -61), INT8_C(-117), INT8_C(  83), INT8_C(-118), INT8_C( -58), INT8_C( -96),
+                           INT8_C(  30), INT8_C( -85), INT8_C(-119), INT8_C( -58), INT8_C(-117), INT8_C(  72), INT8_C(  84), INT8_C(   8),
+                           INT8_C( -38), INT8_C(  58), INT8_C( -37), INT8_C(  -4), INT8_C( -16), INT8_C(   9), INT8_C(  71), INT8_C(   6),
+                           INT8_C( -91), INT8_C(  89), INT8_C(-115), INT8_C(  50), INT8_C( -85), INT8_C( -94), INT8_C( -62), INT8_C(   2),
+                           INT8_C(  20), INT8_C(  48), INT8_C( -84), INT8_C( -95), INT8_C( -65), INT8_C(  64), INT8_C(  28), INT8_C(  -5),
+                           INT8_C(-106), INT8_C(  30), INT8_C(   8), INT8_C( -35), INT8_C(  18), INT8_C(  45), INT8_C(  47), INT8_C( -92)),
+      UINT64_C(16088258443202845707),
+      simde_mm512_set_epi8(INT8_C( 119), INT8_C( 102), INT8_C( -19), INT8_C( 110), INT8_C(  10), INT8_C( -38), INT8_C(  12), INT8_C(-110),
+                           INT8_C(  57), INT8_C(   6), INT8_C( -44), INT8_C(  24), INT8_C( -88), INT8_C(  68), INT8_C( -34), INT8_C( -17),
+                           INT8_C(-114), INT8_C(  98), INT8_C(  69), INT8_C(-104), INT8_C( -64), INT8_C( 119), INT8_C( -52), INT8_C( -10),
+                           INT8_C( -95), INT8_C(  78), INT8_C(  21), INT8_C( -88), INT8_C( -88), INT8_C(  53), INT8_C( 109), INT8_C(  44),
+                           INT8_C( -95), INT8_C( 119), INT8_C(  18), INT8_C( -35), INT8_C( -41), INT8_C(  -1), INT8_C(  15), INT8_C( -13),
+                           INT8_C(   0), INT8_C( 101), INT8_C(  44), INT8_C(  51), INT8_C(  66), INT8_C( -94), INT8_C(  37), INT8_C( -72),
+                           INT8_C(  84), INT8_C( -87), INT8_C(  88), INT8_C( -24), INT8_C( 126), INT8_C(-120), INT8_C(  45), INT8_C(  98),
+                           INT8_C(  26), INT8_C( -45), INT8_C( 115), INT8_C(-103), INT8_C(  26), INT8_C(  68), INT8_C( -24), INT8_C(  50)),
+      simde_mm512_set_epi8(INT8_C(   6), INT8_C(   4), INT8_C(  18), INT8_C(   5), INT8_C(   2), INT8_C(   5), INT8_C(   2), INT8_C(   3),
+                           INT8_C(  -5), INT8_C(   2), INT8_C(  86), INT8_C(  57), INT8_C(   9), INT8_C(   2), INT8_C( 123), INT8_C(  45),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   3), INT8_C(   2), INT8_C(-118), INT8_C( -58), INT8_C(   6),
+                           INT8_C(   3), INT8_C(   4), INT8_C(-119), INT8_C(   3), INT8_C(-117), INT8_C(  72), INT8_C(  84), INT8_C(   8),
+                           INT8_C(   3), INT8_C(  58), INT8_C( -37), INT8_C(   6), INT8_C(   6), INT8_C(   9), INT8_C(  71), INT8_C(   6),
+                           INT8_C(   0), INT8_C(   4), INT8_C(-115), INT8_C(  50), INT8_C(   2), INT8_C( -94), INT8_C( -62), INT8_C(   2),
+                           INT8_C(   3), INT8_C(   4), INT8_C( -84), INT8_C(   4), INT8_C(   6), INT8_C(   2), INT8_C(  28), INT8_C(  -5),
+                           INT8_C(-106), INT8_C(  30), INT8_C(   8), INT8_C( -35), INT8_C(   3), INT8_C(  45), INT8_C(   4), INT8_C(   3)) },
+    { simde_mm512_set_epi8(INT8_C( -71), INT8_C( -23), INT8_C(-117), INT8_C( -10), INT8_C( -43), INT8_C( -86), INT8_C( -48), INT8_C( -70),
+                           INT8_C( 108), INT8_C( -16), INT8_C(-117), INT8_C( -89), INT8_C(   9), INT8_C( -54), INT8_C(  12), INT8_C(  34),
+                           INT8_C( -12), INT8_C(  22), INT8_C(  79), INT8_C(  88), INT8_C( -22), INT8_C(  62), INT8_C(  47), INT8_C( 124),
+                           INT8_C(-118), INT8_C( 113), INT8_C(-107), INT8_C(  -7), INT8_C( 114), INT8_C( -44), INT8_C(  15), INT8_C( -93),
+                           INT8_C( 118), INT8_C( 123), INT8_C(  12), INT8_C(  -4), INT8_C(  89), INT8_C( 116), INT8_C(-117), INT8_C( -76),
+                           INT8_C(  49), INT8_C( -77), INT8_C(  55), INT8_C(  96), INT8_C( -49), INT8_C( -59), INT8_C(-119), INT8_C(  38),
+                           INT8_C(-104), INT8_C(  53), INT8_C(-119), INT8_C(-104), INT8_C(  71), INT8_C(  75), INT8_C( -59), INT8_C( -19),
+                           INT8_C( 110), INT8_C(-122), INT8_C( -75), INT8_C( -90), INT8_C(  15), INT8_C( -85), INT8_C(  47), INT8_C( 115)),
+      UINT64_C( 5352999668751030705),
+      simde_mm512_set_epi8(INT8_C(  96), INT8_C(  30), INT8_C( -82), INT8_C( -54), INT8_C( -14), INT8_C( -55), INT8_C( -28), INT8_C(  57),
+                           INT8_C(  88), INT8_C(  44), INT8_C( 119), INT8_C(  41), INT8_C( -16), INT8_C(  52), INT8_C( -94), INT8_C(  61),
+                           INT8_C(  96), INT8_C(  40), INT8_C(  61), INT8_C(  17), INT8_C( -75), INT8_C(-110), INT8_C(  49), INT8_C( -34),
+                           INT8_C( -44), INT8_C(-108), INT8_C( -75), INT8_C(  26), INT8_C(  93), INT8_C(  87), INT8_C(  80), INT8_C( -65),
+                           INT8_C( -26), INT8_C( -59), INT8_C(  66), INT8_C( -23), INT8_C(  -6), INT8_C( -45), INT8_C(  14), INT8_C(  99),
+                           INT8_C( -34), INT8_C(   9), INT8_C(  37), INT8_C( -10), INT8_C(  39), INT8_C( -66), INT8_C(  19), INT8_C(   5),
+                           INT8_C(  83), INT8_C(  30), INT8_C(   8), INT8_C( 120), INT8_C( 103), INT8_C( 122), INT8_C(  68), INT8_C(-116),
+                           INT8_C( 118), INT8_C(  68), INT8_C( 110), INT8_C( -92), INT8_C( -33), INT8_C(-108), INT8_C( -21), INT8_C(-101)),
+      simde_mm512_set_epi8(INT8_C( -71), INT8_C(   4), INT8_C(-117), INT8_C( -10), INT8_C(   5), INT8_C( -86), INT8_C(   4), INT8_C( -70),
+                           INT8_C( 108), INT8_C(   3), INT8_C(-117), INT8_C( -89), INT8_C(   4), INT8_C( -54), INT8_C(  12), INT8_C(   5),
+                           INT8_C(   2), INT8_C(  22), INT8_C(   5), INT8_C(  88), INT8_C(   5), INT8_C(   3), INT8_C(  47), INT8_C( 124),
+                           INT8_C(   4), INT8_C(   3), INT8_C(-107), INT8_C(   3), INT8_C( 114), INT8_C(   5), INT8_C(   2), INT8_C( -93),
+                           INT8_C( 118), INT8_C(   4), INT8_C(  12), INT8_C(   5), INT8_C(   6), INT8_C( 116), INT8_C(   3), INT8_C( -76),
+                           INT8_C(   6), INT8_C( -77), INT8_C(   3), INT8_C(   6), INT8_C( -49), INT8_C( -59), INT8_C(-119), INT8_C(  38),
+                           INT8_C(-104), INT8_C(   4), INT8_C(-119), INT8_C(   4), INT8_C(   5), INT8_C(  75), INT8_C( -59), INT8_C(   3),
+                           INT8_C(   5), INT8_C(-122), INT8_C(   5), INT8_C(   3), INT8_C(  15), INT8_C( -85), INT8_C(  47), INT8_C(   5)) },
+    { simde_mm512_set_epi8(INT8_C( 104), INT8_C(-115), INT8_C(  43), INT8_C(   6), INT8_C(  -3), INT8_C( -10), INT8_C( -41), INT8_C( -78),
+                           INT8_C(  42), INT8_C(  82), INT8_C( -13), INT8_C(-119), INT8_C( -47), INT8_C( -49), INT8_C(  25), INT8_C( -63),
+                           INT8_C( -20), INT8_C(  93), INT8_C(  69), INT8_C(  12), INT8_C(  92), INT8_C(  21), INT8_C(  29), INT8_C(  59),
+                           INT8_C(  37), INT8_C(  22), INT8_C( -39), INT8_C(  25), INT8_C( -40), INT8_C( -67), INT8_C(  17), INT8_C(  89),
+                           INT8_C(-124), INT8_C(  79), INT8_C( -35), INT8_C(  73), INT8_C( -20), INT8_C( 124), INT8_C( -44), INT8_C( -16),
+                           INT8_C(  20), INT8_C(  57), INT8_C( -26), INT8_C(  58), INT8_C( 104), INT8_C( -29), INT8_C(  11), INT8_C( 102),
+                           INT8_C(  83), INT8_C(   3), INT8_C( -99), INT8_C( -97), INT8_C(  56), INT8_C( 115), INT8_C(  39), INT8_C(  40),
+                           INT8_C(  -3), INT8_C( -78), INT8_C(  99), INT8_C(   5), INT8_C( -69), INT8_C( -95), INT8_C( 117), INT8_C(  66)),
+      UINT64_C( 8268298413500049502),
+      simde_mm512_set_epi8(INT8_C( -44), INT8_C(-104), INT8_C(  65), INT8_C( -14), INT8_C( -48), INT8_C( -82), INT8_C(  61), INT8_C(  36),
+                           INT8_C(  47), INT8_C( -50), INT8_C(-106), INT8_C(-115), INT8_C( -25), INT8_C(  60), INT8_C( -55), INT8_C(  54),
+                           INT8_C(  26), INT8_C( -10), INT8_C( 102), INT8_C(  99), INT8_C( 114), INT8_C(  -5), INT8_C(  -3), INT8_C(-115),
+                           INT8_C( -58), INT8_C(-119), INT8_C( -74), INT8_C( -13), INT8_C( 103), INT8_C(  62), INT8_C(  60), INT8_C( -12),
+                           INT8_C(  67), INT8_C(  -4), INT8_C(-109), INT8_C(  65), INT8_C(-118), INT8_C( -43), INT8_C(  18), INT8_C(-111),
+                           INT8_C( -12), INT8_C(  -7), INT8_C( 127), INT8_C( 100), INT8_C( -64), INT8_C(  45), INT8_C( 104), INT8_C(   1),
+                           INT8_C( -85), INT8_C( -41), INT8_C(  14), INT8_C( 115), INT8_C(  28), INT8_C(-106), INT8_C( 120), INT8_C( -16),
+                           INT8_C(-110), INT8_C( -44), INT8_C(-127), INT8_C( -52), INT8_C( 122), INT8_C( 116), INT8_C(-106), INT8_C( -99)),
+      simde_mm512_set_epi8(INT8_C( 104), INT8_C(   3), INT8_C(   2), INT8_C(   5), INT8_C(  -3), INT8_C( -10), INT8_C(   5), INT8_C( -78),
+                           INT8_C(   5), INT8_C(  82), INT8_C(   4), INT8_C(   4), INT8_C(   6), INT8_C(   4), INT8_C(   4), INT8_C( -63),
+                           INT8_C(   3), INT8_C(   6), INT8_C(   4), INT8_C(  12), INT8_C(  92), INT8_C(   7), INT8_C(  29), INT8_C(   4),
+                           INT8_C(   4), INT8_C(  22), INT8_C( -39), INT8_C(   6), INT8_C(   5), INT8_C( -67), INT8_C(  17), INT8_C(   5),
+                           INT8_C(   3), INT8_C(  79), INT8_C( -35), INT8_C(  73), INT8_C(   3), INT8_C( 124), INT8_C( -44), INT8_C(   3),
+                           INT8_C(   5), INT8_C(  57), INT8_C( -26), INT8_C(   3), INT8_C(   2), INT8_C( -29), INT8_C(  11), INT8_C( 102),
+                           INT8_C(   5), INT8_C(   3), INT8_C(   3), INT8_C( -97), INT8_C(   3), INT8_C( 115), INT8_C(  39), INT8_C(  40),
+                           INT8_C(  -3), INT8_C(   4), INT8_C(  99), INT8_C(   4), INT8_C(   5), INT8_C(   4), INT8_C(   4), INT8_C(  66)) },
+    { simde_mm512_set_epi8(INT8_C( -15), INT8_C( -16), INT8_C(  51), INT8_C(  17), INT8_C(  73), INT8_C(  19), INT8_C( -14), INT8_C( -48),
+                           INT8_C( -13), INT8_C( -10), INT8_C( -75), INT8_C(  11), INT8_C(-121), INT8_C( -74), INT8_C(-115), INT8_C(  74),
+                           INT8_C(  -4), INT8_C( -24), INT8_C(-126), INT8_C( -45), INT8_C(  66), INT8_C(  71), INT8_C(  65), INT8_C(-119),
+                           INT8_C( 109), INT8_C( -12), INT8_C(-128), INT8_C( -94), INT8_C(  10), INT8_C( -63), INT8_C(  -1), INT8_C( -10),
+                           INT8_C( 125), INT8_C( -18), INT8_C(  36), INT8_C( -35), INT8_C(  41), INT8_C(  57), INT8_C(  64), INT8_C( -73),
+                           INT8_C(  77), INT8_C( 102), INT8_C( -54), INT8_C(  63), INT8_C( -31), INT8_C(   3), INT8_C( -77), INT8_C( -48),
+                           INT8_C( -28), INT8_C( 113), INT8_C(  51), INT8_C(  22), INT8_C( -99), INT8_C( 123), INT8_C(  65), INT8_C(-109),
+                           INT8_C(  49), INT8_C(  86), INT8_C(  92), INT8_C(  87), INT8_C(  84), INT8_C( -74), INT8_C(  78), INT8_C(-114)),
+      UINT64_C( 6935706010559727011),
+      simde_mm512_set_epi8(INT8_C(  30), INT8_C( 103), INT8_C(-108), INT8_C(  84), INT8_C(  70), INT8_C( -69), INT8_C(  82), INT8_C(-122),
+                           INT8_C(-107), INT8_C(  25), INT8_C(  99), INT8_C( -49), INT8_C(-114), INT8_C(-118), INT8_C(-124), INT8_C(  14),
+                           INT8_C(  74), INT8_C(  40), INT8_C(  19), INT8_C(  39), INT8_C(  33), INT8_C(  93), INT8_C(  -9), INT8_C( -95),
+                           INT8_C( -74), INT8_C(  71), INT8_C(  23), INT8_C( -65), INT8_C( -53), INT8_C( -44), INT8_C( 122), INT8_C(  21),
+                           INT8_C( 117), INT8_C( -80), INT8_C( -99), INT8_C( -17), INT8_C( 122), INT8_C(  72), INT8_C(  74), INT8_C(-128),
+                           INT8_C( -55), INT8_C(  33), INT8_C( -36), INT8_C(  94), INT8_C(  88), INT8_C( 120), INT8_C( -83), INT8_C(  90),
+                           INT8_C(  78), INT8_C( -15), INT8_C( -91), INT8_C(  86), INT8_C(  82), INT8_C( 123), INT8_C(  22), INT8_C( -73),
+                           INT8_C(-118), INT8_C( 115), INT8_C(-100), INT8_C(  73), INT8_C(-109), INT8_C(  77), INT8_C(  97), INT8_C(  53)),
+      simde_mm512_set_epi8(INT8_C( -15), INT8_C(   5), INT8_C(   3), INT8_C(  17), INT8_C(  73), INT8_C(  19), INT8_C( -14), INT8_C( -48),
+                           INT8_C( -13), INT8_C(   3), INT8_C( -75), INT8_C(  11), INT8_C(-121), INT8_C( -74), INT8_C(-115), INT8_C(  74),
+                           INT8_C(   3), INT8_C( -24), INT8_C(-126), INT8_C(   4), INT8_C(  66), INT8_C(  71), INT8_C(   7), INT8_C(   3),
+                           INT8_C(   5), INT8_C(   4), INT8_C(-128), INT8_C(   7), INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C( -10),
+                           INT8_C(   5), INT8_C( -18), INT8_C(   5), INT8_C( -35), INT8_C(  41), INT8_C(  57), INT8_C(  64), INT8_C(   1),
+                           INT8_C(   4), INT8_C(   2), INT8_C(   5), INT8_C(   5), INT8_C( -31), INT8_C(   4), INT8_C( -77), INT8_C( -48),
+                           INT8_C( -28), INT8_C(   5), INT8_C(  51), INT8_C(  22), INT8_C( -99), INT8_C(   6), INT8_C(  65), INT8_C(   6),
+                           INT8_C(   3), INT8_C(  86), INT8_C(   4), INT8_C(  87), INT8_C(  84), INT8_C( -74), INT8_C(   3), INT8_C(   4)) },
+    { simde_mm512_set_epi8(INT8_C(-106), INT8_C( -63), INT8_C(  37), INT8_C(-100), INT8_C( -21), INT8_C( -48), INT8_C(  60), INT8_C(  42),
+                           INT8_C( -22), INT8_C(-101), INT8_C( -62), INT8_C( -78), INT8_C( -40), INT8_C( -88), INT8_C(  36), INT8_C( -93),
+                           INT8_C( -18), INT8_C( -42), INT8_C(  54), INT8_C(   7), INT8_C( -41), INT8_C(-123), INT8_C(  68), INT8_C( -86),
+                           INT8_C(  53), INT8_C(  -2), INT8_C( 108), INT8_C(-111), INT8_C(  -4), INT8_C(-107), INT8_C(  39), INT8_C( -91),
+                           INT8_C( 123), INT8_C(  58), INT8_C( -58), INT8_C( -32), INT8_C(   2), INT8_C(  23), INT8_C( -95), INT8_C(  39),
+                           INT8_C(  76), INT8_C( 101), INT8_C( -48), INT8_C( -85), INT8_C( -67), INT8_C( -74), INT8_C(  56), INT8_C( -42),
+                           INT8_C( -60), INT8_C(-120), INT8_C( -61), INT8_C(  90), INT8_C( 102), INT8_C( -43), INT8_C(  90), INT8_C( -93),
+                           INT8_C(  16), INT8_C(   0), INT8_C( -29), INT8_C(  74), INT8_C( -94), INT8_C( -62), INT8_C( -91), INT8_C( -24)),
+      UINT64_C(16962945915393102470),
+      simde_mm512_set_epi8(INT8_C( -90), INT8_C( -26), INT8_C(  -7), INT8_C(  -8), INT8_C(  25), INT8_C( 101), INT8_C(  81), INT8_C(  36),
+                           INT8_C(  52), INT8_C(  60), INT8_C( 103), INT8_C( 114), INT8_C( 100), INT8_C(  57), INT8_C( -83), INT8_C( -65),
+                           INT8_C(  80), INT8_C(-126), INT8_C( -70), INT8_C(  89), INT8_C(-123), INT8_C(-117), INT8_C(  88), INT8_C(-114),
+                           INT8_C(  55), INT8_C( -10), INT8_C(   3), INT8_C( -82), INT8_C( -69), INT8_C(-127), INT8_C(-112), INT8_C(  46),
+                           INT8_C(   1), INT8_C(  26), INT8_C( -13), INT8_C( -56), INT8_C(   1), INT8_C( -45), INT8_C(  -9), INT8_C(-127),
+                           INT8_C( -66), INT8_C(  39), INT8_C(  26), INT8_C(-122), INT8_C( -37), INT8_C( 119), INT8_C(  46), INT8_C( -36),
+                           INT8_C( -77), INT8_C( -47), INT8_C(  23), INT8_C(  43), INT8_C(  70), INT8_C(  96), INT8_C( 113), INT8_C(  -1),
+                           INT8_C(   8), INT8_C(  56), INT8_C(  30), INT8_C(-116), INT8_C(-116), INT8_C(  41), INT8_C( -42), INT8_C( -46)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   5), INT8_C(   6), INT8_C(-100), INT8_C(   3), INT8_C( -48), INT8_C(   3), INT8_C(   2),
+                           INT8_C( -22), INT8_C(   4), INT8_C(   5), INT8_C( -78), INT8_C(   3), INT8_C( -88), INT8_C(  36), INT8_C( -93),
+                           INT8_C( -18), INT8_C(   2), INT8_C(   5), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(  68), INT8_C(   4),
+                           INT8_C(  53), INT8_C(   6), INT8_C(   2), INT8_C(-111), INT8_C(   6), INT8_C(   2), INT8_C(   2), INT8_C(   4),
+                           INT8_C(   1), INT8_C(  58), INT8_C(   6), INT8_C(   3), INT8_C(   1), INT8_C(   5), INT8_C(   7), INT8_C(   2),
+                           INT8_C(  76), INT8_C( 101), INT8_C(   3), INT8_C( -85), INT8_C(   6), INT8_C( -74), INT8_C(   4), INT8_C(   5),
+                           INT8_C( -60), INT8_C(   4), INT8_C( -61), INT8_C(   4), INT8_C( 102), INT8_C( -43), INT8_C(   4), INT8_C( -93),
+                           INT8_C(   1), INT8_C(   0), INT8_C( -29), INT8_C(  74), INT8_C( -94), INT8_C(   3), INT8_C(   5), INT8_C( -24)) },
+    { simde_mm512_set_epi8(INT8_C(  93), INT8_C(  96), INT8_C(  43), INT8_C(   1), INT8_C(   2), INT8_C( 103), INT8_C(  -8), INT8_C( -56),
+                           INT8_C(-110), INT8_C( -70), INT8_C( -68), INT8_C( 104), INT8_C(  -2), INT8_C(  10), INT8_C( -11), INT8_C( -29),
+                           INT8_C(  -4), INT8_C(  74), INT8_C(   3), INT8_C(  86), INT8_C( -88), INT8_C(  88), INT8_C(  54), INT8_C(  79),
+                           INT8_C(  20), INT8_C( 119), INT8_C( -30), INT8_C( -63), INT8_C( -67), INT8_C(-116), INT8_C( -56), INT8_C(  31),
+                           INT8_C(  88), INT8_C(-111), INT8_C(  -5), INT8_C(  13), INT8_C(  16), INT8_C( -40), INT8_C(-117), INT8_C(  73),
+                           INT8_C( -67), INT8_C( -32), INT8_C(  89), INT8_C(  97), INT8_C( -79), INT8_C(  57), INT8_C( -45), INT8_C(  47),
+                           INT8_C(   5), INT8_C(   2), INT8_C( -72), INT8_C( -41), INT8_C(  -1), INT8_C( -67), INT8_C(  67), INT8_C( -88),
+                           INT8_C( -26), INT8_C(  51), INT8_C(-128), INT8_C(  61), INT8_C(  11), INT8_C(-105), INT8_C( 101), INT8_C( -93)),
+      UINT64_C(11232198693187993425),
+      simde_mm512_set_epi8(INT8_C(  36), INT8_C( -78), INT8_C(  -8), INT8_C(  43), INT8_C(  58), INT8_C(  47), INT8_C( -40), INT8_C( -32),
+                           INT8_C( 111), INT8_C( -68), INT8_C( -88), INT8_C(-112), INT8_C( -48), INT8_C(  11), INT8_C( -59), INT8_C( -85),
+                           INT8_C(  85), INT8_C( -80), INT8_C(  55), INT8_C( -27), INT8_C(-122), INT8_C(   4), INT8_C( -69), INT8_C( -36),
+                           INT8_C( 102), INT8_C(-124), INT8_C( -33), INT8_C( -65), INT8_C( 106), INT8_C(  51), INT8_C(  76), INT8_C(  68),
+                           INT8_C(   2), INT8_C(  96), INT8_C(-118), INT8_C(-114), INT8_C(-105), INT8_C( -68), INT8_C( -72), INT8_C(  52),
+                           INT8_C( -65), INT8_C( 113), INT8_C( -78), INT8_C( 100), INT8_C( 105), INT8_C( -23), INT8_C( -28), INT8_C( -67),
+                           INT8_C( -14), INT8_C( -43), INT8_C(  92), INT8_C(-119), INT8_C(  57), INT8_C( -17), INT8_C(-121), INT8_C( 115),
+                           INT8_C(  78), INT8_C(   6), INT8_C( -58), INT8_C(  83), INT8_C( 108), INT8_C( -10), INT8_C(   5), INT8_C(  57)),
+      simde_mm512_set_epi8(INT8_C(   2), INT8_C(  96), INT8_C(  43), INT8_C(   4), INT8_C(   4), INT8_C( 103), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   6), INT8_C(   5), INT8_C(   3), INT8_C( 104), INT8_C(  -2), INT8_C(  10), INT8_C( -11), INT8_C( -29),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(  86), INT8_C(   3), INT8_C(  88), INT8_C(  54), INT8_C(   5),
+                           INT8_C(  20), INT8_C( 119), INT8_C(   7), INT8_C(   7), INT8_C( -67), INT8_C(-116), INT8_C(   3), INT8_C(   2),
+                           INT8_C(  88), INT8_C(   2), INT8_C(   3), INT8_C(  13), INT8_C(  16), INT8_C( -40), INT8_C(   4), INT8_C(  73),
+                           INT8_C( -67), INT8_C( -32), INT8_C(  89), INT8_C(   3), INT8_C( -79), INT8_C(  57), INT8_C(   4), INT8_C(   6),
+                           INT8_C(   5), INT8_C(   2), INT8_C(   4), INT8_C(   3), INT8_C(   4), INT8_C(   7), INT8_C(   4), INT8_C(   5),
+                           INT8_C( -26), INT8_C(   2), INT8_C(-128), INT8_C(   4), INT8_C(  11), INT8_C(-105), INT8_C( 101), INT8_C(   4)) },
+    { simde_mm512_set_epi8(INT8_C( 110), INT8_C(  58), INT8_C( 108), INT8_C(  36), INT8_C(  38), INT8_C(  -6), INT8_C( -37), INT8_C(  23),
+                           INT8_C(  75), INT8_C(  93), INT8_C(  -4), INT8_C( -87), INT8_C(   4), INT8_C( -25), INT8_C(  -2), INT8_C(  43),
+                           INT8_C(  56), INT8_C( -93), INT8_C(  70), INT8_C(  92), INT8_C( -47), INT8_C( 118), INT8_C( 111), INT8_C( -12),
+                           INT8_C(   9), INT8_C(  84), INT8_C(  49), INT8_C(  76), INT8_C(-117), INT8_C( 102), INT8_C(  43), INT8_C(  34),
+                           INT8_C(  52), INT8_C(   9), INT8_C(  91), INT8_C(-111), INT8_C(  51), INT8_C(  16), INT8_C(  66), INT8_C(  38),
+                           INT8_C(  10), INT8_C( 114), INT8_C( -92), INT8_C( -86), INT8_C( -13), INT8_C( -73), INT8_C( -25), INT8_C( -87),
+                           INT8_C(  19), INT8_C( -91), INT8_C(  19), INT8_C( -77), INT8_C(  65), INT8_C(  42), INT8_C(-113), INT8_C( 119),
+                           INT8_C( -45), INT8_C( -76), INT8_C( -57), INT8_C( -97), INT8_C(  47), INT8_C(  12), INT8_C( 108), INT8_C( 111)),
+      UINT64_C(13127603775445763825),
+      simde_mm512_set_epi8(INT8_C(  25), INT8_C( -72), INT8_C(  80), INT8_C(  55), INT8_C(  -3), INT8_C(-102), INT8_C(-107), INT8_C(  27),
+                           INT8_C(  44), INT8_C( 118), INT8_C(  86), INT8_C(  -9), INT8_C( -58), INT8_C(  43), INT8_C( -89), INT8_C(  21),
+                           INT8_C(  -5), INT8_C(  18), INT8_C( -34), INT8_C(  97), INT8_C(  43), INT8_C(  29), INT8_C(  48), INT8_C(  53),
+                           INT8_C(  84), INT8_C(  89), INT8_C( -12), INT8_C(   0), INT8_C( 123), INT8_C( -50), INT8_C(  30), INT8_C(  73),
+                           INT8_C( 125), INT8_C(   6), INT8_C( -21), INT8_C( 122), INT8_C(  20), INT8_C(-116), INT8_C(  39), INT8_C(-122),
+                           INT8_C(  99), INT8_C( -91), INT8_C(  62), INT8_C(  -4), INT8_C( -66), INT8_C( -91), INT8_C( -87), INT8_C(-107),
+                           INT8_C(  -4), INT8_C(  18), INT8_C( -87), INT8_C(  17), INT8_C( 111), INT8_C( -38), INT8_C( -79), INT8_C(  55),
+                           INT8_C(   9), INT8_C( -84), INT8_C(-125), INT8_C( -20), INT8_C( -99), INT8_C( -95), INT8_C(  11), INT8_C(  97)),
+      simde_mm512_set_epi8(INT8_C(   3), INT8_C(  58), INT8_C(   2), INT8_C(   5), INT8_C(  38), INT8_C(   4), INT8_C(   4), INT8_C(  23),
+                           INT8_C(  75), INT8_C(  93), INT8_C(   4), INT8_C( -87), INT8_C(   4), INT8_C(   4), INT8_C(   5), INT8_C(  43),
+                           INT8_C(   7), INT8_C( -93), INT8_C(  70), INT8_C(   3), INT8_C(   4), INT8_C(   4), INT8_C(   2), INT8_C( -12),
+                           INT8_C(   9), INT8_C(  84), INT8_C(  49), INT8_C(   0), INT8_C(-117), INT8_C(   5), INT8_C(  43), INT8_C(  34),
+                           INT8_C(   6), INT8_C(   9), INT8_C(   6), INT8_C(-111), INT8_C(   2), INT8_C(  16), INT8_C(   4), INT8_C(   3),
+                           INT8_C(   4), INT8_C( 114), INT8_C( -92), INT8_C( -86), INT8_C( -13), INT8_C(   4), INT8_C( -25), INT8_C(   4),
+                           INT8_C(   6), INT8_C( -91), INT8_C(  19), INT8_C( -77), INT8_C(  65), INT8_C(   5), INT8_C(   4), INT8_C( 119),
+                           INT8_C(   2), INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(  47), INT8_C(  12), INT8_C( 108), INT8_C(   3)) },
+    { simde_mm512_set_epi8(INT8_C( -49), INT8_C( -56), INT8_C( -55), INT8_C( -71), INT8_C( 110), INT8_C(  58), INT8_C( 116), INT8_C(  92),
+                           INT8_C( 104), INT8_C(  17), INT8_C( 113), INT8_C( 118), INT8_C(  85), INT8_C( -30), INT8_C(  58), INT8_C(  40),
+                           INT8_C(-118), INT8_C( 124), INT8_C(  50), INT8_C(-118), INT8_C( -46), INT8_C(  75), INT8_C( -91), INT8_C( -93),
+                           INT8_C( -66), INT8_C( -71), INT8_C( -89), INT8_C(-111), INT8_C(-127), INT8_C( 123), INT8_C(  45), INT8_C(  -8),
+                           INT8_C( -37), INT8_C(  42), INT8_C(  13), INT8_C(  72), INT8_C( -49), INT8_C(  50), INT8_C(  69), INT8_C( -77),
+                           INT8_C(  42), INT8_C(  15), INT8_C( -38), INT8_C(  62), INT8_C( 127), INT8_C( -83), INT8_C(  98), INT8_C( -10),
+                           INT8_C(-122), INT8_C(-105), INT8_C(-120), INT8_C( 112), INT8_C( -81), INT8_C( -72), INT8_C( -44), INT8_C( -97),
+                           INT8_C( -61), INT8_C( -62), INT8_C( 117), INT8_C( -88), INT8_C( -16), INT8_C(  21), INT8_C(  17), INT8_C( -68)),
+      UINT64_C(12451878138248570826),
+      simde_mm512_set_epi8(INT8_C(  46), INT8_C( -42), INT8_C( -90), INT8_C( -92), INT8_C(  75), INT8_C(  49), INT8_C(   5), INT8_C(-127),
+                           INT8_C(-116), INT8_C(  15), INT8_C( 124), INT8_C( -45), INT8_C(-128), INT8_C(  67), INT8_C( -68), INT8_C(  -8),
+                           INT8_C(  49), INT8_C(  77), INT8_C(  24), INT8_C( 120), INT8_C( -98), INT8_C( -39), INT8_C(   0), INT8_C( -71),
+                           INT8_C(  25), INT8_C( -85), INT8_C(  50), INT8_C(  38), INT8_C(  87), INT8_C( -53), INT8_C( -79), INT8_C(  27),
+                           INT8_C(-115), INT8_C(-119), INT8_C(  54), INT8_C( 119), INT8_C(   0), INT8_C(  54), INT8_C( -77), INT8_C(  61),
+                           INT8_C(  21), INT8_C(  59), INT8_C( 108), INT8_C(  -2), INT8_C(  -5), INT8_C( -68), INT8_C( 120), INT8_C( -52),
+                           INT8_C( 121), INT8_C( 100), INT8_C( -25), INT8_C( -59), INT8_C(  63), INT8_C(-102), INT8_C( -53), INT8_C(-101),
+                           INT8_C( -32), INT8_C(  63), INT8_C( -94), INT8_C(  87), INT8_C( -13), INT8_C(-104), INT8_C(-105), INT8_C( -76)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C( -56), INT8_C(   4), INT8_C( -71), INT8_C(   4), INT8_C(   3), INT8_C( 116), INT8_C(  92),
+                           INT8_C(   3), INT8_C(   4), INT8_C( 113), INT8_C( 118), INT8_C(   1), INT8_C(   3), INT8_C(  58), INT8_C(   5),
+                           INT8_C(   3), INT8_C(   4), INT8_C(   2), INT8_C(   4), INT8_C( -46), INT8_C(   5), INT8_C( -91), INT8_C(   5),
+                           INT8_C( -66), INT8_C( -71), INT8_C(   3), INT8_C(   3), INT8_C(-127), INT8_C( 123), INT8_C(  45), INT8_C(   4),
+                           INT8_C(   4), INT8_C(  42), INT8_C(   4), INT8_C(  72), INT8_C( -49), INT8_C(  50), INT8_C(  69), INT8_C( -77),
+                           INT8_C(   3), INT8_C(   5), INT8_C( -38), INT8_C(  62), INT8_C( 127), INT8_C( -83), INT8_C(   4), INT8_C( -10),
+                           INT8_C(-122), INT8_C(-105), INT8_C(   6), INT8_C( 112), INT8_C( -81), INT8_C(   4), INT8_C(   5), INT8_C(   5),
+                           INT8_C(   3), INT8_C(   6), INT8_C( 117), INT8_C( -88), INT8_C(   6), INT8_C(  21), INT8_C(   5), INT8_C( -68)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_popcnt_epi8(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_popcnt_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask64 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT64_C(14337637462192033343),
+      simde_mm512_set_epi8(INT8_C(-103), INT8_C(-104), INT8_C( -95), INT8_C( -66), INT8_C( -45), INT8_C( 125), INT8_C(  13), INT8_C( 101),
+                           INT8_C( -71), INT8_C( -30), INT8_C(  33), INT8_C(   4), INT8_C( -75), INT8_C( -40), INT8_C(  24), INT8_C(  21),
+                           INT8_C( -44), INT8_C(-103), INT8_C( -53), INT8_C(   8), INT8_C(-126), INT8_C( -11), INT8_C(  90), INT8_C( -96),
+                           INT8_C( 110), INT8_C( 127), INT8_C(-104), INT8_C( -57), INT8_C(-109), INT8_C(-122), INT8_C(  84), INT8_C(   8),
+                           INT8_C( -42), INT8_C( -77), INT8_C(  51), INT8_C( -38), INT8_C( 102), INT8_C( 123), INT8_C( -66), INT8_C( 116),
+                           INT8_C( -90), INT8_C(  43), INT8_C( -26), INT8_C( -72), INT8_C( -51), INT8_C( -34), INT8_C(-117), INT8_C( -93),
+                           INT8_C(  96), INT8_C(-101), INT8_C(  13), INT8_C(   9), INT8_C(  86), INT8_C( 120), INT8_C(   2), INT8_C( 103),
+                           INT8_C(  63), INT8_C(  24), INT8_C( 121), INT8_C(  77), INT8_C(-107), INT8_C(  -7), INT8_C(  17), INT8_C(   5)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   6), INT8_C(   3), INT8_C(   0),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   2), INT8_C(   1), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   3),
+                           INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   6), INT8_C(   0), INT8_C(   2),
+                           INT8_C(   0), INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   0),
+                           INT8_C(   5), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   6), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   5), INT8_C(   0), INT8_C(   4), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   4), INT8_C(   1), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   5), INT8_C(   4), INT8_C(   4), INT8_C(   6), INT8_C(   2), INT8_C(   2)) },
+    { UINT64_C(18099338879192450764),
+      simde_mm512_set_epi8(INT8_C(  43), INT8_C(  69), INT8_C(   0), INT8_C(  37), INT8_C( -33), INT8_C( 121), INT8_C( -92), INT8_C( -59),
+                           INT8_C(  22), INT8_C(-125), INT8_C(  53), INT8_C(  26), INT8_C( -64), INT8_C(  19), INT8_C(  61), INT8_C( 127),
+                           INT8_C( -31), INT8_C(  83), INT8_C( -69), INT8_C( -19), INT8_C(  56), INT8_C( -93), INT8_C(-122), INT8_C( -14),
+                           INT8_C( -86), INT8_C( -33), INT8_C(  78), INT8_C( 117), INT8_C( -25), INT8_C(-106), INT8_C( -27), INT8_C(  56),
+                           INT8_C( -96), INT8_C(  25), INT8_C(   5), INT8_C( -70), INT8_C( 100), INT8_C(-128), INT8_C( -20), INT8_C( -95),
+                           INT8_C(  -9), INT8_C( -43), INT8_C(  88), INT8_C(  84), INT8_C( -49), INT8_C(  64), INT8_C(  88), INT8_C(  81),
+                           INT8_C( -78), INT8_C( -88), INT8_C(  89), INT8_C( 119), INT8_C( -99), INT8_C(-109), INT8_C(  76), INT8_C( -56),
+                           INT8_C(  15), INT8_C(  64), INT8_C(  -7), INT8_C(  83), INT8_C( -23), INT8_C(  80), INT8_C( -11), INT8_C( -29)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   3), INT8_C(   0), INT8_C(   3), INT8_C(   7), INT8_C(   0), INT8_C(   3), INT8_C(   4),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   2), INT8_C(   3), INT8_C(   0), INT8_C(   7),
+                           INT8_C(   4), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   4), INT8_C(   7), INT8_C(   0), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   2), INT8_C(   3), INT8_C(   2), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   5), INT8_C(   3),
+                           INT8_C(   7), INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   6), INT8_C(   1), INT8_C(   3), INT8_C(   0),
+                           INT8_C(   4), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   3), INT8_C(   0),
+                           INT8_C(   4), INT8_C(   1), INT8_C(   0), INT8_C(   0), INT8_C(   5), INT8_C(   2), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C(16999795482453328785),
+      simde_mm512_set_epi8(INT8_C( 105), INT8_C( -49), INT8_C( -65), INT8_C(  62), INT8_C( -84), INT8_C( -94), INT8_C( -68), INT8_C( -24),
+                           INT8_C( -85), INT8_C(  31), INT8_C(  79), INT8_C(  21), INT8_C(   8), INT8_C(-106), INT8_C(-110), INT8_C(-115),
+                           INT8_C(  29), INT8_C(-100), INT8_C(  -4), INT8_C(  -1), INT8_C( 118), INT8_C( -72), INT8_C(  94), INT8_C( 113),
+                           INT8_C(-126), INT8_C(  26), INT8_C( 116), INT8_C(  65), INT8_C( -60), INT8_C( -99), INT8_C(  80), INT8_C( -48),
+                           INT8_C(  19), INT8_C( -73), INT8_C(  97), INT8_C(  39), INT8_C( -63), INT8_C( 117), INT8_C( -75), INT8_C(  58),
+                           INT8_C( -89), INT8_C(-122), INT8_C( -44), INT8_C(  23), INT8_C(  90), INT8_C( 106), INT8_C(  42), INT8_C( -81),
+                           INT8_C( -19), INT8_C(  62), INT8_C( -15), INT8_C(   0), INT8_C(  52), INT8_C(-128), INT8_C( -33), INT8_C(  81),
+                           INT8_C(  41), INT8_C(  16), INT8_C( 119), INT8_C(  83), INT8_C(  49), INT8_C( -93), INT8_C( -88), INT8_C(  65)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   6), INT8_C(   7), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   5), INT8_C(   4),
+                           INT8_C(   5), INT8_C(   5), INT8_C(   5), INT8_C(   0), INT8_C(   1), INT8_C(   0), INT8_C(   3), INT8_C(   4),
+                           INT8_C(   0), INT8_C(   4), INT8_C(   6), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   5), INT8_C(   4),
+                           INT8_C(   2), INT8_C(   3), INT8_C(   4), INT8_C(   0), INT8_C(   3), INT8_C(   5), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   4),
+                           INT8_C(   5), INT8_C(   3), INT8_C(   4), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   3), INT8_C(   6),
+                           INT8_C(   6), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   7), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   2)) },
+    { UINT64_C( 6515130228987717937),
+      simde_mm512_set_epi8(INT8_C(  65), INT8_C( -78), INT8_C(  83), INT8_C( -21), INT8_C(  42), INT8_C(  -7), INT8_C(  37), INT8_C(  -6),
+                           INT8_C( -89), INT8_C( -98), INT8_C(  40), INT8_C(  92), INT8_C(-106), INT8_C( -57), INT8_C(  -8), INT8_C( -53),
+                           INT8_C( 127), INT8_C(-112), INT8_C( -87), INT8_C(  41), INT8_C(  38), INT8_C( 108), INT8_C(  67), INT8_C(  13),
+                           INT8_C(  84), INT8_C(  -9), INT8_C( -51), INT8_C( -75), INT8_C(  53), INT8_C(  53), INT8_C(-110), INT8_C( 105),
+                           INT8_C(  82), INT8_C( 126), INT8_C( -37), INT8_C( 120), INT8_C( -76), INT8_C( -53), INT8_C(  52), INT8_C(  65),
+                           INT8_C( -63), INT8_C( -86), INT8_C( -87), INT8_C(  70), INT8_C( 115), INT8_C(  23), INT8_C(  51), INT8_C( -90),
+                           INT8_C(  79), INT8_C(  76), INT8_C( 100), INT8_C(  11), INT8_C(  -2), INT8_C(  99), INT8_C(  40), INT8_C( 118),
+                           INT8_C(  24), INT8_C(  49), INT8_C(  41), INT8_C(  97), INT8_C(  83), INT8_C(-106), INT8_C( -48), INT8_C(  86)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   6), INT8_C(   3), INT8_C(   0), INT8_C(   3), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   5), INT8_C(   2), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   5), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   2), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   7), INT8_C(   5), INT8_C(   0), INT8_C(   4), INT8_C(   4), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   3), INT8_C(   0), INT8_C(   6), INT8_C(   4), INT8_C(   0), INT8_C(   5), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   5), INT8_C(   3), INT8_C(   3), INT8_C(   0), INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   5),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   4)) },
+    { UINT64_C(12170546424439035205),
+      simde_mm512_set_epi8(INT8_C( -96), INT8_C(  65), INT8_C(-120), INT8_C( 104), INT8_C( 105), INT8_C(  54), INT8_C(  15), INT8_C( -38),
+                           INT8_C(  51), INT8_C(  34), INT8_C( -53), INT8_C( 121), INT8_C( -81), INT8_C(  71), INT8_C( -37), INT8_C( 108),
+                           INT8_C(  51), INT8_C(-113), INT8_C(-115), INT8_C(  41), INT8_C(   1), INT8_C( -87), INT8_C(   3), INT8_C( -85),
+                           INT8_C(  65), INT8_C(-101), INT8_C( -98), INT8_C( -12), INT8_C( -95), INT8_C( -79), INT8_C(  18), INT8_C(  79),
+                           INT8_C(-114), INT8_C(  39), INT8_C(  49), INT8_C( -52), INT8_C( -63), INT8_C( -83), INT8_C( -77), INT8_C( 105),
+                           INT8_C( 124), INT8_C(-128), INT8_C(  97), INT8_C(  10), INT8_C( -30), INT8_C(  30), INT8_C( -72), INT8_C(  89),
+                           INT8_C(  67), INT8_C( -83), INT8_C( -77), INT8_C(  11), INT8_C( 119), INT8_C(  25), INT8_C( -87), INT8_C(-118),
+                           INT8_C( 108), INT8_C( -42), INT8_C( -63), INT8_C(-105), INT8_C(-105), INT8_C(  10), INT8_C( -12), INT8_C( -93)),
+      simde_mm512_set_epi8(INT8_C(   2), INT8_C(   0), INT8_C(   2), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   4), INT8_C(   2), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   6), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   5), INT8_C(   4), INT8_C(   3), INT8_C(   0), INT8_C(   4), INT8_C(   2), INT8_C(   5),
+                           INT8_C(   0), INT8_C(   5), INT8_C(   5), INT8_C(   5), INT8_C(   3), INT8_C(   4), INT8_C(   0), INT8_C(   5),
+                           INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   3), INT8_C(   5), INT8_C(   5), INT8_C(   4),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   2), INT8_C(   0), INT8_C(   4), INT8_C(   4), INT8_C(   0),
+                           INT8_C(   3), INT8_C(   5), INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   3),
+                           INT8_C(   0), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   2), INT8_C(   0), INT8_C(   4)) },
+    { UINT64_C( 5568351270992935421),
+      simde_mm512_set_epi8(INT8_C(-118), INT8_C( 116), INT8_C( -36), INT8_C( 120), INT8_C(  44), INT8_C(  37), INT8_C(  23), INT8_C(  19),
+                           INT8_C( -88), INT8_C( 100), INT8_C(-108), INT8_C( -51), INT8_C( -73), INT8_C( -66), INT8_C(  10), INT8_C(-122),
+                           INT8_C( -15), INT8_C(  15), INT8_C( -47), INT8_C( 114), INT8_C(  31), INT8_C( -11), INT8_C(  33), INT8_C(-123),
+                           INT8_C(  25), INT8_C(-119), INT8_C( -50), INT8_C( -16), INT8_C(  79), INT8_C(-112), INT8_C( -66), INT8_C(  -8),
+                           INT8_C(  -2), INT8_C(  69), INT8_C(-103), INT8_C( -90), INT8_C(-120), INT8_C(  55), INT8_C( -43), INT8_C(-109),
+                           INT8_C( 101), INT8_C(  41), INT8_C(  39), INT8_C(  43), INT8_C(   1), INT8_C(   1), INT8_C( -93), INT8_C( -44),
+                           INT8_C( -81), INT8_C(  76), INT8_C(  -9), INT8_C( -79), INT8_C(  67), INT8_C( -76), INT8_C(  84), INT8_C( 124),
+                           INT8_C( -56), INT8_C( -23), INT8_C(  33), INT8_C( 124), INT8_C( 104), INT8_C( 107), INT8_C(   9), INT8_C( -81)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(   3), INT8_C(   0), INT8_C(   3),
+                           INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   6), INT8_C(   2), INT8_C(   0),
+                           INT8_C(   5), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   3),
+                           INT8_C(   3), INT8_C(   3), INT8_C(   5), INT8_C(   4), INT8_C(   5), INT8_C(   0), INT8_C(   6), INT8_C(   0),
+                           INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   5), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   6), INT8_C(   3), INT8_C(   7), INT8_C(   4), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   5),
+                           INT8_C(   3), INT8_C(   5), INT8_C(   2), INT8_C(   5), INT8_C(   3), INT8_C(   5), INT8_C(   0), INT8_C(   6)) },
+    { UINT64_C( 7075804357900150611),
+      simde_mm512_set_epi8(INT8_C(  62), INT8_C( -49), INT8_C(  78), INT8_C(  -3), INT8_C( -86), INT8_C( 100), INT8_C(  18), INT8_C( -10),
+                           INT8_C( -91), INT8_C(  57), INT8_C( -56), INT8_C( -82), INT8_C(  10), INT8_C(-125), INT8_C( -49), INT8_C( 104),
+                           INT8_C(  78), INT8_C(-119), INT8_C(  91), INT8_C(  67), INT8_C( -56), INT8_C( 118), INT8_C(  49), INT8_C( -53),
+                           INT8_C( 112), INT8_C( -15), INT8_C(  62), INT8_C(-117), INT8_C(-108), INT8_C(-128), INT8_C(  66), INT8_C( -50),
+                           INT8_C( -59), INT8_C(   4), INT8_C(  96), INT8_C(  11), INT8_C( -76), INT8_C( -84), INT8_C( -49), INT8_C(  80),
+                           INT8_C( -83), INT8_C(  48), INT8_C(  10), INT8_C(  70), INT8_C( 126), INT8_C(  -5), INT8_C(  54), INT8_C(  60),
+                           INT8_C( 122), INT8_C( -68), INT8_C(  71), INT8_C(  70), INT8_C(   8), INT8_C(  84), INT8_C(  30), INT8_C(   0),
+                           INT8_C(  80), INT8_C( -21), INT8_C( -82), INT8_C(  14), INT8_C( -88), INT8_C( -75), INT8_C( 103), INT8_C(  78)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   6), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   2), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   6), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(   5), INT8_C(   3), INT8_C(   0),
+                           INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   2), INT8_C(   5),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   5), INT8_C(   2), INT8_C(   0), INT8_C(   0), INT8_C(   6), INT8_C(   7), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   5), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(   4), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   6), INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   5), INT8_C(   4)) },
+    { UINT64_C(10951126653602383479),
+      simde_mm512_set_epi8(INT8_C(  85), INT8_C(  91), INT8_C(  56), INT8_C(  82), INT8_C(  66), INT8_C( -83), INT8_C(  -1), INT8_C(-120),
+                           INT8_C( -90), INT8_C( -93), INT8_C( -96), INT8_C( 117), INT8_C( -53), INT8_C( 114), INT8_C(  14), INT8_C( -43),
+                           INT8_C( 116), INT8_C( 126), INT8_C(  65), INT8_C( 119), INT8_C( 111), INT8_C(  92), INT8_C(   2), INT8_C( -48),
+                           INT8_C(  -2), INT8_C( -83), INT8_C(  27), INT8_C( -79), INT8_C( -53), INT8_C( -39), INT8_C( -90), INT8_C( -35),
+                           INT8_C(  -5), INT8_C(  73), INT8_C(  85), INT8_C(  84), INT8_C(  44), INT8_C(  24), INT8_C(  33), INT8_C(  95),
+                           INT8_C(  35), INT8_C( 110), INT8_C(  78), INT8_C(  20), INT8_C(  -3), INT8_C( 127), INT8_C(  47), INT8_C(  65),
+                           INT8_C( -64), INT8_C(   7), INT8_C(-122), INT8_C( -87), INT8_C(  80), INT8_C( -12), INT8_C( -28), INT8_C(-120),
+                           INT8_C(  -9), INT8_C(  26), INT8_C( -28), INT8_C(  91), INT8_C(-112), INT8_C( -68), INT8_C(-118), INT8_C( -35)),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   5), INT8_C(   8), INT8_C(   2),
+                           INT8_C(   4), INT8_C(   4), INT8_C(   2), INT8_C(   5), INT8_C(   5), INT8_C(   0), INT8_C(   3), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   2), INT8_C(   6), INT8_C(   0), INT8_C(   4), INT8_C(   1), INT8_C(   3),
+                           INT8_C(   7), INT8_C(   0), INT8_C(   4), INT8_C(   0), INT8_C(   5), INT8_C(   0), INT8_C(   4), INT8_C(   6),
+                           INT8_C(   0), INT8_C(   3), INT8_C(   4), INT8_C(   3), INT8_C(   3), INT8_C(   2), INT8_C(   2), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   5), INT8_C(   0), INT8_C(   0), INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   5), INT8_C(   4), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   3), INT8_C(   4), INT8_C(   5), INT8_C(   0), INT8_C(   5), INT8_C(   3), INT8_C(   6)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_popcnt_epi8(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_AVX512BITALG_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_AVX512BITALG_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm512_bitshuffle_epi64_mask),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_bitshuffle_epi64_mask),
+  SIMDE_TESTS_DEFINE_TEST(mm512_popcnt_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_popcnt_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_popcnt_epi16),
+  SIMDE_TESTS_DEFINE_TEST(mm512_popcnt_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_popcnt_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_popcnt_epi8),
+#endif /* defined(SIMDE_AVX512BITALG_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
@@ -0,0 +1,1387 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX avx512cd
+#include <simde/x86/avx512cd.h>
+#include <test/x86/test-avx512.h>
+
+#if defined(SIMDE_AVX512CD_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_mm512_broadcastmw_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(19885),
+      simde_mm512_set_epi32(INT32_C(      19885), INT32_C(      19885), INT32_C(      19885), INT32_C(      19885),
+                            INT32_C(      19885), INT32_C(      19885), INT32_C(      19885), INT32_C(      19885),
+                            INT32_C(      19885), INT32_C(      19885), INT32_C(      19885), INT32_C(      19885),
+                            INT32_C(      19885), INT32_C(      19885), INT32_C(      19885), INT32_C(      19885)) },
+    { UINT16_C(24694),
+      simde_mm512_set_epi32(INT32_C(      24694), INT32_C(      24694), INT32_C(      24694), INT32_C(      24694),
+                            INT32_C(      24694), INT32_C(      24694), INT32_C(      24694), INT32_C(      24694),
+                            INT32_C(      24694), INT32_C(      24694), INT32_C(      24694), INT32_C(      24694),
+                            INT32_C(      24694), INT32_C(      24694), INT32_C(      24694), INT32_C(      24694)) },
+    { UINT16_C(24886),
+      simde_mm512_set_epi32(INT32_C(      24886), INT32_C(      24886), INT32_C(      24886), INT32_C(      24886),
+                            INT32_C(      24886), INT32_C(      24886), INT32_C(      24886), INT32_C(      24886),
+                            INT32_C(      24886), INT32_C(      24886), INT32_C(      24886), INT32_C(      24886),
+                            INT32_C(      24886), INT32_C(      24886), INT32_C(      24886), INT32_C(      24886)) },
+    { UINT16_C(52340),
+      simde_mm512_set_epi32(INT32_C(      52340), INT32_C(      52340), INT32_C(      52340), INT32_C(      52340),
+                            INT32_C(      52340), INT32_C(      52340), INT32_C(      52340), INT32_C(      52340),
+                            INT32_C(      52340), INT32_C(      52340), INT32_C(      52340), INT32_C(      52340),
+                            INT32_C(      52340), INT32_C(      52340), INT32_C(      52340), INT32_C(      52340)) },
+    { UINT16_C(19180),
+      simde_mm512_set_epi32(INT32_C(      19180), INT32_C(      19180), INT32_C(      19180), INT32_C(      19180),
+                            INT32_C(      19180), INT32_C(      19180), INT32_C(      19180), INT32_C(      19180),
+                            INT32_C(      19180), INT32_C(      19180), INT32_C(      19180), INT32_C(      19180),
+                            INT32_C(      19180), INT32_C(      19180), INT32_C(      19180), INT32_C(      19180)) },
+    { UINT16_C(64377),
+      simde_mm512_set_epi32(INT32_C(      64377), INT32_C(      64377), INT32_C(      64377), INT32_C(      64377),
+                            INT32_C(      64377), INT32_C(      64377), INT32_C(      64377), INT32_C(      64377),
+                            INT32_C(      64377), INT32_C(      64377), INT32_C(      64377), INT32_C(      64377),
+                            INT32_C(      64377), INT32_C(      64377), INT32_C(      64377), INT32_C(      64377)) },
+    { UINT16_C(62159),
+      simde_mm512_set_epi32(INT32_C(      62159), INT32_C(      62159), INT32_C(      62159), INT32_C(      62159),
+                            INT32_C(      62159), INT32_C(      62159), INT32_C(      62159), INT32_C(      62159),
+                            INT32_C(      62159), INT32_C(      62159), INT32_C(      62159), INT32_C(      62159),
+                            INT32_C(      62159), INT32_C(      62159), INT32_C(      62159), INT32_C(      62159)) },
+    { UINT16_C(28906),
+      simde_mm512_set_epi32(INT32_C(      28906), INT32_C(      28906), INT32_C(      28906), INT32_C(      28906),
+                            INT32_C(      28906), INT32_C(      28906), INT32_C(      28906), INT32_C(      28906),
+                            INT32_C(      28906), INT32_C(      28906), INT32_C(      28906), INT32_C(      28906),
+                            INT32_C(      28906), INT32_C(      28906), INT32_C(      28906), INT32_C(      28906)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_broadcastmw_epi32(test_vec[i].k);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_broadcastmb_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(139),
+      simde_mm512_set_epi64(INT64_C(                 139), INT64_C(                 139),
+                            INT64_C(                 139), INT64_C(                 139),
+                            INT64_C(                 139), INT64_C(                 139),
+                            INT64_C(                 139), INT64_C(                 139)) },
+    { UINT8_C(142),
+      simde_mm512_set_epi64(INT64_C(                 142), INT64_C(                 142),
+                            INT64_C(                 142), INT64_C(                 142),
+                            INT64_C(                 142), INT64_C(                 142),
+                            INT64_C(                 142), INT64_C(                 142)) },
+    { UINT8_C( 21),
+      simde_mm512_set_epi64(INT64_C(                  21), INT64_C(                  21),
+                            INT64_C(                  21), INT64_C(                  21),
+                            INT64_C(                  21), INT64_C(                  21),
+                            INT64_C(                  21), INT64_C(                  21)) },
+    { UINT8_C(  3),
+      simde_mm512_set_epi64(INT64_C(                   3), INT64_C(                   3),
+                            INT64_C(                   3), INT64_C(                   3),
+                            INT64_C(                   3), INT64_C(                   3),
+                            INT64_C(                   3), INT64_C(                   3)) },
+    { UINT8_C(253),
+      simde_mm512_set_epi64(INT64_C(                 253), INT64_C(                 253),
+                            INT64_C(                 253), INT64_C(                 253),
+                            INT64_C(                 253), INT64_C(                 253),
+                            INT64_C(                 253), INT64_C(                 253)) },
+    { UINT8_C(158),
+      simde_mm512_set_epi64(INT64_C(                 158), INT64_C(                 158),
+                            INT64_C(                 158), INT64_C(                 158),
+                            INT64_C(                 158), INT64_C(                 158),
+                            INT64_C(                 158), INT64_C(                 158)) },
+    { UINT8_C( 31),
+      simde_mm512_set_epi64(INT64_C(                  31), INT64_C(                  31),
+                            INT64_C(                  31), INT64_C(                  31),
+                            INT64_C(                  31), INT64_C(                  31),
+                            INT64_C(                  31), INT64_C(                  31)) },
+    { UINT8_C(255),
+      simde_mm512_set_epi64(INT64_C(                 255), INT64_C(                 255),
+                            INT64_C(                 255), INT64_C(                 255),
+                            INT64_C(                 255), INT64_C(                 255),
+                            INT64_C(                 255), INT64_C(                 255)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_broadcastmb_epi64(test_vec[i].k);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_conflict_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C( 1434828149), INT32_C( 2113595064), INT32_C( 1434828149), INT32_C( 1802586959),
+                            INT32_C( 2113595064), INT32_C( 1219755458), INT32_C( 2113595064), INT32_C( -417628919),
+                            INT32_C( 1802586959), INT32_C( 2137129196), INT32_C( 1434828149), INT32_C( 1434828149),
+                            INT32_C( -928081383), INT32_C( 2113595064), INT32_C(-2107280930), INT32_C( -928081383)),
+      simde_mm512_set_epi32(INT32_C(       8240), INT32_C(       2564), INT32_C(         48), INT32_C(        128),
+                            INT32_C(        516), INT32_C(          0), INT32_C(          4), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         16), INT32_C(          0),
+                            INT32_C(          1), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C(  942234150), INT32_C( -938295179), INT32_C(  707762960), INT32_C(  901220143),
+                            INT32_C(  864152880), INT32_C(  942234150), INT32_C(-1023961501), INT32_C(-2015605220),
+                            INT32_C( 1232027922), INT32_C(  707762960), INT32_C( -765201407), INT32_C( 1232027922),
+                            INT32_C( 1232027922), INT32_C(  942234150), INT32_C(  707762960), INT32_C(  720423801)),
+      simde_mm512_set_epi32(INT32_C(       1028), INT32_C(          0), INT32_C(         66), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          4), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         24), INT32_C(          2), INT32_C(          0), INT32_C(          8),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C(-1478340846), INT32_C(-2037398346), INT32_C(-1478340846), INT32_C(  597374655),
+                            INT32_C( -795470850), INT32_C( 1908674316), INT32_C(-1478340846), INT32_C( -179365013),
+                            INT32_C( 1908674316), INT32_C( 1908674316), INT32_C(-2037398346), INT32_C( 1908674316),
+                            INT32_C(-1478340846), INT32_C( 1908674316), INT32_C( 1342506162), INT32_C( 1682522906)),
+      simde_mm512_set_epi32(INT32_C(       8712), INT32_C(         32), INT32_C(        520), INT32_C(          0),
+                            INT32_C(          0), INT32_C(        212), INT32_C(          8), INT32_C(          0),
+                            INT32_C(         84), INT32_C(         20), INT32_C(          0), INT32_C(          4),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C(-1099098995), INT32_C(-1099098995), INT32_C(-1099098995), INT32_C( 1439280743),
+                            INT32_C(-1289916956), INT32_C( 1818653225), INT32_C( 1997779461), INT32_C(-1099098995),
+                            INT32_C(  956107164), INT32_C(  906982974), INT32_C( 1818653225), INT32_C(-1112821675),
+                            INT32_C( -420707926), INT32_C(-1289916956), INT32_C( 1111656614), INT32_C(-1289916956)),
+      simde_mm512_set_epi32(INT32_C(      24832), INT32_C(       8448), INT32_C(        256), INT32_C(          0),
+                            INT32_C(          5), INT32_C(         32), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          1), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C(  363699191), INT32_C(-1685953679), INT32_C(  363699191), INT32_C(  963006805),
+                            INT32_C(-1685953679), INT32_C( -398481643), INT32_C(  159092306), INT32_C(-1685953679),
+                            INT32_C( 2026143656), INT32_C( 1100314947), INT32_C(-1688765970), INT32_C(  253578989),
+                            INT32_C( 1100314947), INT32_C( -979444480), INT32_C(  363699191), INT32_C(  408232827)),
+      simde_mm512_set_epi32(INT32_C(       8194), INT32_C(       2304), INT32_C(          2), INT32_C(          0),
+                            INT32_C(        256), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          8), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C( 1466468534), INT32_C( 2097171708), INT32_C(  309185764), INT32_C(  309185764),
+                            INT32_C(  470858670), INT32_C(-1761929085), INT32_C( 2097171708), INT32_C( 2097171708),
+                            INT32_C(  309185764), INT32_C(-1631784091), INT32_C(-1631784091), INT32_C( -735456661),
+                            INT32_C(-1751324689), INT32_C(  309185764), INT32_C(-1631784091), INT32_C(-1631784091)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(        768), INT32_C(       4228), INT32_C(        132),
+                            INT32_C(          0), INT32_C(          0), INT32_C(        256), INT32_C(          0),
+                            INT32_C(          4), INT32_C(         35), INT32_C(          3), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          1), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C(  185533329), INT32_C( 1196135381), INT32_C(  158944800), INT32_C(-1216850352),
+                            INT32_C(-1644044497), INT32_C(-1216850352), INT32_C( -622860392), INT32_C(-1012024373),
+                            INT32_C( 1178367955), INT32_C(-1216850352), INT32_C(-1505352561), INT32_C(  649901095),
+                            INT32_C(-1216850352), INT32_C(-1505352561), INT32_C( -181678932), INT32_C(  190738329)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       1096),
+                            INT32_C(          0), INT32_C(         72), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          8), INT32_C(          4), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C( 1894946832), INT32_C(-1236994974), INT32_C(-1236994974), INT32_C( 1720526090),
+                            INT32_C( -393462574), INT32_C(  -65223874), INT32_C( 1642554341), INT32_C( 1642554341),
+                            INT32_C( 1555190295), INT32_C(-1236994974), INT32_C( 1642554341), INT32_C(   -8402421),
+                            INT32_C(-1138318623), INT32_C( 1642554341), INT32_C( -449343566), INT32_C(  188030395)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(       8256), INT32_C(         64), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(        292), INT32_C(         36),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          4), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_conflict_epi32(test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_conflict_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(  -52397091), INT32_C( -458700662), INT32_C( 1917678318), INT32_C(  424613946),
+                            INT32_C( 1430467265), INT32_C(  597885179), INT32_C( -417137102), INT32_C(  154668012),
+                            INT32_C( -677004005), INT32_C(-1683306912), INT32_C( 2139910834), INT32_C(-1449269523),
+                            INT32_C(  878836740), INT32_C(  642179026), INT32_C(-1485279618), INT32_C( 2012707104)),
+      UINT16_C(64411),
+      simde_mm512_set_epi32(INT32_C( 2042859653), INT32_C( 2002228396), INT32_C(-1914924892), INT32_C( 2002228396),
+                            INT32_C( 2002228396), INT32_C( 2002228396), INT32_C( 1050488264), INT32_C( 1378128275),
+                            INT32_C( 2002228396), INT32_C( 2083725792), INT32_C( -820062483), INT32_C( 1961447792),
+                            INT32_C( 2042859653), INT32_C( 2042859653), INT32_C( 2002228396), INT32_C( 2123598707)),
+      simde_mm512_set_epi32(INT32_C(         12), INT32_C(       7298), INT32_C(          0), INT32_C(       3202),
+                            INT32_C(       1154), INT32_C(  597885179), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          2), INT32_C(-1683306912), INT32_C( 2139910834), INT32_C(          0),
+                            INT32_C(          4), INT32_C(  642179026), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm512_set_epi32(INT32_C(-1319737374), INT32_C(-1666280420), INT32_C(-1103585963), INT32_C(-1099301022),
+                            INT32_C(-1252945446), INT32_C(-1019228227), INT32_C( 1987347038), INT32_C(-1392484291),
+                            INT32_C( -589769810), INT32_C(-2012358516), INT32_C( 1270786702), INT32_C(-1347745506),
+                            INT32_C( 1821125901), INT32_C( 1036476385), INT32_C(  962608375), INT32_C( 1120725942)),
+      UINT16_C(20020),
+      simde_mm512_set_epi32(INT32_C( 1132379691), INT32_C( 1132379691), INT32_C(-1464634198), INT32_C( 1612948935),
+                            INT32_C( 1132379691), INT32_C( 1421514343), INT32_C( 2105721416), INT32_C(-1110552501),
+                            INT32_C( 1132379691), INT32_C(-1189537965), INT32_C( 1132379691), INT32_C( 1132379691),
+                            INT32_C(  979759528), INT32_C(-1110552501), INT32_C(  979759528), INT32_C(  690704046)),
+      simde_mm512_set_epi32(INT32_C(-1319737374), INT32_C(       2224), INT32_C(-1103585963), INT32_C(-1099301022),
+                            INT32_C(        176), INT32_C(          0), INT32_C(          0), INT32_C(-1392484291),
+                            INT32_C( -589769810), INT32_C(-2012358516), INT32_C(         16), INT32_C(          0),
+                            INT32_C( 1821125901), INT32_C(          0), INT32_C(  962608375), INT32_C( 1120725942)) },
+    { simde_mm512_set_epi32(INT32_C( -187699689), INT32_C( 2068032387), INT32_C( -956632602), INT32_C( 1484602943),
+                            INT32_C( 1182765420), INT32_C( 1707062486), INT32_C( 1508928907), INT32_C(  917769802),
+                            INT32_C( -155261851), INT32_C( -929036133), INT32_C( -422186420), INT32_C( -288303759),
+                            INT32_C(   44072981), INT32_C( -234819729), INT32_C( 1365184119), INT32_C(-1587960475)),
+      UINT16_C(44052),
+      simde_mm512_set_epi32(INT32_C(  239958272), INT32_C(-2060520060), INT32_C(-1049620089), INT32_C(  659206454),
+                            INT32_C( -613592062), INT32_C( -933887597), INT32_C(  239958272), INT32_C( -810479575),
+                            INT32_C(  239958272), INT32_C(   57444002), INT32_C( 1942725618), INT32_C(  466651189),
+                            INT32_C( 1025182154), INT32_C( -340970924), INT32_C(  466651189), INT32_C(  239958272)),
+      simde_mm512_set_epi32(INT32_C(        641), INT32_C( 2068032387), INT32_C(          0), INT32_C( 1484602943),
+                            INT32_C(          0), INT32_C(          0), INT32_C( 1508928907), INT32_C(  917769802),
+                            INT32_C( -155261851), INT32_C( -929036133), INT32_C( -422186420), INT32_C(          2),
+                            INT32_C(   44072981), INT32_C(          0), INT32_C( 1365184119), INT32_C(-1587960475)) },
+    { simde_mm512_set_epi32(INT32_C( -849338319), INT32_C(-1495296119), INT32_C(-1994321385), INT32_C(  850000894),
+                            INT32_C( 1238861802), INT32_C( 1449586972), INT32_C(-1881092700), INT32_C( 1407368615),
+                            INT32_C( -558150023), INT32_C( -748253573), INT32_C( -381899140), INT32_C( -900512717),
+                            INT32_C(  418718958), INT32_C( -126104985), INT32_C( -792619056), INT32_C( -368758459)),
+      UINT16_C(60134),
+      simde_mm512_set_epi32(INT32_C(-1176132349), INT32_C( -940632107), INT32_C( 1214590645), INT32_C( 1214590645),
+                            INT32_C( -743553300), INT32_C( 1058621169), INT32_C( 1727784939), INT32_C( 1255489066),
+                            INT32_C(  549060233), INT32_C(  203203154), INT32_C( -658273129), INT32_C( -882899277),
+                            INT32_C(  149852539), INT32_C(   93669940), INT32_C(-1663235458), INT32_C( -653004165)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(       4096), INT32_C(  850000894),
+                            INT32_C(          0), INT32_C( 1449586972), INT32_C(          0), INT32_C( 1407368615),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C( -900512717),
+                            INT32_C(  418718958), INT32_C(          0), INT32_C(          0), INT32_C( -368758459)) },
+    { simde_mm512_set_epi32(INT32_C( 1537257771), INT32_C(-1908466688), INT32_C(  633220003), INT32_C(  321473302),
+                            INT32_C( -625613660), INT32_C( 1046163272), INT32_C( 1181662435), INT32_C( -494460404),
+                            INT32_C(-2027872786), INT32_C(-1390637101), INT32_C(-1393635158), INT32_C( -109963784),
+                            INT32_C(-1247308588), INT32_C( -617916844), INT32_C( 1526252533), INT32_C(-1504883063)),
+      UINT16_C(25144),
+      simde_mm512_set_epi32(INT32_C( -558226955), INT32_C( 1041411285), INT32_C( -674084992), INT32_C(   15697785),
+                            INT32_C(  652911517), INT32_C( -674084992), INT32_C( -674084992), INT32_C( -729153419),
+                            INT32_C( -674084992), INT32_C( -674084992), INT32_C( -409721102), INT32_C(  112822808),
+                            INT32_C( -359392144), INT32_C( 2068956412), INT32_C( 1566403705), INT32_C(-1314662283)),
+      simde_mm512_set_epi32(INT32_C( 1537257771), INT32_C(          0), INT32_C(       1728), INT32_C(  321473302),
+                            INT32_C( -625613660), INT32_C( 1046163272), INT32_C(        192), INT32_C( -494460404),
+                            INT32_C(-2027872786), INT32_C(-1390637101), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C( -617916844), INT32_C( 1526252533), INT32_C(-1504883063)) },
+    { simde_mm512_set_epi32(INT32_C(-1844968855), INT32_C(  962560157), INT32_C( -716368015), INT32_C(  500537203),
+                            INT32_C( -590389759), INT32_C(-1908313712), INT32_C(  730856317), INT32_C( -105899742),
+                            INT32_C( 1119719419), INT32_C(  904103147), INT32_C( -534091920), INT32_C(-1057945541),
+                            INT32_C( 1308168118), INT32_C(-1277178265), INT32_C( 1678530568), INT32_C(-1738700554)),
+      UINT16_C(47324),
+      simde_mm512_set_epi32(INT32_C( 1559478957), INT32_C( -345900019), INT32_C( -380685152), INT32_C(  561629748),
+                            INT32_C( 1046193840), INT32_C(-1462253387), INT32_C(  613652050), INT32_C( -656494288),
+                            INT32_C(  442791742), INT32_C(-1607012794), INT32_C(  561629748), INT32_C( 1805442254),
+                            INT32_C( -380685152), INT32_C(  561629748), INT32_C( 1559478957), INT32_C( 1559478957)),
+      simde_mm512_set_epi32(INT32_C(          3), INT32_C(  962560157), INT32_C(          8), INT32_C(         36),
+                            INT32_C(          0), INT32_C(-1908313712), INT32_C(  730856317), INT32_C( -105899742),
+                            INT32_C(          0), INT32_C(          0), INT32_C( -534091920), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C( 1678530568), INT32_C(-1738700554)) },
+    { simde_mm512_set_epi32(INT32_C( 1650426841), INT32_C( 1901226951), INT32_C( 1767682549), INT32_C( -603684349),
+                            INT32_C(  954373210), INT32_C(  812778634), INT32_C(  571912576), INT32_C( -771014453),
+                            INT32_C( 1515366770), INT32_C(  817189098), INT32_C( 1555073218), INT32_C(-1775209716),
+                            INT32_C(  195836170), INT32_C( 1541814179), INT32_C(-1695447832), INT32_C( 1837580641)),
+      UINT16_C(57040),
+      simde_mm512_set_epi32(INT32_C(  573301043), INT32_C(-1714889717), INT32_C(-1471881489), INT32_C( -997552275),
+                            INT32_C( 1117922744), INT32_C( -422340047), INT32_C(  152206125), INT32_C(-1958194168),
+                            INT32_C( -422340047), INT32_C( -997552275), INT32_C( -391455862), INT32_C(  439652677),
+                            INT32_C(-1109603025), INT32_C(  663116324), INT32_C(-1843579489), INT32_C(  573301043)),
+      simde_mm512_set_epi32(INT32_C(          1), INT32_C(          0), INT32_C( 1767682549), INT32_C(         64),
+                            INT32_C(          0), INT32_C(        128), INT32_C(          0), INT32_C( -771014453),
+                            INT32_C(          0), INT32_C(          0), INT32_C( 1555073218), INT32_C(          0),
+                            INT32_C(  195836170), INT32_C( 1541814179), INT32_C(-1695447832), INT32_C( 1837580641)) },
+    { simde_mm512_set_epi32(INT32_C( 1394477176), INT32_C( 1736066188), INT32_C( 1984196260), INT32_C( -543888485),
+                            INT32_C(-1175876618), INT32_C( -710225734), INT32_C( 1827703719), INT32_C(  164236322),
+                            INT32_C( -199864488), INT32_C( -365023364), INT32_C(-1972267527), INT32_C( 1926500259),
+                            INT32_C( 1987775740), INT32_C( 1500810164), INT32_C(  833828704), INT32_C( -809137882)),
+      UINT16_C( 4869),
+      simde_mm512_set_epi32(INT32_C( -875267563), INT32_C(-1248710178), INT32_C(-1823645387), INT32_C(-1248710178),
+                            INT32_C(-1248710178), INT32_C(  -86831517), INT32_C( 1421233806), INT32_C( -793887452),
+                            INT32_C( 1929117069), INT32_C( 1566003391), INT32_C(  -86831517), INT32_C(-1248710178),
+                            INT32_C( -264986051), INT32_C( -327363344), INT32_C(  947070760), INT32_C( 1566003391)),
+      simde_mm512_set_epi32(INT32_C( 1394477176), INT32_C( 1736066188), INT32_C( 1984196260), INT32_C(       2064),
+                            INT32_C(-1175876618), INT32_C( -710225734), INT32_C(          0), INT32_C(          0),
+                            INT32_C( -199864488), INT32_C( -365023364), INT32_C(-1972267527), INT32_C( 1926500259),
+                            INT32_C( 1987775740), INT32_C(          0), INT32_C(  833828704), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_conflict_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_conflict_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(63393),
+      simde_mm512_set_epi32(INT32_C(-1903524850), INT32_C(-2046510116), INT32_C(-1903524850), INT32_C(-1564301848),
+                            INT32_C(-1903524850), INT32_C(-1564301848), INT32_C( 1186681478), INT32_C(-1903524850),
+                            INT32_C(-1087679866), INT32_C( 1681501631), INT32_C(-1577826909), INT32_C(-1903524850),
+                            INT32_C(-1943415086), INT32_C( -660069213), INT32_C( 1186681478), INT32_C(-1577826909)),
+      simde_mm512_set_epi32(INT32_C(      10512), INT32_C(          0), INT32_C(       2320), INT32_C(       1024),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          2), INT32_C(         16),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          1), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(48977),
+      simde_mm512_set_epi32(INT32_C(  856703526), INT32_C( -206051415), INT32_C(  789343343), INT32_C(  856703526),
+                            INT32_C(  789343343), INT32_C( -208103500), INT32_C(  789343343), INT32_C(  789343343),
+                            INT32_C( -206051415), INT32_C(  789343343), INT32_C(  856703526), INT32_C( 1093308279),
+                            INT32_C( -206051415), INT32_C(  856703526), INT32_C(  856703526), INT32_C( -780767244)),
+      simde_mm512_set_epi32(INT32_C(       4134), INT32_C(          0), INT32_C(       2880), INT32_C(         38),
+                            INT32_C(        832), INT32_C(          0), INT32_C(        320), INT32_C(         64),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(35747),
+      simde_mm512_set_epi32(INT32_C( -501303207), INT32_C(-1244129259), INT32_C(-2097849696), INT32_C(-1819913208),
+                            INT32_C(-1261751231), INT32_C(  -27056010), INT32_C(  703316881), INT32_C(-1819913208),
+                            INT32_C( -996323120), INT32_C(-1244129259), INT32_C(  832809025), INT32_C(-1819913208),
+                            INT32_C(  950241010), INT32_C(-1819913208), INT32_C( 1719385716), INT32_C(-1244129259)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         20),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(45929),
+      simde_mm512_set_epi32(INT32_C( -414963725), INT32_C(   27853739), INT32_C( 2118665847), INT32_C( -881717547),
+                            INT32_C(   27853739), INT32_C(  -41996479), INT32_C(   27853739), INT32_C(-1436282122),
+                            INT32_C( -931778101), INT32_C(-1263743152), INT32_C(  139730432), INT32_C(   27853739),
+                            INT32_C(-1354245268), INT32_C(-1582230961), INT32_C(   16884692), INT32_C( 1765150682)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         16), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(13180),
+      simde_mm512_set_epi32(INT32_C(  551398042), INT32_C( -569797623), INT32_C( 1397188839), INT32_C(  465808462),
+                            INT32_C( 1969771701), INT32_C(  551398042), INT32_C(  551398042), INT32_C(-1524275686),
+                            INT32_C(  754125826), INT32_C(-2089071323), INT32_C(  428139044), INT32_C(-1524275686),
+                            INT32_C( 1457915247), INT32_C(  207180019), INT32_C(  551398042), INT32_C( 1331292758)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          2), INT32_C(         16),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(59231),
+      simde_mm512_set_epi32(INT32_C(-1168111142), INT32_C(  301208844), INT32_C(  452777079), INT32_C(  656506957),
+                            INT32_C(-1163583122), INT32_C( 1699532831), INT32_C(-1042140045), INT32_C( 1246735999),
+                            INT32_C(  452777079), INT32_C( 1858712401), INT32_C( 1465072080), INT32_C( 1699532831),
+                            INT32_C(-2027951418), INT32_C( -952958221), INT32_C( 1699532831), INT32_C( 1699532831)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(        128), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         19), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          3),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          1), INT32_C(          0)) },
+    { UINT16_C(65353),
+      simde_mm512_set_epi32(INT32_C(-1910885338), INT32_C(  169978789), INT32_C( 1102747239), INT32_C(  515013586),
+                            INT32_C( 1762487391), INT32_C(  515013586), INT32_C( 2100765041), INT32_C(  515013586),
+                            INT32_C( -632315470), INT32_C(  884993919), INT32_C(-2040263606), INT32_C( -632315470),
+                            INT32_C( 2133488375), INT32_C(  169978789), INT32_C( -632315470), INT32_C(  515013586)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          4), INT32_C(          0), INT32_C(       1281),
+                            INT32_C(          0), INT32_C(        257), INT32_C(          0), INT32_C(          1),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(51662),
+      simde_mm512_set_epi32(INT32_C( 1458127100), INT32_C( 1329044284), INT32_C(-1106111833), INT32_C(  942867976),
+                            INT32_C( -675452066), INT32_C( -629449251), INT32_C( -629449251), INT32_C(  332272816),
+                            INT32_C( -629449251), INT32_C( -621839322), INT32_C(  942867976), INT32_C( -675452066),
+                            INT32_C( -675452066), INT32_C(  942867976), INT32_C( -621839322), INT32_C(-1113361216)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         24), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          2), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_conflict_epi32(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_conflict_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-1382959552327608388), INT64_C( 4627251279705733194),
+                            INT64_C(-2076983525676011417), INT64_C( 1084333606030521330),
+                            INT64_C(-8794446561208239183), INT64_C( 6757550973278461546),
+                            INT64_C( 7348640905945788264), INT64_C( 4233617291846345786)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C(-2200524614255691844), INT64_C( 5204250605462488927),
+                            INT64_C(-2200524614255691844), INT64_C( 4156369809806240906),
+                            INT64_C(-1850262409065629805), INT64_C( -757436460140198353),
+                            INT64_C(-9157451796907898157), INT64_C( -357397882446782447)),
+      simde_mm512_set_epi64(INT64_C(                  32), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C( 8303641474592438724), INT64_C( 1099341818015769669),
+                            INT64_C(-1406518693011233321), INT64_C(-8559425850880361432),
+                            INT64_C( 8741718079129391007), INT64_C( 6248290529083013365),
+                            INT64_C( 2510445454504142244), INT64_C( 2562628472532089996)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C(-1331708049785295724), INT64_C(-3475798764606762190),
+                            INT64_C( 3130429812407391962), INT64_C(-3475798764606762190),
+                            INT64_C( 5418611966334672591), INT64_C(-9146513197913089302),
+                            INT64_C( 5418611966334672591), INT64_C( 7391265312432037078)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  16),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   2), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C(-3411740582371814064), INT64_C(-1398478744987942835),
+                            INT64_C(-2352489384557423372), INT64_C(-8066434064248258063),
+                            INT64_C(-8534827020367872474), INT64_C(-3158303950244078826),
+                            INT64_C(-3158303950244078826), INT64_C( 1385987875604356457)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   2),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C(-3735918380998447047), INT64_C(-7384809816467273181),
+                            INT64_C( 2254639843754777951), INT64_C(-9129917717641589583),
+                            INT64_C(-9013349311899426182), INT64_C( 6867986883869632210),
+                            INT64_C( 5595928167022399451), INT64_C(-1458517937031377218)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C( 6348016345090154484), INT64_C( 6348016345090154484),
+                            INT64_C(-2847820256714442113), INT64_C( 8747837338250935787),
+                            INT64_C(-6207328748163493739), INT64_C( 2106052410603483306),
+                            INT64_C(-6865624947572054503), INT64_C( 6348016345090154484)),
+      simde_mm512_set_epi64(INT64_C(                  65), INT64_C(                   1),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C(-1930059351192443054), INT64_C( 7897968535085255632),
+                            INT64_C( 8760337134029879523), INT64_C(  413209776926168984),
+                            INT64_C(-1604007271737843664), INT64_C(-2062580922389640011),
+                            INT64_C(-1930059351192443054), INT64_C(-5357957462159900424)),
+      simde_mm512_set_epi64(INT64_C(                   2), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_conflict_epi64(test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_conflict_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(  316025623280295767), INT64_C( 6104156472511119209),
+                            INT64_C( 5975246669964590482), INT64_C( 3313794263686191585),
+                            INT64_C( 5465431638833464103), INT64_C(-3100736192465816894),
+                            INT64_C(-9065257630158745699), INT64_C(-3902112252188585288)),
+      UINT8_C(169),
+      simde_mm512_set_epi64(INT64_C(-3222387833823551969), INT64_C( 6832282268797577490),
+                            INT64_C( 1749072027729040448), INT64_C( 8789894054995227511),
+                            INT64_C( 4248656414416966417), INT64_C(-3505203009703657328),
+                            INT64_C( -318465261883438424), INT64_C( 4248656414416966417)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C( 6104156472511119209),
+                            INT64_C(                   0), INT64_C( 3313794263686191585),
+                            INT64_C(                   1), INT64_C(-3100736192465816894),
+                            INT64_C(-9065257630158745699), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C(-2108039852391764732), INT64_C(-7849435902206448814),
+                            INT64_C(-7206992703572262314), INT64_C(-5782537451489750857),
+                            INT64_C( 7271147991074208513), INT64_C(-2653611163768525608),
+                            INT64_C( 4895170028180231280), INT64_C(-5614232130558973469)),
+      UINT8_C(222),
+      simde_mm512_set_epi64(INT64_C(-5859331944930555535), INT64_C(-5726791885679418106),
+                            INT64_C( 3697780767812950771), INT64_C( 1991500464126824306),
+                            INT64_C(  113300904131937888), INT64_C(  113300904131937888),
+                            INT64_C( 3577291323523339087), INT64_C(-3730062107410050977)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(-7206992703572262314), INT64_C(                   0),
+                            INT64_C(                   4), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-5614232130558973469)) },
+    { simde_mm512_set_epi64(INT64_C( 3928037808773094442), INT64_C( -405186684848447978),
+                            INT64_C(-3489634946642462045), INT64_C(  611810906644163643),
+                            INT64_C( 2404117831480409036), INT64_C(-2255946836371042478),
+                            INT64_C(-4406844769539929014), INT64_C(-6613072485115489117)),
+      UINT8_C( 18),
+      simde_mm512_set_epi64(INT64_C( 2972624811629936218), INT64_C(-3447426948957782484),
+                            INT64_C(-3447426948957782484), INT64_C(-4832845137159159971),
+                            INT64_C( -962597174442699593), INT64_C( 2972624811629936218),
+                            INT64_C(-7856917399101106073), INT64_C(-8674228017025602506)),
+      simde_mm512_set_epi64(INT64_C( 3928037808773094442), INT64_C( -405186684848447978),
+                            INT64_C(-3489634946642462045), INT64_C(                   0),
+                            INT64_C( 2404117831480409036), INT64_C(-2255946836371042478),
+                            INT64_C(                   0), INT64_C(-6613072485115489117)) },
+    { simde_mm512_set_epi64(INT64_C(-5462834950854626590), INT64_C(  208922127547800985),
+                            INT64_C( 5912096506817596481), INT64_C(-4131866517067834120),
+                            INT64_C( -565616678683524161), INT64_C(-2498045494535435098),
+                            INT64_C(  881306873398922225), INT64_C(-3900596424470483284)),
+      UINT8_C(  7),
+      simde_mm512_set_epi64(INT64_C(-6663745000042510159), INT64_C(-6663745000042510159),
+                            INT64_C(-6663745000042510159), INT64_C( 1931068779377585439),
+                            INT64_C( 8609957416585211472), INT64_C( 8609957416585211472),
+                            INT64_C(-6112379238556286792), INT64_C(-6056522431190498996)),
+      simde_mm512_set_epi64(INT64_C(-5462834950854626590), INT64_C(  208922127547800985),
+                            INT64_C( 5912096506817596481), INT64_C(-4131866517067834120),
+                            INT64_C( -565616678683524161), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { simde_mm512_set_epi64(INT64_C( 1665794658357774017), INT64_C( 3594423290208199816),
+                            INT64_C( 6494782815341821298), INT64_C(-5775750117426571682),
+                            INT64_C( 5444371722577593749), INT64_C(-7406754005791028671),
+                            INT64_C( 5506973552540167578), INT64_C(-7181966161915168843)),
+      UINT8_C(140),
+      simde_mm512_set_epi64(INT64_C(-1828351227307179707), INT64_C( 7670756339386486753),
+                            INT64_C( 6505844959885560751), INT64_C( 6505844959885560751),
+                            INT64_C( 4570243611803975032), INT64_C( 1467708416006731267),
+                            INT64_C( 1467708416006731267), INT64_C( 2972035498234757391)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C( 3594423290208199816),
+                            INT64_C( 6494782815341821298), INT64_C(-5775750117426571682),
+                            INT64_C(                   0), INT64_C(                   2),
+                            INT64_C( 5506973552540167578), INT64_C(-7181966161915168843)) },
+    { simde_mm512_set_epi64(INT64_C( 3046147246474472897), INT64_C(-5971817270540982449),
+                            INT64_C(-4542866853673656590), INT64_C(-3848995558952939857),
+                            INT64_C( -150550706620709214), INT64_C(-7819769635764586095),
+                            INT64_C(-3786831497162706188), INT64_C(  542174459226052999)),
+      UINT8_C(218),
+      simde_mm512_set_epi64(INT64_C( 2975741558420444730), INT64_C( 1285446710629524238),
+                            INT64_C( 6115702697988630147), INT64_C(-3886157630804496412),
+                            INT64_C(-3330929584762707521), INT64_C(-7687390251083859147),
+                            INT64_C(-7687390251083859147), INT64_C( 7656218324473328536)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(-4542866853673656590), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-7819769635764586095),
+                            INT64_C(                   0), INT64_C(  542174459226052999)) },
+    { simde_mm512_set_epi64(INT64_C(-3693603875466882030), INT64_C(-5709242810108339997),
+                            INT64_C( 1846338813022050323), INT64_C( 7893180117527345441),
+                            INT64_C( 8077870166112950932), INT64_C(-3104573428040154084),
+                            INT64_C(-3435376949611006795), INT64_C(-7153350472160489066)),
+      UINT8_C( 58),
+      simde_mm512_set_epi64(INT64_C(-7501878602116491135), INT64_C(-3049728285465184723),
+                            INT64_C( 8499950956495493237), INT64_C(-7501878602116491135),
+                            INT64_C( 7525410580182185525), INT64_C(-3049728285465184723),
+                            INT64_C( 8985156158719954866), INT64_C(-6625162933165483463)),
+      simde_mm512_set_epi64(INT64_C(-3693603875466882030), INT64_C(-5709242810108339997),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-3104573428040154084),
+                            INT64_C(                   0), INT64_C(-7153350472160489066)) },
+    { simde_mm512_set_epi64(INT64_C( 3317626162014799677), INT64_C(-3435814613855961408),
+                            INT64_C( 9222576694246263703), INT64_C(-6585036976160574734),
+                            INT64_C( 8796324472258078201), INT64_C( 2588404930239400684),
+                            INT64_C( 2306217544645164310), INT64_C( 6754145485746441484)),
+      UINT8_C(243),
+      simde_mm512_set_epi64(INT64_C( 4447234347580170415), INT64_C(-5806069661912769195),
+                            INT64_C( 1781063092112213369), INT64_C( 4820264315672902285),
+                            INT64_C( 2026544936658052954), INT64_C( 4447234347580170415),
+                            INT64_C( 4447234347580170415), INT64_C(-8699585306679418174)),
+      simde_mm512_set_epi64(INT64_C(                   6), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 8796324472258078201), INT64_C( 2588404930239400684),
+                            INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_conflict_epi64(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_conflict_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C( 51),
+      simde_mm512_set_epi64(INT64_C(-3920109266508349433), INT64_C( 7474819125592606392),
+                            INT64_C( 7032083146877028850), INT64_C(-5317227680747748478),
+                            INT64_C( 1587912618337997799), INT64_C( 7032083146877028850),
+                            INT64_C( 6863571812746920442), INT64_C(-1849856452362929465)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   4), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(141),
+      simde_mm512_set_epi64(INT64_C( 6790492059395811682), INT64_C( 7242177639770949428),
+                            INT64_C( 4605756752885883787), INT64_C(-1488112333794012818),
+                            INT64_C(-3759181985237491428), INT64_C( 8962333707789666711),
+                            INT64_C(-5426914572173034682), INT64_C(-3883736449618221547)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C( 48),
+      simde_mm512_set_epi64(INT64_C( 4230767794879521741), INT64_C(-1354263294603809095),
+                            INT64_C(-2626670424845707535), INT64_C(-8844668981819164604),
+                            INT64_C(-2968449445203279260), INT64_C( 1851821137781438553),
+                            INT64_C( 4702769115559077940), INT64_C( 3787258589690185862)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C( 74),
+      simde_mm512_set_epi64(INT64_C(-2218804231546089006), INT64_C(-6130557615527874098),
+                            INT64_C(-8314193447408215176), INT64_C(-6130557615527874098),
+                            INT64_C(-6130557615527874098), INT64_C(-1092111023059962823),
+                            INT64_C(-3344755193440870064), INT64_C(-8304263422902777811)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  24),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(241),
+      simde_mm512_set_epi64(INT64_C( 4864346817312335399), INT64_C( 5813491911614046466),
+                            INT64_C(-7054337108522458300), INT64_C(-7054337108522458300),
+                            INT64_C(-7054337108522458300), INT64_C(-7054337108522458300),
+                            INT64_C(-1461119397568177984), INT64_C(-1461119397568177984)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  28), INT64_C(                  12),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(171),
+      simde_mm512_set_epi64(INT64_C( 7938511014306619434), INT64_C( 2323124327386925860),
+                            INT64_C(-1847901448570549247), INT64_C(  878913365147139198),
+                            INT64_C( -100035906247560725), INT64_C( 2323124327386925860),
+                            INT64_C(  800416369156353202), INT64_C( 7395002540224792143)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(234),
+      simde_mm512_set_epi64(INT64_C( 3539056263357978537), INT64_C(-1583589768626760873),
+                            INT64_C( 8906708865134695234), INT64_C(   28106278924956598),
+                            INT64_C(-6701463154398194032), INT64_C(-1043982013689859407),
+                            INT64_C( 3539056263357978537), INT64_C( 3539056263357978537)),
+      simde_mm512_set_epi64(INT64_C(                   3), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   1), INT64_C(                   0)) },
+    { UINT8_C(253),
+      simde_mm512_set_epi64(INT64_C( 5505006546763619727), INT64_C( 1054360706603839162),
+                            INT64_C( 3812509063988283744), INT64_C( 7232233073192764804),
+                            INT64_C( 4853803774197696884), INT64_C( 5505006546763619727),
+                            INT64_C( 2057306058298911166), INT64_C(  775131536936953418)),
+      simde_mm512_set_epi64(INT64_C(                   4), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_conflict_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_lzcnt_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(       1386), INT32_C(    1947475), INT32_C(      82936), INT32_C(    8073867),
+                            INT32_C(          7), INT32_C(        780), INT32_C(      27410), INT32_C(      83012),
+                            INT32_C(        676), INT32_C(         51), INT32_C(          0), INT32_C( 1956363685),
+                            INT32_C(       7509), INT32_C(         17), INT32_C(          1), INT32_C(        252)),
+      simde_mm512_set_epi32(INT32_C(         21), INT32_C(         11), INT32_C(         15), INT32_C(          9),
+                            INT32_C(         29), INT32_C(         22), INT32_C(         17), INT32_C(         15),
+                            INT32_C(         22), INT32_C(         26), INT32_C(         32), INT32_C(          1),
+                            INT32_C(         19), INT32_C(         27), INT32_C(         31), INT32_C(         24)) },
+    { simde_mm512_set_epi32(INT32_C(     906078), INT32_C(        142), INT32_C(     448815), INT32_C(       4054),
+                            INT32_C(     222390), INT32_C(        112), INT32_C( -313774349), INT32_C(   15463532),
+                            INT32_C(       1406), INT32_C(      13347), INT32_C(     518727), INT32_C(  717377640),
+                            INT32_C(         20), INT32_C(    1981736), INT32_C(          2), INT32_C(        998)),
+      simde_mm512_set_epi32(INT32_C(         12), INT32_C(         24), INT32_C(         13), INT32_C(         20),
+                            INT32_C(         14), INT32_C(         25), INT32_C(          0), INT32_C(          8),
+                            INT32_C(         21), INT32_C(         18), INT32_C(         13), INT32_C(          2),
+                            INT32_C(         27), INT32_C(         11), INT32_C(         30), INT32_C(         22)) },
+    { simde_mm512_set_epi32(INT32_C(      30958), INT32_C(         25), INT32_C(         25), INT32_C(        320),
+                            INT32_C(     226669), INT32_C(         10), INT32_C(          7), INT32_C(        124),
+                            INT32_C(      96194), INT32_C(        224), INT32_C( 1410510319), INT32_C(        152),
+                            INT32_C(     242161), INT32_C(      21620), INT32_C(  686745713), INT32_C(          0)),
+      simde_mm512_set_epi32(INT32_C(         17), INT32_C(         27), INT32_C(         27), INT32_C(         23),
+                            INT32_C(         14), INT32_C(         28), INT32_C(         29), INT32_C(         25),
+                            INT32_C(         15), INT32_C(         24), INT32_C(          1), INT32_C(         24),
+                            INT32_C(         14), INT32_C(         17), INT32_C(          2), INT32_C(         32)) },
+    { simde_mm512_set_epi32(INT32_C(        102), INT32_C(          0), INT32_C(   47023435), INT32_C(      45160),
+                            INT32_C(     458125), INT32_C(       4176), INT32_C(       1957), INT32_C(      61241),
+                            INT32_C(          7), INT32_C(  130308201), INT32_C( 1968805350), INT32_C(     448312),
+                            INT32_C(         64), INT32_C(     299310), INT32_C(       1657), INT32_C(    3681640)),
+      simde_mm512_set_epi32(INT32_C(         25), INT32_C(         32), INT32_C(          6), INT32_C(         16),
+                            INT32_C(         13), INT32_C(         19), INT32_C(         21), INT32_C(         16),
+                            INT32_C(         29), INT32_C(          5), INT32_C(          1), INT32_C(         13),
+                            INT32_C(         25), INT32_C(         13), INT32_C(         21), INT32_C(         10)) },
+    { simde_mm512_set_epi32(INT32_C(         97), INT32_C(     102925), INT32_C(    1243716), INT32_C(   64715420),
+                            INT32_C(      13785), INT32_C(         11), INT32_C(  457736173), INT32_C(  197513015),
+                            INT32_C(          0), INT32_C(         56), INT32_C(         23), INT32_C(  220774124),
+                            INT32_C(     245508), INT32_C(          9), INT32_C(       2241), INT32_C(  263985483)),
+      simde_mm512_set_epi32(INT32_C(         25), INT32_C(         15), INT32_C(         11), INT32_C(          6),
+                            INT32_C(         18), INT32_C(         28), INT32_C(          3), INT32_C(          4),
+                            INT32_C(         32), INT32_C(         26), INT32_C(         27), INT32_C(          4),
+                            INT32_C(         14), INT32_C(         28), INT32_C(         20), INT32_C(          4)) },
+    { simde_mm512_set_epi32(INT32_C(  671952194), INT32_C(    5015386), INT32_C(         15), INT32_C(          1),
+                            INT32_C(      10398), INT32_C(          1), INT32_C(    1145141), INT32_C(          3),
+                            INT32_C(   25169362), INT32_C(        687), INT32_C(       2830), INT32_C(       2224),
+                            INT32_C( 1189316803), INT32_C(       2541), INT32_C(   56020088), INT32_C(  555623203)),
+      simde_mm512_set_epi32(INT32_C(          2), INT32_C(          9), INT32_C(         28), INT32_C(         31),
+                            INT32_C(         18), INT32_C(         31), INT32_C(         11), INT32_C(         30),
+                            INT32_C(          7), INT32_C(         22), INT32_C(         20), INT32_C(         20),
+                            INT32_C(          1), INT32_C(         20), INT32_C(          6), INT32_C(          2)) },
+    { simde_mm512_set_epi32(INT32_C(    8744440), INT32_C(     374234), INT32_C(    3071621), INT32_C(    1769125),
+                            INT32_C(          1), INT32_C(          1), INT32_C(   64136980), INT32_C(         39),
+                            INT32_C(        100), INT32_C(         25), INT32_C(       3827), INT32_C(    4110235),
+                            INT32_C(       1012), INT32_C(  101360650), INT32_C(       8070), INT32_C(      96059)),
+      simde_mm512_set_epi32(INT32_C(          8), INT32_C(         13), INT32_C(         10), INT32_C(         11),
+                            INT32_C(         31), INT32_C(         31), INT32_C(          6), INT32_C(         26),
+                            INT32_C(         25), INT32_C(         27), INT32_C(         20), INT32_C(         10),
+                            INT32_C(         22), INT32_C(          5), INT32_C(         19), INT32_C(         15)) },
+    { simde_mm512_set_epi32(INT32_C(   18377924), INT32_C(       1228), INT32_C(     100639), INT32_C(         18),
+                            INT32_C(       3097), INT32_C( 1345245920), INT32_C(     476965), INT32_C(      52057),
+                            INT32_C(          0), INT32_C(          2), INT32_C(      12430), INT32_C(       7142),
+                            INT32_C(  835977933), INT32_C(      10083), INT32_C(      78184), INT32_C(  239131803)),
+      simde_mm512_set_epi32(INT32_C(          7), INT32_C(         21), INT32_C(         15), INT32_C(         27),
+                            INT32_C(         20), INT32_C(          1), INT32_C(         13), INT32_C(         16),
+                            INT32_C(         32), INT32_C(         30), INT32_C(         18), INT32_C(         19),
+                            INT32_C(          2), INT32_C(         18), INT32_C(         15), INT32_C(          4)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_lzcnt_epi32(test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_lzcnt_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(-1338385329), INT32_C( -490982724), INT32_C( -947486469), INT32_C(  132413839),
+                            INT32_C(-1478126916), INT32_C(  -45543313), INT32_C( 1531278200), INT32_C( 1887692927),
+                            INT32_C( 1070079890), INT32_C( -990118016), INT32_C( 1133865557), INT32_C( -319155483),
+                            INT32_C( 1260375072), INT32_C(  475267808), INT32_C( 1378300416), INT32_C(  458668757)),
+      UINT16_C(26073),
+      simde_mm512_set_epi32(INT32_C(       1549), INT32_C(  615497390), INT32_C(    1585051), INT32_C(  681251306),
+                            INT32_C(    2016382), INT32_C(        128), INT32_C(          3), INT32_C(    1463994),
+                            INT32_C(      25570), INT32_C(    1472779), INT32_C(  616586223), INT32_C(         11),
+                            INT32_C(      10084), INT32_C(        328), INT32_C(    1012220), INT32_C(  862958973)),
+      simde_mm512_set_epi32(INT32_C(-1338385329), INT32_C(          2), INT32_C(         11), INT32_C(  132413839),
+                            INT32_C(-1478126916), INT32_C(         24), INT32_C( 1531278200), INT32_C(         11),
+                            INT32_C(         17), INT32_C(         11), INT32_C( 1133865557), INT32_C(         28),
+                            INT32_C(         18), INT32_C(  475267808), INT32_C( 1378300416), INT32_C(          2)) },
+    { simde_mm512_set_epi32(INT32_C(  523217132), INT32_C(  357989966), INT32_C(-2083824087), INT32_C( -856534611),
+                            INT32_C(-1654068600), INT32_C(-1062945513), INT32_C( -556536270), INT32_C( -701226794),
+                            INT32_C( -901467819), INT32_C( 1668032965), INT32_C( -648177696), INT32_C(  586380397),
+                            INT32_C(  997664641), INT32_C( 1363559144), INT32_C(  219241352), INT32_C(-1379348085)),
+      UINT16_C(33074),
+      simde_mm512_set_epi32(INT32_C(    1780877), INT32_C(         20), INT32_C(       1313), INT32_C(        740),
+                            INT32_C(     114406), INT32_C(     145722), INT32_C(      90494), INT32_C(    5725759),
+                            INT32_C(          3), INT32_C(      30693), INT32_C(          1), INT32_C(        105),
+                            INT32_C(    3445448), INT32_C(        288), INT32_C(          0), INT32_C( 1950365841)),
+      simde_mm512_set_epi32(INT32_C(         11), INT32_C(  357989966), INT32_C(-2083824087), INT32_C( -856534611),
+                            INT32_C(-1654068600), INT32_C(-1062945513), INT32_C( -556536270), INT32_C(          9),
+                            INT32_C( -901467819), INT32_C( 1668032965), INT32_C(         31), INT32_C(         25),
+                            INT32_C(  997664641), INT32_C( 1363559144), INT32_C(         32), INT32_C(-1379348085)) },
+    { simde_mm512_set_epi32(INT32_C( 1496063160), INT32_C( -714961642), INT32_C(  810773626), INT32_C(-1319180710),
+                            INT32_C(  -80797466), INT32_C(-2058667220), INT32_C( -250856845), INT32_C(-1044524343),
+                            INT32_C( -666474045), INT32_C( 1067048434), INT32_C(  832658705), INT32_C( -684331797),
+                            INT32_C(-1405556037), INT32_C(-1433158057), INT32_C( 2137715842), INT32_C(  959250709)),
+      UINT16_C(52620),
+      simde_mm512_set_epi32(INT32_C(    2909613), INT32_C( 1886783300), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         15), INT32_C(          4), INT32_C(       5527),
+                            INT32_C(   14823374), INT32_C(          3), INT32_C(  536306092), INT32_C(      13237),
+                            INT32_C(   31140866), INT32_C(      50006), INT32_C(     222216), INT32_C(      24876)),
+      simde_mm512_set_epi32(INT32_C(         10), INT32_C(          1), INT32_C(  810773626), INT32_C(-1319180710),
+                            INT32_C(         32), INT32_C(         28), INT32_C( -250856845), INT32_C(         19),
+                            INT32_C(          8), INT32_C( 1067048434), INT32_C(  832658705), INT32_C( -684331797),
+                            INT32_C(          7), INT32_C(         16), INT32_C( 2137715842), INT32_C(  959250709)) },
+    { simde_mm512_set_epi32(INT32_C(  841505373), INT32_C(  906325393), INT32_C(-1807928653), INT32_C(  544047959),
+                            INT32_C(-1224809484), INT32_C( -503676206), INT32_C(-1914477976), INT32_C(-1368376347),
+                            INT32_C(  934855144), INT32_C( -636844753), INT32_C(  282009839), INT32_C(  557518705),
+                            INT32_C( 1282349600), INT32_C(-1686511857), INT32_C(  268952435), INT32_C(   81756810)),
+      UINT16_C( 8970),
+      simde_mm512_set_epi32(INT32_C(          4), INT32_C(   32085733), INT32_C(          1), INT32_C(       3548),
+                            INT32_C(    2869830), INT32_C(        263), INT32_C(        932), INT32_C(          2),
+                            INT32_C(         14), INT32_C(         10), INT32_C(        242), INT32_C(  572545134),
+                            INT32_C(        355), INT32_C(          0), INT32_C(     282519), INT32_C(          0)),
+      simde_mm512_set_epi32(INT32_C(  841505373), INT32_C(  906325393), INT32_C(         31), INT32_C(  544047959),
+                            INT32_C(-1224809484), INT32_C( -503676206), INT32_C(         22), INT32_C(         30),
+                            INT32_C(  934855144), INT32_C( -636844753), INT32_C(  282009839), INT32_C(  557518705),
+                            INT32_C(         23), INT32_C(-1686511857), INT32_C(         13), INT32_C(   81756810)) },
+    { simde_mm512_set_epi32(INT32_C(  185707058), INT32_C(  557193427), INT32_C(-1303545321), INT32_C( 1902684544),
+                            INT32_C(  249431068), INT32_C(  244169913), INT32_C( -533609277), INT32_C( -494039388),
+                            INT32_C(-1211038991), INT32_C( 1067330942), INT32_C( 1197147513), INT32_C(  677720287),
+                            INT32_C( 1025685912), INT32_C( 1642267100), INT32_C( 1742539124), INT32_C(-1686737916)),
+      UINT16_C( 8226),
+      simde_mm512_set_epi32(INT32_C(    6006082), INT32_C(          6), INT32_C(   13804865), INT32_C(   17172040),
+                            INT32_C(          0), INT32_C(       3939), INT32_C(  326378590), INT32_C(     168323),
+                            INT32_C(      22878), INT32_C(        123), INT32_C(      35524), INT32_C(    2555568),
+                            INT32_C(      11357), INT32_C(   21641192), INT32_C(      10509), INT32_C(      17638)),
+      simde_mm512_set_epi32(INT32_C(  185707058), INT32_C(  557193427), INT32_C(          8), INT32_C( 1902684544),
+                            INT32_C(  249431068), INT32_C(  244169913), INT32_C( -533609277), INT32_C( -494039388),
+                            INT32_C(-1211038991), INT32_C( 1067330942), INT32_C(         16), INT32_C(  677720287),
+                            INT32_C( 1025685912), INT32_C( 1642267100), INT32_C(         18), INT32_C(-1686737916)) },
+    { simde_mm512_set_epi32(INT32_C(-1326279652), INT32_C( -238003832), INT32_C( 1255063816), INT32_C( 2017579048),
+                            INT32_C( 1527223915), INT32_C(-1806941394), INT32_C( 1026037299), INT32_C( -986719718),
+                            INT32_C(-1012876982), INT32_C( -200763657), INT32_C(  344333368), INT32_C(-1519219744),
+                            INT32_C(   -9911086), INT32_C( -977408001), INT32_C( -568979624), INT32_C(  684559844)),
+      UINT16_C(39739),
+      simde_mm512_set_epi32(INT32_C(      16050), INT32_C(         99), INT32_C(  812015966), INT32_C(        346),
+                            INT32_C(          6), INT32_C(          1), INT32_C(       1685), INT32_C(   77983643),
+                            INT32_C(    2835065), INT32_C(        137), INT32_C(    5107842), INT32_C(     259762),
+                            INT32_C(   76499826), INT32_C(  355315704), INT32_C(          1), INT32_C(  221218075)),
+      simde_mm512_set_epi32(INT32_C(         18), INT32_C( -238003832), INT32_C( 1255063816), INT32_C(         23),
+                            INT32_C(         29), INT32_C(-1806941394), INT32_C(         21), INT32_C(          5),
+                            INT32_C(-1012876982), INT32_C( -200763657), INT32_C(          9), INT32_C(         14),
+                            INT32_C(          5), INT32_C( -977408001), INT32_C(         31), INT32_C(          4)) },
+    { simde_mm512_set_epi32(INT32_C( 1848593436), INT32_C( 1388009394), INT32_C(-2081680349), INT32_C(-1703018676),
+                            INT32_C( -876634210), INT32_C( -672943576), INT32_C(-1213436761), INT32_C(  711616697),
+                            INT32_C( -939369418), INT32_C( 2083991768), INT32_C(-1414697313), INT32_C(-1533212535),
+                            INT32_C(  163922244), INT32_C(  -70668588), INT32_C(  108569787), INT32_C(-1262310654)),
+      UINT16_C(36253),
+      simde_mm512_set_epi32(INT32_C(      92577), INT32_C(     466172), INT32_C(        915), INT32_C(        124),
+                            INT32_C(   12092451), INT32_C(      23574), INT32_C(  689238781), INT32_C(          0),
+                            INT32_C(  107174518), INT32_C(        347), INT32_C(          0), INT32_C(          0),
+                            INT32_C( 1442260674), INT32_C(         59), INT32_C(        158), INT32_C(    2214757)),
+      simde_mm512_set_epi32(INT32_C(         15), INT32_C( 1388009394), INT32_C(-2081680349), INT32_C(-1703018676),
+                            INT32_C(          8), INT32_C(         17), INT32_C(-1213436761), INT32_C(         32),
+                            INT32_C(          5), INT32_C( 2083991768), INT32_C(-1414697313), INT32_C(         32),
+                            INT32_C(          1), INT32_C(         26), INT32_C(  108569787), INT32_C(         10)) },
+    { simde_mm512_set_epi32(INT32_C( -560944493), INT32_C(-1547349923), INT32_C( -195848003), INT32_C( -456824497),
+                            INT32_C(  925981282), INT32_C(-1548886477), INT32_C( -519511730), INT32_C(  933422584),
+                            INT32_C( 1815476832), INT32_C(-2097672862), INT32_C( 1064711176), INT32_C(-2100964278),
+                            INT32_C(  318204229), INT32_C(-1299867993), INT32_C( -173908894), INT32_C(-1255332309)),
+      UINT16_C(28093),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(      15418), INT32_C(       6202), INT32_C(          2),
+                            INT32_C(      29562), INT32_C(    3761595), INT32_C(         11), INT32_C(          0),
+                            INT32_C(   14740226), INT32_C(    1614597), INT32_C(          2), INT32_C( 1655113676),
+                            INT32_C(     206282), INT32_C(          0), INT32_C(    1087706), INT32_C(      38704)),
+      simde_mm512_set_epi32(INT32_C( -560944493), INT32_C(         18), INT32_C(         19), INT32_C( -456824497),
+                            INT32_C(         17), INT32_C(         10), INT32_C( -519511730), INT32_C(         32),
+                            INT32_C(          8), INT32_C(-2097672862), INT32_C(         30), INT32_C(          1),
+                            INT32_C(         14), INT32_C(         32), INT32_C( -173908894), INT32_C(         16)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_lzcnt_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_lzcnt_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(62810),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(     605897), INT32_C(         17), INT32_C(  837263720),
+                            INT32_C(          0), INT32_C(    7964939), INT32_C(      81662), INT32_C(  122176474),
+                            INT32_C(     809925), INT32_C(  140307472), INT32_C(     179001), INT32_C(   67043895),
+                            INT32_C(    7378879), INT32_C(-1876463571), INT32_C(          9), INT32_C(    8093429)),
+      simde_mm512_set_epi32(INT32_C(         32), INT32_C(         12), INT32_C(         27), INT32_C(          2),
+                            INT32_C(          0), INT32_C(          9), INT32_C(          0), INT32_C(          5),
+                            INT32_C(          0), INT32_C(          4), INT32_C(          0), INT32_C(          6),
+                            INT32_C(          9), INT32_C(          0), INT32_C(         28), INT32_C(          0)) },
+    { UINT16_C(52868),
+      simde_mm512_set_epi32(INT32_C(         23), INT32_C(        125), INT32_C(        141), INT32_C(         92),
+                            INT32_C(         34), INT32_C(      44695), INT32_C(         40), INT32_C(  123169814),
+                            INT32_C(   26219714), INT32_C(    3938684), INT32_C(       5622), INT32_C(       1610),
+                            INT32_C(          0), INT32_C(        973), INT32_C(     522151), INT32_C(   33304568)),
+      simde_mm512_set_epi32(INT32_C(         27), INT32_C(         25), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         26), INT32_C(         16), INT32_C(         26), INT32_C(          0),
+                            INT32_C(          7), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         22), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(25824),
+      simde_mm512_set_epi32(INT32_C(          1), INT32_C(          0), INT32_C(      19574), INT32_C(          5),
+                            INT32_C(     161163), INT32_C(   13616466), INT32_C(   35644340), INT32_C( 1070193264),
+                            INT32_C(       1055), INT32_C(          3), INT32_C(         30), INT32_C(       1002),
+                            INT32_C(  934038182), INT32_C(          1), INT32_C(   23908351), INT32_C(         63)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(         32), INT32_C(         17), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          8), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         21), INT32_C(         30), INT32_C(         27), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(18266),
+      simde_mm512_set_epi32(INT32_C(          5), INT32_C(  166944145), INT32_C(      17429), INT32_C(      86958),
+                            INT32_C(          0), INT32_C(        157), INT32_C(     153918), INT32_C(  151877095),
+                            INT32_C(     388039), INT32_C(          5), INT32_C(  810903261), INT32_C(      14947),
+                            INT32_C(       1516), INT32_C(   18152002), INT32_C(        772), INT32_C(    4179720)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          4), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         24), INT32_C(         14), INT32_C(          4),
+                            INT32_C(          0), INT32_C(         29), INT32_C(          0), INT32_C(         18),
+                            INT32_C(         21), INT32_C(          0), INT32_C(         22), INT32_C(          0)) },
+    { UINT16_C(56838),
+      simde_mm512_set_epi32(INT32_C(         25), INT32_C(    5669921), INT32_C(   50480953), INT32_C(  493130015),
+                            INT32_C(  806422829), INT32_C(          0), INT32_C(          0), INT32_C(        109),
+                            INT32_C(         10), INT32_C(          2), INT32_C(    7872521), INT32_C(      15344),
+                            INT32_C(  250641535), INT32_C(       1626), INT32_C(       6923), INT32_C(  284354390)),
+      simde_mm512_set_epi32(INT32_C(         27), INT32_C(          9), INT32_C(          0), INT32_C(          3),
+                            INT32_C(          2), INT32_C(         32), INT32_C(         32), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         21), INT32_C(         19), INT32_C(          0)) },
+    { UINT16_C(38508),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(  746690847), INT32_C(          0), INT32_C(  348109613),
+                            INT32_C(      39915), INT32_C(   31373364), INT32_C(          4), INT32_C(     959043),
+                            INT32_C(          3), INT32_C(      24167), INT32_C(     294065), INT32_C(        127),
+                            INT32_C(   15424145), INT32_C(    4660028), INT32_C(   35246600), INT32_C(   16767882)),
+      simde_mm512_set_epi32(INT32_C(         32), INT32_C(          0), INT32_C(          0), INT32_C(          3),
+                            INT32_C(          0), INT32_C(          7), INT32_C(         29), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         17), INT32_C(         13), INT32_C(          0),
+                            INT32_C(          8), INT32_C(          9), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(26838),
+      simde_mm512_set_epi32(INT32_C(     647841), INT32_C(    1570804), INT32_C(          6), INT32_C(    1562780),
+                            INT32_C(      62758), INT32_C(         36), INT32_C(  184324711), INT32_C(          0),
+                            INT32_C(        804), INT32_C(     219975), INT32_C(   21425577), INT32_C( 1791934920),
+                            INT32_C(  741590985), INT32_C(    2886256), INT32_C(        127), INT32_C(    5288027)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(         11), INT32_C(         29), INT32_C(          0),
+                            INT32_C(         16), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         22), INT32_C(         14), INT32_C(          0), INT32_C(          1),
+                            INT32_C(          0), INT32_C(         10), INT32_C(         25), INT32_C(          0)) },
+    { UINT16_C(32773),
+      simde_mm512_set_epi32(INT32_C(    1350570), INT32_C(         17), INT32_C(       4523), INT32_C(          0),
+                            INT32_C(      42956), INT32_C(  465648916), INT32_C(       6887), INT32_C(     193224),
+                            INT32_C(  410240432), INT32_C(    3819059), INT32_C(   31393412), INT32_C(         99),
+                            INT32_C(    1276078), INT32_C(      14002), INT32_C(  135762020), INT32_C( 1646927936)),
+      simde_mm512_set_epi32(INT32_C(         11), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         18), INT32_C(          0), INT32_C(          1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_lzcnt_epi32(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_lzcnt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(  885097719802378808), INT64_C(    2812933879015914),
+                            INT64_C(      62928576796527), INT64_C(   70692567362097757),
+                            INT64_C(                  35), INT64_C(               14401),
+                            INT64_C(   60189351873942817), INT64_C(               13979)),
+      simde_mm512_set_epi64(INT64_C(                   4), INT64_C(                  12),
+                            INT64_C(                  18), INT64_C(                   8),
+                            INT64_C(                  58), INT64_C(                  50),
+                            INT64_C(                   8), INT64_C(                  50)) },
+    { simde_mm512_set_epi64(INT64_C(                 226), INT64_C(                   6),
+                            INT64_C(          1979851203), INT64_C(          2881593912),
+                            INT64_C(              172390), INT64_C(            75972907),
+                            INT64_C(               27635), INT64_C(                 721)),
+      simde_mm512_set_epi64(INT64_C(                  56), INT64_C(                  61),
+                            INT64_C(                  33), INT64_C(                  32),
+                            INT64_C(                  46), INT64_C(                  37),
+                            INT64_C(                  49), INT64_C(                  54)) },
+    { simde_mm512_set_epi64(INT64_C(-7165855951987082464), INT64_C(  417142097938592800),
+                            INT64_C(                 735), INT64_C(               16910),
+                            INT64_C(                  57), INT64_C(      12371508228621),
+                            INT64_C(              501095), INT64_C(         38316232045)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   5),
+                            INT64_C(                  54), INT64_C(                  49),
+                            INT64_C(                  58), INT64_C(                  20),
+                            INT64_C(                  45), INT64_C(                  28)) },
+    { simde_mm512_set_epi64(INT64_C(-6846207641544426570), INT64_C(         89087429043),
+                            INT64_C(                  37), INT64_C(           536295886),
+                            INT64_C(         13096021902), INT64_C(           127978062),
+                            INT64_C(          1050388394), INT64_C(              303663)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  27),
+                            INT64_C(                  58), INT64_C(                  35),
+                            INT64_C(                  30), INT64_C(                  37),
+                            INT64_C(                  34), INT64_C(                  45)) },
+    { simde_mm512_set_epi64(INT64_C(           157381649), INT64_C(                  22),
+                            INT64_C(               49694), INT64_C(            14351027),
+                            INT64_C(  230760175416602164), INT64_C(                 478),
+                            INT64_C(  105531271438459745), INT64_C(                  11)),
+      simde_mm512_set_epi64(INT64_C(                  36), INT64_C(                  59),
+                            INT64_C(                  48), INT64_C(                  40),
+                            INT64_C(                   6), INT64_C(                  55),
+                            INT64_C(                   7), INT64_C(                  60)) },
+    { simde_mm512_set_epi64(INT64_C(         17516634118), INT64_C(      17159986358405),
+                            INT64_C(            33118174), INT64_C(           971819637),
+                            INT64_C(                   0), INT64_C(                   4),
+                            INT64_C(            38483936), INT64_C(    3580724774215350)),
+      simde_mm512_set_epi64(INT64_C(                  29), INT64_C(                  20),
+                            INT64_C(                  39), INT64_C(                  34),
+                            INT64_C(                  64), INT64_C(                  61),
+                            INT64_C(                  38), INT64_C(                  12)) },
+    { simde_mm512_set_epi64(INT64_C(           223119530), INT64_C(    6756085850930835),
+                            INT64_C(                2081), INT64_C(           131615574),
+                            INT64_C(               57355), INT64_C(   16068004831124210),
+                            INT64_C(          1762089251), INT64_C(       7002802202641)),
+      simde_mm512_set_epi64(INT64_C(                  36), INT64_C(                  11),
+                            INT64_C(                  52), INT64_C(                  37),
+                            INT64_C(                  48), INT64_C(                  10),
+                            INT64_C(                  33), INT64_C(                  21)) },
+    { simde_mm512_set_epi64(INT64_C(      58797522228190), INT64_C(-4772675909755159841),
+                            INT64_C(   22873835388017434), INT64_C(                   7),
+                            INT64_C(                   0), INT64_C(           458133112),
+                            INT64_C(          5884524408), INT64_C(     171785299931698)),
+      simde_mm512_set_epi64(INT64_C(                  18), INT64_C(                   0),
+                            INT64_C(                   9), INT64_C(                  61),
+                            INT64_C(                  64), INT64_C(                  35),
+                            INT64_C(                  31), INT64_C(                  16)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_lzcnt_epi64(test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_lzcnt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 2083746022413242487), INT64_C( 5488241235546037708),
+                            INT64_C( 5668288884643216186), INT64_C( 3991401852318114930),
+                            INT64_C(-6221052247418774454), INT64_C( 6795462707387860288),
+                            INT64_C( 2045994233701337491), INT64_C(-8907861308629247385)),
+      UINT8_C(151),
+      simde_mm512_set_epi64(INT64_C(             1359821), INT64_C(               48705),
+                            INT64_C(      50053048620950), INT64_C(  197585162321666197),
+                            INT64_C(       8166651758036), INT64_C(  138542565057249745),
+                            INT64_C(               12823), INT64_C(                3040)),
+      simde_mm512_set_epi64(INT64_C(                  43), INT64_C( 5488241235546037708),
+                            INT64_C( 5668288884643216186), INT64_C(                   6),
+                            INT64_C(-6221052247418774454), INT64_C(                   7),
+                            INT64_C(                  50), INT64_C(                  52)) },
+    { simde_mm512_set_epi64(INT64_C( 8226656851522286743), INT64_C( -156056693142667114),
+                            INT64_C(-1981636514381389738), INT64_C( 7830241243904177661),
+                            INT64_C( 1008461974496240757), INT64_C(  702197979934433905),
+                            INT64_C( 8213575477059318420), INT64_C(-3814975933535897734)),
+      UINT8_C(190),
+      simde_mm512_set_epi64(INT64_C(          6614425940), INT64_C(     139846758019945),
+                            INT64_C(       2081627854396), INT64_C(   56712739994374501),
+                            INT64_C(                6880), INT64_C(            25140636),
+                            INT64_C(              507786), INT64_C(                1847)),
+      simde_mm512_set_epi64(INT64_C(                  31), INT64_C( -156056693142667114),
+                            INT64_C(                  23), INT64_C(                   8),
+                            INT64_C(                  51), INT64_C(                  39),
+                            INT64_C(                  45), INT64_C(-3814975933535897734)) },
+    { simde_mm512_set_epi64(INT64_C(-8760735040154818285), INT64_C(-4497217965515428083),
+                            INT64_C( 4983475338817522836), INT64_C(-6919612003283611145),
+                            INT64_C( 4091180061056975094), INT64_C(  828768344886786009),
+                            INT64_C( 6830997771738315178), INT64_C( 6692495368294983335)),
+      UINT8_C(129),
+      simde_mm512_set_epi64(INT64_C(   20078985633211007), INT64_C(                   5),
+                            INT64_C(  222301357588876578), INT64_C(    6087740189312446),
+                            INT64_C(         13041801046), INT64_C(       3578007350510),
+                            INT64_C(           974330668), INT64_C(               61493)),
+      simde_mm512_set_epi64(INT64_C(                   9), INT64_C(-4497217965515428083),
+                            INT64_C( 4983475338817522836), INT64_C(-6919612003283611145),
+                            INT64_C( 4091180061056975094), INT64_C(  828768344886786009),
+                            INT64_C( 6830997771738315178), INT64_C(                  48)) },
+    { simde_mm512_set_epi64(INT64_C( 6537468662654616335), INT64_C(  683629150341258359),
+                            INT64_C( 6871776736171731618), INT64_C( 3523639877325796942),
+                            INT64_C( 9166183673282008231), INT64_C( 9007189145009612077),
+                            INT64_C( -425955740838507653), INT64_C(-4182101496686472419)),
+      UINT8_C( 73),
+      simde_mm512_set_epi64(INT64_C(           852751754), INT64_C(    2469974436573095),
+                            INT64_C(                6945), INT64_C(                4910),
+                            INT64_C(                 287), INT64_C(             5849258),
+                            INT64_C(             3809816), INT64_C(           600739863)),
+      simde_mm512_set_epi64(INT64_C( 6537468662654616335), INT64_C(                  12),
+                            INT64_C( 6871776736171731618), INT64_C( 3523639877325796942),
+                            INT64_C(                  55), INT64_C( 9007189145009612077),
+                            INT64_C( -425955740838507653), INT64_C(                  34)) },
+    { simde_mm512_set_epi64(INT64_C(-8741222181682887046), INT64_C(-4060171047084493359),
+                            INT64_C( 4532638392565073112), INT64_C( 6549419184984740476),
+                            INT64_C( -383304240123715967), INT64_C( 1901328032965113131),
+                            INT64_C(-7605991247862882666), INT64_C( 1749332497633065381)),
+      UINT8_C(118),
+      simde_mm512_set_epi64(INT64_C(      14141465087119), INT64_C(       1578775207760),
+                            INT64_C(           133968290), INT64_C(                   1),
+                            INT64_C(              723544), INT64_C(         70177094519),
+                            INT64_C(              357963), INT64_C(  175454143552342297)),
+      simde_mm512_set_epi64(INT64_C(-8741222181682887046), INT64_C(                  23),
+                            INT64_C(                  37), INT64_C(                  63),
+                            INT64_C( -383304240123715967), INT64_C(                  27),
+                            INT64_C(                  45), INT64_C( 1749332497633065381)) },
+    { simde_mm512_set_epi64(INT64_C(-6401020248748282933), INT64_C( 5963726191026927270),
+                            INT64_C( 2741753735180237713), INT64_C(-6886967998061700249),
+                            INT64_C(-6126667082589008642), INT64_C(-2599318769236145050),
+                            INT64_C( -859326464367603783), INT64_C(-2444221342523386541)),
+      UINT8_C( 92),
+      simde_mm512_set_epi64(INT64_C(                8515), INT64_C(                3073),
+                            INT64_C(   33674646327240352), INT64_C(             7026151),
+                            INT64_C(         56511282000), INT64_C( 1104498109944362396),
+                            INT64_C(            17273135), INT64_C(                  30)),
+      simde_mm512_set_epi64(INT64_C(-6401020248748282933), INT64_C(                  52),
+                            INT64_C( 2741753735180237713), INT64_C(                  41),
+                            INT64_C(                  28), INT64_C(                   4),
+                            INT64_C( -859326464367603783), INT64_C(-2444221342523386541)) },
+    { simde_mm512_set_epi64(INT64_C(-2560757302995457446), INT64_C( 2824975744221991034),
+                            INT64_C(-6034917447550971298), INT64_C(-5028349591105683043),
+                            INT64_C(-1406164283643869802), INT64_C(-3306642857554163452),
+                            INT64_C( 3618324970050805054), INT64_C( 1591082525463357296)),
+      UINT8_C( 14),
+      simde_mm512_set_epi64(INT64_C(       5273317968088), INT64_C(                  83),
+                            INT64_C(        222027385069), INT64_C(      80127058531825),
+                            INT64_C( 2590443384439802135), INT64_C(                5059),
+                            INT64_C(                  20), INT64_C(           277345235)),
+      simde_mm512_set_epi64(INT64_C(-2560757302995457446), INT64_C( 2824975744221991034),
+                            INT64_C(-6034917447550971298), INT64_C(-5028349591105683043),
+                            INT64_C(                   2), INT64_C(                  51),
+                            INT64_C(                  59), INT64_C( 1591082525463357296)) },
+    { simde_mm512_set_epi64(INT64_C( 4103423174448290836), INT64_C(-4271396223032999658),
+                            INT64_C(-7764453096965881387), INT64_C( 6338131133005771635),
+                            INT64_C( 7303741249692485667), INT64_C( 7625742672510890241),
+                            INT64_C(  -60442742971342140), INT64_C(-4969337955952047012)),
+      UINT8_C( 44),
+      simde_mm512_set_epi64(INT64_C( 8956434160899480994), INT64_C(                 684),
+                            INT64_C(             2634691), INT64_C(              927204),
+                            INT64_C(       7000988685641), INT64_C(               39001),
+                            INT64_C(    3043545369243616), INT64_C(              381075)),
+      simde_mm512_set_epi64(INT64_C( 4103423174448290836), INT64_C(-4271396223032999658),
+                            INT64_C(                  42), INT64_C( 6338131133005771635),
+                            INT64_C(                  21), INT64_C(                  48),
+                            INT64_C(  -60442742971342140), INT64_C(-4969337955952047012)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_lzcnt_epi64(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_lzcnt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C( 50),
+      simde_mm512_set_epi64(INT64_C(          3683586021), INT64_C(          3250976338),
+                            INT64_C(       9384372167127), INT64_C(                   0),
+                            INT64_C(         25485367695), INT64_C(              405124),
+                            INT64_C(                   3), INT64_C(                3424)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  20), INT64_C(                  64),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  62), INT64_C(                   0)) },
+    { UINT8_C( 69),
+      simde_mm512_set_epi64(INT64_C(         13463372488), INT64_C(     117786877074039),
+                            INT64_C(   66324982673900580), INT64_C(        986976210190),
+                            INT64_C(                  22), INT64_C(    5411212670632908),
+                            INT64_C(                 240), INT64_C(               21232)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  17),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  11),
+                            INT64_C(                   0), INT64_C(                  49)) },
+    { UINT8_C( 50),
+      simde_mm512_set_epi64(INT64_C(               41769), INT64_C(       3130542264166),
+                            INT64_C(                 367), INT64_C(     109370584728957),
+                            INT64_C(             6602453), INT64_C(                2109),
+                            INT64_C(  429629627804286450), INT64_C(               16453)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  55), INT64_C(                  17),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   5), INT64_C(                   0)) },
+    { UINT8_C(142),
+      simde_mm512_set_epi64(INT64_C(                1397), INT64_C(                 451),
+                            INT64_C(                  41), INT64_C(                   1),
+                            INT64_C(     156155909066040), INT64_C(  227863876498486713),
+                            INT64_C(              120027), INT64_C(       4591027314519)),
+      simde_mm512_set_epi64(INT64_C(                  53), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  16), INT64_C(                   6),
+                            INT64_C(                  47), INT64_C(                   0)) },
+    { UINT8_C(133),
+      simde_mm512_set_epi64(INT64_C(          1929004596), INT64_C(              113766),
+                            INT64_C(                   4), INT64_C(    1732108145686284),
+                            INT64_C(         98179918554), INT64_C(       7439712459871),
+                            INT64_C( 3929741467759046092), INT64_C(                 606)),
+      simde_mm512_set_epi64(INT64_C(                  33), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  21),
+                            INT64_C(                   0), INT64_C(                  54)) },
+    { UINT8_C(234),
+      simde_mm512_set_epi64(INT64_C(             1953954), INT64_C(                 103),
+                            INT64_C(              479301), INT64_C(  750202099953445008),
+                            INT64_C(  233146797799668511), INT64_C(             1381321),
+                            INT64_C(              883834), INT64_C(       3324299963420)),
+      simde_mm512_set_epi64(INT64_C(                  43), INT64_C(                  57),
+                            INT64_C(                  45), INT64_C(                   0),
+                            INT64_C(                   6), INT64_C(                   0),
+                            INT64_C(                  44), INT64_C(                   0)) },
+    { UINT8_C(233),
+      simde_mm512_set_epi64(INT64_C(   23918162162512262), INT64_C(                  10),
+                            INT64_C( 3555088283518612590), INT64_C(   97673309082911573),
+                            INT64_C(        716595072473), INT64_C(              102726),
+                            INT64_C(   42824422625674314), INT64_C(  145400003171013380)),
+      simde_mm512_set_epi64(INT64_C(                   9), INT64_C(                  60),
+                            INT64_C(                   2), INT64_C(                   0),
+                            INT64_C(                  24), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   6)) },
+    { UINT8_C(111),
+      simde_mm512_set_epi64(INT64_C(              377370), INT64_C(  657397395509917875),
+                            INT64_C(          1013527773), INT64_C(                   0),
+                            INT64_C(                 468), INT64_C(            39186934),
+                            INT64_C(                   5), INT64_C( 7319612133783515518)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   4),
+                            INT64_C(                  34), INT64_C(                   0),
+                            INT64_C(                  55), INT64_C(                  38),
+                            INT64_C(                  61), INT64_C(                   1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_lzcnt_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_AVX512CD_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_AVX512CD_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm512_broadcastmw_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_broadcastmb_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_conflict_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_conflict_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_conflict_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_conflict_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_conflict_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_conflict_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_lzcnt_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_lzcnt_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_lzcnt_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_lzcnt_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_lzcnt_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_lzcnt_epi64),
+#endif /* defined(SIMDE_AVX512CD_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
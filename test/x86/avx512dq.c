@@ -0,0 +1,4299 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX avx512dq
+#include <simde/x86/avx512dq.h>
+#include <test/x86/test-avx512.h>
+
+#if defined(SIMDE_AVX512DQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_kadd_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C(173), UINT8_C(118), UINT8_C( 35) },
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+    { UINT8_C(236), UINT8_C( 19), UINT8_C(255) },
+    { UINT8_C(207), UINT8_C(139), UINT8_C( 90) },
+    { UINT8_C(142), UINT8_C(  1), UINT8_C(143) },
+    { UINT8_C(255), UINT8_C(158), UINT8_C(157) },
+    { UINT8_C( 31), UINT8_C(255), UINT8_C( 30) },
+    { UINT8_C(184), UINT8_C(117), UINT8_C( 45) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_kadd_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kand_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C( 79), UINT8_C( 25), UINT8_C(  9) },
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+    { UINT8_C( 26), UINT8_C(229), UINT8_C(  0) },
+    { UINT8_C(189), UINT8_C( 17), UINT8_C( 17) },
+    { UINT8_C( 63), UINT8_C( 64), UINT8_C(  0) },
+    { UINT8_C(255), UINT8_C(245), UINT8_C(245) },
+    { UINT8_C( 90), UINT8_C(236), UINT8_C( 72) },
+    { UINT8_C(237), UINT8_C( 82), UINT8_C( 64) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_kand_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kandn_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C(246), UINT8_C(  9), UINT8_C(  9) },
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+    { UINT8_C( 94), UINT8_C(161), UINT8_C(161) },
+    { UINT8_C(185), UINT8_C(185), UINT8_C(  0) },
+    { UINT8_C(210), UINT8_C( 37), UINT8_C( 37) },
+    { UINT8_C(255), UINT8_C(236), UINT8_C(  0) },
+    { UINT8_C( 95), UINT8_C(217), UINT8_C(128) },
+    { UINT8_C( 38), UINT8_C( 18), UINT8_C( 16) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_kandn_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kor_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C( 16), UINT8_C( 38), UINT8_C( 54) },
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+    { UINT8_C(175), UINT8_C( 80), UINT8_C(255) },
+    { UINT8_C(227), UINT8_C(  3), UINT8_C(227) },
+    { UINT8_C( 69), UINT8_C(160), UINT8_C(229) },
+    { UINT8_C(255), UINT8_C(  1), UINT8_C(255) },
+    { UINT8_C(169), UINT8_C(206), UINT8_C(239) },
+    { UINT8_C( 93), UINT8_C(169), UINT8_C(253) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_kor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kxnor_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C( 50), UINT8_C( 28), UINT8_C(209) },
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C(255) },
+    { UINT8_C(143), UINT8_C(112), UINT8_C(  0) },
+    { UINT8_C( 94), UINT8_C( 74), UINT8_C(235) },
+    { UINT8_C( 47), UINT8_C(  0), UINT8_C(208) },
+    { UINT8_C(255), UINT8_C(117), UINT8_C(117) },
+    { UINT8_C(181), UINT8_C( 68), UINT8_C( 14) },
+    { UINT8_C(182), UINT8_C(191), UINT8_C(246) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_kxnor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kxor_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C( 18), UINT8_C( 12), UINT8_C( 30) },
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+    { UINT8_C( 28), UINT8_C(227), UINT8_C(255) },
+    { UINT8_C( 59), UINT8_C( 51), UINT8_C(  8) },
+    { UINT8_C(174), UINT8_C(  1), UINT8_C(175) },
+    { UINT8_C(255), UINT8_C(212), UINT8_C( 43) },
+    { UINT8_C( 89), UINT8_C( 47), UINT8_C(118) },
+    { UINT8_C( 77), UINT8_C(151), UINT8_C(218) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_kxor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_knot_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C(208), UINT8_C( 47) },
+    { UINT8_C(  0), UINT8_C(255) },
+    { UINT8_C(  3), UINT8_C(252) },
+    { UINT8_C( 84), UINT8_C(171) },
+    { UINT8_C( 25), UINT8_C(230) },
+    { UINT8_C(255), UINT8_C(  0) },
+    { UINT8_C(225), UINT8_C( 30) },
+    { UINT8_C(170), UINT8_C( 85) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_knot_mask8(test_vec[i].a);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kortestz_mask8_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT8_C(141), UINT8_C(228), 0 },
+    { UINT8_C(  0), UINT8_C(  0), 1 },
+    { UINT8_C(106), UINT8_C(149), 0 },
+    { UINT8_C( 55), UINT8_C( 23), 0 },
+    { UINT8_C( 36), UINT8_C( 81), 0 },
+    { UINT8_C(255), UINT8_C(145), 0 },
+    { UINT8_C(126), UINT8_C( 62), 0 },
+    { UINT8_C( 82), UINT8_C(156), 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char r = simde_kortestz_mask8_u8(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kortestc_mask8_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT8_C(143), UINT8_C(102), 0 },
+    { UINT8_C(  0), UINT8_C(  0), 0 },
+    { UINT8_C( 33), UINT8_C(222), 1 },
+    { UINT8_C( 63), UINT8_C( 52), 0 },
+    { UINT8_C(103), UINT8_C(144), 0 },
+    { UINT8_C(255), UINT8_C(230), 1 },
+    { UINT8_C(249), UINT8_C(186), 0 },
+    { UINT8_C( 67), UINT8_C(113), 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char r = simde_kortestc_mask8_u8(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kortest_mask8_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    unsigned char all_ones;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT8_C(247), UINT8_C(  0), 0, 0 },
+    { UINT8_C(  0), UINT8_C(  0), 0, 1 },
+    { UINT8_C(253), UINT8_C(  2), 1, 0 },
+    { UINT8_C( 99), UINT8_C(  1), 0, 0 },
+    { UINT8_C(  4), UINT8_C(233), 0, 0 },
+    { UINT8_C(255), UINT8_C(238), 1, 0 },
+    { UINT8_C(157), UINT8_C(  4), 0, 0 },
+    { UINT8_C( 50), UINT8_C(168), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char all_ones;
+    unsigned char r = simde_kortest_mask8_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+    munit_assert_uint8(all_ones, ==, test_vec[i].all_ones);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_ktestz_mask8_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT8_C( 87), UINT8_C(173), 0 },
+    { UINT8_C(  0), UINT8_C(  0), 1 },
+    { UINT8_C(206), UINT8_C( 49), 1 },
+    { UINT8_C( 27), UINT8_C( 24), 0 },
+    { UINT8_C( 85), UINT8_C(162), 1 },
+    { UINT8_C(255), UINT8_C( 57), 0 },
+    { UINT8_C(213), UINT8_C( 74), 0 },
+    { UINT8_C(252), UINT8_C(101), 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char r = simde_ktestz_mask8_u8(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_ktestc_mask8_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT8_C(195), UINT8_C(228), 0 },
+    { UINT8_C(  0), UINT8_C(  0), 1 },
+    { UINT8_C(113), UINT8_C(142), 0 },
+    { UINT8_C(125), UINT8_C( 68), 1 },
+    { UINT8_C(239), UINT8_C(  0), 1 },
+    { UINT8_C(255), UINT8_C( 57), 1 },
+    { UINT8_C( 81), UINT8_C(117), 0 },
+    { UINT8_C( 83), UINT8_C( 91), 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char r = simde_ktestc_mask8_u8(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_ktest_mask8_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 b;
+    unsigned char and_not;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT8_C(179), UINT8_C(132), 0, 0 },
+    { UINT8_C(  0), UINT8_C(  0), 1, 1 },
+    { UINT8_C(246), UINT8_C(  9), 0, 1 },
+    { UINT8_C(114), UINT8_C( 80), 1, 0 },
+    { UINT8_C(123), UINT8_C(  0), 1, 1 },
+    { UINT8_C(255), UINT8_C( 76), 1, 0 },
+    { UINT8_C(  2), UINT8_C(182), 0, 0 },
+    { UINT8_C( 39), UINT8_C(143), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char and_not;
+    unsigned char r = simde_ktest_mask8_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+    munit_assert_uint8(and_not, ==, test_vec[i].and_not);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kshiftli_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 r[4];
+  } test_vec[8] = {
+    { UINT8_C(  6), { UINT8_C( 12), UINT8_C( 48), UINT8_C(  0), UINT8_C(  0) } },
+    { UINT8_C(  0), { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+    { UINT8_C(  6), { UINT8_C( 12), UINT8_C( 48), UINT8_C(  0), UINT8_C(  0) } },
+    { UINT8_C( 53), { UINT8_C(106), UINT8_C(168), UINT8_C(128), UINT8_C(  0) } },
+    { UINT8_C(103), { UINT8_C(206), UINT8_C( 56), UINT8_C(128), UINT8_C(  0) } },
+    { UINT8_C(255), { UINT8_C(254), UINT8_C(248), UINT8_C(128), UINT8_C(  0) } },
+    { UINT8_C(107), { UINT8_C(214), UINT8_C( 88), UINT8_C(128), UINT8_C(  0) } },
+    { UINT8_C(192), { UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_mmask8(simde_kshiftli_mask8(test_vec[i].a, 1), ==, test_vec[i].r[0]);
+    simde_assert_mmask8(simde_kshiftli_mask8(test_vec[i].a, 3), ==, test_vec[i].r[1]);
+    simde_assert_mmask8(simde_kshiftli_mask8(test_vec[i].a, 7), ==, test_vec[i].r[2]);
+    simde_assert_mmask8(simde_kshiftli_mask8(test_vec[i].a, 9), ==, test_vec[i].r[3]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kshiftri_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    simde__mmask8 r[4];
+  } test_vec[8] = {
+    { UINT8_C(252), { UINT8_C(126), UINT8_C( 31), UINT8_C(  1), UINT8_C(  0) } },
+    { UINT8_C(  0), { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+    { UINT8_C( 87), { UINT8_C( 43), UINT8_C( 10), UINT8_C(  0), UINT8_C(  0) } },
+    { UINT8_C(134), { UINT8_C( 67), UINT8_C( 16), UINT8_C(  1), UINT8_C(  0) } },
+    { UINT8_C(255), { UINT8_C(127), UINT8_C( 31), UINT8_C(  1), UINT8_C(  0) } },
+    { UINT8_C(255), { UINT8_C(127), UINT8_C( 31), UINT8_C(  1), UINT8_C(  0) } },
+    { UINT8_C(178), { UINT8_C( 89), UINT8_C( 22), UINT8_C(  1), UINT8_C(  0) } },
+    { UINT8_C(214), { UINT8_C(107), UINT8_C( 26), UINT8_C(  1), UINT8_C(  0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_mmask8(simde_kshiftri_mask8(test_vec[i].a, 1), ==, test_vec[i].r[0]);
+    simde_assert_mmask8(simde_kshiftri_mask8(test_vec[i].a, 3), ==, test_vec[i].r[1]);
+    simde_assert_mmask8(simde_kshiftri_mask8(test_vec[i].a, 7), ==, test_vec[i].r[2]);
+    simde_assert_mmask8(simde_kshiftri_mask8(test_vec[i].a, 9), ==, test_vec[i].r[3]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_cvtmask8_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+    unsigned int r;
+  } test_vec[8] = {
+    { UINT8_C( 98), UINT32_C(        98) },
+    { UINT8_C(  0), UINT32_C(         0) },
+    { UINT8_C( 64), UINT32_C(        64) },
+    { UINT8_C( 45), UINT32_C(        45) },
+    { UINT8_C(225), UINT32_C(       225) },
+    { UINT8_C(255), UINT32_C(       255) },
+    { UINT8_C(131), UINT32_C(       131) },
+    { UINT8_C(200), UINT32_C(       200) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned int r = simde_cvtmask8_u32(test_vec[i].a);
+    munit_assert_uint(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_cvtu32_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    unsigned int a;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT32_C(2352698227), UINT8_C(115) },
+    { UINT32_C(2746456341), UINT8_C( 21) },
+    { UINT32_C( 670964583), UINT8_C(103) },
+    { UINT32_C(1853480593), UINT8_C(145) },
+    { UINT32_C(1608034668), UINT8_C(108) },
+    { UINT32_C(4229743422), UINT8_C( 62) },
+    { UINT32_C(3636720952), UINT8_C( 56) },
+    { UINT32_C(3901504722), UINT8_C(210) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_cvtu32_mask8(test_vec[i].a);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_load_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+  } test_vec[8] = {
+    { UINT8_C( 43) },
+    { UINT8_C(  0) },
+    { UINT8_C(231) },
+    { UINT8_C( 42) },
+    { UINT8_C(210) },
+    { UINT8_C(255) },
+    { UINT8_C( 58) },
+    { UINT8_C(155) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 a = test_vec[i].a;
+    simde__mmask8 r = simde_load_mask8(&a);
+    simde_assert_mmask8(r, ==, test_vec[i].a);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_store_mask8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 a;
+  } test_vec[8] = {
+    { UINT8_C(133) },
+    { UINT8_C(  0) },
+    { UINT8_C(115) },
+    { UINT8_C(196) },
+    { UINT8_C( 49) },
+    { UINT8_C(255) },
+    { UINT8_C(237) },
+    { UINT8_C(224) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r;
+    simde_store_mask8(&r, test_vec[i].a);
+    simde_assert_mmask8(r, ==, test_vec[i].a);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_kadd_mask16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { UINT16_C(17692), UINT16_C(17046), UINT16_C(34738) },
+    { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+    { UINT16_C(11720), UINT16_C(53815), UINT16_C(65535) },
+    { UINT16_C( 2456), UINT16_C( 2192), UINT16_C( 4648) },
+    { UINT16_C(56993), UINT16_C(  282), UINT16_C(57275) },
+    { UINT16_C(65535), UINT16_C(32901), UINT16_C(32900) },
+    { UINT16_C(64196), UINT16_C(64049), UINT16_C(62709) },
+    { UINT16_C(47493), UINT16_C(60342), UINT16_C(42299) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_kadd_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_mmask16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_ktestz_mask16_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT16_C(24545), UINT16_C( 2334), 0 },
+    { UINT16_C(    0), UINT16_C(    0), 1 },
+    { UINT16_C(53181), UINT16_C(12354), 1 },
+    { UINT16_C(37916), UINT16_C(36872), 0 },
+    { UINT16_C(20555), UINT16_C(43412), 1 },
+    { UINT16_C(65535), UINT16_C(20142), 0 },
+    { UINT16_C(29619), UINT16_C(52628), 0 },
+    { UINT16_C(23311), UINT16_C(21113), 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char r = simde_ktestz_mask16_u8(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_ktestc_mask16_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT16_C(10397), UINT16_C( 3468), 0 },
+    { UINT16_C(    0), UINT16_C(    0), 1 },
+    { UINT16_C(40643), UINT16_C(24892), 0 },
+    { UINT16_C(22008), UINT16_C( 4536), 1 },
+    { UINT16_C( 9182), UINT16_C(19489), 0 },
+    { UINT16_C(65535), UINT16_C(49736), 1 },
+    { UINT16_C(21964), UINT16_C(38503), 0 },
+    { UINT16_C(39563), UINT16_C(33150), 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char r = simde_ktestc_mask16_u8(test_vec[i].a, test_vec[i].b);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_ktest_mask16_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 a;
+    simde__mmask16 b;
+    unsigned char and_not;
+    unsigned char r;
+  } test_vec[8] = {
+    { UINT16_C(40444), UINT16_C(42439), 0, 0 },
+    { UINT16_C(    0), UINT16_C(    0), 1, 1 },
+    { UINT16_C(30915), UINT16_C(34620), 0, 1 },
+    { UINT16_C(61587), UINT16_C(40961), 1, 0 },
+    { UINT16_C(61295), UINT16_C(  144), 0, 1 },
+    { UINT16_C(65535), UINT16_C(46294), 1, 0 },
+    { UINT16_C(15935), UINT16_C(43907), 0, 0 },
+    { UINT16_C(44052), UINT16_C( 9804), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    unsigned char and_not;
+    unsigned char r = simde_ktest_mask16_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    munit_assert_uint8(r, ==, test_vec[i].r);
+    munit_assert_uint8(and_not, ==, test_vec[i].and_not);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_and_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C( -643139282), INT32_C(  452227306), INT32_C(-1697455804), INT32_C( -689376561),
+                            INT32_C(-1760551474), INT32_C( 1316748153), INT32_C(  753604320), INT32_C(-1580905748),
+                            INT32_C(  811533580), INT32_C(  915262580), INT32_C( 2064109201), INT32_C( -443522762),
+                            INT32_C( 1693511353), INT32_C(   40788086), INT32_C( -602179666), INT32_C(  200494509)),
+      simde_mm512_set_epi32(INT32_C( -982101895), INT32_C(  -60996609), INT32_C(-1188980248), INT32_C( 1062866975),
+                            INT32_C(  236962971), INT32_C( -700743522), INT32_C( 1438415352), INT32_C(-1381559811),
+                            INT32_C(  783123783), INT32_C( 1456938755), INT32_C(  150238463), INT32_C(-1192711403),
+                            INT32_C(-1886475821), INT32_C( 1229098382), INT32_C( -576041339), INT32_C(-1328094581)),
+      simde_mm512_set_epi32(INT32_C(-1054715864), INT32_C(  408174826), INT32_C(-1744797376), INT32_C(  373821455),
+                            INT32_C(  101713034), INT32_C( 1178304536), INT32_C(   78123232), INT32_C(-1585118996),
+                            INT32_C(  537724164), INT32_C(  377818112), INT32_C(  134497425), INT32_C(-1602215660),
+                            INT32_C(   75540625), INT32_C(    4325382), INT32_C( -603306364), INT32_C(   13779081)) },
+    { simde_mm512_set_epi32(INT32_C(-2136071904), INT32_C(-2107280930), INT32_C(  253382869), INT32_C(-1677024742),
+                            INT32_C(-1128555650), INT32_C(-1708025105), INT32_C( 1414205127), INT32_C( 1828741485),
+                            INT32_C(-1829032497), INT32_C( -928081383), INT32_C(  -61457999), INT32_C( 1802586959),
+                            INT32_C(-1557210433), INT32_C( 1434828149), INT32_C(  893189176), INT32_C( 2113595064)),
+      simde_mm512_set_epi32(INT32_C( -860327903), INT32_C(  882440181), INT32_C( 1819373086), INT32_C( 1827504439),
+                            INT32_C( 1536331308), INT32_C(-1736604291), INT32_C(  914479743), INT32_C( 1771243565),
+                            INT32_C( 1829258434), INT32_C( 1776773439), INT32_C( -595151917), INT32_C( -843188717),
+                            INT32_C(  218726888), INT32_C(-1040548892), INT32_C(  236899586), INT32_C( -310637379)),
+      simde_mm512_set_epi32(INT32_C(-2136465376), INT32_C(      29140), INT32_C(  202391572), INT32_C(  201883666),
+                            INT32_C(  412256812), INT32_C(-1741586323), INT32_C(  335612487), INT32_C( 1761607725),
+                            INT32_C(     525506), INT32_C( 1218840601), INT32_C( -603573871), INT32_C( 1227964931),
+                            INT32_C(   17334440), INT32_C( 1098922340), INT32_C(   68996096), INT32_C( 1836582072)) },
+    { simde_mm512_set_epi32(INT32_C(-1077149697), INT32_C(  213696288), INT32_C( 1504091041), INT32_C(  650979763),
+                            INT32_C(-1908819939), INT32_C( -417628919), INT32_C( 2059898803), INT32_C( 1946140662),
+                            INT32_C(  905119152), INT32_C(-1057189294), INT32_C( -953463754), INT32_C( -790921235),
+                            INT32_C(-1329950236), INT32_C( 2137129196), INT32_C(-1626885510), INT32_C( 2022087514)),
+      simde_mm512_set_epi32(INT32_C( -417696409), INT32_C( -306657675), INT32_C( 1863267348), INT32_C( -998466547),
+                            INT32_C(-1137026239), INT32_C(-1706840110), INT32_C(  214470315), INT32_C(  798676155),
+                            INT32_C(  396946568), INT32_C( -522581076), INT32_C(  850989385), INT32_C(-1810388295),
+                            INT32_C( 1462375917), INT32_C( 1219755458), INT32_C(  756867720), INT32_C( 1456606814)),
+      simde_mm512_set_epi32(INT32_C(-1492486809), INT32_C(  213419552), INT32_C( 1225134080), INT32_C(   72091649),
+                            INT32_C(-1942480895), INT32_C(-2113721088), INT32_C(  146837155), INT32_C(  597333170),
+                            INT32_C(  362808448), INT32_C(-1059585536), INT32_C(   36241408), INT32_C(-1877792087),
+                            INT32_C(  271192548), INT32_C( 1210187968), INT32_C(  218407432), INT32_C( 1350699610)) },
+    { simde_mm512_set_epi32(INT32_C( 1176600336), INT32_C( 1320353830), INT32_C(-1207314546), INT32_C(  707762960),
+                            INT32_C(  775573235), INT32_C( 1232027922), INT32_C( -206347287), INT32_C(  942234150),
+                            INT32_C( 1325029422), INT32_C( -534126631), INT32_C( 1468969518), INT32_C(  514171743),
+                            INT32_C( -478837891), INT32_C(-1472144916), INT32_C( 1667714296), INT32_C( 1106152121)),
+      simde_mm512_set_epi32(INT32_C( 1167779544), INT32_C(  787528517), INT32_C(-1874083107), INT32_C(-1595160297),
+                            INT32_C( 1542202793), INT32_C(-2035650616), INT32_C( 1007306157), INT32_C( 1828812259),
+                            INT32_C( -318111509), INT32_C(  808145606), INT32_C(-1076877509), INT32_C(  279368879),
+                            INT32_C( 1245373083), INT32_C(  720423801), INT32_C(-1991789058), INT32_C(  -39407706)),
+      simde_mm512_set_epi32(INT32_C( 1140876816), INT32_C(  246415364), INT32_C(-1878408564), INT32_C(  539724048),
+                            INT32_C(  170394785), INT32_C(    2769152), INT32_C(  805454249), INT32_C(  671174690),
+                            INT32_C( 1275723818), INT32_C(  539579072), INT32_C(  394273322), INT32_C(  279216143),
+                            INT32_C( 1110475289), INT32_C(  675334504), INT32_C(   21431544), INT32_C( 1101433504)) },
+    { simde_mm512_set_epi32(INT32_C( -175412641), INT32_C(-1669829207), INT32_C( 1459836715), INT32_C(  -75474339),
+                            INT32_C( 1704267013), INT32_C( 2028997070), INT32_C(-1725278956), INT32_C(  -85453911),
+                            INT32_C(-1280330124), INT32_C( -765201407), INT32_C( 1413158076), INT32_C( 2044862398),
+                            INT32_C( 1896920870), INT32_C(  841321957), INT32_C( -655160554), INT32_C( 1661807475)),
+      simde_mm512_set_epi32(INT32_C(  681697849), INT32_C(  864152880), INT32_C(  561206663), INT32_C(  411498334),
+                            INT32_C( -881538512), INT32_C(-1277785780), INT32_C(  370568310), INT32_C(-1387953777),
+                            INT32_C( 1218051857), INT32_C(-1023961501), INT32_C( 1305091415), INT32_C(  -16518784),
+                            INT32_C( 1357560946), INT32_C(-2015605220), INT32_C(-1472759490), INT32_C(-1635068110)),
+      simde_mm512_set_epi32(INT32_C(  545350169), INT32_C(  268463392), INT32_C(   16995587), INT32_C(  411062876),
+                            INT32_C( 1091831808), INT32_C(  818940236), INT32_C(  268583956), INT32_C(-1472200311),
+                            INT32_C(    9025040), INT32_C(-1033661439), INT32_C( 1141511188), INT32_C( 2030178688),
+                            INT32_C( 1342223394), INT32_C(   33819652), INT32_C(-2009921258), INT32_C(   34079538)) },
+    { simde_mm512_set_epi32(INT32_C( -259512978), INT32_C( 1907784004), INT32_C(-1328006956), INT32_C( -195667787),
+                            INT32_C( 1801845352), INT32_C( -938295179), INT32_C( 1336382549), INT32_C(  763135994),
+                            INT32_C(  708720192), INT32_C( 1542467110), INT32_C( -117637098), INT32_C(  890946529),
+                            INT32_C(-1094424435), INT32_C(  901220143), INT32_C(  122433974), INT32_C( -638606614)),
+      simde_mm512_set_epi32(INT32_C(-1756633785), INT32_C( 1342506162), INT32_C( -508113857), INT32_C( -829794532),
+                            INT32_C( 1001785887), INT32_C( 1682522906), INT32_C( -119865526), INT32_C(-1209940974),
+                            INT32_C(-1090372257), INT32_C( 1908674316), INT32_C(-1696659652), INT32_C(-1478340846),
+                            INT32_C( 2133877581), INT32_C(  597374655), INT32_C(-1261322423), INT32_C(-2037398346)),
+      simde_mm512_set_epi32(INT32_C(-1878514362), INT32_C( 1342439424), INT32_C(-1601173484), INT32_C(-1006481388),
+                            INT32_C(  723782152), INT32_C( 1073758224), INT32_C( 1216517184), INT32_C(  627082258),
+                            INT32_C(  704787520), INT32_C( 1371540996), INT32_C(-1730346988), INT32_C(  620905216),
+                            INT32_C( 1040211981), INT32_C(  563283503), INT32_C(   71315712), INT32_C(-2138079070)) },
+    { simde_mm512_set_epi32(INT32_C( 2092421280), INT32_C( -374061356), INT32_C( 1122533290), INT32_C( -340156203),
+                            INT32_C(-1478127128), INT32_C( 1518602503), INT32_C(  276674928), INT32_C( -165755317),
+                            INT32_C(-1420224600), INT32_C(  521122478), INT32_C( -166405056), INT32_C(  936496375),
+                            INT32_C( 2025093511), INT32_C(-2058124225), INT32_C( 2022062013), INT32_C(-1157340613)),
+      simde_mm512_set_epi32(INT32_C(  727294224), INT32_C(  117313698), INT32_C(  -66038934), INT32_C(  959725469),
+                            INT32_C( 1078464897), INT32_C( -179365013), INT32_C(-1813516132), INT32_C( 1989762512),
+                            INT32_C(-1664691314), INT32_C(-1152531561), INT32_C(  493794668), INT32_C(-1006711475),
+                            INT32_C(  388507969), INT32_C( 2002506031), INT32_C(-1816915627), INT32_C( 2065570649)),
+      simde_mm512_set_epi32(INT32_C(  672235520), INT32_C(   11796608), INT32_C( 1073763114), INT32_C(  691019925),
+                            INT32_C(    4198784), INT32_C( 1342441731), INT32_C(  275099664), INT32_C( 1981301824),
+                            INT32_C(-2009066616), INT32_C(  453870214), INT32_C(  335844416), INT32_C(   64015429),
+                            INT32_C(  270543105), INT32_C(   89358383), INT32_C(  277090581), INT32_C(  990118425)) },
+    { simde_mm512_set_epi32(INT32_C( 1204796884), INT32_C( 1147590074), INT32_C(-1168516161), INT32_C(  562994125),
+                            INT32_C(  553887471), INT32_C( 1870383641), INT32_C(   23334141), INT32_C( 1585315929),
+                            INT32_C(-1138820172), INT32_C( -795470850), INT32_C(-1441140920), INT32_C( -569780908),
+                            INT32_C( 1211071351), INT32_C( -206295093), INT32_C(-1302470581), INT32_C( 1399161859)),
+      simde_mm512_set_epi32(INT32_C( 1061044925), INT32_C(-1289916956), INT32_C(-1794350731), INT32_C(-1099098995),
+                            INT32_C(-1580376810), INT32_C( 1818653225), INT32_C( 1757584418), INT32_C( -420707926),
+                            INT32_C(-1664951998), INT32_C( -659776494), INT32_C( 1039435359), INT32_C(  101636577),
+                            INT32_C(  492295946), INT32_C(-1100206404), INT32_C(  259096810), INT32_C( 1120810641)),
+      simde_mm512_set_epi32(INT32_C(  118358164), INT32_C(     279968), INT32_C(-1878507211), INT32_C(  537661581),
+                            INT32_C(  553714694), INT32_C( 1818378761), INT32_C(    4197408), INT32_C( 1181483016),
+                            INT32_C(-1677534976), INT32_C( -796651502), INT32_C(  672171592), INT32_C(  101241152),
+                            INT32_C(  134697730), INT32_C(-1306251640), INT32_C(   38895690), INT32_C( 1111753729)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_and_ps(simde_mm512_castsi512_ps(test_vec[i].a), simde_mm512_castsi512_ps(test_vec[i].b));
+    simde_assert_m512i_equal(simde_mm512_castps_si512(r), test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_and_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C( -927384064), INT32_C( 1217975076), INT32_C(-1725122996), INT32_C(  -34096745),
+                            INT32_C(-2093325382), INT32_C(-1859046337), INT32_C( 1949737002), INT32_C(-1222712265),
+                            INT32_C(  921695998), INT32_C( 1111656614), INT32_C( 2142195024), INT32_C(-1204148630),
+                            INT32_C( 1754460751), INT32_C(  120915107), INT32_C(-1192730098), INT32_C(  -18698689)),
+      simde_mm512_set_epi32(INT32_C( -697666380), INT32_C(  956107164), INT32_C( 1396051986), INT32_C( -572709038),
+                            INT32_C( -368663452), INT32_C(  906982974), INT32_C( -204879105), INT32_C(-1339760514),
+                            INT32_C(  142435075), INT32_C(-1820731503), INT32_C(-1722469897), INT32_C( -287550859),
+                            INT32_C(-2138400139), INT32_C(-1112821675), INT32_C( 1683828174), INT32_C(  593341314)),
+      simde_mm512_set_epi32(INT32_C(-1071107072), INT32_C(  144179460), INT32_C(  287576064), INT32_C( -573234926),
+                            INT32_C(-2113789920), INT32_C(  268514366), INT32_C( 1879081002), INT32_C(-1341857738),
+                            INT32_C(    7168514), INT32_C(   37781632), INT32_C(  419758416), INT32_C(-1474821536),
+                            INT32_C(    8557125), INT32_C(   86048769), INT32_C(  541597710), INT32_C(  574663170)) },
+    { simde_mm512_set_epi32(INT32_C(-1190652810), INT32_C(  898161031), INT32_C(-1730113454), INT32_C( -444253121),
+                            INT32_C( 2084409410), INT32_C(-2093827319), INT32_C( 1490456565), INT32_C(  756266017),
+                            INT32_C(-1538804544), INT32_C( 1997779461), INT32_C( -186932261), INT32_C(-2072911676),
+                            INT32_C(    2436908), INT32_C(  850661734), INT32_C(-1923835978), INT32_C( -404548465)),
+      simde_mm512_set_epi32(INT32_C( 1090722759), INT32_C( 1599454394), INT32_C( 1267016334), INT32_C( -407797255),
+                            INT32_C( -118803964), INT32_C( 2075906022), INT32_C( 1922825706), INT32_C( 1400239819),
+                            INT32_C( 1772149792), INT32_C(-1393328974), INT32_C(-1379837054), INT32_C( 1966294267),
+                            INT32_C(  557730295), INT32_C( 1439280743), INT32_C(   70557352), INT32_C(  856508916)),
+      simde_mm512_set_epi32(INT32_C(   16781382), INT32_C(  352360578), INT32_C(  142606338), INT32_C( -444530631),
+                            INT32_C( 2015956992), INT32_C(   53644032), INT32_C( 1351781856), INT32_C(   17937409),
+                            INT32_C(  536908800), INT32_C(  605237248), INT32_C(-1530854526), INT32_C(   70336704),
+                            INT32_C(    2361636), INT32_C(  276824166), INT32_C(   68458144), INT32_C(  587268228)) },
+    { simde_mm512_set_epi32(INT32_C( 1773993562), INT32_C( -338749230), INT32_C( -944646287), INT32_C(  280508413),
+                            INT32_C(    6072683), INT32_C(  408232827), INT32_C( 1000906737), INT32_C(  896966842),
+                            INT32_C(-1158973434), INT32_C( -979444480), INT32_C(  484264281), INT32_C(  363699191),
+                            INT32_C( -682721014), INT32_C(-1685953679), INT32_C(  765747691), INT32_C( 1100314947)),
+      simde_mm512_set_epi32(INT32_C( 1439390184), INT32_C(-1688765970), INT32_C( 1034668201), INT32_C( -303206608),
+                            INT32_C( -240345815), INT32_C(  253578989), INT32_C(-1518263542), INT32_C( -621858168),
+                            INT32_C(   68731457), INT32_C(  -92617212), INT32_C(-1256757340), INT32_C( 1989635737),
+                            INT32_C( 1838008169), INT32_C(-1289220281), INT32_C( 1867633132), INT32_C(-1442647453)),
+      simde_mm512_set_epi32(INT32_C( 1099454536), INT32_C(-1958274878), INT32_C(   94486561), INT32_C(   11020080),
+                            INT32_C(     821545), INT32_C(  135594601), INT32_C(  562037504), INT32_C(  275128456),
+                            INT32_C(     540672), INT32_C(-1071987712), INT32_C(  336937216), INT32_C(  344263313),
+                            INT32_C( 1158447368), INT32_C(-1828715711), INT32_C(  754991592), INT32_C(      28739)) },
+    { simde_mm512_set_epi32(INT32_C( 1868453992), INT32_C(  159092306), INT32_C( -677710902), INT32_C( 1000510840),
+                            INT32_C(-1096918642), INT32_C(-1075164499), INT32_C( 1649287681), INT32_C(-1770971817),
+                            INT32_C( 1759503925), INT32_C( 2026143656), INT32_C( 1608458855), INT32_C( 1732185394),
+                            INT32_C(-1552783737), INT32_C( -613704956), INT32_C( 1923434259), INT32_C(-1447531363)),
+      simde_mm512_set_epi32(INT32_C(-1468277084), INT32_C( -645714522), INT32_C(-1275761090), INT32_C(-2084280137),
+                            INT32_C(-1239115140), INT32_C(  963006805), INT32_C(  292022929), INT32_C( 1741251740),
+                            INT32_C( -754621479), INT32_C( 1105804961), INT32_C(-1153243982), INT32_C(-1160594149),
+                            INT32_C(  799733737), INT32_C( -398481643), INT32_C( 1525683060), INT32_C(-1378046514)),
+      simde_mm512_set_epi32(INT32_C(  677009440), INT32_C(  151194626), INT32_C(-1819254262), INT32_C(   58720304),
+                            INT32_C(-1241245684), INT32_C(  962740229), INT32_C(    4596225), INT32_C(  104924180),
+                            INT32_C( 1074094609), INT32_C( 1086340768), INT32_C(  457318434), INT32_C(  571608338),
+                            INT32_C(  589457025), INT32_C( -936672508), INT32_C( 1386218256), INT32_C(-1449644916)) },
+    { simde_mm512_set_epi32(INT32_C(  475289935), INT32_C(  309185764), INT32_C( 1234060941), INT32_C(-1151863869),
+                            INT32_C(-1597983751), INT32_C(-1631784091), INT32_C(  510772902), INT32_C( 2097171708),
+                            INT32_C(  493940074), INT32_C( -895313078), INT32_C( 2100449563), INT32_C(  865136597),
+                            INT32_C( 1507964546), INT32_C( -506735047), INT32_C( -466144896), INT32_C(-1850375555)),
+      simde_mm512_set_epi32(INT32_C(   32132210), INT32_C(-1751324689), INT32_C(-1057896394), INT32_C( -685681466),
+                            INT32_C( -461735891), INT32_C(-1767843657), INT32_C(-2005920783), INT32_C(-1062124163),
+                            INT32_C(-1775727413), INT32_C( 1126869609), INT32_C(  277744522), INT32_C(-1336071055),
+                            INT32_C( 1742610316), INT32_C( -744609695), INT32_C(  381295929), INT32_C( -228807043)),
+      simde_mm512_set_epi32(INT32_C(    4212802), INT32_C(  302826724), INT32_C( 1082146820), INT32_C(-1828630334),
+                            INT32_C(-1606406103), INT32_C(-1767845851), INT32_C(  141558432), INT32_C( 1073759356),
+                            INT32_C(  337677386), INT32_C( 1109559880), INT32_C(  268566794), INT32_C(  806366289),
+                            INT32_C( 1103107712), INT32_C(-1047920607), INT32_C(   70390016), INT32_C(-1877704067)) },
+    { simde_mm512_set_epi32(INT32_C(-2000338852), INT32_C(  319591515), INT32_C(-1291148647), INT32_C(  901932115),
+                            INT32_C( 1820555627), INT32_C( -376097931), INT32_C( 1769364703), INT32_C(   26915409),
+                            INT32_C(-1384165660), INT32_C(  -12315591), INT32_C(  295430499), INT32_C(  933657359),
+                            INT32_C(  254171282), INT32_C( -735456661), INT32_C( -443759533), INT32_C(-2101885472)),
+      simde_mm512_set_epi32(INT32_C(-1038806538), INT32_C(  470858670), INT32_C( -486705808), INT32_C(-1494962574),
+                            INT32_C(  619063768), INT32_C(-1761929085), INT32_C( -571366399), INT32_C(  156236534),
+                            INT32_C(-1194918994), INT32_C(   83151712), INT32_C(  888774134), INT32_C( 1687806177),
+                            INT32_C( -167024071), INT32_C(  792310404), INT32_C(-1610831184), INT32_C(  232979379)),
+      simde_mm512_set_epi32(INT32_C(-2147155884), INT32_C(  268472330), INT32_C(-1576525808), INT32_C(  616571986),
+                            INT32_C(  612510024), INT32_C(-2137976831), INT32_C( 1232077825), INT32_C(   17478224),
+                            INT32_C(-1471788380), INT32_C(   71565344), INT32_C(  278497634), INT32_C(  612392961),
+                            INT32_C(  100812816), INT32_C(   69833216), INT32_C(-2054389744), INT32_C(   10666400)) },
+    { simde_mm512_set_epi32(INT32_C(  456615529), INT32_C( 1466468534), INT32_C(  482252461), INT32_C( 1437145602),
+                            INT32_C(  419264010), INT32_C( -583588020), INT32_C( -192774909), INT32_C( 1139369157),
+                            INT32_C(  565196734), INT32_C(-1917278389), INT32_C(  687034376), INT32_C(  705420339),
+                            INT32_C( -138822813), INT32_C(  544425083), INT32_C( 1800028983), INT32_C(-2118012583)),
+      simde_mm512_set_epi32(INT32_C(-1614186965), INT32_C( -181678932), INT32_C(-1300525716), INT32_C( 2100040966),
+                            INT32_C( 1873597219), INT32_C(  190738329), INT32_C(-1629471668), INT32_C(-1489947908),
+                            INT32_C(  944678480), INT32_C(-1216850352), INT32_C(-1182461465), INT32_C(-1642173690),
+                            INT32_C( 1619976157), INT32_C(-1505352561), INT32_C(-2043730440), INT32_C(  649901095)),
+      simde_mm512_set_epi32(INT32_C(  453076521), INT32_C( 1428719780), INT32_C(  272270380), INT32_C( 1428688898),
+                            INT32_C(  145510914), INT32_C(  152446728), INT32_C(-1803535360), INT32_C(   52502724),
+                            INT32_C(  536880656), INT32_C(-2059925952), INT32_C(  679546880), INT32_C(  168445954),
+                            INT32_C( 1619565377), INT32_C(  541197323), INT32_C(   34210096), INT32_C(    8433665)) },
+    { simde_mm512_set_epi32(INT32_C(-1900097176), INT32_C( -404028627), INT32_C(  320718601), INT32_C( 1721888055),
+                            INT32_C(-1071810688), INT32_C(-1628114476), INT32_C(-1369723876), INT32_C(-1963228527),
+                            INT32_C( -381612380), INT32_C(-1311761561), INT32_C(  388494373), INT32_C(-1853227429),
+                            INT32_C(   27415867), INT32_C(-1991375083), INT32_C(-1856949295), INT32_C( -238211019)),
+      simde_mm512_set_epi32(INT32_C(-1646539622), INT32_C( -622860392), INT32_C(-1091606325), INT32_C(  482701948),
+                            INT32_C( 1994900403), INT32_C(-1012024373), INT32_C( 1802654453), INT32_C(  112172028),
+                            INT32_C( -727254085), INT32_C( 1178367955), INT32_C(  677209965), INT32_C( 1938229696),
+                            INT32_C( 2088818366), INT32_C(  -25433129), INT32_C(-2144881907), INT32_C( -799555989)),
+      simde_mm512_set_epi32(INT32_C(-1936015352), INT32_C(-1026882808), INT32_C(  302858249), INT32_C(   75587636),
+                            INT32_C( 1074086784), INT32_C(-2103135808), INT32_C(  710017044), INT32_C(   44794512),
+                            INT32_C(-1073739104), INT32_C(    1053507), INT32_C(     353317), INT32_C(  293668928),
+                            INT32_C(    8410170), INT32_C(-2008415467), INT32_C(-2147405055), INT32_C( -800772063)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_and_pd(simde_mm512_castsi512_pd(test_vec[i].a), simde_mm512_castsi512_pd(test_vec[i].b));
+    simde_assert_m512i_equal(simde_mm512_castpd_si512(r), test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_andnot_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(-2113655116), INT32_C(  158944800), INT32_C( -200543042), INT32_C( 1074616078),
+                            INT32_C( 1096755503), INT32_C(-1605887745), INT32_C( 2094615901), INT32_C(  370014033),
+                            INT32_C(  476628462), INT32_C(-1644044497), INT32_C(  799132212), INT32_C(  261428358),
+                            INT32_C( 1235436136), INT32_C( -825469205), INT32_C( -396538321), INT32_C( -657539497)),
+      simde_mm512_set_epi32(INT32_C( 1430758906), INT32_C( 1720526090), INT32_C(  469087178), INT32_C(-1236994974),
+                            INT32_C(-1446675115), INT32_C( 1642554341), INT32_C(-1073196489), INT32_C( -217589290),
+                            INT32_C(  762469300), INT32_C(  185533329), INT32_C(-1106727032), INT32_C( -130068046),
+                            INT32_C(  753208414), INT32_C( 1196135381), INT32_C(  307570492), INT32_C( 2139370684)),
+      simde_mm512_set_epi32(INT32_C( 1430487370), INT32_C( 1719935242), INT32_C(  200540992), INT32_C(-1237278624),
+                            INT32_C(-1467984816), INT32_C( 1101488896), INT32_C(-2147479006), INT32_C( -519960442),
+                            INT32_C(  554834448), INT32_C(   17694864), INT32_C(-1878514296), INT32_C( -265666256),
+                            INT32_C(  608439318), INT32_C(   17006868), INT32_C(  301998352), INT32_C(  654311592)) },
+    { simde_mm512_set_epi32(INT32_C(-1696947363), INT32_C(-1138318623), INT32_C(  -71958126), INT32_C( -843847246),
+                            INT32_C(-1249789376), INT32_C(-1457814539), INT32_C( -389244944), INT32_C(-1431155667),
+                            INT32_C( 1613980981), INT32_C( -449343566), INT32_C(    2235805), INT32_C( 2069068096),
+                            INT32_C( 2129859830), INT32_C(  188030395), INT32_C(-1857539159), INT32_C( -299352640)),
+      simde_mm512_set_epi32(INT32_C(-1101887608), INT32_C( 1555190295), INT32_C(-1205379688), INT32_C(  480767944),
+                            INT32_C( -985246583), INT32_C(  212312846), INT32_C( 1055114923), INT32_C( 1348642435),
+                            INT32_C( 2135279467), INT32_C( 1385822513), INT32_C( -545951898), INT32_C( -728967329),
+                            INT32_C( -192356015), INT32_C(   -8402421), INT32_C(  583910308), INT32_C(  895645668)),
+      simde_mm512_set_epi32(INT32_C(  603980928), INT32_C( 1083199510), INT32_C(      89096), INT32_C(  268699208),
+                            INT32_C( 1078346889), INT32_C(   77864970), INT32_C(  371408907), INT32_C( 1346413186),
+                            INT32_C(  524583498), INT32_C(  310931457), INT32_C( -548052382), INT32_C(-2071165409),
+                            INT32_C(-2146901759), INT32_C( -196427264), INT32_C(  579190788), INT32_C(  289554980)) },
+    { simde_mm512_set_epi32(INT32_C(-1232962990), INT32_C( -393462574), INT32_C( 1081751427), INT32_C( -658246344),
+                            INT32_C(  327137320), INT32_C(  -65223874), INT32_C( 1104565091), INT32_C( 1608034668),
+                            INT32_C(-1142207773), INT32_C( 1853480593), INT32_C( 1340695396), INT32_C(  670964583),
+                            INT32_C(-1598331370), INT32_C(-1548510955), INT32_C( 2037554876), INT32_C(-1942269069)),
+      simde_mm512_set_epi32(INT32_C(  343658445), INT32_C( 1894946832), INT32_C(  204745824), INT32_C(-1817715414),
+                            INT32_C(-1909201055), INT32_C(  993059938), INT32_C( 1177436289), INT32_C( -410017049),
+                            INT32_C( -481988712), INT32_C(  978972806), INT32_C(  100312027), INT32_C( -890707833),
+                            INT32_C( -806545651), INT32_C( -771094965), INT32_C(-1776261987), INT32_C( 1235111979)),
+      simde_mm512_set_epi32(INT32_C(    7964045), INT32_C(  275939328), INT32_C(  201590880), INT32_C(   52692994),
+                            INT32_C(-1946138815), INT32_C(   52438080), INT32_C(  103284864), INT32_C(-1610153341),
+                            INT32_C( 1074013464), INT32_C(  268443654), INT32_C(    1212571), INT32_C( -939466624),
+                            INT32_C( 1329860873), INT32_C( 1342703178), INT32_C(-2046795775), INT32_C( 1099169800)) },
+    { simde_mm512_set_epi32(INT32_C(  -52397091), INT32_C( -458700662), INT32_C( 1917678318), INT32_C(  424613946),
+                            INT32_C( 1430467265), INT32_C(  597885179), INT32_C( -417137102), INT32_C(  154668012),
+                            INT32_C( -677004005), INT32_C(-1683306912), INT32_C( 2139910834), INT32_C(-1449269523),
+                            INT32_C(  878836740), INT32_C(  642179026), INT32_C(-1485279618), INT32_C( 2012707104)),
+      simde_mm512_set_epi32(INT32_C(-2121152128), INT32_C(   11014309), INT32_C(-1124514235), INT32_C( 2123598707),
+                            INT32_C(-2009545246), INT32_C( -744698908), INT32_C( 1893405314), INT32_C( 1274525385),
+                            INT32_C( 1837433535), INT32_C( -938699036), INT32_C( 1609371599), INT32_C( 2042859653),
+                            INT32_C( 1105401732), INT32_C( 2002228396), INT32_C(  334506051), INT32_C(-1686832229)),
+      simde_mm512_set_epi32(INT32_C(   17924096), INT32_C(       4133), INT32_C(-1934621695), INT32_C( 1720746817),
+                            INT32_C(-2009545438), INT32_C( -803419388), INT32_C(  282656896), INT32_C( 1120384001),
+                            INT32_C(  671089316), INT32_C( 1074008196), INT32_C(    6360397), INT32_C( 1346506752),
+                            INT32_C( 1099039616), INT32_C( 1360068652), INT32_C(  276824065), INT32_C(-2013232485)) },
+    { simde_mm512_set_epi32(INT32_C(  506846578), INT32_C(-1411457070), INT32_C( 1596284856), INT32_C( 1961447792),
+                            INT32_C(  848583861), INT32_C( 1469606178), INT32_C(-2090273050), INT32_C( 1286176153),
+                            INT32_C( 1640399714), INT32_C( 2035479601), INT32_C(-1484513260), INT32_C( 1652172833),
+                            INT32_C(  659047121), INT32_C(  329472855), INT32_C(-1378034827), INT32_C(-1154364988)),
+      simde_mm512_set_epi32(INT32_C( -199025439), INT32_C(  561437808), INT32_C( -173868440), INT32_C( 1378128275),
+                            INT32_C( 2134236705), INT32_C(  769344150), INT32_C(-1102122715), INT32_C( 1390429468),
+                            INT32_C(  165787606), INT32_C(  226049955), INT32_C(-1278680781), INT32_C( 2083725792),
+                            INT32_C(-1812929436), INT32_C(  334032896), INT32_C( -622691696), INT32_C( -820062483)),
+      simde_mm512_set_epi32(INT32_C( -536739711), INT32_C(    2097184), INT32_C(-1602052032), INT32_C(   33849475),
+                            INT32_C( 1294041600), INT32_C(  675480212), INT32_C( 1007026433), INT32_C(  306184196),
+                            INT32_C(  136393876), INT32_C(   69798786), INT32_C(  273203491), INT32_C(  469828032),
+                            INT32_C(-1867471836), INT32_C(    4759552), INT32_C( 1377968256), INT32_C( 1141773865)) },
+    { simde_mm512_set_epi32(INT32_C(  207028369), INT32_C(-1941401798), INT32_C(  511892599), INT32_C(  120959836),
+                            INT32_C(-1270570252), INT32_C( 1316150945), INT32_C(-1043863916), INT32_C( 1189689552),
+                            INT32_C( 1801312692), INT32_C(  947637643), INT32_C( -311573976), INT32_C( 1724975512),
+                            INT32_C( 2108560197), INT32_C(-1087085165), INT32_C(  468487332), INT32_C( 1050488264)),
+      simde_mm512_set_epi32(INT32_C( 1270786702), INT32_C(-1347745506), INT32_C( 1821125901), INT32_C( 1036476385),
+                            INT32_C(  962608375), INT32_C( 1120725942), INT32_C(-1427249563), INT32_C(-1681278587),
+                            INT32_C( -233196090), INT32_C(  108526129), INT32_C(-1095795073), INT32_C( 1972959940),
+                            INT32_C(  733169952), INT32_C( -822247291), INT32_C(-1687625133), INT32_C(-1914924892)),
+      simde_mm512_set_epi32(INT32_C( 1135127054), INT32_C(  597884932), INT32_C( 1611407624), INT32_C(  952257697),
+                            INT32_C(  153099267), INT32_C(    9183510), INT32_C(  707264609), INT32_C(-1728020219),
+                            INT32_C(-1879038910), INT32_C(  100938288), INT32_C(  310525015), INT32_C(  285798980),
+                            INT32_C(   34687008), INT32_C( 1086947332), INT32_C(-2147458477), INT32_C(-2126475228)) },
+    { simde_mm512_set_epi32(INT32_C( -704142563), INT32_C(-1110552501), INT32_C( 1919203200), INT32_C(  979759528),
+                            INT32_C(-1116855939), INT32_C( 1020874292), INT32_C(-1319737374), INT32_C(-1666280420),
+                            INT32_C(-1103585963), INT32_C(-1099301022), INT32_C(-1252945446), INT32_C(-1019228227),
+                            INT32_C( 1987347038), INT32_C(-1392484291), INT32_C( -589769810), INT32_C(-2012358516)),
+      simde_mm512_set_epi32(INT32_C(  451130391), INT32_C(-1453174151), INT32_C(-2047996067), INT32_C( 1494571791),
+                            INT32_C( -770201344), INT32_C(-1179005548), INT32_C(-1847796531), INT32_C( -786861133),
+                            INT32_C( -931544802), INT32_C(  690704046), INT32_C(-2144283415), INT32_C(  938300676),
+                            INT32_C(  523374531), INT32_C(-1598248553), INT32_C(-1690656036), INT32_C( 1132379691)),
+      simde_mm512_set_epi32(INT32_C(  148902914), INT32_C(    2097712), INT32_C(-2054551459), INT32_C( 1091570183),
+                            INT32_C( 1108445184), INT32_C(-2128576128), INT32_C(    8951821), INT32_C( 1091658659),
+                            INT32_C( 1078018058), INT32_C(   16908428), INT32_C(    2114593), INT32_C(  885002240),
+                            INT32_C(  151129473), INT32_C(   12355970), INT32_C(   52568144), INT32_C( 1131554339)) },
+    { simde_mm512_set_epi32(INT32_C( 1928760550), INT32_C(-1189537965), INT32_C( -722007329), INT32_C(-2053220872),
+                            INT32_C(-2060457611), INT32_C( -285433026), INT32_C(-1400191711), INT32_C(   83271363),
+                            INT32_C(  -23469902), INT32_C( 1092276966), INT32_C(-1912528922), INT32_C( 1793579159),
+                            INT32_C(-2045064586), INT32_C( 1343950220), INT32_C( 1808444015), INT32_C( -976148323)),
+      simde_mm512_set_epi32(INT32_C(-1893462841), INT32_C( 1421514343), INT32_C(-1536778358), INT32_C( 1612207564),
+                            INT32_C( -835464889), INT32_C( 2105721416), INT32_C(  446994955), INT32_C(-1782554762),
+                            INT32_C(-1888459867), INT32_C(  871190441), INT32_C( -643230526), INT32_C( 1699280921),
+                            INT32_C( 1719539593), INT32_C(-1074388002), INT32_C(-1127698693), INT32_C(  868127165)),
+      simde_mm512_set_epi32(INT32_C(-1929379839), INT32_C( 1151500324), INT32_C(  536909056), INT32_C( 1610612740),
+                            INT32_C( 1242566658), INT32_C(  285360192), INT32_C(  304355850), INT32_C(-1862254284),
+                            INT32_C(   23069445), INT32_C(  853871881), INT32_C( 1369964544), INT32_C(   84418568),
+                            INT32_C( 1617171849), INT32_C(-1344003502), INT32_C(-1811938160), INT32_C(  841912608)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_andnot_ps(simde_mm512_castsi512_ps(test_vec[i].a), simde_mm512_castsi512_ps(test_vec[i].b));
+    simde_assert_m512i_equal(simde_mm512_castps_si512(r), test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_andnot_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C( -499279688), INT32_C(  184447218), INT32_C( -292255109), INT32_C(-1741915965),
+                            INT32_C(  224037185), INT32_C(-1464634198), INT32_C(-1234341684), INT32_C(-1674939572),
+                            INT32_C( -801938509), INT32_C( 1612948935), INT32_C( 1839638949), INT32_C( -882663940),
+                            INT32_C( 1043208893), INT32_C(  180453758), INT32_C(  832099177), INT32_C(-1821599093)),
+      simde_mm512_set_epi32(INT32_C( 1182765420), INT32_C( 1707062486), INT32_C( 1508928907), INT32_C(  917769802),
+                            INT32_C( -155261851), INT32_C( -929036133), INT32_C( -422186420), INT32_C( -288303759),
+                            INT32_C(   44072981), INT32_C( -234819729), INT32_C( 1365184119), INT32_C(-1587960475),
+                            INT32_C(  482867178), INT32_C( -552522830), INT32_C( -937371129), INT32_C( -363859821)),
+      simde_mm512_set_epi32(INT32_C(   71434564), INT32_C( 1694598148), INT32_C(  291530112), INT32_C(  646972936),
+                            INT32_C( -224107484), INT32_C( 1073743889), INT32_C( 1083212288), INT32_C( 1657832497),
+                            INT32_C(   41975812), INT32_C(-1845474776), INT32_C(  274269778), INT32_C(  538451969),
+                            INT32_C(   12707138), INT32_C( -720360832), INT32_C( -937424890), INT32_C( 1745051664)) },
+    { simde_mm512_set_epi32(INT32_C( -346304528), INT32_C( -435583899), INT32_C( -434552440), INT32_C(  466651189),
+                            INT32_C(   17454079), INT32_C( 1942725618), INT32_C(-1808329597), INT32_C(  239958272),
+                            INT32_C(  -12739326), INT32_C( 1436952140), INT32_C( 1071971106), INT32_C(-1475892204),
+                            INT32_C( -187699689), INT32_C( 2068032387), INT32_C( -956632602), INT32_C( 1484602943)),
+      simde_mm512_set_epi32(INT32_C(  -72706959), INT32_C( 1948781913), INT32_C( -188421702), INT32_C( 1025182154),
+                            INT32_C(-1056772679), INT32_C(-1793295056), INT32_C(-2141112988), INT32_C( -340970924),
+                            INT32_C( -811547242), INT32_C( 1462880090), INT32_C(-1823634278), INT32_C( 1016042675),
+                            INT32_C(-1616765397), INT32_C(-1114840783), INT32_C(-1565527353), INT32_C( -378393043)),
+      simde_mm512_set_epi32(INT32_C(  278925313), INT32_C(  270534936), INT32_C(  281323570), INT32_C(  604701130),
+                            INT32_C(-1073697792), INT32_C(-2079040512), INT32_C(    4202852), INT32_C( -509607340),
+                            INT32_C(    8405140), INT32_C(   34717970), INT32_C(-2146892648), INT32_C(  344461475),
+                            INT32_C(  186650664), INT32_C(-2071183312), INT32_C(  537199105), INT32_C(-1593704448)) },
+    { simde_mm512_set_epi32(INT32_C( 1694738320), INT32_C(  167914494), INT32_C( -730052372), INT32_C(-1174790271),
+                            INT32_C( -116048020), INT32_C( 1489090351), INT32_C(-1994481473), INT32_C(   57444002),
+                            INT32_C( 1876752352), INT32_C( 1470336574), INT32_C(-1089435276), INT32_C(-1466342790),
+                            INT32_C( 1745593336), INT32_C( -650618987), INT32_C( 1333119313), INT32_C( -881972477)),
+      simde_mm512_set_epi32(INT32_C(-1409444505), INT32_C(-2057646550), INT32_C(-2025120679), INT32_C( -613592062),
+                            INT32_C( 2024820806), INT32_C( -556488368), INT32_C(  767963080), INT32_C( -933887597),
+                            INT32_C( 1109452872), INT32_C(  363406808), INT32_C(  544627616), INT32_C( 1541247161),
+                            INT32_C( -467350860), INT32_C(  117266505), INT32_C(-1695966629), INT32_C( -810479575)),
+      simde_mm512_set_epi32(INT32_C(-1963192217), INT32_C(-2057780224), INT32_C(   50533393), INT32_C( 1107640322),
+                            INT32_C(   10502146), INT32_C(-2045507504), INT32_C(  616566592), INT32_C( -938344175),
+                            INT32_C(    2099208), INT32_C(     532928), INT32_C(    6705792), INT32_C( 1397002369),
+                            INT32_C(-2077997052), INT32_C(  113576008), INT32_C(-1870130678), INT32_C(   76615720)) },
+    { simde_mm512_set_epi32(INT32_C( -792619056), INT32_C( -368758459), INT32_C(-1921872706), INT32_C(  121707581),
+                            INT32_C( 1588180185), INT32_C(  435636591), INT32_C(  463470925), INT32_C(-2060520060),
+                            INT32_C( 2088166591), INT32_C( -603033500), INT32_C(-1252549039), INT32_C(-1049620089),
+                            INT32_C( 1037692589), INT32_C( 1680255444), INT32_C(-1754444470), INT32_C(  659206454)),
+      simde_mm512_set_epi32(INT32_C( 2037635534), INT32_C( 1430973158), INT32_C( -849338319), INT32_C(-1495296119),
+                            INT32_C(-1994321385), INT32_C(  850000894), INT32_C( 1238861802), INT32_C( 1449586972),
+                            INT32_C(-1881092700), INT32_C( 1407368615), INT32_C( -558150023), INT32_C( -748253573),
+                            INT32_C( -381899140), INT32_C( -900512717), INT32_C(  418718958), INT32_C( -126104985)),
+      simde_mm512_set_epi32(INT32_C(  691161102), INT32_C(  357223074), INT32_C( 1073750017), INT32_C(-1600224384),
+                            INT32_C(-2130705914), INT32_C(  570995344), INT32_C( 1079477922), INT32_C( 1379926040),
+                            INT32_C(-2088761088), INT32_C(   65047939), INT32_C( 1252540456), INT32_C(  302419576),
+                            INT32_C(-1071382448), INT32_C(-1974385629), INT32_C(  143663268), INT32_C( -667858367)) },
+    { simde_mm512_set_epi32(INT32_C( -519165505), INT32_C( -484031287), INT32_C( -745645828), INT32_C( 1017916255),
+                            INT32_C( -484359100), INT32_C( -653004165), INT32_C(  874334403), INT32_C( -382146136),
+                            INT32_C( -568551961), INT32_C( 1214590645), INT32_C(-1480574082), INT32_C( -633475094),
+                            INT32_C( 1517611783), INT32_C(-1663235458), INT32_C(  214764365), INT32_C( -882899277)),
+      simde_mm512_set_epi32(INT32_C(-2091618299), INT32_C( -658273129), INT32_C(  945480666), INT32_C(-1691800116),
+                            INT32_C(  138389355), INT32_C(   49117244), INT32_C(  706035089), INT32_C(-1907985767),
+                            INT32_C( 1394962885), INT32_C(  149852539), INT32_C( -728865899), INT32_C(  -20288096),
+                            INT32_C( -120855946), INT32_C(   93669940), INT32_C( 1754308000), INT32_C(-1444406784)),
+      simde_mm512_set_epi32(INT32_C(   38817792), INT32_C(  415336470), INT32_C(  676373250), INT32_C(-2097085312),
+                            INT32_C(  136225579), INT32_C(   49022980), INT32_C(  167785744), INT32_C(  105255441),
+                            INT32_C(   18964480), INT32_C(    9081162), INT32_C( 1343111297), INT32_C(  616693760),
+                            INT32_C(-1601503120), INT32_C(   16793600), INT32_C( 1611699360), INT32_C(  545789952)) },
+    { simde_mm512_set_epi32(INT32_C(  871996135), INT32_C( 1727784939), INT32_C(  990692956), INT32_C(   57040598),
+                            INT32_C(  926669299), INT32_C( 1255489066), INT32_C( 1511007146), INT32_C( -314699980),
+                            INT32_C(-2110612383), INT32_C(  549060233), INT32_C( -720845213), INT32_C( 1078611862),
+                            INT32_C( 1290487712), INT32_C(  203203154), INT32_C( -933673332), INT32_C(  245354062)),
+      simde_mm512_set_epi32(INT32_C( 1071731419), INT32_C(-1125464405), INT32_C(-1648489192), INT32_C(  896234253),
+                            INT32_C(-1691711564), INT32_C(-1555146909), INT32_C(-1034744898), INT32_C( -175693471),
+                            INT32_C(-1051833565), INT32_C( -743553300), INT32_C(  112804261), INT32_C( 1838213180),
+                            INT32_C(    5478198), INT32_C( 1058621169), INT32_C( 2030889137), INT32_C( 2147125988)),
+      simde_mm512_set_epi32(INT32_C(  201343000), INT32_C(-1744830464), INT32_C(-2068707072), INT32_C(  873013513),
+                            INT32_C(-2013264380), INT32_C(-1593163455), INT32_C(-2143090668), INT32_C(  276897857),
+                            INT32_C( 1095516930), INT32_C( -754581404), INT32_C(   45154692), INT32_C(  764452904),
+                            INT32_C(    1085462), INT32_C(  855721121), INT32_C(  822388785), INT32_C( 1902117024)) },
+    { simde_mm512_set_epi32(INT32_C(-2027872786), INT32_C(-1390637101), INT32_C(-1393635158), INT32_C( -109963784),
+                            INT32_C(-1247308588), INT32_C( -617916844), INT32_C( 1526252533), INT32_C(-1504883063),
+                            INT32_C( 2078957351), INT32_C(-1176132349), INT32_C( 1604496619), INT32_C( 1546362042),
+                            INT32_C(  578126557), INT32_C( -940632107), INT32_C(-1215724829), INT32_C( -633611802)),
+      simde_mm512_set_epi32(INT32_C(  264237574), INT32_C(  473047685), INT32_C(-2089784835), INT32_C(-1314662283),
+                            INT32_C(-1273034549), INT32_C( 2068956412), INT32_C( -607805019), INT32_C( 1897161272),
+                            INT32_C( 1537257771), INT32_C(-1908466688), INT32_C(  633220003), INT32_C(  321473302),
+                            INT32_C( -625613660), INT32_C( 1046163272), INT32_C( 1181662435), INT32_C( -494460404)),
+      simde_mm512_set_epi32(INT32_C(  144630272), INT32_C(  270671876), INT32_C(   51390805), INT32_C(    8505349),
+                            INT32_C(    1574923), INT32_C(  542146728), INT32_C(-2130370560), INT32_C( 1360011312),
+                            INT32_C(      40968), INT32_C(  102373376), INT32_C(  538706688), INT32_C(   50348804),
+                            INT32_C( -662674400), INT32_C(  940582920), INT32_C( 1080441856), INT32_C(  545530376)) },
+    { simde_mm512_set_epi32(INT32_C(-1089731088), INT32_C( 1940738902), INT32_C( -228550053), INT32_C(  315495280),
+                            INT32_C(-1947406988), INT32_C( -588125983), INT32_C(  782916949), INT32_C( 1566403705),
+                            INT32_C(  -72105905), INT32_C(  268459200), INT32_C( -833055127), INT32_C( 1924474057),
+                            INT32_C( 1664838028), INT32_C( -503184625), INT32_C( 1876590151), INT32_C( -674084992)),
+      simde_mm512_set_epi32(INT32_C( 1858879910), INT32_C(-1500795349), INT32_C(  299415831), INT32_C( -866617317),
+                            INT32_C( -879048810), INT32_C(-1275923905), INT32_C(-1736698264), INT32_C( -409721102),
+                            INT32_C( 1853593955), INT32_C(-1584562420), INT32_C(  559947363), INT32_C(  112822808),
+                            INT32_C( -897783148), INT32_C( 1767385160), INT32_C( -521614470), INT32_C( -359392144)),
+      simde_mm512_set_epi32(INT32_C( 1086341126), INT32_C(-2080199639), INT32_C(   26747140), INT32_C( -871340021),
+                            INT32_C( 1074922114), INT32_C(  587338270), INT32_C(-1873542616), INT32_C(-1568669054),
+                            INT32_C(   71833888), INT32_C(-1584585972), INT32_C(  555747330), INT32_C(   67668496),
+                            INT32_C(-2008776176), INT32_C(  156772416), INT32_C(-2145353416), INT32_C(  671357040)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_andnot_pd(simde_mm512_castsi512_pd(test_vec[i].a), simde_mm512_castsi512_pd(test_vec[i].b));
+    simde_assert_m512i_equal(simde_mm512_castpd_si512(r), test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvtepi64_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(                -146), INT64_C(   -7887127318109729),
+                            INT64_C(          2254228139), INT64_C(    5488299307492762),
+                            INT64_C(                 941), INT64_C( 3745176362817332125),
+                            INT64_C(          -164455040), INT64_C(   -3761363256204906)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -146.00), SIMDE_FLOAT64_C(-7887127318109729.00),
+                         SIMDE_FLOAT64_C(2254228139.00), SIMDE_FLOAT64_C(5488299307492762.00),
+                         SIMDE_FLOAT64_C(  941.00), SIMDE_FLOAT64_C(3745176362817332224.00),
+                         SIMDE_FLOAT64_C(-164455040.00), SIMDE_FLOAT64_C(-3761363256204906.00)) },
+    { simde_mm512_set_epi64(INT64_C(                -927), INT64_C(                -665),
+                            INT64_C(    3898435591515787), INT64_C(    7300916500958005),
+                            INT64_C(   -7670734703852645), INT64_C(             8254096),
+                            INT64_C(            58370703), INT64_C(    5138019131010032)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -927.00), SIMDE_FLOAT64_C( -665.00),
+                         SIMDE_FLOAT64_C(3898435591515787.00), SIMDE_FLOAT64_C(7300916500958005.00),
+                         SIMDE_FLOAT64_C(-7670734703852645.00), SIMDE_FLOAT64_C(8254096.00),
+                         SIMDE_FLOAT64_C(58370703.00), SIMDE_FLOAT64_C(5138019131010032.00)) },
+    { simde_mm512_set_epi64(INT64_C(   -2001465686494784), INT64_C( 6508450719412343018),
+                            INT64_C(   -1343639058494026), INT64_C(   -4271284676495965),
+                            INT64_C(                -227), INT64_C(   -9467588860766906),
+                            INT64_C(                 722), INT64_C( 4187499737089392722)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-2001465686494784.00), SIMDE_FLOAT64_C(6508450719412342784.00),
+                         SIMDE_FLOAT64_C(-1343639058494026.00), SIMDE_FLOAT64_C(-4271284676495965.00),
+                         SIMDE_FLOAT64_C( -227.00), SIMDE_FLOAT64_C(-9467588860766906.00),
+                         SIMDE_FLOAT64_C(  722.00), SIMDE_FLOAT64_C(4187499737089392640.00)) },
+    { simde_mm512_set_epi64(INT64_C(                 326), INT64_C(         20148405992),
+                            INT64_C(           837752492), INT64_C(-6287457670024868561),
+                            INT64_C(    2683100978501105), INT64_C(    4971753121865860),
+                            INT64_C(   -4827275637611123), INT64_C(   -3177769021013595)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  326.00), SIMDE_FLOAT64_C(20148405992.00),
+                         SIMDE_FLOAT64_C(837752492.00), SIMDE_FLOAT64_C(-6287457670024868864.00),
+                         SIMDE_FLOAT64_C(2683100978501105.00), SIMDE_FLOAT64_C(4971753121865860.00),
+                         SIMDE_FLOAT64_C(-4827275637611123.00), SIMDE_FLOAT64_C(-3177769021013595.00)) },
+    { simde_mm512_set_epi64(INT64_C( 7849927700046810146), INT64_C(-8470824525501296733),
+                            INT64_C(    5355382692702584), INT64_C(   -4201086521006913),
+                            INT64_C(-8186904650239718154), INT64_C(-6811955167353696269),
+                            INT64_C(     943855354726557), INT64_C( -358785792340755667)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(7849927700046810112.00), SIMDE_FLOAT64_C(-8470824525501296640.00),
+                         SIMDE_FLOAT64_C(5355382692702584.00), SIMDE_FLOAT64_C(-4201086521006913.00),
+                         SIMDE_FLOAT64_C(-8186904650239718400.00), SIMDE_FLOAT64_C(-6811955167353696256.00),
+                         SIMDE_FLOAT64_C(943855354726557.00), SIMDE_FLOAT64_C(-358785792340755648.00)) },
+    { simde_mm512_set_epi64(INT64_C(        -92255932003), INT64_C(    1489144370575843),
+                            INT64_C( 2672562133924647257), INT64_C( 1457449092973267814),
+                            INT64_C(         51603954014), INT64_C(    7479525076871914),
+                            INT64_C(-2447383183340203259), INT64_C(                -791)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-92255932003.00), SIMDE_FLOAT64_C(1489144370575843.00),
+                         SIMDE_FLOAT64_C(2672562133924647424.00), SIMDE_FLOAT64_C(1457449092973267712.00),
+                         SIMDE_FLOAT64_C(51603954014.00), SIMDE_FLOAT64_C(7479525076871914.00),
+                         SIMDE_FLOAT64_C(-2447383183340203008.00), SIMDE_FLOAT64_C( -791.00)) },
+    { simde_mm512_set_epi64(INT64_C(      81535980478813), INT64_C(            82778709),
+                            INT64_C(                 397), INT64_C(                -616),
+                            INT64_C(   -2723324005982326), INT64_C(                 545),
+                            INT64_C(                -821), INT64_C( 1942852866573860237)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(81535980478813.00), SIMDE_FLOAT64_C(82778709.00),
+                         SIMDE_FLOAT64_C(  397.00), SIMDE_FLOAT64_C( -616.00),
+                         SIMDE_FLOAT64_C(-2723324005982326.00), SIMDE_FLOAT64_C(  545.00),
+                         SIMDE_FLOAT64_C( -821.00), SIMDE_FLOAT64_C(1942852866573860352.00)) },
+    { simde_mm512_set_epi64(INT64_C(    -176295975581608), INT64_C(    5872350927203498),
+                            INT64_C(                -789), INT64_C(   79643983782082433),
+                            INT64_C(                 692), INT64_C(    2100830375164970),
+                            INT64_C(                 473), INT64_C(    -563071979640916)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-176295975581608.00), SIMDE_FLOAT64_C(5872350927203498.00),
+                         SIMDE_FLOAT64_C( -789.00), SIMDE_FLOAT64_C(79643983782082432.00),
+                         SIMDE_FLOAT64_C(  692.00), SIMDE_FLOAT64_C(2100830375164970.00),
+                         SIMDE_FLOAT64_C(  473.00), SIMDE_FLOAT64_C(-563071979640916.00)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_cvtepi64_pd(test_vec[i].a);
+    simde_assert_m512d_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_cvtepi64_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  495.66), SIMDE_FLOAT64_C(  897.14),
+                         SIMDE_FLOAT64_C( -390.42), SIMDE_FLOAT64_C( -270.50),
+                         SIMDE_FLOAT64_C(  146.32), SIMDE_FLOAT64_C(  971.01),
+                         SIMDE_FLOAT64_C( -840.09), SIMDE_FLOAT64_C( -308.05)),
+      UINT8_C( 52),
+      simde_mm512_set_epi64(INT64_C(       3534926315443), INT64_C(        -67123375938),
+                            INT64_C(    -340369675105313), INT64_C( 5430774528540671531),
+                            INT64_C(                 959), INT64_C(    -691191073482065),
+                            INT64_C(   -1291234763556347), INT64_C( 6174496548060445660)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  495.66), SIMDE_FLOAT64_C(  897.14),
+                         SIMDE_FLOAT64_C(-340369675105313.00), SIMDE_FLOAT64_C(5430774528540672000.00),
+                         SIMDE_FLOAT64_C(  146.32), SIMDE_FLOAT64_C(-691191073482065.00),
+                         SIMDE_FLOAT64_C( -840.09), SIMDE_FLOAT64_C( -308.05)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  751.94), SIMDE_FLOAT64_C(  623.32),
+                         SIMDE_FLOAT64_C( -186.97), SIMDE_FLOAT64_C(   81.92),
+                         SIMDE_FLOAT64_C(  490.04), SIMDE_FLOAT64_C(  712.22),
+                         SIMDE_FLOAT64_C( -671.39), SIMDE_FLOAT64_C(   51.50)),
+      UINT8_C(155),
+      simde_mm512_set_epi64(INT64_C(    1522411367034676), INT64_C(        171903643289),
+                            INT64_C(              407500), INT64_C(-5052439527841851371),
+                            INT64_C(    7554085038116727), INT64_C(    -380001163886980),
+                            INT64_C(    1734630169631520), INT64_C(-8248001357819759811)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(1522411367034676.00), SIMDE_FLOAT64_C(  623.32),
+                         SIMDE_FLOAT64_C( -186.97), SIMDE_FLOAT64_C(-5052439527841851392.00),
+                         SIMDE_FLOAT64_C(7554085038116727.00), SIMDE_FLOAT64_C(  712.22),
+                         SIMDE_FLOAT64_C(1734630169631520.00), SIMDE_FLOAT64_C(-8248001357819759616.00)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -173.35), SIMDE_FLOAT64_C(  336.89),
+                         SIMDE_FLOAT64_C( -768.65), SIMDE_FLOAT64_C(   16.43),
+                         SIMDE_FLOAT64_C( -845.97), SIMDE_FLOAT64_C(  308.80),
+                         SIMDE_FLOAT64_C(  853.48), SIMDE_FLOAT64_C( -679.18)),
+      UINT8_C(145),
+      simde_mm512_set_epi64(INT64_C(    -898549538222615), INT64_C(    6167843454875274),
+                            INT64_C(                 864), INT64_C(          8805742501),
+                            INT64_C(          -114125849), INT64_C(              261253),
+                            INT64_C(                -785), INT64_C(                -603)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-898549538222615.00), SIMDE_FLOAT64_C(  336.89),
+                         SIMDE_FLOAT64_C( -768.65), SIMDE_FLOAT64_C(8805742501.00),
+                         SIMDE_FLOAT64_C( -845.97), SIMDE_FLOAT64_C(  308.80),
+                         SIMDE_FLOAT64_C(  853.48), SIMDE_FLOAT64_C( -603.00)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -117.64), SIMDE_FLOAT64_C(  539.20),
+                         SIMDE_FLOAT64_C(  353.03), SIMDE_FLOAT64_C(  -41.13),
+                         SIMDE_FLOAT64_C( -367.81), SIMDE_FLOAT64_C( -396.28),
+                         SIMDE_FLOAT64_C(   81.69), SIMDE_FLOAT64_C(  315.57)),
+      UINT8_C(203),
+      simde_mm512_set_epi64(INT64_C(   -7117968729962038), INT64_C(                -519),
+                            INT64_C(                 445), INT64_C(       2434630175125),
+                            INT64_C(     -46925137650006), INT64_C(              128658),
+                            INT64_C(    8694235917326225), INT64_C( 4525923001923015414)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-7117968729962038.00), SIMDE_FLOAT64_C( -519.00),
+                         SIMDE_FLOAT64_C(  353.03), SIMDE_FLOAT64_C(  -41.13),
+                         SIMDE_FLOAT64_C(-46925137650006.00), SIMDE_FLOAT64_C( -396.28),
+                         SIMDE_FLOAT64_C(8694235917326225.00), SIMDE_FLOAT64_C(4525923001923015168.00)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  231.23), SIMDE_FLOAT64_C(  258.50),
+                         SIMDE_FLOAT64_C( -466.93), SIMDE_FLOAT64_C(  451.57),
+                         SIMDE_FLOAT64_C(  283.85), SIMDE_FLOAT64_C( -842.22),
+                         SIMDE_FLOAT64_C( -682.68), SIMDE_FLOAT64_C( -966.73)),
+      UINT8_C( 36),
+      simde_mm512_set_epi64(INT64_C(                -981), INT64_C(                -406),
+                            INT64_C( 4754814464002600014), INT64_C(                 308),
+                            INT64_C(   -2333241407819338), INT64_C( 7677953151997764635),
+                            INT64_C(    -830954512017116), INT64_C( 4002240087000304933)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  231.23), SIMDE_FLOAT64_C(  258.50),
+                         SIMDE_FLOAT64_C(4754814464002599936.00), SIMDE_FLOAT64_C(  451.57),
+                         SIMDE_FLOAT64_C(  283.85), SIMDE_FLOAT64_C(7677953151997764608.00),
+                         SIMDE_FLOAT64_C( -682.68), SIMDE_FLOAT64_C( -966.73)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -543.60), SIMDE_FLOAT64_C( -453.17),
+                         SIMDE_FLOAT64_C(    9.38), SIMDE_FLOAT64_C( -503.60),
+                         SIMDE_FLOAT64_C( -374.64), SIMDE_FLOAT64_C( -290.38),
+                         SIMDE_FLOAT64_C(  764.37), SIMDE_FLOAT64_C( -781.97)),
+      UINT8_C(190),
+      simde_mm512_set_epi64(INT64_C( 6915846657722884462), INT64_C(    6575868755131025),
+                            INT64_C(             6243064), INT64_C(-5274291454405171635),
+                            INT64_C(-4796614605523653725), INT64_C(    8205538636276281),
+                            INT64_C(    7023737769773559), INT64_C(    8556871219991430)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(6915846657722884096.00), SIMDE_FLOAT64_C( -453.17),
+                         SIMDE_FLOAT64_C(6243064.00), SIMDE_FLOAT64_C(-5274291454405171200.00),
+                         SIMDE_FLOAT64_C(-4796614605523653632.00), SIMDE_FLOAT64_C(8205538636276281.00),
+                         SIMDE_FLOAT64_C(7023737769773559.00), SIMDE_FLOAT64_C( -781.97)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  559.84), SIMDE_FLOAT64_C( -430.70),
+                         SIMDE_FLOAT64_C(  886.53), SIMDE_FLOAT64_C(  260.93),
+                         SIMDE_FLOAT64_C(   62.66), SIMDE_FLOAT64_C( -372.10),
+                         SIMDE_FLOAT64_C( -670.18), SIMDE_FLOAT64_C( -747.47)),
+      UINT8_C( 73),
+      simde_mm512_set_epi64(INT64_C(             -109304), INT64_C(                 644),
+                            INT64_C(    8514275827160581), INT64_C( -591986665656170659),
+                            INT64_C(                -174), INT64_C(            -2682388),
+                            INT64_C(                -334), INT64_C(    -403813261629007)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  559.84), SIMDE_FLOAT64_C(  644.00),
+                         SIMDE_FLOAT64_C(  886.53), SIMDE_FLOAT64_C(  260.93),
+                         SIMDE_FLOAT64_C( -174.00), SIMDE_FLOAT64_C( -372.10),
+                         SIMDE_FLOAT64_C( -670.18), SIMDE_FLOAT64_C(-403813261629007.00)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -263.53), SIMDE_FLOAT64_C(  593.10),
+                         SIMDE_FLOAT64_C(  379.68), SIMDE_FLOAT64_C( -534.18),
+                         SIMDE_FLOAT64_C( -710.24), SIMDE_FLOAT64_C(  601.62),
+                         SIMDE_FLOAT64_C(  179.42), SIMDE_FLOAT64_C(  156.81)),
+      UINT8_C(162),
+      simde_mm512_set_epi64(INT64_C(                -988), INT64_C(              -28849),
+                            INT64_C( 8174389509690950185), INT64_C(-5711636723255221756),
+                            INT64_C(                -623), INT64_C(                -798),
+                            INT64_C( 3738629567374046246), INT64_C(    8942594425833683)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -988.00), SIMDE_FLOAT64_C(  593.10),
+                         SIMDE_FLOAT64_C(8174389509690950656.00), SIMDE_FLOAT64_C( -534.18),
+                         SIMDE_FLOAT64_C( -710.24), SIMDE_FLOAT64_C(  601.62),
+                         SIMDE_FLOAT64_C(3738629567374046208.00), SIMDE_FLOAT64_C(  156.81)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_mask_cvtepi64_pd(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512d_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_cvtepi64_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { UINT8_C(226),
+      simde_mm512_set_epi64(INT64_C(                -906), INT64_C(   -4583828740314929),
+                            INT64_C(                 118), INT64_C( -742314724027540805),
+                            INT64_C(-8508671963409023497), INT64_C(-1507064531341761383),
+                            INT64_C(      25404007019246), INT64_C(   -5246854094964682)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -906.00), SIMDE_FLOAT64_C(-4583828740314929.00),
+                         SIMDE_FLOAT64_C(  118.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(25404007019246.00), SIMDE_FLOAT64_C(    0.00)) },
+    { UINT8_C( 10),
+      simde_mm512_set_epi64(INT64_C(-1850262409065629805), INT64_C(           202864522),
+                            INT64_C(             -651918), INT64_C(                -900),
+                            INT64_C( 4094550209330081334), INT64_C(                 283),
+                            INT64_C(    7663919800516854), INT64_C( 1594805367419776381)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(4094550209330081280.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(7663919800516854.00), SIMDE_FLOAT64_C(    0.00)) },
+    { UINT8_C(188),
+      simde_mm512_set_epi64(INT64_C( 2510445454504142244), INT64_C(       -247467800217),
+                            INT64_C( 2562628472532089996), INT64_C(               -7747),
+                            INT64_C(                 968), INT64_C(    4234631839475604),
+                            INT64_C(               -1452), INT64_C(   -8982434150339745)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(2510445454504142336.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(2562628472532089856.00), SIMDE_FLOAT64_C(-7747.00),
+                         SIMDE_FLOAT64_C(  968.00), SIMDE_FLOAT64_C(4234631839475604.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00)) },
+    { UINT8_C(239),
+      simde_mm512_set_epi64(INT64_C(    8788878279120378), INT64_C(                 176),
+                            INT64_C(                 590), INT64_C(         -2939197986),
+                            INT64_C( 1099341818015769669), INT64_C(-1406518693011233321),
+                            INT64_C(    3654510816542086), INT64_C(  938235933719934960)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(8788878279120378.00), SIMDE_FLOAT64_C(  176.00),
+                         SIMDE_FLOAT64_C(  590.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(1099341818015769728.00), SIMDE_FLOAT64_C(-1406518693011233280.00),
+                         SIMDE_FLOAT64_C(3654510816542086.00), SIMDE_FLOAT64_C(938235933719934976.00)) },
+    { UINT8_C(223),
+      simde_mm512_set_epi64(INT64_C(                 -35), INT64_C( 6926659935252560720),
+                            INT64_C(   -7125706023298789), INT64_C(          -889904338),
+                            INT64_C(-1398478744987942835), INT64_C(    6322819679345958),
+                            INT64_C(     431077929127756), INT64_C( 6638720852013426751)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  -35.00), SIMDE_FLOAT64_C(6926659935252560896.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(-889904338.00),
+                         SIMDE_FLOAT64_C(-1398478744987942912.00), SIMDE_FLOAT64_C(6322819679345958.00),
+                         SIMDE_FLOAT64_C(431077929127756.00), SIMDE_FLOAT64_C(6638720852013426688.00)) },
+    { UINT8_C(241),
+      simde_mm512_set_epi64(INT64_C(       -244391022462), INT64_C(    4825899283183654),
+                            INT64_C( 6867986883869632210), INT64_C( 5595928167022399451),
+                            INT64_C(    1438043257954085), INT64_C(                -808),
+                            INT64_C(        221372029823), INT64_C(                 120)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-244391022462.00), SIMDE_FLOAT64_C(4825899283183654.00),
+                         SIMDE_FLOAT64_C(6867986883869632512.00), SIMDE_FLOAT64_C(5595928167022399488.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  120.00)) },
+    { UINT8_C(120),
+      simde_mm512_set_epi64(INT64_C(              511591), INT64_C(     -34793288464224),
+                            INT64_C(-2847820256714442113), INT64_C(   -5579179299099589),
+                            INT64_C(                 664), INT64_C(      17451632967230),
+                            INT64_C(           -44526733), INT64_C(                -702)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(-34793288464224.00),
+                         SIMDE_FLOAT64_C(-2847820256714442240.00), SIMDE_FLOAT64_C(-5579179299099589.00),
+                         SIMDE_FLOAT64_C(  664.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00)) },
+    { UINT8_C( 28),
+      simde_mm512_set_epi64(INT64_C(    -117080748605680), INT64_C(-3902112252188585288),
+                            INT64_C( 3934579616653971399), INT64_C(-1096898754214958072),
+                            INT64_C(-1882072518394036297), INT64_C(  623656500497216624),
+                            INT64_C(       1238944970373), INT64_C( 1078674541660070521)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(-1096898754214958080.00),
+                         SIMDE_FLOAT64_C(-1882072518394036224.00), SIMDE_FLOAT64_C(623656500497216640.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_maskz_cvtepi64_pd(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512d_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvtepu64_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_x_mm512_set_epu64(UINT64_C(15224356239885999647), UINT64_C( 6832282268797577490),
+                              UINT64_C(           265621427), UINT64_C(18446744073709532189),
+                              UINT64_C(18128278811826113192), UINT64_C(18442452133253010978),
+                              UINT64_C(    1400323715346279), UINT64_C(                 375)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(15224356239886000128.00), SIMDE_FLOAT64_C(6832282268797577216.00),
+                         SIMDE_FLOAT64_C(265621427.00), SIMDE_FLOAT64_C(18446744073709533184.00),
+                         SIMDE_FLOAT64_C(18128278811826112512.00), SIMDE_FLOAT64_C(18442452133253011456.00),
+                         SIMDE_FLOAT64_C(1400323715346279.00), SIMDE_FLOAT64_C(  375.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(                 491), UINT64_C(             4252775),
+                              UINT64_C(18438764436018022835), UINT64_C(14716681966299500639),
+                              UINT64_C(    6216845064419464), UINT64_C(15293679181363546334),
+                              UINT64_C(     193240457492367), UINT64_C(    2390219740322378)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  491.00), SIMDE_FLOAT64_C(4252775.00),
+                         SIMDE_FLOAT64_C(18438764436018022400.00), SIMDE_FLOAT64_C(14716681966299500544.00),
+                         SIMDE_FLOAT64_C(6216845064419464.00), SIMDE_FLOAT64_C(15293679181363546112.00),
+                         SIMDE_FLOAT64_C(193240457492367.00), SIMDE_FLOAT64_C(2390219740322378.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C( 9772516056683949110), UINT64_C(18446744073709550674),
+                              UINT64_C(                 737), UINT64_C(    8809354193779835),
+                              UINT64_C(  611810906644163643), UINT64_C(    6855419582114073),
+                              UINT64_C(12587412128778996081), UINT64_C(     572321907817032)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(9772516056683950080.00), SIMDE_FLOAT64_C(18446744073709551616.00),
+                         SIMDE_FLOAT64_C(  737.00), SIMDE_FLOAT64_C(8809354193779835.00),
+                         SIMDE_FLOAT64_C(611810906644163584.00), SIMDE_FLOAT64_C(6855419582114073.00),
+                         SIMDE_FLOAT64_C(12587412128778995712.00), SIMDE_FLOAT64_C(572321907817032.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(    4142621452010950), UINT64_C(18446744072931256042),
+                              UINT64_C(        475308256720), UINT64_C(       1886510191028),
+                              UINT64_C(18438010504352489374), UINT64_C(18438984622047353712),
+                              UINT64_C(    5586571345366895), UINT64_C(18446744073709550981)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(4142621452010950.00), SIMDE_FLOAT64_C(18446744072931256320.00),
+                         SIMDE_FLOAT64_C(475308256720.00), SIMDE_FLOAT64_C(1886510191028.00),
+                         SIMDE_FLOAT64_C(18438010504352489472.00), SIMDE_FLOAT64_C(18438984622047352832.00),
+                         SIMDE_FLOAT64_C(5586571345366895.00), SIMDE_FLOAT64_C(18446744073709551616.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(      12084001499445), UINT64_C(                 153),
+                              UINT64_C(11264777911794382773), UINT64_C(18445178593605452278),
+                              UINT64_C(18442600399777785088), UINT64_C(              269379),
+                              UINT64_C( 2968851357153799225), UINT64_C(10946736828244573006)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(12084001499445.00), SIMDE_FLOAT64_C(  153.00),
+                         SIMDE_FLOAT64_C(11264777911794382848.00), SIMDE_FLOAT64_C(18445178593605451776.00),
+                         SIMDE_FLOAT64_C(18442600399777785856.00), SIMDE_FLOAT64_C(269379.00),
+                         SIMDE_FLOAT64_C(2968851357153799168.00), SIMDE_FLOAT64_C(10946736828244572160.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(10626974437944965521), UINT64_C(18446744073709441115),
+                              UINT64_C(14024008025974372238), UINT64_C(18440547546345493133),
+                              UINT64_C(18446744073709077042), UINT64_C(18443516463674064844),
+                              UINT64_C(14072401790160307842), UINT64_C(18446744073630068238)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(10626974437944965120.00), SIMDE_FLOAT64_C(18446744073709441024.00),
+                         SIMDE_FLOAT64_C(14024008025974372352.00), SIMDE_FLOAT64_C(18440547546345492480.00),
+                         SIMDE_FLOAT64_C(18446744073709076480.00), SIMDE_FLOAT64_C(18443516463674064896.00),
+                         SIMDE_FLOAT64_C(14072401790160308224.00), SIMDE_FLOAT64_C(18446744073630068736.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(14560586442905055204), UINT64_C(18442418918528819292),
+                              UINT64_C(18446744073709551162), UINT64_C(14471846068248278783),
+                              UINT64_C(18446744073709551063), UINT64_C(18446744073684986081),
+                              UINT64_C(                 641), UINT64_C(                 581)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(14560586442905055232.00), SIMDE_FLOAT64_C(18442418918528819200.00),
+                         SIMDE_FLOAT64_C(18446744073709551616.00), SIMDE_FLOAT64_C(14471846068248279040.00),
+                         SIMDE_FLOAT64_C(18446744073709551616.00), SIMDE_FLOAT64_C(18446744073684985856.00),
+                         SIMDE_FLOAT64_C(  641.00), SIMDE_FLOAT64_C(  581.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(         17451831963), UINT64_C(18446744073072476598),
+                              UINT64_C(18446744073709551303), UINT64_C(    6219483038867779),
+                              UINT64_C(18446740415851025942), UINT64_C(                 582),
+                              UINT64_C(18446744073709550995), UINT64_C(18441819265215982522)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(17451831963.00), SIMDE_FLOAT64_C(18446744073072476160.00),
+                         SIMDE_FLOAT64_C(18446744073709551616.00), SIMDE_FLOAT64_C(6219483038867779.00),
+                         SIMDE_FLOAT64_C(18446740415851026432.00), SIMDE_FLOAT64_C(  582.00),
+                         SIMDE_FLOAT64_C(18446744073709551616.00), SIMDE_FLOAT64_C(18441819265215981568.00)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_cvtepu64_pd(test_vec[i].a);
+    simde_assert_m512d_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvtepi64_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(   -1695461092898544), INT64_C( 3317626162014799677),
+                            INT64_C(                -761), INT64_C( 8796324472258078201),
+                            INT64_C( 2306217544645164310), INT64_C(              -26372),
+                            INT64_C(             -931357), INT64_C( 7525410580182185525)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(-1695461157109760.00), SIMDE_FLOAT32_C(3317626253476888576.00), SIMDE_FLOAT32_C(  -761.00), SIMDE_FLOAT32_C(8796324469405646848.00),
+                         SIMDE_FLOAT32_C(2306217667800858624.00), SIMDE_FLOAT32_C(-26372.00), SIMDE_FLOAT32_C(-931357.00), SIMDE_FLOAT32_C(7525410523731460096.00)) },
+    { simde_mm512_set_epi64(INT64_C(   -3433634349061049), INT64_C(   -7424780408521071),
+                            INT64_C(  334065988683382613), INT64_C(            -1829285),
+                            INT64_C(                -250), INT64_C(                 528),
+                            INT64_C(   -6374329850568714), INT64_C(    4321397621168630)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(-3433634421800960.00), SIMDE_FLOAT32_C(-7424780294684672.00), SIMDE_FLOAT32_C(334065992256716800.00), SIMDE_FLOAT32_C(-1829285.00),
+                         SIMDE_FLOAT32_C(  -250.00), SIMDE_FLOAT32_C(   528.00), SIMDE_FLOAT32_C(-6374330078330880.00), SIMDE_FLOAT32_C(4321397719433216.00)) },
+    { simde_mm512_set_epi64(INT64_C(-3883736449618221547), INT64_C(-5426914572173034682),
+                            INT64_C(     421943550284171), INT64_C(          6639622134),
+                            INT64_C(-5317227680747748478), INT64_C(   -5198689155831361),
+                            INT64_C(                 467), INT64_C( 4272261516144906330)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(-3883736478194335744.00), SIMDE_FLOAT32_C(-5426914516795392000.00), SIMDE_FLOAT32_C(421943559847936.00), SIMDE_FLOAT32_C(6639622144.00),
+                         SIMDE_FLOAT32_C(-5317227786564272128.00), SIMDE_FLOAT32_C(-5198689081491456.00), SIMDE_FLOAT32_C(   467.00), SIMDE_FLOAT32_C(4272261556252704768.00)) },
+    { simde_mm512_set_epi64(INT64_C(-2968449445203279260), INT64_C(-8844668981819164604),
+                            INT64_C(                -865), INT64_C( 7242177639770949428),
+                            INT64_C( 4605756752885883787), INT64_C(                -736),
+                            INT64_C(-3759181985237491428), INT64_C(     -38569724653327)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(-2968449398041739264.00), SIMDE_FLOAT32_C(-8844668896167329792.00), SIMDE_FLOAT32_C(  -865.00), SIMDE_FLOAT32_C(7242177427927990272.00),
+                         SIMDE_FLOAT32_C(4605756627096698880.00), SIMDE_FLOAT32_C(  -736.00), SIMDE_FLOAT32_C(-3759181876854521856.00), SIMDE_FLOAT32_C(-38569724870656.00)) },
+    { simde_mm512_set_epi64(INT64_C(                 565), INT64_C(                -882),
+                            INT64_C( 4230767794879521741), INT64_C(-1354263294603809095),
+                            INT64_C(   -2963316139154876), INT64_C(        -14432381964),
+                            INT64_C(    8294906363494001), INT64_C( 3787258589690185862)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(   565.00), SIMDE_FLOAT32_C(  -882.00), SIMDE_FLOAT32_C(4230767911565787136.00), SIMDE_FLOAT32_C(-1354263249251467264.00),
+                         SIMDE_FLOAT32_C(-2963316175536128.00), SIMDE_FLOAT32_C(-14432381952.00), SIMDE_FLOAT32_C(8294906309115904.00), SIMDE_FLOAT32_C(3787258456025595904.00)) },
+    { simde_mm512_set_epi64(INT64_C(    1401818549084018), INT64_C(     519052492899618),
+                            INT64_C(         42440023143), INT64_C(                 706),
+                            INT64_C(        541423877747), INT64_C(             -244116),
+                            INT64_C(                 589), INT64_C(           467913771)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(1401818538049536.00), SIMDE_FLOAT32_C(519052501975040.00), SIMDE_FLOAT32_C(42440024064.00), SIMDE_FLOAT32_C(   706.00),
+                         SIMDE_FLOAT32_C(541423861760.00), SIMDE_FLOAT32_C(-244116.00), SIMDE_FLOAT32_C(   589.00), SIMDE_FLOAT32_C(467913760.00)) },
+    { simde_mm512_set_epi64(INT64_C(    7462539726901470), INT64_C(-9174615688895198653),
+                            INT64_C(   -7268828401547908), INT64_C( 7395002540224792143),
+                            INT64_C(                -662), INT64_C(    8909297346874980),
+                            INT64_C(    1402714208632581), INT64_C(               51050)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(7462539499667456.00), SIMDE_FLOAT32_C(-9174615842988490752.00), SIMDE_FLOAT32_C(-7268828421554176.00), SIMDE_FLOAT32_C(7395002397363273728.00),
+                         SIMDE_FLOAT32_C(  -662.00), SIMDE_FLOAT32_C(8909297085841408.00), SIMDE_FLOAT32_C(1402714172948480.00), SIMDE_FLOAT32_C( 51050.00)) },
+    { simde_mm512_set_epi64(INT64_C(      52843775166768), INT64_C(-6701463154398194032),
+                            INT64_C(-1043982013689859407), INT64_C(          1617654384),
+                            INT64_C(                 209), INT64_C(                -501),
+                            INT64_C(     163938722217845), INT64_C(                 906)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(52843776049152.00), SIMDE_FLOAT32_C(-6701462898155192320.00), SIMDE_FLOAT32_C(-1043982029965754368.00), SIMDE_FLOAT32_C(1617654400.00),
+                         SIMDE_FLOAT32_C(   209.00), SIMDE_FLOAT32_C(  -501.00), SIMDE_FLOAT32_C(163938717138944.00), SIMDE_FLOAT32_C(   906.00)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm512_cvtepi64_ps(test_vec[i].a);
+    simde_assert_m256_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvtepu64_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m256 r;
+  } test_vec[8] = {
+    { simde_x_mm512_set_epu64(UINT64_C(18446744073709551611), UINT64_C(18442352163172773617),
+                              UINT64_C(14109409162829668629), UINT64_C(18446744073709551394),
+                              UINT64_C(18446744073709550874), UINT64_C(    2370021374119969),
+                              UINT64_C(              130484), UINT64_C(16863154305082790743)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(18442352624268214272.00), SIMDE_FLOAT32_C(14109409296156459008.00), SIMDE_FLOAT32_C(18446744073709551616.00),
+                         SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(2370021472862208.00), SIMDE_FLOAT32_C(130484.00), SIMDE_FLOAT32_C(16863153760107495424.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C( 6665350856789655228), UINT64_C( 6033996259044919828),
+                              UINT64_C(                 989), UINT64_C(                 993),
+                              UINT64_C(18446744073709304333), UINT64_C(    3931526210570729),
+                              UINT64_C(    2478174511278512), UINT64_C(                 110)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(6665351088008331264.00), SIMDE_FLOAT32_C(6033996118176563200.00), SIMDE_FLOAT32_C(   989.00), SIMDE_FLOAT32_C(   993.00),
+                         SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(3931526089670656.00), SIMDE_FLOAT32_C(2478174386520064.00), SIMDE_FLOAT32_C(   110.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C( 5969185774071166401), UINT64_C(    1762132809980222),
+                              UINT64_C( 7725594290085657893), UINT64_C(    7611591027522769),
+                              UINT64_C(                 190), UINT64_C(    5158906798529916),
+                              UINT64_C(18446744073709551053), UINT64_C(18446744073201605876)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(5969185955033120768.00), SIMDE_FLOAT32_C(1762132873969664.00), SIMDE_FLOAT32_C(7725594207754125312.00), SIMDE_FLOAT32_C(7611590970966016.00),
+                         SIMDE_FLOAT32_C(   190.00), SIMDE_FLOAT32_C(5158906946912256.00), SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(18446744073709551616.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(18446744073709551443), UINT64_C( 1935184603613343955),
+                              UINT64_C(     195192791493964), UINT64_C(                  34),
+                              UINT64_C(18438529739236547679), UINT64_C(18446741490129966413),
+                              UINT64_C(18446744073709551014), UINT64_C(                 494)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(1935184582789824512.00), SIMDE_FLOAT32_C(195192791498752.00), SIMDE_FLOAT32_C(    34.00),
+                         SIMDE_FLOAT32_C(18438529622338437120.00), SIMDE_FLOAT32_C(18446741874686296064.00), SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(   494.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(12015833319143986317), UINT64_C(18444692678160645888),
+                              UINT64_C( 8880799138397236295), UINT64_C(18446744073709551322),
+                              UINT64_C(18446744073709550924), UINT64_C(        407502361346),
+                              UINT64_C(    8112579951699645), UINT64_C(        231692473435)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(12015833603754688512.00), SIMDE_FLOAT32_C(18444692385012121600.00), SIMDE_FLOAT32_C(8880799398011863040.00), SIMDE_FLOAT32_C(18446744073709551616.00),
+                         SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(407502356480.00), SIMDE_FLOAT32_C(8112580115562496.00), SIMDE_FLOAT32_C(231692468224.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(18444557332277017405), UINT64_C(                 533),
+                              UINT64_C(                 763), UINT64_C(    5213082936241124),
+                              UINT64_C(18446241036647918356), UINT64_C(    4984660875198362),
+                              UINT64_C(18446744073709550916), UINT64_C( 4124088251019360334)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(18444557145081905152.00), SIMDE_FLOAT32_C(   533.00), SIMDE_FLOAT32_C(   763.00), SIMDE_FLOAT32_C(5213083127513088.00),
+                         SIMDE_FLOAT32_C(18446240497384030208.00), SIMDE_FLOAT32_C(4984660660584448.00), SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(4124088345636634624.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C(18446744073709551499), UINT64_C(17624620727997096599),
+                              UINT64_C(18446744073709309988), UINT64_C(     408723575519654),
+                              UINT64_C(18446744073709551473), UINT64_C( 7461885449072305960),
+                              UINT64_C(     358109454273140), UINT64_C(                 110)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(17624620537923764224.00), SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(408723583401984.00),
+                         SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(7461885689680887808.00), SIMDE_FLOAT32_C(358109440638976.00), SIMDE_FLOAT32_C(   110.00)) },
+    { simde_x_mm512_set_epu64(UINT64_C( 8279707343508987625), UINT64_C(18446744051922741992),
+                              UINT64_C(17948659911575543016), UINT64_C(18446744073709429104),
+                              UINT64_C(    5931349156898216), UINT64_C(18446744073709551436),
+                              UINT64_C(                 683), UINT64_C(     900726277211781)),
+      simde_mm256_set_ps(SIMDE_FLOAT32_C(8279707386223001600.00), SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(17948659808768884736.00), SIMDE_FLOAT32_C(18446744073709551616.00),
+                         SIMDE_FLOAT32_C(5931349298905088.00), SIMDE_FLOAT32_C(18446744073709551616.00), SIMDE_FLOAT32_C(   683.00), SIMDE_FLOAT32_C(900726247129088.00)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256 r = simde_mm512_cvtepu64_ps(test_vec[i].a);
+    simde_assert_m256_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvtpd_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -182.49), SIMDE_FLOAT64_C( -654.00),
+                         SIMDE_FLOAT64_C(-1907125392086.00), SIMDE_FLOAT64_C(1752654349816550656.00),
+                         SIMDE_FLOAT64_C( -608.33), SIMDE_FLOAT64_C(  419.41),
+                         SIMDE_FLOAT64_C(  717.97), SIMDE_FLOAT64_C(39217777900706504704.00)),
+      simde_mm512_set_epi64(INT64_C(                -182), INT64_C(                -654),
+                            INT64_C(      -1907125392086), INT64_C( 1752654349816550656),
+                            INT64_C(                -608), INT64_C(                 419),
+                            INT64_C(                 718), INT64_MIN) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(522565137370338112.00), SIMDE_FLOAT64_C(415846285109072704.00),
+                         SIMDE_FLOAT64_C(33672184113580.00), SIMDE_FLOAT64_C(606715359946308608.00),
+                         SIMDE_FLOAT64_C( -392.59), SIMDE_FLOAT64_C(-54897510363359625216.00),
+                         SIMDE_FLOAT64_C(  737.18), SIMDE_FLOAT64_C( -332.81)),
+      simde_mm512_set_epi64(INT64_C(  522565137370338112), INT64_C(  415846285109072704),
+                            INT64_C(      33672184113580), INT64_C(  606715359946308608),
+                            INT64_C(                -393), INT64_MIN,
+                            INT64_C(                 737), INT64_C(                -333)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(31433251901601075200.00), SIMDE_FLOAT64_C(  -48.09),
+                         SIMDE_FLOAT64_C( -962.51), SIMDE_FLOAT64_C(  998.25),
+                         SIMDE_FLOAT64_C(33496546156944464.00), SIMDE_FLOAT64_C(1776701549708553472.00),
+                         SIMDE_FLOAT64_C(   -2.14), SIMDE_FLOAT64_C( -941.05)),
+      simde_mm512_set_epi64(INT64_MIN, INT64_C(                 -48),
+                            INT64_C(                -963), INT64_C(                 998),
+                            INT64_C(   33496546156944464), INT64_C( 1776701549708553472),
+                            INT64_C(                  -2), INT64_C(                -941)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  657.41), SIMDE_FLOAT64_C(20873845601509564.00),
+                         SIMDE_FLOAT64_C(   28.04), SIMDE_FLOAT64_C(  917.79),
+                         SIMDE_FLOAT64_C( -908.47), SIMDE_FLOAT64_C(73122893508184662016.00),
+                         SIMDE_FLOAT64_C( -805.79), SIMDE_FLOAT64_C(32397958623881.00)),
+      simde_mm512_set_epi64(INT64_C(                 657), INT64_C(   20873845601509564),
+                            INT64_C(                  28), INT64_C(                 918),
+                            INT64_C(                -908), INT64_MIN,
+                            INT64_C(                -806), INT64_C(      32397958623881)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(33960455839699283968.00), SIMDE_FLOAT64_C( -536.82),
+                         SIMDE_FLOAT64_C( -752.77), SIMDE_FLOAT64_C(  324.98),
+                         SIMDE_FLOAT64_C( -477.09), SIMDE_FLOAT64_C(200407350917760.00),
+                         SIMDE_FLOAT64_C(    5.31), SIMDE_FLOAT64_C(-12875827363449266176.00)),
+      simde_mm512_set_epi64(INT64_MIN, INT64_C(                -537),
+                            INT64_C(                -753), INT64_C(                 325),
+                            INT64_C(                -477), INT64_C(     200407350917760),
+                            INT64_C(                   5), INT64_MIN) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(1421174348614289.00), SIMDE_FLOAT64_C(    3.77),
+                         SIMDE_FLOAT64_C( -972.14), SIMDE_FLOAT64_C(   -5.02),
+                         SIMDE_FLOAT64_C(-66703426570533740544.00), SIMDE_FLOAT64_C(  282.81),
+                         SIMDE_FLOAT64_C( -496.95), SIMDE_FLOAT64_C(-22505027769925652480.00)),
+      simde_mm512_set_epi64(INT64_C(    1421174348614289), INT64_C(                   4),
+                            INT64_C(                -972), INT64_C(                  -5),
+                            INT64_MIN, INT64_C(                 283),
+                            INT64_C(                -497), INT64_MIN) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(-1686136693062550784.00), SIMDE_FLOAT64_C(32613843522318487552.00),
+                         SIMDE_FLOAT64_C(24181113674317.00), SIMDE_FLOAT64_C(15034369341038.00),
+                         SIMDE_FLOAT64_C(2986081962581831168.00), SIMDE_FLOAT64_C(69913160039359201280.00),
+                         SIMDE_FLOAT64_C(24306548893663.00), SIMDE_FLOAT64_C(16626533229367264.00)),
+      simde_mm512_set_epi64(INT64_C(-1686136693062550784), INT64_MIN,
+                            INT64_C(      24181113674317), INT64_C(      15034369341038),
+                            INT64_C( 2986081962581831168), INT64_MIN,
+                            INT64_C(      24306548893663), INT64_C(   16626533229367264)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  436.20), SIMDE_FLOAT64_C(8198158124184133632.00),
+                         SIMDE_FLOAT64_C(8629706432973799424.00), SIMDE_FLOAT64_C(-222005329347140128.00),
+                         SIMDE_FLOAT64_C(    5.80), SIMDE_FLOAT64_C(   -5.35),
+                         SIMDE_FLOAT64_C( -679.78), SIMDE_FLOAT64_C(  773.01)),
+      simde_mm512_set_epi64(INT64_C(                 436), INT64_C( 8198158124184133632),
+                            INT64_C( 8629706432973799424), INT64_C( -222005329347140128),
+                            INT64_C(                   6), INT64_C(                  -5),
+                            INT64_C(                -680), INT64_C(                 773)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_cvtpd_epi64(test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvtpd_epu64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(16775773506959584.00), SIMDE_FLOAT64_C(  658.84),
+                         SIMDE_FLOAT64_C(   54.49), SIMDE_FLOAT64_C(    7.17),
+                         SIMDE_FLOAT64_C(   13.08), SIMDE_FLOAT64_C( -408.26),
+                         SIMDE_FLOAT64_C(  695.25), SIMDE_FLOAT64_C(  -78.85)),
+      simde_x_mm512_set_epu64(UINT64_C(   16775773506959584), UINT64_C(                 659),
+                              UINT64_C(                  54), UINT64_C(                   7),
+                              UINT64_C(                  13), UINT64_C(18446744073709551615),
+                              UINT64_C(                 695), UINT64_C(18446744073709551615)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(4445890731022336.00), SIMDE_FLOAT64_C(    0.90),
+                         SIMDE_FLOAT64_C(   -0.44), SIMDE_FLOAT64_C(  303.34),
+                         SIMDE_FLOAT64_C(    9.62), SIMDE_FLOAT64_C(218276483783895.00),
+                         SIMDE_FLOAT64_C(35454876345117836.00), SIMDE_FLOAT64_C(    0.67)),
+      simde_x_mm512_set_epu64(UINT64_C(    4445890731022336), UINT64_C(                   1),
+                              UINT64_C(                   0), UINT64_C(                 303),
+                              UINT64_C(                  10), UINT64_C(     218276483783895),
+                              UINT64_C(   35454876345117836), UINT64_C(                   1)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  402.86), SIMDE_FLOAT64_C(10809792027193796608.00),
+                         SIMDE_FLOAT64_C(    7.26), SIMDE_FLOAT64_C(1710736100813710.00),
+                         SIMDE_FLOAT64_C(4090450958674947072.00), SIMDE_FLOAT64_C(  169.96),
+                         SIMDE_FLOAT64_C(44456653217640022016.00), SIMDE_FLOAT64_C(26227134749146.00)),
+      simde_x_mm512_set_epu64(UINT64_C(                 403), UINT64_C(10809792027193796608),
+                              UINT64_C(                   7), UINT64_C(    1710736100813710),
+                              UINT64_C( 4090450958674947072), UINT64_C(                 170),
+                              UINT64_C(18446744073709551615), UINT64_C(      26227134749146)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(   41.32), SIMDE_FLOAT64_C(779583427838582.00),
+                         SIMDE_FLOAT64_C(-7181778009223766016.00), SIMDE_FLOAT64_C(29164302380534800384.00),
+                         SIMDE_FLOAT64_C(    6.54), SIMDE_FLOAT64_C(  741.33),
+                         SIMDE_FLOAT64_C(  209.12), SIMDE_FLOAT64_C(9984495879691278.00)),
+      simde_x_mm512_set_epu64(UINT64_C(                  41), UINT64_C(     779583427838582),
+                              UINT64_C(18446744073709551615), UINT64_C(18446744073709551615),
+                              UINT64_C(                   7), UINT64_C(                 741),
+                              UINT64_C(                 209), UINT64_C(    9984495879691278)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    3.67), SIMDE_FLOAT64_C(-29775867729962148.00),
+                         SIMDE_FLOAT64_C(26323503793183531008.00), SIMDE_FLOAT64_C(35823576991143948288.00),
+                         SIMDE_FLOAT64_C(    8.33), SIMDE_FLOAT64_C(33978902583772995584.00),
+                         SIMDE_FLOAT64_C(24349702177296609280.00), SIMDE_FLOAT64_C(11861256439395241984.00)),
+      simde_x_mm512_set_epu64(UINT64_C(                   4), UINT64_C(18446744073709551615),
+                              UINT64_C(18446744073709551615), UINT64_C(18446744073709551615),
+                              UINT64_C(                   8), UINT64_C(18446744073709551615),
+                              UINT64_C(18446744073709551615), UINT64_C(11861256439395241984)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(   -7.07), SIMDE_FLOAT64_C(17954910575620868.00),
+                         SIMDE_FLOAT64_C(15403031301547474944.00), SIMDE_FLOAT64_C(541466569642371.00),
+                         SIMDE_FLOAT64_C(1800354205727822.00), SIMDE_FLOAT64_C(    7.83),
+                         SIMDE_FLOAT64_C(    1.39), SIMDE_FLOAT64_C(239074481456594.00)),
+      simde_x_mm512_set_epu64(UINT64_C(18446744073709551615), UINT64_C(   17954910575620868),
+                              UINT64_C(15403031301547474944), UINT64_C(     541466569642371),
+                              UINT64_C(    1800354205727822), UINT64_C(                   8),
+                              UINT64_C(                   1), UINT64_C(     239074481456594)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(4181186356968909.00), SIMDE_FLOAT64_C(    9.84),
+                         SIMDE_FLOAT64_C(    0.44), SIMDE_FLOAT64_C(37815825351104577536.00),
+                         SIMDE_FLOAT64_C(1866815771891551744.00), SIMDE_FLOAT64_C(25622565512039492.00),
+                         SIMDE_FLOAT64_C(    8.40), SIMDE_FLOAT64_C(    3.17)),
+      simde_x_mm512_set_epu64(UINT64_C(    4181186356968909), UINT64_C(                  10),
+                              UINT64_C(                   0), UINT64_C(18446744073709551615),
+                              UINT64_C( 1866815771891551744), UINT64_C(   25622565512039492),
+                              UINT64_C(                   8), UINT64_C(                   3)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    5.63), SIMDE_FLOAT64_C(    9.49),
+                         SIMDE_FLOAT64_C(    3.18), SIMDE_FLOAT64_C(62615045747552416.00),
+                         SIMDE_FLOAT64_C( -861.24), SIMDE_FLOAT64_C(    9.29),
+                         SIMDE_FLOAT64_C(    5.77), SIMDE_FLOAT64_C(-40361476033276502016.00)),
+      simde_x_mm512_set_epu64(UINT64_C(                   6), UINT64_C(                   9),
+                              UINT64_C(                   3), UINT64_C(   62615045747552416),
+                              UINT64_C(18446744073709551615), UINT64_C(                   9),
+                              UINT64_C(                   6), UINT64_C(18446744073709551615)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_cvtpd_epu64(test_vec[i].a);
+    simde_assert_m512i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvttpd_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    8.15), SIMDE_FLOAT64_C(58217924296627339264.00),
+                         SIMDE_FLOAT64_C(7274311076445822976.00), SIMDE_FLOAT64_C(890422277168882944.00),
+                         SIMDE_FLOAT64_C(221108072735470.00), SIMDE_FLOAT64_C(    5.50),
+                         SIMDE_FLOAT64_C(10016582032024287232.00), SIMDE_FLOAT64_C( -943.40)),
+      simde_mm512_set_epi64(INT64_C(                   8), INT64_MIN,
+                            INT64_C( 7274311076445822976), INT64_C(  890422277168882944),
+                            INT64_C(     221108072735470), INT64_C(                   5),
+                            INT64_MIN, INT64_C(                -943)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(87731321951432928.00), SIMDE_FLOAT64_C(31323253562794664.00),
+                         SIMDE_FLOAT64_C(33554627470077673472.00), SIMDE_FLOAT64_C(-93366626146736960.00),
+                         SIMDE_FLOAT64_C(600211604100084352.00), SIMDE_FLOAT64_C(21344556508835384.00),
+                         SIMDE_FLOAT64_C(-38959523483674574848.00), SIMDE_FLOAT64_C(90264165886228.00)),
+      simde_mm512_set_epi64(INT64_C(   87731321951432928), INT64_C(   31323253562794664),
+                            INT64_MIN, INT64_C(  -93366626146736960),
+                            INT64_C(  600211604100084352), INT64_C(   21344556508835384),
+                            INT64_MIN, INT64_C(      90264165886228)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.39), SIMDE_FLOAT64_C(-147139593646614.00),
+                         SIMDE_FLOAT64_C(-115744926153878528.00), SIMDE_FLOAT64_C(546957022238145.00),
+                         SIMDE_FLOAT64_C(-136241402311533.00), SIMDE_FLOAT64_C(-70429668873423069184.00),
+                         SIMDE_FLOAT64_C(203342089559813728.00), SIMDE_FLOAT64_C(752657807521495808.00)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(    -147139593646614),
+                            INT64_C( -115744926153878528), INT64_C(     546957022238145),
+                            INT64_C(    -136241402311533), INT64_MIN,
+                            INT64_C(  203342089559813728), INT64_C(  752657807521495808)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.72), SIMDE_FLOAT64_C( -693.18),
+                         SIMDE_FLOAT64_C(    6.10), SIMDE_FLOAT64_C(    5.55),
+                         SIMDE_FLOAT64_C(30870104947779596.00), SIMDE_FLOAT64_C(44493546705787437056.00),
+                         SIMDE_FLOAT64_C( -726.31), SIMDE_FLOAT64_C( -757.05)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                -693),
+                            INT64_C(                   6), INT64_C(                   5),
+                            INT64_C(   30870104947779596), INT64_MIN,
+                            INT64_C(                -726), INT64_C(                -757)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(-176847245404019072.00), SIMDE_FLOAT64_C(135114789862311.00),
+                         SIMDE_FLOAT64_C(  492.67), SIMDE_FLOAT64_C(  411.81),
+                         SIMDE_FLOAT64_C( -293.36), SIMDE_FLOAT64_C(  508.82),
+                         SIMDE_FLOAT64_C( -722.99), SIMDE_FLOAT64_C(  627.52)),
+      simde_mm512_set_epi64(INT64_C( -176847245404019072), INT64_C(     135114789862311),
+                            INT64_C(                 492), INT64_C(                 411),
+                            INT64_C(                -293), INT64_C(                 508),
+                            INT64_C(                -722), INT64_C(                 627)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(45378990421325496320.00), SIMDE_FLOAT64_C(53569344790052536320.00),
+                         SIMDE_FLOAT64_C(61796592646926999552.00), SIMDE_FLOAT64_C(16002550483943034880.00),
+                         SIMDE_FLOAT64_C(-198864636842860.00), SIMDE_FLOAT64_C( -103.94),
+                         SIMDE_FLOAT64_C(65817982854995681280.00), SIMDE_FLOAT64_C(   -2.39)),
+      simde_mm512_set_epi64(INT64_MIN, INT64_MIN,
+                            INT64_MIN, INT64_MIN,
+                            INT64_C(    -198864636842860), INT64_C(                -103),
+                            INT64_MIN, INT64_C(                  -2)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(9453956337776144384.00), SIMDE_FLOAT64_C(4945969605544088576.00),
+                         SIMDE_FLOAT64_C( -479.98), SIMDE_FLOAT64_C(36155618384470720512.00),
+                         SIMDE_FLOAT64_C(54491681993738010624.00), SIMDE_FLOAT64_C(   -5.58),
+                         SIMDE_FLOAT64_C(    1.04), SIMDE_FLOAT64_C(1260972782958600704.00)),
+      simde_mm512_set_epi64(INT64_MIN, INT64_C( 4945969605544088576),
+                            INT64_C(                -479), INT64_MIN,
+                            INT64_MIN, INT64_C(                  -5),
+                            INT64_C(                   1), INT64_C( 1260972782958600704)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(67119164301559.00), SIMDE_FLOAT64_C(-9463179709813000192.00),
+                         SIMDE_FLOAT64_C(108085625228687936.00), SIMDE_FLOAT64_C(29865278655335763968.00),
+                         SIMDE_FLOAT64_C(  935.32), SIMDE_FLOAT64_C(-65670408902406004736.00),
+                         SIMDE_FLOAT64_C(3552577071165492.00), SIMDE_FLOAT64_C(-57443161045531541504.00)),
+      simde_mm512_set_epi64(INT64_C(      67119164301559), INT64_MIN,
+                            INT64_C(  108085625228687936), INT64_MIN,
+                            INT64_C(                 935), INT64_MIN,
+                            INT64_C(    3552577071165492), INT64_MIN) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_cvttpd_epi64(test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_cvttpd_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-7385820768249470869), INT64_C(-6278408209462269313),
+                            INT64_C( 5873709508874703641), INT64_C( 8157912989310545604),
+                            INT64_C(-4046434926473027976), INT64_C(-2643701746747947146),
+                            INT64_C( 6127986281333799680), INT64_C( 8779188734637013685)),
+      UINT8_C(235),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -658.96), SIMDE_FLOAT64_C(-93939720420635056.00),
+                         SIMDE_FLOAT64_C(2948811516118498.00), SIMDE_FLOAT64_C(  379.38),
+                         SIMDE_FLOAT64_C(3898015507740072.00), SIMDE_FLOAT64_C(    4.49),
+                         SIMDE_FLOAT64_C(  583.13), SIMDE_FLOAT64_C(  767.83)),
+      simde_mm512_set_epi64(INT64_C(                -658), INT64_C(  -93939720420635056),
+                            INT64_C(    2948811516118498), INT64_C( 8157912989310545604),
+                            INT64_C(    3898015507740072), INT64_C(-2643701746747947146),
+                            INT64_C(                 583), INT64_C(                 767)) },
+    { simde_mm512_set_epi64(INT64_C(-7336661872914889398), INT64_C( 8303071617532264587),
+                            INT64_C(-1271618596780979554), INT64_C( 6021233831679133649),
+                            INT64_C( 8293567033243473211), INT64_C( 8743327035971807529),
+                            INT64_C(  947931701144191597), INT64_C(-4175206333386410110)),
+      UINT8_C(192),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-15499233689629282.00), SIMDE_FLOAT64_C(-31495974892790488.00),
+                         SIMDE_FLOAT64_C( -613.62), SIMDE_FLOAT64_C(4466674166188668.00),
+                         SIMDE_FLOAT64_C(   41.24), SIMDE_FLOAT64_C(  950.33),
+                         SIMDE_FLOAT64_C(-775115085446078.00), SIMDE_FLOAT64_C(    4.40)),
+      simde_mm512_set_epi64(INT64_C(  -15499233689629282), INT64_C(  -31495974892790488),
+                            INT64_C(-1271618596780979554), INT64_C( 6021233831679133649),
+                            INT64_C( 8293567033243473211), INT64_C( 8743327035971807529),
+                            INT64_C(  947931701144191597), INT64_C(-4175206333386410110)) },
+    { simde_mm512_set_epi64(INT64_C(-3714732743652500727), INT64_C( 6553564955160754682),
+                            INT64_C( -107025330429563677), INT64_C(-4309083164375311333),
+                            INT64_C( 4822000846346404764), INT64_C( 6186676098082971361),
+                            INT64_C( 3345164627464602149), INT64_C(-3770688076937243508)),
+      UINT8_C(127),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-14231663052866920448.00), SIMDE_FLOAT64_C(171996355134850.00),
+                         SIMDE_FLOAT64_C(  762.21), SIMDE_FLOAT64_C(  895.08),
+                         SIMDE_FLOAT64_C(144248174591931.00), SIMDE_FLOAT64_C(753762567454022912.00),
+                         SIMDE_FLOAT64_C(   -8.91), SIMDE_FLOAT64_C(462173405434952.00)),
+      simde_mm512_set_epi64(INT64_C(-3714732743652500727), INT64_C(     171996355134850),
+                            INT64_C(                 762), INT64_C(                 895),
+                            INT64_C(     144248174591931), INT64_C(  753762567454022912),
+                            INT64_C(                  -8), INT64_C(     462173405434952)) },
+    { simde_mm512_set_epi64(INT64_C(-7906419948865601874), INT64_C(-8288165702233111321),
+                            INT64_C(-2388827442293510978), INT64_C( 8844486079331882199),
+                            INT64_C(-2868066870244397493), INT64_C(-8274916361297280568),
+                            INT64_C( 1891765202681047257), INT64_C(-8488757546225557721)),
+      UINT8_C( 83),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -989.69), SIMDE_FLOAT64_C(-78334242963268.00),
+                         SIMDE_FLOAT64_C(-34550751650057990144.00), SIMDE_FLOAT64_C(7801867351881716.00),
+                         SIMDE_FLOAT64_C( -320.57), SIMDE_FLOAT64_C(-73565615365953691648.00),
+                         SIMDE_FLOAT64_C(-2208654729861895680.00), SIMDE_FLOAT64_C(  976.58)),
+      simde_mm512_set_epi64(INT64_C(-7906419948865601874), INT64_C(     -78334242963268),
+                            INT64_C(-2388827442293510978), INT64_C(    7801867351881716),
+                            INT64_C(-2868066870244397493), INT64_C(-8274916361297280568),
+                            INT64_C(-2208654729861895680), INT64_C(                 976)) },
+    { simde_mm512_set_epi64(INT64_C( -670905413429855306), INT64_C(-1129854660211493999),
+                            INT64_C(-8944425904398996471), INT64_C(-1663483031543335903),
+                            INT64_C( 6030573439572327382), INT64_C( 7334141617228310296),
+                            INT64_C( 7819450278326474792), INT64_C(-6625271921999205441)),
+      UINT8_C(193),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-558056542674674304.00), SIMDE_FLOAT64_C(9453956337776144384.00),
+                         SIMDE_FLOAT64_C(  443.93), SIMDE_FLOAT64_C(17985575471866812416.00),
+                         SIMDE_FLOAT64_C(490174464614637.00), SIMDE_FLOAT64_C( -183.64),
+                         SIMDE_FLOAT64_C(   -7.85), SIMDE_FLOAT64_C(15047805071148.00)),
+      simde_mm512_set_epi64(INT64_C( -558056542674674304), INT64_MIN,
+                            INT64_C(-8944425904398996471), INT64_C(-1663483031543335903),
+                            INT64_C( 6030573439572327382), INT64_C( 7334141617228310296),
+                            INT64_C( 7819450278326474792), INT64_C(      15047805071148)) },
+    { simde_mm512_set_epi64(INT64_C(-5567479777943419772), INT64_C(-6924966905260363942),
+                            INT64_C( 5994803226271641025), INT64_C( 8248174417874452414),
+                            INT64_C( 3760057019735486558), INT64_C( -349446829012525659),
+                            INT64_C( 8923674729435021734), INT64_C( 5083932685379704854)),
+      UINT8_C(141),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    9.94), SIMDE_FLOAT64_C(10044370333291824.00),
+                         SIMDE_FLOAT64_C(  772.04), SIMDE_FLOAT64_C( -698.31),
+                         SIMDE_FLOAT64_C(  843.88), SIMDE_FLOAT64_C(126413305173922352.00),
+                         SIMDE_FLOAT64_C(-18170042912603908096.00), SIMDE_FLOAT64_C(-332606751784415.00)),
+      simde_mm512_set_epi64(INT64_C(                   9), INT64_C(-6924966905260363942),
+                            INT64_C( 5994803226271641025), INT64_C( 8248174417874452414),
+                            INT64_C(                 843), INT64_C(  126413305173922352),
+                            INT64_C( 8923674729435021734), INT64_C(    -332606751784415)) },
+    { simde_mm512_set_epi64(INT64_C( -904786607971963180), INT64_C(-5195174033642834691),
+                            INT64_C(-6409052168740302628), INT64_C( 4759863811294686155),
+                            INT64_C( 7886099561425380419), INT64_C(-1750669254810243172),
+                            INT64_C(-2621795005446417606), INT64_C( 6486233306167414564)),
+      UINT8_C(  9),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   -9.32), SIMDE_FLOAT64_C(-52942155491546415104.00),
+                         SIMDE_FLOAT64_C(-14323896773235466240.00), SIMDE_FLOAT64_C(41759850683591136.00),
+                         SIMDE_FLOAT64_C(  997.86), SIMDE_FLOAT64_C(-56114995472224452608.00),
+                         SIMDE_FLOAT64_C(-26876906115394818048.00), SIMDE_FLOAT64_C(    2.23)),
+      simde_mm512_set_epi64(INT64_C( -904786607971963180), INT64_C(-5195174033642834691),
+                            INT64_C(-6409052168740302628), INT64_C( 4759863811294686155),
+                            INT64_C(                 997), INT64_C(-1750669254810243172),
+                            INT64_C(-2621795005446417606), INT64_C(                   2)) },
+    { simde_mm512_set_epi64(INT64_C(-6360767046613414255), INT64_C(-5498980297048851998),
+                            INT64_C( 6748044347423250252), INT64_C(  437114957602785695),
+                            INT64_C(-6927646622454693920), INT64_C( 1972390244000137570),
+                            INT64_C(-1456015915951350956), INT64_C( 7384325613331269273)),
+      UINT8_C( 76),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(46331380398906480.00), SIMDE_FLOAT64_C(28011208810566.00),
+                         SIMDE_FLOAT64_C(-1851759636980626432.00), SIMDE_FLOAT64_C(-239835098263585024.00),
+                         SIMDE_FLOAT64_C(1266846460582687488.00), SIMDE_FLOAT64_C(75253179345660928.00),
+                         SIMDE_FLOAT64_C( -713.27), SIMDE_FLOAT64_C(  590.16)),
+      simde_mm512_set_epi64(INT64_C(-6360767046613414255), INT64_C(      28011208810566),
+                            INT64_C( 6748044347423250252), INT64_C(  437114957602785695),
+                            INT64_C( 1266846460582687488), INT64_C(   75253179345660928),
+                            INT64_C(-1456015915951350956), INT64_C( 7384325613331269273)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_cvttpd_epi64(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_cvttpd_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(123),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(5718458847004358.00), SIMDE_FLOAT64_C(225276016723531776.00),
+                         SIMDE_FLOAT64_C( -509.40), SIMDE_FLOAT64_C(771296383241132.00),
+                         SIMDE_FLOAT64_C(512276920533957.00), SIMDE_FLOAT64_C(18363733725377859584.00),
+                         SIMDE_FLOAT64_C(  129.95), SIMDE_FLOAT64_C(  363.44)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(  225276016723531776),
+                            INT64_C(                -509), INT64_C(     771296383241132),
+                            INT64_C(     512276920533957), INT64_C(                   0),
+                            INT64_C(                 129), INT64_C(                 363)) },
+    { UINT8_C(223),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(-19756462902942928896.00), SIMDE_FLOAT64_C(-348288938662883.00),
+                         SIMDE_FLOAT64_C(-68917035859378880512.00), SIMDE_FLOAT64_C(   -8.52),
+                         SIMDE_FLOAT64_C( -404.96), SIMDE_FLOAT64_C(-23731430997539.00),
+                         SIMDE_FLOAT64_C( -534.47), SIMDE_FLOAT64_C(  671.13)),
+      simde_mm512_set_epi64(INT64_MIN, INT64_C(    -348288938662883),
+                            INT64_C(                   0), INT64_C(                  -8),
+                            INT64_C(                -404), INT64_C(     -23731430997539),
+                            INT64_C(                -534), INT64_C(                 671)) },
+    { UINT8_C(187),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.68), SIMDE_FLOAT64_C(  432.82),
+                         SIMDE_FLOAT64_C(   -6.69), SIMDE_FLOAT64_C(-31709953062706716672.00),
+                         SIMDE_FLOAT64_C(29869999862305.00), SIMDE_FLOAT64_C( -923.87),
+                         SIMDE_FLOAT64_C(11407012942899.00), SIMDE_FLOAT64_C( -256.81)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  -6), INT64_MIN,
+                            INT64_C(      29869999862305), INT64_C(                   0),
+                            INT64_C(      11407012942899), INT64_C(                -256)) },
+    { UINT8_C(105),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(2814089554760398336.00), SIMDE_FLOAT64_C(69625748575830.00),
+                         SIMDE_FLOAT64_C(  512.41), SIMDE_FLOAT64_C(31962344227007616.00),
+                         SIMDE_FLOAT64_C(-27780796575006584832.00), SIMDE_FLOAT64_C(    9.87),
+                         SIMDE_FLOAT64_C(  685.23), SIMDE_FLOAT64_C(   -2.13)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(      69625748575830),
+                            INT64_C(                 512), INT64_C(                   0),
+                            INT64_MIN, INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  -2)) },
+    { UINT8_C(200),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   -2.68), SIMDE_FLOAT64_C(  729.98),
+                         SIMDE_FLOAT64_C(13441619405081.00), SIMDE_FLOAT64_C(9010394166435521536.00),
+                         SIMDE_FLOAT64_C(156910691043213.00), SIMDE_FLOAT64_C(222301357588876576.00),
+                         SIMDE_FLOAT64_C(108570937917702944.00), SIMDE_FLOAT64_C(  285.97)),
+      simde_mm512_set_epi64(INT64_C(                  -2), INT64_C(                 729),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(     156910691043213), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(132),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(27780796575006584832.00), SIMDE_FLOAT64_C(    9.58),
+                         SIMDE_FLOAT64_C(  805.47), SIMDE_FLOAT64_C(-43497422525807124480.00),
+                         SIMDE_FLOAT64_C( -684.04), SIMDE_FLOAT64_C(   -4.01),
+                         SIMDE_FLOAT64_C(2541664888897651.00), SIMDE_FLOAT64_C(8377875089649751040.00)),
+      simde_mm512_set_epi64(INT64_MIN, INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  -4),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(118),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    9.07), SIMDE_FLOAT64_C( -504.71),
+                         SIMDE_FLOAT64_C(-7391845407512815616.00), SIMDE_FLOAT64_C(  578.99),
+                         SIMDE_FLOAT64_C(24278109311571.00), SIMDE_FLOAT64_C(   -7.45),
+                         SIMDE_FLOAT64_C(   -3.17), SIMDE_FLOAT64_C(  217.46)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                -504),
+                            INT64_C(-7391845407512815616), INT64_C(                 578),
+                            INT64_C(                   0), INT64_C(                  -7),
+                            INT64_C(                  -3), INT64_C(                   0)) },
+    { UINT8_C(102),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   39.54), SIMDE_FLOAT64_C( -531.54),
+                         SIMDE_FLOAT64_C(135061612490714.00), SIMDE_FLOAT64_C(   -4.69),
+                         SIMDE_FLOAT64_C(34515565935761324.00), SIMDE_FLOAT64_C(72237449792646602752.00),
+                         SIMDE_FLOAT64_C(  481.86), SIMDE_FLOAT64_C(-18428297329635842048.00)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                -531),
+                            INT64_C(     135061612490714), INT64_C(                   0),
+                            INT64_C(                   0), INT64_MIN,
+                            INT64_C(                 481), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_cvttpd_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_cvttpd_epu64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  461.22), SIMDE_FLOAT64_C(376737799433266752.00),
+                         SIMDE_FLOAT64_C(31174997484569141248.00), SIMDE_FLOAT64_C(11916596671616370688.00),
+                         SIMDE_FLOAT64_C(25438060077645471744.00), SIMDE_FLOAT64_C(44140246003468608.00),
+                         SIMDE_FLOAT64_C(  454.83), SIMDE_FLOAT64_C(14134081914260956.00)),
+      simde_x_mm512_set_epu64(UINT64_C(                 461), UINT64_C(  376737799433266752),
+                              UINT64_C(18446744073709551615), UINT64_C(11916596671616370688),
+                              UINT64_C(18446744073709551615), UINT64_C(   44140246003468608),
+                              UINT64_C(                 454), UINT64_C(   14134081914260956)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    7.89), SIMDE_FLOAT64_C(15117106768404977664.00),
+                         SIMDE_FLOAT64_C(68332169806667.00), SIMDE_FLOAT64_C(20586566386259861504.00),
+                         SIMDE_FLOAT64_C(14338024828193564.00), SIMDE_FLOAT64_C(12525339226048786432.00),
+                         SIMDE_FLOAT64_C(12802040387154427904.00), SIMDE_FLOAT64_C(71536473517845643264.00)),
+      simde_x_mm512_set_epu64(UINT64_C(                   7), UINT64_C(15117106768404977664),
+                              UINT64_C(      68332169806667), UINT64_C(18446744073709551615),
+                              UINT64_C(   14338024828193564), UINT64_C(12525339226048786432),
+                              UINT64_C(12802040387154427904), UINT64_C(18446744073709551615)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(3897029238563990.00), SIMDE_FLOAT64_C(13335494441786.00),
+                         SIMDE_FLOAT64_C(    6.32), SIMDE_FLOAT64_C(-170640646126061824.00),
+                         SIMDE_FLOAT64_C(16546733856447.00), SIMDE_FLOAT64_C(112851812997254.00),
+                         SIMDE_FLOAT64_C(57258693604794449920.00), SIMDE_FLOAT64_C(    9.97)),
+      simde_x_mm512_set_epu64(UINT64_C(    3897029238563990), UINT64_C(      13335494441786),
+                              UINT64_C(                   6), UINT64_C(18446744073709551615),
+                              UINT64_C(      16546733856447), UINT64_C(     112851812997254),
+                              UINT64_C(18446744073709551615), UINT64_C(                   9)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  542.13), SIMDE_FLOAT64_C(  -50.84),
+                         SIMDE_FLOAT64_C(    2.91), SIMDE_FLOAT64_C(  488.86),
+                         SIMDE_FLOAT64_C( -611.44), SIMDE_FLOAT64_C(  790.78),
+                         SIMDE_FLOAT64_C(409950437814089.00), SIMDE_FLOAT64_C(    9.74)),
+      simde_x_mm512_set_epu64(UINT64_C(                 542), UINT64_C(18446744073709551615),
+                              UINT64_C(                   2), UINT64_C(                 488),
+                              UINT64_C(18446744073709551615), UINT64_C(                 790),
+                              UINT64_C(     409950437814089), UINT64_C(                   9)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(1189243086707648.00), SIMDE_FLOAT64_C(-16731196874854563840.00),
+                         SIMDE_FLOAT64_C( -689.10), SIMDE_FLOAT64_C(  704.25),
+                         SIMDE_FLOAT64_C(178629857880441216.00), SIMDE_FLOAT64_C(  364.95),
+                         SIMDE_FLOAT64_C(28407985873512710144.00), SIMDE_FLOAT64_C(24384551303393.00)),
+      simde_x_mm512_set_epu64(UINT64_C(    1189243086707648), UINT64_C(18446744073709551615),
+                              UINT64_C(18446744073709551615), UINT64_C(                 704),
+                              UINT64_C(  178629857880441216), UINT64_C(                 364),
+                              UINT64_C(18446744073709551615), UINT64_C(      24384551303393)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -322.26), SIMDE_FLOAT64_C(2298507476780627200.00),
+                         SIMDE_FLOAT64_C(11270960629036535808.00), SIMDE_FLOAT64_C(16390954975445.00),
+                         SIMDE_FLOAT64_C(7878495143702036.00), SIMDE_FLOAT64_C(375101049976722496.00),
+                         SIMDE_FLOAT64_C(-9251042152965339136.00), SIMDE_FLOAT64_C(23190080411846.00)),
+      simde_x_mm512_set_epu64(UINT64_C(18446744073709551615), UINT64_C( 2298507476780627200),
+                              UINT64_C(11270960629036535808), UINT64_C(      16390954975445),
+                              UINT64_C(    7878495143702036), UINT64_C(  375101049976722496),
+                              UINT64_C(18446744073709551615), UINT64_C(      23190080411846)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(66408278665354387456.00), SIMDE_FLOAT64_C(  920.70),
+                         SIMDE_FLOAT64_C(13886423429353780.00), SIMDE_FLOAT64_C(  152.48),
+                         SIMDE_FLOAT64_C(    9.51), SIMDE_FLOAT64_C(1787014681099491.00),
+                         SIMDE_FLOAT64_C(56336356401108975616.00), SIMDE_FLOAT64_C(  407.94)),
+      simde_x_mm512_set_epu64(UINT64_C(18446744073709551615), UINT64_C(                 920),
+                              UINT64_C(   13886423429353780), UINT64_C(                 152),
+                              UINT64_C(                   9), UINT64_C(    1787014681099491),
+                              UINT64_C(18446744073709551615), UINT64_C(                 407)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(62977184267644403712.00), SIMDE_FLOAT64_C(130480463809767.00),
+                         SIMDE_FLOAT64_C(45283822908361200.00), SIMDE_FLOAT64_C(16436048969675210752.00),
+                         SIMDE_FLOAT64_C( -253.78), SIMDE_FLOAT64_C(-8618457437812.00),
+                         SIMDE_FLOAT64_C(  548.90), SIMDE_FLOAT64_C(  130.69)),
+      simde_x_mm512_set_epu64(UINT64_C(18446744073709551615), UINT64_C(     130480463809767),
+                              UINT64_C(   45283822908361200), UINT64_C(16436048969675210752),
+                              UINT64_C(18446744073709551615), UINT64_C(18446744073709551615),
+                              UINT64_C(                 548), UINT64_C(                 130)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_cvttpd_epu64(test_vec[i].a);
+    simde_assert_m512i_u64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_fpclass_ps_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__mmask16 r[8];
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(          0), INT32_C(   -8388608), INT32_C(   -6856029), INT32_C(   -3255471),
+                            INT32_C(          0), INT32_C(-2147483648), INT32_C(          0), INT32_C( 2147258926),
+                            INT32_C(   -6073203), INT32_C(   -8388608), INT32_C( 2140027351), INT32_C(   -1741738),
+                            INT32_C(    4581693), INT32_C(    5760975), INT32_C(   -4008809), INT32_C(-1576420811)),
+      { UINT16_C( 4370), UINT16_C(35328), UINT16_C( 1024), UINT16_C(    0),
+        UINT16_C(16448), UINT16_C(   12), UINT16_C(    1), UINT16_C( 8352) } },
+    { simde_mm512_set_epi32(INT32_C(          0), INT32_C(    4634923), INT32_C(    4593793), INT32_C(  279250980),
+                            INT32_C(-1214545253), INT32_C(    8172265), INT32_C(  995080913), INT32_C(          0),
+                            INT32_C(    6164125), INT32_C( 2139095040), INT32_C(     952973), INT32_C( 2140301869),
+                            INT32_C( 1455950229), INT32_C(          0), INT32_C(-2147483648), INT32_C(   -6686285)),
+      { UINT16_C(    0), UINT16_C(33028), UINT16_C(    2), UINT16_C(   64),
+        UINT16_C(    0), UINT16_C(25760), UINT16_C( 2048), UINT16_C(   17) } },
+    { simde_mm512_set_epi32(INT32_C(-1898477166), INT32_C(          0), INT32_C(-2147483648), INT32_C(     805925),
+                            INT32_C( 2141190421), INT32_C(-2147483648), INT32_C(   -3221854), INT32_C(   -1133783),
+                            INT32_C(-2050380509), INT32_C(-2143203379), INT32_C(   -8388608), INT32_C(-1693219517),
+                            INT32_C(   -7815427), INT32_C(-2143310375), INT32_C( 2144587055), INT32_C(    2991685)),
+      { UINT16_C(  770), UINT16_C(16384), UINT16_C( 9216), UINT16_C(    0),
+        UINT16_C(   32), UINT16_C( 4165), UINT16_C(32980), UINT16_C( 2056) } },
+    { simde_mm512_set_epi32(INT32_C( 2054398187), INT32_C(          0), INT32_C(  974199340), INT32_C( 2141084999),
+                            INT32_C(-1417402778), INT32_C(-1635838044), INT32_C(-2145674239), INT32_C( 2143423230),
+                            INT32_C(   -1747380), INT32_C( 1294574500), INT32_C(    3215885), INT32_C(-1471478162),
+                            INT32_C( 2141475575), INT32_C(   -8388608), INT32_C(   -8388608), INT32_C(   -5316083)),
+      { UINT16_C(  384), UINT16_C(16384), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    6), UINT16_C(  544), UINT16_C( 3600), UINT16_C( 4105) } },
+    { simde_mm512_set_epi32(INT32_C(  724493276), INT32_C(-2143797831), INT32_C(-2145039401), INT32_C(  383118161),
+                            INT32_C(          0), INT32_C( -995003409), INT32_C(  426415238), INT32_C( 2139095040),
+                            INT32_C(-2018652515), INT32_C(          0), INT32_C(   -8388608), INT32_C( 1585232765),
+                            INT32_C(   -3286019), INT32_C(-2147483648), INT32_C( 2139095040), INT32_C(    6861819)),
+      { UINT16_C(    8), UINT16_C( 2112), UINT16_C(    4), UINT16_C(  258),
+        UINT16_C(   32), UINT16_C(24577), UINT16_C(25728), UINT16_C(    0) } },
+    { simde_mm512_set_epi32(INT32_C(    -262943), INT32_C( 2107023804), INT32_C(  274783717), INT32_C( 2142113799),
+                            INT32_C(    2879351), INT32_C( 2139852653), INT32_C(  729118790), INT32_C(-2139506587),
+                            INT32_C(    5950105), INT32_C( 2145904750), INT32_C(-2147483648), INT32_C(-2122965574),
+                            INT32_C(          0), INT32_C( 2139095040), INT32_C(     461367), INT32_C(-2141476891)),
+      { UINT16_C(32832), UINT16_C(    8), UINT16_C(   32), UINT16_C(    4),
+        UINT16_C(    0), UINT16_C( 2435), UINT16_C(  273), UINT16_C( 5120) } },
+    { simde_mm512_set_epi32(INT32_C( 1452645132), INT32_C(-2147483648), INT32_C(   -3345192), INT32_C(          0),
+                            INT32_C( 2139815229), INT32_C( -506282996), INT32_C(  808237698), INT32_C(   -8388608),
+                            INT32_C( 2141723983), INT32_C(-2142747007), INT32_C( 2139095040), INT32_C(  201170200),
+                            INT32_C(    1772745), INT32_C(   -8388608), INT32_C( 2139095040), INT32_C( 2146501140)),
+      { UINT16_C( 8193), UINT16_C( 4096), UINT16_C(16384), UINT16_C(   34),
+        UINT16_C(  260), UINT16_C(   72), UINT16_C( 1088), UINT16_C( 2176) } },
+    { simde_mm512_set_epi32(INT32_C(    3296325), INT32_C(  283079319), INT32_C(    2742591), INT32_C(   -2046253),
+                            INT32_C(   -8388608), INT32_C( 2144573890), INT32_C(    3234479), INT32_C(  862365282),
+                            INT32_C( 2144295663), INT32_C(    5063663), INT32_C( 2142152589), INT32_C( 2139650025),
+                            INT32_C(   -8388608), INT32_C(          0), INT32_C(-2146928873), INT32_C(  752408306)),
+      { UINT16_C( 5248), UINT16_C(    4), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C( 2056), UINT16_C(41538), UINT16_C(    2), UINT16_C(   48) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 a = simde_mm512_castsi512_ps(test_vec[i].a);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x01), ==, test_vec[i].r[0]);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x02), ==, test_vec[i].r[1]);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x04), ==, test_vec[i].r[2]);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x08), ==, test_vec[i].r[3]);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x10), ==, test_vec[i].r[4]);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x20), ==, test_vec[i].r[5]);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x40), ==, test_vec[i].r[6]);
+    simde_assert_mmask16(simde_mm512_fpclass_ps_mask(a, 0x80), ==, test_vec[i].r[7]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_fpclass_pd_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__mmask8 r[8];
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-3258044441087757974), INT64_C(-9223270393501484801),
+                            INT64_C(   -2687899829816411), INT64_C( 2880140690679219110),
+                            INT64_MIN, INT64_C( 9222268381056305052),
+                            INT64_C( -633962724938628070), INT64_C(   -1716361833777035)),
+      { UINT8_C(  5), UINT8_C(  0), UINT8_C(  8), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(194), UINT8_C( 32) } },
+    { simde_mm512_set_epi64(INT64_C(-9221745675219343419), INT64_C(   -4503599627370496),
+                            INT64_C( 4022228352873203993), INT64_C( 4192225523973791677),
+                            INT64_C( 9218868437227405312), INT64_C( 8282285321114052501),
+                            INT64_C(   -4003478319175751), INT64_C( 9219603014722703233)),
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  8), UINT8_C( 64), UINT8_C(128), UINT8_C(128), UINT8_C(  3) } },
+    { simde_mm512_set_epi64(INT64_C( 3311562671503893367), INT64_C(                   0),
+                            INT64_C(   -1911385965961853), INT64_C(-8074676018431585535),
+                            INT64_C(   -4503599627370496), INT64_C( 7088348344025905217),
+                            INT64_MIN, INT64_C(   -3118252788469321)),
+      { UINT8_C( 32), UINT8_C( 64), UINT8_C(  2), UINT8_C(  0), UINT8_C(  8), UINT8_C(  0), UINT8_C( 16), UINT8_C(  1) } },
+    { simde_mm512_set_epi64(INT64_C(   -4503599627370496), INT64_C(-9221134504528837655),
+                            INT64_C(  582864089108852110), INT64_C(   -4503599627370496),
+                            INT64_C(                   0), INT64_C(-9219960933413045545),
+                            INT64_C( -360388722825704183), INT64_MIN),
+      { UINT8_C(  0), UINT8_C(  8), UINT8_C(  1), UINT8_C(  0), UINT8_C(144), UINT8_C( 68), UINT8_C( 70), UINT8_C(  0) } },
+    { simde_mm512_set_epi64(INT64_C( 6299046151572357570), INT64_C(                   0),
+                            INT64_C( 3008843455631392767), INT64_MIN,
+                            INT64_C(-9220594584315622355), INT64_C(-4941080042322155973),
+                            INT64_C(   -1766067733067274), INT64_C( 9218868437227405312)),
+      { UINT8_C(  2), UINT8_C( 64), UINT8_C( 16), UINT8_C(  1), UINT8_C(  0), UINT8_C(  8), UINT8_C( 12), UINT8_C(  0) } },
+    { simde_mm512_set_epi64(INT64_C(   -3349660371517111), INT64_C( 9219079312472712291),
+                            INT64_C(-8967910849941518312), INT64_C(-6642089266136376848),
+                            INT64_C( 3618600600249540413), INT64_C(   -2558577936828717),
+                            INT64_C( 9221967494791459288), INT64_C(-9221976274063377209)),
+      { UINT8_C(  2), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  1), UINT8_C( 49), UINT8_C(196) } },
+    { simde_mm512_set_epi64(INT64_C(   -4503599627370496), INT64_C(   -4503599627370496),
+                            INT64_C( 9218868437227405312), INT64_C(    -492257993547958),
+                            INT64_C( 9218868437227405312), INT64_C( 9219242376410836945),
+                            INT64_MIN, INT64_C(   -2074184598760536)),
+      { UINT8_C( 17), UINT8_C(  0), UINT8_C(  2), UINT8_C( 40), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(  4) } },
+    { simde_mm512_set_epi64(INT64_C(     -35386137067619), INT64_C( -109798354193907560),
+                            INT64_C(-7859918719155350661), INT64_C( 8153063093240716168),
+                            INT64_C(   -4503599627370496), INT64_C(-2934553308270765503),
+                            INT64_C( 4533753964507525254), INT64_MIN),
+      { UINT8_C(128), UINT8_C(  0), UINT8_C(  1), UINT8_C(  0), UINT8_C(  8), UINT8_C(  0), UINT8_C(100), UINT8_C(  0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d a = simde_mm512_castsi512_pd(test_vec[i].a);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x01), ==, test_vec[i].r[0]);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x02), ==, test_vec[i].r[1]);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x04), ==, test_vec[i].r[2]);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x08), ==, test_vec[i].r[3]);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x10), ==, test_vec[i].r[4]);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x20), ==, test_vec[i].r[5]);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x40), ==, test_vec[i].r[6]);
+    simde_assert_mmask8(simde_mm512_fpclass_pd_mask(a, 0x80), ==, test_vec[i].r[7]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_fpclass_pd_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { UINT8_C( 41),
+      simde_mm512_set_epi64(INT64_C( 5745955863877670727), INT64_C(    1453307417410259),
+                            INT64_C(    -339107682597530), INT64_C(   -2699949581538729),
+                            INT64_C( 4700360748060348578), INT64_C(   -3289494092637801),
+                            INT64_C( 9219990611402522657), INT64_C(    1040617804003847)),
+      UINT8_C( 32) },
+    { UINT8_C( 80),
+      simde_mm512_set_epi64(INT64_C( 9220574755619831889), INT64_C(    -498073375448768),
+                            INT64_C(   -4503599627370496), INT64_C(    2657740565102141),
+                            INT64_C(   -4503599627370496), INT64_C(   -1179607899600976),
+                            INT64_C(    2627982524115345), INT64_C(   -4503599627370496)),
+      UINT8_C( 64) },
+    { UINT8_C(140),
+      simde_mm512_set_epi64(INT64_C( 9221647984709116553), INT64_C(-1154743778476428671),
+                            INT64_C( 1624642070360337535), INT64_C(     617851722761531),
+                            INT64_C(   -1955174129287721), INT64_C(-5568476245884819052),
+                            INT64_C(   -4503599627370496), INT64_C( 6597769199753572822)),
+      UINT8_C(136) },
+    { UINT8_C( 15),
+      simde_mm512_set_epi64(INT64_C( 9218868437227405312), INT64_C(-2756764938594430882),
+                            INT64_C(-6756483177331438092), INT64_MIN,
+                            INT64_C( 9221709396454580638), INT64_MIN,
+                            INT64_C(-5001082137999864281), INT64_C(-6149645817237019299)),
+      UINT8_C(  8) },
+    { UINT8_C(225),
+      simde_mm512_set_epi64(INT64_C( 4204085497063352496), INT64_C(                   0),
+                            INT64_C(   -2549902811609057), INT64_C( 2808338380808659142),
+                            INT64_C(                   0), INT64_C(-9221375004867764131),
+                            INT64_C(   -1241554949448691), INT64_C(-5643000404354954625)),
+      UINT8_C( 32) },
+    { UINT8_C(162),
+      simde_mm512_set_epi64(INT64_C(-4352679444154634307), INT64_C(-6845384842465259894),
+                            INT64_C(   -4353745806323125), INT64_MIN,
+                            INT64_C(-9220248972694365339), INT64_C( 9222128415017622029),
+                            INT64_C(-9213191166058410128), INT64_C( 3401142758911772900)),
+      UINT8_C( 32) },
+    { UINT8_C(189),
+      simde_mm512_set_epi64(INT64_C(    -767990423275316), INT64_C( 5210204564173306409),
+                            INT64_C(    3526160442251367), INT64_C( 9222711764781949016),
+                            INT64_C( 4353922182398095243), INT64_C( 9134200214298391715),
+                            INT64_C(   -4503599627370496), INT64_C(-9220479660517925183)),
+      UINT8_C(144) },
+    { UINT8_C(160),
+      simde_mm512_set_epi64(INT64_C( 9219174107744570167), INT64_C(-2510793160388963407),
+                            INT64_C(-6877054596089697064), INT64_MIN,
+                            INT64_C(-9221641823350423391), INT64_C(-9221819252567486135),
+                            INT64_C(-8684747546354704311), INT64_C(  299446102779154733)),
+      UINT8_C(128) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_mm512_mask_fpclass_pd_mask(test_vec[i].k, simde_mm512_castsi512_pd(test_vec[i].a), 0x99);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_movepi32_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__mmask16 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(  337074973), INT32_C(-1172051027), INT32_C( -674365102), INT32_C( 1098295615),
+                            INT32_C( 1357792436), INT32_C(-1831673285), INT32_C(  586483502), INT32_C( 2048900353),
+                            INT32_C(  182530873), INT32_C(-1042923971), INT32_C( -812997386), INT32_C(  582416147),
+                            INT32_C(-1799287691), INT32_C( 2000483316), INT32_C(  671041749), INT32_C( 1982741709)),
+      UINT16_C(25704) },
+    { simde_mm512_set_epi32(INT32_C(-1648324470), INT32_C( -399714617), INT32_C( -927785512), INT32_C(-1342037437),
+                            INT32_C(  241269129), INT32_C( 1871403059), INT32_C(-1181625724), INT32_C(-1292448145),
+                            INT32_C( 1931915966), INT32_C( -174190862), INT32_C(-1223684490), INT32_C(-1944292588),
+                            INT32_C(  620314269), INT32_C(-1930481548), INT32_C( -175576016), INT32_C(-1163073734)),
+      UINT16_C(62327) },
+    { simde_mm512_set_epi32(INT32_C(-1449035577), INT32_C( 1566225377), INT32_C(  -22385655), INT32_C(-1169683141),
+                            INT32_C( 1199506305), INT32_C(-1937736256), INT32_C( -103603038), INT32_C( 1059995389),
+                            INT32_C(-1102043369), INT32_C(  480430066), INT32_C(-1770957981), INT32_C( 1148218664),
+                            INT32_C(-1675189236), INT32_C(  728481687), INT32_C( 1390851639), INT32_C( -783950166)),
+      UINT16_C(46761) },
+    { simde_mm512_set_epi32(INT32_C(  389232672), INT32_C( 1371181089), INT32_C( 2022099621), INT32_C(-1403773026),
+                            INT32_C( -478014099), INT32_C(  871645089), INT32_C(-1385514762), INT32_C( -504240146),
+                            INT32_C(  541205977), INT32_C(-1697798683), INT32_C(-1499707035), INT32_C( 2080176534),
+                            INT32_C(-1469187402), INT32_C(-1585916165), INT32_C( 1193362987), INT32_C( 1857871558)),
+      UINT16_C( 7020) },
+    { simde_mm512_set_epi32(INT32_C(  -99136659), INT32_C(-2031728304), INT32_C( -796954998), INT32_C(-2002451045),
+                            INT32_C(  745634442), INT32_C(-1683016137), INT32_C(-1381671352), INT32_C(-1629850148),
+                            INT32_C(  761217860), INT32_C(-1007283019), INT32_C( 1362265274), INT32_C( -873628210),
+                            INT32_C(-1903644199), INT32_C(-1808217445), INT32_C( -936311040), INT32_C(-1220817599)),
+      UINT16_C(63327) },
+    { simde_mm512_set_epi32(INT32_C(-1951735558), INT32_C( 1304811933), INT32_C(-1331166396), INT32_C(  -70520322),
+                            INT32_C(-1946491565), INT32_C(-1159338253), INT32_C( 1169083936), INT32_C(-2042032109),
+                            INT32_C(-1519964760), INT32_C( 1490864512), INT32_C(-1736817415), INT32_C(-1605607876),
+                            INT32_C(  -22742531), INT32_C(-1614524703), INT32_C(  265311457), INT32_C(-1898458686)),
+      UINT16_C(48573) },
+    { simde_mm512_set_epi32(INT32_C( 1590719678), INT32_C(  228145899), INT32_C( -214620082), INT32_C(-1398072356),
+                            INT32_C(-1859454320), INT32_C(-1455755776), INT32_C(  139316854), INT32_C( -974059504),
+                            INT32_C(-2071841004), INT32_C(-1672768972), INT32_C( 1311907864), INT32_C(  671947207),
+                            INT32_C( 1938856696), INT32_C(-1749777980), INT32_C( 1379542055), INT32_C( 1506252142)),
+      UINT16_C(15812) },
+    { simde_mm512_set_epi32(INT32_C(-1198437259), INT32_C(  453213746), INT32_C( 2018387596), INT32_C( -630854034),
+                            INT32_C(  418494706), INT32_C( 1730838034), INT32_C( 2020862633), INT32_C( 1309158539),
+                            INT32_C( -944654264), INT32_C( 1840528380), INT32_C(-1011818255), INT32_C(-1944347322),
+                            INT32_C(-1678110169), INT32_C(  281992826), INT32_C(  606690116), INT32_C(-1808936354)),
+      UINT16_C(37049) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask16 r = simde_mm512_movepi32_mask(test_vec[i].a);
+    simde_assert_mmask16(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_movepi64_mask(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__mmask8 r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 5690261351294303658), INT64_C(-5237087495701877827),
+                            INT64_C( 2867748933815450820), INT64_C( -320225047303346930),
+                            INT64_C(-3333037910011848735), INT64_C(-6512698567822670549),
+                            INT64_C(-1396106114957506906), INT64_C( 3579073704114566222)),
+      UINT8_C( 94) },
+    { simde_mm512_set_epi64(INT64_C(  681098976094300169), INT64_C(-3593848389030714109),
+                            INT64_C( -953184440779324857), INT64_C( 2372134815950287014),
+                            INT64_C( -161134012238924657), INT64_C(-4685629698414876450),
+                            INT64_C(-1715632211724599520), INT64_C(-5867147872530999087)),
+      UINT8_C(111) },
+    { simde_mm512_set_epi64(INT64_C(-5877950581484501899), INT64_C(-2560195321420171687),
+                            INT64_C(-8721468513789366715), INT64_C(-8318050578178914092),
+                            INT64_C( 4550826919818912272), INT64_C( 6272259069348289576),
+                            INT64_C(  193089520509953443), INT64_C(  332268759414701337)),
+      UINT8_C(240) },
+    { simde_mm512_set_epi64(INT64_C(-5127388903413099862), INT64_C(-4613257663229548103),
+                            INT64_C(-8594891626448248001), INT64_C(-2134639518193655936),
+                            INT64_C( 1442223599763287644), INT64_C( 6423762323088509004),
+                            INT64_C(-4638123265434484660), INT64_C( 3741689570004818109)),
+      UINT8_C(242) },
+    { simde_mm512_set_epi64(INT64_C( 7229963167667608535), INT64_C( 8362293313705262508),
+                            INT64_C( 5066343203892318195), INT64_C( 3560170675451921983),
+                            INT64_C( 5704506471053973583), INT64_C(-7146254631290026048),
+                            INT64_C( 6964536673283059486), INT64_C(-8822424988462995313)),
+      UINT8_C(  5) },
+    { simde_mm512_set_epi64(INT64_C(-2462317579407865295), INT64_C(-2107282797690796161),
+                            INT64_C(-6021822421756689861), INT64_C(-4940044779106265966),
+                            INT64_C( -354361556586958669), INT64_C(-6257640260052005202),
+                            INT64_C(-5612957916387208755), INT64_C(-7648837019413006688)),
+      UINT8_C(255) },
+    { simde_mm512_set_epi64(INT64_C( 1732542068507699261), INT64_C( 7961472109694212939),
+                            INT64_C(  252077129673206684), INT64_C(-4792747214856779571),
+                            INT64_C(-8263146591129775067), INT64_C(-3752660022185571469),
+                            INT64_C( 1673681297274777262), INT64_C( -145283567088761371)),
+      UINT8_C( 29) },
+    { simde_mm512_set_epi64(INT64_C(-7920346218509686076), INT64_C( 6111260857115863060),
+                            INT64_C(  886357827145480292), INT64_C( -823434158273438055),
+                            INT64_C( 4394745361692006068), INT64_C( 2285806403975156498),
+                            INT64_C(-9203950758825632726), INT64_C( -644565464047262803)),
+      UINT8_C(147) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__mmask8 r = simde_mm512_movepi64_mask(test_vec[i].a);
+    simde_assert_mmask8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_movm_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C( 9617),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(         -1), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         -1), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         -1)) },
+    { UINT16_C(53658),
+      simde_mm512_set_epi32(INT32_C(         -1), INT32_C(         -1), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(         -1), INT32_C(          0)) },
+    { UINT16_C( 3769),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         -1), INT32_C(         -1), INT32_C(         -1), INT32_C(          0),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(         -1), INT32_C(         -1),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(         -1)) },
+    { UINT16_C(42724),
+      simde_mm512_set_epi32(INT32_C(         -1), INT32_C(          0), INT32_C(         -1), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         -1), INT32_C(         -1), INT32_C(          0),
+                            INT32_C(         -1), INT32_C(         -1), INT32_C(         -1), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         -1), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(45225),
+      simde_mm512_set_epi32(INT32_C(         -1), INT32_C(          0), INT32_C(         -1), INT32_C(         -1),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(         -1), INT32_C(          0),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(         -1)) },
+    { UINT16_C(31112),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(         -1), INT32_C(         -1), INT32_C(         -1),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(19835),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(         -1), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         -1), INT32_C(         -1), INT32_C(          0), INT32_C(         -1),
+                            INT32_C(          0), INT32_C(         -1), INT32_C(         -1), INT32_C(         -1),
+                            INT32_C(         -1), INT32_C(          0), INT32_C(         -1), INT32_C(         -1)) },
+    { UINT16_C(49953),
+      simde_mm512_set_epi32(INT32_C(         -1), INT32_C(         -1), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         -1), INT32_C(         -1),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         -1), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         -1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_movm_epi32(test_vec[i].k);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_movm_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(231),
+      simde_mm512_set_epi64(INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                  -1)) },
+    { UINT8_C(246),
+      simde_mm512_set_epi64(INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                   0)) },
+    { UINT8_C( 85),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                  -1)) },
+    { UINT8_C(101),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                  -1)) },
+    { UINT8_C(255),
+      simde_mm512_set_epi64(INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                  -1)) },
+    { UINT8_C(244),
+      simde_mm512_set_epi64(INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C( 65),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  -1)) },
+    { UINT8_C(101),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                  -1), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  -1),
+                            INT64_C(                   0), INT64_C(                  -1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_movm_epi64(test_vec[i].k);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mullo_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(                -350), INT64_C( 8078027716175421974),
+                            INT64_C(   -5378740291040934), INT64_C(-6099067989902308485),
+                            INT64_C(                 852), INT64_C(   11507630996342433),
+                            INT64_C(                -741), INT64_C(    5879997858648613)),
+      simde_mm512_set_epi64(INT64_C(                 776), INT64_C(   -4890712301938581),
+                            INT64_C(    7993405598124392), INT64_C(   -5304605609304862),
+                            INT64_C(    3548269568134535), INT64_C( 4166459058683108086),
+                            INT64_C(    -514418810001105), INT64_C(  594961194573943696)),
+      simde_mm512_set_epi64(INT64_C(             -271600), INT64_C(  970032808548994866),
+                            INT64_C( 5520364200235595408), INT64_C( 5348788212313511574),
+                            INT64_C( 3023125672050623820), INT64_C(-5455585570226964298),
+                            INT64_C(  381184338210818805), INT64_C(-5835607041503743024)) },
+    { simde_mm512_set_epi64(INT64_C(-1662357087563997643), INT64_C(                 354),
+                            INT64_C(                 591), INT64_C(                -925),
+                            INT64_C(               55205), INT64_C(   -1556248671397912),
+                            INT64_C(       5152232620458), INT64_C(    3742642079306768)),
+      simde_mm512_set_epi64(INT64_C(    -424774824525616), INT64_C(                 109),
+                            INT64_C(                -300), INT64_C(         23516513793),
+                            INT64_C(            35070285), INT64_C(   -5253743029621543),
+                            INT64_C(    6505750989050082), INT64_C(       6915616906754)),
+      simde_mm512_set_epi64(INT64_C( 1421399561100856080), INT64_C(               38586),
+                            INT64_C(             -177300), INT64_C(     -21752775258525),
+                            INT64_C(       1936055083425), INT64_C(-2060634305102453848),
+                            INT64_C( 1733469941683689492), INT64_C( 7028485124666886176)) },
+    { simde_mm512_set_epi64(INT64_C( 1024458967392452956), INT64_C(                 139),
+                            INT64_C(-4694751267168478944), INT64_C(    -237167567019349),
+                            INT64_C(-5949826621079917257), INT64_C( 2276587189574690304),
+                            INT64_C( -649689143296879709), INT64_C(   -1487479449361417)),
+      simde_mm512_set_epi64(INT64_C(    8087509200002983), INT64_C(   -2680152608278229),
+                            INT64_C(-2429860681690331978), INT64_C(                 346),
+                            INT64_C(                -581), INT64_C(   -3772202272531796),
+                            INT64_C(       6812103601268), INT64_C(                -949)),
+      simde_mm512_set_epi64(INT64_C( 6303288664925406980), INT64_C( -372541212550673831),
+                            INT64_C(-5621709241751741248), INT64_C(  -82059978188694754),
+                            INT64_C( 7308125063745774125), INT64_C( -253023557604177920),
+                            INT64_C( 2994988926461422044), INT64_C( 1411617997443984733)) },
+    { simde_mm512_set_epi64(INT64_C(             1016204), INT64_C(  549774776776289206),
+                            INT64_C( 6435127273201873883), INT64_C(   -1722497830123035),
+                            INT64_C(                 912), INT64_C(                  39),
+                            INT64_C(                  58), INT64_C(      22208409529130)),
+      simde_mm512_set_epi64(INT64_C(        824022231558), INT64_C(        498213209727),
+                            INT64_C(                -961), INT64_C(    5645910710707447),
+                            INT64_C(   -5147998854538362), INT64_C(   -1023232489451401),
+                            INT64_C(                -724), INT64_C(                 410)),
+      simde_mm512_set_epi64(INT64_C(  837374687798165832), INT64_C( 7829224892544136010),
+                            INT64_C(-4498044854301010203), INT64_C( 2805500606133665779),
+                            INT64_C(-4694974955338986144), INT64_C(  -39906067088604639),
+                            INT64_C(              -41992), INT64_C(    9105447906943300)) },
+    { simde_mm512_set_epi64(INT64_C(                 926), INT64_C(                 607),
+                            INT64_C(-6284402504061711371), INT64_C( 3986278992862824923),
+                            INT64_C( 6054009810040538652), INT64_C(   -2907126038160693),
+                            INT64_C(                 242), INT64_C(    2854958744501770)),
+      simde_mm512_set_epi64(INT64_C(          -210341321), INT64_C(                 376),
+                            INT64_C( 3093328460638992853), INT64_C(   -4490106295737657),
+                            INT64_C(         25020036788), INT64_C( 7990514768582748467),
+                            INT64_C(   -4065955055703354), INT64_C(    5815277056330217)),
+      simde_mm512_set_epi64(INT64_C(       -194776063246), INT64_C(              228232),
+                            INT64_C( 2328949113384796121), INT64_C( 6301037891177611069),
+                            INT64_C( 6567956641928328112), INT64_C(-4706460787313387151),
+                            INT64_C( -983961123480211668), INT64_C(-2859941521739607782)) },
+    { simde_mm512_set_epi64(INT64_C(   -4553413733489927), INT64_C( 6231238799050679621),
+                            INT64_C(                  72), INT64_C( 3804798441934580754),
+                            INT64_C(    6870377601947082), INT64_C(                -529),
+                            INT64_C(-4193454438902291588), INT64_C(    2314389050363561)),
+      simde_mm512_set_epi64(INT64_C(   -3902048256969274), INT64_C(                -636),
+                            INT64_C(     200452084470367), INT64_C(    7788829351450701),
+                            INT64_C(   -3779922977138505), INT64_C(                 -55),
+                            INT64_C(      -3825082953979), INT64_C(-3832634399612262216)),
+      simde_mm512_set_epi64(INT64_C( -567085505129932394), INT64_C( 2982099651321358484),
+                            INT64_C(   14432550081866424), INT64_C(-5979889732235218582),
+                            INT64_C(-1789410964607777946), INT64_C(               29095),
+                            INT64_C( 6749917203461862764), INT64_C(-7269960846154403464)) },
+    { simde_mm512_set_epi64(INT64_C(           711931270), INT64_C(    7756159545362611),
+                            INT64_C( 3162207299732946368), INT64_C(                -856),
+                            INT64_C(                -159), INT64_C(          8005116316),
+                            INT64_C(          -337895282), INT64_C(                 636)),
+      simde_mm512_set_epi64(INT64_C(                 255), INT64_C(                  40),
+                            INT64_C( 4888554000272662542), INT64_C(          -231127174),
+                            INT64_C(    7489010292937201), INT64_C(                -345),
+                            INT64_C(   -6363025885768995), INT64_C( 6687598252111710138)),
+      simde_mm512_set_epi64(INT64_C(        181542473850), INT64_C(  310246381814504440),
+                            INT64_C( 6032247798314721408), INT64_C(        197844860944),
+                            INT64_C(-1190752636577014959), INT64_C(      -2761765129020),
+                            INT64_C(-5382721928726669674), INT64_C(-7885392683858775528)) },
+    { simde_mm512_set_epi64(INT64_C(   -2524841320751316), INT64_C(-7104395446304056082),
+                            INT64_C( 8049507322599187556), INT64_C(                 883),
+                            INT64_C(                 571), INT64_C(    7237996245697776),
+                            INT64_C(        372330773582), INT64_C(     -13488450305546)),
+      simde_mm512_set_epi64(INT64_C(                -867), INT64_C(   -6684909978019688),
+                            INT64_C(-3138340394947321924), INT64_C(    -557153901890864),
+                            INT64_C(   -1545587639016187), INT64_C(            65803233),
+                            INT64_C( -192670567875822317), INT64_C(    2058601653266845)),
+      simde_mm512_set_epi64(INT64_C( 2189037425091390972), INT64_C( 7372561049877380432),
+                            INT64_C( 2105445356913415536), INT64_C( -491966895369632912),
+                            INT64_C( -882530541878242777), INT64_C( 7068169669088536304),
+                            INT64_C( -942466788481593398), INT64_C(-4332924922605332002)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mullo_epi64(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_mullo_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C( 2716968916576102661), INT64_C( -573886517024916752),
+                            INT64_C(-6177513621845931355), INT64_C(-1358320276906594108),
+                            INT64_C( 1309378916996798580), INT64_C( 8140361918993741279),
+                            INT64_C( 8840206087687964624), INT64_C( 3491872004769044576)),
+      UINT8_C(151),
+      simde_mm512_set_epi64(INT64_C(                 180), INT64_C(    4345618297179689),
+                            INT64_C( 3041938634991898687), INT64_C(                -245),
+                            INT64_C( 8214991913116271380), INT64_C(           -15488692),
+                            INT64_C(    -527783286443985), INT64_C(  802616183451299250)),
+      simde_mm512_set_epi64(INT64_C(                 -58), INT64_C(-1990518611693604056),
+                            INT64_C(          -290345264), INT64_C(              -20480),
+                            INT64_C(-1839674737963503797), INT64_C(    -720186279965576),
+                            INT64_C(                -596), INT64_C(                -445)),
+      simde_mm512_set_epi64(INT64_C(              -10440), INT64_C( -573886517024916752),
+                            INT64_C(-6177513621845931355), INT64_C(             5017600),
+                            INT64_C( 1309378916996798580), INT64_C(-5536691581701461088),
+                            INT64_C(  314558838720615060), INT64_C(-6676064235346685546)) },
+    { simde_mm512_set_epi64(INT64_C( 4314816605641445298), INT64_C(-3969412400542645706),
+                            INT64_C(-1637107957648323869), INT64_C(-1211460303942681771),
+                            INT64_C( 2264372798453415787), INT64_C(-3895746009519956012),
+                            INT64_C(-4999277237210645009), INT64_C( 5723771171691794892)),
+      UINT8_C( 45),
+      simde_mm512_set_epi64(INT64_C(           256883599), INT64_C(-4815900362565182379),
+                            INT64_C(                -393), INT64_C(                -826),
+                            INT64_C(   -8907365979684169), INT64_C(                 311),
+                            INT64_C(                -807), INT64_C(    8603295659528720)),
+      simde_mm512_set_epi64(INT64_C(                 288), INT64_C( 1473442856480729029),
+                            INT64_C(     353302099247914), INT64_C( 7997818525734863411),
+                            INT64_C(   -7201036500909275), INT64_C(                 477),
+                            INT64_C(   -2832107868288712), INT64_C(   83762333715843572)),
+      simde_mm512_set_epi64(INT64_C( 4314816605641445298), INT64_C(-3969412400542645706),
+                            INT64_C( -138847725004430202), INT64_C(-1211460303942681771),
+                            INT64_C(-1186930928111269517), INT64_C(              148347),
+                            INT64_C(-4999277237210645009), INT64_C( 8707741882581239616)) },
+    { simde_mm512_set_epi64(INT64_C(  341134573429789384), INT64_C( 5762375263777582547),
+                            INT64_C( 6813547465327754148), INT64_C( 5742747412028630382),
+                            INT64_C(-8387099229290545392), INT64_C(-8813844846625961791),
+                            INT64_C( -363020043860616202), INT64_C(-2698872862124286325)),
+      UINT8_C(237),
+      simde_mm512_set_epi64(INT64_C(    7411881727471643), INT64_C(                -131),
+                            INT64_C(    -631291781417646), INT64_C(-2765373211077603856),
+                            INT64_C(                 417), INT64_C(                -943),
+                            INT64_C( 2322825082141994030), INT64_C(-4576573363362794138)),
+      simde_mm512_set_epi64(INT64_C(             -102845), INT64_C(           -12974211),
+                            INT64_C(-1516555457617617105), INT64_C(    5083177432199496),
+                            INT64_C( -335387493782945408), INT64_C( 8170242368482215347),
+                            INT64_C(        585072568351), INT64_C(    6028002609915480)),
+      simde_mm512_set_epi64(INT64_C(-5958469239729508079), INT64_C(          1699621641),
+                            INT64_C( 5522914687119751182), INT64_C( 5742747412028630382),
+                            INT64_C( 7717367682188177792), INT64_C( 6200469331863503267),
+                            INT64_C( -363020043860616202), INT64_C(-3467406096179265776)) },
+    { simde_mm512_set_epi64(INT64_C( -127250273742482840), INT64_C(-6475192387253707438),
+                            INT64_C( 3459365113555866033), INT64_C( 8204700517181574765),
+                            INT64_C(-1881126701956770553), INT64_C(-6908747906194693883),
+                            INT64_C(-3601472295238116688), INT64_C(  406525546980836150)),
+      UINT8_C( 76),
+      simde_mm512_set_epi64(INT64_C(    7160580521309161), INT64_C(             -928668),
+                            INT64_C(          -142591378), INT64_C(             -500143),
+                            INT64_C(   -7095807475450093), INT64_C(              846142),
+                            INT64_C(    -332272123314483), INT64_C( 8178881148207263940)),
+      simde_mm512_set_epi64(INT64_C(-1411087908753862555), INT64_C( 6766875439748071149),
+                            INT64_C(-4496944235065739385), INT64_C(    2582011866068451),
+                            INT64_C(            12880186), INT64_C( 5354573155778728104),
+                            INT64_C(                -760), INT64_C(                -608)),
+      simde_mm512_set_epi64(INT64_C( -127250273742482840), INT64_C(-2164265623626983276),
+                            INT64_C( 3459365113555866033), INT64_C( 8204700517181574765),
+                            INT64_C( 8296781243196699982), INT64_C( 5980489047873417392),
+                            INT64_C(-3601472295238116688), INT64_C(  406525546980836150)) },
+    { simde_mm512_set_epi64(INT64_C(-2953940041242782219), INT64_C( -335570449250267666),
+                            INT64_C(-8294456256130144795), INT64_C(-2041061946127088861),
+                            INT64_C(-4129254584213504997), INT64_C(-5624817422193728048),
+                            INT64_C(-7302875394046098795), INT64_C( 9211903876136298501)),
+      UINT8_C( 30),
+      simde_mm512_set_epi64(INT64_C(                  94), INT64_C(    5969846185797606),
+                            INT64_C(         -1048166882), INT64_C(               28037),
+                            INT64_C(             -136440), INT64_C(   -1093521295678844),
+                            INT64_C(       -122966949345), INT64_C( 6474553981156110830)),
+      simde_mm512_set_epi64(INT64_C( 8013488619716685565), INT64_C(                -441),
+                            INT64_C(   -1239676530713192), INT64_C(        -28123178634),
+                            INT64_C(-7651765834442435523), INT64_C( 5169276218439603010),
+                            INT64_C(   -6178181501199878), INT64_C(                 221)),
+      simde_mm512_set_epi64(INT64_C(-2953940041242782219), INT64_C( -335570449250267666),
+                            INT64_C(-8294456256130144795), INT64_C(    -788489559361458),
+                            INT64_C(-4997144339880501016), INT64_C(-1743929067517627896),
+                            INT64_C( 3371313605357361478), INT64_C( 9211903876136298501)) },
+    { simde_mm512_set_epi64(INT64_C( 9149588639833954073), INT64_C(-2073614946388756490),
+                            INT64_C( 8767236063759478253), INT64_C( 1798795510602864387),
+                            INT64_C(-7948554743584477990), INT64_C(-5868208198751410166),
+                            INT64_C( 4865067781004170983), INT64_C(-5106332477526998048)),
+      UINT8_C(119),
+      simde_mm512_set_epi64(INT64_C( 5264365221029915697), INT64_C( -925480202983851142),
+                            INT64_C( 6813643393606820356), INT64_C(-7932692222958559777),
+                            INT64_C( 6562973389890366830), INT64_C(    6116939079957608),
+                            INT64_C(   -8099936793489188), INT64_C(   -8090400076706074)),
+      simde_mm512_set_epi64(INT64_C(                  88), INT64_C(                -469),
+                            INT64_C(-3879288104762454264), INT64_C(    2124706987122136),
+                            INT64_C( 8310370022109107021), INT64_C(                 -81),
+                            INT64_C( 6572788057377373125), INT64_C(     -30392885558316)),
+      simde_mm512_set_epi64(INT64_C( 9149588639833954073), INT64_C(-8671642569603053186),
+                            INT64_C(  886551523568929824), INT64_C(-4251479739669448920),
+                            INT64_C(-7948554743584477990), INT64_C( -495472065476566248),
+                            INT64_C( 4616055770348334412), INT64_C(-5888163419957524360)) },
+    { simde_mm512_set_epi64(INT64_C( 6388427219706260557), INT64_C( -915835728785122060),
+                            INT64_C(-7092710356332551689), INT64_C(-6103412038833905482),
+                            INT64_C( 7238141733988214394), INT64_C( 6542002007737715810),
+                            INT64_C( 6573339403354833764), INT64_C(-3111952600621402616)),
+      UINT8_C( 85),
+      simde_mm512_set_epi64(INT64_C( -603961520796283928), INT64_C( -309292836769017498),
+                            INT64_C(    7045441559914710), INT64_C(       -109400664130),
+                            INT64_C(                -539), INT64_C(                 655),
+                            INT64_C(    1380815537223891), INT64_C(    4872689586991319)),
+      simde_mm512_set_epi64(INT64_C(                -185), INT64_C(   -8067846420136059),
+                            INT64_C(     -42695368778241), INT64_C(    5457719351677543),
+                            INT64_C( -449788397044933601), INT64_C(                 952),
+                            INT64_C(    -311411946581446), INT64_C(   -2939770405344026)),
+      simde_mm512_set_epi64(INT64_C( 6388427219706260557), INT64_C( 4519016818781381630),
+                            INT64_C(-7092710356332551689), INT64_C( 3043610208748022130),
+                            INT64_C( 7238141733988214394), INT64_C(              623560),
+                            INT64_C( 6573339403354833764), INT64_C(-4599613957243087574)) },
+    { simde_mm512_set_epi64(INT64_C( 8630427168962750205), INT64_C(-7435427579630197643),
+                            INT64_C(-3331851327629481375), INT64_C( 3254366311375977561),
+                            INT64_C(-6160717086864808816), INT64_C(-4431303019216599331),
+                            INT64_C( 3900799674073285336), INT64_C( 3999853822909481113)),
+      UINT8_C(240),
+      simde_mm512_set_epi64(INT64_C(                -567), INT64_C( 2575650707249804161),
+                            INT64_C(         23506441294), INT64_C(                 -55),
+                            INT64_C(   -4440902213540455), INT64_C(           -51595765),
+                            INT64_C(    8594704806020927), INT64_C(        103346025149)),
+      simde_mm512_set_epi64(INT64_C(                  81), INT64_C(    7120237376048180),
+                            INT64_C(-4888558069806905567), INT64_C(    -389117158120828),
+                            INT64_C(                 722), INT64_C(-3562102495610031981),
+                            INT64_C(    8949353827038643), INT64_C( 3813676269530953291)),
+      simde_mm512_set_epi64(INT64_C(              -45927), INT64_C(-1701527084921355724),
+                            INT64_C(-2200613721594658802), INT64_C(   21401443696645540),
+                            INT64_C(-6160717086864808816), INT64_C(-4431303019216599331),
+                            INT64_C( 3900799674073285336), INT64_C( 3999853822909481113)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_mullo_epi64(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_mullo_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(152),
+      simde_mm512_set_epi64(INT64_C(    2693479797601472), INT64_C(   -4247877292346239),
+                            INT64_C(                 530), INT64_C(                 954),
+                            INT64_C(                 -55), INT64_C(                -998),
+                            INT64_C(              164811), INT64_C(           -28498791)),
+      simde_mm512_set_epi64(INT64_C( 8133462991397416973), INT64_C(   -8970839408110082),
+                            INT64_C(    1920686954401820), INT64_C(-5275988096877707419),
+                            INT64_C( 7802718523382096996), INT64_C(            52464079),
+                            INT64_C(                 138), INT64_C(        -94890419506)),
+      simde_mm512_set_epi64(INT64_C( 1321589458711883200), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 2668487701374713442),
+                            INT64_C(-4874405090695647612), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(173),
+      simde_mm512_set_epi64(INT64_C(                 114), INT64_C(                 648),
+                            INT64_C(   -1385529201331412), INT64_C(             -471525),
+                            INT64_C(   -2153855802593901), INT64_C(    3551482482421350),
+                            INT64_C(   -3872219365929921), INT64_C(                 519)),
+      simde_mm512_set_epi64(INT64_C(-3255379661228199007), INT64_C(-9110129519004256696),
+                            INT64_C(                -366), INT64_C(             -373354),
+                            INT64_C(   -2324298261071236), INT64_C(-4412439662960614238),
+                            INT64_C(   -1640799767935935), INT64_C(                 831)),
+      simde_mm512_set_epi64(INT64_C(-2178399905823654478), INT64_C(                   0),
+                            INT64_C(  507103687687296792), INT64_C(                   0),
+                            INT64_C( 2072818927237636404), INT64_C(-5704262540319804276),
+                            INT64_C(                   0), INT64_C(              431289)) },
+    { UINT8_C(134),
+      simde_mm512_set_epi64(INT64_C(   -1814507219676256), INT64_C(             -148861),
+                            INT64_C(              129743), INT64_C(-5161684320597236608),
+                            INT64_C(-6519791369587166535), INT64_C(   -6171652661381006),
+                            INT64_C(                 944), INT64_C(            -2714678)),
+      simde_mm512_set_epi64(INT64_C(                 687), INT64_C(          -192572381),
+                            INT64_C( 4197937703878213165), INT64_C(    -438768970322610),
+                            INT64_C(               11799), INT64_C(                 798),
+                            INT64_C(    3674084809097726), INT64_C(                 674)),
+      simde_mm512_set_epi64(INT64_C(-1246566459917587872), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-4924978823782042788),
+                            INT64_C( 3468336059788253344), INT64_C(                   0)) },
+    { UINT8_C(  9),
+      simde_mm512_set_epi64(INT64_C( 4086960976795796258), INT64_C(    -255853671518132),
+                            INT64_C(-8477324105541313679), INT64_C(      14667732643315),
+                            INT64_C(                -494), INT64_C( 1045559299950151738),
+                            INT64_C(   -5852294076771135), INT64_C(              -17978)),
+      simde_mm512_set_epi64(INT64_C( 1187738607712942576), INT64_C(                 164),
+                            INT64_C(                 558), INT64_C(                -549),
+                            INT64_C(                -429), INT64_C(       1174242634040),
+                            INT64_C(                -478), INT64_C(-1212576020992493437)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(              211926), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(-4359789721642999726)) },
+    { UINT8_C(131),
+      simde_mm512_set_epi64(INT64_C(             3713181), INT64_C(       4925211600132),
+                            INT64_C(             7451342), INT64_C(             -967068),
+                            INT64_C(   -3664298675513807), INT64_C(    4992849456577837),
+                            INT64_C(                -244), INT64_C(-7615126807148627374)),
+      simde_mm512_set_epi64(INT64_C(                -132), INT64_C( 8240719798419924905),
+                            INT64_C( 3202031008705409028), INT64_C(    1044765317009115),
+                            INT64_C(-1095786611783708927), INT64_C(                 814),
+                            INT64_C(       1404739990969), INT64_C(                -746)),
+      simde_mm512_set_epi64(INT64_C(          -490139892), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(    -342756557796436), INT64_C( -712576569665876724)) },
+    { UINT8_C( 32),
+      simde_mm512_set_epi64(INT64_C(   -6925885075420839), INT64_C(   -8557614089399956),
+                            INT64_C(          -138376610), INT64_C(                -154),
+                            INT64_C(                -286), INT64_C(      -5566563164347),
+                            INT64_C( 2730429803191256951), INT64_C( 3955119252981535167)),
+      simde_mm512_set_epi64(INT64_C(   -7875261092699435), INT64_C(                -452),
+                            INT64_C(    1951345160023722), INT64_C(     -79851017669417),
+                            INT64_C(    2767306464332426), INT64_C( 4803314850070328216),
+                            INT64_C(    4343635357136967), INT64_C(-6858587129100900400)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C( 2911566970246612588), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C( 25),
+      simde_mm512_set_epi64(INT64_C(-7557854631829475155), INT64_C(     101223586751002),
+                            INT64_C(               12448), INT64_C(            67132100),
+                            INT64_C(-6274784527475764893), INT64_C(     189246439385775),
+                            INT64_C(                -770), INT64_C(               75094)),
+      simde_mm512_set_epi64(INT64_C(       -198623438962), INT64_C( 6184085996241856553),
+                            INT64_C( 8289957029290146215), INT64_C( 8599965332203401732),
+                            INT64_C(               -3267), INT64_C(                 892),
+                            INT64_C(   -2927130827020684), INT64_C(-4782770079722099466)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C( 6658044266592121616),
+                            INT64_C( 5388385372012060055), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(  770748473632663716)) },
+    { UINT8_C( 76),
+      simde_mm512_set_epi64(INT64_C(   -3060507445680557), INT64_C(   -8762124389814682),
+                            INT64_C(                -319), INT64_C(   -1092362207619589),
+                            INT64_C(              454133), INT64_C(                -735),
+                            INT64_C(                 423), INT64_C(-2299429105884711801)),
+      simde_mm512_set_epi64(INT64_C(                -530), INT64_C(                 918),
+                            INT64_C(     -46323366266914), INT64_C(    4001513370087325),
+                            INT64_C( 3110971972229249238), INT64_C(             -831149),
+                            INT64_C(                -949), INT64_C(                 -13)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(-8043630189849878076),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(-4200452881494965554), INT64_C(           610894515),
+                            INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_mullo_epi64(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_range_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r[4];
+  } test_vec[8] = {
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(   313.90), SIMDE_FLOAT32_C(   253.45), SIMDE_FLOAT32_C(   767.30), SIMDE_FLOAT32_C(   911.22),
+                         SIMDE_FLOAT32_C(  -452.64), SIMDE_FLOAT32_C(  -323.91), SIMDE_FLOAT32_C(   315.26), SIMDE_FLOAT32_C(   310.10),
+                         SIMDE_FLOAT32_C(   793.11), SIMDE_FLOAT32_C(  -865.34), SIMDE_FLOAT32_C(   904.97), SIMDE_FLOAT32_C(   -35.24),
+                         SIMDE_FLOAT32_C(    26.96), SIMDE_FLOAT32_C(  -159.59), SIMDE_FLOAT32_C(   -87.83), SIMDE_FLOAT32_C(   708.51)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -357.67), SIMDE_FLOAT32_C(   253.45), SIMDE_FLOAT32_C(  -767.30), SIMDE_FLOAT32_C(   532.34),
+                         SIMDE_FLOAT32_C(   452.64), SIMDE_FLOAT32_C(   323.91), SIMDE_FLOAT32_C(  -315.26), SIMDE_FLOAT32_C(   310.10),
+                         SIMDE_FLOAT32_C(  -793.11), SIMDE_FLOAT32_C(  -326.89), SIMDE_FLOAT32_C(  -933.43), SIMDE_FLOAT32_C(    35.24),
+                         SIMDE_FLOAT32_C(   -26.96), SIMDE_FLOAT32_C(  -745.43), SIMDE_FLOAT32_C(    87.83), SIMDE_FLOAT32_C(   905.52)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(   357.67), SIMDE_FLOAT32_C(   253.45), SIMDE_FLOAT32_C(   767.30), SIMDE_FLOAT32_C(   532.34),
+                           SIMDE_FLOAT32_C(  -452.64), SIMDE_FLOAT32_C(  -323.91), SIMDE_FLOAT32_C(   315.26), SIMDE_FLOAT32_C(   310.10),
+                           SIMDE_FLOAT32_C(   793.11), SIMDE_FLOAT32_C(  -865.34), SIMDE_FLOAT32_C(   933.43), SIMDE_FLOAT32_C(   -35.24),
+                           SIMDE_FLOAT32_C(    26.96), SIMDE_FLOAT32_C(  -745.43), SIMDE_FLOAT32_C(   -87.83), SIMDE_FLOAT32_C(   708.51)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -357.67), SIMDE_FLOAT32_C(   253.45), SIMDE_FLOAT32_C(   767.30), SIMDE_FLOAT32_C(   911.22),
+                           SIMDE_FLOAT32_C(   452.64), SIMDE_FLOAT32_C(   323.91), SIMDE_FLOAT32_C(   315.26), SIMDE_FLOAT32_C(   310.10),
+                           SIMDE_FLOAT32_C(   793.11), SIMDE_FLOAT32_C(  -865.34), SIMDE_FLOAT32_C(  -933.43), SIMDE_FLOAT32_C(    35.24),
+                           SIMDE_FLOAT32_C(    26.96), SIMDE_FLOAT32_C(  -745.43), SIMDE_FLOAT32_C(    87.83), SIMDE_FLOAT32_C(   905.52)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   313.90), SIMDE_FLOAT32_C(   253.45), SIMDE_FLOAT32_C(   767.30), SIMDE_FLOAT32_C(   532.34),
+                           SIMDE_FLOAT32_C(   452.64), SIMDE_FLOAT32_C(   323.91), SIMDE_FLOAT32_C(   315.26), SIMDE_FLOAT32_C(   310.10),
+                           SIMDE_FLOAT32_C(   793.11), SIMDE_FLOAT32_C(   326.89), SIMDE_FLOAT32_C(   904.97), SIMDE_FLOAT32_C(    35.24),
+                           SIMDE_FLOAT32_C(    26.96), SIMDE_FLOAT32_C(   159.59), SIMDE_FLOAT32_C(    87.83), SIMDE_FLOAT32_C(   708.51)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -313.90), SIMDE_FLOAT32_C(  -253.45), SIMDE_FLOAT32_C(  -767.30), SIMDE_FLOAT32_C(  -911.22),
+                           SIMDE_FLOAT32_C(  -452.64), SIMDE_FLOAT32_C(  -323.91), SIMDE_FLOAT32_C(  -315.26), SIMDE_FLOAT32_C(  -310.10),
+                           SIMDE_FLOAT32_C(  -793.11), SIMDE_FLOAT32_C(  -326.89), SIMDE_FLOAT32_C(  -904.97), SIMDE_FLOAT32_C(   -35.24),
+                           SIMDE_FLOAT32_C(   -26.96), SIMDE_FLOAT32_C(  -159.59), SIMDE_FLOAT32_C(   -87.83), SIMDE_FLOAT32_C(  -905.52)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -146.10), SIMDE_FLOAT32_C(  -223.86), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(    78.71),
+                         SIMDE_FLOAT32_C(  -484.52), SIMDE_FLOAT32_C(  -404.44), SIMDE_FLOAT32_C(   974.08), SIMDE_FLOAT32_C(  -134.53),
+                         SIMDE_FLOAT32_C(  -557.78), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -199.95), SIMDE_FLOAT32_C(  -466.51),
+                         SIMDE_FLOAT32_C(  -216.14), SIMDE_FLOAT32_C(   -46.53), SIMDE_FLOAT32_C(    87.50), SIMDE_FLOAT32_C(     0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   146.10), SIMDE_FLOAT32_C(   223.86), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    78.71),
+                         SIMDE_FLOAT32_C(   484.52), SIMDE_FLOAT32_C(   214.41), SIMDE_FLOAT32_C(   974.08), SIMDE_FLOAT32_C(  -608.18),
+                         SIMDE_FLOAT32_C(   736.65), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   199.95), SIMDE_FLOAT32_C(  -820.72),
+                         SIMDE_FLOAT32_C(  -216.14), SIMDE_FLOAT32_C(    46.53), SIMDE_FLOAT32_C(  -458.72), SIMDE_FLOAT32_C(     0.00)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -146.10), SIMDE_FLOAT32_C(  -223.86), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(    78.71),
+                           SIMDE_FLOAT32_C(  -484.52), SIMDE_FLOAT32_C(  -404.44), SIMDE_FLOAT32_C(   974.08), SIMDE_FLOAT32_C(  -608.18),
+                           SIMDE_FLOAT32_C(  -557.78), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -199.95), SIMDE_FLOAT32_C(  -820.72),
+                           SIMDE_FLOAT32_C(  -216.14), SIMDE_FLOAT32_C(   -46.53), SIMDE_FLOAT32_C(   458.72), SIMDE_FLOAT32_C(     0.00)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   146.10), SIMDE_FLOAT32_C(   223.86), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    78.71),
+                           SIMDE_FLOAT32_C(   484.52), SIMDE_FLOAT32_C(  -404.44), SIMDE_FLOAT32_C(   974.08), SIMDE_FLOAT32_C(  -608.18),
+                           SIMDE_FLOAT32_C(   736.65), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   199.95), SIMDE_FLOAT32_C(  -820.72),
+                           SIMDE_FLOAT32_C(  -216.14), SIMDE_FLOAT32_C(    46.53), SIMDE_FLOAT32_C(  -458.72), SIMDE_FLOAT32_C(     0.00)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   146.10), SIMDE_FLOAT32_C(   223.86), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    78.71),
+                           SIMDE_FLOAT32_C(   484.52), SIMDE_FLOAT32_C(   214.41), SIMDE_FLOAT32_C(   974.08), SIMDE_FLOAT32_C(   134.53),
+                           SIMDE_FLOAT32_C(   557.78), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   199.95), SIMDE_FLOAT32_C(   466.51),
+                           SIMDE_FLOAT32_C(   216.14), SIMDE_FLOAT32_C(    46.53), SIMDE_FLOAT32_C(    87.50), SIMDE_FLOAT32_C(     0.00)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -146.10), SIMDE_FLOAT32_C(  -223.86), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   -78.71),
+                           SIMDE_FLOAT32_C(  -484.52), SIMDE_FLOAT32_C(  -214.41), SIMDE_FLOAT32_C(  -974.08), SIMDE_FLOAT32_C(  -134.53),
+                           SIMDE_FLOAT32_C(  -736.65), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -199.95), SIMDE_FLOAT32_C(  -466.51),
+                           SIMDE_FLOAT32_C(  -216.14), SIMDE_FLOAT32_C(   -46.53), SIMDE_FLOAT32_C(   -87.50), SIMDE_FLOAT32_C(    -0.00)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -659.87), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   787.86),
+                         SIMDE_FLOAT32_C(  -334.11), SIMDE_FLOAT32_C(   213.07), SIMDE_FLOAT32_C(   668.53), SIMDE_FLOAT32_C(   555.19),
+                         SIMDE_FLOAT32_C(   919.02), SIMDE_FLOAT32_C(    -3.62), SIMDE_FLOAT32_C(  -262.14), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(  -380.60), SIMDE_FLOAT32_C(   273.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   877.75)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -158.44), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -820.59),
+                         SIMDE_FLOAT32_C(   334.11), SIMDE_FLOAT32_C(  -213.07), SIMDE_FLOAT32_C(   668.53), SIMDE_FLOAT32_C(   555.19),
+                         SIMDE_FLOAT32_C(   919.02), SIMDE_FLOAT32_C(   316.88), SIMDE_FLOAT32_C(  -262.14), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(  -435.48), SIMDE_FLOAT32_C(   273.62), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   877.75)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -659.87), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   820.59),
+                           SIMDE_FLOAT32_C(  -334.11), SIMDE_FLOAT32_C(   213.07), SIMDE_FLOAT32_C(   668.53), SIMDE_FLOAT32_C(   555.19),
+                           SIMDE_FLOAT32_C(   919.02), SIMDE_FLOAT32_C(    -3.62), SIMDE_FLOAT32_C(  -262.14), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(  -435.48), SIMDE_FLOAT32_C(   273.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   877.75)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -659.87), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -820.59),
+                           SIMDE_FLOAT32_C(   334.11), SIMDE_FLOAT32_C(   213.07), SIMDE_FLOAT32_C(   668.53), SIMDE_FLOAT32_C(   555.19),
+                           SIMDE_FLOAT32_C(   919.02), SIMDE_FLOAT32_C(   316.88), SIMDE_FLOAT32_C(  -262.14), SIMDE_FLOAT32_C(     0.00),
+                           SIMDE_FLOAT32_C(  -435.48), SIMDE_FLOAT32_C(   273.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   877.75)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   158.44), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   787.86),
+                           SIMDE_FLOAT32_C(   334.11), SIMDE_FLOAT32_C(   213.07), SIMDE_FLOAT32_C(   668.53), SIMDE_FLOAT32_C(   555.19),
+                           SIMDE_FLOAT32_C(   919.02), SIMDE_FLOAT32_C(     3.62), SIMDE_FLOAT32_C(   262.14), SIMDE_FLOAT32_C(     0.00),
+                           SIMDE_FLOAT32_C(   380.60), SIMDE_FLOAT32_C(   273.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   877.75)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -158.44), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -787.86),
+                           SIMDE_FLOAT32_C(  -334.11), SIMDE_FLOAT32_C(  -213.07), SIMDE_FLOAT32_C(  -668.53), SIMDE_FLOAT32_C(  -555.19),
+                           SIMDE_FLOAT32_C(  -919.02), SIMDE_FLOAT32_C(  -316.88), SIMDE_FLOAT32_C(  -262.14), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(  -380.60), SIMDE_FLOAT32_C(  -273.62), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -877.75)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(   743.10), SIMDE_FLOAT32_C(  -362.42), SIMDE_FLOAT32_C(    -9.51), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -601.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   847.79),
+                         SIMDE_FLOAT32_C(   524.06), SIMDE_FLOAT32_C(  -945.86), SIMDE_FLOAT32_C(  -346.31), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(   562.81), SIMDE_FLOAT32_C(  -436.96), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -873.02)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   683.51), SIMDE_FLOAT32_C(  -862.79), SIMDE_FLOAT32_C(  -107.19), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -407.90), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   847.79),
+                         SIMDE_FLOAT32_C(  -212.00), SIMDE_FLOAT32_C(   885.37), SIMDE_FLOAT32_C(   406.96), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(  -844.34), SIMDE_FLOAT32_C(  -887.30), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   998.51)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(   683.51), SIMDE_FLOAT32_C(  -862.79), SIMDE_FLOAT32_C(  -107.19), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -601.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   847.79),
+                           SIMDE_FLOAT32_C(   212.00), SIMDE_FLOAT32_C(  -945.86), SIMDE_FLOAT32_C(  -346.31), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(   844.34), SIMDE_FLOAT32_C(  -887.30), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -873.02)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   743.10), SIMDE_FLOAT32_C(  -862.79), SIMDE_FLOAT32_C(  -107.19), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -601.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   847.79),
+                           SIMDE_FLOAT32_C(   524.06), SIMDE_FLOAT32_C(  -945.86), SIMDE_FLOAT32_C(   406.96), SIMDE_FLOAT32_C(     0.00),
+                           SIMDE_FLOAT32_C(  -844.34), SIMDE_FLOAT32_C(  -887.30), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   998.51)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   683.51), SIMDE_FLOAT32_C(   362.42), SIMDE_FLOAT32_C(     9.51), SIMDE_FLOAT32_C(     0.00),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   407.90), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   847.79),
+                           SIMDE_FLOAT32_C(   212.00), SIMDE_FLOAT32_C(   885.37), SIMDE_FLOAT32_C(   346.31), SIMDE_FLOAT32_C(     0.00),
+                           SIMDE_FLOAT32_C(   562.81), SIMDE_FLOAT32_C(   436.96), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   873.02)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -743.10), SIMDE_FLOAT32_C(  -362.42), SIMDE_FLOAT32_C(    -9.51), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -407.90), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -847.79),
+                           SIMDE_FLOAT32_C(  -524.06), SIMDE_FLOAT32_C(  -885.37), SIMDE_FLOAT32_C(  -406.96), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(  -562.81), SIMDE_FLOAT32_C(  -436.96), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -998.51)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -687.39), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -616.01), SIMDE_FLOAT32_C(   471.65),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -83.58), SIMDE_FLOAT32_C(   274.95), SIMDE_FLOAT32_C(   333.86),
+                         SIMDE_FLOAT32_C(  -108.87), SIMDE_FLOAT32_C(   365.32), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   292.32),
+                         SIMDE_FLOAT32_C(  -977.60), SIMDE_FLOAT32_C(  -786.12), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(    -0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -331.24), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -927.84), SIMDE_FLOAT32_C(   181.49),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -942.95), SIMDE_FLOAT32_C(   447.86), SIMDE_FLOAT32_C(  -492.54),
+                         SIMDE_FLOAT32_C(   327.36), SIMDE_FLOAT32_C(  -851.80), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -105.13),
+                         SIMDE_FLOAT32_C(  -659.72), SIMDE_FLOAT32_C(   786.12), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.00)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -687.39), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -927.84), SIMDE_FLOAT32_C(   181.49),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -942.95), SIMDE_FLOAT32_C(   274.95), SIMDE_FLOAT32_C(   492.54),
+                           SIMDE_FLOAT32_C(  -108.87), SIMDE_FLOAT32_C(   851.80), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   105.13),
+                           SIMDE_FLOAT32_C(  -977.60), SIMDE_FLOAT32_C(  -786.12), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(    -0.00)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -687.39), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -927.84), SIMDE_FLOAT32_C(   471.65),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -942.95), SIMDE_FLOAT32_C(   447.86), SIMDE_FLOAT32_C(  -492.54),
+                           SIMDE_FLOAT32_C(   327.36), SIMDE_FLOAT32_C(  -851.80), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   292.32),
+                           SIMDE_FLOAT32_C(  -977.60), SIMDE_FLOAT32_C(   786.12), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.00)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   331.24), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   616.01), SIMDE_FLOAT32_C(   181.49),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    83.58), SIMDE_FLOAT32_C(   274.95), SIMDE_FLOAT32_C(   333.86),
+                           SIMDE_FLOAT32_C(   108.87), SIMDE_FLOAT32_C(   365.32), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   105.13),
+                           SIMDE_FLOAT32_C(   659.72), SIMDE_FLOAT32_C(   786.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -331.24), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -616.01), SIMDE_FLOAT32_C(  -471.65),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   -83.58), SIMDE_FLOAT32_C(  -447.86), SIMDE_FLOAT32_C(  -333.86),
+                           SIMDE_FLOAT32_C(  -327.36), SIMDE_FLOAT32_C(  -365.32), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -292.32),
+                           SIMDE_FLOAT32_C(  -659.72), SIMDE_FLOAT32_C(  -786.12), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(    -0.00)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(   999.18), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    33.01), SIMDE_FLOAT32_C(   -49.58),
+                         SIMDE_FLOAT32_C(   635.41), SIMDE_FLOAT32_C(   241.18), SIMDE_FLOAT32_C(   389.62), SIMDE_FLOAT32_C(    67.24),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    95.56), SIMDE_FLOAT32_C(   863.59), SIMDE_FLOAT32_C(  -945.49),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -388.44), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -159.25)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   188.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   122.38), SIMDE_FLOAT32_C(   -49.58),
+                         SIMDE_FLOAT32_C(  -481.89), SIMDE_FLOAT32_C(  -241.18), SIMDE_FLOAT32_C(   349.63), SIMDE_FLOAT32_C(  -875.63),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   749.87), SIMDE_FLOAT32_C(   863.59), SIMDE_FLOAT32_C(  -130.61),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   828.07), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   159.25)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(   188.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    33.01), SIMDE_FLOAT32_C(   -49.58),
+                           SIMDE_FLOAT32_C(   481.89), SIMDE_FLOAT32_C(   241.18), SIMDE_FLOAT32_C(   349.63), SIMDE_FLOAT32_C(   875.63),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    95.56), SIMDE_FLOAT32_C(   863.59), SIMDE_FLOAT32_C(  -945.49),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -388.44), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -159.25)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   999.18), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   122.38), SIMDE_FLOAT32_C(   -49.58),
+                           SIMDE_FLOAT32_C(   635.41), SIMDE_FLOAT32_C(   241.18), SIMDE_FLOAT32_C(   389.62), SIMDE_FLOAT32_C(  -875.63),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   749.87), SIMDE_FLOAT32_C(   863.59), SIMDE_FLOAT32_C(  -945.49),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   828.07), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   159.25)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   188.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    33.01), SIMDE_FLOAT32_C(    49.58),
+                           SIMDE_FLOAT32_C(   481.89), SIMDE_FLOAT32_C(   241.18), SIMDE_FLOAT32_C(   349.63), SIMDE_FLOAT32_C(    67.24),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    95.56), SIMDE_FLOAT32_C(   863.59), SIMDE_FLOAT32_C(   130.61),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   388.44), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   159.25)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -999.18), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -122.38), SIMDE_FLOAT32_C(   -49.58),
+                           SIMDE_FLOAT32_C(  -635.41), SIMDE_FLOAT32_C(  -241.18), SIMDE_FLOAT32_C(  -389.62), SIMDE_FLOAT32_C(   -67.24),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -749.87), SIMDE_FLOAT32_C(  -863.59), SIMDE_FLOAT32_C(  -130.61),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -828.07), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -159.25)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -451.03), SIMDE_FLOAT32_C(   613.14), SIMDE_FLOAT32_C(  -325.40), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(   494.09), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   303.92), SIMDE_FLOAT32_C(   597.40),
+                         SIMDE_FLOAT32_C(  -441.83), SIMDE_FLOAT32_C(   352.95), SIMDE_FLOAT32_C(    99.74), SIMDE_FLOAT32_C(   897.37),
+                         SIMDE_FLOAT32_C(    40.80), SIMDE_FLOAT32_C(   892.72), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   300.62)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   451.03), SIMDE_FLOAT32_C(  -613.14), SIMDE_FLOAT32_C(  -529.70), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(  -494.09), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -161.74), SIMDE_FLOAT32_C(   846.17),
+                         SIMDE_FLOAT32_C(  -976.79), SIMDE_FLOAT32_C(   352.95), SIMDE_FLOAT32_C(    99.74), SIMDE_FLOAT32_C(   897.37),
+                         SIMDE_FLOAT32_C(    40.80), SIMDE_FLOAT32_C(   892.72), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   269.59)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -451.03), SIMDE_FLOAT32_C(   613.14), SIMDE_FLOAT32_C(  -529.70), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(   494.09), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   161.74), SIMDE_FLOAT32_C(   597.40),
+                           SIMDE_FLOAT32_C(  -976.79), SIMDE_FLOAT32_C(   352.95), SIMDE_FLOAT32_C(    99.74), SIMDE_FLOAT32_C(   897.37),
+                           SIMDE_FLOAT32_C(    40.80), SIMDE_FLOAT32_C(   892.72), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   269.59)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   451.03), SIMDE_FLOAT32_C(   613.14), SIMDE_FLOAT32_C(  -529.70), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(   494.09), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   303.92), SIMDE_FLOAT32_C(   846.17),
+                           SIMDE_FLOAT32_C(  -976.79), SIMDE_FLOAT32_C(   352.95), SIMDE_FLOAT32_C(    99.74), SIMDE_FLOAT32_C(   897.37),
+                           SIMDE_FLOAT32_C(    40.80), SIMDE_FLOAT32_C(   892.72), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   300.62)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   451.03), SIMDE_FLOAT32_C(   613.14), SIMDE_FLOAT32_C(   325.40), SIMDE_FLOAT32_C(     0.00),
+                           SIMDE_FLOAT32_C(   494.09), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   161.74), SIMDE_FLOAT32_C(   597.40),
+                           SIMDE_FLOAT32_C(   441.83), SIMDE_FLOAT32_C(   352.95), SIMDE_FLOAT32_C(    99.74), SIMDE_FLOAT32_C(   897.37),
+                           SIMDE_FLOAT32_C(    40.80), SIMDE_FLOAT32_C(   892.72), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   269.59)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -451.03), SIMDE_FLOAT32_C(  -613.14), SIMDE_FLOAT32_C(  -325.40), SIMDE_FLOAT32_C(    -0.00),
+                           SIMDE_FLOAT32_C(  -494.09), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -303.92), SIMDE_FLOAT32_C(  -846.17),
+                           SIMDE_FLOAT32_C(  -441.83), SIMDE_FLOAT32_C(  -352.95), SIMDE_FLOAT32_C(   -99.74), SIMDE_FLOAT32_C(  -897.37),
+                           SIMDE_FLOAT32_C(   -40.80), SIMDE_FLOAT32_C(  -892.72), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -300.62)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -702.95), SIMDE_FLOAT32_C(  -900.32), SIMDE_FLOAT32_C(   589.07), SIMDE_FLOAT32_C(   893.25),
+                         SIMDE_FLOAT32_C(   -47.26), SIMDE_FLOAT32_C(   391.74), SIMDE_FLOAT32_C(   921.96), SIMDE_FLOAT32_C(    45.23),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -956.35), SIMDE_FLOAT32_C(   620.97), SIMDE_FLOAT32_C(  -983.60),
+                         SIMDE_FLOAT32_C(  -745.12), SIMDE_FLOAT32_C(   270.78), SIMDE_FLOAT32_C(  -903.66), SIMDE_FLOAT32_C(   137.47)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   243.84), SIMDE_FLOAT32_C(   900.32), SIMDE_FLOAT32_C(   808.40), SIMDE_FLOAT32_C(   954.73),
+                         SIMDE_FLOAT32_C(   634.15), SIMDE_FLOAT32_C(  -626.33), SIMDE_FLOAT32_C(  -295.54), SIMDE_FLOAT32_C(  -970.21),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   945.83), SIMDE_FLOAT32_C(  -853.66), SIMDE_FLOAT32_C(  -956.28),
+                         SIMDE_FLOAT32_C(   783.80), SIMDE_FLOAT32_C(  -270.78), SIMDE_FLOAT32_C(   915.63), SIMDE_FLOAT32_C(   137.47)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(  -702.95), SIMDE_FLOAT32_C(  -900.32), SIMDE_FLOAT32_C(   589.07), SIMDE_FLOAT32_C(   893.25),
+                           SIMDE_FLOAT32_C(   -47.26), SIMDE_FLOAT32_C(   626.33), SIMDE_FLOAT32_C(   295.54), SIMDE_FLOAT32_C(   970.21),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -956.35), SIMDE_FLOAT32_C(   853.66), SIMDE_FLOAT32_C(  -983.60),
+                           SIMDE_FLOAT32_C(  -745.12), SIMDE_FLOAT32_C(   270.78), SIMDE_FLOAT32_C(  -903.66), SIMDE_FLOAT32_C(   137.47)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -702.95), SIMDE_FLOAT32_C(   900.32), SIMDE_FLOAT32_C(   808.40), SIMDE_FLOAT32_C(   954.73),
+                           SIMDE_FLOAT32_C(   634.15), SIMDE_FLOAT32_C(  -626.33), SIMDE_FLOAT32_C(   921.96), SIMDE_FLOAT32_C(  -970.21),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -956.35), SIMDE_FLOAT32_C(  -853.66), SIMDE_FLOAT32_C(  -983.60),
+                           SIMDE_FLOAT32_C(   783.80), SIMDE_FLOAT32_C(   270.78), SIMDE_FLOAT32_C(   915.63), SIMDE_FLOAT32_C(   137.47)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(   243.84), SIMDE_FLOAT32_C(   900.32), SIMDE_FLOAT32_C(   589.07), SIMDE_FLOAT32_C(   893.25),
+                           SIMDE_FLOAT32_C(    47.26), SIMDE_FLOAT32_C(   391.74), SIMDE_FLOAT32_C(   295.54), SIMDE_FLOAT32_C(    45.23),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   945.83), SIMDE_FLOAT32_C(   620.97), SIMDE_FLOAT32_C(   956.28),
+                           SIMDE_FLOAT32_C(   745.12), SIMDE_FLOAT32_C(   270.78), SIMDE_FLOAT32_C(   903.66), SIMDE_FLOAT32_C(   137.47)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(  -243.84), SIMDE_FLOAT32_C(  -900.32), SIMDE_FLOAT32_C(  -808.40), SIMDE_FLOAT32_C(  -954.73),
+                           SIMDE_FLOAT32_C(  -634.15), SIMDE_FLOAT32_C(  -391.74), SIMDE_FLOAT32_C(  -921.96), SIMDE_FLOAT32_C(   -45.23),
+                           SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -945.83), SIMDE_FLOAT32_C(  -620.97), SIMDE_FLOAT32_C(  -956.28),
+                           SIMDE_FLOAT32_C(  -783.80), SIMDE_FLOAT32_C(  -270.78), SIMDE_FLOAT32_C(  -915.63), SIMDE_FLOAT32_C(  -137.47)) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_m512_equal(simde_mm512_range_ps(test_vec[i].a, test_vec[i].b, 0x0), test_vec[i].r[0]);
+    simde_assert_m512_equal(simde_mm512_range_ps(test_vec[i].a, test_vec[i].b, 0x7), test_vec[i].r[1]);
+    simde_assert_m512_equal(simde_mm512_range_ps(test_vec[i].a, test_vec[i].b, 0xa), test_vec[i].r[2]);
+    simde_assert_m512_equal(simde_mm512_range_ps(test_vec[i].a, test_vec[i].b, 0xd), test_vec[i].r[3]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_range_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r[4];
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(  157.39), SIMDE_FLOAT64_C( -779.58),
+                         SIMDE_FLOAT64_C(  251.57), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   74.59), SIMDE_FLOAT64_C(  426.83)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(  157.39), SIMDE_FLOAT64_C(  779.58),
+                         SIMDE_FLOAT64_C( -314.91), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(   74.59), SIMDE_FLOAT64_C(  579.50)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(  157.39), SIMDE_FLOAT64_C( -779.58),
+                           SIMDE_FLOAT64_C(  251.57), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(   74.59), SIMDE_FLOAT64_C(  579.50)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(  157.39), SIMDE_FLOAT64_C( -779.58),
+                           SIMDE_FLOAT64_C(  251.57), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(   74.59), SIMDE_FLOAT64_C(  426.83)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(  157.39), SIMDE_FLOAT64_C(  779.58),
+                           SIMDE_FLOAT64_C(  314.91), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(   74.59), SIMDE_FLOAT64_C(  579.50)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C( -157.39), SIMDE_FLOAT64_C( -779.58),
+                           SIMDE_FLOAT64_C( -314.91), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(  -74.59), SIMDE_FLOAT64_C( -426.83)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -407.73),
+                         SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -694.67),
+                         SIMDE_FLOAT64_C( -520.25), SIMDE_FLOAT64_C( -278.92),
+                         SIMDE_FLOAT64_C( -348.99), SIMDE_FLOAT64_C( -532.99)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  407.73),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  694.67),
+                         SIMDE_FLOAT64_C(  -72.44), SIMDE_FLOAT64_C( -278.92),
+                         SIMDE_FLOAT64_C(  396.49), SIMDE_FLOAT64_C(  310.75)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -407.73),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -694.67),
+                           SIMDE_FLOAT64_C(  -72.44), SIMDE_FLOAT64_C( -278.92),
+                           SIMDE_FLOAT64_C( -396.49), SIMDE_FLOAT64_C( -310.75)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -407.73),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -694.67),
+                           SIMDE_FLOAT64_C(  -72.44), SIMDE_FLOAT64_C( -278.92),
+                           SIMDE_FLOAT64_C( -348.99), SIMDE_FLOAT64_C(  310.75)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  407.73),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  694.67),
+                           SIMDE_FLOAT64_C(  520.25), SIMDE_FLOAT64_C(  278.92),
+                           SIMDE_FLOAT64_C(  396.49), SIMDE_FLOAT64_C(  532.99)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -407.73),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -694.67),
+                           SIMDE_FLOAT64_C( -520.25), SIMDE_FLOAT64_C( -278.92),
+                           SIMDE_FLOAT64_C( -348.99), SIMDE_FLOAT64_C( -532.99)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -572.02), SIMDE_FLOAT64_C( -222.51),
+                         SIMDE_FLOAT64_C( -785.52), SIMDE_FLOAT64_C( -944.33),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -876.64),
+                         SIMDE_FLOAT64_C( -490.54), SIMDE_FLOAT64_C( -889.09)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  551.45), SIMDE_FLOAT64_C( -283.49),
+                         SIMDE_FLOAT64_C( -391.70), SIMDE_FLOAT64_C(  640.60),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -876.64),
+                         SIMDE_FLOAT64_C(  247.61), SIMDE_FLOAT64_C( -889.09)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C( -551.45), SIMDE_FLOAT64_C( -222.51),
+                           SIMDE_FLOAT64_C( -391.70), SIMDE_FLOAT64_C( -640.60),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -876.64),
+                           SIMDE_FLOAT64_C( -247.61), SIMDE_FLOAT64_C( -889.09)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  551.45), SIMDE_FLOAT64_C( -222.51),
+                           SIMDE_FLOAT64_C( -391.70), SIMDE_FLOAT64_C(  640.60),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -876.64),
+                           SIMDE_FLOAT64_C(  247.61), SIMDE_FLOAT64_C( -889.09)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  572.02), SIMDE_FLOAT64_C(  283.49),
+                           SIMDE_FLOAT64_C(  785.52), SIMDE_FLOAT64_C(  944.33),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  876.64),
+                           SIMDE_FLOAT64_C(  490.54), SIMDE_FLOAT64_C(  889.09)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C( -572.02), SIMDE_FLOAT64_C( -283.49),
+                           SIMDE_FLOAT64_C( -785.52), SIMDE_FLOAT64_C( -944.33),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -876.64),
+                           SIMDE_FLOAT64_C( -490.54), SIMDE_FLOAT64_C( -889.09)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -882.02), SIMDE_FLOAT64_C( -668.37),
+                         SIMDE_FLOAT64_C( -927.91), SIMDE_FLOAT64_C(  664.14),
+                         SIMDE_FLOAT64_C( -984.85), SIMDE_FLOAT64_C(  903.87),
+                         SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -708.97)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  -46.71), SIMDE_FLOAT64_C(  668.37),
+                         SIMDE_FLOAT64_C( -927.91), SIMDE_FLOAT64_C(  567.76),
+                         SIMDE_FLOAT64_C(  595.67), SIMDE_FLOAT64_C( -712.32),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  708.97)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(  -46.71), SIMDE_FLOAT64_C( -668.37),
+                           SIMDE_FLOAT64_C( -927.91), SIMDE_FLOAT64_C(  664.14),
+                           SIMDE_FLOAT64_C( -595.67), SIMDE_FLOAT64_C(  903.87),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -708.97)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  -46.71), SIMDE_FLOAT64_C( -668.37),
+                           SIMDE_FLOAT64_C( -927.91), SIMDE_FLOAT64_C(  567.76),
+                           SIMDE_FLOAT64_C(  595.67), SIMDE_FLOAT64_C( -712.32),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -708.97)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  882.02), SIMDE_FLOAT64_C(  668.37),
+                           SIMDE_FLOAT64_C(  927.91), SIMDE_FLOAT64_C(  664.14),
+                           SIMDE_FLOAT64_C(  984.85), SIMDE_FLOAT64_C(  903.87),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  708.97)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C( -882.02), SIMDE_FLOAT64_C( -668.37),
+                           SIMDE_FLOAT64_C( -927.91), SIMDE_FLOAT64_C( -567.76),
+                           SIMDE_FLOAT64_C( -984.85), SIMDE_FLOAT64_C( -712.32),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -708.97)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -413.37),
+                         SIMDE_FLOAT64_C( -229.39), SIMDE_FLOAT64_C(  455.81),
+                         SIMDE_FLOAT64_C( -338.74), SIMDE_FLOAT64_C(  874.85),
+                         SIMDE_FLOAT64_C(  578.46), SIMDE_FLOAT64_C(  496.13)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -477.08),
+                         SIMDE_FLOAT64_C(  229.39), SIMDE_FLOAT64_C(  863.57),
+                         SIMDE_FLOAT64_C( -338.74), SIMDE_FLOAT64_C( -714.96),
+                         SIMDE_FLOAT64_C(  578.46), SIMDE_FLOAT64_C( -700.05)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -413.37),
+                           SIMDE_FLOAT64_C( -229.39), SIMDE_FLOAT64_C(  863.57),
+                           SIMDE_FLOAT64_C( -338.74), SIMDE_FLOAT64_C(  874.85),
+                           SIMDE_FLOAT64_C(  578.46), SIMDE_FLOAT64_C(  496.13)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -413.37),
+                           SIMDE_FLOAT64_C( -229.39), SIMDE_FLOAT64_C(  455.81),
+                           SIMDE_FLOAT64_C( -338.74), SIMDE_FLOAT64_C( -714.96),
+                           SIMDE_FLOAT64_C(  578.46), SIMDE_FLOAT64_C(  496.13)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  477.08),
+                           SIMDE_FLOAT64_C(  229.39), SIMDE_FLOAT64_C(  863.57),
+                           SIMDE_FLOAT64_C(  338.74), SIMDE_FLOAT64_C(  874.85),
+                           SIMDE_FLOAT64_C(  578.46), SIMDE_FLOAT64_C(  700.05)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -477.08),
+                           SIMDE_FLOAT64_C( -229.39), SIMDE_FLOAT64_C( -455.81),
+                           SIMDE_FLOAT64_C( -338.74), SIMDE_FLOAT64_C( -714.96),
+                           SIMDE_FLOAT64_C( -578.46), SIMDE_FLOAT64_C( -700.05)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  -23.16), SIMDE_FLOAT64_C(   75.38),
+                         SIMDE_FLOAT64_C(  984.05), SIMDE_FLOAT64_C( -187.47),
+                         SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -726.38),
+                         SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  553.26), SIMDE_FLOAT64_C(  767.74),
+                         SIMDE_FLOAT64_C( -984.05), SIMDE_FLOAT64_C(  901.13),
+                         SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -759.89),
+                         SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C( -553.26), SIMDE_FLOAT64_C(  767.74),
+                           SIMDE_FLOAT64_C(  984.05), SIMDE_FLOAT64_C( -901.13),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -726.38),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  -23.16), SIMDE_FLOAT64_C(   75.38),
+                           SIMDE_FLOAT64_C( -984.05), SIMDE_FLOAT64_C( -187.47),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -726.38),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  553.26), SIMDE_FLOAT64_C(  767.74),
+                           SIMDE_FLOAT64_C(  984.05), SIMDE_FLOAT64_C(  901.13),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  759.89),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  -23.16), SIMDE_FLOAT64_C(  -75.38),
+                           SIMDE_FLOAT64_C( -984.05), SIMDE_FLOAT64_C( -187.47),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -759.89),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  740.63),
+                         SIMDE_FLOAT64_C( -279.27), SIMDE_FLOAT64_C(  747.80),
+                         SIMDE_FLOAT64_C( -805.61), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(    0.00)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(  160.05),
+                         SIMDE_FLOAT64_C(  -32.34), SIMDE_FLOAT64_C( -747.80),
+                         SIMDE_FLOAT64_C(  996.75), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.00)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  740.63),
+                           SIMDE_FLOAT64_C(  -32.34), SIMDE_FLOAT64_C(  747.80),
+                           SIMDE_FLOAT64_C( -996.75), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(    0.00)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(  160.05),
+                           SIMDE_FLOAT64_C(  -32.34), SIMDE_FLOAT64_C( -747.80),
+                           SIMDE_FLOAT64_C( -805.61), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  740.63),
+                           SIMDE_FLOAT64_C(  279.27), SIMDE_FLOAT64_C(  747.80),
+                           SIMDE_FLOAT64_C(  996.75), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -160.05),
+                           SIMDE_FLOAT64_C( -279.27), SIMDE_FLOAT64_C( -747.80),
+                           SIMDE_FLOAT64_C( -805.61), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   -0.00)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  763.56), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(  784.65), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(  707.81), SIMDE_FLOAT64_C(  712.74),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  405.62)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -763.56), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C( -997.17), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C( -223.60), SIMDE_FLOAT64_C( -918.70),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -525.08)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(  763.56), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(  784.65), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(  707.81), SIMDE_FLOAT64_C(  712.74),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  405.62)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C( -763.56), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(  784.65), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C( -223.60), SIMDE_FLOAT64_C(  712.74),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  405.62)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(  763.56), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(  997.17), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(  707.81), SIMDE_FLOAT64_C(  918.70),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  525.08)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C( -763.56), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C( -997.17), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C( -223.60), SIMDE_FLOAT64_C( -918.70),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -525.08)) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_m512d_equal(simde_mm512_range_pd(test_vec[i].a, test_vec[i].b, 0x1), test_vec[i].r[0]);
+    simde_assert_m512d_equal(simde_mm512_range_pd(test_vec[i].a, test_vec[i].b, 0x6), test_vec[i].r[1]);
+    simde_assert_m512d_equal(simde_mm512_range_pd(test_vec[i].a, test_vec[i].b, 0xb), test_vec[i].r[2]);
+    simde_assert_m512d_equal(simde_mm512_range_pd(test_vec[i].a, test_vec[i].b, 0xc), test_vec[i].r[3]);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_range_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d src;
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d b;
+    simde__m512d r;
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(   76.86), SIMDE_FLOAT64_C(  872.44),
+                         SIMDE_FLOAT64_C(  282.67), SIMDE_FLOAT64_C( -163.49),
+                         SIMDE_FLOAT64_C(  -88.73), SIMDE_FLOAT64_C( -315.45),
+                         SIMDE_FLOAT64_C( -246.11), SIMDE_FLOAT64_C( -589.40)),
+      UINT8_C(227),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  124.23),
+                         SIMDE_FLOAT64_C( -468.05), SIMDE_FLOAT64_C(  424.57),
+                         SIMDE_FLOAT64_C(  425.54), SIMDE_FLOAT64_C(  980.00),
+                         SIMDE_FLOAT64_C(  966.76), SIMDE_FLOAT64_C( -941.59)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(  124.23),
+                         SIMDE_FLOAT64_C(  468.05), SIMDE_FLOAT64_C(  900.79),
+                         SIMDE_FLOAT64_C(  425.54), SIMDE_FLOAT64_C( -753.74),
+                         SIMDE_FLOAT64_C( -966.76), SIMDE_FLOAT64_C(  591.21)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  124.23),
+                         SIMDE_FLOAT64_C( -468.05), SIMDE_FLOAT64_C( -163.49),
+                         SIMDE_FLOAT64_C(  -88.73), SIMDE_FLOAT64_C( -315.45),
+                         SIMDE_FLOAT64_C(  966.76), SIMDE_FLOAT64_C( -591.21)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  882.78), SIMDE_FLOAT64_C( -422.71),
+                         SIMDE_FLOAT64_C(  240.39), SIMDE_FLOAT64_C(  302.11),
+                         SIMDE_FLOAT64_C( -667.07), SIMDE_FLOAT64_C( -654.14),
+                         SIMDE_FLOAT64_C(  298.80), SIMDE_FLOAT64_C( -757.89)),
+      UINT8_C(140),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -604.28), SIMDE_FLOAT64_C(   54.11),
+                         SIMDE_FLOAT64_C( -369.68), SIMDE_FLOAT64_C( -297.64),
+                         SIMDE_FLOAT64_C( -780.12), SIMDE_FLOAT64_C( -376.00),
+                         SIMDE_FLOAT64_C(  -31.09), SIMDE_FLOAT64_C( -271.23)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  604.28), SIMDE_FLOAT64_C(  303.04),
+                         SIMDE_FLOAT64_C( -369.68), SIMDE_FLOAT64_C( -208.21),
+                         SIMDE_FLOAT64_C(  780.12), SIMDE_FLOAT64_C( -376.00),
+                         SIMDE_FLOAT64_C(   31.09), SIMDE_FLOAT64_C( -271.23)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -604.28), SIMDE_FLOAT64_C( -422.71),
+                         SIMDE_FLOAT64_C(  240.39), SIMDE_FLOAT64_C(  302.11),
+                         SIMDE_FLOAT64_C( -780.12), SIMDE_FLOAT64_C( -376.00),
+                         SIMDE_FLOAT64_C(  298.80), SIMDE_FLOAT64_C( -757.89)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -414.23), SIMDE_FLOAT64_C(  776.93),
+                         SIMDE_FLOAT64_C( -686.07), SIMDE_FLOAT64_C(  198.97),
+                         SIMDE_FLOAT64_C( -439.88), SIMDE_FLOAT64_C( -886.48),
+                         SIMDE_FLOAT64_C(  634.36), SIMDE_FLOAT64_C(  907.92)),
+      UINT8_C( 78),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -985.36), SIMDE_FLOAT64_C(  700.33),
+                         SIMDE_FLOAT64_C( -580.94), SIMDE_FLOAT64_C( -614.66),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -720.04),
+                         SIMDE_FLOAT64_C( -364.22), SIMDE_FLOAT64_C(   -0.00)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -985.36), SIMDE_FLOAT64_C(  700.33),
+                         SIMDE_FLOAT64_C(  210.36), SIMDE_FLOAT64_C( -614.66),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -291.64),
+                         SIMDE_FLOAT64_C(  364.22), SIMDE_FLOAT64_C(   -0.00)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -414.23), SIMDE_FLOAT64_C(  700.33),
+                         SIMDE_FLOAT64_C( -686.07), SIMDE_FLOAT64_C(  198.97),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -291.64),
+                         SIMDE_FLOAT64_C( -364.22), SIMDE_FLOAT64_C(  907.92)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -443.33), SIMDE_FLOAT64_C(  705.51),
+                         SIMDE_FLOAT64_C(  749.37), SIMDE_FLOAT64_C(  587.15),
+                         SIMDE_FLOAT64_C(   89.05), SIMDE_FLOAT64_C(   24.99),
+                         SIMDE_FLOAT64_C(  282.36), SIMDE_FLOAT64_C( -295.96)),
+      UINT8_C(154),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  307.78), SIMDE_FLOAT64_C(  829.59),
+                         SIMDE_FLOAT64_C(  -63.21), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C( -877.53), SIMDE_FLOAT64_C(   83.19),
+                         SIMDE_FLOAT64_C(  227.46), SIMDE_FLOAT64_C(  334.62)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  960.22), SIMDE_FLOAT64_C(  503.05),
+                         SIMDE_FLOAT64_C(  784.96), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(  257.21), SIMDE_FLOAT64_C(  680.51),
+                         SIMDE_FLOAT64_C( -868.03), SIMDE_FLOAT64_C( -334.62)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  307.78), SIMDE_FLOAT64_C(  705.51),
+                         SIMDE_FLOAT64_C(  749.37), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C( -257.21), SIMDE_FLOAT64_C(   24.99),
+                         SIMDE_FLOAT64_C(  227.46), SIMDE_FLOAT64_C( -295.96)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -377.35), SIMDE_FLOAT64_C( -900.98),
+                         SIMDE_FLOAT64_C( -795.80), SIMDE_FLOAT64_C(  969.26),
+                         SIMDE_FLOAT64_C(  621.14), SIMDE_FLOAT64_C(  438.74),
+                         SIMDE_FLOAT64_C(  769.02), SIMDE_FLOAT64_C(  473.28)),
+      UINT8_C(157),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  -70.08), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   99.20), SIMDE_FLOAT64_C(  113.35),
+                         SIMDE_FLOAT64_C( -907.89), SIMDE_FLOAT64_C( -441.16),
+                         SIMDE_FLOAT64_C( -536.57), SIMDE_FLOAT64_C(   -0.00)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  796.10), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(  -99.20), SIMDE_FLOAT64_C( -113.35),
+                         SIMDE_FLOAT64_C(  603.82), SIMDE_FLOAT64_C(  259.56),
+                         SIMDE_FLOAT64_C(  536.57), SIMDE_FLOAT64_C(   -0.00)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  -70.08), SIMDE_FLOAT64_C( -900.98),
+                         SIMDE_FLOAT64_C( -795.80), SIMDE_FLOAT64_C(  113.35),
+                         SIMDE_FLOAT64_C( -603.82), SIMDE_FLOAT64_C( -259.56),
+                         SIMDE_FLOAT64_C(  769.02), SIMDE_FLOAT64_C(   -0.00)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  146.46), SIMDE_FLOAT64_C( -702.14),
+                         SIMDE_FLOAT64_C( -373.72), SIMDE_FLOAT64_C(  655.74),
+                         SIMDE_FLOAT64_C(  434.13), SIMDE_FLOAT64_C( -593.88),
+                         SIMDE_FLOAT64_C(  532.42), SIMDE_FLOAT64_C(  124.37)),
+      UINT8_C(249),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -185.73), SIMDE_FLOAT64_C(  723.14),
+                         SIMDE_FLOAT64_C( -140.91), SIMDE_FLOAT64_C(  560.49),
+                         SIMDE_FLOAT64_C(  582.69), SIMDE_FLOAT64_C( -366.28),
+                         SIMDE_FLOAT64_C(  931.56), SIMDE_FLOAT64_C(  -15.47)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  545.01), SIMDE_FLOAT64_C( -207.83),
+                         SIMDE_FLOAT64_C(  140.91), SIMDE_FLOAT64_C( -560.49),
+                         SIMDE_FLOAT64_C( -589.03), SIMDE_FLOAT64_C( -366.28),
+                         SIMDE_FLOAT64_C(  931.56), SIMDE_FLOAT64_C(   70.60)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -185.73), SIMDE_FLOAT64_C(  207.83),
+                         SIMDE_FLOAT64_C( -140.91), SIMDE_FLOAT64_C(  560.49),
+                         SIMDE_FLOAT64_C(  582.69), SIMDE_FLOAT64_C( -593.88),
+                         SIMDE_FLOAT64_C(  532.42), SIMDE_FLOAT64_C(  -15.47)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C( -563.37), SIMDE_FLOAT64_C( -230.88),
+                         SIMDE_FLOAT64_C(   77.88), SIMDE_FLOAT64_C(  404.38),
+                         SIMDE_FLOAT64_C(  314.20), SIMDE_FLOAT64_C( -313.52),
+                         SIMDE_FLOAT64_C(  -24.50), SIMDE_FLOAT64_C(  543.20)),
+      UINT8_C( 87),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  435.70), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   15.40), SIMDE_FLOAT64_C(  540.96),
+                         SIMDE_FLOAT64_C( -360.84), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(  718.73), SIMDE_FLOAT64_C(  652.10)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  736.90), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   15.40), SIMDE_FLOAT64_C(  940.26),
+                         SIMDE_FLOAT64_C(  829.58), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(  -11.69), SIMDE_FLOAT64_C(  373.16)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -563.37), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   77.88), SIMDE_FLOAT64_C(  540.96),
+                         SIMDE_FLOAT64_C(  314.20), SIMDE_FLOAT64_C(   -0.00),
+                         SIMDE_FLOAT64_C(   11.69), SIMDE_FLOAT64_C(  373.16)) },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  962.57), SIMDE_FLOAT64_C(  120.89),
+                         SIMDE_FLOAT64_C( -546.19), SIMDE_FLOAT64_C( -900.12),
+                         SIMDE_FLOAT64_C( -256.27), SIMDE_FLOAT64_C( -472.73),
+                         SIMDE_FLOAT64_C(  -22.08), SIMDE_FLOAT64_C(  864.08)),
+      UINT8_C(  0),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C( -258.19), SIMDE_FLOAT64_C(  670.47),
+                         SIMDE_FLOAT64_C( -460.74), SIMDE_FLOAT64_C(  669.81),
+                         SIMDE_FLOAT64_C( -524.50), SIMDE_FLOAT64_C( -734.14),
+                         SIMDE_FLOAT64_C(  952.57), SIMDE_FLOAT64_C( -264.37)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  693.00), SIMDE_FLOAT64_C(  825.88),
+                         SIMDE_FLOAT64_C(  477.08), SIMDE_FLOAT64_C( -542.78),
+                         SIMDE_FLOAT64_C( -307.74), SIMDE_FLOAT64_C(  226.43),
+                         SIMDE_FLOAT64_C( -952.57), SIMDE_FLOAT64_C(  749.28)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  962.57), SIMDE_FLOAT64_C(  120.89),
+                         SIMDE_FLOAT64_C( -546.19), SIMDE_FLOAT64_C( -900.12),
+                         SIMDE_FLOAT64_C( -256.27), SIMDE_FLOAT64_C( -472.73),
+                         SIMDE_FLOAT64_C(  -22.08), SIMDE_FLOAT64_C(  864.08)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_mask_range_pd(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b, 0x2);
+    simde_assert_m512d_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_range_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512 a;
+    simde__m512 b;
+    simde__m512 r;
+  } test_vec[8] = {
+    { UINT16_C(49540),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -824.86), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   506.28), SIMDE_FLOAT32_C(   159.03),
+                         SIMDE_FLOAT32_C(  -749.23), SIMDE_FLOAT32_C(  -169.30), SIMDE_FLOAT32_C(  -789.13), SIMDE_FLOAT32_C(  -507.17),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -104.82), SIMDE_FLOAT32_C(  -892.79), SIMDE_FLOAT32_C(  -319.05),
+                         SIMDE_FLOAT32_C(   -34.48), SIMDE_FLOAT32_C(   801.16), SIMDE_FLOAT32_C(   488.71), SIMDE_FLOAT32_C(    -0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -824.86), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -506.28), SIMDE_FLOAT32_C(  -818.56),
+                         SIMDE_FLOAT32_C(   449.80), SIMDE_FLOAT32_C(  -169.30), SIMDE_FLOAT32_C(   779.46), SIMDE_FLOAT32_C(  -507.17),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -249.31), SIMDE_FLOAT32_C(  -892.79), SIMDE_FLOAT32_C(   705.87),
+                         SIMDE_FLOAT32_C(   451.21), SIMDE_FLOAT32_C(   831.88), SIMDE_FLOAT32_C(   848.92), SIMDE_FLOAT32_C(    -0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -824.86), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -507.17),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   831.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00)) },
+    { UINT16_C(19782),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -918.96), SIMDE_FLOAT32_C(  -925.09), SIMDE_FLOAT32_C(  -746.04), SIMDE_FLOAT32_C(   791.04),
+                         SIMDE_FLOAT32_C(   800.32), SIMDE_FLOAT32_C(   371.82), SIMDE_FLOAT32_C(   819.38), SIMDE_FLOAT32_C(  -782.47),
+                         SIMDE_FLOAT32_C(  -549.88), SIMDE_FLOAT32_C(   310.77), SIMDE_FLOAT32_C(  -840.22), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   817.44), SIMDE_FLOAT32_C(     3.15), SIMDE_FLOAT32_C(  -262.07), SIMDE_FLOAT32_C(  -605.87)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -918.96), SIMDE_FLOAT32_C(  -603.08), SIMDE_FLOAT32_C(   554.72), SIMDE_FLOAT32_C(  -998.58),
+                         SIMDE_FLOAT32_C(  -902.91), SIMDE_FLOAT32_C(  -769.95), SIMDE_FLOAT32_C(    59.38), SIMDE_FLOAT32_C(  -412.91),
+                         SIMDE_FLOAT32_C(   468.57), SIMDE_FLOAT32_C(  -519.38), SIMDE_FLOAT32_C(   186.28), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(   817.44), SIMDE_FLOAT32_C(    -3.15), SIMDE_FLOAT32_C(   262.07), SIMDE_FLOAT32_C(   605.87)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -603.08), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   800.32), SIMDE_FLOAT32_C(   371.82), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -412.91),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   310.77), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     3.15), SIMDE_FLOAT32_C(   262.07), SIMDE_FLOAT32_C(     0.00)) },
+    { UINT16_C(24503),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   679.44), SIMDE_FLOAT32_C(  -358.77), SIMDE_FLOAT32_C(   846.66), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(  -622.16), SIMDE_FLOAT32_C(  -182.17), SIMDE_FLOAT32_C(   232.37), SIMDE_FLOAT32_C(  -108.38),
+                         SIMDE_FLOAT32_C(  -536.18), SIMDE_FLOAT32_C(   -10.03), SIMDE_FLOAT32_C(   841.46), SIMDE_FLOAT32_C(   232.23),
+                         SIMDE_FLOAT32_C(   667.55), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   967.73), SIMDE_FLOAT32_C(  -680.70)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -679.44), SIMDE_FLOAT32_C(   724.80), SIMDE_FLOAT32_C(  -117.85), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(  -272.46), SIMDE_FLOAT32_C(   182.17), SIMDE_FLOAT32_C(   709.99), SIMDE_FLOAT32_C(   881.51),
+                         SIMDE_FLOAT32_C(   388.11), SIMDE_FLOAT32_C(  -832.66), SIMDE_FLOAT32_C(   225.04), SIMDE_FLOAT32_C(   232.23),
+                         SIMDE_FLOAT32_C(  -667.55), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   538.41), SIMDE_FLOAT32_C(  -680.70)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   724.80), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(  -272.46), SIMDE_FLOAT32_C(   182.17), SIMDE_FLOAT32_C(   709.99), SIMDE_FLOAT32_C(   881.51),
+                         SIMDE_FLOAT32_C(   388.11), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   841.46), SIMDE_FLOAT32_C(   232.23),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   967.73), SIMDE_FLOAT32_C(  -680.70)) },
+    { UINT16_C( 7530),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -161.35), SIMDE_FLOAT32_C(  -221.61), SIMDE_FLOAT32_C(   584.42), SIMDE_FLOAT32_C(   217.43),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   720.73),
+                         SIMDE_FLOAT32_C(   262.21), SIMDE_FLOAT32_C(   595.86), SIMDE_FLOAT32_C(  -711.17), SIMDE_FLOAT32_C(    14.75),
+                         SIMDE_FLOAT32_C(  -848.99), SIMDE_FLOAT32_C(    37.94), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   690.32)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   161.35), SIMDE_FLOAT32_C(   696.85), SIMDE_FLOAT32_C(  -584.42), SIMDE_FLOAT32_C(  -263.71),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -720.73),
+                         SIMDE_FLOAT32_C(  -531.26), SIMDE_FLOAT32_C(  -595.86), SIMDE_FLOAT32_C(  -239.27), SIMDE_FLOAT32_C(   399.80),
+                         SIMDE_FLOAT32_C(  -613.67), SIMDE_FLOAT32_C(    13.94), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  -149.51)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   217.43),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   720.73),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   595.86), SIMDE_FLOAT32_C(  -239.27), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(  -613.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00)) },
+    { UINT16_C(55899),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -312.25), SIMDE_FLOAT32_C(   748.56), SIMDE_FLOAT32_C(   302.75), SIMDE_FLOAT32_C(  -203.89),
+                         SIMDE_FLOAT32_C(   114.52), SIMDE_FLOAT32_C(   116.47), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   379.02), SIMDE_FLOAT32_C(   101.13), SIMDE_FLOAT32_C(   733.80), SIMDE_FLOAT32_C(  -230.17),
+                         SIMDE_FLOAT32_C(  -706.96), SIMDE_FLOAT32_C(    34.58), SIMDE_FLOAT32_C(   249.48), SIMDE_FLOAT32_C(   923.32)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   390.29), SIMDE_FLOAT32_C(   511.26), SIMDE_FLOAT32_C(  -509.57), SIMDE_FLOAT32_C(  -468.13),
+                         SIMDE_FLOAT32_C(    59.64), SIMDE_FLOAT32_C(  -116.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   599.13), SIMDE_FLOAT32_C(  -419.54), SIMDE_FLOAT32_C(  -733.80), SIMDE_FLOAT32_C(   230.17),
+                         SIMDE_FLOAT32_C(  -706.96), SIMDE_FLOAT32_C(  -120.01), SIMDE_FLOAT32_C(    89.06), SIMDE_FLOAT32_C(   923.32)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   390.29), SIMDE_FLOAT32_C(   748.56), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -203.89),
+                         SIMDE_FLOAT32_C(   114.52), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   101.13), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   230.17),
+                         SIMDE_FLOAT32_C(  -706.96), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   249.48), SIMDE_FLOAT32_C(   923.32)) },
+    { UINT16_C(45605),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   -60.51), SIMDE_FLOAT32_C(   919.77), SIMDE_FLOAT32_C(   448.50), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   808.80), SIMDE_FLOAT32_C(  -915.15), SIMDE_FLOAT32_C(   536.67), SIMDE_FLOAT32_C(   150.97),
+                         SIMDE_FLOAT32_C(  -159.80), SIMDE_FLOAT32_C(   375.98), SIMDE_FLOAT32_C(  -624.27), SIMDE_FLOAT32_C(  -300.63),
+                         SIMDE_FLOAT32_C(   980.95), SIMDE_FLOAT32_C(   439.00), SIMDE_FLOAT32_C(  -660.69), SIMDE_FLOAT32_C(     0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   485.39), SIMDE_FLOAT32_C(   979.53), SIMDE_FLOAT32_C(   448.50), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   580.78), SIMDE_FLOAT32_C(   764.71), SIMDE_FLOAT32_C(  -536.67), SIMDE_FLOAT32_C(   150.97),
+                         SIMDE_FLOAT32_C(   393.72), SIMDE_FLOAT32_C(  -536.82), SIMDE_FLOAT32_C(  -809.48), SIMDE_FLOAT32_C(  -819.86),
+                         SIMDE_FLOAT32_C(   800.57), SIMDE_FLOAT32_C(  -439.00), SIMDE_FLOAT32_C(   660.69), SIMDE_FLOAT32_C(    -0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   485.39), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   448.50), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   536.67), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -624.27), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   439.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00)) },
+    { UINT16_C(53552),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -442.12), SIMDE_FLOAT32_C(   116.77), SIMDE_FLOAT32_C(   876.32),
+                         SIMDE_FLOAT32_C(   116.05), SIMDE_FLOAT32_C(   846.12), SIMDE_FLOAT32_C(   437.53), SIMDE_FLOAT32_C(   551.33),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -168.49), SIMDE_FLOAT32_C(   141.20), SIMDE_FLOAT32_C(  -124.42),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   316.56), SIMDE_FLOAT32_C(  -271.11), SIMDE_FLOAT32_C(    -0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -442.12), SIMDE_FLOAT32_C(   116.77), SIMDE_FLOAT32_C(  -876.32),
+                         SIMDE_FLOAT32_C(  -308.34), SIMDE_FLOAT32_C(  -520.44), SIMDE_FLOAT32_C(   437.53), SIMDE_FLOAT32_C(   551.33),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -956.34), SIMDE_FLOAT32_C(   116.47), SIMDE_FLOAT32_C(   654.11),
+                         SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(   262.18), SIMDE_FLOAT32_C(   685.81), SIMDE_FLOAT32_C(    -0.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -442.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   876.32),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   551.33),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   141.20), SIMDE_FLOAT32_C(   654.11),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00)) },
+    { UINT16_C(14184),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(   125.80), SIMDE_FLOAT32_C(   844.83), SIMDE_FLOAT32_C(  -606.15), SIMDE_FLOAT32_C(  -362.81),
+                         SIMDE_FLOAT32_C(   701.23), SIMDE_FLOAT32_C(   741.44), SIMDE_FLOAT32_C(   932.57), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   870.79), SIMDE_FLOAT32_C(   429.69), SIMDE_FLOAT32_C(  -513.53), SIMDE_FLOAT32_C(  -259.80),
+                         SIMDE_FLOAT32_C(  -419.18), SIMDE_FLOAT32_C(   920.86), SIMDE_FLOAT32_C(  -278.90), SIMDE_FLOAT32_C(  -743.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(  -735.47), SIMDE_FLOAT32_C(   844.83), SIMDE_FLOAT32_C(   757.87), SIMDE_FLOAT32_C(  -362.81),
+                         SIMDE_FLOAT32_C(   972.01), SIMDE_FLOAT32_C(   741.44), SIMDE_FLOAT32_C(  -932.57), SIMDE_FLOAT32_C(    -0.00),
+                         SIMDE_FLOAT32_C(   870.79), SIMDE_FLOAT32_C(   429.69), SIMDE_FLOAT32_C(  -551.75), SIMDE_FLOAT32_C(  -714.18),
+                         SIMDE_FLOAT32_C(   -28.13), SIMDE_FLOAT32_C(   850.13), SIMDE_FLOAT32_C(   412.99), SIMDE_FLOAT32_C(   743.00)),
+      simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   757.87), SIMDE_FLOAT32_C(  -362.81),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   741.44), SIMDE_FLOAT32_C(   932.57), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   429.69), SIMDE_FLOAT32_C(  -513.53), SIMDE_FLOAT32_C(     0.00),
+                         SIMDE_FLOAT32_C(   -28.13), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512 r = simde_mm512_maskz_range_ps(test_vec[i].k, test_vec[i].a, test_vec[i].b, 0x5);
+    simde_assert_m512_equal(r, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_ps(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512 a;
+    simde__m512 r[4];
+  } test_vec[8] = {
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(   -62.92), SIMDE_FLOAT32_C(    95.99), SIMDE_FLOAT32_C(   -84.94), SIMDE_FLOAT32_C(   -26.27),
+                         SIMDE_FLOAT32_C(    59.25), SIMDE_FLOAT32_C(    68.23), SIMDE_FLOAT32_C(    44.96), SIMDE_FLOAT32_C(    72.52),
+                         SIMDE_FLOAT32_C(    -1.25), SIMDE_FLOAT32_C(   -43.55), SIMDE_FLOAT32_C(    39.53), SIMDE_FLOAT32_C(    -9.79),
+                         SIMDE_FLOAT32_C(   -24.29), SIMDE_FLOAT32_C(    55.08), SIMDE_FLOAT32_C(    17.81), SIMDE_FLOAT32_C(   -74.67)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(    -0.27),
+                           SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(     0.23), SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(    -0.48),
+                           SIMDE_FLOAT32_C(    -0.25), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(    -0.47), SIMDE_FLOAT32_C(     0.21),
+                           SIMDE_FLOAT32_C(    -0.29), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(    -0.19), SIMDE_FLOAT32_C(     0.33)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.49), SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(     0.23),
+                           SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(     0.23), SIMDE_FLOAT32_C(     0.46), SIMDE_FLOAT32_C(     0.02),
+                           SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(     0.21),
+                           SIMDE_FLOAT32_C(     0.21), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.31), SIMDE_FLOAT32_C(     0.33)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.17), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(    -0.19), SIMDE_FLOAT32_C(    -0.02),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.02), SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(    -0.23),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.22), SIMDE_FLOAT32_C(    -0.04),
+                           SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(    -0.17), SIMDE_FLOAT32_C(    -0.19), SIMDE_FLOAT32_C(    -0.17)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(     0.11), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.02),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.11), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.02),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(    -0.04),
+                           SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(    -0.04)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(   -52.42), SIMDE_FLOAT32_C(   -30.76), SIMDE_FLOAT32_C(   -33.00), SIMDE_FLOAT32_C(    59.66),
+                         SIMDE_FLOAT32_C(   -44.10), SIMDE_FLOAT32_C(    38.17), SIMDE_FLOAT32_C(    75.24), SIMDE_FLOAT32_C(    58.79),
+                         SIMDE_FLOAT32_C(    21.53), SIMDE_FLOAT32_C(   -89.73), SIMDE_FLOAT32_C(    44.92), SIMDE_FLOAT32_C(   -20.11),
+                         SIMDE_FLOAT32_C(   -10.24), SIMDE_FLOAT32_C(    54.53), SIMDE_FLOAT32_C(   -72.13), SIMDE_FLOAT32_C(   -50.53)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.42), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.34),
+                           SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(     0.17), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(    -0.21),
+                           SIMDE_FLOAT32_C(    -0.47), SIMDE_FLOAT32_C(     0.27), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.11),
+                           SIMDE_FLOAT32_C(    -0.24), SIMDE_FLOAT32_C(    -0.47), SIMDE_FLOAT32_C(    -0.13), SIMDE_FLOAT32_C(     0.47)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.16),
+                           SIMDE_FLOAT32_C(     0.40), SIMDE_FLOAT32_C(     0.17), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(     0.29),
+                           SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(     0.27), SIMDE_FLOAT32_C(     0.42), SIMDE_FLOAT32_C(     0.39),
+                           SIMDE_FLOAT32_C(     0.26), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(     0.37), SIMDE_FLOAT32_C(     0.47)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.17), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.09),
+                           SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(    -0.21),
+                           SIMDE_FLOAT32_C(    -0.22), SIMDE_FLOAT32_C(    -0.23), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.11),
+                           SIMDE_FLOAT32_C(    -0.24), SIMDE_FLOAT32_C(    -0.22), SIMDE_FLOAT32_C(    -0.13), SIMDE_FLOAT32_C(    -0.03)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.03),
+                           SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(     0.11), SIMDE_FLOAT32_C(     0.04),
+                           SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(    -0.11), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(    -0.11),
+                           SIMDE_FLOAT32_C(    -0.11), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(    -0.03)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(     5.34), SIMDE_FLOAT32_C(    51.06), SIMDE_FLOAT32_C(   -70.76), SIMDE_FLOAT32_C(   -77.65),
+                         SIMDE_FLOAT32_C(    47.63), SIMDE_FLOAT32_C(     1.95), SIMDE_FLOAT32_C(   -49.95), SIMDE_FLOAT32_C(   -14.94),
+                         SIMDE_FLOAT32_C(    21.21), SIMDE_FLOAT32_C(    40.47), SIMDE_FLOAT32_C(    -6.07), SIMDE_FLOAT32_C(    95.82),
+                         SIMDE_FLOAT32_C(    68.68), SIMDE_FLOAT32_C(   -73.33), SIMDE_FLOAT32_C(    95.10), SIMDE_FLOAT32_C(   -11.52)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.34), SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(     0.35),
+                           SIMDE_FLOAT32_C(    -0.37), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(     0.05), SIMDE_FLOAT32_C(     0.06),
+                           SIMDE_FLOAT32_C(     0.21), SIMDE_FLOAT32_C(     0.47), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.18),
+                           SIMDE_FLOAT32_C(    -0.32), SIMDE_FLOAT32_C(    -0.33), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(     0.48)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.34), SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(     0.35),
+                           SIMDE_FLOAT32_C(     0.13), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.05), SIMDE_FLOAT32_C(     0.06),
+                           SIMDE_FLOAT32_C(     0.21), SIMDE_FLOAT32_C(     0.47), SIMDE_FLOAT32_C(     0.43), SIMDE_FLOAT32_C(     0.32),
+                           SIMDE_FLOAT32_C(     0.18), SIMDE_FLOAT32_C(     0.17), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(     0.48)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.16), SIMDE_FLOAT32_C(    -0.19), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(    -0.15),
+                           SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.20), SIMDE_FLOAT32_C(    -0.19),
+                           SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.18),
+                           SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.15), SIMDE_FLOAT32_C(    -0.02)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(    -0.03),
+                           SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.06),
+                           SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(     0.07),
+                           SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(    -0.02)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(    54.21), SIMDE_FLOAT32_C(    56.57), SIMDE_FLOAT32_C(   -79.54), SIMDE_FLOAT32_C(    22.80),
+                         SIMDE_FLOAT32_C(    -1.05), SIMDE_FLOAT32_C(     9.08), SIMDE_FLOAT32_C(    12.72), SIMDE_FLOAT32_C(    38.63),
+                         SIMDE_FLOAT32_C(    82.19), SIMDE_FLOAT32_C(    86.65), SIMDE_FLOAT32_C(   -92.59), SIMDE_FLOAT32_C(   -97.69),
+                         SIMDE_FLOAT32_C(    15.45), SIMDE_FLOAT32_C(    66.74), SIMDE_FLOAT32_C(    79.39), SIMDE_FLOAT32_C(   -45.16)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.21), SIMDE_FLOAT32_C(    -0.43), SIMDE_FLOAT32_C(     0.46), SIMDE_FLOAT32_C(    -0.20),
+                           SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(    -0.28), SIMDE_FLOAT32_C(    -0.37),
+                           SIMDE_FLOAT32_C(     0.19), SIMDE_FLOAT32_C(    -0.35), SIMDE_FLOAT32_C(     0.41), SIMDE_FLOAT32_C(     0.31),
+                           SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(    -0.26), SIMDE_FLOAT32_C(     0.39), SIMDE_FLOAT32_C(    -0.16)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.21), SIMDE_FLOAT32_C(     0.07), SIMDE_FLOAT32_C(     0.46), SIMDE_FLOAT32_C(     0.30),
+                           SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.22), SIMDE_FLOAT32_C(     0.13),
+                           SIMDE_FLOAT32_C(     0.19), SIMDE_FLOAT32_C(     0.15), SIMDE_FLOAT32_C(     0.41), SIMDE_FLOAT32_C(     0.31),
+                           SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(     0.39), SIMDE_FLOAT32_C(     0.34)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(    -0.18), SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(    -0.20),
+                           SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.17), SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.12),
+                           SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(    -0.09), SIMDE_FLOAT32_C(    -0.19),
+                           SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(    -0.11), SIMDE_FLOAT32_C(    -0.16)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.07), SIMDE_FLOAT32_C(    -0.04), SIMDE_FLOAT32_C(     0.05),
+                           SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(     0.01),
+                           SIMDE_FLOAT32_C(     0.07), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(    -0.09), SIMDE_FLOAT32_C(    -0.07),
+                           SIMDE_FLOAT32_C(     0.07), SIMDE_FLOAT32_C(     0.11), SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(    -0.03)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(   -38.31), SIMDE_FLOAT32_C(    56.09), SIMDE_FLOAT32_C(    59.54), SIMDE_FLOAT32_C(     7.38),
+                         SIMDE_FLOAT32_C(    20.22), SIMDE_FLOAT32_C(   -67.70), SIMDE_FLOAT32_C(   -79.40), SIMDE_FLOAT32_C(   -32.72),
+                         SIMDE_FLOAT32_C(   -16.03), SIMDE_FLOAT32_C(    54.63), SIMDE_FLOAT32_C(    -9.05), SIMDE_FLOAT32_C(    91.21),
+                         SIMDE_FLOAT32_C(    -4.85), SIMDE_FLOAT32_C(    56.95), SIMDE_FLOAT32_C(   -60.46), SIMDE_FLOAT32_C(   -13.76)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.31), SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(    -0.46), SIMDE_FLOAT32_C(     0.38),
+                           SIMDE_FLOAT32_C(     0.22), SIMDE_FLOAT32_C(     0.30), SIMDE_FLOAT32_C(    -0.40), SIMDE_FLOAT32_C(     0.28),
+                           SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.37), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(     0.21),
+                           SIMDE_FLOAT32_C(     0.15), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.46), SIMDE_FLOAT32_C(     0.24)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.19), SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(     0.38),
+                           SIMDE_FLOAT32_C(     0.22), SIMDE_FLOAT32_C(     0.30), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(     0.28),
+                           SIMDE_FLOAT32_C(     0.47), SIMDE_FLOAT32_C(     0.13), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.21),
+                           SIMDE_FLOAT32_C(     0.15), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(     0.24)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(    -0.16), SIMDE_FLOAT32_C(    -0.21), SIMDE_FLOAT32_C(    -0.12),
+                           SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.20), SIMDE_FLOAT32_C(    -0.15), SIMDE_FLOAT32_C(    -0.22),
+                           SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.04),
+                           SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.21), SIMDE_FLOAT32_C(    -0.01)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(     0.01),
+                           SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.10),
+                           SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(     0.08),
+                           SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.01)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(    31.56), SIMDE_FLOAT32_C(   -12.32), SIMDE_FLOAT32_C(    -6.03), SIMDE_FLOAT32_C(    94.87),
+                         SIMDE_FLOAT32_C(   -26.70), SIMDE_FLOAT32_C(   -43.32), SIMDE_FLOAT32_C(    92.17), SIMDE_FLOAT32_C(     0.32),
+                         SIMDE_FLOAT32_C(    26.92), SIMDE_FLOAT32_C(    93.66), SIMDE_FLOAT32_C(    27.34), SIMDE_FLOAT32_C(   -17.19),
+                         SIMDE_FLOAT32_C(    87.95), SIMDE_FLOAT32_C(    72.81), SIMDE_FLOAT32_C(     2.10), SIMDE_FLOAT32_C(   -54.58)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.44), SIMDE_FLOAT32_C(    -0.32), SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.13),
+                           SIMDE_FLOAT32_C(     0.30), SIMDE_FLOAT32_C(    -0.32), SIMDE_FLOAT32_C(     0.17), SIMDE_FLOAT32_C(     0.32),
+                           SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.34), SIMDE_FLOAT32_C(     0.34), SIMDE_FLOAT32_C(    -0.19),
+                           SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.19), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(     0.42)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(     0.18), SIMDE_FLOAT32_C(     0.47), SIMDE_FLOAT32_C(     0.37),
+                           SIMDE_FLOAT32_C(     0.30), SIMDE_FLOAT32_C(     0.18), SIMDE_FLOAT32_C(     0.17), SIMDE_FLOAT32_C(     0.32),
+                           SIMDE_FLOAT32_C(     0.42), SIMDE_FLOAT32_C(     0.16), SIMDE_FLOAT32_C(     0.34), SIMDE_FLOAT32_C(     0.31),
+                           SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.31), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(     0.42)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.19), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.13),
+                           SIMDE_FLOAT32_C(    -0.20), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.18),
+                           SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.09), SIMDE_FLOAT32_C(    -0.16), SIMDE_FLOAT32_C(    -0.19),
+                           SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.19), SIMDE_FLOAT32_C(    -0.15), SIMDE_FLOAT32_C(    -0.08)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(     0.12),
+                           SIMDE_FLOAT32_C(    -0.08), SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(     0.07),
+                           SIMDE_FLOAT32_C(     0.05), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(    -0.07),
+                           SIMDE_FLOAT32_C(     0.07), SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(     0.10), SIMDE_FLOAT32_C(    -0.08)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(   -92.20), SIMDE_FLOAT32_C(   -82.87), SIMDE_FLOAT32_C(   -47.49), SIMDE_FLOAT32_C(   -92.47),
+                         SIMDE_FLOAT32_C(    21.76), SIMDE_FLOAT32_C(    60.45), SIMDE_FLOAT32_C(   -90.74), SIMDE_FLOAT32_C(   -14.46),
+                         SIMDE_FLOAT32_C(    40.43), SIMDE_FLOAT32_C(   -19.12), SIMDE_FLOAT32_C(    97.63), SIMDE_FLOAT32_C(    -4.37),
+                         SIMDE_FLOAT32_C(    32.26), SIMDE_FLOAT32_C(    73.53), SIMDE_FLOAT32_C(   -65.47), SIMDE_FLOAT32_C(   -99.82)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.20), SIMDE_FLOAT32_C(     0.13), SIMDE_FLOAT32_C(    -0.49), SIMDE_FLOAT32_C(    -0.47),
+                           SIMDE_FLOAT32_C(    -0.24), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.26), SIMDE_FLOAT32_C(    -0.46),
+                           SIMDE_FLOAT32_C(     0.43), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.37), SIMDE_FLOAT32_C(    -0.37),
+                           SIMDE_FLOAT32_C(     0.26), SIMDE_FLOAT32_C(    -0.47), SIMDE_FLOAT32_C(    -0.47), SIMDE_FLOAT32_C(     0.18)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.30), SIMDE_FLOAT32_C(     0.13), SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(     0.03),
+                           SIMDE_FLOAT32_C(     0.26), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.26), SIMDE_FLOAT32_C(     0.04),
+                           SIMDE_FLOAT32_C(     0.43), SIMDE_FLOAT32_C(     0.38), SIMDE_FLOAT32_C(     0.13), SIMDE_FLOAT32_C(     0.13),
+                           SIMDE_FLOAT32_C(     0.26), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(     0.18)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.20), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.24), SIMDE_FLOAT32_C(    -0.22),
+                           SIMDE_FLOAT32_C(    -0.24), SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -0.24), SIMDE_FLOAT32_C(    -0.21),
+                           SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.12),
+                           SIMDE_FLOAT32_C(    -0.24), SIMDE_FLOAT32_C(    -0.22), SIMDE_FLOAT32_C(    -0.22), SIMDE_FLOAT32_C(    -0.07)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.07), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(    -0.10),
+                           SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(    -0.11), SIMDE_FLOAT32_C(    -0.09),
+                           SIMDE_FLOAT32_C(     0.06), SIMDE_FLOAT32_C(    -0.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.12),
+                           SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(    -0.07)) } },
+    { simde_mm512_set_ps(SIMDE_FLOAT32_C(    42.33), SIMDE_FLOAT32_C(   -86.26), SIMDE_FLOAT32_C(     2.15), SIMDE_FLOAT32_C(    93.38),
+                         SIMDE_FLOAT32_C(    84.59), SIMDE_FLOAT32_C(    33.64), SIMDE_FLOAT32_C(    47.37), SIMDE_FLOAT32_C(   -68.20),
+                         SIMDE_FLOAT32_C(   -58.25), SIMDE_FLOAT32_C(   -60.48), SIMDE_FLOAT32_C(   -78.64), SIMDE_FLOAT32_C(    91.64),
+                         SIMDE_FLOAT32_C(   -48.41), SIMDE_FLOAT32_C(   -17.56), SIMDE_FLOAT32_C(    24.44), SIMDE_FLOAT32_C(   -82.14)),
+      { simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.33), SIMDE_FLOAT32_C(    -0.26), SIMDE_FLOAT32_C(     0.15), SIMDE_FLOAT32_C(     0.38),
+                           SIMDE_FLOAT32_C(    -0.41), SIMDE_FLOAT32_C(    -0.36), SIMDE_FLOAT32_C(     0.37), SIMDE_FLOAT32_C(    -0.20),
+                           SIMDE_FLOAT32_C(    -0.25), SIMDE_FLOAT32_C(    -0.48), SIMDE_FLOAT32_C(     0.36), SIMDE_FLOAT32_C(    -0.36),
+                           SIMDE_FLOAT32_C(    -0.41), SIMDE_FLOAT32_C(     0.44), SIMDE_FLOAT32_C(     0.44), SIMDE_FLOAT32_C(    -0.14)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.33), SIMDE_FLOAT32_C(     0.24), SIMDE_FLOAT32_C(     0.15), SIMDE_FLOAT32_C(     0.38),
+                           SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(     0.14), SIMDE_FLOAT32_C(     0.37), SIMDE_FLOAT32_C(     0.30),
+                           SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(     0.02), SIMDE_FLOAT32_C(     0.36), SIMDE_FLOAT32_C(     0.14),
+                           SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(     0.44), SIMDE_FLOAT32_C(     0.44), SIMDE_FLOAT32_C(     0.36)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(    -0.17), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(    -0.12),
+                           SIMDE_FLOAT32_C(    -0.16), SIMDE_FLOAT32_C(    -0.11), SIMDE_FLOAT32_C(    -0.13), SIMDE_FLOAT32_C(    -0.20),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.23), SIMDE_FLOAT32_C(    -0.14), SIMDE_FLOAT32_C(    -0.11),
+                           SIMDE_FLOAT32_C(    -0.16), SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(    -0.14)),
+        simde_mm512_set_ps(SIMDE_FLOAT32_C(     0.08), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(     0.03), SIMDE_FLOAT32_C(     0.00),
+                           SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(     0.12), SIMDE_FLOAT32_C(    -0.07),
+                           SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(    -0.01), SIMDE_FLOAT32_C(     0.01),
+                           SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(     0.07), SIMDE_FLOAT32_C(    -0.01)) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_m512_close(simde_mm512_reduce_ps(test_vec[i].a, 0x00), test_vec[i].r[0], 1);
+    simde_assert_m512_close(simde_mm512_reduce_ps(test_vec[i].a, 0x11), test_vec[i].r[1], 1);
+    simde_assert_m512_close(simde_mm512_reduce_ps(test_vec[i].a, 0x22), test_vec[i].r[2], 1);
+    simde_assert_m512_close(simde_mm512_reduce_ps(test_vec[i].a, 0x33), test_vec[i].r[3], 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_reduce_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512d a;
+    simde__m512d r[4];
+  } test_vec[8] = {
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  -18.01), SIMDE_FLOAT64_C(    3.07),
+                         SIMDE_FLOAT64_C(  -97.51), SIMDE_FLOAT64_C(  -97.31),
+                         SIMDE_FLOAT64_C(    6.62), SIMDE_FLOAT64_C(  -33.31),
+                         SIMDE_FLOAT64_C(   85.85), SIMDE_FLOAT64_C(   73.11)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.01), SIMDE_FLOAT64_C(    0.07),
+                           SIMDE_FLOAT64_C(    0.49), SIMDE_FLOAT64_C(   -0.31),
+                           SIMDE_FLOAT64_C(   -0.38), SIMDE_FLOAT64_C(   -0.31),
+                           SIMDE_FLOAT64_C(   -0.15), SIMDE_FLOAT64_C(    0.11)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.49), SIMDE_FLOAT64_C(    0.07),
+                           SIMDE_FLOAT64_C(    0.49), SIMDE_FLOAT64_C(    0.19),
+                           SIMDE_FLOAT64_C(    0.12), SIMDE_FLOAT64_C(    0.19),
+                           SIMDE_FLOAT64_C(    0.35), SIMDE_FLOAT64_C(    0.11)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.01), SIMDE_FLOAT64_C(   -0.18),
+                           SIMDE_FLOAT64_C(   -0.01), SIMDE_FLOAT64_C(   -0.06),
+                           SIMDE_FLOAT64_C(   -0.13), SIMDE_FLOAT64_C(   -0.06),
+                           SIMDE_FLOAT64_C(   -0.15), SIMDE_FLOAT64_C(   -0.14)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.01), SIMDE_FLOAT64_C(    0.07),
+                           SIMDE_FLOAT64_C(   -0.01), SIMDE_FLOAT64_C(   -0.06),
+                           SIMDE_FLOAT64_C(    0.12), SIMDE_FLOAT64_C(   -0.06),
+                           SIMDE_FLOAT64_C(    0.10), SIMDE_FLOAT64_C(    0.11)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(    3.77), SIMDE_FLOAT64_C(    4.89),
+                         SIMDE_FLOAT64_C(   59.70), SIMDE_FLOAT64_C(   50.88),
+                         SIMDE_FLOAT64_C(   -8.12), SIMDE_FLOAT64_C(   17.76),
+                         SIMDE_FLOAT64_C(  -20.38), SIMDE_FLOAT64_C(   23.81)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.23), SIMDE_FLOAT64_C(   -0.11),
+                           SIMDE_FLOAT64_C(   -0.30), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(   -0.12), SIMDE_FLOAT64_C(   -0.24),
+                           SIMDE_FLOAT64_C(   -0.38), SIMDE_FLOAT64_C(   -0.19)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.27), SIMDE_FLOAT64_C(    0.39),
+                           SIMDE_FLOAT64_C(    0.20), SIMDE_FLOAT64_C(    0.38),
+                           SIMDE_FLOAT64_C(    0.38), SIMDE_FLOAT64_C(    0.26),
+                           SIMDE_FLOAT64_C(    0.12), SIMDE_FLOAT64_C(    0.31)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.23), SIMDE_FLOAT64_C(   -0.11),
+                           SIMDE_FLOAT64_C(   -0.05), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(   -0.12), SIMDE_FLOAT64_C(   -0.24),
+                           SIMDE_FLOAT64_C(   -0.13), SIMDE_FLOAT64_C(   -0.19)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.02), SIMDE_FLOAT64_C(    0.01),
+                           SIMDE_FLOAT64_C(    0.08), SIMDE_FLOAT64_C(    0.01),
+                           SIMDE_FLOAT64_C(   -0.12), SIMDE_FLOAT64_C(    0.01),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(    0.06)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  -50.07), SIMDE_FLOAT64_C(   66.54),
+                         SIMDE_FLOAT64_C(   95.43), SIMDE_FLOAT64_C(   45.72),
+                         SIMDE_FLOAT64_C(  -39.72), SIMDE_FLOAT64_C(  -66.15),
+                         SIMDE_FLOAT64_C(   86.16), SIMDE_FLOAT64_C(   89.80)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.07), SIMDE_FLOAT64_C(   -0.46),
+                           SIMDE_FLOAT64_C(    0.43), SIMDE_FLOAT64_C(   -0.28),
+                           SIMDE_FLOAT64_C(    0.28), SIMDE_FLOAT64_C(   -0.15),
+                           SIMDE_FLOAT64_C(    0.16), SIMDE_FLOAT64_C(   -0.20)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.43), SIMDE_FLOAT64_C(    0.04),
+                           SIMDE_FLOAT64_C(    0.43), SIMDE_FLOAT64_C(    0.22),
+                           SIMDE_FLOAT64_C(    0.28), SIMDE_FLOAT64_C(    0.35),
+                           SIMDE_FLOAT64_C(    0.16), SIMDE_FLOAT64_C(    0.30)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.07), SIMDE_FLOAT64_C(   -0.21),
+                           SIMDE_FLOAT64_C(   -0.07), SIMDE_FLOAT64_C(   -0.03),
+                           SIMDE_FLOAT64_C(   -0.22), SIMDE_FLOAT64_C(   -0.15),
+                           SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(   -0.20)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.07), SIMDE_FLOAT64_C(    0.04),
+                           SIMDE_FLOAT64_C(    0.06), SIMDE_FLOAT64_C(    0.09),
+                           SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(   -0.03),
+                           SIMDE_FLOAT64_C(    0.03), SIMDE_FLOAT64_C(    0.05)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(   29.04), SIMDE_FLOAT64_C(  -87.26),
+                         SIMDE_FLOAT64_C(  -53.24), SIMDE_FLOAT64_C(  -88.85),
+                         SIMDE_FLOAT64_C(  -98.42), SIMDE_FLOAT64_C(  -45.38),
+                         SIMDE_FLOAT64_C(  -82.97), SIMDE_FLOAT64_C(   30.45)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.04), SIMDE_FLOAT64_C(   -0.26),
+                           SIMDE_FLOAT64_C(   -0.24), SIMDE_FLOAT64_C(    0.15),
+                           SIMDE_FLOAT64_C(   -0.42), SIMDE_FLOAT64_C(   -0.38),
+                           SIMDE_FLOAT64_C(    0.03), SIMDE_FLOAT64_C(    0.45)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.04), SIMDE_FLOAT64_C(    0.24),
+                           SIMDE_FLOAT64_C(    0.26), SIMDE_FLOAT64_C(    0.15),
+                           SIMDE_FLOAT64_C(    0.08), SIMDE_FLOAT64_C(    0.12),
+                           SIMDE_FLOAT64_C(    0.03), SIMDE_FLOAT64_C(    0.45)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.21), SIMDE_FLOAT64_C(   -0.01),
+                           SIMDE_FLOAT64_C(   -0.24), SIMDE_FLOAT64_C(   -0.10),
+                           SIMDE_FLOAT64_C(   -0.17), SIMDE_FLOAT64_C(   -0.13),
+                           SIMDE_FLOAT64_C(   -0.22), SIMDE_FLOAT64_C(   -0.05)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.04), SIMDE_FLOAT64_C(   -0.01),
+                           SIMDE_FLOAT64_C(   -0.12), SIMDE_FLOAT64_C(   -0.10),
+                           SIMDE_FLOAT64_C(   -0.05), SIMDE_FLOAT64_C(   -0.01),
+                           SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(    0.07)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  -19.80), SIMDE_FLOAT64_C(   91.83),
+                         SIMDE_FLOAT64_C(   20.33), SIMDE_FLOAT64_C(  -86.81),
+                         SIMDE_FLOAT64_C(  -67.97), SIMDE_FLOAT64_C(   70.00),
+                         SIMDE_FLOAT64_C(  -33.77), SIMDE_FLOAT64_C(   97.73)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.20), SIMDE_FLOAT64_C(   -0.17),
+                           SIMDE_FLOAT64_C(    0.33), SIMDE_FLOAT64_C(    0.19),
+                           SIMDE_FLOAT64_C(    0.03), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(    0.23), SIMDE_FLOAT64_C(   -0.27)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.20), SIMDE_FLOAT64_C(    0.33),
+                           SIMDE_FLOAT64_C(    0.33), SIMDE_FLOAT64_C(    0.19),
+                           SIMDE_FLOAT64_C(    0.03), SIMDE_FLOAT64_C(   -0.00),
+                           SIMDE_FLOAT64_C(    0.23), SIMDE_FLOAT64_C(    0.23)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.05), SIMDE_FLOAT64_C(   -0.17),
+                           SIMDE_FLOAT64_C(   -0.17), SIMDE_FLOAT64_C(   -0.06),
+                           SIMDE_FLOAT64_C(   -0.22), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(   -0.02), SIMDE_FLOAT64_C(   -0.02)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.05), SIMDE_FLOAT64_C(    0.08),
+                           SIMDE_FLOAT64_C(    0.08), SIMDE_FLOAT64_C(   -0.06),
+                           SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(    0.00),
+                           SIMDE_FLOAT64_C(   -0.02), SIMDE_FLOAT64_C(    0.11)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(   27.06), SIMDE_FLOAT64_C(   -5.74),
+                         SIMDE_FLOAT64_C(  -69.87), SIMDE_FLOAT64_C(   82.16),
+                         SIMDE_FLOAT64_C(  -26.08), SIMDE_FLOAT64_C(   61.85),
+                         SIMDE_FLOAT64_C(  -25.23), SIMDE_FLOAT64_C(  -63.08)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.06), SIMDE_FLOAT64_C(    0.26),
+                           SIMDE_FLOAT64_C(    0.13), SIMDE_FLOAT64_C(    0.16),
+                           SIMDE_FLOAT64_C(   -0.08), SIMDE_FLOAT64_C(   -0.15),
+                           SIMDE_FLOAT64_C(   -0.23), SIMDE_FLOAT64_C(   -0.08)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.06), SIMDE_FLOAT64_C(    0.26),
+                           SIMDE_FLOAT64_C(    0.13), SIMDE_FLOAT64_C(    0.16),
+                           SIMDE_FLOAT64_C(    0.42), SIMDE_FLOAT64_C(    0.35),
+                           SIMDE_FLOAT64_C(    0.27), SIMDE_FLOAT64_C(    0.42)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.19), SIMDE_FLOAT64_C(   -0.24),
+                           SIMDE_FLOAT64_C(   -0.12), SIMDE_FLOAT64_C(   -0.09),
+                           SIMDE_FLOAT64_C(   -0.08), SIMDE_FLOAT64_C(   -0.15),
+                           SIMDE_FLOAT64_C(   -0.23), SIMDE_FLOAT64_C(   -0.08)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.06), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(   -0.12), SIMDE_FLOAT64_C(    0.03),
+                           SIMDE_FLOAT64_C(   -0.08), SIMDE_FLOAT64_C(    0.10),
+                           SIMDE_FLOAT64_C(   -0.11), SIMDE_FLOAT64_C(   -0.08)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  -28.83), SIMDE_FLOAT64_C(   -2.30),
+                         SIMDE_FLOAT64_C(   77.19), SIMDE_FLOAT64_C(  -68.58),
+                         SIMDE_FLOAT64_C(  -65.74), SIMDE_FLOAT64_C(  -64.37),
+                         SIMDE_FLOAT64_C(  -30.35), SIMDE_FLOAT64_C(   -1.61)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.17), SIMDE_FLOAT64_C(   -0.30),
+                           SIMDE_FLOAT64_C(    0.19), SIMDE_FLOAT64_C(    0.42),
+                           SIMDE_FLOAT64_C(    0.26), SIMDE_FLOAT64_C(   -0.37),
+                           SIMDE_FLOAT64_C(   -0.35), SIMDE_FLOAT64_C(    0.39)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.17), SIMDE_FLOAT64_C(    0.20),
+                           SIMDE_FLOAT64_C(    0.19), SIMDE_FLOAT64_C(    0.42),
+                           SIMDE_FLOAT64_C(    0.26), SIMDE_FLOAT64_C(    0.13),
+                           SIMDE_FLOAT64_C(    0.15), SIMDE_FLOAT64_C(    0.39)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.08), SIMDE_FLOAT64_C(   -0.05),
+                           SIMDE_FLOAT64_C(   -0.06), SIMDE_FLOAT64_C(   -0.08),
+                           SIMDE_FLOAT64_C(   -0.24), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(   -0.10), SIMDE_FLOAT64_C(   -0.11)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.08), SIMDE_FLOAT64_C(   -0.05),
+                           SIMDE_FLOAT64_C(    0.06), SIMDE_FLOAT64_C(   -0.08),
+                           SIMDE_FLOAT64_C(   -0.11), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(   -0.10), SIMDE_FLOAT64_C(   -0.11)) } },
+    { simde_mm512_set_pd(SIMDE_FLOAT64_C(  -37.59), SIMDE_FLOAT64_C(  -44.12),
+                         SIMDE_FLOAT64_C(    4.91), SIMDE_FLOAT64_C(  -26.18),
+                         SIMDE_FLOAT64_C(  -53.24), SIMDE_FLOAT64_C(   95.33),
+                         SIMDE_FLOAT64_C(   -8.50), SIMDE_FLOAT64_C(  -56.42)),
+      { simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.41), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(   -0.18),
+                           SIMDE_FLOAT64_C(   -0.24), SIMDE_FLOAT64_C(    0.33),
+                           SIMDE_FLOAT64_C(   -0.50), SIMDE_FLOAT64_C(   -0.42)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.41), SIMDE_FLOAT64_C(    0.38),
+                           SIMDE_FLOAT64_C(    0.41), SIMDE_FLOAT64_C(    0.32),
+                           SIMDE_FLOAT64_C(    0.26), SIMDE_FLOAT64_C(    0.33),
+                           SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(    0.08)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(   -0.18),
+                           SIMDE_FLOAT64_C(   -0.24), SIMDE_FLOAT64_C(   -0.17),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.17)),
+        simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(   -0.12),
+                           SIMDE_FLOAT64_C(    0.04), SIMDE_FLOAT64_C(   -0.05),
+                           SIMDE_FLOAT64_C(   -0.12), SIMDE_FLOAT64_C(    0.08),
+                           SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.05)) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_m512d_close(simde_mm512_reduce_pd(test_vec[i].a, 0x00), test_vec[i].r[0], 1);
+    simde_assert_m512d_close(simde_mm512_reduce_pd(test_vec[i].a, 0x11), test_vec[i].r[1], 1);
+    simde_assert_m512d_close(simde_mm512_reduce_pd(test_vec[i].a, 0x22), test_vec[i].r[2], 1);
+    simde_assert_m512d_close(simde_mm512_reduce_pd(test_vec[i].a, 0x33), test_vec[i].r[3], 1);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_reduce_pd(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512d a;
+    simde__m512d r;
+  } test_vec[8] = {
+    { UINT8_C(201),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   24.53), SIMDE_FLOAT64_C(   10.43),
+                         SIMDE_FLOAT64_C(   45.17), SIMDE_FLOAT64_C(    6.56),
+                         SIMDE_FLOAT64_C(  -77.53), SIMDE_FLOAT64_C(  -74.97),
+                         SIMDE_FLOAT64_C(  -26.10), SIMDE_FLOAT64_C(  -69.39)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.03), SIMDE_FLOAT64_C(    0.43),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   -0.03), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.39)) },
+    { UINT8_C(241),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  -36.39), SIMDE_FLOAT64_C(   91.88),
+                         SIMDE_FLOAT64_C(   93.94), SIMDE_FLOAT64_C(   31.88),
+                         SIMDE_FLOAT64_C(  -71.10), SIMDE_FLOAT64_C(    2.14),
+                         SIMDE_FLOAT64_C(  -86.74), SIMDE_FLOAT64_C(   43.92)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.39), SIMDE_FLOAT64_C(    0.38),
+                         SIMDE_FLOAT64_C(    0.44), SIMDE_FLOAT64_C(    0.38),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.42)) },
+    { UINT8_C(149),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   84.89), SIMDE_FLOAT64_C(  -19.84),
+                         SIMDE_FLOAT64_C(   -9.43), SIMDE_FLOAT64_C(  -45.15),
+                         SIMDE_FLOAT64_C(  -48.79), SIMDE_FLOAT64_C(  -90.98),
+                         SIMDE_FLOAT64_C(  -20.84), SIMDE_FLOAT64_C(  -42.59)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.39), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.15),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.48),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.09)) },
+    { UINT8_C(122),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   67.93), SIMDE_FLOAT64_C(   58.27),
+                         SIMDE_FLOAT64_C(   12.09), SIMDE_FLOAT64_C(   86.28),
+                         SIMDE_FLOAT64_C(   52.78), SIMDE_FLOAT64_C(   52.87),
+                         SIMDE_FLOAT64_C(  -59.66), SIMDE_FLOAT64_C(  -67.43)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.27),
+                         SIMDE_FLOAT64_C(    0.09), SIMDE_FLOAT64_C(    0.28),
+                         SIMDE_FLOAT64_C(    0.28), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(   -0.16), SIMDE_FLOAT64_C(    0.00)) },
+    { UINT8_C( 80),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   74.40), SIMDE_FLOAT64_C(   29.98),
+                         SIMDE_FLOAT64_C(   51.50), SIMDE_FLOAT64_C(  -54.17),
+                         SIMDE_FLOAT64_C(   43.57), SIMDE_FLOAT64_C(  -19.33),
+                         SIMDE_FLOAT64_C(  -60.57), SIMDE_FLOAT64_C(   61.38)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.48),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.17),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00)) },
+    { UINT8_C(253),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   54.91), SIMDE_FLOAT64_C(   64.47),
+                         SIMDE_FLOAT64_C(  -95.58), SIMDE_FLOAT64_C(   47.16),
+                         SIMDE_FLOAT64_C(  -55.16), SIMDE_FLOAT64_C(  -79.39),
+                         SIMDE_FLOAT64_C(   33.51), SIMDE_FLOAT64_C(  -45.36)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.41), SIMDE_FLOAT64_C(    0.47),
+                         SIMDE_FLOAT64_C(   -0.08), SIMDE_FLOAT64_C(    0.16),
+                         SIMDE_FLOAT64_C(   -0.16), SIMDE_FLOAT64_C(   -0.39),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.36)) },
+    { UINT8_C(108),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   20.15), SIMDE_FLOAT64_C(   18.97),
+                         SIMDE_FLOAT64_C(   14.14), SIMDE_FLOAT64_C(   44.25),
+                         SIMDE_FLOAT64_C(   14.53), SIMDE_FLOAT64_C(   59.29),
+                         SIMDE_FLOAT64_C(  -93.46), SIMDE_FLOAT64_C(  -81.90)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.47),
+                         SIMDE_FLOAT64_C(    0.14), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.03), SIMDE_FLOAT64_C(    0.29),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00)) },
+    { UINT8_C(239),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(  -97.57), SIMDE_FLOAT64_C(  -71.34),
+                         SIMDE_FLOAT64_C(  -83.60), SIMDE_FLOAT64_C(  -70.47),
+                         SIMDE_FLOAT64_C(   50.50), SIMDE_FLOAT64_C(   29.55),
+                         SIMDE_FLOAT64_C(  -75.79), SIMDE_FLOAT64_C(  -66.83)),
+      simde_mm512_set_pd(SIMDE_FLOAT64_C(   -0.07), SIMDE_FLOAT64_C(   -0.34),
+                         SIMDE_FLOAT64_C(   -0.10), SIMDE_FLOAT64_C(    0.00),
+                         SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.05),
+                         SIMDE_FLOAT64_C(   -0.29), SIMDE_FLOAT64_C(   -0.33)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512d r = simde_mm512_maskz_reduce_pd(test_vec[i].k, test_vec[i].a, 0x13);
+    simde_assert_m512d_close(r, test_vec[i].r, 1);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_AVX512DQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_AVX512DQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(kadd_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kand_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kandn_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kor_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kxnor_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kxor_mask8),
+  SIMDE_TESTS_DEFINE_TEST(knot_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kortestz_mask8_u8),
+  SIMDE_TESTS_DEFINE_TEST(kortestc_mask8_u8),
+  SIMDE_TESTS_DEFINE_TEST(kortest_mask8_u8),
+  SIMDE_TESTS_DEFINE_TEST(ktestz_mask8_u8),
+  SIMDE_TESTS_DEFINE_TEST(ktestc_mask8_u8),
+  SIMDE_TESTS_DEFINE_TEST(ktest_mask8_u8),
+  SIMDE_TESTS_DEFINE_TEST(kshiftli_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kshiftri_mask8),
+  SIMDE_TESTS_DEFINE_TEST(cvtmask8_u32),
+  SIMDE_TESTS_DEFINE_TEST(cvtu32_mask8),
+  SIMDE_TESTS_DEFINE_TEST(load_mask8),
+  SIMDE_TESTS_DEFINE_TEST(store_mask8),
+  SIMDE_TESTS_DEFINE_TEST(kadd_mask16),
+  SIMDE_TESTS_DEFINE_TEST(ktestz_mask16_u8),
+  SIMDE_TESTS_DEFINE_TEST(ktestc_mask16_u8),
+  SIMDE_TESTS_DEFINE_TEST(ktest_mask16_u8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_and_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm512_and_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_andnot_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm512_andnot_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvtepi64_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_cvtepi64_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_cvtepi64_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvtepu64_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvtepi64_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvtepu64_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvtpd_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvtpd_epu64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvttpd_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_cvttpd_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_cvttpd_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_cvttpd_epu64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_fpclass_ps_mask),
+  SIMDE_TESTS_DEFINE_TEST(mm512_fpclass_pd_mask),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_fpclass_pd_mask),
+  SIMDE_TESTS_DEFINE_TEST(mm512_movepi32_mask),
+  SIMDE_TESTS_DEFINE_TEST(mm512_movepi64_mask),
+  SIMDE_TESTS_DEFINE_TEST(mm512_movm_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_movm_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mullo_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_mullo_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_mullo_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_range_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm512_range_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_range_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_range_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm512_reduce_ps),
+  SIMDE_TESTS_DEFINE_TEST(mm512_reduce_pd),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_reduce_pd),
+#endif /* defined(SIMDE_AVX512DQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
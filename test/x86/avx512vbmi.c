@@ -0,0 +1,2638 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX avx512vbmi
+#include <simde/x86/avx512vbmi.h>
+#include <test/x86/test-avx512.h>
+
+#if defined(SIMDE_AVX512VBMI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_mm512_multishift_epi64_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C( -39), INT8_C( -86), INT8_C( 121), INT8_C(  46), INT8_C(  26), INT8_C( -12), INT8_C( 112), INT8_C( -22),
+                           INT8_C(-102), INT8_C( -46), INT8_C( -31), INT8_C(  68), INT8_C( -42), INT8_C( -24), INT8_C( -14), INT8_C( -49),
+                           INT8_C(-105), INT8_C(  16), INT8_C(  29), INT8_C( -50), INT8_C(  78), INT8_C( 123), INT8_C(  -5), INT8_C( 121),
+                           INT8_C(  44), INT8_C( -21), INT8_C(  22), INT8_C( -32), INT8_C( -95), INT8_C( -59), INT8_C(  74), INT8_C( -20),
+                           INT8_C(  48), INT8_C(  95), INT8_C(   5), INT8_C(  12), INT8_C(  54), INT8_C(-115), INT8_C( -52), INT8_C( 116),
+                           INT8_C( 123), INT8_C(   7), INT8_C( -50), INT8_C(-111), INT8_C( -27), INT8_C(-112), INT8_C(  97), INT8_C(  54),
+                           INT8_C( 100), INT8_C( -16), INT8_C( -18), INT8_C( -71), INT8_C(   2), INT8_C( 110), INT8_C(  96), INT8_C( 118),
+                           INT8_C( -36), INT8_C(  27), INT8_C( 119), INT8_C( -82), INT8_C(  11), INT8_C( -13), INT8_C(  77), INT8_C( -83)),
+      simde_mm512_set_epi8(INT8_C( -59), INT8_C( 118), INT8_C(  80), INT8_C( 121), INT8_C(  -4), INT8_C(  93), INT8_C(  67), INT8_C(  -1),
+                           INT8_C( -71), INT8_C(  33), INT8_C(-103), INT8_C( -24), INT8_C(  63), INT8_C(  90), INT8_C(  16), INT8_C(  31),
+                           INT8_C(  14), INT8_C(  31), INT8_C( -60), INT8_C(-101), INT8_C( -42), INT8_C(  59), INT8_C(-128), INT8_C( -98),
+                           INT8_C(  85), INT8_C( -68), INT8_C( 121), INT8_C(  -8), INT8_C( -83), INT8_C( -89), INT8_C(  17), INT8_C(  -3),
+                           INT8_C(  46), INT8_C( -83), INT8_C(-123), INT8_C(  71), INT8_C(  86), INT8_C( -41), INT8_C(  31), INT8_C(   3),
+                           INT8_C(   8), INT8_C( -12), INT8_C( 116), INT8_C(  -1), INT8_C( -72), INT8_C( -24), INT8_C( -85), INT8_C(  21),
+                           INT8_C(-113), INT8_C(-114), INT8_C( -87), INT8_C( -45), INT8_C(  73), INT8_C(  66), INT8_C(-115), INT8_C(-114),
+                           INT8_C( -35), INT8_C( -86), INT8_C(  78), INT8_C(-123), INT8_C( -80), INT8_C( -42), INT8_C( -30), INT8_C(-117)),
+      simde_mm512_set_epi8(INT8_C(  -2), INT8_C(-108), INT8_C( -30), INT8_C( -39), INT8_C( 127), INT8_C(  87), INT8_C( 118), INT8_C(-108),
+                           INT8_C(  15), INT8_C( -42), INT8_C( -12), INT8_C(   1), INT8_C(  -3), INT8_C(-103), INT8_C(  72), INT8_C( -76),
+                           INT8_C( -84), INT8_C(  59), INT8_C( -34), INT8_C( -18), INT8_C( -18), INT8_C( -63), INT8_C( -63), INT8_C(   7),
+                           INT8_C( -57), INT8_C(-113), INT8_C( -74), INT8_C(  -8), INT8_C(  -4), INT8_C(-113), INT8_C( -60), INT8_C( -57),
+                           INT8_C( -83), INT8_C(-114), INT8_C(  -8), INT8_C( 113), INT8_C( -70), INT8_C( -72), INT8_C( 113), INT8_C( -22),
+                           INT8_C( -95), INT8_C(  86), INT8_C( -94), INT8_C( 116), INT8_C( -89), INT8_C( -24), INT8_C( 127), INT8_C(  35),
+                           INT8_C( -99), INT8_C(-114), INT8_C(  58), INT8_C(  71), INT8_C(  99), INT8_C(  58), INT8_C( -45), INT8_C(  62),
+                           INT8_C(  91), INT8_C( -74), INT8_C( -69), INT8_C( -87), INT8_C( -36), INT8_C( -75), INT8_C( -73), INT8_C(  82)) },
+    { simde_mm512_set_epi8(INT8_C(-128), INT8_C( -82), INT8_C(  33), INT8_C(  32), INT8_C(-126), INT8_C( 101), INT8_C( 113), INT8_C( -34),
+                           INT8_C(  15), INT8_C(  26), INT8_C(  80), INT8_C( -43), INT8_C(-100), INT8_C(  10), INT8_C( -94), INT8_C(  26),
+                           INT8_C( -68), INT8_C( -69), INT8_C(-101), INT8_C( 126), INT8_C(-102), INT8_C(  49), INT8_C(-102), INT8_C( -17),
+                           INT8_C(  84), INT8_C(  75), INT8_C(  14), INT8_C( -57), INT8_C( 109), INT8_C(   0), INT8_C(  97), INT8_C( 109),
+                           INT8_C(-110), INT8_C(  -5), INT8_C(  45), INT8_C( -49), INT8_C( -56), INT8_C( -82), INT8_C(-102), INT8_C(  25),
+                           INT8_C(  -4), INT8_C(  86), INT8_C(  57), INT8_C( -79), INT8_C( 107), INT8_C( 113), INT8_C(  75), INT8_C(  79),
+                           INT8_C( -93), INT8_C(  46), INT8_C( -38), INT8_C( -65), INT8_C(  85), INT8_C(-123), INT8_C( -67), INT8_C( 117),
+                           INT8_C(  53), INT8_C(  60), INT8_C(  -4), INT8_C(  56), INT8_C( 125), INT8_C(  -6), INT8_C( -26), INT8_C( -72)),
+      simde_mm512_set_epi8(INT8_C( -52), INT8_C( -72), INT8_C( 112), INT8_C(  33), INT8_C(  52), INT8_C(-104), INT8_C(  -9), INT8_C( -11),
+                           INT8_C( 108), INT8_C( 113), INT8_C( 110), INT8_C(  30), INT8_C( 108), INT8_C( -19), INT8_C(-127), INT8_C(  55),
+                           INT8_C(  91), INT8_C(-110), INT8_C(-114), INT8_C(  44), INT8_C(-104), INT8_C( 125), INT8_C(-123), INT8_C( 125),
+                           INT8_C(  54), INT8_C(-127), INT8_C( -38), INT8_C( 127), INT8_C( 105), INT8_C(-109), INT8_C(   8), INT8_C(  45),
+                           INT8_C( 109), INT8_C(   8), INT8_C(  68), INT8_C( -62), INT8_C( 105), INT8_C( -25), INT8_C( 105), INT8_C(  63),
+                           INT8_C( -36), INT8_C(-122), INT8_C( -77), INT8_C( -45), INT8_C( -51), INT8_C( -67), INT8_C( -10), INT8_C(  19),
+                           INT8_C(  13), INT8_C(   9), INT8_C(-127), INT8_C( -24), INT8_C( -63), INT8_C(  -6), INT8_C( 123), INT8_C( -28),
+                           INT8_C(  14), INT8_C(  30), INT8_C( -51), INT8_C(   2), INT8_C( -19), INT8_C( 124), INT8_C(  12), INT8_C( -67)),
+      simde_mm512_set_epi8(INT8_C( -11), INT8_C( -31), INT8_C(  16), INT8_C(  33), INT8_C(  -3), INT8_C(-127), INT8_C(  92), INT8_C(-124),
+                           INT8_C( -37), INT8_C(-101), INT8_C( -19), INT8_C( 103), INT8_C( -26), INT8_C(  96), INT8_C(-121), INT8_C(-101),
+                           INT8_C( -43), INT8_C( -85), INT8_C(-109), INT8_C( -11), INT8_C(  38), INT8_C( -55), INT8_C(  38), INT8_C(  37),
+                           INT8_C(-103), INT8_C(  97), INT8_C(  76), INT8_C(  16), INT8_C(  14), INT8_C(  45), INT8_C(  63), INT8_C(  14),
+                           INT8_C( 121), INT8_C( -19), INT8_C(  66), INT8_C( -50), INT8_C( 105), INT8_C(  33), INT8_C(-102), INT8_C(  52),
+                           INT8_C(  61), INT8_C(  54), INT8_C( -18), INT8_C(  67), INT8_C( -42), INT8_C(  67), INT8_C( -66), INT8_C( 123),
+                           INT8_C(  61), INT8_C(  38), INT8_C(  48), INT8_C( -56), INT8_C(  15), INT8_C( -33), INT8_C(  32), INT8_C( 104),
+                           INT8_C( 112), INT8_C( -48), INT8_C( -48), INT8_C(  14), INT8_C( -24), INT8_C(  67), INT8_C(  52), INT8_C(  14)) },
+    { simde_mm512_set_epi8(INT8_C( -65), INT8_C( -53), INT8_C(  -1), INT8_C(  -1), INT8_C(  12), INT8_C( -68), INT8_C( -65), INT8_C(  32),
+                           INT8_C(  89), INT8_C( -90), INT8_C(-101), INT8_C( -95), INT8_C(  38), INT8_C( -51), INT8_C(  41), INT8_C( -77),
+                           INT8_C(-114), INT8_C(  57), INT8_C( -72), INT8_C(  29), INT8_C( -25), INT8_C(  27), INT8_C( 125), INT8_C(   9),
+                           INT8_C( 122), INT8_C( -57), INT8_C(-113), INT8_C( -77), INT8_C( 115), INT8_C(  -1), INT8_C( -65), INT8_C( -10),
+                           INT8_C(  53), INT8_C( -13), INT8_C(   5), INT8_C( -80), INT8_C( -64), INT8_C(  -4), INT8_C(-110), INT8_C(  82),
+                           INT8_C( -57), INT8_C(  43), INT8_C(  76), INT8_C(  54), INT8_C( -48), INT8_C( -37), INT8_C( 127), INT8_C( -19),
+                           INT8_C( -80), INT8_C( -70), INT8_C(-111), INT8_C( -28), INT8_C( 127), INT8_C(  98), INT8_C(   0), INT8_C( -20),
+                           INT8_C( -97), INT8_C(   7), INT8_C( -78), INT8_C( 122), INT8_C( 120), INT8_C(-122), INT8_C(-101), INT8_C(  90)),
+      simde_mm512_set_epi8(INT8_C( -25), INT8_C(  26), INT8_C( 117), INT8_C( 103), INT8_C( -19), INT8_C( -72), INT8_C( -58), INT8_C( 117),
+                           INT8_C( 111), INT8_C(  15), INT8_C(  52), INT8_C(  20), INT8_C( -60), INT8_C( 124), INT8_C(-100), INT8_C(  13),
+                           INT8_C( -68), INT8_C(  58), INT8_C(  91), INT8_C(  65), INT8_C(-102), INT8_C(  67), INT8_C( -81), INT8_C( -46),
+                           INT8_C(  12), INT8_C( -56), INT8_C(-114), INT8_C( -85), INT8_C(  47), INT8_C(-102), INT8_C( -44), INT8_C( -69),
+                           INT8_C(  23), INT8_C( -88), INT8_C( -20), INT8_C(-120), INT8_C( -32), INT8_C( -38), INT8_C(  11), INT8_C( -84),
+                           INT8_C(  50), INT8_C( -71), INT8_C(  17), INT8_C(  73), INT8_C(-108), INT8_C(  23), INT8_C( -86), INT8_C( -71),
+                           INT8_C(  87), INT8_C(  42), INT8_C(  21), INT8_C( -19), INT8_C(  72), INT8_C( -77), INT8_C(  -3), INT8_C( -62),
+                           INT8_C(  45), INT8_C(  28), INT8_C( -30), INT8_C(-120), INT8_C(  86), INT8_C( -46), INT8_C(  14), INT8_C(  94)),
+      simde_mm512_set_epi8(INT8_C( -21), INT8_C(  24), INT8_C( -21), INT8_C( -21), INT8_C(-116), INT8_C(  94), INT8_C( -21), INT8_C( 103),
+                           INT8_C(  98), INT8_C( -48), INT8_C(-104), INT8_C(  10), INT8_C( -48), INT8_C( -28), INT8_C(-102), INT8_C( -31),
+                           INT8_C(  14), INT8_C(  94), INT8_C( -68), INT8_C(  12), INT8_C( -74), INT8_C(  51), INT8_C(-107), INT8_C( -41),
+                           INT8_C( -61), INT8_C( -87), INT8_C(  53), INT8_C(-103), INT8_C(-103), INT8_C( 118), INT8_C( 118), INT8_C(  51),
+                           INT8_C( -67), INT8_C( -11), INT8_C(  93), INT8_C( -88), INT8_C( -84), INT8_C( -63), INT8_C(  54), INT8_C(  54),
+                           INT8_C(  85), INT8_C(  34), INT8_C( 122), INT8_C( -54), INT8_C(  23), INT8_C(  50), INT8_C( 114), INT8_C( -56),
+                           INT8_C(  42), INT8_C(-107), INT8_C(  89), INT8_C(  94), INT8_C(-124), INT8_C( 123), INT8_C( -62), INT8_C( -95),
+                           INT8_C(  16), INT8_C(  28), INT8_C(  71), INT8_C(-117), INT8_C(  45), INT8_C(  57), INT8_C(  10), INT8_C(  21)) },
+    { simde_mm512_set_epi8(INT8_C(  70), INT8_C(  33), INT8_C( 127), INT8_C(  16), INT8_C(  78), INT8_C( -77), INT8_C(   0), INT8_C(  38),
+                           INT8_C( -72), INT8_C(   9), INT8_C( -41), INT8_C(-114), INT8_C(  42), INT8_C(  47), INT8_C(-101), INT8_C(  16),
+                           INT8_C(  46), INT8_C(  58), INT8_C(  78), INT8_C( -13), INT8_C(  73), INT8_C( 111), INT8_C(  65), INT8_C(  18),
+                           INT8_C( -13), INT8_C( -77), INT8_C(  99), INT8_C( -23), INT8_C(  56), INT8_C(  41), INT8_C(  90), INT8_C(  38),
+                           INT8_C(  78), INT8_C(  -6), INT8_C(  88), INT8_C(  46), INT8_C( -32), INT8_C(  41), INT8_C( -33), INT8_C( -39),
+                           INT8_C(  87), INT8_C(-114), INT8_C( -78), INT8_C(  46), INT8_C(  30), INT8_C( -91), INT8_C( -93), INT8_C(  95),
+                           INT8_C( -29), INT8_C( 117), INT8_C(-125), INT8_C( 125), INT8_C( -88), INT8_C(  64), INT8_C( -39), INT8_C( -20),
+                           INT8_C(  99), INT8_C( 103), INT8_C(  76), INT8_C(  -8), INT8_C(  65), INT8_C( -18), INT8_C(-118), INT8_C( -71)),
+      simde_mm512_set_epi8(INT8_C(  69), INT8_C(-102), INT8_C( -26), INT8_C( -40), INT8_C(  46), INT8_C( -16), INT8_C( -69), INT8_C(  69),
+                           INT8_C(-112), INT8_C(  75), INT8_C( -62), INT8_C( -35), INT8_C( -96), INT8_C( -21), INT8_C( -55), INT8_C(  23),
+                           INT8_C(  91), INT8_C( -20), INT8_C(  37), INT8_C( -87), INT8_C(-122), INT8_C( -86), INT8_C( 111), INT8_C( -56),
+                           INT8_C(  60), INT8_C(  10), INT8_C(  69), INT8_C( -83), INT8_C( 109), INT8_C(   1), INT8_C( 117), INT8_C( -29),
+                           INT8_C( -19), INT8_C(  10), INT8_C(   0), INT8_C( -21), INT8_C(  48), INT8_C(  43), INT8_C(  82), INT8_C( -58),
+                           INT8_C( -65), INT8_C( -48), INT8_C(  39), INT8_C(  59), INT8_C(  16), INT8_C( -90), INT8_C( -44), INT8_C( -81),
+                           INT8_C(  74), INT8_C(  58), INT8_C( -30), INT8_C(-101), INT8_C(  42), INT8_C( -16), INT8_C( -53), INT8_C( 121),
+                           INT8_C(-119), INT8_C(  71), INT8_C( -75), INT8_C(  -2), INT8_C(  -3), INT8_C( -90), INT8_C( -81), INT8_C( -90)),
+      simde_mm512_set_epi8(INT8_C( -19), INT8_C( 108), INT8_C(-118), INT8_C( -16), INT8_C( -62), INT8_C( -77), INT8_C(  69), INT8_C(-101),
+                           INT8_C(-112), INT8_C( -28), INT8_C(  65), INT8_C( -81), INT8_C( -16), INT8_C(-105), INT8_C( -76), INT8_C( -21),
+                           INT8_C( -80), INT8_C(  22), INT8_C( -87), INT8_C( 125), INT8_C(  55), INT8_C( -40), INT8_C( -28), INT8_C( -86),
+                           INT8_C(-127), INT8_C(-127), INT8_C( -75), INT8_C(  34), INT8_C(  60), INT8_C(  34), INT8_C(  91), INT8_C(  22),
+                           INT8_C( -83), INT8_C( -69), INT8_C(  48), INT8_C(  40), INT8_C( -21), INT8_C(   0), INT8_C( -42), INT8_C(-104),
+                           INT8_C(  33), INT8_C(-101), INT8_C( -12), INT8_C(  64), INT8_C( -20), INT8_C(  57), INT8_C( -25), INT8_C( 118),
+                           INT8_C(  83), INT8_C(  81), INT8_C( 111), INT8_C( -54), INT8_C( -30), INT8_C( 121), INT8_C(-107), INT8_C( -82),
+                           INT8_C( -65), INT8_C( 107), INT8_C( 106), INT8_C(-119), INT8_C( -45), INT8_C(  30), INT8_C( -85), INT8_C(  68)) },
+    { simde_mm512_set_epi8(INT8_C( -11), INT8_C(-117), INT8_C( 106), INT8_C(  95), INT8_C(-100), INT8_C( 120), INT8_C( 109), INT8_C( -87),
+                           INT8_C(  87), INT8_C(   3), INT8_C(  87), INT8_C(  43), INT8_C(  -5), INT8_C(-128), INT8_C(  90), INT8_C(  93),
+                           INT8_C( 101), INT8_C(-107), INT8_C(  13), INT8_C(   5), INT8_C( 120), INT8_C( -16), INT8_C(   9), INT8_C( -50),
+                           INT8_C(-103), INT8_C(  42), INT8_C(  85), INT8_C(  20), INT8_C(  -6), INT8_C( -24), INT8_C(  19), INT8_C( -87),
+                           INT8_C( -77), INT8_C( -81), INT8_C( -74), INT8_C( 116), INT8_C( -46), INT8_C(  99), INT8_C( -12), INT8_C(   1),
+                           INT8_C(  84), INT8_C(  59), INT8_C(  20), INT8_C( -68), INT8_C( 121), INT8_C( -30), INT8_C(  31), INT8_C( -66),
+                           INT8_C( 113), INT8_C(  16), INT8_C( -73), INT8_C(  38), INT8_C(  50), INT8_C(  37), INT8_C(-115), INT8_C( -27),
+                           INT8_C( -40), INT8_C( -13), INT8_C(  11), INT8_C(  22), INT8_C(  99), INT8_C(  13), INT8_C(  43), INT8_C( 115)),
+      simde_mm512_set_epi8(INT8_C(  40), INT8_C( -95), INT8_C( -30), INT8_C(  57), INT8_C(  51), INT8_C(-127), INT8_C( -19), INT8_C(  48),
+                           INT8_C(  33), INT8_C( 115), INT8_C(  85), INT8_C(-121), INT8_C(  24), INT8_C(-122), INT8_C(  -9), INT8_C(  94),
+                           INT8_C( -53), INT8_C( 116), INT8_C( -54), INT8_C(  48), INT8_C( -77), INT8_C( -42), INT8_C(-119), INT8_C(  76),
+                           INT8_C(  22), INT8_C(  22), INT8_C( 108), INT8_C( 118), INT8_C( -83), INT8_C(  69), INT8_C(-127), INT8_C(-113),
+                           INT8_C(  72), INT8_C(-103), INT8_C(  -1), INT8_C(  17), INT8_C( -62), INT8_C(  -9), INT8_C(-106), INT8_C(  99),
+                           INT8_C(  77), INT8_C( -54), INT8_C(  29), INT8_C(  87), INT8_C(  -1), INT8_C(   3), INT8_C( -15), INT8_C(-128),
+                           INT8_C(  80), INT8_C( -22), INT8_C( -68), INT8_C( 114), INT8_C(-121), INT8_C( -36), INT8_C(  78), INT8_C(  28),
+                           INT8_C( -88), INT8_C(  55), INT8_C( 121), INT8_C(  62), INT8_C( -98), INT8_C(-118), INT8_C( -41), INT8_C(  50)),
+      simde_mm512_set_epi8(INT8_C(  69), INT8_C(  61), INT8_C( 120), INT8_C( 114), INT8_C(-109), INT8_C(  40), INT8_C(  15), INT8_C( -15),
+                           INT8_C(  49), INT8_C( -21), INT8_C(  49), INT8_C( 106), INT8_C( -60), INT8_C(  94), INT8_C( -58), INT8_C(  56),
+                           INT8_C(  81), INT8_C( -98), INT8_C( -76), INT8_C(  74), INT8_C( -53), INT8_C( 116), INT8_C(  68), INT8_C(  90),
+                           INT8_C(  86), INT8_C(-101), INT8_C( 106), INT8_C( -44), INT8_C( -59), INT8_C( 108), INT8_C( -88), INT8_C(  54),
+                           INT8_C(  19), INT8_C(  51), INT8_C(  34), INT8_C(-119), INT8_C( -67), INT8_C( -30), INT8_C(-119), INT8_C(  49),
+                           INT8_C( -16), INT8_C(   9), INT8_C( -16), INT8_C(   4), INT8_C(  38), INT8_C(  85), INT8_C( -81), INT8_C(   1),
+                           INT8_C( 117), INT8_C( -36), INT8_C( -95), INT8_C( -15), INT8_C(  58), INT8_C( -29), INT8_C( -30), INT8_C( -29),
+                           INT8_C( -98), INT8_C(   6), INT8_C(  90), INT8_C( 122), INT8_C(  39), INT8_C(  86), INT8_C( -17), INT8_C(   6)) },
+    { simde_mm512_set_epi8(INT8_C( -16), INT8_C(-120), INT8_C(  37), INT8_C( 110), INT8_C( 113), INT8_C( -74), INT8_C( 121), INT8_C(  68),
+                           INT8_C( -80), INT8_C( -40), INT8_C(  56), INT8_C( -44), INT8_C( -12), INT8_C(  86), INT8_C(  88), INT8_C( -75),
+                           INT8_C( 107), INT8_C( 101), INT8_C(  -6), INT8_C( 104), INT8_C( -56), INT8_C(  18), INT8_C( -64), INT8_C( 117),
+                           INT8_C(  79), INT8_C( -89), INT8_C(-108), INT8_C(  85), INT8_C(  45), INT8_C( 124), INT8_C(-121), INT8_C(  -6),
+                           INT8_C(  42), INT8_C(  62), INT8_C(  54), INT8_C(  64), INT8_C(  91), INT8_C( -16), INT8_C(  46), INT8_C(  38),
+                           INT8_C(  -8), INT8_C(  -3), INT8_C(   0), INT8_C(  22), INT8_C(  53), INT8_C(  26), INT8_C( -61), INT8_C( -31),
+                           INT8_C( -66), INT8_C( -60), INT8_C( 104), INT8_C(-115), INT8_C(  53), INT8_C( -73), INT8_C(-121), INT8_C(  47),
+                           INT8_C(   7), INT8_C(  76), INT8_C(  49), INT8_C( -74), INT8_C( -39), INT8_C( -17), INT8_C( -94), INT8_C( -22)),
+      simde_mm512_set_epi8(INT8_C(-105), INT8_C(  75), INT8_C( -27), INT8_C(  71), INT8_C(  80), INT8_C(   5), INT8_C(   4), INT8_C( -78),
+                           INT8_C( -31), INT8_C( -74), INT8_C( -52), INT8_C(  63), INT8_C( -50), INT8_C(-118), INT8_C(  87), INT8_C(  28),
+                           INT8_C(  59), INT8_C( -74), INT8_C(  10), INT8_C(  31), INT8_C( 100), INT8_C(  73), INT8_C(  67), INT8_C(  26),
+                           INT8_C(  -8), INT8_C( -38), INT8_C(  -1), INT8_C(  74), INT8_C( -73), INT8_C( -31), INT8_C( -60), INT8_C(  18),
+                           INT8_C( -65), INT8_C(   2), INT8_C(  61), INT8_C(  95), INT8_C( 113), INT8_C( -60), INT8_C(  15), INT8_C(  12),
+                           INT8_C(-102), INT8_C( -33), INT8_C(   7), INT8_C(  60), INT8_C( -89), INT8_C( -30), INT8_C(  79), INT8_C(  18),
+                           INT8_C( 127), INT8_C(  48), INT8_C(  99), INT8_C(  77), INT8_C(  35), INT8_C(-101), INT8_C(  54), INT8_C( -65),
+                           INT8_C( -76), INT8_C( -47), INT8_C( -65), INT8_C(  73), INT8_C(-122), INT8_C(-113), INT8_C( -60), INT8_C( -74)),
+      simde_mm512_set_epi8(INT8_C(  75), INT8_C(   4), INT8_C(  42), INT8_C(  47), INT8_C( -91), INT8_C(  93), INT8_C(  75), INT8_C(  75),
+                           INT8_C( -74), INT8_C( -50), INT8_C( -31), INT8_C( -24), INT8_C(  27), INT8_C(  58), INT8_C( -50), INT8_C(  13),
+                           INT8_C( -63), INT8_C(  80), INT8_C(-114), INT8_C(  10), INT8_C(  67), INT8_C(  18), INT8_C(  26), INT8_C( -35),
+                           INT8_C( -61), INT8_C(  -2), INT8_C( 126), INT8_C( -65), INT8_C( -41), INT8_C(  47), INT8_C(-120), INT8_C( -66),
+                           INT8_C(-113), INT8_C(  50), INT8_C(  -4), INT8_C(  12), INT8_C( -18), INT8_C(   2), INT8_C(   8), INT8_C( -11),
+                           INT8_C(-102), INT8_C(-108), INT8_C(  18), INT8_C( -97), INT8_C( -42), INT8_C(  41), INT8_C( -30), INT8_C( -98),
+                           INT8_C(  -3), INT8_C( 107), INT8_C(  99), INT8_C( -39), INT8_C(  -7), INT8_C(  -2), INT8_C( 109), INT8_C(  96),
+                           INT8_C(-119), INT8_C(  -4), INT8_C( 104), INT8_C( -45), INT8_C( -61), INT8_C( -93), INT8_C( -46), INT8_C( 111)) },
+    { simde_mm512_set_epi8(INT8_C( 124), INT8_C( -73), INT8_C( -48), INT8_C( -96), INT8_C( -23), INT8_C( -76), INT8_C(  70), INT8_C( -44),
+                           INT8_C(  66), INT8_C( -24), INT8_C( 127), INT8_C( -86), INT8_C( -21), INT8_C( -71), INT8_C( -96), INT8_C( -43),
+                           INT8_C( -89), INT8_C( -27), INT8_C(-111), INT8_C( -24), INT8_C(  90), INT8_C(-124), INT8_C(   9), INT8_C(   7),
+                           INT8_C(  16), INT8_C( 125), INT8_C( -71), INT8_C( 112), INT8_C( -10), INT8_C(  30), INT8_C( -58), INT8_C(  75),
+                           INT8_C( -85), INT8_C(  89), INT8_C(  23), INT8_C( -88), INT8_C(  31), INT8_C(  15), INT8_C( -78), INT8_C( -82),
+                           INT8_C( -10), INT8_C(  20), INT8_C( -36), INT8_C(  64), INT8_C(  55), INT8_C( -47), INT8_C( -52), INT8_C(  -9),
+                           INT8_C( 120), INT8_C( -76), INT8_C( 121), INT8_C(-121), INT8_C(-123), INT8_C(  83), INT8_C(-124), INT8_C(  63),
+                           INT8_C( 120), INT8_C(-122), INT8_C(  55), INT8_C( -67), INT8_C( -69), INT8_C(   4), INT8_C(  98), INT8_C(  59)),
+      simde_mm512_set_epi8(INT8_C(  43), INT8_C(  89), INT8_C( -95), INT8_C(  16), INT8_C(   6), INT8_C(  -2), INT8_C(  16), INT8_C( -94),
+                           INT8_C(  -4), INT8_C(  16), INT8_C(  83), INT8_C( 106), INT8_C(  57), INT8_C(  52), INT8_C(  63), INT8_C( -99),
+                           INT8_C(  64), INT8_C(  72), INT8_C(  17), INT8_C(-127), INT8_C( -11), INT8_C(  79), INT8_C(  27), INT8_C( 107),
+                           INT8_C(-109), INT8_C( -25), INT8_C( -16), INT8_C(-100), INT8_C( 118), INT8_C(-103), INT8_C(  93), INT8_C( -48),
+                           INT8_C(-100), INT8_C( -58), INT8_C( -45), INT8_C(-114), INT8_C( -69), INT8_C(  77), INT8_C( -61), INT8_C(-105),
+                           INT8_C(  29), INT8_C( 110), INT8_C( -75), INT8_C( 108), INT8_C( -61), INT8_C(  -2), INT8_C( -51), INT8_C(  77),
+                           INT8_C(  23), INT8_C(  40), INT8_C(  41), INT8_C(  65), INT8_C( 119), INT8_C(  91), INT8_C( -47), INT8_C(  47),
+                           INT8_C(-109), INT8_C( -76), INT8_C(  17), INT8_C(  85), INT8_C( 123), INT8_C(  30), INT8_C(  27), INT8_C(  89)),
+      simde_mm512_set_epi8(INT8_C(  34), INT8_C(  86), INT8_C(  -2), INT8_C(  16), INT8_C( -48), INT8_C( -75), INT8_C(  66), INT8_C( 111),
+                           INT8_C( -25), INT8_C(  83), INT8_C(  59), INT8_C(  20), INT8_C(  10), INT8_C(  -2), INT8_C( 106), INT8_C( -55),
+                           INT8_C(  35), INT8_C(-116), INT8_C( -89), INT8_C(  17), INT8_C( 125), INT8_C( -74), INT8_C(-115), INT8_C(  54),
+                           INT8_C(-103), INT8_C(-124), INT8_C(  73), INT8_C( -25), INT8_C(  79), INT8_C( 113), INT8_C( 119), INT8_C(  43),
+                           INT8_C( -38), INT8_C(  93), INT8_C( 118), INT8_C( -45), INT8_C(  29), INT8_C(-101), INT8_C(  49), INT8_C(  27),
+                           INT8_C( 117), INT8_C(  63), INT8_C( -52), INT8_C(  77), INT8_C(  58), INT8_C(  -1), INT8_C( -20), INT8_C(  58),
+                           INT8_C(  23), INT8_C( 114), INT8_C(-117), INT8_C( -94), INT8_C(-119), INT8_C( -21), INT8_C(  18), INT8_C(  94),
+                           INT8_C(-109), INT8_C( 109), INT8_C(  39), INT8_C( -52), INT8_C(  50), INT8_C( -75), INT8_C(  85), INT8_C(  50)) },
+    { simde_mm512_set_epi8(INT8_C(  71), INT8_C( -49), INT8_C( -67), INT8_C( -44), INT8_C(  68), INT8_C( 102), INT8_C( -43), INT8_C( -70),
+                           INT8_C( -70), INT8_C(  89), INT8_C( -37), INT8_C( -65), INT8_C(  33), INT8_C(-114), INT8_C(-101), INT8_C( -51),
+                           INT8_C(  33), INT8_C(   3), INT8_C( -90), INT8_C( -17), INT8_C( 111), INT8_C( 123), INT8_C( -54), INT8_C(  25),
+                           INT8_C(   1), INT8_C( 100), INT8_C(  12), INT8_C(  -3), INT8_C(  94), INT8_C( 126), INT8_C(   0), INT8_C(  89),
+                           INT8_C( -68), INT8_C(  30), INT8_C(  -5), INT8_C( -76), INT8_C( -48), INT8_C(-106), INT8_C(  19), INT8_C(  -2),
+                           INT8_C( -86), INT8_C(  25), INT8_C( -17), INT8_C(  72), INT8_C( -34), INT8_C(   9), INT8_C( -43), INT8_C(  84),
+                           INT8_C(  72), INT8_C(  47), INT8_C( 123), INT8_C( 119), INT8_C( -13), INT8_C( -76), INT8_C(  47), INT8_C( -53),
+                           INT8_C( -78), INT8_C(  93), INT8_C( -32), INT8_C(  75), INT8_C(  83), INT8_C( 101), INT8_C(-124), INT8_C(   3)),
+      simde_mm512_set_epi8(INT8_C(  63), INT8_C(  62), INT8_C(  66), INT8_C( -67), INT8_C( -77), INT8_C(  29), INT8_C( 109), INT8_C( -28),
+                           INT8_C(-107), INT8_C(  12), INT8_C(  97), INT8_C( 117), INT8_C( -66), INT8_C( 125), INT8_C(  20), INT8_C(-115),
+                           INT8_C( -95), INT8_C( -51), INT8_C(  93), INT8_C(  22), INT8_C( 108), INT8_C( 102), INT8_C( 114), INT8_C(  41),
+                           INT8_C( 104), INT8_C( -62), INT8_C(-100), INT8_C(  34), INT8_C( -26), INT8_C( -20), INT8_C(-127), INT8_C( -86),
+                           INT8_C(-100), INT8_C( -62), INT8_C( -39), INT8_C(  66), INT8_C( -40), INT8_C( -84), INT8_C(-100), INT8_C(  18),
+                           INT8_C(  61), INT8_C( -12), INT8_C(-122), INT8_C(  95), INT8_C(   6), INT8_C(  14), INT8_C( -39), INT8_C( -31),
+                           INT8_C(  29), INT8_C(  87), INT8_C( -41), INT8_C(  10), INT8_C( -66), INT8_C( 108), INT8_C(  46), INT8_C( -68),
+                           INT8_C(  15), INT8_C( 113), INT8_C(-128), INT8_C( -22), INT8_C(  66), INT8_C( -50), INT8_C(  54), INT8_C(-111)),
+      simde_mm512_set_epi8(INT8_C( -37), INT8_C(  58), INT8_C(  33), INT8_C(  49), INT8_C( -34), INT8_C(  10), INT8_C(-104), INT8_C(  15),
+                           INT8_C( 101), INT8_C( -33), INT8_C( -73), INT8_C(  27), INT8_C( -70), INT8_C( -12), INT8_C( -73), INT8_C( -24),
+                           INT8_C(-117), INT8_C(  69), INT8_C( 116), INT8_C(-102), INT8_C(-102), INT8_C(  52), INT8_C(-100), INT8_C(  54),
+                           INT8_C( -43), INT8_C( -62), INT8_C( -56), INT8_C(  83), INT8_C(-117), INT8_C( -87), INT8_C( -86), INT8_C( 115),
+                           INT8_C(  41), INT8_C(  11), INT8_C(  83), INT8_C( -52), INT8_C( -84), INT8_C(  98), INT8_C(  21), INT8_C(  74),
+                           INT8_C(  33), INT8_C(-125), INT8_C( -23), INT8_C( -39), INT8_C( 124), INT8_C( 108), INT8_C(  48), INT8_C(  96),
+                           INT8_C(  46), INT8_C( -81), INT8_C(-125), INT8_C(  58), INT8_C( -86), INT8_C( -43), INT8_C( -81), INT8_C(-123),
+                           INT8_C( -36), INT8_C(  82), INT8_C( -22), INT8_C( -58), INT8_C(  89), INT8_C(   7), INT8_C( 105), INT8_C( -46)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_multishift_epi64_epi8(test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_multishift_epi64_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask64 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C( -56), INT8_C( -71), INT8_C(  62), INT8_C(   0), INT8_C(  72), INT8_C(-104), INT8_C( -45), INT8_C(  36),
+                           INT8_C(-103), INT8_C(  44), INT8_C( -74), INT8_C(  76), INT8_C(  -3), INT8_C(  -9), INT8_C( -71), INT8_C(-105),
+                           INT8_C(-125), INT8_C(  58), INT8_C(  99), INT8_C( -70), INT8_C(-111), INT8_C(  49), INT8_C(  52), INT8_C(  63),
+                           INT8_C( 116), INT8_C(  54), INT8_C( -96), INT8_C(  42), INT8_C( -73), INT8_C(  30), INT8_C( -28), INT8_C(  55),
+                           INT8_C(  54), INT8_C( -17), INT8_C( -10), INT8_C(  -2), INT8_C(  66), INT8_C(  66), INT8_C(-120), INT8_C( -90),
+                           INT8_C( 127), INT8_C( -81), INT8_C(  77), INT8_C(  80), INT8_C( -72), INT8_C(  58), INT8_C(  38), INT8_C( 106),
+                           INT8_C( 104), INT8_C(-110), INT8_C( -14), INT8_C(  79), INT8_C(   7), INT8_C(  53), INT8_C(   4), INT8_C( -93),
+                           INT8_C( -72), INT8_C( -24), INT8_C(  98), INT8_C(  14), INT8_C(  -2), INT8_C( -30), INT8_C( -82), INT8_C(  63)),
+      UINT64_C(  303041520188869108),
+      simde_mm512_set_epi8(INT8_C( -42), INT8_C( 106), INT8_C( 116), INT8_C( -76), INT8_C(  56), INT8_C(  -3), INT8_C(   9), INT8_C(-100),
+                           INT8_C(  83), INT8_C(  54), INT8_C(  16), INT8_C(  18), INT8_C( -35), INT8_C( -35), INT8_C(  39), INT8_C(  82),
+                           INT8_C( -22), INT8_C(   6), INT8_C( -92), INT8_C( 100), INT8_C(  54), INT8_C(  15), INT8_C( 118), INT8_C(  62),
+                           INT8_C( -13), INT8_C( -55), INT8_C( -54), INT8_C(  -1), INT8_C( -80), INT8_C(  36), INT8_C( -32), INT8_C( 126),
+                           INT8_C(   8), INT8_C( 125), INT8_C(  99), INT8_C(   3), INT8_C(-109), INT8_C( 121), INT8_C( -41), INT8_C(-111),
+                           INT8_C(-103), INT8_C(  85), INT8_C(  49), INT8_C(  -9), INT8_C( -18), INT8_C( -36), INT8_C(  82), INT8_C( 117),
+                           INT8_C(-128), INT8_C(-118), INT8_C(-102), INT8_C( 117), INT8_C( -67), INT8_C( -85), INT8_C( -80), INT8_C(  85),
+                           INT8_C( 100), INT8_C(  93), INT8_C(  45), INT8_C( -50), INT8_C(  35), INT8_C(  93), INT8_C( -85), INT8_C(-126)),
+      simde_mm512_set_epi8(INT8_C( -71), INT8_C(   8), INT8_C(  20), INT8_C( 118), INT8_C(  53), INT8_C(-120), INT8_C( -39), INT8_C(-121),
+                           INT8_C(-104), INT8_C( -32), INT8_C(-112), INT8_C(  82), INT8_C( -27), INT8_C(-123), INT8_C(  60), INT8_C(  63),
+                           INT8_C( 124), INT8_C(  61), INT8_C(-112), INT8_C(  66), INT8_C(-125), INT8_C(  50), INT8_C( -69), INT8_C(   9),
+                           INT8_C(  88), INT8_C( -42), INT8_C(-113), INT8_C( -11), INT8_C(  45), INT8_C(  19), INT8_C( -76), INT8_C(  33),
+                           INT8_C( -92), INT8_C(  71), INT8_C( -76), INT8_C( -64), INT8_C( 119), INT8_C(  19), INT8_C( -78), INT8_C(   5),
+                           INT8_C( -12), INT8_C( -37), INT8_C( -93), INT8_C( -37), INT8_C(-124), INT8_C( 113), INT8_C( -32), INT8_C( -60),
+                           INT8_C(   0), INT8_C(  37), INT8_C(  47), INT8_C(  44), INT8_C(  50), INT8_C( -76), INT8_C(  17), INT8_C( 102),
+                           INT8_C(-115), INT8_C(  84), INT8_C(-105), INT8_C( -74), INT8_C( -25), INT8_C( -29), INT8_C(  20), INT8_C(-113)),
+      simde_mm512_set_epi8(INT8_C( -56), INT8_C( -71), INT8_C(  62), INT8_C(   0), INT8_C(  72), INT8_C(  61), INT8_C( -45), INT8_C(  36),
+                           INT8_C(-103), INT8_C(  44), INT8_C(-123), INT8_C(  97), INT8_C(  -3), INT8_C(-105), INT8_C( -71), INT8_C(-105),
+                           INT8_C( 100), INT8_C(  58), INT8_C(  99), INT8_C(   4), INT8_C( -16), INT8_C( 101), INT8_C( -16), INT8_C(  63),
+                           INT8_C(  26), INT8_C(  54), INT8_C( -19), INT8_C(  42), INT8_C( -42), INT8_C(  30), INT8_C( -28), INT8_C(  55),
+                           INT8_C(  54), INT8_C( -17), INT8_C(-104), INT8_C(  64), INT8_C(  66), INT8_C(  66), INT8_C( -18), INT8_C(-119),
+                           INT8_C( 127), INT8_C( -81), INT8_C(  77), INT8_C(  80), INT8_C( 110), INT8_C( -72), INT8_C(  38), INT8_C( -90),
+                           INT8_C( 104), INT8_C(   4), INT8_C( -14), INT8_C(  79), INT8_C(  48), INT8_C(  53), INT8_C(   4), INT8_C(-107),
+                           INT8_C( 123), INT8_C( -73), INT8_C( -92), INT8_C(-116), INT8_C(  -2), INT8_C( -73), INT8_C( -82), INT8_C(  63)) },
+    { simde_mm512_set_epi8(INT8_C(  45), INT8_C( -92), INT8_C(  97), INT8_C( -21), INT8_C(  65), INT8_C(-107), INT8_C( 121), INT8_C(  67),
+                           INT8_C(  65), INT8_C(   3), INT8_C(  27), INT8_C( -57), INT8_C(  95), INT8_C(  85), INT8_C( -68), INT8_C( -70),
+                           INT8_C(  75), INT8_C(-123), INT8_C(  34), INT8_C(-114), INT8_C( -25), INT8_C( -79), INT8_C(-127), INT8_C(  -7),
+                           INT8_C(  -8), INT8_C( -21), INT8_C(  50), INT8_C(   4), INT8_C( 123), INT8_C( -69), INT8_C( -49), INT8_C( -26),
+                           INT8_C( 114), INT8_C(-101), INT8_C(  -3), INT8_C( -22), INT8_C(  83), INT8_C( 117), INT8_C( -10), INT8_C( -53),
+                           INT8_C( 105), INT8_C( -96), INT8_C( -36), INT8_C(  32), INT8_C( -84), INT8_C( -13), INT8_C( 124), INT8_C( -78),
+                           INT8_C( -83), INT8_C( -63), INT8_C(  91), INT8_C(-126), INT8_C( 117), INT8_C(  51), INT8_C(  68), INT8_C(  -5),
+                           INT8_C(  33), INT8_C(  62), INT8_C(  73), INT8_C(  -9), INT8_C(  85), INT8_C( -55), INT8_C( -82), INT8_C( 103)),
+      UINT64_C(11777588709215148804),
+      simde_mm512_set_epi8(INT8_C( 111), INT8_C(  81), INT8_C( -47), INT8_C( -20), INT8_C( -86), INT8_C(   2), INT8_C( -14), INT8_C(  99),
+                           INT8_C( 105), INT8_C( -68), INT8_C(  -2), INT8_C(  90), INT8_C( -21), INT8_C( -49), INT8_C(  24), INT8_C( -46),
+                           INT8_C( -57), INT8_C( -79), INT8_C( -41), INT8_C( 113), INT8_C(  16), INT8_C( -72), INT8_C(  55), INT8_C(  -3),
+                           INT8_C(   0), INT8_C(  92), INT8_C( -87), INT8_C( 107), INT8_C(  24), INT8_C(  85), INT8_C(  35), INT8_C( 123),
+                           INT8_C(  59), INT8_C( -88), INT8_C( -97), INT8_C( -15), INT8_C(  53), INT8_C( 118), INT8_C( -96), INT8_C( -70),
+                           INT8_C( -70), INT8_C( -21), INT8_C( 120), INT8_C(   6), INT8_C( -59), INT8_C( -98), INT8_C( -35), INT8_C(   0),
+                           INT8_C(  28), INT8_C( -35), INT8_C(  73), INT8_C(  89), INT8_C(  21), INT8_C( -83), INT8_C(-101), INT8_C(  -9),
+                           INT8_C( -41), INT8_C(  78), INT8_C(-127), INT8_C(  10), INT8_C(-101), INT8_C(-126), INT8_C(  99), INT8_C( 113)),
+      simde_mm512_set_epi8(INT8_C( 114), INT8_C( -91), INT8_C(  71), INT8_C(  19), INT8_C( -87), INT8_C( -72), INT8_C( 108), INT8_C( -99),
+                           INT8_C(  85), INT8_C( -53), INT8_C(  89), INT8_C( -24), INT8_C(-101), INT8_C(  87), INT8_C( 121), INT8_C( -18),
+                           INT8_C(  61), INT8_C( -85), INT8_C( -56), INT8_C( -87), INT8_C( -19), INT8_C( -19), INT8_C( 111), INT8_C(  48),
+                           INT8_C( -15), INT8_C( -84), INT8_C( -99), INT8_C(  41), INT8_C(  15), INT8_C(  29), INT8_C(  78), INT8_C( -19),
+                           INT8_C( -91), INT8_C(-127), INT8_C(  35), INT8_C(  10), INT8_C( -38), INT8_C( -17), INT8_C(  50), INT8_C(-120),
+                           INT8_C(   4), INT8_C(  24), INT8_C( -62), INT8_C(  65), INT8_C(  -6), INT8_C( 122), INT8_C( -58), INT8_C(   4),
+                           INT8_C( -75), INT8_C(  23), INT8_C( 103), INT8_C( -92), INT8_C( 118), INT8_C(-105), INT8_C( 110), INT8_C(-103),
+                           INT8_C( 109), INT8_C(-115), INT8_C( -57), INT8_C( 105), INT8_C( -77), INT8_C(  40), INT8_C(  15), INT8_C(  71)),
+      simde_mm512_set_epi8(INT8_C(  74), INT8_C( -92), INT8_C( -36), INT8_C( -21), INT8_C(  65), INT8_C(-107), INT8_C( -87), INT8_C( -30),
+                           INT8_C(  65), INT8_C( -27), INT8_C( -71), INT8_C(  38), INT8_C(  95), INT8_C(  85), INT8_C(-101), INT8_C( -70),
+                           INT8_C(  75), INT8_C( -43), INT8_C( -37), INT8_C(-114), INT8_C( -25), INT8_C(  61), INT8_C( 123), INT8_C(  -7),
+                           INT8_C( -19), INT8_C( -21), INT8_C(  50), INT8_C(   4), INT8_C( 123), INT8_C( 120), INT8_C( -91), INT8_C( -66),
+                           INT8_C(  20), INT8_C(  35), INT8_C(  -3), INT8_C( -64), INT8_C(  44), INT8_C( 117), INT8_C(  10), INT8_C(  41),
+                           INT8_C( 105), INT8_C(  24), INT8_C(   4), INT8_C(  32), INT8_C(  48), INT8_C( -13), INT8_C(  15), INT8_C(   4),
+                           INT8_C(  71), INT8_C( -63), INT8_C(  91), INT8_C(  59), INT8_C( -76), INT8_C(  51), INT8_C(-114), INT8_C( 106),
+                           INT8_C(  33), INT8_C(  62), INT8_C(  73), INT8_C(  -9), INT8_C(  85), INT8_C( -47), INT8_C( -82), INT8_C( 103)) },
+    { simde_mm512_set_epi8(INT8_C(  47), INT8_C( -86), INT8_C(  -9), INT8_C( -23), INT8_C( -24), INT8_C(  63), INT8_C( -89), INT8_C(  21),
+                           INT8_C(  90), INT8_C( -16), INT8_C(  19), INT8_C( 116), INT8_C( -83), INT8_C( -36), INT8_C( -83), INT8_C( -50),
+                           INT8_C( 111), INT8_C(  94), INT8_C(  88), INT8_C( 104), INT8_C(   9), INT8_C( 123), INT8_C(-114), INT8_C(  82),
+                           INT8_C( -41), INT8_C(-102), INT8_C( -13), INT8_C( -54), INT8_C(  59), INT8_C( -94), INT8_C(-107), INT8_C( 120),
+                           INT8_C( -66), INT8_C( -98), INT8_C(  89), INT8_C(-114), INT8_C( -65), INT8_C( -22), INT8_C(  74), INT8_C( -83),
+                           INT8_C(  98), INT8_C(  78), INT8_C(  34), INT8_C(   1), INT8_C(-106), INT8_C( 113), INT8_C(  29), INT8_C(  87),
+                           INT8_C( 104), INT8_C( -33), INT8_C( -26), INT8_C(  53), INT8_C( 120), INT8_C( -60), INT8_C( 127), INT8_C( -88),
+                           INT8_C(  95), INT8_C( -33), INT8_C(  34), INT8_C( 103), INT8_C( 103), INT8_C(  63), INT8_C(  13), INT8_C(  50)),
+      UINT64_C( 1192903641592048753),
+      simde_mm512_set_epi8(INT8_C(  89), INT8_C( -31), INT8_C( -74), INT8_C(-126), INT8_C( -31), INT8_C( -53), INT8_C( -42), INT8_C(  57),
+                           INT8_C( -28), INT8_C(  55), INT8_C(  49), INT8_C(-128), INT8_C(-111), INT8_C( -75), INT8_C(-126), INT8_C( 125),
+                           INT8_C( -88), INT8_C( 123), INT8_C( -34), INT8_C( -92), INT8_C( -39), INT8_C(-125), INT8_C(  45), INT8_C( -90),
+                           INT8_C( -77), INT8_C( -11), INT8_C( 110), INT8_C(  62), INT8_C(-125), INT8_C( -60), INT8_C( 104), INT8_C( -73),
+                           INT8_C( -74), INT8_C(  36), INT8_C(-102), INT8_C( 124), INT8_C(  57), INT8_C( 102), INT8_C(  81), INT8_C(  85),
+                           INT8_C(  17), INT8_C( 103), INT8_C( -22), INT8_C(-111), INT8_C( 103), INT8_C( -55), INT8_C( 100), INT8_C(-100),
+                           INT8_C( -45), INT8_C(   5), INT8_C(  99), INT8_C( -39), INT8_C(  65), INT8_C( -23), INT8_C(  62), INT8_C( -95),
+                           INT8_C( -69), INT8_C(  66), INT8_C( -28), INT8_C( -78), INT8_C( -70), INT8_C( -46), INT8_C( -67), INT8_C(  27)),
+      simde_mm512_set_epi8(INT8_C( 103), INT8_C( -34), INT8_C(  31), INT8_C(-116), INT8_C( -45), INT8_C( -98), INT8_C(  40), INT8_C(  97),
+                           INT8_C(  22), INT8_C( -70), INT8_C(  29), INT8_C(  57), INT8_C( -14), INT8_C(  92), INT8_C( -82), INT8_C( 125),
+                           INT8_C(  28), INT8_C(  84), INT8_C(  89), INT8_C(  79), INT8_C(  18), INT8_C( 109), INT8_C( -52), INT8_C( -28),
+                           INT8_C(  73), INT8_C(-114), INT8_C(  70), INT8_C(-115), INT8_C( -69), INT8_C(  87), INT8_C( -13), INT8_C( -61),
+                           INT8_C( -96), INT8_C( -64), INT8_C( -77), INT8_C(  -7), INT8_C( -98), INT8_C( -68), INT8_C( -13), INT8_C( 101),
+                           INT8_C(  30), INT8_C( 113), INT8_C( -58), INT8_C( -90), INT8_C( 125), INT8_C(   0), INT8_C(  76), INT8_C(  -4),
+                           INT8_C(  29), INT8_C( 112), INT8_C( -19), INT8_C( 106), INT8_C( -54), INT8_C( -94), INT8_C(-101), INT8_C(  74),
+                           INT8_C( 125), INT8_C(  50), INT8_C(  81), INT8_C(  27), INT8_C(  51), INT8_C(-112), INT8_C( -17), INT8_C( -43)),
+      simde_mm512_set_epi8(INT8_C(  47), INT8_C( -86), INT8_C(  -9), INT8_C(  24), INT8_C( -24), INT8_C(  63), INT8_C( -89), INT8_C(  21),
+                           INT8_C( -45), INT8_C( -16), INT8_C(  19), INT8_C( 116), INT8_C(  46), INT8_C( -75), INT8_C( -97), INT8_C( -50),
+                           INT8_C( 111), INT8_C(  94), INT8_C(  88), INT8_C( 104), INT8_C(-119), INT8_C( 123), INT8_C( -94), INT8_C( 101),
+                           INT8_C(  49), INT8_C(-102), INT8_C( -13), INT8_C( -54), INT8_C( 120), INT8_C( -94), INT8_C(  70), INT8_C( 120),
+                           INT8_C(-125), INT8_C( -98), INT8_C( 103), INT8_C(  90), INT8_C( -65), INT8_C( -22), INT8_C(  74), INT8_C( -83),
+                           INT8_C(  98), INT8_C(-115), INT8_C(  34), INT8_C(-128), INT8_C(-115), INT8_C(  38), INT8_C(  29), INT8_C( 103),
+                           INT8_C( 104), INT8_C( -33), INT8_C( -83), INT8_C(  53), INT8_C( -91), INT8_C( 118), INT8_C( 127), INT8_C( -88),
+                           INT8_C(  95), INT8_C( -11), INT8_C(  17), INT8_C(  76), INT8_C( 103), INT8_C(  63), INT8_C(  13), INT8_C( 102)) },
+    { simde_mm512_set_epi8(INT8_C(  17), INT8_C(-101), INT8_C( -23), INT8_C(  99), INT8_C(  55), INT8_C( -90), INT8_C( 123), INT8_C(  15),
+                           INT8_C(  15), INT8_C(  38), INT8_C(  88), INT8_C(-110), INT8_C( -44), INT8_C(  41), INT8_C( -46), INT8_C( 107),
+                           INT8_C( -27), INT8_C(-116), INT8_C( -60), INT8_C(  83), INT8_C(-126), INT8_C( -73), INT8_C( -59), INT8_C( -32),
+                           INT8_C(   1), INT8_C( -22), INT8_C(  76), INT8_C( 114), INT8_C(-105), INT8_C(-100), INT8_C( -25), INT8_C( -17),
+                           INT8_C( -64), INT8_C( -15), INT8_C( -56), INT8_C(  54), INT8_C( -41), INT8_C(  33), INT8_C(  84), INT8_C( -58),
+                           INT8_C( -28), INT8_C( 122), INT8_C( 120), INT8_C(  45), INT8_C(-106), INT8_C( -96), INT8_C( -40), INT8_C( -73),
+                           INT8_C(-120), INT8_C( 112), INT8_C(  19), INT8_C( -15), INT8_C( -64), INT8_C( -79), INT8_C(  69), INT8_C( 125),
+                           INT8_C(-106), INT8_C(  40), INT8_C(-116), INT8_C( -53), INT8_C(  67), INT8_C(  42), INT8_C( -86), INT8_C( 105)),
+      UINT64_C( 2427501490713700171),
+      simde_mm512_set_epi8(INT8_C(  52), INT8_C(  -7), INT8_C( -99), INT8_C( -10), INT8_C( 100), INT8_C(-103), INT8_C( -32), INT8_C( -31),
+                           INT8_C( -10), INT8_C(  11), INT8_C( 106), INT8_C(  57), INT8_C(  47), INT8_C(  57), INT8_C( -78), INT8_C(-124),
+                           INT8_C( -97), INT8_C(  -4), INT8_C( -86), INT8_C( -80), INT8_C(  13), INT8_C( -30), INT8_C(  -5), INT8_C( -77),
+                           INT8_C(-120), INT8_C( -59), INT8_C(  64), INT8_C(  92), INT8_C(  19), INT8_C(  12), INT8_C(-108), INT8_C(  91),
+                           INT8_C( -77), INT8_C(  10), INT8_C( -94), INT8_C(-103), INT8_C(  53), INT8_C( -62), INT8_C( 100), INT8_C(  83),
+                           INT8_C( 108), INT8_C(-125), INT8_C( 121), INT8_C( 107), INT8_C( -23), INT8_C(-107), INT8_C(  51), INT8_C( 117),
+                           INT8_C( 105), INT8_C( 118), INT8_C(  92), INT8_C( -33), INT8_C(   1), INT8_C(-102), INT8_C( -78), INT8_C(  81),
+                           INT8_C( -83), INT8_C( 127), INT8_C(  78), INT8_C( -28), INT8_C(  -1), INT8_C(  68), INT8_C(  20), INT8_C(  57)),
+      simde_mm512_set_epi8(INT8_C(  40), INT8_C( -13), INT8_C(  80), INT8_C(   8), INT8_C(  42), INT8_C(  11), INT8_C( -36), INT8_C(  51),
+                           INT8_C(  -9), INT8_C( -71), INT8_C( -69), INT8_C(  99), INT8_C(  32), INT8_C( 115), INT8_C(  68), INT8_C( 123),
+                           INT8_C( 107), INT8_C(  74), INT8_C(  67), INT8_C(  55), INT8_C(-127), INT8_C( -63), INT8_C( -79), INT8_C(  89),
+                           INT8_C( -62), INT8_C(  21), INT8_C(  17), INT8_C( -10), INT8_C(  28), INT8_C(  16), INT8_C( -69), INT8_C( -82),
+                           INT8_C( -30), INT8_C(  -3), INT8_C( 117), INT8_C( 112), INT8_C( -90), INT8_C( -28), INT8_C( -82), INT8_C( 114),
+                           INT8_C(  36), INT8_C( -26), INT8_C(  41), INT8_C( -40), INT8_C(-106), INT8_C(  -5), INT8_C(  24), INT8_C(-125),
+                           INT8_C( -35), INT8_C( -15), INT8_C( -92), INT8_C(   1), INT8_C(   9), INT8_C(  79), INT8_C(  -6), INT8_C( -10),
+                           INT8_C( -72), INT8_C( -58), INT8_C(  -5), INT8_C( -82), INT8_C(   4), INT8_C( -12), INT8_C( -53), INT8_C(  96)),
+      simde_mm512_set_epi8(INT8_C(  17), INT8_C(-101), INT8_C(  65), INT8_C(  99), INT8_C(  55), INT8_C( -90), INT8_C( 123), INT8_C(   4),
+                           INT8_C( -34), INT8_C(  38), INT8_C( 110), INT8_C(  -5), INT8_C( -44), INT8_C(  41), INT8_C( -46), INT8_C( 107),
+                           INT8_C( -27), INT8_C(-116), INT8_C(-112), INT8_C(  74), INT8_C(-126), INT8_C( -51), INT8_C(  45), INT8_C( 105),
+                           INT8_C( -69), INT8_C( -22), INT8_C( -82), INT8_C(  97), INT8_C(-126), INT8_C(  11), INT8_C( -63), INT8_C( -17),
+                           INT8_C(  95), INT8_C( -15), INT8_C( -56), INT8_C(  54), INT8_C(  23), INT8_C(-100), INT8_C(  84), INT8_C( -36),
+                           INT8_C(  98), INT8_C( 122), INT8_C(-110), INT8_C( -59), INT8_C(  20), INT8_C( -96), INT8_C( -40), INT8_C( -73),
+                           INT8_C( -46), INT8_C( 112), INT8_C(  16), INT8_C( -15), INT8_C( -64), INT8_C(  66), INT8_C( 124), INT8_C( -89),
+                           INT8_C(-106), INT8_C( -63), INT8_C(-116), INT8_C( -53), INT8_C( -63), INT8_C(  42), INT8_C(  79), INT8_C(  92)) },
+    { simde_mm512_set_epi8(INT8_C(  56), INT8_C(  78), INT8_C( -90), INT8_C(  80), INT8_C( -73), INT8_C( 120), INT8_C(  86), INT8_C(  80),
+                           INT8_C( -71), INT8_C(-123), INT8_C(  17), INT8_C( -25), INT8_C( -98), INT8_C(  30), INT8_C( 107), INT8_C(   6),
+                           INT8_C(  96), INT8_C(-114), INT8_C( -33), INT8_C( -35), INT8_C( -90), INT8_C(  70), INT8_C(  36), INT8_C(-113),
+                           INT8_C(-122), INT8_C(  47), INT8_C(  37), INT8_C(  -8), INT8_C(  38), INT8_C( -68), INT8_C( -76), INT8_C(  39),
+                           INT8_C(  27), INT8_C(  55), INT8_C( 102), INT8_C( 105), INT8_C(  87), INT8_C( 104), INT8_C(-120), INT8_C( -74),
+                           INT8_C(  28), INT8_C( -66), INT8_C(-106), INT8_C( -83), INT8_C(  85), INT8_C( -87), INT8_C(  26), INT8_C(   2),
+                           INT8_C(  24), INT8_C(  -3), INT8_C( 118), INT8_C(  10), INT8_C( -35), INT8_C(  55), INT8_C(  39), INT8_C(  76),
+                           INT8_C( -12), INT8_C(-126), INT8_C( 125), INT8_C(   3), INT8_C(  67), INT8_C( -23), INT8_C( 100), INT8_C( -59)),
+      UINT64_C( 7742341921735941116),
+      simde_mm512_set_epi8(INT8_C( -23), INT8_C(  65), INT8_C(  14), INT8_C( -92), INT8_C( -79), INT8_C( -48), INT8_C(  27), INT8_C( 103),
+                           INT8_C(  23), INT8_C(  39), INT8_C( -12), INT8_C(  37), INT8_C(-111), INT8_C(-119), INT8_C(  -2), INT8_C(  91),
+                           INT8_C(   1), INT8_C( -94), INT8_C(  85), INT8_C(  59), INT8_C(-119), INT8_C(  78), INT8_C(   7), INT8_C(  21),
+                           INT8_C(-111), INT8_C(  81), INT8_C(  51), INT8_C( -47), INT8_C( -15), INT8_C( -51), INT8_C(  48), INT8_C(  53),
+                           INT8_C( -97), INT8_C( -55), INT8_C( 118), INT8_C(  43), INT8_C( -11), INT8_C(  43), INT8_C( -52), INT8_C( -84),
+                           INT8_C( -78), INT8_C( 123), INT8_C(-115), INT8_C( 108), INT8_C( 125), INT8_C(  44), INT8_C(  21), INT8_C(   6),
+                           INT8_C( 111), INT8_C( -84), INT8_C( -45), INT8_C(  35), INT8_C(  11), INT8_C(  94), INT8_C( 111), INT8_C(-103),
+                           INT8_C( -98), INT8_C( -32), INT8_C(  60), INT8_C(  76), INT8_C( -89), INT8_C(  49), INT8_C(  50), INT8_C(  -4)),
+      simde_mm512_set_epi8(INT8_C( -44), INT8_C( -90), INT8_C(  -5), INT8_C( -69), INT8_C(  70), INT8_C(  60), INT8_C( 119), INT8_C( -45),
+                           INT8_C(  40), INT8_C(  93), INT8_C( 103), INT8_C( 109), INT8_C( 115), INT8_C(-121), INT8_C(   9), INT8_C( -64),
+                           INT8_C( 124), INT8_C(-128), INT8_C( -42), INT8_C( -66), INT8_C(  -2), INT8_C( 123), INT8_C( -21), INT8_C( -41),
+                           INT8_C(-128), INT8_C(  39), INT8_C( -77), INT8_C(  13), INT8_C( -48), INT8_C(  87), INT8_C( -66), INT8_C( 107),
+                           INT8_C(-114), INT8_C( -66), INT8_C( -47), INT8_C( 104), INT8_C( -25), INT8_C( -21), INT8_C(   3), INT8_C(  45),
+                           INT8_C(  19), INT8_C(  29), INT8_C( -57), INT8_C(   9), INT8_C( 102), INT8_C( -95), INT8_C( -19), INT8_C(  55),
+                           INT8_C( -64), INT8_C(  29), INT8_C( 119), INT8_C(-128), INT8_C( -98), INT8_C( -12), INT8_C( -15), INT8_C( -44),
+                           INT8_C( -82), INT8_C(  91), INT8_C( -84), INT8_C(  28), INT8_C(-118), INT8_C(  -5), INT8_C(-126), INT8_C(-111)),
+      simde_mm512_set_epi8(INT8_C(  56), INT8_C( -23), INT8_C( -15), INT8_C(  80), INT8_C(  83), INT8_C( 120), INT8_C( 104), INT8_C(  -9),
+                           INT8_C( -71), INT8_C( -50), INT8_C(-123), INT8_C(  59), INT8_C( -98), INT8_C(  30), INT8_C(   0), INT8_C(   6),
+                           INT8_C(  96), INT8_C( -81), INT8_C( -33), INT8_C( -17), INT8_C( -90), INT8_C(  70), INT8_C( -41), INT8_C(-113),
+                           INT8_C(  43), INT8_C(  43), INT8_C(   4), INT8_C(  43), INT8_C(  38), INT8_C( -67), INT8_C( -76), INT8_C(   1),
+                           INT8_C(  27), INT8_C(  55), INT8_C( 102), INT8_C( 105), INT8_C(  87), INT8_C( -38), INT8_C( -80), INT8_C( -74),
+                           INT8_C( -57), INT8_C( -66), INT8_C(  15), INT8_C( -83), INT8_C( -72), INT8_C( -36), INT8_C(  53), INT8_C( -76),
+                           INT8_C(  58), INT8_C(  -3), INT8_C( 118), INT8_C( -16), INT8_C( -98), INT8_C(  55), INT8_C(  58), INT8_C(  79),
+                           INT8_C( 114), INT8_C(  28), INT8_C(  26), INT8_C( -72), INT8_C(  88), INT8_C(  45), INT8_C( 100), INT8_C( -59)) },
+    { simde_mm512_set_epi8(INT8_C( 124), INT8_C( -39), INT8_C(  77), INT8_C(  93), INT8_C(  22), INT8_C(  13), INT8_C(  -9), INT8_C(  81),
+                           INT8_C(  28), INT8_C( 104), INT8_C( -59), INT8_C( -18), INT8_C( -98), INT8_C(   1), INT8_C( -33), INT8_C(  47),
+                           INT8_C(  47), INT8_C( -95), INT8_C( -54), INT8_C(  52), INT8_C(  15), INT8_C(-107), INT8_C(  20), INT8_C(-122),
+                           INT8_C(  73), INT8_C( -93), INT8_C(  66), INT8_C( 104), INT8_C( -50), INT8_C( -52), INT8_C(  86), INT8_C( -21),
+                           INT8_C( -24), INT8_C(  93), INT8_C(  78), INT8_C(  47), INT8_C( -40), INT8_C( -50), INT8_C( -66), INT8_C(  87),
+                           INT8_C( -99), INT8_C( -37), INT8_C( -52), INT8_C(-102), INT8_C( -38), INT8_C( -33), INT8_C( -25), INT8_C(-104),
+                           INT8_C( -66), INT8_C( -17), INT8_C( 104), INT8_C( -53), INT8_C(  28), INT8_C( -59), INT8_C( 114), INT8_C( 124),
+                           INT8_C( 118), INT8_C( -25), INT8_C( -61), INT8_C( -77), INT8_C( -61), INT8_C( -83), INT8_C( -69), INT8_C( -53)),
+      UINT64_C(13078939579738457077),
+      simde_mm512_set_epi8(INT8_C( -64), INT8_C(   8), INT8_C(  82), INT8_C(  55), INT8_C( -13), INT8_C(   7), INT8_C( -39), INT8_C( -42),
+                           INT8_C(  45), INT8_C( 114), INT8_C(  91), INT8_C( -76), INT8_C(  11), INT8_C(  15), INT8_C(   3), INT8_C(-111),
+                           INT8_C( -66), INT8_C(   8), INT8_C( -81), INT8_C(-120), INT8_C(  -8), INT8_C(  63), INT8_C(  81), INT8_C( -78),
+                           INT8_C(  44), INT8_C( -27), INT8_C(  12), INT8_C(  94), INT8_C(  71), INT8_C(  75), INT8_C(-109), INT8_C( -43),
+                           INT8_C(  18), INT8_C(  85), INT8_C(  39), INT8_C(  60), INT8_C( 127), INT8_C(-124), INT8_C(  52), INT8_C( -68),
+                           INT8_C(-126), INT8_C(   4), INT8_C(  46), INT8_C( -76), INT8_C(   9), INT8_C( 121), INT8_C(  78), INT8_C(  32),
+                           INT8_C( -12), INT8_C(  11), INT8_C( -12), INT8_C( -66), INT8_C(  64), INT8_C(  13), INT8_C(  87), INT8_C(  14),
+                           INT8_C(  65), INT8_C(  95), INT8_C(  41), INT8_C(  47), INT8_C( -96), INT8_C(  72), INT8_C(  24), INT8_C(  -1)),
+      simde_mm512_set_epi8(INT8_C( -24), INT8_C( -52), INT8_C(-105), INT8_C( -16), INT8_C( -86), INT8_C( -78), INT8_C(  76), INT8_C(  45),
+                           INT8_C(  96), INT8_C(  51), INT8_C( 101), INT8_C(  53), INT8_C( -27), INT8_C(  55), INT8_C(-113), INT8_C( -78),
+                           INT8_C(   0), INT8_C(  34), INT8_C(  29), INT8_C( -99), INT8_C( 123), INT8_C(  83), INT8_C( 121), INT8_C(  64),
+                           INT8_C( 126), INT8_C( -13), INT8_C(  20), INT8_C( -10), INT8_C(  11), INT8_C(  53), INT8_C(  29), INT8_C( -69),
+                           INT8_C(-111), INT8_C(  72), INT8_C(  51), INT8_C( -87), INT8_C( -18), INT8_C(  40), INT8_C(  61), INT8_C( -64),
+                           INT8_C(  85), INT8_C(  71), INT8_C( -91), INT8_C(  -6), INT8_C( 102), INT8_C(-115), INT8_C(  37), INT8_C(  10),
+                           INT8_C(  27), INT8_C( -11), INT8_C( -77), INT8_C( -54), INT8_C( -74), INT8_C(  68), INT8_C( -12), INT8_C(  98),
+                           INT8_C( -87), INT8_C( -59), INT8_C( 125), INT8_C(  85), INT8_C(  97), INT8_C( -25), INT8_C(  99), INT8_C( -27)),
+      simde_mm512_set_epi8(INT8_C(  45), INT8_C( -39), INT8_C( -84), INT8_C( -47), INT8_C(  22), INT8_C(-104), INT8_C(  -9), INT8_C( -86),
+                           INT8_C(-101), INT8_C( 104), INT8_C( -59), INT8_C( -18), INT8_C( -98), INT8_C(   1), INT8_C( -33), INT8_C(-101),
+                           INT8_C(   0), INT8_C( -95), INT8_C(  68), INT8_C( 121), INT8_C(   0), INT8_C(-107), INT8_C( -87), INT8_C(-122),
+                           INT8_C(  73), INT8_C( -89), INT8_C(  66), INT8_C( 104), INT8_C( -50), INT8_C( -52), INT8_C(  86), INT8_C( -21),
+                           INT8_C(-118), INT8_C(  93), INT8_C( 103), INT8_C(  47), INT8_C(-127), INT8_C( -50), INT8_C( -66), INT8_C(   9),
+                           INT8_C( -99), INT8_C( -37), INT8_C( -52), INT8_C(  84), INT8_C(-110), INT8_C( -33), INT8_C(  52), INT8_C(  -6),
+                           INT8_C( -65), INT8_C( -17), INT8_C( 104), INT8_C( -53), INT8_C(  28), INT8_C( -59), INT8_C( 108), INT8_C(  19),
+                           INT8_C( -14), INT8_C( -86), INT8_C( -66), INT8_C(-118), INT8_C( -61), INT8_C(  99), INT8_C( -69), INT8_C( -53)) },
+    { simde_mm512_set_epi8(INT8_C( -59), INT8_C(  70), INT8_C(  84), INT8_C(-119), INT8_C(  12), INT8_C( -89), INT8_C( -93), INT8_C(  14),
+                           INT8_C(  62), INT8_C( -29), INT8_C( -58), INT8_C( -85), INT8_C(  80), INT8_C(  98), INT8_C( -90), INT8_C(-125),
+                           INT8_C( 127), INT8_C(  69), INT8_C( -57), INT8_C( 107), INT8_C(  82), INT8_C(-103), INT8_C(  -7), INT8_C(  49),
+                           INT8_C( -33), INT8_C( 117), INT8_C( 111), INT8_C( 102), INT8_C( -44), INT8_C(-116), INT8_C( -41), INT8_C(  95),
+                           INT8_C( -12), INT8_C(-120), INT8_C( -31), INT8_C(  81), INT8_C(  -1), INT8_C( 127), INT8_C( -54), INT8_C(  11),
+                           INT8_C(  34), INT8_C( -51), INT8_C( -61), INT8_C( -92), INT8_C(  53), INT8_C(  98), INT8_C( 119), INT8_C( -28),
+                           INT8_C(-102), INT8_C( -38), INT8_C( -93), INT8_C(  93), INT8_C( -68), INT8_C(  38), INT8_C( -94), INT8_C( -31),
+                           INT8_C(  -5), INT8_C( -74), INT8_C(   1), INT8_C(-110), INT8_C( -51), INT8_C( -77), INT8_C( -23), INT8_C( -78)),
+      UINT64_C(  879376620549823786),
+      simde_mm512_set_epi8(INT8_C(  19), INT8_C( 127), INT8_C( -72), INT8_C(  40), INT8_C(  -4), INT8_C(  28), INT8_C( -61), INT8_C(  62),
+                           INT8_C(  65), INT8_C( -42), INT8_C(  83), INT8_C(  99), INT8_C(  95), INT8_C( -40), INT8_C( -87), INT8_C( 108),
+                           INT8_C( -69), INT8_C( -21), INT8_C(  74), INT8_C( -29), INT8_C( 110), INT8_C( 121), INT8_C( -34), INT8_C(-111),
+                           INT8_C(  79), INT8_C( -23), INT8_C(  99), INT8_C( 100), INT8_C(  39), INT8_C(  -2), INT8_C(  27), INT8_C( 103),
+                           INT8_C( -96), INT8_C( -69), INT8_C( 102), INT8_C(  22), INT8_C( -93), INT8_C( -77), INT8_C(-103), INT8_C(  21),
+                           INT8_C( 121), INT8_C( 114), INT8_C( -98), INT8_C( -68), INT8_C(-116), INT8_C(  59), INT8_C(  83), INT8_C( 115),
+                           INT8_C( -66), INT8_C(  82), INT8_C(-121), INT8_C(-120), INT8_C(  92), INT8_C( -78), INT8_C(  82), INT8_C(  23),
+                           INT8_C( -72), INT8_C(  39), INT8_C(  93), INT8_C(-104), INT8_C(  28), INT8_C( -89), INT8_C( -17), INT8_C( -56)),
+      simde_mm512_set_epi8(INT8_C(-114), INT8_C(  51), INT8_C( -25), INT8_C(  97), INT8_C(  59), INT8_C(  48), INT8_C( -28), INT8_C(  98),
+                           INT8_C(  70), INT8_C(  46), INT8_C(  64), INT8_C(-127), INT8_C( -25), INT8_C(-113), INT8_C( -94), INT8_C( -25),
+                           INT8_C( -29), INT8_C(  69), INT8_C( 111), INT8_C(-104), INT8_C(  58), INT8_C(  89), INT8_C( -16), INT8_C(-122),
+                           INT8_C(   5), INT8_C(  -6), INT8_C( -93), INT8_C( -37), INT8_C( -54), INT8_C( -24), INT8_C( -32), INT8_C(-121),
+                           INT8_C( -49), INT8_C( -19), INT8_C(  23), INT8_C(  13), INT8_C( -46), INT8_C(  10), INT8_C(   6), INT8_C(  75),
+                           INT8_C(-106), INT8_C(  32), INT8_C( 100), INT8_C( -99), INT8_C(  73), INT8_C( -98), INT8_C(  80), INT8_C(  43),
+                           INT8_C( -74), INT8_C(-126), INT8_C( 122), INT8_C(  82), INT8_C( -24), INT8_C(-116), INT8_C(  60), INT8_C( -46),
+                           INT8_C(  64), INT8_C( 122), INT8_C(  55), INT8_C(-125), INT8_C( -40), INT8_C( -61), INT8_C( -11), INT8_C(  56)),
+      simde_mm512_set_epi8(INT8_C( -59), INT8_C(  70), INT8_C(  84), INT8_C(-119), INT8_C(  40), INT8_C(  19), INT8_C( -93), INT8_C(  14),
+                           INT8_C(  62), INT8_C( -29), INT8_C( -15), INT8_C(  16), INT8_C(  80), INT8_C( -25), INT8_C( -90), INT8_C(-125),
+                           INT8_C( 127), INT8_C(  69), INT8_C( 124), INT8_C( 107), INT8_C(  21), INT8_C( 113), INT8_C(  -7), INT8_C(  49),
+                           INT8_C( -33), INT8_C(  81), INT8_C( 123), INT8_C( 102), INT8_C( -44), INT8_C(-116), INT8_C( -41), INT8_C(  95),
+                           INT8_C(  13), INT8_C(-120), INT8_C( -31), INT8_C(  72), INT8_C(  -1), INT8_C( 127), INT8_C( -23), INT8_C(-112),
+                           INT8_C( -53), INT8_C( -51), INT8_C( 117), INT8_C( -92), INT8_C(  53), INT8_C( 114), INT8_C(  51), INT8_C( -60),
+                           INT8_C(  74), INT8_C(  35), INT8_C( -93), INT8_C(  60), INT8_C(  46), INT8_C( -96), INT8_C( -94), INT8_C( -47),
+                           INT8_C(  -5), INT8_C( -74), INT8_C(  30), INT8_C(-110), INT8_C(  61), INT8_C( -77), INT8_C( -12), INT8_C( -78)) },
+    { simde_mm512_set_epi8(INT8_C( 114), INT8_C(  77), INT8_C( 114), INT8_C( -18), INT8_C(  25), INT8_C(  79), INT8_C(  24), INT8_C(  58),
+                           INT8_C(  85), INT8_C(  67), INT8_C(  50), INT8_C( -63), INT8_C(  35), INT8_C( -93), INT8_C(   0), INT8_C(  -5),
+                           INT8_C( -25), INT8_C(  34), INT8_C(  -2), INT8_C(  50), INT8_C(   9), INT8_C(  56), INT8_C(  11), INT8_C( -20),
+                           INT8_C( -41), INT8_C( -91), INT8_C( -67), INT8_C(  27), INT8_C(-101), INT8_C( -86), INT8_C( -58), INT8_C(  96),
+                           INT8_C( 127), INT8_C(-116), INT8_C( 114), INT8_C( -78), INT8_C( -87), INT8_C( -99), INT8_C( -26), INT8_C( -19),
+                           INT8_C(  52), INT8_C(  97), INT8_C(  -4), INT8_C(   4), INT8_C(  38), INT8_C(  70), INT8_C( -33), INT8_C( -46),
+                           INT8_C( -89), INT8_C( 120), INT8_C( 110), INT8_C( 126), INT8_C( 119), INT8_C(  -9), INT8_C( 121), INT8_C(  32),
+                           INT8_C(  20), INT8_C( 123), INT8_C( -49), INT8_C( -51), INT8_C( 112), INT8_C( -14), INT8_C(-104), INT8_C(  16)),
+      UINT64_C( 2176889479483023314),
+      simde_mm512_set_epi8(INT8_C( -68), INT8_C(  -7), INT8_C(  70), INT8_C(  69), INT8_C( 126), INT8_C(-109), INT8_C(-117), INT8_C( 115),
+                           INT8_C(-120), INT8_C(  56), INT8_C( -59), INT8_C( -30), INT8_C( -45), INT8_C(-100), INT8_C( -53), INT8_C( -28),
+                           INT8_C( 112), INT8_C( -37), INT8_C(  18), INT8_C(-126), INT8_C(  75), INT8_C(  -9), INT8_C( -74), INT8_C( -55),
+                           INT8_C( 109), INT8_C(-123), INT8_C(   2), INT8_C( -65), INT8_C( -56), INT8_C(  12), INT8_C(-106), INT8_C( -28),
+                           INT8_C(  95), INT8_C( -19), INT8_C(  15), INT8_C( -49), INT8_C( 121), INT8_C( -61), INT8_C(-112), INT8_C(-123),
+                           INT8_C(  65), INT8_C( -29), INT8_C(  23), INT8_C(-124), INT8_C( 119), INT8_C(  87), INT8_C(-108), INT8_C( -84),
+                           INT8_C(  19), INT8_C( -16), INT8_C(  40), INT8_C(  67), INT8_C(-101), INT8_C( 116), INT8_C(  -5), INT8_C(-101),
+                           INT8_C(  -4), INT8_C( -32), INT8_C( 123), INT8_C( -35), INT8_C( -28), INT8_C( -88), INT8_C( -56), INT8_C(-118)),
+      simde_mm512_set_epi8(INT8_C(  95), INT8_C(  37), INT8_C(  95), INT8_C( -72), INT8_C( 116), INT8_C( -23), INT8_C(  81), INT8_C( 112),
+                           INT8_C(  50), INT8_C(-108), INT8_C(  92), INT8_C( -75), INT8_C(  87), INT8_C(-104), INT8_C( 105), INT8_C(  34),
+                           INT8_C(-125), INT8_C( 104), INT8_C( -10), INT8_C( -26), INT8_C(  76), INT8_C( -87), INT8_C( 125), INT8_C(-103),
+                           INT8_C(  97), INT8_C( -58), INT8_C(-125), INT8_C(  98), INT8_C( 121), INT8_C(  82), INT8_C( -12), INT8_C(  49),
+                           INT8_C( -89), INT8_C(-124), INT8_C(  32), INT8_C(  20), INT8_C(  98), INT8_C( 122), INT8_C(  40), INT8_C(  33),
+                           INT8_C(  39), INT8_C(  72), INT8_C(  66), INT8_C( -47), INT8_C(  19), INT8_C( -93), INT8_C(  91), INT8_C(  87),
+                           INT8_C( -83), INT8_C( -36), INT8_C( -37), INT8_C( 117), INT8_C( -69), INT8_C(  49), INT8_C( -55), INT8_C( -60),
+                           INT8_C(-127), INT8_C(-111), INT8_C( -55), INT8_C(-128), INT8_C(   0), INT8_C( -88), INT8_C(  16), INT8_C( -91)),
+      simde_mm512_set_epi8(INT8_C( 114), INT8_C(  77), INT8_C( 114), INT8_C(-117), INT8_C( -63), INT8_C( -99), INT8_C(  42), INT8_C(  58),
+                           INT8_C(  85), INT8_C(  67), INT8_C(  73), INT8_C(  45), INT8_C(  35), INT8_C(  85), INT8_C(   0), INT8_C( -53),
+                           INT8_C( 104), INT8_C( -55), INT8_C(  -2), INT8_C( 102), INT8_C(  47), INT8_C(   6), INT8_C(  11), INT8_C( -66),
+                           INT8_C( -41), INT8_C( -95), INT8_C(  12), INT8_C(  98), INT8_C(-101), INT8_C( -86), INT8_C( -27), INT8_C(  96),
+                           INT8_C(  40), INT8_C(-116), INT8_C( -12), INT8_C( -78), INT8_C( -45), INT8_C( -99), INT8_C( 122), INT8_C(  65),
+                           INT8_C( -85), INT8_C(  90), INT8_C(  -4), INT8_C( -75), INT8_C(  78), INT8_C(  39), INT8_C(  58), INT8_C( -46),
+                           INT8_C( 102), INT8_C( -36), INT8_C( 110), INT8_C(  56), INT8_C( -73), INT8_C( -35), INT8_C(-107), INT8_C( -73),
+                           INT8_C(  88), INT8_C(-128), INT8_C( -49), INT8_C(   0), INT8_C( 112), INT8_C( -14), INT8_C(  16), INT8_C(  16)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_multishift_epi64_epi8(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_multishift_epi64_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask64 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT64_C(11198449321946943652),
+      simde_mm512_set_epi8(INT8_C( -12), INT8_C(  35), INT8_C(  28), INT8_C( -31), INT8_C(  33), INT8_C( 118), INT8_C( -36), INT8_C( 112),
+                           INT8_C( -11), INT8_C( -94), INT8_C(  -6), INT8_C( 104), INT8_C(  82), INT8_C(  36), INT8_C(-111), INT8_C(-109),
+                           INT8_C( 127), INT8_C(  53), INT8_C( -34), INT8_C(  33), INT8_C(  45), INT8_C( -37), INT8_C(  66), INT8_C(-106),
+                           INT8_C( -66), INT8_C(  78), INT8_C( -15), INT8_C(  37), INT8_C(  82), INT8_C( -32), INT8_C(  69), INT8_C(  28),
+                           INT8_C(   9), INT8_C( -31), INT8_C( -73), INT8_C( -42), INT8_C(  13), INT8_C( 121), INT8_C(  63), INT8_C( -93),
+                           INT8_C( -77), INT8_C( -56), INT8_C( -31), INT8_C(  51), INT8_C( 124), INT8_C(  51), INT8_C(  33), INT8_C( -32),
+                           INT8_C(-109), INT8_C( -16), INT8_C( -28), INT8_C( 100), INT8_C(  19), INT8_C( -24), INT8_C( -16), INT8_C(   0),
+                           INT8_C( -38), INT8_C( -30), INT8_C( 122), INT8_C(-112), INT8_C( -49), INT8_C(  30), INT8_C( -42), INT8_C( -19)),
+      simde_mm512_set_epi8(INT8_C(  12), INT8_C(  87), INT8_C(   0), INT8_C(-111), INT8_C(-116), INT8_C(  72), INT8_C(-113), INT8_C(  58),
+                           INT8_C(  30), INT8_C(-126), INT8_C( -36), INT8_C( 119), INT8_C(   7), INT8_C(  53), INT8_C( -77), INT8_C(  92),
+                           INT8_C( -76), INT8_C(  68), INT8_C( -94), INT8_C( -12), INT8_C(  78), INT8_C( 114), INT8_C( -34), INT8_C( -95),
+                           INT8_C( -63), INT8_C( -57), INT8_C( -26), INT8_C(-108), INT8_C(  70), INT8_C( -23), INT8_C(  56), INT8_C( -48),
+                           INT8_C( 107), INT8_C(  93), INT8_C( -39), INT8_C( -76), INT8_C(  56), INT8_C( 123), INT8_C( -51), INT8_C(-117),
+                           INT8_C( -19), INT8_C( 109), INT8_C( -62), INT8_C(  40), INT8_C( 102), INT8_C( -47), INT8_C(   9), INT8_C(-104),
+                           INT8_C( 125), INT8_C( -82), INT8_C(  19), INT8_C(  69), INT8_C( -65), INT8_C(  52), INT8_C( 101), INT8_C(-109),
+                           INT8_C(  27), INT8_C( -20), INT8_C(-116), INT8_C( -92), INT8_C(  62), INT8_C( -99), INT8_C(  45), INT8_C( -56)),
+      simde_mm512_set_epi8(INT8_C( -59), INT8_C(   0), INT8_C(   0), INT8_C(  72), INT8_C(  72), INT8_C(   0), INT8_C(  24), INT8_C(  87),
+                           INT8_C(   0), INT8_C(  29), INT8_C(   7), INT8_C(   0), INT8_C( -51), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  67), INT8_C( -94), INT8_C( -47), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -88), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -92), INT8_C(   0), INT8_C(  52), INT8_C(   0), INT8_C(   0), INT8_C( -58), INT8_C(  68),
+                           INT8_C( -26), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -34), INT8_C( -75), INT8_C(   0), INT8_C(  54),
+                           INT8_C( -83), INT8_C(   9), INT8_C(   0), INT8_C( -83), INT8_C(-114), INT8_C( -83), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -26), INT8_C(   0), INT8_C(   0), INT8_C(  52), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  15), INT8_C(   0), INT8_C(   6), INT8_C(   0), INT8_C(   0), INT8_C(-112), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C( 2247876496901056919),
+      simde_mm512_set_epi8(INT8_C( -36), INT8_C( -40), INT8_C( -45), INT8_C( -82), INT8_C(-120), INT8_C(  13), INT8_C( -40), INT8_C(-116),
+                           INT8_C(  75), INT8_C( -66), INT8_C( -86), INT8_C(-114), INT8_C( -81), INT8_C( -85), INT8_C(   9), INT8_C(  30),
+                           INT8_C( 108), INT8_C(-116), INT8_C(  45), INT8_C(  13), INT8_C(  61), INT8_C( -57), INT8_C(  95), INT8_C( -31),
+                           INT8_C(  57), INT8_C(  96), INT8_C(  60), INT8_C(  -9), INT8_C(  66), INT8_C( -52), INT8_C( -21), INT8_C( -74),
+                           INT8_C( -86), INT8_C( -19), INT8_C( -26), INT8_C( 101), INT8_C(-101), INT8_C( -55), INT8_C( -71), INT8_C(-123),
+                           INT8_C( -14), INT8_C(  25), INT8_C( -75), INT8_C( -58), INT8_C(   6), INT8_C( 119), INT8_C(  -6), INT8_C(  49),
+                           INT8_C( -66), INT8_C( -81), INT8_C( 126), INT8_C( 127), INT8_C( 117), INT8_C(-104), INT8_C(  -6), INT8_C( -60),
+                           INT8_C(  43), INT8_C( -77), INT8_C(  73), INT8_C(  32), INT8_C( -50), INT8_C(  -3), INT8_C(-128), INT8_C(-123)),
+      simde_mm512_set_epi8(INT8_C(-101), INT8_C(  58), INT8_C( -94), INT8_C( -36), INT8_C(  67), INT8_C( 126), INT8_C( -66), INT8_C(  43),
+                           INT8_C( -42), INT8_C(   7), INT8_C( -93), INT8_C(  29), INT8_C( -67), INT8_C( -50), INT8_C(  80), INT8_C(  75),
+                           INT8_C( 114), INT8_C( 100), INT8_C( -73), INT8_C(-128), INT8_C(  58), INT8_C( 101), INT8_C( -15), INT8_C( -88),
+                           INT8_C( -67), INT8_C( 110), INT8_C(  33), INT8_C( 125), INT8_C(  60), INT8_C( -39), INT8_C(  78), INT8_C(  52),
+                           INT8_C( -79), INT8_C(  86), INT8_C( 103), INT8_C( -30), INT8_C(-100), INT8_C( -82), INT8_C(-108), INT8_C(  28),
+                           INT8_C( -66), INT8_C(  56), INT8_C( -99), INT8_C(  85), INT8_C( -66), INT8_C( 121), INT8_C(  -1), INT8_C(  98),
+                           INT8_C( -75), INT8_C(  81), INT8_C(-111), INT8_C( -38), INT8_C( -61), INT8_C(  63), INT8_C( -49), INT8_C( -67),
+                           INT8_C( 118), INT8_C( 116), INT8_C(-126), INT8_C(  94), INT8_C( -83), INT8_C(   0), INT8_C(  96), INT8_C(  61)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -22), INT8_C( -66), INT8_C( -11), INT8_C(  67), INT8_C( -21),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -24), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(  40), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  67), INT8_C( -29), INT8_C(   0), INT8_C( -64),
+                           INT8_C(  94), INT8_C( 125), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -60), INT8_C( -11),
+                           INT8_C(-103), INT8_C(   0), INT8_C( -97), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(-114), INT8_C(   0), INT8_C( -15), INT8_C(  -3), INT8_C(  -3), INT8_C( 124), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -10), INT8_C(   0), INT8_C( -10), INT8_C(   0), INT8_C( -86), INT8_C(   0), INT8_C(   0), INT8_C(  -5),
+                           INT8_C(-112), INT8_C(   0), INT8_C(   0), INT8_C(  94), INT8_C(   0), INT8_C( -21), INT8_C(  61), INT8_C(   1)) },
+    { UINT64_C(15684090002449954841),
+      simde_mm512_set_epi8(INT8_C(-122), INT8_C(  26), INT8_C( -54), INT8_C( 118), INT8_C(  80), INT8_C(  27), INT8_C(  13), INT8_C(-116),
+                           INT8_C( 107), INT8_C( -54), INT8_C( -86), INT8_C( 111), INT8_C( -59), INT8_C( -47), INT8_C(  40), INT8_C( -99),
+                           INT8_C(  26), INT8_C( -29), INT8_C( -76), INT8_C(  23), INT8_C( -87), INT8_C(  98), INT8_C(  82), INT8_C( 121),
+                           INT8_C(-123), INT8_C( -18), INT8_C(  15), INT8_C(  93), INT8_C(  89), INT8_C(  21), INT8_C(  91), INT8_C(  15),
+                           INT8_C( -46), INT8_C(  23), INT8_C( -87), INT8_C(   0), INT8_C( -71), INT8_C( -71), INT8_C( -51), INT8_C(-108),
+                           INT8_C(-111), INT8_C( -36), INT8_C( -36), INT8_C( -51), INT8_C( -47), INT8_C(  25), INT8_C( 115), INT8_C( -77),
+                           INT8_C( -56), INT8_C( 121), INT8_C( -63), INT8_C(  30), INT8_C(  41), INT8_C(  43), INT8_C(  78), INT8_C( -82),
+                           INT8_C(-128), INT8_C(  48), INT8_C( -44), INT8_C( -23), INT8_C(  55), INT8_C( -19), INT8_C(  85), INT8_C(   4)),
+      simde_mm512_set_epi8(INT8_C( 102), INT8_C( 126), INT8_C(  23), INT8_C(-119), INT8_C( -65), INT8_C( -10), INT8_C(  35), INT8_C( -34),
+                           INT8_C( -68), INT8_C( -56), INT8_C( -82), INT8_C(  -5), INT8_C(  51), INT8_C( -66), INT8_C(-111), INT8_C( -67),
+                           INT8_C( 114), INT8_C( -10), INT8_C(-116), INT8_C( -26), INT8_C( -71), INT8_C(  25), INT8_C(  23), INT8_C(  83),
+                           INT8_C( -44), INT8_C(  -9), INT8_C(  10), INT8_C( -33), INT8_C(-123), INT8_C( -98), INT8_C(  85), INT8_C(  -8),
+                           INT8_C(-123), INT8_C(  47), INT8_C( -23), INT8_C( 117), INT8_C( -18), INT8_C(  -4), INT8_C( -93), INT8_C(  62),
+                           INT8_C( -84), INT8_C(-118), INT8_C( -59), INT8_C(  33), INT8_C(   4), INT8_C( -10), INT8_C( -98), INT8_C( -61),
+                           INT8_C(  -2), INT8_C(-103), INT8_C( -32), INT8_C( -78), INT8_C(  65), INT8_C(  26), INT8_C( -46), INT8_C( -26),
+                           INT8_C(-114), INT8_C(   1), INT8_C(  31), INT8_C( -26), INT8_C( 106), INT8_C( -25), INT8_C( -40), INT8_C(-105)),
+      simde_mm512_set_epi8(INT8_C(-113), INT8_C( 111), INT8_C(   0), INT8_C(-103), INT8_C( -10), INT8_C(   0), INT8_C(   0), INT8_C(  98),
+                           INT8_C(  21), INT8_C(   0), INT8_C(  43), INT8_C(   0), INT8_C(-115), INT8_C(   0), INT8_C(   0), INT8_C( -39),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 114), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -81), INT8_C( -36), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -16), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -35), INT8_C( -12), INT8_C(   0), INT8_C(   0), INT8_C(  66), INT8_C(   0), INT8_C( -17),
+                           INT8_C(   0), INT8_C(  16), INT8_C(   0), INT8_C(   0), INT8_C( 123), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -46), INT8_C( 127), INT8_C( 115), INT8_C( -55), INT8_C( -16), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-113), INT8_C(  28), INT8_C(   0), INT8_C(   0), INT8_C(-119)) },
+    { UINT64_C(  189292016092376943),
+      simde_mm512_set_epi8(INT8_C( 109), INT8_C( -90), INT8_C( -87), INT8_C( -91), INT8_C( -53), INT8_C(  99), INT8_C( -99), INT8_C(  -4),
+                           INT8_C(  62), INT8_C(  46), INT8_C(  26), INT8_C( -67), INT8_C(  10), INT8_C( -63), INT8_C(-127), INT8_C( 126),
+                           INT8_C(  49), INT8_C(-104), INT8_C( -45), INT8_C( 105), INT8_C(-109), INT8_C( 108), INT8_C(-102), INT8_C(-117),
+                           INT8_C(-113), INT8_C(  36), INT8_C(  12), INT8_C( -57), INT8_C(  84), INT8_C( -70), INT8_C(-106), INT8_C( 103),
+                           INT8_C( -92), INT8_C( 102), INT8_C( -97), INT8_C(-118), INT8_C(  96), INT8_C(  24), INT8_C(  85), INT8_C( -52),
+                           INT8_C( -50), INT8_C(  51), INT8_C( -47), INT8_C(  71), INT8_C( 125), INT8_C(-126), INT8_C( -62), INT8_C(  72),
+                           INT8_C(  26), INT8_C( -92), INT8_C(-102), INT8_C(  11), INT8_C(-107), INT8_C( -64), INT8_C(  95), INT8_C( 118),
+                           INT8_C(-113), INT8_C( 112), INT8_C(  99), INT8_C( -91), INT8_C(  51), INT8_C( -19), INT8_C(  79), INT8_C( -87)),
+      simde_mm512_set_epi8(INT8_C(  81), INT8_C(  95), INT8_C(  14), INT8_C( 119), INT8_C( -95), INT8_C(  89), INT8_C( -91), INT8_C( 101),
+                           INT8_C(  28), INT8_C( -57), INT8_C(  -9), INT8_C( -22), INT8_C( -33), INT8_C(  17), INT8_C(  43), INT8_C( -78),
+                           INT8_C( -56), INT8_C(  32), INT8_C( -38), INT8_C(   7), INT8_C( -22), INT8_C(  79), INT8_C( -16), INT8_C(-109),
+                           INT8_C( -30), INT8_C(  61), INT8_C(-104), INT8_C( -72), INT8_C(  10), INT8_C(  -2), INT8_C( 112), INT8_C( -14),
+                           INT8_C( -18), INT8_C(-108), INT8_C(-118), INT8_C( 123), INT8_C(-104), INT8_C(  44), INT8_C( 120), INT8_C( -61),
+                           INT8_C(  13), INT8_C(  90), INT8_C(-119), INT8_C(  65), INT8_C( -88), INT8_C( -77), INT8_C( 116), INT8_C( -86),
+                           INT8_C( -74), INT8_C( 109), INT8_C( 112), INT8_C( -52), INT8_C(-100), INT8_C(  42), INT8_C( 115), INT8_C(  76),
+                           INT8_C( -48), INT8_C(  51), INT8_C(  99), INT8_C( -77), INT8_C(  96), INT8_C(  35), INT8_C( -91), INT8_C( -57)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -67), INT8_C(   0),
+                           INT8_C( -56), INT8_C(   0), INT8_C( -73), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  16), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( -72), INT8_C(   0), INT8_C(  49),
+                           INT8_C( -89), INT8_C(  41), INT8_C(  -9), INT8_C(  30), INT8_C(   0), INT8_C(   0), INT8_C( -63), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  39), INT8_C(  12), INT8_C(  39), INT8_C(   0), INT8_C( -31), INT8_C(  76), INT8_C(-103), INT8_C( -39),
+                           INT8_C(   0), INT8_C(  51), INT8_C( 118), INT8_C(   0), INT8_C(   6), INT8_C(-101), INT8_C(  71), INT8_C( -79)) },
+    { UINT64_C( 9250733817162707540),
+      simde_mm512_set_epi8(INT8_C(  -1), INT8_C(  61), INT8_C( -99), INT8_C(   2), INT8_C(  85), INT8_C( -90), INT8_C(  38), INT8_C(  76),
+                           INT8_C(  63), INT8_C( -28), INT8_C(  -5), INT8_C(  34), INT8_C( -88), INT8_C(   7), INT8_C( -84), INT8_C(  20),
+                           INT8_C( -12), INT8_C( -49), INT8_C( -18), INT8_C(  23), INT8_C( 123), INT8_C(  67), INT8_C( -85), INT8_C(-125),
+                           INT8_C( -58), INT8_C(  -6), INT8_C( -15), INT8_C( -26), INT8_C(  88), INT8_C( 125), INT8_C(  62), INT8_C(  63),
+                           INT8_C(  70), INT8_C( 127), INT8_C(-111), INT8_C( 108), INT8_C( 101), INT8_C( -65), INT8_C( -76), INT8_C( -42),
+                           INT8_C(  89), INT8_C( -16), INT8_C( 109), INT8_C(-117), INT8_C(  54), INT8_C( -76), INT8_C(  14), INT8_C(  74),
+                           INT8_C( -10), INT8_C( -66), INT8_C( -28), INT8_C( 101), INT8_C( -56), INT8_C( -96), INT8_C(   8), INT8_C(-101),
+                           INT8_C( -26), INT8_C( -43), INT8_C( -14), INT8_C(  76), INT8_C( -18), INT8_C( -48), INT8_C( -43), INT8_C( 113)),
+      simde_mm512_set_epi8(INT8_C( -49), INT8_C( -96), INT8_C( -59), INT8_C(-106), INT8_C(  87), INT8_C(  49), INT8_C( -57), INT8_C(  90),
+                           INT8_C(-109), INT8_C(  77), INT8_C(-116), INT8_C(-102), INT8_C(  60), INT8_C(-113), INT8_C(-108), INT8_C( -77),
+                           INT8_C( -97), INT8_C( -94), INT8_C(  30), INT8_C(  43), INT8_C( -67), INT8_C(-116), INT8_C( -31), INT8_C(  49),
+                           INT8_C( -94), INT8_C( -81), INT8_C( -14), INT8_C( -57), INT8_C( -23), INT8_C( 114), INT8_C(  46), INT8_C(  45),
+                           INT8_C( -21), INT8_C(  91), INT8_C( -49), INT8_C( -16), INT8_C( -26), INT8_C(   9), INT8_C(-124), INT8_C( 101),
+                           INT8_C( -26), INT8_C(  25), INT8_C(  65), INT8_C(-120), INT8_C(  27), INT8_C( -48), INT8_C(-120), INT8_C(  53),
+                           INT8_C(   1), INT8_C(  10), INT8_C(  83), INT8_C(  -1), INT8_C( 115), INT8_C( -53), INT8_C( -93), INT8_C( -14),
+                           INT8_C(-108), INT8_C(  55), INT8_C(  20), INT8_C(-125), INT8_C(  14), INT8_C(  77), INT8_C( 121), INT8_C(   0)),
+      simde_mm512_set_epi8(INT8_C( -75), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -55), INT8_C( 114), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -56),
+                           INT8_C(   0), INT8_C(   0), INT8_C(-120), INT8_C( 123), INT8_C(   0), INT8_C(  38), INT8_C(   0), INT8_C(  38),
+                           INT8_C(   0), INT8_C( 104), INT8_C(  87), INT8_C(   0), INT8_C(   0), INT8_C( 109), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  17), INT8_C( -53), INT8_C(   4), INT8_C(   0), INT8_C( 127), INT8_C(   0), INT8_C( -75), INT8_C(-104),
+                           INT8_C(  13), INT8_C(   0), INT8_C( -54), INT8_C(   0), INT8_C(-104), INT8_C(  97), INT8_C(   0), INT8_C(  34),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  63), INT8_C( -97), INT8_C(   0), INT8_C(   0), INT8_C( -93), INT8_C(   0),
+                           INT8_C(   0), INT8_C( 114), INT8_C(   0), INT8_C( -41), INT8_C(   0), INT8_C(  77), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C( 8696539145768839504),
+      simde_mm512_set_epi8(INT8_C(-119), INT8_C(  30), INT8_C( -96), INT8_C( -65), INT8_C(   3), INT8_C( 108), INT8_C(-122), INT8_C( -94),
+                           INT8_C( 111), INT8_C( -36), INT8_C(  -9), INT8_C( -32), INT8_C(  87), INT8_C( -93), INT8_C(-114), INT8_C(  62),
+                           INT8_C( -65), INT8_C(  16), INT8_C(-119), INT8_C( 116), INT8_C( -88), INT8_C(-103), INT8_C(  98), INT8_C( 122),
+                           INT8_C( 104), INT8_C(  11), INT8_C( -93), INT8_C(  -8), INT8_C( -39), INT8_C(  56), INT8_C(  87), INT8_C(-107),
+                           INT8_C(  79), INT8_C( 117), INT8_C( -55), INT8_C(  81), INT8_C( -53), INT8_C( 110), INT8_C(  43), INT8_C(   3),
+                           INT8_C(  -5), INT8_C( -86), INT8_C(-108), INT8_C( 113), INT8_C( 116), INT8_C(  40), INT8_C(  13), INT8_C(  89),
+                           INT8_C( -12), INT8_C( -60), INT8_C( -23), INT8_C( -70), INT8_C(  61), INT8_C(  27), INT8_C(   9), INT8_C( -54),
+                           INT8_C( -63), INT8_C(   2), INT8_C( -19), INT8_C( -71), INT8_C(-107), INT8_C(  28), INT8_C( 125), INT8_C(  48)),
+      simde_mm512_set_epi8(INT8_C(  45), INT8_C( -58), INT8_C(  47), INT8_C( -56), INT8_C( -56), INT8_C(  86), INT8_C(   1), INT8_C(-109),
+                           INT8_C(  66), INT8_C(  32), INT8_C( -24), INT8_C(  72), INT8_C(  21), INT8_C( -87), INT8_C(  37), INT8_C( -40),
+                           INT8_C(  32), INT8_C( 118), INT8_C(  91), INT8_C( -96), INT8_C(  91), INT8_C( -35), INT8_C(-112), INT8_C( -71),
+                           INT8_C( -28), INT8_C(  36), INT8_C( -54), INT8_C( -76), INT8_C(   6), INT8_C(  -3), INT8_C(  88), INT8_C(  73),
+                           INT8_C(-102), INT8_C( -23), INT8_C(-102), INT8_C(  91), INT8_C( -49), INT8_C( -79), INT8_C(  16), INT8_C(  41),
+                           INT8_C( 101), INT8_C(   3), INT8_C( -89), INT8_C(-112), INT8_C(  10), INT8_C(   2), INT8_C(  43), INT8_C(  -2),
+                           INT8_C( -44), INT8_C( 124), INT8_C(  72), INT8_C( -20), INT8_C( -71), INT8_C(  -6), INT8_C(  31), INT8_C(-127),
+                           INT8_C(  -7), INT8_C(  21), INT8_C(  63), INT8_C( 108), INT8_C(  88), INT8_C( -63), INT8_C( -73), INT8_C(  47)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(  35), INT8_C( -56), INT8_C(  38), INT8_C(  50), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  65), INT8_C(   0), INT8_C(-124), INT8_C(  72), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -35), INT8_C(   0), INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -85), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -28), INT8_C(  13), INT8_C(   0),
+                           INT8_C(  98), INT8_C( -41), INT8_C(   0), INT8_C( -40), INT8_C(  34), INT8_C( -90), INT8_C(  51), INT8_C(   0),
+                           INT8_C( -52), INT8_C( -23), INT8_C(   0), INT8_C(-127), INT8_C(   0), INT8_C( -89), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  71), INT8_C(   0), INT8_C(  36), INT8_C(   0), INT8_C(  14), INT8_C(   0), INT8_C(   0), INT8_C(-121),
+                           INT8_C(   0), INT8_C( -53), INT8_C(   0), INT8_C(  -4), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C(14798863773164607369),
+      simde_mm512_set_epi8(INT8_C(  94), INT8_C( -87), INT8_C( -76), INT8_C( -39), INT8_C(  25), INT8_C(  -9), INT8_C(  73), INT8_C( 111),
+                           INT8_C(  27), INT8_C( -96), INT8_C(   1), INT8_C(  77), INT8_C(-123), INT8_C(  46), INT8_C( -11), INT8_C(-124),
+                           INT8_C( 124), INT8_C( 118), INT8_C( -28), INT8_C( -65), INT8_C( -36), INT8_C(  14), INT8_C( 112), INT8_C( 100),
+                           INT8_C( -75), INT8_C(  87), INT8_C( -98), INT8_C(  81), INT8_C( -63), INT8_C( 112), INT8_C(  17), INT8_C(-121),
+                           INT8_C(  61), INT8_C( -39), INT8_C( -18), INT8_C( -83), INT8_C( 100), INT8_C(  38), INT8_C( -87), INT8_C( -44),
+                           INT8_C(-105), INT8_C( 109), INT8_C(  77), INT8_C(  74), INT8_C(  39), INT8_C(  74), INT8_C( -79), INT8_C(  54),
+                           INT8_C( -85), INT8_C(  -3), INT8_C(-107), INT8_C( 103), INT8_C(-123), INT8_C(  90), INT8_C( -50), INT8_C(  42),
+                           INT8_C(-121), INT8_C(  75), INT8_C(  28), INT8_C(  89), INT8_C( -37), INT8_C( 109), INT8_C(  84), INT8_C(   2)),
+      simde_mm512_set_epi8(INT8_C(-119), INT8_C(  33), INT8_C(  18), INT8_C(  23), INT8_C(  50), INT8_C( -87), INT8_C(  -5), INT8_C(  -2),
+                           INT8_C(  73), INT8_C( -41), INT8_C(-121), INT8_C( -22), INT8_C(  86), INT8_C( 102), INT8_C( -15), INT8_C(  28),
+                           INT8_C(-113), INT8_C( -32), INT8_C( -51), INT8_C( -92), INT8_C(  83), INT8_C( -30), INT8_C( -67), INT8_C( -89),
+                           INT8_C( -34), INT8_C( -69), INT8_C(  78), INT8_C( 121), INT8_C( -45), INT8_C( 102), INT8_C(-114), INT8_C( 123),
+                           INT8_C( -23), INT8_C(  60), INT8_C( -82), INT8_C( 124), INT8_C( -54), INT8_C(  83), INT8_C(  68), INT8_C(  51),
+                           INT8_C(  24), INT8_C( -11), INT8_C(  36), INT8_C( -18), INT8_C(  -8), INT8_C( 123), INT8_C( -54), INT8_C( 103),
+                           INT8_C( -48), INT8_C( -63), INT8_C(-105), INT8_C( -48), INT8_C( -22), INT8_C(   5), INT8_C(  49), INT8_C(  69),
+                           INT8_C(-115), INT8_C( 114), INT8_C(-116), INT8_C( -66), INT8_C(   7), INT8_C(  65), INT8_C(  28), INT8_C(  61)),
+      simde_mm512_set_epi8(INT8_C(  92), INT8_C(-119), INT8_C(   0), INT8_C(   0), INT8_C(-103), INT8_C(  18), INT8_C(   0), INT8_C(  66),
+                           INT8_C(   0), INT8_C( -22), INT8_C(-114), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -38), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -25), INT8_C( -77), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  28),
+                           INT8_C( -97), INT8_C(   0), INT8_C( -14), INT8_C(   0), INT8_C(   0), INT8_C( -71), INT8_C(  87), INT8_C(   0),
+                           INT8_C( -16), INT8_C( -87), INT8_C(   0), INT8_C( -14), INT8_C(  73), INT8_C( -14), INT8_C( 122), INT8_C(  99),
+                           INT8_C(  50), INT8_C(   0), INT8_C(   0), INT8_C(  47), INT8_C(   0), INT8_C(  58), INT8_C(  20), INT8_C( 101),
+                           INT8_C(  56), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -64), INT8_C(   0), INT8_C(   0), INT8_C(  15)) },
+    { UINT64_C( 9463311887426096279),
+      simde_mm512_set_epi8(INT8_C( -45), INT8_C(-114), INT8_C(  88), INT8_C(  -4), INT8_C(  60), INT8_C( -84), INT8_C(  43), INT8_C(  95),
+                           INT8_C( -29), INT8_C(  33), INT8_C(  68), INT8_C(  68), INT8_C( -39), INT8_C(  19), INT8_C( -14), INT8_C( 123),
+                           INT8_C(  52), INT8_C(  29), INT8_C(  72), INT8_C( -61), INT8_C( -23), INT8_C(  56), INT8_C( -23), INT8_C( -88),
+                           INT8_C( -34), INT8_C(  28), INT8_C(-107), INT8_C( -25), INT8_C(  72), INT8_C( 101), INT8_C(  46), INT8_C( -75),
+                           INT8_C( -89), INT8_C( -64), INT8_C(  59), INT8_C( 126), INT8_C( -38), INT8_C(  61), INT8_C( -17), INT8_C( -22),
+                           INT8_C(  90), INT8_C( 116), INT8_C( -21), INT8_C(   7), INT8_C(-100), INT8_C( -35), INT8_C(  10), INT8_C( 126),
+                           INT8_C(  12), INT8_C( -51), INT8_C(  11), INT8_C(  77), INT8_C( -53), INT8_C(  96), INT8_C(   6), INT8_C( -77),
+                           INT8_C( 121), INT8_C( 115), INT8_C( -39), INT8_C( -50), INT8_C(  85), INT8_C(  74), INT8_C( -22), INT8_C( -26)),
+      simde_mm512_set_epi8(INT8_C(  56), INT8_C(  90), INT8_C( -29), INT8_C( -38), INT8_C(-101), INT8_C(  41), INT8_C(  45), INT8_C( -52),
+                           INT8_C(   8), INT8_C(  63), INT8_C( -89), INT8_C( 107), INT8_C(   2), INT8_C( -19), INT8_C( 120), INT8_C(  60),
+                           INT8_C(  42), INT8_C(  21), INT8_C(  61), INT8_C(-111), INT8_C(-114), INT8_C(  70), INT8_C( 114), INT8_C(-103),
+                           INT8_C(  83), INT8_C(  37), INT8_C( 113), INT8_C( -59), INT8_C(   8), INT8_C( -18), INT8_C(-111), INT8_C( 123),
+                           INT8_C( -44), INT8_C(-114), INT8_C(  99), INT8_C(-107), INT8_C(  -2), INT8_C( -54), INT8_C( 109), INT8_C( -96),
+                           INT8_C(  -8), INT8_C( -53), INT8_C( -30), INT8_C( 118), INT8_C(   5), INT8_C(-107), INT8_C(  74), INT8_C(  52),
+                           INT8_C( 104), INT8_C(-112), INT8_C( -99), INT8_C( -96), INT8_C( -87), INT8_C( -24), INT8_C(  26), INT8_C(   0),
+                           INT8_C( -31), INT8_C(  14), INT8_C(  41), INT8_C( -65), INT8_C( -29), INT8_C(  38), INT8_C(  68), INT8_C( -55)),
+      simde_mm512_set_epi8(INT8_C( 101), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  92), INT8_C( -75),
+                           INT8_C(   0), INT8_C( -75), INT8_C(   0), INT8_C(-125), INT8_C(   0), INT8_C(  93), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(-116), INT8_C( 114), INT8_C(  83), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-114), INT8_C(   0), INT8_C(-103),
+                           INT8_C( -57), INT8_C( -96), INT8_C(   0), INT8_C(-125), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(-127), INT8_C(-116), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  82), INT8_C( -45),
+                           INT8_C(-127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C( -96), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -16), INT8_C(   0), INT8_C(   0), INT8_C(-103), INT8_C(   0), INT8_C(-111), INT8_C(-118), INT8_C( -90)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_multishift_epi64_epi8(test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_permutex2var_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i idx;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C(  51), INT8_C(  -7), INT8_C(-102), INT8_C( -25), INT8_C( 102), INT8_C(  -5), INT8_C( -25), INT8_C( -21),
+                           INT8_C(  59), INT8_C(  12), INT8_C( -58), INT8_C(  92), INT8_C(   3), INT8_C( 102), INT8_C(  94), INT8_C( -42),
+                           INT8_C(  55), INT8_C(  59), INT8_C( -39), INT8_C( -13), INT8_C(  74), INT8_C( -43), INT8_C(  62), INT8_C(  42),
+                           INT8_C(  90), INT8_C(  16), INT8_C(  35), INT8_C( -86), INT8_C( -19), INT8_C(  62), INT8_C(  15), INT8_C(  52),
+                           INT8_C(-126), INT8_C(  50), INT8_C(-100), INT8_C(  97), INT8_C(  32), INT8_C( -71), INT8_C(  -2), INT8_C(-119),
+                           INT8_C( -43), INT8_C(   8), INT8_C( -58), INT8_C(  99), INT8_C(  64), INT8_C(  74), INT8_C(  79), INT8_C(-106),
+                           INT8_C(  76), INT8_C( -21), INT8_C(  71), INT8_C( -96), INT8_C(  12), INT8_C(  28), INT8_C( -94), INT8_C(  82),
+                           INT8_C( -56), INT8_C(  89), INT8_C(  70), INT8_C(-116), INT8_C(  14), INT8_C( -97), INT8_C( -50), INT8_C(  78)),
+      simde_mm512_set_epi8(INT8_C(  63), INT8_C( -31), INT8_C(  82), INT8_C( -37), INT8_C( -68), INT8_C( -22), INT8_C( -58), INT8_C( -85),
+                           INT8_C( -99), INT8_C( -66), INT8_C(  13), INT8_C(  24), INT8_C(  53), INT8_C( 107), INT8_C( 115), INT8_C(  13),
+                           INT8_C(-101), INT8_C(  42), INT8_C(-121), INT8_C( -76), INT8_C( -93), INT8_C(  78), INT8_C(  87), INT8_C(  99),
+                           INT8_C( -62), INT8_C(  83), INT8_C(  11), INT8_C( -66), INT8_C( -11), INT8_C(-121), INT8_C(  33), INT8_C(  97),
+                           INT8_C( -63), INT8_C(  78), INT8_C(  75), INT8_C(  35), INT8_C( -45), INT8_C( -82), INT8_C(  70), INT8_C( -20),
+                           INT8_C(   6), INT8_C( -71), INT8_C(  65), INT8_C( -91), INT8_C( 109), INT8_C(-112), INT8_C( -24), INT8_C(  60),
+                           INT8_C(   0), INT8_C(  83), INT8_C(-105), INT8_C(  54), INT8_C(  63), INT8_C(  25), INT8_C(  70), INT8_C( -15),
+                           INT8_C( 121), INT8_C(  12), INT8_C( -24), INT8_C( -79), INT8_C( 127), INT8_C(  -6), INT8_C(-118), INT8_C( -28)),
+      simde_mm512_set_epi8(INT8_C(-121), INT8_C(  33), INT8_C(  29), INT8_C( -18), INT8_C( -83), INT8_C(  28), INT8_C(-113), INT8_C( -45),
+                           INT8_C( -84), INT8_C( -18), INT8_C( -48), INT8_C( -86), INT8_C(  -7), INT8_C( 114), INT8_C(  21), INT8_C(  -8),
+                           INT8_C( -75), INT8_C( -89), INT8_C(-108), INT8_C( -44), INT8_C( -37), INT8_C(  43), INT8_C(  86), INT8_C(  84),
+                           INT8_C(  90), INT8_C(  -8), INT8_C( -61), INT8_C( -11), INT8_C( -90), INT8_C(  77), INT8_C(  78), INT8_C(-119),
+                           INT8_C( 123), INT8_C( -22), INT8_C(  95), INT8_C(  39), INT8_C( -71), INT8_C( -27), INT8_C( -91), INT8_C(   3),
+                           INT8_C(  95), INT8_C( -94), INT8_C( -84), INT8_C( -21), INT8_C(  92), INT8_C(  43), INT8_C(-100), INT8_C( -70),
+                           INT8_C(  34), INT8_C( 117), INT8_C(-126), INT8_C( -35), INT8_C( -57), INT8_C( -17), INT8_C(  23), INT8_C( -43),
+                           INT8_C( -73), INT8_C(-119), INT8_C(-126), INT8_C( -29), INT8_C( -38), INT8_C(  59), INT8_C( -39), INT8_C( -26)),
+      simde_mm512_set_epi8(INT8_C(  51), INT8_C(  78), INT8_C(  43), INT8_C( -71), INT8_C( -25), INT8_C(  43), INT8_C(-119), INT8_C(  74),
+                           INT8_C(-100), INT8_C(  -7), INT8_C(  71), INT8_C(-119), INT8_C( -58), INT8_C( -37), INT8_C(  -7), INT8_C(  71),
+                           INT8_C(  32), INT8_C( -43), INT8_C( -56), INT8_C(  92), INT8_C( -19), INT8_C( 117), INT8_C(  95), INT8_C( -90),
+                           INT8_C(  59), INT8_C(  92), INT8_C(  12), INT8_C(  -7), INT8_C( -48), INT8_C( -56), INT8_C(  15), INT8_C(  78),
+                           INT8_C( -39), INT8_C( 117), INT8_C( -57), INT8_C( -19), INT8_C(  92), INT8_C(  59), INT8_C(-119), INT8_C( -44),
+                           INT8_C(  89), INT8_C( -25), INT8_C( -39), INT8_C(  35), INT8_C(-108), INT8_C(-106), INT8_C(  84), INT8_C( -25),
+                           INT8_C(  78), INT8_C(  92), INT8_C( -43), INT8_C(  12), INT8_C(  51), INT8_C(  -2), INT8_C(-119), INT8_C(  21),
+                           INT8_C(-113), INT8_C( -96), INT8_C(  84), INT8_C(  94), INT8_C(-121), INT8_C(  28), INT8_C(  28), INT8_C( -11)) },
+    { simde_mm512_set_epi8(INT8_C(  15), INT8_C( -65), INT8_C( -14), INT8_C(   6), INT8_C(  28), INT8_C(  50), INT8_C(  34), INT8_C(-123),
+                           INT8_C(-125), INT8_C( 112), INT8_C( 105), INT8_C(  -3), INT8_C( -79), INT8_C( -93), INT8_C( -40), INT8_C( 117),
+                           INT8_C( -76), INT8_C(  31), INT8_C(   8), INT8_C( -53), INT8_C( 123), INT8_C(  81), INT8_C( -60), INT8_C(  -4),
+                           INT8_C( -37), INT8_C( -59), INT8_C( -95), INT8_C( -91), INT8_C( 113), INT8_C(  20), INT8_C(  98), INT8_C(  56),
+                           INT8_C(  91), INT8_C( -96), INT8_C( -79), INT8_C(  43), INT8_C(-114), INT8_C(  63), INT8_C(  28), INT8_C(   0),
+                           INT8_C(  37), INT8_C( -66), INT8_C(  43), INT8_C( -93), INT8_C(  19), INT8_C(  41), INT8_C(  75), INT8_C(  22),
+                           INT8_C( -38), INT8_C( -75), INT8_C( -28), INT8_C( -92), INT8_C(  62), INT8_C(  91), INT8_C(  47), INT8_C(  72),
+                           INT8_C(  70), INT8_C( 110), INT8_C( -68), INT8_C( -29), INT8_C( -30), INT8_C(-121), INT8_C(  34), INT8_C(  12)),
+      simde_mm512_set_epi8(INT8_C( -65), INT8_C(  12), INT8_C(   5), INT8_C( -16), INT8_C( 115), INT8_C( -83), INT8_C(  83), INT8_C(  86),
+                           INT8_C( -14), INT8_C(  96), INT8_C(-102), INT8_C(  91), INT8_C(  18), INT8_C( -50), INT8_C(  19), INT8_C( 112),
+                           INT8_C(-117), INT8_C( -20), INT8_C( -19), INT8_C( 116), INT8_C( -36), INT8_C( -15), INT8_C( -24), INT8_C( -31),
+                           INT8_C(  46), INT8_C( -86), INT8_C(  93), INT8_C(  85), INT8_C(  93), INT8_C(  93), INT8_C( 108), INT8_C( 121),
+                           INT8_C(  -5), INT8_C( -77), INT8_C( -64), INT8_C(  79), INT8_C(  16), INT8_C(   0), INT8_C(  92), INT8_C( -64),
+                           INT8_C( -50), INT8_C(  88), INT8_C(-106), INT8_C( 105), INT8_C( 114), INT8_C( -75), INT8_C(  36), INT8_C( -55),
+                           INT8_C(  99), INT8_C(  59), INT8_C( 105), INT8_C(-116), INT8_C( -30), INT8_C(   2), INT8_C(   3), INT8_C(  15),
+                           INT8_C( 111), INT8_C( -38), INT8_C( 126), INT8_C(  71), INT8_C( -41), INT8_C( -46), INT8_C(  71), INT8_C(-128)),
+      simde_mm512_set_epi8(INT8_C( 110), INT8_C( -52), INT8_C(  65), INT8_C( -90), INT8_C( -90), INT8_C(-117), INT8_C( -82), INT8_C(  43),
+                           INT8_C(  17), INT8_C( -40), INT8_C( -71), INT8_C(  23), INT8_C( -52), INT8_C(  88), INT8_C( 120), INT8_C(  27),
+                           INT8_C( -53), INT8_C(-102), INT8_C( -57), INT8_C(-106), INT8_C( -77), INT8_C( -14), INT8_C( -14), INT8_C(  63),
+                           INT8_C(-104), INT8_C( 124), INT8_C(  22), INT8_C( 104), INT8_C( -25), INT8_C(-108), INT8_C(  38), INT8_C( -14),
+                           INT8_C( 110), INT8_C( 123), INT8_C(-103), INT8_C(  99), INT8_C( -95), INT8_C(-115), INT8_C( 127), INT8_C(  12),
+                           INT8_C(  33), INT8_C(  96), INT8_C(  30), INT8_C(  99), INT8_C(   6), INT8_C( -71), INT8_C(-118), INT8_C(  24),
+                           INT8_C( -54), INT8_C( 124), INT8_C( -22), INT8_C(-108), INT8_C( 105), INT8_C(  88), INT8_C(  40), INT8_C(  72),
+                           INT8_C( -32), INT8_C( -24), INT8_C( -53), INT8_C( 122), INT8_C( -22), INT8_C(-108), INT8_C(  28), INT8_C( 112)),
+      simde_mm512_set_epi8(INT8_C(  15), INT8_C( -92), INT8_C( -68), INT8_C(  27), INT8_C( -52), INT8_C(   8), INT8_C(   6), INT8_C(  96),
+                           INT8_C(  88), INT8_C( -14), INT8_C(  63), INT8_C( -95), INT8_C(  41), INT8_C( 124), INT8_C(  19), INT8_C(  27),
+                           INT8_C(  62), INT8_C(-106), INT8_C( -57), INT8_C(  23), INT8_C(  99), INT8_C( 120), INT8_C(  63), INT8_C(  38),
+                           INT8_C(  31), INT8_C(  81), INT8_C(-103), INT8_C(  30), INT8_C(-103), INT8_C(-103), INT8_C(-106), INT8_C( -82),
+                           INT8_C( -90), INT8_C( -79), INT8_C( 112), INT8_C( -54), INT8_C(  22), INT8_C(  12), INT8_C(  99), INT8_C( 112),
+                           INT8_C( 124), INT8_C(  12), INT8_C( -66), INT8_C( -14), INT8_C(  88), INT8_C( 105), INT8_C( -91), INT8_C(  40),
+                           INT8_C( -25), INT8_C(  28), INT8_C( -14), INT8_C( -92), INT8_C(-108), INT8_C(-121), INT8_C( -30), INT8_C( -38),
+                           INT8_C( -53), INT8_C(-115), INT8_C( -52), INT8_C( -32), INT8_C(  33), INT8_C( -71), INT8_C( -32), INT8_C(  12)) },
+    { simde_mm512_set_epi8(INT8_C( -28), INT8_C(  82), INT8_C(  45), INT8_C( -91), INT8_C(  72), INT8_C(  19), INT8_C(  60), INT8_C( -28),
+                           INT8_C(-115), INT8_C( -65), INT8_C( -87), INT8_C( -41), INT8_C( 106), INT8_C( 107), INT8_C( 125), INT8_C( -33),
+                           INT8_C(-118), INT8_C(  24), INT8_C(-109), INT8_C( 103), INT8_C(-114), INT8_C(  -5), INT8_C( 119), INT8_C( 113),
+                           INT8_C(  78), INT8_C( 107), INT8_C(  20), INT8_C(   4), INT8_C(-126), INT8_C( -54), INT8_C( -53), INT8_C(  39),
+                           INT8_C( -70), INT8_C( -28), INT8_C( 119), INT8_C( -21), INT8_C( -57), INT8_C( -57), INT8_C( -87), INT8_C(  53),
+                           INT8_C(  15), INT8_C( -48), INT8_C(  98), INT8_C(-111), INT8_C( -44), INT8_C(-118), INT8_C(   0), INT8_C( 117),
+                           INT8_C( 106), INT8_C( -25), INT8_C(-123), INT8_C(   6), INT8_C(  14), INT8_C( -13), INT8_C(  82), INT8_C( -48),
+                           INT8_C(  47), INT8_C(-113), INT8_C(  29), INT8_C(-115), INT8_C(-101), INT8_C(-122), INT8_C(  83), INT8_C( -73)),
+      simde_mm512_set_epi8(INT8_C(  67), INT8_C(  46), INT8_C( 101), INT8_C(  85), INT8_C( -28), INT8_C( -57), INT8_C(  28), INT8_C( -52),
+                           INT8_C( -30), INT8_C( -16), INT8_C(  -1), INT8_C(-103), INT8_C(  62), INT8_C(  18), INT8_C( -84), INT8_C( -43),
+                           INT8_C(  -6), INT8_C(  91), INT8_C( -61), INT8_C(  -3), INT8_C( -33), INT8_C(  44), INT8_C(  65), INT8_C( -42),
+                           INT8_C(-101), INT8_C(  -4), INT8_C( -94), INT8_C(  21), INT8_C(  39), INT8_C(  44), INT8_C( -42), INT8_C( -69),
+                           INT8_C(  84), INT8_C(  53), INT8_C(  27), INT8_C(  48), INT8_C(  93), INT8_C(-114), INT8_C( -90), INT8_C(  55),
+                           INT8_C(  17), INT8_C(-127), INT8_C( -96), INT8_C( -19), INT8_C(   0), INT8_C( -17), INT8_C(-121), INT8_C( 121),
+                           INT8_C(  62), INT8_C( -94), INT8_C( -78), INT8_C(  -9), INT8_C( -75), INT8_C(  72), INT8_C(  49), INT8_C(-102),
+                           INT8_C(  51), INT8_C(  -7), INT8_C(-118), INT8_C(  15), INT8_C(  38), INT8_C( -22), INT8_C( -93), INT8_C( -99)),
+      simde_mm512_set_epi8(INT8_C( -43), INT8_C(  77), INT8_C(  23), INT8_C( 113), INT8_C(  29), INT8_C( -43), INT8_C(-105), INT8_C( 115),
+                           INT8_C( -36), INT8_C( -49), INT8_C(  94), INT8_C(   1), INT8_C(-114), INT8_C(  65), INT8_C( 113), INT8_C(-112),
+                           INT8_C(  43), INT8_C(-113), INT8_C(  -5), INT8_C( 125), INT8_C(  -7), INT8_C( -80), INT8_C(  25), INT8_C(  34),
+                           INT8_C(  66), INT8_C( -67), INT8_C(-113), INT8_C(  -5), INT8_C(  53), INT8_C( -29), INT8_C(-124), INT8_C( -21),
+                           INT8_C( -32), INT8_C(  42), INT8_C( 103), INT8_C( 112), INT8_C( -64), INT8_C( -15), INT8_C(   8), INT8_C(  59),
+                           INT8_C(  77), INT8_C(  -7), INT8_C(  15), INT8_C( -74), INT8_C( -77), INT8_C( -33), INT8_C( -50), INT8_C( 103),
+                           INT8_C( 100), INT8_C(  12), INT8_C(  88), INT8_C(   8), INT8_C(-104), INT8_C(  93), INT8_C(-120), INT8_C( -10),
+                           INT8_C(  46), INT8_C( 102), INT8_C( -22), INT8_C( -34), INT8_C( -34), INT8_C( -70), INT8_C(  33), INT8_C( -11)),
+      simde_mm512_set_epi8(INT8_C( -34), INT8_C(  24), INT8_C(-113), INT8_C(  15), INT8_C(  -5), INT8_C(  46), INT8_C( -21), INT8_C(   8),
+                           INT8_C( -29), INT8_C(-112), INT8_C( -43), INT8_C( -87), INT8_C(  82), INT8_C(-118), INT8_C( 103), INT8_C(  15),
+                           INT8_C( -43), INT8_C( -64), INT8_C( -34), INT8_C(  23), INT8_C( -32), INT8_C( 103), INT8_C(  33), INT8_C(  -7),
+                           INT8_C( -57), INT8_C( 113), INT8_C( -54), INT8_C(  98), INT8_C(  78), INT8_C( 103), INT8_C(  -7), INT8_C(  72),
+                           INT8_C( -74), INT8_C( -87), INT8_C( -57), INT8_C( -33), INT8_C( 103), INT8_C( -25), INT8_C( 107), INT8_C(-115),
+                           INT8_C(   0), INT8_C(  83), INT8_C(  39), INT8_C(  -5), INT8_C( -73), INT8_C(  43), INT8_C(  47), INT8_C(-105),
+                           INT8_C(  82), INT8_C( -54), INT8_C( 107), INT8_C( -36), INT8_C( -87), INT8_C( -10), INT8_C( 125), INT8_C( -57),
+                           INT8_C( 106), INT8_C(-105), INT8_C( -13), INT8_C( 106), INT8_C( 107), INT8_C( -80), INT8_C(-126), INT8_C( 119)) },
+    { simde_mm512_set_epi8(INT8_C(  -5), INT8_C( -27), INT8_C(  32), INT8_C( -13), INT8_C( 106), INT8_C( -41), INT8_C( -67), INT8_C(-116),
+                           INT8_C( -91), INT8_C(  74), INT8_C( -52), INT8_C( 114), INT8_C(  48), INT8_C(  86), INT8_C(-126), INT8_C( -55),
+                           INT8_C( 118), INT8_C( -84), INT8_C( -18), INT8_C(  52), INT8_C( -23), INT8_C(  79), INT8_C(  52), INT8_C( -96),
+                           INT8_C( -15), INT8_C(  66), INT8_C( -41), INT8_C(  99), INT8_C(  33), INT8_C( 121), INT8_C( -54), INT8_C(  52),
+                           INT8_C( -34), INT8_C( -86), INT8_C( -93), INT8_C( -27), INT8_C(-108), INT8_C(  63), INT8_C(  46), INT8_C( 104),
+                           INT8_C(  86), INT8_C(   7), INT8_C( 109), INT8_C( 104), INT8_C(  92), INT8_C( -13), INT8_C( -62), INT8_C( -83),
+                           INT8_C( -51), INT8_C( 113), INT8_C(  54), INT8_C( -75), INT8_C(  61), INT8_C( 102), INT8_C( -72), INT8_C( -36),
+                           INT8_C(-110), INT8_C(   8), INT8_C(   2), INT8_C( 105), INT8_C(  57), INT8_C(  95), INT8_C(-128), INT8_C( -99)),
+      simde_mm512_set_epi8(INT8_C( -62), INT8_C( -45), INT8_C(  48), INT8_C( -55), INT8_C( 107), INT8_C(-100), INT8_C( -36), INT8_C( -50),
+                           INT8_C( -49), INT8_C(-127), INT8_C(  40), INT8_C( -76), INT8_C(-104), INT8_C(  89), INT8_C( -88), INT8_C(  30),
+                           INT8_C( -61), INT8_C( -21), INT8_C( -17), INT8_C(  74), INT8_C(-110), INT8_C( 122), INT8_C(-116), INT8_C( -57),
+                           INT8_C(  79), INT8_C(  59), INT8_C( -17), INT8_C(-108), INT8_C(  47), INT8_C(  26), INT8_C(  81), INT8_C(  37),
+                           INT8_C( -38), INT8_C(   3), INT8_C( -16), INT8_C( -55), INT8_C(-125), INT8_C( -29), INT8_C(  43), INT8_C( -14),
+                           INT8_C(   1), INT8_C( 123), INT8_C(  81), INT8_C(  13), INT8_C( -32), INT8_C(-128), INT8_C( 122), INT8_C( -57),
+                           INT8_C( -56), INT8_C( -71), INT8_C( -16), INT8_C( 111), INT8_C(  26), INT8_C( -61), INT8_C(   9), INT8_C( -44),
+                           INT8_C(  41), INT8_C(  33), INT8_C(  39), INT8_C(-117), INT8_C(  45), INT8_C( -78), INT8_C( -15), INT8_C(  -9)),
+      simde_mm512_set_epi8(INT8_C( 123), INT8_C(  39), INT8_C(  17), INT8_C( -41), INT8_C( -40), INT8_C( -34), INT8_C( -79), INT8_C(  48),
+                           INT8_C( 116), INT8_C( -74), INT8_C(  61), INT8_C(  19), INT8_C(-119), INT8_C(  10), INT8_C( -80), INT8_C(  80),
+                           INT8_C(  70), INT8_C(-121), INT8_C( 127), INT8_C( 114), INT8_C(  26), INT8_C( 100), INT8_C( 119), INT8_C(  62),
+                           INT8_C(  20), INT8_C( -53), INT8_C( -32), INT8_C( -58), INT8_C(-113), INT8_C(  49), INT8_C( -46), INT8_C(  26),
+                           INT8_C(-111), INT8_C(  71), INT8_C(  71), INT8_C(  45), INT8_C( -96), INT8_C(  54), INT8_C( -18), INT8_C(  70),
+                           INT8_C(  88), INT8_C( 109), INT8_C( -94), INT8_C(  18), INT8_C(  28), INT8_C(  74), INT8_C( -77), INT8_C(  32),
+                           INT8_C( 110), INT8_C( -52), INT8_C( -38), INT8_C(  36), INT8_C( -27), INT8_C( 116), INT8_C(  93), INT8_C(  26),
+                           INT8_C( -74), INT8_C(-128), INT8_C(-126), INT8_C(  75), INT8_C( -88), INT8_C(  11), INT8_C(  22), INT8_C(  -9)),
+      simde_mm512_set_epi8(INT8_C(  11), INT8_C(  28), INT8_C( -55), INT8_C(  93), INT8_C(  26), INT8_C( -27), INT8_C(  45), INT8_C( -52),
+                           INT8_C( 110), INT8_C(-128), INT8_C( -96), INT8_C( 114), INT8_C( 104), INT8_C( -18), INT8_C( -96), INT8_C( -86),
+                           INT8_C( -88), INT8_C(  26), INT8_C(  70), INT8_C( 116), INT8_C( -13), INT8_C( -34), INT8_C( -75), INT8_C( -74),
+                           INT8_C( 110), INT8_C( 106), INT8_C(  70), INT8_C( 104), INT8_C( 118), INT8_C(  63), INT8_C( -77), INT8_C( -41),
+                           INT8_C(  54), INT8_C(  57), INT8_C(  80), INT8_C(  93), INT8_C(  57), INT8_C(-113), INT8_C( -23), INT8_C(  10),
+                           INT8_C(-128), INT8_C( -40), INT8_C( -77), INT8_C(  54), INT8_C(  26), INT8_C( -99), INT8_C( -34), INT8_C( -74),
+                           INT8_C(  26), INT8_C( -67), INT8_C(  80), INT8_C(  70), INT8_C(  63), INT8_C( -88), INT8_C( -72), INT8_C(  18),
+                           INT8_C(  52), INT8_C( -54), INT8_C( -15), INT8_C(  61), INT8_C( -18), INT8_C(  86), INT8_C( -80), INT8_C( 116)) },
+    { simde_mm512_set_epi8(INT8_C( -61), INT8_C( -48), INT8_C( -92), INT8_C(  53), INT8_C(  12), INT8_C( 125), INT8_C( -89), INT8_C( -58),
+                           INT8_C(-122), INT8_C( -72), INT8_C(  30), INT8_C( 118), INT8_C(-127), INT8_C( -30), INT8_C( -67), INT8_C(  -3),
+                           INT8_C(  71), INT8_C(-112), INT8_C( -88), INT8_C(  19), INT8_C(  62), INT8_C(  91), INT8_C( -90), INT8_C( -80),
+                           INT8_C(-122), INT8_C(-118), INT8_C( -29), INT8_C(  59), INT8_C( -77), INT8_C( -86), INT8_C( -22), INT8_C( 100),
+                           INT8_C(  44), INT8_C(  63), INT8_C(-121), INT8_C(-127), INT8_C( -88), INT8_C( -41), INT8_C( -56), INT8_C( -75),
+                           INT8_C(  86), INT8_C( -92), INT8_C(-105), INT8_C(  63), INT8_C(  41), INT8_C(   9), INT8_C( 101), INT8_C(  -2),
+                           INT8_C(-126), INT8_C(-125), INT8_C(-125), INT8_C(  72), INT8_C(  36), INT8_C(-109), INT8_C(-106), INT8_C(  82),
+                           INT8_C(  58), INT8_C(  28), INT8_C(  -4), INT8_C( -45), INT8_C(  22), INT8_C(  65), INT8_C(  64), INT8_C(  82)),
+      simde_mm512_set_epi8(INT8_C(  11), INT8_C( -84), INT8_C(  57), INT8_C(  10), INT8_C(  91), INT8_C( -26), INT8_C(  55), INT8_C( -93),
+                           INT8_C(-102), INT8_C( -15), INT8_C(-124), INT8_C( -24), INT8_C( 109), INT8_C(-121), INT8_C(  65), INT8_C(  97),
+                           INT8_C(  38), INT8_C(  48), INT8_C(  66), INT8_C( -58), INT8_C(  77), INT8_C(-110), INT8_C(  86), INT8_C( -52),
+                           INT8_C(   9), INT8_C( -79), INT8_C(  83), INT8_C(  27), INT8_C( -84), INT8_C(  35), INT8_C(-100), INT8_C( -75),
+                           INT8_C(  18), INT8_C( 127), INT8_C(  73), INT8_C(  76), INT8_C( -21), INT8_C(  97), INT8_C(  -4), INT8_C(  13),
+                           INT8_C( 121), INT8_C( 101), INT8_C( -81), INT8_C( -81), INT8_C(   4), INT8_C(  82), INT8_C( -20), INT8_C( -44),
+                           INT8_C(-125), INT8_C(  30), INT8_C(-109), INT8_C(  99), INT8_C(  22), INT8_C( -43), INT8_C( -61), INT8_C(-109),
+                           INT8_C(-123), INT8_C(-101), INT8_C(  50), INT8_C(  89), INT8_C(  23), INT8_C( -26), INT8_C( 109), INT8_C(   9)),
+      simde_mm512_set_epi8(INT8_C( -54), INT8_C( -91), INT8_C( -23), INT8_C( -85), INT8_C( -60), INT8_C(-118), INT8_C(-113), INT8_C( 109),
+                           INT8_C(  90), INT8_C(  81), INT8_C(  80), INT8_C(  13), INT8_C( 103), INT8_C( -14), INT8_C( -34), INT8_C( -48),
+                           INT8_C(  98), INT8_C(  95), INT8_C(-125), INT8_C( -39), INT8_C( 113), INT8_C(  82), INT8_C( 107), INT8_C( -57),
+                           INT8_C( 105), INT8_C(  92), INT8_C( -79), INT8_C( -11), INT8_C( -36), INT8_C(   4), INT8_C(-126), INT8_C(   3),
+                           INT8_C(  56), INT8_C( -30), INT8_C(-108), INT8_C(  90), INT8_C(  48), INT8_C( 114), INT8_C(   4), INT8_C(-118),
+                           INT8_C(  34), INT8_C(  22), INT8_C( -79), INT8_C(-128), INT8_C( -46), INT8_C(  11), INT8_C(  64), INT8_C( -53),
+                           INT8_C(  90), INT8_C(  82), INT8_C( -87), INT8_C( 114), INT8_C(  48), INT8_C( -75), INT8_C(  80), INT8_C( -22),
+                           INT8_C(  92), INT8_C( -80), INT8_C(-120), INT8_C( -62), INT8_C(-106), INT8_C(  48), INT8_C( 115), INT8_C(  12)),
+      simde_mm512_set_epi8(INT8_C(  36), INT8_C(  19), INT8_C( -89), INT8_C(-109), INT8_C(  48), INT8_C(  92), INT8_C(-122), INT8_C( -77),
+                           INT8_C( -41), INT8_C( -34), INT8_C( -45), INT8_C( -57), INT8_C(-125), INT8_C(  58), INT8_C( 115), INT8_C(-126),
+                           INT8_C(-118), INT8_C(  -3), INT8_C(  48), INT8_C( -80), INT8_C( -87), INT8_C(   9), INT8_C(  22), INT8_C( 114),
+                           INT8_C(-106), INT8_C( -67), INT8_C( -46), INT8_C( -88), INT8_C(  19), INT8_C( -77), INT8_C(-127), INT8_C(  30),
+                           INT8_C(   9), INT8_C( -54), INT8_C(  80), INT8_C( 114), INT8_C( 113), INT8_C(-126), INT8_C( -85), INT8_C(-125),
+                           INT8_C(-113), INT8_C( -79), INT8_C(  71), INT8_C(  71), INT8_C( -45), INT8_C(  11), INT8_C( -39), INT8_C(-128),
+                           INT8_C(  22), INT8_C(  63), INT8_C(  41), INT8_C( -36), INT8_C( -92), INT8_C( -79), INT8_C(-106), INT8_C(  41),
+                           INT8_C(  -4), INT8_C( -88), INT8_C( -30), INT8_C(   4), INT8_C(  86), INT8_C(  92), INT8_C(-125), INT8_C(-106)) },
+    { simde_mm512_set_epi8(INT8_C(  76), INT8_C(  66), INT8_C(  33), INT8_C(   5), INT8_C( -62), INT8_C( -81), INT8_C(-120), INT8_C(  52),
+                           INT8_C(   0), INT8_C(  10), INT8_C(  46), INT8_C( -80), INT8_C(-110), INT8_C(  29), INT8_C(  53), INT8_C( -97),
+                           INT8_C( 107), INT8_C(  46), INT8_C( -99), INT8_C( -61), INT8_C( 102), INT8_C( -67), INT8_C( -79), INT8_C(  -4),
+                           INT8_C(-115), INT8_C(  78), INT8_C(  67), INT8_C( -43), INT8_C( -21), INT8_C(   4), INT8_C(  36), INT8_C( -11),
+                           INT8_C(  91), INT8_C( -26), INT8_C( -35), INT8_C( -37), INT8_C(   5), INT8_C(  66), INT8_C(   9), INT8_C(  39),
+                           INT8_C( -63), INT8_C( -69), INT8_C( -27), INT8_C(   9), INT8_C(  26), INT8_C(  52), INT8_C(-111), INT8_C(  69),
+                           INT8_C(-119), INT8_C(  51), INT8_C(  13), INT8_C(-116), INT8_C( -26), INT8_C( -45), INT8_C(-102), INT8_C(  49),
+                           INT8_C(  23), INT8_C(  78), INT8_C( 112), INT8_C(-125), INT8_C(  34), INT8_C(  43), INT8_C( -31), INT8_C(  51)),
+      simde_mm512_set_epi8(INT8_C(  57), INT8_C( -28), INT8_C(  85), INT8_C(-109), INT8_C(  95), INT8_C( -58), INT8_C(  44), INT8_C( -67),
+                           INT8_C( -75), INT8_C(-103), INT8_C( -27), INT8_C( -49), INT8_C( -24), INT8_C( -86), INT8_C( -37), INT8_C(-118),
+                           INT8_C( 127), INT8_C( -21), INT8_C(  -8), INT8_C( -70), INT8_C( -38), INT8_C( 123), INT8_C( 117), INT8_C(  96),
+                           INT8_C( -57), INT8_C( -68), INT8_C(  90), INT8_C( -80), INT8_C( -65), INT8_C(  49), INT8_C(  21), INT8_C(-117),
+                           INT8_C( -38), INT8_C( -49), INT8_C( -58), INT8_C(  85), INT8_C( -14), INT8_C( -37), INT8_C( -33), INT8_C( 117),
+                           INT8_C( -88), INT8_C( -66), INT8_C( 118), INT8_C(-113), INT8_C( -67), INT8_C( -36), INT8_C( -51), INT8_C(  47),
+                           INT8_C(   3), INT8_C(-106), INT8_C( -52), INT8_C(  70), INT8_C(  78), INT8_C(  59), INT8_C(  95), INT8_C(-112),
+                           INT8_C( -80), INT8_C( -73), INT8_C( 123), INT8_C(  -2), INT8_C(  39), INT8_C(-122), INT8_C(  90), INT8_C(  36)),
+      simde_mm512_set_epi8(INT8_C( -74), INT8_C(-117), INT8_C(  18), INT8_C(   3), INT8_C(  25), INT8_C( -51), INT8_C(  52), INT8_C(-101),
+                           INT8_C(  -5), INT8_C(   5), INT8_C(  86), INT8_C(  57), INT8_C(   9), INT8_C(  18), INT8_C( 123), INT8_C(  45),
+                           INT8_C(-109), INT8_C( 113), INT8_C( -61), INT8_C(-117), INT8_C(  83), INT8_C(-118), INT8_C( -58), INT8_C( -96),
+                           INT8_C(  30), INT8_C( -85), INT8_C(-119), INT8_C( -58), INT8_C(-117), INT8_C(  72), INT8_C(  84), INT8_C(   8),
+                           INT8_C( -38), INT8_C(  58), INT8_C( -37), INT8_C(  -4), INT8_C( -16), INT8_C(   9), INT8_C(  71), INT8_C(   6),
+                           INT8_C( -91), INT8_C(  89), INT8_C(-115), INT8_C(  50), INT8_C( -85), INT8_C( -94), INT8_C( -62), INT8_C(   2),
+                           INT8_C(  20), INT8_C(  48), INT8_C( -84), INT8_C( -95), INT8_C( -65), INT8_C(  64), INT8_C(  28), INT8_C(  -5),
+                           INT8_C(-106), INT8_C(  30), INT8_C(   8), INT8_C( -35), INT8_C(  18), INT8_C(  45), INT8_C(  47), INT8_C( -92)),
+      simde_mm512_set_epi8(INT8_C(-120), INT8_C( -58), INT8_C(-115), INT8_C(  26), INT8_C( -38), INT8_C(  30), INT8_C( -61), INT8_C(  33),
+                           INT8_C(  46), INT8_C(   9), INT8_C(-119), INT8_C(  20), INT8_C( -96), INT8_C( -67), INT8_C( -16), INT8_C( -45),
+                           INT8_C( -74), INT8_C(  83), INT8_C(-101), INT8_C( -81), INT8_C(   9), INT8_C(  25), INT8_C(  86), INT8_C(   8),
+                           INT8_C(-106), INT8_C(   5), INT8_C(   9), INT8_C( -97), INT8_C(  76), INT8_C(  53), INT8_C( -27), INT8_C( -26),
+                           INT8_C(   9), INT8_C(  20), INT8_C(  30), INT8_C(-115), INT8_C(  18), INT8_C( -16), INT8_C( -38), INT8_C(  86),
+                           INT8_C(  -4), INT8_C(  66), INT8_C(   5), INT8_C(-119), INT8_C(  33), INT8_C(  -4), INT8_C( -84), INT8_C( 107),
+                           INT8_C(  34), INT8_C( -69), INT8_C( -95), INT8_C(  30), INT8_C(  48), INT8_C( -62), INT8_C( -38), INT8_C(  69),
+                           INT8_C( -97), INT8_C(   0), INT8_C(  25), INT8_C(-117), INT8_C(-115), INT8_C(  78), INT8_C(   9), INT8_C( -43)) },
+    { simde_mm512_set_epi8(INT8_C( 119), INT8_C( 102), INT8_C( -19), INT8_C( 110), INT8_C(  10), INT8_C( -38), INT8_C(  12), INT8_C(-110),
+                           INT8_C(  57), INT8_C(   6), INT8_C( -44), INT8_C(  24), INT8_C( -88), INT8_C(  68), INT8_C( -34), INT8_C( -17),
+                           INT8_C(-114), INT8_C(  98), INT8_C(  69), INT8_C(-104), INT8_C( -64), INT8_C( 119), INT8_C( -52), INT8_C( -10),
+                           INT8_C( -95), INT8_C(  78), INT8_C(  21), INT8_C( -88), INT8_C( -88), INT8_C(  53), INT8_C( 109), INT8_C(  44),
+                           INT8_C( -95), INT8_C( 119), INT8_C(  18), INT8_C( -35), INT8_C( -41), INT8_C(  -1), INT8_C(  15), INT8_C( -13),
+                           INT8_C(   0), INT8_C( 101), INT8_C(  44), INT8_C(  51), INT8_C(  66), INT8_C( -94), INT8_C(  37), INT8_C( -72),
+                           INT8_C(  84), INT8_C( -87), INT8_C(  88), INT8_C( -24), INT8_C( 126), INT8_C(-120), INT8_C(  45), INT8_C(  98),
+                           INT8_C(  26), INT8_C( -45), INT8_C( 115), INT8_C(-103), INT8_C(  26), INT8_C(  68), INT8_C( -24), INT8_C(  50)),
+      simde_mm512_set_epi8(INT8_C( 108), INT8_C( -16), INT8_C(-117), INT8_C( -89), INT8_C(   9), INT8_C( -54), INT8_C(  12), INT8_C(  34),
+                           INT8_C( -12), INT8_C(  22), INT8_C(  79), INT8_C(  88), INT8_C( -22), INT8_C(  62), INT8_C(  47), INT8_C( 124),
+                           INT8_C(-118), INT8_C( 113), INT8_C(-107), INT8_C(  -7), INT8_C( 114), INT8_C( -44), INT8_C(  15), INT8_C( -93),
+                           INT8_C( 118), INT8_C( 123), INT8_C(  12), INT8_C(  -4), INT8_C(  89), INT8_C( 116), INT8_C(-117), INT8_C( -76),
+                           INT8_C(  49), INT8_C( -77), INT8_C(  55), INT8_C(  96), INT8_C( -49), INT8_C( -59), INT8_C(-119), INT8_C(  38),
+                           INT8_C(-104), INT8_C(  53), INT8_C(-119), INT8_C(-104), INT8_C(  71), INT8_C(  75), INT8_C( -59), INT8_C( -19),
+                           INT8_C( 110), INT8_C(-122), INT8_C( -75), INT8_C( -90), INT8_C(  15), INT8_C( -85), INT8_C(  47), INT8_C( 115),
+                           INT8_C( -33), INT8_C(  68), INT8_C(  -7), INT8_C( -48), INT8_C(-103), INT8_C( -56), INT8_C( -36), INT8_C(  11)),
+      simde_mm512_set_epi8(INT8_C(  88), INT8_C(  44), INT8_C( 119), INT8_C(  41), INT8_C( -16), INT8_C(  52), INT8_C( -94), INT8_C(  61),
+                           INT8_C(  96), INT8_C(  40), INT8_C(  61), INT8_C(  17), INT8_C( -75), INT8_C(-110), INT8_C(  49), INT8_C( -34),
+                           INT8_C( -44), INT8_C(-108), INT8_C( -75), INT8_C(  26), INT8_C(  93), INT8_C(  87), INT8_C(  80), INT8_C( -65),
+                           INT8_C( -26), INT8_C( -59), INT8_C(  66), INT8_C( -23), INT8_C(  -6), INT8_C( -45), INT8_C(  14), INT8_C(  99),
+                           INT8_C( -34), INT8_C(   9), INT8_C(  37), INT8_C( -10), INT8_C(  39), INT8_C( -66), INT8_C(  19), INT8_C(   5),
+                           INT8_C(  83), INT8_C(  30), INT8_C(   8), INT8_C( 120), INT8_C( 103), INT8_C( 122), INT8_C(  68), INT8_C(-116),
+                           INT8_C( 118), INT8_C(  68), INT8_C( 110), INT8_C( -92), INT8_C( -33), INT8_C(-108), INT8_C( -21), INT8_C(-101),
+                           INT8_C( -71), INT8_C( -23), INT8_C(-117), INT8_C( -10), INT8_C( -43), INT8_C( -86), INT8_C( -48), INT8_C( -70)),
+      simde_mm512_set_epi8(INT8_C(  26), INT8_C( -34), INT8_C( 126), INT8_C( -95), INT8_C(  45), INT8_C(-108), INT8_C( -24), INT8_C(  53),
+                           INT8_C(  17), INT8_C( 101), INT8_C( 118), INT8_C(   5), INT8_C(  87), INT8_C( 102), INT8_C(-114), INT8_C(  41),
+                           INT8_C(-120), INT8_C(  49), INT8_C(  44), INT8_C( -94), INT8_C(-110), INT8_C( 120), INT8_C(  84), INT8_C( -88),
+                           INT8_C(  40), INT8_C( -16), INT8_C( -24), INT8_C(  41), INT8_C(  19), INT8_C(  17), INT8_C( 126), INT8_C(  24),
+                           INT8_C( -34), INT8_C( -88), INT8_C(  57), INT8_C(  99), INT8_C( 118), INT8_C(-117), INT8_C(  45), INT8_C(  78),
+                           INT8_C( -13), INT8_C( -44), INT8_C(  45), INT8_C( -13), INT8_C( -71), INT8_C( -33), INT8_C(-117), INT8_C( -75),
+                           INT8_C(-108), INT8_C( -45), INT8_C( -44), INT8_C(  78), INT8_C(  84), INT8_C( -64), INT8_C(-114), INT8_C( -75),
+                           INT8_C( -34), INT8_C( -10), INT8_C( -94), INT8_C(-116), INT8_C(  15), INT8_C(-101), INT8_C( -10), INT8_C( 126)) },
+    { simde_mm512_set_epi8(INT8_C( -20), INT8_C(  93), INT8_C(  69), INT8_C(  12), INT8_C(  92), INT8_C(  21), INT8_C(  29), INT8_C(  59),
+                           INT8_C(  37), INT8_C(  22), INT8_C( -39), INT8_C(  25), INT8_C( -40), INT8_C( -67), INT8_C(  17), INT8_C(  89),
+                           INT8_C(-124), INT8_C(  79), INT8_C( -35), INT8_C(  73), INT8_C( -20), INT8_C( 124), INT8_C( -44), INT8_C( -16),
+                           INT8_C(  20), INT8_C(  57), INT8_C( -26), INT8_C(  58), INT8_C( 104), INT8_C( -29), INT8_C(  11), INT8_C( 102),
+                           INT8_C(  83), INT8_C(   3), INT8_C( -99), INT8_C( -97), INT8_C(  56), INT8_C( 115), INT8_C(  39), INT8_C(  40),
+                           INT8_C(  -3), INT8_C( -78), INT8_C(  99), INT8_C(   5), INT8_C( -69), INT8_C( -95), INT8_C( 117), INT8_C(  66),
+                           INT8_C(  74), INT8_C(  73), INT8_C( -84), INT8_C( -42), INT8_C(  90), INT8_C( -80), INT8_C(  89), INT8_C( -79),
+                           INT8_C(  96), INT8_C(  30), INT8_C( -82), INT8_C( -54), INT8_C( -14), INT8_C( -55), INT8_C( -28), INT8_C(  57)),
+      simde_mm512_set_epi8(INT8_C(  26), INT8_C( -10), INT8_C( 102), INT8_C(  99), INT8_C( 114), INT8_C(  -5), INT8_C(  -3), INT8_C(-115),
+                           INT8_C( -58), INT8_C(-119), INT8_C( -74), INT8_C( -13), INT8_C( 103), INT8_C(  62), INT8_C(  60), INT8_C( -12),
+                           INT8_C(  67), INT8_C(  -4), INT8_C(-109), INT8_C(  65), INT8_C(-118), INT8_C( -43), INT8_C(  18), INT8_C(-111),
+                           INT8_C( -12), INT8_C(  -7), INT8_C( 127), INT8_C( 100), INT8_C( -64), INT8_C(  45), INT8_C( 104), INT8_C(   1),
+                           INT8_C( -85), INT8_C( -41), INT8_C(  14), INT8_C( 115), INT8_C(  28), INT8_C(-106), INT8_C( 120), INT8_C( -16),
+                           INT8_C(-110), INT8_C( -44), INT8_C(-127), INT8_C( -52), INT8_C( 122), INT8_C( 116), INT8_C(-106), INT8_C( -99),
+                           INT8_C( 104), INT8_C(-115), INT8_C(  43), INT8_C(   6), INT8_C(  -3), INT8_C( -10), INT8_C( -41), INT8_C( -78),
+                           INT8_C(  42), INT8_C(  82), INT8_C( -13), INT8_C(-119), INT8_C( -47), INT8_C( -49), INT8_C(  25), INT8_C( -63)),
+      simde_mm512_set_epi8(INT8_C( 109), INT8_C( -12), INT8_C(-128), INT8_C( -94), INT8_C(  10), INT8_C( -63), INT8_C(  -1), INT8_C( -10),
+                           INT8_C( 125), INT8_C( -18), INT8_C(  36), INT8_C( -35), INT8_C(  41), INT8_C(  57), INT8_C(  64), INT8_C( -73),
+                           INT8_C(  77), INT8_C( 102), INT8_C( -54), INT8_C(  63), INT8_C( -31), INT8_C(   3), INT8_C( -77), INT8_C( -48),
+                           INT8_C( -28), INT8_C( 113), INT8_C(  51), INT8_C(  22), INT8_C( -99), INT8_C( 123), INT8_C(  65), INT8_C(-109),
+                           INT8_C(  49), INT8_C(  86), INT8_C(  92), INT8_C(  87), INT8_C(  84), INT8_C( -74), INT8_C(  78), INT8_C(-114),
+                           INT8_C( 114), INT8_C( -66), INT8_C( -27), INT8_C(-103), INT8_C(-119), INT8_C(-104), INT8_C( -88), INT8_C(  94),
+                           INT8_C( -44), INT8_C(-104), INT8_C(  65), INT8_C( -14), INT8_C( -48), INT8_C( -82), INT8_C(  61), INT8_C(  36),
+                           INT8_C(  47), INT8_C( -50), INT8_C(-106), INT8_C(-115), INT8_C( -25), INT8_C(  60), INT8_C( -55), INT8_C(  54)),
+      simde_mm512_set_epi8(INT8_C( 115), INT8_C( -18), INT8_C( 113), INT8_C( -99), INT8_C(  57), INT8_C(  10), INT8_C(-128), INT8_C( -84),
+                           INT8_C( -50), INT8_C(  89), INT8_C(  22), INT8_C(  41), INT8_C( -28), INT8_C(  93), INT8_C(  12), INT8_C( -35),
+                           INT8_C( -25), INT8_C( -94), INT8_C( -69), INT8_C( -55), INT8_C( -80), INT8_C( -27), INT8_C( -95), INT8_C( 117),
+                           INT8_C( -35), INT8_C(  -1), INT8_C( 109), INT8_C(  22), INT8_C(  54), INT8_C( -35), INT8_C( -48), INT8_C( -28),
+                           INT8_C( -20), INT8_C( 114), INT8_C(  73), INT8_C(  41), INT8_C( -97), INT8_C( -78), INT8_C( -10), INT8_C( -73),
+                           INT8_C( -95), INT8_C(-103), INT8_C( -28), INT8_C( -14), INT8_C( -63), INT8_C( -35), INT8_C( -78), INT8_C( -99),
+                           INT8_C( -48), INT8_C( -84), INT8_C( -20), INT8_C(  30), INT8_C(-128), INT8_C( -18), INT8_C( 114), INT8_C( -67),
+                           INT8_C( 124), INT8_C(-104), INT8_C(  41), INT8_C(  89), INT8_C( -88), INT8_C( -44), INT8_C(  39), INT8_C( -55)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_permutex2var_epi8(test_vec[i].a, test_vec[i].idx, test_vec[i].b);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_permutex2var_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__mmask64 k;
+    simde__m512i idx;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C( -74), INT8_C(  71), INT8_C(  23), INT8_C( -65), INT8_C( -53), INT8_C( -44), INT8_C( 122), INT8_C(  21),
+                           INT8_C( 117), INT8_C( -80), INT8_C( -99), INT8_C( -17), INT8_C( 122), INT8_C(  72), INT8_C(  74), INT8_C(-128),
+                           INT8_C( -55), INT8_C(  33), INT8_C( -36), INT8_C(  94), INT8_C(  88), INT8_C( 120), INT8_C( -83), INT8_C(  90),
+                           INT8_C(  78), INT8_C( -15), INT8_C( -91), INT8_C(  86), INT8_C(  82), INT8_C( 123), INT8_C(  22), INT8_C( -73),
+                           INT8_C(-118), INT8_C( 115), INT8_C(-100), INT8_C(  73), INT8_C(-109), INT8_C(  77), INT8_C(  97), INT8_C(  53),
+                           INT8_C( -15), INT8_C( -16), INT8_C(  51), INT8_C(  17), INT8_C(  73), INT8_C(  19), INT8_C( -14), INT8_C( -48),
+                           INT8_C( -13), INT8_C( -10), INT8_C( -75), INT8_C(  11), INT8_C(-121), INT8_C( -74), INT8_C(-115), INT8_C(  74),
+                           INT8_C(  -4), INT8_C( -24), INT8_C(-126), INT8_C( -45), INT8_C(  66), INT8_C(  71), INT8_C(  65), INT8_C(-119)),
+      UINT64_C( 4032414565361881134),
+      simde_mm512_set_epi8(INT8_C( 123), INT8_C(  58), INT8_C( -58), INT8_C( -32), INT8_C(   2), INT8_C(  23), INT8_C( -95), INT8_C(  39),
+                           INT8_C(  76), INT8_C( 101), INT8_C( -48), INT8_C( -85), INT8_C( -67), INT8_C( -74), INT8_C(  56), INT8_C( -42),
+                           INT8_C( -60), INT8_C(-120), INT8_C( -61), INT8_C(  90), INT8_C( 102), INT8_C( -43), INT8_C(  90), INT8_C( -93),
+                           INT8_C(  16), INT8_C(   0), INT8_C( -29), INT8_C(  74), INT8_C( -94), INT8_C( -62), INT8_C( -91), INT8_C( -24),
+                           INT8_C(  96), INT8_C(  64), INT8_C(-109), INT8_C( -34), INT8_C( -95), INT8_C( -12), INT8_C(  69), INT8_C( -93),
+                           INT8_C(  30), INT8_C( 103), INT8_C(-108), INT8_C(  84), INT8_C(  70), INT8_C( -69), INT8_C(  82), INT8_C(-122),
+                           INT8_C(-107), INT8_C(  25), INT8_C(  99), INT8_C( -49), INT8_C(-114), INT8_C(-118), INT8_C(-124), INT8_C(  14),
+                           INT8_C(  74), INT8_C(  40), INT8_C(  19), INT8_C(  39), INT8_C(  33), INT8_C(  93), INT8_C(  -9), INT8_C( -95)),
+      simde_mm512_set_epi8(INT8_C(   1), INT8_C(  26), INT8_C( -13), INT8_C( -56), INT8_C(   1), INT8_C( -45), INT8_C(  -9), INT8_C(-127),
+                           INT8_C( -66), INT8_C(  39), INT8_C(  26), INT8_C(-122), INT8_C( -37), INT8_C( 119), INT8_C(  46), INT8_C( -36),
+                           INT8_C( -77), INT8_C( -47), INT8_C(  23), INT8_C(  43), INT8_C(  70), INT8_C(  96), INT8_C( 113), INT8_C(  -1),
+                           INT8_C(   8), INT8_C(  56), INT8_C(  30), INT8_C(-116), INT8_C(-116), INT8_C(  41), INT8_C( -42), INT8_C( -46),
+                           INT8_C(-106), INT8_C( -63), INT8_C(  37), INT8_C(-100), INT8_C( -21), INT8_C( -48), INT8_C(  60), INT8_C(  42),
+                           INT8_C( -22), INT8_C(-101), INT8_C( -62), INT8_C( -78), INT8_C( -40), INT8_C( -88), INT8_C(  36), INT8_C( -93),
+                           INT8_C( -18), INT8_C( -42), INT8_C(  54), INT8_C(   7), INT8_C( -41), INT8_C(-123), INT8_C(  68), INT8_C( -86),
+                           INT8_C(  53), INT8_C(  -2), INT8_C( 108), INT8_C(-111), INT8_C(  -4), INT8_C(-107), INT8_C(  39), INT8_C( -91)),
+      simde_mm512_set_epi8(INT8_C( -74), INT8_C(  71), INT8_C(  -2), INT8_C( -46), INT8_C( -53), INT8_C( -15), INT8_C(  22), INT8_C(  78),
+                           INT8_C(   7), INT8_C(  30), INT8_C( -93), INT8_C(  88), INT8_C( 122), INT8_C( -80), INT8_C(  21), INT8_C(-128),
+                           INT8_C( -55), INT8_C(  33), INT8_C( -36), INT8_C(  94), INT8_C(  88), INT8_C( 120), INT8_C( -48), INT8_C(  82),
+                           INT8_C( -48), INT8_C( -15), INT8_C(-116), INT8_C(  86), INT8_C( 123), INT8_C(-107), INT8_C( -91), INT8_C( -73),
+                           INT8_C( -46), INT8_C( 115), INT8_C(  73), INT8_C( -63), INT8_C(  22), INT8_C(  77), INT8_C( 108), INT8_C(  82),
+                           INT8_C( 115), INT8_C( -16), INT8_C(  51), INT8_C(  17), INT8_C(  73), INT8_C(  19), INT8_C( -14), INT8_C( -24),
+                           INT8_C(  51), INT8_C( -10), INT8_C( -75), INT8_C( -18), INT8_C(-121), INT8_C( -74), INT8_C(-115), INT8_C(  74),
+                           INT8_C(  -4), INT8_C( -24), INT8_C(  73), INT8_C( -45), INT8_C(  22), INT8_C(  37), INT8_C( -66), INT8_C(-119)) },
+    { simde_mm512_set_epi8(INT8_C(  88), INT8_C(-111), INT8_C(  -5), INT8_C(  13), INT8_C(  16), INT8_C( -40), INT8_C(-117), INT8_C(  73),
+                           INT8_C( -67), INT8_C( -32), INT8_C(  89), INT8_C(  97), INT8_C( -79), INT8_C(  57), INT8_C( -45), INT8_C(  47),
+                           INT8_C(   5), INT8_C(   2), INT8_C( -72), INT8_C( -41), INT8_C(  -1), INT8_C( -67), INT8_C(  67), INT8_C( -88),
+                           INT8_C( -26), INT8_C(  51), INT8_C(-128), INT8_C(  61), INT8_C(  11), INT8_C(-105), INT8_C( 101), INT8_C( -93),
+                           INT8_C( -21), INT8_C( 104), INT8_C( 125), INT8_C( 111), INT8_C( -65), INT8_C(  43), INT8_C(  82), INT8_C(-122),
+                           INT8_C( -90), INT8_C( -26), INT8_C(  -7), INT8_C(  -8), INT8_C(  25), INT8_C( 101), INT8_C(  81), INT8_C(  36),
+                           INT8_C(  52), INT8_C(  60), INT8_C( 103), INT8_C( 114), INT8_C( 100), INT8_C(  57), INT8_C( -83), INT8_C( -65),
+                           INT8_C(  80), INT8_C(-126), INT8_C( -70), INT8_C(  89), INT8_C(-123), INT8_C(-117), INT8_C(  88), INT8_C(-114)),
+      UINT64_C( 3749628843947737638),
+      simde_mm512_set_epi8(INT8_C(   2), INT8_C(  96), INT8_C(-118), INT8_C(-114), INT8_C(-105), INT8_C( -68), INT8_C( -72), INT8_C(  52),
+                           INT8_C( -65), INT8_C( 113), INT8_C( -78), INT8_C( 100), INT8_C( 105), INT8_C( -23), INT8_C( -28), INT8_C( -67),
+                           INT8_C( -14), INT8_C( -43), INT8_C(  92), INT8_C(-119), INT8_C(  57), INT8_C( -17), INT8_C(-121), INT8_C( 115),
+                           INT8_C(  78), INT8_C(   6), INT8_C( -58), INT8_C(  83), INT8_C( 108), INT8_C( -10), INT8_C(   5), INT8_C(  57),
+                           INT8_C(  93), INT8_C(  96), INT8_C(  43), INT8_C(   1), INT8_C(   2), INT8_C( 103), INT8_C(  -8), INT8_C( -56),
+                           INT8_C(-110), INT8_C( -70), INT8_C( -68), INT8_C( 104), INT8_C(  -2), INT8_C(  10), INT8_C( -11), INT8_C( -29),
+                           INT8_C(  -4), INT8_C(  74), INT8_C(   3), INT8_C(  86), INT8_C( -88), INT8_C(  88), INT8_C(  54), INT8_C(  79),
+                           INT8_C(  20), INT8_C( 119), INT8_C( -30), INT8_C( -63), INT8_C( -67), INT8_C(-116), INT8_C( -56), INT8_C(  31)),
+      simde_mm512_set_epi8(INT8_C(  10), INT8_C( 114), INT8_C( -92), INT8_C( -86), INT8_C( -13), INT8_C( -73), INT8_C( -25), INT8_C( -87),
+                           INT8_C(  19), INT8_C( -91), INT8_C(  19), INT8_C( -77), INT8_C(  65), INT8_C(  42), INT8_C(-113), INT8_C( 119),
+                           INT8_C( -45), INT8_C( -76), INT8_C( -57), INT8_C( -97), INT8_C(  47), INT8_C(  12), INT8_C( 108), INT8_C( 111),
+                           INT8_C(-101), INT8_C( -32), INT8_C( -55), INT8_C(  51), INT8_C(  98), INT8_C(  19), INT8_C( -65), INT8_C(  81),
+                           INT8_C(  36), INT8_C( -78), INT8_C(  -8), INT8_C(  43), INT8_C(  58), INT8_C(  47), INT8_C( -40), INT8_C( -32),
+                           INT8_C( 111), INT8_C( -68), INT8_C( -88), INT8_C(-112), INT8_C( -48), INT8_C(  11), INT8_C( -59), INT8_C( -85),
+                           INT8_C(  85), INT8_C( -80), INT8_C(  55), INT8_C( -27), INT8_C(-122), INT8_C(   4), INT8_C( -69), INT8_C( -36),
+                           INT8_C( 102), INT8_C(-124), INT8_C( -33), INT8_C( -65), INT8_C( 106), INT8_C(  51), INT8_C(  76), INT8_C(  68)),
+      simde_mm512_set_epi8(INT8_C(  88), INT8_C(-111), INT8_C(  57), INT8_C(  60), INT8_C(  16), INT8_C(  13), INT8_C(-117), INT8_C(  73),
+                           INT8_C( -67), INT8_C( -32), INT8_C(  89), INT8_C(  97), INT8_C( 108), INT8_C(  57), INT8_C( -45), INT8_C(  -5),
+                           INT8_C(   5), INT8_C( -88), INT8_C( -72), INT8_C( -83), INT8_C(-117), INT8_C( -67), INT8_C(  80), INT8_C(  65),
+                           INT8_C( -80), INT8_C(  51), INT8_C(-128), INT8_C( -48), INT8_C(  11), INT8_C(-105), INT8_C( 101), INT8_C(-117),
+                           INT8_C( -21), INT8_C( 104), INT8_C(  -1), INT8_C(  88), INT8_C( -65), INT8_C(  43), INT8_C( -87), INT8_C( -36),
+                           INT8_C( -90), INT8_C( -26), INT8_C(  -7), INT8_C( 111), INT8_C(  25), INT8_C( 101), INT8_C(  81), INT8_C(  36),
+                           INT8_C(  52), INT8_C(   4), INT8_C( 103), INT8_C( 114), INT8_C( 100), INT8_C(  57), INT8_C( -32), INT8_C( -65),
+                           INT8_C(  80), INT8_C(-126), INT8_C(  19), INT8_C(  89), INT8_C(-123), INT8_C( 114), INT8_C( -36), INT8_C(-114)) },
+    { simde_mm512_set_epi8(INT8_C( 125), INT8_C(   6), INT8_C( -21), INT8_C( 122), INT8_C(  20), INT8_C(-116), INT8_C(  39), INT8_C(-122),
+                           INT8_C(  99), INT8_C( -91), INT8_C(  62), INT8_C(  -4), INT8_C( -66), INT8_C( -91), INT8_C( -87), INT8_C(-107),
+                           INT8_C(  -4), INT8_C(  18), INT8_C( -87), INT8_C(  17), INT8_C( 111), INT8_C( -38), INT8_C( -79), INT8_C(  55),
+                           INT8_C(   9), INT8_C( -84), INT8_C(-125), INT8_C( -20), INT8_C( -99), INT8_C( -95), INT8_C(  11), INT8_C(  97),
+                           INT8_C( 110), INT8_C(  58), INT8_C( 108), INT8_C(  36), INT8_C(  38), INT8_C(  -6), INT8_C( -37), INT8_C(  23),
+                           INT8_C(  75), INT8_C(  93), INT8_C(  -4), INT8_C( -87), INT8_C(   4), INT8_C( -25), INT8_C(  -2), INT8_C(  43),
+                           INT8_C(  56), INT8_C( -93), INT8_C(  70), INT8_C(  92), INT8_C( -47), INT8_C( 118), INT8_C( 111), INT8_C( -12),
+                           INT8_C(   9), INT8_C(  84), INT8_C(  49), INT8_C(  76), INT8_C(-117), INT8_C( 102), INT8_C(  43), INT8_C(  34)),
+      UINT64_C(10198742715889791805),
+      simde_mm512_set_epi8(INT8_C(  42), INT8_C(  15), INT8_C( -38), INT8_C(  62), INT8_C( 127), INT8_C( -83), INT8_C(  98), INT8_C( -10),
+                           INT8_C(-122), INT8_C(-105), INT8_C(-120), INT8_C( 112), INT8_C( -81), INT8_C( -72), INT8_C( -44), INT8_C( -97),
+                           INT8_C( -61), INT8_C( -62), INT8_C( 117), INT8_C( -88), INT8_C( -16), INT8_C(  21), INT8_C(  17), INT8_C( -68),
+                           INT8_C( -74), INT8_C(  46), INT8_C( -98), INT8_C(  20), INT8_C( -85), INT8_C(-123), INT8_C(-122), INT8_C( -15),
+                           INT8_C(  25), INT8_C( -72), INT8_C(  80), INT8_C(  55), INT8_C(  -3), INT8_C(-102), INT8_C(-107), INT8_C(  27),
+                           INT8_C(  44), INT8_C( 118), INT8_C(  86), INT8_C(  -9), INT8_C( -58), INT8_C(  43), INT8_C( -89), INT8_C(  21),
+                           INT8_C(  -5), INT8_C(  18), INT8_C( -34), INT8_C(  97), INT8_C(  43), INT8_C(  29), INT8_C(  48), INT8_C(  53),
+                           INT8_C(  84), INT8_C(  89), INT8_C( -12), INT8_C(   0), INT8_C( 123), INT8_C( -50), INT8_C(  30), INT8_C(  73)),
+      simde_mm512_set_epi8(INT8_C(  21), INT8_C(  59), INT8_C( 108), INT8_C(  -2), INT8_C(  -5), INT8_C( -68), INT8_C( 120), INT8_C( -52),
+                           INT8_C( 121), INT8_C( 100), INT8_C( -25), INT8_C( -59), INT8_C(  63), INT8_C(-102), INT8_C( -53), INT8_C(-101),
+                           INT8_C( -32), INT8_C(  63), INT8_C( -94), INT8_C(  87), INT8_C( -13), INT8_C(-104), INT8_C(-105), INT8_C( -76),
+                           INT8_C( -49), INT8_C( -56), INT8_C( -55), INT8_C( -71), INT8_C( 110), INT8_C(  58), INT8_C( 116), INT8_C(  92),
+                           INT8_C( 104), INT8_C(  17), INT8_C( 113), INT8_C( 118), INT8_C(  85), INT8_C( -30), INT8_C(  58), INT8_C(  40),
+                           INT8_C(-118), INT8_C( 124), INT8_C(  50), INT8_C(-118), INT8_C( -46), INT8_C(  75), INT8_C( -91), INT8_C( -93),
+                           INT8_C( -66), INT8_C( -71), INT8_C( -89), INT8_C(-111), INT8_C(-127), INT8_C( 123), INT8_C(  45), INT8_C(  -8),
+                           INT8_C( -37), INT8_C(  42), INT8_C(  13), INT8_C(  72), INT8_C( -49), INT8_C(  50), INT8_C(  69), INT8_C( -77)),
+      simde_mm512_set_epi8(INT8_C( -38), INT8_C(   6), INT8_C( -21), INT8_C( 122), INT8_C(  21), INT8_C( -87), INT8_C(  39), INT8_C( 100),
+                           INT8_C(  84), INT8_C( -91), INT8_C(  62), INT8_C(  -4), INT8_C(  -4), INT8_C( -91), INT8_C( -87), INT8_C( 110),
+                           INT8_C(  -4), INT8_C(  18), INT8_C( -25), INT8_C(  55), INT8_C( 111), INT8_C(  -4), INT8_C(  -2), INT8_C(  55),
+                           INT8_C(   9), INT8_C(  18), INT8_C(  58), INT8_C( -87), INT8_C( -99), INT8_C(  49), INT8_C(  84), INT8_C( -53),
+                           INT8_C( 110), INT8_C(  58), INT8_C( 108), INT8_C(  36), INT8_C(  38), INT8_C(  -6), INT8_C( -37), INT8_C(  23),
+                           INT8_C(  75), INT8_C(  93), INT8_C( 124), INT8_C( 121), INT8_C(   4), INT8_C( 111), INT8_C(   9), INT8_C(  43),
+                           INT8_C(  -5), INT8_C( -93), INT8_C(  17), INT8_C( 116), INT8_C( -47), INT8_C( 118), INT8_C(-107), INT8_C(  62),
+                           INT8_C(   9), INT8_C(  84), INT8_C( -59), INT8_C(  34), INT8_C(  -5), INT8_C( -71), INT8_C(  43), INT8_C(  45)) },
+    { simde_mm512_set_epi8(INT8_C( -90), INT8_C(  43), INT8_C( -26), INT8_C( -72), INT8_C( -51), INT8_C( -34), INT8_C(-117), INT8_C( -93),
+                           INT8_C(  96), INT8_C(-101), INT8_C(  13), INT8_C(   9), INT8_C(  86), INT8_C( 120), INT8_C(   2), INT8_C( 103),
+                           INT8_C(  63), INT8_C(  24), INT8_C( 121), INT8_C(  77), INT8_C(-107), INT8_C(  -7), INT8_C(  17), INT8_C(   5),
+                           INT8_C( -84), INT8_C( -51), INT8_C( -11), INT8_C(  49), INT8_C( -96), INT8_C( -62), INT8_C(  39), INT8_C( -54),
+                           INT8_C(  46), INT8_C( -42), INT8_C( -90), INT8_C( -92), INT8_C(  75), INT8_C(  49), INT8_C(   5), INT8_C(-127),
+                           INT8_C(-116), INT8_C(  15), INT8_C( 124), INT8_C( -45), INT8_C(-128), INT8_C(  67), INT8_C( -68), INT8_C(  -8),
+                           INT8_C(  49), INT8_C(  77), INT8_C(  24), INT8_C( 120), INT8_C( -98), INT8_C( -39), INT8_C(   0), INT8_C( -71),
+                           INT8_C(  25), INT8_C( -85), INT8_C(  50), INT8_C(  38), INT8_C(  87), INT8_C( -53), INT8_C( -79), INT8_C(  27)),
+      UINT64_C(17095366218728136529),
+      simde_mm512_set_epi8(INT8_C( -78), INT8_C( -88), INT8_C(  89), INT8_C( 119), INT8_C( -99), INT8_C(-109), INT8_C(  76), INT8_C( -56),
+                           INT8_C(  15), INT8_C(  64), INT8_C(  -7), INT8_C(  83), INT8_C( -23), INT8_C(  80), INT8_C( -11), INT8_C( -29),
+                           INT8_C( -58), INT8_C(  -7), INT8_C(-123), INT8_C(  78), INT8_C( -52), INT8_C(  74), INT8_C(  14), INT8_C(  63),
+                           INT8_C(-103), INT8_C(-104), INT8_C( -95), INT8_C( -66), INT8_C( -45), INT8_C( 125), INT8_C(  13), INT8_C( 101),
+                           INT8_C( -71), INT8_C( -30), INT8_C(  33), INT8_C(   4), INT8_C( -75), INT8_C( -40), INT8_C(  24), INT8_C(  21),
+                           INT8_C( -44), INT8_C(-103), INT8_C( -53), INT8_C(   8), INT8_C(-126), INT8_C( -11), INT8_C(  90), INT8_C( -96),
+                           INT8_C( 110), INT8_C( 127), INT8_C(-104), INT8_C( -57), INT8_C(-109), INT8_C(-122), INT8_C(  84), INT8_C(   8),
+                           INT8_C( -42), INT8_C( -77), INT8_C(  51), INT8_C( -38), INT8_C( 102), INT8_C( 123), INT8_C( -66), INT8_C( 116)),
+      simde_mm512_set_epi8(INT8_C(  41), INT8_C(  16), INT8_C( 119), INT8_C(  83), INT8_C(  49), INT8_C( -93), INT8_C( -88), INT8_C(  65),
+                           INT8_C(  -5), INT8_C(  45), INT8_C( -60), INT8_C( -48), INT8_C( -13), INT8_C( -82), INT8_C( -58), INT8_C( -52),
+                           INT8_C(  43), INT8_C(  69), INT8_C(   0), INT8_C(  37), INT8_C( -33), INT8_C( 121), INT8_C( -92), INT8_C( -59),
+                           INT8_C(  22), INT8_C(-125), INT8_C(  53), INT8_C(  26), INT8_C( -64), INT8_C(  19), INT8_C(  61), INT8_C( 127),
+                           INT8_C( -31), INT8_C(  83), INT8_C( -69), INT8_C( -19), INT8_C(  56), INT8_C( -93), INT8_C(-122), INT8_C( -14),
+                           INT8_C( -86), INT8_C( -33), INT8_C(  78), INT8_C( 117), INT8_C( -25), INT8_C(-106), INT8_C( -27), INT8_C(  56),
+                           INT8_C( -96), INT8_C(  25), INT8_C(   5), INT8_C( -70), INT8_C( 100), INT8_C(-128), INT8_C( -20), INT8_C( -95),
+                           INT8_C(  -9), INT8_C( -43), INT8_C(  88), INT8_C(  84), INT8_C( -49), INT8_C(  64), INT8_C(  88), INT8_C(  81)),
+      simde_mm512_set_epi8(INT8_C( 120), INT8_C(   5), INT8_C(-122), INT8_C( -72), INT8_C( -90), INT8_C(-128), INT8_C(-117), INT8_C( -95),
+                           INT8_C(  96), INT8_C(-101), INT8_C( -88), INT8_C( -25), INT8_C( -92), INT8_C(  56), INT8_C( -60), INT8_C( 103),
+                           INT8_C( -43), INT8_C( -88), INT8_C(  50), INT8_C(  25), INT8_C(-107), INT8_C(  -7), INT8_C(  17), INT8_C( -90),
+                           INT8_C( -84), INT8_C( -51), INT8_C( -11), INT8_C(  49), INT8_C( -96), INT8_C( -62), INT8_C(  39), INT8_C( -54),
+                           INT8_C(  46), INT8_C( -42), INT8_C(  39), INT8_C(  38), INT8_C(  75), INT8_C( -14), INT8_C(   5), INT8_C(-127),
+                           INT8_C( 117), INT8_C(  15), INT8_C( 124), INT8_C( -45), INT8_C(-128), INT8_C(  67), INT8_C( -68), INT8_C(  -8),
+                           INT8_C(  69), INT8_C(  41), INT8_C(  24), INT8_C(  -9), INT8_C(-128), INT8_C( -85), INT8_C( 117), INT8_C( -71),
+                           INT8_C(  25), INT8_C(  86), INT8_C(  50), INT8_C( -93), INT8_C(  87), INT8_C( -53), INT8_C( -79), INT8_C( -48)) },
+    { simde_mm512_set_epi8(INT8_C(  24), INT8_C(  49), INT8_C(  41), INT8_C(  97), INT8_C(  83), INT8_C(-106), INT8_C( -48), INT8_C(  86),
+                           INT8_C( -21), INT8_C( -21), INT8_C( 103), INT8_C( -20), INT8_C(  41), INT8_C( -21), INT8_C( -61), INT8_C(-111),
+                           INT8_C( 105), INT8_C( -49), INT8_C( -65), INT8_C(  62), INT8_C( -84), INT8_C( -94), INT8_C( -68), INT8_C( -24),
+                           INT8_C( -85), INT8_C(  31), INT8_C(  79), INT8_C(  21), INT8_C(   8), INT8_C(-106), INT8_C(-110), INT8_C(-115),
+                           INT8_C(  29), INT8_C(-100), INT8_C(  -4), INT8_C(  -1), INT8_C( 118), INT8_C( -72), INT8_C(  94), INT8_C( 113),
+                           INT8_C(-126), INT8_C(  26), INT8_C( 116), INT8_C(  65), INT8_C( -60), INT8_C( -99), INT8_C(  80), INT8_C( -48),
+                           INT8_C(  19), INT8_C( -73), INT8_C(  97), INT8_C(  39), INT8_C( -63), INT8_C( 117), INT8_C( -75), INT8_C(  58),
+                           INT8_C( -89), INT8_C(-122), INT8_C( -44), INT8_C(  23), INT8_C(  90), INT8_C( 106), INT8_C(  42), INT8_C( -81)),
+      UINT64_C(12170546424439035205),
+      simde_mm512_set_epi8(INT8_C(  90), INT8_C( 106), INT8_C( 100), INT8_C( 108), INT8_C( -76), INT8_C(  56), INT8_C( -23), INT8_C(  49),
+                           INT8_C(  65), INT8_C( -78), INT8_C(  83), INT8_C( -21), INT8_C(  42), INT8_C(  -7), INT8_C(  37), INT8_C(  -6),
+                           INT8_C( -89), INT8_C( -98), INT8_C(  40), INT8_C(  92), INT8_C(-106), INT8_C( -57), INT8_C(  -8), INT8_C( -53),
+                           INT8_C( 127), INT8_C(-112), INT8_C( -87), INT8_C(  41), INT8_C(  38), INT8_C( 108), INT8_C(  67), INT8_C(  13),
+                           INT8_C(  84), INT8_C(  -9), INT8_C( -51), INT8_C( -75), INT8_C(  53), INT8_C(  53), INT8_C(-110), INT8_C( 105),
+                           INT8_C(  82), INT8_C( 126), INT8_C( -37), INT8_C( 120), INT8_C( -76), INT8_C( -53), INT8_C(  52), INT8_C(  65),
+                           INT8_C( -63), INT8_C( -86), INT8_C( -87), INT8_C(  70), INT8_C( 115), INT8_C(  23), INT8_C(  51), INT8_C( -90),
+                           INT8_C(  79), INT8_C(  76), INT8_C( 100), INT8_C(  11), INT8_C(  -2), INT8_C(  99), INT8_C(  40), INT8_C( 118)),
+      simde_mm512_set_epi8(INT8_C( -96), INT8_C(  65), INT8_C(-120), INT8_C( 104), INT8_C( 105), INT8_C(  54), INT8_C(  15), INT8_C( -38),
+                           INT8_C(  51), INT8_C(  34), INT8_C( -53), INT8_C( 121), INT8_C( -81), INT8_C(  71), INT8_C( -37), INT8_C( 108),
+                           INT8_C(  51), INT8_C(-113), INT8_C(-115), INT8_C(  41), INT8_C(   1), INT8_C( -87), INT8_C(   3), INT8_C( -85),
+                           INT8_C(  65), INT8_C(-101), INT8_C( -98), INT8_C( -12), INT8_C( -95), INT8_C( -79), INT8_C(  18), INT8_C(  79),
+                           INT8_C(-114), INT8_C(  39), INT8_C(  49), INT8_C( -52), INT8_C( -63), INT8_C( -83), INT8_C( -77), INT8_C( 105),
+                           INT8_C( 124), INT8_C(-128), INT8_C(  97), INT8_C(  10), INT8_C( -30), INT8_C(  30), INT8_C( -72), INT8_C(  89),
+                           INT8_C(  67), INT8_C( -83), INT8_C( -77), INT8_C(  11), INT8_C( 119), INT8_C(  25), INT8_C( -87), INT8_C(-118),
+                           INT8_C( 108), INT8_C( -42), INT8_C( -63), INT8_C(-105), INT8_C(-105), INT8_C(  10), INT8_C( -12), INT8_C( -93)),
+      simde_mm512_set_epi8(INT8_C( -83), INT8_C(  49), INT8_C( -12), INT8_C(  97), INT8_C( -20), INT8_C(-106), INT8_C( -48), INT8_C(  86),
+                           INT8_C( -12), INT8_C( -21), INT8_C( -30), INT8_C( -20), INT8_C(  41), INT8_C(  15), INT8_C(  79), INT8_C(-111),
+                           INT8_C( 105), INT8_C(-100), INT8_C( -24), INT8_C( -52), INT8_C( -84), INT8_C( 108), INT8_C( -38), INT8_C( 119),
+                           INT8_C( -85), INT8_C( -48), INT8_C( -68), INT8_C( -68), INT8_C(  31), INT8_C(  41), INT8_C(-110), INT8_C(  97),
+                           INT8_C(  10), INT8_C(-100), INT8_C(  -4), INT8_C( 103), INT8_C( 103), INT8_C( 103), INT8_C( -99), INT8_C(   3),
+                           INT8_C(-126), INT8_C(  26), INT8_C( 116), INT8_C( -38), INT8_C( -60), INT8_C( 119), INT8_C( -20), INT8_C( -48),
+                           INT8_C( -12), INT8_C( -94), INT8_C(  97), INT8_C( -42), INT8_C( -63), INT8_C(-126), INT8_C( -75), INT8_C(  31),
+                           INT8_C( -89), INT8_C(  11), INT8_C( -44), INT8_C(  23), INT8_C(  90), INT8_C( -95), INT8_C(  42), INT8_C(  34)) },
+    { simde_mm512_set_epi8(INT8_C(-118), INT8_C( 116), INT8_C( -36), INT8_C( 120), INT8_C(  44), INT8_C(  37), INT8_C(  23), INT8_C(  19),
+                           INT8_C( -88), INT8_C( 100), INT8_C(-108), INT8_C( -51), INT8_C( -73), INT8_C( -66), INT8_C(  10), INT8_C(-122),
+                           INT8_C( -15), INT8_C(  15), INT8_C( -47), INT8_C( 114), INT8_C(  31), INT8_C( -11), INT8_C(  33), INT8_C(-123),
+                           INT8_C(  25), INT8_C(-119), INT8_C( -50), INT8_C( -16), INT8_C(  79), INT8_C(-112), INT8_C( -66), INT8_C(  -8),
+                           INT8_C(  -2), INT8_C(  69), INT8_C(-103), INT8_C( -90), INT8_C(-120), INT8_C(  55), INT8_C( -43), INT8_C(-109),
+                           INT8_C( 101), INT8_C(  41), INT8_C(  39), INT8_C(  43), INT8_C(   1), INT8_C(   1), INT8_C( -93), INT8_C( -44),
+                           INT8_C( -81), INT8_C(  76), INT8_C(  -9), INT8_C( -79), INT8_C(  67), INT8_C( -76), INT8_C(  84), INT8_C( 124),
+                           INT8_C( -56), INT8_C( -23), INT8_C(  33), INT8_C( 124), INT8_C( 104), INT8_C( 107), INT8_C(   9), INT8_C( -81)),
+      UINT64_C(12007617459284741845),
+      simde_mm512_set_epi8(INT8_C( -91), INT8_C(  57), INT8_C( -56), INT8_C( -82), INT8_C(  10), INT8_C(-125), INT8_C( -49), INT8_C( 104),
+                           INT8_C(  78), INT8_C(-119), INT8_C(  91), INT8_C(  67), INT8_C( -56), INT8_C( 118), INT8_C(  49), INT8_C( -53),
+                           INT8_C( 112), INT8_C( -15), INT8_C(  62), INT8_C(-117), INT8_C(-108), INT8_C(-128), INT8_C(  66), INT8_C( -50),
+                           INT8_C( -59), INT8_C(   4), INT8_C(  96), INT8_C(  11), INT8_C( -76), INT8_C( -84), INT8_C( -49), INT8_C(  80),
+                           INT8_C( -83), INT8_C(  48), INT8_C(  10), INT8_C(  70), INT8_C( 126), INT8_C(  -5), INT8_C(  54), INT8_C(  60),
+                           INT8_C( 122), INT8_C( -68), INT8_C(  71), INT8_C(  70), INT8_C(   8), INT8_C(  84), INT8_C(  30), INT8_C(   0),
+                           INT8_C(  80), INT8_C( -21), INT8_C( -82), INT8_C(  14), INT8_C( -88), INT8_C( -75), INT8_C( 103), INT8_C(  78),
+                           INT8_C(  77), INT8_C(  70), INT8_C( -63), INT8_C(  -6), INT8_C(-124), INT8_C(  32), INT8_C(  -7), INT8_C(  -3)),
+      simde_mm512_set_epi8(INT8_C( 116), INT8_C( 126), INT8_C(  65), INT8_C( 119), INT8_C( 111), INT8_C(  92), INT8_C(   2), INT8_C( -48),
+                           INT8_C(  -2), INT8_C( -83), INT8_C(  27), INT8_C( -79), INT8_C( -53), INT8_C( -39), INT8_C( -90), INT8_C( -35),
+                           INT8_C(  -5), INT8_C(  73), INT8_C(  85), INT8_C(  84), INT8_C(  44), INT8_C(  24), INT8_C(  33), INT8_C(  95),
+                           INT8_C(  35), INT8_C( 110), INT8_C(  78), INT8_C(  20), INT8_C(  -3), INT8_C( 127), INT8_C(  47), INT8_C(  65),
+                           INT8_C( -64), INT8_C(   7), INT8_C(-122), INT8_C( -87), INT8_C(  80), INT8_C( -12), INT8_C( -28), INT8_C(-120),
+                           INT8_C(  -9), INT8_C(  26), INT8_C( -28), INT8_C(  91), INT8_C(-112), INT8_C( -68), INT8_C(-118), INT8_C( -35),
+                           INT8_C(  98), INT8_C(  50), INT8_C(  78), INT8_C(-109), INT8_C(   4), INT8_C( -52), INT8_C( -89), INT8_C(  83),
+                           INT8_C(  62), INT8_C( -49), INT8_C(  78), INT8_C(  -3), INT8_C( -86), INT8_C( 100), INT8_C(  18), INT8_C( -10)),
+      simde_mm512_set_epi8(INT8_C( -50), INT8_C( 116), INT8_C(  83), INT8_C( 120), INT8_C(  44), INT8_C( 104), INT8_C(  98), INT8_C(  19),
+                           INT8_C(  50), INT8_C( 100), INT8_C(  80), INT8_C( -51), INT8_C( -73), INT8_C( -66), INT8_C(  10), INT8_C(   4),
+                           INT8_C( -35), INT8_C(  15), INT8_C( 116), INT8_C( 114), INT8_C(  31), INT8_C( -11), INT8_C(  33), INT8_C(-123),
+                           INT8_C(  25), INT8_C( 124), INT8_C(  65), INT8_C(  67), INT8_C(  79), INT8_C( 114), INT8_C( -66), INT8_C( -35),
+                           INT8_C( -47), INT8_C(-122), INT8_C(-103), INT8_C( -90), INT8_C( 126), INT8_C(  55), INT8_C( 100), INT8_C( 120),
+                           INT8_C( 101), INT8_C( 120), INT8_C(  62), INT8_C( -49), INT8_C(   1), INT8_C(   1), INT8_C(  69), INT8_C( -44),
+                           INT8_C( -81), INT8_C(  76), INT8_C(  -9), INT8_C( -79), INT8_C(-123), INT8_C(-108), INT8_C(  35), INT8_C( 124),
+                           INT8_C(  78), INT8_C( -49), INT8_C(  33), INT8_C(  92), INT8_C( 104), INT8_C(  -8), INT8_C(   9), INT8_C(  65)) },
+    { simde_mm512_set_epi8(INT8_C(  17), INT8_C(  43), INT8_C( -63), INT8_C( -19), INT8_C( -91), INT8_C(  37), INT8_C( 102), INT8_C(  26),
+                           INT8_C( -55), INT8_C( -25), INT8_C(  -7), INT8_C(  -6), INT8_C( -37), INT8_C(-123), INT8_C(  51), INT8_C( 124),
+                           INT8_C( -97), INT8_C(  26), INT8_C(-117), INT8_C(   7), INT8_C( -25), INT8_C(  68), INT8_C(  39), INT8_C( -13),
+                           INT8_C(  70), INT8_C( -37), INT8_C( 104), INT8_C(-119), INT8_C(  50), INT8_C( -71), INT8_C(  49), INT8_C(-112),
+                           INT8_C(  70), INT8_C(-116), INT8_C( -76), INT8_C(  11), INT8_C(  32), INT8_C(-126), INT8_C(  62), INT8_C( -83),
+                           INT8_C(  93), INT8_C(   8), INT8_C(  34), INT8_C(   5), INT8_C( -28), INT8_C(  29), INT8_C( -85), INT8_C(  59),
+                           INT8_C(-105), INT8_C(  -6), INT8_C(  55), INT8_C( -85), INT8_C( 126), INT8_C(  72), INT8_C(  70), INT8_C( 119),
+                           INT8_C(  85), INT8_C(  91), INT8_C(  56), INT8_C(  82), INT8_C(  66), INT8_C( -83), INT8_C(  -1), INT8_C(-120)),
+      UINT64_C( 4002240087000304933),
+      simde_mm512_set_epi8(INT8_C(  40), INT8_C( -98), INT8_C(  18), INT8_C( -25), INT8_C(  68), INT8_C(   9), INT8_C(  43), INT8_C( -92),
+                           INT8_C(   4), INT8_C(  66), INT8_C(  36), INT8_C( -67), INT8_C( -33), INT8_C(  51), INT8_C( -39), INT8_C( -41),
+                           INT8_C(-127), INT8_C( -37), INT8_C(  -5), INT8_C(  67), INT8_C(  15), INT8_C(-128), INT8_C(  40), INT8_C(  71),
+                           INT8_C( -54), INT8_C(  78), INT8_C(   9), INT8_C( -19), INT8_C(  95), INT8_C( -79), INT8_C( -77), INT8_C(  97),
+                           INT8_C( -75), INT8_C( 116), INT8_C(  74), INT8_C( -77), INT8_C( -82), INT8_C(  59), INT8_C(  -9), INT8_C(  79),
+                           INT8_C( -49), INT8_C( 111), INT8_C( 109), INT8_C( 113), INT8_C(  32), INT8_C( -35), INT8_C( -86), INT8_C(-102),
+                           INT8_C(  80), INT8_C(  -4), INT8_C(-102), INT8_C(-126), INT8_C(  44), INT8_C( -13), INT8_C(  12), INT8_C(   2),
+                           INT8_C( -38), INT8_C(-125), INT8_C( 110), INT8_C(  72), INT8_C(  79), INT8_C(  89), INT8_C( -22), INT8_C(  86)),
+      simde_mm512_set_epi8(INT8_C(-122), INT8_C( -37), INT8_C( -95), INT8_C( -12), INT8_C(  79), INT8_C(  11), INT8_C( -30), INT8_C( -32),
+                           INT8_C(  85), INT8_C( -27), INT8_C( -47), INT8_C(  55), INT8_C(  25), INT8_C(-124), INT8_C( -30), INT8_C(  36),
+                           INT8_C( -99), INT8_C(-104), INT8_C( -31), INT8_C(  31), INT8_C( -20), INT8_C(  64), INT8_C( -13), INT8_C(  66),
+                           INT8_C( -95), INT8_C(  22), INT8_C( -86), INT8_C(  87), INT8_C(  50), INT8_C( -55), INT8_C(  33), INT8_C(   0),
+                           INT8_C(  68), INT8_C(  59), INT8_C(-106), INT8_C(  81), INT8_C( -10), INT8_C(  45), INT8_C( 114), INT8_C( -91),
+                           INT8_C( -71), INT8_C( -52), INT8_C( -28), INT8_C(  30), INT8_C(  86), INT8_C( -26), INT8_C(   5), INT8_C( 111),
+                           INT8_C( -92), INT8_C(  85), INT8_C(  42), INT8_C(  58), INT8_C(-107), INT8_C(  47), INT8_C( -66), INT8_C(-110),
+                           INT8_C(  20), INT8_C(  50), INT8_C(  36), INT8_C( -20), INT8_C(  12), INT8_C(  89), INT8_C(  80), INT8_C( -13)),
+      simde_mm512_set_epi8(INT8_C(  17), INT8_C(  43), INT8_C(  29), INT8_C( -95), INT8_C( -91), INT8_C(  70), INT8_C( -25), INT8_C(-119),
+                           INT8_C(  82), INT8_C( -25), INT8_C(  -7), INT8_C(  -6), INT8_C(  68), INT8_C(-123), INT8_C( 114), INT8_C( 124),
+                           INT8_C(  -1), INT8_C( -10), INT8_C(-117), INT8_C(  12), INT8_C( -25), INT8_C(  68), INT8_C(  39), INT8_C( -13),
+                           INT8_C(  70), INT8_C( -37), INT8_C(  70), INT8_C(-119), INT8_C(  50), INT8_C(  51), INT8_C( -37), INT8_C(  33),
+                           INT8_C(  -7), INT8_C(-116), INT8_C( -76), INT8_C(  11), INT8_C(  32), INT8_C(-126), INT8_C(  85), INT8_C( -92),
+                           INT8_C(  93), INT8_C( -99), INT8_C( -31), INT8_C( -30), INT8_C(-112), INT8_C(  29), INT8_C(  68), INT8_C(-126),
+                           INT8_C(-105), INT8_C( -12), INT8_C(  55), INT8_C( -85), INT8_C(   7), INT8_C(  25), INT8_C(  70), INT8_C( -83),
+                           INT8_C(  85), INT8_C(  91), INT8_C(-104), INT8_C(  82), INT8_C(  66), INT8_C( 114), INT8_C(  -1), INT8_C( -52)) },
+    { simde_mm512_set_epi8(INT8_C( -59), INT8_C(-123), INT8_C(  83), INT8_C(  30), INT8_C(-111), INT8_C(  -6), INT8_C(  78), INT8_C(-105),
+                           INT8_C(  66), INT8_C(  80), INT8_C(-112), INT8_C( -54), INT8_C(  78), INT8_C( 114), INT8_C(  85), INT8_C( 125),
+                           INT8_C(-125), INT8_C( -77), INT8_C( -99), INT8_C( -74), INT8_C( 118), INT8_C(  83), INT8_C(  87), INT8_C(  19),
+                           INT8_C( 106), INT8_C(-115), INT8_C(-111), INT8_C( -74), INT8_C(  82), INT8_C( -22), INT8_C( -28), INT8_C(  27),
+                           INT8_C( -46), INT8_C(  23), INT8_C(-122), INT8_C(   4), INT8_C(  96), INT8_C(  -2), INT8_C( 107), INT8_C( -52),
+                           INT8_C(-112), INT8_C(-100), INT8_C(-104), INT8_C( -21), INT8_C( -97), INT8_C( -88), INT8_C( -82), INT8_C( -47),
+                           INT8_C(  23), INT8_C( -99), INT8_C(  -3), INT8_C( 100), INT8_C(  27), INT8_C(  54), INT8_C( -27), INT8_C(-102),
+                           INT8_C(  21), INT8_C(  69), INT8_C( -54), INT8_C(  28), INT8_C( -34), INT8_C( -12), INT8_C(  82), INT8_C(  -1)),
+      UINT64_C( 8987623857779696830),
+      simde_mm512_set_epi8(INT8_C(  26), INT8_C( 101), INT8_C(-125), INT8_C(  46), INT8_C( -34), INT8_C(   9), INT8_C(-108), INT8_C(   9),
+                           INT8_C( -40), INT8_C(-120), INT8_C( -22), INT8_C( -87), INT8_C( -16), INT8_C( -53), INT8_C(  63), INT8_C( -10),
+                           INT8_C(  71), INT8_C(-101), INT8_C( -75), INT8_C( -16), INT8_C(  83), INT8_C(  71), INT8_C( 104), INT8_C( -25),
+                           INT8_C(-115), INT8_C(-107), INT8_C(  92), INT8_C(  62), INT8_C(  79), INT8_C( -70), INT8_C(  -8), INT8_C(-106),
+                           INT8_C(  65), INT8_C(  -4), INT8_C( 126), INT8_C(-112), INT8_C(  27), INT8_C( -61), INT8_C( -84), INT8_C(  78),
+                           INT8_C(  72), INT8_C(   7), INT8_C( -58), INT8_C(  37), INT8_C( -57), INT8_C( -71), INT8_C(   9), INT8_C(  92),
+                           INT8_C(  39), INT8_C(-107), INT8_C( -73), INT8_C(  -8), INT8_C( 117), INT8_C( 104), INT8_C(  84), INT8_C( -75),
+                           INT8_C(  -9), INT8_C( 126), INT8_C( 123), INT8_C(  18), INT8_C( 100), INT8_C(  12), INT8_C(  -1), INT8_C( -54)),
+      simde_mm512_set_epi8(INT8_C(  58), INT8_C( 107), INT8_C(  97), INT8_C(  11), INT8_C(   1), INT8_C(  57), INT8_C(  78), INT8_C( -29),
+                           INT8_C(  69), INT8_C(  -2), INT8_C( 123), INT8_C(  88), INT8_C(  74), INT8_C(  79), INT8_C( -82), INT8_C( 127),
+                           INT8_C(-127), INT8_C(  51), INT8_C(  75), INT8_C(  93), INT8_C( 101), INT8_C(  76), INT8_C( -48), INT8_C(  31),
+                           INT8_C(  63), INT8_C(-119), INT8_C( -18), INT8_C( 125), INT8_C(  26), INT8_C(  -4), INT8_C( -44), INT8_C( 119),
+                           INT8_C(  80), INT8_C(  11), INT8_C( -37), INT8_C(  44), INT8_C( 110), INT8_C( -55), INT8_C( -77), INT8_C(  81),
+                           INT8_C(  90), INT8_C( -44), INT8_C( -27), INT8_C(  46), INT8_C( 100), INT8_C(  49), INT8_C( -25), INT8_C(  95),
+                           INT8_C( -31), INT8_C( -42), INT8_C( -40), INT8_C( -89), INT8_C( 103), INT8_C( -13), INT8_C(  -6), INT8_C( 107),
+                           INT8_C(  27), INT8_C( -24), INT8_C(  62), INT8_C(  -3), INT8_C( 121), INT8_C(-109), INT8_C( -91), INT8_C(  97)),
+      simde_mm512_set_epi8(INT8_C( -59), INT8_C( -18), INT8_C( -34), INT8_C( -77), INT8_C(  11), INT8_C( -27), INT8_C(  78), INT8_C(-105),
+                           INT8_C(  81), INT8_C(  80), INT8_C(  76), INT8_C(  87), INT8_C( 127), INT8_C( 114), INT8_C( -59), INT8_C( 125),
+                           INT8_C(-125), INT8_C(  96), INT8_C(-112), INT8_C( 127), INT8_C( 118), INT8_C(  27), INT8_C(  87), INT8_C(  19),
+                           INT8_C( 106), INT8_C(-104), INT8_C(-111), INT8_C( -74), INT8_C(  82), INT8_C(  -6), INT8_C( -29), INT8_C(-100),
+                           INT8_C( -91), INT8_C(  23), INT8_C( 107), INT8_C( -47), INT8_C(  96), INT8_C(  -2), INT8_C( 107), INT8_C( -42),
+                           INT8_C( 107), INT8_C(  21), INT8_C(-104), INT8_C( -21), INT8_C(  27), INT8_C( -88), INT8_C( -82), INT8_C( -47),
+                           INT8_C( 106), INT8_C(-104), INT8_C(  66), INT8_C( 100), INT8_C(  27), INT8_C(  31), INT8_C( -27), INT8_C(-102),
+                           INT8_C(  69), INT8_C(  69), INT8_C(   1), INT8_C( -88), INT8_C( 125), INT8_C( 100), INT8_C(  58), INT8_C(  -1)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_permutex2var_epi8(test_vec[i].a, test_vec[i].k, test_vec[i].idx, test_vec[i].b);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask2_permutex2var_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i idx;
+    simde__mmask64 k;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C( -23), INT8_C(  55), INT8_C(  38), INT8_C( -68), INT8_C( -39), INT8_C(  17), INT8_C( -53), INT8_C(  26),
+                           INT8_C( -94), INT8_C(  -7), INT8_C( -40), INT8_C( -99), INT8_C( -91), INT8_C(-107), INT8_C( -92), INT8_C(-109),
+                           INT8_C(-111), INT8_C(  73), INT8_C(-120), INT8_C(  40), INT8_C(-121), INT8_C(  31), INT8_C( -22), INT8_C( -58),
+                           INT8_C( -57), INT8_C( -96), INT8_C( 107), INT8_C(  22), INT8_C(  26), INT8_C(  79), INT8_C( -72), INT8_C(  54),
+                           INT8_C( -16), INT8_C(  18), INT8_C(  67), INT8_C(   0), INT8_C( -57), INT8_C(  51), INT8_C(   2), INT8_C( -13),
+                           INT8_C(  51), INT8_C(  66), INT8_C( 119), INT8_C( -10), INT8_C(  65), INT8_C(  25), INT8_C(  72), INT8_C( -30),
+                           INT8_C( -13), INT8_C(  51), INT8_C( 110), INT8_C( -85), INT8_C( -90), INT8_C(-100), INT8_C(  48), INT8_C(   2),
+                           INT8_C(  -2), INT8_C( -90), INT8_C(  86), INT8_C(  83), INT8_C( 109), INT8_C(  -5), INT8_C(-102), INT8_C(  -9)),
+      simde_mm512_set_epi8(INT8_C(  94), INT8_C(  14), INT8_C( -77), INT8_C( -50), INT8_C(  47), INT8_C( -42), INT8_C( -48), INT8_C( -49),
+                           INT8_C( -66), INT8_C(-123), INT8_C( -15), INT8_C( -87), INT8_C(  -5), INT8_C(  95), INT8_C(-120), INT8_C(  31),
+                           INT8_C(  64), INT8_C( -83), INT8_C(-120), INT8_C( -10), INT8_C(  72), INT8_C(  -5), INT8_C(-113), INT8_C(  65),
+                           INT8_C( -74), INT8_C( -51), INT8_C( -13), INT8_C( -35), INT8_C( -38), INT8_C(  77), INT8_C(  38), INT8_C(  77),
+                           INT8_C(  84), INT8_C(  82), INT8_C( -13), INT8_C(  98), INT8_C(-126), INT8_C( -69), INT8_C(  -4), INT8_C( -76),
+                           INT8_C( -67), INT8_C( 111), INT8_C(   0), INT8_C( 110), INT8_C(   9), INT8_C(  79), INT8_C( -21), INT8_C( -93),
+                           INT8_C(  33), INT8_C( -17), INT8_C(  47), INT8_C( -99), INT8_C(  87), INT8_C(  83), INT8_C(  57), INT8_C( -48),
+                           INT8_C( -12), INT8_C(  48), INT8_C( -57), INT8_C(-127), INT8_C(   1), INT8_C( -86), INT8_C( 110), INT8_C(  12)),
+      UINT64_C( 5791397944504381453),
+      simde_mm512_set_epi8(INT8_C(  42), INT8_C(  55), INT8_C( 100), INT8_C(  22), INT8_C(  39), INT8_C(  33), INT8_C(-128), INT8_C(  77),
+                           INT8_C(  32), INT8_C(  82), INT8_C( -30), INT8_C(  -2), INT8_C( -97), INT8_C( -19), INT8_C( -16), INT8_C( -84),
+                           INT8_C(  95), INT8_C(  -6), INT8_C(   5), INT8_C( -28), INT8_C( -70), INT8_C( -91), INT8_C(  33), INT8_C( 110),
+                           INT8_C( -31), INT8_C(  42), INT8_C( -84), INT8_C( -95), INT8_C(  37), INT8_C(  62), INT8_C(-123), INT8_C( 100),
+                           INT8_C(-103), INT8_C(  84), INT8_C(  -9), INT8_C(  75), INT8_C(  -8), INT8_C( -69), INT8_C( 115), INT8_C(   2),
+                           INT8_C( -70), INT8_C( -27), INT8_C( -66), INT8_C(   9), INT8_C( -23), INT8_C( -44), INT8_C(-116), INT8_C( -37),
+                           INT8_C(  79), INT8_C(   2), INT8_C(  67), INT8_C(-121), INT8_C( -63), INT8_C( -30), INT8_C(  52), INT8_C( 115),
+                           INT8_C( -72), INT8_C( -42), INT8_C( -96), INT8_C(-111), INT8_C( -63), INT8_C( 120), INT8_C( -82), INT8_C( -82)),
+      simde_mm512_set_epi8(INT8_C(  94), INT8_C(  51), INT8_C( -77), INT8_C(   2), INT8_C(  47), INT8_C( -42), INT8_C( -48), INT8_C( -49),
+                           INT8_C( -66), INT8_C(  86), INT8_C( -15), INT8_C( -22), INT8_C(  39), INT8_C(-103), INT8_C(   2), INT8_C( -16),
+                           INT8_C(  64), INT8_C( -83), INT8_C(   2), INT8_C( -10), INT8_C( 115), INT8_C(  39), INT8_C(-113), INT8_C( -82),
+                           INT8_C(  -7), INT8_C( -51), INT8_C( -97), INT8_C(  -9), INT8_C( -69), INT8_C(  67), INT8_C( -96), INT8_C(  67),
+                           INT8_C(  84), INT8_C(  82), INT8_C( -13), INT8_C(  62), INT8_C(-126), INT8_C( -69), INT8_C(  22), INT8_C( -99),
+                           INT8_C( -67), INT8_C( 111), INT8_C(   0), INT8_C(  -6), INT8_C(  48), INT8_C(  79), INT8_C( -21), INT8_C( -93),
+                           INT8_C(  33), INT8_C(  95), INT8_C(-111), INT8_C(  67), INT8_C(  87), INT8_C(  83), INT8_C(  57), INT8_C( -48),
+                           INT8_C( -12), INT8_C(  48), INT8_C( -57), INT8_C(-127), INT8_C(-102), INT8_C(  31), INT8_C( 110), INT8_C( -85)) },
+    { simde_mm512_set_epi8(INT8_C(  11), INT8_C( 122), INT8_C(  32), INT8_C( -48), INT8_C(  30), INT8_C( -78), INT8_C( 123), INT8_C( -46),
+                           INT8_C(  99), INT8_C( -84), INT8_C( 103), INT8_C(-119), INT8_C( 127), INT8_C(  42), INT8_C( 114), INT8_C(  -9),
+                           INT8_C(  92), INT8_C( 124), INT8_C( -46), INT8_C(  -2), INT8_C(  54), INT8_C( -65), INT8_C(  -1), INT8_C(  73),
+                           INT8_C( -57), INT8_C( -88), INT8_C(  -7), INT8_C( 117), INT8_C( -70), INT8_C(  96), INT8_C(   9), INT8_C( -38),
+                           INT8_C(  72), INT8_C( -34), INT8_C( -33), INT8_C(  88), INT8_C( -16), INT8_C(  63), INT8_C(  62), INT8_C(  38),
+                           INT8_C( -15), INT8_C( 121), INT8_C( -70), INT8_C( -79), INT8_C(  17), INT8_C( -12), INT8_C(  21), INT8_C(  12),
+                           INT8_C( -95), INT8_C( 102), INT8_C(  80), INT8_C( -37), INT8_C(  62), INT8_C( -32), INT8_C(  91), INT8_C(  58),
+                           INT8_C(-120), INT8_C(   5), INT8_C(  86), INT8_C(  12), INT8_C( -13), INT8_C( 125), INT8_C( -21), INT8_C( -83)),
+      simde_mm512_set_epi8(INT8_C(-113), INT8_C(  93), INT8_C(-114), INT8_C( -47), INT8_C( 113), INT8_C( -21), INT8_C( -13), INT8_C( -14),
+                           INT8_C( -85), INT8_C(  75), INT8_C(   0), INT8_C( -24), INT8_C( 113), INT8_C( -38), INT8_C(  13), INT8_C( -87),
+                           INT8_C(  25), INT8_C(   0), INT8_C( -51), INT8_C( -45), INT8_C( 107), INT8_C(  83), INT8_C( -97), INT8_C(  87),
+                           INT8_C(  81), INT8_C( -36), INT8_C(  41), INT8_C(  45), INT8_C( -31), INT8_C( 125), INT8_C(-127), INT8_C(  21),
+                           INT8_C(-109), INT8_C(  16), INT8_C( -26), INT8_C( -76), INT8_C(  47), INT8_C(-126), INT8_C(  32), INT8_C(  21),
+                           INT8_C(  61), INT8_C( 110), INT8_C( -29), INT8_C( -89), INT8_C( 114), INT8_C( -57), INT8_C(  18), INT8_C( 113),
+                           INT8_C(   1), INT8_C(-115), INT8_C(  19), INT8_C( -11), INT8_C( -38), INT8_C(  79), INT8_C( -95), INT8_C( -78),
+                           INT8_C(-119), INT8_C( 126), INT8_C(  89), INT8_C(-105), INT8_C(  10), INT8_C(  33), INT8_C( -85), INT8_C( -91)),
+      UINT64_C(  350764343966609249),
+      simde_mm512_set_epi8(INT8_C(-103), INT8_C( -38), INT8_C( -40), INT8_C( -95), INT8_C(  52), INT8_C( -65), INT8_C( -17), INT8_C( 127),
+                           INT8_C( 108), INT8_C( 103), INT8_C( 103), INT8_C( -54), INT8_C( -68), INT8_C(  70), INT8_C(-106), INT8_C( -46),
+                           INT8_C( -97), INT8_C( -29), INT8_C( -46), INT8_C(-121), INT8_C(-122), INT8_C( 100), INT8_C(  12), INT8_C(  74),
+                           INT8_C( -15), INT8_C(  -3), INT8_C(-126), INT8_C(-111), INT8_C(-108), INT8_C( -80), INT8_C(  43), INT8_C(  28),
+                           INT8_C(  38), INT8_C( -98), INT8_C( -52), INT8_C( -10), INT8_C(  91), INT8_C( -60), INT8_C(  39), INT8_C(-109),
+                           INT8_C(  -9), INT8_C( -56), INT8_C( -41), INT8_C(  67), INT8_C(-103), INT8_C( -53), INT8_C( -57), INT8_C(  93),
+                           INT8_C( -95), INT8_C( -99), INT8_C(  40), INT8_C( -26), INT8_C(-107), INT8_C(-111), INT8_C(  92), INT8_C( -28),
+                           INT8_C(  97), INT8_C( -95), INT8_C(   0), INT8_C( -72), INT8_C( -26), INT8_C( -96), INT8_C(-104), INT8_C(-107)),
+      simde_mm512_set_epi8(INT8_C(-113), INT8_C(  93), INT8_C(-114), INT8_C( -47), INT8_C( 113), INT8_C(-122), INT8_C( -13), INT8_C( -14),
+                           INT8_C(  54), INT8_C(-107), INT8_C(   0), INT8_C(  74), INT8_C(-106), INT8_C( -60), INT8_C(  80), INT8_C( -87),
+                           INT8_C(  25), INT8_C(   0), INT8_C(  40), INT8_C( -45), INT8_C(-122), INT8_C(  83), INT8_C(  72), INT8_C(  87),
+                           INT8_C(  81), INT8_C( -10), INT8_C(  41), INT8_C(  45), INT8_C(  43), INT8_C( -40), INT8_C( -21), INT8_C( -70),
+                           INT8_C(  17), INT8_C(  12), INT8_C(  -3), INT8_C(-119), INT8_C(  92), INT8_C(-126), INT8_C( -38), INT8_C(  21),
+                           INT8_C(  61), INT8_C( 110), INT8_C( -29), INT8_C( -89), INT8_C( 114), INT8_C( -57), INT8_C(  18), INT8_C( 113),
+                           INT8_C( -21), INT8_C(-115), INT8_C(  17), INT8_C( -11), INT8_C( -60), INT8_C( -95), INT8_C(   9), INT8_C(  42),
+                           INT8_C(-119), INT8_C( -38), INT8_C(  39), INT8_C(-105), INT8_C(  10), INT8_C(  33), INT8_C( -85), INT8_C(  -7)) },
+    { simde_mm512_set_epi8(INT8_C(  59), INT8_C( -97), INT8_C( -15), INT8_C(-124), INT8_C( -88), INT8_C(-103), INT8_C( -80), INT8_C( -66),
+                           INT8_C(  37), INT8_C(  22), INT8_C( -33), INT8_C(  90), INT8_C(  49), INT8_C(  56), INT8_C(  21), INT8_C( -43),
+                           INT8_C( -51), INT8_C(   1), INT8_C( -24), INT8_C(  88), INT8_C( -66), INT8_C( -51), INT8_C(  51), INT8_C( 115),
+                           INT8_C(-106), INT8_C(  -9), INT8_C(  88), INT8_C(-122), INT8_C( 125), INT8_C(  55), INT8_C(  33), INT8_C( 113),
+                           INT8_C(-108), INT8_C(  18), INT8_C( 104), INT8_C( 123), INT8_C( -85), INT8_C( 109), INT8_C( -60), INT8_C(  -8),
+                           INT8_C( -77), INT8_C( -77), INT8_C( -27), INT8_C(  -2), INT8_C(-122), INT8_C( -89), INT8_C(-122), INT8_C( -75),
+                           INT8_C(  40), INT8_C( -37), INT8_C(  -8), INT8_C( 101), INT8_C(  37), INT8_C( -56), INT8_C( -77), INT8_C(  19),
+                           INT8_C(  53), INT8_C(  95), INT8_C(  26), INT8_C( -61), INT8_C(  92), INT8_C( -51), INT8_C(  86), INT8_C( 127)),
+      simde_mm512_set_epi8(INT8_C( 102), INT8_C(  98), INT8_C(  24), INT8_C(  26), INT8_C(-113), INT8_C( 108), INT8_C(  57), INT8_C(  84),
+                           INT8_C( -88), INT8_C( -64), INT8_C(  70), INT8_C(  61), INT8_C(  83), INT8_C( -71), INT8_C( -43), INT8_C( 126),
+                           INT8_C(  -2), INT8_C(  41), INT8_C( -16), INT8_C(  32), INT8_C(  -6), INT8_C(  70), INT8_C(-102), INT8_C(-117),
+                           INT8_C( -48), INT8_C(-105), INT8_C( -97), INT8_C( -39), INT8_C(  65), INT8_C( -70), INT8_C(-106), INT8_C( 103),
+                           INT8_C(  97), INT8_C(  25), INT8_C( -38), INT8_C( -48), INT8_C( -61), INT8_C(  46), INT8_C(  34), INT8_C( -94),
+                           INT8_C(  94), INT8_C(  68), INT8_C(-106), INT8_C( 106), INT8_C( -97), INT8_C(  40), INT8_C(  51), INT8_C(-123),
+                           INT8_C( -53), INT8_C( -22), INT8_C( -58), INT8_C( -82), INT8_C( -11), INT8_C(-127), INT8_C(-127), INT8_C(  71),
+                           INT8_C( -80), INT8_C(-103), INT8_C(  89), INT8_C(  56), INT8_C( 105), INT8_C(  13), INT8_C( 108), INT8_C(  95)),
+      UINT64_C( 8174389509690950185),
+      simde_mm512_set_epi8(INT8_C( -87), INT8_C( -14), INT8_C( -25), INT8_C( -35), INT8_C( -67), INT8_C( -93), INT8_C( 116), INT8_C( -64),
+                           INT8_C( -80), INT8_C( -68), INT8_C(  48), INT8_C( -87), INT8_C( 104), INT8_C(  75), INT8_C( -30), INT8_C(   4),
+                           INT8_C( -75), INT8_C(-114), INT8_C( -83), INT8_C( 124), INT8_C(  56), INT8_C(  51), INT8_C(   6), INT8_C(   8),
+                           INT8_C( -59), INT8_C(  15), INT8_C( -44), INT8_C(  80), INT8_C( -41), INT8_C( -67), INT8_C( 107), INT8_C(  94),
+                           INT8_C(  82), INT8_C(-111), INT8_C( -33), INT8_C(  71), INT8_C( -38), INT8_C( -17), INT8_C( 124), INT8_C(  38),
+                           INT8_C(-103), INT8_C( -65), INT8_C(  -1), INT8_C(   6), INT8_C( -38), INT8_C( 123), INT8_C(  93), INT8_C( -35),
+                           INT8_C( -70), INT8_C( -94), INT8_C( -34), INT8_C( -72), INT8_C(  76), INT8_C(-109), INT8_C( -55), INT8_C( -50),
+                           INT8_C(  51), INT8_C( -30), INT8_C(  71), INT8_C( -56), INT8_C(-114), INT8_C(  26), INT8_C(  52), INT8_C(  38)),
+      simde_mm512_set_epi8(INT8_C( 102), INT8_C( -67), INT8_C(  -8), INT8_C( 109), INT8_C(-113), INT8_C( 108), INT8_C(  57), INT8_C(   6),
+                           INT8_C( -88), INT8_C(  38), INT8_C( -30), INT8_C( -15), INT8_C(  83), INT8_C( -71), INT8_C( -43), INT8_C( -14),
+                           INT8_C(  -2), INT8_C(  51), INT8_C( -16), INT8_C(  32), INT8_C(  -6), INT8_C(  70), INT8_C( 109), INT8_C(  37),
+                           INT8_C( -35), INT8_C( -77), INT8_C(-108), INT8_C( 124), INT8_C(  65), INT8_C( -70), INT8_C( -77), INT8_C( -59),
+                           INT8_C(  97), INT8_C(  25), INT8_C( -38), INT8_C( -48), INT8_C( -61), INT8_C(   1), INT8_C(  34), INT8_C( -94),
+                           INT8_C(-111), INT8_C( -56), INT8_C(-106), INT8_C( 106), INT8_C(-108), INT8_C( 115), INT8_C(  49), INT8_C(  26),
+                           INT8_C( -53), INT8_C( -22), INT8_C( -58), INT8_C( -82), INT8_C( -11), INT8_C(-127), INT8_C(  86), INT8_C(  71),
+                           INT8_C( -80), INT8_C(-103), INT8_C( 124), INT8_C(  56), INT8_C(   6), INT8_C(  13), INT8_C( 108), INT8_C(  82)) },
+    { simde_mm512_set_epi8(INT8_C(  33), INT8_C( -77), INT8_C(-113), INT8_C(  46), INT8_C(  10), INT8_C(  50), INT8_C( -46), INT8_C(  19),
+                           INT8_C( -55), INT8_C( -94), INT8_C( 120), INT8_C( -98), INT8_C(  71), INT8_C( -55), INT8_C(  56), INT8_C( -30),
+                           INT8_C(  82), INT8_C( -11), INT8_C(-100), INT8_C( -22), INT8_C( -49), INT8_C(  39), INT8_C(  43), INT8_C( -11),
+                           INT8_C( -83), INT8_C(  77), INT8_C(  42), INT8_C(  76), INT8_C( 115), INT8_C( -92), INT8_C( -43), INT8_C( -34),
+                           INT8_C( -73), INT8_C( 121), INT8_C( 127), INT8_C(  -9), INT8_C(  85), INT8_C(   1), INT8_C(  31), INT8_C( -95),
+                           INT8_C(-121), INT8_C( -61), INT8_C(  60), INT8_C( -63), INT8_C(  12), INT8_C(  87), INT8_C(-113), INT8_C( 127),
+                           INT8_C( -31), INT8_C(  98), INT8_C( -89), INT8_C( 117), INT8_C(  55), INT8_C(  32), INT8_C(  63), INT8_C(  65),
+                           INT8_C(  35), INT8_C( -27), INT8_C(  95), INT8_C( -86), INT8_C(  93), INT8_C(-103), INT8_C(  54), INT8_C( 109)),
+      simde_mm512_set_epi8(INT8_C( -21), INT8_C(  21), INT8_C( -44), INT8_C( -53), INT8_C(  35), INT8_C( -56), INT8_C( -92), INT8_C(-103),
+                           INT8_C( 118), INT8_C( -52), INT8_C( -13), INT8_C( -92), INT8_C(  19), INT8_C( -50), INT8_C(  20), INT8_C( -80),
+                           INT8_C(  71), INT8_C(-127), INT8_C( -30), INT8_C(  87), INT8_C(-108), INT8_C( 112), INT8_C( -18), INT8_C( 108),
+                           INT8_C( -17), INT8_C( -86), INT8_C( 123), INT8_C(  52), INT8_C(-113), INT8_C(  59), INT8_C(   2), INT8_C( 104),
+                           INT8_C(  92), INT8_C( 107), INT8_C(  83), INT8_C(  65), INT8_C( -53), INT8_C( -71), INT8_C( 108), INT8_C( -15),
+                           INT8_C( -32), INT8_C(  90), INT8_C(-107), INT8_C( -47), INT8_C(  26), INT8_C(  89), INT8_C( -30), INT8_C( 117),
+                           INT8_C( 115), INT8_C(  30), INT8_C(  26), INT8_C(  76), INT8_C( -17), INT8_C( -86), INT8_C(  18), INT8_C(  17),
+                           INT8_C(-107), INT8_C(  31), INT8_C( -29), INT8_C(  84), INT8_C(  38), INT8_C(  62), INT8_C(  83), INT8_C( 119)),
+      UINT64_C(13119081388115628711),
+      simde_mm512_set_epi8(INT8_C(-126), INT8_C(  71), INT8_C( -66), INT8_C(  94), INT8_C(  56), INT8_C( -71), INT8_C(-113), INT8_C( -72),
+                           INT8_C(  68), INT8_C( -79), INT8_C(  45), INT8_C( 119), INT8_C(  25), INT8_C(  52), INT8_C( -17), INT8_C( -89),
+                           INT8_C(  21), INT8_C( -72), INT8_C(-112), INT8_C(  26), INT8_C(  49), INT8_C( -91), INT8_C(  87), INT8_C(  73),
+                           INT8_C( -10), INT8_C(  61), INT8_C(  -1), INT8_C(  -2), INT8_C( -82), INT8_C( -13), INT8_C(-125), INT8_C( -50),
+                           INT8_C( -11), INT8_C( -78), INT8_C( -60), INT8_C( -79), INT8_C(   2), INT8_C( -53), INT8_C( -38), INT8_C( -69),
+                           INT8_C(   8), INT8_C( -59), INT8_C(  93), INT8_C(  33), INT8_C( -95), INT8_C( -55), INT8_C(  59), INT8_C( -52),
+                           INT8_C(-119), INT8_C( -21), INT8_C(  31), INT8_C( -18), INT8_C(  30), INT8_C( -83), INT8_C(  -3), INT8_C(  -9),
+                           INT8_C(   2), INT8_C(-119), INT8_C(  15), INT8_C( -71), INT8_C(  52), INT8_C(  21), INT8_C(  51), INT8_C(-112)),
+      simde_mm512_set_epi8(INT8_C(  49), INT8_C(  21), INT8_C(  33), INT8_C(  30), INT8_C(  35), INT8_C(  -9), INT8_C(  76), INT8_C(-103),
+                           INT8_C( 118), INT8_C( -52), INT8_C( -13), INT8_C(  76), INT8_C(  19), INT8_C( -50), INT8_C(  20), INT8_C( -80),
+                           INT8_C(  71), INT8_C(  54), INT8_C( -30), INT8_C(   8), INT8_C(-108), INT8_C( -89), INT8_C( -72), INT8_C(  26),
+                           INT8_C( -17), INT8_C( -86), INT8_C( 123), INT8_C(  52), INT8_C(-113), INT8_C(  59), INT8_C(-103), INT8_C(  73),
+                           INT8_C( -79), INT8_C( 107), INT8_C( -95), INT8_C(  51), INT8_C(  30), INT8_C( -46), INT8_C(  26), INT8_C( -15),
+                           INT8_C( -32), INT8_C(  90), INT8_C(-107), INT8_C(  59), INT8_C(  26), INT8_C(  89), INT8_C( -13), INT8_C( 117),
+                           INT8_C( 115), INT8_C(  30), INT8_C(  26), INT8_C( -18), INT8_C( -17), INT8_C( -86), INT8_C(  87), INT8_C(  17),
+                           INT8_C(  60), INT8_C(  31), INT8_C( -82), INT8_C(  84), INT8_C(  38), INT8_C( -77), INT8_C( -95), INT8_C(  68)) },
+    { simde_mm512_set_epi8(INT8_C( 113), INT8_C( -33), INT8_C( 118), INT8_C(   0), INT8_C( -43), INT8_C(  74), INT8_C(  43), INT8_C( 108),
+                           INT8_C( -39), INT8_C( -46), INT8_C(  91), INT8_C(  10), INT8_C(  96), INT8_C(   7), INT8_C( -75), INT8_C( -57),
+                           INT8_C( -29), INT8_C(  45), INT8_C(  18), INT8_C( 124), INT8_C( -37), INT8_C( -66), INT8_C(  48), INT8_C( 103),
+                           INT8_C(  22), INT8_C(  33), INT8_C( -29), INT8_C(   8), INT8_C(  50), INT8_C( -15), INT8_C(  45), INT8_C( 125),
+                           INT8_C( -80), INT8_C( -10), INT8_C(   0), INT8_C(  86), INT8_C(  86), INT8_C( -23), INT8_C(  64), INT8_C(  -4),
+                           INT8_C(  21), INT8_C( -57), INT8_C( -64), INT8_C(  31), INT8_C(  49), INT8_C(  60), INT8_C( -69), INT8_C(  10),
+                           INT8_C( -98), INT8_C(  72), INT8_C( -80), INT8_C(  27), INT8_C(  79), INT8_C(  55), INT8_C(-101), INT8_C(  60),
+                           INT8_C(  60), INT8_C(-119), INT8_C(  63), INT8_C(  -4), INT8_C(-127), INT8_C(  58), INT8_C( 127), INT8_C(  66)),
+      simde_mm512_set_epi8(INT8_C( -97), INT8_C(  40), INT8_C( -31), INT8_C( -44), INT8_C(  28), INT8_C( -28), INT8_C(  58), INT8_C(   6),
+                           INT8_C(-123), INT8_C( -13), INT8_C( -39), INT8_C( 114), INT8_C(-109), INT8_C(   6), INT8_C(  -5), INT8_C( -79),
+                           INT8_C(  48), INT8_C(  36), INT8_C( -65), INT8_C( 113), INT8_C( -34), INT8_C(  30), INT8_C( -13), INT8_C( -42),
+                           INT8_C(  93), INT8_C( -57), INT8_C( -92), INT8_C( -50), INT8_C( -95), INT8_C( -37), INT8_C( -98), INT8_C( 106),
+                           INT8_C(  56), INT8_C( -46), INT8_C( -61), INT8_C( -72), INT8_C( -74), INT8_C(  30), INT8_C( -18), INT8_C(  54),
+                           INT8_C( 101), INT8_C(  -5), INT8_C( -99), INT8_C(  -8), INT8_C(  28), INT8_C( -51), INT8_C( -81), INT8_C( 104),
+                           INT8_C( 118), INT8_C(  -7), INT8_C(   1), INT8_C(  77), INT8_C( -49), INT8_C(  -1), INT8_C(  77), INT8_C( 114),
+                           INT8_C(  58), INT8_C( -64), INT8_C( -44), INT8_C( 127), INT8_C(  11), INT8_C( 115), INT8_C( -28), INT8_C(  58)),
+      UINT64_C(16246219459453859772),
+      simde_mm512_set_epi8(INT8_C( -26), INT8_C(  82), INT8_C(-116), INT8_C(  36), INT8_C(  94), INT8_C(  98), INT8_C( 119), INT8_C(-109),
+                           INT8_C( -20), INT8_C( -50), INT8_C( -67), INT8_C( -99), INT8_C(  72), INT8_C( -57), INT8_C(-105), INT8_C( -68),
+                           INT8_C( -35), INT8_C( 126), INT8_C( -93), INT8_C(  55), INT8_C(  10), INT8_C(-115), INT8_C(   3), INT8_C(  58),
+                           INT8_C(  64), INT8_C(  55), INT8_C(  76), INT8_C(-123), INT8_C( -51), INT8_C(  84), INT8_C(  -8), INT8_C(  74),
+                           INT8_C( -63), INT8_C( 119), INT8_C( 120), INT8_C( -92), INT8_C(  66), INT8_C(  13), INT8_C( -95), INT8_C(   8),
+                           INT8_C(  77), INT8_C(-109), INT8_C( -19), INT8_C( -42), INT8_C(  56), INT8_C( -27), INT8_C( 110), INT8_C(-107),
+                           INT8_C(  28), INT8_C(-128), INT8_C( -20), INT8_C(   6), INT8_C(  80), INT8_C(  21), INT8_C( -32), INT8_C(  21),
+                           INT8_C(  15), INT8_C(  12), INT8_C(  83), INT8_C( -85), INT8_C( 109), INT8_C( 119), INT8_C( -77), INT8_C( -14)),
+      simde_mm512_set_epi8(INT8_C( -80), INT8_C( 103), INT8_C(  -8), INT8_C( -44), INT8_C(  28), INT8_C( -28), INT8_C(  58), INT8_C(-119),
+                           INT8_C(-123), INT8_C(  72), INT8_C( -95), INT8_C( -57), INT8_C(-109), INT8_C(-119), INT8_C(  94), INT8_C( -79),
+                           INT8_C(  48), INT8_C(  36), INT8_C( 113), INT8_C( 113), INT8_C( 119), INT8_C(  30), INT8_C(  72), INT8_C( -42),
+                           INT8_C( 120), INT8_C( -57), INT8_C( -92), INT8_C( -50), INT8_C( -95), INT8_C(  66), INT8_C( -98), INT8_C(-115),
+                           INT8_C( 108), INT8_C( -46), INT8_C( 109), INT8_C( -72), INT8_C( -46), INT8_C( -10), INT8_C( 126), INT8_C( -46),
+                           INT8_C(  76), INT8_C(  94), INT8_C( -99), INT8_C(  -8), INT8_C(  86), INT8_C( -51), INT8_C( -81), INT8_C(  58),
+                           INT8_C( 118), INT8_C(  -7), INT8_C( 127), INT8_C( -20), INT8_C( -49), INT8_C( -26), INT8_C( -20), INT8_C( -57),
+                           INT8_C(  74), INT8_C( -64), INT8_C( -42), INT8_C( -26), INT8_C(  79), INT8_C(  72), INT8_C( -28), INT8_C(  58)) },
+    { simde_mm512_set_epi8(INT8_C(  44), INT8_C( 112), INT8_C(  87), INT8_C( -29), INT8_C(   6), INT8_C(   2), INT8_C( -71), INT8_C( -29),
+                           INT8_C( -11), INT8_C( 125), INT8_C(  11), INT8_C(-115), INT8_C( 117), INT8_C( 106), INT8_C(   6), INT8_C(  47),
+                           INT8_C(  80), INT8_C(  50), INT8_C( -76), INT8_C(  65), INT8_C( -59), INT8_C( -22), INT8_C(  46), INT8_C( -14),
+                           INT8_C(   0), INT8_C(  90), INT8_C( -61), INT8_C(  25), INT8_C( -91), INT8_C(  90), INT8_C( -59), INT8_C( 120),
+                           INT8_C( 111), INT8_C( -54), INT8_C( -69), INT8_C( -54), INT8_C(   3), INT8_C(-118), INT8_C( -44), INT8_C(-111),
+                           INT8_C(  -5), INT8_C(  10), INT8_C(  68), INT8_C(-124), INT8_C(  -3), INT8_C(  72), INT8_C(  96), INT8_C(  17),
+                           INT8_C(  -1), INT8_C(  75), INT8_C( -49), INT8_C( 101), INT8_C(  -2), INT8_C( -91), INT8_C(  11), INT8_C(-122),
+                           INT8_C(-128), INT8_C( -22), INT8_C(  50), INT8_C(  27), INT8_C( -27), INT8_C(-118), INT8_C( -54), INT8_C( -45)),
+      simde_mm512_set_epi8(INT8_C(  70), INT8_C( 117), INT8_C( -50), INT8_C(  67), INT8_C(-100), INT8_C(  21), INT8_C(  88), INT8_C(-111),
+                           INT8_C(  72), INT8_C(  57), INT8_C(  54), INT8_C(  90), INT8_C(  52), INT8_C( -76), INT8_C(   7), INT8_C(  95),
+                           INT8_C(  60), INT8_C(-121), INT8_C(-115), INT8_C( -59), INT8_C(-113), INT8_C( -98), INT8_C( -55), INT8_C( -52),
+                           INT8_C( -39), INT8_C( -52), INT8_C( 115), INT8_C( -91), INT8_C( -65), INT8_C(  41), INT8_C(  16), INT8_C( -83),
+                           INT8_C(  41), INT8_C( -37), INT8_C( 112), INT8_C(  -3), INT8_C( -79), INT8_C( -99), INT8_C( -97), INT8_C(  83),
+                           INT8_C(  57), INT8_C( -82), INT8_C( 100), INT8_C(  82), INT8_C(  20), INT8_C( -88), INT8_C( -84), INT8_C(-118),
+                           INT8_C(  89), INT8_C( 108), INT8_C(  -8), INT8_C( -57), INT8_C( 126), INT8_C(  17), INT8_C( -55), INT8_C(  24),
+                           INT8_C( 120), INT8_C(  91), INT8_C(   0), INT8_C( 116), INT8_C(  95), INT8_C(  60), INT8_C( -92), INT8_C(  80)),
+      UINT64_C(14403564261118452207),
+      simde_mm512_set_epi8(INT8_C(  34), INT8_C( -42), INT8_C( -28), INT8_C( -41), INT8_C(   7), INT8_C( -74), INT8_C( -91), INT8_C( -92),
+                           INT8_C(  15), INT8_C(  22), INT8_C( -79), INT8_C(  53), INT8_C(  97), INT8_C(  40), INT8_C( 104), INT8_C( 116),
+                           INT8_C(-112), INT8_C( -79), INT8_C( -36), INT8_C( -46), INT8_C( -53), INT8_C(  96), INT8_C(  57), INT8_C( -57),
+                           INT8_C(  92), INT8_C(  60), INT8_C( -72), INT8_C(  51), INT8_C(   4), INT8_C( 102), INT8_C(  24), INT8_C(  55),
+                           INT8_C( 115), INT8_C(  60), INT8_C( 117), INT8_C( -19), INT8_C(  51), INT8_C(  72), INT8_C( 121), INT8_C( -60),
+                           INT8_C(  86), INT8_C( -74), INT8_C(  99), INT8_C(  33), INT8_C( -97), INT8_C( 110), INT8_C(  56), INT8_C( -11),
+                           INT8_C(  35), INT8_C(-112), INT8_C(  73), INT8_C(   4), INT8_C( -76), INT8_C(-109), INT8_C( -68), INT8_C(-116),
+                           INT8_C( 115), INT8_C(  55), INT8_C( -84), INT8_C( 104), INT8_C(  89), INT8_C( -87), INT8_C( 118), INT8_C(  96)),
+      simde_mm512_set_epi8(INT8_C(  55), INT8_C( -79), INT8_C( -50), INT8_C(  67), INT8_C(-100), INT8_C(  68), INT8_C( -60), INT8_C(  96),
+                           INT8_C(-116), INT8_C( -71), INT8_C( 125), INT8_C(  90), INT8_C(  52), INT8_C( -76), INT8_C(-128), INT8_C( 115),
+                           INT8_C( -29), INT8_C(-121), INT8_C( -49), INT8_C( -84), INT8_C(  -1), INT8_C( -54), INT8_C( -55), INT8_C(   4),
+                           INT8_C( -39), INT8_C(   4), INT8_C(  97), INT8_C( -91), INT8_C( -65), INT8_C(  41), INT8_C(  16), INT8_C( -76),
+                           INT8_C(  46), INT8_C(  51), INT8_C( 112), INT8_C( -28), INT8_C( -79), INT8_C( -99), INT8_C( 111), INT8_C( -97),
+                           INT8_C(  57), INT8_C(  50), INT8_C(  51), INT8_C( 110), INT8_C(-124), INT8_C( -88), INT8_C(  65), INT8_C(-118),
+                           INT8_C(  89), INT8_C( 108), INT8_C( -92), INT8_C( -57), INT8_C( 126), INT8_C(  17), INT8_C( -55), INT8_C(-111),
+                           INT8_C( -92), INT8_C(  51), INT8_C( -45), INT8_C( 116), INT8_C( 115), INT8_C( -29), INT8_C(  25), INT8_C( -11)) },
+    { simde_mm512_set_epi8(INT8_C( -11), INT8_C(-114), INT8_C(  45), INT8_C(  51), INT8_C(  17), INT8_C(  79), INT8_C( -52), INT8_C( -36),
+                           INT8_C( -20), INT8_C( 123), INT8_C(  10), INT8_C( -77), INT8_C( 101), INT8_C(  30), INT8_C( 101), INT8_C( -41),
+                           INT8_C( -91), INT8_C( -97), INT8_C(  54), INT8_C(  46), INT8_C( -95), INT8_C( -55), INT8_C(   3), INT8_C( -48),
+                           INT8_C(-119), INT8_C(  54), INT8_C( -49), INT8_C(-119), INT8_C( -44), INT8_C(  -6), INT8_C(  -4), INT8_C(  40),
+                           INT8_C( 103), INT8_C( -34), INT8_C(  16), INT8_C( -40), INT8_C(  97), INT8_C( -20), INT8_C(  52), INT8_C(  64),
+                           INT8_C( 121), INT8_C(  80), INT8_C( -46), INT8_C(  71), INT8_C(   1), INT8_C(  30), INT8_C(  15), INT8_C( -97),
+                           INT8_C(  13), INT8_C(   5), INT8_C(  72), INT8_C(-100), INT8_C(  88), INT8_C( -30), INT8_C(  55), INT8_C( -16),
+                           INT8_C(-127), INT8_C(  46), INT8_C(  12), INT8_C( -46), INT8_C(  22), INT8_C( -79), INT8_C(  78), INT8_C( 108)),
+      simde_mm512_set_epi8(INT8_C( 102), INT8_C(-109), INT8_C(  12), INT8_C( -92), INT8_C(  28), INT8_C(  45), INT8_C(-100), INT8_C( -42),
+                           INT8_C(  -7), INT8_C( -32), INT8_C(-113), INT8_C( 110), INT8_C(-109), INT8_C(-100), INT8_C(  97), INT8_C(  20),
+                           INT8_C( -49), INT8_C( -61), INT8_C( 123), INT8_C( 112), INT8_C( 108), INT8_C( -33), INT8_C(  83), INT8_C(  50),
+                           INT8_C(  75), INT8_C(  50), INT8_C( -58), INT8_C( -33), INT8_C( -43), INT8_C(  15), INT8_C(  30), INT8_C( -49),
+                           INT8_C( -38), INT8_C(  93), INT8_C( -14), INT8_C( -25), INT8_C(  57), INT8_C(-117), INT8_C( -20), INT8_C(-106),
+                           INT8_C( -81), INT8_C(  48), INT8_C(-102), INT8_C(  34), INT8_C(   1), INT8_C( -10), INT8_C( -57), INT8_C(  24),
+                           INT8_C( 116), INT8_C( -26), INT8_C(-114), INT8_C(  26), INT8_C(   1), INT8_C(  79), INT8_C(  74), INT8_C( -51),
+                           INT8_C(  15), INT8_C(  65), INT8_C( -91), INT8_C(-113), INT8_C(  21), INT8_C(-113), INT8_C( -28), INT8_C(  69)),
+      UINT64_C(  882847598853646100),
+      simde_mm512_set_epi8(INT8_C(  -4), INT8_C( -96), INT8_C(  81), INT8_C(  73), INT8_C( -16), INT8_C(  40), INT8_C( -67), INT8_C( -81),
+                           INT8_C(  92), INT8_C(  33), INT8_C( 121), INT8_C( 113), INT8_C(   3), INT8_C(  61), INT8_C(  40), INT8_C(  63),
+                           INT8_C( -64), INT8_C(-103), INT8_C(  20), INT8_C(-106), INT8_C( -25), INT8_C(-117), INT8_C( -33), INT8_C(-128),
+                           INT8_C( -98), INT8_C(-112), INT8_C( -96), INT8_C( -16), INT8_C( -64), INT8_C(   3), INT8_C( -49), INT8_C( -33),
+                           INT8_C(-127), INT8_C(  17), INT8_C(  14), INT8_C( -76), INT8_C( -16), INT8_C(  -9), INT8_C( -38), INT8_C( -22),
+                           INT8_C(  -7), INT8_C( -53), INT8_C(-127), INT8_C( 126), INT8_C( 104), INT8_C( -81), INT8_C( -43), INT8_C(  64),
+                           INT8_C( -78), INT8_C( -94), INT8_C(   6), INT8_C( 118), INT8_C( -41), INT8_C( 113), INT8_C(  37), INT8_C( -53),
+                           INT8_C(   7), INT8_C( 118), INT8_C(  89), INT8_C( -17), INT8_C(-120), INT8_C(  54), INT8_C(  50), INT8_C( 111)),
+      simde_mm512_set_epi8(INT8_C( 102), INT8_C(-109), INT8_C(  12), INT8_C( -92), INT8_C( -40), INT8_C(  54), INT8_C(-100), INT8_C( -42),
+                           INT8_C(  -7), INT8_C( -33), INT8_C(-113), INT8_C( 110), INT8_C(-109), INT8_C(-100), INT8_C(  97), INT8_C(  20),
+                           INT8_C( -78), INT8_C( -61), INT8_C( 123), INT8_C( 112), INT8_C( 108), INT8_C( -33), INT8_C(  83), INT8_C(  30),
+                           INT8_C(  75), INT8_C(  50), INT8_C( 118), INT8_C(-127), INT8_C( -43), INT8_C(  13), INT8_C( -34), INT8_C( -49),
+                           INT8_C(  -9), INT8_C(  93), INT8_C(  61), INT8_C( -98), INT8_C(  57), INT8_C(-117), INT8_C( -20), INT8_C(-106),
+                           INT8_C( -81), INT8_C( -41), INT8_C( -20), INT8_C(  -6), INT8_C(  78), INT8_C( -10), INT8_C(   7), INT8_C(  24),
+                           INT8_C( 116), INT8_C(-112), INT8_C(   5), INT8_C(  26), INT8_C(   1), INT8_C( -78), INT8_C( 113), INT8_C(   6),
+                           INT8_C(  15), INT8_C(  65), INT8_C( -91), INT8_C(  13), INT8_C(  21), INT8_C(  13), INT8_C( -28), INT8_C(  69)) },
+    { simde_mm512_set_epi8(INT8_C( -44), INT8_C(  43), INT8_C( 115), INT8_C(  74), INT8_C( 104), INT8_C(  -3), INT8_C(  27), INT8_C(  22),
+                           INT8_C(  96), INT8_C( 113), INT8_C(  72), INT8_C( -62), INT8_C( -96), INT8_C(-102), INT8_C( -19), INT8_C(-115),
+                           INT8_C( -20), INT8_C(-105), INT8_C(-102), INT8_C(  -3), INT8_C( -85), INT8_C(  15), INT8_C(  64), INT8_C(  77),
+                           INT8_C( -19), INT8_C(-124), INT8_C( -46), INT8_C(-107), INT8_C(-100), INT8_C(   4), INT8_C( -20), INT8_C(-108),
+                           INT8_C(-116), INT8_C(  54), INT8_C(-124), INT8_C(-100), INT8_C( -77), INT8_C( -87), INT8_C(  45), INT8_C(  78),
+                           INT8_C( -77), INT8_C( -76), INT8_C(-111), INT8_C( 103), INT8_C( -70), INT8_C( -23), INT8_C(  55), INT8_C(  32),
+                           INT8_C( 117), INT8_C( -11), INT8_C( -67), INT8_C( 113), INT8_C(-110), INT8_C( -48), INT8_C(-117), INT8_C(  -9),
+                           INT8_C(  43), INT8_C( 113), INT8_C(-123), INT8_C(  84), INT8_C(  34), INT8_C( -43), INT8_C( -42), INT8_C( -38)),
+      simde_mm512_set_epi8(INT8_C(-119), INT8_C(-114), INT8_C(  52), INT8_C(  11), INT8_C(  95), INT8_C(-111), INT8_C(  62), INT8_C(  38),
+                           INT8_C(  96), INT8_C(  32), INT8_C( 112), INT8_C(-125), INT8_C(  24), INT8_C( -88), INT8_C( -69), INT8_C(  80),
+                           INT8_C( -13), INT8_C( -98), INT8_C(  87), INT8_C(  64), INT8_C( -70), INT8_C(-105), INT8_C(-128), INT8_C(  80),
+                           INT8_C( -58), INT8_C(  11), INT8_C(-107), INT8_C(  31), INT8_C(  54), INT8_C( -72), INT8_C( -26), INT8_C( -35),
+                           INT8_C( -54), INT8_C(-122), INT8_C(  85), INT8_C( -62), INT8_C(  87), INT8_C(  55), INT8_C(  42), INT8_C(-120),
+                           INT8_C( 112), INT8_C(  80), INT8_C( -56), INT8_C( -32), INT8_C(   7), INT8_C( -31), INT8_C( -19), INT8_C(-109),
+                           INT8_C(  19), INT8_C(  60), INT8_C(   4), INT8_C( -95), INT8_C(  44), INT8_C( 101), INT8_C(  93), INT8_C( 105),
+                           INT8_C( -49), INT8_C( 100), INT8_C( 122), INT8_C(  56), INT8_C( -87), INT8_C(  72), INT8_C( -28), INT8_C( -96)),
+      UINT64_C( 9433394761810125434),
+      simde_mm512_set_epi8(INT8_C( -48), INT8_C( -89), INT8_C(  16), INT8_C(   4), INT8_C(  57), INT8_C( -15), INT8_C(-107), INT8_C(  80),
+                           INT8_C(-119), INT8_C( -87), INT8_C( -87), INT8_C( -51), INT8_C(  -6), INT8_C(  63), INT8_C( -21), INT8_C(   6),
+                           INT8_C(  51), INT8_C(-118), INT8_C( -51), INT8_C(  27), INT8_C( 127), INT8_C( -92), INT8_C(  99), INT8_C(-127),
+                           INT8_C(  71), INT8_C( -24), INT8_C(  98), INT8_C( -43), INT8_C( -39), INT8_C(-115), INT8_C(  78), INT8_C(  93),
+                           INT8_C( -33), INT8_C(  90), INT8_C(  71), INT8_C(  94), INT8_C( 103), INT8_C(-109), INT8_C( -44), INT8_C( -12),
+                           INT8_C( -89), INT8_C( -90), INT8_C( 123), INT8_C( -16), INT8_C(-124), INT8_C( 125), INT8_C( -93), INT8_C(  50),
+                           INT8_C(-112), INT8_C(  14), INT8_C(  68), INT8_C( -12), INT8_C( -44), INT8_C(  95), INT8_C(  65), INT8_C( -15),
+                           INT8_C( -51), INT8_C(  28), INT8_C(  84), INT8_C(  12), INT8_C(  33), INT8_C(  17), INT8_C(  85), INT8_C( -38)),
+      simde_mm512_set_epi8(INT8_C(-117), INT8_C(-114), INT8_C(  52), INT8_C(  11), INT8_C(  95), INT8_C(-111), INT8_C(  43), INT8_C(  38),
+                           INT8_C(  93), INT8_C(-108), INT8_C(   6), INT8_C(-125), INT8_C(  78), INT8_C( -88), INT8_C( 104), INT8_C(  80),
+                           INT8_C( -13), INT8_C( -98), INT8_C( -89), INT8_C(  64), INT8_C( -70), INT8_C( -77), INT8_C( -38), INT8_C(  80),
+                           INT8_C(  28), INT8_C(  11), INT8_C(-107), INT8_C(  31), INT8_C( 113), INT8_C(  22), INT8_C( -24), INT8_C( -35),
+                           INT8_C( -54), INT8_C(-122), INT8_C( 123), INT8_C(  17), INT8_C( -89), INT8_C(  55), INT8_C(  15), INT8_C(  -9),
+                           INT8_C(   6), INT8_C(  80), INT8_C( -15), INT8_C(  93), INT8_C(  43), INT8_C( -31), INT8_C( -19), INT8_C( -70),
+                           INT8_C(  19), INT8_C(  60), INT8_C(  84), INT8_C( -95), INT8_C(  44), INT8_C( 101), INT8_C(  71), INT8_C( 105),
+                           INT8_C( -49), INT8_C( -43), INT8_C( -15), INT8_C(  22), INT8_C(  64), INT8_C(  72), INT8_C( -43), INT8_C( -96)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask2_permutex2var_epi8(test_vec[i].a, test_vec[i].idx, test_vec[i].k, test_vec[i].b);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_permutex2var_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask64 k;
+    simde__m512i a;
+    simde__m512i idx;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT64_C( 4792722664974712281),
+      simde_mm512_set_epi8(INT8_C(  95), INT8_C(  79), INT8_C(  -3), INT8_C( -82), INT8_C( -57), INT8_C(  23), INT8_C( 102), INT8_C( -46),
+                           INT8_C(  49), INT8_C(  29), INT8_C( -10), INT8_C( -20), INT8_C(  -9), INT8_C( -90), INT8_C( 107), INT8_C(   4),
+                           INT8_C(  77), INT8_C( -88), INT8_C( -69), INT8_C(   4), INT8_C(  -9), INT8_C(  -7), INT8_C(  15), INT8_C( -37),
+                           INT8_C( -45), INT8_C( -46), INT8_C(  67), INT8_C( -61), INT8_C( -31), INT8_C(  54), INT8_C(  25), INT8_C( -24),
+                           INT8_C( -64), INT8_C(  70), INT8_C(  -3), INT8_C( -89), INT8_C(  -3), INT8_C(  97), INT8_C( -64), INT8_C( 104),
+                           INT8_C(  40), INT8_C( -33), INT8_C(  36), INT8_C(  76), INT8_C( 126), INT8_C(  -7), INT8_C(  47), INT8_C(  -9),
+                           INT8_C(-103), INT8_C(-125), INT8_C( -30), INT8_C(-103), INT8_C(  43), INT8_C( -90), INT8_C(-118), INT8_C(  35),
+                           INT8_C( -21), INT8_C( -62), INT8_C(  77), INT8_C( -87), INT8_C( -16), INT8_C( -75), INT8_C(-114), INT8_C( -66)),
+      simde_mm512_set_epi8(INT8_C( -30), INT8_C( -29), INT8_C( -34), INT8_C(  53), INT8_C(  41), INT8_C(  95), INT8_C( 115), INT8_C( 120),
+                           INT8_C( -90), INT8_C(  86), INT8_C(  53), INT8_C(  28), INT8_C(  -7), INT8_C(  26), INT8_C(  78), INT8_C( -91),
+                           INT8_C(  31), INT8_C(  74), INT8_C(  22), INT8_C(  -2), INT8_C(   7), INT8_C( 114), INT8_C(  29), INT8_C(  95),
+                           INT8_C( 113), INT8_C( -51), INT8_C( -82), INT8_C(  30), INT8_C(  -4), INT8_C( -34), INT8_C(  91), INT8_C( -24),
+                           INT8_C(-127), INT8_C(  76), INT8_C(   4), INT8_C(  53), INT8_C(  75), INT8_C( 109), INT8_C(-116), INT8_C( -79),
+                           INT8_C(  18), INT8_C( -82), INT8_C(-111), INT8_C( -72), INT8_C(  21), INT8_C( -94), INT8_C(  -7), INT8_C( -62),
+                           INT8_C(-119), INT8_C(  41), INT8_C(   9), INT8_C( -29), INT8_C(  -9), INT8_C( -63), INT8_C(  50), INT8_C(  38),
+                           INT8_C(   3), INT8_C( -74), INT8_C( -74), INT8_C(  51), INT8_C( -54), INT8_C( -92), INT8_C( -68), INT8_C( -97)),
+      simde_mm512_set_epi8(INT8_C( 126), INT8_C(  -6), INT8_C(  51), INT8_C(  17), INT8_C( -15), INT8_C( -11), INT8_C(  33), INT8_C(  91),
+                           INT8_C( 125), INT8_C( 117), INT8_C(  72), INT8_C(  71), INT8_C(  52), INT8_C( 104), INT8_C(-101), INT8_C(  45),
+                           INT8_C(  15), INT8_C(  55), INT8_C(  94), INT8_C( 127), INT8_C(  25), INT8_C(  61), INT8_C(  83), INT8_C(  75),
+                           INT8_C(  88), INT8_C(  24), INT8_C( -81), INT8_C(  59), INT8_C(-115), INT8_C( 120), INT8_C( -33), INT8_C( -12),
+                           INT8_C( -87), INT8_C( -37), INT8_C(  35), INT8_C( 100), INT8_C(  49), INT8_C( -91), INT8_C(  16), INT8_C(-107),
+                           INT8_C( -96), INT8_C( -72), INT8_C( 102), INT8_C( 124), INT8_C(  94), INT8_C( -24), INT8_C( 102), INT8_C(  25),
+                           INT8_C( -52), INT8_C(  39), INT8_C(  90), INT8_C(   6), INT8_C( -74), INT8_C( -68), INT8_C(  48), INT8_C(  57),
+                           INT8_C(  -5), INT8_C( -58), INT8_C( -60), INT8_C(-108), INT8_C( -35), INT8_C(-126), INT8_C(  19), INT8_C( -98)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(-115), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  52), INT8_C(   0),
+                           INT8_C( -46), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  39), INT8_C(  67),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -33), INT8_C(   0), INT8_C( -21), INT8_C(   0), INT8_C(  -3), INT8_C( -87),
+                           INT8_C(-101), INT8_C(  90), INT8_C(   0), INT8_C(  70), INT8_C(  17), INT8_C( -37), INT8_C(  49), INT8_C(   0),
+                           INT8_C(-114), INT8_C(   6), INT8_C( -87), INT8_C( -10), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  -7), INT8_C( -88), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  54), INT8_C(  33), INT8_C(-126),
+                           INT8_C(-118), INT8_C(  15), INT8_C(-118), INT8_C(-115), INT8_C( 125), INT8_C(  19), INT8_C(   0), INT8_C( -46),
+                           INT8_C( -16), INT8_C(  29), INT8_C(   0), INT8_C(  -9), INT8_C( -68), INT8_C(   0), INT8_C(   0), INT8_C( -64)) },
+    { UINT64_C(  413209776926168984),
+      simde_mm512_set_epi8(INT8_C( -40), INT8_C( 122), INT8_C(-126), INT8_C(-112), INT8_C( -98), INT8_C(  95), INT8_C( -70), INT8_C( 127),
+                           INT8_C( 117), INT8_C(  64), INT8_C(  19), INT8_C(-103), INT8_C(  17), INT8_C(  76), INT8_C( -41), INT8_C( -48),
+                           INT8_C( 121), INT8_C( 102), INT8_C(-113), INT8_C( -74), INT8_C(  11), INT8_C(  88), INT8_C( 125), INT8_C( -21),
+                           INT8_C( -98), INT8_C(-111), INT8_C( -33), INT8_C(  66), INT8_C(  22), INT8_C( -98), INT8_C(  45), INT8_C( -80),
+                           INT8_C(  14), INT8_C(  64), INT8_C( -52), INT8_C(  16), INT8_C( 105), INT8_C(  98), INT8_C( -25), INT8_C( -65),
+                           INT8_C(-128), INT8_C(   4), INT8_C( 112), INT8_C(  95), INT8_C( 122), INT8_C(  71), INT8_C(-102), INT8_C(  75),
+                           INT8_C(  29), INT8_C(  58), INT8_C(  51), INT8_C(-126), INT8_C(  84), INT8_C(  96), INT8_C(  48), INT8_C( -86),
+                           INT8_C(  47), INT8_C( -20), INT8_C(   2), INT8_C( -23), INT8_C( -53), INT8_C( -90), INT8_C(  36), INT8_C(  98)),
+      simde_mm512_set_epi8(INT8_C( -29), INT8_C(-100), INT8_C( -96), INT8_C(  71), INT8_C(  77), INT8_C( -38), INT8_C( -14), INT8_C(  28),
+                           INT8_C( -27), INT8_C(  55), INT8_C(  13), INT8_C(  62), INT8_C(  -8), INT8_C( -64), INT8_C( -25), INT8_C(  82),
+                           INT8_C( 121), INT8_C(-110), INT8_C(  -8), INT8_C(  53), INT8_C(-118), INT8_C(-125), INT8_C( -72), INT8_C( -29),
+                           INT8_C(  -7), INT8_C( -52), INT8_C( -17), INT8_C(  93), INT8_C( 123), INT8_C(  31), INT8_C( -22), INT8_C( -74),
+                           INT8_C(-105), INT8_C( -56), INT8_C(  66), INT8_C( 119), INT8_C( -27), INT8_C(-122), INT8_C(  45), INT8_C( -83),
+                           INT8_C( -22), INT8_C(  72), INT8_C(  30), INT8_C(  97), INT8_C(  78), INT8_C(  13), INT8_C(-119), INT8_C( 127),
+                           INT8_C(   0), INT8_C(  -3), INT8_C(  39), INT8_C(-116), INT8_C( -53), INT8_C( -69), INT8_C(   0), INT8_C(  -2),
+                           INT8_C(   9), INT8_C( -53), INT8_C( 127), INT8_C(  -3), INT8_C(  42), INT8_C(  84), INT8_C( 122), INT8_C( -53)),
+      simde_mm512_set_epi8(INT8_C(   8), INT8_C( -89), INT8_C( -84), INT8_C(  72), INT8_C( 109), INT8_C(  -1), INT8_C( -12), INT8_C( 112),
+                           INT8_C( -23), INT8_C( -67), INT8_C( 107), INT8_C( -30), INT8_C( 126), INT8_C( -20), INT8_C(  32), INT8_C(  48),
+                           INT8_C( -60), INT8_C(  -8), INT8_C(   9), INT8_C( -44), INT8_C( -48), INT8_C(  74), INT8_C( -82), INT8_C( 108),
+                           INT8_C( -29), INT8_C(  96), INT8_C(  61), INT8_C(-108), INT8_C(  64), INT8_C( 119), INT8_C( -52), INT8_C( -75),
+                           INT8_C(-112), INT8_C(  59), INT8_C( 111), INT8_C(  -5), INT8_C(  66), INT8_C( -34), INT8_C( -41), INT8_C(-102),
+                           INT8_C(  15), INT8_C(-113), INT8_C( -80), INT8_C( -47), INT8_C( 126), INT8_C(  13), INT8_C(-109), INT8_C(  -3),
+                           INT8_C(  14), INT8_C(  -8), INT8_C(  56), INT8_C( -57), INT8_C( -45), INT8_C( -25), INT8_C( -30), INT8_C( 121),
+                           INT8_C( -75), INT8_C( -92), INT8_C( -74), INT8_C(  19), INT8_C( 106), INT8_C(  78), INT8_C(  64), INT8_C(  -8)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -34), INT8_C(   0), INT8_C(  16),
+                           INT8_C(  61), INT8_C(   0), INT8_C(  51), INT8_C( 122), INT8_C( 112), INT8_C(  -8), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -53), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 111), INT8_C( 109), INT8_C(   0), INT8_C(  74), INT8_C(   0),
+                           INT8_C(   0), INT8_C( 121), INT8_C(   0), INT8_C( -23), INT8_C(   0), INT8_C(   0), INT8_C(-113), INT8_C(-113),
+                           INT8_C(   0), INT8_C( 121), INT8_C(  64), INT8_C(   0), INT8_C(   0), INT8_C(  51), INT8_C(  48), INT8_C(   8),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-126), INT8_C(   0), INT8_C( -98), INT8_C(  98), INT8_C( -89),
+                           INT8_C(  48), INT8_C(   0), INT8_C(   0), INT8_C( -84), INT8_C(  88), INT8_C(   0), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C( 9837682717086476383),
+      simde_mm512_set_epi8(INT8_C(-126), INT8_C(  49), INT8_C( -68), INT8_C(  55), INT8_C(  20), INT8_C(  -3), INT8_C(  15), INT8_C( -99),
+                           INT8_C( -55), INT8_C( -40), INT8_C( -23), INT8_C(-108), INT8_C( -74), INT8_C(-103), INT8_C(-110), INT8_C( -72),
+                           INT8_C(  77), INT8_C(   0), INT8_C( -57), INT8_C( -25), INT8_C(-114), INT8_C(  98), INT8_C(  80), INT8_C(  24),
+                           INT8_C(  54), INT8_C(-102), INT8_C( 111), INT8_C(  80), INT8_C( -89), INT8_C(  39), INT8_C(  15), INT8_C( -57),
+                           INT8_C( 109), INT8_C(-101), INT8_C(  56), INT8_C(-119), INT8_C(-108), INT8_C(  -8), INT8_C(  11), INT8_C( -48),
+                           INT8_C( -16), INT8_C( -57), INT8_C(   8), INT8_C( 101), INT8_C(   8), INT8_C( 114), INT8_C( -20), INT8_C(   8),
+                           INT8_C( -53), INT8_C( -77), INT8_C(  91), INT8_C( -93), INT8_C( -22), INT8_C( 119), INT8_C(   0), INT8_C(   8),
+                           INT8_C( -27), INT8_C( -31), INT8_C(-119), INT8_C(   4), INT8_C(  35), INT8_C(-103), INT8_C(  63), INT8_C( -73)),
+      simde_mm512_set_epi8(INT8_C( -49), INT8_C(  91), INT8_C(   4), INT8_C( 111), INT8_C(  28), INT8_C(  -5), INT8_C( -64), INT8_C(-112),
+                           INT8_C(  39), INT8_C( -52), INT8_C( -78), INT8_C(  44), INT8_C(  -3), INT8_C( 123), INT8_C(  60), INT8_C( -87),
+                           INT8_C(   4), INT8_C(  98), INT8_C( -65), INT8_C( -95), INT8_C(  71), INT8_C(-117), INT8_C(  31), INT8_C(  87),
+                           INT8_C(  84), INT8_C( -74), INT8_C(  81), INT8_C(  -8), INT8_C( 117), INT8_C( 109), INT8_C(  63), INT8_C( 105),
+                           INT8_C(  82), INT8_C( -20), INT8_C(  87), INT8_C(  48), INT8_C(  40), INT8_C(-109), INT8_C(  61), INT8_C(-110),
+                           INT8_C(  45), INT8_C(  -4), INT8_C( -10), INT8_C(  83), INT8_C(  89), INT8_C( -66), INT8_C(  25), INT8_C( -31),
+                           INT8_C(  75), INT8_C( -39), INT8_C(  29), INT8_C(  30), INT8_C(  80), INT8_C( -39), INT8_C(-125), INT8_C(  39),
+                           INT8_C( -44), INT8_C(  -9), INT8_C(  -8), INT8_C( -36), INT8_C(-127), INT8_C( -32), INT8_C( -78), INT8_C( -62)),
+      simde_mm512_set_epi8(INT8_C(-105), INT8_C( -57), INT8_C( -15), INT8_C( -81), INT8_C(  42), INT8_C( -88), INT8_C( -44), INT8_C(  55),
+                           INT8_C( -46), INT8_C( -75), INT8_C( 110), INT8_C(  75), INT8_C(  19), INT8_C(-113), INT8_C(  37), INT8_C(  61),
+                           INT8_C(  -5), INT8_C(-108), INT8_C(-107), INT8_C(-120), INT8_C(  24), INT8_C(  34), INT8_C( -54), INT8_C( -88),
+                           INT8_C( 119), INT8_C(-100), INT8_C(-104), INT8_C( -48), INT8_C( -43), INT8_C( -52), INT8_C(  80), INT8_C(   8),
+                           INT8_C( -19), INT8_C(-125), INT8_C( -17), INT8_C( 122), INT8_C(  42), INT8_C(  49), INT8_C(  63), INT8_C( -73),
+                           INT8_C(-118), INT8_C(  23), INT8_C( 102), INT8_C(-115), INT8_C( 118), INT8_C( -52), INT8_C(  83), INT8_C(  81),
+                           INT8_C( 121), INT8_C(  -5), INT8_C(  -6), INT8_C(  18), INT8_C( 121), INT8_C(  78), INT8_C( -13), INT8_C( 119),
+                           INT8_C(  58), INT8_C( -10), INT8_C(  66), INT8_C( 127), INT8_C( -94), INT8_C(   2), INT8_C(  19), INT8_C(  17)),
+      simde_mm512_set_epi8(INT8_C( 121), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-119), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  54), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  42), INT8_C(  55), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -52), INT8_C(-126), INT8_C(  15), INT8_C(  58), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -40), INT8_C(   0), INT8_C(   0), INT8_C( 110), INT8_C(-107), INT8_C(-126), INT8_C( -54),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -72), INT8_C(   0), INT8_C(   8), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -57), INT8_C( -81), INT8_C( -75), INT8_C( 118), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(  63), INT8_C(  56), INT8_C(   0), INT8_C(  81), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -46), INT8_C(   0), INT8_C( 122), INT8_C(  63), INT8_C(   8), INT8_C(-103), INT8_C(   2)) },
+    { UINT64_C(16342297992250944775),
+      simde_mm512_set_epi8(INT8_C( -91), INT8_C(  49), INT8_C( -59), INT8_C( -61), INT8_C(-118), INT8_C(-128), INT8_C( -17), INT8_C( -64),
+                           INT8_C(  94), INT8_C( -47), INT8_C(  36), INT8_C(-122), INT8_C(  68), INT8_C( -31), INT8_C(  41), INT8_C(  18),
+                           INT8_C(   8), INT8_C(  26), INT8_C(  34), INT8_C(  92), INT8_C(  64), INT8_C(  39), INT8_C(  61), INT8_C( 104),
+                           INT8_C(  24), INT8_C(  69), INT8_C( -13), INT8_C( -66), INT8_C(   3), INT8_C(  92), INT8_C(-108), INT8_C(  64),
+                           INT8_C( -33), INT8_C(-108), INT8_C( 123), INT8_C( -16), INT8_C(  88), INT8_C( -75), INT8_C( -11), INT8_C(  42),
+                           INT8_C(  -3), INT8_C(  80), INT8_C(  -5), INT8_C(  60), INT8_C(  95), INT8_C( 114), INT8_C(  77), INT8_C( -15),
+                           INT8_C(-102), INT8_C(  52), INT8_C(  27), INT8_C( 126), INT8_C(  -9), INT8_C(  72), INT8_C( -32), INT8_C( 113),
+                           INT8_C(  76), INT8_C( -55), INT8_C( -14), INT8_C( 116), INT8_C(  69), INT8_C(  86), INT8_C( 127), INT8_C(  79)),
+      simde_mm512_set_epi8(INT8_C(-109), INT8_C(  17), INT8_C(  51), INT8_C( -94), INT8_C(-111), INT8_C( -55), INT8_C( 107), INT8_C(  82),
+                           INT8_C(-101), INT8_C(  -5), INT8_C( -98), INT8_C(  82), INT8_C(   4), INT8_C( -66), INT8_C(  66), INT8_C(  86),
+                           INT8_C( -81), INT8_C( -64), INT8_C(  76), INT8_C( -45), INT8_C(  55), INT8_C(-113), INT8_C(-112), INT8_C( -73),
+                           INT8_C( 100), INT8_C( -24), INT8_C(  78), INT8_C(-110), INT8_C( -35), INT8_C(  69), INT8_C(  -5), INT8_C(   1),
+                           INT8_C( -37), INT8_C(  44), INT8_C( 122), INT8_C( -76), INT8_C( -69), INT8_C(-112), INT8_C( -20), INT8_C( -40),
+                           INT8_C(  67), INT8_C( -17), INT8_C(  35), INT8_C(  52), INT8_C( 116), INT8_C( -46), INT8_C(  84), INT8_C( 112),
+                           INT8_C( -78), INT8_C(  22), INT8_C(  61), INT8_C( -97), INT8_C( 107), INT8_C( 114), INT8_C( -87), INT8_C( -29),
+                           INT8_C( -45), INT8_C(  71), INT8_C( -57), INT8_C(  86), INT8_C(-116), INT8_C( 104), INT8_C(  30), INT8_C(  31)),
+      simde_mm512_set_epi8(INT8_C(  96), INT8_C( -75), INT8_C( 127), INT8_C(-117), INT8_C(  13), INT8_C(  -1), INT8_C( 124), INT8_C(  63),
+                           INT8_C( -52), INT8_C(  60), INT8_C(  40), INT8_C(  70), INT8_C( -87), INT8_C( -83), INT8_C( -48), INT8_C(  95),
+                           INT8_C( -60), INT8_C(  11), INT8_C( -20), INT8_C(  54), INT8_C(  96), INT8_C( -71), INT8_C(  89), INT8_C( -20),
+                           INT8_C(   1), INT8_C(-110), INT8_C(-122), INT8_C(-110), INT8_C( 111), INT8_C(-125), INT8_C( -58), INT8_C(  96),
+                           INT8_C( -80), INT8_C( -79), INT8_C(-128), INT8_C(  77), INT8_C(-127), INT8_C( -60), INT8_C(  68), INT8_C( -87),
+                           INT8_C(  49), INT8_C( -91), INT8_C(  23), INT8_C(-127), INT8_C( 100), INT8_C( -78), INT8_C(  19), INT8_C(  79),
+                           INT8_C( -44), INT8_C(  62), INT8_C(  16), INT8_C(  47), INT8_C( -95), INT8_C( -10), INT8_C(   8), INT8_C( -34),
+                           INT8_C( -30), INT8_C( -66), INT8_C( -68), INT8_C( -20), INT8_C(  81), INT8_C( -46), INT8_C( 109), INT8_C(   4)),
+      simde_mm512_set_epi8(INT8_C(  95), INT8_C(  77), INT8_C(  68), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  96), INT8_C(   0),
+                           INT8_C(  88), INT8_C(  13), INT8_C(   0), INT8_C(   0), INT8_C( 116), INT8_C(   0), INT8_C( -46), INT8_C( -91),
+                           INT8_C(   8), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  94),
+                           INT8_C(   0), INT8_C( -20), INT8_C(  62), INT8_C( 114), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(  92), INT8_C(   0), INT8_C(-122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -87),
+                           INT8_C(  81), INT8_C(   0), INT8_C(   3), INT8_C(-122), INT8_C(   0), INT8_C(   0), INT8_C(-127), INT8_C(   0),
+                           INT8_C(   0), INT8_C(  80), INT8_C( -59), INT8_C(   0), INT8_C(  96), INT8_C( -83), INT8_C(   0), INT8_C( 111),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -20), INT8_C(-108), INT8_C( -33)) },
+    { UINT64_C( 7876912953615037264),
+      simde_mm512_set_epi8(INT8_C(  51), INT8_C(  81), INT8_C(  40), INT8_C(   4), INT8_C(  66), INT8_C( -61), INT8_C(  26), INT8_C( -13),
+                           INT8_C( -80), INT8_C(   8), INT8_C( 117), INT8_C( -58), INT8_C(-106), INT8_C(  55), INT8_C(  15), INT8_C( -20),
+                           INT8_C(  27), INT8_C( -93), INT8_C(  59), INT8_C(  30), INT8_C( -26), INT8_C(  78), INT8_C(  15), INT8_C( 114),
+                           INT8_C( -36), INT8_C(  10), INT8_C(-111), INT8_C(   0), INT8_C( 115), INT8_C( -93), INT8_C(  25), INT8_C(  64),
+                           INT8_C( -61), INT8_C( -23), INT8_C( -60), INT8_C( -55), INT8_C( -77), INT8_C(  85), INT8_C( -93), INT8_C( -57),
+                           INT8_C(-127), INT8_C( -56), INT8_C( -49), INT8_C( 101), INT8_C(  86), INT8_C(-122), INT8_C(  75), INT8_C(  17),
+                           INT8_C(   8), INT8_C( 112), INT8_C( -82), INT8_C( -59), INT8_C(-122), INT8_C( -93), INT8_C(  46), INT8_C(  13),
+                           INT8_C(  19), INT8_C(  97), INT8_C(  96), INT8_C(   5), INT8_C( -64), INT8_C(  16), INT8_C( -88), INT8_C(  29)),
+      simde_mm512_set_epi8(INT8_C(  33), INT8_C(  93), INT8_C(  36), INT8_C( 110), INT8_C(  31), INT8_C(-110), INT8_C( 123), INT8_C( -52),
+                           INT8_C( -32), INT8_C( -79), INT8_C(  68), INT8_C(  78), INT8_C(   9), INT8_C( -16), INT8_C(  15), INT8_C(  82),
+                           INT8_C( -62), INT8_C( -41), INT8_C( -66), INT8_C(   7), INT8_C( -45), INT8_C(  72), INT8_C( -52), INT8_C(  74),
+                           INT8_C( -92), INT8_C(  57), INT8_C( -91), INT8_C(-100), INT8_C( -62), INT8_C( -56), INT8_C(  20), INT8_C( -93),
+                           INT8_C( -82), INT8_C( -81), INT8_C( 120), INT8_C( -93), INT8_C( -31), INT8_C(  80), INT8_C( -55), INT8_C( 113),
+                           INT8_C(-108), INT8_C(  64), INT8_C(  34), INT8_C(  29), INT8_C( -41), INT8_C(  82), INT8_C(  94), INT8_C( -52),
+                           INT8_C( -80), INT8_C(-122), INT8_C(  89), INT8_C(  31), INT8_C(  47), INT8_C( 125), INT8_C(  37), INT8_C(   6),
+                           INT8_C(  16), INT8_C(  68), INT8_C(  48), INT8_C( -96), INT8_C(  25), INT8_C( -46), INT8_C(  64), INT8_C(   6)),
+      simde_mm512_set_epi8(INT8_C( -48), INT8_C(  40), INT8_C(  71), INT8_C( 116), INT8_C(-122), INT8_C(  67), INT8_C(  62), INT8_C(  44),
+                           INT8_C( -65), INT8_C(   8), INT8_C(  70), INT8_C(  83), INT8_C(-117), INT8_C(  -7), INT8_C(  69), INT8_C(  38),
+                           INT8_C(  41), INT8_C(  64), INT8_C( -30), INT8_C(-124), INT8_C(  59), INT8_C( -74), INT8_C(  -2), INT8_C(  90),
+                           INT8_C(  34), INT8_C(  86), INT8_C( -97), INT8_C( -75), INT8_C(-101), INT8_C( 111), INT8_C( 100), INT8_C(  18),
+                           INT8_C(  54), INT8_C(-125), INT8_C(  49), INT8_C(-109), INT8_C(  80), INT8_C(  57), INT8_C(  92), INT8_C(  42),
+                           INT8_C(  -6), INT8_C(  96), INT8_C( 124), INT8_C( -37), INT8_C(  93), INT8_C( -29), INT8_C( -34), INT8_C(  22),
+                           INT8_C( -49), INT8_C(-110), INT8_C(  83), INT8_C(-127), INT8_C(  65), INT8_C(-106), INT8_C(  58), INT8_C( -93),
+                           INT8_C(   8), INT8_C( 125), INT8_C(-106), INT8_C( -57), INT8_C(  48), INT8_C(  60), INT8_C(  44), INT8_C(  59)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(  49), INT8_C(   0), INT8_C(   0), INT8_C( -61), INT8_C(-122), INT8_C(   0), INT8_C(-127),
+                           INT8_C(   0), INT8_C(  15), INT8_C(   0), INT8_C(-110), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(  -6), INT8_C(  81), INT8_C(   0), INT8_C(  93), INT8_C(   0), INT8_C(-127), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -55), INT8_C(  60), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -93), INT8_C(  27), INT8_C(  44), INT8_C( 115), INT8_C( 100), INT8_C(  22), INT8_C(  58), INT8_C(   0),
+                           INT8_C( 101), INT8_C(  59), INT8_C( -93), INT8_C(   0), INT8_C(   0), INT8_C( -29), INT8_C(   0), INT8_C(-127),
+                           INT8_C( -20), INT8_C(   0), INT8_C(  92), INT8_C( -61), INT8_C(   0), INT8_C(   0), INT8_C(-111), INT8_C(  97),
+                           INT8_C(   0), INT8_C( -57), INT8_C(   0), INT8_C(  64), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C(11782999073667041457),
+      simde_mm512_set_epi8(INT8_C( -36), INT8_C(-119), INT8_C( 112), INT8_C(  -1), INT8_C( -47), INT8_C(  36), INT8_C(-127), INT8_C( -34),
+                           INT8_C( -14), INT8_C( -92), INT8_C(  42), INT8_C(  -8), INT8_C(  75), INT8_C(-116), INT8_C(  84), INT8_C( -73),
+                           INT8_C(  60), INT8_C(-112), INT8_C(-128), INT8_C( -93), INT8_C(  50), INT8_C(-111), INT8_C(-109), INT8_C(-112),
+                           INT8_C( -98), INT8_C( -57), INT8_C( -88), INT8_C(   4), INT8_C( 108), INT8_C( 123), INT8_C( 126), INT8_C( 108),
+                           INT8_C(  48), INT8_C(  53), INT8_C( -21), INT8_C( 110), INT8_C(-110), INT8_C( -13), INT8_C(  29), INT8_C(-105),
+                           INT8_C(-110), INT8_C( -10), INT8_C( -97), INT8_C(  64), INT8_C( -44), INT8_C(  -2), INT8_C(  24), INT8_C( 103),
+                           INT8_C( -22), INT8_C( 102), INT8_C( -75), INT8_C(  67), INT8_C(  -1), INT8_C( -77), INT8_C(-124), INT8_C( -18),
+                           INT8_C(-121), INT8_C( -98), INT8_C( -13), INT8_C(-109), INT8_C(-104), INT8_C( 114), INT8_C( -84), INT8_C(  54)),
+      simde_mm512_set_epi8(INT8_C( -55), INT8_C( -34), INT8_C(  76), INT8_C(  55), INT8_C( -37), INT8_C(  71), INT8_C(  46), INT8_C( -84),
+                           INT8_C( -73), INT8_C( -25), INT8_C( -11), INT8_C( -64), INT8_C(  81), INT8_C( -79), INT8_C( -37), INT8_C( -37),
+                           INT8_C(  54), INT8_C( -25), INT8_C(-104), INT8_C( -94), INT8_C(  54), INT8_C(-119), INT8_C( -76), INT8_C( 115),
+                           INT8_C(-116), INT8_C(  31), INT8_C(-105), INT8_C(  -5), INT8_C(-110), INT8_C( 109), INT8_C(   3), INT8_C(  53),
+                           INT8_C(  22), INT8_C( -89), INT8_C(  37), INT8_C( -67), INT8_C( -37), INT8_C( -82), INT8_C(  -3), INT8_C(  15),
+                           INT8_C(  -8), INT8_C(  57), INT8_C(  20), INT8_C(-103), INT8_C(  49), INT8_C(   3), INT8_C(  16), INT8_C( -82),
+                           INT8_C(  37), INT8_C( -99), INT8_C( -90), INT8_C(  65), INT8_C( -54), INT8_C( -57), INT8_C(  70), INT8_C( -29),
+                           INT8_C( -68), INT8_C( -18), INT8_C(  72), INT8_C( -12), INT8_C(   9), INT8_C(  39), INT8_C( 127), INT8_C(  93)),
+      simde_mm512_set_epi8(INT8_C(-123), INT8_C(  85), INT8_C(  62), INT8_C(-125), INT8_C( -91), INT8_C( -87), INT8_C(  59), INT8_C(   7),
+                           INT8_C( -76), INT8_C(  48), INT8_C(  28), INT8_C(-114), INT8_C(  55), INT8_C( -72), INT8_C( -78), INT8_C( -30),
+                           INT8_C(   2), INT8_C( -26), INT8_C(  61), INT8_C(-111), INT8_C( 110), INT8_C(  52), INT8_C( -99), INT8_C(-103),
+                           INT8_C(  82), INT8_C(  11), INT8_C(  -4), INT8_C( 115), INT8_C(   6), INT8_C( -80), INT8_C( -52), INT8_C(  65),
+                           INT8_C( -58), INT8_C( -88), INT8_C( -87), INT8_C(  75), INT8_C(  86), INT8_C( -41), INT8_C(  92), INT8_C(  -8),
+                           INT8_C(  -8), INT8_C(  38), INT8_C(-122), INT8_C( -96), INT8_C( -92), INT8_C(   8), INT8_C(  67), INT8_C( -65),
+                           INT8_C( -35), INT8_C(  85), INT8_C(  40), INT8_C( -37), INT8_C( -95), INT8_C( 115), INT8_C(  76), INT8_C( -90),
+                           INT8_C(  12), INT8_C(  59), INT8_C(   7), INT8_C( -18), INT8_C(-105), INT8_C(  13), INT8_C(-117), INT8_C( -15)),
+      simde_mm512_set_epi8(INT8_C(  76), INT8_C(   0), INT8_C( -37), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-112), INT8_C( -93),
+                           INT8_C( -14), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  84), INT8_C(   0), INT8_C(  86),
+                           INT8_C( -92), INT8_C(   0), INT8_C(   0), INT8_C( 123), INT8_C( -92), INT8_C(-124), INT8_C(  -8), INT8_C(  55),
+                           INT8_C(   0), INT8_C(   0), INT8_C(-110), INT8_C( -91), INT8_C(  -2), INT8_C(   0), INT8_C(-104), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -98), INT8_C( -88), INT8_C( 112), INT8_C(  86), INT8_C(-112), INT8_C(  62), INT8_C(   0),
+                           INT8_C(   7), INT8_C(   0), INT8_C(  64), INT8_C(   0), INT8_C(  84), INT8_C(-104), INT8_C( 103), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -21), INT8_C(   0), INT8_C(   0), INT8_C( 115), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  -1), INT8_C(   0), INT8_C( -90), INT8_C(-114), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -87)) },
+    { UINT64_C( 3594423290208199816),
+      simde_mm512_set_epi8(INT8_C(  45), INT8_C(-103), INT8_C(   8), INT8_C(  87), INT8_C(  64), INT8_C( -76), INT8_C( -81), INT8_C(  33),
+                           INT8_C(  41), INT8_C(  51), INT8_C( 122), INT8_C(-108), INT8_C( 102), INT8_C(  22), INT8_C( -84), INT8_C(  57),
+                           INT8_C( -85), INT8_C(  44), INT8_C( 119), INT8_C( 119), INT8_C( -95), INT8_C(  97), INT8_C(  64), INT8_C( -72),
+                           INT8_C(-105), INT8_C( -22), INT8_C( -97), INT8_C(  37), INT8_C( -95), INT8_C(  52), INT8_C(  59), INT8_C(  78),
+                           INT8_C( -85), INT8_C( -14), INT8_C( -24), INT8_C( -16), INT8_C(  10), INT8_C( -76), INT8_C(-127), INT8_C(  76),
+                           INT8_C( -28), INT8_C( -35), INT8_C( -10), INT8_C(  73), INT8_C(  58), INT8_C(  17), INT8_C(  32), INT8_C(  12),
+                           INT8_C( 119), INT8_C( 124), INT8_C( -74), INT8_C( -89), INT8_C(  34), INT8_C( -51), INT8_C(  46), INT8_C(  80),
+                           INT8_C(  58), INT8_C( -34), INT8_C( -60), INT8_C( -32), INT8_C(  88), INT8_C(  23), INT8_C(  24), INT8_C(  96)),
+      simde_mm512_set_epi8(INT8_C(  44), INT8_C( 126), INT8_C(  93), INT8_C( -20), INT8_C(  15), INT8_C( -16), INT8_C(  85), INT8_C(  89),
+                           INT8_C( -33), INT8_C( -42), INT8_C( -21), INT8_C( -27), INT8_C(  64), INT8_C(  81), INT8_C( -33), INT8_C(  39),
+                           INT8_C(  56), INT8_C(-122), INT8_C(  72), INT8_C(  50), INT8_C(  -2), INT8_C(  63), INT8_C(  80), INT8_C(  71),
+                           INT8_C( 117), INT8_C( -59), INT8_C(  50), INT8_C(  38), INT8_C(  36), INT8_C( -40), INT8_C(   1), INT8_C(   5),
+                           INT8_C(  26), INT8_C( -52), INT8_C(-120), INT8_C( -46), INT8_C( -41), INT8_C( -91), INT8_C( -19), INT8_C(  31),
+                           INT8_C( -92), INT8_C(  12), INT8_C( -53), INT8_C(-123), INT8_C(   5), INT8_C( -77), INT8_C( 119), INT8_C( -16),
+                           INT8_C(   2), INT8_C( -68), INT8_C( -50), INT8_C(   9), INT8_C(  87), INT8_C(  27), INT8_C(  73), INT8_C( -93),
+                           INT8_C(-125), INT8_C(-120), INT8_C( 106), INT8_C( 117), INT8_C(  10), INT8_C(-124), INT8_C(  46), INT8_C(  63)),
+      simde_mm512_set_epi8(INT8_C(  90), INT8_C(  34), INT8_C(  26), INT8_C(-113), INT8_C(  73), INT8_C( -62), INT8_C( -67), INT8_C( 114),
+                           INT8_C( -81), INT8_C( -40), INT8_C( 105), INT8_C( -34), INT8_C(-109), INT8_C(  94), INT8_C(  86), INT8_C(  94),
+                           INT8_C(  75), INT8_C(-114), INT8_C(  75), INT8_C(  60), INT8_C( 117), INT8_C( 107), INT8_C(  69), INT8_C(-107),
+                           INT8_C(-103), INT8_C(  53), INT8_C( -20), INT8_C( 121), INT8_C( 114), INT8_C(  31), INT8_C( -54), INT8_C(  65),
+                           INT8_C(  76), INT8_C( 108), INT8_C( -77), INT8_C(  68), INT8_C( -46), INT8_C( -96), INT8_C( -83), INT8_C(-102),
+                           INT8_C(-100), INT8_C(  84), INT8_C(-121), INT8_C( -45), INT8_C( -46), INT8_C(  43), INT8_C( -73), INT8_C( -75),
+                           INT8_C( -19), INT8_C( -12), INT8_C(  94), INT8_C( 110), INT8_C(-127), INT8_C(  21), INT8_C(  32), INT8_C( -12),
+                           INT8_C(  81), INT8_C(  88), INT8_C(  25), INT8_C(   9), INT8_C( -90), INT8_C(  55), INT8_C( -61), INT8_C( -77)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C( -77), INT8_C(  60), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -83),
+                           INT8_C(  76), INT8_C(  84), INT8_C( 117), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-105),
+                           INT8_C(  33), INT8_C( -34), INT8_C( -12), INT8_C(  22), INT8_C(   0), INT8_C(  45), INT8_C(   0), INT8_C(   0),
+                           INT8_C( 105), INT8_C(  25), INT8_C(  22), INT8_C( -22), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  80), INT8_C(  43), INT8_C(-100), INT8_C(   0), INT8_C(   0), INT8_C( -85),
+                           INT8_C(   0), INT8_C( -89), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -12), INT8_C(   0), INT8_C(   0), INT8_C(  10), INT8_C(   0), INT8_C(   0),
+                           INT8_C(  88), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -51), INT8_C(   0), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C(18296193367088842402),
+      simde_mm512_set_epi8(INT8_C(  91), INT8_C( -69), INT8_C( -12), INT8_C(  45), INT8_C(  28), INT8_C(   1), INT8_C( -90), INT8_C(  77),
+                           INT8_C(  41), INT8_C(  62), INT8_C( -54), INT8_C(-118), INT8_C(   4), INT8_C(  34), INT8_C(  65), INT8_C(  15),
+                           INT8_C( -61), INT8_C(  75), INT8_C(  54), INT8_C( -34), INT8_C(-113), INT8_C(  19), INT8_C(-122), INT8_C(-126),
+                           INT8_C(  63), INT8_C( 108), INT8_C( -60), INT8_C(  89), INT8_C( -54), INT8_C(-110), INT8_C(  -3), INT8_C( 120),
+                           INT8_C(  90), INT8_C(  73), INT8_C( 103), INT8_C(-123), INT8_C(-123), INT8_C( -66), INT8_C(-117), INT8_C( -81),
+                           INT8_C(  20), INT8_C(  94), INT8_C(  89), INT8_C(   7), INT8_C(  49), INT8_C( -18), INT8_C( -74), INT8_C(   3),
+                           INT8_C(-105), INT8_C(-102), INT8_C(  62), INT8_C(  67), INT8_C( -64), INT8_C( -55), INT8_C(  71), INT8_C(-116),
+                           INT8_C(  23), INT8_C(  30), INT8_C(  23), INT8_C( 106), INT8_C(-128), INT8_C(  40), INT8_C(-122), INT8_C( -63)),
+      simde_mm512_set_epi8(INT8_C(  53), INT8_C(  81), INT8_C( -59), INT8_C(  15), INT8_C(  33), INT8_C(  45), INT8_C(  39), INT8_C( -45),
+                           INT8_C( -80), INT8_C(  29), INT8_C( -85), INT8_C( -93), INT8_C(   1), INT8_C( 107), INT8_C(-104), INT8_C(  35),
+                           INT8_C( -15), INT8_C(  14), INT8_C(-107), INT8_C(  32), INT8_C(  79), INT8_C(  15), INT8_C( -22), INT8_C(  55),
+                           INT8_C( 117), INT8_C( -66), INT8_C(  16), INT8_C( -57), INT8_C(  -9), INT8_C( -64), INT8_C(-101), INT8_C(  65),
+                           INT8_C( -20), INT8_C( -11), INT8_C( -21), INT8_C( 106), INT8_C(  67), INT8_C( 116), INT8_C(  93), INT8_C(  59),
+                           INT8_C( -25), INT8_C( -71), INT8_C( -63), INT8_C( 119), INT8_C( -77), INT8_C( -70), INT8_C(  90), INT8_C(  79),
+                           INT8_C( 122), INT8_C(  16), INT8_C(  25), INT8_C(  45), INT8_C( -22), INT8_C( -48), INT8_C(  17), INT8_C(  45),
+                           INT8_C( 115), INT8_C( 112), INT8_C( -50), INT8_C(  49), INT8_C(  94), INT8_C(  27), INT8_C(-106), INT8_C(  65)),
+      simde_mm512_set_epi8(INT8_C(-109), INT8_C( 122), INT8_C(-104), INT8_C( -14), INT8_C( 122), INT8_C( -35), INT8_C( -71), INT8_C(-111),
+                           INT8_C( -53), INT8_C( 114), INT8_C( 120), INT8_C( -47), INT8_C(  27), INT8_C(  91), INT8_C(  50), INT8_C( -12),
+                           INT8_C(   7), INT8_C(-122), INT8_C(  48), INT8_C( -52), INT8_C(  80), INT8_C( 117), INT8_C(  89), INT8_C(-121),
+                           INT8_C( -26), INT8_C( -96), INT8_C( 100), INT8_C(  62), INT8_C( -21), INT8_C( -76), INT8_C( -63), INT8_C(  69),
+                           INT8_C( -41), INT8_C( -46), INT8_C( -25), INT8_C(  17), INT8_C(-121), INT8_C( -23), INT8_C( -67), INT8_C( -66),
+                           INT8_C( 106), INT8_C( 116), INT8_C(   0), INT8_C(  63), INT8_C( -49), INT8_C( -75), INT8_C(  15), INT8_C( -31),
+                           INT8_C( -62), INT8_C( -97), INT8_C(  72), INT8_C(  -1), INT8_C(  75), INT8_C( 109), INT8_C(  -9), INT8_C(-114),
+                           INT8_C(-113), INT8_C(  58), INT8_C(  96), INT8_C( -47), INT8_C(   2), INT8_C( 100), INT8_C( -23), INT8_C(  92)),
+      simde_mm512_set_epi8(INT8_C( -54), INT8_C(  15), INT8_C(  96), INT8_C(-105), INT8_C(  -3), INT8_C(  54), INT8_C(   0), INT8_C( -49),
+                           INT8_C(  15), INT8_C( 103), INT8_C(-113), INT8_C(   0), INT8_C(-122), INT8_C(   0), INT8_C(   0), INT8_C( -54),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  89), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 117), INT8_C(   0),
+                           INT8_C( 120), INT8_C( -69), INT8_C(   3), INT8_C(   0), INT8_C( -53), INT8_C(  92), INT8_C(-123), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 117), INT8_C(   0), INT8_C(   0), INT8_C( -25), INT8_C(  28),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -23), INT8_C( -53), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   3), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31), INT8_C( -74), INT8_C(   0),
+                           INT8_C(  27), INT8_C(   0), INT8_C( -97), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  94), INT8_C(   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_permutex2var_epi8(test_vec[i].k, test_vec[i].a, test_vec[i].idx, test_vec[i].b);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_permutexvar_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i idx;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C(  17), INT8_C( -42), INT8_C( -46), INT8_C(  -7), INT8_C(   4), INT8_C( -60), INT8_C(  99), INT8_C(  14),
+                           INT8_C(  84), INT8_C( -33), INT8_C(  87), INT8_C(  51), INT8_C(-111), INT8_C(-126), INT8_C( -90), INT8_C(-125),
+                           INT8_C(-107), INT8_C(  80), INT8_C( -25), INT8_C(  75), INT8_C( -46), INT8_C(  88), INT8_C( 123), INT8_C(  53),
+                           INT8_C( -69), INT8_C( 107), INT8_C(-113), INT8_C(-128), INT8_C( -68), INT8_C(  -3), INT8_C(  55), INT8_C( -38),
+                           INT8_C(  42), INT8_C(  70), INT8_C(  22), INT8_C( -56), INT8_C(  15), INT8_C( -91), INT8_C(  45), INT8_C( -63),
+                           INT8_C( -83), INT8_C(  31), INT8_C( -41), INT8_C( -43), INT8_C(  29), INT8_C( -36), INT8_C( -89), INT8_C(  79),
+                           INT8_C( -64), INT8_C( -12), INT8_C( 126), INT8_C( -86), INT8_C( 108), INT8_C( -30), INT8_C( -98), INT8_C( -14),
+                           INT8_C( -54), INT8_C(-107), INT8_C( -98), INT8_C( -18), INT8_C(-106), INT8_C(-115), INT8_C( -50), INT8_C( -81)),
+      simde_mm512_set_epi8(INT8_C( -47), INT8_C( -58), INT8_C(  41), INT8_C(  48), INT8_C( -48), INT8_C(  97), INT8_C(  33), INT8_C( -65),
+                           INT8_C( 122), INT8_C( -19), INT8_C( -91), INT8_C(  81), INT8_C(  42), INT8_C(  -3), INT8_C(  39), INT8_C( -16),
+                           INT8_C(  11), INT8_C( -51), INT8_C( 117), INT8_C( -25), INT8_C( -52), INT8_C( -94), INT8_C( 117), INT8_C( -37),
+                           INT8_C( 110), INT8_C( -24), INT8_C(-110), INT8_C(  23), INT8_C( -24), INT8_C(  55), INT8_C( 105), INT8_C(  73),
+                           INT8_C( -17), INT8_C( -94), INT8_C( 117), INT8_C(-107), INT8_C(-102), INT8_C(  40), INT8_C(  13), INT8_C( -46),
+                           INT8_C( -56), INT8_C( -42), INT8_C(  83), INT8_C(  82), INT8_C( -18), INT8_C(  18), INT8_C( 118), INT8_C(  -1),
+                           INT8_C( 106), INT8_C(  64), INT8_C(  90), INT8_C(   0), INT8_C( 113), INT8_C(  17), INT8_C( -77), INT8_C(-104),
+                           INT8_C(   9), INT8_C(  20), INT8_C( 118), INT8_C( -20), INT8_C(-101), INT8_C(  36), INT8_C( -24), INT8_C(  72)),
+      simde_mm512_set_epi8(INT8_C( 118), INT8_C( -42), INT8_C(  18), INT8_C(  33), INT8_C( -20), INT8_C( -20), INT8_C( -24), INT8_C(  64),
+                           INT8_C(  82), INT8_C( -17), INT8_C( -56), INT8_C(  42), INT8_C( 118), INT8_C(  36), INT8_C( -24), INT8_C(-101),
+                           INT8_C(  83), INT8_C(  -1), INT8_C( 110), INT8_C( 113), INT8_C(  18), INT8_C( -46), INT8_C( -48), INT8_C( -91),
+                           INT8_C( -48), INT8_C( -52), INT8_C( 106), INT8_C(  72), INT8_C(  48), INT8_C(  41), INT8_C( 122), INT8_C(  40),
+                           INT8_C( -94), INT8_C(  20), INT8_C( -42), INT8_C(-104), INT8_C( 106), INT8_C(-110), INT8_C( 117), INT8_C( -24),
+                           INT8_C( 117), INT8_C( -17), INT8_C( -56), INT8_C(  83), INT8_C( 117), INT8_C(-107), INT8_C( 110), INT8_C( 106),
+                           INT8_C(  72), INT8_C(  81), INT8_C( -58), INT8_C( -94), INT8_C( -25), INT8_C(  55), INT8_C( -94), INT8_C(  -3),
+                           INT8_C(  17), INT8_C(  83), INT8_C( -94), INT8_C( -51), INT8_C( -42), INT8_C(  90), INT8_C(  64), INT8_C(  11)) },
+    { simde_mm512_set_epi8(INT8_C(  41), INT8_C(  75), INT8_C( -11), INT8_C(  46), INT8_C( 101), INT8_C(   4), INT8_C(-106), INT8_C(  58),
+                           INT8_C( -11), INT8_C(   0), INT8_C(-112), INT8_C( -34), INT8_C(  13), INT8_C(-100), INT8_C(  -2), INT8_C(  70),
+                           INT8_C( -48), INT8_C( -42), INT8_C(   0), INT8_C(  70), INT8_C( 121), INT8_C(  58), INT8_C(  82), INT8_C(  98),
+                           INT8_C(  -7), INT8_C(  90), INT8_C(  -3), INT8_C( -92), INT8_C( -42), INT8_C(-121), INT8_C(  24), INT8_C(-109),
+                           INT8_C(-117), INT8_C(  -8), INT8_C( -78), INT8_C( -90), INT8_C( -60), INT8_C( -94), INT8_C(  48), INT8_C(  51),
+                           INT8_C( -52), INT8_C( -27), INT8_C(-115), INT8_C( -42), INT8_C(  67), INT8_C( -99), INT8_C( 100), INT8_C(  59),
+                           INT8_C( -54), INT8_C(  17), INT8_C(-104), INT8_C(  57), INT8_C( 122), INT8_C( -71), INT8_C( 111), INT8_C( -28),
+                           INT8_C( -14), INT8_C( 124), INT8_C( -24), INT8_C(  38), INT8_C(  85), INT8_C( -58), INT8_C( 108), INT8_C(  60)),
+      simde_mm512_set_epi8(INT8_C( -52), INT8_C( -67), INT8_C( -82), INT8_C( -40), INT8_C(  69), INT8_C( -54), INT8_C(  84), INT8_C(  18),
+                           INT8_C( -80), INT8_C( -60), INT8_C( -79), INT8_C( -23), INT8_C( -65), INT8_C(  10), INT8_C(  24), INT8_C( -29),
+                           INT8_C(  25), INT8_C( -97), INT8_C(-125), INT8_C(  94), INT8_C(  61), INT8_C(  50), INT8_C(  24), INT8_C(  19),
+                           INT8_C( 109), INT8_C(-118), INT8_C(  53), INT8_C( 127), INT8_C(  61), INT8_C( 100), INT8_C( -71), INT8_C(  33),
+                           INT8_C( 112), INT8_C(  26), INT8_C(  92), INT8_C(  30), INT8_C(  32), INT8_C( -29), INT8_C(  90), INT8_C(-108),
+                           INT8_C( -44), INT8_C( -22), INT8_C(  86), INT8_C( -22), INT8_C( 122), INT8_C(-116), INT8_C( -60), INT8_C(  28),
+                           INT8_C( -48), INT8_C(  83), INT8_C(  22), INT8_C( -35), INT8_C( -96), INT8_C( -34), INT8_C( -12), INT8_C( -75),
+                           INT8_C(-100), INT8_C( -70), INT8_C(  49), INT8_C( -91), INT8_C(  73), INT8_C(   0), INT8_C(  81), INT8_C(-106)),
+      simde_mm512_set_epi8(INT8_C(  24), INT8_C( -96), INT8_C( -79), INT8_C( -97), INT8_C(  53), INT8_C( -91), INT8_C( -22), INT8_C( -54),
+                           INT8_C( -79), INT8_C(-106), INT8_C(  28), INT8_C(  26), INT8_C(  22), INT8_C(  30), INT8_C( -67), INT8_C( -70),
+                           INT8_C(  28), INT8_C( -22), INT8_C(-106), INT8_C( -70), INT8_C(  84), INT8_C( -54), INT8_C(-116), INT8_C( 100),
+                           INT8_C(  84), INT8_C( -29), INT8_C( -82), INT8_C( 127), INT8_C( -22), INT8_C(-100), INT8_C(-108), INT8_C( 122),
+                           INT8_C( -96), INT8_C(  18), INT8_C(  10), INT8_C(-118), INT8_C( -91), INT8_C( 100), INT8_C( -29), INT8_C( -65),
+                           INT8_C( -35), INT8_C(  53), INT8_C(  22), INT8_C( -22), INT8_C(  73), INT8_C(  92), INT8_C( 127), INT8_C(  69),
+                           INT8_C( -34), INT8_C( -60), INT8_C(-108), INT8_C(  84), INT8_C( -54), INT8_C(  84), INT8_C(  25), INT8_C( 127),
+                           INT8_C(  10), INT8_C( -40), INT8_C(  19), INT8_C(-118), INT8_C(  86), INT8_C( -70), INT8_C(  94), INT8_C( -40)) },
+    { simde_mm512_set_epi8(INT8_C(  32), INT8_C(-127), INT8_C( -82), INT8_C(-108), INT8_C( -35), INT8_C(-109), INT8_C( 102), INT8_C(  61),
+                           INT8_C( -29), INT8_C(  78), INT8_C( -55), INT8_C( -67), INT8_C( -80), INT8_C(  38), INT8_C(-104), INT8_C(  77),
+                           INT8_C( -92), INT8_C(  14), INT8_C( -79), INT8_C( 105), INT8_C( -11), INT8_C(-106), INT8_C(  26), INT8_C(  57),
+                           INT8_C(  29), INT8_C( -74), INT8_C( -21), INT8_C( -46), INT8_C(   1), INT8_C(  33), INT8_C( 100), INT8_C( -16),
+                           INT8_C(-105), INT8_C( -29), INT8_C(  -7), INT8_C(  40), INT8_C( 116), INT8_C( -66), INT8_C(  24), INT8_C(-127),
+                           INT8_C( -43), INT8_C( -83), INT8_C(  48), INT8_C(  72), INT8_C(  83), INT8_C(  98), INT8_C( -10), INT8_C(  45),
+                           INT8_C( 124), INT8_C( -79), INT8_C( -81), INT8_C( -21), INT8_C( -61), INT8_C( -22), INT8_C(-113), INT8_C( -78),
+                           INT8_C( -81), INT8_C( -49), INT8_C( -15), INT8_C(-128), INT8_C( -59), INT8_C(  34), INT8_C(-124), INT8_C(  58)),
+      simde_mm512_set_epi8(INT8_C( 117), INT8_C( -11), INT8_C( -28), INT8_C(  92), INT8_C(  58), INT8_C(  39), INT8_C( -40), INT8_C( 117),
+                           INT8_C( -16), INT8_C(  59), INT8_C(  59), INT8_C( 123), INT8_C(  16), INT8_C( 115), INT8_C(-125), INT8_C( -14),
+                           INT8_C( -29), INT8_C(  97), INT8_C( -46), INT8_C(   4), INT8_C(  39), INT8_C( -18), INT8_C(  29), INT8_C(-119),
+                           INT8_C( -82), INT8_C(  84), INT8_C( -43), INT8_C(  38), INT8_C( -10), INT8_C( 105), INT8_C( -24), INT8_C(  25),
+                           INT8_C( 104), INT8_C( 111), INT8_C( -95), INT8_C(  13), INT8_C(  36), INT8_C( -71), INT8_C( -74), INT8_C(  53),
+                           INT8_C(   8), INT8_C(-112), INT8_C(  13), INT8_C( -53), INT8_C( 125), INT8_C(  47), INT8_C(  70), INT8_C( -72),
+                           INT8_C( -15), INT8_C( -47), INT8_C(  16), INT8_C( 106), INT8_C(  45), INT8_C( -93), INT8_C(  11), INT8_C(  46),
+                           INT8_C(  51), INT8_C( -32), INT8_C( 107), INT8_C(  32), INT8_C(  35), INT8_C(  84), INT8_C( 111), INT8_C( -79)),
+      simde_mm512_set_epi8(INT8_C(  25), INT8_C( 111), INT8_C(  97), INT8_C( -53), INT8_C( -95), INT8_C( 125), INT8_C(  84), INT8_C( -28),
+                           INT8_C( -10), INT8_C( -47), INT8_C(  11), INT8_C( -28), INT8_C( -14), INT8_C(  84), INT8_C(  53), INT8_C(  16),
+                           INT8_C(  38), INT8_C( -47), INT8_C(-125), INT8_C(  29), INT8_C(  59), INT8_C(-112), INT8_C( -71), INT8_C( -40),
+                           INT8_C( -95), INT8_C(  59), INT8_C(  39), INT8_C(  47), INT8_C( 111), INT8_C( -24), INT8_C(  38), INT8_C( -14),
+                           INT8_C(   8), INT8_C( -10), INT8_C( -40), INT8_C(-119), INT8_C( 123), INT8_C( -11), INT8_C(  53), INT8_C( 111),
+                           INT8_C(  13), INT8_C( -46), INT8_C( -14), INT8_C(  46), INT8_C( 125), INT8_C( 105), INT8_C(  59), INT8_C( -46),
+                           INT8_C(  92), INT8_C(-125), INT8_C( -29), INT8_C(  39), INT8_C(  35), INT8_C( -18), INT8_C( -15), INT8_C( 115),
+                           INT8_C( -29), INT8_C( -15), INT8_C(-125), INT8_C( -79), INT8_C( 107), INT8_C( 105), INT8_C(  32), INT8_C(  39)) },
+    { simde_mm512_set_epi8(INT8_C( 122), INT8_C(  18), INT8_C( -46), INT8_C(-128), INT8_C( -86), INT8_C(   4), INT8_C( -91), INT8_C(  -7),
+                           INT8_C(  35), INT8_C( -21), INT8_C( -36), INT8_C(-111), INT8_C( -15), INT8_C( -54), INT8_C(  10), INT8_C( -20),
+                           INT8_C(  32), INT8_C(   1), INT8_C(  84), INT8_C( -93), INT8_C(  83), INT8_C(  89), INT8_C(  61), INT8_C(  22),
+                           INT8_C(  93), INT8_C( -69), INT8_C(-117), INT8_C(-120), INT8_C( -57), INT8_C(  57), INT8_C(-115), INT8_C(  12),
+                           INT8_C( -80), INT8_C(  12), INT8_C( 114), INT8_C( -25), INT8_C(  16), INT8_C( 104), INT8_C( -54), INT8_C( -39),
+                           INT8_C(  33), INT8_C(  43), INT8_C(  24), INT8_C(  49), INT8_C( -39), INT8_C(  43), INT8_C( -83), INT8_C(  67),
+                           INT8_C(  12), INT8_C( -32), INT8_C(-103), INT8_C(   8), INT8_C(  42), INT8_C( -48), INT8_C( 105), INT8_C(-112),
+                           INT8_C(  -9), INT8_C(  81), INT8_C( 126), INT8_C(-120), INT8_C( -91), INT8_C( -95), INT8_C(  42), INT8_C(-123)),
+      simde_mm512_set_epi8(INT8_C(  61), INT8_C( -73), INT8_C( -64), INT8_C(  19), INT8_C( -96), INT8_C( 110), INT8_C( -96), INT8_C( -81),
+                           INT8_C( -81), INT8_C( 108), INT8_C( -78), INT8_C( 103), INT8_C(-124), INT8_C(-124), INT8_C(  93), INT8_C(  85),
+                           INT8_C(  48), INT8_C(  48), INT8_C(  26), INT8_C(  97), INT8_C(  97), INT8_C( -73), INT8_C(-123), INT8_C( -34),
+                           INT8_C( 104), INT8_C(  70), INT8_C(  46), INT8_C(  15), INT8_C( 127), INT8_C( -41), INT8_C( -10), INT8_C( -13),
+                           INT8_C(  46), INT8_C(  10), INT8_C(-109), INT8_C( 106), INT8_C( -76), INT8_C( 111), INT8_C(  71), INT8_C(  61),
+                           INT8_C( -48), INT8_C(  81), INT8_C(-120), INT8_C( -49), INT8_C(  -5), INT8_C(   4), INT8_C(  -2), INT8_C( -64),
+                           INT8_C( 127), INT8_C(  -3), INT8_C(  44), INT8_C( -93), INT8_C( -34), INT8_C(  88), INT8_C(  75), INT8_C(-105),
+                           INT8_C( -92), INT8_C( -99), INT8_C(  63), INT8_C( -62), INT8_C(  91), INT8_C(  34), INT8_C( -14), INT8_C( -14)),
+      simde_mm512_set_epi8(INT8_C( 110), INT8_C(   4), INT8_C(   4), INT8_C( -14), INT8_C( -73), INT8_C( -62), INT8_C(  46), INT8_C( -96),
+                           INT8_C( 127), INT8_C(  97), INT8_C( 106), INT8_C(  -2), INT8_C(  93), INT8_C(  88), INT8_C(  88), INT8_C(  97),
+                           INT8_C( -13), INT8_C( -14), INT8_C( -49), INT8_C( 127), INT8_C(  -5), INT8_C(  71), INT8_C( -64), INT8_C(  81),
+                           INT8_C(-109), INT8_C( -96), INT8_C( -34), INT8_C(-105), INT8_C( -92), INT8_C( -96), INT8_C(  44), INT8_C( -93),
+                           INT8_C(  85), INT8_C( -93), INT8_C(-124), INT8_C( 104), INT8_C( -64), INT8_C( -34), INT8_C(  88), INT8_C(  71),
+                           INT8_C( -10), INT8_C(  97), INT8_C(  61), INT8_C(  93), INT8_C(  71), INT8_C(  97), INT8_C(  26), INT8_C(  91),
+                           INT8_C( -93), INT8_C( -13), INT8_C(  71), INT8_C(-105), INT8_C( -73), INT8_C( -64), INT8_C(-123), INT8_C( -64),
+                           INT8_C( -81), INT8_C(  -2), INT8_C( -73), INT8_C(-105), INT8_C(  46), INT8_C( -10), INT8_C( -73), INT8_C(  63)) },
+    { simde_mm512_set_epi8(INT8_C(  28), INT8_C(  31), INT8_C( -69), INT8_C( -31), INT8_C(  -2), INT8_C( -34), INT8_C( -89), INT8_C(  90),
+                           INT8_C(  93), INT8_C( -97), INT8_C( -75), INT8_C(  -7), INT8_C( 127), INT8_C( -50), INT8_C( 118), INT8_C(  54),
+                           INT8_C( -41), INT8_C(   5), INT8_C( 120), INT8_C(-114), INT8_C(  26), INT8_C(  32), INT8_C( -20), INT8_C( 110),
+                           INT8_C(  87), INT8_C( 123), INT8_C( -42), INT8_C(  82), INT8_C(  64), INT8_C( -56), INT8_C( -92), INT8_C( -25),
+                           INT8_C( -75), INT8_C(  43), INT8_C(  90), INT8_C(-109), INT8_C( 101), INT8_C(   0), INT8_C(  86), INT8_C( -54),
+                           INT8_C( 116), INT8_C( 106), INT8_C( -77), INT8_C(-110), INT8_C(  78), INT8_C( -24), INT8_C( -58), INT8_C(-121),
+                           INT8_C(-121), INT8_C(  68), INT8_C( -35), INT8_C(  65), INT8_C(-122), INT8_C(  42), INT8_C(  98), INT8_C( -62),
+                           INT8_C( 122), INT8_C( -46), INT8_C(  78), INT8_C(  81), INT8_C(  36), INT8_C( -49), INT8_C( -74), INT8_C(  46)),
+      simde_mm512_set_epi8(INT8_C(  46), INT8_C(-114), INT8_C(  92), INT8_C( -37), INT8_C( 106), INT8_C( -90), INT8_C(  76), INT8_C( 107),
+                           INT8_C(   4), INT8_C( -94), INT8_C( -41), INT8_C(  63), INT8_C(  43), INT8_C(   3), INT8_C(  63), INT8_C(  85),
+                           INT8_C( -56), INT8_C(  -7), INT8_C( -85), INT8_C( -42), INT8_C(-118), INT8_C( 119), INT8_C( 120), INT8_C( -92),
+                           INT8_C(  60), INT8_C( 114), INT8_C( 121), INT8_C( -19), INT8_C( -34), INT8_C(  15), INT8_C( -21), INT8_C( -77),
+                           INT8_C(  24), INT8_C( -73), INT8_C(-101), INT8_C( 114), INT8_C(  31), INT8_C( -24), INT8_C(  69), INT8_C( 121),
+                           INT8_C( -33), INT8_C(  77), INT8_C(  44), INT8_C(  16), INT8_C(  24), INT8_C(  69), INT8_C( -32), INT8_C( -72),
+                           INT8_C(  66), INT8_C( -27), INT8_C(   4), INT8_C( -37), INT8_C(  51), INT8_C(  44), INT8_C( -70), INT8_C(-115),
+                           INT8_C( 108), INT8_C( -47), INT8_C(  -1), INT8_C( -15), INT8_C(  71), INT8_C(  73), INT8_C(-116), INT8_C(-108)),
+      simde_mm512_set_epi8(INT8_C( 114), INT8_C(  24), INT8_C( 106), INT8_C( -21), INT8_C(-114), INT8_C( -73), INT8_C(  60), INT8_C( -24),
+                           INT8_C(-101), INT8_C(  24), INT8_C( -41), INT8_C(  76), INT8_C(  46), INT8_C( -27), INT8_C( -94), INT8_C( -94),
+                           INT8_C( -33), INT8_C(  -1), INT8_C( 107), INT8_C( -27), INT8_C( -24), INT8_C( -77), INT8_C( -42), INT8_C(  -7),
+                           INT8_C( -33), INT8_C( 106), INT8_C(  77), INT8_C(  69), INT8_C(-108), INT8_C(-115), INT8_C( -19), INT8_C(  60),
+                           INT8_C( -41), INT8_C(-118), INT8_C( -24), INT8_C(  24), INT8_C( 121), INT8_C(-108), INT8_C(  77), INT8_C(  44),
+                           INT8_C(  63), INT8_C( 119), INT8_C(  43), INT8_C(  69), INT8_C( -27), INT8_C( -92), INT8_C( -47), INT8_C( 108),
+                           INT8_C( 108), INT8_C( -15), INT8_C(-101), INT8_C(-116), INT8_C( -47), INT8_C( 119), INT8_C(  15), INT8_C(  73),
+                           INT8_C( -90), INT8_C(  69), INT8_C( -27), INT8_C( -32), INT8_C( -19), INT8_C(  66), INT8_C( -94), INT8_C(  -7)) },
+    { simde_mm512_set_epi8(INT8_C(  95), INT8_C(  64), INT8_C(  78), INT8_C(  50), INT8_C( -19), INT8_C(  42), INT8_C(   1), INT8_C(  -6),
+                           INT8_C(  59), INT8_C(  74), INT8_C(  31), INT8_C(  54), INT8_C( -87), INT8_C(  99), INT8_C(-112), INT8_C(  90),
+                           INT8_C( -30), INT8_C( 102), INT8_C(   2), INT8_C( -37), INT8_C( -91), INT8_C( 118), INT8_C(  51), INT8_C(  60),
+                           INT8_C( 106), INT8_C( 124), INT8_C(   2), INT8_C(  15), INT8_C( -23), INT8_C( -78), INT8_C( -50), INT8_C( -31),
+                           INT8_C(  97), INT8_C(-106), INT8_C(  -6), INT8_C(  93), INT8_C(  80), INT8_C( -99), INT8_C( -55), INT8_C( -14),
+                           INT8_C( -26), INT8_C(  83), INT8_C(  -3), INT8_C(  91), INT8_C(-121), INT8_C( 113), INT8_C( 122), INT8_C( -57),
+                           INT8_C( -55), INT8_C(-104), INT8_C(  -7), INT8_C( 100), INT8_C(  73), INT8_C(  13), INT8_C(-128), INT8_C(   7),
+                           INT8_C( -45), INT8_C(   6), INT8_C(  99), INT8_C(  54), INT8_C(  72), INT8_C(  11), INT8_C( 122), INT8_C(  51)),
+      simde_mm512_set_epi8(INT8_C(  98), INT8_C( -16), INT8_C(  37), INT8_C(  -3), INT8_C( -91), INT8_C( 114), INT8_C( -69), INT8_C( -93),
+                           INT8_C(  -7), INT8_C(  60), INT8_C( -63), INT8_C(  59), INT8_C( -66), INT8_C(  20), INT8_C( -13), INT8_C(   5),
+                           INT8_C( -74), INT8_C(  53), INT8_C( 105), INT8_C(-104), INT8_C( -93), INT8_C(  40), INT8_C(   3), INT8_C(-126),
+                           INT8_C( -30), INT8_C(  -8), INT8_C( -75), INT8_C(  33), INT8_C( 110), INT8_C(-127), INT8_C(  65), INT8_C(   0),
+                           INT8_C(  22), INT8_C(   9), INT8_C( 102), INT8_C(  28), INT8_C(  -2), INT8_C( 101), INT8_C(-109), INT8_C( -25),
+                           INT8_C(-109), INT8_C( -63), INT8_C( 113), INT8_C(  35), INT8_C( 114), INT8_C( -78), INT8_C(  11), INT8_C( -16),
+                           INT8_C(  54), INT8_C(  78), INT8_C(-102), INT8_C(  89), INT8_C(  85), INT8_C(  -1), INT8_C( -17), INT8_C( -17),
+                           INT8_C( 105), INT8_C(  74), INT8_C(  27), INT8_C(  46), INT8_C(  84), INT8_C( -67), INT8_C( 107), INT8_C( 121)),
+      simde_mm512_set_epi8(INT8_C(  22), INT8_C( 121), INT8_C(  78), INT8_C(  20), INT8_C( 105), INT8_C(  40), INT8_C( 107), INT8_C( 114),
+                           INT8_C( -91), INT8_C(  -1), INT8_C(  22), INT8_C(  60), INT8_C(   3), INT8_C( 110), INT8_C( -16), INT8_C( 101),
+                           INT8_C(-127), INT8_C(  -8), INT8_C( -67), INT8_C(  -2), INT8_C( -75), INT8_C(  60), INT8_C( -66), INT8_C(  -3),
+                           INT8_C(  40), INT8_C(  -3), INT8_C( -67), INT8_C(  54), INT8_C(   3), INT8_C(  20), INT8_C(  78), INT8_C(  65),
+                           INT8_C(  65), INT8_C( -63), INT8_C( 114), INT8_C( 102), INT8_C( -16), INT8_C( 102), INT8_C( -17), INT8_C(  20),
+                           INT8_C(  -8), INT8_C( 114), INT8_C(  37), INT8_C(  -2), INT8_C( 105), INT8_C( -13), INT8_C( 114), INT8_C( 105),
+                           INT8_C( -17), INT8_C( -25), INT8_C( -69), INT8_C(  33), INT8_C( -17), INT8_C(-102), INT8_C( 121), INT8_C( 105),
+                           INT8_C( 114), INT8_C(  74), INT8_C( 110), INT8_C(  60), INT8_C( -17), INT8_C(  85), INT8_C( 114), INT8_C( -66)) },
+    { simde_mm512_set_epi8(INT8_C( -76), INT8_C( -81), INT8_C( -71), INT8_C( -13), INT8_C(  27), INT8_C(  60), INT8_C(  59), INT8_C(  70),
+                           INT8_C(  48), INT8_C( 114), INT8_C(   8), INT8_C( -51), INT8_C( -23), INT8_C( -85), INT8_C( -87), INT8_C(  20),
+                           INT8_C( -99), INT8_C(  90), INT8_C(-103), INT8_C(   8), INT8_C(-114), INT8_C(-100), INT8_C(  24), INT8_C(  36),
+                           INT8_C(  80), INT8_C(-104), INT8_C(  33), INT8_C(  85), INT8_C(   7), INT8_C( -73), INT8_C( -12), INT8_C(-115),
+                           INT8_C( -65), INT8_C( -32), INT8_C( -79), INT8_C( -73), INT8_C(   8), INT8_C( -59), INT8_C( -56), INT8_C(  93),
+                           INT8_C(   3), INT8_C(  13), INT8_C(  -8), INT8_C(  35), INT8_C(  82), INT8_C( 120), INT8_C(-108), INT8_C(  53),
+                           INT8_C( 103), INT8_C( -69), INT8_C( -28), INT8_C( 100), INT8_C(  53), INT8_C(  62), INT8_C(  70), INT8_C( -72),
+                           INT8_C( 122), INT8_C(  97), INT8_C( -91), INT8_C( -76), INT8_C(  -7), INT8_C( -54), INT8_C( -42), INT8_C(  20)),
+      simde_mm512_set_epi8(INT8_C( -53), INT8_C( -44), INT8_C( -77), INT8_C( -26), INT8_C( -61), INT8_C( -33), INT8_C(  33), INT8_C(  28),
+                           INT8_C(  45), INT8_C(-124), INT8_C(  58), INT8_C( -95), INT8_C(  85), INT8_C(  78), INT8_C(  44), INT8_C(  68),
+                           INT8_C( 124), INT8_C(  96), INT8_C(-101), INT8_C(   5), INT8_C( -45), INT8_C(  80), INT8_C(   9), INT8_C(-105),
+                           INT8_C( -74), INT8_C(  -1), INT8_C( -17), INT8_C( -41), INT8_C( -16), INT8_C( 108), INT8_C(  39), INT8_C( -40),
+                           INT8_C(-116), INT8_C(  80), INT8_C( -38), INT8_C( -14), INT8_C( -68), INT8_C(  63), INT8_C(  74), INT8_C(  76),
+                           INT8_C(  11), INT8_C(-116), INT8_C(-116), INT8_C(-127), INT8_C( -14), INT8_C( -61), INT8_C(  74), INT8_C(-103),
+                           INT8_C( -54), INT8_C(  26), INT8_C(  50), INT8_C(  70), INT8_C( -89), INT8_C(  68), INT8_C( -26), INT8_C(  21),
+                           INT8_C( -79), INT8_C(  85), INT8_C(-109), INT8_C(  -7), INT8_C(  16), INT8_C(  12), INT8_C(  82), INT8_C( -80)),
+      simde_mm512_set_epi8(INT8_C( -95), INT8_C( 124), INT8_C(  33), INT8_C(  85), INT8_C( -68), INT8_C( -26), INT8_C( -61), INT8_C(  85),
+                           INT8_C(  68), INT8_C(  78), INT8_C(  21), INT8_C(  50), INT8_C(   9), INT8_C( -45), INT8_C(   9), INT8_C(-127),
+                           INT8_C( -38), INT8_C(  63), INT8_C(  74), INT8_C(  21), INT8_C(  26), INT8_C( -14), INT8_C(  76), INT8_C( -41),
+                           INT8_C(-103), INT8_C(  76), INT8_C(  39), INT8_C(-116), INT8_C( -79), INT8_C(  45), INT8_C( -95), INT8_C(  50),
+                           INT8_C( -53), INT8_C( -40), INT8_C(  44), INT8_C(  45), INT8_C(  21), INT8_C(-109), INT8_C(  21), INT8_C( -38),
+                           INT8_C(  16), INT8_C(  50), INT8_C(  28), INT8_C( -16), INT8_C( -61), INT8_C(  28), INT8_C(-127), INT8_C(  58),
+                           INT8_C( -74), INT8_C( -61), INT8_C( -41), INT8_C( -41), INT8_C(  58), INT8_C( -44), INT8_C(  85), INT8_C(  28),
+                           INT8_C( -33), INT8_C(  39), INT8_C( -17), INT8_C( -95), INT8_C(  33), INT8_C(  68), INT8_C(-116), INT8_C(-127)) },
+    { simde_mm512_set_epi8(INT8_C(  94), INT8_C(  60), INT8_C( -84), INT8_C(-116), INT8_C( -22), INT8_C( 101), INT8_C( -23), INT8_C(  98),
+                           INT8_C( -59), INT8_C( -95), INT8_C(  14), INT8_C(  88), INT8_C(  60), INT8_C(  37), INT8_C( -20), INT8_C(  58),
+                           INT8_C( 100), INT8_C(-127), INT8_C(  98), INT8_C(  49), INT8_C(  82), INT8_C( -45), INT8_C(   7), INT8_C(  52),
+                           INT8_C( -21), INT8_C(   1), INT8_C( -59), INT8_C(  74), INT8_C( 120), INT8_C( -52), INT8_C(  28), INT8_C(  12),
+                           INT8_C(  63), INT8_C( -22), INT8_C( -17), INT8_C(  93), INT8_C(  73), INT8_C( -98), INT8_C( -93), INT8_C(-117),
+                           INT8_C(  -4), INT8_C(  17), INT8_C(  54), INT8_C( -78), INT8_C(  80), INT8_C(  57), INT8_C( -93), INT8_C( -52),
+                           INT8_C( -21), INT8_C(  89), INT8_C(  41), INT8_C( -73), INT8_C( 126), INT8_C(  84), INT8_C(-111), INT8_C( 110),
+                           INT8_C(  43), INT8_C(-121), INT8_C(   0), INT8_C(  44), INT8_C( -83), INT8_C(  15), INT8_C(  88), INT8_C(  94)),
+      simde_mm512_set_epi8(INT8_C( -21), INT8_C( -63), INT8_C(  99), INT8_C(  25), INT8_C( -19), INT8_C( -13), INT8_C(-119), INT8_C(  26),
+                           INT8_C(  -9), INT8_C(   9), INT8_C(  34), INT8_C(  25), INT8_C(  84), INT8_C( -11), INT8_C(  38), INT8_C(-105),
+                           INT8_C(  52), INT8_C(-113), INT8_C(  11), INT8_C( -97), INT8_C(  31), INT8_C(   7), INT8_C( -56), INT8_C(-122),
+                           INT8_C(-127), INT8_C( -36), INT8_C( -45), INT8_C( -84), INT8_C( -75), INT8_C( 113), INT8_C( -13), INT8_C(  96),
+                           INT8_C( -42), INT8_C( -51), INT8_C( -14), INT8_C( -11), INT8_C(   4), INT8_C( -12), INT8_C(   2), INT8_C( 100),
+                           INT8_C(  65), INT8_C(  67), INT8_C(-105), INT8_C(-104), INT8_C(  33), INT8_C(-109), INT8_C( -88), INT8_C(  52),
+                           INT8_C(-123), INT8_C(  65), INT8_C( 108), INT8_C( 108), INT8_C(  14), INT8_C( -64), INT8_C( -72), INT8_C(  68),
+                           INT8_C(  29), INT8_C( 125), INT8_C( -60), INT8_C( 109), INT8_C( -93), INT8_C(-121), INT8_C(  58), INT8_C(  48)),
+      simde_mm512_set_epi8(INT8_C( -51), INT8_C(  25), INT8_C( -97), INT8_C( 108), INT8_C(   7), INT8_C( -45), INT8_C( -56), INT8_C( 113),
+                           INT8_C( -60), INT8_C( -13), INT8_C(  65), INT8_C( 100), INT8_C(  25), INT8_C( -45), INT8_C( -97), INT8_C( -13),
+                           INT8_C( -84), INT8_C(  58), INT8_C( 113), INT8_C(  38), INT8_C(-109), INT8_C(  33), INT8_C(  29), INT8_C(  25),
+                           INT8_C(  31), INT8_C(  58), INT8_C( -60), INT8_C( -64), INT8_C(  26), INT8_C( 108), INT8_C( -11), INT8_C( 108),
+                           INT8_C( -21), INT8_C(   7), INT8_C(  52), INT8_C( -14), INT8_C( -72), INT8_C( -51), INT8_C( -75), INT8_C(  14),
+                           INT8_C(  25), INT8_C( -88), INT8_C(   9), INT8_C( -11), INT8_C(  52), INT8_C(-119), INT8_C( -75), INT8_C( 108),
+                           INT8_C(  31), INT8_C(   2), INT8_C( -56), INT8_C(  -9), INT8_C( -63), INT8_C(-104), INT8_C( -88), INT8_C(-113),
+                           INT8_C(  31), INT8_C(  29), INT8_C(  48), INT8_C( -97), INT8_C(  11), INT8_C(-123), INT8_C( 100), INT8_C( -51)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_permutexvar_epi8(test_vec[i].idx, test_vec[i].a);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_permutexvar_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask64 k;
+    simde__m512i idx;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi8(INT8_C( -37), INT8_C(-116), INT8_C(  49), INT8_C(  42), INT8_C(  81), INT8_C(  12), INT8_C(  22), INT8_C( -15),
+                           INT8_C(  84), INT8_C(  56), INT8_C( -10), INT8_C( 110), INT8_C( -90), INT8_C( -19), INT8_C( -31), INT8_C( -78),
+                           INT8_C(  -6), INT8_C( -42), INT8_C( -94), INT8_C(  77), INT8_C(   9), INT8_C( -76), INT8_C( -40), INT8_C( -61),
+                           INT8_C(  35), INT8_C(  51), INT8_C( -24), INT8_C(  66), INT8_C( 105), INT8_C(   0), INT8_C( -82), INT8_C(  95),
+                           INT8_C(  15), INT8_C(  65), INT8_C(  82), INT8_C(  54), INT8_C( -16), INT8_C(-116), INT8_C(  94), INT8_C(  35),
+                           INT8_C( 107), INT8_C(-121), INT8_C(-107), INT8_C(-127), INT8_C(-117), INT8_C(  80), INT8_C(-123), INT8_C( 105),
+                           INT8_C(  25), INT8_C( -78), INT8_C(  -3), INT8_C(-125), INT8_C( 113), INT8_C(   5), INT8_C( -72), INT8_C(  89),
+                           INT8_C( -14), INT8_C(  24), INT8_C( -67), INT8_C( -56), INT8_C(   2), INT8_C(  -7), INT8_C( 104), INT8_C(-120)),
+      UINT64_C(12003352789277866275),
+      simde_mm512_set_epi8(INT8_C(-116), INT8_C( -63), INT8_C(  84), INT8_C( 106), INT8_C(  44), INT8_C(-100), INT8_C(  72), INT8_C(  45),
+                           INT8_C( -86), INT8_C( -21), INT8_C( -30), INT8_C(  84), INT8_C( 107), INT8_C( 101), INT8_C(  49), INT8_C( -50),
+                           INT8_C(-116), INT8_C( -98), INT8_C(  13), INT8_C(  28), INT8_C(  45), INT8_C(  90), INT8_C(  91), INT8_C( 120),
+                           INT8_C(  25), INT8_C( -65), INT8_C(   2), INT8_C(  30), INT8_C(  14), INT8_C(-120), INT8_C(  89), INT8_C(  74),
+                           INT8_C(  58), INT8_C( -74), INT8_C( -76), INT8_C( -28), INT8_C( -44), INT8_C( -12), INT8_C( -29), INT8_C( -51),
+                           INT8_C( -50), INT8_C( -10), INT8_C(-128), INT8_C( 127), INT8_C(   4), INT8_C(  63), INT8_C(  52), INT8_C( -92),
+                           INT8_C( -19), INT8_C(  52), INT8_C( -80), INT8_C( -75), INT8_C( 112), INT8_C( -54), INT8_C(  46), INT8_C( -71),
+                           INT8_C(  14), INT8_C( -23), INT8_C( -95), INT8_C(  22), INT8_C( -31), INT8_C(  77), INT8_C(-110), INT8_C(-100)),
+      simde_mm512_set_epi8(INT8_C( 119), INT8_C(  50), INT8_C(-120), INT8_C(-108), INT8_C(  71), INT8_C(  69), INT8_C(  18), INT8_C(-122),
+                           INT8_C(   1), INT8_C( -33), INT8_C( 121), INT8_C( -25), INT8_C(-105), INT8_C( -66), INT8_C( -85), INT8_C(-111),
+                           INT8_C( -16), INT8_C( -40), INT8_C(  10), INT8_C( -49), INT8_C(-113), INT8_C(  56), INT8_C( -12), INT8_C(  57),
+                           INT8_C(-126), INT8_C(-105), INT8_C( -48), INT8_C(  81), INT8_C( 127), INT8_C( -94), INT8_C(-107), INT8_C(-110),
+                           INT8_C( -47), INT8_C(-107), INT8_C(  10), INT8_C( -33), INT8_C( 114), INT8_C(  80), INT8_C(  97), INT8_C(  80),
+                           INT8_C(  -6), INT8_C(-113), INT8_C( -21), INT8_C(  82), INT8_C(  89), INT8_C( 104), INT8_C( -72), INT8_C(  32),
+                           INT8_C( 111), INT8_C(-113), INT8_C(  48), INT8_C( -83), INT8_C( -27), INT8_C( -73), INT8_C( -43), INT8_C(  10),
+                           INT8_C( -76), INT8_C( -76), INT8_C(  36), INT8_C( 127), INT8_C( -31), INT8_C(  40), INT8_C( -37), INT8_C(  -3)),
+      simde_mm512_set_epi8(INT8_C( -83), INT8_C(-116), INT8_C(  82), INT8_C(  42), INT8_C(  81), INT8_C( -33), INT8_C(  10), INT8_C( -15),
+                           INT8_C(  56), INT8_C(  56), INT8_C( -10), INT8_C(  82), INT8_C( -90), INT8_C( -48), INT8_C( -31), INT8_C( -78),
+                           INT8_C(  -6), INT8_C(-107), INT8_C(  48), INT8_C( -33), INT8_C(  10), INT8_C( -76), INT8_C( -40), INT8_C(-122),
+                           INT8_C(  97), INT8_C( 119), INT8_C( -24), INT8_C(  66), INT8_C( 105), INT8_C(   0), INT8_C(  97), INT8_C( -73),
+                           INT8_C(  69), INT8_C( -33), INT8_C( -25), INT8_C(  54), INT8_C(  82), INT8_C( -25), INT8_C( 127), INT8_C(  35),
+                           INT8_C(-113), INT8_C(-121), INT8_C(-107), INT8_C( 119), INT8_C( 127), INT8_C(  80), INT8_C(-123), INT8_C(  81),
+                           INT8_C(  10), INT8_C( -25), INT8_C(-111), INT8_C( 121), INT8_C(-111), INT8_C(   5), INT8_C( -72), INT8_C(  18),
+                           INT8_C( -14), INT8_C(  24), INT8_C(-107), INT8_C( -56), INT8_C(   2), INT8_C(  -7), INT8_C( 104), INT8_C( -33)) },
+    { simde_mm512_set_epi8(INT8_C( -17), INT8_C(-101), INT8_C(  28), INT8_C(-124), INT8_C(  17), INT8_C( -30), INT8_C(  -6), INT8_C( -15),
+                           INT8_C( -31), INT8_C(  53), INT8_C(  57), INT8_C(  78), INT8_C( -96), INT8_C(-113), INT8_C( -47), INT8_C( -46),
+                           INT8_C(  -5), INT8_C( -37), INT8_C(  47), INT8_C(   3), INT8_C(  52), INT8_C(  73), INT8_C(  26), INT8_C( 102),
+                           INT8_C(  28), INT8_C( -35), INT8_C( -46), INT8_C( -49), INT8_C( -92), INT8_C(  81), INT8_C( 126), INT8_C(  26),
+                           INT8_C(  90), INT8_C(  84), INT8_C(  25), INT8_C(-115), INT8_C(-122), INT8_C( -45), INT8_C(-118), INT8_C( -49),
+                           INT8_C(  -4), INT8_C(  30), INT8_C( -63), INT8_C( 124), INT8_C( -26), INT8_C(-119), INT8_C( 114), INT8_C( -86),
+                           INT8_C(  91), INT8_C( -23), INT8_C(  84), INT8_C( -53), INT8_C(-110), INT8_C(   4), INT8_C(  63), INT8_C(-107),
+                           INT8_C(-111), INT8_C( -50), INT8_C( -68), INT8_C(  37), INT8_C(  52), INT8_C(  60), INT8_C( -30), INT8_C(  17)),
+      UINT64_C( 2872758699279526021),
+      simde_mm512_set_epi8(INT8_C( -88), INT8_C(  -6), INT8_C(  89), INT8_C(   6), INT8_C(-107), INT8_C(-126), INT8_C(  19), INT8_C( -67),
+                           INT8_C( -88), INT8_C( -53), INT8_C( -61), INT8_C( -20), INT8_C( -99), INT8_C( -44), INT8_C(  24), INT8_C(-116),
+                           INT8_C( -64), INT8_C(-102), INT8_C( -20), INT8_C(  18), INT8_C(  57), INT8_C(-122), INT8_C(-124), INT8_C( -59),
+                           INT8_C( -20), INT8_C(   9), INT8_C( -87), INT8_C( -70), INT8_C( -62), INT8_C(-111), INT8_C(  26), INT8_C( -16),
+                           INT8_C( 110), INT8_C( -48), INT8_C( 101), INT8_C( 102), INT8_C( -38), INT8_C(  19), INT8_C(  32), INT8_C( -15),
+                           INT8_C( -21), INT8_C( -71), INT8_C(  15), INT8_C( -90), INT8_C(  53), INT8_C(-124), INT8_C(  24), INT8_C( -64),
+                           INT8_C(  80), INT8_C( -83), INT8_C( -84), INT8_C(  23), INT8_C( -88), INT8_C(  92), INT8_C( -95), INT8_C(   2),
+                           INT8_C( -98), INT8_C(  25), INT8_C( -11), INT8_C( -58), INT8_C( 120), INT8_C( -87), INT8_C( -93), INT8_C(  68)),
+      simde_mm512_set_epi8(INT8_C( -48), INT8_C( 124), INT8_C(-118), INT8_C(  82), INT8_C( -90), INT8_C( -41), INT8_C(  37), INT8_C(  15),
+                           INT8_C( 116), INT8_C( -72), INT8_C(  29), INT8_C(  91), INT8_C(  67), INT8_C(-113), INT8_C( -47), INT8_C( -84),
+                           INT8_C( -17), INT8_C( -71), INT8_C(  27), INT8_C(-118), INT8_C( -65), INT8_C(  52), INT8_C(  60), INT8_C(-107),
+                           INT8_C(  99), INT8_C( -75), INT8_C(  23), INT8_C(  25), INT8_C( 102), INT8_C( -63), INT8_C(  18), INT8_C( -80),
+                           INT8_C(  31), INT8_C( -78), INT8_C( -31), INT8_C( -77), INT8_C( -58), INT8_C( -46), INT8_C( -78), INT8_C(-107),
+                           INT8_C( 104), INT8_C( -95), INT8_C( -39), INT8_C(-118), INT8_C( -10), INT8_C(  54), INT8_C( 109), INT8_C( -50),
+                           INT8_C( -13), INT8_C( -52), INT8_C( -16), INT8_C(  87), INT8_C( -12), INT8_C( -94), INT8_C( -14), INT8_C( -21),
+                           INT8_C( -97), INT8_C(  94), INT8_C(  74), INT8_C(  21), INT8_C(  11), INT8_C( -18), INT8_C(  88), INT8_C( -38)),
+      simde_mm512_set_epi8(INT8_C( -17), INT8_C(-101), INT8_C( -78), INT8_C(-124), INT8_C(  17), INT8_C( -18), INT8_C( -10), INT8_C(-118),
+                           INT8_C(-107), INT8_C( -12), INT8_C(  57), INT8_C(-118), INT8_C( -31), INT8_C(-118), INT8_C(-107), INT8_C( -46),
+                           INT8_C(  -5), INT8_C( -37), INT8_C(  47), INT8_C(  54), INT8_C(  52), INT8_C(  94), INT8_C(  21), INT8_C( 102),
+                           INT8_C(-118), INT8_C( -14), INT8_C( -46), INT8_C( -41), INT8_C( -92), INT8_C(  81), INT8_C( 126), INT8_C( -84),
+                           INT8_C(  90), INT8_C(  84), INT8_C(  25), INT8_C(-115), INT8_C(-122), INT8_C( -45), INT8_C( -80), INT8_C( -47),
+                           INT8_C( -65), INT8_C(  37), INT8_C( -13), INT8_C( -75), INT8_C(  29), INT8_C(-119), INT8_C( 114), INT8_C( -86),
+                           INT8_C(  91), INT8_C( -23), INT8_C(-118), INT8_C( -53), INT8_C(-107), INT8_C(   4), INT8_C(  63), INT8_C(-107),
+                           INT8_C( -78), INT8_C( -50), INT8_C( -68), INT8_C(  37), INT8_C(  52), INT8_C(  60), INT8_C( -30), INT8_C(  21)) },
+    { simde_mm512_set_epi8(INT8_C( 102), INT8_C( -96), INT8_C(  83), INT8_C( -95), INT8_C(  67), INT8_C(  53), INT8_C( -58), INT8_C(  79),
+                           INT8_C(  32), INT8_C( -74), INT8_C( -16), INT8_C(  50), INT8_C( -20), INT8_C(  -5), INT8_C( -61), INT8_C( -56),
+                           INT8_C(  -2), INT8_C(-100), INT8_C(-103), INT8_C( -33), INT8_C(-113), INT8_C(  84), INT8_C( 113), INT8_C( -21),
+                           INT8_C(  11), INT8_C(  27), INT8_C( -90), INT8_C( 114), INT8_C( 107), INT8_C(  -8), INT8_C( -20), INT8_C( -78),
+                           INT8_C(  32), INT8_C(  61), INT8_C( 101), INT8_C(  68), INT8_C( 110), INT8_C(  -9), INT8_C(  75), INT8_C(  36),
+                           INT8_C(  -3), INT8_C(  55), INT8_C( -85), INT8_C( 124), INT8_C( 120), INT8_C( 115), INT8_C(  39), INT8_C( -85),
+                           INT8_C(  67), INT8_C(-127), INT8_C( -95), INT8_C( -88), INT8_C( 110), INT8_C(  52), INT8_C(  38), INT8_C(  39),
+                           INT8_C(-103), INT8_C(  72), INT8_C(-117), INT8_C(   9), INT8_C( -23), INT8_C( -51), INT8_C(  89), INT8_C(-108)),
+      UINT64_C(17824850350435022918),
+      simde_mm512_set_epi8(INT8_C(  12), INT8_C(  50), INT8_C(-121), INT8_C(  12), INT8_C(-123), INT8_C( -16), INT8_C(  60), INT8_C( 126),
+                           INT8_C( -44), INT8_C(  25), INT8_C(  31), INT8_C( 108), INT8_C(  90), INT8_C(-122), INT8_C( -12), INT8_C(  22),
+                           INT8_C( -44), INT8_C(  87), INT8_C( -93), INT8_C( -20), INT8_C( 108), INT8_C(  72), INT8_C( -96), INT8_C(-105),
+                           INT8_C(-128), INT8_C( -83), INT8_C(  55), INT8_C( -93), INT8_C( -32), INT8_C( -83), INT8_C(  10), INT8_C(  67),
+                           INT8_C( -91), INT8_C(-100), INT8_C( -43), INT8_C(  35), INT8_C( -36), INT8_C(  91), INT8_C( -55), INT8_C( -48),
+                           INT8_C(  92), INT8_C(   3), INT8_C(  98), INT8_C( -68), INT8_C(  13), INT8_C( 115), INT8_C(  50), INT8_C( -11),
+                           INT8_C( -50), INT8_C(-105), INT8_C( -81), INT8_C( -10), INT8_C( 117), INT8_C( -44), INT8_C(  37), INT8_C( 127),
+                           INT8_C( -54), INT8_C( 109), INT8_C(  59), INT8_C(  39), INT8_C( -56), INT8_C(  13), INT8_C( -34), INT8_C(   3)),
+      simde_mm512_set_epi8(INT8_C(  49), INT8_C(  29), INT8_C(  64), INT8_C( -21), INT8_C( -71), INT8_C(-110), INT8_C( -41), INT8_C( -87),
+                           INT8_C( -75), INT8_C( -94), INT8_C(  -3), INT8_C(  -3), INT8_C(  81), INT8_C( -58), INT8_C(  97), INT8_C( -22),
+                           INT8_C( 110), INT8_C(  43), INT8_C(  65), INT8_C( -75), INT8_C(  29), INT8_C(  69), INT8_C( -96), INT8_C(  42),
+                           INT8_C( -34), INT8_C( -54), INT8_C(  55), INT8_C( -19), INT8_C(  26), INT8_C(-111), INT8_C( -50), INT8_C(  54),
+                           INT8_C(-107), INT8_C(  25), INT8_C( -11), INT8_C(  77), INT8_C( 127), INT8_C( 117), INT8_C( -16), INT8_C(  86),
+                           INT8_C( -83), INT8_C(  13), INT8_C( 111), INT8_C(  67), INT8_C( 125), INT8_C( -32), INT8_C( -25), INT8_C( -39),
+                           INT8_C( -26), INT8_C(  90), INT8_C( -17), INT8_C( 108), INT8_C(  82), INT8_C(   5), INT8_C( -52), INT8_C(   1),
+                           INT8_C(  63), INT8_C(  81), INT8_C( 127), INT8_C( 107), INT8_C( -32), INT8_C( 119), INT8_C(   3), INT8_C(-122)),
+      simde_mm512_set_epi8(INT8_C( 108), INT8_C( -58), INT8_C(  63), INT8_C( 108), INT8_C(  67), INT8_C( -22), INT8_C( -21), INT8_C(  29),
+                           INT8_C(  32), INT8_C( -16), INT8_C( -16), INT8_C( -75), INT8_C( 117), INT8_C(  81), INT8_C(  -3), INT8_C( -56),
+                           INT8_C(  67), INT8_C(-100), INT8_C(-103), INT8_C( -75), INT8_C(-113), INT8_C(   1), INT8_C(  54), INT8_C( -21),
+                           INT8_C(-122), INT8_C(  65), INT8_C( -75), INT8_C(  26), INT8_C( 107), INT8_C(  65), INT8_C( -20), INT8_C( -78),
+                           INT8_C(  32), INT8_C(  61), INT8_C( 111), INT8_C(  68), INT8_C( 110), INT8_C(  -9), INT8_C(  75), INT8_C(  36),
+                           INT8_C(  -3), INT8_C(  55), INT8_C(-111), INT8_C( 124), INT8_C( -17), INT8_C(  81), INT8_C(  39), INT8_C(  -3),
+                           INT8_C(  67), INT8_C(-127), INT8_C( 110), INT8_C( -94), INT8_C(  -3), INT8_C(  52), INT8_C(  38), INT8_C(  39),
+                           INT8_C(-103), INT8_C(  65), INT8_C(-117), INT8_C(   9), INT8_C( -23), INT8_C( -17), INT8_C(  25), INT8_C(-108)) },
+    { simde_mm512_set_epi8(INT8_C(-112), INT8_C( -25), INT8_C(   8), INT8_C( -36), INT8_C( -64), INT8_C( 104), INT8_C( -62), INT8_C(  20),
+                           INT8_C( -15), INT8_C(-125), INT8_C(   7), INT8_C( -29), INT8_C( -54), INT8_C(  30), INT8_C( 114), INT8_C( -79),
+                           INT8_C(  97), INT8_C( -63), INT8_C(  23), INT8_C(-111), INT8_C(  71), INT8_C( -91), INT8_C(  24), INT8_C(-128),
+                           INT8_C( -93), INT8_C(  57), INT8_C( -77), INT8_C(  39), INT8_C(-101), INT8_C( -30), INT8_C( -42), INT8_C(  44),
+                           INT8_C( -82), INT8_C(  53), INT8_C( -84), INT8_C(  -7), INT8_C(  45), INT8_C( -52), INT8_C( -40), INT8_C( -35),
+                           INT8_C(  48), INT8_C(  53), INT8_C( -71), INT8_C(  56), INT8_C(  66), INT8_C( 113), INT8_C(-105), INT8_C(  51),
+                           INT8_C( -64), INT8_C(  -7), INT8_C(-104), INT8_C(  40), INT8_C(   0), INT8_C( 121), INT8_C(  17), INT8_C(  81),
+                           INT8_C(   0), INT8_C(  99), INT8_C( -38), INT8_C(-125), INT8_C(   3), INT8_C(  71), INT8_C( -77), INT8_C( -74)),
+      UINT64_C( 2057306058298911166),
+      simde_mm512_set_epi8(INT8_C( -82), INT8_C(-103), INT8_C(   3), INT8_C(-125), INT8_C(  78), INT8_C(   5), INT8_C(  56), INT8_C( -79),
+                           INT8_C( -22), INT8_C(   5), INT8_C( -11), INT8_C( 126), INT8_C( -29), INT8_C(  15), INT8_C(  19), INT8_C(  87),
+                           INT8_C(-114), INT8_C(  68), INT8_C( -64), INT8_C( -96), INT8_C(  -7), INT8_C(  25), INT8_C( -39), INT8_C( -28),
+                           INT8_C( 123), INT8_C(-102), INT8_C(  -4), INT8_C(-123), INT8_C( -24), INT8_C(  45), INT8_C(  19), INT8_C(  66),
+                           INT8_C( -74), INT8_C( -16), INT8_C( 125), INT8_C( -68), INT8_C( -99), INT8_C( -70), INT8_C(  37), INT8_C(   8),
+                           INT8_C( -64), INT8_C(  62), INT8_C(-103), INT8_C( -54), INT8_C(  36), INT8_C( -62), INT8_C( -68), INT8_C( 112),
+                           INT8_C( -27), INT8_C( -13), INT8_C(  62), INT8_C( -70), INT8_C( -65), INT8_C(  58), INT8_C( -58), INT8_C( -67),
+                           INT8_C( -94), INT8_C(  -1), INT8_C( -98), INT8_C( -60), INT8_C(  86), INT8_C( -70), INT8_C(  22), INT8_C(-112)),
+      simde_mm512_set_epi8(INT8_C(  58), INT8_C( -92), INT8_C(  -2), INT8_C(-114), INT8_C(  69), INT8_C( -38), INT8_C(  28), INT8_C(   6),
+                           INT8_C(  10), INT8_C( -63), INT8_C( -46), INT8_C(   6), INT8_C( -87), INT8_C(  84), INT8_C( 102), INT8_C(  74),
+                           INT8_C( -68), INT8_C(-116), INT8_C(  41), INT8_C(-110), INT8_C( 102), INT8_C( -12), INT8_C( -42), INT8_C( 102),
+                           INT8_C(  67), INT8_C(  92), INT8_C(  44), INT8_C( -48), INT8_C( -22), INT8_C(-127), INT8_C(   9), INT8_C( 116),
+                           INT8_C(  76), INT8_C( 101), INT8_C( -74), INT8_C(  73), INT8_C(-102), INT8_C(  11), INT8_C( -99), INT8_C(-113),
+                           INT8_C( 100), INT8_C(  94), INT8_C(  13), INT8_C( -87), INT8_C( 124), INT8_C( 124), INT8_C(-123), INT8_C(-124),
+                           INT8_C( -34), INT8_C( -37), INT8_C( -22), INT8_C(  17), INT8_C( -41), INT8_C(-125), INT8_C(  28), INT8_C(  -3),
+                           INT8_C(  -2), INT8_C( -38), INT8_C( 101), INT8_C(  21), INT8_C(  19), INT8_C( -63), INT8_C(  62), INT8_C(-128)),
+      simde_mm512_set_epi8(INT8_C(-112), INT8_C( -25), INT8_C(   8), INT8_C(  19), INT8_C( -37), INT8_C( 101), INT8_C( -62), INT8_C(  20),
+                           INT8_C( -12), INT8_C(-125), INT8_C(   7), INT8_C( -29), INT8_C( -22), INT8_C( -34), INT8_C( 114), INT8_C( 100),
+                           INT8_C(  97), INT8_C( -63), INT8_C(  23), INT8_C(-111), INT8_C(  71), INT8_C( -99), INT8_C(  24), INT8_C(-128),
+                           INT8_C(  69), INT8_C(  11), INT8_C(-114), INT8_C( 101), INT8_C(-101), INT8_C(  41), INT8_C( -42), INT8_C( -63),
+                           INT8_C( -63), INT8_C(  53), INT8_C(  -2), INT8_C(-114), INT8_C( -74), INT8_C( -38), INT8_C(  44), INT8_C(  -3),
+                           INT8_C(  48), INT8_C(  53), INT8_C( -99), INT8_C(  56), INT8_C( -48), INT8_C( 113), INT8_C(-114), INT8_C(  51),
+                           INT8_C( -64), INT8_C( -87), INT8_C( -92), INT8_C(  40), INT8_C(  58), INT8_C( 121), INT8_C(  17), INT8_C(  -2),
+                           INT8_C(-127), INT8_C(  99), INT8_C( 101), INT8_C(  21), INT8_C(  94), INT8_C( -38), INT8_C(  94), INT8_C( -74)) },
+    { simde_mm512_set_epi8(INT8_C(  52), INT8_C( -24), INT8_C( -64), INT8_C( -53), INT8_C(  77), INT8_C(  -6), INT8_C(-119), INT8_C(  96),
+                           INT8_C(  30), INT8_C(  78), INT8_C( -78), INT8_C(  86), INT8_C(  32), INT8_C(  38), INT8_C( -41), INT8_C(  78),
+                           INT8_C(  94), INT8_C( -32), INT8_C( -13), INT8_C(  66), INT8_C( 104), INT8_C( -22), INT8_C( -63), INT8_C(-115),
+                           INT8_C( 124), INT8_C( -45), INT8_C(  90), INT8_C( -37), INT8_C( 112), INT8_C(-120), INT8_C( 124), INT8_C(  53),
+                           INT8_C(   3), INT8_C( -57), INT8_C(  71), INT8_C( -21), INT8_C( -60), INT8_C(  84), INT8_C( 113), INT8_C(  23),
+                           INT8_C( -61), INT8_C( -50), INT8_C( -80), INT8_C( -32), INT8_C( -11), INT8_C(  26), INT8_C( -95), INT8_C(  21),
+                           INT8_C(-109), INT8_C( -25), INT8_C( 110), INT8_C( -74), INT8_C(-102), INT8_C( 102), INT8_C( -50), INT8_C(-120),
+                           INT8_C(-107), INT8_C(-122), INT8_C(  51), INT8_C(-123), INT8_C( -10), INT8_C(  35), INT8_C(-110), INT8_C( -19)),
+      UINT64_C( 6830724180172449860),
+      simde_mm512_set_epi8(INT8_C(  98), INT8_C(-119), INT8_C(   1), INT8_C(   0), INT8_C(   2), INT8_C(  66), INT8_C( -42), INT8_C(-120),
+                           INT8_C( 111), INT8_C( -67), INT8_C( -98), INT8_C(  57), INT8_C( -90), INT8_C(  79), INT8_C(  76), INT8_C(  16),
+                           INT8_C(  54), INT8_C(  28), INT8_C( -23), INT8_C( -54), INT8_C(   3), INT8_C( -14), INT8_C( -87), INT8_C(-125),
+                           INT8_C(  52), INT8_C(  20), INT8_C(-104), INT8_C(   7), INT8_C( -57), INT8_C(  42), INT8_C(-105), INT8_C( -84),
+                           INT8_C(  70), INT8_C( 111), INT8_C(  23), INT8_C( -69), INT8_C( 125), INT8_C(  77), INT8_C(-123), INT8_C(  38),
+                           INT8_C( -36), INT8_C( -29), INT8_C(  68), INT8_C( -94), INT8_C(-103), INT8_C( -82), INT8_C(   0), INT8_C( -25),
+                           INT8_C(  14), INT8_C( -95), INT8_C( -41), INT8_C( 121), INT8_C( -10), INT8_C(  64), INT8_C( 110), INT8_C( -70),
+                           INT8_C( -72), INT8_C( -27), INT8_C( -93), INT8_C(  -8), INT8_C( -68), INT8_C(  11), INT8_C(  36), INT8_C( 114)),
+      simde_mm512_set_epi8(INT8_C( -96), INT8_C(  51), INT8_C( -25), INT8_C(  12), INT8_C(  16), INT8_C( -80), INT8_C(  78), INT8_C(-103),
+                           INT8_C( -42), INT8_C(-116), INT8_C( 112), INT8_C(  -3), INT8_C(  90), INT8_C(  21), INT8_C(  67), INT8_C( -98),
+                           INT8_C(  30), INT8_C(-118), INT8_C( -18), INT8_C(  -4), INT8_C( 116), INT8_C(-101), INT8_C( -67), INT8_C( -91),
+                           INT8_C( -23), INT8_C( 112), INT8_C( -91), INT8_C(  -2), INT8_C(  83), INT8_C( -14), INT8_C( -31), INT8_C( -26),
+                           INT8_C(-124), INT8_C(-109), INT8_C(  57), INT8_C(  30), INT8_C( -22), INT8_C( -81), INT8_C( 100), INT8_C( -17),
+                           INT8_C(-101), INT8_C( 103), INT8_C(   7), INT8_C( -38), INT8_C(   5), INT8_C(  70), INT8_C(  29), INT8_C( -44),
+                           INT8_C( -15), INT8_C( 124), INT8_C( -10), INT8_C(  71), INT8_C(  35), INT8_C(  42), INT8_C( -55), INT8_C(-121),
+                           INT8_C( -28), INT8_C( -71), INT8_C( -61), INT8_C(  15), INT8_C(  42), INT8_C( 104), INT8_C( -15), INT8_C(  37)),
+      simde_mm512_set_epi8(INT8_C(  52), INT8_C( -55), INT8_C( -64), INT8_C(  37), INT8_C( 104), INT8_C( 104), INT8_C( 103), INT8_C(  96),
+                           INT8_C(  30), INT8_C( -25), INT8_C( -78), INT8_C(  86), INT8_C( 112), INT8_C(  38), INT8_C(  71), INT8_C( -44),
+                           INT8_C(-116), INT8_C( -32), INT8_C( -13), INT8_C(  42), INT8_C(  42), INT8_C( -22), INT8_C( -67), INT8_C(  42),
+                           INT8_C( 124), INT8_C( -38), INT8_C( -17), INT8_C( -28), INT8_C( 112), INT8_C(-120), INT8_C(-101), INT8_C(  -4),
+                           INT8_C(   3), INT8_C(  30), INT8_C(-101), INT8_C(  16), INT8_C( -25), INT8_C( -10), INT8_C( 113), INT8_C( 112),
+                           INT8_C(  30), INT8_C(  83), INT8_C( -80), INT8_C( -14), INT8_C( 100), INT8_C(  26), INT8_C( -95), INT8_C( -23),
+                           INT8_C( 124), INT8_C( -25), INT8_C(-101), INT8_C( -74), INT8_C(-116), INT8_C( 102), INT8_C( -50), INT8_C(-120),
+                           INT8_C(-107), INT8_C( -91), INT8_C(  51), INT8_C(-123), INT8_C( -10), INT8_C(  35), INT8_C(-110), INT8_C( -19)) },
+    { simde_mm512_set_epi8(INT8_C(-109), INT8_C( 112), INT8_C(-109), INT8_C(  30), INT8_C(  11), INT8_C( -56), INT8_C( -91), INT8_C( -10),
+                           INT8_C(  47), INT8_C( -44), INT8_C( -37), INT8_C(  29), INT8_C(  53), INT8_C(-119), INT8_C( 108), INT8_C( -17),
+                           INT8_C( -55), INT8_C( -81), INT8_C(  10), INT8_C( 110), INT8_C(  98), INT8_C(-113), INT8_C(-113), INT8_C( -16),
+                           INT8_C( 121), INT8_C(  26), INT8_C(-116), INT8_C(  50), INT8_C(  40), INT8_C(-120), INT8_C(-100), INT8_C(-119),
+                           INT8_C(  91), INT8_C( -45), INT8_C( -28), INT8_C(  79), INT8_C(  -5), INT8_C( -12), INT8_C(  68), INT8_C(  65),
+                           INT8_C(  92), INT8_C(-128), INT8_C(  21), INT8_C(  74), INT8_C(  42), INT8_C(  74), INT8_C(  -2), INT8_C( -68),
+                           INT8_C(  -5), INT8_C( -82), INT8_C(-119), INT8_C(  33), INT8_C(  58), INT8_C(-112), INT8_C(  94), INT8_C(   0),
+                           INT8_C(  83), INT8_C( -67), INT8_C(  15), INT8_C( -96), INT8_C( -52), INT8_C( 104), INT8_C(-118), INT8_C(  20)),
+      UINT64_C( 5841316051021284074),
+      simde_mm512_set_epi8(INT8_C( -40), INT8_C(  85), INT8_C( -99), INT8_C(  26), INT8_C(  -9), INT8_C( -26), INT8_C(-115), INT8_C( -69),
+                           INT8_C( -67), INT8_C(-105), INT8_C( 104), INT8_C( -95), INT8_C(  80), INT8_C(  -2), INT8_C(  10), INT8_C( 111),
+                           INT8_C(  77), INT8_C(  57), INT8_C(-116), INT8_C( -87), INT8_C( -87), INT8_C( -34), INT8_C(  73), INT8_C(  -4),
+                           INT8_C(  79), INT8_C( 119), INT8_C(-105), INT8_C(  -5), INT8_C( -10), INT8_C( 101), INT8_C(  23), INT8_C(  82),
+                           INT8_C(  -8), INT8_C( 119), INT8_C( -33), INT8_C( -89), INT8_C(  -4), INT8_C( -14), INT8_C( -69), INT8_C(  36),
+                           INT8_C(-110), INT8_C( -97), INT8_C(  -4), INT8_C( -71), INT8_C(  62), INT8_C( -21), INT8_C( -26), INT8_C( -87),
+                           INT8_C( -36), INT8_C( 107), INT8_C( -63), INT8_C(  74), INT8_C(  -3), INT8_C( -17), INT8_C(   3), INT8_C( 111),
+                           INT8_C( 105), INT8_C(-106), INT8_C( -42), INT8_C(  82), INT8_C( -61), INT8_C(  50), INT8_C(-119), INT8_C(  61)),
+      simde_mm512_set_epi8(INT8_C(  82), INT8_C( -42), INT8_C( -50), INT8_C( -43), INT8_C( -35), INT8_C( -45), INT8_C( -75), INT8_C( -63),
+                           INT8_C( -39), INT8_C( -42), INT8_C( 126), INT8_C(  15), INT8_C(-101), INT8_C(  31), INT8_C( -84), INT8_C(-104),
+                           INT8_C( -26), INT8_C( -90), INT8_C(  92), INT8_C(  95), INT8_C( -22), INT8_C( 104), INT8_C( 108), INT8_C(  64),
+                           INT8_C(  50), INT8_C(  21), INT8_C(  52), INT8_C(  33), INT8_C( 124), INT8_C( -55), INT8_C( -11), INT8_C(  42),
+                           INT8_C(-114), INT8_C(  28), INT8_C( 113), INT8_C( -31), INT8_C(  66), INT8_C(  68), INT8_C(  58), INT8_C( -97),
+                           INT8_C( 107), INT8_C(  54), INT8_C( -45), INT8_C(  19), INT8_C(  43), INT8_C(  87), INT8_C( 125), INT8_C(  37),
+                           INT8_C( -25), INT8_C(  43), INT8_C( 122), INT8_C(  -9), INT8_C(   7), INT8_C(  87), INT8_C( 108), INT8_C(  -4),
+                           INT8_C(  55), INT8_C( -30), INT8_C(  -6), INT8_C(  91), INT8_C( 118), INT8_C( -35), INT8_C(  78), INT8_C(  96)),
+      simde_mm512_set_epi8(INT8_C(-109), INT8_C( -45), INT8_C(-109), INT8_C(  68), INT8_C(  11), INT8_C( -56), INT8_C( -91), INT8_C( -35),
+                           INT8_C(  47), INT8_C( -44), INT8_C( -37), INT8_C( -11), INT8_C(  53), INT8_C(-119), INT8_C( 108), INT8_C( -17),
+                           INT8_C( 122), INT8_C( -81), INT8_C(  10), INT8_C( 110), INT8_C(  98), INT8_C(  28), INT8_C(-113), INT8_C( -43),
+                           INT8_C( -25), INT8_C( -39), INT8_C( 107), INT8_C( -35), INT8_C( -42), INT8_C(  52), INT8_C( 107), INT8_C(  87),
+                           INT8_C( -63), INT8_C( -39), INT8_C(-114), INT8_C(  50), INT8_C(  -5), INT8_C( -12), INT8_C(  68), INT8_C(  33),
+                           INT8_C(  87), INT8_C(-114), INT8_C( -43), INT8_C(  74), INT8_C( -42), INT8_C(  74), INT8_C(  -2), INT8_C( 108),
+                           INT8_C(  -5), INT8_C( -22), INT8_C(-119), INT8_C(  33), INT8_C(  58), INT8_C(-112), INT8_C( 118), INT8_C(   0),
+                           INT8_C( 108), INT8_C(  54), INT8_C(  54), INT8_C( -96), INT8_C( 118), INT8_C( 104), INT8_C( 108), INT8_C(  20)) },
+    { simde_mm512_set_epi8(INT8_C( -95), INT8_C( -73), INT8_C(  25), INT8_C(  99), INT8_C( -48), INT8_C(-116), INT8_C( 110), INT8_C( 111),
+                           INT8_C( -32), INT8_C(  50), INT8_C(  26), INT8_C( 111), INT8_C(  34), INT8_C( -94), INT8_C( -64), INT8_C(  47),
+                           INT8_C( -87), INT8_C( -81), INT8_C( -80), INT8_C( 125), INT8_C( 126), INT8_C( -92), INT8_C( 125), INT8_C( -44),
+                           INT8_C(-106), INT8_C(  98), INT8_C(  85), INT8_C(  -6), INT8_C( -84), INT8_C(  -1), INT8_C(  27), INT8_C(  98),
+                           INT8_C(  -5), INT8_C( 125), INT8_C( 117), INT8_C( 109), INT8_C( -85), INT8_C(   9), INT8_C(  65), INT8_C( -95),
+                           INT8_C(  47), INT8_C( 116), INT8_C( -12), INT8_C( -32), INT8_C(   7), INT8_C(-104), INT8_C(  78), INT8_C( 125),
+                           INT8_C(-122), INT8_C( -31), INT8_C( 100), INT8_C(  67), INT8_C( -94), INT8_C(  57), INT8_C(-125), INT8_C(  -6),
+                           INT8_C(  11), INT8_C(  70), INT8_C( -99), INT8_C(  59), INT8_C(-119), INT8_C( -39), INT8_C( 106), INT8_C( -17)),
+      UINT64_C(17734419813534219791),
+      simde_mm512_set_epi8(INT8_C(  54), INT8_C(  76), INT8_C(   8), INT8_C(  96), INT8_C( -32), INT8_C(  93), INT8_C(  15), INT8_C(  58),
+                           INT8_C(  76), INT8_C( -28), INT8_C(-101), INT8_C(-110), INT8_C(  16), INT8_C( -97), INT8_C( 106), INT8_C( 110),
+                           INT8_C( -79), INT8_C(-122), INT8_C( -36), INT8_C(  -1), INT8_C( -19), INT8_C(  76), INT8_C(  46), INT8_C( -13),
+                           INT8_C( -12), INT8_C(  97), INT8_C(  -7), INT8_C(  54), INT8_C(  87), INT8_C( -45), INT8_C(  -7), INT8_C(  65),
+                           INT8_C(-114), INT8_C(  80), INT8_C( -31), INT8_C( -12), INT8_C( 117), INT8_C(  -6), INT8_C(  54), INT8_C( 109),
+                           INT8_C( -28), INT8_C(  38), INT8_C( 106), INT8_C(  99), INT8_C( 110), INT8_C( -64), INT8_C(   9), INT8_C(  -2),
+                           INT8_C(  20), INT8_C(  46), INT8_C(-115), INT8_C( -87), INT8_C(  87), INT8_C( -28), INT8_C(  11), INT8_C( -87),
+                           INT8_C( -23), INT8_C( 119), INT8_C(  38), INT8_C(  66), INT8_C( -93), INT8_C(  29), INT8_C(  13), INT8_C( 115)),
+      simde_mm512_set_epi8(INT8_C( -21), INT8_C(  58), INT8_C(   6), INT8_C( -29), INT8_C(  35), INT8_C(-125), INT8_C( -45), INT8_C( -88),
+                           INT8_C( -42), INT8_C(-119), INT8_C(  22), INT8_C(-107), INT8_C( 117), INT8_C(  12), INT8_C( -64), INT8_C(  40),
+                           INT8_C( -41), INT8_C( -57), INT8_C( -54), INT8_C(  81), INT8_C( 109), INT8_C(-110), INT8_C( -11), INT8_C(  66),
+                           INT8_C( -65), INT8_C(-121), INT8_C(   0), INT8_C(  54), INT8_C(  62), INT8_C(  42), INT8_C(  -1), INT8_C(  -3),
+                           INT8_C( 118), INT8_C( -98), INT8_C( 122), INT8_C(  42), INT8_C( 126), INT8_C( -78), INT8_C(  56), INT8_C(-116),
+                           INT8_C( 103), INT8_C( -18), INT8_C( -41), INT8_C( -76), INT8_C(  19), INT8_C(  13), INT8_C( -65), INT8_C( 114),
+                           INT8_C(  26), INT8_C( -37), INT8_C(  40), INT8_C(  36), INT8_C( -39), INT8_C(  45), INT8_C( -80), INT8_C( -45),
+                           INT8_C( -98), INT8_C( -87), INT8_C( -70), INT8_C(  49), INT8_C( -32), INT8_C( 113), INT8_C(  59), INT8_C( -92)),
+      simde_mm512_set_epi8(INT8_C(-119), INT8_C(  36), INT8_C( -45), INT8_C(  -3), INT8_C( -48), INT8_C( 122), INT8_C(  26), INT8_C( 111),
+                           INT8_C( -32), INT8_C(  50), INT8_C(  26), INT8_C(  13), INT8_C( 114), INT8_C( 118), INT8_C( -64), INT8_C( -57),
+                           INT8_C( -87), INT8_C( -87), INT8_C( -80), INT8_C( -21), INT8_C( 126), INT8_C( -92), INT8_C( 125), INT8_C( -44),
+                           INT8_C(-107), INT8_C(  -1), INT8_C(  85), INT8_C(-119), INT8_C( 103), INT8_C(  19), INT8_C(  27), INT8_C(  98),
+                           INT8_C(  -5), INT8_C( 125), INT8_C( 117), INT8_C( 109), INT8_C( -85), INT8_C(   9), INT8_C(-119), INT8_C( -54),
+                           INT8_C(  47), INT8_C(-121), INT8_C( -12), INT8_C(  62), INT8_C( -57), INT8_C(-104), INT8_C( -80), INT8_C(  58),
+                           INT8_C(-122), INT8_C( -31), INT8_C(  40), INT8_C( -11), INT8_C( 103), INT8_C(  54), INT8_C( -39), INT8_C(  -6),
+                           INT8_C(  11), INT8_C(  70), INT8_C( -99), INT8_C(  59), INT8_C(  62), INT8_C( 122), INT8_C(  40), INT8_C( 117)) },
+    { simde_mm512_set_epi8(INT8_C( 123), INT8_C( -17), INT8_C( -99), INT8_C(  48), INT8_C( -71), INT8_C(  -4), INT8_C(  68), INT8_C(  -9),
+                           INT8_C( -85), INT8_C( -87), INT8_C(  91), INT8_C( 121), INT8_C(  84), INT8_C( 116), INT8_C(  94), INT8_C( -54),
+                           INT8_C(  44), INT8_C( -76), INT8_C( -72), INT8_C( -53), INT8_C(  94), INT8_C( -92), INT8_C(  71), INT8_C(  68),
+                           INT8_C( -58), INT8_C(  38), INT8_C( -36), INT8_C( 116), INT8_C( -93), INT8_C( -69), INT8_C( -95), INT8_C( -57),
+                           INT8_C( -67), INT8_C( -62), INT8_C(  17), INT8_C(  38), INT8_C(   4), INT8_C( -44), INT8_C( -18), INT8_C(-102),
+                           INT8_C(  -5), INT8_C(  16), INT8_C(  23), INT8_C( 114), INT8_C(  73), INT8_C(  73), INT8_C(  51), INT8_C( -67),
+                           INT8_C( -55), INT8_C(  61), INT8_C(  38), INT8_C( -11), INT8_C(  87), INT8_C( -53), INT8_C(  12), INT8_C( -92),
+                           INT8_C( -26), INT8_C(-110), INT8_C( -55), INT8_C( -79), INT8_C( -35), INT8_C(  53), INT8_C( -21), INT8_C( -77)),
+      UINT64_C( 3577601289042481131),
+      simde_mm512_set_epi8(INT8_C(  15), INT8_C( -46), INT8_C(  24), INT8_C( -21), INT8_C(-101), INT8_C( -67), INT8_C(-120), INT8_C(-100),
+                           INT8_C(  14), INT8_C(-104), INT8_C( -43), INT8_C(  29), INT8_C( 112), INT8_C(  94), INT8_C( -68), INT8_C( -91),
+                           INT8_C(  58), INT8_C(  77), INT8_C( -35), INT8_C(  -9), INT8_C( -28), INT8_C(   8), INT8_C(   6), INT8_C( -88),
+                           INT8_C(-127), INT8_C(   5), INT8_C(  44), INT8_C( 113), INT8_C( -88), INT8_C(  37), INT8_C(  91), INT8_C( -33),
+                           INT8_C( 123), INT8_C(  62), INT8_C( -17), INT8_C( -61), INT8_C(-115), INT8_C( -61), INT8_C(  44), INT8_C(  71),
+                           INT8_C( -45), INT8_C(  57), INT8_C(  26), INT8_C( -92), INT8_C(  38), INT8_C(   9), INT8_C( -53), INT8_C( -48),
+                           INT8_C(  22), INT8_C( -23), INT8_C( -77), INT8_C(  -9), INT8_C(  37), INT8_C( 113), INT8_C(  54), INT8_C(  -3),
+                           INT8_C( -69), INT8_C( 111), INT8_C(  71), INT8_C(  27), INT8_C( -20), INT8_C( 124), INT8_C(  97), INT8_C( -66)),
+      simde_mm512_set_epi8(INT8_C(  66), INT8_C(  80), INT8_C( -35), INT8_C(  44), INT8_C(  31), INT8_C(  14), INT8_C(  49), INT8_C(-120),
+                           INT8_C(-115), INT8_C( -84), INT8_C(  46), INT8_C( 102), INT8_C(  85), INT8_C(  -4), INT8_C( -45), INT8_C( -17),
+                           INT8_C( -61), INT8_C( 126), INT8_C( -43), INT8_C(  53), INT8_C( 127), INT8_C(  25), INT8_C(  12), INT8_C(  55),
+                           INT8_C(  22), INT8_C(  -9), INT8_C(  30), INT8_C( -86), INT8_C(  14), INT8_C( 125), INT8_C(  18), INT8_C(-110),
+                           INT8_C(-125), INT8_C( -64), INT8_C(  32), INT8_C(  71), INT8_C( -49), INT8_C( 101), INT8_C(-106), INT8_C(  62),
+                           INT8_C(  57), INT8_C(  59), INT8_C( -76), INT8_C( 105), INT8_C(  -8), INT8_C(  94), INT8_C(  -8), INT8_C(  78),
+                           INT8_C(  47), INT8_C( -78), INT8_C( -19), INT8_C( -86), INT8_C(  56), INT8_C(-102), INT8_C(  21), INT8_C( 100),
+                           INT8_C( -90), INT8_C( -64), INT8_C( -48), INT8_C( -67), INT8_C( -69), INT8_C( -31), INT8_C(  84), INT8_C(-115)),
+      simde_mm512_set_epi8(INT8_C( 123), INT8_C( -17), INT8_C(  62), INT8_C( 127), INT8_C( -71), INT8_C(  -4), INT8_C(  68), INT8_C(  71),
+                           INT8_C( -78), INT8_C( -87), INT8_C( -76), INT8_C( 121), INT8_C(  84), INT8_C( -64), INT8_C(  44), INT8_C( -54),
+                           INT8_C(  44), INT8_C( -76), INT8_C(  32), INT8_C(-115), INT8_C(  94), INT8_C( -92), INT8_C(  71), INT8_C(  55),
+                           INT8_C( -58), INT8_C( -48), INT8_C(  53), INT8_C( 116), INT8_C(  55), INT8_C( -69), INT8_C( -49), INT8_C( -57),
+                           INT8_C(  31), INT8_C(  80), INT8_C(  17), INT8_C( -69), INT8_C( -19), INT8_C( -69), INT8_C( -18), INT8_C( -90),
+                           INT8_C(  -5), INT8_C(  49), INT8_C(  23), INT8_C( -86), INT8_C(  -9), INT8_C(  73), INT8_C(  56), INT8_C(  78),
+                           INT8_C( -55), INT8_C(  12), INT8_C(  38), INT8_C( -11), INT8_C(  30), INT8_C( -45), INT8_C( -84), INT8_C( -35),
+                           INT8_C(  31), INT8_C( -61), INT8_C( -90), INT8_C( -79), INT8_C(  53), INT8_C(  53), INT8_C(  18), INT8_C(  80)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_permutexvar_epi8(test_vec[i].src, test_vec[i].k, test_vec[i].idx, test_vec[i].a);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_permutexvar_epi8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask64 k;
+    simde__m512i idx;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT64_C(16799608371837110820),
+      simde_mm512_set_epi8(INT8_C( -17), INT8_C(  64), INT8_C(  24), INT8_C( -17), INT8_C( -15), INT8_C( -36), INT8_C(  35), INT8_C(-126),
+                           INT8_C(  41), INT8_C( -31), INT8_C(  96), INT8_C( -81), INT8_C( -26), INT8_C(  68), INT8_C( -13), INT8_C( 100),
+                           INT8_C(  26), INT8_C( -73), INT8_C(-113), INT8_C(  98), INT8_C( -53), INT8_C( -57), INT8_C(  -7), INT8_C(  22),
+                           INT8_C( -49), INT8_C( -87), INT8_C( 109), INT8_C(-123), INT8_C(  21), INT8_C( 115), INT8_C( -46), INT8_C(  50),
+                           INT8_C(-108), INT8_C(  42), INT8_C(  43), INT8_C( -92), INT8_C( -53), INT8_C(  95), INT8_C(  32), INT8_C( -77),
+                           INT8_C(  95), INT8_C(  77), INT8_C( -88), INT8_C( -15), INT8_C(-128), INT8_C( -74), INT8_C(  32), INT8_C(  51),
+                           INT8_C( -29), INT8_C(  47), INT8_C( 118), INT8_C( -43), INT8_C( -96), INT8_C(  14), INT8_C(  64), INT8_C( 115),
+                           INT8_C(  14), INT8_C(  76), INT8_C(  19), INT8_C(-118), INT8_C( -16), INT8_C( -89), INT8_C(  99), INT8_C( -76)),
+      simde_mm512_set_epi8(INT8_C(  10), INT8_C(  45), INT8_C(-106), INT8_C( -42), INT8_C(-128), INT8_C(  83), INT8_C( -89), INT8_C( -85),
+                           INT8_C( 105), INT8_C(   3), INT8_C(-107), INT8_C(  22), INT8_C(  -6), INT8_C(  -3), INT8_C(  58), INT8_C(  31),
+                           INT8_C( -96), INT8_C(  46), INT8_C( -57), INT8_C( -17), INT8_C(  73), INT8_C(  18), INT8_C( -17), INT8_C( -64),
+                           INT8_C(  75), INT8_C(  81), INT8_C( -16), INT8_C(   5), INT8_C( -62), INT8_C(  -1), INT8_C(   1), INT8_C(  66),
+                           INT8_C(   4), INT8_C(  13), INT8_C( 127), INT8_C( 102), INT8_C( 103), INT8_C(-108), INT8_C( 113), INT8_C( -31),
+                           INT8_C(  62), INT8_C(  38), INT8_C( -93), INT8_C(  82), INT8_C( 106), INT8_C(  38), INT8_C(  25), INT8_C(  19),
+                           INT8_C( -65), INT8_C( -59), INT8_C(  59), INT8_C( -78), INT8_C( 112), INT8_C(  90), INT8_C( -48), INT8_C( 115),
+                           INT8_C(  87), INT8_C( -74), INT8_C( -25), INT8_C(-105), INT8_C( -85), INT8_C( -51), INT8_C(  59), INT8_C(  69)),
+      simde_mm512_set_epi8(INT8_C( -96), INT8_C(  69), INT8_C( -31), INT8_C(   0), INT8_C(  58), INT8_C(   0), INT8_C(   0), INT8_C( -51),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  66), INT8_C(   0), INT8_C(   0), INT8_C(-105), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -65), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C( -89), INT8_C(   0),
+                           INT8_C( -65), INT8_C( -17), INT8_C(   0), INT8_C(   0), INT8_C( -93), INT8_C(  -6), INT8_C(  38), INT8_C(   0),
+                           INT8_C(   0), INT8_C(  18), INT8_C(   0), INT8_C(   5), INT8_C( 112), INT8_C(   0), INT8_C(   0), INT8_C(  -6),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   3), INT8_C(  66), INT8_C(  -6),
+                           INT8_C( -62), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  66), INT8_C(   0), INT8_C(  69), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( 106), INT8_C(   0), INT8_C(   0), INT8_C(  75), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C( 1844687415729729235),
+      simde_mm512_set_epi8(INT8_C(  62), INT8_C(   4), INT8_C(  41), INT8_C(  46), INT8_C(  17), INT8_C(  66), INT8_C(  82), INT8_C( -87),
+                           INT8_C(   2), INT8_C(  93), INT8_C(  -7), INT8_C( -13), INT8_C(  -1), INT8_C(-118), INT8_C( 119), INT8_C( -58),
+                           INT8_C(  11), INT8_C( -99), INT8_C( -38), INT8_C(  -4), INT8_C(  61), INT8_C( -51), INT8_C(  55), INT8_C( -23),
+                           INT8_C( -10), INT8_C( 104), INT8_C(  12), INT8_C( -12), INT8_C(  -8), INT8_C(-117), INT8_C(  13), INT8_C(  51),
+                           INT8_C(  43), INT8_C( 114), INT8_C( 124), INT8_C( 114), INT8_C( 105), INT8_C( -16), INT8_C( -97), INT8_C(  77),
+                           INT8_C(  80), INT8_C(   6), INT8_C(  -7), INT8_C(  35), INT8_C( 117), INT8_C(  89), INT8_C(-107), INT8_C( -26),
+                           INT8_C( 103), INT8_C(-115), INT8_C( -15), INT8_C(  71), INT8_C(  -6), INT8_C(-100), INT8_C( 103), INT8_C(  40),
+                           INT8_C( 107), INT8_C(-103), INT8_C( -24), INT8_C(  58), INT8_C( 109), INT8_C( 115), INT8_C(-116), INT8_C(  48)),
+      simde_mm512_set_epi8(INT8_C( -73), INT8_C( -97), INT8_C(-112), INT8_C( -55), INT8_C( -98), INT8_C(  44), INT8_C(  28), INT8_C(  43),
+                           INT8_C(  35), INT8_C(   9), INT8_C( 103), INT8_C(-110), INT8_C( 111), INT8_C( -40), INT8_C( -38), INT8_C(  95),
+                           INT8_C( -65), INT8_C(  17), INT8_C(  -3), INT8_C(  50), INT8_C(  24), INT8_C(-116), INT8_C(  38), INT8_C(-110),
+                           INT8_C( -12), INT8_C(-105), INT8_C(  59), INT8_C(  44), INT8_C(  65), INT8_C(  64), INT8_C( -30), INT8_C(-105),
+                           INT8_C(  51), INT8_C( 125), INT8_C(   9), INT8_C( 108), INT8_C( -35), INT8_C( -57), INT8_C(-113), INT8_C(-120),
+                           INT8_C(  31), INT8_C(  17), INT8_C( -83), INT8_C( -13), INT8_C( -12), INT8_C( -73), INT8_C( -29), INT8_C(-113),
+                           INT8_C( -86), INT8_C(-111), INT8_C(  14), INT8_C( -78), INT8_C(  84), INT8_C( -47), INT8_C( -67), INT8_C( -12),
+                           INT8_C( -21), INT8_C(  -9), INT8_C(   7), INT8_C(-110), INT8_C( -17), INT8_C(  57), INT8_C(  92), INT8_C(  76)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  17), INT8_C( -29), INT8_C(   0), INT8_C(   0), INT8_C(  38),
+                           INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C( 111), INT8_C( -73), INT8_C(   0), INT8_C(   0), INT8_C(  -9),
+                           INT8_C(  84), INT8_C(   0), INT8_C( -57), INT8_C(   0), INT8_C(   0), INT8_C(  14), INT8_C(   0), INT8_C(  38),
+                           INT8_C(   0), INT8_C(-110), INT8_C( -78), INT8_C(   0), INT8_C(  43), INT8_C(  84), INT8_C(  14), INT8_C(   0),
+                           INT8_C(   0), INT8_C( -40), INT8_C(   0), INT8_C( -40), INT8_C(  38), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  28), INT8_C(  65), INT8_C(   0), INT8_C(-113), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -38), INT8_C(   0), INT8_C(  44), INT8_C( 108), INT8_C( -12), INT8_C(   0),
+                           INT8_C(  24), INT8_C(-113), INT8_C(   0), INT8_C(  44), INT8_C(   0), INT8_C(   0), INT8_C( -78), INT8_C(  95)) },
+    { UINT64_C(  933555988588898595),
+      simde_mm512_set_epi8(INT8_C(  78), INT8_C( -16), INT8_C(-107), INT8_C( -91), INT8_C(  -5), INT8_C( -63), INT8_C(-108), INT8_C( -76),
+                           INT8_C( -88), INT8_C(-108), INT8_C(  62), INT8_C( -68), INT8_C(  73), INT8_C(  45), INT8_C(  66), INT8_C(  48),
+                           INT8_C(  68), INT8_C(  77), INT8_C(  42), INT8_C( -75), INT8_C( -51), INT8_C( -88), INT8_C(  11), INT8_C( -25),
+                           INT8_C(  41), INT8_C(  50), INT8_C(-117), INT8_C( -28), INT8_C(  76), INT8_C( -53), INT8_C( 103), INT8_C( 105),
+                           INT8_C( 107), INT8_C(-110), INT8_C( -21), INT8_C(   4), INT8_C(   0), INT8_C(  36), INT8_C(  25), INT8_C( -38),
+                           INT8_C(  27), INT8_C(   3), INT8_C(  65), INT8_C(  -3), INT8_C( -95), INT8_C(-112), INT8_C( 106), INT8_C( -49),
+                           INT8_C(   3), INT8_C( -30), INT8_C(  93), INT8_C(-102), INT8_C( -77), INT8_C(  97), INT8_C(  82), INT8_C( -22),
+                           INT8_C(  32), INT8_C(   6), INT8_C(  30), INT8_C(  31), INT8_C(  40), INT8_C( -55), INT8_C(-110), INT8_C(  78)),
+      simde_mm512_set_epi8(INT8_C( -94), INT8_C(  83), INT8_C(  10), INT8_C( -93), INT8_C(  26), INT8_C(  81), INT8_C( 125), INT8_C( -40),
+                           INT8_C(  -8), INT8_C(  -2), INT8_C(  64), INT8_C( 123), INT8_C(  90), INT8_C( 102), INT8_C( -92), INT8_C( -47),
+                           INT8_C(  -7), INT8_C(  22), INT8_C( 115), INT8_C(  23), INT8_C( -17), INT8_C( -63), INT8_C(  28), INT8_C( -24),
+                           INT8_C(-108), INT8_C( -26), INT8_C(-104), INT8_C( -91), INT8_C(  31), INT8_C(  50), INT8_C( 124), INT8_C(  16),
+                           INT8_C( 106), INT8_C(  74), INT8_C( -98), INT8_C( -25), INT8_C(  36), INT8_C(-111), INT8_C(  76), INT8_C( -55),
+                           INT8_C( 102), INT8_C(  30), INT8_C(  38), INT8_C(-110), INT8_C( -44), INT8_C(  90), INT8_C( -46), INT8_C(  45),
+                           INT8_C( -17), INT8_C(  72), INT8_C(  45), INT8_C(  41), INT8_C(-116), INT8_C(  29), INT8_C(  66), INT8_C( -88),
+                           INT8_C(  25), INT8_C( -20), INT8_C(  71), INT8_C(   3), INT8_C(   7), INT8_C(  -1), INT8_C( -70), INT8_C( -99)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  26), INT8_C( -70), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -24), INT8_C(-110), INT8_C(  83), INT8_C( -93), INT8_C(   0), INT8_C( 115), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   3), INT8_C(   0), INT8_C( -63), INT8_C(   0), INT8_C(  45), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(-116), INT8_C( -91), INT8_C(  41), INT8_C(   0), INT8_C(   0), INT8_C(  28),
+                           INT8_C( -17), INT8_C(   0), INT8_C( -17), INT8_C(   3), INT8_C(   0), INT8_C( -91), INT8_C(   0), INT8_C(-111),
+                           INT8_C(  36), INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  45), INT8_C( -63), INT8_C( -17),
+                           INT8_C(   7), INT8_C(   0), INT8_C( -98), INT8_C(   0), INT8_C(  90), INT8_C(   0), INT8_C(   0), INT8_C( -63),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  74), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  90), INT8_C(  72)) },
+    { UINT64_C(12266456527255249762),
+      simde_mm512_set_epi8(INT8_C(  -9), INT8_C(  91), INT8_C(-124), INT8_C(-111), INT8_C( -53), INT8_C( -47), INT8_C( -59), INT8_C( 102),
+                           INT8_C( 125), INT8_C( -84), INT8_C(  50), INT8_C( -90), INT8_C(  47), INT8_C(  23), INT8_C(  60), INT8_C( -33),
+                           INT8_C( 103), INT8_C(  73), INT8_C(  44), INT8_C(  65), INT8_C(-116), INT8_C( 114), INT8_C(  42), INT8_C(  75),
+                           INT8_C( -41), INT8_C(-124), INT8_C(  91), INT8_C(  56), INT8_C(   0), INT8_C(  61), INT8_C(  60), INT8_C( -78),
+                           INT8_C( -96), INT8_C( -71), INT8_C(  41), INT8_C(  21), INT8_C( -67), INT8_C(  21), INT8_C(  83), INT8_C(  20),
+                           INT8_C( 114), INT8_C( -25), INT8_C( 109), INT8_C( -10), INT8_C(  14), INT8_C(  11), INT8_C( -34), INT8_C( -23),
+                           INT8_C( -58), INT8_C(  21), INT8_C(   5), INT8_C( -94), INT8_C( 107), INT8_C( -77), INT8_C(-126), INT8_C( -20),
+                           INT8_C( 107), INT8_C( -72), INT8_C(  -3), INT8_C( 120), INT8_C(  95), INT8_C(   0), INT8_C(  14), INT8_C( -79)),
+      simde_mm512_set_epi8(INT8_C( -99), INT8_C( -80), INT8_C( -59), INT8_C(  67), INT8_C(  24), INT8_C( -37), INT8_C( -56), INT8_C( 114),
+                           INT8_C(  97), INT8_C(  74), INT8_C( -73), INT8_C(  97), INT8_C( 123), INT8_C( 111), INT8_C(  83), INT8_C(-107),
+                           INT8_C(-116), INT8_C(  -1), INT8_C(-108), INT8_C( -14), INT8_C( -60), INT8_C(  15), INT8_C( -15), INT8_C( -10),
+                           INT8_C( -20), INT8_C(  46), INT8_C( -74), INT8_C( 117), INT8_C( 107), INT8_C( -78), INT8_C(  80), INT8_C(-105),
+                           INT8_C(  48), INT8_C( -52), INT8_C( -39), INT8_C( 113), INT8_C(  -1), INT8_C(-119), INT8_C( -92), INT8_C(  31),
+                           INT8_C( -75), INT8_C( -81), INT8_C(  79), INT8_C(  51), INT8_C(  91), INT8_C(  42), INT8_C(   5), INT8_C(  85),
+                           INT8_C( 100), INT8_C(-112), INT8_C(  76), INT8_C(  28), INT8_C(  61), INT8_C( -63), INT8_C(  35), INT8_C(-110),
+                           INT8_C( -37), INT8_C( -26), INT8_C( 103), INT8_C( -89), INT8_C( -38), INT8_C(  67), INT8_C(  -1), INT8_C( 108)),
+      simde_mm512_set_epi8(INT8_C(  97), INT8_C(   0), INT8_C( -89), INT8_C(   0), INT8_C(  61), INT8_C(   0), INT8_C( 103), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( 111), INT8_C(  46), INT8_C(-116), INT8_C(   0), INT8_C(  67), INT8_C(  48),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -14), INT8_C(  -1), INT8_C(   0), INT8_C( 111), INT8_C(   0), INT8_C(  61),
+                           INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C( 114), INT8_C( 108), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(-105), INT8_C(   0), INT8_C(   0), INT8_C(  79), INT8_C(   0), INT8_C(  79), INT8_C(  91), INT8_C(  51),
+                           INT8_C( 111), INT8_C( -20), INT8_C(   0), INT8_C(  74), INT8_C(   0), INT8_C(   0), INT8_C( -52), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( 103), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  67), INT8_C( -14),
+                           INT8_C(   0), INT8_C( 114), INT8_C( -59), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-112), INT8_C(   0)) },
+    { UINT64_C( 7550773209366913229),
+      simde_mm512_set_epi8(INT8_C(  85), INT8_C( 102), INT8_C( -99), INT8_C( -94), INT8_C( -43), INT8_C( -77), INT8_C(  30), INT8_C(  41),
+                           INT8_C(  27), INT8_C( -18), INT8_C( -98), INT8_C( -51), INT8_C(  -9), INT8_C( 106), INT8_C(  -2), INT8_C( -44),
+                           INT8_C(-121), INT8_C(  12), INT8_C(  83), INT8_C(  64), INT8_C(-124), INT8_C( 120), INT8_C(-116), INT8_C(-115),
+                           INT8_C(  58), INT8_C( -93), INT8_C( 112), INT8_C( 106), INT8_C(  44), INT8_C(  35), INT8_C( 110), INT8_C(  17),
+                           INT8_C(  44), INT8_C(  73), INT8_C( -80), INT8_C( 125), INT8_C(  97), INT8_C( 105), INT8_C(-114), INT8_C(  77),
+                           INT8_C(  26), INT8_C( -43), INT8_C(   6), INT8_C( -30), INT8_C(  -2), INT8_C(  86), INT8_C( -97), INT8_C( -14),
+                           INT8_C(  24), INT8_C(  48), INT8_C(  78), INT8_C(  73), INT8_C( -55), INT8_C(   6), INT8_C( -44), INT8_C(-101),
+                           INT8_C( -14), INT8_C(  31), INT8_C( -77), INT8_C( -65), INT8_C( 105), INT8_C(  81), INT8_C(  31), INT8_C( -92)),
+      simde_mm512_set_epi8(INT8_C(  77), INT8_C( -65), INT8_C( -85), INT8_C( -26), INT8_C(  44), INT8_C(  58), INT8_C(  37), INT8_C(  71),
+                           INT8_C( -68), INT8_C(  -7), INT8_C( -22), INT8_C( -50), INT8_C(  96), INT8_C( 108), INT8_C(   8), INT8_C( -42),
+                           INT8_C(-126), INT8_C( -31), INT8_C( 110), INT8_C( -48), INT8_C(-117), INT8_C(  12), INT8_C( -57), INT8_C(  88),
+                           INT8_C(   6), INT8_C( -14), INT8_C( 126), INT8_C(-102), INT8_C( -53), INT8_C( -32), INT8_C(  30), INT8_C( 100),
+                           INT8_C( -51), INT8_C( 119), INT8_C(  82), INT8_C( -12), INT8_C(-115), INT8_C( -57), INT8_C(  17), INT8_C(-121),
+                           INT8_C(   2), INT8_C(  30), INT8_C(-128), INT8_C(   5), INT8_C(-104), INT8_C(  41), INT8_C( -67), INT8_C(  -4),
+                           INT8_C(-128), INT8_C(  48), INT8_C(  99), INT8_C( -35), INT8_C( -98), INT8_C( -37), INT8_C(-122), INT8_C( -79),
+                           INT8_C(  66), INT8_C( -22), INT8_C(  92), INT8_C( -81), INT8_C(  59), INT8_C( -80), INT8_C( -46), INT8_C(  85)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C( -14), INT8_C(  82), INT8_C(   0), INT8_C(-128), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(-115), INT8_C( -31), INT8_C(   0), INT8_C(   0), INT8_C( -68), INT8_C(   0), INT8_C(   0), INT8_C(   5),
+                           INT8_C(  66), INT8_C(   0), INT8_C(-104), INT8_C(  85), INT8_C( -81), INT8_C(  71), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -42), INT8_C(  12), INT8_C( -48), INT8_C(   0), INT8_C( -31), INT8_C(   0),
+                           INT8_C(   0), INT8_C(-122), INT8_C( -42), INT8_C(   0), INT8_C(  30), INT8_C(   0), INT8_C(  48), INT8_C(  99),
+                           INT8_C( -57), INT8_C(-128), INT8_C(   0), INT8_C( -32), INT8_C( -65), INT8_C(   0), INT8_C(   0), INT8_C( 108),
+                           INT8_C(-121), INT8_C( -42), INT8_C(  48), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C( 108), INT8_C( -51), INT8_C(   0), INT8_C(   0), INT8_C( -57), INT8_C( -67), INT8_C(   0), INT8_C(-102)) },
+    { UINT64_C( 7106806198834214224),
+      simde_mm512_set_epi8(INT8_C( -37), INT8_C( 118), INT8_C( -56), INT8_C( -59), INT8_C(  35), INT8_C(  87), INT8_C( -65), INT8_C(  17),
+                           INT8_C( -72), INT8_C( -84), INT8_C(  63), INT8_C( -57), INT8_C(  34), INT8_C( -14), INT8_C( 106), INT8_C( -60),
+                           INT8_C(  78), INT8_C( -46), INT8_C( -95), INT8_C( 100), INT8_C(  96), INT8_C( 106), INT8_C(  42), INT8_C( -47),
+                           INT8_C( -88), INT8_C( -21), INT8_C(-109), INT8_C(  34), INT8_C(  51), INT8_C( -27), INT8_C( -39), INT8_C( -30),
+                           INT8_C( 122), INT8_C( 127), INT8_C( -86), INT8_C(  74), INT8_C( -90), INT8_C( -80), INT8_C(  -1), INT8_C(  28),
+                           INT8_C( -42), INT8_C( -44), INT8_C( -44), INT8_C(  43), INT8_C(  96), INT8_C(   3), INT8_C( 116), INT8_C( -75),
+                           INT8_C(   6), INT8_C(  50), INT8_C( -19), INT8_C(  16), INT8_C(  81), INT8_C(  61), INT8_C( -68), INT8_C( -52),
+                           INT8_C(-122), INT8_C( -73), INT8_C( -58), INT8_C( 124), INT8_C(  85), INT8_C(  -9), INT8_C( -64), INT8_C(  76)),
+      simde_mm512_set_epi8(INT8_C(  62), INT8_C(  99), INT8_C( -66), INT8_C(  11), INT8_C( 115), INT8_C(  26), INT8_C(-121), INT8_C( -97),
+                           INT8_C( 100), INT8_C( -90), INT8_C( -71), INT8_C(  55), INT8_C(  -1), INT8_C( -64), INT8_C( -31), INT8_C(  29),
+                           INT8_C(  31), INT8_C(  31), INT8_C(  -1), INT8_C( -25), INT8_C( -39), INT8_C(  99), INT8_C( -98), INT8_C(  97),
+                           INT8_C(   7), INT8_C(-117), INT8_C(-119), INT8_C(-122), INT8_C(  93), INT8_C(  55), INT8_C( -50), INT8_C(  -4),
+                           INT8_C(  59), INT8_C( -23), INT8_C(  99), INT8_C( -14), INT8_C(  45), INT8_C(  58), INT8_C(  57), INT8_C(  14),
+                           INT8_C( -70), INT8_C( -39), INT8_C( -38), INT8_C( 121), INT8_C(  81), INT8_C(  61), INT8_C( -98), INT8_C( -13),
+                           INT8_C(  58), INT8_C(   4), INT8_C(  49), INT8_C( -54), INT8_C(  71), INT8_C( -78), INT8_C(-102), INT8_C(   7),
+                           INT8_C(  98), INT8_C(-121), INT8_C( -90), INT8_C(  79), INT8_C(  99), INT8_C(  66), INT8_C( -12), INT8_C(  47)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C( -90), INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  62), INT8_C(   0),
+                           INT8_C( -97), INT8_C(   0), INT8_C(  62), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(  61), INT8_C( -50), INT8_C(-122), INT8_C(   0), INT8_C(   0), INT8_C(  99), INT8_C(   0),
+                           INT8_C(  97), INT8_C(   0), INT8_C(   0), INT8_C(  55), INT8_C(   0), INT8_C(-119), INT8_C(   0), INT8_C(  55),
+                           INT8_C(  26), INT8_C(   0), INT8_C(   0), INT8_C( -78), INT8_C(-117), INT8_C(   0), INT8_C(   0), INT8_C( -14),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -4), INT8_C(  99), INT8_C(  55), INT8_C(   0),
+                           INT8_C(-121), INT8_C(   0), INT8_C(  -1), INT8_C( -13), INT8_C(   0), INT8_C( -66), INT8_C(   0), INT8_C( -54),
+                           INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  11), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)) },
+    { UINT64_C( 3991237309540431513),
+      simde_mm512_set_epi8(INT8_C(   4), INT8_C( -52), INT8_C( 125), INT8_C(  50), INT8_C(  48), INT8_C(  85), INT8_C(  32), INT8_C(  86),
+                           INT8_C(  38), INT8_C( -96), INT8_C( -36), INT8_C( -79), INT8_C( 108), INT8_C(-102), INT8_C( -64), INT8_C(  86),
+                           INT8_C(  -1), INT8_C( -58), INT8_C(-124), INT8_C(   8), INT8_C( 126), INT8_C(  24), INT8_C(  38), INT8_C( -37),
+                           INT8_C( -72), INT8_C(  28), INT8_C(   8), INT8_C(   6), INT8_C(-105), INT8_C(  59), INT8_C(  59), INT8_C( -84),
+                           INT8_C( -97), INT8_C( 109), INT8_C( -75), INT8_C(  31), INT8_C(  11), INT8_C( -71), INT8_C( -35), INT8_C( -41),
+                           INT8_C(  59), INT8_C(-128), INT8_C( 119), INT8_C(  51), INT8_C( 113), INT8_C(-114), INT8_C(  39), INT8_C(-104),
+                           INT8_C(  94), INT8_C(-117), INT8_C(-114), INT8_C(  88), INT8_C(  40), INT8_C(  13), INT8_C(  45), INT8_C(  66),
+                           INT8_C(  36), INT8_C(  69), INT8_C( 106), INT8_C(  64), INT8_C( -33), INT8_C(  79), INT8_C(  -4), INT8_C(  58)),
+      simde_mm512_set_epi8(INT8_C(  58), INT8_C( -18), INT8_C( 121), INT8_C( -95), INT8_C( 101), INT8_C(  18), INT8_C( 120), INT8_C(  41),
+                           INT8_C( 106), INT8_C( -25), INT8_C( -69), INT8_C(-114), INT8_C(  34), INT8_C(-128), INT8_C(  92), INT8_C(-112),
+                           INT8_C(-116), INT8_C( -73), INT8_C(  -7), INT8_C(  82), INT8_C( 119), INT8_C( -99), INT8_C( 124), INT8_C( 104),
+                           INT8_C(  39), INT8_C(-101), INT8_C(  33), INT8_C( -44), INT8_C(  42), INT8_C( -83), INT8_C(  55), INT8_C( -57),
+                           INT8_C(  25), INT8_C(   3), INT8_C(  74), INT8_C( -30), INT8_C(  -6), INT8_C( -34), INT8_C( 108), INT8_C( -98),
+                           INT8_C( -55), INT8_C(  46), INT8_C(  83), INT8_C(  62), INT8_C( 105), INT8_C(  35), INT8_C(  -9), INT8_C( 112),
+                           INT8_C( 121), INT8_C( -40), INT8_C(  75), INT8_C(  35), INT8_C( 126), INT8_C(-104), INT8_C( -52), INT8_C( -87),
+                           INT8_C(  84), INT8_C( -31), INT8_C(  37), INT8_C( -96), INT8_C(  90), INT8_C(  91), INT8_C(  95), INT8_C(-106)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C( 121), INT8_C(-128), INT8_C(   0), INT8_C(  83), INT8_C( -57), INT8_C(  46),
+                           INT8_C(   0), INT8_C( -57), INT8_C( -30), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(-106), INT8_C(  46),
+                           INT8_C(  58), INT8_C(   0), INT8_C( -96), INT8_C( -87), INT8_C( -18), INT8_C(   0), INT8_C(   0), INT8_C(  -6),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -87), INT8_C(   0), INT8_C( -55), INT8_C( 101), INT8_C( 101), INT8_C(  82),
+                           INT8_C(  25), INT8_C(  -7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -55),
+                           INT8_C(   0), INT8_C(-106), INT8_C( 106), INT8_C(  34), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -98),
+                           INT8_C(   0), INT8_C( 126), INT8_C( -40), INT8_C( -98), INT8_C(   0), INT8_C(  75), INT8_C(  -7), INT8_C(   0),
+                           INT8_C( -44), INT8_C(   0), INT8_C(   0), INT8_C(-106), INT8_C(  25), INT8_C(   0), INT8_C(   0), INT8_C(  18)) },
+    { UINT64_C( 8519711788754663667),
+      simde_mm512_set_epi8(INT8_C(  69), INT8_C(-125), INT8_C( -15), INT8_C( -90), INT8_C( -38), INT8_C(  76), INT8_C(  53), INT8_C(  23),
+                           INT8_C( -78), INT8_C( -90), INT8_C( -87), INT8_C( 121), INT8_C(  88), INT8_C(  -7), INT8_C(  35), INT8_C(  17),
+                           INT8_C(  59), INT8_C(  45), INT8_C(   9), INT8_C(  12), INT8_C(  38), INT8_C( -60), INT8_C(-117), INT8_C(-122),
+                           INT8_C( 117), INT8_C(  76), INT8_C( -44), INT8_C(  33), INT8_C( 122), INT8_C(  84), INT8_C( -30), INT8_C(-125),
+                           INT8_C(  40), INT8_C(  -8), INT8_C(  71), INT8_C( -17), INT8_C(  49), INT8_C(  64), INT8_C(   3), INT8_C(-124),
+                           INT8_C( 119), INT8_C(  16), INT8_C(  79), INT8_C(  92), INT8_C(-100), INT8_C( -47), INT8_C(  63), INT8_C( 122),
+                           INT8_C(  24), INT8_C( -37), INT8_C( -55), INT8_C(  45), INT8_C( -10), INT8_C( -89), INT8_C(  53), INT8_C(  16),
+                           INT8_C( -37), INT8_C( -63), INT8_C(  21), INT8_C( 121), INT8_C( -56), INT8_C(  21), INT8_C(  18), INT8_C(  52)),
+      simde_mm512_set_epi8(INT8_C( -71), INT8_C(  49), INT8_C( 107), INT8_C( -24), INT8_C(  20), INT8_C( -76), INT8_C( -23), INT8_C(  97),
+                           INT8_C( -50), INT8_C(  61), INT8_C( -49), INT8_C(  68), INT8_C(  22), INT8_C( -41), INT8_C( 106), INT8_C( -76),
+                           INT8_C(  74), INT8_C(  40), INT8_C( -90), INT8_C( -24), INT8_C(  44), INT8_C( -96), INT8_C( -69), INT8_C(  66),
+                           INT8_C(  58), INT8_C(  82), INT8_C( -81), INT8_C(  62), INT8_C( -69), INT8_C( 122), INT8_C(  21), INT8_C( 104),
+                           INT8_C( 118), INT8_C(  34), INT8_C( -89), INT8_C(   5), INT8_C( 123), INT8_C(  -8), INT8_C( -12), INT8_C( -63),
+                           INT8_C( 114), INT8_C( 112), INT8_C(  26), INT8_C(-114), INT8_C( -41), INT8_C( -11), INT8_C(  43), INT8_C(  87),
+                           INT8_C(  97), INT8_C(  41), INT8_C(  29), INT8_C( 104), INT8_C( 107), INT8_C(-122), INT8_C( -35), INT8_C( -20),
+                           INT8_C( -78), INT8_C( -75), INT8_C(  64), INT8_C(  20), INT8_C(-109), INT8_C(  45), INT8_C(   8), INT8_C( -67)),
+      simde_mm512_set_epi8(INT8_C(   0), INT8_C(-109), INT8_C( 106), INT8_C(  82), INT8_C(   0), INT8_C( 104), INT8_C( -49), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C( -69), INT8_C( -23), INT8_C( -63), INT8_C( -23), INT8_C(   0), INT8_C(   0),
+                           INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 104), INT8_C(  82), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C( -49), INT8_C(   0), INT8_C(-114), INT8_C(  21), INT8_C( -76), INT8_C(   0), INT8_C( 122), INT8_C(-109),
+                           INT8_C(  66), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -67), INT8_C(   0), INT8_C(  20),
+                           INT8_C(   0), INT8_C(  87), INT8_C(  97), INT8_C(   0), INT8_C(   5), INT8_C(  43), INT8_C(   0), INT8_C( -76),
+                           INT8_C( -63), INT8_C( 123), INT8_C( -35), INT8_C( -90), INT8_C(  61), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                           INT8_C( 123), INT8_C(   8), INT8_C(  26), INT8_C( -23), INT8_C(   0), INT8_C(   0), INT8_C( -11), INT8_C(  68)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_permutexvar_epi8(test_vec[i].k, test_vec[i].idx, test_vec[i].a);
+    simde_assert_m512i_i8(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_AVX512VBMI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_AVX512VBMI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm512_multishift_epi64_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_multishift_epi64_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_multishift_epi64_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_permutex2var_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_permutex2var_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask2_permutex2var_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_permutex2var_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_permutexvar_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_permutexvar_epi8),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_permutexvar_epi8),
+#endif /* defined(SIMDE_AVX512VBMI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
@@ -0,0 +1,2143 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX avx512vnni
+#include <simde/x86/avx512vnni.h>
+#include <test/x86/test-avx512.h>
+
+#if defined(SIMDE_AVX512VNNI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_mm_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i src;
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C( 1693511353), INT32_C(   40788086), INT32_C( -602179666), INT32_C(  200494509)),
+      simde_mm_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                        INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                        INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm_set_epi32(INT32_C( 1693640893), INT32_C(   40917626), INT32_C( -602050126), INT32_C(  200624049)) },
+    { simde_mm_set_epi32(INT32_C(  218726888), INT32_C(-1040548892), INT32_C(  236899586), INT32_C( -310637379)),
+      simde_mm_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                        INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                        INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm_set_epi32(INT32_C(  218596328), INT32_C(-1040679452), INT32_C(  236769026), INT32_C( -310767939)) },
+    { simde_mm_set_epi32(INT32_C( -478837891), INT32_C(-1472144916), INT32_C( 1667714296), INT32_C( 1106152121)),
+      simde_mm_set_epi8(INT8_C(  74), INT8_C(  58), INT8_C( -30), INT8_C(-101), INT8_C(  42), INT8_C( -16), INT8_C( -53), INT8_C( 121),
+                        INT8_C(-119), INT8_C(  71), INT8_C( -75), INT8_C(  -2), INT8_C(  -3), INT8_C( -90), INT8_C( -81), INT8_C( -90)),
+      simde_mm_set_epi8(INT8_C( 113), INT8_C(  16), INT8_C( -73), INT8_C(  38), INT8_C(  50), INT8_C(  37), INT8_C(-115), INT8_C( -27),
+                        INT8_C( -40), INT8_C( -13), INT8_C(  11), INT8_C(  22), INT8_C(  99), INT8_C(  13), INT8_C(  43), INT8_C( 115)),
+      simde_mm_set_epi32(INT32_C( -478839209), INT32_C(-1472160548), INT32_C( 1667715472), INT32_C( 1106205941)) },
+    { simde_mm_set_epi32(INT32_C( 1357560946), INT32_C(-2015605220), INT32_C(-1472759490), INT32_C(-1635068110)),
+      simde_mm_set_epi8(INT8_C( -66), INT8_C( -60), INT8_C( 104), INT8_C(-115), INT8_C(  53), INT8_C( -73), INT8_C(-121), INT8_C(  47),
+                        INT8_C(   7), INT8_C(  76), INT8_C(  49), INT8_C( -74), INT8_C( -39), INT8_C( -17), INT8_C( -94), INT8_C( -22)),
+      simde_mm_set_epi8(INT8_C( 127), INT8_C(  48), INT8_C(  99), INT8_C(  77), INT8_C(  35), INT8_C(-101), INT8_C(  54), INT8_C( -65),
+                        INT8_C( -76), INT8_C( -47), INT8_C( -65), INT8_C(  73), INT8_C(-122), INT8_C(-113), INT8_C( -60), INT8_C( -74)),
+      simde_mm_set_epi32(INT32_C( 1357615637), INT32_C(-2015617613), INT32_C(-1472753493), INT32_C(-1635148627)) },
+    { simde_mm_set_epi32(INT32_C( 2025093511), INT32_C(-2058124225), INT32_C( 2022062013), INT32_C(-1157340613)),
+      simde_mm_set_epi8(INT8_C(  23), INT8_C(  40), INT8_C(  41), INT8_C(  65), INT8_C( 119), INT8_C(  91), INT8_C( -47), INT8_C(  47),
+                        INT8_C(-109), INT8_C( -76), INT8_C(  17), INT8_C(  85), INT8_C( 123), INT8_C(  30), INT8_C(  27), INT8_C(  89)),
+      simde_mm_set_epi8(INT8_C(  72), INT8_C(  47), INT8_C( 123), INT8_C( 119), INT8_C( -13), INT8_C( -76), INT8_C(  47), INT8_C( -53),
+                        INT8_C( -78), INT8_C(  93), INT8_C( -32), INT8_C(  75), INT8_C(  83), INT8_C( 101), INT8_C(-124), INT8_C(   3)),
+      simde_mm_set_epi32(INT32_C( 2025109825), INT32_C(-2058125356), INT32_C( 2022073118), INT32_C(-1157330455)) },
+    { simde_mm_set_epi32(INT32_C(  492295946), INT32_C(-1100206404), INT32_C(  259096810), INT32_C( 1120810641)),
+      simde_mm_set_epi8(INT8_C( 104), INT8_C(-110), INT8_C( -14), INT8_C(  79), INT8_C(   7), INT8_C(  53), INT8_C(   4), INT8_C( -93),
+                        INT8_C( -72), INT8_C( -24), INT8_C(  98), INT8_C(  14), INT8_C(  -2), INT8_C( -30), INT8_C( -82), INT8_C(  63)),
+      simde_mm_set_epi8(INT8_C(-128), INT8_C(-118), INT8_C(-102), INT8_C( 117), INT8_C( -67), INT8_C( -85), INT8_C( -80), INT8_C(  85),
+                        INT8_C( 100), INT8_C(  93), INT8_C(  45), INT8_C( -50), INT8_C(  35), INT8_C(  93), INT8_C( -85), INT8_C(-126)),
+      simde_mm_set_epi32(INT32_C(  492249965), INT32_C(-1100197843), INT32_C(  259140496), INT32_C( 1120817821)) },
+    { simde_mm_set_epi32(INT32_C(    2436908), INT32_C(  850661734), INT32_C(-1923835978), INT32_C( -404548465)),
+      simde_mm_set_epi8(INT8_C(  33), INT8_C(  62), INT8_C(  73), INT8_C(  -9), INT8_C(  85), INT8_C( -55), INT8_C( -82), INT8_C( 103),
+                        INT8_C(   4), INT8_C(  52), INT8_C( -98), INT8_C( -88), INT8_C(  51), INT8_C(  13), INT8_C(  73), INT8_C( -12)),
+      simde_mm_set_epi8(INT8_C( -41), INT8_C(  78), INT8_C(-127), INT8_C(  10), INT8_C(-101), INT8_C(-126), INT8_C(  99), INT8_C( 113),
+                        INT8_C(  45), INT8_C( -92), INT8_C(  97), INT8_C( -21), INT8_C(  65), INT8_C(-107), INT8_C( 121), INT8_C(  67)),
+      simde_mm_set_epi32(INT32_C(    2433590), INT32_C(  850656688), INT32_C(-1923828784), INT32_C( -404521360)) },
+    { simde_mm_set_epi32(INT32_C( 1838008169), INT32_C(-1289220281), INT32_C( 1867633132), INT32_C(-1442647453)),
+      simde_mm_set_epi8(INT8_C( -93), INT8_C( 114), INT8_C( 102), INT8_C(-121), INT8_C( -37), INT8_C( 107), INT8_C(-101), INT8_C(   4),
+                        INT8_C( 114), INT8_C( -91), INT8_C(  71), INT8_C(  19), INT8_C( -87), INT8_C( -72), INT8_C( 108), INT8_C( -99)),
+      simde_mm_set_epi8(INT8_C(  47), INT8_C( -86), INT8_C(  -9), INT8_C( -23), INT8_C( -24), INT8_C(  63), INT8_C( -89), INT8_C(  21),
+                        INT8_C(  90), INT8_C( -16), INT8_C(  19), INT8_C( 116), INT8_C( -83), INT8_C( -36), INT8_C( -83), INT8_C( -50)),
+      simde_mm_set_epi32(INT32_C( 1838002003), INT32_C(-1289232507), INT32_C( 1867644305), INT32_C(-1442684918)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_dpbusd_epi32(test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i src;
+    simde__mmask8 k;
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C( 1507964546), INT32_C( -506735047), INT32_C( -466144896), INT32_C(-1850375555)),
+      UINT8_C(  3),
+      simde_mm_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                        INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                        INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm_set_epi32(INT32_C( 1507964546), INT32_C( -506735047), INT32_C( -466015356), INT32_C(-1850246015)) },
+    { simde_mm_set_epi32(INT32_C(  888774134), INT32_C( 1687806177), INT32_C( -167024071), INT32_C(  792310404)),
+      UINT8_C(  5),
+      simde_mm_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                        INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                        INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm_set_epi32(INT32_C(  888774134), INT32_C( 1687675617), INT32_C( -167024071), INT32_C(  792179844)) },
+    { simde_mm_set_epi32(INT32_C( -381612380), INT32_C(-1311761561), INT32_C(  388494373), INT32_C(-1853227429)),
+      UINT8_C(  2),
+      simde_mm_set_epi8(INT8_C( -44), INT8_C( -90), INT8_C(  -5), INT8_C( -69), INT8_C(  70), INT8_C(  60), INT8_C( 119), INT8_C( -45),
+                        INT8_C(  40), INT8_C(  93), INT8_C( 103), INT8_C( 109), INT8_C( 115), INT8_C(-121), INT8_C(   9), INT8_C( -64)),
+      simde_mm_set_epi8(INT8_C(  28), INT8_C( 104), INT8_C( -59), INT8_C( -18), INT8_C( -98), INT8_C(   1), INT8_C( -33), INT8_C(  47),
+                        INT8_C(  47), INT8_C( -95), INT8_C( -54), INT8_C(  52), INT8_C(  15), INT8_C(-107), INT8_C(  20), INT8_C(-122)),
+      simde_mm_set_epi32(INT32_C( -381612380), INT32_C(-1311761561), INT32_C(  388487524), INT32_C(-1853227429)) },
+    { simde_mm_set_epi32(INT32_C(-1073196489), INT32_C( -217589290), INT32_C(  762469300), INT32_C(  185533329)),
+      UINT8_C(  1),
+      simde_mm_set_epi8(INT8_C( -24), INT8_C( -52), INT8_C(-105), INT8_C( -16), INT8_C( -86), INT8_C( -78), INT8_C(  76), INT8_C(  45),
+                        INT8_C(  96), INT8_C(  51), INT8_C( 101), INT8_C(  53), INT8_C( -27), INT8_C(  55), INT8_C(-113), INT8_C( -78)),
+      simde_mm_set_epi8(INT8_C(  62), INT8_C( -29), INT8_C( -58), INT8_C( -85), INT8_C(  80), INT8_C(  98), INT8_C( -90), INT8_C(-125),
+                        INT8_C( 127), INT8_C(  69), INT8_C( -57), INT8_C( 107), INT8_C(  82), INT8_C(-103), INT8_C(  -7), INT8_C(  49)),
+      simde_mm_set_epi32(INT32_C(-1073196489), INT32_C( -217589290), INT32_C(  762469300), INT32_C(  185554163)) },
+    { simde_mm_set_epi32(INT32_C(  327137320), INT32_C(  -65223874), INT32_C( 1104565091), INT32_C( 1608034668)),
+      UINT8_C(  9),
+      simde_mm_set_epi8(INT8_C(-114), INT8_C(  51), INT8_C( -25), INT8_C(  97), INT8_C(  59), INT8_C(  48), INT8_C( -28), INT8_C(  98),
+                        INT8_C(  70), INT8_C(  46), INT8_C(  64), INT8_C(-127), INT8_C( -25), INT8_C(-113), INT8_C( -94), INT8_C( -25)),
+      simde_mm_set_epi8(INT8_C(  85), INT8_C(  67), INT8_C(  50), INT8_C( -63), INT8_C(  35), INT8_C( -93), INT8_C(   0), INT8_C(  -5),
+                        INT8_C( -25), INT8_C(  34), INT8_C(  -2), INT8_C(  50), INT8_C(   9), INT8_C(  56), INT8_C(  11), INT8_C( -20)),
+      simde_mm_set_epi32(INT32_C(  327158246), INT32_C(  -65223874), INT32_C( 1104565091), INT32_C( 1608041917)) },
+    { simde_mm_set_epi32(INT32_C(-1124514235), INT32_C( 2123598707), INT32_C(-2009545246), INT32_C( -744698908)),
+      UINT8_C(  1),
+      simde_mm_set_epi8(INT8_C(  95), INT8_C(  37), INT8_C(  95), INT8_C( -72), INT8_C( 116), INT8_C( -23), INT8_C(  81), INT8_C( 112),
+                        INT8_C(  50), INT8_C(-108), INT8_C(  92), INT8_C( -75), INT8_C(  87), INT8_C(-104), INT8_C( 105), INT8_C(  34)),
+      simde_mm_set_epi8(INT8_C( -11), INT8_C( -94), INT8_C(  -6), INT8_C( 104), INT8_C(  82), INT8_C(  36), INT8_C(-111), INT8_C(-109),
+                        INT8_C( 127), INT8_C(  53), INT8_C( -34), INT8_C(  33), INT8_C(  45), INT8_C( -37), INT8_C(  66), INT8_C(-106)),
+      simde_mm_set_epi32(INT32_C(-1124514235), INT32_C( 2123598707), INT32_C(-2009545246), INT32_C( -744697291)) },
+    { simde_mm_set_epi32(INT32_C(  207028369), INT32_C(-1941401798), INT32_C(  511892599), INT32_C(  120959836)),
+      UINT8_C( 15),
+      simde_mm_set_epi8(INT8_C(  75), INT8_C( -66), INT8_C( -86), INT8_C(-114), INT8_C( -81), INT8_C( -85), INT8_C(   9), INT8_C(  30),
+                        INT8_C( 108), INT8_C(-116), INT8_C(  45), INT8_C(  13), INT8_C(  61), INT8_C( -57), INT8_C(  95), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C( -42), INT8_C(   7), INT8_C( -93), INT8_C(  29), INT8_C( -67), INT8_C( -50), INT8_C(  80), INT8_C(  75),
+                        INT8_C( 114), INT8_C( 100), INT8_C( -73), INT8_C(-128), INT8_C(  58), INT8_C( 101), INT8_C( -15), INT8_C( -88)),
+      simde_mm_set_epi32(INT32_C(  207014857), INT32_C(-1941419103), INT32_C(  511913962), INT32_C(  120962248)) },
+    { simde_mm_set_epi32(INT32_C( 1808444015), INT32_C( -976148323), INT32_C(  451130391), INT32_C(-1453174151)),
+      UINT8_C(  2),
+      simde_mm_set_epi8(INT8_C( -68), INT8_C( -56), INT8_C( -82), INT8_C(  -5), INT8_C(  51), INT8_C( -66), INT8_C(-111), INT8_C( -67),
+                        INT8_C( 114), INT8_C( -10), INT8_C(-116), INT8_C( -26), INT8_C( -71), INT8_C(  25), INT8_C(  23), INT8_C(  83)),
+      simde_mm_set_epi8(INT8_C(  49), INT8_C(-104), INT8_C( -45), INT8_C( 105), INT8_C(-109), INT8_C( 108), INT8_C(-102), INT8_C(-117),
+                        INT8_C(-113), INT8_C(  36), INT8_C(  12), INT8_C( -57), INT8_C(  84), INT8_C( -70), INT8_C(-106), INT8_C( 103)),
+      simde_mm_set_epi32(INT32_C( 1808444015), INT32_C( -976148323), INT32_C(  451114935), INT32_C(-1453174151)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mask_dpbusd_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskz_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m128i src;
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { UINT8_C(  3),
+      simde_mm_set_epi32(INT32_C(  482867178), INT32_C( -552522830), INT32_C( -937371129), INT32_C( -363859821)),
+      simde_mm_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                        INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                        INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( -937241589), INT32_C( -363730281)) },
+    { UINT8_C(  3),
+      simde_mm_set_epi32(INT32_C(-1089435276), INT32_C(-1466342790), INT32_C( 1745593336), INT32_C( -650618987)),
+      simde_mm_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                        INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                        INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1745462776), INT32_C( -650749547)) },
+    { UINT8_C(  6),
+      simde_mm_set_epi32(INT32_C(-1881092700), INT32_C( 1407368615), INT32_C( -558150023), INT32_C( -748253573)),
+      simde_mm_set_epi8(INT8_C( -34), INT8_C(  28), INT8_C(-107), INT8_C( -25), INT8_C(  72), INT8_C( 101), INT8_C(  46), INT8_C( -75),
+                        INT8_C( -89), INT8_C( -64), INT8_C(  59), INT8_C( 126), INT8_C( -38), INT8_C(  61), INT8_C( -17), INT8_C( -22)),
+      simde_mm_set_epi8(INT8_C(  83), INT8_C(  37), INT8_C( 113), INT8_C( -59), INT8_C(   8), INT8_C( -18), INT8_C(-111), INT8_C( 123),
+                        INT8_C( -44), INT8_C(-114), INT8_C(  99), INT8_C(-107), INT8_C(  -2), INT8_C( -54), INT8_C( 109), INT8_C( -96)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C( 1407384530), INT32_C( -558186900), INT32_C(          0)) },
+    { UINT8_C(  0),
+      simde_mm_set_epi32(INT32_C( 1511007146), INT32_C( -314699980), INT32_C(-2110612383), INT32_C(  549060233)),
+      simde_mm_set_epi8(INT8_C( -62), INT8_C(  83), INT8_C(  11), INT8_C( -66), INT8_C( -11), INT8_C(-121), INT8_C(  33), INT8_C(  97),
+                        INT8_C( -63), INT8_C(  78), INT8_C(  75), INT8_C(  35), INT8_C( -45), INT8_C( -82), INT8_C(  70), INT8_C( -20)),
+      simde_mm_set_epi8(INT8_C(  90), INT8_C(  -8), INT8_C( -61), INT8_C( -11), INT8_C( -90), INT8_C(  77), INT8_C(  78), INT8_C(-119),
+                        INT8_C( 123), INT8_C( -22), INT8_C(  95), INT8_C(  39), INT8_C( -71), INT8_C( -27), INT8_C( -91), INT8_C(   3)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(  7),
+      simde_mm_set_epi32(INT32_C(-1273034549), INT32_C( 2068956412), INT32_C( -607805019), INT32_C( 1897161272)),
+      simde_mm_set_epi8(INT8_C(-117), INT8_C( -20), INT8_C( -19), INT8_C( 116), INT8_C( -36), INT8_C( -15), INT8_C( -24), INT8_C( -31),
+                        INT8_C(  46), INT8_C( -86), INT8_C(  93), INT8_C(  85), INT8_C(  93), INT8_C(  93), INT8_C( 108), INT8_C( 121)),
+      simde_mm_set_epi8(INT8_C( -53), INT8_C(-102), INT8_C( -57), INT8_C(-106), INT8_C( -77), INT8_C( -14), INT8_C( -14), INT8_C(  63),
+                        INT8_C(-104), INT8_C( 124), INT8_C(  22), INT8_C( 104), INT8_C( -25), INT8_C(-108), INT8_C(  38), INT8_C( -14)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C( 2068947025), INT32_C( -607777837), INT32_C( 1897151313)) },
+    { UINT8_C(  0),
+      simde_mm_set_epi32(INT32_C(-1916818985), INT32_C( 1785429471), INT32_C(-1978100889), INT32_C(-1896122511)),
+      simde_mm_set_epi8(INT8_C( -30), INT8_C( -16), INT8_C(  -1), INT8_C(-103), INT8_C(  62), INT8_C(  18), INT8_C( -84), INT8_C( -43),
+                        INT8_C(  -6), INT8_C(  91), INT8_C( -61), INT8_C(  -3), INT8_C( -33), INT8_C(  44), INT8_C(  65), INT8_C( -42)),
+      simde_mm_set_epi8(INT8_C( -36), INT8_C( -49), INT8_C(  94), INT8_C(   1), INT8_C(-114), INT8_C(  65), INT8_C( 113), INT8_C(-112),
+                        INT8_C(  43), INT8_C(-113), INT8_C(  -5), INT8_C( 125), INT8_C(  -7), INT8_C( -80), INT8_C(  25), INT8_C(  34)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C( 13),
+      simde_mm_set_epi32(INT32_C(  -68869901), INT32_C( 1792523660), INT32_C(-1521824654), INT32_C(  810975945)),
+      simde_mm_set_epi8(INT8_C( -62), INT8_C( -45), INT8_C(  48), INT8_C( -55), INT8_C( 107), INT8_C(-100), INT8_C( -36), INT8_C( -50),
+                        INT8_C( -49), INT8_C(-127), INT8_C(  40), INT8_C( -76), INT8_C(-104), INT8_C(  89), INT8_C( -88), INT8_C(  30)),
+      simde_mm_set_epi8(INT8_C( 123), INT8_C(  39), INT8_C(  17), INT8_C( -41), INT8_C( -40), INT8_C( -34), INT8_C( -79), INT8_C(  48),
+                        INT8_C( 116), INT8_C( -74), INT8_C(  61), INT8_C(  19), INT8_C(-119), INT8_C(  10), INT8_C( -80), INT8_C(  80)),
+      simde_mm_set_epi32(INT32_C(  -68845235), INT32_C( 1792506584), INT32_C(          0), INT32_C(  810947707)) },
+    { UINT8_C(  4),
+      simde_mm_set_epi32(INT32_C(-2053426599), INT32_C(  400977161), INT32_C(-1009736651), INT32_C(  209561542)),
+      simde_mm_set_epi8(INT8_C(  92), INT8_C( -80), INT8_C(-120), INT8_C( -62), INT8_C(-106), INT8_C(  48), INT8_C( 115), INT8_C(  12),
+                        INT8_C(  11), INT8_C( -84), INT8_C(  57), INT8_C(  10), INT8_C(  91), INT8_C( -26), INT8_C(  55), INT8_C( -93)),
+      simde_mm_set_epi8(INT8_C(  23), INT8_C(  78), INT8_C( 112), INT8_C(-125), INT8_C(  34), INT8_C(  43), INT8_C( -31), INT8_C(  51),
+                        INT8_C( -54), INT8_C( -91), INT8_C( -23), INT8_C( -85), INT8_C( -60), INT8_C(-118), INT8_C(-113), INT8_C( 109)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(  400981372), INT32_C(          0), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_maskz_dpbusd_epi32(test_vec[i].k, test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i src;
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(   60214342), INT32_C( 1312513936), INT32_C(-1330152450), INT32_C(  663116324)),
+      simde_mm_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm_set_epi32(INT32_C(-2087203770), INT32_C( -834904176), INT32_C(  817396734), INT32_C(-1484301788)) },
+    { simde_mm_set_epi32(INT32_C( 1854322086), INT32_C(  262877043), INT32_C( -549127728), INT32_C(-1714889717)),
+      simde_mm_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm_set_epi32(INT32_C( -293096026), INT32_C(-1884541069), INT32_C( 1598421456), INT32_C(  432659467)) },
+    { simde_mm_set_epi32(INT32_C( 1754082054), INT32_C(  -34154574), INT32_C(  710079369), INT32_C( -774956607)),
+      simde_mm_set_epi16(INT16_C(-11112), INT16_C( 16882), INT16_C(-12114), INT16_C( 15652), INT16_C( 12238), INT16_C(-26995), INT16_C( -6340), INT16_C(-14026)),
+      simde_mm_set_epi16(INT16_C( -3082), INT16_C(-19189), INT16_C(-30794), INT16_C(-29366), INT16_C(  -792), INT16_C(-32045), INT16_C( 16967), INT16_C( 16777)),
+      simde_mm_set_epi32(INT32_C( 1464380540), INT32_C( -120752690), INT32_C( 1565441648), INT32_C(-1117841589)) },
+    { simde_mm_set_epi32(INT32_C(-1793498161), INT32_C(-1903524850), INT32_C( 1244140327), INT32_C(  559806369)),
+      simde_mm_set_epi16(INT16_C( -4394), INT16_C( 13831), INT16_C(-10363), INT16_C( 17578), INT16_C( 13822), INT16_C( 27793), INT16_C(  -875), INT16_C( 10149)),
+      simde_mm_set_epi16(INT16_C( 20610), INT16_C(-17831), INT16_C(-31349), INT16_C( 22670), INT16_C( 14326), INT16_C(   942), INT16_C(-17535), INT16_C(-28626)),
+      simde_mm_set_epi32(INT32_C(-2130679062), INT32_C(-1180161903), INT32_C( 1468335305), INT32_C(  284624220)) },
+    { simde_mm_set_epi32(INT32_C(  343401153), INT32_C(-1114847201), INT32_C( 1485961997), INT32_C(  282626889)),
+      simde_mm_set_epi16(INT16_C( 26244), INT16_C( -8257), INT16_C( 27187), INT16_C( 19524), INT16_C(   608), INT16_C(-30066), INT16_C(-26692), INT16_C(-18380)),
+      simde_mm_set_epi16(INT16_C( 13321), INT16_C( 23441), INT16_C( 13072), INT16_C( 16934), INT16_C(  2674), INT16_C(-23382), INT16_C( -3145), INT16_C( -6231)),
+      simde_mm_set_epi32(INT32_C(  499445140), INT32_C( -428839321), INT32_C(-2104376295), INT32_C(  481099009)) },
+    { simde_mm_set_epi32(INT32_C( 2097605498), INT32_C(  344729478), INT32_C( 1671773948), INT32_C(-1096439403)),
+      simde_mm_set_epi16(INT16_C( 10767), INT16_C( -9666), INT16_C( 32685), INT16_C( 25334), INT16_C(-31081), INT16_C(-30608), INT16_C(-20552), INT16_C(-11105)),
+      simde_mm_set_epi16(INT16_C(  5435), INT16_C( 27902), INT16_C( -1092), INT16_C( 30924), INT16_C( 31076), INT16_C( -6203), INT16_C( 16282), INT16_C(-13413)),
+      simde_mm_set_epi32(INT32_C( 1886423411), INT32_C( 1092466074), INT32_C(  895762216), INT32_C(-1282115702)) },
+    { simde_mm_set_epi32(INT32_C( 1620774153), INT32_C( 1450705511), INT32_C( 1058568525), INT32_C(-1778839291)),
+      simde_mm_set_epi16(INT16_C(  3904), INT16_C( -1709), INT16_C( -5808), INT16_C( -2589), INT16_C(-14599), INT16_C(-31410), INT16_C(-13238), INT16_C(  3647)),
+      simde_mm_set_epi16(INT16_C( -1235), INT16_C(-15152), INT16_C( -3154), INT16_C(-14644), INT16_C( 11077), INT16_C(    37), INT16_C( -8327), INT16_C(-23355)),
+      simde_mm_set_epi32(INT32_C( 1641847481), INT32_C( 1506937259), INT32_C(  895693232), INT32_C(-1753782150)) },
+    { simde_mm_set_epi32(INT32_C( 1775222590), INT32_C(-1398620952), INT32_C(-1424011499), INT32_C(  144085645)),
+      simde_mm_set_epi16(INT16_C(-22626), INT16_C( 10332), INT16_C(-26937), INT16_C( -1845), INT16_C( 32656), INT16_C(-22231), INT16_C(  9836), INT16_C( 17165)),
+      simde_mm_set_epi16(INT16_C( 13199), INT16_C(-29399), INT16_C(   425), INT16_C(   939), INT16_C( 16795), INT16_C(-24844), INT16_C(-24143), INT16_C(  4687)),
+      simde_mm_set_epi32(INT32_C( 1172831548), INT32_C(-1411801632), INT32_C( -323247015), INT32_C(  -12932548)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_dpwssd_epi32(test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_mask_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i src;
+    simde__mmask8 k;
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { simde_mm_set_epi32(INT32_C(  428461808), INT32_C( 1334886136), INT32_C(  -28993114), INT32_C(-2009606765)),
+      UINT8_C( 11),
+      simde_mm_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm_set_epi32(INT32_C(-1718956304), INT32_C( 1334886136), INT32_C( 2118556070), INT32_C(  137942419)) },
+    { simde_mm_set_epi32(INT32_C( 1188784265), INT32_C(  850997648), INT32_C( 1183626251), INT32_C(  545406637)),
+      UINT8_C(  1),
+      simde_mm_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm_set_epi32(INT32_C( 1188784265), INT32_C(  850997648), INT32_C( 1183626251), INT32_C(-1602011475)) },
+    { simde_mm_set_epi32(INT32_C( 1787662774), INT32_C( 1391125531), INT32_C( -770210300), INT32_C( 1627286476)),
+      UINT8_C(  2),
+      simde_mm_set_epi16(INT16_C(-29291), INT16_C( 23614), INT16_C( 20410), INT16_C( -1898), INT16_C( 16892), INT16_C( 32400), INT16_C(  7107), INT16_C(-21426)),
+      simde_mm_set_epi16(INT16_C( 16265), INT16_C( -4483), INT16_C(  6908), INT16_C(-11145), INT16_C( 20491), INT16_C( -9428), INT16_C( 28361), INT16_C(-19631)),
+      simde_mm_set_epi32(INT32_C( 1787662774), INT32_C( 1391125531), INT32_C( -729543528), INT32_C( 1627286476)) },
+    { simde_mm_set_epi32(INT32_C( -945788138), INT32_C(  441432118), INT32_C( -267238656), INT32_C( -952958221)),
+      UINT8_C( 12),
+      simde_mm_set_epi16(INT16_C(-18739), INT16_C( -3107), INT16_C( -9651), INT16_C(  9805), INT16_C( 21586), INT16_C( -3230), INT16_C(-32069), INT16_C(  -844)),
+      simde_mm_set_epi16(INT16_C( -7894), INT16_C(-21343), INT16_C(  9534), INT16_C(-31388), INT16_C(-26284), INT16_C( -2229), INT16_C( -1861), INT16_C( 29442)),
+      simde_mm_set_epi32(INT32_C( -731549771), INT32_C(   41660144), INT32_C( -267238656), INT32_C( -952958221)) },
+    { simde_mm_set_epi32(INT32_C( -945227403), INT32_C(-1168111142), INT32_C( 1222565720), INT32_C( -264290778)),
+      UINT8_C(  5),
+      simde_mm_set_epi16(INT16_C( 20956), INT16_C( 10541), INT16_C( -7811), INT16_C(-32491), INT16_C(-27888), INT16_C( -6476), INT16_C( 12162), INT16_C(  8213)),
+      simde_mm_set_epi16(INT16_C( -3587), INT16_C(-32111), INT16_C(-27472), INT16_C( 11036), INT16_C(  9886), INT16_C(-13066), INT16_C( 23492), INT16_C( 10131)),
+      simde_mm_set_epi32(INT32_C( -945227403), INT32_C(-1312098026), INT32_C( 1222565720), INT32_C(  104624829)) },
+    { simde_mm_set_epi32(INT32_C(-1762174842), INT32_C( 2100765041), INT32_C(-1810732933), INT32_C(-1418869512)),
+      UINT8_C( 15),
+      simde_mm_set_epi16(INT16_C(-12137), INT16_C(-24615), INT16_C( 16826), INT16_C(-27033), INT16_C( 24857), INT16_C( -9520), INT16_C(-15570), INT16_C(  8866)),
+      simde_mm_set_epi16(INT16_C(-15089), INT16_C(-11184), INT16_C(-10307), INT16_C( 27486), INT16_C( 21137), INT16_C( -8377), INT16_C( -9489), INT16_C( 31782)),
+      simde_mm_set_epi32(INT32_C(-1303745489), INT32_C( 1184310421), INT32_C(-1205581484), INT32_C( -989346570)) },
+    { simde_mm_set_epi32(INT32_C(-1387451828), INT32_C( 1940182494), INT32_C(-1216774153), INT32_C( 1426136993)),
+      UINT8_C( 10),
+      simde_mm_set_epi16(INT16_C( -4182), INT16_C( 31540), INT16_C(-28869), INT16_C(   616), INT16_C( 23659), INT16_C( 21313), INT16_C(-13383), INT16_C( 27889)),
+      simde_mm_set_epi16(INT16_C( -2499), INT16_C(    -2), INT16_C(-20749), INT16_C(-31794), INT16_C( -2638), INT16_C(-15183), INT16_C(   715), INT16_C( -9541)),
+      simde_mm_set_epi32(INT32_C(-1377064090), INT32_C( 1940182494), INT32_C(-1602781874), INT32_C( 1426136993)) },
+    { simde_mm_set_epi32(INT32_C(  371319560), INT32_C(  854666621), INT32_C(-1326055338), INT32_C( 1458127100)),
+      UINT8_C(  1),
+      simde_mm_set_epi16(INT16_C( 24007), INT16_C(-23346), INT16_C(-24101), INT16_C(-24982), INT16_C( 14546), INT16_C(-15432), INT16_C(-18914), INT16_C( -4554)),
+      simde_mm_set_epi16(INT16_C( 16439), INT16_C( 19589), INT16_C(-12972), INT16_C( -1974), INT16_C(-16009), INT16_C( 30884), INT16_C( 16909), INT16_C(-24312)),
+      simde_mm_set_epi32(INT32_C(  371319560), INT32_C(  854666621), INT32_C(-1326055338), INT32_C( 1249027122)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_mask_dpwssd_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_maskz_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m128i src;
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r;
+  } test_vec[8] = {
+    { UINT8_C( 15),
+      simde_mm_set_epi32(INT32_C(    5948185), INT32_C(-1520777864), INT32_C( 1875557322), INT32_C(   59430033)),
+      simde_mm_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm_set_epi32(INT32_C(-2141469927), INT32_C(  626771320), INT32_C( -271860790), INT32_C(-2087988079)) },
+    { UINT8_C(  0),
+      simde_mm_set_epi32(INT32_C(-1992896631), INT32_C( -721748952), INT32_C( 1742606552), INT32_C( 1642869824)),
+      simde_mm_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(  7),
+      simde_mm_set_epi32(INT32_C( -310062443), INT32_C(-1677398892), INT32_C(-1942584164), INT32_C(-1280758450)),
+      simde_mm_set_epi16(INT16_C(-14837), INT16_C(-27361), INT16_C( 14008), INT16_C( -6435), INT16_C(-13690), INT16_C( 21954), INT16_C( 22327), INT16_C( 10888)),
+      simde_mm_set_epi16(INT16_C( 18408), INT16_C( 25301), INT16_C( -9843), INT16_C( 20061), INT16_C( -8358), INT16_C( 18270), INT16_C( 26515), INT16_C(-11020)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(-1944372171), INT32_C(-1427063564), INT32_C( -808743805)) },
+    { UINT8_C( 11),
+      simde_mm_set_epi32(INT32_C( -741194813), INT32_C( -516548120), INT32_C(-1069089369), INT32_C(  -43925400)),
+      simde_mm_set_epi16(INT16_C( 29133), INT16_C(-20962), INT16_C(  -802), INT16_C( 23528), INT16_C(-32436), INT16_C(  1077), INT16_C( 19309), INT16_C(-29519)),
+      simde_mm_set_epi16(INT16_C( 22552), INT16_C(-20677), INT16_C(-29320), INT16_C( -8204), INT16_C(-22053), INT16_C(  9060), INT16_C( 12709), INT16_C(  4245)),
+      simde_mm_set_epi32(INT32_C(  349243877), INT32_C(          0), INT32_C( -344020641), INT32_C(   76164526)) },
+    { UINT8_C(  8),
+      simde_mm_set_epi32(INT32_C(-1634607294), INT32_C(  379465136), INT32_C(  239127568), INT32_C( 1768089535)),
+      simde_mm_set_epi16(INT16_C( -1588), INT16_C( -4259), INT16_C( 31519), INT16_C( -5450), INT16_C(-26680), INT16_C( 17015), INT16_C( -6778), INT16_C( 11693)),
+      simde_mm_set_epi16(INT16_C( -7328), INT16_C( 15764), INT16_C( 16503), INT16_C(-13131), INT16_C(-28613), INT16_C( 28667), INT16_C( 17118), INT16_C(-10342)),
+      simde_mm_set_epi32(INT32_C(-1690109306), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(  1),
+      simde_mm_set_epi32(INT32_C(  916090704), INT32_C(-1490612281), INT32_C( 1838889097), INT32_C(-1795683376)),
+      simde_mm_set_epi16(INT16_C( 21686), INT16_C( 20984), INT16_C( 30061), INT16_C( 16233), INT16_C( 21228), INT16_C( 22320), INT16_C( 10387), INT16_C( 15762)),
+      simde_mm_set_epi16(INT16_C( 30620), INT16_C(-26416), INT16_C(-10804), INT16_C( 20488), INT16_C( -4733), INT16_C( -4230), INT16_C( 10801), INT16_C( 16311)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(-1426399407)) },
+    { UINT8_C(  1),
+      simde_mm_set_epi32(INT32_C(  407237566), INT32_C(   56398912), INT32_C( -543917072), INT32_C( 1488319786)),
+      simde_mm_set_epi16(INT16_C( 25832), INT16_C( 20114), INT16_C( -8891), INT16_C( -1279), INT16_C( -9428), INT16_C( 31412), INT16_C(-17520), INT16_C( -4904)),
+      simde_mm_set_epi16(INT16_C(   402), INT16_C(-31086), INT16_C( 28547), INT16_C(-14752), INT16_C(-20303), INT16_C(-32691), INT16_C(-32316), INT16_C( 17577)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C( 1968298498)) },
+    { UINT8_C(  7),
+      simde_mm_set_epi32(INT32_C( -603287296), INT32_C( 1940068672), INT32_C(-1008089911), INT32_C(-1286233145)),
+      simde_mm_set_epi16(INT16_C(-23495), INT16_C(-23140), INT16_C(-15672), INT16_C(  5283), INT16_C(-20817), INT16_C( 30883), INT16_C( -7856), INT16_C(-13967)),
+      simde_mm_set_epi16(INT16_C(  8790), INT16_C(-24651), INT16_C(-25745), INT16_C( 25618), INT16_C( 13955), INT16_C( 12691), INT16_C( 20537), INT16_C( 23594)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(-1816083090), INT32_C( -906654993), INT32_C(-1777109215)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r = simde_mm_maskz_dpwssd_epi32(test_vec[i].k, test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m128i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i src;
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( -224122120), INT32_C( 1267487927), INT32_C( 1016103075), INT32_C(  848401296), INT32_C(-1631082492), INT32_C( 1820032620), INT32_C(  808840046), INT32_C(-1829560937)),
+      simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm256_set_epi32(INT32_C( -223992580), INT32_C( 1267617467), INT32_C( 1016232615), INT32_C(  848530836), INT32_C(-1630952952), INT32_C( 1820162160), INT32_C(  808969586), INT32_C(-1829431397)) },
+    { simde_mm256_set_epi32(INT32_C(-1423149193), INT32_C(-1587461960), INT32_C(-1746231515), INT32_C(-1590412466), INT32_C(-1410144016), INT32_C(  179601740), INT32_C( -455215543), INT32_C(  974200844)),
+      simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm256_set_epi32(INT32_C(-1423279753), INT32_C(-1587592520), INT32_C(-1746362075), INT32_C(-1590543026), INT32_C(-1410274576), INT32_C(  179471180), INT32_C( -455346103), INT32_C(  974070284)) },
+    { simde_mm256_set_epi32(INT32_C( 1064092761), INT32_C( -896336520), INT32_C( 1514760069), INT32_C(-2051109969), INT32_C(  341727495), INT32_C(  837727747), INT32_C(-1751499197), INT32_C(-1060550772)),
+      simde_mm256_set_epi8(INT8_C( 117), INT8_C( -66), INT8_C(  16), INT8_C( -57), INT8_C(  -9), INT8_C( -64), INT8_C(-101), INT8_C(  65),
+                           INT8_C( -20), INT8_C( -11), INT8_C( -21), INT8_C( 106), INT8_C(  67), INT8_C( 116), INT8_C(  93), INT8_C(  59),
+                           INT8_C( -25), INT8_C( -71), INT8_C( -63), INT8_C( 119), INT8_C( -77), INT8_C( -70), INT8_C(  90), INT8_C(  79),
+                           INT8_C( 122), INT8_C(  16), INT8_C(  25), INT8_C(  45), INT8_C( -22), INT8_C( -48), INT8_C(  17), INT8_C(  45)),
+      simde_mm256_set_epi8(INT8_C( -26), INT8_C( -96), INT8_C( 100), INT8_C(  62), INT8_C( -21), INT8_C( -76), INT8_C( -63), INT8_C(  69),
+                           INT8_C( -41), INT8_C( -46), INT8_C( -25), INT8_C(  17), INT8_C(-121), INT8_C( -23), INT8_C( -67), INT8_C( -66),
+                           INT8_C( 106), INT8_C( 116), INT8_C(   0), INT8_C(  63), INT8_C( -49), INT8_C( -75), INT8_C(  15), INT8_C( -31),
+                           INT8_C( -62), INT8_C( -97), INT8_C(  72), INT8_C(  -1), INT8_C(  75), INT8_C( 109), INT8_C(  -9), INT8_C(-114)),
+      simde_mm256_set_epi32(INT32_C( 1064085417), INT32_C( -896361579), INT32_C( 1514735050), INT32_C(-2051130869), INT32_C(  341780938), INT32_C(  837703927), INT32_C(-1751506558), INT32_C(-1060515833)) },
+    { simde_mm256_set_epi32(INT32_C(  709236424), INT32_C(  262483393), INT32_C(-1390422059), INT32_C(  501000015), INT32_C(-1057718614), INT32_C( 1826791154), INT32_C( -896164114), INT32_C(-1769091409)),
+      simde_mm256_set_epi8(INT8_C( -17), INT8_C( -94), INT8_C( 117), INT8_C(-107), INT8_C(-102), INT8_C(  40), INT8_C(  13), INT8_C( -46),
+                           INT8_C( -56), INT8_C( -42), INT8_C(  83), INT8_C(  82), INT8_C( -18), INT8_C(  18), INT8_C( 118), INT8_C(  -1),
+                           INT8_C( 106), INT8_C(  64), INT8_C(  90), INT8_C(   0), INT8_C( 113), INT8_C(  17), INT8_C( -77), INT8_C(-104),
+                           INT8_C(   9), INT8_C(  20), INT8_C( 118), INT8_C( -20), INT8_C(-101), INT8_C(  36), INT8_C( -24), INT8_C(  72)),
+      simde_mm256_set_epi8(INT8_C(-117), INT8_C(  -8), INT8_C( -78), INT8_C( -90), INT8_C( -60), INT8_C( -94), INT8_C(  48), INT8_C(  51),
+                           INT8_C( -52), INT8_C( -27), INT8_C(-115), INT8_C( -42), INT8_C(  67), INT8_C( -99), INT8_C( 100), INT8_C(  59),
+                           INT8_C( -54), INT8_C(  17), INT8_C(-104), INT8_C(  57), INT8_C( 122), INT8_C( -71), INT8_C( 111), INT8_C( -28),
+                           INT8_C( -14), INT8_C( 124), INT8_C( -24), INT8_C(  38), INT8_C(  85), INT8_C( -58), INT8_C( 108), INT8_C(  60)),
+      simde_mm256_set_epi32(INT32_C(  709184629), INT32_C(  262481727), INT32_C(-1390451226), INT32_C(  501041024), INT32_C(-1057732610), INT32_C( 1826819346), INT32_C( -896155624), INT32_C(-1769050946)) },
+    { simde_mm256_set_epi32(INT32_C( 1880775710), INT32_C(  551770772), INT32_C( -722839830), INT32_C( 2056045596), INT32_C( -799861027), INT32_C(-1596001099), INT32_C(-1665519195), INT32_C( 1224757654)),
+      simde_mm256_set_epi8(INT8_C(-105), INT8_C( -29), INT8_C(  -7), INT8_C(  40), INT8_C( 116), INT8_C( -66), INT8_C(  24), INT8_C(-127),
+                           INT8_C( -43), INT8_C( -83), INT8_C(  48), INT8_C(  72), INT8_C(  83), INT8_C(  98), INT8_C( -10), INT8_C(  45),
+                           INT8_C( 124), INT8_C( -79), INT8_C( -81), INT8_C( -21), INT8_C( -61), INT8_C( -22), INT8_C(-113), INT8_C( -78),
+                           INT8_C( -81), INT8_C( -49), INT8_C( -15), INT8_C(-128), INT8_C( -59), INT8_C(  34), INT8_C(-124), INT8_C(  58)),
+      simde_mm256_set_epi8(INT8_C( 104), INT8_C( 111), INT8_C( -95), INT8_C(  13), INT8_C(  36), INT8_C( -71), INT8_C( -74), INT8_C(  53),
+                           INT8_C(   8), INT8_C(-112), INT8_C(  13), INT8_C( -53), INT8_C( 125), INT8_C(  47), INT8_C(  70), INT8_C( -72),
+                           INT8_C( -15), INT8_C( -47), INT8_C(  16), INT8_C( 106), INT8_C(  45), INT8_C( -93), INT8_C(  11), INT8_C(  46),
+                           INT8_C(  51), INT8_C( -32), INT8_C( 107), INT8_C(  32), INT8_C(  35), INT8_C(  84), INT8_C( 111), INT8_C( -79)),
+      simde_mm256_set_epi32(INT32_C( 1880793476), INT32_C(  551766519), INT32_C( -722860694), INT32_C( 2056074557), INT32_C( -799843496), INT32_C(-1596004325), INT32_C(-1665487011), INT32_C( 1224777475)) },
+    { simde_mm256_set_epi32(INT32_C(-1341361433), INT32_C(  275303129), INT32_C(  556472369), INT32_C( -651449021), INT32_C(  216045832), INT32_C(  718301584), INT32_C( -145654136), INT32_C(-1516164475)),
+      simde_mm256_set_epi8(INT8_C(  46), INT8_C(  10), INT8_C(-109), INT8_C( 106), INT8_C( -76), INT8_C( 111), INT8_C(  71), INT8_C(  61),
+                           INT8_C( -48), INT8_C(  81), INT8_C(-120), INT8_C( -49), INT8_C(  -5), INT8_C(   4), INT8_C(  -2), INT8_C( -64),
+                           INT8_C( 127), INT8_C(  -3), INT8_C(  44), INT8_C( -93), INT8_C( -34), INT8_C(  88), INT8_C(  75), INT8_C(-105),
+                           INT8_C( -92), INT8_C( -99), INT8_C(  63), INT8_C( -62), INT8_C(  91), INT8_C(  34), INT8_C( -14), INT8_C( -14)),
+      simde_mm256_set_epi8(INT8_C( -75), INT8_C(  43), INT8_C(  90), INT8_C(-109), INT8_C( 101), INT8_C(   0), INT8_C(  86), INT8_C( -54),
+                           INT8_C( 116), INT8_C( 106), INT8_C( -77), INT8_C(-110), INT8_C(  78), INT8_C( -24), INT8_C( -58), INT8_C(-121),
+                           INT8_C(-121), INT8_C(  68), INT8_C( -35), INT8_C(  65), INT8_C(-122), INT8_C(  42), INT8_C(  98), INT8_C( -62),
+                           INT8_C( 122), INT8_C( -46), INT8_C(  78), INT8_C(  81), INT8_C(  36), INT8_C( -49), INT8_C( -74), INT8_C(  46)),
+      simde_mm256_set_epi32(INT32_C(-1341362777), INT32_C(  275324121), INT32_C(  556471841), INT32_C( -651467503), INT32_C(  216056724), INT32_C(  718276184), INT32_C( -145620722), INT32_C(-1516169641)) },
+    { simde_mm256_set_epi32(INT32_C(  414686066), INT32_C(  535315833), INT32_C( -548590576), INT32_C(  407232696), INT32_C( 1122305243), INT32_C(  858569357), INT32_C( 1825701873), INT32_C( 1196002452)),
+      simde_mm256_set_epi8(INT8_C(  97), INT8_C(-106), INT8_C(  -6), INT8_C(  93), INT8_C(  80), INT8_C( -99), INT8_C( -55), INT8_C( -14),
+                           INT8_C( -26), INT8_C(  83), INT8_C(  -3), INT8_C(  91), INT8_C(-121), INT8_C( 113), INT8_C( 122), INT8_C( -57),
+                           INT8_C( -55), INT8_C(-104), INT8_C(  -7), INT8_C( 100), INT8_C(  73), INT8_C(  13), INT8_C(-128), INT8_C(   7),
+                           INT8_C( -45), INT8_C(   6), INT8_C(  99), INT8_C(  54), INT8_C(  72), INT8_C(  11), INT8_C( 122), INT8_C(  51)),
+      simde_mm256_set_epi8(INT8_C(  22), INT8_C(   9), INT8_C( 102), INT8_C(  28), INT8_C(  -2), INT8_C( 101), INT8_C(-109), INT8_C( -25),
+                           INT8_C(-109), INT8_C( -63), INT8_C( 113), INT8_C(  35), INT8_C( 114), INT8_C( -78), INT8_C(  11), INT8_C( -16),
+                           INT8_C(  54), INT8_C(  78), INT8_C(-102), INT8_C(  89), INT8_C(  85), INT8_C(  -1), INT8_C( -17), INT8_C( -17),
+                           INT8_C( 105), INT8_C(  74), INT8_C(  27), INT8_C(  46), INT8_C(  84), INT8_C( -67), INT8_C( 107), INT8_C( 121)),
+      simde_mm256_set_epi32(INT32_C(  414717654), INT32_C(  535303571), INT32_C( -548589101), INT32_C(  407237430), INT32_C( 1122311455), INT32_C(  858573254), INT32_C( 1825729629), INT32_C( 1196026988)) },
+    { simde_mm256_set_epi32(INT32_C(-1075793481), INT32_C(  147179613), INT32_C(   51247139), INT32_C( 1383633973), INT32_C( 1740366948), INT32_C(  893273784), INT32_C( 2053219764), INT32_C( -104147436)),
+      simde_mm256_set_epi8(INT8_C(-116), INT8_C(  80), INT8_C( -38), INT8_C( -14), INT8_C( -68), INT8_C(  63), INT8_C(  74), INT8_C(  76),
+                           INT8_C(  11), INT8_C(-116), INT8_C(-116), INT8_C(-127), INT8_C( -14), INT8_C( -61), INT8_C(  74), INT8_C(-103),
+                           INT8_C( -54), INT8_C(  26), INT8_C(  50), INT8_C(  70), INT8_C( -89), INT8_C(  68), INT8_C( -26), INT8_C(  21),
+                           INT8_C( -79), INT8_C(  85), INT8_C(-109), INT8_C(  -7), INT8_C(  16), INT8_C(  12), INT8_C(  82), INT8_C( -80)),
+      simde_mm256_set_epi8(INT8_C(  63), INT8_C( -22), INT8_C( -17), INT8_C(  93), INT8_C(  73), INT8_C( -98), INT8_C( -93), INT8_C(-117),
+                           INT8_C(  -4), INT8_C(  17), INT8_C(  54), INT8_C( -78), INT8_C(  80), INT8_C(  57), INT8_C( -93), INT8_C( -52),
+                           INT8_C( -21), INT8_C(  89), INT8_C(  41), INT8_C( -73), INT8_C( 126), INT8_C(  84), INT8_C(-111), INT8_C( 110),
+                           INT8_C(  43), INT8_C(-121), INT8_C(   0), INT8_C(  44), INT8_C( -83), INT8_C(  15), INT8_C(  88), INT8_C(  94)),
+      simde_mm256_set_epi32(INT32_C(-1075767621), INT32_C(  147171389), INT32_C(   51246973), INT32_C( 1383649610), INT32_C( 1740361960), INT32_C(  893277318), INT32_C( 2053228046), INT32_C( -104124824)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_dpbusd_epi32(test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i src;
+    simde__mmask8 k;
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( -691145995), INT32_C(   83100260), INT32_C( 1094948760), INT32_C(  563324980), INT32_C(-2059309972), INT32_C(  247511108), INT32_C(  494781549), INT32_C(-1551418832)),
+      UINT8_C(253),
+      simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm256_set_epi32(INT32_C( -691016455), INT32_C(   83229800), INT32_C( 1095078300), INT32_C(  563454520), INT32_C(-2059180432), INT32_C(  247640648), INT32_C(  494781549), INT32_C(-1551289292)) },
+    { simde_mm256_set_epi32(INT32_C(-2103979951), INT32_C( 2141361554), INT32_C( -778761505), INT32_C( 1917870416), INT32_C(  -91231406), INT32_C( 1500035104), INT32_C( 1871655085), INT32_C( -440937206)),
+      UINT8_C(218),
+      simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm256_set_epi32(INT32_C(-2104110511), INT32_C( 2141230994), INT32_C( -778761505), INT32_C( 1917739856), INT32_C(  -91361966), INT32_C( 1500035104), INT32_C( 1871524525), INT32_C( -440937206)) },
+    { simde_mm256_set_epi32(INT32_C( 1672812313), INT32_C( 1723929264), INT32_C(  531816883), INT32_C( -959270251), INT32_C( 1755437450), INT32_C( -164205106), INT32_C( -204672937), INT32_C( -190647573)),
+      UINT8_C(134),
+      simde_mm256_set_epi8(INT8_C(  32), INT8_C(  61), INT8_C( 101), INT8_C(  68), INT8_C( 110), INT8_C(  -9), INT8_C(  75), INT8_C(  36),
+                           INT8_C(  -3), INT8_C(  55), INT8_C( -85), INT8_C( 124), INT8_C( 120), INT8_C( 115), INT8_C(  39), INT8_C( -85),
+                           INT8_C(  67), INT8_C(-127), INT8_C( -95), INT8_C( -88), INT8_C( 110), INT8_C(  52), INT8_C(  38), INT8_C(  39),
+                           INT8_C(-103), INT8_C(  72), INT8_C(-117), INT8_C(   9), INT8_C( -23), INT8_C( -51), INT8_C(  89), INT8_C(-108)),
+      simde_mm256_set_epi8(INT8_C( -91), INT8_C(-100), INT8_C( -43), INT8_C(  35), INT8_C( -36), INT8_C(  91), INT8_C( -55), INT8_C( -48),
+                           INT8_C(  92), INT8_C(   3), INT8_C(  98), INT8_C( -68), INT8_C(  13), INT8_C( 115), INT8_C(  50), INT8_C( -11),
+                           INT8_C( -50), INT8_C(-105), INT8_C( -81), INT8_C( -10), INT8_C( 117), INT8_C( -44), INT8_C(  37), INT8_C( 127),
+                           INT8_C( -54), INT8_C( 109), INT8_C(  59), INT8_C(  39), INT8_C( -56), INT8_C(  13), INT8_C( -34), INT8_C(   3)),
+      simde_mm256_set_epi32(INT32_C( 1672801338), INT32_C( 1723929264), INT32_C(  531816883), INT32_C( -959270251), INT32_C( 1755437450), INT32_C( -164188165), INT32_C( -204664799), INT32_C( -190647573)) },
+    { simde_mm256_set_epi32(INT32_C( -557172755), INT32_C(  445763126), INT32_C(-1793460915), INT32_C( 2138435670), INT32_C(-1391628477), INT32_C( 2111891417), INT32_C( -430248084), INT32_C( 1376111617)),
+      UINT8_C(128),
+      simde_mm256_set_epi8(INT8_C( -82), INT8_C(  53), INT8_C( -84), INT8_C(  -7), INT8_C(  45), INT8_C( -52), INT8_C( -40), INT8_C( -35),
+                           INT8_C(  48), INT8_C(  53), INT8_C( -71), INT8_C(  56), INT8_C(  66), INT8_C( 113), INT8_C(-105), INT8_C(  51),
+                           INT8_C( -64), INT8_C(  -7), INT8_C(-104), INT8_C(  40), INT8_C(   0), INT8_C( 121), INT8_C(  17), INT8_C(  81),
+                           INT8_C(   0), INT8_C(  99), INT8_C( -38), INT8_C(-125), INT8_C(   3), INT8_C(  71), INT8_C( -77), INT8_C( -74)),
+      simde_mm256_set_epi8(INT8_C( -74), INT8_C( -16), INT8_C( 125), INT8_C( -68), INT8_C( -99), INT8_C( -70), INT8_C(  37), INT8_C(   8),
+                           INT8_C( -64), INT8_C(  62), INT8_C(-103), INT8_C( -54), INT8_C(  36), INT8_C( -62), INT8_C( -68), INT8_C( 112),
+                           INT8_C( -27), INT8_C( -13), INT8_C(  62), INT8_C( -70), INT8_C( -65), INT8_C(  58), INT8_C( -58), INT8_C( -67),
+                           INT8_C( -94), INT8_C(  -1), INT8_C( -98), INT8_C( -60), INT8_C(  86), INT8_C( -70), INT8_C(  22), INT8_C(-112)),
+      simde_mm256_set_epi32(INT32_C( -557181911), INT32_C(  445763126), INT32_C(-1793460915), INT32_C( 2138435670), INT32_C(-1391628477), INT32_C( 2111891417), INT32_C( -430248084), INT32_C( 1376111617)) },
+    { simde_mm256_set_epi32(INT32_C( 1130114256), INT32_C( -360642188), INT32_C( 1281734217), INT32_C(-1710514801), INT32_C( 1683885481), INT32_C( 2088535428), INT32_C( -556013039), INT32_C( -679273219)),
+      UINT8_C( 37),
+      simde_mm256_set_epi8(INT8_C(   3), INT8_C( -57), INT8_C(  71), INT8_C( -21), INT8_C( -60), INT8_C(  84), INT8_C( 113), INT8_C(  23),
+                           INT8_C( -61), INT8_C( -50), INT8_C( -80), INT8_C( -32), INT8_C( -11), INT8_C(  26), INT8_C( -95), INT8_C(  21),
+                           INT8_C(-109), INT8_C( -25), INT8_C( 110), INT8_C( -74), INT8_C(-102), INT8_C( 102), INT8_C( -50), INT8_C(-120),
+                           INT8_C(-107), INT8_C(-122), INT8_C(  51), INT8_C(-123), INT8_C( -10), INT8_C(  35), INT8_C(-110), INT8_C( -19)),
+      simde_mm256_set_epi8(INT8_C(  70), INT8_C( 111), INT8_C(  23), INT8_C( -69), INT8_C( 125), INT8_C(  77), INT8_C(-123), INT8_C(  38),
+                           INT8_C( -36), INT8_C( -29), INT8_C(  68), INT8_C( -94), INT8_C(-103), INT8_C( -82), INT8_C(   0), INT8_C( -25),
+                           INT8_C(  14), INT8_C( -95), INT8_C( -41), INT8_C( 121), INT8_C( -10), INT8_C(  64), INT8_C( 110), INT8_C( -70),
+                           INT8_C( -72), INT8_C( -27), INT8_C( -93), INT8_C(  -8), INT8_C( -68), INT8_C(  11), INT8_C(  36), INT8_C( 114)),
+      simde_mm256_set_epi32(INT32_C( 1130114256), INT32_C( -360642188), INT32_C( 1281712135), INT32_C(-1710514801), INT32_C( 1683885481), INT32_C( 2088553556), INT32_C( -556013039), INT32_C( -679257288)) },
+    { simde_mm256_set_epi32(INT32_C( -378493442), INT32_C( 1408426470), INT32_C(-2070726370), INT32_C( -357604113), INT32_C(-1687746598), INT32_C(   88481236), INT32_C( -243468729), INT32_C(  590006663)),
+      UINT8_C( 96),
+      simde_mm256_set_epi8(INT8_C(  91), INT8_C( -45), INT8_C( -28), INT8_C(  79), INT8_C(  -5), INT8_C( -12), INT8_C(  68), INT8_C(  65),
+                           INT8_C(  92), INT8_C(-128), INT8_C(  21), INT8_C(  74), INT8_C(  42), INT8_C(  74), INT8_C(  -2), INT8_C( -68),
+                           INT8_C(  -5), INT8_C( -82), INT8_C(-119), INT8_C(  33), INT8_C(  58), INT8_C(-112), INT8_C(  94), INT8_C(   0),
+                           INT8_C(  83), INT8_C( -67), INT8_C(  15), INT8_C( -96), INT8_C( -52), INT8_C( 104), INT8_C(-118), INT8_C(  20)),
+      simde_mm256_set_epi8(INT8_C(  -8), INT8_C( 119), INT8_C( -33), INT8_C( -89), INT8_C(  -4), INT8_C( -14), INT8_C( -69), INT8_C(  36),
+                           INT8_C(-110), INT8_C( -97), INT8_C(  -4), INT8_C( -71), INT8_C(  62), INT8_C( -21), INT8_C( -26), INT8_C( -87),
+                           INT8_C( -36), INT8_C( 107), INT8_C( -63), INT8_C(  74), INT8_C(  -3), INT8_C( -17), INT8_C(   3), INT8_C( 111),
+                           INT8_C( 105), INT8_C(-106), INT8_C( -42), INT8_C(  82), INT8_C( -61), INT8_C(  50), INT8_C(-119), INT8_C(  61)),
+      simde_mm256_set_epi32(INT32_C( -378493442), INT32_C( 1408419698), INT32_C(-2070754244), INT32_C( -357604113), INT32_C(-1687746598), INT32_C(   88481236), INT32_C( -243468729), INT32_C(  590006663)) },
+    { simde_mm256_set_epi32(INT32_C(  840250401), INT32_C( 2093610282), INT32_C(-1910738463), INT32_C( 1111767711), INT32_C( 1798755091), INT32_C(  727153957), INT32_C( -416580873), INT32_C(  123170044)),
+      UINT8_C(164),
+      simde_mm256_set_epi8(INT8_C(  -5), INT8_C( 125), INT8_C( 117), INT8_C( 109), INT8_C( -85), INT8_C(   9), INT8_C(  65), INT8_C( -95),
+                           INT8_C(  47), INT8_C( 116), INT8_C( -12), INT8_C( -32), INT8_C(   7), INT8_C(-104), INT8_C(  78), INT8_C( 125),
+                           INT8_C(-122), INT8_C( -31), INT8_C( 100), INT8_C(  67), INT8_C( -94), INT8_C(  57), INT8_C(-125), INT8_C(  -6),
+                           INT8_C(  11), INT8_C(  70), INT8_C( -99), INT8_C(  59), INT8_C(-119), INT8_C( -39), INT8_C( 106), INT8_C( -17)),
+      simde_mm256_set_epi8(INT8_C(-114), INT8_C(  80), INT8_C( -31), INT8_C( -12), INT8_C( 117), INT8_C(  -6), INT8_C(  54), INT8_C( 109),
+                           INT8_C( -28), INT8_C(  38), INT8_C( 106), INT8_C(  99), INT8_C( 110), INT8_C( -64), INT8_C(   9), INT8_C(  -2),
+                           INT8_C(  20), INT8_C(  46), INT8_C(-115), INT8_C( -87), INT8_C(  87), INT8_C( -28), INT8_C(  11), INT8_C( -87),
+                           INT8_C( -23), INT8_C( 119), INT8_C(  38), INT8_C(  66), INT8_C( -93), INT8_C(  29), INT8_C(  13), INT8_C( 115)),
+      simde_mm256_set_epi32(INT32_C(  840226852), INT32_C( 2093610282), INT32_C(-1910687331), INT32_C( 1111767711), INT32_C( 1798755091), INT32_C(  727146146), INT32_C( -416580873), INT32_C(  123170044)) },
+    { simde_mm256_set_epi32(INT32_C(-1081671626), INT32_C( 1043005437), INT32_C( 1990097450), INT32_C( 2125609100), INT32_C( 1743706036), INT32_C(  319668082), INT32_C(  450570276), INT32_C( -651317037)),
+      UINT8_C(141),
+      simde_mm256_set_epi8(INT8_C( -67), INT8_C( -62), INT8_C(  17), INT8_C(  38), INT8_C(   4), INT8_C( -44), INT8_C( -18), INT8_C(-102),
+                           INT8_C(  -5), INT8_C(  16), INT8_C(  23), INT8_C( 114), INT8_C(  73), INT8_C(  73), INT8_C(  51), INT8_C( -67),
+                           INT8_C( -55), INT8_C(  61), INT8_C(  38), INT8_C( -11), INT8_C(  87), INT8_C( -53), INT8_C(  12), INT8_C( -92),
+                           INT8_C( -26), INT8_C(-110), INT8_C( -55), INT8_C( -79), INT8_C( -35), INT8_C(  53), INT8_C( -21), INT8_C( -77)),
+      simde_mm256_set_epi8(INT8_C( 123), INT8_C(  62), INT8_C( -17), INT8_C( -61), INT8_C(-115), INT8_C( -61), INT8_C(  44), INT8_C(  71),
+                           INT8_C( -45), INT8_C(  57), INT8_C(  26), INT8_C( -92), INT8_C(  38), INT8_C(   9), INT8_C( -53), INT8_C( -48),
+                           INT8_C(  22), INT8_C( -23), INT8_C( -77), INT8_C(  -9), INT8_C(  37), INT8_C( 113), INT8_C(  54), INT8_C(  -3),
+                           INT8_C( -69), INT8_C( 111), INT8_C(  71), INT8_C(  27), INT8_C( -20), INT8_C( 124), INT8_C(  97), INT8_C( -66)),
+      simde_mm256_set_epi32(INT32_C(-1081638958), INT32_C( 1043005437), INT32_C( 1990097450), INT32_C( 2125609100), INT32_C( 1743703924), INT32_C(  319694396), INT32_C(  450570276), INT32_C( -651303904)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_dpbusd_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskz_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m256i src;
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { UINT8_C( 36),
+      simde_mm256_set_epi32(INT32_C(  385293994), INT32_C(  243077778), INT32_C(-2084560825), INT32_C( -815425986), INT32_C(  960214121), INT32_C( -127993778), INT32_C(  800255402), INT32_C(  949622116)),
+      simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(-2084431285), INT32_C(          0), INT32_C(          0), INT32_C( -127864238), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(180),
+      simde_mm256_set_epi32(INT32_C(  728923250), INT32_C( 1777377101), INT32_C( 1342634275), INT32_C( 1968805350), INT32_C( 1737355591), INT32_C(  -90413272), INT32_C( 1805248570), INT32_C( 1836289072)),
+      simde_mm256_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm256_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm256_set_epi32(INT32_C(  728792690), INT32_C(          0), INT32_C( 1342503715), INT32_C( 1968674790), INT32_C(          0), INT32_C(  -90543832), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(114),
+      simde_mm256_set_epi32(INT32_C( 1783275239), INT32_C(  613502153), INT32_C( 1713251986), INT32_C( -732245459), INT32_C( -280482519), INT32_C(-1944239448), INT32_C(  434915075), INT32_C(  134199965)),
+      simde_mm256_set_epi8(INT8_C( 114), INT8_C( -25), INT8_C( 109), INT8_C( -10), INT8_C(  14), INT8_C(  11), INT8_C( -34), INT8_C( -23),
+                           INT8_C( -58), INT8_C(  21), INT8_C(   5), INT8_C( -94), INT8_C( 107), INT8_C( -77), INT8_C(-126), INT8_C( -20),
+                           INT8_C( 107), INT8_C( -72), INT8_C(  -3), INT8_C( 120), INT8_C(  95), INT8_C(   0), INT8_C(  14), INT8_C( -79),
+                           INT8_C(  12), INT8_C( -12), INT8_C( -88), INT8_C(  57), INT8_C( -75), INT8_C( -57), INT8_C( -87), INT8_C(  35)),
+      simde_mm256_set_epi8(INT8_C( -75), INT8_C( -81), INT8_C(  79), INT8_C(  51), INT8_C(  91), INT8_C(  42), INT8_C(   5), INT8_C(  85),
+                           INT8_C( 100), INT8_C(-112), INT8_C(  76), INT8_C(  28), INT8_C(  61), INT8_C( -63), INT8_C(  35), INT8_C(-110),
+                           INT8_C( -37), INT8_C( -26), INT8_C( 103), INT8_C( -89), INT8_C( -38), INT8_C(  67), INT8_C(  -1), INT8_C( 108),
+                           INT8_C(  -9), INT8_C(  91), INT8_C(-124), INT8_C(-111), INT8_C( -53), INT8_C( -47), INT8_C( -59), INT8_C( 102)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(  613524804), INT32_C( 1713274350), INT32_C( -732271619), INT32_C(          0), INT32_C(          0), INT32_C(  434910012), INT32_C(          0)) },
+    { UINT8_C(196),
+      simde_mm256_set_epi32(INT32_C(  450168546), INT32_C(  -27877390), INT32_C(  405818953), INT32_C( -922299237), INT32_C( -232803393), INT32_C( 1766924196), INT32_C(-1438960328), INT32_C(-1747836062)),
+      simde_mm256_set_epi8(INT8_C(   2), INT8_C(  30), INT8_C(-128), INT8_C(   5), INT8_C(-104), INT8_C(  41), INT8_C( -67), INT8_C(  -4),
+                           INT8_C(-128), INT8_C(  48), INT8_C(  99), INT8_C( -35), INT8_C( -98), INT8_C( -37), INT8_C(-122), INT8_C( -79),
+                           INT8_C(  66), INT8_C( -22), INT8_C(  92), INT8_C( -81), INT8_C(  59), INT8_C( -80), INT8_C( -46), INT8_C(  85),
+                           INT8_C(  85), INT8_C( 102), INT8_C( -99), INT8_C( -94), INT8_C( -43), INT8_C( -77), INT8_C(  30), INT8_C(  41)),
+      simde_mm256_set_epi8(INT8_C(   6), INT8_C(  50), INT8_C( -19), INT8_C(  16), INT8_C(  81), INT8_C(  61), INT8_C( -68), INT8_C( -52),
+                           INT8_C(-122), INT8_C( -73), INT8_C( -58), INT8_C( 124), INT8_C(  85), INT8_C(  -9), INT8_C( -64), INT8_C(  76),
+                           INT8_C( 104), INT8_C( -55), INT8_C( -68), INT8_C(  58), INT8_C( 107), INT8_C( -39), INT8_C( -32), INT8_C( -51),
+                           INT8_C(  77), INT8_C( -65), INT8_C( -85), INT8_C( -26), INT8_C(  44), INT8_C(  58), INT8_C(  37), INT8_C(  71)),
+      simde_mm256_set_epi32(INT32_C(  450167706), INT32_C(  -27888533), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C( 1766912590), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(144),
+      simde_mm256_set_epi32(INT32_C(-1160127879), INT32_C( 1362992883), INT32_C(  973353418), INT32_C( 1202887175), INT32_C( 1653057103), INT32_C( 1665332271), INT32_C( -612972347), INT32_C(  592953105)),
+      simde_mm256_set_epi8(INT8_C(  94), INT8_C(-117), INT8_C(-114), INT8_C(  88), INT8_C(  40), INT8_C(  13), INT8_C(  45), INT8_C(  66),
+                           INT8_C(  36), INT8_C(  69), INT8_C( 106), INT8_C(  64), INT8_C( -33), INT8_C(  79), INT8_C(  -4), INT8_C(  58),
+                           INT8_C(  98), INT8_C( -96), INT8_C( 114), INT8_C(-107), INT8_C(-103), INT8_C(  14), INT8_C( -75), INT8_C(  80),
+                           INT8_C(  62), INT8_C(  99), INT8_C( -66), INT8_C(  11), INT8_C( 115), INT8_C(  26), INT8_C(-121), INT8_C( -97)),
+      simde_mm256_set_epi8(INT8_C( 121), INT8_C( -40), INT8_C(  75), INT8_C(  35), INT8_C( 126), INT8_C(-104), INT8_C( -52), INT8_C( -87),
+                           INT8_C(  84), INT8_C( -31), INT8_C(  37), INT8_C( -96), INT8_C(  90), INT8_C(  91), INT8_C(  95), INT8_C(-106),
+                           INT8_C(   4), INT8_C( -52), INT8_C( 125), INT8_C(  50), INT8_C(  48), INT8_C(  85), INT8_C(  32), INT8_C(  86),
+                           INT8_C(  38), INT8_C( -96), INT8_C( -36), INT8_C( -79), INT8_C( 108), INT8_C(-102), INT8_C( -64), INT8_C(  86)),
+      simde_mm256_set_epi32(INT32_C(-1160108335), INT32_C(          0), INT32_C(          0), INT32_C( 1202932226), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C( 46),
+      simde_mm256_set_epi32(INT32_C(  417057069), INT32_C( -156814064), INT32_C( -608103047), INT32_C( -938143180), INT32_C(  929282351), INT32_C(-1049528679), INT32_C(  988707233), INT32_C( 1695709225)),
+      simde_mm256_set_epi8(INT8_C(  97), INT8_C(  41), INT8_C(  29), INT8_C( 104), INT8_C( 107), INT8_C(-122), INT8_C( -35), INT8_C( -20),
+                           INT8_C( -78), INT8_C( -75), INT8_C(  64), INT8_C(  20), INT8_C(-109), INT8_C(  45), INT8_C(   8), INT8_C( -67),
+                           INT8_C(  69), INT8_C(-125), INT8_C( -15), INT8_C( -90), INT8_C( -38), INT8_C(  76), INT8_C(  53), INT8_C(  23),
+                           INT8_C( -78), INT8_C( -90), INT8_C( -87), INT8_C( 121), INT8_C(  88), INT8_C(  -7), INT8_C(  35), INT8_C(  17)),
+      simde_mm256_set_epi8(INT8_C(-119), INT8_C(  77), INT8_C(  18), INT8_C( -56), INT8_C( -23), INT8_C(-125), INT8_C( 127), INT8_C( -62),
+                           INT8_C( 118), INT8_C(  60), INT8_C(  24), INT8_C( -69), INT8_C(-123), INT8_C( 109), INT8_C(  -8), INT8_C( -13),
+                           INT8_C( -71), INT8_C(  49), INT8_C( 107), INT8_C( -24), INT8_C(  20), INT8_C( -76), INT8_C( -23), INT8_C(  97),
+                           INT8_C( -50), INT8_C(  61), INT8_C( -49), INT8_C(  68), INT8_C(  22), INT8_C( -41), INT8_C( 106), INT8_C( -76)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( -608071027), INT32_C(          0), INT32_C(  929305674), INT32_C(-1049529083), INT32_C(  988708406), INT32_C(          0)) },
+    { UINT8_C( 81),
+      simde_mm256_set_epi32(INT32_C(-2128492842), INT32_C( 1872359340), INT32_C(  668421646), INT32_C(  578324193), INT32_C(  382246686), INT32_C( -951055561), INT32_C(  314307451), INT32_C(  965468660)),
+      simde_mm256_set_epi8(INT8_C( -69), INT8_C( -95), INT8_C(-109), INT8_C( -12), INT8_C( -40), INT8_C(  12), INT8_C(  -3), INT8_C(  24),
+                           INT8_C(  59), INT8_C(  73), INT8_C( 126), INT8_C( -36), INT8_C( 101), INT8_C( -84), INT8_C( -93), INT8_C( -97),
+                           INT8_C(  25), INT8_C( -38), INT8_C( -81), INT8_C( -50), INT8_C(-106), INT8_C( 109), INT8_C(-107), INT8_C( -76),
+                           INT8_C(  31), INT8_C( -91), INT8_C( 100), INT8_C(-106), INT8_C( -15), INT8_C(  49), INT8_C( 108), INT8_C( 108)),
+      simde_mm256_set_epi8(INT8_C( -23), INT8_C( -35), INT8_C( -12), INT8_C( -97), INT8_C(  27), INT8_C(-108), INT8_C(  66), INT8_C( -80),
+                           INT8_C(  55), INT8_C(  42), INT8_C( 103), INT8_C( 121), INT8_C(  36), INT8_C(  74), INT8_C( -46), INT8_C(  20),
+                           INT8_C( -73), INT8_C( -30), INT8_C( 114), INT8_C(  18), INT8_C( -81), INT8_C(  14), INT8_C(  77), INT8_C(  14),
+                           INT8_C( -88), INT8_C( -63), INT8_C( 114), INT8_C(  19), INT8_C(  96), INT8_C( -54), INT8_C(  12), INT8_C( -41)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C( 1872378654), INT32_C(          0), INT32_C(  578336239), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(  965486018)) },
+    { UINT8_C( 54),
+      simde_mm256_set_epi32(INT32_C( 1070079890), INT32_C( -990118016), INT32_C( 1133865557), INT32_C( -319155483), INT32_C( 1260375072), INT32_C(  475267808), INT32_C( 1378300416), INT32_C(  458668757)),
+      simde_mm256_set_epi8(INT8_C(  99), INT8_C( -71), INT8_C(  11), INT8_C(-104), INT8_C(  45), INT8_C(-112), INT8_C(  85), INT8_C(  95),
+                           INT8_C( -81), INT8_C(  30), INT8_C(  63), INT8_C(  -1), INT8_C( -51), INT8_C( -66), INT8_C( -43), INT8_C( -12),
+                           INT8_C(  80), INT8_C( -56), INT8_C( -49), INT8_C(   3), INT8_C( 104), INT8_C( -87), INT8_C(  19), INT8_C(  82),
+                           INT8_C(  10), INT8_C(  23), INT8_C( -24), INT8_C(  28), INT8_C( -97), INT8_C(-112), INT8_C( 101), INT8_C( -39)),
+      simde_mm256_set_epi8(INT8_C( -14), INT8_C(   6), INT8_C( 109), INT8_C(  38), INT8_C(  16), INT8_C(  80), INT8_C(  32), INT8_C(  63),
+                           INT8_C(-113), INT8_C( -17), INT8_C(  62), INT8_C( 109), INT8_C( -80), INT8_C(  57), INT8_C( -88), INT8_C( -18),
+                           INT8_C(  84), INT8_C(   1), INT8_C(   2), INT8_C(  91), INT8_C(  89), INT8_C( 122), INT8_C(-124), INT8_C( 102),
+                           INT8_C(  56), INT8_C(  89), INT8_C( 112), INT8_C( -62), INT8_C( -99), INT8_C(-111), INT8_C( 106), INT8_C(  50)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1133876973), INT32_C( -319184189), INT32_C(          0), INT32_C(  475303690), INT32_C( 1378327271), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_maskz_dpbusd_epi32(test_vec[i].k, test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i src;
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( 1475898051), INT32_C( 1765171669), INT32_C(  944275640), INT32_C(   34791830), INT32_C( -481364044), INT32_C(  749565119), INT32_C( 1835250163), INT32_C(-1284347158)),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm256_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm256_set_epi32(INT32_C( -671520061), INT32_C( -382246443), INT32_C(-1203142472), INT32_C(-2112626282), INT32_C( 1666185140), INT32_C(-1397852993), INT32_C( -312167949), INT32_C(  863202026)) },
+    { simde_mm256_set_epi32(INT32_C( -477402431), INT32_C(-1460355936), INT32_C( 1114739289), INT32_C( 1950365841), INT32_C(  376122943), INT32_C( 2030178480), INT32_C( 2009260103), INT32_C( 1431208242)),
+      simde_mm256_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm256_set_epi32(INT32_C( 1670146753), INT32_C(  687193248), INT32_C(-1032678823), INT32_C( -197052271), INT32_C(-1771295169), INT32_C( -117239632), INT32_C( -138158009), INT32_C( -716209870)) },
+    { simde_mm256_set_epi32(INT32_C( -295311214), INT32_C( -605848204), INT32_C(-1010053486), INT32_C(-1188055585), INT32_C(-1393704091), INT32_C( 1345463383), INT32_C( -626224297), INT32_C( 1874443438)),
+      simde_mm256_set_epi16(INT16_C( 12705), INT16_C( 23825), INT16_C(-10443), INT16_C( -4885), INT16_C(-21448), INT16_C( -5445), INT16_C(-21869), INT16_C(-16809),
+                            INT16_C( 32618), INT16_C( -2942), INT16_C( 14637), INT16_C(   277), INT16_C( -1044), INT16_C(  2908), INT16_C( 13913), INT16_C(  7074)),
+      simde_mm256_set_epi16(INT16_C( 31319), INT16_C( 25624), INT16_C(  3109), INT16_C(-30259), INT16_C( 31845), INT16_C(-29898), INT16_C(-18608), INT16_C(-29417),
+                            INT16_C( 15167), INT16_C( 11147), INT16_C( 14033), INT16_C(-12916), INT16_C( 22828), INT16_C(  7352), INT16_C(-10910), INT16_C(-29418)),
+      simde_mm256_set_epi32(INT32_C(  713088481), INT32_C( -490500276), INT32_C(-1530270436), INT32_C( -286646880), INT32_C( -931781359), INT32_C( 1547286672), INT32_C( -628677113), INT32_C( 1514549676)) },
+    { simde_mm256_set_epi32(INT32_C( 1600777267), INT32_C( 1735034116), INT32_C( -682676866), INT32_C( -751536278), INT32_C( 1242662586), INT32_C( -308936344), INT32_C(  -55035493), INT32_C(-1182790221)),
+      simde_mm256_set_epi16(INT16_C( -2410), INT16_C( 25932), INT16_C( 11055), INT16_C( 20088), INT16_C( 27652), INT16_C( 30096), INT16_C(-25230), INT16_C(-17973),
+                            INT16_C(-18548), INT16_C( 23059), INT16_C( 28951), INT16_C( -6331), INT16_C(-27645), INT16_C( 16689), INT16_C( 30257), INT16_C( 14453)),
+      simde_mm256_set_epi16(INT16_C(-26324), INT16_C(  7582), INT16_C(  2075), INT16_C( -4763), INT16_C(-26989), INT16_C( -3926), INT16_C( 12266), INT16_C(-25063),
+                            INT16_C( 31522), INT16_C(  8115), INT16_C(   702), INT16_C(-14700), INT16_C( -1556), INT16_C(  6198), INT16_C( 26644), INT16_C( 29296)),
+      simde_mm256_set_epi32(INT32_C( 1860834531), INT32_C( 1662294097), INT32_C(-1547133590), INT32_C( -610550159), INT32_C(  845116315), INT32_C( -195547042), INT32_C(   91418549), INT32_C(   46792375)) },
+    { simde_mm256_set_epi32(INT32_C(  282009839), INT32_C(  557518705), INT32_C( 1282349600), INT32_C(-1686511857), INT32_C(  268952435), INT32_C(   81756810), INT32_C(  920597888), INT32_C( 1489722172)),
+      simde_mm256_set_epi16(INT16_C(-31019), INT16_C( 13470), INT16_C(  1334), INT16_C( 11231), INT16_C( -8477), INT16_C(-11494), INT16_C(  7592), INT16_C(-30260),
+                            INT16_C( 20440), INT16_C( 31332), INT16_C( -6508), INT16_C(  8970), INT16_C( 12840), INT16_C( 23133), INT16_C( 13829), INT16_C( 28049)),
+      simde_mm256_set_epi16(INT16_C(-25515), INT16_C( 13043), INT16_C(-30591), INT16_C( 25019), INT16_C( 27445), INT16_C( -6226), INT16_C(  6095), INT16_C(-24700),
+                            INT16_C(-27724), INT16_C(-22929), INT16_C(  5691), INT16_C( 28772), INT16_C(  6104), INT16_C(-25676), INT16_C( 24726), INT16_C(-10091)),
+      simde_mm256_set_epi32(INT32_C( 1249148834), INT32_C(  797698700), INT32_C( 1121259979), INT32_C( -892816617), INT32_C(-1016137553), INT32_C(  302804622), INT32_C(  405010340), INT32_C( 1548615567)) },
+    { simde_mm256_set_epi32(INT32_C( 1667533453), INT32_C(-1899766110), INT32_C(-2015758759), INT32_C( -228642883), INT32_C(-1395420019), INT32_C( -428447699), INT32_C( -276458945), INT32_C( 1888543531)),
+      simde_mm256_set_epi16(INT16_C( 17969), INT16_C(-12633), INT16_C(   443), INT16_C(-31664), INT16_C( 17133), INT16_C( -8177), INT16_C(  9392), INT16_C(  -275),
+                            INT16_C( 30508), INT16_C(-29233), INT16_C(-20695), INT16_C(  6872), INT16_C(-14018), INT16_C( 32547), INT16_C(-25026), INT16_C( 24600)),
+      simde_mm256_set_epi16(INT16_C( 15650), INT16_C(-18024), INT16_C( 25059), INT16_C(   476), INT16_C( 26589), INT16_C(  2420), INT16_C(-25738), INT16_C( 27652),
+                            INT16_C( -5484), INT16_C(-27317), INT16_C(  2396), INT16_C( 22838), INT16_C( 19859), INT16_C(  2126), INT16_C( -2494), INT16_C(   247)),
+      simde_mm256_set_epi32(INT32_C(-2118521801), INT32_C(-1903737037), INT32_C(-1579997762), INT32_C( -477978479), INT32_C( -764168030), INT32_C( -321090183), INT32_C( -485647485), INT32_C( 1957034575)) },
+    { simde_mm256_set_epi32(INT32_C(-1888444531), INT32_C(-1267519262), INT32_C(-1111828968), INT32_C(-1951653854), INT32_C(  185707058), INT32_C(  557193427), INT32_C(-1303545321), INT32_C( 1902684544)),
+      simde_mm256_set_epi16(INT16_C(-11205), INT16_C(-18329), INT16_C(-11752), INT16_C(-19306), INT16_C( 13915), INT16_C( -2206), INT16_C(-20108), INT16_C(-28618),
+                            INT16_C( 18862), INT16_C(-23729), INT16_C(-15012), INT16_C( -6215), INT16_C(-20740), INT16_C( 18891), INT16_C(-23269), INT16_C( -3055)),
+      simde_mm256_set_epi16(INT16_C( 10386), INT16_C( -2454), INT16_C( 32371), INT16_C(-21768), INT16_C(  4275), INT16_C(-11918), INT16_C( 22878), INT16_C(  3942),
+                            INT16_C(  6549), INT16_C(-22909), INT16_C(-25615), INT16_C( 14551), INT16_C( 30748), INT16_C(  8275), INT16_C( -2408), INT16_C( -6010)),
+      simde_mm256_set_epi32(INT32_C(-1959840295), INT32_C(-1227690246), INT32_C(-1026051235), INT32_C( 1770470462), INT32_C(  852841957), INT32_C(  851291342), INT32_C(-1784935816), INT32_C( 1977076846)) },
+    { simde_mm256_set_epi32(INT32_C( -133774509), INT32_C(-1521377350), INT32_C(-1500150670), INT32_C(  660369752), INT32_C( 1953916472), INT32_C( 1514405670), INT32_C( 2081071898), INT32_C( -164147194)),
+      simde_mm256_set_epi16(INT16_C( -8682), INT16_C(  3928), INT16_C( 10445), INT16_C(-29212), INT16_C( 22394), INT16_C( -8545), INT16_C( 11730), INT16_C(-24282),
+                            INT16_C( -2195), INT16_C(  8145), INT16_C(-32416), INT16_C(-20805), INT16_C(  8133), INT16_C( 12562), INT16_C(-15902), INT16_C(  1972)),
+      simde_mm256_set_epi16(INT16_C( 13264), INT16_C(-31205), INT16_C(-32414), INT16_C(-25797), INT16_C(-20238), INT16_C(-27620), INT16_C( -3632), INT16_C( 22920),
+                            INT16_C( 19150), INT16_C(-16120), INT16_C( 30785), INT16_C(-12248), INT16_C( 23303), INT16_C(-27029), INT16_C(-27572), INT16_C( 17198)),
+      simde_mm256_set_epi32(INT32_C( -371505797), INT32_C(-1106359616), INT32_C(-1717347542), INT32_C(   61222952), INT32_C( 1780584822), INT32_C(  771298750), INT32_C( 1931056899), INT32_C(  308217206)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_dpwssd_epi32(test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_mask_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m256i src;
+    simde__mmask8 k;
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { simde_mm256_set_epi32(INT32_C( 1234117317), INT32_C(  611998609), INT32_C(-2053233713), INT32_C( 1097381112), INT32_C( -325819974), INT32_C(-1452441657), INT32_C(  823274687), INT32_C( 1516724025)),
+      UINT8_C(177),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm256_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm256_set_epi32(INT32_C( -913300795), INT32_C(  611998609), INT32_C(   94315471), INT32_C(-1050037000), INT32_C( -325819974), INT32_C(-1452441657), INT32_C(  823274687), INT32_C( -630694087)) },
+    { simde_mm256_set_epi32(INT32_C(  108569787), INT32_C(-1262310654), INT32_C(-1948618207), INT32_C( 2103714439), INT32_C( 1599505350), INT32_C( -327534029), INT32_C( 1463516939), INT32_C( -942282272)),
+      UINT8_C(118),
+      simde_mm256_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm256_set_epi32(INT32_C(  108569787), INT32_C(  885238530), INT32_C(  198930977), INT32_C(  -43703673), INT32_C( 1599505350), INT32_C( 1820015155), INT32_C( -683901173), INT32_C( -942282272)) },
+    { simde_mm256_set_epi32(INT32_C(-1516004496), INT32_C(  -12162849), INT32_C( 1335573320), INT32_C( -865382718), INT32_C( 1607535824), INT32_C(  316321241), INT32_C(  216235958), INT32_C( 1458456018)),
+      UINT8_C( 51),
+      simde_mm256_set_epi16(INT16_C(  8771), INT16_C(-26295), INT16_C( 15050), INT16_C(-25280), INT16_C(  2456), INT16_C(-15865), INT16_C( 23618), INT16_C(  4515),
+                            INT16_C( 19281), INT16_C(-11863), INT16_C(  8812), INT16_C(-24541), INT16_C(-28201), INT16_C(-29198), INT16_C( 23574), INT16_C( -1584)),
+      simde_mm256_set_epi16(INT16_C( -2654), INT16_C( 23650), INT16_C(-19155), INT16_C(  9771), INT16_C(-26951), INT16_C( -1265), INT16_C( 11572), INT16_C( 14554),
+                            INT16_C(-12866), INT16_C( -1563), INT16_C( -1219), INT16_C(  6250), INT16_C(  8529), INT16_C(-31464), INT16_C( 29135), INT16_C(-13895)),
+      simde_mm256_set_epi32(INT32_C(-1516004496), INT32_C(  -12162849), INT32_C( 1289450889), INT32_C( -526363912), INT32_C( 1607535824), INT32_C(  316321241), INT32_C(  894395501), INT32_C(-2127673108)) },
+    { simde_mm256_set_epi32(INT32_C( 1036361525), INT32_C(-1064375258), INT32_C( 2096686316), INT32_C(   78081469), INT32_C( -560944493), INT32_C(-1547349923), INT32_C( -195848003), INT32_C( -456824497)),
+      UINT8_C( 18),
+      simde_mm256_set_epi16(INT16_C( 32499), INT16_C( -4725), INT16_C( 27741), INT16_C(-17247), INT16_C( 23117), INT16_C( 20915), INT16_C(   805), INT16_C(-13707),
+                            INT16_C( 19367), INT16_C( 26605), INT16_C( 25268), INT16_C(  5598), INT16_C( 12364), INT16_C(-30054), INT16_C(  1948), INT16_C( -4860)),
+      simde_mm256_set_epi16(INT16_C(   -80), INT16_C( 23480), INT16_C(-29527), INT16_C( -2167), INT16_C( 20428), INT16_C( 17260), INT16_C( -7957), INT16_C(   652),
+                            INT16_C(-31722), INT16_C(-11364), INT16_C(-29549), INT16_C(-23419), INT16_C( 23419), INT16_C( 29379), INT16_C( 25228), INT16_C(  5800)),
+      simde_mm256_set_epi32(INT32_C( 1036361525), INT32_C(-1064375258), INT32_C( 2096686316), INT32_C(   62739120), INT32_C( -560944493), INT32_C(-1547349923), INT32_C( -789251953), INT32_C( -456824497)) },
+    { simde_mm256_set_epi32(INT32_C( 1607091506), INT32_C(-1581610443), INT32_C( 1581442384), INT32_C( -772933861), INT32_C(-1122586012), INT32_C( -420123200), INT32_C( 1975177029), INT32_C(  412894796)),
+      UINT8_C(  8),
+      simde_mm256_set_epi16(INT16_C(-23512), INT16_C(-24636), INT16_C( 31614), INT16_C( -2732), INT16_C( -8528), INT16_C(  8073), INT16_C(  3301), INT16_C(-19920),
+                            INT16_C(-27330), INT16_C(-20384), INT16_C( -8792), INT16_C( -2726), INT16_C(  8968), INT16_C( 22201), INT16_C(-20211), INT16_C(-20229)),
+      simde_mm256_set_epi16(INT16_C(-12791), INT16_C( 18333), INT16_C( 16368), INT16_C(  9082), INT16_C(-14781), INT16_C(  4419), INT16_C(-28542), INT16_C( 29145),
+                            INT16_C(-14585), INT16_C( 31377), INT16_C( 14411), INT16_C( -8218), INT16_C( 26066), INT16_C( 19847), INT16_C( -5180), INT16_C(-27251)),
+      simde_mm256_set_epi32(INT32_C( 1607091506), INT32_C(-1581610443), INT32_C( 1581442384), INT32_C( -772933861), INT32_C(-1363566730), INT32_C( -420123200), INT32_C( 1975177029), INT32_C(  412894796)) },
+    { simde_mm256_set_epi32(INT32_C( -589311345), INT32_C(-1652728727), INT32_C( -167197376), INT32_C( -385320097), INT32_C( 1802717496), INT32_C( -577863395), INT32_C( -799886209), INT32_C( -977513292)),
+      UINT8_C( 54),
+      simde_mm256_set_epi16(INT16_C( 18502), INT16_C( 31461), INT16_C(-30646), INT16_C(   776), INT16_C( 10197), INT16_C(  4573), INT16_C( 22484), INT16_C(-20376),
+                            INT16_C(-30062), INT16_C(-25885), INT16_C(-14434), INT16_C(-31325), INT16_C( 15213), INT16_C(-19961), INT16_C( 24370), INT16_C(-28740)),
+      simde_mm256_set_epi16(INT16_C( 10811), INT16_C(-17122), INT16_C( 32634), INT16_C( 32080), INT16_C( 24921), INT16_C( 13762), INT16_C(  3072), INT16_C( 28365),
+                            INT16_C( 32313), INT16_C(-28502), INT16_C(  -489), INT16_C(  -907), INT16_C( -2707), INT16_C(-29711), INT16_C(-29018), INT16_C(  5657)),
+      simde_mm256_set_epi32(INT32_C( -589311345), INT32_C(-1652728727), INT32_C(  149855687), INT32_C( -894214489), INT32_C( 1802717496), INT32_C( -542393394), INT32_C( -248006529), INT32_C( -977513292)) },
+    { simde_mm256_set_epi32(INT32_C( 1047952366), INT32_C( -242034930), INT32_C( -999058315), INT32_C( 1473816195), INT32_C(-1517216773), INT32_C(  910836549), INT32_C(  550734003), INT32_C( -916831028)),
+      UINT8_C( 41),
+      simde_mm256_set_epi16(INT16_C( 31203), INT16_C( 18353), INT16_C(  8437), INT16_C(-12478), INT16_C( 17562), INT16_C( 24086), INT16_C(-23932), INT16_C(-31605),
+                            INT16_C(  7346), INT16_C( 22303), INT16_C( -5180), INT16_C( 29922), INT16_C( 10916), INT16_C(-29959), INT16_C( 30070), INT16_C(-16032)),
+      simde_mm256_set_epi16(INT16_C( 16377), INT16_C(-21847), INT16_C(-26162), INT16_C(-13593), INT16_C( 30257), INT16_C( 24935), INT16_C( 18145), INT16_C( -8026),
+                            INT16_C( -7478), INT16_C( 20128), INT16_C( -7734), INT16_C(-22410), INT16_C(  3173), INT16_C(-20478), INT16_C(-18166), INT16_C( 32266)),
+      simde_mm256_set_epi32(INT32_C( 1047952366), INT32_C( -242034930), INT32_C(  132899529), INT32_C( 1473816195), INT32_C(-1123235377), INT32_C(  910836549), INT32_C(  550734003), INT32_C(-1980371160)) },
+    { simde_mm256_set_epi32(INT32_C( 1735669406), INT32_C( 1815485195), INT32_C(  824875312), INT32_C(  382533620), INT32_C(-1254056281), INT32_C( -389290440), INT32_C(  948507363), INT32_C( 2118676633)),
+      UINT8_C( 98),
+      simde_mm256_set_epi16(INT16_C(-28285), INT16_C(-26840), INT16_C( 18606), INT16_C(-23509), INT16_C( 17039), INT16_C(  -473), INT16_C( -2054), INT16_C( 13069),
+                            INT16_C( -4704), INT16_C(-22392), INT16_C(-20336), INT16_C(-24114), INT16_C( 19129), INT16_C(-10542), INT16_C( -1408), INT16_C( 25352)),
+      simde_mm256_set_epi16(INT16_C( 20953), INT16_C( -3963), INT16_C( 18771), INT16_C( -5645), INT16_C(  -279), INT16_C( 10964), INT16_C( 17404), INT16_C( 30366),
+                            INT16_C( -7665), INT16_C(-27783), INT16_C( 10767), INT16_C(-21623), INT16_C( 18067), INT16_C(-19512), INT16_C( 32659), INT16_C(-19232)),
+      simde_mm256_set_epi32(INT32_C( 1735669406), INT32_C(-1997520570), INT32_C(  814935459), INT32_C(  382533620), INT32_C(-1254056281), INT32_C( -389290440), INT32_C( 1499806510), INT32_C( 2118676633)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_mask_dpwssd_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm256_maskz_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m256i src;
+    simde__m256i a;
+    simde__m256i b;
+    simde__m256i r;
+  } test_vec[8] = {
+    { UINT8_C(196),
+      simde_mm256_set_epi32(INT32_C( -340175734), INT32_C(-1145627516), INT32_C( -636184918), INT32_C(  667953494), INT32_C( 1496047346), INT32_C( 1282801815), INT32_C( 1705356631), INT32_C(-1124009754)),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm256_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm256_set_epi32(INT32_C( 1807373450), INT32_C( 1001921668), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C( -864616297), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(109),
+      simde_mm256_set_epi32(INT32_C(-1281608702), INT32_C(   21055979), INT32_C(-1719645404), INT32_C(-1647730581), INT32_C(-1461805825), INT32_C( 2015029887), INT32_C( 1367579565), INT32_C(-1773169895)),
+      simde_mm256_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm256_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(-2126362133), INT32_C(  427903780), INT32_C(          0), INT32_C(  685743359), INT32_C( -132388225), INT32_C(          0), INT32_C(  374379289)) },
+    { UINT8_C( 24),
+      simde_mm256_set_epi32(INT32_C( -296071777), INT32_C(-1592341858), INT32_C( 1401927748), INT32_C(-1630763055), INT32_C( 1930996550), INT32_C(-1990322885), INT32_C( 2035714461), INT32_C( 1982540073)),
+      simde_mm256_set_epi16(INT16_C( 14626), INT16_C( 31850), INT16_C(-31965), INT16_C(  8636), INT16_C(-11280), INT16_C(-26806), INT16_C(-16316), INT16_C(  9397),
+                            INT16_C(-20357), INT16_C( 16560), INT16_C( -1847), INT16_C(  4752), INT16_C(-18337), INT16_C( -3221), INT16_C( 27048), INT16_C( 17432)),
+      simde_mm256_set_epi16(INT16_C( -5270), INT16_C(-30241), INT16_C( 29121), INT16_C(-27028), INT16_C(-31048), INT16_C( 22665), INT16_C(-12994), INT16_C( 24878),
+                            INT16_C( 16249), INT16_C(-21892), INT16_C(   809), INT16_C( -3699), INT16_C(-28741), INT16_C( 10499), INT16_C(-21240), INT16_C( 17290)),
+      simde_mm256_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(-1184974385), INT32_C( 1237684137), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(237),
+      simde_mm256_set_epi32(INT32_C(  778856833), INT32_C( 1463468581), INT32_C( -877931732), INT32_C(  123393164), INT32_C(-1317330616), INT32_C( 1437612729), INT32_C(-1847652637), INT32_C( 1192967360)),
+      simde_mm256_set_epi16(INT16_C( 19477), INT16_C( 27944), INT16_C(-22620), INT16_C( -9953), INT16_C( 23196), INT16_C( -9850), INT16_C( 15675), INT16_C( 20607),
+                            INT16_C(-13198), INT16_C(-25024), INT16_C( 19220), INT16_C(-25847), INT16_C( 23282), INT16_C( -3942), INT16_C(-17202), INT16_C( 14842)),
+      simde_mm256_set_epi16(INT16_C( 31713), INT16_C(-21180), INT16_C(-11674), INT16_C(-21895), INT16_C( 29698), INT16_C( 31346), INT16_C(  4989), INT16_C( 29840),
+                            INT16_C(-22690), INT16_C( 28923), INT16_C( -7851), INT16_C(-12853), INT16_C(-16333), INT16_C( 26208), INT16_C( -4260), INT16_C(  6719)),
+      simde_mm256_set_epi32(INT32_C(  804677014), INT32_C( 1945455396), INT32_C( -497815024), INT32_C(          0), INT32_C(-1741637148), INT32_C( 1618928000), INT32_C(          0), INT32_C( 1365971278)) },
+    { UINT8_C(149),
+      simde_mm256_set_epi32(INT32_C( -406412826), INT32_C( 2089328694), INT32_C(  656114025), INT32_C(-1587497128), INT32_C(  461375995), INT32_C( 1335660423), INT32_C(  293265049), INT32_C(  763979990)),
+      simde_mm256_set_epi16(INT16_C(-10190), INT16_C(-27552), INT16_C(-28924), INT16_C( 11851), INT16_C(-29399), INT16_C(-26775), INT16_C( 27342), INT16_C(-15928),
+                            INT16_C(  6720), INT16_C( -6547), INT16_C(-14273), INT16_C(-22311), INT16_C(-30159), INT16_C( -8196), INT16_C(-20273), INT16_C(  7975)),
+      simde_mm256_set_epi16(INT16_C( 17887), INT16_C(-15789), INT16_C(-20535), INT16_C(  9844), INT16_C(  4354), INT16_C( -7391), INT16_C( 21789), INT16_C(-24693),
+                            INT16_C( 23529), INT16_C(  9153), INT16_C(-18705), INT16_C(  8719), INT16_C( 15039), INT16_C( 26093), INT16_C( 12876), INT16_C( 20051)),
+      simde_mm256_set_epi32(INT32_C( -153662828), INT32_C(          0), INT32_C(          0), INT32_C( -598432186), INT32_C(          0), INT32_C( 1408107279), INT32_C(          0), INT32_C(  662851567)) },
+    { UINT8_C(172),
+      simde_mm256_set_epi32(INT32_C( -953670149), INT32_C(-1889344837), INT32_C( 1459067269), INT32_C(  826346412), INT32_C(-1298499621), INT32_C(   35168622), INT32_C(-2041657751), INT32_C(-1094393302)),
+      simde_mm256_set_epi16(INT16_C( -9120), INT16_C(-20061), INT16_C(  8286), INT16_C( 16784), INT16_C(  8400), INT16_C(-27824), INT16_C(-30628), INT16_C( -6080),
+                            INT16_C( 20713), INT16_C(-22272), INT16_C(-15276), INT16_C( 16513), INT16_C( 29955), INT16_C(  5352), INT16_C( 23513), INT16_C(-15803)),
+      simde_mm256_set_epi16(INT16_C( -5910), INT16_C(  7935), INT16_C(  3832), INT16_C( 13345), INT16_C( 21424), INT16_C( -6505), INT16_C(-30307), INT16_C( 15318),
+                            INT16_C( 26056), INT16_C(  6897), INT16_C( 25421), INT16_C( 26392), INT16_C( 27780), INT16_C( 17561), INT16_C( 21114), INT16_C(-26584)),
+      simde_mm256_set_epi32(INT32_C(-1058954984), INT32_C(          0), INT32_C( 1820023989), INT32_C(          0), INT32_C( -912411677), INT32_C(   82648522), INT32_C(          0), INT32_C(          0)) },
+    { UINT8_C(165),
+      simde_mm256_set_epi32(INT32_C(  460857243), INT32_C( 1238376483), INT32_C(  312509845), INT32_C( 1805483035), INT32_C( -187360531), INT32_C( 1246528158), INT32_C(  918445133), INT32_C(-1129176675)),
+      simde_mm256_set_epi16(INT16_C(-10680), INT16_C(-14322), INT16_C( 13614), INT16_C(  1086), INT16_C(-21496), INT16_C( -3195), INT16_C(-29345), INT16_C( 26226),
+                            INT16_C(-14876), INT16_C( 17542), INT16_C( -5583), INT16_C( 20562), INT16_C(  8298), INT16_C( 12496), INT16_C(  2302), INT16_C( -4594)),
+      simde_mm256_set_epi16(INT16_C( 23724), INT16_C(-27493), INT16_C( -7985), INT16_C( 21474), INT16_C(-10795), INT16_C( -6775), INT16_C(-19179), INT16_C(  8673),
+                            INT16_C(-10904), INT16_C(-29739), INT16_C( 15697), INT16_C(-21320), INT16_C( 13979), INT16_C(  9173), INT16_C(  6674), INT16_C(-31438)),
+      simde_mm256_set_epi32(INT32_C(  601239669), INT32_C(          0), INT32_C(  566205290), INT32_C(          0), INT32_C(          0), INT32_C(  720509967), INT32_C(          0), INT32_C( -969386955)) },
+    { UINT8_C(154),
+      simde_mm256_set_epi32(INT32_C(-1612344502), INT32_C(  715042650), INT32_C( 1395773893), INT32_C(-1068929599), INT32_C( 1920427758), INT32_C(-1361117250), INT32_C(  875456496), INT32_C(  344731742)),
+      simde_mm256_set_epi16(INT16_C(-28440), INT16_C(  9589), INT16_C( 15963), INT16_C( -6013), INT16_C( -9523), INT16_C( -5189), INT16_C( 11075), INT16_C(  5227),
+                            INT16_C(-10266), INT16_C(-24460), INT16_C( -6943), INT16_C(-18810), INT16_C(-29367), INT16_C( -7009), INT16_C(  6654), INT16_C(-29666)),
+      simde_mm256_set_epi16(INT16_C( 26736), INT16_C(-12224), INT16_C(-31698), INT16_C(-31497), INT16_C(-24909), INT16_C(  1510), INT16_C(-29570), INT16_C(-26617),
+                            INT16_C( -5116), INT16_C( 17286), INT16_C(-17078), INT16_C( -2072), INT16_C( -3354), INT16_C(-25039), INT16_C(-12693), INT16_C( 11570)),
+      simde_mm256_set_epi32(INT32_C( 1805035018), INT32_C(          0), INT32_C(          0), INT32_C(-1535544408), INT32_C( 1550133054), INT32_C(          0), INT32_C( 1149451765), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m256i r = simde_mm256_maskz_dpwssd_epi32(test_vec[i].k, test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m256i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(-1492223742), INT32_C( 1464439004), INT32_C( 1108242154), INT32_C( -478876725),
+                            INT32_C( 1836125636), INT32_C( -836787133), INT32_C( -407609450), INT32_C(-1814663268),
+                            INT32_C( -610434219), INT32_C( 1517884218), INT32_C( 1510193875), INT32_C(-1872064732),
+                            INT32_C(  -13155905), INT32_C(  858815314), INT32_C( -189992179), INT32_C(  433428643)),
+      simde_mm512_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm512_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm512_set_epi32(INT32_C(-1492094202), INT32_C( 1464568544), INT32_C( 1108371694), INT32_C( -478747185),
+                            INT32_C( 1836255176), INT32_C( -836657593), INT32_C( -407479910), INT32_C(-1814533728),
+                            INT32_C( -610304679), INT32_C( 1518013758), INT32_C( 1510323415), INT32_C(-1871935192),
+                            INT32_C(  -13026365), INT32_C(  858944854), INT32_C( -189862639), INT32_C(  433558183)) },
+    { simde_mm512_set_epi32(INT32_C(-1487844424), INT32_C( -375400729), INT32_C(  785416111), INT32_C(-1121485158),
+                            INT32_C(   86944356), INT32_C(-1932423743), INT32_C(-1594006932), INT32_C(  992869302),
+                            INT32_C( 1179688651), INT32_C(-1078967041), INT32_C(-1510985139), INT32_C(-1732235868),
+                            INT32_C( -620187915), INT32_C(-1126888654), INT32_C(   38891891), INT32_C(-1485199492)),
+      simde_mm512_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm512_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm512_set_epi32(INT32_C(-1487974984), INT32_C( -375531289), INT32_C(  785285551), INT32_C(-1121615718),
+                            INT32_C(   86813796), INT32_C(-1932554303), INT32_C(-1594137492), INT32_C(  992738742),
+                            INT32_C( 1179558091), INT32_C(-1079097601), INT32_C(-1511115699), INT32_C(-1732366428),
+                            INT32_C( -620318475), INT32_C(-1127019214), INT32_C(   38761331), INT32_C(-1485330052)) },
+    { simde_mm512_set_epi32(INT32_C(-1839977338), INT32_C(-2030841302), INT32_C( 1943639275), INT32_C(-1491812713),
+                            INT32_C(-1935281882), INT32_C(-1611687833), INT32_C( 1073177074), INT32_C( -412370095),
+                            INT32_C( 1548169279), INT32_C(-1630659094), INT32_C(   70084984), INT32_C(-1133006859),
+                            INT32_C(  822823054), INT32_C(-1612926320), INT32_C(  615742985), INT32_C( 1047159703)),
+      simde_mm512_set_epi8(INT8_C(  10), INT8_C(  48), INT8_C(  59), INT8_C( -66), INT8_C( -34), INT8_C( -65), INT8_C(  17), INT8_C(-118),
+                           INT8_C( 101), INT8_C( -25), INT8_C( 120), INT8_C(-102), INT8_C(-127), INT8_C(  24), INT8_C( 125), INT8_C( 112),
+                           INT8_C(  88), INT8_C( -79), INT8_C(  27), INT8_C( -88), INT8_C( -26), INT8_C(  98), INT8_C( -89), INT8_C(  -1),
+                           INT8_C(-126), INT8_C(-126), INT8_C(  84), INT8_C(   0), INT8_C( -64), INT8_C(  75), INT8_C( -43), INT8_C(  21),
+                           INT8_C( -52), INT8_C(-102), INT8_C( 116), INT8_C( -41), INT8_C( -88), INT8_C( -70), INT8_C(  24), INT8_C( 101),
+                           INT8_C(  -7), INT8_C( -75), INT8_C( -18), INT8_C(  66), INT8_C(-120), INT8_C(  92), INT8_C(  17), INT8_C( -58),
+                           INT8_C(-126), INT8_C(-128), INT8_C(  79), INT8_C(  49), INT8_C( -47), INT8_C( -53), INT8_C(  91), INT8_C( 112),
+                           INT8_C(  -4), INT8_C( -85), INT8_C( -17), INT8_C(  63), INT8_C( -77), INT8_C(  83), INT8_C(  -1), INT8_C(  14)),
+      simde_mm512_set_epi8(INT8_C( -19), INT8_C(  75), INT8_C( -21), INT8_C(-116), INT8_C( -73), INT8_C( -99), INT8_C(  33), INT8_C( -37),
+                           INT8_C( 125), INT8_C(-124), INT8_C( -75), INT8_C( 103), INT8_C(  48), INT8_C( -39), INT8_C( -25), INT8_C(  85),
+                           INT8_C( -55), INT8_C( 113), INT8_C(  49), INT8_C(  86), INT8_C( 121), INT8_C(  83), INT8_C(  -7), INT8_C( 103),
+                           INT8_C( -32), INT8_C(  11), INT8_C(  37), INT8_C(  66), INT8_C(  47), INT8_C( 119), INT8_C( -22), INT8_C( 115),
+                           INT8_C( -93), INT8_C( -25), INT8_C(  61), INT8_C(  59), INT8_C( 127), INT8_C(  -8), INT8_C( 100), INT8_C( 123),
+                           INT8_C( -28), INT8_C(  87), INT8_C(  15), INT8_C( -96), INT8_C( -43), INT8_C( 107), INT8_C( -55), INT8_C( -24),
+                           INT8_C( -92), INT8_C(-102), INT8_C(  37), INT8_C(  30), INT8_C( -95), INT8_C(  92), INT8_C( 109), INT8_C( -13),
+                           INT8_C( -46), INT8_C(  14), INT8_C( -78), INT8_C(  71), INT8_C( 116), INT8_C( -91), INT8_C(  77), INT8_C(  41)),
+      simde_mm512_set_epi32(INT32_C(-1839997207), INT32_C(-2030880962), INT32_C( 1943630118), INT32_C(-1491801062),
+                            INT32_C(-1935250950), INT32_C(-1611626773), INT32_C( 1073177452), INT32_C( -412354417),
+                            INT32_C( 1548166218), INT32_C(-1630624423), INT32_C(   70090993), INT32_C(-1133008550),
+                            INT32_C(  822802431), INT32_C(-1612919036), INT32_C(  615719618), INT32_C( 1047193123)) },
+    { simde_mm512_set_epi32(INT32_C( 1062859526), INT32_C(-1275977005), INT32_C(-1673731641), INT32_C(-1305330581),
+                            INT32_C( -386604560), INT32_C(   31628561), INT32_C( -725054807), INT32_C( 1007847489),
+                            INT32_C( 1305606010), INT32_C( -847620305), INT32_C( 1610776388), INT32_C( -570798160),
+                            INT32_C( -448560041), INT32_C( 1739798850), INT32_C(-2112761209), INT32_C( -147780264)),
+      simde_mm512_set_epi8(INT8_C( -98), INT8_C(  44), INT8_C( 108), INT8_C( -87), INT8_C(  -5), INT8_C(   5), INT8_C(  79), INT8_C(  -3),
+                           INT8_C( 113), INT8_C(  37), INT8_C(  32), INT8_C( 110), INT8_C( -90), INT8_C(-123), INT8_C( -14), INT8_C(  89),
+                           INT8_C( 100), INT8_C(  10), INT8_C( -22), INT8_C(  -1), INT8_C(  39), INT8_C(  18), INT8_C(  -2), INT8_C( -92),
+                           INT8_C(  15), INT8_C(  22), INT8_C( -79), INT8_C( -35), INT8_C( -84), INT8_C(  -1), INT8_C(-112), INT8_C( -59),
+                           INT8_C(  12), INT8_C( -94), INT8_C( -85), INT8_C(  84), INT8_C(-128), INT8_C( -92), INT8_C( 110), INT8_C(  89),
+                           INT8_C( 109), INT8_C(  58), INT8_C(  57), INT8_C( -31), INT8_C(  53), INT8_C(  63), INT8_C(  36), INT8_C(  81),
+                           INT8_C(  88), INT8_C(  29), INT8_C(-118), INT8_C(  31), INT8_C( -95), INT8_C( -60), INT8_C(-111), INT8_C( -14),
+                           INT8_C( -81), INT8_C(  95), INT8_C(  91), INT8_C( -68), INT8_C(  34), INT8_C( -21), INT8_C(  18), INT8_C(  86)),
+      simde_mm512_set_epi8(INT8_C(  94), INT8_C(  78), INT8_C(  85), INT8_C(  84), INT8_C(  22), INT8_C(  68), INT8_C(-123), INT8_C(  64),
+                           INT8_C(  28), INT8_C( 100), INT8_C( -44), INT8_C( -22), INT8_C(  88), INT8_C(  68), INT8_C(   9), INT8_C(-109),
+                           INT8_C(-124), INT8_C(  96), INT8_C( -21), INT8_C(  85), INT8_C( -18), INT8_C( -75), INT8_C(  26), INT8_C( 103),
+                           INT8_C( -43), INT8_C( -25), INT8_C( 117), INT8_C( -76), INT8_C(  79), INT8_C( 121), INT8_C(  30), INT8_C( -38),
+                           INT8_C(-114), INT8_C(  75), INT8_C( -48), INT8_C( -57), INT8_C(  52), INT8_C(  46), INT8_C(  24), INT8_C( 106),
+                           INT8_C( -67), INT8_C( -60), INT8_C(  12), INT8_C(-117), INT8_C(  -6), INT8_C(  -6), INT8_C( -70), INT8_C( -33),
+                           INT8_C( -67), INT8_C( 105), INT8_C(  44), INT8_C( -50), INT8_C(  -7), INT8_C(  93), INT8_C( -28), INT8_C(-106),
+                           INT8_C(  81), INT8_C(  67), INT8_C( -95), INT8_C( -48), INT8_C( -12), INT8_C(  27), INT8_C(  26), INT8_C(  34)),
+      simde_mm512_set_epi32(INT32_C( 1062901186), INT32_C(-1275964668), INT32_C(-1673728605), INT32_C(-1305314452),
+                            INT32_C( -386599239), INT32_C(   31650005), INT32_C( -725052089), INT32_C( 1007888766),
+                            INT32_C( 1305603796), INT32_C( -847594031), INT32_C( 1610739964), INT32_C( -570804049),
+                            INT32_C( -448558370), INT32_C( 1739786239), INT32_C(-2112758338), INT32_C( -147770935)) },
+    { simde_mm512_set_epi32(INT32_C( 1594215126), INT32_C(  749581667), INT32_C( -486964516), INT32_C(  113922496),
+                            INT32_C(  318440374), INT32_C(-2100311145), INT32_C(  485159927), INT32_C(-1676472201),
+                            INT32_C( 1277830739), INT32_C( 1717525964), INT32_C( 1319751349), INT32_C( 1836333882),
+                            INT32_C(  929320662), INT32_C( 1531044978), INT32_C(-1448451599), INT32_C(  125131850)),
+      simde_mm512_set_epi8(INT8_C(  43), INT8_C( -33), INT8_C( 106), INT8_C(-120), INT8_C(  81), INT8_C(  34), INT8_C(   9), INT8_C(  93),
+                           INT8_C(  35), INT8_C(-114), INT8_C(-106), INT8_C(  31), INT8_C(  10), INT8_C(  79), INT8_C(  32), INT8_C(  93),
+                           INT8_C( -19), INT8_C( -82), INT8_C(  76), INT8_C(  16), INT8_C( -70), INT8_C(-101), INT8_C( -65), INT8_C( -94),
+                           INT8_C( -89), INT8_C( -82), INT8_C(  44), INT8_C( -36), INT8_C(   1), INT8_C(  81), INT8_C(  70), INT8_C( -17),
+                           INT8_C( -10), INT8_C(  25), INT8_C( -35), INT8_C(  76), INT8_C(  65), INT8_C(  32), INT8_C( -24), INT8_C( -66),
+                           INT8_C(  11), INT8_C(-120), INT8_C(  51), INT8_C(   8), INT8_C( -27), INT8_C(  17), INT8_C(   6), INT8_C(  50),
+                           INT8_C(  50), INT8_C(  23), INT8_C( -34), INT8_C(  76), INT8_C(  24), INT8_C( -94), INT8_C(  11), INT8_C(  36),
+                           INT8_C(-123), INT8_C(  41), INT8_C(-117), INT8_C(  54), INT8_C( -80), INT8_C( -89), INT8_C( -42), INT8_C( -55)),
+      simde_mm512_set_epi8(INT8_C( 113), INT8_C(  -4), INT8_C( 123), INT8_C(  97), INT8_C(   5), INT8_C(  -6), INT8_C( -14), INT8_C(-108),
+                           INT8_C( -53), INT8_C(  14), INT8_C( 123), INT8_C(-103), INT8_C( -34), INT8_C( -19), INT8_C( -73), INT8_C( 122),
+                           INT8_C(   2), INT8_C(-105), INT8_C(  -7), INT8_C( -67), INT8_C(  21), INT8_C(  12), INT8_C( -32), INT8_C(  58),
+                           INT8_C(-109), INT8_C( -63), INT8_C( -76), INT8_C(  43), INT8_C( 118), INT8_C(-110), INT8_C(-115), INT8_C(  32),
+                           INT8_C(  95), INT8_C(  32), INT8_C( -69), INT8_C( 106), INT8_C( 104), INT8_C(  70), INT8_C(  14), INT8_C(  60),
+                           INT8_C( -31), INT8_C( -72), INT8_C( -54), INT8_C(  43), INT8_C(  19), INT8_C( 111), INT8_C(  85), INT8_C(  22),
+                           INT8_C(  45), INT8_C(-123), INT8_C( -30), INT8_C(  46), INT8_C( -41), INT8_C(-106), INT8_C( -74), INT8_C( -69),
+                           INT8_C(  63), INT8_C( -39), INT8_C( -20), INT8_C(  62), INT8_C(  60), INT8_C(  55), INT8_C( -70), INT8_C(  15)),
+      simde_mm512_set_epi32(INT32_C( 1594245323), INT32_C(  749571698), INT32_C( -486949126), INT32_C(  113929665),
+                            INT32_C(  318420974), INT32_C(-2100302095), INT32_C(  485136878), INT32_C(-1676481395),
+                            INT32_C( 1277847716), INT32_C( 1717549612), INT32_C( 1319738806), INT32_C( 1836341730),
+                            INT32_C(  929316919), INT32_C( 1531023524), INT32_C(-1448444251), INT32_C(  125139630)) },
+    { simde_mm512_set_epi32(INT32_C(-1456867499), INT32_C( -334886577), INT32_C( 1903587049), INT32_C(-1854981954),
+                            INT32_C( 1915417809), INT32_C( -603655017), INT32_C(  -36334781), INT32_C(-1335312234),
+                            INT32_C( -461385706), INT32_C( -564486058), INT32_C( 1823120108), INT32_C( -930777603),
+                            INT32_C(  234800850), INT32_C(-1621728139), INT32_C(  163493207), INT32_C(-1543691663)),
+      simde_mm512_set_epi8(INT8_C(  96), INT8_C(-126), INT8_C(  84), INT8_C(  71), INT8_C(  50), INT8_C(-107), INT8_C(-114), INT8_C( -35),
+                           INT8_C( 107), INT8_C(-128), INT8_C(  -2), INT8_C( -46), INT8_C(  13), INT8_C( -89), INT8_C( 122), INT8_C( 105),
+                           INT8_C(-120), INT8_C( -89), INT8_C( -35), INT8_C(-121), INT8_C(  -1), INT8_C( -33), INT8_C( -11), INT8_C(  67),
+                           INT8_C( -65), INT8_C( -50), INT8_C( -50), INT8_C( 105), INT8_C( -11), INT8_C( -30), INT8_C(  94), INT8_C(  63),
+                           INT8_C( -81), INT8_C( 101), INT8_C(  80), INT8_C(  30), INT8_C(   3), INT8_C( 125), INT8_C(  77), INT8_C( -92),
+                           INT8_C( 123), INT8_C(  -8), INT8_C( -91), INT8_C(  83), INT8_C(   5), INT8_C(  99), INT8_C(  28), INT8_C( -35),
+                           INT8_C(  42), INT8_C(  95), INT8_C(  79), INT8_C(  23), INT8_C(  69), INT8_C( -55), INT8_C(  46), INT8_C(-128),
+                           INT8_C(  14), INT8_C( 110), INT8_C( -60), INT8_C( -78), INT8_C(  89), INT8_C(  67), INT8_C( -82), INT8_C( -99)),
+      simde_mm512_set_epi8(INT8_C(  92), INT8_C( -32), INT8_C(-123), INT8_C(  20), INT8_C(  64), INT8_C(  43), INT8_C( 102), INT8_C( -89),
+                           INT8_C(  98), INT8_C(-112), INT8_C(   8), INT8_C(  85), INT8_C(  22), INT8_C( -12), INT8_C( 101), INT8_C(  45),
+                           INT8_C( -95), INT8_C( 117), INT8_C(  15), INT8_C( -67), INT8_C( -34), INT8_C( -26), INT8_C(   3), INT8_C( -86),
+                           INT8_C(  -2), INT8_C(  97), INT8_C(  56), INT8_C( -85), INT8_C( 102), INT8_C( -46), INT8_C( -24), INT8_C( -69),
+                           INT8_C(  -9), INT8_C( -83), INT8_C(  53), INT8_C(  91), INT8_C( 112), INT8_C( 123), INT8_C( 127), INT8_C(   5),
+                           INT8_C(  15), INT8_C(  37), INT8_C(  85), INT8_C(-126), INT8_C( -79), INT8_C( -30), INT8_C(  19), INT8_C( -94),
+                           INT8_C(   0), INT8_C( -33), INT8_C(  -4), INT8_C( -56), INT8_C(  79), INT8_C( 100), INT8_C(-125), INT8_C( -27),
+                           INT8_C( 100), INT8_C( -67), INT8_C(  -9), INT8_C( -32), INT8_C( -51), INT8_C(  72), INT8_C( -78), INT8_C(-128)),
+      simde_mm512_set_epi32(INT32_C(-1456871739), INT32_C( -334882155), INT32_C( 1903603081), INT32_C(-1854966625),
+                            INT32_C( 1915418698), INT32_C( -603674512), INT32_C(  -36312570), INT32_C(-1335304243),
+                            INT32_C( -461388694), INT32_C( -564459748), INT32_C( 1823134696), INT32_C( -930801210),
+                            INT32_C(  234796111), INT32_C(-1621711794), INT32_C(  163479777), INT32_C(-1543725046)) },
+    { simde_mm512_set_epi32(INT32_C(  -45348853), INT32_C( 1499172737), INT32_C(-2039767579), INT32_C(-1203689197),
+                            INT32_C(-1047090154), INT32_C( 1878175501), INT32_C( 1160305770), INT32_C( -987542380),
+                            INT32_C(-1611097717), INT32_C( 1891652087), INT32_C(  952552086), INT32_C( -344571658),
+                            INT32_C(  192962667), INT32_C(  772847577), INT32_C( 1590465607), INT32_C(  -34440790)),
+      simde_mm512_set_epi8(INT8_C( -62), INT8_C(  86), INT8_C(-123), INT8_C( -43), INT8_C( -91), INT8_C( -19), INT8_C( 105), INT8_C( 123),
+                           INT8_C(   1), INT8_C(  56), INT8_C( -92), INT8_C(  29), INT8_C( -50), INT8_C(  40), INT8_C(  69), INT8_C( -16),
+                           INT8_C( -48), INT8_C(  68), INT8_C( 118), INT8_C( -37), INT8_C(  59), INT8_C( -87), INT8_C(  18), INT8_C(-107),
+                           INT8_C( -47), INT8_C(-116), INT8_C( -73), INT8_C( -32), INT8_C( -21), INT8_C(  71), INT8_C(  46), INT8_C( -56),
+                           INT8_C( -24), INT8_C(  76), INT8_C( 108), INT8_C( -80), INT8_C(  17), INT8_C(  28), INT8_C(   7), INT8_C(  70),
+                           INT8_C(-100), INT8_C(  54), INT8_C( -98), INT8_C(  41), INT8_C(  86), INT8_C(-123), INT8_C( -42), INT8_C( 106),
+                           INT8_C( -16), INT8_C(  53), INT8_C( -52), INT8_C(  46), INT8_C(  53), INT8_C(-113), INT8_C(-126), INT8_C( -81),
+                           INT8_C(-113), INT8_C( 121), INT8_C(  40), INT8_C(  19), INT8_C(-103), INT8_C(  70), INT8_C(  -8), INT8_C( -34)),
+      simde_mm512_set_epi8(INT8_C(  71), INT8_C(  85), INT8_C( -69), INT8_C(  38), INT8_C(  30), INT8_C(  34), INT8_C( 127), INT8_C(  35),
+                           INT8_C(   4), INT8_C( 117), INT8_C( -84), INT8_C( -16), INT8_C(   2), INT8_C(  60), INT8_C( 106), INT8_C(  55),
+                           INT8_C(  83), INT8_C( 106), INT8_C( -67), INT8_C(  -8), INT8_C( -73), INT8_C( -45), INT8_C(  33), INT8_C(  53),
+                           INT8_C(  14), INT8_C( -81), INT8_C(-119), INT8_C( 126), INT8_C(  -6), INT8_C( -62), INT8_C(  16), INT8_C(  85),
+                           INT8_C(  98), INT8_C( -72), INT8_C( -67), INT8_C(   5), INT8_C(-123), INT8_C(-127), INT8_C( -92), INT8_C(  93),
+                           INT8_C(  27), INT8_C( -79), INT8_C( -67), INT8_C( -92), INT8_C(-124), INT8_C(  96), INT8_C( -61), INT8_C(  27),
+                           INT8_C( -83), INT8_C(   6), INT8_C(  35), INT8_C( -69), INT8_C( -64), INT8_C(  45), INT8_C( -12), INT8_C(  51),
+                           INT8_C( -64), INT8_C( -36), INT8_C(  88), INT8_C( -83), INT8_C( -62), INT8_C(   1), INT8_C(-115), INT8_C( 105)),
+      simde_mm512_set_epi32(INT32_C(  -45328852), INT32_C( 1499203385), INT32_C(-2039775263), INT32_C(-1203665871),
+                            INT32_C(-1047075340), INT32_C( 1878172080), INT32_C( 1160303803), INT32_C( -987530456),
+                            INT32_C(-1611086809), INT32_C( 1891652306), INT32_C(  952537674), INT32_C( -344579746),
+                            INT32_C(  192947031), INT32_C(  772857985), INT32_C( 1590454042), INT32_C(  -34455416)) },
+    { simde_mm512_set_epi32(INT32_C( 1522123036), INT32_C(-1748581617), INT32_C(  159169815), INT32_C(  405888119),
+                            INT32_C( 1599960200), INT32_C(-2024854878), INT32_C(  820411340), INT32_C(-1536706994),
+                            INT32_C( 2134168444), INT32_C( 2146800807), INT32_C( 2097149646), INT32_C(  621634861),
+                            INT32_C(  -99175550), INT32_C(-1320662149), INT32_C( -973721384), INT32_C(-1285582051)),
+      simde_mm512_set_epi8(INT8_C(-112), INT8_C( 122), INT8_C(  23), INT8_C(-115), INT8_C( 116), INT8_C(   7), INT8_C(  62), INT8_C( -51),
+                           INT8_C( -78), INT8_C(-127), INT8_C(  85), INT8_C(  40), INT8_C( -56), INT8_C(  60), INT8_C(  -8), INT8_C( 125),
+                           INT8_C( -56), INT8_C(-119), INT8_C(-107), INT8_C( -74), INT8_C( 125), INT8_C(  59), INT8_C(  62), INT8_C(  65),
+                           INT8_C( -24), INT8_C(-120), INT8_C(  98), INT8_C(   3), INT8_C(  38), INT8_C(  85), INT8_C( -90), INT8_C(  77),
+                           INT8_C(  57), INT8_C( -99), INT8_C(  -7), INT8_C(   1), INT8_C( -88), INT8_C(  46), INT8_C(  81), INT8_C(  47),
+                           INT8_C(  71), INT8_C( -99), INT8_C(  32), INT8_C(  47), INT8_C( -29), INT8_C( -78), INT8_C( -43), INT8_C(-124),
+                           INT8_C(  93), INT8_C( -69), INT8_C( -58), INT8_C( -59), INT8_C(-117), INT8_C(-123), INT8_C(  75), INT8_C( -45),
+                           INT8_C( -84), INT8_C( -40), INT8_C( 105), INT8_C(  51), INT8_C(  93), INT8_C( -86), INT8_C( 109), INT8_C(  73)),
+      simde_mm512_set_epi8(INT8_C(   9), INT8_C( -41), INT8_C(  90), INT8_C( -68), INT8_C( -62), INT8_C(  65), INT8_C(  -4), INT8_C(  67),
+                           INT8_C(-116), INT8_C( 102), INT8_C( -37), INT8_C( -50), INT8_C(  86), INT8_C(  -6), INT8_C( 112), INT8_C(  99),
+                           INT8_C( 117), INT8_C( -52), INT8_C( -72), INT8_C(  20), INT8_C( -97), INT8_C( -81), INT8_C(  91), INT8_C( -44),
+                           INT8_C( -39), INT8_C(  11), INT8_C( -19), INT8_C( -45), INT8_C(  54), INT8_C(  -8), INT8_C(  52), INT8_C(  -3),
+                           INT8_C( -98), INT8_C(  87), INT8_C(   0), INT8_C( 119), INT8_C(   3), INT8_C(   3), INT8_C(-105), INT8_C(  19),
+                           INT8_C(  76), INT8_C( -69), INT8_C(  54), INT8_C(   4), INT8_C( -37), INT8_C(  17), INT8_C( -33), INT8_C( -84),
+                           INT8_C(  53), INT8_C(-108), INT8_C(  43), INT8_C(   1), INT8_C( -19), INT8_C( -33), INT8_C( -19), INT8_C( -73),
+                           INT8_C(-113), INT8_C( -47), INT8_C( -65), INT8_C(-115), INT8_C( -49), INT8_C(  25), INT8_C(  35), INT8_C( -16)),
+      simde_mm512_set_epi32(INT32_C( 1522111812), INT32_C(-1748574867), INT32_C(  159157180), INT32_C(  405945110),
+                            INT32_C( 1599969388), INT32_C(-2024869000), INT32_C(  820401791), INT32_C(-1536697221),
+                            INT32_C( 2134176636), INT32_C( 2146793837), INT32_C( 2097146125), INT32_C(  621611371),
+                            INT32_C(  -99182106), INT32_C(-1320686007), INT32_C( -973763662), INT32_C(-1285579711)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_dpbusd_epi32(test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C( -945332239), INT32_C(-1020004911), INT32_C( 1055337114), INT32_C( 1680049368),
+                            INT32_C( 1524905484), INT32_C( 1713689212), INT32_C(  -89244973), INT32_C(  243687041),
+                            INT32_C(  442687429), INT32_C(-1235176149), INT32_C(-1770907838), INT32_C(  577183382),
+                            INT32_C(  407298211), INT32_C( 1668757925), INT32_C( 1705503509), INT32_C(  180621179)),
+      UINT16_C( 7061),
+      simde_mm512_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm512_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm512_set_epi32(INT32_C( -945332239), INT32_C(-1020004911), INT32_C( 1055337114), INT32_C( 1680178908),
+                            INT32_C( 1525035024), INT32_C( 1713689212), INT32_C(  -89115433), INT32_C(  243816581),
+                            INT32_C(  442816969), INT32_C(-1235176149), INT32_C(-1770907838), INT32_C(  577312922),
+                            INT32_C(  407298211), INT32_C( 1668887465), INT32_C( 1705503509), INT32_C(  180750719)) },
+    { simde_mm512_set_epi32(INT32_C( 1388538207), INT32_C(-1579518298), INT32_C(  638364286), INT32_C( -419120239),
+                            INT32_C(-1603497192), INT32_C(  806132583), INT32_C(-1426475841), INT32_C(-1254880002),
+                            INT32_C( -605201063), INT32_C( -441676698), INT32_C( -200077534), INT32_C(  826724281),
+                            INT32_C( -569089629), INT32_C(-1770580653), INT32_C( -842461172), INT32_C( -923100958)),
+      UINT16_C(27494),
+      simde_mm512_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm512_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm512_set_epi32(INT32_C( 1388538207), INT32_C(-1579648858), INT32_C(  638233726), INT32_C( -419120239),
+                            INT32_C(-1603627752), INT32_C(  806132583), INT32_C(-1426606401), INT32_C(-1255010562),
+                            INT32_C( -605201063), INT32_C( -441807258), INT32_C( -200208094), INT32_C(  826724281),
+                            INT32_C( -569089629), INT32_C(-1770711213), INT32_C( -842591732), INT32_C( -923100958)) },
+    { simde_mm512_set_epi32(INT32_C(  657740920), INT32_C( -713928582), INT32_C(-1405113714), INT32_C( 1240126046),
+                            INT32_C(-1170753872), INT32_C(  799687069), INT32_C( -327398136), INT32_C(-1047476842),
+                            INT32_C( -769887785), INT32_C(  610715908), INT32_C(  842456931), INT32_C(-1177690818),
+                            INT32_C(  370452768), INT32_C(-2104285328), INT32_C(-2062580766), INT32_C(-1404723152)),
+      UINT16_C(18345),
+      simde_mm512_set_epi8(INT8_C(  39), INT8_C(-121), INT8_C( -21), INT8_C(  10), INT8_C( -32), INT8_C(  24), INT8_C(  17), INT8_C( -41),
+                           INT8_C( 123), INT8_C(  68), INT8_C(  47), INT8_C(-103), INT8_C( 111), INT8_C( -37), INT8_C(  67), INT8_C(  17),
+                           INT8_C( -89), INT8_C(  65), INT8_C(  46), INT8_C( -65), INT8_C(  -5), INT8_C( -68), INT8_C(  21), INT8_C( -70),
+                           INT8_C(  -1), INT8_C( -22), INT8_C(  60), INT8_C(  35), INT8_C( 125), INT8_C(  93), INT8_C( -32), INT8_C( -69),
+                           INT8_C(-124), INT8_C(  63), INT8_C( -98), INT8_C(-104), INT8_C(  30), INT8_C( -79), INT8_C( -10), INT8_C( -42),
+                           INT8_C( -47), INT8_C( -99), INT8_C(  32), INT8_C( 115), INT8_C( -13), INT8_C(  97), INT8_C(  -1), INT8_C(  40),
+                           INT8_C(  40), INT8_C( -28), INT8_C(  96), INT8_C(-123), INT8_C(-103), INT8_C(-105), INT8_C( -45), INT8_C(  14),
+                           INT8_C( -36), INT8_C( 118), INT8_C(  92), INT8_C( -52), INT8_C( -26), INT8_C(  -9), INT8_C( -22), INT8_C(  90)),
+      simde_mm512_set_epi8(INT8_C( -89), INT8_C(  78), INT8_C(  33), INT8_C(  10), INT8_C(-107), INT8_C( -44), INT8_C( -57), INT8_C( -90),
+                           INT8_C(-108), INT8_C(  -8), INT8_C( -42), INT8_C( -28), INT8_C(  83), INT8_C(  50), INT8_C( 108), INT8_C( -65),
+                           INT8_C( 103), INT8_C(  99), INT8_C( -70), INT8_C(  17), INT8_C( -37), INT8_C( 125), INT8_C( 110), INT8_C( -30),
+                           INT8_C(  71), INT8_C(  74), INT8_C( 119), INT8_C( -27), INT8_C( 105), INT8_C( -98), INT8_C(  19), INT8_C(-123),
+                           INT8_C(-111), INT8_C( -64), INT8_C(  17), INT8_C( -72), INT8_C( -85), INT8_C( -29), INT8_C( 103), INT8_C( -54),
+                           INT8_C( 122), INT8_C(  50), INT8_C( -56), INT8_C( -62), INT8_C(  36), INT8_C( 102), INT8_C( -17), INT8_C(  20),
+                           INT8_C(-113), INT8_C( -52), INT8_C( 106), INT8_C(  34), INT8_C(  49), INT8_C(  46), INT8_C(  36), INT8_C(  92),
+                           INT8_C(  47), INT8_C(-100), INT8_C(-103), INT8_C( -86), INT8_C(-103), INT8_C(-114), INT8_C( -76), INT8_C(  52)),
+      simde_mm512_set_epi32(INT32_C(  657740920), INT32_C( -713973925), INT32_C(-1405113714), INT32_C( 1240126046),
+                            INT32_C(-1170753872), INT32_C(  799698012), INT32_C( -327356520), INT32_C(-1047491576),
+                            INT32_C( -769914727), INT32_C(  610715908), INT32_C(  842481357), INT32_C(-1177690818),
+                            INT32_C(  370451090), INT32_C(-2104285328), INT32_C(-2062580766), INT32_C(-1404788104)) },
+    { simde_mm512_set_epi32(INT32_C( -994511932), INT32_C(  388776214), INT32_C(-1807802613), INT32_C( -802504235),
+                            INT32_C( 1475711151), INT32_C( 1118253939), INT32_C( 1700534776), INT32_C( 1061799971),
+                            INT32_C( 1775506574), INT32_C( -947080959), INT32_C(  -14072923), INT32_C( 1072784068),
+                            INT32_C(-1157014155), INT32_C(  782027868), INT32_C( 1287431144), INT32_C(-1920705178)),
+      UINT16_C( 7091),
+      simde_mm512_set_epi8(INT8_C(-104), INT8_C(  89), INT8_C(  22), INT8_C(  49), INT8_C( -85), INT8_C( -48), INT8_C(  56), INT8_C(   7),
+                           INT8_C(  33), INT8_C(  63), INT8_C( -34), INT8_C(  68), INT8_C(-118), INT8_C( -69), INT8_C( -76), INT8_C( -18),
+                           INT8_C(  21), INT8_C( -96), INT8_C(  45), INT8_C(  65), INT8_C(  46), INT8_C( -33), INT8_C( -64), INT8_C( -81),
+                           INT8_C(-116), INT8_C( -37), INT8_C( -32), INT8_C(  -8), INT8_C( -38), INT8_C( 104), INT8_C( -13), INT8_C(   9),
+                           INT8_C(  46), INT8_C(-124), INT8_C(-103), INT8_C( -13), INT8_C( -95), INT8_C(  41), INT8_C(-125), INT8_C(-114),
+                           INT8_C( -68), INT8_C( -55), INT8_C( -61), INT8_C( -85), INT8_C( 123), INT8_C(  82), INT8_C(  -7), INT8_C( 124),
+                           INT8_C(  67), INT8_C(  50), INT8_C( -15), INT8_C( -31), INT8_C( -28), INT8_C(  45), INT8_C(  40), INT8_C(  44),
+                           INT8_C(  56), INT8_C( -14), INT8_C(  73), INT8_C( -94), INT8_C( -28), INT8_C(  24), INT8_C(-100), INT8_C(  20)),
+      simde_mm512_set_epi8(INT8_C(  21), INT8_C(  99), INT8_C(-100), INT8_C( -85), INT8_C(-113), INT8_C(  -7), INT8_C(-121), INT8_C( -68),
+                           INT8_C( -39), INT8_C(  55), INT8_C( -70), INT8_C( -49), INT8_C( -33), INT8_C(  40), INT8_C(  80), INT8_C(  28),
+                           INT8_C(  40), INT8_C(  51), INT8_C( -61), INT8_C( -48), INT8_C( -92), INT8_C(-118), INT8_C( -61), INT8_C(  26),
+                           INT8_C(  59), INT8_C(-128), INT8_C( -11), INT8_C(  25), INT8_C( -95), INT8_C( -74), INT8_C( -17), INT8_C(-123),
+                           INT8_C( -30), INT8_C(  94), INT8_C(  74), INT8_C(  67), INT8_C( 115), INT8_C(  90), INT8_C( -19), INT8_C( -34),
+                           INT8_C(  70), INT8_C(-124), INT8_C(-109), INT8_C( 114), INT8_C( -21), INT8_C(   3), INT8_C(  55), INT8_C( -15),
+                           INT8_C( 101), INT8_C( -32), INT8_C( -73), INT8_C(  25), INT8_C(  84), INT8_C(-106), INT8_C(  58), INT8_C(-124),
+                           INT8_C(-127), INT8_C( -16), INT8_C( 106), INT8_C(  31), INT8_C( -56), INT8_C( -25), INT8_C( 121), INT8_C( -73)),
+      simde_mm512_set_epi32(INT32_C( -994511932), INT32_C(  388776214), INT32_C(-1807802613), INT32_C( -802480245),
+                            INT32_C( 1475714286), INT32_C( 1118253939), INT32_C( 1700518740), INT32_C( 1061766327),
+                            INT32_C( 1775545205), INT32_C( -947080959), INT32_C(  -14086448), INT32_C( 1072793566),
+                            INT32_C(-1157014155), INT32_C(  782027868), INT32_C( 1287432920), INT32_C(-1920701130)) },
+    { simde_mm512_set_epi32(INT32_C(  414847685), INT32_C( -772362262), INT32_C( 1735071451), INT32_C(-1002466419),
+                            INT32_C( -798966481), INT32_C(  945590639), INT32_C(  914864514), INT32_C( -214363954),
+                            INT32_C( -703674314), INT32_C(  658160633), INT32_C(-1015664154), INT32_C( 1842091732),
+                            INT32_C( -257784249), INT32_C(  487895858), INT32_C( -124302635), INT32_C(  221035332)),
+      UINT16_C(28921),
+      simde_mm512_set_epi8(INT8_C(  38), INT8_C(-118), INT8_C(  96), INT8_C(  33), INT8_C(  34), INT8_C(  30), INT8_C(  98), INT8_C(  40),
+                           INT8_C( -63), INT8_C( -59), INT8_C( -10), INT8_C(  82), INT8_C(  44), INT8_C(  67), INT8_C( -11), INT8_C(  66),
+                           INT8_C(   9), INT8_C( -47), INT8_C(  -2), INT8_C(  29), INT8_C(  11), INT8_C( -16), INT8_C(  89), INT8_C( -79),
+                           INT8_C(   8), INT8_C(-120), INT8_C(  -8), INT8_C(  43), INT8_C(  97), INT8_C( -41), INT8_C( -45), INT8_C(-106),
+                           INT8_C( -17), INT8_C( -64), INT8_C( 105), INT8_C( -89), INT8_C( -86), INT8_C(  21), INT8_C(  55), INT8_C( -71),
+                           INT8_C(   0), INT8_C( 105), INT8_C(  73), INT8_C(  65), INT8_C(  71), INT8_C(  94), INT8_C( -72), INT8_C( -56),
+                           INT8_C(  94), INT8_C( -16), INT8_C( -67), INT8_C(-104), INT8_C( -16), INT8_C(  31), INT8_C(-122), INT8_C(-123),
+                           INT8_C(-127), INT8_C(   2), INT8_C(-119), INT8_C( -83), INT8_C(   2), INT8_C( 105), INT8_C(  -8), INT8_C(  53)),
+      simde_mm512_set_epi8(INT8_C(-103), INT8_C( -53), INT8_C( -63), INT8_C(   8), INT8_C(  76), INT8_C(  30), INT8_C(  99), INT8_C( -66),
+                           INT8_C(  -1), INT8_C( -82), INT8_C(  76), INT8_C(-121), INT8_C(  48), INT8_C( -12), INT8_C(  71), INT8_C(  48),
+                           INT8_C(  15), INT8_C(  12), INT8_C(-106), INT8_C(  49), INT8_C(-106), INT8_C( -65), INT8_C(  38), INT8_C( 124),
+                           INT8_C( -74), INT8_C( 127), INT8_C( -28), INT8_C( -56), INT8_C(  93), INT8_C(  74), INT8_C(  41), INT8_C( -17),
+                           INT8_C(  82), INT8_C( -16), INT8_C( -66), INT8_C(  41), INT8_C( 103), INT8_C( 103), INT8_C(  23), INT8_C( -64),
+                           INT8_C( 102), INT8_C( -93), INT8_C(  92), INT8_C(  57), INT8_C( -40), INT8_C(-122), INT8_C(  18), INT8_C( -91),
+                           INT8_C(-117), INT8_C( -91), INT8_C(  16), INT8_C( -74), INT8_C(-124), INT8_C( -71), INT8_C( -48), INT8_C(  69),
+                           INT8_C( -37), INT8_C(-113), INT8_C(  15), INT8_C( -27), INT8_C(-126), INT8_C(  95), INT8_C( -44), INT8_C( -20)),
+      simde_mm512_set_epi32(INT32_C(  414847685), INT32_C( -772351716), INT32_C( 1735063878), INT32_C(-1002444548),
+                            INT32_C( -798966481), INT32_C(  945590639), INT32_C(  914864514), INT32_C( -214363954),
+                            INT32_C( -703657871), INT32_C(  658169731), INT32_C(-1015663498), INT32_C( 1842062536),
+                            INT32_C( -257825311), INT32_C(  487895858), INT32_C( -124302635), INT32_C(  221033083)) },
+    { simde_mm512_set_epi32(INT32_C( 1690038248), INT32_C( 1455039980), INT32_C( -700397073), INT32_C(  888038379),
+                            INT32_C( 1627867973), INT32_C( -640243804), INT32_C( -341690264), INT32_C(   50603181),
+                            INT32_C( -790946373), INT32_C( 1278996493), INT32_C(  963843955), INT32_C( 1135548001),
+                            INT32_C(-1893653840), INT32_C(  716457192), INT32_C(-1306547701), INT32_C(-1643816872)),
+      UINT16_C(46775),
+      simde_mm512_set_epi8(INT8_C(-125), INT8_C( -42), INT8_C(-104), INT8_C(-105), INT8_C(  -4), INT8_C( -71), INT8_C(  58), INT8_C(-122),
+                           INT8_C(  93), INT8_C(  54), INT8_C(  65), INT8_C(-114), INT8_C(  43), INT8_C( -46), INT8_C(  85), INT8_C(  44),
+                           INT8_C( -66), INT8_C( -53), INT8_C(  59), INT8_C( -40), INT8_C( -56), INT8_C(  63), INT8_C( -66), INT8_C(  80),
+                           INT8_C(  -4), INT8_C( -89), INT8_C(  60), INT8_C( -88), INT8_C(  81), INT8_C(  23), INT8_C(-122), INT8_C(  92),
+                           INT8_C(  64), INT8_C(  69), INT8_C(-105), INT8_C(  74), INT8_C(  72), INT8_C(  12), INT8_C(  17), INT8_C( -65),
+                           INT8_C( -71), INT8_C(   3), INT8_C( -36), INT8_C(  -3), INT8_C(  45), INT8_C(  15), INT8_C(  -2), INT8_C( -62),
+                           INT8_C( -46), INT8_C(  84), INT8_C(-128), INT8_C(  50), INT8_C( -61), INT8_C(  69), INT8_C(  56), INT8_C(  50),
+                           INT8_C( -56), INT8_C( -98), INT8_C( -80), INT8_C( -78), INT8_C(  57), INT8_C( 109), INT8_C( -86), INT8_C( -89)),
+      simde_mm512_set_epi8(INT8_C( -74), INT8_C(  56), INT8_C( -73), INT8_C(   3), INT8_C( -39), INT8_C(-101), INT8_C( 105), INT8_C(  37),
+                           INT8_C(  17), INT8_C(-121), INT8_C(  56), INT8_C(-123), INT8_C( -71), INT8_C( -34), INT8_C( 119), INT8_C(  11),
+                           INT8_C( -73), INT8_C(  -4), INT8_C(  65), INT8_C( 115), INT8_C(-112), INT8_C(   1), INT8_C(   5), INT8_C(  65),
+                           INT8_C( 104), INT8_C( -71), INT8_C( -72), INT8_C(-116), INT8_C( -27), INT8_C(-120), INT8_C(  38), INT8_C(  77),
+                           INT8_C(  49), INT8_C( -68), INT8_C( 105), INT8_C( 109), INT8_C(   2), INT8_C( -66), INT8_C( -16), INT8_C( -84),
+                           INT8_C(-118), INT8_C(   7), INT8_C(  49), INT8_C(  22), INT8_C( -93), INT8_C( -28), INT8_C( -93), INT8_C( 106),
+                           INT8_C( -55), INT8_C( 125), INT8_C( -85), INT8_C( 107), INT8_C(-115), INT8_C(  79), INT8_C( 101), INT8_C( -31),
+                           INT8_C(-113), INT8_C(  -8), INT8_C(  91), INT8_C( 114), INT8_C(-120), INT8_C( -72), INT8_C(  41), INT8_C( 115)),
+      simde_mm512_set_epi32(INT32_C( 1690029895), INT32_C( 1455039980), INT32_C( -700415852), INT32_C(  888038785),
+                            INT32_C( 1627867973), INT32_C( -640259991), INT32_C( -341699721), INT32_C(   50603181),
+                            INT32_C( -790924008), INT32_C( 1278996493), INT32_C(  963838492), INT32_C( 1135540338),
+                            INT32_C(-1893653840), INT32_C(  716444324), INT32_C(-1306535257), INT32_C(-1643805385)) },
+    { simde_mm512_set_epi32(INT32_C( -899530943), INT32_C( -176329118), INT32_C(-1070165835), INT32_C( -420428375),
+                            INT32_C(  983265054), INT32_C(-1394713198), INT32_C( -997460602), INT32_C(  403181070),
+                            INT32_C(-2053254741), INT32_C( -354416356), INT32_C( 2038295292), INT32_C( 1903257741),
+                            INT32_C( 1497080399), INT32_C( 1740980622), INT32_C(-1557567563), INT32_C(-1626961382)),
+      UINT16_C(45452),
+      simde_mm512_set_epi8(INT8_C( -31), INT8_C( -98), INT8_C(  63), INT8_C(-125), INT8_C(   4), INT8_C(  21), INT8_C( -47), INT8_C( -95),
+                           INT8_C(  20), INT8_C( -88), INT8_C( -69), INT8_C(  66), INT8_C(  92), INT8_C( 123), INT8_C(  10), INT8_C( -76),
+                           INT8_C(  20), INT8_C(-126), INT8_C(-109), INT8_C( 123), INT8_C(  15), INT8_C( -46), INT8_C(  34), INT8_C( -79),
+                           INT8_C(-123), INT8_C(  92), INT8_C( -18), INT8_C( -49), INT8_C(  22), INT8_C(  98), INT8_C( -46), INT8_C(  85),
+                           INT8_C(-104), INT8_C(  64), INT8_C(  84), INT8_C(  34), INT8_C( -69), INT8_C( -43), INT8_C( -56), INT8_C( -60),
+                           INT8_C(   5), INT8_C( 108), INT8_C( -23), INT8_C( 115), INT8_C( 103), INT8_C(  11), INT8_C(  74), INT8_C(  80),
+                           INT8_C(  71), INT8_C(   2), INT8_C( -16), INT8_C( -66), INT8_C( -90), INT8_C(-100), INT8_C( 123), INT8_C(  38),
+                           INT8_C( -89), INT8_C(  74), INT8_C(  29), INT8_C( -19), INT8_C(  28), INT8_C( 124), INT8_C(  76), INT8_C(  62)),
+      simde_mm512_set_epi8(INT8_C( 108), INT8_C( -49), INT8_C( -89), INT8_C(-104), INT8_C(-120), INT8_C(-113), INT8_C(  40), INT8_C( -99),
+                           INT8_C( -38), INT8_C(  36), INT8_C(  -4), INT8_C(  45), INT8_C(  83), INT8_C(-103), INT8_C( -73), INT8_C(  51),
+                           INT8_C(-112), INT8_C(  66), INT8_C(  35), INT8_C(  87), INT8_C( -87), INT8_C(  75), INT8_C(  73), INT8_C( -96),
+                           INT8_C(   9), INT8_C( 121), INT8_C( -66), INT8_C(  36), INT8_C(-103), INT8_C(  -4), INT8_C( -81), INT8_C( 126),
+                           INT8_C( -98), INT8_C( -89), INT8_C( -70), INT8_C(  50), INT8_C(  79), INT8_C(-128), INT8_C(  96), INT8_C(  62),
+                           INT8_C( 108), INT8_C( -67), INT8_C( -63), INT8_C(  50), INT8_C( -98), INT8_C( -18), INT8_C( 125), INT8_C(-123),
+                           INT8_C( -82), INT8_C( -74), INT8_C( -72), INT8_C( 102), INT8_C(  51), INT8_C(   2), INT8_C( -47), INT8_C( -90),
+                           INT8_C(  33), INT8_C(  93), INT8_C(  -7), INT8_C(   4), INT8_C( -39), INT8_C( -39), INT8_C( -78), INT8_C(  66)),
+      simde_mm512_set_epi32(INT32_C( -899533616), INT32_C( -176329118), INT32_C(-1070158325), INT32_C( -420424958),
+                            INT32_C(  983265054), INT32_C(-1394713198), INT32_C( -997460602), INT32_C(  403172112),
+                            INT32_C(-2053279513), INT32_C( -354416356), INT32_C( 2038295292), INT32_C( 1903257741),
+                            INT32_C( 1497076529), INT32_C( 1740980199), INT32_C(-1557567563), INT32_C(-1626961382)) },
+    { simde_mm512_set_epi32(INT32_C( -567075294), INT32_C(  522323336), INT32_C( 1262470970), INT32_C(   60044642),
+                            INT32_C(   19074892), INT32_C( 2126056119), INT32_C( -480078030), INT32_C(  865520814),
+                            INT32_C(  825933525), INT32_C( -474454684), INT32_C( 1116033061), INT32_C(  -25684085),
+                            INT32_C( 1534061227), INT32_C( 1793769460), INT32_C(-2124228816), INT32_C( -261820945)),
+      UINT16_C(61798),
+      simde_mm512_set_epi8(INT8_C(  34), INT8_C(  46), INT8_C(  51), INT8_C( -19), INT8_C(-109), INT8_C(  97), INT8_C(  37), INT8_C( 117),
+                           INT8_C( -41), INT8_C( -57), INT8_C( -94), INT8_C( -56), INT8_C(  -6), INT8_C(  65), INT8_C(  19), INT8_C( -46),
+                           INT8_C(  72), INT8_C( -83), INT8_C( 101), INT8_C(  59), INT8_C(  65), INT8_C(  29), INT8_C( 105), INT8_C(   0),
+                           INT8_C(  48), INT8_C(  95), INT8_C(  -5), INT8_C( 126), INT8_C( -63), INT8_C( -50), INT8_C( -25), INT8_C(  78),
+                           INT8_C( -85), INT8_C( -94), INT8_C(-115), INT8_C(  -6), INT8_C(-100), INT8_C( -22), INT8_C( -31), INT8_C( -51),
+                           INT8_C(  60), INT8_C(  95), INT8_C(-126), INT8_C( -99), INT8_C(  78), INT8_C(-124), INT8_C(  83), INT8_C( -22),
+                           INT8_C(  57), INT8_C( 125), INT8_C(  35), INT8_C(  26), INT8_C( 127), INT8_C( -14), INT8_C(  -9), INT8_C(   4),
+                           INT8_C( -38), INT8_C( 119), INT8_C(  21), INT8_C(  37), INT8_C(-108), INT8_C(  42), INT8_C(  35), INT8_C(-125)),
+      simde_mm512_set_epi8(INT8_C( 111), INT8_C( -11), INT8_C( -52), INT8_C(  97), INT8_C( -98), INT8_C( -72), INT8_C(  80), INT8_C(  70),
+                           INT8_C(   7), INT8_C(  80), INT8_C(  69), INT8_C(  64), INT8_C(  46), INT8_C(  64), INT8_C(   1), INT8_C(  68),
+                           INT8_C( -10), INT8_C( 126), INT8_C(  71), INT8_C(-102), INT8_C(  10), INT8_C(  60), INT8_C( -18), INT8_C( -39),
+                           INT8_C( -90), INT8_C(-108), INT8_C(  13), INT8_C(  92), INT8_C( -41), INT8_C( -94), INT8_C(-119), INT8_C(  11),
+                           INT8_C( -28), INT8_C(  26), INT8_C( 125), INT8_C(-107), INT8_C(  80), INT8_C( 125), INT8_C(   1), INT8_C(  73),
+                           INT8_C(  25), INT8_C( -30), INT8_C( 110), INT8_C(  55), INT8_C(  -6), INT8_C( -13), INT8_C( -40), INT8_C(  -8),
+                           INT8_C( -58), INT8_C(  73), INT8_C( 112), INT8_C( -39), INT8_C(  98), INT8_C(-127), INT8_C( -39), INT8_C(-117),
+                           INT8_C( -88), INT8_C( -98), INT8_C(  79), INT8_C( -62), INT8_C(-128), INT8_C(  94), INT8_C(  26), INT8_C( 127)),
+      simde_mm512_set_epi32(INT32_C( -567051689), INT32_C(  522313096), INT32_C( 1262512373), INT32_C(   60074601),
+                            INT32_C(   19074892), INT32_C( 2126056119), INT32_C( -480078030), INT32_C(  865466906),
+                            INT32_C(  825933525), INT32_C( -474397764), INT32_C( 1116054646), INT32_C(  -25684085),
+                            INT32_C( 1534061227), INT32_C( 1793741071), INT32_C(-2124260297), INT32_C( -261820945)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_dpbusd_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_dpbusd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i src;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(52156),
+      simde_mm512_set_epi32(INT32_C( -703097185), INT32_C( 1135558627), INT32_C(-1742432798), INT32_C( 1350847222),
+                            INT32_C(  999089183), INT32_C(  696019683), INT32_C(  541657221), INT32_C(  898969667),
+                            INT32_C( 1900061732), INT32_C( 1989572524), INT32_C( 1137765091), INT32_C(  574063337),
+                            INT32_C(  500212249), INT32_C(   28046722), INT32_C( -832968945), INT32_C(   37470980)),
+      simde_mm512_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm512_set_epi8(INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127),
+                           INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127), INT8_C( 127)),
+      simde_mm512_set_epi32(INT32_C( -702967645), INT32_C( 1135688167), INT32_C(          0), INT32_C(          0),
+                            INT32_C(  999218723), INT32_C(          0), INT32_C(  541786761), INT32_C(  899099207),
+                            INT32_C( 1900191272), INT32_C(          0), INT32_C( 1137894631), INT32_C(  574192877),
+                            INT32_C(  500341789), INT32_C(   28176262), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(26178),
+      simde_mm512_set_epi32(INT32_C( -898407682), INT32_C( 1667800358), INT32_C( -240856204), INT32_C(-1168315979),
+                            INT32_C( -778494113), INT32_C( -596072712), INT32_C(   51730958), INT32_C( 2068910942),
+                            INT32_C( -955240067), INT32_C( 2091356859), INT32_C(  983551400), INT32_C( -691834083),
+                            INT32_C( -100869995), INT32_C( 1097873453), INT32_C( 1253981906), INT32_C( 1740170027)),
+      simde_mm512_set_epi8(INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+                           INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)),
+      simde_mm512_set_epi8(INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128),
+                           INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(-128)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C( 1667669798), INT32_C( -240986764), INT32_C(          0),
+                            INT32_C(          0), INT32_C( -596203272), INT32_C(   51600398), INT32_C(          0),
+                            INT32_C(          0), INT32_C( 2091226299), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C( 1253851346), INT32_C(          0)) },
+    { UINT16_C(11351),
+      simde_mm512_set_epi32(INT32_C( -144054063), INT32_C(  261787905), INT32_C(  337390772), INT32_C( 1355365882),
+                            INT32_C( 1103957103), INT32_C(-1161885271), INT32_C(  931546869), INT32_C( 1155661782),
+                            INT32_C(  238734960), INT32_C(-1116872428), INT32_C(  260244616), INT32_C(-2100117226),
+                            INT32_C(-1501225162), INT32_C( -298813338), INT32_C( 1173174669), INT32_C(  329774094)),
+      simde_mm512_set_epi8(INT8_C(  90), INT8_C(  16), INT8_C(  55), INT8_C(-123), INT8_C(  52), INT8_C( -24), INT8_C(  95), INT8_C( -48),
+                           INT8_C( -48), INT8_C( -66), INT8_C(  69), INT8_C( -85), INT8_C(-106), INT8_C(-121), INT8_C(  89), INT8_C( -93),
+                           INT8_C(  15), INT8_C(  54), INT8_C(  18), INT8_C(   7), INT8_C(-113), INT8_C(  75), INT8_C( -69), INT8_C( -44),
+                           INT8_C(-114), INT8_C( -94), INT8_C(  60), INT8_C(  60), INT8_C( -91), INT8_C( 107), INT8_C( -15), INT8_C(  -9),
+                           INT8_C( -75), INT8_C(  26), INT8_C( -64), INT8_C(  98), INT8_C( -29), INT8_C( 109), INT8_C( -38), INT8_C( -62),
+                           INT8_C(-105), INT8_C( 119), INT8_C( -50), INT8_C(-105), INT8_C(  75), INT8_C(  79), INT8_C(   7), INT8_C(-115),
+                           INT8_C( -19), INT8_C(  87), INT8_C( -77), INT8_C( 100), INT8_C(  25), INT8_C( -49), INT8_C(  51), INT8_C(  43),
+                           INT8_C(-106), INT8_C(-121), INT8_C(  28), INT8_C( -77), INT8_C(-111), INT8_C( -57), INT8_C( -60), INT8_C(  99)),
+      simde_mm512_set_epi8(INT8_C( -87), INT8_C(  62), INT8_C(  95), INT8_C(  78), INT8_C( -76), INT8_C(  35), INT8_C(-108), INT8_C(  -2),
+                           INT8_C(  94), INT8_C( -95), INT8_C( -11), INT8_C( -27), INT8_C(  93), INT8_C(  66), INT8_C( -44), INT8_C(-105),
+                           INT8_C( -64), INT8_C(  61), INT8_C(  33), INT8_C( 104), INT8_C( -31), INT8_C( 116), INT8_C( -49), INT8_C(  73),
+                           INT8_C( -45), INT8_C(  13), INT8_C( 116), INT8_C(  13), INT8_C(-103), INT8_C(  53), INT8_C(-124), INT8_C(   1),
+                           INT8_C( 102), INT8_C(  88), INT8_C( -53), INT8_C( 119), INT8_C(-117), INT8_C(   9), INT8_C( -70), INT8_C(  53),
+                           INT8_C(  -3), INT8_C(  15), INT8_C(-127), INT8_C( 103), INT8_C(-111), INT8_C(-114), INT8_C(  18), INT8_C(  81),
+                           INT8_C( -78), INT8_C( -76), INT8_C( -52), INT8_C(-109), INT8_C(  87), INT8_C(   0), INT8_C(  36), INT8_C(  89),
+                           INT8_C(  -4), INT8_C(  45), INT8_C(  78), INT8_C( -30), INT8_C(  -7), INT8_C( -78), INT8_C( 123), INT8_C( 111)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(  337386898), INT32_C(          0),
+                            INT32_C( 1103960759), INT32_C(-1161874691), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(-1116902984), INT32_C(          0), INT32_C(-2100123010),
+                            INT32_C(          0), INT32_C( -298805500), INT32_C( 1173176958), INT32_C(  329792654)) },
+    { UINT16_C(52347),
+      simde_mm512_set_epi32(INT32_C( -563628598), INT32_C(  576189198), INT32_C( 2038882447), INT32_C(-1616548778),
+                            INT32_C(-1004335452), INT32_C( 2043679092), INT32_C(  246272637), INT32_C( 1921748399),
+                            INT32_C( -310967455), INT32_C(-1496979139), INT32_C(-1630715995), INT32_C(  877184375),
+                            INT32_C(-1769181901), INT32_C( -541631552), INT32_C(  601780632), INT32_C(-1336416305)),
+      simde_mm512_set_epi8(INT8_C( -78), INT8_C( 106), INT8_C( 101), INT8_C( -83), INT8_C( 112), INT8_C( -98), INT8_C(  17), INT8_C( 100),
+                           INT8_C( -37), INT8_C(  -1), INT8_C(  95), INT8_C( -68), INT8_C( 120), INT8_C( -29), INT8_C(  84), INT8_C(-115),
+                           INT8_C(  19), INT8_C( -15), INT8_C(-122), INT8_C( -87), INT8_C(-100), INT8_C( 104), INT8_C(  37), INT8_C(   7),
+                           INT8_C(  80), INT8_C( -24), INT8_C( -70), INT8_C( -17), INT8_C( -48), INT8_C(  94), INT8_C( 112), INT8_C(  39),
+                           INT8_C(  36), INT8_C( -26), INT8_C(   2), INT8_C( -51), INT8_C(  58), INT8_C(  72), INT8_C(  17), INT8_C(  69),
+                           INT8_C( 113), INT8_C( -63), INT8_C(-103), INT8_C(-126), INT8_C(  75), INT8_C(  84), INT8_C(  16), INT8_C(  37),
+                           INT8_C(   5), INT8_C( -65), INT8_C(  86), INT8_C( -26), INT8_C( -14), INT8_C(  78), INT8_C(  57), INT8_C( -42),
+                           INT8_C( -80), INT8_C(  72), INT8_C(  -9), INT8_C( 127), INT8_C(  99), INT8_C(  94), INT8_C(  95), INT8_C( 104)),
+      simde_mm512_set_epi8(INT8_C(-100), INT8_C( 125), INT8_C(-108), INT8_C( 112), INT8_C( -63), INT8_C(   6), INT8_C( -75), INT8_C(  81),
+                           INT8_C(  97), INT8_C(  75), INT8_C( -37), INT8_C(-117), INT8_C( 110), INT8_C( -13), INT8_C( 122), INT8_C( -92),
+                           INT8_C( -87), INT8_C( -32), INT8_C(-127), INT8_C(  31), INT8_C(  89), INT8_C( -76), INT8_C(-116), INT8_C(  -3),
+                           INT8_C( 107), INT8_C(-106), INT8_C(   1), INT8_C(  43), INT8_C(  51), INT8_C(  63), INT8_C(  86), INT8_C(  17),
+                           INT8_C(  97), INT8_C(  91), INT8_C( -90), INT8_C(  45), INT8_C(  41), INT8_C( -44), INT8_C( -51), INT8_C(  75),
+                           INT8_C(  -6), INT8_C( -16), INT8_C( -39), INT8_C( -52), INT8_C(  94), INT8_C(   7), INT8_C( -96), INT8_C(-118),
+                           INT8_C( 112), INT8_C(  50), INT8_C(  43), INT8_C( -14), INT8_C( -89), INT8_C(  60), INT8_C(-110), INT8_C(  46),
+                           INT8_C(  23), INT8_C( 113), INT8_C( -21), INT8_C(-122), INT8_C(  39), INT8_C(  91), INT8_C( -12), INT8_C(  70)),
+      simde_mm512_set_epi32(INT32_C( -563624680), INT32_C(  576189915), INT32_C(          0), INT32_C(          0),
+                            INT32_C(-1004356596), INT32_C( 2043680759), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(-1496975621), INT32_C(-1630732488), INT32_C(  877186111),
+                            INT32_C(-1769171313), INT32_C(          0), INT32_C(  601772135), INT32_C(-1336397750)) },
+    { UINT16_C(40819),
+      simde_mm512_set_epi32(INT32_C( 1744131957), INT32_C(  374867286), INT32_C( -642576296), INT32_C( 2009160814),
+                            INT32_C(  765414145), INT32_C( -602888985), INT32_C(  329774303), INT32_C( 1654088354),
+                            INT32_C( -320058466), INT32_C( 2138689792), INT32_C( 1699437319), INT32_C( -382485577),
+                            INT32_C(  -52249552), INT32_C(-1769057455), INT32_C(    4335564), INT32_C( 1737578787)),
+      simde_mm512_set_epi8(INT8_C(  80), INT8_C( 102), INT8_C(  39), INT8_C(-112), INT8_C( -26), INT8_C(   2), INT8_C(  62), INT8_C( -99),
+                           INT8_C( 112), INT8_C( -40), INT8_C(  28), INT8_C( -52), INT8_C( 112), INT8_C(  75), INT8_C(  10), INT8_C(-120),
+                           INT8_C(  -7), INT8_C(-119), INT8_C(  32), INT8_C( -10), INT8_C( -53), INT8_C(  -3), INT8_C( -30), INT8_C(  76),
+                           INT8_C( -15), INT8_C( -45), INT8_C( -87), INT8_C(  75), INT8_C(  23), INT8_C(  10), INT8_C( 102), INT8_C( -63),
+                           INT8_C( -56), INT8_C(  48), INT8_C(   6), INT8_C(  47), INT8_C(-116), INT8_C( -39), INT8_C(  -7), INT8_C( -78),
+                           INT8_C( -76), INT8_C( -12), INT8_C( 112), INT8_C( -54), INT8_C( -98), INT8_C( -58), INT8_C(  46), INT8_C( 110),
+                           INT8_C(-106), INT8_C(  70), INT8_C(  95), INT8_C( -90), INT8_C( 115), INT8_C( -40), INT8_C(  89), INT8_C( -99),
+                           INT8_C(  72), INT8_C(  43), INT8_C(  23), INT8_C( -21), INT8_C(  43), INT8_C( 103), INT8_C(  32), INT8_C( -36)),
+      simde_mm512_set_epi8(INT8_C( 103), INT8_C( -63), INT8_C( -34), INT8_C( -96), INT8_C( -89), INT8_C(  82), INT8_C(  69), INT8_C(  -8),
+                           INT8_C(-117), INT8_C(  -9), INT8_C(  25), INT8_C( 121), INT8_C( 119), INT8_C(-110), INT8_C( 106), INT8_C(  44),
+                           INT8_C(  30), INT8_C( -71), INT8_C(  71), INT8_C( -52), INT8_C( -60), INT8_C(  -2), INT8_C(   9), INT8_C(  -1),
+                           INT8_C( 114), INT8_C(  93), INT8_C(  -9), INT8_C(  35), INT8_C( 110), INT8_C( -46), INT8_C(  92), INT8_C( -58),
+                           INT8_C( -99), INT8_C( 122), INT8_C( -20), INT8_C( -53), INT8_C(-109), INT8_C(  72), INT8_C(   9), INT8_C(-107),
+                           INT8_C(  62), INT8_C( -61), INT8_C( -39), INT8_C( 111), INT8_C(  72), INT8_C(   0), INT8_C( -74), INT8_C(  -8),
+                           INT8_C( -17), INT8_C(  23), INT8_C( -89), INT8_C(  -1), INT8_C(  47), INT8_C( -88), INT8_C( -15), INT8_C( -37),
+                           INT8_C( -77), INT8_C( -15), INT8_C(  18), INT8_C(   2), INT8_C( 123), INT8_C( -46), INT8_C(  61), INT8_C( -96)),
+      simde_mm512_set_epi32(INT32_C( 1744118621), INT32_C(          0), INT32_C(          0), INT32_C( 2009172936),
+                            INT32_C(  765401368), INT32_C( -602899713), INT32_C(  329822504), INT32_C( 1654088614),
+                            INT32_C(          0), INT32_C( 2138673351), INT32_C( 1699451649), INT32_C( -382478485),
+                            INT32_C(          0), INT32_C(          0), INT32_C(    4330259), INT32_C( 1737560170)) },
+    { UINT16_C(53666),
+      simde_mm512_set_epi32(INT32_C( -312791746), INT32_C(-1618379093), INT32_C( -663280988), INT32_C( 1809692096),
+                            INT32_C( 1516648623), INT32_C( -371323235), INT32_C( -482291491), INT32_C(-1146556355),
+                            INT32_C(  618154399), INT32_C( -868402738), INT32_C( -387643218), INT32_C(  -18006031),
+                            INT32_C( -571929425), INT32_C(   -3238696), INT32_C( -546694926), INT32_C(-2121364851)),
+      simde_mm512_set_epi8(INT8_C(  63), INT8_C( -39), INT8_C(  34), INT8_C(  46), INT8_C(  32), INT8_C(  89), INT8_C( -15), INT8_C(-115),
+                           INT8_C( -31), INT8_C( -12), INT8_C( -68), INT8_C(-106), INT8_C( -89), INT8_C( 124), INT8_C( -78), INT8_C( -24),
+                           INT8_C( -11), INT8_C( 107), INT8_C(  49), INT8_C(  52), INT8_C( -99), INT8_C( -14), INT8_C(  87), INT8_C(-121),
+                           INT8_C( -55), INT8_C( 100), INT8_C( -87), INT8_C( 123), INT8_C(  81), INT8_C(-113), INT8_C( -79), INT8_C( -28),
+                           INT8_C(  80), INT8_C( -56), INT8_C(  23), INT8_C(   4), INT8_C(  94), INT8_C(  79), INT8_C( -70), INT8_C( -47),
+                           INT8_C(-125), INT8_C(   2), INT8_C( -98), INT8_C( -85), INT8_C(-115), INT8_C(  85), INT8_C(  39), INT8_C(  95),
+                           INT8_C(  71), INT8_C(  63), INT8_C( -67), INT8_C(  60), INT8_C( -96), INT8_C(-103), INT8_C( -30), INT8_C(  91),
+                           INT8_C(-121), INT8_C(-119), INT8_C(  89), INT8_C(  75), INT8_C(  98), INT8_C(  16), INT8_C( -90), INT8_C(-106)),
+      simde_mm512_set_epi8(INT8_C( -79), INT8_C( -80), INT8_C( 119), INT8_C(  87), INT8_C(-123), INT8_C( -85), INT8_C( -53), INT8_C(  52),
+                           INT8_C( -63), INT8_C( 102), INT8_C(-118), INT8_C( -75), INT8_C( -48), INT8_C(  37), INT8_C(   8), INT8_C(  36),
+                           INT8_C(  97), INT8_C(  -3), INT8_C( -81), INT8_C( 100), INT8_C(  58), INT8_C( -36), INT8_C(  46), INT8_C( 120),
+                           INT8_C(  31), INT8_C( -43), INT8_C( -56), INT8_C( -23), INT8_C( -47), INT8_C(-128), INT8_C(  32), INT8_C(  56),
+                           INT8_C(  75), INT8_C( -20), INT8_C(  29), INT8_C( -46), INT8_C( -46), INT8_C( -94), INT8_C( 115), INT8_C(  94),
+                           INT8_C(  64), INT8_C(   7), INT8_C(  11), INT8_C( -84), INT8_C( -37), INT8_C(  27), INT8_C(-126), INT8_C(-101),
+                           INT8_C(  53), INT8_C( 112), INT8_C( -42), INT8_C(  56), INT8_C( 115), INT8_C(  -7), INT8_C(  27), INT8_C( -84),
+                           INT8_C( -92), INT8_C( 121), INT8_C( 119), INT8_C(  64), INT8_C(  86), INT8_C(   8), INT8_C(-127), INT8_C(  46)),
+      simde_mm512_set_epi32(INT32_C( -312806035), INT32_C(-1618396035), INT32_C(          0), INT32_C( 1809698444),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(-1146560034),
+                            INT32_C(  618156882), INT32_C(          0), INT32_C( -387647446), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C( -546675378), INT32_C(          0)) },
+    { UINT16_C( 8647),
+      simde_mm512_set_epi32(INT32_C(  104109412), INT32_C(-1964442830), INT32_C( 1929733039), INT32_C( 1984310632),
+                            INT32_C( 1355986668), INT32_C(-1859041627), INT32_C( 1311773299), INT32_C(   73875160),
+                            INT32_C(  275572729), INT32_C(  222738730), INT32_C( -449956376), INT32_C( 1381718489),
+                            INT32_C( 1434642012), INT32_C(  360223984), INT32_C(  252912869), INT32_C(  608573569)),
+      simde_mm512_set_epi8(INT8_C( 114), INT8_C( -64), INT8_C( -32), INT8_C( -37), INT8_C( -64), INT8_C( -81), INT8_C( -92), INT8_C(-125),
+                           INT8_C(  53), INT8_C(   5), INT8_C(  15), INT8_C( -24), INT8_C(  99), INT8_C(  63), INT8_C( -83), INT8_C( -40),
+                           INT8_C(-106), INT8_C( -86), INT8_C(  -2), INT8_C(-101), INT8_C(-101), INT8_C( -69), INT8_C( -41), INT8_C( -73),
+                           INT8_C( -40), INT8_C( -37), INT8_C(  11), INT8_C(  23), INT8_C( 127), INT8_C( 117), INT8_C( -63), INT8_C( 117),
+                           INT8_C(  99), INT8_C(  10), INT8_C( -33), INT8_C(-114), INT8_C( -51), INT8_C(  83), INT8_C( -51), INT8_C(  47),
+                           INT8_C( -20), INT8_C(-117), INT8_C( 109), INT8_C(  74), INT8_C( -59), INT8_C( -93), INT8_C( 127), INT8_C( -48),
+                           INT8_C(  13), INT8_C( 118), INT8_C(-106), INT8_C( -42), INT8_C( -72), INT8_C( -56), INT8_C( -20), INT8_C(   8),
+                           INT8_C(  -3), INT8_C( -46), INT8_C(  -7), INT8_C( 122), INT8_C( -86), INT8_C(  45), INT8_C( -90), INT8_C(  68)),
+      simde_mm512_set_epi8(INT8_C( 102), INT8_C( -95), INT8_C( -92), INT8_C(-115), INT8_C(  69), INT8_C( -89), INT8_C(-107), INT8_C( -20),
+                           INT8_C( 115), INT8_C(  31), INT8_C(  35), INT8_C( -92), INT8_C( 100), INT8_C(  66), INT8_C(-110), INT8_C(-119),
+                           INT8_C(  56), INT8_C(-112), INT8_C(  79), INT8_C(  56), INT8_C(   5), INT8_C(  19), INT8_C(-123), INT8_C(  67),
+                           INT8_C(   2), INT8_C( 124), INT8_C( -33), INT8_C( -52), INT8_C(  43), INT8_C(  83), INT8_C(  66), INT8_C(   7),
+                           INT8_C( -99), INT8_C( -28), INT8_C( -21), INT8_C( -94), INT8_C(  92), INT8_C( -92), INT8_C( -13), INT8_C( -32),
+                           INT8_C( -95), INT8_C(  72), INT8_C(  57), INT8_C( -70), INT8_C( -48), INT8_C( -79), INT8_C(-112), INT8_C(-127),
+                           INT8_C(-102), INT8_C(-116), INT8_C( 114), INT8_C( -80), INT8_C( -27), INT8_C(-120), INT8_C( -66), INT8_C(  -4),
+                           INT8_C(  49), INT8_C(  -7), INT8_C( 127), INT8_C(  80), INT8_C( -34), INT8_C(  67), INT8_C( -69), INT8_C(  10)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( 1929718470), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(   73903889),
+                            INT32_C(  275544617), INT32_C(  222745785), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(  360179408), INT32_C(  252965179), INT32_C(  608560030)) },
+    { UINT16_C(31341),
+      simde_mm512_set_epi32(INT32_C( -461661038), INT32_C(-1023639852), INT32_C(-1195587683), INT32_C( -621603143),
+                            INT32_C( 2125248505), INT32_C(-1010193117), INT32_C( -641371553), INT32_C( 1548975576),
+                            INT32_C(-1333225010), INT32_C(  927923183), INT32_C(  435998043), INT32_C( -690438573),
+                            INT32_C( -756039588), INT32_C(-1967042612), INT32_C( -442559212), INT32_C(  650986564)),
+      simde_mm512_set_epi8(INT8_C( -23), INT8_C( -96), INT8_C( -49), INT8_C(  -8), INT8_C( -92), INT8_C( -28), INT8_C( -71), INT8_C( -89),
+                           INT8_C(  -3), INT8_C( 102), INT8_C( -82), INT8_C( 100), INT8_C( -43), INT8_C(   4), INT8_C(  80), INT8_C(-122),
+                           INT8_C(  92), INT8_C(  97), INT8_C( 104), INT8_C( 111), INT8_C( -71), INT8_C(  42), INT8_C( -57), INT8_C(   8),
+                           INT8_C( -62), INT8_C(  44), INT8_C(-106), INT8_C( -61), INT8_C( -56), INT8_C(  51), INT8_C( -93), INT8_C(-113),
+                           INT8_C( -61), INT8_C(-112), INT8_C(-119), INT8_C(  67), INT8_C(-127), INT8_C(  78), INT8_C( -42), INT8_C( -94),
+                           INT8_C( -79), INT8_C(-122), INT8_C(-125), INT8_C( -51), INT8_C( 102), INT8_C(  42), INT8_C( -46), INT8_C( -57),
+                           INT8_C( 115), INT8_C( -18), INT8_C(  80), INT8_C(-107), INT8_C( 111), INT8_C(  90), INT8_C(-124), INT8_C(  15),
+                           INT8_C( -72), INT8_C(  79), INT8_C( -72), INT8_C(  61), INT8_C( -79), INT8_C( -18), INT8_C( -77), INT8_C(  41)),
+      simde_mm512_set_epi8(INT8_C( -83), INT8_C( 104), INT8_C( -97), INT8_C( 124), INT8_C(  96), INT8_C( 102), INT8_C(   9), INT8_C(  -2),
+                           INT8_C( -92), INT8_C(-105), INT8_C( -50), INT8_C( -87), INT8_C(-104), INT8_C( -44), INT8_C( 107), INT8_C(  40),
+                           INT8_C(-119), INT8_C(  52), INT8_C(  87), INT8_C(  53), INT8_C(  11), INT8_C( -58), INT8_C(  -9), INT8_C(  70),
+                           INT8_C( -92), INT8_C(   8), INT8_C( -72), INT8_C( -40), INT8_C(  16), INT8_C( 106), INT8_C(  -3), INT8_C(  -3),
+                           INT8_C(  92), INT8_C( -71), INT8_C(  61), INT8_C( -94), INT8_C(  69), INT8_C(-116), INT8_C(  76), INT8_C(  37),
+                           INT8_C( 102), INT8_C( -31), INT8_C( -75), INT8_C(  45), INT8_C( -40), INT8_C(  -5), INT8_C(   2), INT8_C(  97),
+                           INT8_C( -69), INT8_C( 110), INT8_C(  62), INT8_C(  75), INT8_C( -20), INT8_C(-100), INT8_C(   3), INT8_C( -26),
+                           INT8_C(  56), INT8_C(  26), INT8_C(-109), INT8_C( -67), INT8_C(   9), INT8_C( -97), INT8_C(  -7), INT8_C(  20)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(-1023599521), INT32_C(-1195639069), INT32_C( -621611551),
+                            INT32_C( 2125257532), INT32_C(          0), INT32_C( -641407649), INT32_C(          0),
+                            INT32_C(          0), INT32_C(  927945294), INT32_C(  436011343), INT32_C(          0),
+                            INT32_C( -756005208), INT32_C(-1967053826), INT32_C(          0), INT32_C(  650964638)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_dpbusd_epi32(test_vec[i].k, test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(-1828616549), INT32_C( 1420173296), INT32_C( 1784334488), INT32_C( 1480629385),
+                            INT32_C( -520294134), INT32_C(   45015565), INT32_C(  439357915), INT32_C( -613710779),
+                            INT32_C( 1741720039), INT32_C(  957547009), INT32_C(  740125225), INT32_C( 1264028050),
+                            INT32_C(  426512101), INT32_C(-1427896802), INT32_C(-1417041000), INT32_C( -318127143)),
+      simde_mm512_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm512_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm512_set_epi32(INT32_C(  318932635), INT32_C( -727244816), INT32_C( -363083624), INT32_C( -666788727),
+                            INT32_C( 1627255050), INT32_C(-2102402547), INT32_C(-1708060197), INT32_C( 1533838405),
+                            INT32_C( -405698073), INT32_C(-1189871103), INT32_C(-1407292887), INT32_C( -883390062),
+                            INT32_C(-1720906011), INT32_C(  719652382), INT32_C(  730508184), INT32_C( 1829422041)) },
+    { simde_mm512_set_epi32(INT32_C(   45679597), INT32_C(-2108357559), INT32_C(  261688794), INT32_C( -119017109),
+                            INT32_C(-1497442962), INT32_C( 1463945982), INT32_C(-1706236196), INT32_C(-1046814465),
+                            INT32_C( -827014147), INT32_C(-1739878432), INT32_C(  119703398), INT32_C(-1184541108),
+                            INT32_C( 2002341877), INT32_C( 1702768144), INT32_C(  855243083), INT32_C(  701995491)),
+      simde_mm512_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm512_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm512_set_epi32(INT32_C(-2101738515), INT32_C(   39191625), INT32_C(-1885729318), INT32_C( 2028532075),
+                            INT32_C(  650106222), INT32_C( -683472130), INT32_C(  441312988), INT32_C( 1100734719),
+                            INT32_C( 1320535037), INT32_C(  407670752), INT32_C(-2027714714), INT32_C(  963008076),
+                            INT32_C( -145076235), INT32_C( -444649968), INT32_C(-1292175029), INT32_C(-1445422621)) },
+    { simde_mm512_set_epi32(INT32_C( 1849444505), INT32_C(-2073487920), INT32_C(-1097862867), INT32_C(-1794564758),
+                            INT32_C(  -82261019), INT32_C( 1844682987), INT32_C( -450246987), INT32_C( 1577901329),
+                            INT32_C(  680955108), INT32_C(-1311802652), INT32_C(-1368622237), INT32_C(  -66848748),
+                            INT32_C( 1080116644), INT32_C( 1745450366), INT32_C( 1701650588), INT32_C( -314559720)),
+      simde_mm512_set_epi16(INT16_C(-21385), INT16_C(-29823), INT16_C(-17139), INT16_C( -9219), INT16_C( 24518), INT16_C( 29303), INT16_C( -6088), INT16_C(  6348),
+                            INT16_C( 15455), INT16_C(   631), INT16_C(  1065), INT16_C(-12397), INT16_C(-15044), INT16_C(-30505), INT16_C(-32143), INT16_C( 20849),
+                            INT16_C( -7147), INT16_C(-27843), INT16_C( -2884), INT16_C(  1597), INT16_C( 10816), INT16_C( 23458), INT16_C(-30671), INT16_C(-13148),
+                            INT16_C( -5903), INT16_C(-29430), INT16_C(-20653), INT16_C(  -932), INT16_C(-21720), INT16_C( 14809), INT16_C( -6040), INT16_C(-19461)),
+      simde_mm512_set_epi16(INT16_C( -7893), INT16_C( -7614), INT16_C( 17996), INT16_C( -7488), INT16_C( 27266), INT16_C(   603), INT16_C(-21646), INT16_C(  7030),
+                            INT16_C(-32652), INT16_C(-16312), INT16_C(  5458), INT16_C( 25585), INT16_C( -9388), INT16_C(-28892), INT16_C( 20534), INT16_C( 15691),
+                            INT16_C( 15522), INT16_C(-24826), INT16_C(  3836), INT16_C(-17539), INT16_C( 18605), INT16_C( 24318), INT16_C(-22769), INT16_C(  3109),
+                            INT16_C( 23250), INT16_C(-27600), INT16_C( -5452), INT16_C(-14156), INT16_C( 15117), INT16_C( 16293), INT16_C( 30826), INT16_C(-24822)),
+      simde_mm512_set_epi32(INT32_C(-2049658664), INT32_C( 1982077804), INT32_C( -411685370), INT32_C(-1618157470),
+                            INT32_C( -597190551), INT32_C( 1533318512), INT32_C(  572336545), INT32_C( 1245018626),
+                            INT32_C( 1261249692), INT32_C(-1350875459), INT32_C( -596938913), INT32_C(  590622119),
+                            INT32_C( 1755139894), INT32_C( 1871243914), INT32_C( 1614592385), INT32_C(  -17687818)) },
+    { simde_mm512_set_epi32(INT32_C( 2137077313), INT32_C( 1141970940), INT32_C( -243637697), INT32_C( -993060022),
+                            INT32_C(-1524972477), INT32_C( 1013618532), INT32_C( -307997720), INT32_C(   38441536),
+                            INT32_C(   54959563), INT32_C( -475148643), INT32_C( 1871537192), INT32_C(-1587103508),
+                            INT32_C( 1059511886), INT32_C(  694812627), INT32_C( 1206187679), INT32_C( 1537919749)),
+      simde_mm512_set_epi16(INT16_C( -2898), INT16_C(-11339), INT16_C(-24535), INT16_C( -7459), INT16_C( 32221), INT16_C(-12546), INT16_C(-27987), INT16_C(  2760),
+                            INT16_C(-30269), INT16_C(-22679), INT16_C(-10575), INT16_C( 29679), INT16_C( 24354), INT16_C( -5037), INT16_C(-14738), INT16_C( 22750),
+                            INT16_C(-10220), INT16_C(   839), INT16_C(-13787), INT16_C(-10065), INT16_C(-13137), INT16_C(  -535), INT16_C( 28617), INT16_C(-24529),
+                            INT16_C( -2293), INT16_C( -1599), INT16_C( -7062), INT16_C(-27514), INT16_C(-16153), INT16_C(-29512), INT16_C( 30085), INT16_C( 19155)),
+      simde_mm512_set_epi16(INT16_C( 22071), INT16_C( 26092), INT16_C( -5562), INT16_C( 13505), INT16_C( -6285), INT16_C(-23213), INT16_C(-23387), INT16_C( 19414),
+                            INT16_C( 21049), INT16_C(-26543), INT16_C( -7482), INT16_C(  7278), INT16_C(-23883), INT16_C( 17045), INT16_C(  2492), INT16_C(-19257),
+                            INT16_C( 14276), INT16_C(-28951), INT16_C( -1067), INT16_C( -5295), INT16_C(-14198), INT16_C(-19460), INT16_C( 27701), INT16_C(-22626),
+                            INT16_C( 11784), INT16_C( 26837), INT16_C(-15149), INT16_C(-15084), INT16_C(-32646), INT16_C( 11754), INT16_C(-19974), INT16_C(-22952)),
+      simde_mm512_set_epi32(INT32_C( 1777258367), INT32_C( 1177700815), INT32_C( -154916384), INT32_C( -284945413),
+                            INT32_C(-1560135961), INT32_C( 1308744444), INT32_C( -975499967), INT32_C( -436382310),
+                            INT32_C( -115231046), INT32_C( -407143739), INT32_C( 2068467418), INT32_C( -239390837),
+                            INT32_C(  989578811), INT32_C( 1216816041), INT32_C( 1386634469), INT32_C(  497356399)) },
+    { simde_mm512_set_epi32(INT32_C(-1960472685), INT32_C(-1435371959), INT32_C( 1294867953), INT32_C(  -15939301),
+                            INT32_C(  295604728), INT32_C(-1414601764), INT32_C( 1488378919), INT32_C(-1924141625),
+                            INT32_C(-1895191530), INT32_C( 1541849349), INT32_C( -911490319), INT32_C(-1229913214),
+                            INT32_C( 2017435041), INT32_C( 1522023865), INT32_C( 1632969818), INT32_C(  894937320)),
+      simde_mm512_set_epi16(INT16_C( 20577), INT16_C(  8355), INT16_C( -4062), INT16_C( 24292), INT16_C(-24955), INT16_C(-15809), INT16_C( -5707), INT16_C(-18678),
+                            INT16_C(-17723), INT16_C( -2674), INT16_C(-31293), INT16_C( 32177), INT16_C( 10308), INT16_C(  4712), INT16_C( 17550), INT16_C( 18850),
+                            INT16_C(-14892), INT16_C(-18823), INT16_C( -7033), INT16_C(  2614), INT16_C( 28552), INT16_C( 11966), INT16_C( 13833), INT16_C(-14343),
+                            INT16_C(-11896), INT16_C( 10704), INT16_C(-30886), INT16_C( 18922), INT16_C(-28430), INT16_C(  2571), INT16_C( 24667), INT16_C(-22555)),
+      simde_mm512_set_epi16(INT16_C( 13631), INT16_C(  3743), INT16_C(-10065), INT16_C( 27133), INT16_C( 20922), INT16_C(-22744), INT16_C(   671), INT16_C( -3682),
+                            INT16_C( 15877), INT16_C( 12935), INT16_C( -5185), INT16_C( 20735), INT16_C( -6796), INT16_C(-17162), INT16_C( 28855), INT16_C( -8447),
+                            INT16_C(  4509), INT16_C(-19228), INT16_C(-17930), INT16_C(  7610), INT16_C(-12971), INT16_C(  -159), INT16_C( -6099), INT16_C(  4569),
+                            INT16_C(-23403), INT16_C(-13792), INT16_C(  3906), INT16_C(-23713), INT16_C(  7336), INT16_C( 23816), INT16_C(-19909), INT16_C(  9049)),
+      simde_mm512_set_epi32(INT32_C(-1648714833), INT32_C( -735373093), INT32_C( 1132319339), INT32_C(   49003698),
+                            INT32_C(  -20371533), INT32_C( -585157464), INT32_C( 1337458407), INT32_C(-1576962325),
+                            INT32_C(-1600410914), INT32_C( 1687843579), INT32_C(-1283740905), INT32_C(-1379813848),
+                            INT32_C(-2146759735), INT32_C(  952685763), INT32_C( 1485638274), INT32_C(  199741822)) },
+    { simde_mm512_set_epi32(INT32_C( -722031811), INT32_C(-2000891372), INT32_C(   83996145), INT32_C(  133806180),
+                            INT32_C(-2079311463), INT32_C( -536531457), INT32_C(  768715128), INT32_C( -745809651),
+                            INT32_C( -971377539), INT32_C(-1789212008), INT32_C( 1368650785), INT32_C( 2046439238),
+                            INT32_C( -719877451), INT32_C(-1873904578), INT32_C(-1920503914), INT32_C( -249042834)),
+      simde_mm512_set_epi16(INT16_C(-27581), INT16_C( -8352), INT16_C( 26713), INT16_C(-32396), INT16_C( 17318), INT16_C(  5900), INT16_C(-28625), INT16_C( 17266),
+                            INT16_C( 11072), INT16_C( -4615), INT16_C( 18251), INT16_C(-28820), INT16_C( 29607), INT16_C(  9126), INT16_C(-11178), INT16_C(-20944),
+                            INT16_C(  7168), INT16_C( 16578), INT16_C(  6256), INT16_C( 17206), INT16_C( 25500), INT16_C( 15625), INT16_C( -8203), INT16_C( 30790),
+                            INT16_C( -6734), INT16_C(  1169), INT16_C( 14699), INT16_C( 30189), INT16_C( 29102), INT16_C(-19031), INT16_C(  7099), INT16_C(-20816)),
+      simde_mm512_set_epi16(INT16_C(-30561), INT16_C(-11659), INT16_C(-27168), INT16_C( -8731), INT16_C(-17439), INT16_C( 28840), INT16_C(-19926), INT16_C( 16219),
+                            INT16_C(-15635), INT16_C( 22508), INT16_C(  -159), INT16_C(-27843), INT16_C( 11457), INT16_C( 11338), INT16_C(-13349), INT16_C(-29274),
+                            INT16_C( 12576), INT16_C( 14899), INT16_C( -8530), INT16_C(  4102), INT16_C(-13781), INT16_C(-23352), INT16_C( 14301), INT16_C( 29282),
+                            INT16_C(-21237), INT16_C(  6732), INT16_C( -4658), INT16_C(-23256), INT16_C( -2577), INT16_C(-28608), INT16_C( 20523), INT16_C( -4234)),
+      simde_mm512_set_epi32(INT32_C(  218247098), INT32_C( 1851186616), INT32_C(  -47856457), INT32_C(  984225184),
+                            INT32_C( 1938670693), INT32_C(  263001894), INT32_C( 1211393115), INT32_C(   16520127),
+                            INT32_C( -634237149), INT32_C(-1771996676), INT32_C(  652360285), INT32_C(-1464246381),
+                            INT32_C( -568997785), INT32_C( 1650519392), INT32_C(-1451060920), INT32_C(  -15215113)) },
+    { simde_mm512_set_epi32(INT32_C( 1987065063), INT32_C( 1607996248), INT32_C(-1718938864), INT32_C(  947649761),
+                            INT32_C( 1410294172), INT32_C( 1097272568), INT32_C( -743360097), INT32_C( 1681417215),
+                            INT32_C( -101797574), INT32_C( -409558596), INT32_C(  -19941391), INT32_C( 1628122978),
+                            INT32_C(  704783987), INT32_C(-1243038956), INT32_C( -165349239), INT32_C(-1753430754)),
+      simde_mm512_set_epi16(INT16_C(  9777), INT16_C( 14608), INT16_C( 23366), INT16_C(-23924), INT16_C(   -58), INT16_C(-26689), INT16_C(-31006), INT16_C( -1924),
+                            INT16_C( 13473), INT16_C( -7408), INT16_C( -1261), INT16_C( 16766), INT16_C( -8898), INT16_C( 16715), INT16_C(   -57), INT16_C(   191),
+                            INT16_C( 28310), INT16_C( 21663), INT16_C(  7746), INT16_C( 29402), INT16_C( -5442), INT16_C(  5375), INT16_C(-23959), INT16_C( -6896),
+                            INT16_C(   187), INT16_C(  4292), INT16_C(-25231), INT16_C(   532), INT16_C( 32073), INT16_C(-13134), INT16_C(-28684), INT16_C( 30078)),
+      simde_mm512_set_epi16(INT16_C( 11182), INT16_C(  4066), INT16_C( 31495), INT16_C(-13205), INT16_C( 27430), INT16_C(-29697), INT16_C(-30120), INT16_C(  1250),
+                            INT16_C( -7460), INT16_C(-31604), INT16_C(-27850), INT16_C(  8226), INT16_C(-22672), INT16_C(   413), INT16_C(  9725), INT16_C(-25320),
+                            INT16_C(  8118), INT16_C( 11260), INT16_C( 13572), INT16_C(-25568), INT16_C(  3355), INT16_C(-31257), INT16_C(-11410), INT16_C( 20673),
+                            INT16_C(  -663), INT16_C(-29528), INT16_C(-21202), INT16_C( 10384), INT16_C( 10537), INT16_C( -6130), INT16_C( 26523), INT16_C(  3273)),
+      simde_mm512_set_epi32(INT32_C(-2139179691), INT32_C(-1635142458), INT32_C( -927946571), INT32_C( 1879145481),
+                            INT32_C( 1543908024), INT32_C( 1270308534), INT32_C( -534721346), INT32_C( 1676026770),
+                            INT32_C(  371948386), INT32_C(-1056180220), INT32_C( -206205676), INT32_C( 1758934160),
+                            INT32_C(  577925830), INT32_C( -702567006), INT32_C(  253115382), INT32_C( 1879196104)) },
+    { simde_mm512_set_epi32(INT32_C( 1600181137), INT32_C(-2095222284), INT32_C( 1359041292), INT32_C(  109510152),
+                            INT32_C( 1734070556), INT32_C( 1015479989), INT32_C( 1717905822), INT32_C(-1255662257),
+                            INT32_C( 1208097960), INT32_C(  593057760), INT32_C(  184698257), INT32_C(  101275212),
+                            INT32_C( 2085270494), INT32_C(  206063233), INT32_C(  595716892), INT32_C( -169232077)),
+      simde_mm512_set_epi16(INT16_C(   432), INT16_C( 22412), INT16_C(  3740), INT16_C(-25996), INT16_C(  1274), INT16_C(  6270), INT16_C(-31662), INT16_C(-17396),
+                            INT16_C(-10008), INT16_C( -7582), INT16_C( 24278), INT16_C(-25548), INT16_C( 29775), INT16_C(-25424), INT16_C(  1209), INT16_C( 25265),
+                            INT16_C( -3091), INT16_C(-13869), INT16_C(-12882), INT16_C(   887), INT16_C( 20064), INT16_C(  7567), INT16_C(  2348), INT16_C(-17790),
+                            INT16_C(  3316), INT16_C( 16648), INT16_C( 29252), INT16_C( 31931), INT16_C(-13837), INT16_C( 21702), INT16_C(-23209), INT16_C(-18921)),
+      simde_mm512_set_epi16(INT16_C(-22366), INT16_C(-32097), INT16_C( 24330), INT16_C( 23345), INT16_C( 25187), INT16_C( 21106), INT16_C(-16052), INT16_C( -2856),
+                            INT16_C(-12851), INT16_C( 17305), INT16_C( -6303), INT16_C(  8409), INT16_C( 17516), INT16_C(-23564), INT16_C( 19705), INT16_C( -6571),
+                            INT16_C( 24771), INT16_C(  4201), INT16_C( 31269), INT16_C(  3593), INT16_C(-19293), INT16_C( 28386), INT16_C( 25868), INT16_C( 10182),
+                            INT16_C( 24581), INT16_C(  5951), INT16_C( 18698), INT16_C(  -708), INT16_C(-24399), INT16_C(  4128), INT16_C( 24169), INT16_C(-16832)),
+      simde_mm512_set_epi32(INT32_C(  871161061), INT32_C( 1683862592), INT32_C( 1523464150), INT32_C(  667431552),
+                            INT32_C( 1731476854), INT32_C(  647622623), INT32_C(-1456431438), INT32_C(-1397855227),
+                            INT32_C( 1073267130), INT32_C(  193437493), INT32_C(   12400367), INT32_C(  -19124504),
+                            INT32_C(-2029113958), INT32_C(  730409981), INT32_C( 1022911711), INT32_C( -411692126)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_dpwssd_epi32(test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C(-1154234808), INT32_C(-1925649112), INT32_C( -278123065), INT32_C( 1725971036),
+                            INT32_C(-1976847734), INT32_C( 1881404218), INT32_C(-1562333327), INT32_C( 1653971724),
+                            INT32_C(-1934549282), INT32_C( 1755135092), INT32_C(-1107663351), INT32_C( 1969323278),
+                            INT32_C( -290123381), INT32_C(  214247232), INT32_C( -296133851), INT32_C(-1345674297)),
+      UINT16_C(17391),
+      simde_mm512_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm512_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm512_set_epi32(INT32_C(-1154234808), INT32_C(  221900072), INT32_C( -278123065), INT32_C( 1725971036),
+                            INT32_C(-1976847734), INT32_C( 1881404218), INT32_C(  585215857), INT32_C( -493446388),
+                            INT32_C(  212999902), INT32_C( -392283020), INT32_C( 1039885833), INT32_C( 1969323278),
+                            INT32_C( 1857425803), INT32_C(-1933170880), INT32_C( 1851415333), INT32_C(  801874887)) },
+    { simde_mm512_set_epi32(INT32_C(-1097613877), INT32_C( -911887442), INT32_C(  408629807), INT32_C( 2103879266),
+                            INT32_C( -626849059), INT32_C( 1471780495), INT32_C(  412216044), INT32_C( 1837462821),
+                            INT32_C(  488011305), INT32_C(-1360650342), INT32_C( -509954103), INT32_C(  722426607),
+                            INT32_C( -505370077), INT32_C( 1316503853), INT32_C( -636292692), INT32_C( 1771356840)),
+      UINT16_C(29335),
+      simde_mm512_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm512_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm512_set_epi32(INT32_C(-1097613877), INT32_C( 1235661742), INT32_C(-1738788305), INT32_C(  -43538846),
+                            INT32_C( -626849059), INT32_C( 1471780495), INT32_C(-1735202068), INT32_C( 1837462821),
+                            INT32_C(-1659406807), INT32_C(-1360650342), INT32_C( -509954103), INT32_C(-1424991505),
+                            INT32_C( -505370077), INT32_C( -830914259), INT32_C( 1511256492), INT32_C( -376061272)) },
+    { simde_mm512_set_epi32(INT32_C( 2112685087), INT32_C( 1324899154), INT32_C(-1246166649), INT32_C(  930147269),
+                            INT32_C(  166323962), INT32_C( 1586985077), INT32_C( -432219790), INT32_C(  845614574),
+                            INT32_C(  819337257), INT32_C(-1549166179), INT32_C(  670248420), INT32_C( 1563577413),
+                            INT32_C( -856344612), INT32_C( 1643844129), INT32_C( 1094168508), INT32_C(-1688499790)),
+      UINT16_C(30974),
+      simde_mm512_set_epi16(INT16_C( 29917), INT16_C( 15505), INT16_C(-10142), INT16_C(-31268), INT16_C( 18600), INT16_C( 21959), INT16_C( 31928), INT16_C( 31780),
+                            INT16_C(  8526), INT16_C(-32162), INT16_C(-22879), INT16_C(-17517), INT16_C( -7764), INT16_C(  5179), INT16_C(  7213), INT16_C(-30820),
+                            INT16_C(-25168), INT16_C(-13905), INT16_C(-29062), INT16_C( -6576), INT16_C( 21466), INT16_C(-19793), INT16_C(   129), INT16_C( -7918),
+                            INT16_C( 19107), INT16_C(-18878), INT16_C(-19663), INT16_C(-15334), INT16_C(-17181), INT16_C(-17879), INT16_C(-17455), INT16_C( 16228)),
+      simde_mm512_set_epi16(INT16_C( -4412), INT16_C(-12132), INT16_C( -3278), INT16_C(-15496), INT16_C( 29263), INT16_C( 23639), INT16_C( 24951), INT16_C( 15811),
+                            INT16_C( 28174), INT16_C( 29534), INT16_C(-29325), INT16_C(-19548), INT16_C(  9928), INT16_C( 13997), INT16_C( 21988), INT16_C( -7584),
+                            INT16_C( 18210), INT16_C( 16875), INT16_C( 23253), INT16_C( 16545), INT16_C(-24088), INT16_C( 20658), INT16_C(-11499), INT16_C( 17318),
+                            INT16_C( 18424), INT16_C(-19050), INT16_C(-13703), INT16_C( 28536), INT16_C( -7732), INT16_C(  -509), INT16_C( -9114), INT16_C(-18473)),
+      simde_mm512_set_epi32(INT32_C( 2112685087), INT32_C( 1842673558), INT32_C( -182786048), INT32_C(-2065710919),
+                            INT32_C( -543337022), INT32_C( 1586985077), INT32_C( -432219790), INT32_C(  845614574),
+                            INT32_C(  126381102), INT32_C( 1961222511), INT32_C( -255708382), INT32_C( 1424970118),
+                            INT32_C( -144691344), INT32_C( 1475715194), INT32_C( 1236112411), INT32_C(-1688499790)) },
+    { simde_mm512_set_epi32(INT32_C( 1075757236), INT32_C(  295336479), INT32_C(   80387096), INT32_C(  648728448),
+                            INT32_C( 1453091794), INT32_C( 1187987907), INT32_C(-1801974404), INT32_C(  419636616),
+                            INT32_C( -459728425), INT32_C(-1165545110), INT32_C(  152957003), INT32_C(-2116690027),
+                            INT32_C( 1191881436), INT32_C(  700318876), INT32_C(-1799870066), INT32_C(-1921554033)),
+      UINT16_C(26955),
+      simde_mm512_set_epi16(INT16_C(-28556), INT16_C(-11044), INT16_C(  5486), INT16_C(-20638), INT16_C(-17355), INT16_C( 23532), INT16_C( 19978), INT16_C(  -998),
+                            INT16_C(-16288), INT16_C(-26978), INT16_C( 15727), INT16_C( 26517), INT16_C( 11384), INT16_C( 17353), INT16_C(-26140), INT16_C(  3212),
+                            INT16_C(  9948), INT16_C( 31917), INT16_C( 27134), INT16_C( 25160), INT16_C(-21850), INT16_C(   615), INT16_C(-28792), INT16_C( 32566),
+                            INT16_C( 20977), INT16_C(-14629), INT16_C(-28437), INT16_C( 26553), INT16_C( 15676), INT16_C( -3382), INT16_C(   562), INT16_C( 10539)),
+      simde_mm512_set_epi16(INT16_C( -5599), INT16_C(-11424), INT16_C( 21123), INT16_C(  2329), INT16_C( 15883), INT16_C(-31331), INT16_C( 16095), INT16_C(-24666),
+                            INT16_C(  5153), INT16_C( 14788), INT16_C( 24750), INT16_C(  5057), INT16_C(-14995), INT16_C( -3044), INT16_C( -1359), INT16_C( 16834),
+                            INT16_C( 28877), INT16_C(-14617), INT16_C(  5832), INT16_C(-24643), INT16_C( 14651), INT16_C(  4643), INT16_C(-13382), INT16_C( 22605),
+                            INT16_C( 19701), INT16_C( -6335), INT16_C(-15128), INT16_C( 12905), INT16_C(  6976), INT16_C(-12582), INT16_C( -2437), INT16_C( -5444)),
+      simde_mm512_set_epi32(INT32_C( 1075757236), INT32_C(  363151355), INT32_C( -932543461), INT32_C(  648728448),
+                            INT32_C(  970209066), INT32_C( 1187987907), INT32_C(-1801974404), INT32_C(  509231684),
+                            INT32_C( -459728425), INT32_C(-1627317502), INT32_C(  152957003), INT32_C(-2116690027),
+                            INT32_C( 1697824028), INT32_C(  700318876), INT32_C(-1647961966), INT32_C(-1980297943)) },
+    { simde_mm512_set_epi32(INT32_C(-1543507484), INT32_C(-1467093419), INT32_C(  217377783), INT32_C(  842609078),
+                            INT32_C(  334783526), INT32_C( 1633244383), INT32_C( -200773903), INT32_C(-1117910517),
+                            INT32_C(  892716842), INT32_C( -745642044), INT32_C( -193334098), INT32_C(-1640850050),
+                            INT32_C( 1326842037), INT32_C( -403264789), INT32_C(-1560205427), INT32_C(  328399193)),
+      UINT16_C(18762),
+      simde_mm512_set_epi16(INT16_C( 28941), INT16_C(  3544), INT16_C(-25292), INT16_C(  4039), INT16_C(-10347), INT16_C(-18428), INT16_C(-10388), INT16_C( 15280),
+                            INT16_C(-22420), INT16_C( 31866), INT16_C(  4307), INT16_C(-32527), INT16_C(-12386), INT16_C( -8381), INT16_C( 25060), INT16_C( 30785),
+                            INT16_C( -6754), INT16_C(-29771), INT16_C( 13064), INT16_C( 20704), INT16_C( 14860), INT16_C(  5447), INT16_C(-27282), INT16_C(-26286),
+                            INT16_C( 10837), INT16_C(  9992), INT16_C(-20997), INT16_C( 11528), INT16_C(-26367), INT16_C(  7399), INT16_C( 32511), INT16_C(-16183)),
+      simde_mm512_set_epi16(INT16_C(  8038), INT16_C(-19008), INT16_C( 22986), INT16_C(-27485), INT16_C( 29470), INT16_C(  9512), INT16_C( 15779), INT16_C(-21000),
+                            INT16_C(-30735), INT16_C( 13722), INT16_C(-14728), INT16_C( 23939), INT16_C(  1080), INT16_C( -5703), INT16_C(-13327), INT16_C(-13483),
+                            INT16_C( 23359), INT16_C(-15638), INT16_C(-22971), INT16_C( -1689), INT16_C(-28096), INT16_C(  -783), INT16_C( 21765), INT16_C(  4865),
+                            INT16_C(-26231), INT16_C( -1072), INT16_C( 13994), INT16_C( 31476), INT16_C( 13714), INT16_C(-19544), INT16_C(  3269), INT16_C( 30232)),
+      simde_mm512_set_epi32(INT32_C(-1543507484), INT32_C( 2135500050), INT32_C(  217377783), INT32_C(  842609078),
+                            INT32_C( 1461127478), INT32_C( 1633244383), INT32_C( -200773903), INT32_C(-1866959292),
+                            INT32_C(  892716842), INT32_C(-1080704244), INT32_C( -193334098), INT32_C(-1640850050),
+                            INT32_C( 1031865266), INT32_C( -403264789), INT32_C(-2066408521), INT32_C(  328399193)) },
+    { simde_mm512_set_epi32(INT32_C( 1483928266), INT32_C(-2128883544), INT32_C(  158445059), INT32_C(   -1503031),
+                            INT32_C(-1177245511), INT32_C( -348369903), INT32_C(-1681524076), INT32_C( -695635145),
+                            INT32_C( 1487905843), INT32_C( 1741030257), INT32_C(  879036596), INT32_C( 1315890039),
+                            INT32_C(-1841518107), INT32_C(-2095565666), INT32_C(  820693750), INT32_C(  -75439272)),
+      UINT16_C(30724),
+      simde_mm512_set_epi16(INT16_C(-12909), INT16_C(  5195), INT16_C(  3697), INT16_C( -7400), INT16_C(-11424), INT16_C(-18615), INT16_C(  1392), INT16_C(  6635),
+                            INT16_C( 11034), INT16_C( 26111), INT16_C(-22842), INT16_C( -2942), INT16_C(-21101), INT16_C(-25074), INT16_C(  1614), INT16_C( 12386),
+                            INT16_C(-30596), INT16_C(  7777), INT16_C( 26863), INT16_C(-17705), INT16_C( 18044), INT16_C( 12835), INT16_C( 13133), INT16_C(-10010),
+                            INT16_C( -4722), INT16_C( 12062), INT16_C(  7995), INT16_C( 31443), INT16_C( -4737), INT16_C(-23459), INT16_C(-19734), INT16_C(-13047)),
+      simde_mm512_set_epi16(INT16_C(-21560), INT16_C(-11583), INT16_C( 11643), INT16_C(  5615), INT16_C( -5481), INT16_C( -3322), INT16_C(  6006), INT16_C(  1000),
+                            INT16_C( -7099), INT16_C( 22237), INT16_C(-13753), INT16_C(-31583), INT16_C( -7707), INT16_C(  9273), INT16_C(-31179), INT16_C( -9643),
+                            INT16_C(-19242), INT16_C(-16435), INT16_C(  1962), INT16_C( 11662), INT16_C( 14780), INT16_C(  2766), INT16_C( 16296), INT16_C(-21926),
+                            INT16_C(  1428), INT16_C(  9762), INT16_C(-11923), INT16_C(  9427), INT16_C( 11416), INT16_C( 12675), INT16_C(-18998), INT16_C(-14626)),
+      simde_mm512_set_epi32(INT32_C( 1483928266), INT32_C(-2127390373), INT32_C(  282899033), INT32_C(   13492321),
+                            INT32_C( -674945570), INT32_C( -348369903), INT32_C(-1681524076), INT32_C( -695635145),
+                            INT32_C( 1487905843), INT32_C( 1741030257), INT32_C(  879036596), INT32_C( 1315890039),
+                            INT32_C(-1841518107), INT32_C(-1894476890), INT32_C(  820693750), INT32_C(  -75439272)) },
+    { simde_mm512_set_epi32(INT32_C( -544813091), INT32_C(  163030321), INT32_C( -246549054), INT32_C(-1214996431),
+                            INT32_C(  968354150), INT32_C(  680102501), INT32_C(  762952133), INT32_C( 1344211446),
+                            INT32_C(   85107829), INT32_C(  315652295), INT32_C(-2129526645), INT32_C(  609625675),
+                            INT32_C( -437897949), INT32_C(   68772931), INT32_C( -382554958), INT32_C( 1260477428)),
+      UINT16_C(46913),
+      simde_mm512_set_epi16(INT16_C(  5265), INT16_C(-24378), INT16_C(-14737), INT16_C(-29186), INT16_C(  1393), INT16_C( 13096), INT16_C(  1398), INT16_C(-21974),
+                            INT16_C( 25586), INT16_C(  8371), INT16_C(-13463), INT16_C( 15507), INT16_C(  5487), INT16_C( -1902), INT16_C( 15881), INT16_C( 21365),
+                            INT16_C(-17143), INT16_C( -8684), INT16_C(  4090), INT16_C(  3117), INT16_C( 15739), INT16_C(  4902), INT16_C( -4229), INT16_C( 24208),
+                            INT16_C(-13604), INT16_C(-16108), INT16_C( 20624), INT16_C( 29623), INT16_C( 11805), INT16_C(-15903), INT16_C( 26269), INT16_C(-22981)),
+      simde_mm512_set_epi16(INT16_C( 25322), INT16_C(-19175), INT16_C( -8125), INT16_C(   450), INT16_C(-12270), INT16_C(-18734), INT16_C(-21473), INT16_C( 27351),
+                            INT16_C( 22336), INT16_C( 25645), INT16_C( 20491), INT16_C(-28728), INT16_C( 18151), INT16_C( 13981), INT16_C(  9496), INT16_C(-18650),
+                            INT16_C( -8666), INT16_C(-15069), INT16_C(   749), INT16_C(-22869), INT16_C(-15851), INT16_C( 17021), INT16_C( 28593), INT16_C(-19008),
+                            INT16_C( 26465), INT16_C(-28882), INT16_C( 28074), INT16_C(    -1), INT16_C( -2754), INT16_C( 10628), INT16_C( -1163), INT16_C( -4763)),
+      simde_mm512_set_epi32(INT32_C(   55955389), INT32_C(  163030321), INT32_C( -508981628), INT32_C(-1846026559),
+                            INT32_C(  968354150), INT32_C(  -41252928), INT32_C(  835954808), INT32_C( 1096560172),
+                            INT32_C(   85107829), INT32_C(  247433032), INT32_C(-2129526645), INT32_C(  609625675),
+                            INT32_C( -437897949), INT32_C(   68772931), INT32_C( -382554958), INT32_C( 1339385084)) },
+    { simde_mm512_set_epi32(INT32_C( -349771524), INT32_C(-1494092077), INT32_C(-2000881506), INT32_C( -999469299),
+                            INT32_C(  165203235), INT32_C(-1043498181), INT32_C(  767230611), INT32_C(-1858178600),
+                            INT32_C(  488108966), INT32_C(-1823227816), INT32_C( 1873205459), INT32_C(-1354345602),
+                            INT32_C( 1739912560), INT32_C( 1499413703), INT32_C(-1548915442), INT32_C(   70890607)),
+      UINT16_C(49352),
+      simde_mm512_set_epi16(INT16_C( -9054), INT16_C(-28928), INT16_C( -2687), INT16_C(-26128), INT16_C( 24909), INT16_C( -8465), INT16_C( -5287), INT16_C(  9530),
+                            INT16_C(-13412), INT16_C(-26535), INT16_C( 23642), INT16_C(-13331), INT16_C( -8472), INT16_C( 21346), INT16_C(-24154), INT16_C( 14147),
+                            INT16_C(-16537), INT16_C( -9710), INT16_C( -7709), INT16_C(-24771), INT16_C( 32016), INT16_C( 18173), INT16_C( -7860), INT16_C(-20002),
+                            INT16_C( -2280), INT16_C( 28196), INT16_C(-22929), INT16_C(-19971), INT16_C( 11232), INT16_C(-19219), INT16_C( 24295), INT16_C(-15874)),
+      simde_mm512_set_epi16(INT16_C( 11469), INT16_C(-28226), INT16_C(-24939), INT16_C( -3605), INT16_C( -4944), INT16_C(-16438), INT16_C( 14358), INT16_C(-23453),
+                            INT16_C(  5674), INT16_C( 14191), INT16_C( 13630), INT16_C(-24223), INT16_C(  2973), INT16_C( 28345), INT16_C(  5563), INT16_C( -2936),
+                            INT16_C( 22171), INT16_C(-27496), INT16_C(-27683), INT16_C( 18456), INT16_C( 18881), INT16_C(-13827), INT16_C( 13056), INT16_C( 21745),
+                            INT16_C( -6238), INT16_C(-17521), INT16_C(  2076), INT16_C( 24526), INT16_C(-23169), INT16_C( 23286), INT16_C( 27316), INT16_C( -6461)),
+      simde_mm512_set_epi32(INT32_C(  362909878), INT32_C(-1332889544), INT32_C(-2000881506), INT32_C( -999469299),
+                            INT32_C(  165203235), INT32_C(-1043498181), INT32_C(  767230611), INT32_C(-1858178600),
+                            INT32_C(  388453299), INT32_C(-2066993145), INT32_C( 1873205459), INT32_C(-1354345602),
+                            INT32_C( 1260113084), INT32_C( 1499413703), INT32_C(-1548915442), INT32_C(   70890607)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_dpwssd_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_dpwssd_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i src;
+    simde__m512i a;
+    simde__m512i b;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(44953),
+      simde_mm512_set_epi32(INT32_C( 1889548477), INT32_C( -462760903), INT32_C(  226092311), INT32_C(-1649107582),
+                            INT32_C(-1721883770), INT32_C(-1327928681), INT32_C(  901506361), INT32_C(-1483559921),
+                            INT32_C(  365470090), INT32_C( 1137365928), INT32_C(-1096033098), INT32_C( 1902445293),
+                            INT32_C( -186055720), INT32_C(-1852206325), INT32_C(-1374938752), INT32_C( 1802502473)),
+      simde_mm512_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm512_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm512_set_epi32(INT32_C( -257869635), INT32_C(          0), INT32_C(-1921325801), INT32_C(          0),
+                            INT32_C(  425665414), INT32_C(  819620503), INT32_C(-1245911751), INT32_C(  663989263),
+                            INT32_C(-1781948022), INT32_C(          0), INT32_C(          0), INT32_C( -244972819),
+                            INT32_C( 1961493464), INT32_C(          0), INT32_C(          0), INT32_C( -344915639)) },
+    { UINT16_C(64006),
+      simde_mm512_set_epi32(INT32_C( 2079339061), INT32_C( 1130800070), INT32_C(-1557825432), INT32_C(-1695050134),
+                            INT32_C(-2059372171), INT32_C(-2041950283), INT32_C( -655990960), INT32_C( 1712511553),
+                            INT32_C( 1006666478), INT32_C(  284233761), INT32_C( 1626656911), INT32_C( -895325968),
+                            INT32_C( 1557105584), INT32_C( -192058393), INT32_C(-1559551691), INT32_C(-1182961530)),
+      simde_mm512_set_epi16(INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767),
+                            INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767), INT16_C( 32767)),
+      simde_mm512_set_epi16(INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768),
+                            INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768)),
+      simde_mm512_set_epi32(INT32_C(  -68079051), INT32_C(-1016618042), INT32_C(  589723752), INT32_C(  452499050),
+                            INT32_C(   88177013), INT32_C(          0), INT32_C( 1491558224), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C( 1955490791), INT32_C(  587997493), INT32_C(          0)) },
+    { UINT16_C(21669),
+      simde_mm512_set_epi32(INT32_C(-1053013651), INT32_C(  610605092), INT32_C( 1265778996), INT32_C( 1284546660),
+                            INT32_C( 1938575416), INT32_C( -115467881), INT32_C(-2031361763), INT32_C(-1352386521),
+                            INT32_C(-1191442526), INT32_C( 1134658401), INT32_C( -589038436), INT32_C(-1995079647),
+                            INT32_C(  345546986), INT32_C(  680692146), INT32_C(-1315941494), INT32_C(  893034610)),
+      simde_mm512_set_epi16(INT16_C( 20566), INT16_C(-13419), INT16_C( 22281), INT16_C(-15002), INT16_C( 21311), INT16_C(  4531), INT16_C(-25785), INT16_C(-32093),
+                            INT16_C(-24019), INT16_C( 21279), INT16_C(  7793), INT16_C(  4163), INT16_C( 13118), INT16_C( 26729), INT16_C(    71), INT16_C( -5545),
+                            INT16_C( 13516), INT16_C( 12077), INT16_C( -4720), INT16_C( 13693), INT16_C(-19266), INT16_C(  7028), INT16_C( -9115), INT16_C( 24323),
+                            INT16_C( 27371), INT16_C(  2354), INT16_C( 24659), INT16_C(-28510), INT16_C(-11019), INT16_C( 18148), INT16_C( -3513), INT16_C( 23316)),
+      simde_mm512_set_epi16(INT16_C( 21125), INT16_C(-14958), INT16_C( 17228), INT16_C( 26153), INT16_C( 21405), INT16_C(-17302), INT16_C( 12672), INT16_C( 22343),
+                            INT16_C(-19593), INT16_C(  9536), INT16_C(-13710), INT16_C( 17344), INT16_C(-12696), INT16_C(  3655), INT16_C(-30485), INT16_C(-30898),
+                            INT16_C( -3655), INT16_C(-10068), INT16_C(  5509), INT16_C( 21606), INT16_C(  4501), INT16_C( 10694), INT16_C(-32675), INT16_C( 15059),
+                            INT16_C(-17487), INT16_C( 31584), INT16_C(  7435), INT16_C( 20722), INT16_C( -9381), INT16_C( 10050), INT16_C(  6562), INT16_C( 20332)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(  602114854), INT32_C(          0), INT32_C(  240745241),
+                            INT32_C(          0), INT32_C( -150106839), INT32_C(          0), INT32_C(          0),
+                            INT32_C(-1362434742), INT32_C(          0), INT32_C( -600597270), INT32_C(          0),
+                            INT32_C(          0), INT32_C(  273247591), INT32_C(          0), INT32_C( 1344043216)) },
+    { UINT16_C(12758),
+      simde_mm512_set_epi32(INT32_C( 1656199620), INT32_C( -284803905), INT32_C( 1898696487), INT32_C(  573278128),
+                            INT32_C( 2088318010), INT32_C( -356511019), INT32_C( 1529058982), INT32_C(-1778078909),
+                            INT32_C( 1581864482), INT32_C( -590124656), INT32_C(-1689601894), INT32_C(  357815287),
+                            INT32_C( 1456189471), INT32_C( -349865850), INT32_C(-1257283816), INT32_C(  526869836)),
+      simde_mm512_set_epi16(INT16_C(  4359), INT16_C(-30191), INT16_C( -4647), INT16_C( -9031), INT16_C(-24185), INT16_C(-19178), INT16_C( -7140), INT16_C(-11683),
+                            INT16_C(-17037), INT16_C(-20834), INT16_C(-11929), INT16_C(-21435), INT16_C( 30237), INT16_C(-31922), INT16_C(-19193), INT16_C(   513),
+                            INT16_C(-25639), INT16_C( 28979), INT16_C( 29257), INT16_C(-16835), INT16_C(-14492), INT16_C( 13493), INT16_C( -6261), INT16_C(  1462),
+                            INT16_C( -5449), INT16_C(-18184), INT16_C( 10206), INT16_C( 26488), INT16_C(-23308), INT16_C( -9299), INT16_C(-24884), INT16_C(  -250)),
+      simde_mm512_set_epi16(INT16_C( 24442), INT16_C( -3764), INT16_C( 13290), INT16_C( 16361), INT16_C(-11726), INT16_C( -3771), INT16_C( 26129), INT16_C(  9571),
+                            INT16_C( 17774), INT16_C( 15482), INT16_C(-19921), INT16_C(   742), INT16_C( -8471), INT16_C( -5688), INT16_C( -9082), INT16_C( -9392),
+                            INT16_C( 25942), INT16_C(  4067), INT16_C( 13735), INT16_C(-32688), INT16_C(-21136), INT16_C(  5390), INT16_C(-25741), INT16_C( 31977),
+                            INT16_C(-15930), INT16_C( 25002), INT16_C(-17324), INT16_C( -2686), INT16_C(-26610), INT16_C( 15105), INT16_C( 16738), INT16_C( 24896)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(-2040357261), INT32_C(  274899075),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(-1608586179),
+                            INT32_C( 1034595137), INT32_C(  362022719), INT32_C(          0), INT32_C(  565730062),
+                            INT32_C(          0), INT32_C( -597821362), INT32_C( -777519331), INT32_C(          0)) },
+    { UINT16_C(20975),
+      simde_mm512_set_epi32(INT32_C( 1340607553), INT32_C( 2082475976), INT32_C(-1965386237), INT32_C( 1190979527),
+                            INT32_C(-1684485029), INT32_C( 2144709012), INT32_C(-1543459366), INT32_C( 2113193496),
+                            INT32_C( 1771211299), INT32_C( 1304211012), INT32_C( 2091527923), INT32_C( 1908916219),
+                            INT32_C(  346056905), INT32_C( 1187726641), INT32_C( 1468862384), INT32_C( 1092952629)),
+      simde_mm512_set_epi16(INT16_C(-23925), INT16_C( -7334), INT16_C( -3333), INT16_C(-21377), INT16_C( -5999), INT16_C( 10519), INT16_C(-12484), INT16_C( 11621),
+                            INT16_C(-15455), INT16_C( 30960), INT16_C( 10141), INT16_C(-21903), INT16_C(-10047), INT16_C( 13329), INT16_C( 24947), INT16_C( 24752),
+                            INT16_C( 30450), INT16_C( 12782), INT16_C(-12171), INT16_C(-31430), INT16_C(-23338), INT16_C(-14297), INT16_C( 19534), INT16_C( 23054),
+                            INT16_C( 22092), INT16_C(  4526), INT16_C(-10792), INT16_C( 12652), INT16_C(-30215), INT16_C(  3527), INT16_C(-29556), INT16_C(-16937)),
+      simde_mm512_set_epi16(INT16_C(   827), INT16_C(-19701), INT16_C( 18049), INT16_C(-20084), INT16_C(-13999), INT16_C( -8197), INT16_C(-11192), INT16_C(-23927),
+                            INT16_C( 23899), INT16_C( 30598), INT16_C( -4894), INT16_C( 18310), INT16_C( 23451), INT16_C( 12413), INT16_C( 18607), INT16_C(-11996),
+                            INT16_C(-24311), INT16_C(-31066), INT16_C(-12975), INT16_C( -3455), INT16_C( 28779), INT16_C( -5168), INT16_C( -3632), INT16_C( 25542),
+                            INT16_C( -8339), INT16_C(  2384), INT16_C(   342), INT16_C(  5230), INT16_C( 10146), INT16_C( 25738), INT16_C(-14924), INT16_C(-23321)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(-1843312969), INT32_C(          0), INT32_C( 1052644788),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(-2014509963),
+                            INT32_C(  633855737), INT32_C( 1570720387), INT32_C( 1493770517), INT32_C(          0),
+                            INT32_C(  172621701), INT32_C( 1250205737), INT32_C( 1253078920), INT32_C( 1929034150)) },
+    { UINT16_C(32527),
+      simde_mm512_set_epi32(INT32_C(-1941163053), INT32_C( 1602816251), INT32_C(-1049061814), INT32_C( -671642073),
+                            INT32_C( -986169935), INT32_C(   93736380), INT32_C( 2139479920), INT32_C( 1167260232),
+                            INT32_C(   32515234), INT32_C(-1981796393), INT32_C(  328733110), INT32_C(  555672925),
+                            INT32_C(  986000610), INT32_C( -945284059), INT32_C(  140291960), INT32_C( -642394996)),
+      simde_mm512_set_epi16(INT16_C( 24681), INT16_C( -6758), INT16_C( 16181), INT16_C(-28221), INT16_C( 22308), INT16_C( 30783), INT16_C(  8108), INT16_C(-20381),
+                            INT16_C( 25209), INT16_C(-15890), INT16_C( 30927), INT16_C( 17451), INT16_C(-13417), INT16_C( 16515), INT16_C( 28692), INT16_C(  7005),
+                            INT16_C(  4722), INT16_C(  6102), INT16_C( 23950), INT16_C(-24162), INT16_C(-17417), INT16_C( -7321), INT16_C(  -145), INT16_C(-20926),
+                            INT16_C( 15622), INT16_C( 29617), INT16_C(-17333), INT16_C( 28706), INT16_C( 25350), INT16_C( 16452), INT16_C(-19905), INT16_C( 17450)),
+      simde_mm512_set_epi16(INT16_C( -4099), INT16_C(-30021), INT16_C( 18244), INT16_C(  6334), INT16_C( 13536), INT16_C(-18820), INT16_C( 30259), INT16_C(-24450),
+                            INT16_C( 16958), INT16_C(   228), INT16_C( -3629), INT16_C(-12194), INT16_C( 26507), INT16_C(  3705), INT16_C(  8373), INT16_C( 30258),
+                            INT16_C(   610), INT16_C( 22140), INT16_C(-11780), INT16_C( -8759), INT16_C( -2873), INT16_C(-24758), INT16_C(   682), INT16_C(-19601),
+                            INT16_C( -8196), INT16_C(  9816), INT16_C(  -959), INT16_C(-12812), INT16_C( 29203), INT16_C(  -233), INT16_C(-24489), INT16_C( -5600)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C( 1719270601), INT32_C(-1326436786), INT32_C(   72013349),
+                            INT32_C( -562298633), INT32_C( -231295197), INT32_C( 1845023576), INT32_C( 1619455638),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C( 1148683170), INT32_C(-1296442984), INT32_C(  876754694), INT32_C( -252661451)) },
+    { UINT16_C(10416),
+      simde_mm512_set_epi32(INT32_C( 1983494890), INT32_C(-1896548619), INT32_C(  -61630769), INT32_C( -163259379),
+                            INT32_C( 1340421127), INT32_C(-1347414618), INT32_C( 1566787724), INT32_C(-2044926293),
+                            INT32_C( -508557049), INT32_C(-1224111489), INT32_C(-1099557005), INT32_C( 1262358242),
+                            INT32_C(  538924945), INT32_C(-1095548963), INT32_C( 1832860063), INT32_C(-1407003087)),
+      simde_mm512_set_epi16(INT16_C(  8937), INT16_C( 14560), INT16_C(-13006), INT16_C(  8390), INT16_C(-19002), INT16_C(-22875), INT16_C(  6549), INT16_C(-11424),
+                            INT16_C( -6905), INT16_C(  1723), INT16_C( -3547), INT16_C(-24673), INT16_C( 24645), INT16_C( -4351), INT16_C(-16102), INT16_C( 18574),
+                            INT16_C( 15686), INT16_C(  5936), INT16_C(-16099), INT16_C(-16463), INT16_C( 12790), INT16_C(-10291), INT16_C(  5959), INT16_C(  5788),
+                            INT16_C(-27529), INT16_C(  6218), INT16_C( 15920), INT16_C( -8100), INT16_C(  1058), INT16_C(-11530), INT16_C( 31930), INT16_C(   600)),
+      simde_mm512_set_epi16(INT16_C( 27397), INT16_C( 19548), INT16_C(-12531), INT16_C( 11110), INT16_C( 11661), INT16_C(-16140), INT16_C(-13116), INT16_C( 27710),
+                            INT16_C(  7695), INT16_C(  2976), INT16_C(-24354), INT16_C(  5396), INT16_C( 30682), INT16_C(-22456), INT16_C(-29773), INT16_C( -6818),
+                            INT16_C(-28147), INT16_C(-30210), INT16_C( 14759), INT16_C( 26638), INT16_C( -1714), INT16_C( -3872), INT16_C( 31923), INT16_C(-14306),
+                            INT16_C( -2094), INT16_C( -7776), INT16_C( 11453), INT16_C( 31149), INT16_C(-27658), INT16_C(-15499), INT16_C( 28214), INT16_C(-19193)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(   85989409), INT32_C(          0),
+                            INT32_C( 1292414800), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(-1129397451), INT32_C(          0), INT32_C(-1081632313), INT32_C( 1369784271),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(11159),
+      simde_mm512_set_epi32(INT32_C(-1802236749), INT32_C(-1033862217), INT32_C( -778417391), INT32_C( -358786938),
+                            INT32_C( -334615284), INT32_C( 1942886901), INT32_C( -557627055), INT32_C(-1219229468),
+                            INT32_C( 2092259409), INT32_C(  376196728), INT32_C(-1458407973), INT32_C( 1415808435),
+                            INT32_C( 1771748015), INT32_C( 2125375484), INT32_C( 1281139601), INT32_C(  885567201)),
+      simde_mm512_set_epi16(INT16_C( 32133), INT16_C(-22980), INT16_C(  -853), INT16_C( -5485), INT16_C( -2581), INT16_C(  6249), INT16_C(  2532), INT16_C( 23397),
+                            INT16_C(-28715), INT16_C(-20175), INT16_C(-32718), INT16_C(-31250), INT16_C( 22524), INT16_C(-23624), INT16_C(-28232), INT16_C( 11257),
+                            INT16_C( 31531), INT16_C(-27410), INT16_C(-17879), INT16_C( 23053), INT16_C(  5699), INT16_C( -6803), INT16_C(-30098), INT16_C(  9729),
+                            INT16_C(  9039), INT16_C( 16240), INT16_C(-23403), INT16_C( 14318), INT16_C( -2812), INT16_C( 11122), INT16_C(-19630), INT16_C( 20336)),
+      simde_mm512_set_epi16(INT16_C(-18064), INT16_C( 20161), INT16_C(  4611), INT16_C(-12662), INT16_C(-17739), INT16_C(  4427), INT16_C(-13399), INT16_C(-13601),
+                            INT16_C(-14039), INT16_C( 17596), INT16_C(-23605), INT16_C(-19528), INT16_C(-18649), INT16_C( 10734), INT16_C(-29015), INT16_C( -5201),
+                            INT16_C(-27864), INT16_C(-30646), INT16_C(-28731), INT16_C(-28085), INT16_C( 15496), INT16_C(-28368), INT16_C(-26921), INT16_C( 19420),
+                            INT16_C( 11025), INT16_C(-31842), INT16_C(-22799), INT16_C( 13557), INT16_C(-19611), INT16_C(  6190), INT16_C(  8694), INT16_C( 31110)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C( -704968709), INT32_C(          0),
+                            INT32_C( -286484699), INT32_C(          0), INT32_C(-1231257147), INT32_C( -458625645),
+                            INT32_C( 2053686485), INT32_C(          0), INT32_C(          0), INT32_C(-1879953423),
+                            INT32_C(          0), INT32_C(-1441917689), INT32_C( 1405130913), INT32_C( 1347556941)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_dpwssd_epi32(test_vec[i].k, test_vec[i].src, test_vec[i].a, test_vec[i].b);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_AVX512VNNI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_AVX512VNNI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_maskz_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_mask_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm_maskz_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_maskz_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_mask_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm256_maskz_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_dpbusd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_dpwssd_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_dpwssd_epi32),
+#endif /* defined(SIMDE_AVX512VNNI_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
@@ -0,0 +1,661 @@
+/* Copyright (c) 2020 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX avx512vpopcntdq
+#include <simde/x86/avx512vpopcntdq.h>
+#include <test/x86/test-avx512.h>
+
+#if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_mm512_popcnt_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C( -643139282), INT32_C(  452227306), INT32_C(-1697455804), INT32_C( -689376561),
+                            INT32_C(-1760551474), INT32_C( 1316748153), INT32_C(  753604320), INT32_C(-1580905748),
+                            INT32_C(  811533580), INT32_C(  915262580), INT32_C( 2064109201), INT32_C( -443522762),
+                            INT32_C( 1693511353), INT32_C(   40788086), INT32_C( -602179666), INT32_C(  200494509)),
+      simde_mm512_set_epi32(INT32_C(         18), INT32_C(         16), INT32_C(         14), INT32_C(         20),
+                            INT32_C(         15), INT32_C(         22), INT32_C(         15), INT32_C(         15),
+                            INT32_C(         12), INT32_C(         16), INT32_C(         17), INT32_C(         14),
+                            INT32_C(         18), INT32_C(         13), INT32_C(         20), INT32_C(         18)) },
+    { simde_mm512_set_epi32(INT32_C( -982101895), INT32_C(  -60996609), INT32_C(-1188980248), INT32_C( 1062866975),
+                            INT32_C(  236962971), INT32_C( -700743522), INT32_C( 1438415352), INT32_C(-1381559811),
+                            INT32_C(  783123783), INT32_C( 1456938755), INT32_C(  150238463), INT32_C(-1192711403),
+                            INT32_C(-1886475821), INT32_C( 1229098382), INT32_C( -576041339), INT32_C(-1328094581)),
+      simde_mm512_set_epi32(INT32_C(         16), INT32_C(         22), INT32_C(         15), INT32_C(         16),
+                            INT32_C(         16), INT32_C(         16), INT32_C(         19), INT32_C(         19),
+                            INT32_C(         16), INT32_C(         17), INT32_C(         18), INT32_C(         16),
+                            INT32_C(         18), INT32_C(         13), INT32_C(         17), INT32_C(         16)) },
+    { simde_mm512_set_epi32(INT32_C(-2136071904), INT32_C(-2107280930), INT32_C(  253382869), INT32_C(-1677024742),
+                            INT32_C(-1128555650), INT32_C(-1708025105), INT32_C( 1414205127), INT32_C( 1828741485),
+                            INT32_C(-1829032497), INT32_C( -928081383), INT32_C(  -61457999), INT32_C( 1802586959),
+                            INT32_C(-1557210433), INT32_C( 1434828149), INT32_C(  893189176), INT32_C( 2113595064)),
+      simde_mm512_set_epi32(INT32_C(          9), INT32_C(         16), INT32_C(         14), INT32_C(         12),
+                            INT32_C(         22), INT32_C(         18), INT32_C(         15), INT32_C(         13),
+                            INT32_C(         20), INT32_C(         15), INT32_C(         18), INT32_C(         18),
+                            INT32_C(         20), INT32_C(         18), INT32_C(         17), INT32_C(         21)) },
+    { simde_mm512_set_epi32(INT32_C( -860327903), INT32_C(  882440181), INT32_C( 1819373086), INT32_C( 1827504439),
+                            INT32_C( 1536331308), INT32_C(-1736604291), INT32_C(  914479743), INT32_C( 1771243565),
+                            INT32_C( 1829258434), INT32_C( 1776773439), INT32_C( -595151917), INT32_C( -843188717),
+                            INT32_C(  218726888), INT32_C(-1040548892), INT32_C(  236899586), INT32_C( -310637379)),
+      simde_mm512_set_epi32(INT32_C(         13), INT32_C(         19), INT32_C(         17), INT32_C(         17),
+                            INT32_C(         15), INT32_C(         18), INT32_C(         18), INT32_C(         13),
+                            INT32_C(         11), INT32_C(         20), INT32_C(         18), INT32_C(         20),
+                            INT32_C(         11), INT32_C(         19), INT32_C(         13), INT32_C(         19)) },
+    { simde_mm512_set_epi32(INT32_C(-1077149697), INT32_C(  213696288), INT32_C( 1504091041), INT32_C(  650979763),
+                            INT32_C(-1908819939), INT32_C( -417628919), INT32_C( 2059898803), INT32_C( 1946140662),
+                            INT32_C(  905119152), INT32_C(-1057189294), INT32_C( -953463754), INT32_C( -790921235),
+                            INT32_C(-1329950236), INT32_C( 2137129196), INT32_C(-1626885510), INT32_C( 2022087514)),
+      simde_mm512_set_epi32(INT32_C(         28), INT32_C(         15), INT32_C(         16), INT32_C(         16),
+                            INT32_C(         16), INT32_C(         18), INT32_C(         20), INT32_C(         26),
+                            INT32_C(         15), INT32_C(         14), INT32_C(         16), INT32_C(         22),
+                            INT32_C(         15), INT32_C(         15), INT32_C(         18), INT32_C(         16)) },
+    { simde_mm512_set_epi32(INT32_C( -417696409), INT32_C( -306657675), INT32_C( 1863267348), INT32_C( -998466547),
+                            INT32_C(-1137026239), INT32_C(-1706840110), INT32_C(  214470315), INT32_C(  798676155),
+                            INT32_C(  396946568), INT32_C( -522581076), INT32_C(  850989385), INT32_C(-1810388295),
+                            INT32_C( 1462375917), INT32_C( 1219755458), INT32_C(  756867720), INT32_C( 1456606814)),
+      simde_mm512_set_epi32(INT32_C(         19), INT32_C(         19), INT32_C(         15), INT32_C(         15),
+                            INT32_C(         16), INT32_C(         17), INT32_C(         14), INT32_C(         19),
+                            INT32_C(         14), INT32_C(         15), INT32_C(         13), INT32_C(         16),
+                            INT32_C(         17), INT32_C(         17), INT32_C(         13), INT32_C(         16)) },
+    { simde_mm512_set_epi32(INT32_C( 1176600336), INT32_C( 1320353830), INT32_C(-1207314546), INT32_C(  707762960),
+                            INT32_C(  775573235), INT32_C( 1232027922), INT32_C( -206347287), INT32_C(  942234150),
+                            INT32_C( 1325029422), INT32_C( -534126631), INT32_C( 1468969518), INT32_C(  514171743),
+                            INT32_C( -478837891), INT32_C(-1472144916), INT32_C( 1667714296), INT32_C( 1106152121)),
+      simde_mm512_set_epi32(INT32_C(         13), INT32_C(         12), INT32_C(         16), INT32_C(         14),
+                            INT32_C(         18), INT32_C(         13), INT32_C(         20), INT32_C(         13),
+                            INT32_C(         17), INT32_C(         18), INT32_C(         17), INT32_C(         18),
+                            INT32_C(         19), INT32_C(         14), INT32_C(         17), INT32_C(         16)) },
+    { simde_mm512_set_epi32(INT32_C( 1167779544), INT32_C(  787528517), INT32_C(-1874083107), INT32_C(-1595160297),
+                            INT32_C( 1542202793), INT32_C(-2035650616), INT32_C( 1007306157), INT32_C( 1828812259),
+                            INT32_C( -318111509), INT32_C(  808145606), INT32_C(-1076877509), INT32_C(  279368879),
+                            INT32_C( 1245373083), INT32_C(  720423801), INT32_C(-1991789058), INT32_C(  -39407706)),
+      simde_mm512_set_epi32(INT32_C(         16), INT32_C(         17), INT32_C(         15), INT32_C(         16),
+                            INT32_C(         17), INT32_C(         16), INT32_C(         14), INT32_C(         16),
+                            INT32_C(         14), INT32_C(         13), INT32_C(         19), INT32_C(         15),
+                            INT32_C(         16), INT32_C(         17), INT32_C(         19), INT32_C(         21)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_popcnt_epi32(test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_popcnt_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi32(INT32_C( -175412641), INT32_C(-1669829207), INT32_C( 1459836715), INT32_C(  -75474339),
+                            INT32_C( 1704267013), INT32_C( 2028997070), INT32_C(-1725278956), INT32_C(  -85453911),
+                            INT32_C(-1280330124), INT32_C( -765201407), INT32_C( 1413158076), INT32_C( 2044862398),
+                            INT32_C( 1896920870), INT32_C(  841321957), INT32_C( -655160554), INT32_C( 1661807475)),
+      UINT16_C(41706),
+      simde_mm512_set_epi32(INT32_C(  681697849), INT32_C(  864152880), INT32_C(  561206663), INT32_C(  411498334),
+                            INT32_C( -881538512), INT32_C(-1277785780), INT32_C(  370568310), INT32_C(-1387953777),
+                            INT32_C( 1218051857), INT32_C(-1023961501), INT32_C( 1305091415), INT32_C(  -16518784),
+                            INT32_C( 1357560946), INT32_C(-2015605220), INT32_C(-1472759490), INT32_C(-1635068110)),
+      simde_mm512_set_epi32(INT32_C(         13), INT32_C(-1669829207), INT32_C(         15), INT32_C(  -75474339),
+                            INT32_C( 1704267013), INT32_C( 2028997070), INT32_C(         15), INT32_C(  -85453911),
+                            INT32_C(         16), INT32_C(         18), INT32_C(         17), INT32_C( 2044862398),
+                            INT32_C(         16), INT32_C(  841321957), INT32_C(         18), INT32_C( 1661807475)) },
+    { simde_mm512_set_epi32(INT32_C(-1261322423), INT32_C(-2037398346), INT32_C( -259512978), INT32_C( 1907784004),
+                            INT32_C(-1328006956), INT32_C( -195667787), INT32_C( 1801845352), INT32_C( -938295179),
+                            INT32_C( 1336382549), INT32_C(  763135994), INT32_C(  708720192), INT32_C( 1542467110),
+                            INT32_C( -117637098), INT32_C(  890946529), INT32_C(-1094424435), INT32_C(  901220143)),
+      UINT16_C(33855),
+      simde_mm512_set_epi32(INT32_C( 2022062013), INT32_C(-1157340613), INT32_C(-1756633785), INT32_C( 1342506162),
+                            INT32_C( -508113857), INT32_C( -829794532), INT32_C( 1001785887), INT32_C( 1682522906),
+                            INT32_C( -119865526), INT32_C(-1209940974), INT32_C(-1090372257), INT32_C( 1908674316),
+                            INT32_C(-1696659652), INT32_C(-1478340846), INT32_C( 2133877581), INT32_C(  597374655)),
+      simde_mm512_set_epi32(INT32_C(         18), INT32_C(-2037398346), INT32_C( -259512978), INT32_C( 1907784004),
+                            INT32_C(-1328006956), INT32_C(         16), INT32_C( 1801845352), INT32_C( -938295179),
+                            INT32_C( 1336382549), INT32_C(  763135994), INT32_C(         19), INT32_C(         13),
+                            INT32_C(         18), INT32_C(         16), INT32_C(         17), INT32_C(         19)) },
+    { simde_mm512_set_epi32(INT32_C(  388507969), INT32_C( 2002506031), INT32_C(-1816915627), INT32_C( 2065570649),
+                            INT32_C( 2092421280), INT32_C( -374061356), INT32_C( 1122533290), INT32_C( -340156203),
+                            INT32_C(-1478127128), INT32_C( 1518602503), INT32_C(  276674928), INT32_C( -165755317),
+                            INT32_C(-1420224600), INT32_C(  521122478), INT32_C( -166405056), INT32_C(  936496375)),
+      UINT16_C(54612),
+      simde_mm512_set_epi32(INT32_C( 1211071351), INT32_C( -206295093), INT32_C(-1302470581), INT32_C( 1399161859),
+                            INT32_C(  727294224), INT32_C(  117313698), INT32_C(  -66038934), INT32_C(  959725469),
+                            INT32_C( 1078464897), INT32_C( -179365013), INT32_C(-1813516132), INT32_C( 1989762512),
+                            INT32_C(-1664691314), INT32_C(-1152531561), INT32_C(  493794668), INT32_C(-1006711475)),
+      simde_mm512_set_epi32(INT32_C(         19), INT32_C(         20), INT32_C(-1816915627), INT32_C(         12),
+                            INT32_C( 2092421280), INT32_C(         13), INT32_C( 1122533290), INT32_C(         18),
+                            INT32_C(-1478127128), INT32_C(         20), INT32_C(  276674928), INT32_C(         17),
+                            INT32_C(-1420224600), INT32_C(         19), INT32_C( -166405056), INT32_C(  936496375)) },
+    { simde_mm512_set_epi32(INT32_C( 1039435359), INT32_C(  101636577), INT32_C(  492295946), INT32_C(-1100206404),
+                            INT32_C(  259096810), INT32_C( 1120810641), INT32_C( 1204796884), INT32_C( 1147590074),
+                            INT32_C(-1168516161), INT32_C(  562994125), INT32_C(  553887471), INT32_C( 1870383641),
+                            INT32_C(   23334141), INT32_C( 1585315929), INT32_C(-1138820172), INT32_C( -795470850)),
+      UINT16_C(34982),
+      simde_mm512_set_epi32(INT32_C( 2142195024), INT32_C(-1204148630), INT32_C( 1754460751), INT32_C(  120915107),
+                            INT32_C(-1192730098), INT32_C(  -18698689), INT32_C( 1061044925), INT32_C(-1289916956),
+                            INT32_C(-1794350731), INT32_C(-1099098995), INT32_C(-1580376810), INT32_C( 1818653225),
+                            INT32_C( 1757584418), INT32_C( -420707926), INT32_C(-1664951998), INT32_C( -659776494)),
+      simde_mm512_set_epi32(INT32_C(         19), INT32_C(  101636577), INT32_C(  492295946), INT32_C(-1100206404),
+                            INT32_C(         14), INT32_C( 1120810641), INT32_C( 1204796884), INT32_C( 1147590074),
+                            INT32_C(         14), INT32_C(  562994125), INT32_C(         16), INT32_C( 1870383641),
+                            INT32_C(   23334141), INT32_C(         16), INT32_C(         14), INT32_C( -795470850)) },
+    { simde_mm512_set_epi32(INT32_C(  142435075), INT32_C(-1820731503), INT32_C(-1722469897), INT32_C( -287550859),
+                            INT32_C(-2138400139), INT32_C(-1112821675), INT32_C( 1683828174), INT32_C(  593341314),
+                            INT32_C( -927384064), INT32_C( 1217975076), INT32_C(-1725122996), INT32_C(  -34096745),
+                            INT32_C(-2093325382), INT32_C(-1859046337), INT32_C( 1949737002), INT32_C(-1222712265)),
+      UINT16_C(46113),
+      simde_mm512_set_epi32(INT32_C(-1538804544), INT32_C( 1997779461), INT32_C( -186932261), INT32_C(-2072911676),
+                            INT32_C(    2436908), INT32_C(  850661734), INT32_C(-1923835978), INT32_C( -404548465),
+                            INT32_C( -697666380), INT32_C(  956107164), INT32_C( 1396051986), INT32_C( -572709038),
+                            INT32_C( -368663452), INT32_C(  906982974), INT32_C( -204879105), INT32_C(-1339760514)),
+      simde_mm512_set_epi32(INT32_C(         13), INT32_C(-1820731503), INT32_C(         21), INT32_C(         12),
+                            INT32_C(-2138400139), INT32_C(         13), INT32_C( 1683828174), INT32_C(  593341314),
+                            INT32_C( -927384064), INT32_C( 1217975076), INT32_C(         11), INT32_C(  -34096745),
+                            INT32_C(-2093325382), INT32_C(-1859046337), INT32_C( 1949737002), INT32_C(         14)) },
+    { simde_mm512_set_epi32(INT32_C( 1922825706), INT32_C( 1400239819), INT32_C( 1772149792), INT32_C(-1393328974),
+                            INT32_C(-1379837054), INT32_C( 1966294267), INT32_C(  557730295), INT32_C( 1439280743),
+                            INT32_C(   70557352), INT32_C(  856508916), INT32_C(-1190652810), INT32_C(  898161031),
+                            INT32_C(-1730113454), INT32_C( -444253121), INT32_C( 2084409410), INT32_C(-2093827319)),
+      UINT16_C( 9083),
+      simde_mm512_set_epi32(INT32_C( 1000906737), INT32_C(  896966842), INT32_C(-1158973434), INT32_C( -979444480),
+                            INT32_C(  484264281), INT32_C(  363699191), INT32_C( -682721014), INT32_C(-1685953679),
+                            INT32_C(  765747691), INT32_C( 1100314947), INT32_C( 1090722759), INT32_C( 1599454394),
+                            INT32_C( 1267016334), INT32_C( -407797255), INT32_C( -118803964), INT32_C( 2075906022)),
+      simde_mm512_set_epi32(INT32_C( 1922825706), INT32_C( 1400239819), INT32_C(         17), INT32_C(-1393328974),
+                            INT32_C(-1379837054), INT32_C( 1966294267), INT32_C(         14), INT32_C(         15),
+                            INT32_C(   70557352), INT32_C(         14), INT32_C(         13), INT32_C(         20),
+                            INT32_C(         13), INT32_C( -444253121), INT32_C(         15), INT32_C(         23)) },
+    { simde_mm512_set_epi32(INT32_C( -240345815), INT32_C(  253578989), INT32_C(-1518263542), INT32_C( -621858168),
+                            INT32_C(   68731457), INT32_C(  -92617212), INT32_C(-1256757340), INT32_C( 1989635737),
+                            INT32_C( 1838008169), INT32_C(-1289220281), INT32_C( 1867633132), INT32_C(-1442647453),
+                            INT32_C( 1773993562), INT32_C( -338749230), INT32_C( -944646287), INT32_C(  280508413)),
+      UINT16_C(38264),
+      simde_mm512_set_epi32(INT32_C(-1096918642), INT32_C(-1075164499), INT32_C( 1649287681), INT32_C(-1770971817),
+                            INT32_C( 1759503925), INT32_C( 2026143656), INT32_C( 1608458855), INT32_C( 1732185394),
+                            INT32_C(-1552783737), INT32_C( -613704956), INT32_C( 1923434259), INT32_C(-1447531363),
+                            INT32_C( 1439390184), INT32_C(-1688765970), INT32_C( 1034668201), INT32_C( -303206608)),
+      simde_mm512_set_epi32(INT32_C(         19), INT32_C(  253578989), INT32_C(-1518263542), INT32_C(         17),
+                            INT32_C(   68731457), INT32_C(         17), INT32_C(-1256757340), INT32_C(         17),
+                            INT32_C( 1838008169), INT32_C(         17), INT32_C(         15), INT32_C(         17),
+                            INT32_C(         17), INT32_C( -338749230), INT32_C( -944646287), INT32_C(  280508413)) },
+    { simde_mm512_set_epi32(INT32_C(-1275761090), INT32_C(-2084280137), INT32_C(-1239115140), INT32_C(  963006805),
+                            INT32_C(  292022929), INT32_C( 1741251740), INT32_C( -754621479), INT32_C( 1105804961),
+                            INT32_C(-1153243982), INT32_C(-1160594149), INT32_C(  799733737), INT32_C( -398481643),
+                            INT32_C( 1525683060), INT32_C(-1378046514), INT32_C( 1868453992), INT32_C(  159092306)),
+      UINT16_C(52452),
+      simde_mm512_set_epi32(INT32_C( 1234060941), INT32_C(-1151863869), INT32_C(-1597983751), INT32_C(-1631784091),
+                            INT32_C(  510772902), INT32_C( 2097171708), INT32_C(  493940074), INT32_C( -895313078),
+                            INT32_C( 2100449563), INT32_C(  865136597), INT32_C( 1507964546), INT32_C( -506735047),
+                            INT32_C( -466144896), INT32_C(-1850375555), INT32_C(-1468277084), INT32_C( -645714522)),
+      simde_mm512_set_epi32(INT32_C(         14), INT32_C(         21), INT32_C(-1239115140), INT32_C(  963006805),
+                            INT32_C(         16), INT32_C(         15), INT32_C( -754621479), INT32_C( 1105804961),
+                            INT32_C(         16), INT32_C(         18), INT32_C(         15), INT32_C( -398481643),
+                            INT32_C( 1525683060), INT32_C(         16), INT32_C( 1868453992), INT32_C(  159092306)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_popcnt_epi32(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_popcnt_epi32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask16 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT16_C(50656),
+      simde_mm512_set_epi32(INT32_C(   32132210), INT32_C(-1751324689), INT32_C(-1057896394), INT32_C( -685681466),
+                            INT32_C( -461735891), INT32_C(-1767843657), INT32_C(-2005920783), INT32_C(-1062124163),
+                            INT32_C(-1775727413), INT32_C( 1126869609), INT32_C(  277744522), INT32_C(-1336071055),
+                            INT32_C( 1742610316), INT32_C( -744609695), INT32_C(  381295929), INT32_C( -228807043)),
+      simde_mm512_set_epi32(INT32_C(         13), INT32_C(         22), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         16), INT32_C(          0), INT32_C(         15),
+                            INT32_C(         14), INT32_C(         14), INT32_C(         11), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(45700),
+      simde_mm512_set_epi32(INT32_C(-1610831184), INT32_C(  232979379), INT32_C(-2000338852), INT32_C(  319591515),
+                            INT32_C(-1291148647), INT32_C(  901932115), INT32_C( 1820555627), INT32_C( -376097931),
+                            INT32_C( 1769364703), INT32_C(   26915409), INT32_C(-1384165660), INT32_C(  -12315591),
+                            INT32_C(  295430499), INT32_C(  933657359), INT32_C(  254171282), INT32_C( -735456661)),
+      simde_mm512_set_epi32(INT32_C(         19), INT32_C(          0), INT32_C(         11), INT32_C(         13),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         17), INT32_C(          0),
+                            INT32_C(         20), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         19), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(56371),
+      simde_mm512_set_epi32(INT32_C( -138822813), INT32_C(  544425083), INT32_C( 1800028983), INT32_C(-2118012583),
+                            INT32_C(-1038806538), INT32_C(  470858670), INT32_C( -486705808), INT32_C(-1494962574),
+                            INT32_C(  619063768), INT32_C(-1761929085), INT32_C( -571366399), INT32_C(  156236534),
+                            INT32_C(-1194918994), INT32_C(   83151712), INT32_C(  888774134), INT32_C( 1687806177)),
+      simde_mm512_set_epi32(INT32_C(         22), INT32_C(         14), INT32_C(          0), INT32_C(         13),
+                            INT32_C(         14), INT32_C(         15), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         15), INT32_C(         19),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         20), INT32_C(         14)) },
+    { UINT16_C(22096),
+      simde_mm512_set_epi32(INT32_C(-1182461465), INT32_C(-1642173690), INT32_C( 1619976157), INT32_C(-1505352561),
+                            INT32_C(-2043730440), INT32_C(  649901095), INT32_C(  456615529), INT32_C( 1466468534),
+                            INT32_C(  482252461), INT32_C( 1437145602), INT32_C(  419264010), INT32_C( -583588020),
+                            INT32_C( -192774909), INT32_C( 1139369157), INT32_C(  565196734), INT32_C(-1917278389)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(         16), INT32_C(          0), INT32_C(         14),
+                            INT32_C(          0), INT32_C(         16), INT32_C(         17), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         12), INT32_C(          0), INT32_C(         18),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { UINT16_C(33425),
+      simde_mm512_set_epi32(INT32_C( -381612380), INT32_C(-1311761561), INT32_C(  388494373), INT32_C(-1853227429),
+                            INT32_C(   27415867), INT32_C(-1991375083), INT32_C(-1856949295), INT32_C( -238211019),
+                            INT32_C(-1614186965), INT32_C( -181678932), INT32_C(-1300525716), INT32_C( 2100040966),
+                            INT32_C( 1873597219), INT32_C(  190738329), INT32_C(-1629471668), INT32_C(-1489947908)),
+      simde_mm512_set_epi32(INT32_C(         13), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(          0), INT32_C(          0), INT32_C(         14), INT32_C(          0),
+                            INT32_C(         19), INT32_C(          0), INT32_C(          0), INT32_C(         14),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         17)) },
+    { UINT16_C(48075),
+      simde_mm512_set_epi32(INT32_C( 1802654453), INT32_C(  112172028), INT32_C( -727254085), INT32_C( 1178367955),
+                            INT32_C(  677209965), INT32_C( 1938229696), INT32_C( 2088818366), INT32_C(  -25433129),
+                            INT32_C(-2144881907), INT32_C( -799555989), INT32_C(-1900097176), INT32_C( -404028627),
+                            INT32_C(  320718601), INT32_C( 1721888055), INT32_C(-1071810688), INT32_C(-1628114476)),
+      simde_mm512_set_epi32(INT32_C(         18), INT32_C(          0), INT32_C(         21), INT32_C(         18),
+                            INT32_C(         17), INT32_C(          0), INT32_C(         17), INT32_C(         25),
+                            INT32_C(         13), INT32_C(         19), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         14), INT32_C(          0), INT32_C(         13), INT32_C(         19)) },
+    { UINT16_C(22286),
+      simde_mm512_set_epi32(INT32_C( 1096755503), INT32_C(-1605887745), INT32_C( 2094615901), INT32_C(  370014033),
+                            INT32_C(  476628462), INT32_C(-1644044497), INT32_C(  799132212), INT32_C(  261428358),
+                            INT32_C( 1235436136), INT32_C( -825469205), INT32_C( -396538321), INT32_C( -657539497),
+                            INT32_C(-1646539622), INT32_C( -622860392), INT32_C(-1091606325), INT32_C(  482701948)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(         14), INT32_C(          0), INT32_C(         16),
+                            INT32_C(          0), INT32_C(         18), INT32_C(         15), INT32_C(         13),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         19), INT32_C(         21), INT32_C(         21), INT32_C(          0)) },
+    { UINT16_C( 9482),
+      simde_mm512_set_epi32(INT32_C(  469087178), INT32_C(-1236994974), INT32_C(-1446675115), INT32_C( 1642554341),
+                            INT32_C(-1073196489), INT32_C( -217589290), INT32_C(  762469300), INT32_C(  185533329),
+                            INT32_C(-1106727032), INT32_C( -130068046), INT32_C(  753208414), INT32_C( 1196135381),
+                            INT32_C(  307570492), INT32_C( 2139370684), INT32_C(-2113655116), INT32_C(  158944800)),
+      simde_mm512_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(         18), INT32_C(          0),
+                            INT32_C(          0), INT32_C(         19), INT32_C(          0), INT32_C(         12),
+                            INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+                            INT32_C(         14), INT32_C(          0), INT32_C(         11), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_popcnt_epi32(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_popcnt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(-7288333423961791775), INT64_C( -309057794400327246),
+                            INT64_C(-5367804493971094539), INT64_C(-1671794301749539795),
+                            INT64_C( 6931995533606621106), INT64_C(    9602711424301376),
+                            INT64_C( 9147678315102150075), INT64_C(-7978069934948729408)),
+      simde_mm512_set_epi64(INT64_C(                  33), INT64_C(                  35),
+                            INT64_C(                  30), INT64_C(                  32),
+                            INT64_C(                  33), INT64_C(                  27),
+                            INT64_C(                  37), INT64_C(                  28)) },
+    { simde_mm512_set_epi64(INT64_C(-4732571238672477673), INT64_C(-5177066338741915704),
+                            INT64_C(-4231601852268436722), INT64_C( 4531684089155200643),
+                            INT64_C( 9170955479971133745), INT64_C(-2344845543533127841),
+                            INT64_C( -826162789327320565), INT64_C( 2507875677552932836)),
+      simde_mm512_set_epi64(INT64_C(                  30), INT64_C(                  34),
+                            INT64_C(                  27), INT64_C(                  31),
+                            INT64_C(                  36), INT64_C(                  41),
+                            INT64_C(                  36), INT64_C(                  31)) },
+    { simde_mm512_set_epi64(INT64_C(-5295535715326870318), INT64_C( 4646087005003052344),
+                            INT64_C( 1405044094930830142), INT64_C( 4744070943756298604),
+                            INT64_C(-4905745028418511215), INT64_C( 5758242880388733799),
+                            INT64_C(-6864780959574419179), INT64_C( 8751231558578033523)),
+      simde_mm512_set_epi64(INT64_C(                  30), INT64_C(                  31),
+                            INT64_C(                  34), INT64_C(                  33),
+                            INT64_C(                  39), INT64_C(                  37),
+                            INT64_C(                  31), INT64_C(                  36)) },
+    { simde_mm512_set_epi64(INT64_C( 1476001784164161552), INT64_C(  879376620549823786),
+                            INT64_C(-8199956091720637342), INT64_C( 5057050358263554791),
+                            INT64_C(-2070125754102189946), INT64_C(  430836878764728455),
+                            INT64_C(-3464087190252157365), INT64_C(-7628987142057865173)),
+      simde_mm512_set_epi64(INT64_C(                  31), INT64_C(                  28),
+                            INT64_C(                  31), INT64_C(                  30),
+                            INT64_C(                  32), INT64_C(                  33),
+                            INT64_C(                  31), INT64_C(                  27)) },
+    { simde_mm512_set_epi64(INT64_C( -225043788414269302), INT64_C( 8236365660482902074),
+                            INT64_C( 6143810121771450619), INT64_C(-1791590210883548180),
+                            INT64_C(-2907710058124360096), INT64_C( 9190847051231782637),
+                            INT64_C( 3774575057465434066), INT64_C(-6379227382712665824)),
+      simde_mm512_set_epi64(INT64_C(                  34), INT64_C(                  32),
+                            INT64_C(                  27), INT64_C(                  31),
+                            INT64_C(                  35), INT64_C(                  38),
+                            INT64_C(                  30), INT64_C(                  39)) },
+    { simde_mm512_set_epi64(INT64_C(-9110279019589791579), INT64_C(-4829751861087859853),
+                            INT64_C(-8630931107852006428), INT64_C( 8132113902977136329),
+                            INT64_C( 7891716944754939620), INT64_C( 6912198386859085957),
+                            INT64_C( 4747664289883985068), INT64_C( 1436692551967243163)),
+      simde_mm512_set_epi64(INT64_C(                  18), INT64_C(                  36),
+                            INT64_C(                  31), INT64_C(                  33),
+                            INT64_C(                  29), INT64_C(                  36),
+                            INT64_C(                  31), INT64_C(                  33)) },
+    { simde_mm512_set_epi64(INT64_C( 2176889479483023314), INT64_C( 6855991253581517168),
+                            INT64_C( 3644639932378016034), INT64_C(-8977654388173996647),
+                            INT64_C( 7045463126033232945), INT64_C(-6375935900526172127),
+                            INT64_C( 2830585831547427671), INT64_C(-5918614511573415484)),
+      simde_mm512_set_epi64(INT64_C(                  40), INT64_C(                  34),
+                            INT64_C(                  29), INT64_C(                  34),
+                            INT64_C(                  29), INT64_C(                  22),
+                            INT64_C(                  29), INT64_C(                  37)) },
+    { simde_mm512_set_epi64(INT64_C( -854807751015605136), INT64_C( -746759262228409965),
+                            INT64_C( 9166476850667143830), INT64_C(-4733581015713299172),
+                            INT64_C(  712052346078183331), INT64_C(-5491892134335012384),
+                            INT64_C(-7786472637241692160), INT64_C(-2674440466335869203)),
+      simde_mm512_set_epi64(INT64_C(                  30), INT64_C(                  30),
+                            INT64_C(                  35), INT64_C(                  30),
+                            INT64_C(                  35), INT64_C(                  30),
+                            INT64_C(                  26), INT64_C(                  37)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_popcnt_epi64(test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_mask_popcnt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m512i src;
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { simde_mm512_set_epi64(INT64_C(  889180076552785722), INT64_C( 2198561971890402140),
+                            INT64_C(-5457057678294327647), INT64_C(-4483361379504801584),
+                            INT64_C( 7736579102957358475), INT64_C(-1338200035479713384),
+                            INT64_C( 9056197090970199443), INT64_C( 2012137770580782536)),
+      UINT8_C(140),
+      simde_mm512_set_epi64(INT64_C( 5457987328228919582), INT64_C( 7821676187730010081),
+                            INT64_C( 4134371490601429942), INT64_C(-6129990193701602939),
+                            INT64_C(-1001569579996546511), INT64_C(-4706403999679972668),
+                            INT64_C( 3148940969722609797), INT64_C(-7248294751762607964)),
+      simde_mm512_set_epi64(INT64_C(                  35), INT64_C( 2198561971890402140),
+                            INT64_C(-5457057678294327647), INT64_C(-4483361379504801584),
+                            INT64_C(                  34), INT64_C(                  42),
+                            INT64_C( 9056197090970199443), INT64_C( 2012137770580782536)) },
+    { simde_mm512_set_epi64(INT64_C(-7261312382272618965), INT64_C(-3024269276622204853),
+                            INT64_C( 8242914979358306728), INT64_C(-4796859731327496652),
+                            INT64_C(-5668228858010233828), INT64_C(-4739865616213999774),
+                            INT64_C(-5381359710966394947), INT64_C( 8535590536914952253)),
+      UINT8_C(140),
+      simde_mm512_set_epi64(INT64_C( 7767207904390752413), INT64_C( 1937590278418485881),
+                            INT64_C(-8796076128607053041), INT64_C(-3307989580699284076),
+                            INT64_C(-7936225666799144013), INT64_C(-4000954458658091346),
+                            INT64_C(-9209627139841895164), INT64_C( 2247876496901056919)),
+      simde_mm512_set_epi64(INT64_C(                  34), INT64_C(-3024269276622204853),
+                            INT64_C( 8242914979358306728), INT64_C(-4796859731327496652),
+                            INT64_C(                  35), INT64_C(                  31),
+                            INT64_C(-5381359710966394947), INT64_C( 8535590536914952253)) },
+    { simde_mm512_set_epi64(INT64_C( 7385366319332729822), INT64_C(-4843429005308816963),
+                            INT64_C( 8283963487170402131), INT64_C(-3100997863285565960),
+                            INT64_C(-8849598050029755586), INT64_C(-6013777606792012093),
+                            INT64_C( -100802460438048026), INT64_C(-8214249170850555753)),
+      UINT8_C(252),
+      simde_mm512_set_epi64(INT64_C( 4480548078511817086), INT64_C( 3573838754716883595),
+                            INT64_C(-8132360976864733593), INT64_C(-6600412787198372404),
+                            INT64_C(-3588294373105548728), INT64_C( 1919828715714404214),
+                            INT64_C(-8110873367702319191), INT64_C(-2762654071259596775)),
+      simde_mm512_set_epi64(INT64_C(                  31), INT64_C(                  31),
+                            INT64_C(                  31), INT64_C(                  28),
+                            INT64_C(                  30), INT64_C(                  30),
+                            INT64_C( -100802460438048026), INT64_C(-8214249170850555753)) },
+    { simde_mm512_set_epi64(INT64_C( 5863421146830579045), INT64_C( 2073898741564255154),
+                            INT64_C(-4025978339338489709), INT64_C(-2144389931332636430),
+                            INT64_C(-1255226132690863933), INT64_C(  962232385493234858),
+                            INT64_C(-5301457162249538740), INT64_C(-3444299667945052729)),
+      UINT8_C( 76),
+      simde_mm512_set_epi64(INT64_C( 4604080845346024468), INT64_C( -806164023656338557),
+                            INT64_C(-4108705738392781249), INT64_C( 5079938799446766806),
+                            INT64_C( 6480800308471795274), INT64_C( -666844568995493733),
+                            INT64_C(-1813276862708656783), INT64_C(  189292016092376943)),
+      simde_mm512_set_epi64(INT64_C( 5863421146830579045), INT64_C(                  38),
+                            INT64_C(-4025978339338489709), INT64_C(-2144389931332636430),
+                            INT64_C(                  31), INT64_C(                  31),
+                            INT64_C(-5301457162249538740), INT64_C(-3444299667945052729)) },
+    { simde_mm512_set_epi64(INT64_C(-3485568862086117542), INT64_C(-7832449582858529613),
+                            INT64_C(-6943954502239329999), INT64_C(-6723888778211873235),
+                            INT64_C(-1487366618357332891), INT64_C(-1866388517730351051),
+                            INT64_C(   74964700429526002), INT64_C(-7766716479263901440)),
+      UINT8_C(162),
+      simde_mm512_set_epi64(INT64_C( 8060589976001416766), INT64_C(-4679088878700109190),
+                            INT64_C( 7497266293879887765), INT64_C( 5725703854413982467),
+                            INT64_C( -312274009147830951), INT64_C( -809265046921475638),
+                            INT64_C(-4538804093109633744), INT64_C(-9196010256546844076)),
+      simde_mm512_set_epi64(INT64_C(                  39), INT64_C(-7832449582858529613),
+                            INT64_C(                  32), INT64_C(-6723888778211873235),
+                            INT64_C(-1487366618357332891), INT64_C(-1866388517730351051),
+                            INT64_C(                  30), INT64_C(-7766716479263901440)) },
+    { simde_mm512_set_epi64(INT64_C( 3298376316496511379), INT64_C( 4765063802056680920),
+                            INT64_C( 2339157800759693497), INT64_C(-2007256659340208055),
+                            INT64_C(-7284121203177877463), INT64_C( 7278845659845897214),
+                            INT64_C(-3135551058987049087), INT64_C( -498422449176463569)),
+      UINT8_C(111),
+      simde_mm512_set_epi64(INT64_C( 1990592467756316036), INT64_C( 8968607220636741732),
+                            INT64_C(-5379657155895881337), INT64_C( 4456855734736824788),
+                            INT64_C(-7535281620638846666), INT64_C(-6053518052264587734),
+                            INT64_C(-8697827083076938750), INT64_C( 8696539145768839504)),
+      simde_mm512_set_epi64(INT64_C( 3298376316496511379), INT64_C(                  35),
+                            INT64_C(                  30), INT64_C(-2007256659340208055),
+                            INT64_C(                  32), INT64_C(                  36),
+                            INT64_C(                  30), INT64_C(                  28)) },
+    { simde_mm512_set_epi64(INT64_C(-8565545125438424066), INT64_C( 5320870925303214364),
+                            INT64_C(-8079231625836970585), INT64_C(-2397236091499934085),
+                            INT64_C(-1640244313276070861), INT64_C( 1798384234994059879),
+                            INT64_C(-3404272919780183739), INT64_C(-8254380419223315395)),
+      UINT8_C( 95),
+      simde_mm512_set_epi64(INT64_C(-2080306490378030469), INT64_C( 3755237670565505448),
+                            INT64_C(-2441912077357076811), INT64_C(-6359017257833730070),
+                            INT64_C( 6518092978640980606), INT64_C(  922405927433275059),
+                            INT64_C( 8751577981128469222), INT64_C(-3647880300544944247)),
+      simde_mm512_set_epi64(INT64_C(-8565545125438424066), INT64_C(                  29),
+                            INT64_C(-8079231625836970585), INT64_C(                  40),
+                            INT64_C(                  35), INT64_C(                  28),
+                            INT64_C(                  37), INT64_C(                  30)) },
+    { simde_mm512_set_epi64(INT64_C( 4060808542073466316), INT64_C(  594377753888651324),
+                            INT64_C( 3032397619470430873), INT64_C( 5991319970358661499),
+                            INT64_C(-3130455195099959904), INT64_C( -519072335503472076),
+                            INT64_C( 7534695489961728512), INT64_C(-2229798861375388471)),
+      UINT8_C(235),
+      simde_mm512_set_epi64(INT64_C( 4254993846454607574), INT64_C( 3980014334667734570),
+                            INT64_C( 6489726280072564532), INT64_C(-9065011158968566135),
+                            INT64_C(-3096006614234542186), INT64_C( 5542602519133069906),
+                            INT64_C(-4010096425841996210), INT64_C(-8983432186283455337)),
+      simde_mm512_set_epi64(INT64_C(                  31), INT64_C(                  37),
+                            INT64_C(                  30), INT64_C( 5991319970358661499),
+                            INT64_C(                  27), INT64_C( -519072335503472076),
+                            INT64_C(                  31), INT64_C(                  27)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_mask_popcnt_epi64(test_vec[i].src, test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm512_maskz_popcnt_epi64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__mmask8 k;
+    simde__m512i a;
+    simde__m512i r;
+  } test_vec[8] = {
+    { UINT8_C(230),
+      simde_mm512_set_epi64(INT64_C( 4603051397870175915), INT64_C(-7080207166553230579),
+                            INT64_C(-7265845838905190557), INT64_C(-4444195492493581983),
+                            INT64_C(-4517590758958676244), INT64_C(  484490613682661436),
+                            INT64_C(   23528682309633777), INT64_C( 8722602427363789540)),
+      simde_mm512_set_epi64(INT64_C(                  38), INT64_C(                  33),
+                            INT64_C(                  33), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  28),
+                            INT64_C(                  30), INT64_C(                   0)) },
+    { UINT8_C( 72),
+      simde_mm512_set_epi64(INT64_C( 5075201517037232652), INT64_C(-8709647293414076461),
+                            INT64_C(-5985617421980789256), INT64_C(-5357149589802887596),
+                            INT64_C( 6555204717462245001), INT64_C( 8929053835442627843),
+                            INT64_C( 6891260506693934266), INT64_C( 2483034658618415061)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                  34),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  34), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(201),
+      simde_mm512_set_epi64(INT64_C( 7150424887188914959), INT64_C( 8059893330161584000),
+                            INT64_C( 1134891739177427589), INT64_C(-8975557519021451147),
+                            INT64_C(-5467641752564153092), INT64_C(-2610502677052497352),
+                            INT64_C( 6602471854353357824), INT64_C( 2719659204379495190)),
+      simde_mm512_set_epi64(INT64_C(                  27), INT64_C(                  36),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  33), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  30)) },
+    { UINT8_C( 12),
+      simde_mm512_set_epi64(INT64_C( 2404955611679263256), INT64_C(-3855949257792542648),
+                            INT64_C(-2240317085834797968), INT64_C(-4680359382453759146),
+                            INT64_C( -981615002818571408), INT64_C(-8364049321755023135),
+                            INT64_C( 3362602693005503609), INT64_C( -309692503555023680)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  29), INT64_C(                  37),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C( 39),
+      simde_mm512_set_epi64(INT64_C(-4979723433412155083), INT64_C( 1139519084200329333),
+                            INT64_C( 7703271948707648208), INT64_C( 3426990335489102775),
+                            INT64_C( 7983828423435595307), INT64_C( 1285981205478012955),
+                            INT64_C(-3775485887518674369), INT64_C(-7459062243014727950)),
+      simde_mm512_set_epi64(INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  30), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  30),
+                            INT64_C(                  39), INT64_C(                  31)) },
+    { UINT8_C(214),
+      simde_mm512_set_epi64(INT64_C(-7206707091964373317), INT64_C( 6067785967493621303),
+                            INT64_C( 1261466310423840633), INT64_C( 4513366553546731930),
+                            INT64_C( 3745176362817332125), INT64_C(-1994481497069634332),
+                            INT64_C(-8232674851141485089), INT64_C(-8495878624044681359)),
+      simde_mm512_set_epi64(INT64_C(                  35), INT64_C(                  31),
+                            INT64_C(                   0), INT64_C(                  33),
+                            INT64_C(                   0), INT64_C(                  28),
+                            INT64_C(                  43), INT64_C(                   0)) },
+    { UINT8_C(144),
+      simde_mm512_set_epi64(INT64_C( 3139003983779076386), INT64_C( 4809158286205224171),
+                            INT64_C(-2293907326220826565), INT64_C( 5618539287497657959),
+                            INT64_C( 7209233897452570870), INT64_C( 3343618016309551605),
+                            INT64_C( 4840918069054741708), INT64_C(-2093892793090790187)),
+      simde_mm512_set_epi64(INT64_C(                  36), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                  41),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0)) },
+    { UINT8_C(140),
+      simde_mm512_set_epi64(INT64_C(-6536187118365539639), INT64_C( 8551471703489721504),
+                            INT64_C(-1062049741342651852), INT64_C(-2401927244818731416),
+                            INT64_C( 6199043707102282413), INT64_C(-3643070471518897956),
+                            INT64_C(-7924080893401005923), INT64_C(-3076777195824900237)),
+      simde_mm512_set_epi64(INT64_C(                  27), INT64_C(                   0),
+                            INT64_C(                   0), INT64_C(                   0),
+                            INT64_C(                  33), INT64_C(                  36),
+                            INT64_C(                   0), INT64_C(                   0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m512i r = simde_mm512_maskz_popcnt_epi64(test_vec[i].k, test_vec[i].a);
+    simde_assert_m512i_i64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_AVX512VPOPCNTDQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_AVX512VPOPCNTDQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm512_popcnt_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_popcnt_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_popcnt_epi32),
+  SIMDE_TESTS_DEFINE_TEST(mm512_popcnt_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_mask_popcnt_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm512_maskz_popcnt_epi64),
+#endif /* defined(SIMDE_AVX512VPOPCNTDQ_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
@@ -0,0 +1,137 @@
+/* Copyright (c) 2017 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX clmul
+#include <test/x86/test-x86-internal.h>
+#include <simde/x86/clmul.h>
+
+#if defined(SIMDE_CLMUL_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+
+static MunitResult
+test_simde_mm_clmulepi64_si128(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i r00;
+    simde__m128i r01;
+    simde__m128i r10;
+    simde__m128i r11;
+  } test_vec[8] = {
+    { simde_mm_set_epi64x(INT64_C( 7273575876580499574), INT64_C(-2586341971585708627)),
+      simde_mm_set_epi64x(INT64_C( 3485510186621062260), INT64_C( 8865281517519135030)),
+      simde_mm_set_epi64x(INT64_C( 2793000610273977711), INT64_C( 1805433624094674846)),
+      simde_mm_set_epi64x(INT64_C( 1181817820812081763), INT64_C(-3403743871541412204)),
+      simde_mm_set_epi64x(INT64_C( 1620427078684350519), INT64_C(-2289161826831421820)),
+      simde_mm_set_epi64x(INT64_C(  778129505120659794), INT64_C( 8691253587079167480)) },
+    { simde_mm_set_epi64x(INT64_C(-7561511002437846151), INT64_C( 3236705911238380268)),
+      simde_mm_set_epi64x(INT64_C(-2762262182510694166), INT64_C(-7290517160979795249)),
+      simde_mm_set_epi64x(INT64_C( 1556684543658416238), INT64_C(-3136795403927882012)),
+      simde_mm_set_epi64x(INT64_C( 5118834488527884275), INT64_C(-6514387095155647641)),
+      simde_mm_set_epi64x(INT64_C( 2222692743407307215), INT64_C(  174518909985493560)),
+      simde_mm_set_epi64x(INT64_C( 7155760743918272678), INT64_C( 3247250831711850714)) },
+    { simde_mm_set_epi64x(INT64_C(-8102351954660651634), INT64_C(-2474078709182176629)),
+      simde_mm_set_epi64x(INT64_C( 3363491038161739523), INT64_C(  645269288288561941)),
+      simde_mm_set_epi64x(INT64_C(  477899139630621053), INT64_C( 3190514590571848983)),
+      simde_mm_set_epi64x(INT64_C(  289178271365886772), INT64_C(  435319374180270422)),
+      simde_mm_set_epi64x(INT64_C( 2298433913371471102), INT64_C(-4698252613275386211)),
+      simde_mm_set_epi64x(INT64_C( 1656262079619623959), INT64_C( 7133850148028394642)) },
+    { simde_mm_set_epi64x(INT64_C( 1017748214402220190), INT64_C( 6177946897817735677)),
+      simde_mm_set_epi64x(INT64_C(-4218095516130655233), INT64_C(-5106631279687102433)),
+      simde_mm_set_epi64x(INT64_C( 2864540686004299644), INT64_C( 4317994295570281931)),
+      simde_mm_set_epi64x(INT64_C(  455651937899355829), INT64_C( -535303706730336566)),
+      simde_mm_set_epi64x(INT64_C( 4515142228437083063), INT64_C( 8624197202932014251)),
+      simde_mm_set_epi64x(INT64_C(  341413119524719173), INT64_C(-7393711177583896694)) },
+    { simde_mm_set_epi64x(INT64_C(-6688167881290171019), INT64_C( 3836218302174783160)),
+      simde_mm_set_epi64x(INT64_C(-7855634754569332199), INT64_C( -263960093980013745)),
+      simde_mm_set_epi64x(INT64_C( 1393480675368107550), INT64_C(-3420994586502094104)),
+      simde_mm_set_epi64x(INT64_C( 6971300285334485575), INT64_C( -622229036618288221)),
+      simde_mm_set_epi64x(INT64_C( 1852136601919168760), INT64_C( 6283232329936439544)),
+      simde_mm_set_epi64x(INT64_C( 6521275508107982521), INT64_C(-9072123925559176307)) },
+    { simde_mm_set_epi64x(INT64_C(-4847109605879080209), INT64_C( 6073964772129268077)),
+      simde_mm_set_epi64x(INT64_C(-9174358967396765218), INT64_C( 1088271138339594778)),
+      simde_mm_set_epi64x(INT64_C(  218696495266180982), INT64_C(-3395331638846151326)),
+      simde_mm_set_epi64x(INT64_C(  494707201628021477), INT64_C(-2667852936795655594)),
+      simde_mm_set_epi64x(INT64_C( 3028242699348570529), INT64_C(-1275362914188596714)),
+      simde_mm_set_epi64x(INT64_C( 6778619443509240404), INT64_C(-3451884858589391702)) },
+    { simde_mm_set_epi64x(INT64_C(  939424833970273252), INT64_C( 1017475978290269373)),
+      simde_mm_set_epi64x(INT64_C( 7856605151738947903), INT64_C(-2556158016214927853)),
+      simde_mm_set_epi64x(INT64_C(  299095023669242088), INT64_C( 6719708235245543447)),
+      simde_mm_set_epi64x(INT64_C(  381961039801088842), INT64_C(-1840133129093993876)),
+      simde_mm_set_epi64x(INT64_C(  144830131795889931), INT64_C(-1784403442339959893)),
+      simde_mm_set_epi64x(INT64_C(  194315529035600647), INT64_C(-2076931123199264164)) },
+    { simde_mm_set_epi64x(INT64_C( 6598492726239266173), INT64_C( 3927660590810728493)),
+      simde_mm_set_epi64x(INT64_C(-3695080206338820107), INT64_C( 7814147905420099895)),
+      simde_mm_set_epi64x(INT64_C(  726874813700014143), INT64_C(-6728137467173072205)),
+      simde_mm_set_epi64x(INT64_C( 2178694225787223581), INT64_C(-7269557775869239549)),
+      simde_mm_set_epi64x(INT64_C( 1698374662664570585), INT64_C( 2677054538142368041)),
+      simde_mm_set_epi64x(INT64_C( 4088982975177379845), INT64_C(-1067629051835102663)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde__m128i r;
+
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x00);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r00);
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x01);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r01);
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x10);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r10);
+    r = simde_mm_clmulepi64_si128(test_vec[i].a, test_vec[i].b, 0x11);
+    simde_assert_m128i_i64(r, ==, test_vec[i].r11);
+  }
+
+  return MUNIT_OK;
+}
+
+#endif /* defined(SIMDE_CLMUL_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
+
+static MunitTest test_suite_tests[] = {
+#if defined(SIMDE_CLMUL_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm_clmulepi64_si128),
+
+#endif /* defined(SIMDE_CLMUL_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
+
+  { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
+};
+
+HEDLEY_C_DECL MunitSuite* SIMDE_TESTS_GENERATE_SYMBOL(suite)(void) {
+  static MunitSuite suite = { (char*) "/" HEDLEY_STRINGIFY(SIMDE_TESTS_CURRENT_ISAX), test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return &suite;
+}
+
+#if defined(SIMDE_TESTS_SINGLE_ISAX)
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  static MunitSuite suite = { "", test_suite_tests, NULL, 1, MUNIT_SUITE_OPTION_NONE };
+
+  return munit_suite_main(&suite, NULL, argc, argv);
+}
+#endif /* defined(SIMDE_TESTS_SINGLE_ISAX) */
+
+HEDLEY_DIAGNOSTIC_POP
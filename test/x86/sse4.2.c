@@ -27,6 +27,892 @@
 
 #if defined(SIMDE_SSE4_2_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
 
+static MunitResult
+test_simde_mm_cmpestra(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(  -2), INT8_C(  99), INT8_C( -31), INT8_C( -32),
+                        INT8_C(  98), INT8_C( -31), INT8_C( 101), INT8_C(  98),
+                        INT8_C(  98), INT8_C(  97), INT8_C(  97), INT8_C( 101),
+                        INT8_C( 101), INT8_C(  98), INT8_C( -32), INT8_C( 100)),
+      15,
+      simde_mm_set_epi8(INT8_C( -31), INT8_C(  97), INT8_C(  99), INT8_C( 101),
+                        INT8_C(  99), INT8_C( -31), INT8_C(  99), INT8_C(  -2),
+                        INT8_C( 101), INT8_C( 100), INT8_C(  -2), INT8_C( -31),
+                        INT8_C( 100), INT8_C( 100), INT8_C(  99), INT8_C( -31)),
+      11,
+      0, 0, 1, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(-128), INT8_C( -32),
+                        INT8_C(-128), INT8_C( 100), INT8_C(-128), INT8_C(  97),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C(  97)),
+      15,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C( -32),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C( 100)),
+      -7,
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(  98), INT8_C(  99), INT8_C(  99), INT8_C(  98),
+                        INT8_C( -32), INT8_C( -31), INT8_C( -32), INT8_C( 101),
+                        INT8_C( 100), INT8_C(  -2), INT8_C(  99), INT8_C(  -2),
+                        INT8_C(  99), INT8_C(  -2), INT8_C(  99), INT8_C(  98)),
+      18,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(  97), INT8_C( -31), INT8_C(  97), INT8_C( 100)),
+      -2,
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(-128), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( -32)),
+      6,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C( -32),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C(  99), INT8_C(-128), INT8_C(  98)),
+      6,
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(  -2), INT8_C(  98), INT8_C(  97), INT8_C( -32),
+                        INT8_C(  97), INT8_C(  -2), INT8_C( -31), INT8_C( -31),
+                        INT8_C(  -2), INT8_C(  98), INT8_C(  97), INT8_C( -31),
+                        INT8_C( -31), INT8_C( 101), INT8_C(  97), INT8_C(  98)),
+      13,
+      simde_mm_set_epi8(INT8_C( 101), INT8_C(  -2), INT8_C( 100), INT8_C(  99),
+                        INT8_C(  98), INT8_C( 101), INT8_C( 101), INT8_C(  -2),
+                        INT8_C( 100), INT8_C(  98), INT8_C(  98), INT8_C( 101),
+                        INT8_C(  -2), INT8_C(  99), INT8_C(  97), INT8_C( 101)),
+      -15,
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(-128), INT8_C(  -2)),
+      -12,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C(  -2)),
+      16,
+      0, 0, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C( 101), INT8_C( -31), INT8_C(  97), INT8_C( 100),
+                        INT8_C( 101), INT8_C(  99), INT8_C( 101), INT8_C( 100),
+                        INT8_C(  -2), INT8_C(  99), INT8_C(  -2), INT8_C(  -2),
+                        INT8_C(  -2), INT8_C(  98), INT8_C(  -2), INT8_C(  99)),
+      9,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  99),
+                        INT8_C(  98), INT8_C( -32), INT8_C( -32), INT8_C( 101)),
+      -20,
+      0, 0, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 100)),
+      -5,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C(  -2)),
+      8,
+      0, 0, 0, 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpestra(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpestra(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpestra(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpestra(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpestra(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrc(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C( 101), INT8_C( 101), INT8_C(  99), INT8_C(  98),
+                        INT8_C(  97), INT8_C(  -2), INT8_C(  -2), INT8_C( -31),
+                        INT8_C( -32), INT8_C( -31), INT8_C( 100), INT8_C( 100),
+                        INT8_C( -32), INT8_C(  97), INT8_C(  99), INT8_C(  99)),
+      5,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C( -31), INT8_C(  98),
+                        INT8_C( -32), INT8_C( 101), INT8_C( 100), INT8_C(  -2),
+                        INT8_C( 101), INT8_C( 101), INT8_C(  99), INT8_C( 101)),
+      2,
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  97)),
+      7,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(-128), INT8_C( -31),
+                        INT8_C(-128), INT8_C( -32), INT8_C(-128), INT8_C(  99)),
+      -10,
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 101), INT8_C( 100), INT8_C( 101),
+                        INT8_C(  97), INT8_C(  97), INT8_C( 100), INT8_C(  97),
+                        INT8_C(  99), INT8_C(  97), INT8_C(  97), INT8_C( -31)),
+      -1,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( -31), INT8_C(  99), INT8_C( -32),
+                        INT8_C( 100), INT8_C(  99), INT8_C( 101), INT8_C( -32),
+                        INT8_C(  98), INT8_C( -32), INT8_C(  99), INT8_C( -31)),
+      20,
+      1, 1, 0, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( -32)),
+      -2,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  -2), INT8_C(-128), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(-128), INT8_C(  98),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( 100)),
+      14,
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C( 101), INT8_C(  97), INT8_C( -32), INT8_C( -32),
+                        INT8_C( -32), INT8_C(  -2), INT8_C(  98), INT8_C( -31),
+                        INT8_C( -32), INT8_C(  98), INT8_C(  98), INT8_C( -31),
+                        INT8_C(  99), INT8_C(  99), INT8_C( 101), INT8_C(  97)),
+      -14,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97)),
+      9,
+      1, 0, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( -31),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C( 101)),
+      15,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C(  97)),
+      15,
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( -31), INT8_C(  99), INT8_C(  97), INT8_C(  99),
+                        INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( -32),
+                        INT8_C( 101), INT8_C( 101), INT8_C(  99), INT8_C(  -2)),
+      19,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(  97), INT8_C(  99), INT8_C( 100), INT8_C( 101),
+                        INT8_C( 100), INT8_C( -31), INT8_C( -32), INT8_C(  99),
+                        INT8_C( 101), INT8_C( 100), INT8_C(  98), INT8_C(  99)),
+      6,
+      1, 0, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  97),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  98)),
+      -6,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C( -31), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  97), INT8_C(-128), INT8_C( 101)),
+      17,
+      1, 1, 1, 1, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpestrc(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpestrc(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpestrc(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpestrc(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpestrc(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestri(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101)),
+      -13,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98)),
+      -13,
+      1, 0, 7, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C( 100)),
+      -20,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C(  99)),
+      -17,
+      1, 0, 1, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101),
+                        INT8_C(  97), INT8_C(  97), INT8_C(  -2), INT8_C(  98),
+                        INT8_C( -32), INT8_C( -32), INT8_C(  -2), INT8_C( -31)),
+      -6,
+      simde_mm_set_epi8(INT8_C( 101), INT8_C(  98), INT8_C(  99), INT8_C( 100),
+                        INT8_C( 100), INT8_C(  97), INT8_C( -31), INT8_C(  98),
+                        INT8_C( 101), INT8_C(  -2), INT8_C(  -2), INT8_C(  98),
+                        INT8_C( -31), INT8_C(  98), INT8_C( -31), INT8_C( 101)),
+      10,
+      1, 0, 8, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  97), INT8_C(-128), INT8_C(  99)),
+      12,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 100)),
+      10,
+      1, 0, 8, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  99),
+                        INT8_C(  98), INT8_C( -31), INT8_C( -32), INT8_C( -32),
+                        INT8_C(  99), INT8_C(  97), INT8_C( -32), INT8_C(  -2),
+                        INT8_C( 100), INT8_C(  98), INT8_C( -32), INT8_C(  -2)),
+      -7,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( 101), INT8_C(  98), INT8_C(  98), INT8_C( -32),
+                        INT8_C( 101), INT8_C( -31), INT8_C(  -2), INT8_C( 100),
+                        INT8_C(  -2), INT8_C( -31), INT8_C(  97), INT8_C( -31)),
+      -1,
+      16, 0, 8, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  98), INT8_C(-128), INT8_C( 101)),
+      4,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  -2)),
+      -4,
+      1, 0, 8, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(  -2), INT8_C(  99), INT8_C( -32), INT8_C(  97),
+                        INT8_C( 100), INT8_C( -31), INT8_C(  -2), INT8_C( -32),
+                        INT8_C(  97), INT8_C(  98), INT8_C(  -2), INT8_C(  99),
+                        INT8_C(  -2), INT8_C(  -2), INT8_C(  -2), INT8_C( -32)),
+      -6,
+      simde_mm_set_epi8(INT8_C(  -2), INT8_C(  99), INT8_C( -31), INT8_C( -32),
+                        INT8_C(  98), INT8_C( -31), INT8_C( -32), INT8_C(  99),
+                        INT8_C(  99), INT8_C(  -2), INT8_C( 100), INT8_C( 101),
+                        INT8_C(  97), INT8_C( -32), INT8_C( -31), INT8_C( -31)),
+      20,
+      2, 3, 8, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  97), INT8_C(-128), INT8_C(  98)),
+      -11,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C(  99),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C(  99)),
+      18,
+      1, 0, 7, 0, 16 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpestri(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpestri(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpestri(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpestri(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpestri(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrm(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    simde__m128i equal_any;
+    simde__m128i ranges;
+    simde__m128i ranges_word;
+    simde__m128i equal_each;
+    simde__m128i equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C( -32), INT8_C( -32),
+                        INT8_C(  -2), INT8_C( -31), INT8_C(  97), INT8_C( -31)),
+      7,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 101), INT8_C( -31), INT8_C( 100),
+                        INT8_C(  97), INT8_C(  97), INT8_C(  97), INT8_C(  99),
+                        INT8_C( 100), INT8_C( 101), INT8_C( 100), INT8_C( 100)),
+      -12,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       2784)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       1311)),
+      simde_mm_set_epi32(INT32_C(         -1), INT32_C(      65535), INT32_C(          0), INT32_C(         -1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        191)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  -2)),
+      -15,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C( -31),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 100)),
+      5,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         14)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         21)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(         -1), INT32_C(         -1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C( 101), INT8_C( 101), INT8_C( -31), INT8_C(  98),
+                        INT8_C(  -2), INT8_C( -31), INT8_C(  -2), INT8_C( -31),
+                        INT8_C(  99), INT8_C( -31), INT8_C( -31), INT8_C( -31)),
+      -2,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 100), INT8_C( -31), INT8_C(  -2)),
+      -11,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          2)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       2045)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C( 100)),
+      13,
+      simde_mm_set_epi8(INT8_C(-128), INT8_C(  -2), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C(  99)),
+      16,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(      47851)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(      63351)),
+      simde_mm_set_epi32(INT32_C(      65535), INT32_C(     -65536), INT32_C(          0), INT32_C(         -1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(  97), INT8_C(  99),
+                        INT8_C( 101), INT8_C( 101), INT8_C( -32), INT8_C(  -2)),
+      8,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( -32), INT8_C(  97), INT8_C( -32), INT8_C( -32),
+                        INT8_C( 100), INT8_C(  97), INT8_C(  97), INT8_C( -32),
+                        INT8_C( -31), INT8_C( -32), INT8_C(  99), INT8_C(  99)),
+      -13,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       8055)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       4095)),
+      simde_mm_set_epi32(INT32_C(         -1), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         63)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( 101),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C( -32),
+                        INT8_C(-128), INT8_C( 100), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C(  -2)),
+      -15,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( -32),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  98)),
+      -2,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          3)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31),
+                        INT8_C( 100), INT8_C( 101), INT8_C(  99), INT8_C( -31),
+                        INT8_C(  99), INT8_C(  -2), INT8_C( -31), INT8_C( 100)),
+      -3,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C( 101), INT8_C( 100)),
+      -11,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       2047)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C( -31),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C( -32)),
+      -5,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97)),
+      13,
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       8190)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        239)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_m128i_i32(simde_mm_cmpestrm(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    simde_assert_m128i_i32(simde_mm_cmpestrm(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    simde_assert_m128i_i32(simde_mm_cmpestrm(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    simde_assert_m128i_i32(simde_mm_cmpestrm(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    simde_assert_m128i_i32(simde_mm_cmpestrm(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestro(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(  98), INT8_C(  -2), INT8_C( 101), INT8_C( 100),
+                        INT8_C(  -2), INT8_C(  -2), INT8_C(  -2), INT8_C( -31)),
+      -8,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 100), INT8_C(  97), INT8_C( -31),
+                        INT8_C(  97), INT8_C( 100), INT8_C(  97), INT8_C(  -2),
+                        INT8_C(  97), INT8_C(  99), INT8_C(  98), INT8_C(  -2)),
+      -17,
+      1, 0, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( -31), INT8_C(-128), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  -2)),
+      11,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  -2), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  98), INT8_C(-128), INT8_C(  99)),
+      6,
+      0, 1, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(  98), INT8_C( 101), INT8_C(  97), INT8_C(  97),
+                        INT8_C( -31), INT8_C(  99), INT8_C(  -2), INT8_C(  -2),
+                        INT8_C(  98), INT8_C( 100), INT8_C( -31), INT8_C( -31),
+                        INT8_C( -31), INT8_C(  97), INT8_C( -31), INT8_C(  97)),
+      16,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)),
+      11,
+      0, 1, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C( -31), INT8_C(-128), INT8_C( -32),
+                        INT8_C(-128), INT8_C(  97), INT8_C(   0), INT8_C(  97)),
+      15,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C(  97),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 100), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  99)),
+      -15,
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C( 101), INT8_C( -31)),
+      12,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(  97), INT8_C(  97),
+                        INT8_C( 100), INT8_C(  98), INT8_C( -32), INT8_C(  97),
+                        INT8_C( 100), INT8_C(  99), INT8_C(  97), INT8_C( 100),
+                        INT8_C( -31), INT8_C(  97), INT8_C(  -2), INT8_C( 101)),
+      -9,
+      1, 0, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C(  97)),
+      -18,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C( 100), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C( 101),
+                        INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C( -32)),
+      -16,
+      0, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(  98), INT8_C( 101), INT8_C( -32), INT8_C(  98),
+                        INT8_C(  97), INT8_C( 101), INT8_C(  97), INT8_C(  -2),
+                        INT8_C(  97), INT8_C( -31), INT8_C( -31), INT8_C( -31),
+                        INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C(  98)),
+      -17,
+      simde_mm_set_epi8(INT8_C(  97), INT8_C(  98), INT8_C( 100), INT8_C( -31),
+                        INT8_C( 101), INT8_C(  -2), INT8_C(  98), INT8_C( -31),
+                        INT8_C(  97), INT8_C(  97), INT8_C( -31), INT8_C( 101),
+                        INT8_C( -31), INT8_C( -32), INT8_C(  -2), INT8_C(  97)),
+      -10,
+      1, 0, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  97)),
+      7,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C( -31), INT8_C(-128), INT8_C(  98),
+                        INT8_C(-128), INT8_C(  99), INT8_C(-128), INT8_C(  97)),
+      20,
+      1, 1, 0, 1, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpestro(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpestro(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpestro(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpestro(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpestro(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrs(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(  98), INT8_C(  -2), INT8_C(  -2), INT8_C(  -2),
+                        INT8_C(  97), INT8_C( 101), INT8_C(  97), INT8_C(  -2),
+                        INT8_C( -31), INT8_C( -31), INT8_C( -32), INT8_C( 101)),
+      -18,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31),
+                        INT8_C( -31), INT8_C( 100), INT8_C( 100), INT8_C( 101),
+                        INT8_C( 100), INT8_C(  -2), INT8_C( -31), INT8_C(  -2),
+                        INT8_C( -31), INT8_C(  99), INT8_C( -31), INT8_C(  -2)),
+      -6,
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C(  97), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C( -32)),
+      -18,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C( -31), INT8_C(-128), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C(  99)),
+      -2,
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C( 100), INT8_C( 100), INT8_C( -31), INT8_C( 101),
+                        INT8_C( -32), INT8_C(  98), INT8_C( -32), INT8_C(  -2),
+                        INT8_C(  97), INT8_C( -32), INT8_C(  97), INT8_C(  -2),
+                        INT8_C(  99), INT8_C(  99), INT8_C(  99), INT8_C( -31)),
+      14,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C( -31), INT8_C( -31),
+                        INT8_C(  99), INT8_C(  -2), INT8_C(  -2), INT8_C(  99),
+                        INT8_C(  99), INT8_C( 100), INT8_C(  99), INT8_C( 101),
+                        INT8_C(  98), INT8_C( 101), INT8_C(  98), INT8_C(  98)),
+      -17,
+      1, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)),
+      -13,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C(  97),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C( -31)),
+      -15,
+      1, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(  97), INT8_C(  99), INT8_C( -31), INT8_C(  97),
+                        INT8_C(  99), INT8_C( -32), INT8_C(  97), INT8_C( -32),
+                        INT8_C(  98), INT8_C( -32), INT8_C(  97), INT8_C(  -2),
+                        INT8_C( 101), INT8_C(  98), INT8_C( 100), INT8_C(  98)),
+      -15,
+      simde_mm_set_epi8(INT8_C( -32), INT8_C(  98), INT8_C( -32), INT8_C( -32),
+                        INT8_C(  97), INT8_C( 100), INT8_C(  -2), INT8_C(  -2),
+                        INT8_C(  98), INT8_C( 100), INT8_C( -31), INT8_C( -31),
+                        INT8_C( -31), INT8_C( -32), INT8_C( 101), INT8_C( 100)),
+      11,
+      1, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( -32)),
+      0,
+      simde_mm_set_epi8(INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C( -32), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  97)),
+      -9,
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(  98), INT8_C(  97), INT8_C( -32), INT8_C( -32),
+                        INT8_C(  97), INT8_C( 100), INT8_C( -31), INT8_C(  97),
+                        INT8_C(  -2), INT8_C(  97), INT8_C(  97), INT8_C(  99)),
+      2,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( -32), INT8_C( 100), INT8_C(  -2), INT8_C(  97),
+                        INT8_C(  98), INT8_C( -31), INT8_C( 100), INT8_C(  98),
+                        INT8_C( 100), INT8_C(  99), INT8_C( -31), INT8_C(  -2)),
+      -16,
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( 101)),
+      13,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  97), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( -32)),
+      -11,
+      1, 1, 0, 0, 1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpestrs(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpestrs(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpestrs(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpestrs(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpestrs(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpestrz(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    int la;
+    simde__m128i b;
+    int lb;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101),
+                        INT8_C(  98), INT8_C(  97), INT8_C(  98), INT8_C( 100),
+                        INT8_C(  98), INT8_C(  -2), INT8_C(  -2), INT8_C( -32)),
+      10,
+      simde_mm_set_epi8(INT8_C( -32), INT8_C( -31), INT8_C(  -2), INT8_C( -31),
+                        INT8_C( -32), INT8_C( 100), INT8_C(  97), INT8_C(  -2),
+                        INT8_C(  97), INT8_C( 100), INT8_C(  97), INT8_C(  99),
+                        INT8_C(  98), INT8_C(  99), INT8_C( 101), INT8_C( 101)),
+      -19,
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  99),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  -2)),
+      11,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  98)),
+      4,
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  98), INT8_C( 100), INT8_C(  99),
+                        INT8_C( -32), INT8_C( -32), INT8_C( 101), INT8_C(  99),
+                        INT8_C(  99), INT8_C(  99), INT8_C(  97), INT8_C( -32)),
+      -20,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101)),
+      9,
+      1, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( 100)),
+      -19,
+      simde_mm_set_epi8(INT8_C(-128), INT8_C(  97), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C( -31), INT8_C(-128), INT8_C( 100),
+                        INT8_C(   0), INT8_C( 100), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( -31)),
+      11,
+      1, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 100), INT8_C(  98), INT8_C(  -2),
+                        INT8_C(  97), INT8_C( -32), INT8_C( -32), INT8_C(  -2),
+                        INT8_C( 101), INT8_C( 101), INT8_C(  97), INT8_C(  98)),
+      7,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( -31), INT8_C( -32), INT8_C(  98),
+                        INT8_C(  97), INT8_C(  -2), INT8_C(  99), INT8_C( -32),
+                        INT8_C( -31), INT8_C(  99), INT8_C( -32), INT8_C( 101)),
+      13,
+      1, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C( -32)),
+      4,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  97)),
+      4,
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -32),
+                        INT8_C(  98), INT8_C( 100), INT8_C( 101), INT8_C(  99),
+                        INT8_C( 100), INT8_C(  97), INT8_C( 101), INT8_C(  -2)),
+      7,
+      simde_mm_set_epi8(INT8_C( 100), INT8_C( -31), INT8_C( 101), INT8_C(  -2),
+                        INT8_C(  99), INT8_C(  99), INT8_C( 100), INT8_C( -32),
+                        INT8_C(  98), INT8_C(  -2), INT8_C(  99), INT8_C(  99),
+                        INT8_C(  -2), INT8_C(  -2), INT8_C(  99), INT8_C( -32)),
+      5,
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  98)),
+      3,
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( -31),
+                        INT8_C(-128), INT8_C(  97), INT8_C(   0), INT8_C( 101)),
+      -13,
+      1, 1, 0, 0, 1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpestrz(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpestrz(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpestrz(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpestrz(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpestrz(test_vec[i].a, test_vec[i].la, test_vec[i].b, test_vec[i].lb,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
 static MunitResult
 test_simde_mm_cmpgt_epi64(const MunitParameter params[], void* data) {
   (void) params;
@@ -71,6 +957,942 @@ test_simde_mm_cmpgt_epi64(const MunitParameter params[], void* data) {
   return MUNIT_OK;
 }
 
+static MunitResult
+test_simde_mm_cmpistra(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C( 100), INT8_C(  99),
+                        INT8_C(  97), INT8_C( -32), INT8_C(  97), INT8_C( -31),
+                        INT8_C( -32), INT8_C(  99), INT8_C(  97), INT8_C(  -2),
+                        INT8_C( -32), INT8_C( 101), INT8_C( 100), INT8_C( -32)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97),
+                        INT8_C(  97), INT8_C( 100), INT8_C(  97), INT8_C(  -2),
+                        INT8_C(  -2), INT8_C( 101), INT8_C(  -2), INT8_C(  97),
+                        INT8_C( 101), INT8_C( 100), INT8_C( 101), INT8_C(  99)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 100)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C( 101), INT8_C(  -2), INT8_C( -31), INT8_C( -31),
+                        INT8_C( -32), INT8_C(  -2), INT8_C( -32), INT8_C( -32),
+                        INT8_C( 100), INT8_C( 101), INT8_C( 101), INT8_C(  98),
+                        INT8_C(  -2), INT8_C(  97), INT8_C( 101), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( 101)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( -32), INT8_C( 100), INT8_C( 100), INT8_C( -32),
+                        INT8_C( -32), INT8_C(  97), INT8_C( -31), INT8_C( 100)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31),
+                        INT8_C( -32), INT8_C( 100), INT8_C( 100), INT8_C(  99),
+                        INT8_C(  98), INT8_C( -32), INT8_C( -32), INT8_C(  98)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C( -32), INT8_C(-128), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( -32),
+                        INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( -32)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C( -31), INT8_C( -32), INT8_C( 100), INT8_C(  -2),
+                        INT8_C( 101), INT8_C( 101), INT8_C(  -2), INT8_C( -31),
+                        INT8_C(  -2), INT8_C(  97), INT8_C( -31), INT8_C( 101),
+                        INT8_C( -31), INT8_C(  99), INT8_C(  -2), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C( -32), INT8_C( -32), INT8_C(  98), INT8_C(  98),
+                        INT8_C(  97), INT8_C(  99), INT8_C( -32), INT8_C( 101),
+                        INT8_C(  98), INT8_C( 100), INT8_C( -32), INT8_C( -31),
+                        INT8_C(  97), INT8_C( 101), INT8_C( 101), INT8_C(  97)),
+      0, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 100)),
+      0, 0, 0, 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpistra(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpistra(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpistra(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpistra(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpistra(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrc(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( -31), INT8_C( 100), INT8_C(  -2), INT8_C( 100),
+                        INT8_C( -32), INT8_C(  97), INT8_C(  98), INT8_C(  99),
+                        INT8_C( -32), INT8_C(  97), INT8_C( 101), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(  97), INT8_C( -31), INT8_C( -32), INT8_C( 100),
+                        INT8_C( -31), INT8_C( -32), INT8_C(  98), INT8_C(  98),
+                        INT8_C(  99), INT8_C(  98), INT8_C( 100), INT8_C( -31),
+                        INT8_C(  98), INT8_C(  98), INT8_C( 100), INT8_C(  99)),
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( -31),
+                        INT8_C(-128), INT8_C( 100), INT8_C(   0), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C( -32), INT8_C(-128), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( 101)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(  99), INT8_C( -31),
+                        INT8_C( 101), INT8_C(  -2), INT8_C(  -2), INT8_C(  97),
+                        INT8_C(  98), INT8_C(  97), INT8_C(  -2), INT8_C(  -2),
+                        INT8_C(  97), INT8_C( -32), INT8_C(  99), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C( 100), INT8_C( -32), INT8_C(  99), INT8_C( 101),
+                        INT8_C( 101), INT8_C(  -2), INT8_C( 101), INT8_C( 100)),
+      1, 0, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 100)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( -32)),
+      0, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(  98), INT8_C( -32), INT8_C(  97), INT8_C(  -2),
+                        INT8_C( -31), INT8_C(  97), INT8_C( 100), INT8_C(  97),
+                        INT8_C( 100), INT8_C( 100), INT8_C(  99), INT8_C( -32),
+                        INT8_C(  98), INT8_C(  -2), INT8_C( -32), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(  97), INT8_C( -31), INT8_C( 100), INT8_C(  -2),
+                        INT8_C( 101), INT8_C(  98), INT8_C(  98), INT8_C(  97),
+                        INT8_C( 101), INT8_C( 101), INT8_C(  98), INT8_C( -31),
+                        INT8_C(  97), INT8_C( -31), INT8_C(  -2), INT8_C(  -2)),
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 100)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  99),
+                        INT8_C(-128), INT8_C( -31), INT8_C(-128), INT8_C(  98)),
+      0, 1, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(  99), INT8_C(  -2), INT8_C( 100), INT8_C( -31),
+                        INT8_C( 101), INT8_C( -31), INT8_C(  99), INT8_C( -31),
+                        INT8_C(  97), INT8_C( -31), INT8_C(  -2), INT8_C( 101),
+                        INT8_C( -31), INT8_C( 100), INT8_C( -32), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(  98), INT8_C(  97), INT8_C( 101), INT8_C( -31),
+                        INT8_C(  99), INT8_C( -31), INT8_C( -31), INT8_C( 101),
+                        INT8_C(  99), INT8_C(  -2), INT8_C( -32), INT8_C( -32),
+                        INT8_C(  -2), INT8_C( 101), INT8_C( -31), INT8_C( -32)),
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C(  97), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C( -31),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( -32),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C(  97)),
+      0, 1, 1, 1, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpistrc(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpistrc(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpistrc(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpistrc(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpistrc(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistri(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C( -32), INT8_C( -32),
+                        INT8_C(  -2), INT8_C( -31), INT8_C(  97), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 101), INT8_C( -31), INT8_C( 100),
+                        INT8_C(  97), INT8_C(  97), INT8_C(  97), INT8_C(  99),
+                        INT8_C( 100), INT8_C( 101), INT8_C( 100), INT8_C( 100)),
+      5, 0, 4, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( -32)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 100), INT8_C(-128), INT8_C( 101),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  99)),
+      16, 0, 5, 0, 16 },
+    { simde_mm_set_epi8(INT8_C( 101), INT8_C( 101), INT8_C( -31), INT8_C(  98),
+                        INT8_C(  -2), INT8_C( -31), INT8_C(  -2), INT8_C( -31),
+                        INT8_C(  99), INT8_C( -31), INT8_C( -31), INT8_C( -31),
+                        INT8_C( 101), INT8_C(  99), INT8_C( 101), INT8_C(  -2)),
+      simde_mm_set_epi8(INT8_C(  -2), INT8_C( -31), INT8_C(  -2), INT8_C( 100),
+                        INT8_C(  98), INT8_C(  98), INT8_C(  97), INT8_C( -32),
+                        INT8_C( 100), INT8_C( -31), INT8_C(  -2), INT8_C(  99),
+                        INT8_C(  99), INT8_C( -31), INT8_C(  -2), INT8_C(  97)),
+      1, 8, 7, 0, 15 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -32)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 100), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C( -32)),
+      0, 0, 8, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  99),
+                        INT8_C(  -2), INT8_C(  98), INT8_C(  97), INT8_C( 101),
+                        INT8_C( -32), INT8_C(  97), INT8_C( -31), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(  97), INT8_C(  97), INT8_C( -32), INT8_C( -31),
+                        INT8_C( -32), INT8_C(  99), INT8_C(  99), INT8_C( 101),
+                        INT8_C(  99), INT8_C( -31), INT8_C( 100), INT8_C( -32),
+                        INT8_C(  97), INT8_C(  99), INT8_C( 100), INT8_C( 101)),
+      0, 0, 6, 0, 15 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( -32)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  98)),
+      16, 0, 7, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  98), INT8_C( -31), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C( 101), INT8_C( -31),
+                        INT8_C( 100), INT8_C( 101), INT8_C(  99), INT8_C( -31)),
+      0, 0, 8, 0, 16 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C(  97), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( 100)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C(  97),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C( -32),
+                        INT8_C(-128), INT8_C( -31), INT8_C(-128), INT8_C(  -2)),
+      16, 0, 7, 0, 16 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpistri(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpistri(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpistri(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpistri(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpistri(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrm(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    simde__m128i equal_any;
+    simde__m128i ranges;
+    simde__m128i ranges_word;
+    simde__m128i equal_each;
+    simde__m128i equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(  99), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97),
+                        INT8_C(  99), INT8_C( -31), INT8_C(  98), INT8_C(  97)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         10)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         21)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          7)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 100), INT8_C(-128), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  98), INT8_C(-128), INT8_C(  98)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          5)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          7)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(     -65536)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        247)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(   16711935)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(  97), INT8_C( 101),
+                        INT8_C( 101), INT8_C(  98), INT8_C( 100), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(  99), INT8_C( -31), INT8_C(  98), INT8_C( -32),
+                        INT8_C(  99), INT8_C( -32), INT8_C(  -2), INT8_C( 101),
+                        INT8_C( -32), INT8_C(  99), INT8_C(  97), INT8_C( 101),
+                        INT8_C(  97), INT8_C(  99), INT8_C( 100), INT8_C(  99)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       8506)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(      22184)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        251)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C( 100), INT8_C(   0), INT8_C( -32)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C( -32)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          5)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          7)),
+      simde_mm_set_epi32(INT32_C(      65535), INT32_C(         -1), INT32_C(         -1), INT32_C(         -1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        243)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(   16711935)) },
+    { simde_mm_set_epi8(INT8_C( -31), INT8_C(  98), INT8_C(  99), INT8_C(  98),
+                        INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 100),
+                        INT8_C( -32), INT8_C( -32), INT8_C( -32), INT8_C( 101),
+                        INT8_C(  99), INT8_C(  99), INT8_C(  99), INT8_C(  99)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 101), INT8_C(  97), INT8_C( -31),
+                        INT8_C( -32), INT8_C(  98), INT8_C(  99), INT8_C( -32),
+                        INT8_C(  97), INT8_C( -31), INT8_C( -31), INT8_C( 100)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(       1527)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        782)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(         -1), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( 100),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C(  -2)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C( 100)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(         -1), INT32_C(     -65536), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C( 100), INT8_C(  99)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(  99), INT8_C(  98), INT8_C(  99), INT8_C( 101),
+                        INT8_C(  97), INT8_C( 100), INT8_C( -31), INT8_C(  97)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        164)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         91)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(         15)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 100),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C( 100),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( -31)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          1)),
+      simde_mm_set_epi32(INT32_C(     -65536), INT32_C(      65535), INT32_C(          0), INT32_C(         -1)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(        255)),
+      simde_mm_set_epi32(INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    simde_assert_m128i_i32(simde_mm_cmpistrm(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    simde_assert_m128i_i32(simde_mm_cmpistrm(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    simde_assert_m128i_i32(simde_mm_cmpistrm(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    simde_assert_m128i_i32(simde_mm_cmpistrm(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    simde_assert_m128i_i32(simde_mm_cmpistrm(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistro(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(  98), INT8_C(  -2), INT8_C(  -2), INT8_C(  -2),
+                        INT8_C(  97), INT8_C( 101), INT8_C(  97), INT8_C(  -2),
+                        INT8_C( -31), INT8_C( -31), INT8_C( -32), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31),
+                        INT8_C( -31), INT8_C( 100), INT8_C( 100), INT8_C( 101),
+                        INT8_C( 100), INT8_C(  -2), INT8_C( -31), INT8_C(  -2),
+                        INT8_C( -31), INT8_C(  99), INT8_C( -31), INT8_C(  -2)),
+      1, 0, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( 101), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 101),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C(  98), INT8_C(   0), INT8_C(  -2)),
+      0, 1, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(  99), INT8_C(  -2),
+                        INT8_C(  -2), INT8_C(  99), INT8_C(  99), INT8_C( 100),
+                        INT8_C(  99), INT8_C( 101), INT8_C(  98), INT8_C( 101),
+                        INT8_C(  98), INT8_C(  98), INT8_C( -32), INT8_C( 100)),
+      0, 1, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( -32),
+                        INT8_C(   0), INT8_C( 100), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(-128), INT8_C( -32),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( 100)),
+      0, 1, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( -32), INT8_C( -32), INT8_C( -32), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -31),
+                        INT8_C( -32), INT8_C( 101), INT8_C( 100), INT8_C( 101),
+                        INT8_C(  97), INT8_C(  99), INT8_C( -31), INT8_C(  97)),
+      0, 1, 0, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  97),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C( -32)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  98)),
+      0, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(  97), INT8_C( 100), INT8_C( -31), INT8_C(  97),
+                        INT8_C(  -2), INT8_C(  97), INT8_C(  97), INT8_C(  99),
+                        INT8_C( 100), INT8_C(  97), INT8_C( -31), INT8_C( 101),
+                        INT8_C(  98), INT8_C(  99), INT8_C( -32), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C( -31), INT8_C( 100), INT8_C(  98), INT8_C( 100),
+                        INT8_C(  99), INT8_C( -31), INT8_C(  -2), INT8_C(  98),
+                        INT8_C( -32), INT8_C( -31), INT8_C( -32), INT8_C( 100),
+                        INT8_C( -31), INT8_C(  98), INT8_C(  97), INT8_C( -32)),
+      1, 1, 1, 1, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(-128), INT8_C( -32), INT8_C(   0), INT8_C( 100)),
+      0, 1, 0, 1, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpistro(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpistro(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpistro(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpistro(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpistro(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrs(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -32),
+                        INT8_C(  98), INT8_C(  98), INT8_C(  97), INT8_C( -32),
+                        INT8_C(  -2), INT8_C(  97), INT8_C(  99), INT8_C(  99)),
+      simde_mm_set_epi8(INT8_C( 100), INT8_C( -31), INT8_C( -32), INT8_C(  99),
+                        INT8_C(  -2), INT8_C(  97), INT8_C( 100), INT8_C(  99),
+                        INT8_C( -32), INT8_C(  98), INT8_C( 100), INT8_C(  97),
+                        INT8_C( -32), INT8_C( 100), INT8_C( -32), INT8_C(  97)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( -32)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(  97), INT8_C(  97), INT8_C(  98), INT8_C( 100),
+                        INT8_C( -31), INT8_C( 100), INT8_C(  99), INT8_C( -31),
+                        INT8_C(  -2), INT8_C( -31), INT8_C(  -2), INT8_C( -31),
+                        INT8_C( 100), INT8_C(  98), INT8_C( 100), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -32),
+                        INT8_C(  -2), INT8_C(  99), INT8_C( -32), INT8_C( -31)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( 100)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C( -32), INT8_C(  97), INT8_C(  99), INT8_C(  -2),
+                        INT8_C(  -2), INT8_C(  98), INT8_C(  99), INT8_C( 101),
+                        INT8_C(  -2), INT8_C( 101), INT8_C( -32), INT8_C( -31),
+                        INT8_C(  -2), INT8_C( 100), INT8_C(  97), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C( -31), INT8_C( 100), INT8_C( 100), INT8_C( -32)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  99), INT8_C(   0), INT8_C(  97),
+                        INT8_C(-128), INT8_C(  -2), INT8_C(   0), INT8_C( -31),
+                        INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C( -31),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  98)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(  98), INT8_C(  -2)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C( -32), INT8_C(-128), INT8_C(  -2),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C( -32)),
+      1, 1, 1, 1, 1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpistrs(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpistrs(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpistrs(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpistrs(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpistrs(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_cmpistrz(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int equal_any;
+    int ranges;
+    int ranges_word;
+    int equal_each;
+    int equal_ordered;
+  } test_vec[8] = {
+    { simde_mm_set_epi8(INT8_C(  98), INT8_C( 101), INT8_C( 101), INT8_C( 101),
+                        INT8_C( 101), INT8_C(  98), INT8_C( -31), INT8_C( -32),
+                        INT8_C(  -2), INT8_C( 101), INT8_C(  98), INT8_C( -31),
+                        INT8_C(  97), INT8_C( -32), INT8_C( -31), INT8_C(  99)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(  -2), INT8_C( -32),
+                        INT8_C( 100), INT8_C(  99), INT8_C( 100), INT8_C( 101),
+                        INT8_C(  -2), INT8_C(  98), INT8_C( -31), INT8_C(  -2),
+                        INT8_C( -31), INT8_C(  -2), INT8_C(  -2), INT8_C(  99)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  -2), INT8_C(-128), INT8_C(  99),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C( -32), INT8_C(   0), INT8_C(  97),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(  97), INT8_C(  98), INT8_C( 100), INT8_C(  -2),
+                        INT8_C( 100), INT8_C(  97), INT8_C( 101), INT8_C(  99),
+                        INT8_C( 100), INT8_C(  98), INT8_C( -31), INT8_C(  97),
+                        INT8_C(  98), INT8_C(  -2), INT8_C( 100), INT8_C( -32)),
+      simde_mm_set_epi8(INT8_C( 100), INT8_C( 101), INT8_C(  98), INT8_C(  97),
+                        INT8_C(  99), INT8_C( 100), INT8_C( -31), INT8_C( -32),
+                        INT8_C( -31), INT8_C(  98), INT8_C( 100), INT8_C( 100),
+                        INT8_C( 101), INT8_C( 100), INT8_C(  -2), INT8_C( 100)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  99)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(  97), INT8_C( 100), INT8_C(  -2), INT8_C(  97),
+                        INT8_C(  97), INT8_C( 100), INT8_C(  98), INT8_C( 100),
+                        INT8_C( -32), INT8_C(  98), INT8_C(  97), INT8_C( 100),
+                        INT8_C(  97), INT8_C( 101), INT8_C(  99), INT8_C( -31)),
+      simde_mm_set_epi8(INT8_C(  98), INT8_C(  99), INT8_C(  -2), INT8_C( 100),
+                        INT8_C(  -2), INT8_C(  99), INT8_C( -32), INT8_C( 101),
+                        INT8_C(  99), INT8_C( 100), INT8_C(  97), INT8_C(  -2),
+                        INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C(  -2)),
+      0, 0, 0, 0, 0 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( -32),
+                        INT8_C(-128), INT8_C( 101), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C(  97)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C(  -2),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C( -32),
+                        INT8_C(-128), INT8_C(  99), INT8_C(   0), INT8_C(  98),
+                        INT8_C(-128), INT8_C( -31), INT8_C(   0), INT8_C( -31)),
+      1, 1, 0, 0, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C( 101)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+                        INT8_C( -31), INT8_C(  97), INT8_C( 100), INT8_C( 100),
+                        INT8_C( -32), INT8_C( 100), INT8_C(  99), INT8_C(  -2)),
+      1, 1, 1, 1, 1 },
+    { simde_mm_set_epi8(INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  99), INT8_C(-128), INT8_C( -31),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  97),
+                        INT8_C(   0), INT8_C( -31), INT8_C(   0), INT8_C(  98)),
+      simde_mm_set_epi8(INT8_C(   0), INT8_C( 101), INT8_C(   0), INT8_C( 101),
+                        INT8_C(   0), INT8_C(  -2), INT8_C(   0), INT8_C(  99),
+                        INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  98),
+                        INT8_C(   0), INT8_C( 100), INT8_C(   0), INT8_C( -32)),
+      1, 1, 0, 0, 1 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    munit_assert_int(simde_mm_cmpistrz(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), ==, test_vec[i].equal_any);
+    munit_assert_int(simde_mm_cmpistrz(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), ==, test_vec[i].ranges);
+    munit_assert_int(simde_mm_cmpistrz(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].ranges_word);
+    munit_assert_int(simde_mm_cmpistrz(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), ==, test_vec[i].equal_each);
+    munit_assert_int(simde_mm_cmpistrz(test_vec[i].a, test_vec[i].b,
+        SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), ==, test_vec[i].equal_ordered);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u8(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t crc;
+    uint8_t v;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(2354857082),
+      UINT8_C( 53),
+      UINT32_C( 535068124) },
+    { UINT32_C(2365699235),
+      UINT8_C(112),
+      UINT32_C(3222148075) },
+    { UINT32_C(3001914898),
+      UINT8_C(215),
+      UINT32_C(4140752718) },
+    { UINT32_C(3169823266),
+      UINT8_C(137),
+      UINT32_C( 998175031) },
+    { UINT32_C( 573483958),
+      UINT8_C(202),
+      UINT32_C(1022997878) },
+    { UINT32_C(3483121865),
+      UINT8_C( 22),
+      UINT32_C(2366587319) },
+    { UINT32_C(3334989914),
+      UINT8_C(239),
+      UINT32_C(2267193661) },
+    { UINT32_C(1622102954),
+      UINT8_C(142),
+      UINT32_C(3880236690) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm_crc32_u8(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u16(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t crc;
+    uint16_t v;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C(3575731150),
+      UINT16_C(64424),
+      UINT32_C(3250670716) },
+    { UINT32_C(2358071702),
+      UINT16_C(44299),
+      UINT32_C(3122076995) },
+    { UINT32_C( 732061206),
+      UINT16_C(59539),
+      UINT32_C( 845135313) },
+    { UINT32_C(4023919763),
+      UINT16_C(45006),
+      UINT32_C( 462516749) },
+    { UINT32_C(3299040660),
+      UINT16_C(45407),
+      UINT32_C(  55899317) },
+    { UINT32_C(2630431672),
+      UINT16_C(62805),
+      UINT32_C(1582282761) },
+    { UINT32_C(2343106946),
+      UINT16_C( 8704),
+      UINT32_C(2531003183) },
+    { UINT32_C(2768709100),
+      UINT16_C(52138),
+      UINT32_C(3650102540) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm_crc32_u16(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u32(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint32_t crc;
+    uint32_t v;
+    uint32_t r;
+  } test_vec[8] = {
+    { UINT32_C( 243140684),
+      UINT32_C(2595476484),
+      UINT32_C(1448558888) },
+    { UINT32_C(1920374553),
+      UINT32_C(2207966122),
+      UINT32_C(1868224000) },
+    { UINT32_C(3705111670),
+      UINT32_C(4113161859),
+      UINT32_C(1234686040) },
+    { UINT32_C( 704159108),
+      UINT32_C(4063634677),
+      UINT32_C(1965484392) },
+    { UINT32_C(1307197177),
+      UINT32_C(2754515215),
+      UINT32_C(4095531280) },
+    { UINT32_C(3201914691),
+      UINT32_C(3600489299),
+      UINT32_C(3150157436) },
+    { UINT32_C(3254290287),
+      UINT32_C(3830895092),
+      UINT32_C( 738953258) },
+    { UINT32_C(4273015061),
+      UINT32_C(1304299259),
+      UINT32_C( 381625003) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint32_t r = simde_mm_crc32_u32(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint32(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
+static MunitResult
+test_simde_mm_crc32_u64(const MunitParameter params[], void* data) {
+  (void) params;
+  (void) data;
+
+  const struct {
+    uint64_t crc;
+    uint64_t v;
+    uint64_t r;
+  } test_vec[8] = {
+    { UINT64_C( 5411629108959652944),
+      UINT64_C(15868522132201967449),
+      UINT64_C(          1203364964) },
+    { UINT64_C( 4737996908936830619),
+      UINT64_C( 4129154864883732335),
+      UINT64_C(          2963437640) },
+    { UINT64_C(16911940012105188159),
+      UINT64_C(15361710633766631117),
+      UINT64_C(          1823109911) },
+    { UINT64_C(16329324238088152648),
+      UINT64_C( 7837288739077081741),
+      UINT64_C(          1448905175) },
+    { UINT64_C(15990186206116770194),
+      UINT64_C(15612631745653457894),
+      UINT64_C(          2962874123) },
+    { UINT64_C(17790694023294271785),
+      UINT64_C( 2145645648721523523),
+      UINT64_C(           200174695) },
+    { UINT64_C(14581002437382470975),
+      UINT64_C(11801837904048856959),
+      UINT64_C(          4162055808) },
+    { UINT64_C( 1679179148499027870),
+      UINT64_C(17315482085537165613),
+      UINT64_C(          3834869402) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
+    uint64_t r = simde_mm_crc32_u64(test_vec[i].crc, test_vec[i].v);
+    munit_assert_uint64(r, ==, test_vec[i].r);
+  }
+
+  return MUNIT_OK;
+}
+
 #endif /* defined(SIMDE_SSE4_2_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
 
 HEDLEY_DIAGNOSTIC_PUSH
@@ -78,7 +1900,26 @@ HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
 
 static MunitTest test_suite_tests[] = {
 #if defined(SIMDE_SSE4_2_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS)
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpestra),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpestrc),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpestri),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpestrm),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpestro),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpestrs),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpestrz),
   SIMDE_TESTS_DEFINE_TEST(mm_cmpgt_epi64),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpistra),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpistrc),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpistri),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpistrm),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpistro),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpistrs),
+  SIMDE_TESTS_DEFINE_TEST(mm_cmpistrz),
+  SIMDE_TESTS_DEFINE_TEST(mm_crc32_u8),
+  SIMDE_TESTS_DEFINE_TEST(mm_crc32_u16),
+  SIMDE_TESTS_DEFINE_TEST(mm_crc32_u32),
+  SIMDE_TESTS_DEFINE_TEST(mm_crc32_u64),
+
 #endif /* defined(SIMDE_SSE4_2_NATIVE) || defined(SIMDE_NO_NATIVE) || defined(SIMDE_ALWAYS_BUILD_NATIVE_TESTS) */
 
   { NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
@@ -30,6 +30,12 @@
   simde_assert_vec_equal(a, b, simde__m256i)
 #define simde_assert_m256d_equal(a, b) \
   simde_assert_vec_equal(a, b, simde__m256d)
+#define simde_assert_m512_equal(a, b) \
+  simde_assert_vec_equal(a, b, simde__m512)
+#define simde_assert_m512i_equal(a, b) \
+  simde_assert_vec_equal(a, b, simde__m512i)
+#define simde_assert_m512d_equal(a, b) \
+  simde_assert_vec_equal(a, b, simde__m512d)
 
 /* Assert that every integer in two vectors are equal */
 #define simde_assert_vec_i(a, op, b, T, accessor, fmt) do { \
@@ -183,11 +189,20 @@ SIMDE_TESTS_GENERATE_SUITE_GETTERS(sse3);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(ssse3);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(sse4_1);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(sse4_2);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(aes);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(fma);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx2);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512f);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512bitalg);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512bw);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512cd);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512dq);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512vbmi);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512vl);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512vnni);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(avx512vpopcntdq);
+SIMDE_TESTS_GENERATE_SUITE_GETTERS(clmul);
 SIMDE_TESTS_GENERATE_SUITE_GETTERS(svml);
 
 HEDLEY_END_C_DECLS
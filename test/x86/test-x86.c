@@ -19,7 +19,7 @@
 
 MunitSuite*
 simde_tests_x86_get_suite(void) {
-  static MunitSuite children[(13 * SUITES_PER_ISAX) + 1];
+  static MunitSuite children[(22 * SUITES_PER_ISAX) + 1];
   static MunitSuite suite = { "/x86", NULL, children, 1, MUNIT_SUITE_OPTION_NONE };
   static const MunitSuite empty = { NULL, NULL, NULL, 1, MUNIT_SUITE_OPTION_NONE };
 
@@ -32,11 +32,20 @@ simde_tests_x86_get_suite(void) {
   SET_CHILDREN_FOR_ARCH(ssse3);
   SET_CHILDREN_FOR_ARCH(sse4_1);
   SET_CHILDREN_FOR_ARCH(sse4_2);
+  SET_CHILDREN_FOR_ARCH(aes);
   SET_CHILDREN_FOR_ARCH(avx);
   SET_CHILDREN_FOR_ARCH(fma);
   SET_CHILDREN_FOR_ARCH(avx2);
   SET_CHILDREN_FOR_ARCH(avx512f);
+  SET_CHILDREN_FOR_ARCH(avx512bitalg);
   SET_CHILDREN_FOR_ARCH(avx512bw);
+  SET_CHILDREN_FOR_ARCH(avx512cd);
+  SET_CHILDREN_FOR_ARCH(avx512dq);
+  SET_CHILDREN_FOR_ARCH(avx512vbmi);
+  SET_CHILDREN_FOR_ARCH(avx512vl);
+  SET_CHILDREN_FOR_ARCH(avx512vnni);
+  SET_CHILDREN_FOR_ARCH(avx512vpopcntdq);
+  SET_CHILDREN_FOR_ARCH(clmul);
   SET_CHILDREN_FOR_ARCH(svml);
 
   children[i++] = empty;